@@ -20,6 +20,7 @@
 #ifndef LC_PKCS7_COMMON_H
 #define LC_PKCS7_COMMON_H
 
+#include "lc_sha3.h"
 #include "lc_x509_common.h"
 
 #ifdef __cplusplus
@@ -27,8 +28,24 @@ extern "C" {
 #endif
 
 /// \cond DO_NOT_DOCUMENT
+#define LC_PKCS7_VERIFY_CACHE_ENTRIES 64
+struct lc_pkcs7_verify_cache {
+	uint8_t digest[LC_PKCS7_VERIFY_CACHE_ENTRIES][LC_SHA3_256_SIZE_DIGEST];
+	unsigned int entries;
+	unsigned int next;
+};
+
+#define LC_PKCS7_TRUST_STORE_BUCKETS 256
 struct lc_pkcs7_trust_store {
 	struct lc_x509_certificate *anchor_cert;
+	struct lc_pkcs7_verify_cache *verify_cache;
+
+	/*
+	 * Hash index of the anchors by issuer + serial number and by the
+	 * subject key ID.
+	 */
+	struct lc_x509_certificate *id_index[LC_PKCS7_TRUST_STORE_BUCKETS];
+	struct lc_x509_certificate *skid_index[LC_PKCS7_TRUST_STORE_BUCKETS];
 };
 
 struct lc_pkcs7_signed_info {
@@ -109,6 +126,13 @@ struct lc_pkcs7_message {
 	unsigned int embed_data : 1; /* Embed data into message */
 };
 
+#define LC_PKCS7_STREAM_MAX_HASHES 4
+struct lc_pkcs7_verify_stream {
+	struct lc_pkcs7_message *pkcs7;
+	struct lc_hash_ctx *hash_ctx[LC_PKCS7_STREAM_MAX_HASHES];
+	unsigned int num_hash_ctx;
+};
+
 /// \endcond
 
 /**
@@ -212,6 +212,52 @@ int lc_pkcs7_verify(struct lc_pkcs7_message *pkcs7,
 		    const struct lc_pkcs7_trust_store *trust_store,
 		    const struct lc_verify_rules *verify_rules);
 
+struct lc_pkcs7_executor {
+	/**
+	 * Execute the jobs \p job(job_ctx, idx) for all idx from 0 to
+	 * \p num_jobs - 1. The jobs are independent of each other and thus
+	 * may be executed concurrently and in any order. The function must
+	 * only return after all jobs are completed.
+	 */
+	void (*run)(void *executor_ctx,
+		    void (*job)(void *job_ctx, unsigned int idx), void *job_ctx,
+		    unsigned int num_jobs);
+
+	/**
+	 * Context provided to the \p run callback.
+	 */
+	void *executor_ctx;
+};
+
+/**
+ * @ingroup PKCS7
+ * @brief Verify a PKCS#7 message with concurrent signature checks
+ *
+ * The verification is identical to \p lc_pkcs7_verify, but the signature
+ * checks of all signers and of the certificates in their certificate chains
+ * are handed to the \p executor as independent jobs. For example, the
+ * executor can distribute the jobs to a thread pool. A message signed with
+ * multiple signers then only requires the time of the slowest signature
+ * chain instead of the sum of all of them.
+ *
+ * The returned error is the same as returned by \p lc_pkcs7_verify
+ * independent of the order the jobs are executed in.
+ *
+ * @param [in] pkcs7 The PKCS#7 message to be verified
+ * @param [in] trust_store Trust store with trust anchor certificates - see
+ *			   \p lc_pkcs7_verify
+ * @param [in] verify_rules If non-NULL, the given rules are applied during
+ *			    certificate verification.
+ * @param [in] executor Executor for the signature checks - if it is NULL, the
+ *			signature checks are executed sequentially
+ *
+ * @return 0 on success or < 0 on error - see \p lc_pkcs7_verify
+ */
+int lc_pkcs7_verify_parallel(struct lc_pkcs7_message *pkcs7,
+			     const struct lc_pkcs7_trust_store *trust_store,
+			     const struct lc_verify_rules *verify_rules,
+			     const struct lc_pkcs7_executor *executor);
+
 /**
  * @ingroup PKCS7
  * @brief Supply the data needed to verify a PKCS#7 message
@@ -232,6 +278,97 @@ int lc_pkcs7_verify(struct lc_pkcs7_message *pkcs7,
 int lc_pkcs7_supply_detached_data(struct lc_pkcs7_message *pkcs7,
 				  const uint8_t *data, size_t datalen);
 
+/**
+ * @ingroup PKCS7
+ * @brief Initialize the streaming verification of detached data
+ *
+ * The streaming verification is an alternative to
+ * \p lc_pkcs7_supply_detached_data followed by \p lc_pkcs7_verify for
+ * detached data that should not be held in memory as a whole. The data is
+ * supplied in arbitrarily sized chunks with \p lc_pkcs7_verify_stream_update
+ * and the verification is performed with \p lc_pkcs7_verify_stream_final.
+ *
+ * The data is hashed once for each distinct message digest algorithm used by
+ * the signers of the PKCS#7 message, i.e. all signers are served by one pass
+ * over the data. At most LC_PKCS7_STREAM_MAX_HASHES different message digest
+ * algorithms are supported.
+ *
+ * The PKCS#7 message must stay available until the streaming verification
+ * completes.
+ *
+ * @param [in] stream Streaming verification context to initialize
+ * @param [in] pkcs7 The decoded PKCS#7 message
+ *
+ * @return 0 on success or < 0 on error (-EEXIST refers to the case if data is
+ * already present in the message, -EOVERFLOW refers to the case if the signers
+ * use too many different message digest algorithms)
+ */
+int lc_pkcs7_verify_stream_init(struct lc_pkcs7_verify_stream *stream,
+				struct lc_pkcs7_message *pkcs7);
+
+/**
+ * @ingroup PKCS7
+ * @brief Supply the next chunk of the detached data
+ *
+ * @param [in] stream Streaming verification context
+ * @param [in] data Next chunk of the data to be verified
+ * @param [in] datalen Length of the chunk
+ *
+ * @return 0 on success or < 0 on error
+ */
+int lc_pkcs7_verify_stream_update(struct lc_pkcs7_verify_stream *stream,
+				  const uint8_t *data, size_t datalen);
+
+/**
+ * @ingroup PKCS7
+ * @brief Supply the detached data read from a file descriptor
+ *
+ * The data is read from \p fd until end of file is reached and supplied to
+ * the streaming verification with \p lc_pkcs7_verify_stream_update. The data
+ * is read in large chunks into an aligned buffer.
+ *
+ * \note This function is not available in the Linux kernel and EFI
+ * environments.
+ *
+ * @param [in] stream Streaming verification context
+ * @param [in] fd File descriptor to read the data from
+ *
+ * @return 0 on success or < 0 on error
+ */
+int lc_pkcs7_verify_stream_update_fd(struct lc_pkcs7_verify_stream *stream,
+				     int fd);
+
+/**
+ * @ingroup PKCS7
+ * @brief Verify the PKCS#7 message with the streamed detached data
+ *
+ * The verification is identical to \p lc_pkcs7_verify using the message
+ * digest of the streamed data. The streaming verification context is released
+ * independent of the result.
+ *
+ * @param [in] stream Streaming verification context
+ * @param [in] trust_store Trust store with trust anchor certificates - see
+ *			   \p lc_pkcs7_verify
+ * @param [in] verify_rules If non-NULL, the given rules are applied during
+ *			    certificate verification.
+ *
+ * @return 0 on success or < 0 on error - see \p lc_pkcs7_verify
+ */
+int lc_pkcs7_verify_stream_final(struct lc_pkcs7_verify_stream *stream,
+				 const struct lc_pkcs7_trust_store *trust_store,
+				 const struct lc_verify_rules *verify_rules);
+
+/**
+ * @ingroup PKCS7
+ * @brief Release the streaming verification context
+ *
+ * This function is only needed when the streaming verification is aborted
+ * before \p lc_pkcs7_verify_stream_final is invoked.
+ *
+ * @param [in] stream Streaming verification context to release
+ */
+void lc_pkcs7_verify_stream_clear(struct lc_pkcs7_verify_stream *stream);
+
 /**
  * @ingroup PKCS7
  * @brief Calculate and return the message digest of the data
@@ -295,4 +432,42 @@ int lc_pkcs7_trust_store_add(struct lc_pkcs7_trust_store *trust_store,
  */
 void lc_pkcs7_trust_store_clear(struct lc_pkcs7_trust_store *trust_store);
 
+/**
+ * @ingroup PKCS7
+ * @brief Use a verification cache with the trust store
+ *
+ * When verifying a PKCS#7 message against the trust store, the successful
+ * signature checks of the certificates in the certificate chain are recorded
+ * in the cache. A certificate whose signature was already verified with the
+ * same issuer key is not verified again. The cache is keyed by a SHA3-256
+ * digest over the issuer key, the TBS part and the signature of the
+ * certificate. All other checks, such as the validity time and the key usage
+ * of the issuer, are applied to every verification. The signature of the
+ * PKCS#7 message itself is always verified.
+ *
+ * The cache holds LC_PKCS7_VERIFY_CACHE_ENTRIES entries, the oldest entry is
+ * replaced when the cache is full. The cache is updated during
+ * \p lc_pkcs7_verify and thus must not be used by concurrent verification
+ * operations.
+ *
+ * The cache must be cleared with \p lc_pkcs7_verify_cache_clear before its
+ * first use.
+ *
+ * @param [in] trust_store Trust store to use the cache with
+ * @param [in] cache Verification cache or NULL to disable the cache
+ *
+ * @return 0 on success or < 0 on error
+ */
+int lc_pkcs7_trust_store_set_verify_cache(
+	struct lc_pkcs7_trust_store *trust_store,
+	struct lc_pkcs7_verify_cache *cache);
+
+/**
+ * @ingroup PKCS7
+ * @brief Invalidate all entries of the verification cache
+ *
+ * @param [in] cache Verification cache to clear
+ */
+void lc_pkcs7_verify_cache_clear(struct lc_pkcs7_verify_cache *cache);
+
 #endif /* _CRYPTO_PKCS7_H */
@@ -292,6 +292,8 @@ struct lc_x509_key_data {
 struct lc_x509_certificate {
 	struct lc_x509_certificate *next;
 	struct lc_x509_certificate *signer; /* Certificate that signed this one */
+	struct lc_x509_certificate *trust_id_next; /* Trust store ID index */
+	struct lc_x509_certificate *trust_skid_next; /* Trust store SKID index */
 	struct lc_x509_key_data sig_gen_data;
 	struct lc_x509_key_data pub_gen_data;
 	struct lc_public_key pub; /* Public key details */
@@ -344,6 +346,7 @@ struct lc_x509_certificate {
 		unsupported_sig : 1; /* T if signature uses unsupported crypto */
 	unsigned int blacklisted : 1;
 	unsigned int allocated : 1;
+	unsigned int lazy : 1; /* Names and extensions not yet parsed */
 };
 
 /// \endcond
@@ -94,6 +94,46 @@ void lc_x509_cert_clear(struct lc_x509_certificate *cert);
 int lc_x509_cert_decode(struct lc_x509_certificate *cert, const uint8_t *data,
 			size_t datalen);
 
+/**
+ * @ingroup X509
+ * @brief Lazily decode an X.509 certificate
+ *
+ * The function only parses the parts of the X.509 data buffer which are
+ * needed for using the public key of the certificate: the serial number, the
+ * validity period, the public key, the signature and the locations of the
+ * signed data, the issuer and the subject. The issuer and subject names as
+ * well as all extensions are parsed when they are accessed for the first time
+ * with one of the lc_x509_cert_get_* or lc_x509_policy_* functions. The
+ * self-signed detection, which may imply a signature verification, is
+ * deferred likewise. This allows a fast loading of a large number of
+ * certificates when only the public key and the validity period are of
+ * interest.
+ *
+ * \note The same requirements for the \p data buffer as for
+ * lc_x509_cert_decode apply.
+ *
+ * \note The first access to the deferred data modifies \p cert. Thus, the
+ * first access to a lazily decoded certificate must not happen concurrently
+ * with other accesses to it.
+ *
+ * \note When the deferred parsing fails, every access to the deferred data
+ * returns the error.
+ *
+ * \note The deferred data must not be accessed directly in the data
+ * structure before one of the mentioned functions triggered the parsing.
+ *
+ * @param [in,out] cert The data structure that is filled with the parameters
+ *			from the X.509 certificate data buffer. The buffer must
+ *			have been allocated by the caller. It is permissible
+ *			to keep it on the stack.
+ * @param [in] data Raw X.509 data blob in DER / BER format
+ * @param [in] datalen Length of the raw X.509 certificate buffer
+ *
+ * @return 0 on success or < 0 on error
+ */
+int lc_x509_cert_decode_lazy(struct lc_x509_certificate *cert,
+			     const uint8_t *data, size_t datalen);
+
 /// \cond DO_NOT_DOCUMENT
 #define LC_X509_KEYS_SPHINCS_SIZE                                              \
 	(sizeof(struct lc_sphincs_pk) + sizeof(struct lc_sphincs_sk) +         \
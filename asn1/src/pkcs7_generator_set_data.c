@@ -26,6 +26,7 @@
 #include "ret_checkers.h"
 #include "visibility.h"
 #include "x509_algorithm_mapper.h"
+#include "x509_cert_parser.h"
 
 static int pkcs7_add_cert(struct lc_pkcs7_message *pkcs7,
 			  struct lc_x509_certificate *x509)
@@ -59,6 +60,8 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_set_certificate,
 	CKNULL(x509->raw_cert, -EINVAL);
 	CKNULL(x509->raw_cert_size, -EINVAL);
 
+	CKINT(x509_cert_lazy_complete(x509));
+
 	CKINT(pkcs7_add_cert(pkcs7, x509));
 
 out:
@@ -84,6 +87,8 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_set_signer, struct lc_pkcs7_message *pkcs7,
 	CKNULL(sig_gen_data->pk.dilithium_pk, -EINVAL);
 	CKNULL(sig_gen_data->sk.dilithium_sk, -EINVAL);
 
+	CKINT(x509_cert_lazy_complete(x509_with_sk));
+
 	CKINT(pkcs7_sinfo_get(&sinfo, pkcs7));
 
 	/* Also set the certificate as signer */
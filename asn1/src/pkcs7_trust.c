@@ -31,10 +31,39 @@
 #include "asn1_debug.h"
 #include "asym_key.h"
 #include "asymmetric_type.h"
+#include "build_bug_on.h"
+#include "lc_memset_secure.h"
 #include "lc_pkcs7_parser.h"
 #include "pkcs7_internal.h"
 #include "ret_checkers.h"
 #include "visibility.h"
+#include "x509_cert_parser.h"
+
+/*
+ * The trust store index is keyed by the first bytes of the key ID. The lookup
+ * compares the full key ID of the searched key with the index entries. IDs
+ * shorter than the hashed prefix are searched linearly.
+ */
+#define PKCS7_TRUST_HASH_LEN 8
+
+static unsigned int
+pkcs7_trust_hash(const struct lc_asymmetric_key_id *kid)
+{
+	/* FNV-1a */
+	uint32_t h = 0x811c9dc5;
+	unsigned int i;
+
+	BUILD_BUG_ON(sizeof(kid->data) < PKCS7_TRUST_HASH_LEN);
+	BUILD_BUG_ON(LC_PKCS7_TRUST_STORE_BUCKETS &
+		     (LC_PKCS7_TRUST_STORE_BUCKETS - 1));
+
+	for (i = 0; i < PKCS7_TRUST_HASH_LEN; i++) {
+		h ^= kid->data[i];
+		h *= 0x01000193;
+	}
+
+	return (h ^ (h >> 16)) & (LC_PKCS7_TRUST_STORE_BUCKETS - 1);
+}
 
 int pkcs7_find_asymmetric_key(const struct lc_x509_certificate **anchor_cert,
 			      const struct lc_pkcs7_trust_store *trust_store,
@@ -52,22 +81,48 @@ int pkcs7_find_asymmetric_key(const struct lc_x509_certificate **anchor_cert,
 	 */
 	if (auth0 && auth0->len) {
 		bin2print_debug(auth0->data, auth0->len, stdout, "- want");
-		for (p = trust_store->anchor_cert; p; p = p->next) {
-			printf_debug("- cmp [%u] ", p->index);
-			bin2print_debug(p->id.data, p->id.len, stdout, "");
-
-			if (asymmetric_key_id_same(&p->id, auth0))
-				goto found_issuer_check_skid;
+		if (auth0->len >= PKCS7_TRUST_HASH_LEN) {
+			for (p = trust_store->id_index[pkcs7_trust_hash(auth0)];
+			     p; p = p->trust_id_next) {
+				printf_debug("- cmp [%u] ", p->index);
+				bin2print_debug(p->id.data, p->id.len, stdout,
+						"");
+
+				if (asymmetric_key_id_same(&p->id, auth0))
+					goto found_issuer_check_skid;
+			}
+		} else {
+			for (p = trust_store->anchor_cert; p; p = p->next) {
+				printf_debug("- cmp [%u] ", p->index);
+				bin2print_debug(p->id.data, p->id.len, stdout,
+						"");
+
+				if (asymmetric_key_id_same(&p->id, auth0))
+					goto found_issuer_check_skid;
+			}
 		}
 	} else if (auth1 && auth1->len) {
 		bin2print_debug(auth1->data, auth1->len, stdout, "- want");
-		for (p = trust_store->anchor_cert; p; p = p->next) {
-			if (!p->skid.len)
-				continue;
-			printf_debug("- cmp [%u] ", p->index);
-			bin2print_debug(p->skid.data, p->skid.len, stdout, "");
-			if (asymmetric_key_id_same(&p->skid, auth1))
-				goto found_issuer;
+		if (auth1->len >= PKCS7_TRUST_HASH_LEN) {
+			for (p = trust_store->skid_index[pkcs7_trust_hash(
+				     auth1)];
+			     p; p = p->trust_skid_next) {
+				printf_debug("- cmp [%u] ", p->index);
+				bin2print_debug(p->skid.data, p->skid.len,
+						stdout, "");
+				if (asymmetric_key_id_same(&p->skid, auth1))
+					goto found_issuer;
+			}
+		} else {
+			for (p = trust_store->anchor_cert; p; p = p->next) {
+				if (!p->skid.len)
+					continue;
+				printf_debug("- cmp [%u] ", p->index);
+				bin2print_debug(p->skid.data, p->skid.len,
+						stdout, "");
+				if (asymmetric_key_id_same(&p->skid, auth1))
+					goto found_issuer;
+			}
 		}
 	}
 
@@ -288,6 +343,23 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_validate,
 }
 #endif
 
+static void pkcs7_trust_index_add(struct lc_x509_certificate **bucket,
+				  struct lc_x509_certificate *x509,
+				  unsigned int skid)
+{
+	struct lc_x509_certificate *p;
+
+	if (__sync_val_compare_and_swap(bucket, NULL, x509) == NULL)
+		return;
+
+	for (p = *bucket; p; p = skid ? p->trust_skid_next : p->trust_id_next) {
+		if (__sync_val_compare_and_swap(skid ? &p->trust_skid_next :
+						       &p->trust_id_next,
+						NULL, x509) == NULL)
+			return;
+	}
+}
+
 LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_store_add,
 		      struct lc_pkcs7_trust_store *trust_store,
 		      struct lc_x509_certificate *x509)
@@ -298,6 +370,9 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_store_add,
 	CKNULL(x509, -EINVAL);
 	CKNULL(trust_store, -EINVAL);
 
+	/* The trust store indexes require the key IDs */
+	CKINT(x509_cert_lazy_complete(x509));
+
 	CKINT(lc_x509_policy_is_root_ca(x509));
 	if (ret != LC_X509_POL_TRUE) {
 		printf_debug(
@@ -316,6 +391,8 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_store_add,
 	}
 
 	x509->next = NULL;
+	x509->trust_id_next = NULL;
+	x509->trust_skid_next = NULL;
 	ret = 0;
 
 	/*
@@ -323,7 +400,7 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_store_add,
 	 */
 	if (__sync_val_compare_and_swap(&trust_store->anchor_cert, NULL,
 					x509) == NULL)
-		goto out;
+		goto index;
 
 	/*
 	 * Swap did not succeed, which means we must have a head.
@@ -332,13 +409,48 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_store_add,
 	     anchor_cert = anchor_cert->next) {
 		if (__sync_val_compare_and_swap(&anchor_cert->next, NULL,
 						x509) == NULL)
-			goto out;
+			goto index;
+	}
+
+index:
+	/*
+	 * Append the trust anchor to the index buckets in the same way such
+	 * that the lookup finds the same anchor as a linear search of the list.
+	 */
+	pkcs7_trust_index_add(&trust_store->id_index[pkcs7_trust_hash(
+				      &x509->id)],
+			      x509, 0);
+	if (x509->skid.len) {
+		pkcs7_trust_index_add(&trust_store->skid_index
+					       [pkcs7_trust_hash(&x509->skid)],
+				      x509, 1);
 	}
 
 out:
 	return ret;
 }
 
+LC_INTERFACE_FUNCTION(int, lc_pkcs7_trust_store_set_verify_cache,
+		      struct lc_pkcs7_trust_store *trust_store,
+		      struct lc_pkcs7_verify_cache *cache)
+{
+	if (!trust_store)
+		return -EINVAL;
+
+	trust_store->verify_cache = cache;
+
+	return 0;
+}
+
+LC_INTERFACE_FUNCTION(void, lc_pkcs7_verify_cache_clear,
+		      struct lc_pkcs7_verify_cache *cache)
+{
+	if (!cache)
+		return;
+
+	lc_memset_secure(cache, 0, sizeof(*cache));
+}
+
 LC_INTERFACE_FUNCTION(void, lc_pkcs7_trust_store_clear,
 		      struct lc_pkcs7_trust_store *trust_store)
 {
@@ -356,4 +468,6 @@ LC_INTERFACE_FUNCTION(void, lc_pkcs7_trust_store_clear,
 		anchor_cert = anchor_cert->next;
 		lc_x509_cert_clear(tmp);
 	}
+
+	lc_memset_secure(trust_store, 0, sizeof(*trust_store));
 }
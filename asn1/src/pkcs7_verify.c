@@ -32,6 +32,7 @@
 #include "asn1_debug.h"
 #include "asym_key.h"
 #include "lc_memcmp_secure.h"
+#include "lc_memory_support.h"
 #include "lc_sha256.h"
 #include "lc_sha3.h"
 #include "lc_sha512.h"
@@ -40,6 +41,71 @@
 #include "visibility.h"
 #include "x509_cert_parser.h"
 
+/*
+ * If there are authenticated attributes, there must be a message digest
+ * attribute amongst them which corresponds to the digest of the data held in
+ * the signature. In this case, the digest of the authenticated attributes
+ * replaces the digest of the data.
+ */
+static int pkcs7_digest_authattrs(struct lc_pkcs7_signed_info *sinfo)
+{
+	static const uint8_t tag = ASN1_CONS_BIT | ASN1_SET;
+	struct lc_public_key_signature *sig = &sinfo->sig;
+	int ret = 0;
+	LC_HASH_CTX_ON_STACK(hash_ctx, sig->hash_algo);
+
+	if (!sinfo->authattrs)
+		return 0;
+
+	if (!sinfo->msgdigest) {
+		printf_debug("Sig %u: No messageDigest\n", sinfo->index);
+		ret = -EKEYREJECTED;
+		goto out;
+	}
+
+	if (sinfo->msgdigest_len != sig->digest_size) {
+		printf_debug("Sig %u: Invalid digest size (%zu)\n", sinfo->index,
+			     sinfo->msgdigest_len);
+		ret = -EBADMSG;
+		goto out;
+	}
+
+	if (lc_memcmp_secure(sig->digest, sig->digest_size, sinfo->msgdigest,
+			     sinfo->msgdigest_len) != 0) {
+		printf_debug("Sig %u: Message digest doesn't match\n",
+			     sinfo->index);
+		bin2print_debug(sinfo->msgdigest, sinfo->msgdigest_len, stdout,
+				"signerInfos messageDigest");
+		ret = -EKEYREJECTED;
+		goto out;
+	}
+
+	/*
+	 * We then calculate anew, using the authenticated attributes as the
+	 * contents of the digest instead.  Note that we need to convert the
+	 * attributes from a CONT.0 into a SET before we hash it.
+	 */
+	memset(sig->digest, 0, sig->digest_size);
+	CKINT(lc_hash_init(hash_ctx));
+	sig->digest_size = sizeof(sig->digest);
+	CKINT(x509_set_digestsize(&sig->digest_size, hash_ctx));
+	lc_hash_update(hash_ctx, &tag, 1);
+	lc_hash_update(hash_ctx, sinfo->authattrs, sinfo->authattrs_len);
+	lc_hash_final(hash_ctx, sig->digest);
+
+	bin2print_debug(sig->digest, sig->digest_size, stdout,
+			"signerInfos AADigest");
+
+out:
+	/* Do not leave a digest behind that was not validated */
+	if (ret) {
+		memset(sig->digest, 0, sizeof(sig->digest));
+		sig->digest_size = 0;
+	}
+	lc_hash_zero(hash_ctx);
+	return ret;
+}
+
 /*
  * Digest the relevant parts of the PKCS#7 data
  */
@@ -69,58 +135,7 @@ static int pkcs7_digest(struct lc_pkcs7_message *pkcs7,
 
 	bin2print_debug(sig->digest, sig->digest_size, stdout, "messageDigest");
 
-	/*
-	 * However, if there are authenticated attributes, there must be a
-	 * message digest attribute amongst them which corresponds to the
-	 * digest we just calculated.
-	 */
-	if (sinfo->authattrs) {
-		static const uint8_t tag = ASN1_CONS_BIT | ASN1_SET;
-
-		if (!sinfo->msgdigest) {
-			printf_debug("Sig %u: No messageDigest\n",
-				     sinfo->index);
-			ret = -EKEYREJECTED;
-			goto out;
-		}
-
-		if (sinfo->msgdigest_len != sig->digest_size) {
-			printf_debug("Sig %u: Invalid digest size (%zu)\n",
-				     sinfo->index, sinfo->msgdigest_len);
-			ret = -EBADMSG;
-			goto out;
-		}
-
-		if (lc_memcmp_secure(sig->digest, sig->digest_size,
-				     sinfo->msgdigest,
-				     sinfo->msgdigest_len) != 0) {
-			printf_debug("Sig %u: Message digest doesn't match\n",
-				     sinfo->index);
-			bin2print_debug(sinfo->msgdigest, sinfo->msgdigest_len,
-					stdout, "signerInfos messageDigest");
-			ret = -EKEYREJECTED;
-			goto out;
-		}
-
-		/*
-		 * We then calculate anew, using the authenticated attributes
-		 * as the contents of the digest instead.  Note that we need to
-		 * convert the attributes from a CONT.0 into a SET before we
-		 * hash it.
-		 */
-		memset(sig->digest, 0, sig->digest_size);
-		CKINT(lc_hash_init(hash_ctx));
-		sig->digest_size = sizeof(sig->digest);
-		CKINT(x509_set_digestsize(&sig->digest_size, hash_ctx));
-		lc_hash_update(hash_ctx, &tag, 1);
-		lc_hash_update(hash_ctx, sinfo->authattrs,
-			       sinfo->authattrs_len);
-		lc_hash_final(hash_ctx, sig->digest);
-		lc_hash_zero(hash_ctx);
-
-		bin2print_debug(sig->digest, sig->digest_size, stdout,
-				"signerInfos AADigest");
-	}
+	CKINT(pkcs7_digest_authattrs(sinfo));
 
 out:
 	printf_debug("<== %s(),  = %d\n", __func__, ret);
@@ -169,13 +184,158 @@ static int pkcs7_find_key(struct lc_pkcs7_message *pkcs7,
 	return -ENOKEY;
 }
 
+/*
+ * Digest identifying a successful signature check of a certificate with an
+ * issuer key.
+ */
+static int pkcs7_verify_cache_digest(uint8_t digest[LC_SHA3_256_SIZE_DIGEST],
+				     const struct lc_public_key *pkey,
+				     const struct lc_x509_certificate *x509)
+{
+	uint32_t pkey_algo = (uint32_t)pkey->pkey_algo;
+	int ret;
+	LC_HASH_CTX_ON_STACK(hash_ctx, lc_sha3_256);
+
+	CKINT(lc_hash_init(hash_ctx));
+	lc_hash_update(hash_ctx, (const uint8_t *)&pkey_algo,
+		       sizeof(pkey_algo));
+	lc_hash_update(hash_ctx, pkey->key, pkey->keylen);
+	lc_hash_update(hash_ctx, x509->tbs, x509->tbs_size);
+	lc_hash_update(hash_ctx, x509->raw_sig, x509->raw_sig_size);
+	lc_hash_final(hash_ctx, digest);
+
+out:
+	lc_hash_zero(hash_ctx);
+	return ret;
+}
+
+static int pkcs7_verify_cache_lookup(const struct lc_pkcs7_verify_cache *cache,
+				     const uint8_t digest[LC_SHA3_256_SIZE_DIGEST])
+{
+	unsigned int i;
+
+	for (i = 0; i < cache->entries; i++) {
+		if (!memcmp(cache->digest[i], digest, LC_SHA3_256_SIZE_DIGEST))
+			return 1;
+	}
+
+	return 0;
+}
+
+static void pkcs7_verify_cache_add(struct lc_pkcs7_verify_cache *cache,
+				   const uint8_t digest[LC_SHA3_256_SIZE_DIGEST])
+{
+	/* Replace the oldest entry when the cache is full */
+	if (cache->next >= LC_PKCS7_VERIFY_CACHE_ENTRIES)
+		cache->next = 0;
+
+	memcpy(cache->digest[cache->next], digest, LC_SHA3_256_SIZE_DIGEST);
+	cache->next++;
+	if (cache->entries < LC_PKCS7_VERIFY_CACHE_ENTRIES)
+		cache->entries++;
+}
+
+/*
+ * Signature check deferred by the parallel verification
+ */
+struct pkcs7_sig_job {
+	const struct lc_public_key *pkey;
+	const struct lc_public_key_signature *sig;
+	uint8_t cache_digest[LC_SHA3_256_SIZE_DIGEST];
+	unsigned int cache_add : 1;
+	int ret;
+};
+
+struct pkcs7_sig_jobs {
+	struct pkcs7_sig_job *job;
+	unsigned int num;
+	unsigned int max;
+};
+
+static int pkcs7_sig_job_add(struct pkcs7_sig_jobs *jobs,
+			     const struct lc_public_key *pkey,
+			     const struct lc_public_key_signature *sig,
+			     const uint8_t *cache_digest)
+{
+	struct pkcs7_sig_job *job;
+
+	if (jobs->num >= jobs->max)
+		return -EOVERFLOW;
+
+	job = &jobs->job[jobs->num++];
+	job->pkey = pkey;
+	job->sig = sig;
+	job->ret = 0;
+	job->cache_add = !!cache_digest;
+	if (cache_digest) {
+		memcpy(job->cache_digest, cache_digest,
+		       LC_SHA3_256_SIZE_DIGEST);
+	}
+
+	return 0;
+}
+
+static void pkcs7_sig_job_exec(void *job_ctx, unsigned int idx)
+{
+	struct pkcs7_sig_job *job = (struct pkcs7_sig_job *)job_ctx + idx;
+	int ret;
+
+	CKINT_SIGCHECK(public_key_verify_signature(job->pkey, job->sig));
+
+out:
+	job->ret = ret;
+}
+
+/*
+ * Verify the certificate with the issuer key, the signature check is skipped
+ * if it is recorded in the verification cache of the trust store. If jobs are
+ * provided, the signature check is not performed but recorded as a job.
+ */
+static int pkcs7_verify_cert(const struct lc_pkcs7_trust_store *trust_store,
+			     const struct lc_public_key *pkey,
+			     const struct lc_x509_certificate *x509,
+			     struct pkcs7_sig_jobs *jobs)
+{
+	struct lc_pkcs7_verify_cache *cache =
+		trust_store ? trust_store->verify_cache : NULL;
+	uint8_t digest[LC_SHA3_256_SIZE_DIGEST];
+	int ret;
+
+	if (!cache && !jobs)
+		return lc_x509_policy_verify_cert(pkey, x509, 0);
+
+	if (cache) {
+		CKINT(pkcs7_verify_cache_digest(digest, pkey, x509));
+
+		if (pkcs7_verify_cache_lookup(cache, digest)) {
+			printf_debug("- certificate signature check cached\n");
+			return x509_policy_verify_cert_sig(pkey, x509, 0, 0);
+		}
+	}
+
+	if (jobs) {
+		CKINT(x509_policy_verify_cert_sig(pkey, x509, 0, 0));
+		CKINT(pkcs7_sig_job_add(jobs, pkey, &x509->sig,
+					cache ? digest : NULL));
+		goto out;
+	}
+
+	CKINT(x509_policy_verify_cert_sig(pkey, x509, 0, 1));
+	pkcs7_verify_cache_add(cache, digest);
+
+out:
+	return ret;
+}
+
 /*
  * Verify the internal certificate chain as best we can.
  */
-int pkcs7_verify_sig_chain(struct lc_x509_certificate *certificate_chain,
-			   const struct lc_pkcs7_trust_store *trust_store,
-			   struct lc_x509_certificate *x509,
-			   struct lc_pkcs7_signed_info *sinfo)
+static int
+pkcs7_verify_sig_chain_jobs(struct lc_x509_certificate *certificate_chain,
+			    const struct lc_pkcs7_trust_store *trust_store,
+			    struct lc_x509_certificate *x509,
+			    struct lc_pkcs7_signed_info *sinfo,
+			    struct pkcs7_sig_jobs *jobs)
 {
 	struct lc_public_key_signature *sig;
 	struct lc_x509_certificate *p;
@@ -262,8 +422,8 @@ int pkcs7_verify_sig_chain(struct lc_x509_certificate *certificate_chain,
 		ret = pkcs7_find_asymmetric_key(&trusted, trust_store, auth0,
 						auth1);
 		if (!ret) {
-			CKINT(lc_x509_policy_verify_cert(&trusted->pub, x509,
-							 0));
+			CKINT(pkcs7_verify_cert(trust_store, &trusted->pub,
+						x509, jobs));
 			return 0;
 		}
 
@@ -312,8 +472,9 @@ int pkcs7_verify_sig_chain(struct lc_x509_certificate *certificate_chain,
 					"- searching root CA in trust store\n");
 				CKINT(pkcs7_find_asymmetric_key(
 					&trusted, trust_store, auth0, auth1));
-				CKINT(lc_x509_policy_verify_cert(&trusted->pub,
-								 x509, 0));
+				CKINT(pkcs7_verify_cert(trust_store,
+							&trusted->pub, x509,
+							jobs));
 				return 0;
 			}
 
@@ -322,7 +483,8 @@ int pkcs7_verify_sig_chain(struct lc_x509_certificate *certificate_chain,
 			 * provided root certificate to verify and accept it
 			 * as trust anchor.
 			 */
-			CKINT(lc_x509_policy_verify_cert(&p->pub, x509, 0));
+			CKINT(pkcs7_verify_cert(trust_store, &p->pub, x509,
+						jobs));
 			return 0;
 		}
 
@@ -336,7 +498,7 @@ int pkcs7_verify_sig_chain(struct lc_x509_certificate *certificate_chain,
 			return -EKEYREJECTED;
 		}
 
-		CKINT(lc_x509_policy_verify_cert(&p->pub, x509, 0));
+		CKINT(pkcs7_verify_cert(trust_store, &p->pub, x509, jobs));
 		x509->signer = p;
 
 		x509 = p;
@@ -351,13 +513,23 @@ out:
 	return ret;
 }
 
+int pkcs7_verify_sig_chain(struct lc_x509_certificate *certificate_chain,
+			   const struct lc_pkcs7_trust_store *trust_store,
+			   struct lc_x509_certificate *x509,
+			   struct lc_pkcs7_signed_info *sinfo)
+{
+	return pkcs7_verify_sig_chain_jobs(certificate_chain, trust_store, x509,
+					   sinfo, NULL);
+}
+
 /*
- * Verify one signed information block from a PKCS#7 message.
+ * Perform all checks of one signed information block from a PKCS#7 message
+ * preceding the signature verification.
  */
-static int pkcs7_verify_one(struct lc_pkcs7_message *pkcs7,
-			    const struct lc_pkcs7_trust_store *trust_store,
-			    struct lc_pkcs7_signed_info *sinfo,
-			    const struct lc_verify_rules *verify_rules)
+static int
+pkcs7_verify_one_prepare(struct lc_pkcs7_message *pkcs7,
+			 struct lc_pkcs7_signed_info *sinfo,
+			 const struct lc_verify_rules *verify_rules)
 {
 	int ret;
 
@@ -412,6 +584,24 @@ static int pkcs7_verify_one(struct lc_pkcs7_message *pkcs7,
 			return -EKEYREJECTED;
 	}
 
+	ret = 0;
+
+out:
+	return ret;
+}
+
+/*
+ * Verify one signed information block from a PKCS#7 message.
+ */
+static int pkcs7_verify_one(struct lc_pkcs7_message *pkcs7,
+			    const struct lc_pkcs7_trust_store *trust_store,
+			    struct lc_pkcs7_signed_info *sinfo,
+			    const struct lc_verify_rules *verify_rules)
+{
+	int ret;
+
+	CKINT(pkcs7_verify_one_prepare(pkcs7, sinfo, verify_rules));
+
 	/* Verify the PKCS#7 binary against the key */
 	CKINT_SIGCHECK(
 		public_key_verify_signature(&sinfo->signer->pub, &sinfo->sig));
@@ -426,6 +616,164 @@ out:
 	return ret;
 }
 
+/*
+ * Merge the result of the verification of one signed information block into
+ * the overall result. Returns true if the verification must be aborted with
+ * the error of the signed information block.
+ */
+static int pkcs7_verify_merge(int ret, int *cached_ret)
+{
+	switch (ret) {
+	case -ENOKEY:
+		return 0;
+	case -ENOPKG:
+		if (*cached_ret == -ENOKEY)
+			*cached_ret = -ENOPKG;
+		return 0;
+	case 0:
+		*cached_ret = 0;
+		return 0;
+	default:
+		return 1;
+	}
+}
+
+/*
+ * Verify all signed information blocks of the PKCS#7 message.
+ */
+static int pkcs7_verify_sinfos(struct lc_pkcs7_message *pkcs7,
+			       const struct lc_pkcs7_trust_store *trust_store,
+			       const struct lc_verify_rules *verify_rules)
+{
+	struct lc_pkcs7_signed_info *sinfo;
+	int ret, cached_ret = -ENOKEY;
+
+	for (sinfo = pkcs7->list_head_sinfo; sinfo; sinfo = sinfo->next) {
+		ret = pkcs7_verify_one(pkcs7, trust_store, sinfo, verify_rules);
+		if (pkcs7_verify_merge(ret, &cached_ret)) {
+			printf_debug("<== %s() = %d\n", __func__, ret);
+			return ret;
+		}
+	}
+
+	printf_debug("<== %s() = %d\n", __func__, cached_ret);
+	return cached_ret;
+}
+
+/*
+ * Verify all signed information blocks of the PKCS#7 message with the
+ * signature checks executed by the executor.
+ *
+ * The checks of all signed information blocks and the walk through their
+ * certificate chains are performed first where all signature checks are
+ * recorded as jobs. After the executor completed all jobs, the results are
+ * merged in the order of the signed information blocks. For each block, the
+ * signature checks are considered in the order they would be performed by
+ * pkcs7_verify_one. Thus, the result is identical to pkcs7_verify_sinfos,
+ * independent of the order the jobs are executed in.
+ */
+static int
+pkcs7_verify_sinfos_parallel(struct lc_pkcs7_message *pkcs7,
+			     const struct lc_pkcs7_trust_store *trust_store,
+			     const struct lc_verify_rules *verify_rules,
+			     const struct lc_pkcs7_executor *executor)
+{
+	struct pkcs7_sinfo_result {
+		int ret;
+		unsigned int job_start;
+		unsigned int job_end;
+	};
+	struct lc_pkcs7_verify_cache *cache =
+		trust_store ? trust_store->verify_cache : NULL;
+	struct lc_pkcs7_signed_info *sinfo;
+	struct lc_x509_certificate *x509;
+	struct pkcs7_sinfo_result *result = NULL;
+	struct pkcs7_sig_jobs jobs = { 0 };
+	unsigned int i, j, num_sinfo = 0, num_prepared = 0, num_certs = 0;
+	int ret, cached_ret = -ENOKEY;
+	void *mem = NULL;
+
+	for (sinfo = pkcs7->list_head_sinfo; sinfo; sinfo = sinfo->next)
+		num_sinfo++;
+	for (x509 = pkcs7->certs; x509; x509 = x509->next)
+		num_certs++;
+
+	if (!num_sinfo)
+		return -ENOKEY;
+
+	/*
+	 * Every signed information block requires at most one signature check
+	 * for the message, one per certificate in the message and one with the
+	 * trust anchor.
+	 */
+	jobs.max = num_sinfo * (num_certs + 2);
+	CKINT(lc_alloc_aligned(&mem, 8,
+			       num_sinfo * sizeof(struct pkcs7_sinfo_result) +
+				       jobs.max *
+					       sizeof(struct pkcs7_sig_job)));
+	CKNULL(mem, -ENOMEM);
+	jobs.job = mem;
+	result = (struct pkcs7_sinfo_result *)(jobs.job + jobs.max);
+
+	for (sinfo = pkcs7->list_head_sinfo; sinfo; sinfo = sinfo->next) {
+		struct pkcs7_sinfo_result *res = &result[num_prepared++];
+
+		res->job_start = jobs.num;
+		res->ret = pkcs7_verify_one_prepare(pkcs7, sinfo, verify_rules);
+		if (!res->ret) {
+			res->ret = pkcs7_sig_job_add(&jobs, &sinfo->signer->pub,
+						     &sinfo->sig, NULL);
+		}
+		if (!res->ret) {
+			res->ret = pkcs7_verify_sig_chain_jobs(pkcs7->certs,
+							       trust_store,
+							       sinfo->signer,
+							       sinfo, &jobs);
+		}
+		res->job_end = jobs.num;
+
+		/* Subsequent signed information blocks are irrelevant */
+		if (res->job_start == res->job_end &&
+		    res->ret != -ENOKEY && res->ret != -ENOPKG && res->ret)
+			break;
+	}
+
+	if (executor && executor->run) {
+		executor->run(executor->executor_ctx, pkcs7_sig_job_exec,
+			      jobs.job, jobs.num);
+	} else {
+		for (i = 0; i < jobs.num; i++)
+			pkcs7_sig_job_exec(jobs.job, i);
+	}
+
+	for (i = 0; i < jobs.num; i++) {
+		if (cache && jobs.job[i].cache_add && !jobs.job[i].ret)
+			pkcs7_verify_cache_add(cache, jobs.job[i].cache_digest);
+	}
+
+	for (i = 0; i < num_prepared; i++) {
+		ret = result[i].ret;
+
+		/* A failed signature check precedes all remaining checks */
+		for (j = result[i].job_start; j < result[i].job_end; j++) {
+			if (jobs.job[j].ret) {
+				ret = jobs.job[j].ret;
+				break;
+			}
+		}
+
+		if (pkcs7_verify_merge(ret, &cached_ret))
+			goto out;
+	}
+
+	ret = cached_ret;
+
+out:
+	printf_debug("<== %s() = %d\n", __func__, ret);
+	lc_free(mem);
+	return ret;
+}
+
 /******************************************************************************
  * API functions
  ******************************************************************************/
@@ -464,9 +812,6 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify, struct lc_pkcs7_message *pkcs7,
 		      const struct lc_pkcs7_trust_store *trust_store,
 		      const struct lc_verify_rules *verify_rules)
 {
-	struct lc_pkcs7_signed_info *sinfo;
-	int ret, cached_ret = -ENOKEY;
-
 	if (!pkcs7)
 		return -EINVAL;
 
@@ -482,26 +827,32 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify, struct lc_pkcs7_message *pkcs7,
 		return -ENODATA;
 	}
 
-	for (sinfo = pkcs7->list_head_sinfo; sinfo; sinfo = sinfo->next) {
-		ret = pkcs7_verify_one(pkcs7, trust_store, sinfo, verify_rules);
-		switch (ret) {
-		case -ENOKEY:
-			continue;
-		case -ENOPKG:
-			if (cached_ret == -ENOKEY)
-				cached_ret = -ENOPKG;
-			continue;
-		case 0:
-			cached_ret = 0;
-			continue;
-		default:
-			printf_debug("<== %s() = %d\n", __func__, ret);
-			return ret;
-		}
+	return pkcs7_verify_sinfos(pkcs7, trust_store, verify_rules);
+}
+
+LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify_parallel,
+		      struct lc_pkcs7_message *pkcs7,
+		      const struct lc_pkcs7_trust_store *trust_store,
+		      const struct lc_verify_rules *verify_rules,
+		      const struct lc_pkcs7_executor *executor)
+{
+	if (!pkcs7)
+		return -EINVAL;
+
+	printf_debug("==> %s(), ", __func__);
+
+	if (pkcs7->data_type != OID_data) {
+		printf_debug("Invalid sig (not pkcs7-data)\n");
+		return -EKEYREJECTED;
 	}
 
-	printf_debug("<== %s() = %d\n", __func__, cached_ret);
-	return cached_ret;
+	if (!pkcs7->data) {
+		printf_debug("EncapsulatedContent missing\n");
+		return -ENODATA;
+	}
+
+	return pkcs7_verify_sinfos_parallel(pkcs7, trust_store, verify_rules,
+					    executor);
 }
 
 LC_INTERFACE_FUNCTION(int, lc_pkcs7_supply_detached_data,
@@ -521,3 +872,159 @@ LC_INTERFACE_FUNCTION(int, lc_pkcs7_supply_detached_data,
 
 	return 0;
 }
+
+LC_INTERFACE_FUNCTION(void, lc_pkcs7_verify_stream_clear,
+		      struct lc_pkcs7_verify_stream *stream)
+{
+	unsigned int i;
+
+	if (!stream)
+		return;
+
+	for (i = 0; i < stream->num_hash_ctx; i++) {
+		lc_hash_zero_free(stream->hash_ctx[i]);
+		stream->hash_ctx[i] = NULL;
+	}
+	stream->num_hash_ctx = 0;
+	stream->pkcs7 = NULL;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify_stream_init,
+		      struct lc_pkcs7_verify_stream *stream,
+		      struct lc_pkcs7_message *pkcs7)
+{
+	struct lc_pkcs7_signed_info *sinfo;
+	unsigned int i;
+	int ret = 0;
+
+	CKNULL(stream, -EINVAL);
+	CKNULL(pkcs7, -EINVAL);
+
+	if (pkcs7->data) {
+		printf_debug("Data already supplied\n");
+		return -EEXIST;
+	}
+
+	stream->pkcs7 = pkcs7;
+	stream->num_hash_ctx = 0;
+
+	/*
+	 * Allocate one hash context per distinct message digest algorithm
+	 * used by the signers so that the data is hashed only once.
+	 */
+	for (sinfo = pkcs7->list_head_sinfo; sinfo; sinfo = sinfo->next) {
+		struct lc_public_key_signature *sig = &sinfo->sig;
+
+		/* The digest is calculated from the streamed data */
+		memset(sig->digest, 0, sizeof(sig->digest));
+		sig->digest_size = 0;
+
+		if (!sig->hash_algo)
+			continue;
+
+		for (i = 0; i < stream->num_hash_ctx; i++) {
+			if (stream->hash_ctx[i]->hash == sig->hash_algo)
+				break;
+		}
+		if (i < stream->num_hash_ctx)
+			continue;
+
+		if (stream->num_hash_ctx >= LC_PKCS7_STREAM_MAX_HASHES) {
+			ret = -EOVERFLOW;
+			goto out;
+		}
+
+		CKINT(lc_hash_alloc(sig->hash_algo,
+				    &stream->hash_ctx[stream->num_hash_ctx]));
+		stream->num_hash_ctx++;
+		CKINT(lc_hash_init(stream->hash_ctx[stream->num_hash_ctx - 1]));
+	}
+
+out:
+	if (ret)
+		lc_pkcs7_verify_stream_clear(stream);
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify_stream_update,
+		      struct lc_pkcs7_verify_stream *stream, const uint8_t *data,
+		      size_t datalen)
+{
+	unsigned int i;
+
+	if (!stream || !stream->pkcs7)
+		return -EINVAL;
+
+	for (i = 0; i < stream->num_hash_ctx; i++)
+		lc_hash_update(stream->hash_ctx[i], data, datalen);
+
+	return 0;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify_stream_final,
+		      struct lc_pkcs7_verify_stream *stream,
+		      const struct lc_pkcs7_trust_store *trust_store,
+		      const struct lc_verify_rules *verify_rules)
+{
+	struct lc_pkcs7_message *pkcs7;
+	struct lc_pkcs7_signed_info *sinfo;
+	unsigned int i;
+	int ret = 0;
+
+	if (!stream || !stream->pkcs7)
+		return -EINVAL;
+
+	pkcs7 = stream->pkcs7;
+
+	printf_debug("==> %s(), ", __func__);
+
+	if (pkcs7->data_type != OID_data) {
+		printf_debug("Invalid sig (not pkcs7-data)\n");
+		ret = -EKEYREJECTED;
+		goto out;
+	}
+
+	/*
+	 * Finalize the message digest of every hash context and hand it to all
+	 * signers using this digest algorithm [RFC5652 5.4].
+	 */
+	for (i = 0; i < stream->num_hash_ctx; i++) {
+		struct lc_hash_ctx *hash_ctx = stream->hash_ctx[i];
+		struct lc_public_key_signature *first = NULL;
+
+		for (sinfo = pkcs7->list_head_sinfo; sinfo;
+		     sinfo = sinfo->next) {
+			struct lc_public_key_signature *sig = &sinfo->sig;
+
+			if (sig->hash_algo != hash_ctx->hash)
+				continue;
+
+			if (first) {
+				memcpy(sig->digest, first->digest,
+				       first->digest_size);
+				sig->digest_size = first->digest_size;
+				continue;
+			}
+
+			sig->digest_size = sizeof(sig->digest);
+			CKINT(x509_set_digestsize(&sig->digest_size,
+						  hash_ctx));
+			lc_hash_final(hash_ctx, sig->digest);
+			first = sig;
+
+			bin2print_debug(sig->digest, sig->digest_size, stdout,
+					"messageDigest");
+		}
+	}
+
+	for (sinfo = pkcs7->list_head_sinfo; sinfo; sinfo = sinfo->next) {
+		if (sinfo->sig.digest_size)
+			CKINT(pkcs7_digest_authattrs(sinfo));
+	}
+
+	ret = pkcs7_verify_sinfos(pkcs7, trust_store, verify_rules);
+
+out:
+	lc_pkcs7_verify_stream_clear(stream);
+	return ret;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 - 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING ANY WAY OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#include "ext_headers.h"
+#include "lc_memory_support.h"
+#include "lc_pkcs7_parser.h"
+#include "ret_checkers.h"
+#include "visibility.h"
+
+/*
+ * Size of the read buffer - large reads keep the number of system calls low
+ * and allow the hash implementations to process long runs of blocks.
+ */
+#define LC_PKCS7_STREAM_FD_BUFSIZE (1UL << 20)
+#define LC_PKCS7_STREAM_FD_ALIGNMENT 4096
+
+LC_INTERFACE_FUNCTION(int, lc_pkcs7_verify_stream_update_fd,
+		      struct lc_pkcs7_verify_stream *stream, int fd)
+{
+	uint8_t *buf = NULL;
+	ssize_t rc;
+	int ret = 0;
+
+	if (!stream || !stream->pkcs7 || fd < 0)
+		return -EINVAL;
+
+	if (lc_alloc_aligned((void **)&buf, LC_PKCS7_STREAM_FD_ALIGNMENT,
+			     LC_PKCS7_STREAM_FD_BUFSIZE))
+		return -ENOMEM;
+
+	for (;;) {
+		rc = read(fd, buf, LC_PKCS7_STREAM_FD_BUFSIZE);
+		if (rc < 0) {
+			if (errno == EINTR)
+				continue;
+			ret = -errno;
+			goto out;
+		}
+		if (!rc)
+			break;
+
+		CKINT(lc_pkcs7_verify_stream_update(stream, buf, (size_t)rc));
+	}
+
+out:
+	lc_free(buf);
+	return ret;
+}
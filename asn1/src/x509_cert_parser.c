@@ -50,6 +50,7 @@
 #include "x509_basic_constraints_asn1.h"
 #include "x509_eku_asn1.h"
 #include "x509_keyusage_asn1.h"
+#include "x509_lazy_asn1.h"
 #include "x509_san_asn1.h"
 #include "x509_skid_asn1.h"
 
@@ -1128,6 +1129,108 @@ int x509_version(void *context, size_t hdrlen, unsigned char tag,
 	return 0;
 }
 
+/*
+ * Lazy decoding: only note the location of the issuer and subject names, the
+ * names are parsed with the full decoder in x509_cert_lazy_complete.
+ */
+int x509_lazy_note_issuer(void *context, size_t hdrlen, unsigned char tag,
+			  const uint8_t *value, size_t vlen)
+{
+	struct x509_parse_context *ctx = context;
+	struct lc_x509_certificate *cert = ctx->cert;
+
+	(void)hdrlen;
+	(void)tag;
+
+	cert->raw_issuer = value;
+	cert->raw_issuer_size = vlen;
+	return 0;
+}
+
+int x509_lazy_note_subject(void *context, size_t hdrlen, unsigned char tag,
+			   const uint8_t *value, size_t vlen)
+{
+	struct x509_parse_context *ctx = context;
+	struct lc_x509_certificate *cert = ctx->cert;
+
+	(void)hdrlen;
+	(void)tag;
+
+	cert->raw_subject = value;
+	cert->raw_subject_size = vlen;
+	return 0;
+}
+
+/* The lazy ASN.1 structure is only used for decoding */
+int x509_lazy_note_issuer_enc(void *context, uint8_t *data,
+			      size_t *avail_datalen, uint8_t *tag)
+{
+	(void)context;
+	(void)data;
+	(void)avail_datalen;
+	(void)tag;
+	return -EOPNOTSUPP;
+}
+
+int x509_lazy_note_subject_enc(void *context, uint8_t *data,
+			       size_t *avail_datalen, uint8_t *tag)
+{
+	(void)context;
+	(void)data;
+	(void)avail_datalen;
+	(void)tag;
+	return -EOPNOTSUPP;
+}
+
+static void x509_set_pub(struct lc_x509_certificate *x509,
+			 const struct x509_parse_context *ctx)
+{
+	x509->pub.key = ctx->key;
+	x509->pub.keylen = ctx->key_size;
+
+	x509->pub.params = ctx->params;
+	x509->pub.paramlen = ctx->params_size;
+
+	x509->pub.algo = ctx->key_algo;
+}
+
+int x509_cert_lazy_complete(const struct lc_x509_certificate *cert)
+{
+	/*
+	 * The completion only fills in the parts of the certificate which are
+	 * derived from the unchanged raw certificate data.
+	 */
+	struct lc_x509_certificate *x509 = (struct lc_x509_certificate *)cert;
+	struct lc_x509_certificate *next, *signer;
+	const uint8_t *data;
+	size_t datalen;
+	int ret;
+
+	if (!x509->lazy)
+		return 0;
+
+	next = x509->next;
+	signer = x509->signer;
+	data = x509->raw_cert;
+	datalen = x509->raw_cert_size;
+
+	/* The full decoding starts with a pristine certificate */
+	lc_x509_cert_clear(x509);
+	ret = lc_x509_cert_decode(x509, data, datalen);
+
+	/*
+	 * Retain the lazy state of a certificate which cannot be fully decoded
+	 * to report the error with every access.
+	 */
+	if (ret)
+		lc_x509_cert_decode_lazy(x509, data, datalen);
+
+	x509->next = next;
+	x509->signer = signer;
+
+	return ret;
+}
+
 /******************************************************************************
  * API functions
  ******************************************************************************/
@@ -1178,13 +1281,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_decode,
 				       ctx.raw_akid_size));
 	}
 
-	x509->pub.key = ctx.key;
-	x509->pub.keylen = ctx.key_size;
-
-	x509->pub.params = ctx.params;
-	x509->pub.paramlen = ctx.params_size;
-
-	x509->pub.algo = ctx.key_algo;
+	x509_set_pub(x509, &ctx);
 
 	/* Grab the signature bits */
 	CKINT(x509_get_sig_params(x509));
@@ -1203,6 +1300,38 @@ out:
 	return ret;
 }
 
+LC_INTERFACE_FUNCTION(int, lc_x509_cert_decode_lazy,
+		      struct lc_x509_certificate *x509, const uint8_t *data,
+		      size_t datalen)
+{
+	struct x509_parse_context ctx = { 0 };
+	int ret;
+
+	CKNULL(x509, -EINVAL);
+	CKNULL(data, -EINVAL);
+
+	ctx.cert = x509;
+	ctx.data = data;
+
+	x509->raw_cert = data;
+	x509->raw_cert_size = datalen;
+
+	/* Locate the names and extensions without parsing them */
+	CKINT(asn1_ber_decoder(&x509_lazy_decoder, &ctx, data, datalen));
+
+	x509_set_pub(x509, &ctx);
+
+	/* Grab the signature bits */
+	CKINT(x509_get_sig_params(x509));
+
+	x509->lazy = 1;
+
+out:
+	if (ret)
+		lc_x509_cert_clear(x509);
+	return ret;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_x509_sk_decode, struct lc_x509_key_data *key,
 		      enum lc_sig_types key_type, const uint8_t *data,
 		      size_t datalen)
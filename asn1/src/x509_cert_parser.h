@@ -67,6 +67,20 @@ extern const unsigned int x509_keyusage_to_name_size;
 
 int lc_x509_cert_oid_to_eku(enum OID oid, uint16_t *eku);
 
+/*
+ * Parse the deferred parts of a certificate decoded with
+ * lc_x509_cert_decode_lazy. The call is a noop for fully decoded certificates.
+ */
+int x509_cert_lazy_complete(const struct lc_x509_certificate *cert);
+
+/*
+ * lc_x509_policy_verify_cert with the option to skip the signature check
+ * when the signature of the certificate was already verified with pkey.
+ */
+int x509_policy_verify_cert_sig(const struct lc_public_key *pkey,
+				const struct lc_x509_certificate *cert,
+				uint64_t flags, unsigned int check_sig);
+
 /**
  * @brief Decode an X.509 time ASN.1 object
  * @param [out] _t The time to fill in
@@ -128,6 +128,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_eku,
 	CKNULL(cert, -EINVAL);
 	CKNULL(eku_names, -EINVAL);
 	CKNULL(num_eku, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	pub = &cert->pub;
 
@@ -150,6 +151,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_eku_val,
 
 	CKNULL(cert, -EINVAL);
 	CKNULL(val, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	pub = &cert->pub;
 	*val = pub->key_eku;
@@ -192,6 +194,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_keyusage,
 	CKNULL(cert, -EINVAL);
 	CKNULL(keyusage_names, -EINVAL);
 	CKNULL(num_keyusage, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	pub = &cert->pub;
 
@@ -214,6 +217,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_keyusage_val,
 
 	CKNULL(cert, -EINVAL);
 	CKNULL(val, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	pub = &cert->pub;
 	*val = pub->key_usage;
@@ -231,6 +235,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_san_dns,
 	CKNULL(cert, -EINVAL);
 	CKNULL(san_dns_name, -EINVAL);
 	CKNULL(san_dns_len, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	*san_dns_name = cert->san_dns;
 	*san_dns_len = cert->san_dns_len;
@@ -272,6 +277,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_san_ip,
 	CKNULL(cert, -EINVAL);
 	CKNULL(san_ip, -EINVAL);
 	CKNULL(san_ip_len, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	*san_ip = cert->san_ip;
 	*san_ip_len = cert->san_ip_len;
@@ -289,6 +295,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_skid,
 	CKNULL(cert, -EINVAL);
 	CKNULL(skid, -EINVAL);
 	CKNULL(skidlen, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	*skid = cert->raw_skid;
 	*skidlen = cert->raw_skid_size;
@@ -306,6 +313,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_akid,
 	CKNULL(cert, -EINVAL);
 	CKNULL(akid, -EINVAL);
 	CKNULL(akidlen, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 
 	*akid = cert->raw_akid;
 	*akidlen = cert->raw_akid_size;
@@ -367,6 +375,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_subject_cn,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->subject_segments.cn, string,
 				   string_len));
 
@@ -381,6 +390,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_subject_email,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->subject_segments.email, string,
 				   string_len));
 
@@ -395,6 +405,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_subject_ou,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->subject_segments.ou, string,
 				   string_len));
 
@@ -409,6 +420,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_subject_o,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->subject_segments.o, string,
 				   string_len));
 
@@ -423,6 +435,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_subject_st,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->subject_segments.st, string,
 				   string_len));
 
@@ -437,6 +450,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_subject_c,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->subject_segments.c, string,
 				   string_len));
 
@@ -451,6 +465,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_issuer_cn,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->issuer_segments.cn, string,
 				   string_len));
 
@@ -465,6 +480,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_issuer_email,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->issuer_segments.email, string,
 				   string_len));
 
@@ -479,6 +495,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_issuer_ou,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->issuer_segments.ou, string,
 				   string_len));
 
@@ -493,6 +510,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_issuer_o,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->issuer_segments.o, string,
 				   string_len));
 
@@ -507,6 +525,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_issuer_st,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->issuer_segments.st, string,
 				   string_len));
 
@@ -521,6 +540,7 @@ LC_INTERFACE_FUNCTION(int, lc_x509_cert_get_issuer_c,
 	int ret = 0;
 
 	CKNULL(cert, -EINVAL);
+	CKINT(x509_cert_lazy_complete(cert));
 	CKINT(x509_cert_get_string(&cert->issuer_segments.c, string,
 				   string_len));
 
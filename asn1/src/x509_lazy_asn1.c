@@ -0,0 +1,184 @@
+
+/*
+ * Automatically generated by asn1_compiler.  Do not edit
+ *
+ * ASN.1 parser for x509_lazy
+ */
+#include "asn1_ber_bytecode.h"
+#include "x509_lazy_asn1.h"
+
+// clang-format off
+
+enum x509_lazy_actions {
+	ACT_x509_extract_key_data = 0,
+	ACT_x509_lazy_note_issuer = 1,
+	ACT_x509_lazy_note_subject = 2,
+	ACT_x509_note_algorithm_OID = 3,
+	ACT_x509_note_not_after = 4,
+	ACT_x509_note_not_before = 5,
+	ACT_x509_note_params = 6,
+	ACT_x509_note_serial = 7,
+	ACT_x509_note_sig_algo = 8,
+	ACT_x509_note_signature = 9,
+	ACT_x509_note_tbs_certificate = 10,
+	ACT_x509_set_gen_time = 11,
+	ACT_x509_set_uct_time = 12,
+	ACT_x509_signature_algorithm = 13,
+	ACT_x509_version = 14,
+	NR__x509_lazy_actions = 15
+};
+
+static const asn1_action_t x509_lazy_action_table[NR__x509_lazy_actions] = {
+	[   0] = x509_extract_key_data,
+	[   1] = x509_lazy_note_issuer,
+	[   2] = x509_lazy_note_subject,
+	[   3] = x509_note_algorithm_OID,
+	[   4] = x509_note_not_after,
+	[   5] = x509_note_not_before,
+	[   6] = x509_note_params,
+	[   7] = x509_note_serial,
+	[   8] = x509_note_sig_algo,
+	[   9] = x509_note_signature,
+	[  10] = x509_note_tbs_certificate,
+	[  11] = x509_set_gen_time,
+	[  12] = x509_set_uct_time,
+	[  13] = x509_signature_algorithm,
+	[  14] = x509_version,
+};
+
+static const asn1_action_enc_t x509_lazy_action_table_enc[NR__x509_lazy_actions] = {
+	[   0] = x509_extract_key_data_enc,
+	[   1] = x509_lazy_note_issuer_enc,
+	[   2] = x509_lazy_note_subject_enc,
+	[   3] = x509_note_algorithm_OID_enc,
+	[   4] = x509_note_not_after_enc,
+	[   5] = x509_note_not_before_enc,
+	[   6] = x509_note_params_enc,
+	[   7] = x509_note_serial_enc,
+	[   8] = x509_note_sig_algo_enc,
+	[   9] = x509_note_signature_enc,
+	[  10] = x509_note_tbs_certificate_enc,
+	[  11] = x509_set_gen_time_enc,
+	[  12] = x509_set_uct_time_enc,
+	[  13] = x509_signature_algorithm_enc,
+	[  14] = x509_version_enc,
+};
+
+static const unsigned char x509_lazy_machine[] = {
+	// Certificate
+	[   0] = ASN1_OP_MATCH,
+	[   1] = _tag(UNIV, CONS, SEQ),
+	// TBSCertificate
+	[   2] =  ASN1_OP_MATCH,
+	[   3] =  _tag(UNIV, CONS, SEQ),
+	[   4] =   ASN1_OP_MATCH_JUMP_OR_SKIP,		// version
+	[   5] =   _tagn(CONT, CONS,  0),
+	[   6] =   _jump_target(70),
+	// CertificateSerialNumber
+	[   7] =   ASN1_OP_MATCH,
+	[   8] =   _tag(UNIV, PRIM, INT),
+	[   9] =   ASN1_OP_ACT,
+	[  10] =   _action(ACT_x509_note_serial),
+	// AlgorithmIdentifier
+	[  11] =   ASN1_OP_MATCH_JUMP,
+	[  12] =   _tag(UNIV, CONS, SEQ),
+	[  13] =   _jump_target(76),		// --> AlgorithmIdentifier
+	[  14] =   ASN1_OP_ACT,
+	[  15] =   _action(ACT_x509_note_sig_algo),
+	[  16] =   ASN1_OP_MATCH_ANY_ACT,		// issuer
+	[  17] =   _action(ACT_x509_lazy_note_issuer),
+	// Validity
+	[  18] =   ASN1_OP_MATCH,
+	[  19] =   _tag(UNIV, CONS, SEQ),
+	// Time
+	[  20] =    ASN1_OP_MATCH_ACT_OR_SKIP,		// utcTime
+	[  21] =    _tag(UNIV, PRIM, UNITIM),
+	[  22] =    _action(ACT_x509_set_uct_time),
+	[  23] =    ASN1_OP_COND_MATCH_ACT_OR_SKIP,		// generalTime
+	[  24] =    _tag(UNIV, PRIM, GENTIM),
+	[  25] =    _action(ACT_x509_set_gen_time),
+	[  26] =    ASN1_OP_COND_FAIL,
+	[  27] =    ASN1_OP_ACT,
+	[  28] =    _action(ACT_x509_note_not_before),
+	// Time
+	[  29] =    ASN1_OP_MATCH_ACT_OR_SKIP,		// utcTime
+	[  30] =    _tag(UNIV, PRIM, UNITIM),
+	[  31] =    _action(ACT_x509_set_uct_time),
+	[  32] =    ASN1_OP_COND_MATCH_ACT_OR_SKIP,		// generalTime
+	[  33] =    _tag(UNIV, PRIM, GENTIM),
+	[  34] =    _action(ACT_x509_set_gen_time),
+	[  35] =    ASN1_OP_COND_FAIL,
+	[  36] =    ASN1_OP_ACT,
+	[  37] =    _action(ACT_x509_note_not_after),
+	[  38] =   ASN1_OP_END_SEQ,
+	[  39] =   ASN1_OP_MATCH_ANY_ACT,		// subject
+	[  40] =   _action(ACT_x509_lazy_note_subject),
+	// SubjectPublicKeyInfo
+	[  41] =   ASN1_OP_MATCH,
+	[  42] =   _tag(UNIV, CONS, SEQ),
+	// AlgorithmIdentifier
+	[  43] =    ASN1_OP_MATCH_JUMP,
+	[  44] =    _tag(UNIV, CONS, SEQ),
+	[  45] =    _jump_target(76),		// --> AlgorithmIdentifier
+	[  46] =    ASN1_OP_MATCH_ACT,		// subjectPublicKey
+	[  47] =    _tag(UNIV, PRIM, BTS),
+	[  48] =    _action(ACT_x509_extract_key_data),
+	[  49] =   ASN1_OP_END_SEQ,
+	// UniqueIdentifier
+	[  50] =   ASN1_OP_MATCH_OR_SKIP,		// issuerUniqueID
+	[  51] =   _tagn(CONT, PRIM,  1),
+	// UniqueIdentifier
+	[  52] =   ASN1_OP_MATCH_OR_SKIP,		// subjectUniqueID
+	[  53] =   _tagn(CONT, PRIM,  2),
+	[  54] =   ASN1_OP_MATCH_JUMP_OR_SKIP,		// extensions
+	[  55] =   _tagn(CONT, CONS,  3),
+	[  56] =   _jump_target(83),
+	[  57] =  ASN1_OP_END_SEQ,
+	[  58] =  ASN1_OP_ACT,
+	[  59] =  _action(ACT_x509_note_tbs_certificate),
+	// AlgorithmIdentifier
+	[  60] =  ASN1_OP_MATCH_JUMP,
+	[  61] =  _tag(UNIV, CONS, SEQ),
+	[  62] =  _jump_target(76),		// --> AlgorithmIdentifier
+	[  63] =  ASN1_OP_ACT,
+	[  64] =  _action(ACT_x509_signature_algorithm),
+	[  65] =  ASN1_OP_MATCH_ACT,		// signature
+	[  66] =  _tag(UNIV, PRIM, BTS),
+	[  67] =  _action(ACT_x509_note_signature),
+	[  68] = ASN1_OP_END_SEQ,
+	[  69] = ASN1_OP_COMPLETE,
+
+	// Version
+	[  70] =  ASN1_OP_MATCH,
+	[  71] =  _tag(UNIV, PRIM, INT),
+	[  72] =  ASN1_OP_ACT,
+	[  73] =  _action(ACT_x509_version),
+	[  74] = ASN1_OP_END_SEQ,
+	[  75] = ASN1_OP_RETURN,
+
+	[  76] =  ASN1_OP_MATCH_ACT,		// algorithm
+	[  77] =  _tag(UNIV, PRIM, OID),
+	[  78] =  _action(ACT_x509_note_algorithm_OID),
+	[  79] =  ASN1_OP_MATCH_ANY_ACT_OR_SKIP,		// parameters
+	[  80] =  _action(ACT_x509_note_params),
+	[  81] = ASN1_OP_END_SEQ,
+	[  82] = ASN1_OP_RETURN,
+
+	[  83] =  ASN1_OP_MATCH_ANY,		// extensions
+	[  84] = ASN1_OP_END_SEQ,
+	[  85] = ASN1_OP_RETURN,
+};
+
+const struct asn1_decoder x509_lazy_decoder = {
+	.machine = x509_lazy_machine,
+	.machlen = sizeof(x509_lazy_machine),
+	.actions = x509_lazy_action_table,
+};
+
+const struct asn1_encoder x509_lazy_encoder = {
+	.machine = x509_lazy_machine,
+	.machlen = sizeof(x509_lazy_machine),
+	.actions = x509_lazy_action_table_enc,
+};
+
+// clang-format on
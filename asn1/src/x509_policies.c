@@ -23,6 +23,7 @@
 #include "lc_memcmp_secure.h"
 #include "ret_checkers.h"
 #include "visibility.h"
+#include "x509_cert_parser.h"
 
 #define CKINT_POL(x)                                                           \
 	{                                                                      \
@@ -36,6 +37,17 @@
 		}                                                              \
 	}
 
+/*
+ * Parse the deferred parts of a lazily decoded certificate before the policy
+ * is applied to it.
+ */
+#define CKINT_LAZY(cert)                                                       \
+	{                                                                      \
+		int ret_lazy = x509_cert_lazy_complete(cert);                  \
+		if (ret_lazy < 0)                                              \
+			return ret_lazy;                                       \
+	}
+
 static lc_x509_pol_ret_t
 lc_509_policy_cert_contains_signature(const struct lc_x509_certificate *cert)
 {
@@ -72,6 +84,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_is_ca,
 
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	CKINT(lc_x509_policy_cert_valid(cert))
 	if (ret != LC_X509_POL_TRUE)
@@ -120,6 +133,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_is_selfsigned,
 {
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	if (!cert->self_signed)
 		return LC_X509_POL_FALSE;
@@ -134,6 +148,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_is_root_ca,
 
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	if (cert->raw_akid) {
 		CKINT(lc_x509_policy_match_akid(cert, cert->raw_skid,
@@ -165,6 +180,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_can_validate_crls,
 
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	pub = &cert->pub;
 
@@ -189,6 +205,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_match_akid,
 	lc_x509_pol_ret_t ret;
 
 	CKNULL(cert, -EINVAL);
+	CKINT_LAZY(cert);
 
 	if (!reference_akid)
 		return LC_X509_POL_FALSE;
@@ -228,6 +245,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_match_skid,
 	lc_x509_pol_ret_t ret;
 
 	CKNULL(cert, -EINVAL);
+	CKINT_LAZY(cert);
 
 	if (!reference_skid)
 		return LC_X509_POL_FALSE;
@@ -293,6 +311,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_match_key_usage,
 {
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	return lc_x509_policy_match_key_usage_pub(&cert->pub,
 						  required_key_usage);
@@ -308,6 +327,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t,
 
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	/* If the caller does not requests the checking, return true */
 	if (!required_eku)
@@ -371,6 +391,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_cert_valid,
 {
 	if (!cert)
 		return -EINVAL;
+	CKINT_LAZY(cert);
 
 	/*
 	 * RFC5280 section 4.2.1.3: SKID must always be present.
@@ -398,7 +419,7 @@ LC_INTERFACE_FUNCTION(lc_x509_pol_ret_t, lc_x509_policy_cert_valid,
 
 static int lc_x509_policy_verify_general(const struct lc_public_key *pkey,
 					 const struct lc_x509_certificate *cert,
-					 uint64_t flags)
+					 uint64_t flags, unsigned int check_sig)
 {
 	time64_t time_since_epoch = 0;
 	int ret;
@@ -431,20 +452,21 @@ static int lc_x509_policy_verify_general(const struct lc_public_key *pkey,
 	/*
 	 * Certificate validation: Check signature
 	 */
-	CKINT_SIGCHECK(public_key_verify_signature(pkey, &cert->sig));
+	if (check_sig)
+		CKINT_SIGCHECK(public_key_verify_signature(pkey, &cert->sig));
 
 out:
 	return ret;
 }
 
-LC_INTERFACE_FUNCTION(int, lc_x509_policy_verify_cert,
-		      const struct lc_public_key *pkey,
-		      const struct lc_x509_certificate *cert, uint64_t flags)
+int x509_policy_verify_cert_sig(const struct lc_public_key *pkey,
+				const struct lc_x509_certificate *cert,
+				uint64_t flags, unsigned int check_sig)
 {
 	lc_x509_pol_ret_t ret_pol;
 	int ret;
 
-	CKINT(lc_x509_policy_verify_general(pkey, cert, flags));
+	CKINT(lc_x509_policy_verify_general(pkey, cert, flags, check_sig));
 
 	/*
 	 * A certificate must be allowed for key sign for successfully
@@ -456,3 +478,10 @@ LC_INTERFACE_FUNCTION(int, lc_x509_policy_verify_cert,
 out:
 	return ret;
 }
+
+LC_INTERFACE_FUNCTION(int, lc_x509_policy_verify_cert,
+		      const struct lc_public_key *pkey,
+		      const struct lc_x509_certificate *cert, uint64_t flags)
+{
+	return x509_policy_verify_cert_sig(pkey, cert, flags, 1);
+}
@@ -21,6 +21,7 @@
 #include <errno.h>
 #include <getopt.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
 #include "lc_pkcs7_parser.h"
@@ -34,10 +35,46 @@
 #include "../src/x509_cert_parser.h"
 #include "../../apps/src/lc_x509_generator_file_helper.h"
 
-static int x509_load(const struct x509_checker_options *parsed_opts)
+static int x509_load_lazy(struct lc_x509_certificate *x509_lazy,
+			  const struct lc_x509_certificate *x509,
+			  const uint8_t *data, size_t datalen)
+{
+	const char *string;
+	size_t string_len;
+	int ret;
+
+	CKINT_LOG(lc_x509_cert_decode_lazy(x509_lazy, data, datalen),
+		  "Lazy parsing of message failed\n");
+
+	/* Public key and validity are available without the full parsing */
+	if (x509_lazy->pub.key != x509->pub.key ||
+	    x509_lazy->pub.keylen != x509->pub.keylen ||
+	    x509_lazy->pub.pkey_algo != x509->pub.pkey_algo ||
+	    x509_lazy->valid_from != x509->valid_from ||
+	    x509_lazy->valid_to != x509->valid_to) {
+		printf("Lazy parsing: public key or validity mismatch\n");
+		ret = -EINVAL;
+		goto out;
+	}
+
+	/* Trigger the parsing of the deferred data */
+	CKINT(lc_x509_cert_get_subject_cn(x509_lazy, &string, &string_len));
+
+	if (memcmp(x509_lazy, x509, sizeof(*x509))) {
+		printf("Lazy parsing: certificate mismatch\n");
+		ret = -EINVAL;
+	}
+
+out:
+	return ret;
+}
+
+static int x509_load(const struct x509_checker_options *parsed_opts,
+		     unsigned int lazy)
 {
 	struct workspace {
 		struct lc_x509_certificate x509_msg;
+		struct lc_x509_certificate x509_lazy;
 	};
 	size_t datalen = 0;
 	uint8_t *data = NULL;
@@ -52,11 +89,17 @@ static int x509_load(const struct x509_checker_options *parsed_opts)
 	CKINT_LOG(lc_x509_cert_decode(&ws->x509_msg, data, datalen),
 		  "Parsing of message failed\n");
 
+	if (lazy) {
+		CKINT(x509_load_lazy(&ws->x509_lazy, &ws->x509_msg, data,
+				     datalen));
+	}
+
 	CKINT(apply_checks_x509(&ws->x509_msg, parsed_opts));
 
 out:
 	release_data(data, datalen);
 	lc_x509_cert_clear(&ws->x509_msg);
+	lc_x509_cert_clear(&ws->x509_lazy);
 	LC_RELEASE_MEM(ws);
 	return ret;
 }
@@ -163,6 +206,8 @@ static void asn1_usage(void)
 	fprintf(stderr, "\t   --san-ip <IP-Hex>\t\tmatch SAN IP\n");
 	fprintf(stderr, "\t   --skid <HEX>\t\tmatch subject key ID\n");
 	fprintf(stderr, "\t   --akid <HEX>\t\tmatch authority key ID\n");
+	fprintf(stderr,
+		"\t   --lazy\t\tcompare with lazily decoded X.509 data\n");
 
 	fprintf(stderr, "\t-h  --help\t\tPrint this help text\n");
 }
@@ -171,6 +216,7 @@ int main(int argc, char *argv[])
 {
 	struct x509_checker_options parsed_opts = { 0 };
 	int ret = 0, opt_index = 0;
+	unsigned int lazy = 0;
 
 	static const char *opts_short = "f:hxpv:";
 	static const struct option opts[] = { { "help", 0, 0, 'h' },
@@ -197,6 +243,7 @@ int main(int argc, char *argv[])
 						0 },
 					      { "check-time", 0, 0, 0 },
 					      { "verify", 1, 0, 'v' },
+					      { "lazy", 0, 0, 0 },
 
 					      { 0, 0, 0, 0 } };
 
@@ -308,6 +355,11 @@ int main(int argc, char *argv[])
 				parsed_opts.asn1_type = asn1_type_verify;
 				parsed_opts.verified_file = optarg;
 				break;
+
+			/* lazy */
+			case 22:
+				lazy = 1;
+				break;
 			}
 			break;
 
@@ -343,7 +395,7 @@ int main(int argc, char *argv[])
 		CKINT(pkcs7_load(&parsed_opts));
 		break;
 	case asn1_type_x509:
-		CKINT(x509_load(&parsed_opts));
+		CKINT(x509_load(&parsed_opts, lazy));
 		break;
 	case asn1_type_verify:
 		CKINT(pkcs7_load_and_verify(&parsed_opts));
@@ -19,8 +19,10 @@
 
 #define _GNU_SOURCE
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
 #include <stdio.h>
+#include <unistd.h>
 
 #include "lc_pkcs7_parser.h"
 #include "ret_checkers.h"
@@ -37,12 +39,31 @@ struct pkcs7_trust_options {
 	const char *verified_file;
 };
 
+/*
+ * Executor running the jobs in reverse order to show that the result does not
+ * depend on the execution order.
+ */
+static void pkcs7_trust_executor(void *executor_ctx,
+				 void (*job)(void *job_ctx, unsigned int idx),
+				 void *job_ctx, unsigned int num_jobs)
+{
+	unsigned int *executed = executor_ctx;
+
+	while (num_jobs) {
+		job(job_ctx, --num_jobs);
+		(*executed)++;
+	}
+}
+
 static int pkcs7_trust_store(struct pkcs7_trust_options *opts)
 {
 	struct workspace {
 		struct lc_pkcs7_trust_store trust_store;
+		struct lc_pkcs7_verify_cache verify_cache;
 		struct lc_x509_certificate x509[MAX_FILES];
 		struct lc_pkcs7_message pkcs7;
+		struct lc_pkcs7_message pkcs7_stream;
+		struct lc_pkcs7_verify_stream stream;
 	};
 	uint8_t *data[MAX_FILES] = { 0 };
 	size_t datalen[MAX_FILES] = { 0 };
@@ -50,8 +71,10 @@ static int pkcs7_trust_store(struct pkcs7_trust_options *opts)
 	size_t pkcs7_datalen = 0;
 	uint8_t *verified_data = NULL;
 	size_t verified_datalen = 0;
-	unsigned int i;
-	int ret = 0;
+	unsigned int i, executed = 0;
+	struct lc_pkcs7_executor executor = { .run = pkcs7_trust_executor,
+					      .executor_ctx = &executed };
+	int fd = -1, ret = 0;
 	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
 
 	for (i = 0; i < opts->num_files; i++) {
@@ -81,6 +104,57 @@ static int pkcs7_trust_store(struct pkcs7_trust_options *opts)
 
 		CKINT_LOG(lc_pkcs7_verify(&ws->pkcs7, &ws->trust_store, NULL),
 			  "PKCS#7 verification\n");
+
+		CKINT_LOG(lc_pkcs7_verify_parallel(&ws->pkcs7,
+						   &ws->trust_store, NULL,
+						   &executor),
+			  "PKCS#7 parallel verification\n");
+		if (!executed) {
+			printf("PKCS#7 parallel verification without jobs\n");
+			ret = -EFAULT;
+			goto out;
+		}
+
+		/*
+		 * Verify again with the verification cache: the first run
+		 * fills the cache, the second run uses the cached results.
+		 */
+		lc_pkcs7_verify_cache_clear(&ws->verify_cache);
+		CKINT(lc_pkcs7_trust_store_set_verify_cache(&ws->trust_store,
+							    &ws->verify_cache));
+		CKINT_LOG(lc_pkcs7_verify(&ws->pkcs7, &ws->trust_store, NULL),
+			  "PKCS#7 verification filling the cache\n");
+		CKINT_LOG(lc_pkcs7_verify(&ws->pkcs7, &ws->trust_store, NULL),
+			  "PKCS#7 verification using the cache\n");
+
+		/* Verify the detached data in chunks */
+		CKINT_LOG(lc_pkcs7_decode(&ws->pkcs7_stream, pkcs7_data,
+					  pkcs7_datalen),
+			  "Parsing of PKCS#7 message\n");
+		CKINT(lc_pkcs7_verify_stream_init(&ws->stream,
+						  &ws->pkcs7_stream));
+		for (i = 0; i < verified_datalen; i += 7) {
+			CKINT(lc_pkcs7_verify_stream_update(
+				&ws->stream, verified_data + i,
+				verified_datalen - i < 7 ? verified_datalen - i :
+							   7));
+		}
+		CKINT_LOG(lc_pkcs7_verify_stream_final(&ws->stream,
+						       &ws->trust_store, NULL),
+			  "PKCS#7 streaming verification\n");
+
+		/* Verify the detached data read from the file */
+		fd = open(opts->verified_file, O_RDONLY);
+		if (fd < 0) {
+			ret = -errno;
+			goto out;
+		}
+		CKINT(lc_pkcs7_verify_stream_init(&ws->stream,
+						  &ws->pkcs7_stream));
+		CKINT(lc_pkcs7_verify_stream_update_fd(&ws->stream, fd));
+		CKINT_LOG(lc_pkcs7_verify_stream_final(&ws->stream,
+						       &ws->trust_store, NULL),
+			  "PKCS#7 streaming verification from file\n");
 	}
 
 out:
@@ -90,6 +164,8 @@ out:
 	}
 	release_data(pkcs7_data, pkcs7_datalen);
 	release_data(verified_data, verified_datalen);
+	if (fd >= 0)
+		close(fd);
 
 	/*
 	 * A conversion to support testing on different systems where the
@@ -100,6 +176,8 @@ out:
 	if (ret == -ENOKEY)
 		ret = -249;
 
+	lc_pkcs7_verify_stream_clear(&ws->stream);
+	lc_pkcs7_message_clear(&ws->pkcs7_stream);
 	lc_pkcs7_message_clear(&ws->pkcs7);
 	lc_pkcs7_trust_store_clear(&ws->trust_store);
 	LC_RELEASE_MEM(ws);
@@ -102,9 +102,16 @@ extern "C" {
 #define lc_bike_enc_kdf BIKE_F(enc_kdf)
 #define lc_bike_enc_internal BIKE_F(enc_internal)
 #define lc_bike_dec BIKE_F(dec)
+#define lc_bike_dec_batch BIKE_F(dec_batch)
 #define lc_bike_dec_kdf BIKE_F(dec_kdf)
 
 #define bike_decode BIKE_F(bike_decode)
+#define bike_decode_init BIKE_F(bike_decode_init)
+#define bike_decode_ws BIKE_F(bike_decode_ws)
+#define bike_profile_add BIKE_F(bike_profile_add)
+#define bike_profile_reset BIKE_F(bike_profile_reset)
+#define bike_profile_get BIKE_F(bike_profile_get)
+#define bike_profile_name BIKE_F(bike_profile_name)
 #define rotate_right_port BIKE_F(rotate_right_port)
 #define dup_port BIKE_F(dup_port)
 #define bit_sliced_adder_port BIKE_F(bit_sliced_adder_port)
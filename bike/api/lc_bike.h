@@ -453,6 +453,28 @@ int lc_bike_enc_kdf(struct lc_bike_ct *ct, uint8_t *ss, size_t ss_len,
 int lc_bike_dec(struct lc_bike_ss *ss, const struct lc_bike_ct *ct,
 		const struct lc_bike_sk *sk);
 
+/**
+ * @ingroup BIKE
+ * @brief Key decapsulation of multiple cipher texts for one private key
+ *
+ * Generates the shared secrets for cipher texts that were all generated for
+ * the same key pair. The result is identical to invoking \p lc_bike_dec for
+ * each cipher text, but the key-dependent decoder setup and the memory
+ * allocation are shared between all cipher texts.
+ *
+ * @param [out] ss array of \p num pointers to output shared secrets
+ * @param [in] ct array of \p num pointers to input cipher texts
+ * @param [in] num number of entries in \p ss and \p ct
+ * @param [in] sk pointer to input private key
+ *
+ * @return 0 (success) or < 0 on error
+ *
+ * On decoding failure, the respective ss will contain a pseudo-random value.
+ */
+int lc_bike_dec_batch(struct lc_bike_ss *const *ss,
+		      const struct lc_bike_ct *const *ct, unsigned int num,
+		      const struct lc_bike_sk *sk);
+
 /**
  * @ingroup BIKE
  * @brief Key decapsulation with KDF applied to shared secret
@@ -634,6 +634,102 @@ LC_INTERFACE_FUNCTION(int, lc_bike_dec, struct lc_bike_ss *ss,
 	}
 }
 
+/*
+ * Number of cipher texts whose type-specific pointers are collected on the
+ * stack before handing them to the type-specific batch decapsulation.
+ */
+#define LC_BIKE_DEC_BATCH_CHUNK 16
+
+static int lc_bike_dec_batch_chunk(struct lc_bike_ss *const *ss,
+				   const struct lc_bike_ct *const *ct,
+				   unsigned int num, const struct lc_bike_sk *sk)
+{
+	unsigned int i;
+
+	switch (sk->bike_type) {
+	case LC_BIKE_5:
+#ifdef LC_BIKE_5_ENABLED
+	{
+		struct lc_bike_5_ss *ss_5[LC_BIKE_DEC_BATCH_CHUNK];
+		const struct lc_bike_5_ct *ct_5[LC_BIKE_DEC_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			ss[i]->bike_type = LC_BIKE_5;
+			ss_5[i] = &ss[i]->key.ss_5;
+			ct_5[i] = &ct[i]->key.ct_5;
+		}
+		return lc_bike_5_dec_batch(ss_5, ct_5, num, &sk->key.sk_5);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_BIKE_3:
+#ifdef LC_BIKE_3_ENABLED
+	{
+		struct lc_bike_3_ss *ss_3[LC_BIKE_DEC_BATCH_CHUNK];
+		const struct lc_bike_3_ct *ct_3[LC_BIKE_DEC_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			ss[i]->bike_type = LC_BIKE_3;
+			ss_3[i] = &ss[i]->key.ss_3;
+			ct_3[i] = &ct[i]->key.ct_3;
+		}
+		return lc_bike_3_dec_batch(ss_3, ct_3, num, &sk->key.sk_3);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_BIKE_1:
+#ifdef LC_BIKE_1_ENABLED
+	{
+		struct lc_bike_1_ss *ss_1[LC_BIKE_DEC_BATCH_CHUNK];
+		const struct lc_bike_1_ct *ct_1[LC_BIKE_DEC_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			ss[i]->bike_type = LC_BIKE_1;
+			ss_1[i] = &ss[i]->key.ss_1;
+			ct_1[i] = &ct[i]->key.ct_1;
+		}
+		return lc_bike_1_dec_batch(ss_1, ct_1, num, &sk->key.sk_1);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_BIKE_UNKNOWN:
+	default:
+		(void)i;
+		return -EOPNOTSUPP;
+	}
+}
+
+LC_INTERFACE_FUNCTION(int, lc_bike_dec_batch, struct lc_bike_ss *const *ss,
+		      const struct lc_bike_ct *const *ct, unsigned int num,
+		      const struct lc_bike_sk *sk)
+{
+	unsigned int i, n;
+	int ret;
+
+	if (!ss || !ct || !sk)
+		return -EINVAL;
+
+	for (i = 0; i < num; i++) {
+		if (!ss[i] || !ct[i] || ct[i]->bike_type != sk->bike_type)
+			return -EINVAL;
+	}
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_BIKE_DEC_BATCH_CHUNK)
+			n = LC_BIKE_DEC_BATCH_CHUNK;
+
+		ret = lc_bike_dec_batch_chunk(ss + i, ct + i, n, sk);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_bike_dec_kdf, uint8_t *ss, size_t ss_len,
 		      const struct lc_bike_ct *ct, const struct lc_bike_sk *sk)
 {
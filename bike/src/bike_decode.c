@@ -59,6 +59,8 @@
 #include "bike_decode.h"
 #include "bike_decode_internal.h"
 #include "bike_gf2x.h"
+#include "bike_gf2x_internal.h"
+#include "bike_profile.h"
 #include "bike_utilities.h"
 #include "build_bug_on.h"
 #include "lc_memset_secure.h"
@@ -79,39 +81,36 @@
 #endif
 
 static void compute_syndrome(syndrome_t *syndrome, const pad_r_t *c0,
-			     const pad_r_t *h0, const decode_ctx *ctx,
-			     pad_r_t *pad_s, dbl_pad_r_t *t,
-			     uint64_t secure_buffer[LC_SECURE_BUFFER_QWORDS])
+			     const pad_r_t *h0, struct bike_decode_ws *ws,
+			     pad_r_t *pad_s)
 {
-	lc_memset_secure(secure_buffer, 0, sizeof(*secure_buffer));
-	gf2x_mod_mul(pad_s, c0, h0, t, secure_buffer);
+	lc_memset_secure(ws->secure_buffer, 0, sizeof(*ws->secure_buffer));
+	gf2x_mod_mul_with_ctx(pad_s, c0, h0, &ws->gf2x_ctx, &ws->t,
+			      ws->secure_buffer);
 
 	memcpy((uint8_t *)syndrome->qw, pad_s->val.raw, LC_BIKE_R_BYTES);
-	ctx->dup(syndrome);
+	ws->ctx.dup(syndrome);
 }
 
-static inline void
-recompute_syndrome(syndrome_t *syndrome, const pad_r_t *c0, const pad_r_t *h0,
-		   const pad_r_t *pk, const e_t *e, const decode_ctx *ctx,
-		   pad_r_t *tmp_c0, pad_r_t *e0, pad_r_t *e1, pad_r_t *pad_s,
-		   dbl_pad_r_t *t,
-		   uint64_t secure_buffer[LC_SECURE_BUFFER_QWORDS])
+static inline void recompute_syndrome(syndrome_t *syndrome, const pad_r_t *c0,
+				      const e_t *e, struct bike_decode_ws *ws)
 {
-	lc_memset_secure(e0, 0, sizeof(*e0));
-	lc_memset_secure(e1, 0, sizeof(*e1));
+	lc_memset_secure(&ws->e0, 0, sizeof(ws->e0));
+	lc_memset_secure(&ws->e1, 0, sizeof(ws->e1));
 
-	e0->val = e->val[0];
-	e1->val = e->val[1];
+	ws->e0.val = e->val[0];
+	ws->e1.val = e->val[1];
 
-	lc_memset_secure(secure_buffer, 0, sizeof(*secure_buffer));
+	lc_memset_secure(ws->secure_buffer, 0, sizeof(*ws->secure_buffer));
 
 	// tmp_c0 = pk * e1 + c0 + e0
-	gf2x_mod_mul(tmp_c0, e1, pk, t, secure_buffer);
-	gf2x_mod_add(tmp_c0, tmp_c0, c0);
-	gf2x_mod_add(tmp_c0, tmp_c0, e0);
+	gf2x_mod_mul_with_ctx(&ws->tmp_c0, &ws->e1, &ws->pk, &ws->gf2x_ctx,
+			      &ws->t, ws->secure_buffer);
+	gf2x_mod_add(&ws->tmp_c0, &ws->tmp_c0, c0);
+	gf2x_mod_add(&ws->tmp_c0, &ws->tmp_c0, &ws->e0);
 
 	// Recompute the syndrome using the updated ciphertext
-	compute_syndrome(syndrome, tmp_c0, h0, ctx, pad_s, t, secure_buffer);
+	compute_syndrome(syndrome, &ws->tmp_c0, &ws->h0, ws, &ws->pad_s);
 }
 
 #define MUL64HIGH(c, a, b)                                                     \
@@ -283,38 +282,41 @@ out:
 	return ret;
 }
 
-int bike_decode(e_t *e, const struct lc_bike_ct *ct,
-		const struct lc_bike_sk *sk)
+void bike_decode_init(struct bike_decode_ws *ws, const struct lc_bike_sk *sk)
 {
-	struct workspace {
-		pad_r_t c0, h0, pk, pad_s, tmp_c0, e0, e1;
-		dbl_pad_r_t t;
-		syndrome_t s, rotated_syndrome;
-		upc_t upc;
-		uint64_t secure_buffer[LC_SECURE_BUFFER_QWORDS];
-		decode_ctx ctx;
-		e_t black_e, gray_e;
-	};
-	unsigned int iter;
-	int ret;
-	LC_DECLARE_MEM(ws, struct workspace, LC_BIKE_ALIGN_BYTES);
+	uint64_t prof = bike_profile_start();
 
 	decode_ctx_init(&ws->ctx);
+	gf2x_ctx_init(&ws->gf2x_ctx);
 
-	// Pad ciphertext (c0), secret key (h0), and public key (h)
-	ws->c0.val = ct->c0;
+	// Pad the secret key (h0) and the public key (h)
 	ws->h0.val = sk->bin[0];
 	ws->pk.val = sk->pk;
 
+	bike_profile_stop(BIKE_PROFILE_DEC_SETUP, prof);
+}
+
+int bike_decode_ws(e_t *e, const struct lc_bike_ct *ct,
+		   const struct lc_bike_sk *sk, struct bike_decode_ws *ws)
+{
+	uint64_t prof;
+	unsigned int iter;
+	int ret;
+
+	// Pad ciphertext (c0)
+	ws->c0.val = ct->c0;
+
 	//DMSG("  Computing s.\n");
-	compute_syndrome(&ws->s, &ws->c0, &ws->h0, &ws->ctx, &ws->pad_s, &ws->t,
-			 ws->secure_buffer);
+	prof = bike_profile_start();
+	compute_syndrome(&ws->s, &ws->c0, &ws->h0, ws, &ws->pad_s);
 	ws->ctx.dup(&ws->s);
+	bike_profile_stop(BIKE_PROFILE_DEC_SYNDROME, prof);
 
 	// Reset (init) the error because it is xored in the find_err functions.
 	memset(e, 0, sizeof(*e));
 
 	for (iter = 0; iter < LC_BIKE_MAX_IT; iter++) {
+		prof = bike_profile_start();
 		const uint8_t threshold = get_threshold(&ws->s);
 
 		//DMSG("    Iteration: %d\n", iter);
@@ -325,10 +327,11 @@ int bike_decode(e_t *e, const struct lc_bike_ct *ct,
 		CKINT(find_err1(e, &ws->black_e, &ws->gray_e, &ws->s, sk->wlist,
 				threshold, &ws->ctx, &ws->rotated_syndrome,
 				&ws->upc));
+		bike_profile_stop(BIKE_PROFILE_DEC_UPC, prof);
 
-		recompute_syndrome(&ws->s, &ws->c0, &ws->h0, &ws->pk, e,
-				   &ws->ctx, &ws->tmp_c0, &ws->e0, &ws->e1,
-				   &ws->pad_s, &ws->t, ws->secure_buffer);
+		prof = bike_profile_start();
+		recompute_syndrome(&ws->s, &ws->c0, e, ws);
+		bike_profile_stop(BIKE_PROFILE_DEC_SYNDROME, prof);
 #if defined(BGF_DECODER)
 		if (iter >= 1) {
 			continue;
@@ -339,22 +342,37 @@ int bike_decode(e_t *e, const struct lc_bike_ct *ct,
 		//DMSG("    Weight of syndrome: %lu\n", r_bits_vector_weight((r_t *)s.qw));
 
 		//find_err2(e, &black_e, &s, sk->wlist, ((D + 1) / 2) + 1, &ctx);
-		recompute_syndrome(&ws->s, &ws->c0, &ws->h0, &ws->pk, e,
-				   &ws->ctx, &ws->tmp_c0, &ws->e0, &ws->e1,
-				   &ws->pad_s, &ws->t, ws->secure_buffer);
+		prof = bike_profile_start();
+		recompute_syndrome(&ws->s, &ws->c0, e, ws);
+		bike_profile_stop(BIKE_PROFILE_DEC_SYNDROME, prof);
 
 		//DMSG("    Weight of e: %lu\n",
 		//     r_bits_vector_weight(&e->val[0]) + r_bits_vector_weight(&e->val[1]));
 		//DMSG("    Weight of syndrome: %lu\n", r_bits_vector_weight((r_t *)s.qw));
+		prof = bike_profile_start();
 		CKINT(find_err2(e, &ws->gray_e, &ws->s, sk->wlist,
 				((LC_BIKE_D + 1) / 2) + 1, &ws->ctx,
 				&ws->rotated_syndrome, &ws->upc));
+		bike_profile_stop(BIKE_PROFILE_DEC_UPC, prof);
 
-		recompute_syndrome(&ws->s, &ws->c0, &ws->h0, &ws->pk, e,
-				   &ws->ctx, &ws->tmp_c0, &ws->e0, &ws->e1,
-				   &ws->pad_s, &ws->t, ws->secure_buffer);
+		prof = bike_profile_start();
+		recompute_syndrome(&ws->s, &ws->c0, e, ws);
+		bike_profile_stop(BIKE_PROFILE_DEC_SYNDROME, prof);
 	}
 
+out:
+	return ret;
+}
+
+int bike_decode(e_t *e, const struct lc_bike_ct *ct,
+		const struct lc_bike_sk *sk)
+{
+	int ret;
+	LC_DECLARE_MEM(ws, struct bike_decode_ws, LC_BIKE_ALIGN_BYTES);
+
+	bike_decode_init(ws, sk);
+	CKINT(bike_decode_ws(e, ct, sk, ws));
+
 out:
 	LC_RELEASE_MEM(ws);
 	return 0;
@@ -30,12 +30,34 @@
 #ifndef BIKE_DECODE_H
 #define BIKE_DECODE_H
 
+#include "bike_decode_internal.h"
+#include "bike_gf2x_internal.h"
 #include "bike_internal.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Decoder state that only depends on the secret key (padded h0 and pk as well
+ * as the dispatch contexts) is set up once with bike_decode_init and can then
+ * be reused by bike_decode_ws for any number of ciphertexts of that key.
+ */
+struct bike_decode_ws {
+	pad_r_t c0, h0, pk, pad_s, tmp_c0, e0, e1;
+	dbl_pad_r_t t;
+	syndrome_t s, rotated_syndrome;
+	upc_t upc;
+	uint64_t secure_buffer[LC_SECURE_BUFFER_QWORDS];
+	decode_ctx ctx;
+	gf2x_ctx gf2x_ctx;
+	e_t black_e, gray_e;
+};
+
+void bike_decode_init(struct bike_decode_ws *ws, const struct lc_bike_sk *sk);
+int bike_decode_ws(e_t *e, const struct lc_bike_ct *ct,
+		   const struct lc_bike_sk *sk, struct bike_decode_ws *ws);
+
 int bike_decode(e_t *e, const struct lc_bike_ct *ct,
 		const struct lc_bike_sk *sk);
 
@@ -63,6 +63,21 @@ int k_sqr_port(pad_r_t *c, const pad_r_t *a, size_t l_param);
 // c = a mod (x^r - 1)
 void gf2x_red_port(pad_r_t *c, const dbl_pad_r_t *a);
 
+// Number of 16-bit words written by the vectorized k-squaring functions
+#define K_SQR_WORDS LC_BIKE_DIVIDE_AND_CEIL(LC_BIKE_R_BITS, 16)
+
+// Clear the bits of a k-squaring result beyond r and the remaining bytes of
+// the last QWORD which the multiplication operates on.
+static inline void k_sqr_clear_tail(pad_r_t *c)
+{
+	uint8_t *raw = (uint8_t *)c;
+	size_t i;
+
+	raw[LC_BIKE_R_BYTES - 1] &= LC_BIKE_LAST_R_BYTE_MASK;
+	for (i = LC_BIKE_R_BYTES; i < LC_BIKE_R_QWORDS * 8; i++)
+		raw[i] = 0;
+}
+
 // AVX2 and AVX512 versions of the functions
 #if defined(X86_64)
 // ------------------ FUNCTIONS NEEDED FOR GF2X MULTIPLICATION ------------------
@@ -100,6 +115,16 @@ void gf2x_red_avx2(pad_r_t *c, const dbl_pad_r_t *a);
 void gf2x_red_avx512(pad_r_t *c, const dbl_pad_r_t *a);
 #endif
 
+// Thresholds for switching from repeated squaring to k-squaring in the
+// inversion, derived from benchmarks of k-squaring against squaring:
+//   - vectorized k-squaring costs about as much as 30 to 50 squarings,
+//   - portable k-squaring costs about as much as 200 squarings using
+//     carry-less multiplication,
+//   - portable squaring is about as expensive as a k-squaring.
+#define K_SQR_THR_VEC (32)
+#define K_SQR_THR_PORT (128)
+#define K_SQR_THR_SQR_PORT (1)
+
 // GF2X methods struct
 typedef struct gf2x_ctx_st {
 	size_t mul_base_qwords;
@@ -114,6 +139,9 @@ typedef struct gf2x_ctx_st {
 
 	void (*sqr)(dbl_pad_r_t *c, const pad_r_t *a);
 	int (*k_sqr)(pad_r_t *c, const pad_r_t *a, size_t l_param);
+	// Exponentiations f^(2^k) with k up to this threshold are computed by
+	// repeated squaring, larger ones by k-squaring.
+	size_t k_sqr_thr;
 
 	void (*red)(pad_r_t *c, const dbl_pad_r_t *a);
 } gf2x_ctx;
@@ -133,6 +161,7 @@ static inline void gf2x_ctx_init(gf2x_ctx *ctx)
 		ctx->karatzuba_add2 = karatzuba_add2_avx512;
 		ctx->karatzuba_add3 = karatzuba_add3_avx512;
 		ctx->k_sqr = k_sqr_avx512;
+		ctx->k_sqr_thr = K_SQR_THR_VEC;
 		ctx->red = gf2x_red_avx512;
 	} else if (feat & LC_CPU_FEATURE_INTEL_AVX2) {
 		ctx->karatzuba_add1 = karatzuba_add1_avx2;
@@ -142,8 +171,10 @@ static inline void gf2x_ctx_init(gf2x_ctx *ctx)
 		//TODO fix this
 #ifdef LINUX_KERNEL
 		ctx->k_sqr = k_sqr_port;
+		ctx->k_sqr_thr = K_SQR_THR_PORT;
 #else
 		ctx->k_sqr = k_sqr_avx2;
+		ctx->k_sqr_thr = K_SQR_THR_VEC;
 #endif
 		ctx->red = gf2x_red_avx2;
 	} else
@@ -153,6 +184,7 @@ static inline void gf2x_ctx_init(gf2x_ctx *ctx)
 		ctx->karatzuba_add2 = karatzuba_add2_port;
 		ctx->karatzuba_add3 = karatzuba_add3_port;
 		ctx->k_sqr = k_sqr_port;
+		ctx->k_sqr_thr = K_SQR_THR_PORT;
 		ctx->red = gf2x_red_port;
 	}
 
@@ -172,6 +204,7 @@ static inline void gf2x_ctx_init(gf2x_ctx *ctx)
 		ctx->mul_base_qwords = GF2X_PORT_BASE_QWORDS;
 		ctx->mul_base = gf2x_mul_base_port;
 		ctx->sqr = gf2x_sqr_port;
+		ctx->k_sqr_thr = K_SQR_THR_SQR_PORT;
 	}
 }
 
@@ -35,6 +35,7 @@
 #include "bike_gf2x.h"
 #include "bike_gf2x_internal.h"
 #include "build_bug_on.h"
+#include "helper.h"
 #include "lc_memset_secure.h"
 #include "small_stack_support.h"
 #include "ret_checkers.h"
@@ -63,73 +64,102 @@ static inline void repeated_squaring(pad_r_t *c, const pad_r_t *a,
 // The gf2x_mod_inv function implements inversion in F_2[x]/(x^R - 1)
 // based on [1](Algorithm 2).
 
-// In every iteration, [1](Algorithm 2) performs two exponentiations:
-// exponentiation 0 (exp0) and exponentiation 1 (exp1) of the form f^(2^k).
-// These exponentiations are computed either by repeated squaring of f, k times,
-// or by a single k-squaring of f. The method for a specific value of k
-// is chosen based on the performance of squaring and k-squaring.
+// [1](Algorithm 2) computes a^-1 = (a^(2^(r-2) - 1))^2 by building the
+// exponents f_u = a^(2^u - 1) along the binary representation of r-2 where
+// each step f_(u+v) = (f_u)^(2^v) * f_v costs one multiplication and one
+// exponentiation of the form f^(2^k). The binary method requires
+// floor(log2(r-2)) + popcount(r-2) - 1 multiplications. Any addition chain
+// 1 = u_0 < u_1 < ... < u_n = r-2 can be used instead, where the number of
+// multiplications equals the length n of the chain. The chains below were
+// found by an exhaustive search for the shortest addition chains of r-2;
+// among those, the chain minimizing the costs of the exponentiations was
+// selected. For BIKE level 5 this saves one multiplication compared to the
+// binary method.
+//
+// Every step of the chain computes f = f^(2^k) * m and is described by:
+//   - k: the exponentiation f^(2^k) applied to the current value f,
+//   - l: the parameter (2^k)^-1 % R for computing the exponentiation as a
+//        permutation of bits (k-squaring, [1](Observation 1)),
+//   - mul: the slot holding m, or INV_SELF if m is the current value f
+//          (doubling f_(2u) = (f_u)^(2^u) * f_u),
+//   - save: the slot to store the new value f in for later use, or INV_NONE.
+// Slot 0 always holds the input a = f_1.
 //
-// Benchmarks on several platforms indicate that a good threshold
-// for switching from repeated squaring to k-squaring is k = 64.
-#define K_SQR_THR (64)
-
-// k-squaring is computed by a permutation of bits of the input polynomial,
-// as defined in [1](Observation 1). The required parameter for the permutation
-// is l = (2^k)^-1 % R.
-// Therefore, there are two sets of parameters for every exponentiation:
-//   - exp0_k and exp1_k
-//   - exp0_l and exp1_l
-
-// Exponentiation 0 computes f^2^2^(i-1) for 0 < i < MAX_I.
-// Exponentiation 1 computes f^2^((r-2) % 2^i) for 0 < i < MAX_I,
-// only when the i-th bit of (r-2) is 1. Therefore, the value 0 in
-// exp1_k[i] and exp1_l[i] means that exp1 is skipped in i-th iteration.
-
-// To quickly generate all the required parameters in Sage:
-//   r = DESIRED_R
-//   max_i = floor(log(r-2, 2)) + 1
-//   exp0_k = [2^i for i in range(max_i)]
-//   exp0_l = [inverse_mod((2^k) % r, r) for k in exp0_k]
-//   exp1_k = [(r-2)%(2^i) if ((r-2) & (1<<i)) else 0 for i in range(max_i)]
-//   exp1_l = [inverse_mod((2^k) % r, r) if k != 0 else 0 for k in exp1_k]
+// The exponentiations are computed either by repeated squaring of f, k times,
+// or by a single k-squaring of f. The method for a specific value of k
+// is chosen based on the performance of squaring and k-squaring of the
+// selected implementation (see gf2x_ctx.k_sqr_thr).
+
+#define INV_SELF (0xff)
+#define INV_NONE (0xff)
+
+struct inv_step {
+	unsigned short k;
+	unsigned short l;
+	unsigned char mul;
+	unsigned char save;
+};
 
 #if (LC_BIKE_LEVEL == 1)
 
-// MAX_I = floor(log(r-2)) + 1
-#define MAX_I (14)
-#define EXP0_K_VALS                                                            \
-	1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192
-#define EXP0_L_VALS                                                            \
-	6162, 3081, 3851, 5632, 22, 484, 119, 1838, 1742, 3106, 10650, 1608,   \
-		10157, 8816
-#define EXP1_K_VALS 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 33, 4129
-#define EXP1_L_VALS 0, 0, 0, 0, 0, 6162, 0, 0, 0, 0, 0, 0, 242, 5717
+// r - 2 = 12321:
+// 1 2 4 8 16 32 48 96 192 384 385 770 1540 3080 6160 12320 12321
+#define INV_SLOTS (2)
+#define INV_STEPS                                                              \
+	{ 1, 6162, INV_SELF, INV_NONE }, { 2, 3081, INV_SELF, INV_NONE },      \
+		{ 4, 3851, INV_SELF, INV_NONE }, { 8, 5632, INV_SELF, 1 },     \
+		{ 16, 22, INV_SELF, INV_NONE }, { 16, 22, 1, INV_NONE },       \
+		{ 48, 10648, INV_SELF, INV_NONE },                             \
+		{ 96, 8304, INV_SELF, INV_NONE },                              \
+		{ 192, 9231, INV_SELF, INV_NONE }, { 1, 6162, 0, INV_NONE },   \
+		{ 385, 11231, INV_SELF, INV_NONE },                            \
+		{ 770, 9456, INV_SELF, INV_NONE },                             \
+		{ 1540, 248, INV_SELF, INV_NONE },                             \
+		{ 3080, 12212, INV_SELF, INV_NONE },                           \
+		{ 6160, 12321, INV_SELF, INV_NONE }, { 1, 6162, 0, INV_NONE }
 
 #elif (LC_BIKE_LEVEL == 3)
 
-// MAX_I = floor(log(r-2)) + 1
-#define MAX_I (15)
-#define EXP0_K_VALS                                                            \
-	1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384
-#define EXP0_L_VALS                                                            \
-	12330, 6165, 7706, 3564, 2711, 1139, 15053, 1258, 4388, 20524, 9538,   \
-		6393, 10486, 1715, 6804
-#define EXP1_K_VALS 0, 0, 0, 0, 1, 0, 17, 0, 0, 0, 0, 0, 0, 81, 8273
-#define EXP1_L_VALS 0, 0, 0, 0, 12330, 0, 13685, 0, 0, 0, 0, 0, 0, 23678, 19056
+// r - 2 = 24657:
+// 1 2 4 8 16 32 48 96 192 384 385 770 1540 1541 3082 6164 12328 24656 24657
+#define INV_SLOTS (2)
+#define INV_STEPS                                                              \
+	{ 1, 12330, INV_SELF, INV_NONE }, { 2, 6165, INV_SELF, INV_NONE },     \
+		{ 4, 7706, INV_SELF, INV_NONE }, { 8, 3564, INV_SELF, 1 },     \
+		{ 16, 2711, INV_SELF, INV_NONE }, { 16, 2711, 1, INV_NONE },   \
+		{ 48, 5454, INV_SELF, INV_NONE },                              \
+		{ 96, 7362, INV_SELF, INV_NONE },                              \
+		{ 192, 23221, INV_SELF, INV_NONE }, { 1, 12330, 0, INV_NONE }, \
+		{ 385, 22903, INV_SELF, INV_NONE },                            \
+		{ 770, 1161, INV_SELF, INV_NONE }, { 1, 12330, 0, INV_NONE },  \
+		{ 1541, 20497, INV_SELF, INV_NONE },                           \
+		{ 3082, 11626, INV_SELF, INV_NONE },                           \
+		{ 6164, 7897, INV_SELF, INV_NONE },                            \
+		{ 12328, 24657, INV_SELF, INV_NONE },                          \
+		{ 1, 12330, 0, INV_NONE }
 
 #else
 
-// MAX_I = floor(log(r-2)) + 1
-#define MAX_I (16)
-#define EXP0_K_VALS                                                            \
-	1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,  \
-		32768
-#define EXP0_L_VALS                                                            \
-	20487, 30730, 28169, 9443, 13001, 12376, 8302, 6618, 38760, 21582,     \
-		1660, 10409, 14669, 30338, 17745, 7520
-#define EXP1_K_VALS 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 8203
-#define EXP1_L_VALS                                                            \
-	0, 20487, 0, 15365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6302, 0, 10058
+// r - 2 = 40971:
+// 1 2 3 5 10 20 40 80 160 320 640 1280 2560 5120 5121 10242 20484 40968 40971
+#define INV_SLOTS (3)
+#define INV_STEPS                                                              \
+	{ 1, 20487, INV_SELF, 1 }, { 1, 20487, 0, 2 },                         \
+		{ 2, 30730, 1, INV_NONE }, { 5, 34571, INV_SELF, INV_NONE },   \
+		{ 10, 12604, INV_SELF, INV_NONE },                             \
+		{ 20, 8495, INV_SELF, INV_NONE },                              \
+		{ 40, 11572, INV_SELF, INV_NONE },                             \
+		{ 80, 11420, INV_SELF, INV_NONE },                             \
+		{ 160, 40314, INV_SELF, INV_NONE },                            \
+		{ 320, 24551, INV_SELF, INV_NONE },                            \
+		{ 640, 38771, INV_SELF, INV_NONE },                            \
+		{ 1280, 13990, INV_SELF, INV_NONE },                           \
+		{ 2560, 33052, INV_SELF, INV_NONE },                           \
+		{ 1, 20487, 0, INV_NONE },                                     \
+		{ 5121, 6289, INV_SELF, INV_NONE },                            \
+		{ 10242, 12576, INV_SELF, INV_NONE },                          \
+		{ 20484, 40969, INV_SELF, INV_NONE },                          \
+		{ 3, 15365, 2, INV_NONE }
 
 #endif
 
@@ -138,22 +168,16 @@ static inline void repeated_squaring(pad_r_t *c, const pad_r_t *a,
 int gf2x_mod_inv(pad_r_t *c, const pad_r_t *a)
 {
 	/*
-	 * Note that exp0/1_k/l are predefined constants that depend
+	 * Note that the addition chain is a predefined constant that depends
 	 * only on the value of R. This value is public. Therefore,
 	 * branches in this function, which depends on R, are also
 	 * "public". Code that releases these branches
 	 * (taken/not-taken) does not leak secret information.
 	 */
 	LC_FIPS_RODATA_SECTION
-	static const unsigned short exp0_k[MAX_I] = { EXP0_K_VALS };
-	LC_FIPS_RODATA_SECTION
-	static const unsigned short exp0_l[MAX_I] = { EXP0_L_VALS };
-	LC_FIPS_RODATA_SECTION
-	static const unsigned short exp1_k[MAX_I] = { EXP1_K_VALS };
-	LC_FIPS_RODATA_SECTION
-	static const unsigned short exp1_l[MAX_I] = { EXP1_L_VALS };
+	static const struct inv_step steps[] = { INV_STEPS };
 	struct workspace {
-		pad_r_t f, g, t;
+		pad_r_t f, g, slot[INV_SLOTS];
 		dbl_pad_r_t sec_buf, tmp;
 		uint64_t secure_buffer[LC_SECURE_BUFFER_QWORDS];
 	};
@@ -176,45 +200,36 @@ int gf2x_mod_inv(pad_r_t *c, const pad_r_t *a)
 	BUILD_BUG_ON(LC_BIKE_R_BITS != 40973);
 #endif
 
-	// Steps 2 and 3 in [1](Algorithm 2)
+	// f = f_1 = a
 	ws->f.val = a->val;
-	ws->t.val = a->val;
+	ws->slot[0].val = a->val;
 
-	for (i = 1; i < MAX_I; i++) {
-		// Step 5 in [1](Algorithm 2), exponentiation 0: g = f^2^2^(i-1)
-		if (exp0_k[i - 1] <= K_SQR_THR) {
-			repeated_squaring(&ws->g, &ws->f, exp0_k[i - 1],
+	for (i = 0; i < ARRAY_SIZE(steps); i++) {
+		const struct inv_step *step = &steps[i];
+		const pad_r_t *m = (step->mul == INV_SELF) ? &ws->f :
+							      &ws->slot[step->mul];
+
+		// g = f^2^k
+		if (step->k <= ctx.k_sqr_thr) {
+			repeated_squaring(&ws->g, &ws->f, step->k,
 					  &ws->sec_buf, &ctx);
 		} else {
-			CKINT(ctx.k_sqr(&ws->g, &ws->f, exp0_l[i - 1]));
+			CKINT(ctx.k_sqr(&ws->g, &ws->f, step->l));
 		}
 
 		lc_memset_secure(ws->secure_buffer, 0,
 				 sizeof(ws->secure_buffer));
-		// Step 6, [1](Algorithm 2): f = f*g
-		gf2x_mod_mul_with_ctx(&ws->f, &ws->g, &ws->f, &ctx, &ws->tmp,
+		// f = g * m
+		gf2x_mod_mul_with_ctx(&ws->f, &ws->g, m, &ctx, &ws->tmp,
 				      ws->secure_buffer);
 
-		if (exp1_k[i] != 0) {
-			// Step 8, [1](Algorithm 2), exponentiation 1: g = f^2^((r-2) % 2^i)
-			if (exp1_k[i] <= K_SQR_THR) {
-				repeated_squaring(&ws->g, &ws->f, exp1_k[i],
-						  &ws->sec_buf, &ctx);
-			} else {
-				CKINT(ctx.k_sqr(&ws->g, &ws->f, exp1_l[i]));
-			}
-
-			lc_memset_secure(ws->secure_buffer, 0,
-					 sizeof(ws->secure_buffer));
-			// Step 9, [1](Algorithm 2): t = t*g;
-			gf2x_mod_mul_with_ctx(&ws->t, &ws->g, &ws->t, &ctx,
-					      &ws->tmp, ws->secure_buffer);
-		}
+		if (step->save != INV_NONE)
+			ws->slot[step->save].val = ws->f.val;
 	}
 
-	// Step 10, [1](Algorithm 2): c = t^2
-	gf2x_mod_sqr_in_place(&ws->t, &ws->sec_buf, &ctx);
-	c->val = ws->t.val;
+	// Step 10, [1](Algorithm 2): c = f^2 with f = a^(2^(r-2) - 1)
+	gf2x_mod_sqr_in_place(&ws->f, &ws->sec_buf, &ctx);
+	c->val = ws->f.val;
 
 out:
 	LC_RELEASE_MEM(ws);
@@ -49,23 +49,29 @@
 // Input argument l_param is defined as the value (2^-k) % r.
 int k_sqr_port(pad_r_t *c, const pad_r_t *a, const size_t l_param)
 {
-	size_t i, idx = 0;
+	size_t i, pos = 0;
 	memset(c->val.raw, 0, sizeof(c->val));
 
 	// Compute the result byte by byte
 	for (i = 0; i < LC_BIKE_R_BYTES; i++) {
 		size_t j;
 
-		for (j = 0; j < BITS_IN_BYTE; j++, idx++) {
-			// Bit of "c" at position idx is set to the value of
-			// the bit of "a" at position pi1(idx) = (l_param * idx) % R_BITS.
-			size_t pos = (l_param * idx) % LC_BIKE_R_BITS;
-
+		for (j = 0; j < BITS_IN_BYTE; j++) {
+			// Bit of "c" at position idx = i * 8 + j is set to the
+			// value of the bit of "a" at position
+			// pi1(idx) = (l_param * idx) % R_BITS.
 			size_t pos_byte = pos >> 3;
 			size_t pos_bit = pos & 7;
 			uint8_t bit = (a->val.raw[pos_byte] >> pos_bit) & 1;
 
 			c->val.raw[i] |= (bit << j);
+
+			// pi1(idx + 1) is obtained from pi1(idx) by adding l_param
+			// modulo R_BITS. The branch depends only on the public
+			// l_param.
+			pos += l_param;
+			if (pos >= LC_BIKE_R_BITS)
+				pos -= LC_BIKE_R_BITS;
 		}
 	}
 	c->val.raw[LC_BIKE_R_BYTES - 1] &= LC_BIKE_LAST_R_BYTE_MASK;
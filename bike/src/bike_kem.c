@@ -30,6 +30,7 @@
 #include "bike_decode.h"
 #include "bike_gf2x.h"
 #include "bike_internal.h"
+#include "bike_profile.h"
 #include "bike_sampling.h"
 #include "bike_utilities.h"
 
@@ -154,19 +155,24 @@ static inline void bike_encrypt(struct lc_bike_ct *ct, const pad_e_t *e,
 				pad_r_t *p_pk, dbl_pad_r_t *t,
 				uint64_t secure_buffer[LC_SECURE_BUFFER_QWORDS])
 {
+	uint64_t prof;
 	unsigned int i;
 
 	p_pk->val = *pk;
 
 	// Generate the ciphertext
 	// ct = pk * e1 + e0
+	prof = bike_profile_start();
 	gf2x_mod_mul(p_ct, &e->val[1], p_pk, t, secure_buffer);
 	gf2x_mod_add(p_ct, p_ct, &e->val[0]);
+	bike_profile_stop(BIKE_PROFILE_ENC_MUL, prof);
 
 	ct->c0 = p_ct->val;
 
 	// c1 = L(e0, e1)
+	prof = bike_profile_start();
 	function_l(&ct->c1, e);
+	bike_profile_stop(BIKE_PROFILE_ENC_HASH, prof);
 
 	// m xor L(e0, e1)
 	for (i = 0; i < sizeof(*m); i++)
@@ -231,6 +237,7 @@ LC_INTERFACE_FUNCTION(int, lc_bike_keypair, struct lc_bike_pk *pk,
 		// The randomness of the key generation
 		seeds_t seeds;
 	};
+	uint64_t prof;
 	int ret;
 	LC_DECLARE_MEM(ws, struct workspace, LC_BIKE_ALIGN_BYTES);
 
@@ -239,15 +246,22 @@ LC_INTERFACE_FUNCTION(int, lc_bike_keypair, struct lc_bike_pk *pk,
 	CKINT(lc_rng_generate(rng_ctx, NULL, 0, (uint8_t *)&ws->seeds.seed,
 			      sizeof(ws->seeds.seed)));
 
+	prof = bike_profile_start();
 	CKINT(generate_secret_key(&ws->h0, &ws->h1, sk->wlist[0].val,
 				  sk->wlist[1].val, &ws->seeds.seed[0]));
+	bike_profile_stop(BIKE_PROFILE_KEYGEN_SAMPLE, prof);
 
 	// Generate sigma
 	convert_seed_to_m_type(&sk->sigma, &ws->seeds.seed[1]);
 
 	// Calculate the public key
+	prof = bike_profile_start();
 	CKINT(gf2x_mod_inv(&ws->h0inv, &ws->h0));
+	bike_profile_stop(BIKE_PROFILE_KEYGEN_INV, prof);
+
+	prof = bike_profile_start();
 	gf2x_mod_mul(&ws->h, &ws->h1, &ws->h0inv, &ws->t, ws->secure_buffer);
+	bike_profile_stop(BIKE_PROFILE_KEYGEN_MUL, prof);
 
 	// Fill the secret key data structure with contents - cancel the padding
 	sk->bin[0] = ws->h0.val;
@@ -297,6 +311,7 @@ LC_INTERFACE_FUNCTION(int, lc_bike_enc_internal, struct lc_bike_ct *ct,
 		m_t m;
 		seeds_t seeds;
 	};
+	uint64_t prof;
 	int ret;
 	LC_DECLARE_MEM(ws, struct workspace, LC_BIKE_ALIGN_BYTES);
 
@@ -306,15 +321,19 @@ LC_INTERFACE_FUNCTION(int, lc_bike_enc_internal, struct lc_bike_ct *ct,
 			      sizeof(ws->seeds.seed)));
 
 	// e = H(m) = H(seed[0])
+	prof = bike_profile_start();
 	convert_seed_to_m_type(&ws->m, &ws->seeds.seed[0]);
 	CKINT(function_h(&ws->e, &ws->m, &pk->pk));
+	bike_profile_stop(BIKE_PROFILE_ENC_SAMPLE, prof);
 
 	// Calculate the ciphertext
 	bike_encrypt(ct, &ws->e, &pk->pk, &ws->m, &ws->p_ct, &ws->p_pk, &ws->t,
 		     ws->secure_buffer);
 
 	// Generate the shared secret
+	prof = bike_profile_start();
 	function_k(ss, &ws->m, ct);
+	bike_profile_stop(BIKE_PROFILE_ENC_HASH, prof);
 
 	//print("ss: ", (uint64_t *)l_ss.raw, SIZEOF_BITS(l_ss));
 
@@ -345,27 +364,30 @@ out:
 	return ret;
 }
 
-LC_INTERFACE_FUNCTION(int, lc_bike_dec, struct lc_bike_ss *ss,
-		      const struct lc_bike_ct *ct, const struct lc_bike_sk *sk)
+#if !(defined(LC_BIG_ENDIAN) || (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+struct bike_dec_ws {
+	struct bike_decode_ws decode;
+	pad_e_t e_tmp, e_prime;
+	m_t m_prime;
+	e_t e;
+};
+
+/*
+ * Decapsulate one ciphertext using a workspace whose key-dependent part was
+ * already set up with bike_decode_init.
+ */
+static int bike_dec_ws(struct lc_bike_ss *ss, const struct lc_bike_ct *ct,
+		       const struct lc_bike_sk *sk, struct bike_dec_ws *ws)
 {
-#if (defined(LC_BIG_ENDIAN) || (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
-	(void)ss;
-	(void)ct;
-	(void)sk;
-	return -EOPNOTSUPP;
-#else
-	struct workspace {
-		pad_e_t e_tmp, e_prime;
-		m_t m_prime;
-		e_t e;
-	};
+	uint64_t prof;
 	uint32_t mask;
 	unsigned int i;
 	int success_cond, ret;
-	LC_DECLARE_MEM(ws, struct workspace, LC_BIKE_ALIGN_BYTES);
 
 	// Decode
-	CKINT(bike_decode(&ws->e, ct, sk));
+	CKINT(bike_decode_ws(&ws->e, ct, sk, &ws->decode));
+
+	prof = bike_profile_start();
 
 	// Copy the error vector in the padded struct.
 	ws->e_prime.val[0].val = ws->e.val[0];
@@ -394,6 +416,67 @@ LC_INTERFACE_FUNCTION(int, lc_bike_dec, struct lc_bike_ss *ss,
 	// Generate the shared secret
 	function_k(ss, &ws->m_prime, ct);
 
+	bike_profile_stop(BIKE_PROFILE_DEC_FO, prof);
+
+out:
+	return ret;
+}
+#endif
+
+LC_INTERFACE_FUNCTION(int, lc_bike_dec, struct lc_bike_ss *ss,
+		      const struct lc_bike_ct *ct, const struct lc_bike_sk *sk)
+{
+#if (defined(LC_BIG_ENDIAN) || (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+	(void)ss;
+	(void)ct;
+	(void)sk;
+	return -EOPNOTSUPP;
+#else
+	int ret;
+	LC_DECLARE_MEM(ws, struct bike_dec_ws, LC_BIKE_ALIGN_BYTES);
+
+	bike_decode_init(&ws->decode, sk);
+	CKINT(bike_dec_ws(ss, ct, sk, ws));
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+#endif
+}
+
+LC_INTERFACE_FUNCTION(int, lc_bike_dec_batch, struct lc_bike_ss *const *ss,
+		      const struct lc_bike_ct *const *ct, unsigned int num,
+		      const struct lc_bike_sk *sk)
+{
+#if (defined(LC_BIG_ENDIAN) || (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+	(void)ss;
+	(void)ct;
+	(void)num;
+	(void)sk;
+	return -EOPNOTSUPP;
+#else
+	unsigned int i;
+	int ret = 0;
+	LC_DECLARE_MEM(ws, struct bike_dec_ws, LC_BIKE_ALIGN_BYTES);
+
+	if (!ss || !ct || !sk) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	/*
+	 * The key-dependent decoder state is set up once and the single
+	 * workspace is reused for all ciphertexts.
+	 */
+	bike_decode_init(&ws->decode, sk);
+	for (i = 0; i < num; i++) {
+		if (!ss[i] || !ct[i]) {
+			ret = -EINVAL;
+			goto out;
+		}
+		CKINT(bike_dec_ws(ss[i], ct[i], sk, ws));
+	}
+
 out:
 	LC_RELEASE_MEM(ws);
 	return ret;
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 - 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#include "bike_profile.h"
+
+#ifdef LC_BIKE_PROFILE
+
+static uint64_t bike_profile_cycles_ctr[BIKE_PROFILE_PHASES];
+static uint64_t bike_profile_calls_ctr[BIKE_PROFILE_PHASES];
+
+void bike_profile_add(enum bike_profile_phase phase, uint64_t start)
+{
+	uint64_t now = bike_profile_cycles();
+
+	if (phase >= BIKE_PROFILE_PHASES)
+		return;
+
+	bike_profile_cycles_ctr[phase] += now - start;
+	bike_profile_calls_ctr[phase]++;
+}
+
+void bike_profile_reset(void)
+{
+	memset(bike_profile_cycles_ctr, 0, sizeof(bike_profile_cycles_ctr));
+	memset(bike_profile_calls_ctr, 0, sizeof(bike_profile_calls_ctr));
+}
+
+void bike_profile_get(enum bike_profile_phase phase, uint64_t *cycles,
+		      uint64_t *calls)
+{
+	if (phase >= BIKE_PROFILE_PHASES) {
+		*cycles = 0;
+		*calls = 0;
+		return;
+	}
+
+	*cycles = bike_profile_cycles_ctr[phase];
+	*calls = bike_profile_calls_ctr[phase];
+}
+
+const char *bike_profile_name(enum bike_profile_phase phase)
+{
+	switch (phase) {
+	case BIKE_PROFILE_KEYGEN_SAMPLE:
+		return "keygen: sample secret key";
+	case BIKE_PROFILE_KEYGEN_INV:
+		return "keygen: inversion";
+	case BIKE_PROFILE_KEYGEN_MUL:
+		return "keygen: multiplication";
+	case BIKE_PROFILE_ENC_SAMPLE:
+		return "enc: sample error vector";
+	case BIKE_PROFILE_ENC_MUL:
+		return "enc: multiplication";
+	case BIKE_PROFILE_ENC_HASH:
+		return "enc: hashing (L, K)";
+	case BIKE_PROFILE_DEC_SETUP:
+		return "dec: decoder setup";
+	case BIKE_PROFILE_DEC_SYNDROME:
+		return "dec: syndrome computation";
+	case BIKE_PROFILE_DEC_UPC:
+		return "dec: UPC / bit flipping";
+	case BIKE_PROFILE_DEC_FO:
+		return "dec: re-encryption check";
+	case BIKE_PROFILE_PHASES:
+	default:
+		return "unknown";
+	}
+}
+
+#endif /* LC_BIKE_PROFILE */
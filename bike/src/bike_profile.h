@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2024 - 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef BIKE_PROFILE_H
+#define BIKE_PROFILE_H
+
+#include "bike_type.h"
+#include "ext_headers_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Per-phase cycle accounting of the BIKE operations. The instrumentation is
+ * only compiled when LC_BIKE_PROFILE is defined (meson option bike_profile).
+ * The counters are global and not protected against concurrent updates -
+ * this is a debugging aid to find out whether the inversion, the sampling or
+ * the decoder dominates on a given CPU and is not intended for production
+ * builds.
+ */
+enum bike_profile_phase {
+	/* Key generation */
+	BIKE_PROFILE_KEYGEN_SAMPLE,
+	BIKE_PROFILE_KEYGEN_INV,
+	BIKE_PROFILE_KEYGEN_MUL,
+
+	/* Encapsulation */
+	BIKE_PROFILE_ENC_SAMPLE,
+	BIKE_PROFILE_ENC_MUL,
+	BIKE_PROFILE_ENC_HASH,
+
+	/* Decapsulation */
+	BIKE_PROFILE_DEC_SETUP,
+	BIKE_PROFILE_DEC_SYNDROME,
+	BIKE_PROFILE_DEC_UPC,
+	BIKE_PROFILE_DEC_FO,
+
+	BIKE_PROFILE_PHASES
+};
+
+#ifdef LC_BIKE_PROFILE
+
+static inline uint64_t bike_profile_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	uint32_t lo, hi;
+
+	__asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+	return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+	uint64_t cnt;
+
+	__asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(cnt));
+	return cnt;
+#else
+	struct timespec tp = { 0 };
+
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return (uint64_t)tp.tv_sec * 1000000000UL + (uint64_t)tp.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Account the cycles since \p start to \p phase
+ */
+void bike_profile_add(enum bike_profile_phase phase, uint64_t start);
+
+/**
+ * @brief Clear all counters
+ */
+void bike_profile_reset(void);
+
+/**
+ * @brief Obtain the accumulated counters of one phase
+ *
+ * @param [in] phase phase to query
+ * @param [out] cycles accumulated cycles spent in the phase
+ * @param [out] calls number of times the phase was entered
+ */
+void bike_profile_get(enum bike_profile_phase phase, uint64_t *cycles,
+		      uint64_t *calls);
+
+/**
+ * @brief Return a human readable name of the phase
+ */
+const char *bike_profile_name(enum bike_profile_phase phase);
+
+static inline uint64_t bike_profile_start(void)
+{
+	return bike_profile_cycles();
+}
+
+static inline void bike_profile_stop(enum bike_profile_phase phase,
+				     uint64_t start)
+{
+	bike_profile_add(phase, start);
+}
+
+#else /* LC_BIKE_PROFILE */
+
+static inline uint64_t bike_profile_start(void)
+{
+	return 0;
+}
+
+static inline void bike_profile_stop(enum bike_profile_phase phase,
+				     uint64_t start)
+{
+	(void)phase;
+	(void)start;
+}
+
+#endif /* LC_BIKE_PROFILE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BIKE_PROFILE_H */
@@ -34,6 +34,8 @@ static int bike_official(enum lc_bike_type type)
 		struct lc_bike_ss ss, ss2;
 		uint8_t ss3[10], ss4[10];
 	};
+	struct lc_bike_ss *ss_p;
+	const struct lc_bike_ct *ct_p;
 	int ret;
 	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
 
@@ -81,6 +83,20 @@ static int bike_official(enum lc_bike_type type)
 		goto out;
 	}
 
+	/* positive operation */
+	ss_p = &ws->ss2;
+	ct_p = &ws->ct;
+	memset(&ws->ss2, 0, sizeof(ws->ss2));
+	CKINT_LOG(lc_bike_dec_batch(&ss_p, &ct_p, 1, &ws->sk),
+		  "Unexpected error dec batch\n");
+
+	unpoison(&ws->ss2, sizeof(ws->ss2));
+	if (memcmp(&ws->ss, &ws->ss2, sizeof(ws->ss))) {
+		printf("Shared secrets of batch decapsulation do not match\n");
+		ret = 1;
+		goto out;
+	}
+
 	/* positive operation */
 	ws->pk.bike_type = type;
 	CKINT_LOG(lc_bike_enc_kdf(&ws->ct, ws->ss3, sizeof(ws->ss3), &ws->pk),
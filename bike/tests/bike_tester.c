@@ -136,6 +136,51 @@ out:
 	return ret ? ret : rc;
 }
 
+#ifndef GENERATE_VECTORS
+#define BIKE_BATCH_NUM 3
+
+/*
+ * Batch decapsulation must deliver the same shared secrets as the individual
+ * decapsulation, including the implicit rejection of a modified cipher text.
+ */
+static int bike_tester_batch(struct workspace *ws)
+{
+	struct batch_ws {
+		struct lc_bike_ct ct[BIKE_BATCH_NUM];
+		struct lc_bike_ss ss[BIKE_BATCH_NUM], ss_batch[BIKE_BATCH_NUM];
+	};
+	struct lc_bike_ss *ss_p[BIKE_BATCH_NUM];
+	const struct lc_bike_ct *ct_p[BIKE_BATCH_NUM];
+	unsigned int i;
+	int ret, rc = 0;
+	LC_DECLARE_MEM(bws, struct batch_ws, LC_BIKE_ALIGN_BYTES);
+
+	for (i = 0; i < BIKE_BATCH_NUM; i++) {
+		CKINT(lc_bike_enc(&bws->ct[i], &bws->ss[i], &ws->pk));
+		ss_p[i] = &bws->ss_batch[i];
+		ct_p[i] = &bws->ct[i];
+	}
+
+	/* Force the implicit rejection for the last cipher text */
+	bws->ct[BIKE_BATCH_NUM - 1].c1.raw[0] ^= 1;
+	CKINT(lc_bike_dec(&bws->ss[BIKE_BATCH_NUM - 1],
+			  &bws->ct[BIKE_BATCH_NUM - 1], &ws->sk));
+
+	CKINT(lc_bike_dec_batch(ss_p, ct_p, BIKE_BATCH_NUM, &ws->sk));
+
+	for (i = 0; i < BIKE_BATCH_NUM; i++) {
+		rc += lc_compare(bws->ss_batch[i].ss, bws->ss[i].ss,
+				 sizeof(bws->ss[i].ss), "BIKE Batch Dec SS");
+	}
+
+out:
+	LC_RELEASE_MEM(bws);
+	if (ret == -EOPNOTSUPP)
+		ret = 77;
+	return ret ? ret : rc;
+}
+#endif
+
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	unsigned int i, count = ARRAY_SIZE(bike_test);
@@ -169,6 +214,11 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 			break;
 	}
 
+#ifndef GENERATE_VECTORS
+	if (!ret)
+		ret = bike_tester_batch(ws);
+#endif
+
 #ifdef GENERATE_VECTORS
 	printf("\n};\n");
 #endif
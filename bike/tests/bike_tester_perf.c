@@ -18,6 +18,7 @@
  */
 
 #include "bike_internal.h"
+#include "bike_profile.h"
 
 #include "compare.h"
 #include "cpufeatures.h"
@@ -51,6 +52,24 @@ out:
 	return ret;
 }
 
+#ifdef LC_BIKE_PROFILE
+static void bike_tester_perf_profile(unsigned int rounds)
+{
+	uint64_t cycles, calls;
+	unsigned int i;
+
+	printf("BIKE per-phase cycles (average per operation over %u rounds)\n",
+	       rounds);
+	for (i = 0; i < BIKE_PROFILE_PHASES; i++) {
+		bike_profile_get((enum bike_profile_phase)i, &cycles, &calls);
+		printf("%-24s %12llu cycles (%llu calls)\n",
+		       bike_profile_name((enum bike_profile_phase)i),
+		       (unsigned long long)(cycles / rounds),
+		       (unsigned long long)calls);
+	}
+}
+#endif
+
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	unsigned int i;
@@ -63,12 +82,21 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	if (argc > 1)
 		lc_cpu_feature_disable();
 
+#ifdef LC_BIKE_PROFILE
+	bike_profile_reset();
+#endif
+
 	for (i = 0; i < 200; i++) {
 		ret = bike_tester_perf_one(ws);
 		if (ret)
 			break;
 	}
 
+#ifdef LC_BIKE_PROFILE
+	if (!ret)
+		bike_tester_perf_profile(i);
+#endif
+
 	/* Enable any accelerations when there is one parameter */
 	if (argc > 1)
 		lc_cpu_feature_enable();
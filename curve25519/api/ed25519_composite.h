@@ -36,6 +36,12 @@ int lc_ed25519_verify_ctx(const struct lc_ed25519_sig *sig, const uint8_t *msg,
 			  size_t mlen, const struct lc_ed25519_pk *pk,
 			  struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx);
 
+int lc_ed25519_verify_batch_ctx(
+	int *res, const struct lc_ed25519_sig *const *sig,
+	const uint8_t *const *msg, const size_t *mlen, unsigned int num,
+	const struct lc_ed25519_pk *const *pk,
+	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx);
+
 #ifdef __cplusplus
 }
 #endif
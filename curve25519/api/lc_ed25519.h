@@ -49,6 +49,56 @@ int lc_ed25519_sign(struct lc_ed25519_sig *sig, const uint8_t *msg, size_t mlen,
 int lc_ed25519_verify(const struct lc_ed25519_sig *sig, const uint8_t *msg,
 		      size_t mlen, const struct lc_ed25519_pk *pk);
 
+/*
+ * Verify multiple signatures in one shot
+ *
+ * The verification equations of the signatures are combined with random
+ * 128 bit weights and checked with one multi-scalar multiplication. When the
+ * combined check fails, every signature is verified on its own to identify
+ * the failing ones. Each signature may be created with a different key,
+ * repeated keys are only processed once.
+ *
+ * res: array of num entries receiving the result of lc_ed25519_verify for
+ *	each signature; may be NULL
+ *
+ * Returns 0 if all signatures could be verified correctly and -EBADMSG when
+ * at least one signature cannot be verified, < 0 on other errors.
+ */
+int lc_ed25519_verify_batch(int *res, const struct lc_ed25519_sig *const *sig,
+			    const uint8_t *const *msg, const size_t *mlen,
+			    unsigned int num,
+			    const struct lc_ed25519_pk *const *pk);
+
+/*
+ * Ed25519 secret key prepared for signing
+ *
+ * az holds the clamped secret scalar followed by the prefix used for deriving
+ * the nonce, pk holds the encoded public key. Both are derived once from the
+ * secret key with lc_ed25519_sk_prepare so that lc_ed25519_sign_prepared does
+ * not need to expand the secret key with SHA-512 for every signature.
+ *
+ * The prepared key is as sensitive as the secret key and must be wiped with
+ * lc_memset_secure after use.
+ */
+struct lc_ed25519_sk_prepared {
+	uint8_t az[LC_ED25519_SECRETKEYBYTES];
+	uint8_t pk[LC_ED25519_PUBLICKEYBYTES];
+};
+
+int lc_ed25519_sk_prepare(struct lc_ed25519_sk_prepared *prep_sk,
+			  const struct lc_ed25519_sk *sk);
+
+/*
+ * Sign with a prepared secret key
+ *
+ * Without rng_ctx the signature is identical to the one created by
+ * lc_ed25519_sign with the secret key the prepared key was derived from.
+ */
+int lc_ed25519_sign_prepared(struct lc_ed25519_sig *sig, const uint8_t *msg,
+			     size_t mlen,
+			     const struct lc_ed25519_sk_prepared *prep_sk,
+			     struct lc_rng_ctx *rng_ctx);
+
 /* Receive a message pre-hashed with SHA-512 */
 int lc_ed25519ph_sign(struct lc_ed25519_sig *sig, const uint8_t *msg,
 		      size_t mlen, const struct lc_ed25519_sk *sk,
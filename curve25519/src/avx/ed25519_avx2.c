@@ -0,0 +1,549 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * Four-way parallel Ed25519 point arithmetic using AVX2.
+ *
+ * The four coordinates of a point are processed in the four 64 bit lanes of
+ * the AVX2 registers, i.e. one field multiplication instruction sequence
+ * computes four independent field multiplications. The point formulas are
+ * the parallel formulas of Hisil, Wong, Carter, Dawson ("Twisted Edwards
+ * Curves Revisited", section 4.2) as arranged by the AVX2 backend of
+ * curve25519-dalek: one point addition needs two parallel multiplications,
+ * one doubling needs one parallel squaring and one parallel multiplication.
+ *
+ * Field elements use ten limbs of alternating 26 and 25 bits. vpmuludq
+ * multiplies the low 32 bits of the lanes, all multiplication inputs
+ * therefore must have limbs below 2^28 so that the products with the
+ * factors 2 and 19 of the reduction stay within the 32 bit input.
+ */
+
+#include "ed25519_avx2.h"
+#include "ext_headers_x86.h"
+#include "small_stack_support.h"
+
+typedef __m256i fe4[10];
+
+#define ED25519_AVX2_MASK26 ((1ULL << 26) - 1)
+#define ED25519_AVX2_MASK25 ((1ULL << 25) - 1)
+
+/* Lane selection of the coordinates for _mm256_blend_epi32 */
+#define LANE_A 0x03
+#define LANE_B 0x0c
+#define LANE_C 0x30
+#define LANE_D 0xc0
+
+/* Lane permutation for _mm256_permute4x64_epi64 */
+#define SHUF(a, b, c, d) ((a) | ((b) << 2) | ((c) << 4) | ((d) << 6))
+
+/* 2 * p in the 26 / 25 bit radix */
+static const uint64_t ed25519_avx2_2p[10] = {
+	0x7ffffda, 0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe,
+	0x3fffffe, 0x7fffffe, 0x3fffffe, 0x7fffffe, 0x3fffffe
+};
+
+/* 2 * d in the 26 / 25 bit radix */
+static const uint64_t ed25519_avx2_d2[10] = {
+	45281625, 27714825, 36363642, 13898781, 229458,
+	15978800, 54557047, 27058993, 29715967, 9444199
+};
+
+static inline __m256i fe4_mul19(__m256i a)
+{
+	return _mm256_add_epi64(
+		_mm256_add_epi64(a, _mm256_slli_epi64(a, 1)),
+		_mm256_slli_epi64(a, 4));
+}
+
+/*
+ * Reduce all limbs to 26 or 25 bits plus a small carry. The carry chain is
+ * the one of the fe_25_5 multiplication: the two interleaved chains keep
+ * the dependency chain short and accept limbs up to 2^64.
+ */
+static inline void fe4_carry(fe4 h)
+{
+	const __m256i m26 = _mm256_set1_epi64x(ED25519_AVX2_MASK26);
+	const __m256i m25 = _mm256_set1_epi64x(ED25519_AVX2_MASK25);
+	__m256i c;
+
+#define CARRY26(i)                                                             \
+	c = _mm256_srli_epi64(h[i], 26);                                       \
+	h[i + 1] = _mm256_add_epi64(h[i + 1], c);                              \
+	h[i] = _mm256_and_si256(h[i], m26)
+#define CARRY25(i)                                                             \
+	c = _mm256_srli_epi64(h[i], 25);                                       \
+	h[i + 1] = _mm256_add_epi64(h[i + 1], c);                              \
+	h[i] = _mm256_and_si256(h[i], m25)
+
+	CARRY26(0);
+	CARRY26(4);
+	CARRY25(1);
+	CARRY25(5);
+	CARRY26(2);
+	CARRY26(6);
+	CARRY25(3);
+	CARRY25(7);
+	CARRY26(4);
+	CARRY26(8);
+
+	c = _mm256_srli_epi64(h[9], 25);
+	h[0] = _mm256_add_epi64(h[0], fe4_mul19(c));
+	h[9] = _mm256_and_si256(h[9], m25);
+
+	CARRY26(0);
+
+#undef CARRY26
+#undef CARRY25
+}
+
+/* h = f * g, the limbs of f and g must be below 2^28 */
+static inline void fe4_mul(fe4 h, const fe4 f, const fe4 g)
+{
+	__m256i f2[10], g19[10], t[10];
+	unsigned int i, j;
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++) {
+		f2[i] = (i & 1) ? _mm256_add_epi64(f[i], f[i]) : f[i];
+		g19[i] = fe4_mul19(g[i]);
+	}
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++) {
+		t[i] = _mm256_setzero_si256();
+#pragma GCC unroll 10
+		for (j = 0; j < 10; j++) {
+			/*
+			 * The product of two odd limbs has twice the weight
+			 * of the result limb, which is covered by f2.
+			 */
+			const __m256i fi = (j & 1) ? f2[j] : f[j];
+			const __m256i fo = ((i - j) & 1) ? fi : f[j];
+
+			if (j <= i) {
+				t[i] = _mm256_add_epi64(
+					t[i], _mm256_mul_epu32(fo, g[i - j]));
+			} else {
+				t[i] = _mm256_add_epi64(
+					t[i],
+					_mm256_mul_epu32(fo, g19[10 + i - j]));
+			}
+		}
+	}
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		h[i] = t[i];
+
+	fe4_carry(h);
+}
+
+/* h = f^2, the limbs of f must be below 2^28 */
+static inline void fe4_sq(fe4 h, const fe4 f)
+{
+	__m256i f2[10], f4[10], f19[10], t[10];
+	unsigned int i, j;
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++) {
+		f2[i] = _mm256_add_epi64(f[i], f[i]);
+		f4[i] = _mm256_add_epi64(f2[i], f2[i]);
+		f19[i] = fe4_mul19(f[i]);
+	}
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++) {
+		t[i] = _mm256_setzero_si256();
+
+#pragma GCC unroll 10
+		for (j = 0; j < 10; j++) {
+			/* partner limb k with j + k = i (mod 10), use j <= k */
+			const unsigned int k = (i >= j) ? i - j : i + 10 - j;
+			const unsigned int odd = (j & 1) & (k & 1);
+			__m256i l, r;
+
+			if (j > k)
+				continue;
+
+			if (j != k)
+				l = odd ? f4[j] : f2[j];
+			else
+				l = odd ? f2[j] : f[j];
+			r = (j + k >= 10) ? f19[k] : f[k];
+
+			t[i] = _mm256_add_epi64(t[i], _mm256_mul_epu32(l, r));
+		}
+	}
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		h[i] = t[i];
+
+	fe4_carry(h);
+}
+
+/* h = f - g + 2^n * p, the limbs of g must be below those of 2^n * p */
+static inline void fe4_sub_np(fe4 h, const fe4 f, const fe4 g,
+			      const unsigned int n)
+{
+	unsigned int i;
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++) {
+		h[i] = _mm256_sub_epi64(
+			_mm256_add_epi64(f[i],
+					 _mm256_set1_epi64x((long long)(
+						 ed25519_avx2_2p[i] << (n - 1)))),
+			g[i]);
+	}
+}
+
+/* h = f - g, g must be reduced */
+static inline void fe4_sub(fe4 h, const fe4 f, const fe4 g)
+{
+	fe4_sub_np(h, f, g, 1);
+}
+
+/*
+ * Lane permutation and lane blending of all limbs, macros as the selectors
+ * must be immediates.
+ */
+#define fe4_shuffle(h, f, imm)                                                 \
+	do {                                                                   \
+		unsigned int __i;                                              \
+		for (__i = 0; __i < 10; __i++)                                 \
+			(h)[__i] = _mm256_permute4x64_epi64((f)[__i], imm);    \
+	} while (0)
+
+#define fe4_blend(h, f, g, mask)                                               \
+	do {                                                                   \
+		unsigned int __i;                                              \
+		for (__i = 0; __i < 10; __i++)                                 \
+			(h)[__i] = _mm256_blend_epi32((f)[__i], (g)[__i],      \
+						      mask);                   \
+	} while (0)
+
+/* (A, B, C, D) -> (B - A, B + A, D - C, D + C), f must be reduced */
+static inline void fe4_diff_sum(fe4 h, const fe4 f)
+{
+	fe4 t, sum, diff;
+	unsigned int i;
+
+	fe4_shuffle(t, f, SHUF(1, 0, 3, 2));
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		sum[i] = _mm256_add_epi64(f[i], t[i]);
+	fe4_sub(diff, t, f);
+
+	fe4_blend(h, diff, sum, LANE_B | LANE_D);
+}
+
+static inline void fe4_load(fe4 h, const ge25519_avx2 *p)
+{
+	unsigned int i;
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		h[i] = _mm256_load_si256((const __m256i *)p->v[i]);
+}
+
+static inline void fe4_store(ge25519_avx2 *p, const fe4 h)
+{
+	unsigned int i;
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		_mm256_store_si256((__m256i *)p->v[i], h[i]);
+}
+
+/* Combine four fe_51 field elements into the lanes of h */
+static inline void fe4_from_fe51(fe4 h, const fe25519 a, const fe25519 b,
+				 const fe25519 c, const fe25519 d)
+{
+	const __m256i m26 = _mm256_set1_epi64x(ED25519_AVX2_MASK26);
+	unsigned int i;
+
+#pragma GCC unroll 5
+	for (i = 0; i < 5; i++) {
+		__m256i x = _mm256_set_epi64x((long long)d[i], (long long)c[i],
+					      (long long)b[i], (long long)a[i]);
+
+		h[2 * i] = _mm256_and_si256(x, m26);
+		h[2 * i + 1] = _mm256_srli_epi64(x, 26);
+	}
+
+	fe4_carry(h);
+}
+
+/* Split the lanes of the reduced h into four fe_51 field elements */
+static inline void fe4_to_fe51(fe25519 a, fe25519 b, fe25519 c, fe25519 d,
+			       const fe4 h)
+{
+	uint64_t x[4] __attribute__((aligned(32)));
+	unsigned int i;
+
+#pragma GCC unroll 5
+	for (i = 0; i < 5; i++) {
+		_mm256_store_si256(
+			(__m256i *)x,
+			_mm256_add_epi64(h[2 * i],
+					 _mm256_slli_epi64(h[2 * i + 1], 26)));
+		a[i] = x[0];
+		b[i] = x[1];
+		c[i] = x[2];
+		d[i] = x[3];
+	}
+}
+
+/*
+ * Cached form of a point: (Y - X, Y + X, 2 * Z, 2 * d * T)
+ */
+static void fe4_to_cached(fe4 q, const fe4 p)
+{
+	fe4 k;
+	unsigned int i;
+
+	fe4_diff_sum(q, p);
+	fe4_blend(q, q, p, LANE_C | LANE_D);
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++) {
+		k[i] = _mm256_set_epi64x((long long)ed25519_avx2_d2[i],
+					 i ? 0 : 2, i ? 0 : 1, i ? 0 : 1);
+	}
+	fe4_mul(q, q, k);
+}
+
+/* Cached form of a precomputed point with Z = 1 */
+static void fe4_precomp_to_cached(fe4 q, const ge25519_precomp *p)
+{
+	static const fe25519 two = { 2 };
+
+	fe4_from_fe51(q, p->yminusx, p->yplusx, two, p->xy2d);
+}
+
+/* Cached form of -Q from the cached form of Q */
+static void fe4_cached_neg(fe4 n, const fe4 q)
+{
+	fe4 t, z;
+	unsigned int i;
+
+	fe4_shuffle(n, q, SHUF(1, 0, 2, 3));
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		z[i] = _mm256_setzero_si256();
+	fe4_sub(t, z, n);
+	fe4_carry(t);
+
+	fe4_blend(n, n, t, LANE_D);
+}
+
+/* p = (0, 1, 1, 0) */
+static void fe4_0(fe4 p)
+{
+	unsigned int i;
+
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		p[i] = _mm256_setzero_si256();
+	p[0] = _mm256_set_epi64x(0, 1, 1, 0);
+}
+
+/*
+ * p = 2 * p
+ *
+ * With (S0, S1, S2, S3) = (X^2, Y^2, Z^2, (X + Y)^2) the doubling is
+ * X3 = E * F, Y3 = G * H, Z3 = F * G, T3 = E * H with E = S3 - S0 - S1,
+ * G = S1 - S0, F = G - 2 * S2 and H = -(S0 + S1). The result is computed as
+ * (-X3, -Y3, -Z3, -T3) which avoids negating H.
+ */
+static void fe4_dbl(fe4 p)
+{
+	fe4 s, s0, s1, s5, g, e, f, t0, t1;
+	unsigned int i;
+
+	/* (X, Y, Z, X + Y) */
+	fe4_shuffle(t0, p, SHUF(0, 1, 2, 0));
+	fe4_shuffle(t1, p, SHUF(1, 1, 1, 1));
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		t1[i] = _mm256_add_epi64(t0[i], t1[i]);
+	fe4_blend(t0, t0, t1, LANE_D);
+
+	fe4_sq(s, t0);
+
+	fe4_shuffle(s0, s, SHUF(0, 0, 0, 0));
+	fe4_shuffle(s1, s, SHUF(1, 1, 1, 1));
+
+	/* S5 = S0 + S1 = -H */
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		s5[i] = _mm256_add_epi64(s0[i], s1[i]);
+
+	/* G = S1 - S0 */
+	fe4_sub(g, s1, s0);
+
+	/* E = S3 - S5 */
+	fe4_shuffle(t0, s, SHUF(3, 3, 3, 3));
+	fe4_sub_np(e, t0, s5, 2);
+
+	/* -F = 2 * S2 - G */
+	fe4_shuffle(t0, s, SHUF(2, 2, 2, 2));
+#pragma GCC unroll 10
+	for (i = 0; i < 10; i++)
+		t0[i] = _mm256_add_epi64(t0[i], t0[i]);
+	fe4_sub_np(f, t0, g, 2);
+
+	/* E and -F are in the same lanes which are carried at once */
+	fe4_blend(e, e, f, LANE_B);
+	fe4_carry(e);
+	fe4_shuffle(f, e, SHUF(1, 1, 1, 1));
+
+	/* (E, G, -F, E) * (-F, S5, G, S5) */
+	fe4_blend(t0, e, g, LANE_B);
+	fe4_blend(t0, t0, f, LANE_C);
+	fe4_blend(t1, s5, f, LANE_A);
+	fe4_blend(t1, t1, g, LANE_C);
+	fe4_mul(p, t0, t1);
+}
+
+/* p = p + q with q in cached form */
+static void fe4_add_cached(fe4 p, const fe4 q)
+{
+	fe4 t0, t1;
+
+	/* (Y - X, Y + X, Z, T) */
+	fe4_diff_sum(t0, p);
+	fe4_blend(t0, t0, p, LANE_C | LANE_D);
+
+	/* (A, B, D, C) */
+	fe4_mul(t0, t0, q);
+
+	/* (A, B, C, D) -> (E, H, F, G) = (B - A, B + A, D - C, D + C) */
+	fe4_shuffle(t0, t0, SHUF(0, 1, 3, 2));
+	fe4_diff_sum(t0, t0);
+
+	/* (E, G, G, E) * (F, H, F, H) = (X3, Y3, Z3, T3) */
+	fe4_shuffle(t1, t0, SHUF(2, 1, 2, 1));
+	fe4_shuffle(t0, t0, SHUF(0, 3, 3, 0));
+	fe4_mul(p, t0, t1);
+}
+
+/* p = p - q with q in cached form */
+static void fe4_sub_cached(fe4 p, const fe4 q)
+{
+	fe4 n;
+
+	fe4_cached_neg(n, q);
+	fe4_add_cached(p, n);
+}
+
+void ge25519_avx2_0(ge25519_avx2 *r)
+{
+	fe4 p;
+
+	fe4_0(p);
+	fe4_store(r, p);
+}
+
+void ge25519_avx2_dbl(ge25519_avx2 *r, unsigned int n)
+{
+	fe4 p;
+
+	fe4_load(p, r);
+	while (n--)
+		fe4_dbl(p);
+	fe4_store(r, p);
+}
+
+void ge25519_avx2_add_precomp(ge25519_avx2 *r, const ge25519_precomp *q)
+{
+	fe4 p, c;
+
+	fe4_load(p, r);
+	fe4_precomp_to_cached(c, q);
+	fe4_add_cached(p, c);
+	fe4_store(r, p);
+}
+
+void ge25519_avx2_to_p3(ge25519_p3 *r, const ge25519_avx2 *p)
+{
+	fe4 h;
+
+	fe4_load(h, p);
+	fe4_to_fe51(r->X, r->Y, r->Z, r->T, h);
+}
+
+int ge25519_double_scalarmult_vartime_avx2(ge25519_p2 *r,
+					   const signed char aslide[256],
+					   const ge25519_p3 *A,
+					   const signed char bslide[256],
+					   const ge25519_precomp Bi[8])
+{
+	struct workspace {
+		fe4 Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+		fe4 Bc[8];
+		fe4 A2;
+		fe4 u;
+		fe25519 T;
+	};
+	int i;
+	LC_DECLARE_MEM(ws, struct workspace, 32);
+
+	fe4_from_fe51(ws->u, A->X, A->Y, A->Z, A->T);
+	fe4_to_cached(ws->Ai[0], ws->u);
+
+	fe4_dbl(ws->u);
+	memcpy(ws->A2, ws->u, sizeof(ws->A2));
+	for (i = 1; i < 8; i++) {
+		fe4_add_cached(ws->u, ws->Ai[i - 1]);
+		fe4_to_cached(ws->Ai[i], ws->u);
+		memcpy(ws->u, ws->A2, sizeof(ws->u));
+	}
+
+	for (i = 0; i < 8; i++)
+		fe4_precomp_to_cached(ws->Bc[i], &Bi[i]);
+
+	for (i = 255; i >= 0; --i) {
+		if (aslide[i] || bslide[i])
+			break;
+	}
+
+	fe4_0(ws->u);
+
+	for (; i >= 0; --i) {
+		fe4_dbl(ws->u);
+
+		if (aslide[i] > 0)
+			fe4_add_cached(ws->u, ws->Ai[aslide[i] / 2]);
+		else if (aslide[i] < 0)
+			fe4_sub_cached(ws->u, ws->Ai[(-aslide[i]) / 2]);
+
+		if (bslide[i] > 0)
+			fe4_add_cached(ws->u, ws->Bc[bslide[i] / 2]);
+		else if (bslide[i] < 0)
+			fe4_sub_cached(ws->u, ws->Bc[(-bslide[i]) / 2]);
+	}
+
+	fe4_to_fe51(r->X, r->Y, r->Z, ws->T, ws->u);
+
+	LC_RELEASE_MEM(ws);
+	return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef ED25519_AVX2_H
+#define ED25519_AVX2_H
+
+#include "../ed25519_ref10.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Extended point (X:Y:Z:T) with the four coordinates held in the four 64 bit
+ * lanes of AVX2 registers: v[i][j] is limb i of coordinate j, the limbs use
+ * the alternating 26 / 25 bit radix of the fe_25_5 code.
+ */
+typedef struct {
+	uint64_t v[10][4] __attribute__((aligned(32)));
+} ge25519_avx2;
+
+/* r = neutral element */
+void ge25519_avx2_0(ge25519_avx2 *r);
+
+/* r = 2^n * r */
+void ge25519_avx2_dbl(ge25519_avx2 *r, unsigned int n);
+
+/* r = r + q */
+void ge25519_avx2_add_precomp(ge25519_avx2 *r, const ge25519_precomp *q);
+
+void ge25519_avx2_to_p3(ge25519_p3 *r, const ge25519_avx2 *p);
+
+/*
+ * r = a * A + b * B with the signed sliding window digits aslide and bslide
+ * of a and b and the odd multiples Bi of the base point B.
+ */
+int ge25519_double_scalarmult_vartime_avx2(ge25519_p2 *r,
+					   const signed char aslide[256],
+					   const ge25519_p3 *A,
+					   const signed char bslide[256],
+					   const ge25519_precomp Bi[8]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ED25519_AVX2_H */
@@ -0,0 +1,412 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+/*
+ * Eight-way X25519 Montgomery ladder using AVX-512 IFMA.
+ *
+ * Each 64 bit lane of a ZMM register holds one limb of a field element of
+ * an independent scalar multiplication. Field elements use 5 limbs of radix
+ * 2^51 like the fe51 code. The 52 bit multiply-add instructions only consume
+ * the low 52 bits of their inputs, thus all multiplication inputs are kept
+ * below 2^52 by a carry step after every operation. The high half of a
+ * 52x52 bit product is aligned at 2^52 which is twice the next limb weight,
+ * hence it is accumulated separately and doubled before the reduction.
+ */
+
+#include "ext_headers_x86.h"
+#include "fe51.h"
+#include "lc_memset_secure.h"
+#include "x25519_scalarmult.h"
+
+typedef __m512i fe_ifma[5];
+
+#define X25519_IFMA_MASK51 ((1ULL << 51) - 1)
+
+/* r = 19 * a */
+static inline __m512i fe_ifma_mul19(__m512i a)
+{
+	return _mm512_add_epi64(
+		_mm512_add_epi64(a, _mm512_slli_epi64(a, 1)),
+		_mm512_slli_epi64(a, 4));
+}
+
+/*
+ * One parallel carry round: all limbs are reduced to 51 bits plus the carry
+ * of the preceding limb. For inputs below 2^62 the result is below 2^52.
+ */
+static inline void fe_ifma_carry(fe_ifma r, const __m512i t0, const __m512i t1,
+				 const __m512i t2, const __m512i t3,
+				 const __m512i t4)
+{
+	const __m512i mask = _mm512_set1_epi64(X25519_IFMA_MASK51);
+	__m512i c0 = _mm512_srli_epi64(t0, 51);
+	__m512i c1 = _mm512_srli_epi64(t1, 51);
+	__m512i c2 = _mm512_srli_epi64(t2, 51);
+	__m512i c3 = _mm512_srli_epi64(t3, 51);
+	__m512i c4 = _mm512_srli_epi64(t4, 51);
+
+	r[0] = _mm512_add_epi64(_mm512_and_si512(t0, mask), fe_ifma_mul19(c4));
+	r[1] = _mm512_add_epi64(_mm512_and_si512(t1, mask), c0);
+	r[2] = _mm512_add_epi64(_mm512_and_si512(t2, mask), c1);
+	r[3] = _mm512_add_epi64(_mm512_and_si512(t3, mask), c2);
+	r[4] = _mm512_add_epi64(_mm512_and_si512(t4, mask), c3);
+}
+
+static inline void fe_ifma_add(fe_ifma r, const fe_ifma a, const fe_ifma b)
+{
+	fe_ifma_carry(r, _mm512_add_epi64(a[0], b[0]),
+		      _mm512_add_epi64(a[1], b[1]),
+		      _mm512_add_epi64(a[2], b[2]),
+		      _mm512_add_epi64(a[3], b[3]),
+		      _mm512_add_epi64(a[4], b[4]));
+}
+
+/* r = a + 2p - b */
+static inline void fe_ifma_sub(fe_ifma r, const fe_ifma a, const fe_ifma b)
+{
+	const __m512i p0 = _mm512_set1_epi64((1LL << 52) - 38);
+	const __m512i p1 = _mm512_set1_epi64((1LL << 52) - 2);
+
+	fe_ifma_carry(r,
+		      _mm512_sub_epi64(_mm512_add_epi64(a[0], p0), b[0]),
+		      _mm512_sub_epi64(_mm512_add_epi64(a[1], p1), b[1]),
+		      _mm512_sub_epi64(_mm512_add_epi64(a[2], p1), b[2]),
+		      _mm512_sub_epi64(_mm512_add_epi64(a[3], p1), b[3]),
+		      _mm512_sub_epi64(_mm512_add_epi64(a[4], p1), b[4]));
+}
+
+/*
+ * Reduce the product given as low halves lo[0..8] at limb position k and
+ * high halves hi[1..9] at twice the weight of limb position k.
+ */
+static inline void fe_ifma_reduce(fe_ifma r, __m512i lo[10], __m512i hi[10])
+{
+	__m512i t[10];
+	unsigned int k;
+
+	for (k = 0; k < 10; k++)
+		t[k] = _mm512_add_epi64(lo[k], _mm512_slli_epi64(hi[k], 1));
+
+	/* 2^255 = 19 mod p */
+	fe_ifma_carry(r, _mm512_add_epi64(t[0], fe_ifma_mul19(t[5])),
+		      _mm512_add_epi64(t[1], fe_ifma_mul19(t[6])),
+		      _mm512_add_epi64(t[2], fe_ifma_mul19(t[7])),
+		      _mm512_add_epi64(t[3], fe_ifma_mul19(t[8])),
+		      _mm512_add_epi64(t[4], fe_ifma_mul19(t[9])));
+}
+
+#define FE_IFMA_MADD(i, j)                                                     \
+	lo[i + j] = _mm512_madd52lo_epu64(lo[i + j], a[i], b[j]);              \
+	hi[i + j + 1] = _mm512_madd52hi_epu64(hi[i + j + 1], a[i], b[j])
+
+static inline void fe_ifma_mul(fe_ifma r, const fe_ifma a, const fe_ifma b)
+{
+	__m512i lo[10], hi[10];
+	unsigned int k;
+
+	for (k = 0; k < 10; k++) {
+		lo[k] = _mm512_setzero_si512();
+		hi[k] = _mm512_setzero_si512();
+	}
+
+	FE_IFMA_MADD(0, 0);
+	FE_IFMA_MADD(0, 1);
+	FE_IFMA_MADD(0, 2);
+	FE_IFMA_MADD(0, 3);
+	FE_IFMA_MADD(0, 4);
+	FE_IFMA_MADD(1, 0);
+	FE_IFMA_MADD(1, 1);
+	FE_IFMA_MADD(1, 2);
+	FE_IFMA_MADD(1, 3);
+	FE_IFMA_MADD(1, 4);
+	FE_IFMA_MADD(2, 0);
+	FE_IFMA_MADD(2, 1);
+	FE_IFMA_MADD(2, 2);
+	FE_IFMA_MADD(2, 3);
+	FE_IFMA_MADD(2, 4);
+	FE_IFMA_MADD(3, 0);
+	FE_IFMA_MADD(3, 1);
+	FE_IFMA_MADD(3, 2);
+	FE_IFMA_MADD(3, 3);
+	FE_IFMA_MADD(3, 4);
+	FE_IFMA_MADD(4, 0);
+	FE_IFMA_MADD(4, 1);
+	FE_IFMA_MADD(4, 2);
+	FE_IFMA_MADD(4, 3);
+	FE_IFMA_MADD(4, 4);
+
+	fe_ifma_reduce(r, lo, hi);
+}
+
+static inline void fe_ifma_sq(fe_ifma r, const fe_ifma a)
+{
+	const __m512i *b = a;
+	__m512i lo[10], hi[10];
+	unsigned int k;
+
+	for (k = 0; k < 10; k++) {
+		lo[k] = _mm512_setzero_si512();
+		hi[k] = _mm512_setzero_si512();
+	}
+
+	/* Cross products are computed once and doubled */
+	FE_IFMA_MADD(0, 1);
+	FE_IFMA_MADD(0, 2);
+	FE_IFMA_MADD(0, 3);
+	FE_IFMA_MADD(0, 4);
+	FE_IFMA_MADD(1, 2);
+	FE_IFMA_MADD(1, 3);
+	FE_IFMA_MADD(1, 4);
+	FE_IFMA_MADD(2, 3);
+	FE_IFMA_MADD(2, 4);
+	FE_IFMA_MADD(3, 4);
+
+	for (k = 0; k < 10; k++) {
+		lo[k] = _mm512_slli_epi64(lo[k], 1);
+		hi[k] = _mm512_slli_epi64(hi[k], 1);
+	}
+
+	FE_IFMA_MADD(0, 0);
+	FE_IFMA_MADD(1, 1);
+	FE_IFMA_MADD(2, 2);
+	FE_IFMA_MADD(3, 3);
+	FE_IFMA_MADD(4, 4);
+
+	fe_ifma_reduce(r, lo, hi);
+}
+
+#undef FE_IFMA_MADD
+
+static inline void fe_ifma_nsq(fe_ifma r, const fe_ifma a, unsigned int n)
+{
+	fe_ifma_sq(r, a);
+	while (--n)
+		fe_ifma_sq(r, r);
+}
+
+/* r = bb + 121666 * e */
+static inline void fe_ifma_mul121666_add(fe_ifma r, const fe_ifma e,
+					 const fe_ifma bb)
+{
+	const __m512i c = _mm512_set1_epi64(121666);
+	const __m512i zero = _mm512_setzero_si512();
+	__m512i lo[5], hi[5];
+	unsigned int k;
+
+	for (k = 0; k < 5; k++) {
+		lo[k] = _mm512_madd52lo_epu64(bb[k], e[k], c);
+		hi[k] = _mm512_slli_epi64(_mm512_madd52hi_epu64(zero, e[k], c),
+					  1);
+	}
+
+	/* hi[k] belongs to limb k + 1, hi[4] is folded into limb 0 */
+	fe_ifma_carry(r, _mm512_add_epi64(lo[0], fe_ifma_mul19(hi[4])),
+		      _mm512_add_epi64(lo[1], hi[0]),
+		      _mm512_add_epi64(lo[2], hi[1]),
+		      _mm512_add_epi64(lo[3], hi[2]),
+		      _mm512_add_epi64(lo[4], hi[3]));
+}
+
+static inline void fe_ifma_cswap(fe_ifma a, fe_ifma b, __mmask8 swap)
+{
+	unsigned int k;
+
+	for (k = 0; k < 5; k++) {
+		__m512i t = _mm512_mask_blend_epi64(swap, a[k], b[k]);
+
+		b[k] = _mm512_mask_blend_epi64(swap, b[k], a[k]);
+		a[k] = t;
+	}
+}
+
+/* r = z^(p - 2) */
+static void fe_ifma_invert(fe_ifma r, const fe_ifma z)
+{
+	fe_ifma t0, t1, t2, t3;
+
+	fe_ifma_sq(t0, z);
+	fe_ifma_nsq(t1, t0, 2);
+	fe_ifma_mul(t1, z, t1);
+	fe_ifma_mul(t0, t0, t1);
+	fe_ifma_sq(t2, t0);
+	fe_ifma_mul(t1, t1, t2);
+	fe_ifma_nsq(t2, t1, 5);
+	fe_ifma_mul(t1, t2, t1);
+	fe_ifma_nsq(t2, t1, 10);
+	fe_ifma_mul(t2, t2, t1);
+	fe_ifma_nsq(t3, t2, 20);
+	fe_ifma_mul(t2, t3, t2);
+	fe_ifma_nsq(t2, t2, 10);
+	fe_ifma_mul(t1, t2, t1);
+	fe_ifma_nsq(t2, t1, 50);
+	fe_ifma_mul(t2, t2, t1);
+	fe_ifma_nsq(t3, t2, 100);
+	fe_ifma_mul(t2, t3, t2);
+	fe_ifma_nsq(t2, t2, 50);
+	fe_ifma_mul(t1, t2, t1);
+	fe_ifma_nsq(t1, t1, 5);
+	fe_ifma_mul(r, t1, t0);
+}
+
+static inline uint64_t x25519_ifma_load64(const uint8_t *in)
+{
+	uint64_t r = 0;
+	unsigned int i;
+
+	for (i = 0; i < 8; i++)
+		r |= (uint64_t)in[i] << (8 * i);
+
+	return r;
+}
+
+struct x25519_ifma_ws {
+	uint64_t limbs[5][LC_X25519_IFMA_LANES];
+	uint8_t t[LC_X25519_IFMA_LANES][32];
+	__mmask8 swap[255];
+	fe51 out;
+};
+
+static void x25519_ifma_ladder(fe_ifma x2, fe_ifma z2, const fe_ifma x1,
+			       const __mmask8 *bits)
+{
+	fe_ifma x3, z3, a, b, aa, bb, e, c, d, da, cb;
+	__mmask8 swap = 0;
+	unsigned int k;
+	int pos;
+
+	for (k = 0; k < 5; k++) {
+		x2[k] = _mm512_setzero_si512();
+		z2[k] = _mm512_setzero_si512();
+		x3[k] = x1[k];
+		z3[k] = _mm512_setzero_si512();
+	}
+	x2[0] = _mm512_set1_epi64(1);
+	z3[0] = _mm512_set1_epi64(1);
+
+	for (pos = 254; pos >= 0; --pos) {
+		swap ^= bits[pos];
+		fe_ifma_cswap(x2, x3, swap);
+		fe_ifma_cswap(z2, z3, swap);
+		swap = bits[pos];
+
+		fe_ifma_add(a, x2, z2);
+		fe_ifma_sub(b, x2, z2);
+		fe_ifma_add(c, x3, z3);
+		fe_ifma_sub(d, x3, z3);
+		fe_ifma_sq(aa, a);
+		fe_ifma_sq(bb, b);
+		fe_ifma_mul(da, d, a);
+		fe_ifma_mul(cb, c, b);
+		fe_ifma_mul(x2, aa, bb);
+		fe_ifma_sub(e, aa, bb);
+		fe_ifma_add(x3, da, cb);
+		fe_ifma_sq(x3, x3);
+		fe_ifma_sub(z3, da, cb);
+		fe_ifma_sq(z3, z3);
+		fe_ifma_mul(z3, z3, x1);
+		fe_ifma_mul121666_add(z2, e, bb);
+		fe_ifma_mul(z2, z2, e);
+	}
+	fe_ifma_cswap(x2, x3, swap);
+	fe_ifma_cswap(z2, z3, swap);
+
+	lc_memset_secure(x3, 0, sizeof(x3));
+	lc_memset_secure(z3, 0, sizeof(z3));
+	lc_memset_secure(a, 0, sizeof(a));
+	lc_memset_secure(b, 0, sizeof(b));
+	lc_memset_secure(aa, 0, sizeof(aa));
+	lc_memset_secure(bb, 0, sizeof(bb));
+	lc_memset_secure(e, 0, sizeof(e));
+	lc_memset_secure(c, 0, sizeof(c));
+	lc_memset_secure(d, 0, sizeof(d));
+	lc_memset_secure(da, 0, sizeof(da));
+	lc_memset_secure(cb, 0, sizeof(cb));
+}
+
+void crypto_scalarmult_curve25519_ifma(uint8_t *const *q,
+				       const uint8_t *const *n,
+				       const uint8_t *const *p,
+				       unsigned int num)
+{
+	struct x25519_ifma_ws ws;
+	fe_ifma x1, x2, z2;
+	unsigned int i, k;
+	int pos;
+
+	memset(&ws, 0, sizeof(ws));
+
+	/*
+	 * Unused lanes operate on the zero scalar and point, their result is
+	 * discarded.
+	 */
+	for (i = 0; i < num; i++) {
+		uint64_t w0 = x25519_ifma_load64(p[i]);
+		uint64_t w1 = x25519_ifma_load64(p[i] + 8);
+		uint64_t w2 = x25519_ifma_load64(p[i] + 16);
+		uint64_t w3 = x25519_ifma_load64(p[i] + 24);
+
+		ws.limbs[0][i] = w0 & X25519_IFMA_MASK51;
+		ws.limbs[1][i] = ((w0 >> 51) | (w1 << 13)) & X25519_IFMA_MASK51;
+		ws.limbs[2][i] = ((w1 >> 38) | (w2 << 26)) & X25519_IFMA_MASK51;
+		ws.limbs[3][i] = ((w2 >> 25) | (w3 << 39)) & X25519_IFMA_MASK51;
+		ws.limbs[4][i] = (w3 >> 12) & X25519_IFMA_MASK51;
+
+		memcpy(ws.t[i], n[i], sizeof(ws.t[i]));
+		ws.t[i][0] &= 248;
+		ws.t[i][31] &= 127;
+		ws.t[i][31] |= 64;
+	}
+
+	/* Collect the bits of all scalars at each position into one mask */
+	for (pos = 0; pos < 255; pos++) {
+		unsigned int m = 0;
+
+		for (i = 0; i < LC_X25519_IFMA_LANES; i++)
+			m |= (unsigned int)((ws.t[i][pos >> 3] >> (pos & 7)) &
+					    1)
+			     << i;
+		ws.swap[pos] = (__mmask8)m;
+	}
+
+	LC_FPU_ENABLE;
+
+	for (k = 0; k < 5; k++)
+		x1[k] = _mm512_loadu_si512((const void *)ws.limbs[k]);
+
+	x25519_ifma_ladder(x2, z2, x1, ws.swap);
+
+	fe_ifma_invert(z2, z2);
+	fe_ifma_mul(x2, x2, z2);
+
+	for (k = 0; k < 5; k++)
+		_mm512_storeu_si512((void *)ws.limbs[k], x2[k]);
+
+	lc_memset_secure(x2, 0, sizeof(x2));
+	lc_memset_secure(z2, 0, sizeof(z2));
+
+	for (i = 0; i < num; i++) {
+		for (k = 0; k < 5; k++)
+			ws.out.v[k] = ws.limbs[k][i];
+		curve25519_fe51_pack_avx(q[i], &ws.out);
+	}
+
+	LC_FPU_DISABLE;
+
+	lc_memset_secure(&ws, 0, sizeof(ws));
+}
@@ -37,6 +37,7 @@
 #include "ret_checkers.h"
 #include "selftest_rng.h"
 #include "signature_domain_separation.h"
+#include "small_stack_support.h"
 #include "timecop.h"
 #include "visibility.h"
 
@@ -310,12 +311,18 @@ static inline void lc_ed25519_dom2(struct lc_hash_ctx *hash_ctx, int prehash)
 	lc_hash_update(hash_ctx, label, sizeof(label));
 }
 
-static int lc_ed25519_sign_internal(
+/*
+ * Sign with the expanded secret key az = SHA-512(sk) where the first half is
+ * the secret scalar, clamped or not, and the second half is the prefix used
+ * for deriving the nonce.
+ */
+static int lc_ed25519_sign_expanded(
 	struct lc_ed25519_sig *sig, int prehash, const uint8_t *msg,
-	size_t mlen, const struct lc_ed25519_sk *sk, struct lc_rng_ctx *rng_ctx,
+	size_t mlen, const uint8_t az[LC_SHA512_SIZE_DIGEST], const uint8_t *pk,
+	struct lc_rng_ctx *rng_ctx,
 	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx)
 {
-	uint8_t az[LC_SHA512_SIZE_DIGEST];
+	uint8_t scalar[32];
 	uint8_t nonce[LC_SHA512_SIZE_DIGEST];
 	uint8_t hram[LC_SHA512_SIZE_DIGEST];
 	ge25519_p3 R;
@@ -323,9 +330,6 @@ static int lc_ed25519_sign_internal(
 	int ret = 0;
 	LC_HASH_CTX_ON_STACK(hash_ctx, lc_sha512);
 
-	CKNULL(sig, -EINVAL);
-	CKNULL(sk, -EINVAL);
-
 	if (composite_ml_dsa_ctx) {
 		dilithium_ctx = &composite_ml_dsa_ctx->dilithium_ctx;
 
@@ -333,11 +337,6 @@ static int lc_ed25519_sign_internal(
 			dilithium_ctx = NULL;
 	}
 
-	/* Timecop: mark the secret key as sensitive */
-	poison(sk->sk, sizeof(sk->sk));
-
-	CKINT(lc_hash(lc_sha512, sk->sk, 32, az));
-
 	CKINT(lc_hash_init(hash_ctx));
 	lc_ed25519_dom2(hash_ctx, prehash);
 
@@ -363,7 +362,7 @@ static int lc_ed25519_sign_internal(
 	lc_hash_update(hash_ctx, msg, mlen);
 	lc_hash_final(hash_ctx, nonce);
 
-	memcpy(sig->sig + 32, sk->sk + 32, 32);
+	memcpy(sig->sig + 32, pk, 32);
 
 	sc25519_reduce(nonce);
 	ge25519_scalarmult_base(&R, nonce);
@@ -386,16 +385,17 @@ static int lc_ed25519_sign_internal(
 	lc_hash_final(hash_ctx, hram);
 
 	sc25519_reduce(hram);
-	az[0] &= 248;
-	az[31] &= 127;
-	az[31] |= 64;
-	sc25519_muladd(sig->sig + 32, hram, az, nonce);
+	memcpy(scalar, az, sizeof(scalar));
+	scalar[0] &= 248;
+	scalar[31] &= 127;
+	scalar[31] |= 64;
+	sc25519_muladd(sig->sig + 32, hram, scalar, nonce);
 
 	/* Timecop: pk and sk are not relevant for side-channels any more. */
 	unpoison(sig->sig, LC_ED25519_SIGBYTES);
 
 out:
-	lc_memset_secure(az, 0, sizeof(az));
+	lc_memset_secure(scalar, 0, sizeof(scalar));
 	lc_memset_secure(nonce, 0, sizeof(nonce));
 	lc_memset_secure(hram, 0, sizeof(hram));
 	lc_memset_secure(&R, 0, sizeof(R));
@@ -403,6 +403,30 @@ out:
 	return ret;
 }
 
+static int lc_ed25519_sign_internal(
+	struct lc_ed25519_sig *sig, int prehash, const uint8_t *msg,
+	size_t mlen, const struct lc_ed25519_sk *sk, struct lc_rng_ctx *rng_ctx,
+	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx)
+{
+	uint8_t az[LC_SHA512_SIZE_DIGEST];
+	int ret;
+
+	CKNULL(sig, -EINVAL);
+	CKNULL(sk, -EINVAL);
+
+	/* Timecop: mark the secret key as sensitive */
+	poison(sk->sk, sizeof(sk->sk));
+
+	CKINT(lc_hash(lc_sha512, sk->sk, 32, az));
+	CKINT(lc_ed25519_sign_expanded(sig, prehash, msg, mlen, az,
+				       sk->sk + 32, rng_ctx,
+				       composite_ml_dsa_ctx));
+
+out:
+	lc_memset_secure(az, 0, sizeof(az));
+	return ret;
+}
+
 int lc_ed25519_sign_ctx(struct lc_ed25519_sig *sig, const uint8_t *msg,
 			size_t mlen, const struct lc_ed25519_sk *sk,
 			struct lc_rng_ctx *rng_ctx,
@@ -438,6 +462,50 @@ LC_INTERFACE_FUNCTION(int, lc_ed25519ph_sign, struct lc_ed25519_sig *sig,
 	return lc_ed25519_sign_internal(sig, 1, msg, mlen, sk, rng_ctx, NULL);
 }
 
+LC_INTERFACE_FUNCTION(int, lc_ed25519_sk_prepare,
+		      struct lc_ed25519_sk_prepared *prep_sk,
+		      const struct lc_ed25519_sk *sk)
+{
+	int ret;
+
+	CKNULL(prep_sk, -EINVAL);
+	CKNULL(sk, -EINVAL);
+
+	/* Timecop: mark the secret key as sensitive */
+	poison(sk->sk, sizeof(sk->sk));
+
+	CKINT(lc_hash(lc_sha512, sk->sk, 32, prep_sk->az));
+	prep_sk->az[0] &= 248;
+	prep_sk->az[31] &= 127;
+	prep_sk->az[31] |= 64;
+	memcpy(prep_sk->pk, sk->sk + 32, sizeof(prep_sk->pk));
+
+	unpoison(prep_sk->pk, sizeof(prep_sk->pk));
+
+out:
+	if (ret)
+		lc_memset_secure(prep_sk, 0, sizeof(*prep_sk));
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_ed25519_sign_prepared,
+		      struct lc_ed25519_sig *sig, const uint8_t *msg,
+		      size_t mlen, const struct lc_ed25519_sk_prepared *prep_sk,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	lc_ed25519_sign_tester();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_ED25519_SIGGEN);
+
+	if (!sig || !prep_sk)
+		return -EINVAL;
+
+	/* Timecop: mark the secret key as sensitive */
+	poison(prep_sk->az, sizeof(prep_sk->az));
+
+	return lc_ed25519_sign_expanded(sig, 0, msg, mlen, prep_sk->az,
+					prep_sk->pk, rng_ctx, NULL);
+}
+
 static int lc_ed25519_verify_internal(
 	const struct lc_ed25519_sig *sig, int prehash, const uint8_t *msg,
 	size_t mlen, const struct lc_ed25519_pk *pk,
@@ -516,17 +584,18 @@ static void lc_ed25519_verify_tester(void)
 			    "ED25519 Signature verification\n");
 }
 
-static int lc_ed25519_verify_internal(
+/*
+ * Perform the checks on the signature and public key, decode R and A (the
+ * latter negated) and compute h = SHA-512(dom2 || R || A || M) mod l. If
+ * A_decoded is set, A already holds the checked and decoded public key.
+ */
+static int lc_ed25519_verify_prepare(
 	const struct lc_ed25519_sig *sig, int prehash, const uint8_t *msg,
 	size_t mlen, const struct lc_ed25519_pk *pk,
-	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx)
+	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx,
+	uint8_t h[LC_SHA512_SIZE_DIGEST], ge25519_p3 *expected_r,
+	ge25519_p3 *A, int A_decoded)
 {
-	uint8_t h[LC_SHA512_SIZE_DIGEST];
-	ge25519_p3 check;
-	ge25519_p3 expected_r;
-	ge25519_p3 A;
-	ge25519_p3 sb_ah;
-	ge25519_p2 sb_ah_p2;
 	struct lc_dilithium_ctx *dilithium_ctx = NULL;
 	int ret = 0;
 	LC_HASH_CTX_ON_STACK(hash_ctx, lc_sha512);
@@ -553,18 +622,18 @@ static int lc_ed25519_verify_internal(
 		ret = -EINVAL;
 		goto out;
 	}
-	if (ge25519_is_canonical(pk->pk) == 0) {
+	if (!A_decoded && ge25519_is_canonical(pk->pk) == 0) {
 		ret = -EINVAL;
 		goto out;
 	}
 #endif
-	if (ge25519_frombytes_negate_vartime(&A, pk->pk) != 0 ||
-	    ge25519_has_small_order(&A) != 0) {
+	if (!A_decoded && (ge25519_frombytes_negate_vartime(A, pk->pk) != 0 ||
+			   ge25519_has_small_order(A) != 0)) {
 		ret = -EINVAL;
 		goto out;
 	}
-	if (ge25519_frombytes(&expected_r, sig->sig) != 0 ||
-	    ge25519_has_small_order(&expected_r) != 0) {
+	if (ge25519_frombytes(expected_r, sig->sig) != 0 ||
+	    ge25519_has_small_order(expected_r) != 0) {
 		ret = -EINVAL;
 		goto out;
 	}
@@ -585,24 +654,55 @@ static int lc_ed25519_verify_internal(
 
 	lc_hash_update(hash_ctx, msg, mlen);
 	lc_hash_final(hash_ctx, h);
-	lc_hash_zero(hash_ctx);
 	sc25519_reduce(h);
 
-	ge25519_double_scalarmult_vartime(&sb_ah_p2, h, &A, sig->sig + 32);
+out:
+	lc_hash_zero(hash_ctx);
+	return ret;
+}
+
+/* Check that R - (S * B - h * A) is of small order */
+static int lc_ed25519_verify_equation(const uint8_t *h,
+				      const ge25519_p3 *expected_r,
+				      const ge25519_p3 *A, const uint8_t *s)
+{
+	ge25519_p3 check;
+	ge25519_p3 sb_ah;
+	ge25519_p2 sb_ah_p2;
+	int ret = 0;
+
+	ge25519_double_scalarmult_vartime(&sb_ah_p2, h, A, s);
 	ge25519_p2_to_p3(&sb_ah, &sb_ah_p2);
-	ge25519_p3_sub(&check, &expected_r, &sb_ah);
+	ge25519_p3_sub(&check, expected_r, &sb_ah);
 
 	if ((ge25519_has_small_order(&check) - 1) != 0)
 		ret = -EBADMSG;
 
+	lc_memset_secure(&check, 0, sizeof(check));
+	lc_memset_secure(&sb_ah, 0, sizeof(sb_ah));
+	lc_memset_secure(&sb_ah_p2, 0, sizeof(sb_ah_p2));
+	return ret;
+}
+
+static int lc_ed25519_verify_internal(
+	const struct lc_ed25519_sig *sig, int prehash, const uint8_t *msg,
+	size_t mlen, const struct lc_ed25519_pk *pk,
+	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx)
+{
+	uint8_t h[LC_SHA512_SIZE_DIGEST];
+	ge25519_p3 expected_r;
+	ge25519_p3 A;
+	int ret;
+
+	CKINT(lc_ed25519_verify_prepare(sig, prehash, msg, mlen, pk,
+					composite_ml_dsa_ctx, h, &expected_r,
+					&A, 0));
+	ret = lc_ed25519_verify_equation(h, &expected_r, &A, sig->sig + 32);
+
 out:
 	lc_memset_secure(h, 0, sizeof(h));
-	lc_memset_secure(&check, 0, sizeof(check));
 	lc_memset_secure(&expected_r, 0, sizeof(expected_r));
 	lc_memset_secure(&A, 0, sizeof(A));
-	lc_memset_secure(&sb_ah, 0, sizeof(sb_ah));
-	lc_memset_secure(&sb_ah_p2, 0, sizeof(sb_ah_p2));
-	lc_hash_zero(hash_ctx);
 	return ret;
 }
 
@@ -637,3 +737,176 @@ LC_INTERFACE_FUNCTION(int, lc_ed25519ph_verify,
 
 	return lc_ed25519_verify_internal(sig, 1, msg, mlen, pk, NULL);
 }
+
+/*
+ * Number of signatures combined into one multi-scalar multiplication: each
+ * signature contributes R and A (unless A is shared with a preceding
+ * signature in the chunk) to the point set.
+ */
+#define LC_ED25519_VERIFY_BATCH_CHUNK (GE25519_MULTI_SCALARMULT_MAX / 2)
+
+struct lc_ed25519_verify_batch_ws {
+	uint8_t h[LC_ED25519_VERIFY_BATCH_CHUNK][LC_SHA512_SIZE_DIGEST];
+	ge25519_p3 expected_r[LC_ED25519_VERIFY_BATCH_CHUNK];
+	ge25519_p3 A[LC_ED25519_VERIFY_BATCH_CHUNK];
+	uint8_t z[LC_ED25519_VERIFY_BATCH_CHUNK][32];
+	int ret[LC_ED25519_VERIFY_BATCH_CHUNK];
+	unsigned int a_dup[LC_ED25519_VERIFY_BATCH_CHUNK];
+	unsigned int a_idx[LC_ED25519_VERIFY_BATCH_CHUNK];
+	ge25519_p3 points[GE25519_MULTI_SCALARMULT_MAX];
+	uint8_t scalars[GE25519_MULTI_SCALARMULT_MAX][32];
+	uint8_t b[32];
+	ge25519_p3 check;
+};
+
+/*
+ * Verify up to LC_ED25519_VERIFY_BATCH_CHUNK signatures with one randomized
+ * linear combination of the verification equations:
+ *
+ * sum(z_i * R_i) - (sum(z_i * S_i)) * B + sum((z_i * h_i) * A_i)
+ *
+ * must be of small order for 128 bit random z_i. This is the cofactored
+ * equivalent of the check applied by lc_ed25519_verify_equation which
+ * therefore accepts the same signatures. If the combination does not hold,
+ * each signature is verified on its own to identify the bad ones.
+ */
+static int lc_ed25519_verify_batch_chunk(
+	struct lc_ed25519_verify_batch_ws *ws, int *res,
+	const struct lc_ed25519_sig *const *sig, const uint8_t *const *msg,
+	const size_t *mlen, unsigned int num,
+	const struct lc_ed25519_pk *const *pk,
+	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx)
+{
+	struct lc_rng_ctx *rng_ctx = NULL;
+	unsigned int i, j, npoints = 0, nvalid = 0;
+	int ret = 0;
+
+	for (i = 0; i < num; i++) {
+		/* Decode each public key only once */
+		for (j = 0; pk[i] && j < i; j++) {
+			if (!ws->ret[j] &&
+			    !memcmp(pk[j]->pk, pk[i]->pk,
+				    LC_ED25519_PUBLICKEYBYTES)) {
+				ws->A[i] = ws->A[j];
+				break;
+			}
+		}
+		ws->a_dup[i] = (pk[i] && j < i) ? j : i;
+
+		ws->ret[i] = lc_ed25519_verify_prepare(
+			sig[i], 0, msg[i], mlen[i], pk[i], composite_ml_dsa_ctx,
+			ws->h[i], &ws->expected_r[i], &ws->A[i],
+			ws->a_dup[i] != i);
+		if (!ws->ret[i])
+			nvalid++;
+	}
+
+	if (nvalid) {
+		lc_rng_check(&rng_ctx);
+		memset(ws->z, 0, sizeof(ws->z));
+		memset(ws->b, 0, sizeof(ws->b));
+
+		for (i = 0; i < num; i++) {
+			if (ws->ret[i])
+				continue;
+
+			CKINT(lc_rng_generate(rng_ctx, NULL, 0, ws->z[i], 16));
+
+			/* z_i * R_i: the sum is negated as A_i is negated */
+			ge25519_p3_neg(&ws->points[npoints], &ws->expected_r[i]);
+			memcpy(ws->scalars[npoints], ws->z[i], 32);
+			npoints++;
+
+			/* sum(z_i * S_i) */
+			sc25519_muladd(ws->b, ws->z[i], sig[i]->sig + 32, ws->b);
+
+			/* (z_i * h_i) * A_i, merged for repeated public keys */
+			j = ws->a_dup[i];
+			if (j != i) {
+				ws->a_idx[i] = ws->a_idx[j];
+				sc25519_muladd(ws->scalars[ws->a_idx[i]],
+					       ws->z[i], ws->h[i],
+					       ws->scalars[ws->a_idx[i]]);
+			} else {
+				ws->a_idx[i] = npoints;
+				ws->points[npoints] = ws->A[i];
+				sc25519_mul(ws->scalars[npoints], ws->z[i],
+					    ws->h[i]);
+				npoints++;
+			}
+		}
+
+		ge25519_multi_scalarmult_vartime(
+			&ws->check, (const unsigned char(*)[32])ws->scalars,
+			ws->points, npoints, ws->b);
+
+		if ((ge25519_has_small_order(&ws->check) - 1) != 0) {
+			for (i = 0; i < num; i++) {
+				if (ws->ret[i])
+					continue;
+
+				ws->ret[i] = lc_ed25519_verify_equation(
+					ws->h[i], &ws->expected_r[i], &ws->A[i],
+					sig[i]->sig + 32);
+			}
+		}
+	}
+
+	for (i = 0; i < num; i++) {
+		if (res)
+			res[i] = ws->ret[i];
+		if (ws->ret[i])
+			ret = -EBADMSG;
+	}
+
+out:
+	return ret;
+}
+
+int lc_ed25519_verify_batch_ctx(
+	int *res, const struct lc_ed25519_sig *const *sig,
+	const uint8_t *const *msg, const size_t *mlen, unsigned int num,
+	const struct lc_ed25519_pk *const *pk,
+	struct lc_dilithium_ed25519_ctx *composite_ml_dsa_ctx)
+{
+	unsigned int i, n;
+	int ret = 0, tmp;
+	LC_DECLARE_MEM(ws, struct lc_ed25519_verify_batch_ws, sizeof(uint64_t));
+
+	lc_ed25519_verify_tester();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_ED25519_SIGVER);
+
+	CKNULL(sig, -EINVAL);
+	CKNULL(msg, -EINVAL);
+	CKNULL(mlen, -EINVAL);
+	CKNULL(pk, -EINVAL);
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_ED25519_VERIFY_BATCH_CHUNK)
+			n = LC_ED25519_VERIFY_BATCH_CHUNK;
+
+		tmp = lc_ed25519_verify_batch_chunk(ws, res ? res + i : NULL,
+						    sig + i, msg + i, mlen + i,
+						    n, pk + i,
+						    composite_ml_dsa_ctx);
+		if (tmp == -EBADMSG) {
+			ret = tmp;
+		} else if (tmp) {
+			ret = tmp;
+			goto out;
+		}
+	}
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_ed25519_verify_batch, int *res,
+		      const struct lc_ed25519_sig *const *sig,
+		      const uint8_t *const *msg, const size_t *mlen,
+		      unsigned int num, const struct lc_ed25519_pk *const *pk)
+{
+	return lc_ed25519_verify_batch_ctx(res, sig, msg, mlen, num, pk, NULL);
+}
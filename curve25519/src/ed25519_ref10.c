@@ -30,6 +30,18 @@
 #include "ext_headers_internal.h"
 #include "small_stack_support.h"
 
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+#define LC_ED25519_AVX2
+#include "avx/ed25519_avx2.h"
+#include "cpufeatures.h"
+
+#ifdef LC_ED25519_LARGE_BASE_TABLE
+#define LC_ED25519_COMB_SSE2
+#include "build_bug_on.h"
+#include "ext_headers_x86.h"
+#endif
+#endif
+
 static inline uint64_t load_3(const unsigned char *in)
 {
 	uint64_t result;
@@ -480,9 +492,9 @@ void ge25519_p1p1_to_p3(ge25519_p3 *r, const ge25519_p1p1 *p)
  */
 void ge25519_p2_to_p3(ge25519_p3 *r, const ge25519_p2 *p)
 {
-	fe25519_copy(r->X, p->X);
-	fe25519_copy(r->Y, p->Y);
-	fe25519_copy(r->Z, p->Z);
+	fe25519_mul(r->X, p->X, p->Z);
+	fe25519_mul(r->Y, p->Y, p->Z);
+	fe25519_sq(r->Z, p->Z);
 	fe25519_mul(r->T, p->X, p->Y);
 }
 
@@ -642,6 +654,8 @@ static void ge25519_cmov_cached(ge25519_cached *t, const ge25519_cached *u,
 	fe25519_cmov(t->T2d, u->T2d, b);
 }
 
+#ifndef LC_ED25519_LARGE_BASE_TABLE
+
 static void ge25519_cmov8(ge25519_precomp *t, const ge25519_precomp precomp[8],
 			  const signed char b)
 {
@@ -680,6 +694,87 @@ static void ge25519_cmov8_base(ge25519_precomp *t, const int pos,
 	ge25519_cmov8(t, base[pos], b);
 }
 
+#else /* LC_ED25519_LARGE_BASE_TABLE */
+
+/*
+ * Select b * P from precomp[j] = (j + 1) * P with -16 <= b <= 16 in constant
+ * time. All entries are read independently of b and the selected one is
+ * accumulated with masks. On x86-64, the masking operates on full SSE2
+ * registers which is considerably faster than the conditional moves of
+ * ge25519_cmov when scanning 16 entries.
+ */
+static void ge25519_cmov16(ge25519_precomp *t,
+			   const ge25519_precomp precomp[16],
+			   const signed char b)
+{
+	ge25519_precomp minust;
+	const unsigned char bnegative = negative(b);
+	const unsigned char babs = (unsigned char)(b - (((-bnegative) & b) *
+							((signed char)1 << 1)));
+	unsigned int i;
+
+#ifdef LC_ED25519_COMB_SSE2
+	__m128i acc[8], mask;
+	uint64_t last[2];
+	unsigned int k;
+
+	BUILD_BUG_ON(sizeof(ge25519_precomp) != 7 * sizeof(__m128i) + 8);
+
+	/* b = 0 selects the neutral element */
+	ge25519_precomp_0(t);
+	mask = _mm_set1_epi64x(-(long long)equal(babs, 0));
+	for (k = 0; k < 7; k++) {
+		acc[k] = _mm_and_si128(_mm_loadu_si128((__m128i *)t + k), mask);
+	}
+	acc[7] = _mm_and_si128(_mm_loadl_epi64((__m128i *)t + 7), mask);
+
+	for (i = 0; i < 16; i++) {
+		const __m128i *entry = (const __m128i *)&precomp[i];
+
+		mask = _mm_set1_epi64x(
+			-(long long)equal(babs, (unsigned char)(i + 1)));
+		for (k = 0; k < 7; k++) {
+			acc[k] = _mm_or_si128(
+				acc[k],
+				_mm_and_si128(_mm_loadu_si128(entry + k), mask));
+		}
+		acc[7] = _mm_or_si128(
+			acc[7], _mm_and_si128(_mm_loadl_epi64(entry + 7), mask));
+	}
+
+	for (k = 0; k < 7; k++)
+		_mm_storeu_si128((__m128i *)t + k, acc[k]);
+	_mm_storeu_si128((__m128i *)last, acc[7]);
+	memcpy((uint8_t *)t + 7 * sizeof(__m128i), last, 8);
+#else
+	ge25519_precomp_0(t);
+	for (i = 0; i < 16; i++)
+		ge25519_cmov(t, &precomp[i], equal(babs, (unsigned char)(i + 1)));
+#endif
+
+	fe25519_copy(minust.yplusx, t->yminusx);
+	fe25519_copy(minust.yminusx, t->yplusx);
+	fe25519_neg(minust.xy2d, t->xy2d);
+	ge25519_cmov(t, &minust, bnegative);
+}
+
+static void ge25519_cmov16_base(ge25519_precomp *t, const int pos,
+				const signed char b)
+{
+	LC_FIPS_RODATA_SECTION
+	static const ge25519_precomp base[52][16] = {
+	/* base[i][j] = (j+1)*32^i*B */
+#ifdef LC_HOST_X86_64
+#include "fe_51/base_comb.h"
+#else
+#include "fe_25_5/base_comb.h"
+#endif
+	};
+	ge25519_cmov16(t, base[pos], b);
+}
+
+#endif /* LC_ED25519_LARGE_BASE_TABLE */
+
 static void ge25519_cmov8_cached(ge25519_cached *t,
 				 const ge25519_cached cached[8],
 				 const signed char b)
@@ -776,6 +871,15 @@ static int _ge25519_double_scalarmult_vartime(ge25519_p2 *r,
 	slide_vartime(ws->aslide, a);
 	slide_vartime(ws->bslide, b);
 
+#ifdef LC_ED25519_AVX2
+	if (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) {
+		i = ge25519_double_scalarmult_vartime_avx2(r, ws->aslide, A,
+							   ws->bslide, Bi);
+		LC_RELEASE_MEM(ws);
+		return i;
+	}
+#endif
+
 	ge25519_p3_to_cached(&ws->Ai[0], A);
 
 	ge25519_p3_dbl(&ws->t, A);
@@ -854,6 +958,138 @@ void ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
 	_ge25519_double_scalarmult_vartime(r, a, A, b);
 }
 
+/*
+ Ai = A,3A,5A,7A,9A,11A,13A,15A
+ */
+
+static void ge25519_cached_odd_multiples(ge25519_cached Ai[8],
+					 const ge25519_p3 *A)
+{
+	ge25519_p1p1 t;
+	ge25519_p3 u;
+	ge25519_p3 A2;
+	unsigned int i;
+
+	ge25519_p3_to_cached(&Ai[0], A);
+
+	ge25519_p3_dbl(&t, A);
+	ge25519_p1p1_to_p3(&A2, &t);
+
+	for (i = 1; i < 8; i++) {
+		ge25519_add_cached(&t, &A2, &Ai[i - 1]);
+		ge25519_p1p1_to_p3(&u, &t);
+		ge25519_p3_to_cached(&Ai[i], &u);
+	}
+}
+
+/*
+ r = a[0] * A[0] + ... + a[n - 1] * A[n - 1] + b * B
+ where the scalars are encoded as for ge25519_double_scalarmult_vartime and
+ B is the Ed25519 base point.
+
+ The points are processed interleaved (Straus) with the sliding windows of
+ ge25519_double_scalarmult_vartime: all points share one chain of 256
+ doublings and each point only adds its window digits. n must not be larger
+ than GE25519_MULTI_SCALARMULT_MAX.
+
+ Only used for batch signatures verification.
+ */
+
+static int _ge25519_multi_scalarmult_vartime(ge25519_p3 *r,
+					     const unsigned char (*a)[32],
+					     const ge25519_p3 *A,
+					     unsigned int n,
+					     const unsigned char *b)
+{
+	LC_FIPS_RODATA_SECTION
+	static const ge25519_precomp Bi[8] = {
+#ifdef LC_HOST_X86_64
+#include "fe_51/base2.h"
+#else
+#include "fe_25_5/base2.h"
+#endif
+	};
+	struct workspace {
+		signed char aslide[GE25519_MULTI_SCALARMULT_MAX][256];
+		signed char bslide[256];
+		ge25519_cached Ai[GE25519_MULTI_SCALARMULT_MAX][8];
+		ge25519_p1p1 t;
+		ge25519_p3 u;
+		ge25519_p2 r2;
+	};
+	unsigned int j;
+	int i, top = -1;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	slide_vartime(ws->bslide, b);
+	for (i = 255; i >= 0; --i) {
+		if (ws->bslide[i]) {
+			top = i;
+			break;
+		}
+	}
+
+	for (j = 0; j < n; j++) {
+		slide_vartime(ws->aslide[j], a[j]);
+		ge25519_cached_odd_multiples(ws->Ai[j], &A[j]);
+
+		for (i = 255; i > top; --i) {
+			if (ws->aslide[j][i]) {
+				top = i;
+				break;
+			}
+		}
+	}
+
+	ge25519_p2_0(&ws->r2);
+
+	for (i = top; i >= 0; --i) {
+		ge25519_p2_dbl(&ws->t, &ws->r2);
+
+		for (j = 0; j < n; j++) {
+			signed char d = ws->aslide[j][i];
+
+			if (d > 0) {
+				ge25519_p1p1_to_p3(&ws->u, &ws->t);
+				ge25519_add_cached(&ws->t, &ws->u,
+						   &ws->Ai[j][d / 2]);
+			} else if (d < 0) {
+				ge25519_p1p1_to_p3(&ws->u, &ws->t);
+				ge25519_sub_cached(&ws->t, &ws->u,
+						   &ws->Ai[j][(-d) / 2]);
+			}
+		}
+
+		if (ws->bslide[i] > 0) {
+			ge25519_p1p1_to_p3(&ws->u, &ws->t);
+			ge25519_add_precomp(&ws->t, &ws->u,
+					    &Bi[ws->bslide[i] / 2]);
+		} else if (ws->bslide[i] < 0) {
+			ge25519_p1p1_to_p3(&ws->u, &ws->t);
+			ge25519_sub_precomp(&ws->t, &ws->u,
+					    &Bi[(-ws->bslide[i]) / 2]);
+		}
+
+		ge25519_p1p1_to_p2(&ws->r2, &ws->t);
+	}
+
+	if (top < 0)
+		ge25519_p3_0(r);
+	else
+		ge25519_p1p1_to_p3(r, &ws->t);
+
+	LC_RELEASE_MEM(ws);
+	return 0;
+}
+
+void ge25519_multi_scalarmult_vartime(ge25519_p3 *r,
+				      const unsigned char (*a)[32],
+				      const ge25519_p3 *A, unsigned int n,
+				      const unsigned char *b)
+{
+	_ge25519_multi_scalarmult_vartime(r, a, A, n, b);
+}
+
 /*
  h = a * p
  where a = a[0]+256*a[1]+...+256^31 a[31]
@@ -969,6 +1205,67 @@ void ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a,
  a[31] <= 127
  */
 
+#ifdef LC_ED25519_LARGE_BASE_TABLE
+
+/*
+ * The scalar is recoded into 52 signed radix-32 digits. As the table holds
+ * the multiples of 32^i * B for every digit position, each digit costs one
+ * addition and no doublings are needed: 52 additions instead of the 64
+ * additions and 4 doublings of the default table.
+ */
+void ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
+{
+	signed char e[52];
+	signed char carry;
+	ge25519_p1p1 r;
+	ge25519_precomp t;
+	unsigned int i, bit, v;
+
+	for (i = 0; i < 52; ++i) {
+		bit = 5 * i;
+		v = (unsigned int)a[bit >> 3] >> (bit & 7);
+		if ((bit >> 3) < 31)
+			v |= (unsigned int)a[(bit >> 3) + 1] << (8 - (bit & 7));
+		e[i] = (signed char)(v & 31);
+	}
+	/* each e[i] is between 0 and 31 */
+	/* e[51] is 0 */
+
+	carry = 0;
+	for (i = 0; i < 51; ++i) {
+		e[i] += carry;
+		carry = e[i] + 16;
+		carry >>= 5;
+		e[i] -= (signed char)(carry * ((signed char)1 << 5));
+	}
+	e[51] += carry;
+	/* each e[i] is between -16 and 16 */
+
+#ifdef LC_ED25519_AVX2
+	if (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) {
+		ge25519_avx2 p;
+
+		ge25519_avx2_0(&p);
+		for (i = 0; i < 52; i++) {
+			ge25519_cmov16_base(&t, (int)i, e[i]);
+			ge25519_avx2_add_precomp(&p, &t);
+		}
+		ge25519_avx2_to_p3(h, &p);
+		return;
+	}
+#endif
+
+	ge25519_p3_0(h);
+
+	for (i = 0; i < 52; i++) {
+		ge25519_cmov16_base(&t, (int)i, e[i]);
+		ge25519_add_precomp(&r, h, &t);
+		ge25519_p1p1_to_p3(h, &r);
+	}
+}
+
+#else /* LC_ED25519_LARGE_BASE_TABLE */
+
 void ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
 {
 	signed char e[64];
@@ -995,6 +1292,27 @@ void ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
 	e[63] += carry;
 	/* each e[i] is between -8 and 8 */
 
+#ifdef LC_ED25519_AVX2
+	if (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) {
+		ge25519_avx2 p;
+
+		ge25519_avx2_0(&p);
+		for (i = 1; i < 64; i += 2) {
+			ge25519_cmov8_base(&t, i / 2, e[i]);
+			ge25519_avx2_add_precomp(&p, &t);
+		}
+
+		ge25519_avx2_dbl(&p, 4);
+
+		for (i = 0; i < 64; i += 2) {
+			ge25519_cmov8_base(&t, i / 2, e[i]);
+			ge25519_avx2_add_precomp(&p, &t);
+		}
+		ge25519_avx2_to_p3(h, &p);
+		return;
+	}
+#endif
+
 	ge25519_p3_0(h);
 
 	for (i = 1; i < 64; i += 2) {
@@ -1019,6 +1337,8 @@ void ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
 	}
 }
 
+#endif /* LC_ED25519_LARGE_BASE_TABLE */
+
 /* r = 2p */
 static void ge25519_p3p3_dbl(ge25519_p3 *r, const ge25519_p3 *p)
 {
@@ -1029,7 +1349,7 @@ static void ge25519_p3p3_dbl(ge25519_p3 *r, const ge25519_p3 *p)
 }
 
 /* r = -p */
-static void ge25519_p3_neg(ge25519_p3 *r, const ge25519_p3 *p)
+void ge25519_p3_neg(ge25519_p3 *r, const ge25519_p3 *p)
 {
 	fe25519_neg(r->X, p->X);
 	fe25519_copy(r->Y, p->Y);
@@ -1185,24 +1505,20 @@ int ge25519_is_canonical(const unsigned char *s)
 
 unsigned int ge25519_has_small_order(const ge25519_p3 *p)
 {
-	fe25519 recip;
-	fe25519 x;
-	fe25519 x_neg;
-	fe25519 y;
 	fe25519 y_sqrtm1;
 	fe25519 c;
 	unsigned int ret = 0;
 
-	fe25519_invert(recip, p->Z);
-	fe25519_mul(x, p->X, recip);
-	ret |= fe25519_iszero(x);
-	fe25519_mul(y, p->Y, recip);
-	ret |= fe25519_iszero(y);
-	fe25519_neg(x_neg, p->X);
-	fe25519_mul(y_sqrtm1, y, fe25519_sqrtm1);
-	fe25519_sub(c, y_sqrtm1, x);
+	/*
+	 * The points of order 1, 2, 4 and 8 have x = 0, y = 0 or x = +/-i * y,
+	 * all of which can be checked projectively without an inversion.
+	 */
+	ret |= fe25519_iszero(p->X);
+	ret |= fe25519_iszero(p->Y);
+	fe25519_mul(y_sqrtm1, p->Y, fe25519_sqrtm1);
+	fe25519_sub(c, y_sqrtm1, p->X);
 	ret |= fe25519_iszero(c);
-	fe25519_sub(c, y_sqrtm1, x_neg);
+	fe25519_add(c, y_sqrtm1, p->X);
 	ret |= fe25519_iszero(c);
 
 	return ret;
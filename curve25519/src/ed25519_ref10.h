@@ -121,6 +121,8 @@ void ge25519_p3_add(ge25519_p3 *r, const ge25519_p3 *p, const ge25519_p3 *q);
 
 void ge25519_p3_sub(ge25519_p3 *r, const ge25519_p3 *p, const ge25519_p3 *q);
 
+void ge25519_p3_neg(ge25519_p3 *r, const ge25519_p3 *p);
+
 void ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a);
 
 void ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
@@ -130,6 +132,12 @@ void ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
 void ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a,
 			const ge25519_p3 *p);
 
+#define GE25519_MULTI_SCALARMULT_MAX 32
+void ge25519_multi_scalarmult_vartime(ge25519_p3 *r,
+				      const unsigned char (*a)[32],
+				      const ge25519_p3 *A, unsigned int n,
+				      const unsigned char *b);
+
 void ge25519_clear_cofactor(ge25519_p3 *p3);
 
 int ge25519_is_canonical(const unsigned char *s);
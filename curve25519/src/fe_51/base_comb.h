@@ -0,0 +1,5096 @@
+{ /* 0/51 */
+  { { 1288382639258501, 245678601348599, 269427782077623, 1462984067271730,
+      137412439391563 },
+    { 62697248952638, 204681361388450, 631292143396476, 338455783676468,
+      1213667448819585 },
+    { 301289933810280, 1259582250014073, 1422107436869536, 796239922652654,
+      1953934009299142 } },
+  { { 1380971894829527, 790832306631236, 2067202295274102, 1995808275510000,
+      1566530869037010 },
+    { 463307831301544, 432984605774163, 1610641361907204, 750899048855000,
+      1894842303421586 },
+    { 748439484463711, 1033211726465151, 1396005112841647, 1611506220286469,
+      1972177495910992 } },
+  { { 1601611775252272, 1720807796594148, 1132070835939856, 1260455018889551,
+      2147779492816911 },
+    { 316559037616741, 2177824224946892, 1459442586438991, 1461528397712656,
+      751590696113597 },
+    { 1850748884277385, 1200145853858453, 1068094770532492, 672251375690438,
+      1586055907191707 } },
+  { { 934282339813791, 1846903124198670, 1172395437954843, 1007037127761661,
+      1830588347719256 },
+    { 1694390458783935, 1735906047636159, 705069562067493, 648033061693059,
+      696214010414170 },
+    { 1121406372216585, 192876649532226, 190294192191717, 1994165897297032,
+      2245000007398739 } },
+  { { 769950342298419, 132954430919746, 844085933195555, 974092374476333,
+      726076285546016 },
+    { 425251763115706, 608463272472562, 442562545713235, 837766094556764,
+      374555092627893 },
+    { 1086255230780037, 274979815921559, 1960002765731872, 929474102396301,
+      1190409889297339 } },
+  { { 1388594989461809, 316767091099457, 394298842192982, 1230079486801005,
+      1440737038838979 },
+    { 7380825640100, 146210432690483, 304903576448906, 1198869323871120,
+      997689833219095 },
+    { 1181317918772081, 114573476638901, 262805072233344, 265712217171332,
+      294181933805782 } },
+  { { 665000864555967, 2065379846933859, 370231110385876, 350988370788628,
+      1233371373142985 },
+    { 2019367628972465, 676711900706637, 110710997811333, 1108646842542025,
+      517791959672113 },
+    { 965130719900578, 247011430587952, 526356006571389, 91986625355052,
+      2157223321444601 } },
+  { { 2068619540119183, 1966274918058806, 957728544705549, 729906502578991,
+      159834893065166 },
+    { 2073601412052185, 31021124762708, 264500969797082, 248034690651703,
+      1030252227928288 },
+    { 551790716293402, 1989538725166328, 801169423371717, 2052451893578887,
+      678432056995012 } },
+  { { 1802695059465007, 1664899123557221, 593559490740857, 2160434469266659,
+      927570450755031 },
+    { 1725674970513508, 1933645953859181, 1542344539275782, 1767788773573747,
+      1297447965928905 },
+    { 1381809363726107, 1430341051343062, 2061843536018959, 1551778050872521,
+      2036394857967624 } },
+  { { 1569908045411470, 706723917266915, 1500941167088851, 271058246676941,
+      1190527933001305 },
+    { 938493881647581, 1913928661987006, 2094455298711648, 986546367603450,
+      58515486184715 },
+    { 1454533688490200, 416156769327623, 1344514353803379, 1816391251363763,
+      259908591619060 } },
+  { { 1970894096313054, 528066325833207, 1619374932191227, 2207306624415883,
+      1169170329061080 },
+    { 2070390218572616, 1458919061857835, 624171843017421, 1055332792707765,
+      433987520732508 },
+    { 893653801273833, 1168026499324677, 1242553501121234, 1306366254304474,
+      1086752658510815 } },
+  { { 1548398643541305, 838955728976966, 116266075650295, 1878116023572280,
+      132675799667661 },
+    { 2114866412082361, 591083254091949, 940561138633470, 412059816539947,
+      2134627974686210 },
+    { 1571032457823571, 1253760059932116, 665829584253800, 109400965270906,
+      981221002823741 } },
+  { { 213454002618221, 939771523987438, 1159882208056014, 317388369627517,
+      621213314200687 },
+    { 1971678598905747, 338026507889165, 762398079972271, 655096486107477,
+      42299032696322 },
+    { 177130678690680, 1754759263300204, 1864311296286618, 1180675631479880,
+      1292726903152791 } },
+  { { 124159973735922, 12085856625887, 570609322991103, 870869641855508,
+      1947192330052817 },
+    { 996453150823040, 557931626380283, 1039170142840520, 115485616863415,
+      808203906823112 },
+    { 498660636760962, 1605652986893012, 893278769679967, 1769999239723039,
+      646478004325289 } },
+  { { 1913163449625248, 460779200291993, 2193883288642314, 1008900146920800,
+      1721983679009502 },
+    { 1070401523076875, 1272492007800961, 1910153608563310, 2075579521696771,
+      1191169788841221 },
+    { 692896803108118, 500174642072499, 2068223309439677, 1162190621851337,
+      1426986007309901 } },
+  { { 1412482364088822, 1810590036362821, 923779398567548, 2023841154802081,
+      355905946953295 },
+    { 89929455382003, 409881867087833, 601740464114195, 1198413365513369,
+      1353640795548072 },
+    { 1825728698698411, 497946242397168, 105715611816086, 968568072676853,
+      592999326381074 } }
+},
+{ /* 1/51 */
+  { { 697390239916431, 1979948019919137, 219386298782941, 1322163545375974,
+      2216896082446062 },
+    { 2243384404640579, 785474317161769, 1966836974893905, 484861779306458,
+      182878807563947 },
+    { 743917567567859, 870447381138646, 392196079309387, 1786878704882853,
+      1520161635991866 } },
+  { { 17312075132209, 979788843744677, 871430968010085, 1299656894822779,
+      1180051671372258 },
+    { 1437746335671579, 1161524116603216, 612164096500525, 996617112698868,
+      969716318261981 },
+    { 407953783981, 1647278360877740, 584504284208188, 906066565536232,
+      1341016264992694 } },
+  { { 577289733493044, 1790256014216199, 1797656649279268, 311091238837443,
+      493980515519392 },
+    { 2025760966125832, 102033327397065, 115646513104586, 1232705905425061,
+      485822002465270 },
+    { 62004126799683, 1668357417723485, 402010966421038, 827662362499868,
+      620754241677270 } },
+  { { 898618711827587, 1314215296781160, 1302503840208753, 1244939174414641,
+      1698289814254751 },
+    { 1863200156658018, 1022256865883135, 1702323481131932, 1517463390341654,
+      1993268869301555 },
+    { 1392999845620760, 634309693840701, 815492400002072, 340703897996290,
+      2038693787178716 } },
+  { { 364104552578517, 737197398316646, 1602932940462504, 2167985252180769,
+      308160995097814 },
+    { 265853220313602, 409817514657505, 1887800100787328, 1224371809176626,
+      658646916746588 },
+    { 1882565165016312, 1581434850744420, 1900290919378503, 1985953844470085,
+      2168995994538833 } },
+  { { 603033805804918, 1321768811817989, 536183518454770, 12190759869489,
+      1793061944113996 },
+    { 1763917473799381, 749878681687651, 1818404629672345, 2194036038724398,
+      161511890752682 },
+    { 1398840935273285, 790488576331737, 33415624257391, 1637374533896247,
+      2205752015162110 } },
+  { { 192551290544395, 212638631228835, 2148034812459853, 1041500100514044,
+      1602026846836918 },
+    { 722463354779248, 2225481153946854, 843556932648540, 64045720696467,
+      342896367709166 },
+    { 273084620529389, 1358348733025497, 1143735162114047, 1683813303234668,
+      2163735276562013 } },
+  { { 1368953770187805, 790347636712921, 437508475667162, 2142576377050580,
+      1932081720066286 },
+    { 953638594433374, 1092333936795051, 1419774766716690, 805677984380077,
+      859228993502513 },
+    { 1200766035879111, 20142053207432, 1465634435977050, 1645256912097844,
+      295121984874596 } },
+  { { 840667168783746, 1312608060198509, 776870283148400, 1075154568012366,
+      854635716137510 },
+    { 1158364557988615, 198505159720879, 999240510152716, 1600323827360155,
+      1548592852005424 },
+    { 1683898846916029, 599049421303413, 2156521143395365, 1494583872554235,
+      1903731724757592 } },
+  { { 225486109233311, 1623280468268576, 437196568669121, 827453217924470,
+      2157708242265566 },
+    { 1192227212115258, 498539944361030, 263752475688523, 579080491710784,
+      2236701670508601 },
+    { 572814692658904, 1860980403963467, 1851165734723330, 2207274584458880,
+      136691999025165 } },
+  { { 1016024589212349, 671189699471614, 915048910545071, 1252151770745375,
+      1408856916619501 },
+    { 899094999422111, 1690569336703298, 530827882666135, 1279126318096501,
+      2170814878890355 },
+    { 1650877085835809, 876125378013113, 1175268185324653, 1795870293283459,
+      127767380222835 } },
+  { { 1374534857340329, 1573859028339200, 2027769008084218, 505100696667185,
+      387307615336841 },
+    { 269991632725554, 247842673342264, 988974896985511, 285854979020884,
+      2023447196879447 },
+    { 32970624534563, 1133195452111955, 1256593989183571, 559557926477248,
+      100726966567313 } },
+  { { 262719094142449, 128161468289857, 1945382062951667, 1313593946818107,
+      945391560938528 },
+    { 1383256963128002, 575508289398811, 1259232793071878, 1445828096005993,
+      2177106429090967 },
+    { 4415778886408, 1472575706708803, 1349277533929779, 530609720387635,
+      1767377403378303 } },
+  { { 1493291910116345, 307621254484620, 530476338277911, 1882177935272528,
+      7480229015587 },
+    { 789715069283211, 1626562995090874, 1808645713672851, 1219037920000109,
+      39018355666108 },
+    { 885680845080799, 157254019136032, 963355162876364, 278894211123620,
+      1146829277328418 } },
+  { { 361140471743533, 1813711473181081, 287411563928141, 1541939354841946,
+      1062345439569751 },
+    { 110925070640055, 1419598564803663, 1081047270469559, 1660941093165085,
+      836148481326580 },
+    { 483783992297363, 428081765003686, 1071664197596757, 478647729401842,
+      112533339017856 } },
+  { { 1735718747031557, 1248237894295956, 1204753118328107, 976066523550493,
+      65943769534592 },
+    { 1060098822528990, 1586825862073490, 212301317240126, 1975302711403555,
+      666724059764335 },
+    { 1091990273418756, 1572899409348578, 80968014455247, 306009358661350,
+      1520450739132526 } }
+},
+{ /* 2/51 */
+  { { 1982622644432056, 2014393600336956, 128909208804214, 1617792623929191,
+      105294281913815 },
+    { 980234343912898, 1712256739246056, 588935272190264, 204298813091998,
+      841798321043288 },
+    { 197561292938973, 454817274782871, 1963754960082318, 2113372252160468,
+      971377527342673 } },
+  { { 794524995833413, 1849907304548286, 53348672473145, 1272368559505217,
+      1147304168324779 },
+    { 1504846112759364, 1203096289004681, 562139421471418, 274333017451844,
+      1284344053775441 },
+    { 483048732424432, 2116063063343382, 30120189902313, 292451576741007,
+      1156379271702225 } },
+  { { 748123900738723, 2239140288387656, 322477057520882, 393173627734548,
+      1290933190145309 },
+    { 106518640742844, 984674612580210, 300810941301077, 1847778052863102,
+      1252302570260833 },
+    { 2218076336525385, 339947754397137, 1735892619490, 1441988709036711,
+      932991353908008 } },
+  { { 423177393666002, 81745418621691, 2028971153113313, 476357540333955,
+      1525930694244524 },
+    { 2111527632783832, 450040158835276, 2024085682500627, 1804656400081649,
+      1628769314539400 },
+    { 1435691822393684, 1850026012837208, 2218717487026642, 81859254010196,
+      244808221751742 } },
+  { { 240926297106744, 1484603468873016, 211374054712375, 2174528716017124,
+      2102319798003376 },
+    { 201490184422996, 1430226075823072, 1590438952458810, 1043100298986572,
+      996894416545175 },
+    { 472944491312913, 1384790305004554, 1778189765345105, 1598862570437896,
+      213614412209990 } },
+  { { 716669116169929, 1188055609443829, 1393721681141128, 1973577243912927,
+      1619241114669502 },
+    { 1143996060716970, 875276423664526, 978750810123940, 1496005210694645,
+      1796311493993286 },
+    { 689732974960969, 1149694494797763, 34666016056848, 998690978315409,
+      1354271921124160 } },
+  { { 2106273162427187, 252812780214586, 990368180146863, 303666997649525,
+      598398948476041 },
+    { 1732812508157850, 1938646508379112, 1178555870966108, 1668799299728871,
+      1682686212203884 },
+    { 1317989739078862, 2091808081627199, 2131778561189098, 1093597680131246,
+      667689068451005 } },
+  { { 821837003520378, 1758499246064311, 611427618116979, 1826926617406750,
+      190751450672812 },
+    { 1899219292317099, 301143383160140, 1505423608269154, 262436526053886,
+      1603944942225467 },
+    { 1428688544729295, 109069749881410, 270830364539996, 1755181768867140,
+      162349670944771 } },
+  { { 413697308896272, 699134461586886, 711015030907047, 1299876542002,
+      832305981626214 },
+    { 565499889088674, 751683022690201, 1153353920866673, 479317048114822,
+      1114414346729200 },
+    { 952340031139928, 2138102993568440, 1606889213039914, 166919511679670,
+      717893816202340 } },
+  { { 518843098730077, 691570479886707, 1060582056459323, 428039850528040,
+      2034179537060677 },
+    { 2056597642290698, 1046561792437087, 984312131004873, 966661265733746,
+      1765752713684574 },
+    { 1986058137797378, 1434580626693337, 966814340967020, 502425303678510,
+      1066330051859875 } },
+  { { 682288735387347, 307964577169723, 1297694910860965, 65014380107452,
+      1099823476578138 },
+    { 1827631150975132, 1045479367173851, 1999947219314874, 2196955488651286,
+      730377382901712 },
+    { 1623598009048187, 1014844876644353, 871714129530196, 813891329549000,
+      507587707143124 } },
+  { { 387321772446342, 157157592651549, 1734448286334816, 737995238873311,
+      2164082093074358 },
+    { 138427770525630, 1006458583514274, 50156603826175, 564841532066850,
+      1867325910960689 },
+    { 309881142350067, 2106019349943259, 816133263871674, 2018031260992166,
+      1563425406132832 } },
+  { { 683676082606588, 949275451828816, 2120840305454211, 444385807761591,
+      387195881600984 },
+    { 645200600588590, 562546169747253, 156186764608191, 2235471020771491,
+      273215864888271 },
+    { 1174467518774776, 1720687219579664, 1460314689686527, 1234315554419367,
+      10342280797801 } },
+  { { 636266545979769, 1196678303499110, 1544042804952052, 390348891242074,
+      2154007392837602 },
+    { 1639688611092348, 1650093789575836, 1655732950498695, 740816158202830,
+      660499420339501 },
+    { 119472839998080, 306976601680874, 1752396185972949, 389264399846114,
+      716403171730209 } },
+  { { 619982547023359, 507151035019806, 1394235460635684, 213108763323576,
+      428287479820651 },
+    { 1218779158586662, 207160811231456, 511838183164909, 1587562924076948,
+      1109498130852034 },
+    { 990348128231819, 2171729958991420, 73723086835884, 1704262857642441,
+      1782896286691103 } },
+  { { 1498799085180043, 1744340656397133, 2064851197592072, 178034001090864,
+      2145324400616904 },
+    { 2143695105244535, 759647590919964, 1665346117918695, 508167339935601,
+      1875842900408800 },
+    { 614788980313577, 1501513053451003, 1472055221710495, 1920317897819127,
+      2208964791748263 } }
+},
+{ /* 3/51 */
+  { { 2174491994328155, 493557282042709, 1350905374864565, 998113744991988,
+      496681585664265 },
+    { 1850443852254769, 1964063521171136, 2156578506765080, 119377851781170,
+      1787528661543958 },
+    { 758760864397232, 1830650226770835, 326981597370189, 1345979301472296,
+      174985669849506 } },
+  { { 928372153029038, 2147692869914564, 1455665844462196, 1986737809425946,
+      185207050258089 },
+    { 137732961814206, 706670923917341, 1387038086865771, 1965643813686352,
+      1384777115696347 },
+    { 481144981981577, 2053319313589856, 2065402289827512, 617954271490316,
+      1106602634668125 } },
+  { { 1875437433957658, 1617511878185885, 1878009732283905, 1058755973096283,
+      398200017432781 },
+    { 1970434957311929, 1386896129031402, 609681707685145, 843163613125979,
+      916711076830513 },
+    { 1880494894034338, 1374139181237352, 982681977590737, 1710999519808102,
+      1184248241977179 } },
+  { { 696298019648792, 893299659040895, 1148636718636009, 26734077349617,
+      2203955659340681 },
+    { 657390353372855, 998499966885562, 991893336905797, 810470207106761,
+      343139804608786 },
+    { 791736669492960, 934767652997115, 824656780392914, 1759463253018643,
+      361530362383518 } },
+  { { 535375765365132, 1422878608802278, 68021047082109, 1582464912868499,
+      1232173894233315 },
+    { 284296053204617, 855664235345070, 871940805497801, 1412729450435868,
+      1588669830681086 },
+    { 707187950581192, 1793846852887323, 573257946855299, 593643176826652,
+      251194478375544 } },
+  { { 2022541353055597, 2094700262587466, 1551008075025686, 242785517418164,
+      695985404963562 },
+    { 1287487199965223, 2215311941380308, 1552928390931986, 1664859529680196,
+      1125004975265243 },
+    { 677434665154918, 989582503122485, 1817429540898386, 1052904935475344,
+      1143826298169798 } },
+  { { 2032085898874916, 1999502460535824, 2211878946721838, 1717538951425795,
+      25238963684847 },
+    { 1347027763819122, 790515692627514, 1991990972087895, 749111478606098,
+      1101994842756802 },
+    { 1103450930338069, 1893633420580656, 82466593766538, 1306217627779933,
+      581876649313912 } },
+  { { 367266328308408, 318431188922404, 695629353755355, 634085657580832,
+      24581612564426 },
+    { 773360688841258, 1815381330538070, 363773437667376, 539629987070205,
+      783280434248437 },
+    { 180820816194166, 168937968377394, 748416242794470, 1227281252254508,
+      1567587861004268 } },
+  { { 636028728945192, 1384851252231089, 339652763125897, 1303125056841675,
+      2241845271515270 },
+    { 982667105625590, 132832369845929, 806869211230737, 2143823895787617,
+      1826028659254127 },
+    { 849884991451624, 846723706852795, 1430613802239687, 1897150688452042,
+      1247437200949526 } },
+  { { 478775558583645, 2062896624554807, 699391259285399, 358099408427873,
+      1277310261461761 },
+    { 1984740906540026, 1079164179400229, 1056021349262661, 1659958556483663,
+      1088529069025527 },
+    { 580736401511151, 1842931091388998, 1177201471228238, 2075460256527244,
+      1301133425678027 } },
+  { { 187079263568398, 1768993979764876, 2102218224368848, 266112661877437,
+      1856565871329382 },
+    { 1628380013699538, 40676091760986, 1320326802400125, 2105351193023164,
+      1802049661464249 },
+    { 1455007964233644, 1636190310665153, 587563637713814, 906409705031477,
+      902865747218989 } },
+  { { 1515728832059182, 1575261009617579, 1510246567196186, 191078022609704,
+      116661716289141 },
+    { 1295295738269652, 1714742313707026, 545583042462581, 2034411676262552,
+      1513248090013606 },
+    { 230710545179830, 30821514358353, 760704303452229, 390668103790604,
+      573437871383156 } },
+  { { 815666701188600, 897174761262953, 1255870352179472, 921522641997344,
+      741432461362850 },
+    { 1847053567789622, 1243768099179651, 554243961120851, 543238479662424,
+      1155754349577110 },
+    { 271953687299172, 1053700454775349, 1842241169234503, 1803894685651650,
+      2194057385392457 } },
+  { { 1169380107545646, 263167233745614, 2022901299054448, 819900753251120,
+      2023898464874585 },
+    { 2102254323485823, 1570832666216754, 34696906544624, 1993213739807337,
+      70638552271463 },
+    { 894132856735058, 548675863558441, 845349339503395, 1942269668326667,
+      1615682209874691 } },
+  { { 746834040971754, 1454666991928854, 543992257392188, 1741052521185956,
+      212328333075878 },
+    { 1244461856460103, 1222272511014731, 2149147927016991, 2171969239114070,
+      1558723445520511 },
+    { 683178461396743, 1469941068971309, 1184116489130658, 334805620619242,
+      1376712205834911 } },
+  { { 1287670217537834, 1222355136884920, 1846481788678694, 1150426571265110,
+      1613523400722047 },
+    { 793388516527298, 1315457083650035, 1972286999342417, 1901825953052455,
+      338269477222410 },
+    { 550201530671806, 778605267108140, 2063911101902983, 115500557286349,
+      2041641272971022 } }
+},
+{ /* 4/51 */
+  { { 1907837041515237, 898421797873440, 1363421772307007, 1869148099628409,
+      252053503603382 },
+    { 1983475287633675, 383067298392598, 1529372645239762, 271237723417042,
+      16306006127885 },
+    { 45902352975738, 1246446699820833, 173320410042641, 1542230462600972,
+      692910725375140 } },
+  { { 710084928405467, 2105676789486896, 168843193799662, 353334820683649,
+      1050869817514446 },
+    { 2234556940968142, 508383103687203, 548677296961294, 1801756227307155,
+      763581134184080 },
+    { 2191680341805656, 1972509245077282, 981795995975654, 852454486043614,
+      1189735660434765 } },
+  { { 1743977233997800, 1581920097003352, 192244940755923, 2232313400412572,
+      1420975603500953 },
+    { 394331370968199, 375506683250477, 178987122837126, 1628597680090539,
+      1981626777721129 },
+    { 1931343025077052, 1393738210614177, 622857924319466, 1123524882306454,
+      1963513295012502 } },
+  { { 1850504730697909, 2129879659168370, 2011448898092861, 2090154061858281,
+      1857166627539261 },
+    { 93122640069162, 80390620181922, 904913824687012, 878714325670358,
+      2009239140681625 },
+    { 1509035496076582, 1583601071466027, 421912810565136, 1678479534084506,
+      2033502297510813 } },
+  { { 2238137325796934, 1165391281982950, 2048774700033766, 1309041739154703,
+      952882074105884 },
+    { 648683464284688, 918118399351936, 1745356360731796, 498388366566450,
+      2218312233818996 },
+    { 520151332809519, 1588829471961614, 2166353389460390, 404024831468766,
+      1335244071323823 } },
+  { { 276674675630644, 2071299735249834, 367425156502024, 1019665374394195,
+      1519932762444250 },
+    { 140650035965992, 4102126210825, 1340382612618316, 1431330732152485,
+      95392378361840 },
+    { 1935180256227856, 250757393177447, 1959439731378182, 1297506762666169,
+      575184640324100 } },
+  { { 1312014106178185, 1486712601904121, 727281996805526, 1807789883906315,
+      1294755680282130 },
+    { 1746208083129163, 286040119208595, 923407701729416, 1058134233102422,
+      2156333962869932 },
+    { 1438068615152094, 34949160848567, 1911746456436447, 1412684293826264,
+      1046374507505090 } },
+  { { 1493476678908327, 1067355251760666, 2088667670293412, 1347426012722422,
+      874958688794590 },
+    { 1106398809275628, 1328345218773061, 1782306826891988, 2161245407418976,
+      674877440657824 },
+    { 1428599160764785, 602821281250279, 1877258833313507, 333285098655770,
+      740310036947361 } },
+  { { 317431275767464, 1518352325643055, 1017739272243784, 131225281369735,
+      2248498609425138 },
+    { 2185938567848735, 7830587710417, 120201083722985, 1606359356887502,
+      1540314436818236 },
+    { 375535123602711, 924645774628115, 2045840727994073, 766250909414083,
+      1069698092749769 } },
+  { { 1648059230526694, 806437617638909, 1669265990252614, 1557023953019450,
+      1861135005644936 },
+    { 2183494317018394, 431280190007147, 1346280639008465, 2144569274614585,
+      1690834549380148 },
+    { 1352954153117419, 632457759471481, 85028188501619, 1852310027888311,
+      1569233778435479 } },
+  { { 1177033227220429, 1414982090591775, 1722841418062421, 980376562317675,
+      1625133154241834 },
+    { 491008111856233, 1298090237777443, 98870311764798, 759375037494073,
+      1325940420401793 },
+    { 478074309368979, 623121553345246, 885068774570210, 117698677138481,
+      109006840646140 } },
+  { { 1476961150268616, 69354429918369, 737795879830107, 1157931145550899,
+      2062873179003704 },
+    { 976783963761511, 1433695152478636, 1608095770825631, 1880765678109962,
+      1350718651958898 },
+    { 1329749333731727, 46254713998516, 373767480531871, 1933047124368118,
+      430092326122748 } },
+  { { 231642736627077, 1364013097423553, 606627474627588, 2135393495237611,
+      596254727540093 },
+    { 1816819588730494, 1703996634030255, 1472778532685586, 2085732496367231,
+      2000652244807656 },
+    { 8959488931169, 1768025271694380, 2157573235225770, 292082063715064,
+      330646837880843 } },
+  { { 1682783588724042, 399675063705792, 965357158907407, 1910483514645702,
+      1644451034905796 },
+    { 625421168776264, 1072313529331098, 140084527136792, 549153666664274,
+      124282572287672 },
+    { 976078747227308, 1952905065031031, 949292862704054, 1492592732072346,
+      1010921457352162 } },
+  { { 712043135351088, 1110443523197924, 118666337002710, 2051405852060770,
+      1998735788124574 },
+    { 1754610701142467, 2115564038671618, 856374256959303, 1148042632707004,
+      1399605648276789 },
+    { 629291283140720, 1484410172308977, 1230690465849055, 1563468011476927,
+      1425159147311735 } },
+  { { 717255318455100, 519313764361315, 2080406977303708, 541981206705521,
+      774328150311600 },
+    { 261715221532238, 1795354330069993, 1496878026850283, 499739720521052,
+      389031152673770 },
+    { 1997217696294013, 1717306351628065, 1684313917746180, 1644426076011410,
+      1857378133465451 } }
+},
+{ /* 5/51 */
+  { { 1475434724792648, 76931896285979, 1116729029771667, 2002544139318042,
+      725547833803938 },
+    { 2022306639183567, 726296063571875, 315345054448644, 1058733329149221,
+      1448201136060677 },
+    { 1710065158525665, 1895094923036397, 123988286168546, 1145519900776355,
+      1607510767693874 } },
+  { { 1199690223111956, 24028135822341, 66638289244341, 57626156285975,
+      565093967979607 },
+    { 876926774220824, 554618976488214, 1012056309841565, 839961821554611,
+      1414499340307677 },
+    { 703047626104145, 1266841406201770, 165556500219173, 486991595001879,
+      1011325891650656 } },
+  { { 333403773039279, 295772542452938, 1693106465353610, 912330357530760,
+      471235657950362 },
+    { 1811196219982022, 1068969825533602, 289602974833439, 1988956043611592,
+      863562343398367 },
+    { 906282429780072, 2108672665779781, 432396390473936, 150625823801893,
+      1708930497638539 } },
+  { { 643355106415761, 290186807495774, 2013561737429023, 319648069511546,
+      393736678496162 },
+    { 129358342392716, 1932811617704777, 1176749390799681, 398040349861790,
+      1170779668090425 },
+    { 2051980782668029, 121859921510665, 2048329875753063, 1235229850149665,
+      519062146124755 } },
+  { { 1440754265571108, 465972815569460, 600149133151174, 1137683900246312,
+      1448786922664579 },
+    { 1194080495408038, 1724766131896954, 357617096160339, 199269676118399,
+      1048889462977820 },
+    { 843777949621211, 1435525643946674, 1087149831109219, 1794919173070415,
+      1112222323032617 } },
+  { { 1797316281488746, 601251404322945, 874408124299499, 559679760249258,
+      810020000304392 },
+    { 125973023394412, 979391956083768, 522519324327198, 1134484488854748,
+      1931292049093510 },
+    { 1673853233469462, 2069508754540826, 444570721431342, 318669192295723,
+      1286647860911061 } },
+  { { 963223637080381, 1989745848107068, 65884033921047, 2073505048594829,
+      792770882411102 },
+    { 90471516569000, 1780773393683549, 1334842241121198, 381480574597115,
+      1952885591463539 },
+    { 213368529611304, 716996641453362, 1913278462832177, 1585475497182388,
+      563601091454134 } },
+  { { 622985803843745, 1037465406252873, 1045087237459432, 35039786059068,
+      786748793374779 },
+    { 1081639936085048, 107037096524550, 982783085397386, 1478794236122441,
+      1973445033407428 },
+    { 1152063960223905, 1495207756023516, 403624329924470, 288757773501508,
+      634701074033280 } },
+  { { 1146714648966436, 1736884619853758, 1137119250120509, 289483142749028,
+      1905006024585388 },
+    { 906855327812529, 642534159985490, 1448725793966263, 1409372267263616,
+      23235069726583 },
+    { 630536255216206, 448792556322981, 999546564398571, 2201499868232868,
+      2058696946443665 } },
+  { { 1686313364516310, 1525043008380582, 557409512191975, 1949487746825733,
+      744667855996420 },
+    { 20896299197186, 2204082234627731, 586139556524943, 1835427056691776,
+      1191168418772840 },
+    { 1488766318587308, 2134780114150108, 1584665245700253, 1889046363710331,
+      642295386055023 } },
+  { { 1170000117930998, 86629400279402, 186453193056974, 22917348040720,
+      2188532598900378 },
+    { 1660382203460649, 828090351562537, 316684839499235, 174267732700391,
+      1173399140165963 },
+    { 400717035071738, 1767061864165625, 548472698004617, 845648529513110,
+      1236176914177758 } },
+  { { 306504739482714, 131129580948784, 1188582988867227, 121259636959491,
+      1579085558468582 },
+    { 584445447347277, 2113075575078619, 1323703165619476, 1045124984644658,
+      817237135318780 },
+    { 754119005237796, 1781758432514314, 1857276939288138, 702232457427167,
+      1671669511275682 } },
+  { { 2043759687134852, 375656275012636, 1946306055776892, 1278122714525299,
+      379365668519913 },
+    { 891679608980187, 542046045421000, 1723893827854749, 485189219508440,
+      2003009801691499 },
+    { 827526310881880, 2133423593952591, 1303395942535937, 1377681747843599,
+      1915766390697690 } },
+  { { 100304725077105, 778133267768760, 185591179781839, 1720120180532186,
+      200972146004995 },
+    { 117807518331070, 594339795149041, 1903050482767519, 1551851665273013,
+      1650926338407147 },
+    { 134811647700634, 1909225957325842, 2030952923637560, 672953953578339,
+      1293637987676175 } },
+  { { 1301086011747522, 1173903735680550, 1961578900040616, 1722549265034432,
+      1031529366162483 },
+    { 1919487049822927, 720248474557629, 96063072088940, 2055622535812484,
+      979705414397053 },
+    { 1462484838637863, 1567140525974954, 488765569606958, 1942197883263577,
+      628161040649752 } },
+  { { 666083887617405, 673285785424434, 1762910413161601, 912132719741983,
+      462281505628903 },
+    { 2036807708438173, 343296519154494, 203759671035838, 631607941505392,
+      1537534416157211 },
+    { 204576686258175, 1916354881141604, 2182213405559566, 836541881049164,
+      1393662576855498 } }
+},
+{ /* 6/51 */
+  { { 471657679736049, 36304457446248, 1889807602666694, 571526543144584,
+      2151183507738315 },
+    { 1320619393211836, 1830783765803799, 733116888584824, 192154761237340,
+      1836129819319417 },
+    { 216379584390389, 359329711860756, 2220840445637019, 1935487238453911,
+      314381139238943 } },
+  { { 1354120322856557, 1315215183190037, 873849392207479, 969776210885688,
+      1552605391252884 },
+    { 62769891776663, 1685142666023085, 443051725399699, 1094137944849531,
+      1786990183014737 },
+    { 758252632702114, 914226082256766, 434171717412081, 779505540917105,
+      51590353584795 } },
+  { { 411808451074640, 2105855808111832, 1544120735347360, 1337192426203247,
+      554754518107071 },
+    { 1425492357109559, 865850649486344, 215639866084739, 2110361447395184,
+      1214036906704351 },
+    { 2036310356419974, 1862941437683537, 2122628002305950, 427826430955887,
+      291402007632220 } },
+  { { 1608170971973096, 415809060360428, 1350468408164766, 2038620059057678,
+      1026904485989112 },
+    { 1837656083115103, 1510134048812070, 906263674192061, 1821064197805734,
+      565375124676301 },
+    { 578027192365650, 2034800251375322, 2128954087207123, 478816193810521,
+      2196171989962750 } },
+  { { 486799646208464, 1954741746371391, 599244162298817, 764911182067923,
+      1119314483065209 },
+    { 917617711079428, 2000908020759071, 67062208032578, 269886536216889,
+      794102734522411 },
+    { 1659547183874312, 1160992046637689, 115862046651144, 721750944787551,
+      553639199252871 } },
+  { { 222649147765230, 1244342055433210, 260212389089708, 750651607773942,
+      1416930622993378 },
+    { 978700433517105, 661498765597157, 923796644390494, 425042672855163,
+      1161006472261563 },
+    { 2052192104527388, 1670439396947783, 1365143255754144, 321214057777507,
+      1623893732838030 } },
+  { { 766485616863355, 185846422186304, 622697389167409, 1397282616236871,
+      1403664093647337 },
+    { 2187445915863115, 1567887873700238, 1490192810453810, 1229276594560986,
+      1628358773775064 },
+    { 1667454255937431, 1466524613972708, 1991366627974407, 1283865324159873,
+      951057717299277 } },
+  { { 1633188840273139, 852787172373708, 1548762607215796, 1266275218902681,
+      1107218203325133 },
+    { 462189358480054, 1784816734159228, 1611334301651368, 1303938263943540,
+      707589560319424 },
+    { 1038829280972848, 38176604650029, 753193246598573, 1136076426528122,
+      595709990562434 } },
+  { { 1179291724021934, 2135086029559761, 1310959933924188, 1038624650757648,
+      1397826829060106 },
+    { 177430163044496, 567245755530253, 373303234063068, 761118347856525,
+      2052772390285268 },
+    { 329210437128923, 534894741393748, 1127953928312911, 1202525317028321,
+      2152490543503365 } },
+  { { 2102214505332835, 1838940233011699, 251609668505654, 290942303809962,
+      1848549969618808 },
+    { 747501458420425, 954222199322869, 530194071067823, 1352800688468148,
+      1359323968428652 },
+    { 745974963505604, 2182623307274379, 929454982287594, 1928935065380062,
+      6620650377507 } },
+  { { 1267125746220324, 157079328970999, 1435198339381366, 333919294520225,
+      2157107865890357 },
+    { 54230113346551, 1548444340485407, 1502990405125363, 1383293293731590,
+      2097326762253969 },
+    { 1841606478231627, 361961350929299, 1230707688051911, 1872042866337718,
+      1800439317692451 } },
+  { { 1408451820859834, 2194984964010833, 2198361797561729, 1061962440055713,
+      1645147963442934 },
+    { 4701053362120, 1647641066302348, 1047553002242085, 1923635013395977,
+      206970314902065 },
+    { 1750479161778571, 1362553355169293, 1891721260220598, 966109370862782,
+      1024913988299801 } },
+  { { 1755814380100345, 987947382040385, 2045909051968813, 596166711338152,
+      590415265120010 },
+    { 1483939481037711, 1699005245098844, 947117724797150, 208511819939529,
+      882149497375655 },
+    { 670127973180808, 1909319231742221, 159615638555729, 404115291023205,
+      1019209553440563 } },
+  { { 462155829227911, 1975377407615080, 2042223714016128, 2246515598358375,
+      720540772935175 },
+    { 747027490450779, 331875678733161, 191832232451572, 1856548616787027,
+      1959559821319422 },
+    { 2138327645973426, 2065563746138428, 1458791106909595, 1224144005653688,
+      630204198065225 } },
+  { { 119992929148774, 1313934413100793, 1233909198950557, 1173318763689962,
+      1057047143342356 },
+    { 1726614263927506, 500595945482013, 1786986978415014, 1328040149744767,
+      1515110674745662 },
+    { 845119277029676, 546256359445244, 1053209421632273, 1597525808988209,
+      1321443535664119 } },
+  { { 212699049131723, 1117950018299775, 1873945661751056, 1403802921984058,
+      130896082652698 },
+    { 636808533673210, 1262201711667560, 390951380330599, 1663420692697294,
+      561951321757406 },
+    { 520731594438141, 1446301499955692, 273753264629267, 1565101517999256,
+      1019411827004672 } }
+},
+{ /* 7/51 */
+  { { 1210746697896478, 1416608304244708, 686487477217856, 1245131191434135,
+      1051238336855737 },
+    { 1135604073198207, 1683322080485474, 769147804376683, 2086688130589414,
+      900445683120379 },
+    { 1971518477615628, 401909519527336, 448627091057375, 1409486868273821,
+      1214789035034363 } },
+  { { 1773953341907125, 1826809791300708, 924874532383668, 712490100943736,
+      748251880846901 },
+    { 1773696272644354, 524584715796245, 2052807431577622, 1474261915840483,
+      1472344085384396 },
+    { 1048828262296911, 626018299495748, 1536855937015065, 557005099579827,
+      205000143299648 } },
+  { { 1155532475764029, 2100842183632111, 1791225745332700, 1529431845274299,
+      1128121046535644 },
+    { 255135376055572, 254647348092493, 763486043071444, 2214690023864374,
+      2130062642809226 },
+    { 292640807492102, 639646902080903, 157406048827411, 608915509236498,
+      986662864280276 } },
+  { { 941815577996700, 1930911276112812, 749821254542917, 1967675522206375,
+      892948220720651 },
+    { 1434849833149473, 1179935727179617, 1288878261580880, 251520331051845,
+      2174778140013271 },
+    { 39364207708032, 54077643340559, 47072300438335, 484490203728205,
+      330170579231628 } },
+  { { 1801260472422000, 1544316045474966, 859021290636787, 556770590022561,
+      1932140949245525 },
+    { 1791008249282529, 545812608548139, 1104797022311712, 1342491095840281,
+      1156480524859204 },
+    { 1792077131003860, 423430027635793, 598547944460771, 361841190168784,
+      2230764044728674 } },
+  { { 1020447780607298, 551245056565558, 1618835409581890, 673850310162293,
+      354159319190084 },
+    { 199234941368169, 1039878917333290, 1138631272437872, 1506846618426377,
+      651537961859356 },
+    { 1190283817822151, 29815862110548, 1401771831527381, 1814017508050437,
+      751331585591881 } },
+  { { 161795823096496, 1358472309856448, 1250658958058977, 745471964803795,
+      700837728529175 },
+    { 1886094636928913, 1141613531684153, 103482642010629, 377873957111193,
+      694561423132243 },
+    { 2225288638884818, 158161014647817, 414239451698911, 616619259684595,
+      1962279248176915 } },
+  { { 2159866514586362, 1758376548473728, 1635569740383557, 192110938352718,
+      2023235829583534 },
+    { 605995978939884, 48218004293082, 461040418591673, 316385510440522,
+      1980476765721118 },
+    { 535848012622913, 543536404720769, 149076814975879, 1567757637416350,
+      1002851193383852 } },
+  { { 1151107251996593, 190558298763313, 1451584030877450, 1519046894877692,
+      1163177657622647 },
+    { 1140444251514251, 979071431373647, 2123119481717781, 1813841221706803,
+      224721386516754 },
+    { 775427781113142, 1260268903756668, 1554583528708290, 1210001275098448,
+      1685221587744667 } },
+  { { 850247344591371, 1642810784021239, 1974409276090170, 1605973976114297,
+      1350011424543020 },
+    { 1563762061819676, 483704726889726, 378890223689177, 614454628872887,
+      138207457619482 },
+    { 66796032196982, 83108349878636, 1058512765854606, 355785880766958,
+      2173660513649027 } },
+  { { 1988873660721477, 296841230836924, 1981748649380842, 66128832254490,
+      377280377235720 },
+    { 1739236265734990, 2232805298050351, 793456329927470, 1004592774968139,
+      1376854328189140 },
+    { 115821819848166, 504179904016130, 1929415808148264, 1432907047550913,
+      301402970227759 } },
+  { { 1941123290917747, 65177497691743, 661963569507333, 1172954226263396,
+      1951085968954154 },
+    { 633834845666480, 1266075508915353, 932911917033228, 2013039593891141,
+      2014375254042349 },
+    { 1331723279107642, 360406964548232, 602431788387748, 1292398959539176,
+      347247628588850 } },
+  { { 2050132114884794, 2149788493376629, 18341640349270, 190826182390552,
+      1263036912997997 },
+    { 286537079202750, 916369382345604, 704409199864226, 340323675217354,
+      1713429768990445 },
+    { 1894758163087282, 1985783918346608, 2142284172376198, 992628672079242,
+      475448388474032 } },
+  { { 2170226002806049, 1739335733478471, 1765672611311764, 666860341980082,
+      542065866111114 },
+    { 928917294762421, 827086505179749, 79913563808991, 1363419744736215,
+      1159465025606665 },
+    { 245885669910192, 255454579697350, 869246923980317, 823008017430135,
+      2047987637517532 } },
+  { { 441523306859797, 214508308941826, 1324885669151393, 1355615302775131,
+      228744777191528 },
+    { 122387717714839, 31668706494262, 408369330617199, 1622623010905133,
+      68972153839925 },
+    { 465532156639319, 1751716206501322, 476285572172828, 478238859209423,
+      252968728557214 } },
+  { { 1363748633264621, 134440781639129, 1969460953567930, 687618113673021,
+      1831662708850446 },
+    { 484597594561270, 1872466346130086, 1773863188829220, 2151270062723810,
+      574178361260864 },
+    { 1325588019367749, 1763566216507756, 445592400440775, 1009027711126237,
+      1471076108623188 } }
+},
+{ /* 8/51 */
+  { { 1364039144731711, 1897497433586190, 2203097701135459, 145461396811251,
+      1349844460790699 },
+    { 1045230323257973, 818206601145807, 630513189076103, 1672046528998132,
+      807204017562437 },
+    { 439961968385997, 386362664488986, 1382706320807688, 309894000125359,
+      2207801346498567 } },
+  { { 1229004686397588, 920643968530863, 123975893911178, 681423993215777,
+      1400559197080973 },
+    { 2003766096898049, 170074059235165, 1141124258967971, 1485419893480973,
+      1573762821028725 },
+    { 729905708611432, 1270323270673202, 123353058984288, 426460209632942,
+      2195574535456672 } },
+  { { 1271140255321235, 2044363183174497, 52125387634689, 1445120246694705,
+      942541986339084 },
+    { 1761608437466135, 583360847526804, 1586706389685493, 2157056599579261,
+      1170692369685772 },
+    { 871476219910823, 1878769545097794, 2241832391238412, 548957640601001,
+      690047440233174 } },
+  { { 297194732135507, 1366347803776820, 1301185512245601, 561849853336294,
+      1533554921345731 },
+    { 999628998628371, 1132836708493400, 2084741674517453, 469343353015612,
+      678782988708035 },
+    { 2189427607417022, 699801937082607, 412764402319267, 1478091893643349,
+      2244675696854460 } },
+  { { 1712292055966563, 204413590624874, 1405738637332841, 408981300829763,
+      861082219276721 },
+    { 508561155940631, 966928475686665, 2236717801150132, 424543858577297,
+      2089272956986143 },
+    { 221245220129925, 1156020201681217, 491145634799213, 542422431960839,
+      828100817819207 } },
+  { { 153756971240384, 1299874139923977, 393099165260502, 1058234455773022,
+      996989038681183 },
+    { 559086812798481, 573177704212711, 1629737083816402, 1399819713462595,
+      1646954378266038 },
+    { 1887963056288059, 228507035730124, 1468368348640282, 930557653420194,
+      613513962454686 } },
+  { { 1224529808187553, 1577022856702685, 2206946542980843, 625883007765001,
+      279930793512158 },
+    { 1076287717051609, 1114455570543035, 187297059715481, 250446884292121,
+      1885187512550540 },
+    { 902497362940219, 76749815795675, 1657927525633846, 1420238379745202,
+      1340321636548352 } },
+  { { 1129576631190784, 1281994010027327, 996844254743018, 257876363489249,
+      1150850742055018 },
+    { 628740660038789, 1943038498527841, 467786347793886, 1093341428303375,
+      235413859513003 },
+    { 237425418909360, 469614029179605, 1512389769174935, 1241726368345357,
+      441602891065214 } },
+  { { 256269894881655, 731087473525590, 1712829089863355, 1739545432690564,
+      1853100260794477 },
+    { 762634428407485, 914699280277969, 1907787519177201, 980988034818443,
+      1758095138401930 },
+    { 4642168584761, 1314096799362798, 1620739012635580, 444075187404753,
+      76135520441225 } },
+  { { 1717340294466846, 894010493775439, 1904170181110299, 1698314560575378,
+      2248427553137503 },
+    { 664232887435505, 906405014034017, 1557824336159424, 270380422518437,
+      1526479053144758 },
+    { 1356583144121446, 1439603152129038, 880464721166116, 426511648446184,
+      1044401386572766 } },
+  { { 1430891268582688, 1935676112917302, 918476809294643, 624233316991390,
+      1596266630249200 },
+    { 1575473650472430, 967253993350338, 1983977008222547, 928647195161666,
+      170861031434441 },
+    { 1484505136430423, 343818915658679, 1066931341976591, 1574952097402529,
+      895157643469052 } },
+  { { 2193735258244385, 13942854467965, 549801847492973, 1573679250261670,
+      2218164822512395 },
+    { 2132610855338939, 314844271876603, 2026649627971043, 1205053707864054,
+      2037006012910569 },
+    { 125908919015544, 908539856510216, 254196493329521, 1841783557943867,
+      1826956209112337 } },
+  { { 1218465765165773, 1222399589933778, 1897798290509556, 56200133600723,
+      278637912813060 },
+    { 1764048760908459, 870662304967533, 255906313198924, 1183161537014186,
+      1158717372378153 },
+    { 1352017428769842, 1226345478088737, 1834808987089176, 171935268241134,
+      1252599135760918 } },
+  { { 269241043449631, 1713401415896622, 808940841959443, 2228155591500883,
+      21723429550182 },
+    { 2140114154635772, 1139746460367841, 1009078681939033, 1841964102409991,
+      1982139153156902 },
+    { 994025955714788, 1395495501299355, 1717525291885154, 64780760930213,
+      1492125616744822 } },
+  { { 607657959766893, 341003272737447, 761249806099562, 2103923803467650,
+      437155965158728 },
+    { 2244771924854810, 1634082933647495, 1913546366257171, 85613129382467,
+      745552826499669 },
+    { 686675614020084, 1129369471718576, 1361332769753183, 814390480194826,
+      1958437091006724 } },
+  { { 1326059070986772, 1683859889439034, 800400358642626, 1553800812119228,
+      1435890639134217 },
+    { 10289322871173, 960938633288362, 54790899094325, 355480603420821,
+      769816521286162 },
+    { 1081752225631401, 201284952113932, 1619339403526661, 1533363030164674,
+      1727571790703503 } }
+},
+{ /* 9/51 */
+  { { 899735975760499, 1741766716299829, 1742063303545331, 2027626928190420,
+      2245203856982753 },
+    { 1954377740831254, 964432157821305, 1474491321949063, 395839918315184,
+      1677872381409569 },
+    { 868012933261061, 1472665613225898, 1744063644616181, 1350305502884983,
+      2227467074628670 } },
+  { { 492643442569612, 1013874505344584, 1972732629285783, 1936827407065469,
+      1830481951704579 },
+    { 1948145815698108, 1342521170841730, 1978080278356424, 1881064851625948,
+      229238155064023 },
+    { 634737804354539, 422989080575800, 1774993942417585, 688011718282303,
+      581542014403477 } },
+  { { 1755760392036140, 2130115351478138, 442625433812754, 2043622709923143,
+      86495244370338 },
+    { 973803294013993, 865469347514382, 1546238264282843, 1531400184873330,
+      852951437390016 },
+    { 1425112218383847, 329346717672590, 378517748485393, 1806152114945447,
+      1211275024279312 } },
+  { { 1973106012015851, 342123586374596, 833516958919696, 2182197879897069,
+      1721403407106648 },
+    { 1234205143570590, 574413568977114, 1646424797106159, 300930903818472,
+      929000726436362 },
+    { 1591076166555979, 849361769125080, 1443799738863429, 166584794343739,
+      1861773413238536 } },
+  { { 1733819728686835, 684225152861985, 1590816041651633, 912011190613861,
+      424957656992120 },
+    { 1046343569036960, 1181018946388025, 1197444220174359, 779977861028534,
+      361004980637985 },
+    { 1319097278964637, 787422552977413, 1599496421811883, 1959379193761008,
+      1506646670818903 } },
+  { { 1127279535151728, 1199265744257977, 1248562495202825, 1868357952639788,
+      917052103965266 },
+    { 1620116409819885, 246216830132318, 854961683956249, 1860864071388168,
+      1885615828395445 },
+    { 25664888255034, 1628004430886188, 1439984389498414, 1961957176184883,
+      182596205772698 } },
+  { { 744798933974786, 449189546044796, 2197501482114022, 906406675813878,
+      454001113235336 },
+    { 444273421790610, 397434073056995, 2171984181358990, 438067423575734,
+      868469711549313 },
+    { 96737353895103, 1534044505139178, 563303281603459, 407703386650348,
+      1821870774469537 } },
+  { { 1736417953058555, 726531315520508, 1833335034432527, 1629442561574747,
+      624418919286085 },
+    { 1960754663920689, 497040957888962, 1909832851283095, 1271432136996826,
+      2219780368020940 },
+    { 1537037379417136, 1358865369268262, 2130838645654099, 828733687040705,
+      1999987652890901 } },
+  { { 2158964910729318, 2004901314229666, 980018796194972, 100719188885551,
+      1440186157139755 },
+    { 689802755676846, 2069990202134550, 2126458970241614, 1811091758315205,
+      1552041063552439 },
+    { 112438190311653, 2121119519595455, 644028794502746, 955202575602677,
+      874854189551533 } },
+  { { 155477257567151, 1568634838280966, 529312882900437, 1190588296074698,
+      1481022522313583 },
+    { 1219341654385047, 17132796384568, 1325504681640191, 1121132058797104,
+      1960516279750702 },
+    { 699463952076452, 1925761146169712, 617634106793881, 1435231602396381,
+      1523703967302775 } },
+  { { 1250370417529715, 2118411204773747, 905041186501779, 666368486995311,
+      46753500207617 },
+    { 931460961847785, 967884926903512, 2206906583753186, 1957218171976475,
+      1235541728117766 },
+    { 896045226852297, 2052604386523381, 1050659387530442, 10100149590320,
+      1101774695545689 } },
+  { { 2136624430153181, 1437674197952820, 1713491211007294, 99282253557837,
+      9414831571738 },
+    { 1996520486777758, 675677205914931, 1742710022497809, 1508075894749580,
+      75741788237102 },
+    { 1028388570189513, 300526531139751, 450640933869621, 364899501149005,
+      1282156284386085 } },
+  { { 1216189810424851, 519698428392851, 2242793958294207, 891845536181600,
+      1412209903430995 },
+    { 1978257624100252, 2030456126844638, 2131504322176207, 1908850488203401,
+      315255119362804 },
+    { 612278291613364, 1724840778040837, 1027030136661896, 291655903075005,
+      263852768474515 } },
+  { { 1925581767181666, 2080999745670541, 1228697907683208, 1538109352450610,
+      358556328966864 },
+    { 1359733199020856, 207773197942114, 1601507974673311, 1657721553592342,
+      153048738797709 },
+    { 2143279732493188, 1366667000313872, 1315690686647688, 1969904517463196,
+      1739506514826977 } },
+  { { 2075328330686575, 388690718689394, 2073650799065865, 1138649722112755,
+      1774583143250997 },
+    { 1026020678601428, 1001873470463090, 908858922920175, 1716996490414074,
+      1403480915831078 },
+    { 95863430451742, 1492486074176443, 630559426576107, 1417416513809638,
+      957186802535899 } },
+  { { 629042105241814, 1098854999137608, 887281544569320, 1423102019874777,
+      7911258951561 },
+    { 1811562332665373, 1501882019007673, 2213763501088999, 359573079719636,
+      36370565049116 },
+    { 218907117361280, 1209298913016966, 1944312619096112, 1130690631451061,
+      1342327389191701 } }
+},
+{ /* 10/51 */
+  { { 319638829540294, 596282656808406, 2037902696412608, 1557219121643918,
+      341938082688094 },
+    { 1901860206695915, 2004489122065736, 1625847061568236, 973529743399879,
+      2075287685312905 },
+    { 1371853944110545, 1042332820512553, 1949855697918254, 1791195775521505,
+      37487364849293 } },
+  { { 1812471844975748, 1856491995543149, 126579494584102, 1036244859282620,
+      1975108050082550 },
+    { 650623932407995, 1137551288410575, 2125223403615539, 1725658013221271,
+      2134892965117796 },
+    { 522584000310195, 1241762481390450, 1743702789495384, 2227404127826575,
+      1686746002148897 } },
+  { { 2204538589507476, 891043427298747, 199776800605413, 952417190022837,
+      635674663503434 },
+    { 2198333491841156, 555629646782191, 479238297408146, 1907252492795906,
+      2038569943093712 },
+    { 510455031824465, 465163402943305, 2022658124081289, 1881132727821470,
+      31746160856543 } },
+  { { 1171837083014025, 264732902278699, 1770010974323604, 266108208353474,
+      2020794083615322 },
+    { 293218709634113, 1719011489643599, 831619655945737, 1611022286286405,
+      2006064581746788 },
+    { 762321251771152, 1460210191529427, 2248797163104578, 217468651569622,
+      63003536153574 } },
+  { { 1253926392372274, 487954410348947, 105208478723800, 287609073983821,
+      551052366059500 },
+    { 480324482088798, 547821943377221, 1008880811730814, 229616966517108,
+      2187910192957436 },
+    { 382772988420084, 377268858355321, 2014446499231184, 1791684686627115,
+      1858385890274879 } },
+  { { 1468942521262663, 965285477748964, 1357339318615791, 453619687037093,
+      27583008856420 },
+    { 1785441127249196, 1692788790252292, 2030249112109248, 641340745250383,
+      1525476155656051 },
+    { 147617576924232, 750543836338826, 216515763171698, 448683940021842,
+      666426848177047 } },
+  { { 257778042578872, 24608579957679, 1528237364405256, 2008961667970794,
+      1766606190227381 },
+    { 1058899921801710, 83343181050531, 1801405111725810, 114408790349771,
+      709509117086787 },
+    { 1874277793138111, 1626529073509303, 151495790219656, 455240507092903,
+      706271551856999 } },
+  { { 391588043113892, 2202456919563943, 1617888818929289, 694159965511217,
+      2143606811138355 },
+    { 2008058364358132, 1051355690609066, 1659991296428347, 1022293360838405,
+      1042097367448254 },
+    { 719793864170869, 1411477466905009, 1515019021063010, 1483421690183889,
+      1704042941619334 } },
+  { { 1403761197126057, 2078598970957846, 1322929741411900, 1567306659790424,
+      1173285022924932 },
+    { 960589681362441, 706280137808542, 1229199323405406, 1538736872374776,
+      2018028444441884 },
+    { 2197022808271474, 1407143108986688, 1009817116705041, 71531789689040,
+      1896193213410282 } },
+  { { 1697781430640218, 1520304010377028, 781380208437990, 1793414410548913,
+      2166524336512075 },
+    { 565939882927894, 2119253489526995, 1435475806966004, 302446209351656,
+      17168463162684 },
+    { 164417108933475, 604787902585307, 1893481489487087, 942194265644630,
+      1933835561033231 } },
+  { { 1774831837164273, 870369497426874, 974084587952276, 825762959138234,
+      88446696097701 },
+    { 1735923830729967, 663964653130785, 704207531815736, 791502858216208,
+      1884688385386861 },
+    { 2079995305370875, 506117157505057, 1787295940729509, 1211999097803487,
+      2178718943974512 } },
+  { { 517835973347256, 706523709933216, 1537480429839773, 1483278086593314,
+      1378968978067758 },
+    { 783163454514521, 1366624508143284, 1863506003869690, 917979662972397,
+      1583895088313562 },
+    { 1315034452637574, 1172434640681242, 1135533609020364, 253349230877293,
+      161211572823476 } },
+  { { 696598964903212, 1843045426770307, 1415827342374723, 484038355219880,
+      1303557951944390 },
+    { 1616401163666585, 1916649121027360, 517784282068026, 1097139464632440,
+      1923807788916222 },
+    { 459941859277134, 516821055271895, 1926620716890555, 998592915107636,
+      1153917797071778 } },
+  { { 1459464209890149, 1978794890227345, 385000036933387, 789502095080917,
+      1056031385523015 },
+    { 1217063695723907, 336836783652230, 117343635436620, 2222371127823246,
+      1880951187948926 },
+    { 248998074417769, 1966462008064165, 54036384105462, 2047689206076670,
+      2065762857952013 } },
+  { { 57215567913777, 1938282035004120, 2057398012901067, 1439291273533426,
+      1694633904445394 },
+    { 925373380955341, 181534320494844, 802421407686171, 1177141761303107,
+      326024465005379 },
+    { 2146639653517188, 202546770944767, 774949134039784, 631237699522153,
+      449667013680072 } },
+  { { 407608189412637, 2049444491227494, 342891130347629, 1169428941568801,
+      848234126951058 },
+    { 1690850439525075, 1667024303418336, 1749847485823236, 736954918508817,
+      531773443234823 },
+    { 437225545901468, 888271756229202, 903344393515123, 162913205438885,
+      1475178706291532 } }
+},
+{ /* 11/51 */
+  { { 1440929316705148, 1633730452330828, 1405404753609489, 1406118623302575,
+      309924733037947 },
+    { 656250768022145, 564144318086388, 48310283291479, 2142014283110632,
+      1641981030879013 },
+    { 809017030155597, 1831934834657405, 58189812416765, 1517873507099267,
+      889681994437792 } },
+  { { 427904865186312, 1703211129693455, 1585368107547509, 1436984488744336,
+      761188534613978 },
+    { 318101947455002, 248138407995851, 1481904195303927, 309278454311197,
+      1258516760217879 },
+    { 1275068538599310, 513726919533379, 349926553492294, 688428871968420,
+      1702400196000666 } },
+  { { 1391741736667383, 1539557169017641, 1808280841427456, 1437981425758132,
+      1898718897767380 },
+    { 2075108982360364, 640973325323599, 372476703593683, 230562542649108,
+      215528084511708 },
+    { 1378930680297102, 1243716537313950, 1324128019560636, 928196475501216,
+      1498142384634152 } },
+  { { 1061864036265233, 961611260325381, 321859632700838, 1045600629959517,
+      1985130202504038 },
+    { 1558816436882417, 1962896332636523, 1337709822062152, 1501413830776938,
+      294436165831932 },
+    { 818359826554971, 1862173000996177, 626821592884859, 573655738872376,
+      1749691246745455 } },
+  { { 468779731562131, 390992902642432, 237844538681913, 1780041004192148,
+      1792610241809 },
+    { 2037744046827925, 1078012502925066, 901047064158136, 1161677640692116,
+      230004881958239 },
+    { 264646227831106, 2157934925563267, 2242152783987554, 831535537916442,
+      1924401857731517 } },
+  { { 1988022651432119, 1082111498586040, 1834020786104821, 1454826876423687,
+      692929915223122 },
+    { 2146513703733331, 584788900394667, 464965657279958, 2183973639356127,
+      238371159456790 },
+    { 1129007025494441, 2197883144413266, 265142755578169, 971864464758890,
+      1983715884903702 } },
+  { { 1160820864442362, 1741491094861356, 1627176649512763, 393180608810963,
+      2173836023798827 },
+    { 492460754555277, 2067817062510771, 2065234178798150, 468754450531044,
+      1160508557946979 },
+    { 1296921715144121, 1291032766115082, 1747884121754638, 81247291334702,
+      26470981430245 } },
+  { { 1291366624493075, 381456718189114, 1711482489312444, 1815233647702022,
+      892279782992467 },
+    { 444548969917454, 1452286453853356, 2113731441506810, 645188273895859,
+      810317625309512 },
+    { 2242724082797924, 1373354730327868, 1006520110883049, 2147330369940688,
+      1151816104883620 } },
+  { { 1078786750556583, 1578572520135356, 1046631443740668, 1142096308687824,
+      2214533969637220 },
+    { 1437576401967251, 928890353660903, 2062241181271235, 1923772308490773,
+      1545042168116132 },
+    { 917971023994678, 1900273262924059, 2241871012351074, 118866831223644,
+      196029565782397 } },
+  { { 1745720200383796, 1911723143175317, 2056329390702074, 355227174309849,
+      879232794371100 },
+    { 163723479936298, 115424889803150, 1156016391581227, 1894942220753364,
+      1970549419986329 },
+    { 681981452362484, 267208874112496, 1374683991933094, 638600984916117,
+      646178654558546 } },
+  { { 368638201272458, 45044097644339, 733813725299767, 1465603709248656,
+      196905365236037 },
+    { 2135282366752375, 125670436443155, 1072298993769191, 1350522698845098,
+      999127335251656 },
+    { 1797235004950541, 1930980007872440, 2099509783258771, 1786414577956121,
+      556285286141455 } },
+  { { 13378654854251, 106237307029567, 1944412051589651, 1841976767925457,
+      230702819835573 },
+    { 260683893467075, 854060306077237, 913639551980112, 4704576840123,
+      280254810808712 },
+    { 715374893080287, 1173334812210491, 1806524662079626, 1894596008000979,
+      398905715033393 } },
+  { { 227457175093168, 858306258433904, 157637805095090, 1912460578895186,
+      1408035331066913 },
+    { 126946501269675, 1054612320731793, 1796563487477472, 1598502827744950,
+      2195550234021661 },
+    { 2134869456216953, 615433250782500, 1689984105356606, 685805877145831,
+      1137026864379096 } },
+  { { 500026409727661, 1596431288195371, 1420380351989370, 985211561521489,
+      392444930785633 },
+    { 2096421546958141, 1922523000950363, 789831022876840, 427295144688779,
+      320923973161730 },
+    { 1927770723575450, 1485792977512719, 1850996108474547, 551696031508956,
+      2126047405475647 } },
+  { { 1616678621871425, 1801756237368721, 1557948078790206, 324799692714897,
+      1899435197899158 },
+    { 1387822670200332, 822455324978201, 821866340436882, 779746868215715,
+      246123581768695 },
+    { 1925699611317996, 137987304451179, 78944209865830, 651261392676975,
+      366885504542530 } },
+  { { 2112099158080148, 742570803909715, 6484558077432, 1951119898618916,
+      93090382703416 },
+    { 383905201636970, 859946997631870, 855623867637644, 1017125780577795,
+      794250831877809 },
+    { 77571826285752, 999304298101753, 487841111777762, 1038031143212339,
+      339066367948762 } }
+},
+{ /* 12/51 */
+  { { 1179642228804668, 1418657644034850, 675683856213334, 596096446428822,
+      1170437361620647 },
+    { 1511564286472767, 2184358636968286, 1412906036411316, 89284351539568,
+      352068421522218 },
+    { 1907217462504765, 679044428705663, 1371479879514675, 1420793148384765,
+      190685345044087 } },
+  { { 1276705999322783, 1661230352625442, 1205734973860699, 784019563379976,
+      1449546143149561 },
+    { 637296935955637, 450944727568131, 645072163640910, 309713610901635,
+      311189073223217 },
+    { 2213525665395526, 146358659614731, 1573034916169973, 1131167148341295,
+      1194403623212224 } },
+  { { 2105305689409187, 1932040296635725, 307501795091619, 1653053081843051,
+      1246676406522367 },
+    { 782790693528855, 1519731603158914, 2028140081496226, 1275020033363837,
+      2056444369633135 },
+    { 1916484225176, 1896106466807315, 1279953155660650, 1725386140841619,
+      757101416534772 } },
+  { { 2133488547373098, 633134528408434, 1652284377802153, 2035540453530543,
+      489273649398225 },
+    { 2051614458366870, 728789063070456, 282245488169187, 2178894003553741,
+      1855341936085133 },
+    { 655928016394658, 1087485647128905, 1281789693328119, 2088439151211398,
+      1863153332596984 } },
+  { { 210017655980803, 1811183847825904, 1323101412046938, 1360571080713195,
+      1716626899554003 },
+    { 716543727419056, 2051592790034539, 1445865707531046, 863515409408522,
+      1102874443417899 },
+    { 1790273650925445, 2180187262630477, 28219260774301, 1951582862584504,
+      1059160821201578 } },
+  { { 857134543659225, 571584078624683, 457976954128720, 480578452053593,
+      1695118712507850 },
+    { 1455060305288896, 1678698521692147, 955042089053421, 482480751768889,
+      972076543638923 },
+    { 95538772778706, 1914880923031197, 417513632407841, 1767845086605839,
+      832379724270193 } },
+  { { 1456443406045738, 1909385161475434, 816382632051404, 1426587922914898,
+      2166890266198132 },
+    { 629341497594299, 294953389516334, 1800301282775361, 2224016821184931,
+      924802345871186 },
+    { 393110820654303, 662371396172458, 1370237312917823, 2034119121136113,
+      904928937827 } },
+  { { 1257344135899307, 524694436287172, 1637109398723535, 1801319038042246,
+      2082644998926031 },
+    { 571822557710951, 195833865463720, 1444687327784978, 1429898638089182,
+      1938057576257967 },
+    { 189274223123103, 2188109173279445, 1461570511269332, 151886143484743,
+      1557837550414982 } },
+  { { 1853425141155930, 1562248478016912, 1805828417935850, 1548444252518409,
+      1509442962180566 },
+    { 2113566004905728, 676606596444694, 531774910260309, 1451617262003405,
+      1925547617906272 },
+    { 966697507230426, 1689614203301123, 867370120071235, 563108996765880,
+      1552869095947518 } },
+  { { 428710350733830, 873472483018412, 228735397183971, 464721098622881,
+      1141684153257222 },
+    { 1687012995398915, 758517156051015, 1267223406584338, 389079174105648,
+      1537526322499142 },
+    { 1871952745325912, 144470913279784, 434631777342778, 552837449330893,
+      642852750438644 } },
+  { { 1809358219650842, 87860747263326, 158784625452665, 1286742564054195,
+      1381620064520781 },
+    { 251909128622990, 1402068879946426, 1377262896768859, 993060530359482,
+      2229211226216284 },
+    { 64765075641768, 68764899017819, 1968408548264810, 2037002115471749,
+      211556643344747 } },
+  { { 1049209717975987, 425659265579626, 455526653534993, 9855624744769,
+      710846537165111 },
+    { 1040026214336160, 57029633653833, 228151855733274, 1803649920231128,
+      509157472065208 },
+    { 1579401584164790, 1951017356653076, 1801209077919862, 1153368800641031,
+      1775772413220140 } },
+  { { 547036285871787, 2002468979873229, 1132424890166086, 136604638013560,
+      664387721246095 },
+    { 1304517784822193, 1430651666034031, 1924728018029076, 736369304009705,
+      3004372386002 },
+    { 1947208168676528, 1750536949518976, 835780038339521, 1802624114603814,
+      1867663782159356 } },
+  { { 267867967690637, 1132412577764720, 71131066313735, 1660817657158453,
+      554776769494619 },
+    { 847731813737569, 398133653202307, 931247096073091, 2120348411520248,
+      2124450702434442 },
+    { 1273923691469553, 1862566872300733, 2236121435313308, 274949363314112,
+      477088969758259 } },
+  { { 1965761504739774, 948410112529604, 1470368970845507, 1212419708620855,
+      1953662369491230 },
+    { 1106680482832796, 1563027304892563, 530204689676809, 299800282060962,
+      437037442251865 },
+    { 1946412430894973, 2031215026716789, 1150845535883051, 749273986980949,
+      1433091314912259 } },
+  { { 674994775520533, 266035846330789, 826951213393478, 1405007746162285,
+      1781791018620876 },
+    { 1001412661522686, 348196197067298, 1666614366723946, 888424995032760,
+      580747687801357 },
+    { 1939560076207777, 1409892634407635, 552574736069277, 383854338280405,
+      190706709864139 } }
+},
+{ /* 13/51 */
+  { { 2177087163428741, 1439255351721944, 1208070840382793, 2230616362004769,
+      1396886392021913 },
+    { 676962063230039, 1880275537148808, 2046721011602706, 888463247083003,
+      1318301552024067 },
+    { 1466980508178206, 617045217998949, 652303580573628, 757303753529064,
+      207583137376902 } },
+  { { 416770998629779, 389655552427054, 1314476859406756, 1749382513022778,
+      1161905598739491 },
+    { 1428358296490651, 1027115282420478, 304840698058337, 441410174026628,
+      1819358356278573 },
+    { 204943430200135, 1554861433819175, 216426658514651, 264149070665950,
+      2047097371738319 } },
+  { { 945205108984232, 526277562959295, 1324180513733566, 1666970227868664,
+      153547609289173 },
+    { 2031433403516252, 203996615228162, 170487168837083, 981513604791390,
+      843573964916831 },
+    { 1476570093962618, 838514669399805, 1857930577281364, 2017007352225784,
+      317085545220047 } },
+  { { 566116659100033, 820247422481740, 994464017954148, 327157611686365,
+      92591318111744 },
+    { 617256647603209, 1652107761099439, 1857213046645471, 1085597175214970,
+      817432759830522 },
+    { 771808161440705, 1323510426395069, 680497615846440, 851580615547985,
+      1320806384849017 } },
+  { { 394921645077290, 1247587116821481, 335027385931130, 1680221683806638,
+      969339720975688 },
+    { 1022828360379176, 14801395798372, 417520384913388, 275718870295479,
+      52053104240039 },
+    { 1595456591254808, 1919330451560855, 265402806641622, 1560117962587834,
+      1169927205192232 } },
+  { { 299024329513088, 1472973110394008, 389026283520838, 553204470600531,
+      1474092785282710 },
+    { 1757788862747584, 1973452748655524, 634792998828794, 1643784747809472,
+      2071938416075651 },
+    { 901870527597111, 1300831444709451, 1795706127510368, 1590464383227069,
+      60287918150860 } },
+  { { 1102630701890818, 2202327440719776, 1844385418066207, 1719220574774295,
+      770639020176809 },
+    { 790852957780176, 2126974970440838, 432812021761078, 1550860498026842,
+      862138215232859 },
+    { 1192644591215061, 1951970263153038, 182489349589207, 1072483329544407,
+      1425993434915257 } },
+  { { 875483311206750, 1070293195031859, 1281389774974538, 2234860500431395,
+      778685125379289 },
+    { 61535391329516, 448636217346295, 2080976424777490, 1693183775735280,
+      1282728854739106 },
+    { 2191861413872447, 1998107865473216, 135161483760725, 1133778951112075,
+      2177808149908975 } },
+  { { 399782442885348, 863392731283639, 10768616144096, 848902587329911,
+      1291715860260000 },
+    { 2094805578898988, 2032836299437646, 682669661257796, 1091601395624145,
+      1811316694087220 },
+    { 2134741581329920, 780495253145963, 567449663015521, 1797492458615304,
+      517880546244456 } },
+  { { 475314526457825, 1542328519919860, 780162177799682, 936919052422815,
+      1460725628805854 },
+    { 74389546244658, 1796310071464984, 1063457215010456, 1548555985044002,
+      247514045694883 },
+    { 1746261246083530, 1365923999728827, 2003632491863752, 626302361482772,
+      1242642022991358 } },
+  { { 146831038152316, 1263718607849501, 1066603753620710, 985447239529545,
+      1802130495319981 },
+    { 77378247112166, 1939851002075727, 1209337253309309, 868296778851247,
+      1433885780383621 },
+    { 1248440054084185, 349542262650630, 1827787804264307, 509085301166716,
+      2162119087338759 } },
+  { { 1711855333995466, 1910732914002792, 982796433381956, 1610702012580457,
+      2141909047592645 },
+    { 371190018823910, 599091874882159, 1771060908423525, 1434842805379244,
+      476856347655310 },
+    { 1569768854079439, 2199201869213216, 1174940445376196, 2058599462945351,
+      982374658249145 } },
+  { { 671608908115941, 484269451051509, 102986838521834, 1746794120504525,
+      446566683262850 },
+    { 1658360447315580, 235574970436768, 2193299829303686, 724334890670034,
+      424169220517854 },
+    { 572800341374627, 89533128439918, 95803032860478, 323487829218667,
+      538974854785013 } },
+  { { 1706144746545732, 1011379720498586, 1702279691254521, 1158076352127568,
+      1653611038188983 },
+    { 1363437643627106, 277110290962098, 393788685374112, 1961256044212174,
+      661675109333654 },
+    { 1050680773136345, 353668073266043, 643180297629375, 1931139426349612,
+      518165039751217 } },
+  { { 19276750766278, 1669155288599014, 1507478486354408, 405925954946493,
+      2143299555235418 },
+    { 1589109919444203, 982836969468736, 1563782079680127, 1408868643018028,
+      1455478147938533 },
+    { 1398662091289774, 1560424162620311, 116791231064001, 28668329998471,
+      2185085079473248 } },
+  { { 1355285592679618, 964532200162205, 606767307684972, 180576224889129,
+      482463910553398 },
+    { 2220808064153177, 176691452047504, 762781849533969, 944930357489006,
+      1534273731293129 },
+    { 449706520184472, 2214233011551797, 684523848529734, 431843026966950,
+      1758835924810462 } }
+},
+{ /* 14/51 */
+  { { 1381495390544381, 584763141985101, 879705032985300, 313362758653765,
+      2037973653370615 },
+    { 1890742306105773, 171853555874878, 1636487436566592, 1018479096469591,
+      1049093089544630 },
+    { 762375715838646, 553562190209386, 1146347552263484, 824188464596685,
+      1830942666102590 } },
+  { { 1528297312537716, 2187935649407647, 715931603706163, 903221378972329,
+      1577434241618945 },
+    { 816944747089363, 1889295505677179, 1061560556919768, 681907473170465,
+      1031466762565130 },
+    { 1385713524190245, 153942078459639, 747467190641094, 1446053675113471,
+      429215290527338 } },
+  { { 2201062670972485, 265709142593639, 429860623330877, 2026769404043332,
+      1562746334284849 },
+    { 378121020022844, 825936872512952, 1650345619233699, 606283736757827,
+      1756067113723921 },
+    { 2029537774099989, 798336123274982, 962765795717174, 1441375461370721,
+      595792417755859 } },
+  { { 1219260086131915, 647169006596815, 79601124759706, 2161724213426748,
+      404861897060198 },
+    { 1327968293887866, 1335500852943256, 1401587164534264, 558137311952440,
+      1551360549268902 },
+    { 417621685193956, 1429953819744454, 396157358457099, 1940470778873255,
+      214000046234152 } },
+  { { 52405933174014, 129829098574336, 1287715254728848, 797300455234913,
+      136040202304140 },
+    { 1067823335481987, 699576431451255, 2247599170305995, 2136062757900704,
+      276795894988793 },
+    { 2090499387837281, 1738232489337197, 89628464572496, 330577247594545,
+      1509311339573925 } },
+  { { 759330834618807, 1980941059961292, 1007212016193707, 1897051116675950,
+      1314655091590608 },
+    { 853223378119015, 1541319514595021, 658867101298856, 1436759955980797,
+      1805479881384115 },
+    { 813923630382560, 2070308454618547, 1123753760701538, 125701858674237,
+      1639876691492174 } },
+  { { 660457766126717, 1899904872118576, 2214179562340732, 456995681364326,
+      662844695182908 },
+    { 435466159222517, 2187266940421609, 1321026749871315, 1523662413810968,
+      322350658778158 },
+    { 1138558219095340, 1151536604143443, 413388077302883, 2227565636724078,
+      1162237337050609 } },
+  { { 1268047918491973, 2172375426948536, 1533916099229249, 1761293575457130,
+      1590622667026765 },
+    { 1627072914981959, 2211603081280073, 1912369601616504, 1191770436221309,
+      2187309757525860 },
+    { 1149147819689533, 378692712667677, 828475842424202, 2218619146419342,
+      70688125792186 } },
+  { { 3413179823387, 480762486590101, 84191581355312, 628211443197933,
+      2213494099253629 },
+    { 1854765997888797, 336604586588444, 806854870907216, 1001949872861562,
+      570257099009375 },
+    { 834101398118966, 271022854369145, 1369674314861137, 1818916289496810,
+      1266134825749943 } },
+  { { 1410686222988228, 2104835708434440, 1261330834491682, 162817793919631,
+      1958863190823035 },
+    { 1496164884775817, 1088656408957049, 691739915757074, 138898825877781,
+      260953870717702 },
+    { 1038765404048732, 1369892669816941, 813245412145919, 1308696772712209,
+      983496888456019 } },
+  { { 1559922084281010, 818475325959040, 1641601040165538, 1447252870536279,
+      1567693711144484 },
+    { 475634818502575, 1175459439718422, 1996017460566560, 833004825516132,
+      185380122751190 },
+    { 264174388706200, 1255545285419248, 1209357159960639, 1360317857566816,
+      1165282760372820 } },
+  { { 1299739417079761, 1438616663452759, 1536729078504412, 2053896748919838,
+      1008421032591246 },
+    { 2040723824657366, 399555637875075, 632543375452995, 872649937008051,
+      1235394727030233 },
+    { 2211311599327900, 2139787259888175, 938706616835350, 12609661139114,
+      2081897930719789 } },
+  { { 1049539095917283, 405715750871589, 824822321927687, 698230211333844,
+      2237292610351351 },
+    { 2173807904350587, 1365814741026997, 736946937613060, 1072437565221240,
+      363894364314974 },
+    { 155657864174561, 1796953774276698, 223128301981749, 468121917293855,
+      996062976193721 } },
+  { { 863021006485300, 622374497077679, 17074488078781, 1889856903951957,
+      381275511918326 },
+    { 1559568743803463, 1247046487182599, 563362401041338, 35898887783896,
+      1178475398893754 },
+    { 2218193689512155, 2193971580116541, 1105913513779761, 1734221896008379,
+      548073641924556 } },
+  { { 229063000498590, 1314277778603795, 1398896159726879, 20280049240013,
+      1710170205754499 },
+    { 28369402532694, 2081122251401250, 196508071565830, 67080239900191,
+      182954550150590 },
+    { 2070257592538602, 1813898931317490, 1039206397473220, 2042478281991863,
+      943609113181435 } },
+  { { 1324994503390450, 336982330582631, 1183998925654177, 1091654665913274,
+      48727673971319 },
+    { 1845522914617879, 1222198248335542, 150841072760134, 1927029069940982,
+      1189913404498011 },
+    { 1079559557592645, 2215338383666441, 1903569501302605, 49033973033940,
+      305703433934152 } }
+},
+{ /* 15/51 */
+  { { 1916168475367211, 915626432541343, 883217071712575, 363427871374304,
+      1976029821251593 },
+    { 678039535434506, 570587290189340, 1605302676614120, 2147762562875701,
+      1706063797091704 },
+    { 1439489648586438, 2194580753290951, 832380563557396, 561521973970522,
+      584497280718389 } },
+  { { 1684548552982170, 260880483365080, 2151565475089601, 2240257948464080,
+      105534272702509 },
+    { 759532983145199, 1041506031166509, 2098906843949927, 2024575413813287,
+      1129901033077001 },
+    { 2245889758290233, 1304556815701186, 1427348922813143, 221464961710041,
+      2149077757654506 } },
+  { { 79297973334596, 262526648693013, 604537225308063, 809780153862762,
+      2182713811088823 },
+    { 913727636183534, 860885730253656, 1215549221101497, 656343278887452,
+      1371123818158513 },
+    { 1203690509711338, 1078459921386538, 166204039480004, 817259859872778,
+      1177955504111033 } },
+  { { 1200977971745538, 679604753110803, 118640303903686, 13161284424804,
+      1017048311556209 },
+    { 518289544308872, 2210328310178151, 992468182848569, 1632583101328401,
+      88660873565255 },
+    { 1190992926530423, 1046016291129455, 1934369009614752, 958221374199446,
+      762751542850234 } },
+  { { 1430503906423204, 2145923890259126, 958589818428077, 55101209307565,
+      791194318313681 },
+    { 579305967797542, 282748389877576, 2193202024960988, 80689170288508,
+      1220178447774781 },
+    { 166628931873469, 1975669553014052, 1396989460756441, 1635696363793894,
+      49061929249802 } },
+  { { 1196600994744564, 1547369290503378, 2035231477477616, 1257032246257935,
+      477213736067146 },
+    { 1209177241620207, 898929391359607, 808801284537394, 1245342740956132,
+      272014677526521 },
+    { 1316355169784636, 2159471323343549, 195437001734225, 1784725127680235,
+      23628188515854 } },
+  { { 936680408673250, 632255132930248, 1107274952037880, 557387366049136,
+      452708336144231 },
+    { 1382488769673834, 1569111029627111, 1817374221660487, 723410524424384,
+      1423221389919440 },
+    { 1132711466368427, 1417950357314652, 1061614326379092, 1029811022928614,
+      305678277832816 } },
+  { { 1782397857084708, 48095726564004, 1468513199329122, 1169924369129606,
+      1452708652401532 },
+    { 2163087320072509, 199316101406292, 1846431193137861, 204046193177858,
+      1779620820558944 },
+    { 246845927125542, 475207520380026, 1495857355234583, 1332907410765356,
+      1137190823002655 } },
+  { { 1838679687103130, 1568056445864956, 196229418146419, 1564076055391722,
+      811487866422231 },
+    { 917325171771199, 1282290126451149, 1427725537183653, 36809817007349,
+      1302142977375433 },
+    { 9206989236480, 660825891866914, 759696087137503, 6337085381232,
+      1249077138731305 } },
+  { { 402770419372181, 879148936024281, 171152161387778, 1521258543891684,
+      1016650524881308 },
+    { 116038458993258, 608632312109909, 1178551838069391, 1820997430699396,
+      949215725963241 },
+    { 122249525311324, 1126352422834922, 929325077009082, 782368628240853,
+      94217591211022 } },
+  { { 1938533916119830, 760436157440953, 1862533081126747, 265623616804111,
+      1877926846411964 },
+    { 1453854983990291, 46777997872091, 1345322419362524, 308767826717790,
+      157605623857606 },
+    { 1234842151857825, 812889049461103, 2084874952325857, 312827323988726,
+      934486402157215 } },
+  { { 739195792604578, 770122614286754, 302802129599792, 1502244105829111,
+      1773114045409669 },
+    { 459035525733650, 770535776464013, 252174834449567, 2131746448577589,
+      954066860320410 },
+    { 156241863414061, 496518516536107, 402847929676013, 1139792271454333,
+      1977247161507402 } },
+  { { 1140611982916754, 637519960454987, 1423964297284559, 2019043726311563,
+      342991122788575 },
+    { 965120629845928, 436115832729647, 1332745662068392, 987000910672295,
+      1532331820833538 },
+    { 969197222824260, 95489851764502, 1157985055243862, 1402152094386490,
+      1700872258538622 } },
+  { { 211523957170473, 1644670408070226, 756431515781898, 949873124601275,
+      36660463549794 },
+    { 529214503061057, 257079294506787, 2191069624568715, 1061830060574110,
+      2065600952844923 },
+    { 1855056967762827, 1495181328549832, 966278130514841, 758391654071223,
+      467588501531856 } },
+  { { 1865408747407036, 1653441443625497, 105767832293003, 28600765551017,
+      786820049043927 },
+    { 1396766020295865, 1585435387460199, 1787428622229505, 1887543739588463,
+      1863150398233008 },
+    { 419297983172447, 358864541134894, 2118626262091238, 1687094843894439,
+      939311726290818 } },
+  { { 185100610527958, 1954148435588968, 1712385658617173, 471993490740154,
+      681838917243490 },
+    { 313435187549042, 1956277154208437, 1365239857368542, 1348897712723582,
+      126454872238337 },
+    { 1439947543028469, 885225692302481, 1285222886469976, 1588398795428018,
+      1298691185892088 } }
+},
+{ /* 16/51 */
+  { { 187989455492609, 681223515948275, 1933493571072456, 1872921007304880,
+      488162364135671 },
+    { 1413466089534451, 410844090765630, 1397263346404072, 408227143123410,
+      1594561803147811 },
+    { 2102170800973153, 719462588665004, 1479649438510153, 1097529543970028,
+      1302363283777685 } },
+  { { 942065717847195, 1069313679352961, 2007341951411051, 70973416446291,
+      1419433790163706 },
+    { 1146565545556377, 1661971299445212, 406681704748893, 564452436406089,
+      1109109865829139 },
+    { 2214421081775077, 1165671861210569, 1890453018796184, 3556249878661,
+      442116172656317 } },
+  { { 753830546620811, 1666955059895019, 1530775289309243, 1119987029104146,
+      2164156153857580 },
+    { 615171919212796, 1523849404854568, 854560460547503, 2067097370290715,
+      1765325848586042 },
+    { 1094538949313667, 1796592198908825, 870221004284388, 2025558921863561,
+      1699010892802384 } },
+  { { 1951351290725195, 1916457206844795, 198025184438026, 1909076887557595,
+      1938542290318919 },
+    { 1014323197538413, 869150639940606, 1756009942696599, 1334952557375672,
+      1544945379082874 },
+    { 764055910920305, 1603590757375439, 146805246592357, 1843313433854297,
+      954279890114939 } },
+  { { 80113526615750, 764536758732259, 1055139345100233, 469252651759390,
+      617897512431515 },
+    { 74497112547268, 740094153192149, 1745254631717581, 727713886503130,
+      1283034364416928 },
+    { 525892105991110, 1723776830270342, 1476444848991936, 573789489857760,
+      133864092632978 } },
+  { { 542611720192581, 1986812262899321, 1162535242465837, 481498966143464,
+      544600533583622 },
+    { 64123227344372, 1239927720647794, 1360722983445904, 222610813654661,
+      62429487187991 },
+    { 1793193323953132, 91096687857833, 70945970938921, 2158587638946380,
+      1537042406482111 } },
+  { { 1895854577604609, 1394895708949416, 1728548428495944, 1140864900240149,
+      563645333603061 },
+    { 141358280486863, 91435889572504, 1087208572552643, 1829599652522921,
+      1193307020643647 },
+    { 1611230858525381, 950720175540785, 499589887488610, 2001656988495019,
+      88977313255908 } },
+  { { 1189080501479658, 2184348804772597, 1040818725742319, 2018318290311834,
+      1712060030915354 },
+    { 873966876953756, 1090638350350440, 1708559325189137, 672344594801910,
+      1320437969700239 },
+    { 1508590048271766, 1131769479776094, 101550868699323, 428297785557897,
+      561791648661744 } },
+  { { 432920540217177, 290770592514699, 627484756484379, 824810409698118,
+      982836063036306 },
+    { 353355251740798, 1991816083101731, 531398365732334, 658525949984292,
+      2238278328356437 },
+    { 1857779135539838, 1774848070278290, 1383862392183037, 1948805685118077,
+      1143607656457264 } },
+  { { 1741735203658460, 2040511596280954, 994080127103494, 1750904751318661,
+      1289068422789788 },
+    { 1422369203246522, 971984599311858, 573014681621518, 918848094870590,
+      367659447629224 },
+    { 103031326341235, 1843731695283489, 1066974994445109, 1210433521778964,
+      118970268237578 } },
+  { { 1990983617046169, 854661065244784, 1275461113767737, 1443049000516840,
+      1724142301140669 },
+    { 526076300826364, 1586144386274444, 1604867537646151, 2047301186620175,
+      2088705035995344 },
+    { 888262946735860, 1859763056800716, 714395964694532, 57820586821189,
+      354182478325612 } },
+  { { 1658219197861206, 1494360717755939, 1921505970326949, 797586498581590,
+      223479569236846 },
+    { 1548525608040451, 1073757559082238, 1531369709327363, 922355437238401,
+      1843971892788743 },
+    { 1290766154788448, 1600589032610209, 784792370088015, 423204440383515,
+      459184860068298 } },
+  { { 2215101089214073, 1997062079162084, 1249116849924618, 465107085276733,
+      1293244424458276 },
+    { 1173405439078453, 736456899988215, 1888556478991842, 74794080134484,
+      755787171212360 },
+    { 880894898454805, 639667973647762, 200272726605326, 297199521205209,
+      1640420309599773 } },
+  { { 658635179203333, 1466091549480452, 1422016859604874, 2129566854376279,
+      1443087419989351 },
+    { 1772599462959424, 324607711577639, 2208191644070295, 1873852587641829,
+      1848483126905265 },
+    { 1532654097308642, 1958497386525981, 111717506991097, 1708848284574815,
+      1306115185198907 } },
+  { { 2039429018914652, 791346872047456, 1364716986897876, 1031303003048000,
+      1123429638631433 },
+    { 1608800116223605, 2230571150409028, 791905361408124, 396843532013026,
+      1950462527132799 },
+    { 765045651502510, 451621180435426, 15885268584069, 767513226653014,
+      768056106241896 } },
+  { { 464451590840864, 1631117916585970, 1763058100245834, 2213037729836095,
+      1396521499150134 },
+    { 1708891979933193, 193606038525586, 1981223293240314, 1300147684220123,
+      1415690962041537 },
+    { 296206175452724, 658879322369119, 97943562265366, 1761747874053347,
+      665498744562262 } }
+},
+{ /* 17/51 */
+  { { 1200760264207189, 52939066426767, 1927960174691145, 1569518880089323,
+      1152309979337507 },
+    { 38546390495599, 61816108201901, 1929402325321447, 2162999785972298,
+      837806219901868 },
+    { 2038947849479643, 237162323211423, 2065816839891168, 419806183479203,
+      384865548997533 } },
+  { { 1987770197713503, 751549594590657, 1878974480372933, 520288146790215,
+      146577641784525 },
+    { 1870148064878802, 1722962699461314, 2148888862361842, 1498958478808291,
+      1078521514059403 },
+    { 1021194340773145, 2214506742467645, 1946787888944335, 2047968106648641,
+      1821857137920583 } },
+  { { 1148904473568401, 40634531148500, 608217842239622, 896886146116791,
+      1793557015614071 },
+    { 1636905029336861, 770793125827227, 1336171461860292, 201993548186316,
+      114272157082495 },
+    { 738867948290551, 1113067062951318, 2239418068162676, 2235388618772922,
+      321946428440080 } },
+  { { 1473307785816396, 2183888493524504, 1340430334743973, 620286732260876,
+      718894511556160 },
+    { 355530883651858, 1186819460918536, 2022594105067760, 38939679101912,
+      518229550986997 },
+    { 200438687964996, 1579389594103736, 1144999901302662, 1292188560016150,
+      1342060233269448 } },
+  { { 2182554744233356, 926666458178889, 539025491304793, 277348144030924,
+      951582391464257 },
+    { 1087694274214681, 657837867113485, 2056079076075723, 42698622858844,
+      1937805079712484 },
+    { 187571578269437, 1207365261045700, 1671287753495621, 128062601272884,
+      1097620007687094 } },
+  { { 1833700152289011, 152023677399495, 1100733497809069, 730002289899125,
+      157354538884250 },
+    { 234481426214488, 623865650412606, 1830554657397465, 828177268704079,
+      139407215273400 },
+    { 822917758900752, 1019777701975664, 1564136027018780, 1218107309963297,
+      1014127758290355 } },
+  { { 391654910353785, 1385194776028483, 1321542156467456, 302349308078573,
+      374384490264460 },
+    { 377572545908744, 1348013154772650, 885851232216817, 86939046384524,
+      1422748012134905 },
+    { 1041863798926969, 1989079677249410, 910600041636905, 172639986070412,
+      958797345271109 } },
+  { { 756417570499462, 237882279232602, 2136263418594016, 1701968045454886,
+      703713185137472 },
+    { 1781187809325462, 1697624151492346, 1381393690939988, 175194132284669,
+      1483054666415238 },
+    { 2175517777364616, 708781536456029, 955668231122942, 1967557500069555,
+      2021208005604118 } },
+  { { 1595355944187935, 829460966808407, 1977944440906480, 1032917662634886,
+      767708922696309 },
+    { 858649013649097, 1772289719165094, 772639614435916, 935996040079446,
+      1138357546756603 },
+    { 1875482164842682, 1366081272964294, 1388469067239022, 1288981408648325,
+      1494201116787118 } },
+  { { 1680308209839530, 1539068455167905, 1720687448275269, 672104395075782,
+      1898898871459090 },
+    { 1381876066424501, 1166259022351178, 250163863564413, 1869009057404818,
+      609588044235692 },
+    { 1171592639846366, 53556464080513, 509917402336366, 50302783996591,
+      116926663089281 } },
+  { { 449118214720731, 594119282021534, 1838635818584827, 1141540115605515,
+      111816545602416 },
+    { 1821630848233745, 35284300403497, 352394310319344, 1834354924249117,
+      1332814598504964 },
+    { 1667065429383181, 2067106810774583, 546254848004624, 1787126028895347,
+      552569301209655 } },
+  { { 1388253729624836, 499584036628990, 1020619719339765, 182551197217258,
+      445563979455016 },
+    { 341732817398995, 1127087065296322, 469287765768203, 2011080442454689,
+      2055425353635708 },
+    { 358483800778822, 1132443021880518, 210021124219010, 1981657555816451,
+      1550175374481458 } },
+  { { 894571270702955, 1239147587643737, 2035975571580974, 508567898665115,
+      1717947079982820 },
+    { 1497152557642369, 1213379397541002, 1620454961051669, 1512823548451857,
+      1918916459608450 },
+    { 1762010413704497, 1394465346573971, 1226578058043391, 1141181977667671,
+      70377869760879 } },
+  { { 19488418614468, 169699368092169, 278968875861936, 1987569768661737,
+      1050374145889453 },
+    { 357716193937003, 102267197432736, 266211422593506, 928976112910070,
+      1995303156549375 },
+    { 800756918935681, 980907507609063, 1031864457570059, 479726313712865,
+      905099083509154 } },
+  { { 1082058248128476, 2113831576823897, 1141847808005957, 1518021390389299,
+      450447893178625 },
+    { 1926033105096507, 2238519674979232, 1421854078986512, 2184803052606553,
+      389215792927831 },
+    { 1259800973998425, 1997765989630674, 1203631014480164, 1726213185804077,
+      1972574621326532 } },
+  { { 1115135966606887, 224217372950782, 915967306279222, 593866251291540,
+      561747094208006 },
+    { 1443163092879439, 391875531646162, 2180847134654632, 464538543018753,
+      1594098196837178 },
+    { 850858855888869, 319436476624586, 327807784938441, 740785849558761,
+      17128415486016 } }
+},
+{ /* 18/51 */
+  { { 122321229299801, 1022922077493685, 2001275453369484, 2017441881607947,
+      993205880778002 },
+    { 654925550560074, 1168810995576858, 575655959430926, 905758704861388,
+      496774564663534 },
+    { 1954109525779738, 2117022646152485, 338102630417180, 1194140505732026,
+      107881734943492 } },
+  { { 360275475604565, 547835731063078, 215360904187529, 596646739879007,
+      332709650425085 },
+    { 47602113726801, 1522314509708010, 437706261372925, 814035330438027,
+      335930650933545 },
+    { 1291597595523886, 1058020588994081, 402837842324045, 1363323695882781,
+      2105763393033193 } },
+  { { 1212935253295642, 2026300849238541, 1196083870541997, 1364910689032304,
+      767721080478219 },
+    { 1488819723619072, 35092073032524, 821532055319225, 241314925012301,
+      1469048576976071 },
+    { 2014517785153097, 1607430272140319, 1855018731367383, 2200629261829065,
+      987339037980209 } },
+  { { 831848399557275, 2203944328508070, 1205773492199750, 696100069920808,
+      1258775953756160 },
+    { 1536600197637719, 735192130338721, 1949638657621950, 1215398877067309,
+      196061350744259 },
+    { 801855642469056, 1726062700700587, 1064722548099106, 1128997468587175,
+      1368420390253860 } },
+  { { 1622804048544200, 915041952882907, 1930032922997884, 311056897392678,
+      169542458418274 },
+    { 287149663014406, 1833763257239198, 1928687648160027, 1196128746079943,
+      2063883975740239 },
+    { 1551335528577145, 1948004732325226, 1312662718768754, 210905365566252,
+      2058193794812140 } },
+  { { 142063894440228, 1372509542166385, 2168326442740084, 2125528633887315,
+      1476968897162639 },
+    { 785434002069208, 1744753979728712, 1078762096601858, 938403122376921,
+      1213343778825366 },
+    { 985903604801154, 1332886857023986, 2192903547363473, 1840653102523012,
+      429691169313138 } },
+  { { 1245320581556515, 1602979844911741, 2107281419587782, 1757218026844315,
+      108223170283648 },
+    { 892483078620071, 1282903740840521, 288486899223614, 1193037005255340,
+      329767062013699 },
+    { 963583404511934, 278128946441565, 1903533887155182, 978312868545893,
+      583354603016146 } },
+  { { 1095027470911861, 1309452919940954, 165563932177558, 1165431755382480,
+      1895316643922204 },
+    { 717156719298230, 1955979138243696, 2199791266029467, 1058002839738406,
+      1449532534254269 },
+    { 2142749866659158, 1962490102531981, 1691447155265793, 1827079035266074,
+      3803331638058 } },
+  { { 1504474042703954, 467427742958424, 352220297237610, 1309424200487215,
+      1912480544524107 },
+    { 88533347812538, 1294136033482022, 299596233956243, 60663199529242,
+      1787783363336769 },
+    { 1709235819232169, 567404565356497, 1995949931537830, 1908745429560797,
+      1214196194872047 } },
+  { { 1043353844971295, 2043211380513154, 1699222893347162, 315336060401577,
+      23499265425561 },
+    { 785211022797815, 131959333969695, 421003636399016, 1415026534724707,
+      259170718243180 },
+    { 299314826812781, 1973991302926879, 344270175372800, 1521436236341130,
+      978141399248076 } },
+  { { 2070740574932740, 1562735870397740, 1622391615341094, 1176158848322452,
+      1626784437347104 },
+    { 1249017755758050, 1702387957369772, 1220050705651008, 1761915687423485,
+      439848735585580 },
+    { 1518477574890767, 333492348816229, 1565883822704407, 197275889570220,
+      12999397458289 } },
+  { { 1104482724596124, 121997531441, 635349471659539, 1384857237573085,
+      1805272655273783 },
+    { 478069199145280, 1141170740207616, 940257554984262, 897591638444270,
+      1814438392415312 },
+    { 399619403797256, 1517816986720610, 1503473770785461, 1650204761619743,
+      2016574488970872 } },
+  { { 673134042556382, 263641146156934, 668703597909064, 2244629269026048,
+      863800061710589 },
+    { 28125822440725, 1321104715653731, 1855905220908873, 1642951583006543,
+      196278346766320 },
+    { 141001094563586, 745053268207009, 1933127088515518, 2223038166038791,
+      302137944312804 } },
+  { { 1892881056249351, 224718992791357, 886934504265812, 137854399320237,
+      2097768652942237 },
+    { 1311225750858844, 605951970544033, 43897084268518, 16238814867179,
+      1379802052960446 },
+    { 2114686272109070, 1740718345102266, 1294350645076173, 2163010864291133,
+      67178198006822 } },
+  { { 2098359993052422, 1268272578932237, 969418269919982, 1084550350165731,
+      346854656875689 },
+    { 903207516549054, 2127872093258697, 1937250219252355, 1400381839721648,
+      1947447086440430 },
+    { 1613697280682962, 426167043646607, 2237161612253816, 254293623066907,
+      2220839026298682 } },
+  { { 1452497321657782, 1539338328736177, 1904958092028386, 1587402592924884,
+      2189645592400953 },
+    { 1830872026784925, 1623034384028758, 2186083484441019, 1970420851072046,
+      64231867033146 },
+    { 481460971838645, 495603062939192, 2081146895236470, 971761350637757,
+      742727604094484 } }
+},
+{ /* 19/51 */
+  { { 1661216359883315, 1198665005326425, 1223676681611594, 881743418686048,
+      635325796191538 },
+    { 610180487982555, 1103087737610894, 1696274700114993, 1767466185217554,
+      250915004216473 },
+    { 1196599610725063, 2100294611545468, 412113633351820, 925880965367657,
+      519930913383517 } },
+  { { 109521982566564, 1715257748585139, 1112231216891516, 2046641005101484,
+      134249157157013 },
+    { 2156991030936798, 2227544497153325, 1869050094431622, 754875860479115,
+      1754242344267058 },
+    { 1846089562873800, 98894784984326, 1412430299204844, 171351226625762,
+      1100604760929008 } },
+  { { 459167279500688, 1744640523205965, 1419675855731500, 1649499688440624,
+      891151721743640 },
+    { 207354516743448, 1036071450342472, 1036793175612935, 315648352734251,
+      395461444209318 },
+    { 823091630229988, 1446150800886833, 1726850363620476, 561825154532916,
+      535215286555612 } },
+  { { 84172382130492, 499710970700046, 425749630620778, 1762872794206857,
+      612842602127960 },
+    { 868309334532756, 1703010512741873, 1952690008738057, 4325269926064,
+      2071083554962116 },
+    { 523094549451158, 401938899487815, 1407690589076010, 2022387426254453,
+      158660516411257 } },
+  { { 1686414631782552, 512252050561736, 1693003812859306, 998992166879936,
+      953018803583439 },
+    { 340752156151206, 1980970325201299, 1444982221413880, 194740242740143,
+      655048218941095 },
+    { 357900760213273, 16321449171902, 1991064462370748, 674543053397998,
+      373159546436491 } },
+  { { 612867287630009, 448212612103814, 571629077419196, 1466796750919376,
+      1728478129663858 },
+    { 1723848973783452, 2208822520534681, 1718748322776940, 1974268454121942,
+      1194212502258141 },
+    { 1254114807944608, 977770684047110, 2010756238954993, 1783628927194099,
+      1525962994408256 } },
+  { { 178126449070591, 1928485879232125, 1404480320852662, 59419184509478,
+      1066535677910018 },
+    { 998783231183816, 642485368111007, 1034201599255404, 103576728934777,
+      1685291101194070 },
+    { 1791035770232747, 396684773854366, 120555003180349, 1919647893352352,
+      888586344216506 } },
+  { { 232464058235826, 1948628555342434, 1835348780427694, 1031609499437291,
+      64472106918373 },
+    { 767338676040683, 754089548318405, 1523192045639075, 435746025122062,
+      512692508440385 },
+    { 1255955808701983, 1700487367990941, 1166401238800299, 1175121994891534,
+      1190934801395380 } },
+  { { 407878049799782, 951711903896343, 511145564962075, 600952179039559,
+      1385812127813406 },
+    { 1448394594562091, 471452420160221, 88020297907517, 1700970732814085,
+      1487101537228651 },
+    { 1426945486832212, 235380359681674, 784043829430173, 1912062180758682,
+      1617407281111969 } },
+  { { 349144008168292, 1337012557669162, 1475912332999108, 1321618454900458,
+      47611291904320 },
+    { 877519947135419, 2172838026132651, 272304391224129, 1655143327559984,
+      886229406429814 },
+    { 375806028254706, 214463229793940, 572906353144089, 572168269875638,
+      697556386112979 } },
+  { { 1493298692354242, 837277226695549, 28310019861902, 976570150700109,
+      1089767200708625 },
+    { 2142474321250358, 240179012197689, 1669530306416287, 406510227236553,
+      1583157150601903 },
+    { 1276533261509748, 709093740609134, 1761587126684054, 1009829138879812,
+      1627247137495505 } },
+  { { 1168827102357844, 823864273033637, 2071538752104697, 788062026895924,
+      599578340743362 },
+    { 1948116082078088, 2054898304487796, 2204939184983900, 210526805152138,
+      786593586607626 },
+    { 1915320147894736, 156481169009469, 655050471180417, 592917090415421,
+      2165897438660879 } },
+  { { 907038117245554, 877440344234842, 1922992290929398, 1992419677538206,
+      326132455669063 },
+    { 1149556000676945, 501094054733340, 2031469858369275, 1423040970371538,
+      2091636575152674 },
+    { 1941653905418897, 648581496288189, 725193027242145, 150189491680224,
+      668798078131448 } },
+  { { 1726336468579724, 1119932070398949, 1929199510967666, 33918788322959,
+      1836837863503150 },
+    { 829996854845988, 217061778005138, 1686565909803640, 1346948817219846,
+      1723823550730181 },
+    { 384301494966394, 687038900403062, 2211195391021739, 254684538421383,
+      1245698430589680 } },
+  { { 1813999523916171, 1945767828540575, 1967776174199507, 1120803521131314,
+      1674717097826443 },
+    { 895988256862052, 1997314866750196, 1313544548706321, 1288629206657540,
+      1788666801873498 },
+    { 167483846981697, 1983178574906713, 223423676390001, 2209322276196744,
+      1574161658584185 } },
+  { { 1247567493562688, 1978182094455847, 183871474792955, 806570235643435,
+      288461518067916 },
+    { 1449077384734201, 38285445457996, 2136537659177832, 2146493000841573,
+      725161151123125 },
+    { 1201928866368855, 800415690605445, 1703146756828343, 997278587541744,
+      1858284414104014 } }
+},
+{ /* 20/51 */
+  { { 1941100238292788, 1530763972357988, 689917761100876, 517834246099702,
+      1016501476684148 },
+    { 1361281020450455, 1270489161609055, 2229166815777130, 478093075579488,
+      1028298658754112 },
+    { 402477551873128, 1206353712079331, 1931900782149571, 353151698548753,
+      227661813611943 } },
+  { { 790360882582618, 1193039775906918, 457074437270605, 1880772252763311,
+      1647664574467171 },
+    { 1267345491545277, 1040955582161709, 944602568432597, 589216616145824,
+      2176282068300736 },
+    { 1801318854301087, 529217444026518, 41439150499132, 1819497139150034,
+      1914318279506430 } },
+  { { 1401592520352142, 2119290268348413, 1662789932544495, 1461053630461698,
+      1761023449047587 },
+    { 114244238715052, 1711673966360604, 27096215850346, 649231795386780,
+      1751566257090632 },
+    { 1892648843913435, 1079776332626104, 1111039290977790, 1827479485396386,
+      859677304170245 } },
+  { { 1955745180210476, 1703319703537271, 2019166049085294, 1111446728934944,
+      1621319325065514 },
+    { 1631515565881337, 74820660423111, 1234156086642234, 902000684785159,
+      479946197517415 },
+    { 1700391063795585, 361747633083750, 1216968456947850, 1993842710713264,
+      601267006969711 } },
+  { { 1335348453199749, 440896739279346, 991468498763434, 1958567111536423,
+      1194502970771976 },
+    { 421687194725601, 1452210447909774, 1972718778338361, 2245279220138677,
+      197097958178703 },
+    { 1656217138482787, 491628805607466, 1679451179466805, 970181505842258,
+      1534105889461948 } },
+  { { 1051919605857270, 437958703079032, 943831089706606, 69819660973933,
+      1445811115388040 },
+    { 1953169811593624, 587935880863229, 808215721544276, 1172930642871056,
+      933712923663396 },
+    { 1160289603260459, 1956223108351205, 1733312353955470, 208731931777063,
+      2163609865075088 } },
+  { { 353960863214443, 267136175486224, 1655039766011589, 100906939435905,
+      1606429966007504 },
+    { 1668322680159809, 1164890095728715, 2146980235097167, 1096904483609062,
+      290681949797038 },
+    { 1142834714776341, 85770505106288, 713866520631433, 440023537352050,
+      178697006218663 } },
+  { { 1815823837273367, 310953977328321, 1539789395052837, 1395950066391658,
+      1631063017998021 },
+    { 866175525108893, 724819292219605, 2068366674175907, 2097483603288131,
+      549017403202089 },
+    { 534961844628464, 1393583055120721, 1748351260324708, 1375538226727024,
+      2193309623120304 } },
+  { { 872424258749188, 1017619653704369, 2236476348626174, 2024356220545311,
+      646984149936138 },
+    { 2110712152071290, 1083061627849304, 1308479297196572, 433649975322,
+      1443470366414306 },
+    { 1239822839121281, 1734625037061034, 1644113104753887, 838912630061655,
+      2165081997489666 } },
+  { { 396778796084837, 1439044445648177, 2082598280716610, 312891228956027,
+      1346520144951774 },
+    { 216068533245512, 450632926011098, 1155704279830393, 1553096955694524,
+      1828326669367983 },
+    { 1979149515238517, 717801405945362, 2104011649567412, 1561125545440573,
+      2157118688047562 } },
+  { { 1808742790957812, 496003497932491, 1593506265293205, 1924084822718510,
+      13052705957492 },
+    { 1925374899754391, 927884555160724, 408803445586324, 1171415905577533,
+      1564029961010013 },
+    { 1767189866398838, 835676264200014, 201596448765126, 1979907908451931,
+      1442810524651041 } },
+  { { 128841748532646, 1898386240588450, 1005124623360433, 1767814929221709,
+      337338633748079 },
+    { 2157496244107467, 2094268061525907, 1207437550614157, 350199052205771,
+      2217008494975342 },
+    { 1077226425497346, 607378044682866, 1485491791574172, 1074180848747199,
+      1023053128705595 } },
+  { { 241559560479919, 212280779218940, 1933101226851634, 1880342534882667,
+      166117663538592 },
+    { 1301003651545236, 544228005900385, 507427038513644, 1330143538205517,
+      599967285393572 },
+    { 1284426144747169, 2005093245564178, 229493920382094, 1642769566056222,
+      1596652614163344 } },
+  { { 1238878967024320, 471172814059509, 1889926553697686, 374867419189059,
+      1454538201510031 },
+    { 2226701688930612, 602397011340505, 2055445995572607, 660393007609165,
+      2190683761654867 },
+    { 978951056774557, 1610590016630807, 2160020521521822, 2222969528403014,
+      1290838415735858 } },
+  { { 884223512975709, 943781670457040, 112700233686803, 978391045278572,
+      2088093684065312 },
+    { 1981595287959862, 256449212298126, 1168053390719568, 1303662603325176,
+      2043691383438785 },
+    { 319754006496675, 2078141843592369, 1381704035073408, 2135424637477137,
+      1217419566529670 } },
+  { { 356468809648877, 782373916933152, 1718002439402870, 1392222252219254,
+      663171266061951 },
+    { 759628738230460, 1012693474275852, 353780233086498, 246080061387552,
+      2030378857679162 },
+    { 2040672435071076, 888593182036908, 1298443657189359, 1804780278521327,
+      354070726137060 } }
+},
+{ /* 21/51 */
+  { { 1894938527423184, 1463213041477277, 474410505497651, 247294963033299,
+      877975941029128 },
+    { 207937160991127, 12966911039119, 820997788283092, 1010440472205286,
+      1701372890140810 },
+    { 218882774543183, 533427444716285, 1233243976733245, 435054256891319,
+      1509568989549904 } },
+  { { 1402334161391744, 1560083671046299, 1008585416617747, 1147797150908892,
+      1420416683642459 },
+    { 665506704253369, 273770475169863, 799236974202630, 848328990077558,
+      1811448782807931 },
+    { 1468412523962641, 771866649897997, 1931766110147832, 799561180078482,
+      524837559150077 } },
+  { { 1862751661970328, 851596246739884, 1519315554814041, 1542798466547449,
+      1417975335901520 },
+    { 1228168094547481, 334133883362894, 587567568420081, 433612590281181,
+      603390400373205 },
+    { 121893973206505, 1843345804916664, 1703118377384911, 497810164760654,
+      101150811654673 } },
+  { { 923487018849600, 2085106799623355, 528082801620136, 1606206360876188,
+      735907091712524 },
+    { 1697697887804317, 1335343703828273, 831288615207040, 949416685250051,
+      288760277392022 },
+    { 1419122478109648, 1325574567803701, 602393874111094, 2107893372601700,
+      1314159682671307 } },
+  { { 1477173810966815, 956178534108247, 405061100265807, 825157489520719,
+      531073823989502 },
+    { 1392341055147288, 2141438628605581, 1992888020943799, 741876718210369,
+      292264675661600 },
+    { 12931323257125, 562700432679180, 780577595442459, 440747171628074,
+      31993258894121 } },
+  { { 426074691354309, 678833394869759, 1435664475903899, 1992670845292813,
+      654778477108270 },
+    { 1042997088413307, 1651077842675875, 1975699443855382, 1124111515020055,
+      534711496922040 },
+    { 651854196246431, 2602668557028, 1822678077647200, 2072267608435533,
+      435243653222236 } },
+  { { 420616296952710, 993499171959085, 1344078619347415, 2037703067415133,
+      446012955960116 },
+    { 1650429842210899, 994538652523686, 1029952899844772, 1250117562297466,
+      406948313223715 },
+    { 325041473989085, 842410640177049, 1052993540865892, 2093280369201601,
+      361408260911216 } },
+  { { 2219813055094868, 1499254289481425, 764148091645989, 790564725975557,
+      2174498914560537 },
+    { 787174142558441, 290213816892411, 217164218175754, 1829516411753589,
+      1841606552724103 },
+    { 1346839273131020, 1947175237418499, 2130499171815608, 841760904333801,
+      793011313347544 } },
+  { { 419440472501304, 509227645591622, 942623925894500, 1233921117854437,
+      1021968596387498 },
+    { 275301401840872, 1788346177727283, 1993992000728922, 1357292485939944,
+      529939058465561 },
+    { 71528060024013, 498611271716527, 1196432438714212, 692281617705321,
+      1899408706058804 } },
+  { { 645632570641312, 1573452966763371, 368586685270904, 1739042945676342,
+      197470914033861 },
+    { 1891220647894018, 1462284743256770, 1341868021457380, 634119694336595,
+      1576096124859176 },
+    { 2061885114973036, 1264392098373339, 1120601964885848, 1233693299161847,
+      139816678143788 } },
+  { { 125691542497580, 557476562406554, 1992535859778121, 1685439897981630,
+      2128768694934035 },
+    { 1530198014841393, 1035193049799354, 1177019872675808, 2008903060179739,
+      1161224918116160 },
+    { 2184378898355776, 1774960125594335, 1884382299708874, 2074749579976083,
+      1952503647372503 } },
+  { { 1520684470201357, 1316013316528763, 1540196449089197, 568371480938041,
+      1363866324865970 },
+    { 455083586862931, 423548387253826, 685066211748355, 852340049231959,
+      1729437591356141 },
+    { 260802717013329, 1583157564732787, 1642188565270865, 945377846588312,
+      48795241148018 } },
+  { { 745097455305197, 722318743093982, 168257911206777, 1366026979926004,
+      369110698866072 },
+    { 2227184797343554, 1756791329984721, 1129718676311003, 747188924739121,
+      486576605104253 },
+    { 758817929867462, 1387514434299366, 283895217218412, 776744152417851,
+      978563586695406 } },
+  { { 2241228700284326, 65484917834282, 917402691607937, 1497403661514660,
+      2233620166891221 },
+    { 1253364783437178, 992918106431991, 118902761890155, 83210979155873,
+      163722178511759 },
+    { 1814830241033634, 350600541711717, 2078033356136165, 2045181995498255,
+      808364346175938 } },
+  { { 139836641713492, 110080947228441, 1118122983207429, 328290762586851,
+      143402314076891 },
+    { 1977689251334393, 1886324628710018, 2223897132510385, 41859466170206,
+      1544373730841592 },
+    { 1073917163837773, 1078164698706329, 549129459377660, 983452938524469,
+      861362102510410 } },
+  { { 453885616355922, 1931337763813344, 1867986078235466, 963301853857219,
+      951744845930641 },
+    { 1638299625437402, 933125827264344, 1274558365788714, 1878405715151006,
+      1891383856643984 },
+    { 548016394257586, 1770170736821935, 883041007523403, 1244492123782548,
+      1874837894534970 } }
+},
+{ /* 22/51 */
+  { { 1980868732324310, 208050273598170, 1500353534094478, 1977074025846907,
+      686785408890947 },
+    { 651709082505144, 1321036933983907, 1168392824733552, 893454319309249,
+      367099342904064 },
+    { 1977199595236300, 927859862391871, 2045825765550850, 1189431662969386,
+      451125616133550 } },
+  { { 1322932513703416, 348483708721842, 625435238632922, 1647316986471087,
+      1495874784707614 },
+    { 1382315411654289, 1155328561290128, 746170398588834, 1242063022588681,
+      1283807594473873 },
+    { 889518489432828, 1216748566987677, 2027061052060458, 268044074097160,
+      1539610510772867 } },
+  { { 21424958575818, 1223111129900150, 1584682650834635, 2022200125401455,
+      1373728084078920 },
+    { 865621295938646, 1209886026068106, 451706790235670, 54695233825741,
+      1098464777589440 },
+    { 913182622593832, 2001872744868184, 882970207556847, 299806317329996,
+      1726046908726060 } },
+  { { 2201150872731804, 2180241023425241, 97663456423163, 1633405770247824,
+      848945042443986 },
+    { 1173339555550611, 818605084277583, 47521504364289, 924108720564965,
+      735423405754506 },
+    { 830104860549448, 1886653193241086, 1600929509383773, 1475051275443631,
+      286679780900937 } },
+  { { 1850892492353316, 1684891071309520, 40385998826085, 2006298934163466,
+      1183254236076430 },
+    { 467345837679854, 1079963287879203, 1289481776488924, 1138995482850167,
+      2090075574715802 },
+    { 2078945761664379, 416819824388135, 1807168813952296, 1829119498211340,
+      1104898017158901 } },
+  { { 935515906104687, 1207071825389422, 2027424072446041, 872722513859541,
+      1919104755183505 },
+    { 974225782733251, 1716712557000811, 2213523695428657, 637866107816352,
+      2046217619948135 },
+    { 1856027684240449, 277191080330797, 547803870712495, 1929436393972708,
+      2108273376021333 } },
+  { { 2193164114891658, 2202998446167377, 830394820264895, 1122473769367725,
+      1358275184077328 },
+    { 1713875475414688, 1485870843394126, 2156404008253540, 957659398385731,
+      670525812145269 },
+    { 1061223351362795, 167181581911539, 875970769411976, 408514155038427,
+      1364760473892018 } },
+  { { 1577111294832995, 1030899169768747, 144900916293530, 1964672592979567,
+      568390100955250 },
+    { 278388655910247, 487143369099838, 927762205508727, 181017540174210,
+      1616886700741287 },
+    { 1191033906638969, 940823957346562, 1606870843663445, 861684761499847,
+      658674867251089 } },
+  { { 706309251516769, 903123598445940, 1911114154957759, 365310359666426,
+      1410153181499189 },
+    { 1117369287008216, 1992718956994807, 1623092030697625, 1463250338147353,
+      330895921813728 },
+    { 1338054819421554, 196025573340191, 1003479620781913, 428165015011426,
+      172997912189104 } },
+  { { 1535127854114396, 215946570783199, 1630290306081261, 1238983383730599,
+      2100751563233476 },
+    { 1667316455431685, 649264929690552, 1018034262215239, 451277049704889,
+      1928747937105228 },
+    { 380961780389541, 2178338328468620, 742870124831160, 1911375771211225,
+      997508847257641 } },
+  { { 1638960350895601, 1032597264122281, 59455789804027, 774449845818253,
+      652693409939925 },
+    { 986696988414426, 520410762989103, 548822543218748, 1464796292781984,
+      534586647076034 },
+    { 412044957208638, 2013913097048832, 709192743692058, 1189608839037433,
+      136231478615625 } },
+  { { 1875032594195546, 1427106132796197, 724736390962158, 901860512044740,
+      635268497268760 },
+    { 622869792298357, 1903919278950367, 1922588621661629, 1520574711600434,
+      1087100760174640 },
+    { 25465949416618, 1693639527318811, 1526153382657203, 125943137857169,
+      145276964043999 } },
+  { { 491608792008238, 1747425420458448, 208978581350024, 1442594140897164,
+      101338865333173 },
+    { 1189738651986660, 748480464495258, 1229045436584832, 830628367791864,
+      797900747288538 },
+    { 2241042174611096, 516782778349986, 605966420024022, 1192302264152749,
+      813851846433235 } },
+  { { 297577126578919, 1171468310850627, 1272686373561523, 67198984587162,
+      834305680938946 },
+    { 994425208143260, 647089363286802, 2080075552945492, 2059513965148651,
+      2080019008023479 },
+    { 2021142845793295, 675163321442635, 1715741717739842, 2195656578860181,
+      1505117053438698 } },
+  { { 812426979538914, 1359792553972802, 1646363050250158, 1327973772287868,
+      1257661852521111 },
+    { 1961768095612626, 1096257457085002, 925774241590656, 354027094600942,
+      683840632669427 },
+    { 553378032971487, 2245203556393359, 1726830610251330, 1269145696941890,
+      1213931530146204 } },
+  { { 214739857969358, 920212862967915, 1939901550972269, 1211862791775221,
+      85097515720120 },
+    { 2006245852772938, 734762734836159, 254642929763427, 1406213292755966,
+      239303749517686 },
+    { 1619678837192149, 1919424032779215, 1357391272956794, 1525634040073113,
+      1310226789796241 } }
+},
+{ /* 23/51 */
+  { { 1367603834210841, 2131988646583224, 890353773628144, 1908908219165595,
+      270836895252891 },
+    { 597536315471731, 40375058742586, 1942256403956049, 1185484645495932,
+      312666282024145 },
+    { 1919411405316294, 1234508526402192, 1066863051997083, 1008444703737597,
+      1348810787701552 } },
+  { { 177691828723780, 1283094434250488, 1065039300161912, 1977830055676077,
+      423980805911273 },
+    { 748747339297832, 1135609155306207, 1823617401704634, 2112890298604997,
+      1132880422123891 },
+    { 2176454779743876, 931093459142961, 2244697379845986, 723779257225747,
+      962795008037376 } },
+  { { 3492977666438, 1059763912512158, 2123305335497043, 513064355848036,
+      373759872530947 },
+    { 838582957417862, 1207297738483933, 79142553546463, 1092187171093481,
+      740792244917716 },
+    { 106260719974760, 1846945220455408, 2057735991364521, 1360923495418445,
+      2137889229643639 } },
+  { { 1861517597691605, 1772481620932890, 377676625275392, 454027945773073,
+      2107910124630171 },
+    { 1912837811596353, 1062706188835521, 151816288759714, 1928975341682546,
+      1204168782841137 },
+    { 683279446283480, 2167544438614321, 1975855992985379, 780955320484514,
+      780910621778643 } },
+  { { 764546806494735, 63133868587300, 1680545904367578, 897400720645571,
+      1485527549217927 },
+    { 1571506109577703, 389342188608946, 469837775319265, 1236404830759152,
+      891460135838779 },
+    { 1668683573293370, 1020955303849177, 2113637355264643, 1774340245191049,
+      2013491246040446 } },
+  { { 434558441289919, 1927951543046986, 247887434587243, 1241163995738961,
+      526331455331708 },
+    { 1703744445643093, 2206438520188924, 1360590793044037, 2093233444244748,
+      605362476106795 },
+    { 1074884828909420, 432905047961772, 1185537826254838, 52144045776742,
+      1826277929133963 } },
+  { { 2033798102016229, 2186159521975438, 1491294849268915, 599832950582654,
+      1729705703908465 },
+    { 68241040374779, 1512656103874967, 1584985722358638, 2014424459439976,
+      1496682638282111 },
+    { 372468138489154, 2221369479079946, 1016798567240898, 788564472399102,
+      1195195590111771 } },
+  { { 2156715047802986, 1276772803921323, 128433708852190, 1960794365816569,
+      428584705572025 },
+    { 1180853732303989, 373577860927933, 170608019599358, 101879149800615,
+      226385074242609 },
+    { 1862177374063425, 1873700738552432, 308885709393483, 2100622082080360,
+      1104535253282502 } },
+  { { 223947462151105, 867206721895522, 221314718809572, 498543812509266,
+      1321641164409520 },
+    { 1392990233436086, 399124263442192, 976949108262476, 1061317344537969,
+      1129651932642903 },
+    { 1457098571606778, 1996521020823392, 1307294094256327, 595869530383055,
+      1951519145799084 } },
+  { { 1459840872562735, 421582154826229, 2220646689506683, 1208894292386914,
+      2152820272048462 },
+    { 1679349250090669, 2002629885813715, 2159329725118112, 1827787758857312,
+      351765134384947 },
+    { 1565335522994081, 54406341126738, 599331788389250, 1486039135212823,
+      940991227185565 } },
+  { { 522383608364912, 1784001230157243, 2186964597961869, 241822612601204,
+      506375202417218 },
+    { 1974460781934096, 1971569111353888, 588578184898580, 352696908741028,
+      1808098912705588 },
+    { 962831960919491, 1609679458564154, 1003348474056828, 1734645301275268,
+      124728942157964 } },
+  { { 1597264402054136, 1749721095022851, 1211432053366671, 1390398927836990,
+      1030072339730422 },
+    { 2146657684344428, 426155031380951, 1700774487052680, 2241243783258638,
+      801862184492916 },
+    { 225800753248600, 1001289196776939, 1570695157447337, 474142387326152,
+      1860241406570283 } },
+  { { 1768170464316882, 1928010869503709, 1238389854648654, 1661820602288917,
+      1234365278222420 },
+    { 1314366798126365, 2139773463213711, 936137977545162, 362686988399883,
+      508998220250320 },
+    { 1293490281163201, 439174853723017, 1582572930709784, 580149870240157,
+      904306967167253 } },
+  { { 1052973111938531, 571717070295127, 662638871434015, 487194242940400,
+      563864123356551 },
+    { 313768325663018, 1096387612893633, 232711817872390, 926931708861688,
+      2208373716341324 },
+    { 823857549390635, 2207592640971793, 1855512257490888, 1911413747439725,
+      1853809846918105 } },
+  { { 1171719750095443, 1226062873767669, 1776926194835425, 276684397588819,
+      1298061141117592 },
+    { 317534887386373, 1478752362415540, 691653599605466, 1164499421656505,
+      1582226508003071 },
+    { 1075390611627290, 2004890406331517, 1883659484385537, 10236539132297,
+      1276037348284315 } },
+  { { 2036109024667906, 788786007664495, 529185570326229, 1970818175728285,
+      716638820776172 },
+    { 1691119362383073, 1374233162940119, 1499830893630563, 2225901026600973,
+      949304629739203 },
+    { 695616701038646, 20368455765111, 619664083096696, 723635083382804,
+      1023760209767255 } }
+},
+{ /* 24/51 */
+  { { 2102881477513865, 1570274565945361, 1573617900503708, 18662635732583,
+      2232324307922098 },
+    { 1853931367696942, 8107973870707, 350214504129299, 775206934582587,
+      1752317649166792 },
+    { 1417148368003523, 721357181628282, 505725498207811, 373232277872983,
+      261634707184480 } },
+  { { 2186733281493267, 2250694917008620, 1014829812957440, 479998161452389,
+      83566193876474 },
+    { 1268116367301224, 560157088142809, 802626839600444, 2210189936605713,
+      1129993785579988 },
+    { 615183387352312, 917611676109240, 878893615973325, 978940963313282,
+      938686890583575 } },
+  { { 522024729211672, 1045059315315808, 1892245413707790, 1907891107684253,
+      2059998109500714 },
+    { 1799679152208884, 912132775900387, 25967768040979, 432130448590461,
+      274568990261996 },
+    { 98698809797682, 2144627600856209, 1907959298569602, 811491302610148,
+      1262481774981493 } },
+  { { 1791451399743152, 1713538728337276, 118349997257490, 1882306388849954,
+      158235232210248 },
+    { 1217809823321928, 2173947284933160, 1986927836272325, 1388114931125539,
+      12686131160169 },
+    { 1650875518872272, 1136263858253897, 1732115601395988, 734312880662190,
+      1252904681142109 } },
+  { { 372986456113865, 525430915458171, 2116279931702135, 501422713587815,
+      1907002872974925 },
+    { 803147181835288, 868941437997146, 316299302989663, 943495589630550,
+      571224287904572 },
+    { 227742695588364, 1776969298667369, 628602552821802, 457210915378118,
+      2041906378111140 } },
+  { { 815000523470260, 913085688728307, 1052060118271173, 1345536665214223,
+      541623413135555 },
+    { 1580216071604333, 1877997504342444, 857147161260913, 703522726778478,
+      2182763974211603 },
+    { 1870080310923419, 71988220958492, 1783225432016732, 615915287105016,
+      1035570475990230 } },
+  { { 730987750830150, 857613889540280, 1083813157271766, 1002817255970169,
+      1719228484436074 },
+    { 377616581647602, 1581980403078513, 804044118130621, 2034382823044191,
+      643844048472185 },
+    { 176957326463017, 1573744060478586, 528642225008045, 1816109618372371,
+      1515140189765006 } },
+  { { 1888911448245718, 1387110895611080, 1924503794066429, 1731539523700949,
+      2230378382645454 },
+    { 443392177002051, 233793396845137, 2199506622312416, 1011858706515937,
+      974676837063129 },
+    { 1846351103143623, 1949984838808427, 671247021915253, 1946756846184401,
+      1929296930380217 } },
+  { { 381355034133882, 121517988993168, 1975012837597447, 1280185854661457,
+      1002498273417023 },
+    { 2005892001358347, 83499497684844, 2127029513143904, 27184048741543,
+      584569873352834 },
+    { 1896123626988797, 1131351092678624, 1831358114864483, 1263257519094555,
+      153161823153575 } },
+  { { 624048240918892, 357280153851022, 969596300589996, 1330649045956929,
+      1828925625187427 },
+    { 510399560955873, 838451493226635, 1155275920204821, 489989960451518,
+      1166684509844369 },
+    { 85523512650066, 1145743424577874, 270900922559567, 1781500837265517,
+      1998986005265292 } },
+  { { 652428108160061, 2015564997958156, 1994336236107344, 2172724361186958,
+      602807242041445 },
+    { 2048515195716518, 116512496400958, 360961157331299, 800263965286847,
+      202949705751540 },
+    { 2127639189718319, 2205729457048157, 1849555339256920, 1751645797856968,
+      1883138982486949 } },
+  { { 762600272699983, 501698515094644, 1064616556970457, 526788695246362,
+      811067357256020 },
+    { 1738116206825469, 238341968077063, 710990074006746, 2099348516760835,
+      1176872657137975 },
+    { 1503368613839734, 2009362771486879, 495897391474535, 1905468005297555,
+      272387388531978 } },
+  { { 1830890930331384, 1576312455307437, 1643833878217310, 1105165451044480,
+      134942040296775 },
+    { 1309447273719093, 546833241593789, 201676040739723, 1944537215523573,
+      753556866822227 },
+    { 995710478389517, 1430833880042694, 1172677663947400, 1545257382741759,
+      1798260148494462 } },
+  { { 1276458355120913, 275388093173562, 1130163473530637, 1281375897896514,
+      2161750040536620 },
+    { 702250729336971, 183212241063726, 1113316565138576, 2243046267272772,
+      916046753452102 },
+    { 1025062667466023, 43711902086443, 2210112172846377, 233136450830559,
+      1412931651896051 } },
+  { { 196247865165891, 599053419172739, 828695260044478, 1198848441856845,
+      1359787207816262 },
+    { 1308541815353293, 41938375732191, 779669417711792, 313239720528728,
+      297947503568568 },
+    { 555971766815523, 2160228751293088, 266579216919501, 408880354152864,
+      2184471346102790 } },
+  { { 1895408474337392, 1335954976788533, 985141721217292, 126921816462693,
+      1461766309882915 },
+    { 1770583362798948, 2134249174371107, 1845225536958177, 623900187867507,
+      1068565274816080 },
+    { 1291953286798969, 2102679466898679, 1596002078575263, 1387588817990761,
+      2143444637427225 } }
+},
+{ /* 25/51 */
+  { { 520696289105719, 665438838768697, 1731727230740743, 2247887220248582,
+      2143609474706149 },
+    { 1493094934626749, 1179627985066790, 395613897622098, 353090108066162,
+      1901192209543475 },
+    { 923819152192005, 1415712944791087, 1125410698033067, 788009900900011,
+      869993295869018 } },
+  { { 1177246463904127, 236633799581924, 76678394799500, 1550430756969068,
+      92809245758469 },
+    { 2205646414116132, 1924280510925419, 2153130381296311, 1685372119895441,
+      1251264911209213 },
+    { 1519155588261854, 483899768651806, 1235345257217886, 467640517750393,
+      1224438957323827 } },
+  { { 737891874041407, 199889941827640, 720930115890536, 1153163677723625,
+      379353551150416 },
+    { 52463875264865, 1027608038151042, 1805698129344579, 3415274007095,
+      896582555813622 },
+    { 1021578499394252, 2003506226907156, 1906928204664703, 617432881327189,
+      487770381544088 } },
+  { { 629205712253447, 696219141060254, 2240941577462355, 167573388134812,
+      430353727713638 },
+    { 126346605636302, 787953954157654, 1019044033937394, 2068877580663841,
+      1651025896417965 },
+    { 948811544154236, 95827271348811, 971972540788513, 1752656910961976,
+      1577613288465037 } },
+  { { 1527437581330470, 280055925817045, 1076300728317329, 89902572950682,
+      2037036009072309 },
+    { 58914822906401, 1358560583594968, 1502986220031865, 1770551709901457,
+      1850282530786210 },
+    { 357187236460800, 1343207422743391, 1557831743447331, 138875622916216,
+      2073308474766668 } },
+  { { 1971880260906249, 339023149950609, 31371728610139, 888730652847271,
+      2069077006720618 },
+    { 1100737477396864, 1335503357080706, 67659044825564, 808920067298861,
+      287772348275842 },
+    { 986114249350619, 899447833294837, 753796294360457, 1686315816498457,
+      1484432111173806 } },
+  { { 339244995001665, 1760160432424305, 258343218401669, 900873257630653,
+      1381243383153778 },
+    { 2066388285289669, 1939175439520620, 549754232119060, 1372609658209854,
+      1231278190285729 },
+    { 1027887039599863, 645983151773049, 940633405940384, 791297293294468,
+      113951612418342 } },
+  { { 849646212452002, 1410198775302919, 73767886183695, 1641663456615812,
+      762256272452411 },
+    { 692017667358279, 723305578826727, 1638042139863265, 748219305990306,
+      334589200523901 },
+    { 22893968530686, 2235758574399251, 1661465835630252, 925707319443452,
+      1203475116966621 } },
+  { { 1919453806484998, 1103915041437510, 877365096350947, 532178363792336,
+      360260842514555 },
+    { 66523655872065, 257229387753089, 81105326031093, 2030504349873434,
+      388493409954615 },
+    { 398432002841251, 2097382035821216, 1272107887699961, 1696825652413751,
+      692387005924555 } },
+  { { 140038613601336, 2105687094653167, 1486630138237354, 124607255301142,
+      1256725970817237 },
+    { 1862475296576427, 624814639192685, 1339017047625035, 2179660911134907,
+      294596597410145 },
+    { 231504686987457, 2055416507943965, 574849064425067, 1758626897835009,
+      1664390322568157 } },
+  { { 409889181587051, 689787456759356, 1321642317818892, 506883787581889,
+      144584472382836 },
+    { 955467635681247, 1038976921074141, 1409573754063213, 2201173169034971,
+      207785161390444 },
+    { 858095673245566, 1691973813552377, 1965144506075193, 2208509537716678,
+      1428298191594852 } },
+  { { 1843651654233645, 505572466358294, 1753916797941971, 881484632531640,
+      1434888313682225 },
+    { 650384728362688, 1463587645627221, 2172988021784277, 1621073161692303,
+      2086498606871480 },
+    { 1619136765217710, 573470295197364, 1341941638051488, 253646158708694,
+      894404841895825 } },
+  { { 1769535842284272, 547256763749804, 2094332619048139, 2116425241152066,
+      1878072535960388 },
+    { 403435473973828, 789245990654822, 3613462722370, 1652821931562421,
+      384999803304689 },
+    { 565310835646672, 1460124433556313, 857253992890882, 650889256013482,
+      2183303892004710 } },
+  { { 294074809388072, 653022917600541, 161478685393176, 1226620322415825,
+      1277277938746649 },
+    { 870451464236228, 1226348901528229, 1275987458850801, 598987823919543,
+      583836909978776 },
+    { 445824573251743, 790816418422983, 1156443783989921, 887592740883166,
+      1545867111728555 } },
+  { { 966228910959877, 284490218578334, 1891992141015256, 1954034859146107,
+      768576718449541 },
+    { 997184807887642, 860351713014736, 2208286454026124, 2058804388927980,
+      1328473053716547 },
+    { 1694567623598406, 378686244035083, 1446043257835588, 2086730085188974,
+      1755635156163547 } },
+  { { 801299035785166, 1733292596726131, 1664508947088596, 467749120991922,
+      1647498584535623 },
+    { 903105258014366, 427141894933047, 561187017169777, 1884330244401954,
+      1914145708422219 },
+    { 1344191060517578, 1960935031767890, 1518838929955259, 1781502350597190,
+      1564784025565682 } }
+},
+{ /* 26/51 */
+  { { 271413961212179, 1353052061471651, 344711291283483, 2014925838520662,
+      2006221033113941 },
+    { 194583029968109, 514316781467765, 829677956235672, 1676415686873082,
+      810104584395840 },
+    { 1980510813313589, 1948645276483975, 152063780665900, 129968026417582,
+      256984195613935 } },
+  { { 1364621558265400, 1512388234908357, 1926731583198686, 2041482526432505,
+      920401122333774 },
+    { 1884844597333588, 601480070269079, 620203503079537, 1079527400117915,
+      1202076693132015 },
+    { 840922919763324, 727955812569642, 1303406629750194, 522898432152867,
+      294161410441865 } },
+  { { 808958715657431, 535960365684029, 560954557362549, 857395349585760,
+      922421985880169 },
+    { 599374483754862, 849006014614117, 2003053353607252, 1915076208941392,
+      189258423364169 },
+    { 1970356456788069, 1887106101566224, 2120741856788965, 1887465058487327,
+      166078852378175 } },
+  { { 1370912655100576, 28079262268111, 1535348789227131, 2242808749632369,
+      809642652295670 },
+    { 635991163691045, 570696406791013, 1609311709579718, 2034994939683182,
+      109989835041421 },
+    { 2128769772677977, 2142654242576520, 2016094652496998, 2132031230853467,
+      725434888027655 } },
+  { { 1754011114902342, 1412555657059790, 396104406402672, 38004008261123,
+      1625818784604548 },
+    { 1495850063352271, 668975197051914, 2065738832148257, 2030730567027161,
+      1400458471245021 },
+    { 1402433259125399, 542534891585658, 1215616393227078, 710196562400792,
+      306411035739055 } },
+  { { 336776966215760, 891392900539282, 239694810077395, 1972075498322545,
+      1912294604686715 },
+    { 1950601948212002, 2168476417486635, 576695936777704, 491248572731813,
+      1239724977676433 },
+    { 1833902199612236, 1936506556601833, 638510767562956, 2246407720069552,
+      2176643306867318 } },
+  { { 937874669026162, 800393277818670, 1266069468786691, 41417158564491,
+      2118488848214880 },
+    { 164005522423211, 317510693512490, 974608878840600, 33149043102477,
+      143708957409749 },
+    { 1490670543286601, 430568445984086, 585334374798343, 1745655864263916,
+      2134786216754222 } },
+  { { 2135073895739904, 1220642636112600, 1493509767807811, 1591839321329741,
+      1420071562059335 },
+    { 174203991396502, 770330841919696, 114371198672236, 1881281468795601,
+      79711356135445 },
+    { 1420603492551010, 679640550295814, 1617533903828801, 780154362635607,
+      1319780020899258 } },
+  { { 1595829256594686, 1914383836820299, 1922108176128921, 1211373143982220,
+      1580960353653125 },
+    { 1740729400681481, 1000429543436473, 1184259921493104, 1397075383883590,
+      1410526166628778 },
+    { 1722600034150460, 714845970096063, 1831107608794153, 1639437371802418,
+      1220490468485613 } },
+  { { 1765261809717466, 466014340570387, 1797681172978490, 1641912452244201,
+      40480733704652 },
+    { 1183490764738018, 1144576483538494, 357664143214093, 2048437324584307,
+      570764096014866 },
+    { 1324913735660836, 1780078730736800, 646879243983054, 676686368473452,
+      511548109776165 } },
+  { { 812944356405581, 1233328488262348, 2108459085024140, 1297889368538326,
+      942841728379898 },
+    { 777758421708838, 581055197318378, 601152807529804, 63937311507036,
+      1996745089755639 },
+    { 955419195962176, 148872587307355, 729445435686292, 2198313217932414,
+      1960359921350383 } },
+  { { 1443775398367956, 342649786021856, 491131145750945, 1161286236132679,
+      93221155048400 },
+    { 1685268313866105, 1091225057981324, 34738159867818, 1271578597078582,
+      933514586691351 },
+    { 194815921686333, 1256736762545940, 1408742447743650, 304562218341097,
+      2021464306176092 } },
+  { { 2081553424693574, 1987056468954746, 1355157044015672, 2086067500750093,
+      412214048259429 },
+    { 505468987109327, 2216983295022076, 1302378085121841, 1968348007944917,
+      450577481421464 },
+    { 2202930745260826, 2008297733323650, 2046253285222993, 1298134350748731,
+      134766833983364 } },
+  { { 627147299378105, 40948281875403, 1718874445886171, 1671656465729548,
+      1034831387866985 },
+    { 2063654282459101, 322618584522232, 1024908517705867, 1720749579766676,
+      1574407442838240 },
+    { 1594302786695407, 200904087716968, 1756225997348461, 1636782017753755,
+      830525839338811 } },
+  { { 2024222335824840, 198693876714545, 1298751258995829, 515968786019213,
+      61974934460123 },
+    { 681749003004951, 1941315835305904, 2070229014363911, 1374746952347758,
+      798833944119951 },
+    { 2229526303558773, 1928596485526016, 1381392825893124, 1461224479022449,
+      359109749545724 } },
+  { { 507963256544514, 472375505174555, 779257878153691, 1179390009947662,
+      709717330654464 },
+    { 960423152600264, 1015052059094369, 2084933873716193, 291273183388512,
+      2172369805610215 },
+    { 440075250919582, 694825884103652, 2159700403414911, 116894270435230,
+      1425927073727904 } }
+},
+{ /* 27/51 */
+  { { 111282977120126, 1990957989315238, 417960004432922, 1082016561159722,
+      1325118659202749 },
+    { 1473525133658734, 34732346162721, 1029920254545173, 1228101358414801,
+      152805623267113 },
+    { 183359648873960, 382111728086623, 1969766109298473, 2071169946252387,
+      242935538497060 } },
+  { { 353760790835310, 1598361541848743, 1122905698202299, 1922533590158905,
+      419107700666580 },
+    { 359856369838236, 180914355488683, 861726472646627, 218807937262986,
+      575626773232501 },
+    { 755467689082474, 909202735047934, 730078068932500, 936309075711518,
+      2007798262842972 } },
+  { { 2044418771947283, 1137094168476104, 323912222553973, 1943788899763338,
+      746421807501861 },
+    { 1411497898568181, 399420692247978, 540440536963598, 181015667700355,
+      260685987331482 },
+    { 1133896940055680, 1865936174280211, 535310246883206, 84910882736996,
+      1172128477027922 } },
+  { { 1609384177904073, 362745185608627, 1335318541768201, 800965770436248,
+      547877979267412 },
+    { 984339177776787, 815727786505884, 1645154585713747, 1659074964378553,
+      1686601651984156 },
+    { 1697863093781930, 599794399429786, 1104556219769607, 830560774794755,
+      12812858601017 } },
+  { { 1452963869152447, 923040334083434, 1821414296024964, 742274868547916,
+      1750054097533544 },
+    { 799045138428743, 2016209575988247, 881135007120035, 237045464469793,
+      2123723942938383 },
+    { 255139741703673, 68532735059505, 1804300395977128, 1276926533893234,
+      238862678630831 } },
+  { { 1168737550514982, 897832437380552, 463140296333799, 302564600022547,
+      2008360505135501 },
+    { 1856930662813910, 678090852002597, 1920179140755167, 1259527833759868,
+      55540971895511 },
+    { 1158643631044921, 476554103621892, 178447851439725, 1305025542653569,
+      103433927680625 } },
+  { { 47261649927551, 320172823339715, 1369197892732769, 1203331337140895,
+      2145844905336690 },
+    { 2244614480939516, 181749056157615, 901673748193205, 2174504854833975,
+      336442196343735 },
+    { 298613843221864, 1970488850664642, 1298125570752135, 2055638864293920,
+      1665149183748753 } },
+  { { 2176793111709008, 1576725716350391, 2009350167273523, 2012390194631546,
+      2125297410909580 },
+    { 825403285195098, 2144208587560784, 1925552004644643, 1915177840006985,
+      1015952128947864 },
+    { 1807108316634472, 1534392066433717, 347342975407218, 1153820745616376,
+      7375003497471 } },
+  { { 2043096363231953, 148850043182089, 243560026093757, 470311532007161,
+      2056341427512775 },
+    { 1187929582485422, 1227204986795386, 1406265140781361, 596570020634092,
+      91190050554427 },
+    { 237419283685245, 1859574645049978, 1854593261476970, 587420999752657,
+      230566390089626 } },
+  { { 983061001799725, 431211889901241, 2201903782961093, 817393911064341,
+      2214616493042167 },
+    { 228567918409756, 865093958780220, 358083886450556, 159617889659320,
+      1360637926292598 },
+    { 234147501399755, 2229469128637390, 2175289352258889, 1397401514549353,
+      1885288963089922 } },
+  { { 472505521542177, 2143703992249266, 1989824958759928, 965340591442201,
+      898342270140929 },
+    { 118178146367198, 2156251713979123, 814974962230411, 1129495688396497,
+      1991627366008986 },
+    { 178597662029755, 1651716674881924, 1242386420811082, 2022134452064757,
+      1140925514190594 } },
+  { { 1111762412951562, 252849572507389, 1048714233823341, 146111095601446,
+      1237505378776770 },
+    { 1113790697840279, 1051167139966244, 1045930658550944, 2011366241542643,
+      1686166824620755 },
+    { 1054097349305049, 1872495070333352, 182121071220717, 1064378906787311,
+      100273572924182 } },
+  { { 1325589031550405, 2018826140395015, 2160271716407449, 1360817276321147,
+      1190090637981302 },
+    { 497212662071802, 356191353380849, 602401875790523, 1791352156333086,
+      2022970746678915 },
+    { 2059353772005951, 1845003238535246, 1680522325267043, 467691405624051,
+      143452758396446 } },
+  { { 1306410853171605, 1627717417672447, 50983221088417, 1109249951172250,
+      870201789081392 },
+    { 104233794644221, 1548919791188248, 2224541913267306, 2054909377116478,
+      1043803389015153 },
+    { 216762189468802, 707284285441622, 190678557969733, 973969342604308,
+      1403009538434867 } },
+  { { 1773058067651578, 2055118515680897, 1242201662420419, 1596594966994651,
+      2201278189470362 },
+    { 1936359176203773, 103984319446946, 1605615078170471, 1943878853244023,
+      472714482792070 },
+    { 1035542555079216, 1266231739037902, 2058634826430326, 1339874924402280,
+      541552416517288 } },
+  { { 1279024291038477, 344776835218310, 273722096017199, 1834200436811442,
+      634517197663804 },
+    { 343805853118335, 1302216857414201, 566872543223541, 2051138939539004,
+      321428858384280 },
+    { 470067171324852, 1618629234173951, 2000092177515639, 7307679772789,
+      1117521120249968 } }
+},
+{ /* 28/51 */
+  { { 2216608521812979, 1133671267609171, 1886801270451833, 693723450681229,
+      2177664326279079 },
+    { 1217176410618852, 1156758041567635, 584945597615208, 401700658526440,
+      188718999318719 },
+    { 2233307833752057, 720411965215730, 1519169695491573, 1249545629073374,
+      42274079495163 } },
+  { { 1028220431149045, 1318628129209811, 867598555050648, 391516159010623,
+      618793687544686 },
+    { 785648940778980, 1566075695368470, 2205885851017647, 372501423919883,
+      2042694981038794 },
+    { 354305362086679, 1512134460741612, 359672307646707, 182487842123724,
+      70434142068276 } },
+  { { 1024824838093574, 182044951578079, 539066115399189, 1963658167580139,
+      888614446782442 },
+    { 1693757839885659, 836292189541753, 950751758815067, 982651358735092,
+      221102476905845 },
+    { 46706548238824, 1986500518838735, 2027136585204085, 1143580830274421,
+      237034819567290 } },
+  { { 1210457740468652, 2215903401275260, 1545855048122212, 1560256833448838,
+      235678314205821 },
+    { 1677629762901748, 541583930343398, 1383717393793391, 951594759624156,
+      166785376717098 },
+    { 1032532177573683, 1507169914894481, 893954872249259, 1464210961075811,
+      2248024514969267 } },
+  { { 2215196432839229, 1453988298479780, 911159768469061, 1417180860727486,
+      1916001465630095 },
+    { 266073750133030, 1063660218646657, 2001496173067453, 1054570510340478,
+      1787320193554613 },
+    { 1593076635649167, 613414152324278, 1398118686752976, 1550186634066418,
+      2024312475795755 } },
+  { { 1611115816843085, 1564686497935112, 379643685080005, 291591976378398,
+      1070282314438177 },
+    { 20428272805067, 344278789324198, 839609851549831, 358979365865884,
+      847000176814724 },
+    { 1370619542022553, 13593976629245, 670888839522668, 29909561835083,
+      1113994299778657 } },
+  { { 210667856729798, 832581000901195, 979195344857408, 761623507948939,
+      102316955504785 },
+    { 743880451641798, 738115538583549, 1701458888198429, 1737802518950586,
+      1702048374090090 },
+    { 1653806661942935, 798938977173667, 1204504651898865, 2012775328403335,
+      959133953735021 } },
+  { { 1056291284182974, 186371978807430, 666572176305850, 2221533064225315,
+      1302577527793701 },
+    { 484740628192045, 1747162484279003, 1958227960728501, 2029226260228924,
+      1872489756569532 },
+    { 2246982488380161, 704048527252770, 449031029656446, 2000971659049725,
+      1830758195793359 } },
+  { { 800470433913435, 672404056812, 182281358307082, 420997384243032,
+      351090837625276 },
+    { 938875748136569, 2219220429343996, 514799483708317, 1488024780300031,
+      1997480530156815 },
+    { 2144671346446832, 542864631780587, 1155108742000404, 1404732713614448,
+      240293866423412 } },
+  { { 1307308592059221, 784383479594685, 1720750519626457, 1912081034355222,
+      2024784929774716 },
+    { 617781795775109, 330273540233799, 1776373520427011, 1020434679511389,
+      1726962726506212 },
+    { 22174994285057, 375276401373336, 1210941030392323, 1903374444438123,
+      1011323371888298 } },
+  { { 746994751609738, 2057935584763382, 647777410123614, 1519188817940760,
+      1842063844888831 },
+    { 294871001888273, 1688193754070267, 1716062938944823, 1038532713134574,
+      809665108008140 },
+    { 892208073348264, 1880270486117637, 1866139692669281, 577642276098528,
+      159304923876906 } },
+  { { 867017597014674, 1416293682313137, 1358642285736990, 1764897881567575,
+      1533248549446374 },
+    { 97434005500231, 1295654269286564, 1275504419230110, 1966673568091831,
+      562696536595372 },
+    { 841452637470330, 509851329084465, 315943768852800, 745051417948746,
+      1317978823624451 } },
+  { { 2216474880678668, 1883045416719140, 1305295773582612, 162452308176835,
+      767818455443584 },
+    { 708924451360549, 1329610096862545, 253976285864925, 1506333312168430,
+      221876871239889 },
+    { 1790146986408439, 1266311794146205, 923857310756466, 2043374401317120,
+      726369229085659 } },
+  { { 1047639500605479, 1016683765780036, 2206428670313251, 1688287562131353,
+      1668007864663417 },
+    { 374712944226317, 1970995153845960, 1069877565474913, 1154794696991644,
+      239532478102658 },
+    { 1777656298881359, 367886496899263, 1134571758927624, 161297709883194,
+      864111924164392 } },
+  { { 1207697025811178, 1172866796116673, 2087657719164010, 1359779659817200,
+      2226199443508324 },
+    { 267038019739146, 852980691069616, 1952810457772992, 748363570639034,
+      109263490233305 },
+    { 179962092093812, 1434865358203901, 1509301171184812, 465007053005824,
+      1606826267425619 } },
+  { { 278151578291475, 1810282338562947, 1771599529530998, 1383659409671631,
+      685373414471841 },
+    { 577009397403102, 1791440261786291, 2177643735971638, 174546149911960,
+      1412505077782326 },
+    { 893719721537457, 1201282458018197, 1522349501711173, 58011597740583,
+      1130406465887139 } }
+},
+{ /* 29/51 */
+  { { 412607348255453, 1280455764199780, 2233277987330768, 14180080401665,
+      331584698417165 },
+    { 262483770854550, 990511055108216, 526885552771698, 571664396646158,
+      354086190278723 },
+    { 1820352417585487, 24495617171480, 1547899057533253, 10041836186225,
+      480457105094042 } },
+  { { 544644538748041, 1039872944430374, 876750409130610, 710657711326551,
+      1216952687484972 },
+    { 58242421545916, 2035812695641843, 2118491866122923, 1191684463816273,
+      46921517454099 },
+    { 272268252444639, 1374166457774292, 2230115177009552, 1053149803909880,
+      1354288411641016 } },
+  { { 754558365378305, 1712186480903618, 1703656826337531, 750310918489786,
+      518996040250900 },
+    { 1309847803895382, 1462151862813074, 211370866671570, 1544595152703681,
+      1027691798954090 },
+    { 803217563745370, 1884799722343599, 1357706345069218, 2244955901722095,
+      730869460037413 } },
+  { { 1607325776830197, 530883941415333, 1451089452727895, 1581691157083423,
+      496100432831154 },
+    { 1068900648804224, 2006891997072550, 1134049269345549, 1638760646180091,
+      2055396084625778 },
+    { 2222475519314561, 1870703901472013, 1884051508440561, 1344072275216753,
+      1318025677799069 } },
+  { { 296797112183500, 410335886380581, 2088163736824993, 80181646990783,
+      519325390204892 },
+    { 684769355780495, 1545614889562591, 1460134279430146, 1979627287122125,
+      349447439464334 },
+    { 780634400476978, 637764048158951, 901014587909154, 1354805333992459,
+      2018934308296179 } },
+  { { 1495282016474960, 1520760409479970, 1598412209810121, 1654404133831532,
+      437659257098574 },
+    { 415936726797299, 339445176878789, 202330884186963, 759090415375120,
+      2135184812291592 },
+    { 744124236937047, 1544378156616778, 715829909389559, 2120659842894185,
+      72002654880101 } },
+  { { 131916631969425, 593701291679001, 927474828233236, 2181012191586749,
+      1803624299237656 },
+    { 901042737134897, 1830184914724277, 1002459936966372, 100729552387365,
+      2219638930340248 },
+    { 1792270341351139, 2065266134997868, 51895527839218, 798734893906822,
+      992253836606399 } },
+  { { 477207916553285, 1488064260202941, 1661453866463954, 1141228074051855,
+      672072650786576 },
+    { 2069770607401591, 1225367702112866, 1538953132048656, 2188401482212846,
+      128593173278991 },
+    { 916404312971536, 1000014350915647, 1498754584389763, 67530592482209,
+      1667646385756724 } },
+  { { 1403411457853039, 113211710311463, 1327199045320283, 696758733701164,
+      1419284563835793 },
+    { 2176255973803443, 327060820916877, 941749422699781, 372792681007725,
+      445216307755062 },
+    { 1857092696041333, 1724512262736770, 287297305864829, 1586610933942813,
+      1494183109763809 } },
+  { { 572547411991674, 1718361760835346, 869848195892273, 1134847104231068,
+      1674131234697561 },
+    { 1149478890099079, 722810946188148, 1918531526527787, 512306135938238,
+      1127986822393381 },
+    { 226110855638231, 1443215750878791, 270826887833993, 1369247691967551,
+      1438798261889144 } },
+  { { 1497123942919936, 955947819659147, 555057731533385, 1901101482594949,
+      634798464356189 },
+    { 207258149610922, 1682368460024387, 236009785883626, 2123667930675261,
+      2022659325456278 },
+    { 2089085858811487, 626453377900764, 2129042346711368, 1569893277904764,
+      1856813658038321 } },
+  { { 787506410562729, 999383806230137, 1189427749179644, 1543029117464542,
+      1165375133706142 },
+    { 1064478155201276, 2146644325358098, 1195222415385787, 1542741035137784,
+      1868638542232099 },
+    { 1807463069356454, 1073631843165438, 1913431796074714, 1933702437545480,
+      1859393001784609 } },
+  { { 1160476269327365, 50267586770404, 992568363091739, 2207936446812663,
+      213795171335862 },
+    { 1668705743439101, 1309509953628126, 1597427470637562, 2078585482257755,
+      1338499919869316 },
+    { 611084371402838, 907856546426870, 1024823153539692, 1778919615886950,
+      1092449916509002 } },
+  { { 714547180912214, 866689960630785, 943533238361143, 971026434464219,
+      1393368331326044 },
+    { 240142072841043, 163726490524985, 372775859438918, 93749670769173,
+      405118039875084 },
+    { 1205257181872918, 149703658022768, 828522135485836, 582352806879956,
+      1652631681470928 } },
+  { { 67700281865071, 1631757700524378, 1233107048854013, 1980385962668754,
+      2109591367455336 },
+    { 1821010761471636, 2039504038986003, 2008257653566116, 603319945218984,
+      1780841957442779 },
+    { 472388788575038, 639013188017259, 611943260636831, 1542893928291149,
+      2035468143202164 } },
+  { { 810369747020183, 2237618141036509, 30441627290829, 396142955464533,
+      62356642942044 },
+    { 1586711819320142, 815259294495906, 1356055059989454, 14254368880198,
+      988334017759084 },
+    { 498205650210982, 2029447832739442, 1287708517665602, 2063154761502015,
+      592549403529808 } }
+},
+{ /* 30/51 */
+  { { 394133855270478, 1022205784206132, 404819328296271, 1746214054851431,
+      801232833816448 },
+    { 1273141653286537, 600137967440787, 1108281665285822, 1607794127357251,
+      276080397056360 },
+    { 1625278703177771, 652272403287866, 1130860155562117, 1467718191751280,
+      170296377586353 } },
+  { { 1386180360119611, 1021274801195911, 1729880193705624, 2228606406348098,
+      1592392117444361 },
+    { 1689247777141059, 1987892221330336, 2238604025082286, 2061272829606697,
+      166862139432161 },
+    { 419731549689034, 1989626747750813, 1591278351630992, 1092786235861584,
+      177178675215960 } },
+  { { 874026063340854, 581394977884979, 554076247399451, 1693301763657948,
+      1873084195329208 },
+    { 6932090905729, 522370684247211, 2046750441884777, 198865291867578,
+      902267487290513 },
+    { 262642087469467, 394043452244726, 1877384193205089, 135064540003798,
+      932774458922892 } },
+  { { 155711679280656, 681100400509288, 389811735211209, 2135723811340709,
+      408733211204125 },
+    { 7813206966729, 194444201427550, 2071405409526507, 1065605076176312,
+      1645486789731291 },
+    { 16625790644959, 1647648827778410, 1579910185572704, 436452271048548,
+      121070048451050 } },
+  { { 571579876968632, 58797045989456, 1350176454179621, 342380021599803,
+      523609628126150 },
+    { 1501292725409308, 1238219522811892, 1552584937846753, 21794772566842,
+      1668786749206159 },
+    { 1923863876155286, 122199335211043, 1002707948758226, 36987619026769,
+      1150638264204758 } },
+  { { 1536097914487694, 1844505177101959, 1940885571305988, 1318446623468144,
+      1782894874034435 },
+    { 359951720530493, 43082453634541, 1257387399987992, 1812153804530322,
+      1702380259675676 },
+    { 1102198410065990, 2035958901082211, 663166579998017, 1280637581527414,
+      1834499895467312 } },
+  { { 586429640549219, 727606559420435, 1917560201809397, 1908489428490361,
+      803951954024708 },
+    { 1818874955050134, 2112640611543001, 1089194231603048, 648731096307394,
+      738240185226130 },
+    { 1297307734104486, 514187407473541, 1142383366347439, 531634506139746,
+      1603029940958430 } },
+  { { 1037263028552531, 568385780377829, 297953104144430, 1558584511931211,
+      2238221839292471 },
+    { 190565267697443, 672855706028058, 338796554369226, 337687268493904,
+      853246848691734 },
+    { 1763863028400139, 766498079432444, 1321118624818005, 69494294452268,
+      858786744165651 } },
+  { { 1907069441651104, 1553711702512373, 473673097773862, 1604344656451092,
+      1336905783950647 },
+    { 1681774815694295, 2368021108385, 348992161183226, 1944478486218296,
+      857526520836042 },
+    { 102687015928577, 704881233335847, 1821632459294712, 2241392167752086,
+      1756104171567289 } },
+  { { 368398655453847, 333745524646407, 653018818666239, 473366099464459,
+      570748713924715 },
+    { 2012503180736128, 1792315901656051, 1638756101860944, 423188131261520,
+      18691678230220 },
+    { 484344170797270, 1652682192070061, 851471825469954, 104376581681327,
+      180407874320785 } },
+  { { 94193764961673, 348487513405028, 2102797924162251, 2057790672735443,
+      1135022778581553 },
+    { 2212537369106131, 168056602082847, 850727966217538, 1334032445279205,
+      1954183215378874 },
+    { 1728117201567932, 1739767900202897, 2205333359753896, 1438103274967585,
+      1266651910298729 } },
+  { { 1292056768563024, 1456632109855638, 1100631247050184, 1386133165675321,
+      1232898350193752 },
+    { 366253102478259, 525676242508811, 1449610995265438, 1183300845322183,
+      185960306491545 },
+    { 28315355815982, 460422265558930, 1799675876678724, 1969256312504498,
+      1051823843138725 } },
+  { { 1935886106829149, 2124897705472473, 2183559664845685, 933798861657046,
+      2202504692241716 },
+    { 2043986259501968, 406218654486756, 1018408934859520, 1685727871997643,
+      900128405662108 },
+    { 1543736400146726, 809836145816917, 131615030311544, 1077644683422280,
+      1123541831087698 } },
+  { { 2244699475507971, 1961013703894917, 640654552204415, 1754829361909331,
+      1541140264027566 },
+    { 1099290108726274, 1541115973733393, 601197479661025, 1764621609824539,
+      1444181436548624 },
+    { 1038004499849138, 707540882141177, 1576365896690443, 2011328691034939,
+      25914862630834 } },
+  { { 1007313487333142, 1264528921249923, 291687873686320, 1962794999659014,
+      253465329246667 },
+    { 1957658575268486, 118295248511609, 249938722508612, 1558182223024144,
+      1059938522368481 },
+    { 1321965603743307, 435260719621130, 247595971200, 1174632212579447,
+      1663837356122307 } },
+  { { 156914999361983, 1606148405719949, 1665208410108430, 317643278692271,
+      1383783705665320 },
+    { 54684536365732, 2210010038536222, 1194984798155308, 535239027773705,
+      1516355079301361 },
+    { 1484387703771650, 198537510937949, 2186282186359116, 617687444857508,
+      647477376402122 } }
+},
+{ /* 31/51 */
+  { { 107077591595359, 884959942172345, 27306869797400, 2224911448949390,
+      964352058245223 },
+    { 1730194207717538, 431790042319772, 1831515233279467, 1372080552768581,
+      1074513929381760 },
+    { 1450880638731607, 1019861580989005, 1229729455116861, 1174945729836143,
+      826083146840706 } },
+  { { 1185838263017961, 1658025814770644, 412614687917606, 2015508295646823,
+      715217716364667 },
+    { 1481646966443338, 466715278381335, 1774539570883972, 288554375125960,
+      1219982066342679 },
+    { 1569664128884381, 407663338845983, 2002256010544711, 671085899312035,
+      984282527793076 } },
+  { { 1573454056174313, 1055924246289468, 797162505941524, 131630855807654,
+      2058301940709053 },
+    { 2021500347173012, 169210404836628, 1396272255177601, 1330647643563917,
+      418085517179246 },
+    { 1743343488610674, 1917111794467890, 1232422311515032, 331885313209344,
+      1157120228894105 } },
+  { { 322516746875165, 79424149775986, 290872190809355, 923053834242184,
+      852824612935969 },
+    { 1837729354575368, 1806927222817205, 772071460769486, 1075261054203712,
+      272300877743610 },
+    { 946711433665760, 2239987349934557, 803861660898522, 2156551410386926,
+      1502787654920122 } },
+  { { 27311069466271, 1120757683817857, 2075892134012677, 265558970209809,
+      1618706637820537 },
+    { 318600204541135, 2154650401144826, 1541605518077685, 1241668655049359,
+      1637887775786401 },
+    { 1120548233256728, 2228793504111366, 747671419916807, 1751013192745626,
+      537498208085315 } },
+  { { 1002763931894790, 2216555692070697, 1092592077852813, 2095372815347837,
+      831620519830306 },
+    { 933979342100663, 1447579579388357, 744931334263945, 1922902624484262,
+      1957904221232842 },
+    { 2050669866355306, 2190774465449013, 2058969733807763, 270320273862327,
+      1870514939355617 } },
+  { { 1143318020183474, 2056720379079599, 1644110224803923, 1472375672823466,
+      1119074676061976 },
+    { 1157154374890382, 2078807758614162, 181633350489802, 1960990010471818,
+      174624961024384 },
+    { 47710495519909, 1374057683560306, 557401701309034, 1644281017011007,
+      1705095999123845 } },
+  { { 1975814150439887, 898075979342335, 1261444197722907, 508629827289513,
+      1552966352555280 },
+    { 652257990405769, 2146188399812219, 991910114432277, 1441046103324288,
+      269464123586741 },
+    { 1633514016507671, 758793436105214, 1666766843388618, 1223902548045585,
+      233185566290059 } },
+  { { 952228858749703, 1555806596798215, 150916205609320, 1767214287745290,
+      1024892217780368 },
+    { 1731816971569424, 909192508261235, 284503268064411, 96193362738724,
+      2028565131303208 },
+    { 2182214619457686, 609961069349186, 1516016988699777, 381954525695265,
+      1045708021335830 } },
+  { { 117175990536680, 205242142019633, 1624416971413677, 563819279426049,
+      1423562576573628 },
+    { 1832224409155062, 1433153761769974, 2221777649495288, 403216383897423,
+      1835854244426528 },
+    { 2039348563488973, 248927546652694, 729506739622176, 397171022735714,
+      1644628056647629 } },
+  { { 1320782895094478, 159712244604577, 2046085675339149, 1217005025814426,
+      1120567067786351 },
+    { 1401383158209737, 415919737503422, 660239968641139, 1910958740718254,
+      2176847445197788 },
+    { 2053768625287362, 968179984351401, 1040367383834379, 2173244500002875,
+      1883637689737999 } },
+  { { 282843384358242, 819262945764986, 1435968129823677, 594097030236782,
+      2123224284522922 },
+    { 922213134544802, 1558729975805415, 545733826452503, 1871955716617573,
+      1112039957894281 },
+    { 1869384197190792, 1569592234203114, 2196362163965849, 1717386471659459,
+      39685498183014 } },
+  { { 936391654114277, 1128990034202749, 1010757570459668, 1032923189697175,
+      594336305763914 },
+    { 1868108367142692, 1319899388000850, 1349873111752185, 2185716506382645,
+      887212485056580 },
+    { 1465486333745401, 734849272933664, 1939100176959530, 135835886068875,
+      2238510171341344 } },
+  { { 1421109370612225, 24542237345030, 1620731107586927, 264254102429506,
+      1357365806509466 },
+    { 131935548103652, 101931348851158, 1207001294934204, 367655431725731,
+      1256859454639685 },
+    { 985026127753438, 120648499984234, 3776067837201, 1121956503069595,
+      1317952564469757 } },
+  { { 1074997799475097, 421242600292364, 889871805036696, 1628966582739389,
+      165284461583547 },
+    { 38531045368716, 1259554843643475, 1565490548586813, 376954731391301,
+      1026817082548253 },
+    { 582336772478516, 896103341257036, 742602230046634, 2053350903602944,
+      2208761663140133 } },
+  { { 339460334668018, 1004239686397252, 1203428024902644, 1634973881827916,
+      77943558028425 },
+    { 19371390465932, 184228893567174, 1200073564252783, 688999569396420,
+      535206532329522 },
+    { 1781496335107774, 734939096367772, 1979958937781877, 860043149833798,
+      2198713547814584 } }
+},
+{ /* 32/51 */
+  { { 1899935429242705, 1602068751520477, 940583196550370, 82431069053859,
+      1540863155745696 },
+    { 2136688454840028, 2099509000964294, 1690800495246475, 1217643678575476,
+      828720645084218 },
+    { 765548025667841, 462473984016099, 998061409979798, 546353034089527,
+      2212508972466858 } },
+  { { 46575283771160, 892570971573071, 1281983193144090, 1491520128287375,
+      75847005908304 },
+    { 1801436127943107, 1734436817907890, 1268728090345068, 167003097070711,
+      2233597765834956 },
+    { 1997562060465113, 1048700225534011, 7615603985628, 1855310849546841,
+      2242557647635213 } },
+  { { 1161017320376250, 492624580169043, 2169815802355237, 976496781732542,
+      1770879511019629 },
+    { 1357044908364776, 729130645262438, 1762469072918979, 1365633616878458,
+      181282906404941 },
+    { 1080413443139865, 1155205815510486, 1848782073549786, 622566975152580,
+      124965574467971 } },
+  { { 1184526762066993, 247622751762817, 692129017206356, 820018689412496,
+      2188697339828085 },
+    { 2020536369003019, 202261491735136, 1053169669150884, 2056531979272544,
+      778165514694311 },
+    { 237404399610207, 1308324858405118, 1229680749538400, 720131409105291,
+      1958958863624906 } },
+  { { 515583508038846, 17656978857189, 1717918437373989, 1568052070792483,
+      46975803123923 },
+    { 281527309158085, 36970532401524, 866906920877543, 2222282602952734,
+      1289598729589882 },
+    { 1278207464902042, 494742455008756, 1262082121427081, 1577236621659884,
+      1888786707293291 } },
+  { { 353042527954210, 1830056151907359, 1111731275799225, 174960955838824,
+      404312815582675 },
+    { 2064251142068628, 1666421603389706, 1419271365315441, 468767774902855,
+      191535130366583 },
+    { 1716987058588002, 1859366439773457, 1767194234188234, 64476199777924,
+      1117233614485261 } },
+  { { 984292135520292, 135138246951259, 2220652137473167, 1722843421165029,
+      190482558012909 },
+    { 298845952651262, 1166086588952562, 1179896526238434, 1347812759398693,
+      1412945390096208 },
+    { 1143239552672925, 906436640714209, 2177000572812152, 2075299936108548,
+      325186347798433 } },
+  { { 721024854374772, 684487861263316, 1373438744094159, 2193186935276995,
+      1387043709851261 },
+    { 418098668140962, 715065997721283, 1471916138376055, 2168570337288357,
+      937812682637044 },
+    { 1043584187226485, 2143395746619356, 2209558562919611, 482427979307092,
+      847556718384018 } },
+  { { 149807506775174, 912267207660897, 545976734422637, 1401692837350637,
+      518614477171099 },
+    { 2036378377993918, 501805733304808, 2138481508169727, 1314165893238533,
+      633769691720883 },
+    { 904627574235583, 366582160013268, 1919276459982818, 683852563070972,
+      849013528013132 } },
+  { { 314313360314866, 1556311374160012, 1168603496880569, 1814168775579275,
+      1614132085719577 },
+    { 2131084209034260, 1079618267255989, 2221075635319892, 1767700624704351,
+      2211234254213298 },
+    { 2211811396782717, 1987727116500422, 1201194143426517, 1988979712261853,
+      884086138400803 } },
+  { { 905437535859381, 2087027997220234, 1635119994381095, 1685873597006198,
+      1012846163414573 },
+    { 1676395312121042, 3029220223268, 368206865668243, 964533673789594,
+      215376185876701 },
+    { 554990822829571, 1043610604169755, 239155874009083, 1207029530220679,
+      1248980877883503 } },
+  { { 69285391071238, 952699065262595, 1897195179818498, 2221896934640248,
+      2249233024322127 },
+    { 78809566929483, 779032012311147, 1427611596584513, 518873618952061,
+      1526917368222930 },
+    { 1100828805329651, 38323682820671, 233339076341529, 570439134676859,
+      373923102906827 } },
+  { { 650556138336187, 1140806781381529, 1319490550148986, 191418598917150,
+      2092597895198458 },
+    { 318870179835268, 74934950484033, 1562778480087512, 1707372248382077,
+      1218075494012839 },
+    { 24874372349398, 672413878008022, 2109618619032869, 617580455983017,
+      643082448965145 } },
+  { { 895116466708821, 59560718869665, 1331906084934492, 1442649827370867,
+      985339602059253 },
+    { 1451142689265254, 1969461860313708, 21715673478130, 528368101402583,
+      2160134848980621 },
+    { 1101806460504208, 48906420814555, 455540794156723, 777238833441277,
+      678815750013174 } },
+  { { 1203258470211606, 631466542942779, 1508156827359998, 1386471169744113,
+      1401834110583506 },
+    { 452617917293805, 2159217690799159, 1402674324629166, 651400501019098,
+      2161850530833241 },
+    { 928961391578986, 832907369443124, 468987297840672, 1558723144077997,
+      1418280592841651 } },
+  { { 997854281022512, 371412096455343, 385221936050652, 1659016544729114,
+      609442868038809 },
+    { 283947992808316, 906854516558219, 2004968339980078, 682646947000673,
+      252088188293511 },
+    { 1619428378651736, 1579845830028655, 3625310117685, 170605089295866,
+      1149673757755609 } }
+},
+{ /* 33/51 */
+  { { 1431189333362745, 270437001637520, 1841157954619917, 132664511521572,
+      105906730937715 },
+    { 1519560400510514, 757016839193621, 962011066300527, 1331491453807482,
+      366291408709403 },
+    { 437646608465794, 2094793895484999, 1468162389698058, 248477625893392,
+      1999708435919408 } },
+  { { 2057796043232663, 11608799675559, 1596783085458033, 1729533403820748,
+      911191922916278 },
+    { 1223062248495683, 1630657229329984, 493822228052059, 1371287517681447,
+      1729125662506463 },
+    { 43999776827657, 989331901442862, 147120313740048, 495021300047603,
+      2007031690017476 } },
+  { { 1956939819397260, 1563769450095983, 1153022458216287, 176747536292706,
+      223633771534996 },
+    { 2218297806122503, 133016207658508, 881158740655112, 1061346067421084,
+      2078729038976858 },
+    { 277297371046776, 1016671322777094, 1912173712739697, 1941234701885292,
+      1286651577841525 } },
+  { { 129496500081800, 1790297098324227, 1302842166366374, 1122296729486616,
+      917050154500647 },
+    { 2209800470133809, 1185162704121958, 1319971255383218, 1371435139486267,
+      1231465623037748 },
+    { 627678063257079, 716314893721428, 1223825394014331, 504272345435927,
+      1599415310067837 } },
+  { { 2160964425547565, 270331735865855, 218025191525885, 304256310615629,
+      1406273379451890 },
+    { 1682932750659430, 406102396456081, 1166743504562791, 282574121837855,
+      1702848107164650 },
+    { 66232156124863, 1741674194899368, 1229742843930407, 260078220485178,
+      2065725536502563 } },
+  { { 1759675286353642, 1663207329829539, 60895891056823, 376287419379109,
+      945193438671385 },
+    { 1911995337182400, 808483762173758, 939031425183399, 313596106521368,
+      1211390505692035 },
+    { 1986557906737275, 810826505070108, 96017120328357, 1696299441261906,
+      1606104856145766 } },
+  { { 2175013070553375, 1068962231285366, 1143129099999601, 1532959129324381,
+      301299046788933 },
+    { 2144001785307842, 733563115114107, 1878201272500268, 2067196405322608,
+      1858301662618688 },
+    { 745372522040276, 1748456103797955, 2181743850112213, 796241938657904,
+      1942989014453742 } },
+  { { 1248731221520759, 1465200936117687, 540803492710140, 52978634680892,
+      261434490176109 },
+    { 1057329623869501, 620334067429122, 461700859268034, 2012481616501857,
+      297268569108938 },
+    { 1055352180870759, 1553151421852298, 1510903185371259, 1470458349428097,
+      1226259419062731 } },
+  { { 1329566059311380, 2025025630203080, 527457956871520, 883895263819210,
+      1057268979016315 },
+    { 981857096981737, 1002247899881912, 555167186590837, 1992623062370786,
+      689372711882115 },
+    { 680995291622632, 2245830306253375, 1069764255679816, 766876845927528,
+      351738473952439 } },
+  { { 300228223665471, 1738248289812633, 1714710031716034, 1564851200318976,
+      1402383500494809 },
+    { 145497366563876, 1777764482975886, 2203033856075189, 387035223657911,
+      1784786000749994 },
+    { 1344357352033446, 1625025565269032, 1770237265265853, 113572325787481,
+      747666152982810 } },
+  { { 1739730291624091, 1632624441408506, 917541220641535, 2073873284447349,
+      2232915399847418 },
+    { 558620996073999, 9133225073692, 1003442620082718, 1470783501909767,
+      270335895636491 },
+    { 487923459993420, 858982751210810, 2245517770424769, 719415024187879,
+      1567047952593537 } },
+  { { 1698887255365079, 1788140151633790, 1796470583807688, 56758026261255,
+      751131751511121 },
+    { 2225322846751398, 1561530440447950, 1763953794385273, 952188555627701,
+      782316126864480 },
+    { 951713200038001, 1435824767028872, 1419752002972500, 1030586133611370,
+      1030307027459008 } },
+  { { 107995253969898, 2136557288770412, 452715637008450, 775393549586735,
+      2079087258376254 },
+    { 1276807171665962, 173216293641193, 1877014197617699, 1939927094785320,
+      792004096348722 },
+    { 1246542805295580, 1701749298294033, 1247377298018307, 1579427874938929,
+      945778570658615 } },
+  { { 2065254287258639, 1225231347267788, 871370354675605, 2136988057383544,
+      274515188581321 },
+    { 778561433685880, 2017838556187550, 761810112451769, 1295565238862703,
+      1781306681433360 },
+    { 1702858315270585, 1310332238717384, 904646339147209, 2011898804040037,
+      880509356355662 } },
+  { { 1510012695968494, 352422029197070, 2018120321306130, 702017226053169,
+      2105563267082814 },
+    { 1641020663556449, 385585392089970, 242883144130673, 1294234938162741,
+      448786524107108 },
+    { 2003066563533723, 1915974473060829, 1306459207115439, 697043777820394,
+      1816400433109748 } },
+  { { 1492988790301668, 790326625573331, 1190107028409745, 1389394752159193,
+      1620408196604194 },
+    { 47000654413729, 1004754424173864, 1868044813557703, 173236934059409,
+      588771199737015 },
+    { 30498470091663, 1082245510489825, 576771653181956, 806509986132686,
+      1317634017056939 } }
+},
+{ /* 34/51 */
+  { { 1995325341336574, 911500251774648, 164010755403692, 855378419194762,
+      1573601397528842 },
+    { 241719380661528, 310028521317150, 1215881323380194, 1408214976493624,
+      2141142156467363 },
+    { 1315157046163473, 727368447885818, 1363466668108618, 1668921439990361,
+      1398483384337907 } },
+  { { 838432205560695, 1997703511451664, 1018791879907867, 1662001808174331,
+      78328132957753 },
+    { 739152638255629, 2074935399403557, 505483666745895, 1611883356514088,
+      628654635394878 },
+    { 1822054032121349, 643057948186973, 7306757352712, 577249257962099,
+      284735863382083 } },
+  { { 939988499217114, 1662632170533262, 1597931620617614, 816384760006537,
+      2103376627071646 },
+    { 153926091142038, 1765220518579265, 528407889482033, 1944774404468420,
+      55214660108975 },
+    { 98516339668203, 1987095201806236, 109825731538912, 249333174781555,
+      868887613476084 } },
+  { { 1912748982362695, 1220789150721713, 704177718050401, 723618635926708,
+      1539793845278548 },
+    { 797199596391742, 1640579499587252, 2249382671495029, 1509816099416416,
+      1287100489183999 },
+    { 2120957025321772, 1416788979770990, 1248163529640000, 1057479098339217,
+      1345904049070916 } },
+  { { 254121746213369, 1533500053409216, 635709488325464, 1143238478729669,
+      2134848088586068 },
+    { 1746879317691946, 686105653351478, 2043100616430503, 971699238203156,
+      104317575808346 },
+    { 852542705191174, 1773940944796397, 110837992325710, 2231703469430819,
+      349088851981013 } },
+  { { 793977705557061, 2021518417426778, 1732253271242201, 1293748598781831,
+      829319793069143 },
+    { 788535447152259, 1016555038491888, 990067004977538, 1321283029883181,
+      846580866043953 },
+    { 110555050492969, 701122633359978, 947827171315505, 1007083735220856,
+      2186736036162197 } },
+  { { 801046924791751, 1937826096094762, 901257692586611, 1929902598090714,
+      410680383194296 },
+    { 1511252350965953, 1242806839559772, 941190528770125, 848987521707247,
+      1770475079640735 },
+    { 1754633294428314, 2154502484623757, 2011608413039233, 1969957542290297,
+      1446257406201241 } },
+  { { 1020723204932740, 925702577219623, 993238884888760, 1734688533140183,
+      2122148469059677 },
+    { 91831374297454, 1526227336126975, 1355766749788798, 604694865815954,
+      179753894501239 },
+    { 1672839208916523, 1716495024680343, 1707076061183264, 765180466790910,
+      2017432747304428 } },
+  { { 756623766768775, 1991587084927598, 1373391401979308, 1665725475234083,
+      1968182055405121 },
+    { 592732400846588, 36261853172026, 300573459939186, 1097010826367826,
+      1187240170941336 },
+    { 1129939559093854, 115411381815159, 1643323027370752, 1057763109943669,
+      1215511282800683 } },
+  { { 979157969997640, 781365085180074, 2052217627248167, 626459442141542,
+      1446996452191635 },
+    { 508002240308955, 2182480398434935, 120365472791495, 175489098273257,
+      641728417129403 },
+    { 1233588463814759, 966863898273900, 1057975855925880, 967550326000152,
+      1411751114548341 } },
+  { { 1757700744775968, 684436626549586, 1290857595283177, 1292154319580064,
+      424310864381175 },
+    { 1190160684235692, 2216589841982445, 303448460297705, 413409541026783,
+      2183537752608363 },
+    { 1823832516176735, 118976325266904, 1997049946199681, 1488809896891393,
+      1997400624287774 } },
+  { { 162252707744707, 1593372837632109, 419105697539909, 1656407715094130,
+      112109013318476 },
+    { 1845211281712630, 314796716337139, 1084733734214267, 2030481699162822,
+      408225771371226 },
+    { 192171151121229, 1275967732855104, 1864584199775891, 1693406950762857,
+      451756333138903 } },
+  { { 1934941369331531, 388260373608175, 1304482939975309, 1529402531991965,
+      1498338899563392 },
+    { 434465565952568, 272333844056755, 526330323705288, 976329191188551,
+      735878981585166 },
+    { 486851592096970, 264537447834014, 1822054972903336, 238032531658386,
+      1678107842746402 } },
+  { { 2162140011651749, 1675927674210235, 436681937730684, 332739841506044,
+      1569242283000804 },
+    { 1245624909427148, 1055288224512918, 2245150738413630, 161261146568384,
+      1090651350647907 },
+    { 458134832756999, 939829782195586, 2250353956101998, 434064832994582,
+      338708936831109 } },
+  { { 2056018369491766, 1624971110356071, 1245644103099606, 212830559235017,
+      1964722912769135 },
+    { 1105151597870361, 2109200404659049, 2216073774113885, 1897978861200905,
+      1596357428289980 },
+    { 678725855212719, 57776089061085, 1925610488691950, 1367327322661409,
+      1290430534697304 } },
+  { { 1612422054090644, 2236845889213344, 111947795252003, 1594023725720587,
+      709352663553385 },
+    { 223618880166307, 2227771290802404, 11281894918949, 2094951662727146,
+      841799884322096 },
+    { 1485832258557624, 680071864680695, 1288498699771584, 258483455916573,
+      1782424270254224 } }
+},
+{ /* 35/51 */
+  { { 1958983221377553, 2178877734404748, 1849996731612977, 1835657059247969,
+      2041180109654311 },
+    { 506164232017347, 1310600048415123, 805017935693660, 858678127951771,
+      552614740457634 },
+    { 724524272708234, 661221141789934, 1298795839460575, 1322772218421097,
+      837427426454482 } },
+  { { 1366558556363930, 1448606567552086, 1478881020944768, 165803179355898,
+      1115718458123498 },
+    { 204146226972102, 1630511199034723, 2215235214174763, 174665910283542,
+      956127674017216 },
+    { 1562934578796716, 1070893489712745, 11324610642270, 958989751581897,
+      2172552325473805 } },
+  { { 344496328588140, 812166993434148, 1279101166048218, 289993374427177,
+      2213952539224116 },
+    { 764944097278493, 1270937970378437, 874590385403376, 805083435349795,
+      982556909220931 },
+    { 1515284639342632, 1915357197605248, 608432263577869, 1229557023822133,
+      255786600308217 } },
+  { { 1770564423056027, 735523631664565, 1326060113795289, 1509650369341127,
+      65892421582684 },
+    { 623682558650637, 1337866509471512, 990313350206649, 1314236615762469,
+      1164772974270275 },
+    { 223256821462517, 723690150104139, 1000261663630601, 933280913953265,
+      254872671543046 } },
+  { { 765264767966471, 630401732219715, 2050370595661583, 1937949454465830,
+      1867907091818197 },
+    { 2055868407075537, 886474385060089, 1989871285760092, 1751278173974350,
+      864177026725152 },
+    { 59663996153313, 5601138898, 304383515207138, 2188865114313217,
+      1370228229360105 } },
+  { { 1969087237026041, 624795725447124, 1335555107635969, 2069986355593023,
+      1712100149341902 },
+    { 1236103475266979, 1837885883267218, 1026072585230455, 1025865513954973,
+      1801964901432134 },
+    { 1115241013365517, 1712251818829143, 2148864332502771, 2096001471438138,
+      2235017246626125 } },
+  { { 1138644244764139, 866979453130866, 2083020898206034, 1272608196865206,
+      1000174222678408 },
+    { 1333058869576011, 2017435563631224, 730046425102685, 1799884439838832,
+      2084158037990066 },
+    { 609193124030390, 2123573224834709, 2039694254049712, 509800661636418,
+      1089395281931877 } },
+  { { 1299268198601632, 2047148477845621, 2165648650132450, 1612539282026145,
+      514197911628890 },
+    { 118352772338543, 1067608711804704, 1434796676193498, 1683240170548391,
+      230866769907437 },
+    { 1850689576796636, 1601590730430274, 1139674615958142, 1954384401440257,
+      76039205311 } },
+  { { 1654376743559156, 1139278832280724, 1639772297498402, 746860192753148,
+      212420989604133 },
+    { 2111265309908915, 477237967065921, 1721330904190144, 322163169033405,
+      387854825571302 },
+    { 941964152670617, 380151436668931, 903987324732658, 1791000771173745,
+      793762311450920 } },
+  { { 1723387471374172, 997301467038410, 533927635123657, 20928644693965,
+      1756575222802513 },
+    { 2146711623855116, 503278928021499, 625853062251406, 1109121378393107,
+      1033853809911861 },
+    { 571005965509422, 2005213373292546, 1016697270349626, 56607856974274,
+      914438579435146 } },
+  { { 1118596247293721, 917221428626664, 584284699528570, 1576393725956618,
+      1549406788423546 },
+    { 211699516952334, 277424929571320, 1269552264144172, 1030657172098590,
+      1705702847761128 },
+    { 1600832676785824, 1366251316782858, 1736036285834279, 983678399391395,
+      2089122632628050 } },
+  { { 1346698876211176, 2076651707527589, 1084761571110205, 265334478828406,
+      1068954492309671 },
+    { 1769967932677654, 1695893319756416, 1151863389675920, 1781042784397689,
+      400287774418285 },
+    { 1851867764003121, 403841933237558, 820549523771987, 761292590207581,
+      1743735048551143 } },
+  { { 2249446551552396, 1626994231789315, 1994089576014832, 1673015651135023,
+      2010903619782560 },
+    { 297466008670619, 424980558970456, 2146657407117941, 1354690155275335,
+      1507283311745617 },
+    { 662126268159006, 510677617397985, 209868790478309, 646087996472083,
+      1557649446337533 } },
+  { { 410915148140008, 2107072311871739, 1004367461876503, 99684895396761,
+      1180818713503224 },
+    { 285945406881439, 648174397347453, 1098403762631981, 1366547441102991,
+      1505876883139217 },
+    { 672095903120153, 1675918957959872, 636236529315028, 1569297300327696,
+      2164144194785875 } },
+  { { 2003452504366399, 623392523542101, 1324258452452243, 1779955689670120,
+      188307399186917 },
+    { 104876989688017, 370012202169734, 2046270355679993, 747077790546344,
+      1951209704649924 },
+    { 451310424281176, 2110871484153804, 200407664502138, 1584656074990273,
+      58625207178768 } },
+  { { 1902708175321798, 1035343530915438, 1178560808893263, 301095684058146,
+      1280977479761118 },
+    { 1615357281742403, 404257611616381, 2160201349780978, 1160947379188955,
+      1578038619549541 },
+    { 2013087639791217, 822734930507457, 1785668418619014, 1668650702946164,
+      389450875221715 } }
+},
+{ /* 36/51 */
+  { { 1638260469631934, 1786040878698661, 906589425735481, 1583514814511733,
+      161900944868234 },
+    { 821091239344879, 1029728218242611, 1785130220912361, 134891303686179,
+      1146812607647243 },
+    { 960395712488566, 1090263312831733, 1493488072165035, 718337273853885,
+      140550395520083 } },
+  { { 582009322268611, 1462939149444616, 1699035707213512, 1260336843200283,
+      22744545971108 },
+    { 66233320680397, 481500577921291, 1593046392900201, 1567890828749600,
+      494668490181439 },
+    { 447501697246828, 643764017641830, 598739660833153, 477276555234445,
+      722964385617133 } },
+  { { 1468688697571051, 679132917145459, 729559654398033, 216030070311676,
+      1572642054261960 },
+    { 1240274286914554, 1067294500855911, 1808099303249661, 2078686383903322,
+      1106012145326576 },
+    { 601523810297856, 895074627148937, 773977692709653, 1905383167427875,
+      1540507530397039 } },
+  { { 399548058429350, 1239727848347326, 910155210437028, 460253616151978,
+      1473384781489285 },
+    { 649661364881903, 490692502811334, 1079509849353758, 1289782120135506,
+      536543674034462 },
+    { 1148448246837183, 1915539016170074, 727268432049334, 838952046766961,
+      1100979659516489 } },
+  { { 549684439104063, 1308243333207399, 849363374624769, 650751688271388,
+      1782136170508092 },
+    { 2061989082911795, 1479591773633681, 978076246857124, 838517167558357,
+      354474530763849 },
+    { 1354449553272043, 1085110494903468, 2224048655022783, 1932600057639272,
+      200912869737304 } },
+  { { 768379161979195, 698528958407689, 1384131174334607, 573310211564337,
+      5045987379232 },
+    { 1737002989059736, 802467700141916, 1002869782075529, 704293791948409,
+      2201857958628929 },
+    { 1328818899805024, 1356396048253838, 60665341223248, 1567700157316511,
+      290562887661571 } },
+  { { 2083771618977947, 1607978129046189, 1586868936731179, 268756465778504,
+      2196980677006700 },
+    { 286239024641757, 487000093964479, 1365236543743062, 952492668921998,
+      305066005571225 },
+    { 1179288489475667, 394266093483806, 2023843107238627, 906600297586329,
+      1987935808498095 } },
+  { { 2190648163527070, 1182302286459911, 1698709705179966, 606253946341655,
+      512030280417032 },
+    { 348777384482283, 2016426622766719, 1222199716068557, 1918283401506759,
+      2245473746651968 },
+    { 1766029976663583, 578113072554872, 1407762358462124, 1251410333318914,
+      1519685697291309 } },
+  { { 2165465146173096, 1900611060212209, 1042730545588351, 2014093929109019,
+      1810920073473014 },
+    { 173411190973372, 967529309086102, 1908986490599312, 411938580678674,
+      356258419083572 },
+    { 2188210814895132, 862494540176239, 429026747909695, 420692388686242,
+      398456856483386 } },
+  { { 2182481135659358, 1214620204337280, 1322637461359405, 1356848297722186,
+      919105498759085 },
+    { 880514070070495, 1997526724728810, 1484288295863144, 272582074519933,
+      2088837521459658 },
+    { 825616994407031, 220978982016139, 419943662189285, 2047052177976116,
+      183513451940769 } },
+  { { 783125706449468, 306749525643676, 21770820613928, 103790913644674,
+      1721435535499275 },
+    { 2132053622782186, 1113268721076370, 128627570986857, 1755820574942708,
+      242159262066477 },
+    { 397259122369220, 1632965024772390, 1358524229763907, 634652123170537,
+      1300732316858513 } },
+  { { 959435621276742, 649442782529811, 632841582251763, 968805857393904,
+      1687384821034387 },
+    { 34122925272183, 2155153497888788, 244056216431944, 117474587239490,
+      152689635003290 },
+    { 596504540509310, 1411595783429460, 320205765945468, 1703829528897671,
+      791135694264620 } },
+  { { 654173403472873, 928661794238621, 1629853006863494, 1616810006326534,
+      2007934577851039 },
+    { 1683503690923416, 727988134240269, 2240507241051587, 1847468092528986,
+      1643341229966684 },
+    { 1723586093910128, 42167711405468, 711328489930847, 1802621686437750,
+      138939056743574 } },
+  { { 570251557550507, 1171790929970039, 580334044699877, 1197545364645877,
+      1343246277400449 },
+    { 1283485640594810, 1892074764812191, 2126737364321622, 680209267941507,
+      1777758743504942 },
+    { 201514708798683, 714458960438240, 193526864900221, 289856941669808,
+      677692044183495 } },
+  { { 815420529102355, 1318716141230896, 859940092247599, 545165849427436,
+      1325031219234521 },
+    { 1138573439840070, 1068378781077018, 1630139289265327, 1160984923403677,
+      1289616917811600 },
+    { 520206601828502, 827736556609109, 1548115289807569, 226762337353952,
+      901425653289102 } },
+  { { 453918449698368, 106406819929001, 2072540975937135, 308588860670238,
+      1304394580755385 },
+    { 1295082798350326, 2091844511495996, 1851348972587817, 3375039684596,
+      789440738712837 },
+    { 2083069137186154, 848523102004566, 993982213589257, 1405313299916317,
+      1532824818698468 } }
+},
+{ /* 37/51 */
+  { { 1495961298852430, 1397203457344779, 1774950217066942, 139302743555696,
+      66603584342787 },
+    { 1782411379088302, 1096724939964781, 27593390721418, 542241850291353,
+      1540337798439873 },
+    { 693543956581437, 171507720360750, 1557908942697227, 1074697073443438,
+      1104093109037196 } },
+  { { 854645372543796, 1936406001954827, 151460662541253, 825325739271555,
+      1554306377287556 },
+    { 1497138821904622, 1044820250515590, 1742593886423484, 1237204112746837,
+      849047450816987 },
+    { 667962773375330, 1897271816877105, 1399712621683474, 1143302161683099,
+      2081798441209593 } },
+  { { 373666279883137, 146457241530109, 304116267127857, 416088749147715,
+      1258577131183391 },
+    { 1186115062588401, 2251609796968486, 1098944457878953, 1153112761201374,
+      1791625503417267 },
+    { 1870078460219737, 2129630962183380, 852283639691142, 292865602592851,
+      401904317342226 } },
+  { { 1294303766540260, 1183557465955093, 882271357233093, 63854569425375,
+      2213283684565087 },
+    { 339050984211414, 601386726509773, 413735232134068, 966191255137228,
+      1839475899458159 },
+    { 235605972169408, 2174055643032978, 1538335001838863, 1281866796917192,
+      1815940222628465 } },
+  { { 608363524539665, 1518910856395189, 235952432870392, 1408491254860197,
+      1242950972146918 },
+    { 141237975904618, 1930686443811123, 1177247652685079, 777764676897614,
+      1765510645122998 },
+    { 724510145626490, 1990648995683735, 1234513756420164, 776971151906420,
+      1819715569230741 } },
+  { { 1030092646107051, 1933131048782199, 99428680181957, 2032809616708978,
+      282557169383529 },
+    { 289958998205570, 1630227756877098, 1955441365488300, 777423577141482,
+      1857833856067877 },
+    { 909754464411828, 785219392684958, 1338541457752162, 826789969638535,
+      2048189131938215 } },
+  { { 1452942110247071, 1201823364506117, 78440357117953, 655819098974901,
+      2069141053434695 },
+    { 323645104778051, 202751157595363, 1373659598813809, 1414179066094017,
+      869209142492064 },
+    { 745779946397307, 916664696261756, 1535477642186117, 1334763610638931,
+      1366843744138046 } },
+  { { 1595188599035679, 1464526558278044, 1898228983618218, 1360237543176202,
+      561355623244020 },
+    { 1624984233972943, 1175602927768556, 2008613229958363, 860666473258130,
+      8855064843107 },
+    { 427225699371050, 88989906931284, 374954954790275, 1891881595245671,
+      72849256625193 } },
+  { { 370957271770191, 144057950825693, 809353512679209, 1501475896528612,
+      54377649857162 },
+    { 1903866438586219, 787365075527527, 1803354224157384, 2118362296926186,
+      1572984662579543 },
+    { 2243132277728359, 487375468360281, 721765214435031, 1682004470823858,
+      601174195873112 } },
+  { { 295438644852012, 1058171926387716, 801609243377825, 1556518427966833,
+      1401891522939023 },
+    { 1947047485599658, 467803101824713, 1713818266814711, 196057718016052,
+      2074403339608269 },
+    { 659351651684135, 2208551077316914, 1675116867007967, 458624483054526,
+      1417131339089547 } },
+  { { 2142919829388577, 1501918052325406, 1757785635395595, 1250182819965225,
+      1099384757428717 },
+    { 2049208268386413, 763923109611395, 1330348448615935, 928950698447051,
+      1753591328068739 },
+    { 462317021879055, 1694244988466894, 1468442603193275, 185628038763960,
+      351474599621768 } },
+  { { 1153146833008253, 1848223127752381, 1738172480609500, 336126924059233,
+      324807830573476 },
+    { 1320862864351243, 1568715466275446, 1558715001159632, 1281494833516722,
+      1481197165742606 },
+    { 573714500102675, 1974778294895399, 247899028774282, 961838690251046,
+      1227354193122381 } },
+  { { 703580732984279, 1831025267646011, 2160727360073194, 335861351431163,
+      1508572520818384 },
+    { 69461527645763, 1355113319487293, 302070555792177, 1329621923315087,
+      1838127133230616 },
+    { 417503806725911, 1267380137949222, 1463529779222276, 801191811611095,
+      2107291692847302 } },
+  { { 190503559417822, 1338043387578150, 364965530609766, 1273493393525069,
+      2029301145535541 },
+    { 1220188600255938, 529993677481026, 797805356554154, 434641112019417,
+      1921685264882394 },
+    { 1609738917592956, 1761023280559209, 945436018250269, 1737232407735307,
+      673020593491007 } },
+  { { 1598125951393064, 1928838108590565, 1044135991287560, 1465399057994990,
+      1117866658315674 },
+    { 402629068194915, 598317139519363, 1077571721872685, 923568396261314,
+      143788835401408 },
+    { 1630135235212091, 1261154568675148, 1245545945966424, 649599046015314,
+      471740276282287 } },
+  { { 84040170431047, 1931214780001053, 1443891068193482, 1666635094108942,
+      143074570822442 },
+    { 1665011381698399, 1378754749747507, 487038326296225, 1599334628314079,
+      304382055379555 },
+    { 487618024041635, 1610635862259296, 1930277174961405, 2060246530132043,
+      471988063294585 } }
+},
+{ /* 38/51 */
+  { { 1025432551730846, 1648743746278575, 16684771081519, 347896520603035,
+      1136469383570497 },
+    { 1553077072086479, 778919053728455, 581206537360082, 2100029769810002,
+      192766048046100 },
+    { 437947250844137, 170970937295705, 294909197597269, 2210849722009323,
+      1802271999575202 } },
+  { { 345774063281888, 1248680369566159, 993767719430878, 632344407656797,
+      494002909476340 },
+    { 525302074276141, 241111491449954, 1218402302345939, 567375174674023,
+      525859655102473 },
+    { 1262037831799441, 1761445988918060, 1818282615037362, 643977010061831,
+      1670449776207217 } },
+  { { 105618528712651, 1599797957446168, 1723240952262061, 1521319741808023,
+      1244021174200017 },
+    { 154720291700703, 533958195082685, 801063430923359, 417051647072220,
+      91268681893473 },
+    { 1682663787527018, 508342182938395, 1334960042435994, 788285033210835,
+      1620852797020940 } },
+  { { 1632352921721536, 1833328609514701, 2092779091951987, 1923956201873226,
+      2210068022482919 },
+    { 35271216625062, 1712350667021807, 983664255668860, 98571260373038,
+      1232645608559836 },
+    { 1998172393429622, 1798947921427073, 784387737563581, 1589352214827263,
+      1589861734168180 } },
+  { { 1501008607154960, 1563686557608537, 609033933792108, 1536455301442641,
+      1828207280451471 },
+    { 1757463240890423, 1084586437565356, 674676257046313, 1797880867889069,
+      2163367554160634 },
+    { 1692634708765115, 1439394672846608, 1906726749038590, 841471569745445,
+      610983732913164 } },
+  { { 24859833299225, 1159089376385356, 756772521963176, 188739816336795,
+      972658746781390 },
+    { 1366090295712491, 509267435817523, 1595372259512299, 94186959707772,
+      1052764824068037 },
+    { 1380663358610302, 13527549633514, 1398584537173685, 1632720970065177,
+      1650958084279369 } },
+  { { 697987915176445, 133416785505936, 1449184407897135, 967865560071656,
+      85553524989298 },
+    { 1503272981057299, 1773600850082806, 1109725102365418, 1697982940339293,
+      68257764421792 },
+    { 1748179580274940, 534280555384699, 568941398869518, 127928105804569,
+      1098014024324994 } },
+  { { 1733739258725305, 31715717059538, 201969945218860, 992093044556990,
+      1194308773174556 },
+    { 846415389605137, 746163495539180, 829658752826080, 592067705956946,
+      957242537821393 },
+    { 1758148849754419, 619249044817679, 168089007997045, 1371497636330523,
+      1867101418880350 } },
+  { { 83285890529250, 2062114292303446, 1057339688664157, 883236001978485,
+      1425252631637430 },
+    { 1185679862698239, 1876936454661329, 588745622816003, 231168999595020,
+      874700109469248 },
+    { 838923892832926, 2058839223583505, 771385551534887, 332236222984821,
+      495351408098863 } },
+  { { 1134834255621136, 1919389365086497, 1528203891548067, 2029873700874765,
+      1953355553934260 },
+    { 1633754979199207, 484957469969036, 1760373405450096, 1860832728908965,
+      1492139386939155 },
+    { 593490584920710, 1146664983900373, 89382643176674, 1563731168417270,
+      158854757185262 } },
+  { { 1236450672664323, 396341254485838, 1808561961147467, 1792522203299614,
+      1605783007030001 },
+    { 268307540650494, 1324411112159005, 2017107463277532, 2137592127187254,
+      534920533756206 },
+    { 1275424231344290, 1460044005754998, 1880572567874046, 1133206707555448,
+      939501845742013 } },
+  { { 326633984209635, 261759506071016, 1700682323676193, 1577907266349064,
+      1217647663383016 },
+    { 1714182387328607, 1477856482074168, 574895689942184, 2159118410227270,
+      1555532449716575 },
+    { 853828206885131, 998498946036955, 1835887550391235, 207627336608048,
+      258363815956050 } },
+  { { 1313788342678762, 1315440055643720, 1214065368291679, 205111008935315,
+      1935736633676833 },
+    { 412596012173286, 687814750109884, 323232598907933, 2174060715461817,
+      1484501533614323 },
+    { 1008070842748440, 2099305694142085, 153179973673139, 567866478906802,
+      854143793130041 } },
+  { { 1373048109829047, 2142664138582800, 66806767921188, 432874256295668,
+      1546585422696486 },
+    { 191253205012271, 1997529964861273, 743585098448547, 916239483418126,
+      296912737750104 },
+    { 1047682554124367, 1329845026101429, 1648213048555504, 207137382784721,
+      1529805460897011 } },
+  { { 111184843100769, 825519965447365, 1340345892431139, 2093408782932033,
+      1852217741005440 },
+    { 915213787001391, 1245864590534520, 1205599863942461, 1428729912964141,
+      388662212190609 },
+    { 2006931247888232, 239131773624011, 2139365226926203, 1365864781727631,
+      1553167772238896 } },
+  { { 141141474651677, 1236728744905256, 643101419899887, 1646615130509173,
+      1208239602291765 },
+    { 1501663228068911, 1354879465566912, 1444432675498247, 897812463852601,
+      855062598754348 },
+    { 714380763546606, 1032824444965790, 1774073483745338, 1063840874947367,
+      1738680636537158 } }
+},
+{ /* 39/51 */
+  { { 2228654250927986, 1483591363415267, 1368661293910956, 1076511285177291,
+      526650682059608 },
+    { 709481497028540, 531682216165724, 316963769431931, 1814315888453765,
+      258560242424104 },
+    { 1053447823660455, 1955135194248683, 1010900954918985, 1182614026976701,
+      1240051576966610 } },
+  { { 2143318224651032, 733385627315851, 254705425241603, 246670488543148,
+      1442295963272082 },
+    { 1951027410316907, 776338288529184, 1414670155467203, 355995586863836,
+      1209606780078452 },
+    { 2200224066087308, 1167051805827953, 161446888552827, 1516422365939770,
+      1942535836845300 } },
+  { { 1708597220825023, 1438783626370955, 1070128530574711, 79967796035882,
+      535213046500338 },
+    { 1870500428573528, 1425825047803447, 1236877305888985, 1746763332166984,
+      2003970190098443 },
+    { 1784097217061133, 675274725963308, 2233934579880996, 707618504407388,
+      2099389424774240 } },
+  { { 1230426392539272, 997104644926831, 1053774819732819, 2147764348670691,
+      1676514761128454 },
+    { 668289581572433, 277229536066558, 512862571267843, 1966556713706538,
+      794475628136672 },
+    { 1628314393858778, 1997743320994668, 1561201521750924, 1869590045554733,
+      1810714681142288 } },
+  { { 248447928244352, 1091423095481279, 1133718131754060, 44963872660085,
+      1777776032697527 },
+    { 183337342970535, 601856538930543, 1585812882403420, 1170074264503885,
+      713212262415502 },
+    { 602820566687403, 272329795516265, 669297924120711, 2123735650321164,
+      1442487723853936 } },
+  { { 1675422916543613, 420608931102229, 507417335369419, 640362125760162,
+      547806107918848 },
+    { 177854791944349, 1181810088365991, 667731284331731, 2129076819445302,
+      821127077179399 },
+    { 1484872832783728, 72255685107270, 1098972476164964, 1732914770170238,
+      145186792002379 } },
+  { { 1591642286372111, 1031232548535563, 2221056175478252, 1051402993563081,
+      1978749665367544 },
+    { 1397783044742064, 1732520664234125, 1322103487085235, 1043096375494316,
+      379060571057543 },
+    { 1425294960998886, 1491603386037323, 2150114802561157, 38851320037974,
+      1220480905205844 } },
+  { { 1372652207334635, 280088467298730, 1519487391303038, 6992513325161,
+      640671581341508 },
+    { 1683583627473543, 470109912280877, 1910006662061487, 346619407103075,
+      53117372144724 },
+    { 156581553787681, 307978851206907, 1451582278870485, 442722234791876,
+      662472042575165 } },
+  { { 1555095458533707, 1669410626373158, 1672772285709789, 1406679210672109,
+      1257615388468630 },
+    { 538412008662054, 1982416336753459, 1489119441159000, 1832827344674398,
+      1128037209874055 },
+    { 1704913693547807, 617520512587840, 78695453855264, 2189647827939960,
+      2192467833995248 } },
+  { { 2082652078388962, 493846157816801, 43960882916728, 111049106953707,
+      118614369521774 },
+    { 614940244711006, 1241836004262404, 149137396399876, 870877804496097,
+      2195700460595074 },
+    { 1712668510139487, 784271226274642, 827073136956465, 1001465329762964,
+      1662630974562798 } },
+  { { 1679320620903152, 795088119703599, 1811116863966335, 1397870305191040,
+      1561255076652956 },
+    { 1039426813552439, 1376371383225426, 203750058327900, 626924089634401,
+      1716299317393645 },
+    { 1872850997165034, 228229782442145, 725881447978085, 746373306700457,
+      2084847958729897 } },
+  { { 818080711416948, 1360095872859392, 283891848994117, 834642121756558,
+      787978368976316 },
+    { 652575947450972, 2107702224275112, 718520440691947, 141932352843721,
+      172644594071659 },
+    { 1509857525874286, 1496970584948645, 399828714647739, 1863753979948441,
+      2149707660031809 } },
+  { { 2153664350830641, 1790557065290252, 1087336482788123, 74424650100006,
+      837747650003059 },
+    { 1339731274627502, 254960662978993, 828473208739365, 810332739899747,
+      1535149971129871 },
+    { 1508254284211355, 2220523166234892, 412747189650830, 989144788109139,
+      1668358202588467 } },
+  { { 700395318544234, 1093768336629146, 1768906295222690, 2025477905414216,
+      743793294293786 },
+    { 1893066183933410, 836260013095430, 2186488905733469, 211412087780179,
+      1358659880821660 },
+    { 1951144383031056, 1085048452592587, 499199223423315, 2055889411465929,
+      698006601614245 } },
+  { { 88618848457429, 1208470713553970, 675637071352857, 1033782420169973,
+      1471531657193822 },
+    { 183759727715676, 1540676205079495, 750822318064948, 2186636083229027,
+      271584948765485 },
+    { 739290004195306, 2141143026705424, 129646639519115, 165523977765979,
+      2033949383875189 } },
+  { { 700816495675260, 1165569165048171, 2172597164236109, 1071655796287173,
+      140828680192945 },
+    { 1932164408348001, 314265512109288, 1717210254999343, 1391381349870857,
+      1425970078148568 },
+    { 1862104717906915, 1752261107932084, 1874923294613947, 1008681858018398,
+      628821150989939 } }
+},
+{ /* 40/51 */
+  { { 1957943897155497, 1788667368028035, 137692910029106, 1039519607062,
+      826404763313028 },
+    { 1848942433095597, 1582009882530495, 1849292741020143, 1068498323302788,
+      2001402229799484 },
+    { 1528282417624269, 2142492439828191, 2179662545816034, 362568973150328,
+      1591374675250271 } },
+  { { 160026679434388, 232341189218716, 2149181472355545, 598041771119831,
+      183859001910173 },
+    { 2013278155187349, 662660471354454, 793981225706267, 411706605985744,
+      804490933124791 },
+    { 2051892037280204, 488391251096321, 2230187337030708, 930221970662692,
+      679002758255210 } },
+  { { 1530723630438670, 875873929577927, 341560134269988, 449903119530753,
+      1055551308214179 },
+    { 1461835919309432, 1955256480136428, 180866187813063, 1551979252664528,
+      557743861963950 },
+    { 359179641731115, 1324915145732949, 902828372691474, 294254275669987,
+      1887036027752957 } },
+  { { 2043271609454323, 2038225437857464, 1317528426475850, 1398989128982787,
+      2027639881006861 },
+    { 2072902725256516, 312132452743412, 309930885642209, 996244312618453,
+      1590501300352303 },
+    { 1397254305160710, 695734355138021, 2233992044438756, 1776180593969996,
+      1085588199351115 } },
+  { { 440567051331029, 254894786356681, 493869224930222, 1556322069683366,
+      1567456540319218 },
+    { 1950722461391320, 1907845598854797, 1822757481635527, 2121567704750244,
+      73811931471221 },
+    { 387139307395758, 2058036430315676, 1220915649965325, 1794832055328951,
+      1230009312169328 } },
+  { { 1765973779329517, 659344059446977, 19821901606666, 1301928341311214,
+      1116266004075885 },
+    { 1127572801181483, 1224743760571696, 1276219889847274, 1529738721702581,
+      1589819666871853 },
+    { 2181229378964934, 2190885205260020, 1511536077659137, 1246504208580490,
+      668883326494241 } },
+  { { 437866655573314, 669026411194768, 81896997980338, 523874406393178,
+      245052060935236 },
+    { 1975438052228868, 1071801519999806, 594652299224319, 1877697652668809,
+      1489635366987285 },
+    { 958592545673770, 233048016518599, 851568750216589, 567703851596087,
+      1740300006094761 } },
+  { { 2014540178270324, 192672779514432, 213877182641530, 2194819933853411,
+      1716422829364835 },
+    { 1540769606609725, 2148289943846077, 1597804156127445, 1230603716683868,
+      815423458809453 },
+    { 1738560251245018, 1779576754536888, 1783765347671392, 1880170990446751,
+      1088225159617541 } },
+  { { 664721818475248, 91312327011767, 1601700300762338, 1763148914953177,
+      456391161471011 },
+    { 2195895609043093, 166492702184777, 1092371516693134, 578271210922313,
+      705925854510151 },
+    { 1339021042945816, 1840804708066696, 877961221559635, 1281458842745501,
+      1950851850845276 } },
+  { { 1020393680308979, 1582912152861834, 70927142474335, 995949551108035,
+      783372565431893 },
+    { 283322707170508, 451425014068290, 737361158971158, 682830005338441,
+      480789621703915 },
+    { 2248087612518599, 173333799263920, 1744928838552182, 957368524885377,
+      1722980339454003 } },
+  { { 201864547473083, 1406864297960650, 2133047286876874, 639446786234013,
+      1077039773701842 },
+    { 1574426772816100, 481791842865072, 1454978574176907, 497439805624424,
+      1391685255696725 },
+    { 1403674776792037, 176114870970230, 204752269254815, 823265703401663,
+      973549049711641 } },
+  { { 1259707444932020, 89894521051155, 771378629688383, 1867652969448711,
+      1541883672814481 },
+    { 2176894488793201, 2027716283845645, 55230079721899, 3089796004320,
+      808927956992836 },
+    { 273175012476053, 353915697751570, 1920076197363975, 2096923665433891,
+      694182114426694 } },
+  { { 21358998325927, 1001970332300944, 1455430838863126, 1701216872600126,
+      1994907074166318 },
+    { 1932892271286750, 1882260467126736, 918979855287858, 2204507190024693,
+      2056499473043853 },
+    { 854928709890819, 247698160098706, 1293104197995963, 648230677212306,
+      784063325867838 } },
+  { { 743926857795135, 855124812601935, 466950880259927, 1017009452055371,
+      1129470954185504 },
+    { 437286598865, 946974580464584, 1538471761396184, 415268975404250,
+      852489282863133 },
+    { 2104894828289916, 873144584667742, 506537740149646, 646077767532773,
+      1966868865211605 } },
+  { { 17547209714618, 1910686315635228, 654955394153571, 605616689489840,
+      847850165913281 },
+    { 1544846481420274, 1020516003801535, 1913951223747635, 2079839202875825,
+      787722964414573 },
+    { 836953051260559, 1769743545147988, 699239118029628, 825806019782225,
+      1990070083297713 } },
+  { { 944214205150673, 113579352686446, 1305491360151613, 710549772492770,
+      1508433893219248 },
+    { 181463710138863, 324899312232426, 748437826404564, 1442893546327651,
+      882055388832311 },
+    { 99837384801727, 2128746966172064, 1728087272474317, 1660968164341303,
+      2094478837305487 } }
+},
+{ /* 41/51 */
+  { { 1045092786794937, 922156857253434, 571265958550934, 1028247394751676,
+      400144133024675 },
+    { 556217026906589, 2242519046221962, 731336075742219, 560401179364011,
+      169768611612000 },
+    { 1350540322092981, 428507123444697, 863081413402232, 950089447398951,
+      118865435494230 } },
+  { { 910278956134402, 894183083609573, 830213734772943, 1343060696486484,
+      611721765217825 },
+    { 664779139067617, 1109839789271330, 140453904417500, 1571861604864808,
+      1784338148265262 },
+    { 220994375354681, 1633125608855915, 2233079832150828, 144297568151940,
+      217868145580028 } },
+  { { 1528432877912367, 135699980342021, 780855157188914, 1744928736206446,
+      1837149863417515 },
+    { 1673313678131884, 345643119065179, 43736965486584, 1315834285030270,
+      2054079925795780 },
+    { 1612827416827303, 1149821613065205, 1844912308905994, 429769677786205,
+      1866058244678788 } },
+  { { 291256384752389, 1431181693384326, 1492922137755707, 301469885232977,
+      1110919820832195 },
+    { 916743892302278, 663940551107639, 723671180823208, 1605702843269381,
+      586953762179027 },
+    { 641798503068060, 129975789967638, 2167736719761015, 31631641435626,
+      350785183214734 } },
+  { { 1399648064845097, 1606346276621799, 630052623079440, 301459981908231,
+      1176387697940858 },
+    { 476620103429946, 2095883575675383, 1545418180483167, 1716394030925737,
+      561897200492816 },
+    { 301865991723133, 208252052427984, 51972802328726, 2021710333754506,
+      1378508945174500 } },
+  { { 2243355286660512, 1008046595179169, 1913072889496857, 753019988978676,
+      2074854260894060 },
+    { 477302515147774, 992548652787948, 121203962204406, 227109980852016,
+      1843872509899554 },
+    { 1050426720469833, 301805153257576, 1393268630450121, 1286505995795045,
+      1587323866723540 } },
+  { { 1885791717393579, 1356720090981184, 1552856953369268, 1482599502933895,
+      280860879781735 },
+    { 1676737606073105, 459018290350841, 506084650755301, 576730797509298,
+      232853032626074 },
+    { 222453425419780, 1881231455372494, 356159674087381, 2031436073565603,
+      1587722788974501 } },
+  { { 659303913929492, 1956447718227573, 1830568515922666, 841069049744408,
+      1669607124206368 },
+    { 1143465490433355, 1532194726196059, 1093276745494697, 481041706116088,
+      2121405433561163 },
+    { 1686424298744462, 1451806974487153, 266296068846582, 1834686947542675,
+      1720762336132256 } },
+  { { 1032666135924078, 884848650242042, 206547170106245, 957542930593435,
+      1840872952810839 },
+    { 1064938113070779, 2175468959314319, 2187288774846842, 1432833179510794,
+      714195659063305 },
+    { 516270556275240, 676756388735475, 217503846045745, 1925381578676085,
+      1413231930248233 } },
+  { { 1981843689365174, 2188982795223917, 591293320493897, 2123624399030290,
+      943063219937537 },
+    { 1158691329376143, 1216626327463558, 1911663636838662, 980531642284464,
+      848434353517908 },
+    { 523530380656411, 1888605440999310, 760403295835255, 335589895680076,
+      712439792868823 } },
+  { { 1605777102169746, 1902143103431537, 2033172115145115, 219741370035705,
+      2165484589054422 },
+    { 344905623706102, 904955362965574, 733940211431857, 1775457082935810,
+      695263219326426 },
+    { 1711085876208488, 786946305663335, 1464349432048512, 954479365662645,
+      2106243433882463 } },
+  { { 115132773627312, 1360365227688792, 399370903873656, 903377098410635,
+      111527289641792 },
+    { 1920813342730385, 74826507816408, 464545473634629, 1982233679775074,
+      697048869768782 },
+    { 1711118382039883, 668941145317825, 434280036658089, 1221420664346447,
+      1513957595877557 } },
+  { { 1412516180696623, 1684177770559370, 810782015858547, 1526444666828299,
+      730427475837145 },
+    { 1906198282334425, 991719479405032, 1669357971233584, 839000101932111,
+      419470732219080 },
+    { 2121468962649003, 586129222700827, 386186267535986, 2058958620447280,
+      153055223429423 } },
+  { { 544216051965117, 875510234909992, 356503899550249, 454079569470006,
+      25168087661867 },
+    { 208575462511947, 1428836154826589, 2106509794005281, 976762402958802,
+      1511415351332304 },
+    { 1230376496739897, 622578930830040, 461760450259260, 2161248300300614,
+      1929689006078165 } },
+  { { 1320302125946451, 1539221090044982, 356810569136475, 1115709481045557,
+      650011485384257 },
+    { 1470751560632201, 1705821635047480, 1836744003519522, 762431788040488,
+      1892519658539752 },
+    { 1650334458737083, 36719156874850, 2212084439549782, 514637249180105,
+      693459945153438 } },
+  { { 889217026388959, 1043290623284660, 856125087551909, 1669272323124636,
+      1603340330827879 },
+    { 1206396181488998, 333158148435054, 1402633492821422, 1120091191722026,
+      1945474114550509 },
+    { 766720088232571, 1512222781191002, 1189719893490790, 2091302129467914,
+      2141418006894941 } }
+},
+{ /* 42/51 */
+  { { 1653276489969630, 6081825167624, 1921777941170836, 1604139841794531,
+      861211053640641 },
+    { 996661541407379, 1455877387952927, 744312806857277, 139213896196746,
+      1000282908547789 },
+    { 1450817495603008, 1476865707053229, 1030490562252053, 620966950353376,
+      1744760161539058 } },
+  { { 1401939116319266, 335306339903072, 72046196085786, 862423201496006,
+      850518754531384 },
+    { 1234706593321979, 1083343891215917, 898273974314935, 1640859118399498,
+      157578398571149 },
+    { 1143483057726416, 1992614991758919, 674268662140796, 1773370048077526,
+      674318359920189 } },
+  { { 1844293295362215, 1524583677136176, 1827935191421177, 1761145652561373,
+      402445018996936 },
+    { 1359421012066407, 511008775933306, 1235661358650810, 121489457167998,
+      750643479014138 },
+    { 2163920127813722, 1809848067831371, 1226486593520438, 6568253441272,
+      318658165188350 } },
+  { { 1051236049852089, 838236098838683, 1401529863477899, 819561906490618,
+      1695547314615010 },
+    { 906923277717385, 1205267497856625, 1482990850447715, 814292408880760,
+      1285504246425383 },
+    { 342012360452061, 1887029215668228, 1155449753977691, 310762800506541,
+      1868750527042639 } },
+  { { 2045099649207179, 928566106329290, 1751707271775365, 243714904225769,
+      1697122639551309 },
+    { 1621210529396417, 473702830755356, 113967089143876, 2027996109593680,
+      334247609676783 },
+    { 65610840894268, 1859825165272831, 2126326856745773, 1697334161855958,
+      2126062257964925 } },
+  { { 2128931535981228, 1664649369637525, 827251760823705, 281379004955298,
+      2131845370502517 },
+    { 1549958968282246, 1414228225490689, 49341428489142, 1907649166629107,
+      2053446999937698 },
+    { 91328232413243, 1349171648880840, 1320143522454812, 2071016680285748,
+      1098830160269076 } },
+  { { 854573969898278, 918371593761593, 880440820932196, 330442526363771,
+      1985515427672874 },
+    { 371116706915478, 958241665679581, 1788343016949073, 2039742682106485,
+      617386814520640 },
+    { 1406636081701774, 1032905040983927, 1211964732051439, 783496875254481,
+      1256336848183949 } },
+  { { 446777329491613, 1182111476573108, 361578732926394, 969051558291558,
+      551871149504900 },
+    { 1502211512267751, 522814637298393, 2125300438723032, 2018782704272556,
+      1170472673030354 },
+    { 883746203814773, 276737323512287, 2229390196673160, 2155663378443822,
+      635390057802745 } },
+  { { 901746448893728, 535719694452731, 232367332688389, 1187239826444625,
+      1846767342985634 },
+    { 696694156725365, 486651037873822, 1801514994292338, 212132803137369,
+      361850231722772 },
+    { 830941077896381, 1322873948469225, 251496686218292, 318047334754654,
+      2222624896040938 } },
+  { { 1352880640834541, 360532727283478, 1159364083323608, 124995472839866,
+      1534041447364786 },
+    { 433411144892763, 1230530410714249, 1906292125361651, 1466765531131955,
+      919741938184793 },
+    { 1534635678949293, 1410766953739367, 418241675069218, 1896729587147142,
+      1827680478578861 } },
+  { { 308682750118944, 2191203377428859, 2246545138725771, 1754049138321491,
+      2156687129189500 },
+    { 881227328359103, 726015696236115, 1540593909497382, 1222487066053195,
+      802677171270674 },
+    { 1679686012578185, 1371607734878063, 138425201854233, 1476676924317623,
+      1374552427345337 } },
+  { { 840689961188280, 666855865921493, 2236632145763388, 553161305644429,
+      770093598280661 },
+    { 1845357083269366, 283024454100284, 1261058990950787, 83148423763794,
+      1614274061088985 },
+    { 1649953183870355, 2176771717569818, 1233096109604549, 1152511702037810,
+      560573824644263 } },
+  { { 2008352035910449, 3220462166446, 2227552503409279, 894520393273629,
+      148134799193470 },
+    { 875869235476678, 134925755531231, 675734772318499, 1459975059883042,
+      1758218695339523 },
+    { 1404434757101278, 182322009021126, 383952158933780, 1345632294052636,
+      160570997200964 } },
+  { { 1896557090818885, 2177967273225863, 688252864070162, 1162905249241173,
+      937700276968149 },
+    { 52817761712085, 1070719382900173, 1031179099999604, 1840566549419915,
+      1254523675887533 },
+    { 178945920129419, 2132448796881487, 1238333428203160, 12518861204367,
+      1635779697751396 } },
+  { { 1868460022584118, 477707895119178, 248251244708541, 809499157585398,
+      162751069089006 },
+    { 1092375135494391, 428349888689423, 1683929485226826, 1349279922257845,
+      1345709583824059 },
+    { 398018487814899, 1413472237113061, 242537396843158, 999253431182310,
+      2066990216613622 } },
+  { { 1027653299140521, 430869933716354, 39439958469758, 1392853852430383,
+      1280424544026220 },
+    { 1374992270629118, 886701324738892, 997915444084346, 1696807732220344,
+      949943622938188 },
+    { 380965098906693, 835788132761480, 2232989119976139, 2205277179143298,
+      1175904351372329 } }
+},
+{ /* 43/51 */
+  { { 1926650836092769, 1141267952622767, 1136176853749112, 2038056869767014,
+      1320936551384977 },
+    { 1594911994296225, 1802592071832, 643263241942676, 120105560381493,
+      1062009661984977 },
+    { 283489509389185, 614480115735096, 278795579529276, 1166609138076060,
+      1715497286463476 } },
+  { { 1835401379538542, 173900035308392, 818247630716732, 1762100412152786,
+      1021506399448291 },
+    { 1506632088156630, 2127481795522179, 513812919490255, 140643715928370,
+      442476620300318 },
+    { 2056683376856736, 219094741662735, 2193541883188309, 1841182310235800,
+      556477468664293 } },
+  { { 559372501390264, 1903063760916713, 2084280070228981, 1932998595236375,
+      2157685623964146 },
+    { 1660073100338746, 1238978483873930, 1753429549921020, 1191701436292493,
+      96556664529752 },
+    { 12301548690893, 2040905970231969, 323510844601644, 1280458839302984,
+      1545657348700985 } },
+  { { 1315019427910827, 1049075855992603, 2066573052986543, 266904467185534,
+      2040482348591520 },
+    { 94096246544434, 922482381166992, 24517828745563, 2139430508542503,
+      2097139044231004 },
+    { 537697207950515, 1399352016347350, 1563663552106345, 2148749520888918,
+      549922092988516 } },
+  { { 734172103684730, 461956071504065, 1128556529475497, 282375043938404,
+      1116152012818178 },
+    { 1450719658568590, 1393218840718540, 759099863883078, 679464535186194,
+      1685930497072763 },
+    { 238670680221856, 444630502403267, 1952043759970279, 519780308028670,
+      722571434947767 } },
+  { { 1747985413252434, 680511052635695, 1809559829982725, 594274250930054,
+      201673170745982 },
+    { 323583936109569, 1973572998577657, 1192219029966558, 79354804385273,
+      1374043025560347 },
+    { 213277331329947, 416202017849623, 1950535221091783, 1313441578103244,
+      2171386783823658 } },
+  { { 1467541083089918, 2045178754505438, 1012333420789806, 1494691497860722,
+      1876381579011925 },
+    { 419366927575750, 2170606220244329, 140403889680809, 1600530433585227,
+      131712959551530 },
+    { 2073535269238105, 1216465921282243, 425737158613410, 720748141542532,
+      1407788954240839 } },
+  { { 189088804229831, 993969372859110, 895870121536987, 1547301535298256,
+      1477373024911350 },
+    { 1620578418245010, 541035331188469, 2235785724453865, 2154865809088198,
+      1974627268751826 },
+    { 1346805451740245, 1350981335690626, 942744349501813, 2155094562545502,
+      1012483751693409 } },
+  { { 973021769255784, 251897143490130, 2128452029617726, 1591014306721264,
+      31963257562286 },
+    { 1942382337266097, 299983387987974, 212387868389994, 497770809721718,
+      1575140533040175 },
+    { 2082008772213293, 524418023316508, 1085827984104030, 836955105078749,
+      597127312754618 } },
+  { { 2107080134091762, 1132567062788208, 1824935377687210, 769194804343737,
+      1857941799971888 },
+    { 1074666112436467, 249279386739593, 1174337926625354, 1559013532006480,
+      1472287775519121 },
+    { 1872620123779532, 1892932666768992, 1921559078394978, 1270573311796160,
+      1438913646755037 } },
+  { { 1140928805993963, 542733342306404, 17051043689541, 1803198722575545,
+      2005828121338219 },
+    { 1839912790725979, 1633312664508808, 507213137039308, 1632164384755208,
+      735023745825078 },
+    { 2080431450542792, 314050346493738, 1863636881499643, 1795480078118760,
+      2120158915186502 } },
+  { { 837390187648199, 1012253300223599, 989780015893987, 1351393287739814,
+      328627746545550 },
+    { 1028328827183114, 1711043289969857, 1350832470374933, 1923164689604327,
+      1495656368846911 },
+    { 1900828492104143, 430212361082163, 687437570852799, 832514536673512,
+      1685641495940794 } },
+  { { 24190764113271, 1427406537451298, 1860142339069371, 1915589115690763,
+      794428004899923 },
+    { 454720724687424, 1438084947984365, 1587489189522798, 1153892996191027,
+      1478603146123758 },
+    { 2212965464303333, 1976153924922682, 1877787409693943, 1001538805362022,
+      919523566226359 } },
+  { { 842632847936398, 605670026766216, 290836444839585, 163210774892356,
+      2213815011799645 },
+    { 1176336383453996, 1725477294339771, 12700622672454, 678015708818208,
+      162724078519879 },
+    { 1448049969043497, 1789411762943521, 385587766217753, 90201620913498,
+      832999441066823 } },
+  { { 1259456577330918, 433210798998162, 311509342000855, 1413504179658963,
+      453855096391026 },
+    { 2003706449383297, 2219848735380928, 1857957883540787, 278023174081461,
+      1199884351894310 },
+    { 1628249969551088, 1834155458607214, 1978875861318997, 1652466835060603,
+      1563391140347881 } },
+  { { 516086333293313, 2240508292484616, 1351669528166508, 1223255565316488,
+      750235824427138 },
+    { 1263624896582495, 1102602401673328, 526302183714372, 2152015839128799,
+      1483839308490010 },
+    { 442991718646863, 1599275157036458, 1925389027579192, 899514691371390,
+      350263251085160 } }
+},
+{ /* 44/51 */
+  { { 708933751359100, 2107676482823116, 1657279889267301, 1609984394439769,
+      1082526754413784 },
+    { 1606753372548095, 1940797730019702, 2170465741030982, 557319246680918,
+      1999867966032864 },
+    { 1823622181083017, 408967151178094, 2033143529389867, 2209724434343478,
+      918118538477317 } },
+  { { 590468521603508, 1888183319191452, 1440689086131057, 1677336684221251,
+      1925080943820196 },
+    { 1585117306142537, 1612495744818187, 2023976907380213, 2224019669007289,
+      182352658157013 },
+    { 463491021439363, 1750609461077078, 1169967881279297, 474253519600450,
+      901070375860211 } },
+  { { 1234176672107405, 1118156106770039, 1401308706374344, 49246839018891,
+      129899069235955 },
+    { 2148892609267637, 156091090159501, 219195676377608, 1764671763402282,
+      1450853793183865 },
+    { 288029433804634, 1918327772711516, 1858109617364668, 1548745667412753,
+      1635036158704975 } },
+  { { 1915560744141480, 968144533182421, 1684794323668365, 813038486884416,
+      485174716721005 },
+    { 396318558702260, 1083473990827737, 904833535607248, 1965475057496774,
+      806903729265008 },
+    { 131383425958682, 1726194406199626, 1195125520329959, 1269440178344704,
+      1934708138886976 } },
+  { { 2185121667669569, 1115206785572251, 704158439711004, 2133851508118048,
+      1251130304627637 },
+    { 309139531546063, 2049522628380760, 1821330378737221, 2189050579333957,
+      379745028034240 },
+    { 1895230235031468, 1896812472261458, 768470747222158, 1996242383935516,
+      1420798451369434 } },
+  { { 1579856931436900, 195251954153981, 616268009970342, 1688893962924789,
+      2116170079089324 },
+    { 1336195493856024, 616151775822139, 132656637077528, 800859950704494,
+      523331976590323 },
+    { 556211501812000, 449190026847667, 2036295767110360, 128995208617458,
+      1118467502984960 } },
+  { { 1146590809115000, 1820230761045333, 438948341893375, 844036154978819,
+      278417404664415 },
+    { 1098861443862149, 1056118674042928, 602217524379356, 1351672530126771,
+      1647296273265328 },
+    { 1878982227582804, 1431346083601994, 1534977024077189, 2155113334662581,
+      1782950372830762 } },
+  { { 352512930664620, 200908289136568, 978667112601609, 2118488738947709,
+      52678658272637 },
+    { 194062342816527, 1511332321457621, 529868032979417, 655355508011806,
+      156865380492922 },
+    { 1390885694073460, 1816639772663275, 1066627353945560, 1454561122724455,
+      848860562366790 } },
+  { { 311990017335629, 1091918781323390, 7225575992672, 1392665428080843,
+      1419667725388688 },
+    { 1037229489569527, 1696948685764563, 756950827500384, 172789937573414,
+      2131746869365416 },
+    { 981545110828877, 510698765880228, 2161678679515528, 1436791773758609,
+      1673597748298096 } },
+  { { 1362423483981320, 1645590394493468, 560194225449327, 706889687388840,
+      112066720001886 },
+    { 2077913249267885, 435740348991502, 455102608277438, 1017083340491715,
+      1887945258539676 },
+    { 1294858674770242, 529668890256843, 2030539078163824, 294693146073477,
+      969527805905143 } },
+  { { 1176127152490464, 1894013131106171, 1812632908007715, 1499234933639326,
+      38073564802511 },
+    { 166771756371767, 1751136701203931, 463260219240212, 233141483231652,
+      257357799953754 },
+    { 61868149975749, 236120696290007, 608351327055311, 1829919587421069,
+      1627340269896729 } },
+  { { 1471096269274020, 1863222026681565, 2044934869352810, 1385880696113195,
+      1308481967864035 },
+    { 558660333338486, 437631012595498, 1856230475161709, 1064559516436452,
+      1138159299114818 },
+    { 1796753889379582, 2232245583163596, 176790521107364, 133826841897595,
+      1041041183235991 } },
+  { { 1172839421931844, 278706227560696, 950602465490964, 1867524240141887,
+      1078908361802522 },
+    { 1286134762329693, 746629033585650, 1285368254294412, 2031616339452574,
+      1293923059816597 },
+    { 1442655471934418, 1764674447040318, 316317796980033, 318184491515700,
+      1168933061547497 } },
+  { { 1580156396502051, 956444557002442, 223926404960590, 565074765027696,
+      2169726994764050 },
+    { 1348045269148289, 1645046732186345, 2051914281511704, 29227876891307,
+      1516962114670480 },
+    { 1942280341359651, 50425926664281, 1816034234875212, 880607828368837,
+      2092912650330571 } },
+  { { 1344167653424867, 1048535312223495, 1948741777806718, 820931006927219,
+      1645288196866884 },
+    { 1009166234092554, 1873916818816345, 420931069742281, 734656291044843,
+      1401802257793081 },
+    { 1745152490874503, 1836336442271605, 2042898833391948, 1540893062903555,
+      1183365031475960 } },
+  { { 1689713572022143, 593854559254373, 978095044791970, 1985127338729499,
+      1676069120347625 },
+    { 1557207018622683, 340631692799603, 1477725909476187, 614735951619419,
+      2033237123746766 },
+    { 968764929340557, 1225534776710944, 662967304013036, 1155521416178595,
+      791142883466590 } }
+},
+{ /* 45/51 */
+  { { 1487081286167458, 993039441814934, 1792378982844640, 698652444999874,
+      2153908693179754 },
+    { 1123181311102823, 685575944875442, 507605465509927, 1412590462117473,
+      568017325228626 },
+    { 560258797465417, 2193971151466401, 1824086900849026, 579056363542056,
+      1690063960036441 } },
+  { { 2024297515263178, 416959329722687, 1079014235017302, 171612225573183,
+      1031677520051053 },
+    { 2033900009388450, 1744902869870788, 2190580087917640, 1949474984254121,
+      231049754293748 },
+    { 343868674606581, 550155864008088, 1450580864229630, 481603765195050,
+      896972360018042 } },
+  { { 1155762232730333, 980662895504006, 2053766700883521, 490966214077606,
+      510405877041357 },
+    { 1683750316716132, 652278688286128, 1221798761193539, 1897360681476669,
+      319658166027343 },
+    { 618808732869972, 72755186759744, 2060379135624181, 1730731526741822,
+      48862757828238 } },
+  { { 1784446333136569, 1973746527984364, 334856327359575, 1156769775884610,
+      1023950124675478 },
+    { 2065270940578383, 31477096270353, 306421879113491, 181958643936686,
+      1907105536686083 },
+    { 1496516440779464, 1748485652986458, 872778352227340, 818358834654919,
+      97932669284220 } },
+  { { 378489645873232, 2051409995957990, 2137890426251559, 613350707081978,
+      2183646505352379 },
+    { 1955493045556948, 2187438143192128, 1963031234384998, 1613569784294384,
+      1700175812052548 },
+    { 250950165450403, 2108575357747549, 1858230594483734, 184468003072844,
+      1358638013010624 } },
+  { { 891039147350730, 498786796467410, 773550976507042, 652448826471938,
+      1143072395278581 },
+    { 1436956904723354, 57793661986291, 1246493353324586, 2226040415853889,
+      1680587558253594 },
+    { 913282769158846, 347533899935257, 99606006705773, 1452035970297517,
+      2212487011762079 } },
+  { { 616470521493868, 390707946935204, 1334622907385598, 2029831529830923,
+      561935527869423 },
+    { 99688957658625, 2023695028984104, 56375765123599, 823225854771677,
+      381872304195855 },
+    { 1307353080865175, 1065210115652369, 1698012640184922, 2095589265946492,
+      688919666182564 } },
+  { { 432661147328404, 1458149898387512, 1783966662497693, 1338383483986408,
+      1938129546538183 },
+    { 1362667331125037, 555463793483067, 2233240717963474, 1482036091634425,
+      897559387782686 },
+    { 40033251972751, 73885946378640, 1935473366247146, 1461619709267546,
+      1211799649582059 } },
+  { { 856050655293007, 625552534444471, 1949074755630095, 2080295055883097,
+      1800727405161369 },
+    { 1483890803938325, 1461858743677870, 174058631623982, 522721431293074,
+      1164457329435180 },
+    { 1776202539459751, 975771780761243, 1334517592778688, 1410991024059602,
+      889205064507764 } },
+  { { 1183682518918849, 28331239118069, 1257870280100410, 1925778381931009,
+      1203315342590312 },
+    { 1414479522399936, 1610610607251887, 526895587584916, 1765729271236840,
+      220991592057611 },
+    { 215730067641434, 1360758427645829, 2150670384649262, 552613675218089,
+      1863176593649028 } },
+  { { 574271726643291, 242767670581538, 71106632106535, 68832874241774,
+      1552472068529946 },
+    { 530520812577235, 2051363420683407, 849260636482086, 1350498133745193,
+      567355005130969 },
+    { 1393012487839481, 740046055258358, 1707186853112759, 1807102851241676,
+      1182772779251109 } },
+  { { 1217373891052476, 1229861322886872, 907130593033364, 1455532918696136,
+      859828955375688 },
+    { 1891735986457638, 1901246726633, 1156881518146549, 1926112431884414,
+      1827459831287260 },
+    { 1487962041721869, 269343496694427, 1257556852029515, 342720658723,
+      2099204209535358 } },
+  { { 462202769565095, 2134939108448834, 1888046606664116, 445888912730648,
+      1853449060933092 },
+    { 2011655757314617, 41273341515635, 817864464467686, 1634024977070844,
+      1037737573540327 },
+    { 2174964912209709, 2056192344011136, 1144934207854325, 100738834828862,
+      553153320866448 } },
+  { { 1635468113363381, 204503582489766, 411447521264729, 1403034457568111,
+      994816930770749 },
+    { 781324548368282, 1981483346448620, 341040916867775, 1054057856397815,
+      315990133561626 },
+    { 1852524649820135, 1973075669000398, 2133906781195653, 486610900641628,
+      166885035266310 } },
+  { { 816210169167126, 300034143179105, 349704315662675, 1563263728608904,
+      2251279681964546 },
+    { 1836055376204936, 222031140374553, 183636660518416, 1406887891665378,
+      2064311044808070 },
+    { 671162560365052, 1928229799009345, 1193681299321019, 1081751953487306,
+      1197332305250387 } },
+  { { 49425255395021, 2184860938031359, 21532237643300, 1704804667098003,
+      1911735781256473 },
+    { 746857581688692, 2121876522621080, 578602395071792, 691986710522145,
+      2051278946864590 },
+    { 2217303387266656, 2227853943602075, 1384266551040407, 847818056628355,
+      1874126181291960 } }
+},
+{ /* 46/51 */
+  { { 995506859453010, 174069429422226, 370685091406527, 2040657700179410,
+      1450858492090282 },
+    { 1421908854362862, 161715173892682, 1729749930861440, 1836384830865689,
+      48949287445656 },
+    { 1636572211186580, 2000987144770729, 1893417472062746, 196779160527558,
+      1557344243161357 } },
+  { { 1495731174651295, 280947107652162, 2156800382632015, 1987445924091844,
+      1196317565653296 },
+    { 2250306499911260, 1939747202154883, 1217632366505406, 177514286663808,
+      968879985948762 },
+    { 483117633444291, 1721449975252800, 2014677970681898, 2079902425951169,
+      117285229800651 } },
+  { { 1507079336277406, 16158670400411, 725842773817224, 2203610500470887,
+      1640888914156664 },
+    { 533526002845609, 2065287278461364, 2142958807833890, 917611533866144,
+      948962334848887 },
+    { 1753063336824455, 1632699439142352, 654655992711894, 254878945844677,
+      1142235737877277 } },
+  { { 471636015770351, 672455402793577, 1804995246884103, 1842309243470804,
+      1501862504981682 },
+    { 1013216974933691, 538921919682598, 1915776722521558, 1742822441583877,
+      1886550687916656 },
+    { 2094270000643336, 303971879192276, 40801275554748, 649448917027930,
+      1818544418535447 } },
+  { { 1148080446050112, 2132613961523904, 1250420090952542, 1073606637042265,
+      1136316631918667 },
+    { 432364473242774, 39743790059724, 220093305287024, 882695210228712,
+      1250284879006172 },
+    { 1308793608120261, 1449040386580588, 1101631154183215, 1497130864799324,
+      169852361549146 } },
+  { { 226003849082303, 601179975359759, 940631827741356, 1127612465735266,
+      1440820191536310 },
+    { 1495639527602816, 57301448208046, 1451497740129468, 55936708618434,
+      964571251189964 },
+    { 123418138995758, 1978567312772587, 1348730554478157, 544009099976318,
+      1458271200647609 } },
+  { { 2069974909117054, 1308061796902428, 18943199885610, 583641514327845,
+      1473321168223286 },
+    { 1178878122763439, 651039868237756, 1648769735446867, 222010915543153,
+      265722501450619 },
+    { 186894202868784, 669642538748472, 1751029408900890, 1452410162706295,
+      822484923996253 } },
+  { { 2241737709499165, 549397817447461, 838180519319392, 1725686958520781,
+      1705639080897747 },
+    { 1216074541925116, 50120933933509, 1565829004133810, 721728156134580,
+      349206064666188 },
+    { 948617110470858, 346222547451945, 1126511960599975, 1759386906004538,
+      493053284802266 } },
+  { { 280010732133130, 1127293372965981, 697004887613663, 1905238191128068,
+      59718893485038 },
+    { 1882853235706949, 1486349571810895, 315344009398372, 1720850569909845,
+      1885508469335244 },
+    { 302250423214367, 1199248533314516, 412562080741735, 342674503581715,
+      2011860141589142 } },
+  { { 1115724079290882, 996151854744842, 243820983295152, 195938920815985,
+      2033304248964972 },
+    { 139923192654984, 2107130100572776, 1240777965371817, 2103236269512710,
+      1663961419492268 },
+    { 1690516266667235, 1717206722742664, 2018042702156749, 464771311355946,
+      1988881378065658 } },
+  { { 1381412085068908, 732552219394798, 301501327778185, 724616833762094,
+      2176374340517301 },
+    { 1360232738930430, 1681103625656341, 1681678041101659, 1002066218704533,
+      974084946079387 },
+    { 851280348776322, 502663124878735, 236458711302258, 1405209842341265,
+      32876714630465 } },
+  { { 1454933046815146, 874696014266362, 1467170975468588, 1432316382418897,
+      2111710746366763 },
+    { 2105387117364450, 1996463405126433, 1303008614294500, 851908115948209,
+      1353742049788635 },
+    { 750300956351719, 1487736556065813, 15158817002104, 1511998221598392,
+      971739901354129 } },
+  { { 880882702716428, 1343016116845607, 673480262952192, 845417915536923,
+      1757668258348114 },
+    { 516635705924950, 389437712595068, 953767331309091, 85616409135632,
+      1899366837799687 },
+    { 1366945846088313, 397665071074633, 2041470664790369, 1336251042978385,
+      402822314074967 } },
+  { { 1766199893942014, 2222443124693628, 398404112948141, 2156049858134716,
+      724839098982177 },
+    { 1571960295737743, 741550805159082, 2210044322631075, 2049659627493195,
+      1095433159356314 },
+    { 1240686409044907, 1039246640562740, 873168255244058, 843905570744233,
+      770445828097935 } },
+  { { 134089861572677, 1170046804773399, 1042699677041134, 1452901496172787,
+      1342772147908152 },
+    { 1976930657209303, 604256764565367, 942565869803012, 1969793213537015,
+      287887744771686 },
+    { 1734092303337487, 655166109590567, 169444734753546, 107887918923613,
+      1936609614094343 } },
+  { { 1874648163531693, 2124487685930551, 1810030029384882, 918400043048335,
+      586348627300650 },
+    { 1235084464747900, 1166111146432082, 1745394857881591, 1405516473883040,
+      4463504151617 },
+    { 1663810156463827, 327797390285791, 1341846161759410, 1964121122800605,
+      1747470312055380 } }
+},
+{ /* 47/51 */
+  { { 207343737062002, 1118176942430253, 758894594548164, 806764629546266,
+      1157700123092949 },
+    { 1273565321399022, 1638509681964574, 759235866488935, 666015124346707,
+      897983460943405 },
+    { 1717263794012298, 1059601762860786, 1837819172257618, 1054130665797229,
+      680893204263559 } },
+  { { 1271231670673207, 572836852528616, 143342018841698, 770528850757884,
+      250108126336533 },
+    { 721508221232856, 1746185362187777, 649848024809540, 1643484536323064,
+      1179347009186690 },
+    { 722866669050453, 648025000876863, 272387785321835, 1191578896340587,
+      133025146298323 } },
+  { { 1863434339091715, 610755080219982, 336105644451907, 1779875111798618,
+      1215984716204076 },
+    { 1776812170386043, 643146841740442, 1599153562043133, 344303089657238,
+      1303753025416380 },
+    { 329905478564481, 1421107176602190, 1343194203406881, 869619073106369,
+      1647167628966590 } },
+  { { 82857304500618, 1554338034359360, 760468202446199, 93034647782207,
+      688719719651552 },
+    { 2178219113942829, 1024549486604539, 1632802890914011, 1790174780762258,
+      1653222380589718 },
+    { 2128452325542740, 952454207454828, 1516099560539414, 1362377470631451,
+      1181280467630705 } },
+  { { 2218921838783613, 224370674827382, 1946912822553785, 1338754233237346,
+      2214541312782815 },
+    { 1001897353326305, 802080864698926, 882135072405699, 1018497632229281,
+      1691641498559786 },
+    { 346062045061520, 403415728512797, 1497343909041141, 1612206736581155,
+      310674675283815 } },
+  { { 1234316951156125, 523003930516900, 786537036458099, 587803232898987,
+      1645722164542235 },
+    { 1626105811055763, 1108425817222319, 1368577262542202, 1305824653124397,
+      1291284997707495 },
+    { 894237486099210, 1516039905189318, 1740044048087400, 593444525063043,
+      2109764897178862 } },
+  { { 1742426409644216, 122650977230455, 716311679285696, 94328784589776,
+      661593009781041 },
+    { 2015053493948246, 238326149030243, 1494925031424444, 1637858295120923,
+      820282138409657 },
+    { 249646757520424, 463187003030520, 1638741771298768, 1722746044679283,
+      1356170553778095 } },
+  { { 1482109974932762, 1512691293799179, 1056618842237051, 1669766513116243,
+      1645628848588889 },
+    { 1373561144490400, 1204823121475578, 1535466087890943, 1654057093724213,
+      1457988383716911 },
+    { 134048702591674, 1512942576919112, 1666722043826583, 1830910766776036,
+      90483195207340 } },
+  { { 698850959866052, 1467740234924962, 593635060416714, 1398815963059072,
+      2214410230686989 },
+    { 458133076652574, 1951912335248484, 2230508331810296, 1528194724762166,
+      1675904175884762 },
+    { 843267344567400, 2145042463113149, 734763047999013, 235326347313127,
+      1921359382727290 } },
+  { { 242638196481708, 1432383122970499, 1373327814736372, 1764585753875764,
+      464067108961610 },
+    { 1510449339451312, 916047817203617, 516663857623252, 1445637979382315,
+      1580153534770815 },
+    { 914153294895020, 1485178337004016, 1172992438642136, 742396957515979,
+      1460451697085215 } },
+  { { 1704914242617752, 709122460572639, 1959392776815431, 1070184512917302,
+      351708174608949 },
+    { 1263440250990151, 1852460228586041, 866379172700499, 284304453783723,
+      329200753304407 },
+    { 647139090180908, 171468002089079, 47305002680053, 1523723513433825,
+      870936632075717 } },
+  { { 629876504002066, 875797994426523, 1680974550469384, 379692973243407,
+      2080467460645230 },
+    { 1041541771776987, 410986020624753, 1173847847203529, 1599676982141034,
+      684152561028988 },
+    { 1084836891982052, 405373371974756, 392292573225522, 1228291428535054,
+      196706224397467 } },
+  { { 1507590730480201, 386047389810631, 1784533499340516, 278900333648306,
+      1314970522229532 },
+    { 1367419007744625, 1596951084594223, 526957670617693, 227461077608289,
+      1488759696938384 },
+    { 2173782522915487, 222544900970817, 502956725804422, 2132363547946651,
+      924455062029847 } },
+  { { 2181085219797589, 186467806208455, 1398091257339580, 1543623638852333,
+      24079936812708 },
+    { 919366765858854, 1265998847343319, 1239257288722888, 846012957753740,
+      594713398434214 },
+    { 1451708073273912, 640663458576442, 472967005176057, 1940369909273489,
+      1650816055376110 } },
+  { { 1851307961005151, 1994725480678878, 824517717511833, 153681639332115,
+      634115154985188 },
+    { 2095291872046291, 22408327516691, 752670956759673, 274635341683808,
+      172935590280231 },
+    { 2103643973577651, 977952042935150, 1142478652795736, 1026447359732549,
+      376510521784131 } },
+  { { 604257425371268, 1647914007806880, 1178627125851434, 1025033951888023,
+      1528786153297882 },
+    { 1271992142776406, 306128060193141, 1814967755510541, 1676050795259182,
+      1038924484586542 },
+    { 1406590024268518, 1220852036090080, 364949301397175, 1654716393716139,
+      143122595639438 } }
+},
+{ /* 48/51 */
+  { { 2237039662793603, 2249022333361206, 2058613546633703, 149454094845279,
+      2215176649164582 },
+    { 79472182719605, 1851130257050174, 1825744808933107, 821667333481068,
+      781795293511946 },
+    { 755822026485370, 152464789723500, 1178207602290608, 410307889503239,
+      156581253571278 } },
+  { { 1418185496130297, 484520167728613, 1646737281442950, 1401487684670265,
+      1349185550126961 },
+    { 1495380034400429, 325049476417173, 46346894893933, 1553408840354856,
+      828980101835683 },
+    { 1280337889310282, 2070832742866672, 1640940617225222, 2098284908289951,
+      450929509534434 } },
+  { { 407703353998781, 126572141483652, 286039827513621, 1999255076709338,
+      2030511179441770 },
+    { 1254958221100483, 1153235960999843, 942907704968834, 637105404087392,
+      1149293270147267 },
+    { 894249020470196, 400291701616810, 406878712230981, 1599128793487393,
+      1145868722604026 } },
+  { { 1497955250203334, 110116344653260, 1128535642171976, 1900106496009660,
+      129792717460909 },
+    { 452487513298665, 1352120549024569, 1173495883910956, 1999111705922009,
+      367328130454226 },
+    { 1717539401269642, 1475188995688487, 891921989653942, 836824441505699,
+      1885988485608364 } },
+  { { 1241784121422547, 187337051947583, 1118481812236193, 428747751936362,
+      30358898927325 },
+    { 2022432361201842, 1088816090685051, 1977843398539868, 1854834215890724,
+      564238862029357 },
+    { 938868489100585, 1100285072929025, 1017806255688848, 1957262154788833,
+      152787950560442 } },
+  { { 867319417678923, 620471962942542, 226032203305716, 342001443957629,
+      1761675818237336 },
+    { 1295072362439987, 931227904689414, 1355731432641687, 922235735834035,
+      892227229410209 },
+    { 1680989767906154, 535362787031440, 2136691276706570, 1942228485381244,
+      1267350086882274 } },
+  { { 366018233770527, 432660629755596, 126409707644535, 1973842949591662,
+      645627343442376 },
+    { 535509430575217, 546885533737322, 1524675609547799, 2138095752851703,
+      1260738089896827 },
+    { 1159906385590467, 2198530004321610, 714559485023225, 81880727882151,
+      1484020820037082 } },
+  { { 1377485731340769, 2046328105512000, 1802058637158797, 62146136768173,
+      1356993908853901 },
+    { 2013612215646735, 1830770575920375, 536135310219832, 609272325580394,
+      270684344495013 },
+    { 1237542585982777, 2228682050256790, 1385281931622824, 593183794882890,
+      493654978552689 } },
+  { { 1448933928004639, 2019165860436684, 839545028551310, 954045289946680,
+      605871795457102 },
+    { 2181948027120817, 1469821966663216, 495537385849601, 447095384662436,
+      711932068643874 },
+    { 2031235379883797, 946220755552074, 1457648474415011, 1222951728743327,
+      1610191601040290 } },
+  { { 1461436857021091, 1708249553383011, 1441184960961852, 2138372449656361,
+      2208801341603864 },
+    { 1910495819629329, 243904881001403, 916503175988358, 737664162956505,
+      148512866676450 },
+    { 743176047113998, 1210025633688996, 1298930577649249, 2241929289171655,
+      319185600078644 } },
+  { { 109955663596505, 1668279743409002, 1772761852174941, 2188727617473580,
+      1972330964627961 },
+    { 211874206232687, 299241082919300, 1560447662280358, 777739777537607,
+      1611135468853981 },
+    { 2224894613062235, 459022333460366, 853633232091964, 42662368548958,
+      1428459390829900 } },
+  { { 1888400628800904, 994643156686671, 2048876033526184, 418388094414663,
+      2174354817875660 },
+    { 1373340083891363, 979957454916983, 1089096356271731, 237603348017998,
+      995178316184850 },
+    { 1865410028261408, 627467389699032, 146077987303115, 1698467014229834,
+      2014393109530681 } },
+  { { 418844978152214, 399963620508069, 33220232591578, 2227807589256769,
+      1464013488829088 },
+    { 1087327009286572, 1463860919773049, 407789662304423, 1950415221080672,
+      1074473983968709 },
+    { 1806473647942365, 538787999504182, 512973154409687, 1944932181085518,
+      1069910541821032 } },
+  { { 342138165311106, 157664552291421, 2076140577147017, 2175301861378049,
+      1879995664155907 },
+    { 382958515679658, 355913288431307, 424788048423920, 2186335772603459,
+      1408707358783051 },
+    { 407209884855019, 2088464831333939, 2111856537862679, 1631244096914416,
+      1074707055277992 } },
+  { { 502401202015822, 2110371415921011, 277866920771080, 515443390912203,
+      89974392681169 },
+    { 2127890637662291, 1895922559173190, 1539875255118981, 1579085739040792,
+      980339195955319 },
+    { 1547018311600067, 615783499206767, 485547569767288, 1517514580034299,
+      457611163959317 } },
+  { { 1941635877650350, 41136794015779, 802548087270427, 553714331402352,
+      386035892408446 },
+    { 1253759950575250, 1509487323905258, 578311512025850, 212916427969408,
+      1753384794452412 },
+    { 1415499622184076, 11739232724558, 1448526577403933, 77973485783393,
+      148463223858677 } }
+},
+{ /* 49/51 */
+  { { 311441914860102, 648657507285395, 2021653799300721, 1829986640373467,
+      1684057546885166 },
+    { 1304756256783871, 1600981150400111, 901595917857192, 242747876317930,
+      1279035873929757 },
+    { 531432570362576, 1071513573823369, 449672118652203, 98547521251379,
+      260579416510065 } },
+  { { 50302027267574, 423806012475259, 1179614475371999, 273291038306754,
+      1591101869035053 },
+    { 2041024517366388, 906640306630802, 1870667933915535, 1018654973521110,
+      670144050027407 },
+    { 67986117053250, 143032219413988, 187059126532888, 1606721935579222,
+      2108737133289470 } },
+  { { 608607226436064, 1177142915116464, 893340840255623, 1733521080031483,
+      935074982514089 },
+    { 812295789681636, 324775898964235, 2192210973050135, 1489710278245695,
+      1388601324428403 },
+    { 731527977617797, 464892677638406, 850380242165564, 1707297435867315,
+      797914062581028 } },
+  { { 51064528108022, 111517112206598, 1559429527589512, 2124275860379685,
+      1685170275648173 },
+    { 545023831723124, 1093783076745175, 1713278174184402, 137023744208400,
+      408433093622657 },
+    { 567087552892581, 1562927351866469, 299640978917608, 868196882482839,
+      81953139898216 } },
+  { { 684328204421715, 1695470026893169, 721327698919107, 1666309508011310,
+      2226049713730899 },
+    { 1005527096376467, 623839385825901, 2058830440859393, 182843688056684,
+      221130622007413 },
+    { 1512722216346670, 113316334999619, 1851114541854723, 1700671412068281,
+      1858477808352196 } },
+  { { 1264907271299989, 1394622056509400, 1944208348735795, 496588693406690,
+      682133441900340 },
+    { 911417584194508, 1880156691051621, 102793854766833, 282686583954398,
+      248402271647827 },
+    { 939102610898658, 657762889309704, 1555084457788919, 1150153333777593,
+      1006706590082496 } },
+  { { 1784370156336175, 2235499907922716, 2025309612181078, 2188885065316605,
+      981283554040234 },
+    { 1086073212868270, 1180494479774104, 884077588584563, 1665545048742165,
+      876115711386548 },
+    { 417210119430620, 1641361429213146, 1508617462812435, 1831075688628217,
+      1813350286884393 } },
+  { { 47341488007760, 1891414891220257, 983894663308928, 176161768286818,
+      1126261115179708 },
+    { 1694030170963455, 502038567066200, 1691160065225467, 949628319562187,
+      275110186693066 },
+    { 1124515748676336, 1661673816593408, 1499640319059718, 1584929449166988,
+      558148594103306 } },
+  { { 1855918485666801, 85218847139860, 1943795207823530, 1299271019794505,
+      793129939003759 },
+    { 1437787085986054, 575082663884137, 1084928851342742, 1306331359548803,
+      493721277016193 },
+    { 1513880360024809, 29168562248162, 2165314857427094, 1804379450950540,
+      1650430035507229 } },
+  { { 1278345890406602, 1197818669477028, 872080263614971, 472824283135648,
+      543528243311291 },
+    { 392501583619091, 762048477147151, 456672548554597, 1631036660752735,
+      1832665983590829 },
+    { 1087102117147681, 1582092198665266, 1088738303263971, 260810848069721,
+      1627775503382807 } },
+  { { 914888535552091, 1918674634203695, 324847672140810, 2148183805078059,
+      530777877681203 },
+    { 1502731211476278, 1540070026598421, 434680235151082, 2138432133829369,
+      180923923635326 },
+    { 1164798514317009, 959101661174465, 1274732634147837, 2054524627744402,
+      618067951231358 } },
+  { { 1982056629379090, 1443322156872454, 924998364295427, 242830475338811,
+      209922624418508 },
+    { 1485573359591916, 622920437630530, 284257977467607, 1600769191523526,
+      1111138611114565 },
+    { 1156098955156446, 2231509525907833, 1577857315123904, 1077644178138027,
+      1603836982733821 } },
+  { { 746155110185659, 1460627821699344, 598986948743842, 1457500393424738,
+      1289258642034583 },
+    { 582360392478705, 1158357221613476, 1694477491150473, 1508047715099324,
+      525911244785368 },
+    { 622524054976691, 245544497063729, 887902868634494, 2133909743039771,
+      820752802227217 } },
+  { { 1876853834786890, 1509541652285156, 2096167915357474, 2042748085445358,
+      175921640781324 },
+    { 2213773410392673, 477185377658997, 1222547349616788, 668563735645780,
+      1116927072020795 },
+    { 1245018876122394, 1675980184045045, 1714757348421567, 517385714455076,
+      1382402866471142 } },
+  { { 1798225724690312, 203841314875595, 1168121189938436, 139321065299860,
+      1619350212325986 },
+    { 1839728679786680, 1938251175953369, 465722836447005, 625248406353107,
+      1746324636842772 },
+    { 1095428490992995, 694761332986399, 303051341154685, 1930267588180245,
+      451250397081114 } },
+  { { 1784525599998356, 1619698033617383, 2097300287550715, 258265458103756,
+      1905684794832758 },
+    { 1288941072872766, 931787902039402, 190731008859042, 2006859954667190,
+      1005931482221702 },
+    { 1465551264822703, 152905080555927, 680334307368453, 173227184634745,
+      666407097159852 } }
+},
+{ /* 50/51 */
+  { { 160425464456957, 950394373239689, 430497123340934, 711676555398832,
+      320964687779005 },
+    { 988979367990485, 1359729327576302, 1301834257246029, 294141160829308,
+      29348272277475 },
+    { 1434382743317910, 100082049942065, 221102347892623, 186982837860588,
+      1305765053501834 } },
+  { { 1050627428414972, 1955849529137135, 2171162376368357, 91745868298214,
+      447733118757826 },
+    { 1287181461435438, 622722465530711, 880952150571872, 741035693459198,
+      311565274989772 },
+    { 1003649078149734, 545233927396469, 1849786171789880, 1318943684880434,
+      280345687170552 } },
+  { { 2006252393530958, 1508680571996938, 954356197543577, 1837108886184047,
+      759769646125864 },
+    { 2172698567966722, 2118345352277226, 2051996099547069, 169753363515973,
+      1287452493356373 },
+    { 1187304510804619, 1384816718516187, 514455602674227, 392638325371554,
+      588228521113051 } },
+  { { 1650059244213943, 1415687339027798, 1500141786956787, 2204874486713657,
+      1294277876097258 },
+    { 137033802346169, 2184552721577514, 539064280617532, 2076540099477398,
+      2066610116555437 },
+    { 1247200432261975, 265507035905438, 1620404126253617, 117362009527087,
+      1746435297969059 } },
+  { { 1825437392176699, 907686900853553, 913817474999877, 376847311554936,
+      952900901511161 },
+    { 16460943316339, 865363558338269, 1081126913053728, 1984198566210168,
+      693911739678591 },
+    { 1735892608800937, 252059696064385, 2231277656792353, 190315520487156,
+      1578798653560771 } },
+  { { 1517000678259824, 1483997169941967, 519539722731871, 2033134998312037,
+      1358032943031124 },
+    { 1528712817748752, 2017766428018612, 1162174112266416, 1812385611328308,
+      2144712073347724 },
+    { 1731716537145363, 1794467547859624, 1646162317162994, 364913230037059,
+      415641914630240 } },
+  { { 867102314969295, 177204163640709, 932706101724694, 895760037431074,
+      1926657328393370 },
+    { 1615507189218466, 2553618189771, 29515181389582, 2060787976858393,
+      452569105748765 },
+    { 2164447073692030, 2235474886627512, 1180432651596109, 840434165754520,
+      17225464249081 } },
+  { { 1068629703061668, 984762690851450, 1229949103789232, 2110232841828031,
+      1092532788851750 },
+    { 837136640501665, 1043670615489504, 2155335349713680, 1236566668693657,
+      1494720534426543 },
+    { 1306097687903586, 1372543655508231, 1658076721821581, 2200003583698537,
+      780636112677937 } },
+  { { 2117492307368618, 1709168226535565, 233762331859812, 425438867395335,
+      1601057748246597 },
+    { 1793659836722917, 791157320000450, 1901380703911097, 671210109200346,
+      409461673241960 },
+    { 845069008464407, 979039615485579, 193913017996729, 449879767959326,
+      372738561109212 } },
+  { { 2213523598938004, 242589778847459, 1840956814213720, 1295450969278652,
+      543389038840695 },
+    { 1502648328069200, 1891078433514958, 74786055052185, 656832420233058,
+      390753562081660 },
+    { 1195481634064188, 1329844785302194, 1313462918982248, 1107475649619426,
+      7376324807793 } },
+  { { 1395918219101738, 521559556798277, 2189317053846815, 1618186630396527,
+      1208380551587558 },
+    { 1404241202649408, 1571994130452022, 1929757983495880, 2092872400096433,
+      1055397564628322 },
+    { 324936075779920, 1871771077744824, 760721314708887, 2236253813618340,
+      1107848804577326 } },
+  { { 814536290823781, 63061116467332, 804840198178091, 8292666531281,
+      2073254466378785 },
+    { 722478309804879, 1188829196206039, 1185414523406556, 1657025426781102,
+      1841660092890563 },
+    { 479894784370716, 1925880613677947, 2183487522494884, 625094381313712,
+      854845126872293 } },
+  { { 1127107758910429, 963256815453345, 978307767128825, 1110718515966990,
+      1940414529352487 },
+    { 1111964474543301, 224153643182257, 745303967966921, 2180916147150830,
+      808318254462192 },
+    { 859228221529707, 1739781089337288, 1717872097995933, 1768216878921818,
+      2055937047555311 } },
+  { { 346901336251706, 522666938795821, 407326620676165, 524211963138110,
+      1927605057667425 },
+    { 295157005295797, 1746357151504686, 2161437362296206, 820950684322906,
+      693759980607742 },
+    { 1888381489837910, 196623655731183, 1928045727190681, 647052441821743,
+      272992419588845 } },
+  { { 1138008309343278, 1286256331388491, 1263031548713040, 1987411587031699,
+      1325648720658323 },
+    { 48319968529799, 1333709797519536, 433601958427117, 995311274909489,
+      1648361620654503 },
+    { 614829280308208, 1807262149284119, 168113001819420, 1469257028090658,
+      1941994949215280 } },
+  { { 817093479351430, 1836962122101804, 919916971324812, 476742058422480,
+      1520644895959803 },
+    { 694018530392140, 2181664308275944, 1008881841276548, 1869175821107034,
+      1331662548691003 },
+    { 1207982418891449, 1577854720087533, 2009037012572541, 1476807775109585,
+      764858983320152 } }
+},
+{ /* 51/51 */
+  { { 382218292636378, 253308433944437, 874541765087370, 2016974307899051,
+      1468999769476078 },
+    { 550413608250370, 875252643681210, 2041453659475649, 2067699249466175,
+      837158492223667 },
+    { 2013224690617610, 881120726963113, 2087874148443678, 930634847072563,
+      2100154549645766 } },
+  { { 101160670093713, 361893738814125, 52894630383946, 1501259724002497,
+      351318543681517 },
+    { 279316726592569, 117514864091725, 1889428919107234, 2054001097616280,
+      1909879816571102 },
+    { 401024742782312, 365133344333835, 2094858337279076, 1474190532535235,
+      873243796576815 } },
+  { { 1604706113280196, 1361566481392083, 1610295963343064, 245051163964851,
+      383297117547468 },
+    { 1491254023854405, 629527834280689, 41212588427027, 1220166930408796,
+      347347909682137 },
+    { 2039436204926639, 1926741216715387, 1049516571807905, 33427889774625,
+      1244728601644063 } },
+  { { 2210635594139754, 1624790008064494, 599132262248487, 2140758858928406,
+      628597462360655 },
+    { 562031499853931, 1510830723445024, 684615976680088, 429185632750463,
+      2193745587025849 },
+    { 584100419460213, 53968125802685, 702061472647813, 1933921994441873,
+      1313730981189896 } },
+  { { 238279295673725, 1308864955222451, 2188398105641380, 42229371066395,
+      315424235098610 },
+    { 477491781669310, 1611536679637989, 187362232413980, 891952238672777,
+      1225539987054071 },
+    { 1646688728268120, 522617274770425, 965819147384696, 1779992585591290,
+      599046500566875 } },
+  { { 759993622151799, 1224771495679557, 693581267620704, 1475598945318631,
+      1967373666914938 },
+    { 1442254111820422, 212648876439491, 1245428585510084, 1584077023276416,
+      1255046564639032 },
+    { 1299930181897423, 1334445189094419, 1377780313591143, 1632251052504619,
+      2124755504217102 } },
+  { { 1076308918770737, 746039954036577, 2162409972118497, 2135196354484968,
+      908240224806887 },
+    { 538193832863566, 691736142161379, 619859608148219, 528072583294496,
+      1268090436966653 },
+    { 1563254252268299, 45690927021920, 1977171827759869, 575051855881173,
+      1160515835844545 } },
+  { { 450336598746318, 1231853846143085, 1205387804414007, 399976769070896,
+      2214536789200811 },
+    { 95976653348200, 1030949021231393, 1732887037612734, 2036227524686042,
+      1793123495641824 },
+    { 444427922280653, 1693147287605423, 1157943436407938, 1628818779064409,
+      329793214557010 } },
+  { { 1791684329445208, 456115988730919, 1979036113180686, 467456368806989,
+      27188047346307 },
+    { 1442876575255450, 467606044248331, 305756440896881, 346873418766323,
+      839225659299252 },
+    { 1137133040208613, 184776781601936, 1187734110134977, 1350452799064962,
+      890443809141664 } },
+  { { 1456828852186531, 474022042671049, 2206589205809410, 1528843044894498,
+      1970488131072876 },
+    { 2029708562965172, 1032715798301442, 396183949188594, 1704784934664950,
+      1934745333477258 },
+    { 1745574692828326, 1276269278918664, 1153893512676234, 239150053563501,
+      159153109373739 } },
+  { { 1166550138965739, 343799751084861, 355692917145408, 1514696593315374,
+      660753352729654 },
+    { 953712171958222, 2188484560514506, 1750187641501448, 261291330832412,
+      1999810245524609 },
+    { 1583082100123087, 1573047171311380, 2125122811874800, 37608033064126,
+      1780206481909707 } },
+  { { 1553906752978077, 831130604438604, 2165457137663659, 413993083223275,
+      1825720741966542 },
+    { 1152308383698883, 2095538318492953, 1604799151257594, 1415995849694185,
+      314685561665735 },
+    { 481701478053202, 534617811615381, 1976623787636230, 2165259482833412,
+      84940296188711 } },
+  { { 149416264376988, 1712706687708482, 688439127952868, 125425122227921,
+      172789475798153 },
+    { 775326253111342, 1354188754728137, 1693287532081950, 1458055169592634,
+      204944721828634 },
+    { 1125608631211261, 904844359174671, 770145187222265, 56321018368817,
+      1150232528804887 } },
+  { { 1451677329132876, 1940277743838419, 290966781288550, 2189354801655655,
+      25470867374475 },
+    { 715797526883767, 1050966575228600, 661678222720023, 2073375361738145,
+      1195279989363344 },
+    { 823576515560861, 75785490690429, 2023416683827610, 3149080820523,
+      1397065484012800 } },
+  { { 1657342384774869, 176446761108836, 332229836601206, 126577838557050,
+      1460824437106045 },
+    { 699177503793444, 992419210674434, 444274968967062, 2041261847142296,
+      2092670518954632 },
+    { 1957458931450406, 2025421328369380, 2223830473056031, 65651894158598,
+      1640323539531074 } },
+  { { 518198914814389, 203660264943000, 1794063490391293, 1055437419915456,
+      267701390672180 },
+    { 1762795443580171, 257740130135331, 333249819378241, 2188512649053026,
+      1424188826091514 },
+    { 1889398199177278, 1532909798208066, 861882886504405, 1219273741793626,
+      336618344354666 } }
+}
@@ -17,11 +17,14 @@
  * DAMAGE.
  */
 
+#include "build_bug_on.h"
 #include "compare.h"
+#include "cpufeatures.h"
 #include "fips_mode.h"
 #include "lc_rng.h"
 #include "ret_checkers.h"
 #include "lc_x25519.h"
+#include "math_helper.h"
 #include "timecop.h"
 #include "x25519_scalarmult.h"
 
@@ -94,6 +97,113 @@ out:
 	return ret;
 }
 
+/* Number of operations handled with one invocation of the batch helper */
+#define LC_X25519_BATCH_CHUNK 8
+
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+/*
+ * The IFMA ladder always calculates all of its lanes. It is faster than the
+ * AVX2 variable base ladder starting with 2 operations and faster than the
+ * fixed base comb starting with 3 operations.
+ */
+#define LC_X25519_IFMA_MIN_SS 2
+#define LC_X25519_IFMA_MIN_BASE 3
+#endif
+
+/*
+ * Calculate q[i] = n[i] * p[i] for num <= LC_X25519_BATCH_CHUNK entries. If
+ * p is NULL, the base point is used.
+ */
+static int lc_x25519_scalarmult_batch(uint8_t *const *q,
+				      const uint8_t *const *n,
+				      const uint8_t *const *p, unsigned int num)
+{
+	unsigned int i;
+	int ret = 0, tmp;
+
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+	BUILD_BUG_ON(LC_X25519_BATCH_CHUNK != LC_X25519_IFMA_LANES);
+
+	if ((lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX512IFMA) &&
+	    num >= (p ? LC_X25519_IFMA_MIN_SS : LC_X25519_IFMA_MIN_BASE)) {
+		static const uint8_t basepoint[LC_X25519_PUBLICKEYBYTES] = {
+			9
+		};
+		const uint8_t *base[LC_X25519_IFMA_LANES];
+
+		if (!p) {
+			for (i = 0; i < num; i++)
+				base[i] = basepoint;
+			p = base;
+		}
+
+		crypto_scalarmult_curve25519_ifma(q, n, p, num);
+		return 0;
+	}
+#endif
+
+	for (i = 0; i < num; i++) {
+		if (p)
+			tmp = crypto_scalarmult_curve25519(q[i], n[i], p[i]);
+		else
+			tmp = crypto_scalarmult_curve25519_base(q[i], n[i]);
+		if (tmp)
+			ret = tmp;
+	}
+
+	return ret;
+}
+
+int lc_x25519_keypair_batch(struct lc_x25519_pk *const *pk,
+			    struct lc_x25519_sk *const *sk, unsigned int num,
+			    struct lc_rng_ctx *rng_ctx)
+{
+	uint8_t *q[LC_X25519_BATCH_CHUNK];
+	const uint8_t *n[LC_X25519_BATCH_CHUNK];
+	unsigned int i, j, todo;
+	int ret = 0;
+
+	CKNULL(sk, -EINVAL);
+	CKNULL(pk, -EINVAL);
+
+	lc_x25519_keypair_selftest();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_X25519_KEYGEN);
+
+	lc_rng_check(&rng_ctx);
+
+	for (i = 0; i < num; i += todo) {
+		todo = min_uint32(num - i, LC_X25519_BATCH_CHUNK);
+
+		for (j = 0; j < todo; j++) {
+			CKNULL(sk[i + j], -EINVAL);
+			CKNULL(pk[i + j], -EINVAL);
+
+			CKINT(lc_rng_generate(rng_ctx, NULL, 0, sk[i + j]->sk,
+					      LC_X25519_SECRETKEYBYTES));
+
+			/* Timecop: the random number is the sentitive data */
+			poison(sk[i + j]->sk, LC_X25519_SECRETKEYBYTES);
+
+			q[j] = pk[i + j]->pk;
+			n[j] = sk[i + j]->sk;
+		}
+
+		CKINT(lc_x25519_scalarmult_batch(q, n, NULL, todo));
+
+		/*
+		 * Timecop: pk and sk are not relevant for side-channels any
+		 * more.
+		 */
+		for (j = 0; j < todo; j++) {
+			unpoison(sk[i + j]->sk, LC_X25519_SECRETKEYBYTES);
+			unpoison(pk[i + j]->pk, LC_X25519_PUBLICKEYBYTES);
+		}
+	}
+
+out:
+	return ret;
+}
+
 static void lc_x25519_ss_selftest(void)
 {
 	/*
@@ -180,3 +290,54 @@ int lc_x25519_ss(struct lc_x25519_ss *ss, const struct lc_x25519_pk *pk,
 out:
 	return ret;
 }
+
+int lc_x25519_ss_batch(struct lc_x25519_ss *const *ss,
+		       const struct lc_x25519_pk *const *pk,
+		       const struct lc_x25519_sk *const *sk, unsigned int num)
+{
+	uint8_t *q[LC_X25519_BATCH_CHUNK];
+	const uint8_t *n[LC_X25519_BATCH_CHUNK], *p[LC_X25519_BATCH_CHUNK];
+	unsigned int i, j, todo;
+	int ret = 0, tmp;
+
+	CKNULL(sk, -EINVAL);
+	CKNULL(pk, -EINVAL);
+	CKNULL(ss, -EINVAL);
+
+	lc_x25519_ss_selftest();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_X25519_SS);
+
+	for (i = 0; i < num; i += todo) {
+		todo = min_uint32(num - i, LC_X25519_BATCH_CHUNK);
+
+		for (j = 0; j < todo; j++) {
+			CKNULL(sk[i + j], -EINVAL);
+			CKNULL(pk[i + j], -EINVAL);
+			CKNULL(ss[i + j], -EINVAL);
+
+			/* Timecop: mark the secret key as sensitive */
+			poison(sk[i + j]->sk, LC_X25519_SECRETKEYBYTES);
+
+			q[j] = ss[i + j]->ss;
+			n[j] = sk[i + j]->sk;
+			p[j] = pk[i + j]->pk;
+		}
+
+		/* Process all entries even if one of them fails */
+		tmp = lc_x25519_scalarmult_batch(q, n, p, todo);
+		if (tmp)
+			ret = tmp;
+
+		/*
+		 * Timecop: pk and sk are not relevant for side-channels any
+		 * more.
+		 */
+		for (j = 0; j < todo; j++) {
+			unpoison(sk[i + j]->sk, LC_X25519_SECRETKEYBYTES);
+			unpoison(ss[i + j]->ss, LC_X25519_SSBYTES);
+		}
+	}
+
+out:
+	return ret;
+}
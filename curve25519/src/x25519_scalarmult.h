@@ -39,6 +39,23 @@ int crypto_scalarmult_curve25519_base(uint8_t *q, const uint8_t *n);
 int crypto_scalarmult_curve25519(uint8_t *q, const uint8_t *n,
 				 const uint8_t *p);
 
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+/* Number of scalar multiplications performed in parallel */
+#define LC_X25519_IFMA_LANES 8
+
+/*
+ * Perform num <= LC_X25519_IFMA_LANES independent scalar multiplications
+ * q[i] = n[i] * p[i] with one Montgomery ladder operating on all lanes of
+ * AVX-512 registers using the IFMA 52 bit multiply-add instructions.
+ *
+ * The caller must ensure that the CPU supports AVX-512 IFMA.
+ */
+void crypto_scalarmult_curve25519_ifma(uint8_t *const *q,
+				       const uint8_t *const *n,
+				       const uint8_t *const *p,
+				       unsigned int num);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -177,6 +177,7 @@ static int ed25519_siggen_rfc8032_tester(void)
 			 0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
 			 0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b }
 	};
+	struct lc_ed25519_sk_prepared prep_sk;
 	struct lc_ed25519_sig sig;
 	int ret;
 
@@ -184,7 +185,13 @@ static int ed25519_siggen_rfc8032_tester(void)
 	lc_compare(sig.sig, exp_sig.sig, sizeof(exp_sig.sig),
 		   "ED25519 Signature\n");
 
+	CKINT(lc_ed25519_sk_prepare(&prep_sk, &sk));
+	CKINT(lc_ed25519_sign_prepared(&sig, NULL, 0, &prep_sk, NULL));
+	ret = lc_compare(sig.sig, exp_sig.sig, sizeof(exp_sig.sig),
+			 "ED25519 Signature with prepared key\n");
+
 out:
+	lc_memset_secure(&prep_sk, 0, sizeof(prep_sk));
 	return ret ? 1 : 0;
 }
 
@@ -249,6 +256,82 @@ out:
 	return ret ? 1 : 0;
 }
 
+#define ED25519_BATCH_NUM 20
+static int ed25519_batch_tester(void)
+{
+	struct lc_ed25519_pk pk[2];
+	struct lc_ed25519_sk sk[2];
+	struct lc_ed25519_sig sig[ED25519_BATCH_NUM];
+	uint8_t msg[ED25519_BATCH_NUM][4];
+	const struct lc_ed25519_sig *sigp[ED25519_BATCH_NUM];
+	const struct lc_ed25519_pk *pkp[ED25519_BATCH_NUM];
+	const uint8_t *msgp[ED25519_BATCH_NUM];
+	size_t mlen[ED25519_BATCH_NUM];
+	int res[ED25519_BATCH_NUM];
+	unsigned int i;
+	int ret;
+	LC_SELFTEST_DRNG_CTX_ON_STACK(selftest_rng);
+
+	CKINT(lc_ed25519_keypair(&pk[0], &sk[0], selftest_rng));
+	CKINT(lc_ed25519_keypair(&pk[1], &sk[1], selftest_rng));
+
+	/* Spans two chunks, every third signature uses the second key */
+	for (i = 0; i < ED25519_BATCH_NUM; i++) {
+		msg[i][0] = (uint8_t)i;
+		msg[i][1] = 0x01;
+		msg[i][2] = 0x02;
+		msg[i][3] = 0x03;
+		msgp[i] = msg[i];
+		mlen[i] = sizeof(msg[i]);
+		sigp[i] = &sig[i];
+		pkp[i] = &pk[i % 3 ? 0 : 1];
+
+		CKINT(lc_ed25519_sign(&sig[i], msg[i], sizeof(msg[i]),
+				      &sk[i % 3 ? 0 : 1], selftest_rng));
+	}
+
+	CKINT(lc_ed25519_verify_batch(res, sigp, msgp, mlen, ED25519_BATCH_NUM,
+				      pkp));
+	for (i = 0; i < ED25519_BATCH_NUM; i++) {
+		if (res[i]) {
+			printf("Ed25519 batch verification of signature %u failed\n",
+			       i);
+			ret = 1;
+			goto out;
+		}
+	}
+
+	/* Modified message, modified S, non-canonical S, wrong key */
+	msg[3][1] ^= 0x01;
+	sig[8].sig[32] ^= 0x01;
+	sig[12].sig[63] = 0xff;
+	pkp[17] = &pk[1];
+
+	if (lc_ed25519_verify_batch(res, sigp, msgp, mlen, ED25519_BATCH_NUM,
+				    pkp) != -EBADMSG) {
+		printf("Ed25519 batch verification did not detect failure\n");
+		ret = 1;
+		goto out;
+	}
+	for (i = 0; i < ED25519_BATCH_NUM; i++) {
+		if (res[i] != lc_ed25519_verify(sigp[i], msgp[i], mlen[i],
+						pkp[i])) {
+			printf("Ed25519 batch verification result %d of signature %u differs from single verification\n",
+			       res[i], i);
+			ret = 1;
+			goto out;
+		}
+	}
+	if (!res[3] || !res[8] || res[12] != -EINVAL || !res[17]) {
+		printf("Ed25519 batch verification missed a failure\n");
+		ret = 1;
+		goto out;
+	}
+
+out:
+	return ret ? 1 : 0;
+}
+
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	int ret = 0;
@@ -271,6 +354,7 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	ret += ed25519_siggen_tester();
 	ret += ed25519_siggen_rfc8032_tester();
 	ret += ed25519ph_siggen_rfc8032_tester();
+	ret += ed25519_batch_tester();
 
 	ret = test_validate_status(ret, LC_ALG_STATUS_ED25519_KEYGEN, 1);
 	ret = test_validate_status(ret, LC_ALG_STATUS_ED25519_SIGGEN, 1);
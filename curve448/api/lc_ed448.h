@@ -49,6 +49,25 @@ int lc_ed448_sign(struct lc_ed448_sig *sig, const uint8_t *msg, size_t mlen,
 int lc_ed448_verify(const struct lc_ed448_sig *sig, const uint8_t *msg,
 		    size_t mlen, const struct lc_ed448_pk *pk);
 
+/*
+ * Verify multiple signatures in one shot
+ *
+ * The verification equations of the signatures are combined with random
+ * 128 bit weights and checked with one multi-scalar multiplication. When the
+ * combined check fails, every signature is verified on its own to identify
+ * the failing ones. Each signature may be created with a different key,
+ * repeated keys are only processed once.
+ *
+ * res: array of num entries receiving the result of lc_ed448_verify for
+ *	each signature; may be NULL
+ *
+ * Returns 0 if all signatures could be verified correctly and -EBADMSG when
+ * at least one signature cannot be verified, < 0 on other errors.
+ */
+int lc_ed448_verify_batch(int *res, const struct lc_ed448_sig *const *sig,
+			  const uint8_t *const *msg, const size_t *mlen,
+			  unsigned int num, const struct lc_ed448_pk *const *pk);
+
 /* Receive a message pre-hashed with SHAKE-256 */
 int lc_ed448ph_sign(struct lc_ed448_sig *sig, const uint8_t *msg, size_t mlen,
 		    const struct lc_ed448_sk *sk, struct lc_rng_ctx *rng_ctx);
@@ -47,6 +47,22 @@ int lc_x448_keypair(struct lc_x448_pk *pk, struct lc_x448_sk *sk,
 int lc_x448_ss(struct lc_x448_ss *ss, const struct lc_x448_pk *pk,
 	       const struct lc_x448_sk *sk);
 
+/*
+ * Batch variants of the key generation and shared secret calculation: the
+ * i-th entry of each array forms one operation equivalent to the non-batch
+ * call. On CPUs with AVX-512 up to 8 operations are calculated in parallel,
+ * otherwise the operations are processed one after another.
+ *
+ * lc_x448_ss_batch returns an error if the shared secret of any of the
+ * entries could not be calculated.
+ */
+int lc_x448_keypair_batch(struct lc_x448_pk *const *pk,
+			  struct lc_x448_sk *const *sk, unsigned int num,
+			  struct lc_rng_ctx *rng_ctx);
+int lc_x448_ss_batch(struct lc_x448_ss *const *ss,
+		     const struct lc_x448_pk *const *pk,
+		     const struct lc_x448_sk *const *sk, unsigned int num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,524 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+/*
+ * Eight-way X448 Montgomery ladder using AVX-512F.
+ *
+ * Each 64 bit lane of a ZMM register holds one limb of a field element of
+ * an independent scalar multiplication. Field elements use 16 limbs of radix
+ * 2^28 so that the 32x32 bit multiplication of VPMULUDQ can be used and the
+ * Goldilocks prime p = 2^448 - 2^224 - 1 splits at a limb boundary:
+ * with phi = 2^224, the multiplication of a = a0 + a1 * phi and
+ * b = b0 + b1 * phi uses the Karatsuba identity
+ *
+ *	a * b = (a0 * b0 + a1 * b1) + ((a0 + a1) * (b0 + b1) - a0 * b0) * phi
+ *
+ * which already includes the reduction phi^2 = phi + 1.
+ *
+ * Multiplication inputs must have limbs below 2^29, which holds for the sum
+ * of two carried field elements. The subtraction is always followed by a
+ * carry round.
+ */
+
+#include "ext_headers_x86.h"
+#include "lc_memset_secure.h"
+#include "x448_scalarmult.h"
+
+#define GF_AVX512_NLIMBS 16
+#define GF_AVX512_HALF (GF_AVX512_NLIMBS / 2)
+#define GF_AVX512_MASK28 ((1ULL << 28) - 1)
+
+typedef __m512i gf_avx512[GF_AVX512_NLIMBS];
+
+/* Column k of the product a[0..7] * b[0..7] */
+static inline __m512i gf_avx512_mul_col(const __m512i *a, const __m512i *b,
+					unsigned int k)
+{
+	__m512i r = _mm512_setzero_si512();
+	unsigned int i;
+
+#pragma GCC unroll 8
+	for (i = (k < GF_AVX512_HALF) ? 0 : k - GF_AVX512_HALF + 1;
+	     i < GF_AVX512_HALF && i <= k; i++)
+		r = _mm512_add_epi64(r, _mm512_mul_epu32(a[i], b[k - i]));
+
+	return r;
+}
+
+/* Column k of the square a[0..7]^2 where the cross products are doubled */
+static inline __m512i gf_avx512_sq_col(const __m512i *a, unsigned int k)
+{
+	__m512i r = _mm512_setzero_si512();
+	unsigned int i;
+
+#pragma GCC unroll 8
+	for (i = (k < GF_AVX512_HALF) ? 0 : k - GF_AVX512_HALF + 1;
+	     2 * i < k; i++)
+		r = _mm512_add_epi64(r, _mm512_mul_epu32(a[i], a[k - i]));
+	r = _mm512_slli_epi64(r, 1);
+
+	if (!(k & 1))
+		r = _mm512_add_epi64(r, _mm512_mul_epu32(a[k / 2], a[k / 2]));
+
+	return r;
+}
+
+/*
+ * Carry the 64 bit coefficients c[0..15] into limbs of 28 bits. Two chains
+ * starting at limb 0 and limb 8 run interleaved. The carry out of limb 15
+ * has the weight 2^448 = phi + 1 and is added to limb 0 and limb 8. All
+ * resulting limbs are below 2^28 + 2^10.
+ */
+static inline void gf_avx512_carry(gf_avx512 r, __m512i c[GF_AVX512_NLIMBS])
+{
+	const __m512i mask = _mm512_set1_epi64(GF_AVX512_MASK28);
+	__m512i top;
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_HALF - 1; k++) {
+		c[k + 1] =
+			_mm512_add_epi64(c[k + 1], _mm512_srli_epi64(c[k], 28));
+		c[k] = _mm512_and_si512(c[k], mask);
+		c[k + GF_AVX512_HALF + 1] = _mm512_add_epi64(
+			c[k + GF_AVX512_HALF + 1],
+			_mm512_srli_epi64(c[k + GF_AVX512_HALF], 28));
+		c[k + GF_AVX512_HALF] =
+			_mm512_and_si512(c[k + GF_AVX512_HALF], mask);
+	}
+
+	c[GF_AVX512_HALF] =
+		_mm512_add_epi64(c[GF_AVX512_HALF],
+				 _mm512_srli_epi64(c[GF_AVX512_HALF - 1], 28));
+	c[GF_AVX512_HALF - 1] = _mm512_and_si512(c[GF_AVX512_HALF - 1], mask);
+
+	top = _mm512_srli_epi64(c[GF_AVX512_NLIMBS - 1], 28);
+	c[GF_AVX512_NLIMBS - 1] =
+		_mm512_and_si512(c[GF_AVX512_NLIMBS - 1], mask);
+	c[0] = _mm512_add_epi64(c[0], top);
+	c[GF_AVX512_HALF] = _mm512_add_epi64(c[GF_AVX512_HALF], top);
+
+	c[1] = _mm512_add_epi64(c[1], _mm512_srli_epi64(c[0], 28));
+	c[0] = _mm512_and_si512(c[0], mask);
+	c[GF_AVX512_HALF + 1] =
+		_mm512_add_epi64(c[GF_AVX512_HALF + 1],
+				 _mm512_srli_epi64(c[GF_AVX512_HALF], 28));
+	c[GF_AVX512_HALF] = _mm512_and_si512(c[GF_AVX512_HALF], mask);
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++)
+		r[k] = c[k];
+}
+
+/*
+ * One parallel carry round for limbs below 2^45: every limb is reduced to
+ * 28 bits plus the carry of the preceding limb which is below 2^17.
+ */
+static inline void gf_avx512_carry_short(gf_avx512 r,
+					 const __m512i t[GF_AVX512_NLIMBS])
+{
+	const __m512i mask = _mm512_set1_epi64(GF_AVX512_MASK28);
+	__m512i top = _mm512_srli_epi64(t[GF_AVX512_NLIMBS - 1], 28);
+	unsigned int k;
+
+	for (k = GF_AVX512_NLIMBS - 1; k > 0; k--)
+		r[k] = _mm512_add_epi64(_mm512_and_si512(t[k], mask),
+					_mm512_srli_epi64(t[k - 1], 28));
+	r[0] = _mm512_add_epi64(_mm512_and_si512(t[0], mask), top);
+	r[GF_AVX512_HALF] = _mm512_add_epi64(r[GF_AVX512_HALF], top);
+}
+
+static inline __m512i gf_avx512_col(const __m512i *a, const __m512i *b,
+				    unsigned int k, int sq)
+{
+	return sq ? gf_avx512_sq_col(a, k) : gf_avx512_mul_col(a, b, k);
+}
+
+/*
+ * With the Karatsuba products p0 = a0 * b0, p1 = a1 * b1 and
+ * p2 = (a0 + a1) * (b0 + b1), the coefficients of p2 - p0 at positions 8 to
+ * 14 have the weight phi^2 = phi + 1. Limbs j and j + 8 of the result thus
+ * only depend on the columns j and j + 8 of the three products:
+ *
+ *	c[j]     = p0[j] + p1[j] + p2[j + 8] - p0[j + 8]
+ *	c[j + 8] = p1[j + 8] + p2[j] - p0[j] + p2[j + 8]
+ *
+ * Each column is accumulated in one register which avoids keeping the full
+ * products. The sums of the halves of a and b are given with as and bs.
+ */
+static inline void gf_avx512_karatsuba(gf_avx512 r, const gf_avx512 a,
+				       const gf_avx512 b, const __m512i *as,
+				       const __m512i *bs, int sq)
+{
+	const __m512i *a1 = a + GF_AVX512_HALF, *b1 = b + GF_AVX512_HALF;
+	__m512i c[GF_AVX512_NLIMBS];
+	unsigned int j;
+
+#pragma GCC unroll 8
+	for (j = 0; j < GF_AVX512_HALF; j++) {
+		__m512i p0l = gf_avx512_col(a, b, j, sq);
+		__m512i p1l = gf_avx512_col(a1, b1, j, sq);
+		__m512i p2l = gf_avx512_col(as, bs, j, sq);
+		__m512i p0h = _mm512_setzero_si512(), p1h = p0h, p2h = p0h;
+
+		if (j < GF_AVX512_HALF - 1) {
+			p0h = gf_avx512_col(a, b, j + GF_AVX512_HALF, sq);
+			p1h = gf_avx512_col(a1, b1, j + GF_AVX512_HALF, sq);
+			p2h = gf_avx512_col(as, bs, j + GF_AVX512_HALF, sq);
+		}
+
+		c[j] = _mm512_sub_epi64(
+			_mm512_add_epi64(_mm512_add_epi64(p0l, p1l), p2h), p0h);
+		c[j + GF_AVX512_HALF] = _mm512_sub_epi64(
+			_mm512_add_epi64(_mm512_add_epi64(p1h, p2l), p2h), p0l);
+	}
+
+	gf_avx512_carry(r, c);
+}
+
+static inline void gf_avx512_mul(gf_avx512 r, const gf_avx512 a,
+				 const gf_avx512 b)
+{
+	__m512i as[GF_AVX512_HALF], bs[GF_AVX512_HALF];
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_HALF; k++) {
+		as[k] = _mm512_add_epi64(a[k], a[k + GF_AVX512_HALF]);
+		bs[k] = _mm512_add_epi64(b[k], b[k + GF_AVX512_HALF]);
+	}
+
+	gf_avx512_karatsuba(r, a, b, as, bs, 0);
+}
+
+static inline void gf_avx512_sq(gf_avx512 r, const gf_avx512 a)
+{
+	__m512i as[GF_AVX512_HALF];
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_HALF; k++)
+		as[k] = _mm512_add_epi64(a[k], a[k + GF_AVX512_HALF]);
+
+	gf_avx512_karatsuba(r, a, a, as, as, 1);
+}
+
+static inline void gf_avx512_nsq(gf_avx512 r, const gf_avx512 a,
+				 unsigned int n)
+{
+	gf_avx512_sq(r, a);
+	while (--n)
+		gf_avx512_sq(r, r);
+}
+
+/* r = a + b without carry */
+static inline void gf_avx512_add(gf_avx512 r, const gf_avx512 a,
+				 const gf_avx512 b)
+{
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++)
+		r[k] = _mm512_add_epi64(a[k], b[k]);
+}
+
+/* r = a + 2p - b */
+static inline void gf_avx512_sub(gf_avx512 r, const gf_avx512 a,
+				 const gf_avx512 b)
+{
+	const __m512i p2 = _mm512_set1_epi64((1LL << 29) - 2);
+	const __m512i p2_mid = _mm512_set1_epi64((1LL << 29) - 4);
+	__m512i t[GF_AVX512_NLIMBS];
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++)
+		t[k] = _mm512_sub_epi64(
+			_mm512_add_epi64(a[k], k == GF_AVX512_HALF ? p2_mid :
+								     p2),
+			b[k]);
+
+	gf_avx512_carry_short(r, t);
+}
+
+/* r = aa + 39081 * e */
+static inline void gf_avx512_mula24_add(gf_avx512 r, const gf_avx512 e,
+					const gf_avx512 aa)
+{
+	const __m512i a24 = _mm512_set1_epi64(39081);
+	__m512i t[GF_AVX512_NLIMBS];
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++)
+		t[k] = _mm512_add_epi64(aa[k], _mm512_mul_epu32(e[k], a24));
+
+	gf_avx512_carry_short(r, t);
+}
+
+static inline void gf_avx512_cswap(gf_avx512 a, gf_avx512 b, __mmask8 swap)
+{
+	unsigned int k;
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++) {
+		__m512i t = _mm512_mask_blend_epi64(swap, a[k], b[k]);
+
+		b[k] = _mm512_mask_blend_epi64(swap, b[k], a[k]);
+		a[k] = t;
+	}
+}
+
+/*
+ * r = z^(p - 2) where p - 2 consists of 223 one bits, one zero bit, 222 one
+ * bits, one zero bit and one one bit. The chain uses e_n = z^(2^n - 1).
+ */
+static void gf_avx512_invert(gf_avx512 r, const gf_avx512 z)
+{
+	gf_avx512 e3, e6, e24, t0, t1;
+
+	/* e_2, e_3 */
+	gf_avx512_sq(t0, z);
+	gf_avx512_mul(t0, t0, z);
+	gf_avx512_sq(e3, t0);
+	gf_avx512_mul(e3, e3, z);
+
+	/* e_6, e_12, e_24 */
+	gf_avx512_nsq(e6, e3, 3);
+	gf_avx512_mul(e6, e6, e3);
+	gf_avx512_nsq(t0, e6, 6);
+	gf_avx512_mul(t0, t0, e6);
+	gf_avx512_nsq(e24, t0, 12);
+	gf_avx512_mul(e24, e24, t0);
+
+	/* e_48, e_96, e_192 */
+	gf_avx512_nsq(t0, e24, 24);
+	gf_avx512_mul(t0, t0, e24);
+	gf_avx512_nsq(t1, t0, 48);
+	gf_avx512_mul(t1, t1, t0);
+	gf_avx512_nsq(t0, t1, 96);
+	gf_avx512_mul(t0, t0, t1);
+
+	/* e_216, e_222 */
+	gf_avx512_nsq(t0, t0, 24);
+	gf_avx512_mul(t0, t0, e24);
+	gf_avx512_nsq(t0, t0, 6);
+	gf_avx512_mul(t1, t0, e6);
+
+	/* e_223 followed by one zero bit and e_222 */
+	gf_avx512_sq(t0, t1);
+	gf_avx512_mul(t0, t0, z);
+	gf_avx512_nsq(t0, t0, 223);
+	gf_avx512_mul(t0, t0, t1);
+
+	/* Final zero and one bits */
+	gf_avx512_nsq(t0, t0, 2);
+	gf_avx512_mul(r, t0, z);
+
+	lc_memset_secure(e3, 0, sizeof(e3));
+	lc_memset_secure(e6, 0, sizeof(e6));
+	lc_memset_secure(e24, 0, sizeof(e24));
+	lc_memset_secure(t0, 0, sizeof(t0));
+	lc_memset_secure(t1, 0, sizeof(t1));
+}
+
+static void x448_avx512_ladder(gf_avx512 x2, gf_avx512 z2, const gf_avx512 x1,
+			       const __mmask8 *bits)
+{
+	gf_avx512 x3, z3, a, b, c, d, aa, bb, e, da, cb;
+	__mmask8 swap = 0;
+	unsigned int k;
+	int pos;
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++) {
+		x2[k] = _mm512_setzero_si512();
+		z2[k] = _mm512_setzero_si512();
+		x3[k] = x1[k];
+		z3[k] = _mm512_setzero_si512();
+	}
+	x2[0] = _mm512_set1_epi64(1);
+	z3[0] = _mm512_set1_epi64(1);
+
+	for (pos = LC_X448_SECRETKEYBYTES * 8 - 1; pos >= 0; --pos) {
+		swap ^= bits[pos];
+		gf_avx512_cswap(x2, x3, swap);
+		gf_avx512_cswap(z2, z3, swap);
+		swap = bits[pos];
+
+		gf_avx512_add(a, x2, z2);
+		gf_avx512_sub(b, x2, z2);
+		gf_avx512_add(c, x3, z3);
+		gf_avx512_sub(d, x3, z3);
+		gf_avx512_sq(aa, a);
+		gf_avx512_sq(bb, b);
+		gf_avx512_mul(da, d, a);
+		gf_avx512_mul(cb, c, b);
+		gf_avx512_mul(x2, aa, bb);
+		gf_avx512_sub(e, aa, bb);
+		gf_avx512_add(x3, da, cb);
+		gf_avx512_sq(x3, x3);
+		gf_avx512_sub(z3, da, cb);
+		gf_avx512_sq(z3, z3);
+		gf_avx512_mul(z3, z3, x1);
+		gf_avx512_mula24_add(z2, e, aa);
+		gf_avx512_mul(z2, z2, e);
+	}
+	gf_avx512_cswap(x2, x3, swap);
+	gf_avx512_cswap(z2, z3, swap);
+
+	lc_memset_secure(x3, 0, sizeof(x3));
+	lc_memset_secure(z3, 0, sizeof(z3));
+	lc_memset_secure(a, 0, sizeof(a));
+	lc_memset_secure(b, 0, sizeof(b));
+	lc_memset_secure(c, 0, sizeof(c));
+	lc_memset_secure(d, 0, sizeof(d));
+	lc_memset_secure(aa, 0, sizeof(aa));
+	lc_memset_secure(bb, 0, sizeof(bb));
+	lc_memset_secure(e, 0, sizeof(e));
+	lc_memset_secure(da, 0, sizeof(da));
+	lc_memset_secure(cb, 0, sizeof(cb));
+}
+
+/*
+ * Fully reduce the limbs of one lane and serialize them. The limbs are
+ * carried, p is subtracted and added back if the subtraction borrowed.
+ */
+static int x448_avx512_serialize(uint8_t out[LC_X448_PUBLICKEYBYTES],
+				 uint64_t l[GF_AVX512_NLIMBS])
+{
+	uint64_t carry, mask, acc = 0;
+	int64_t scarry = 0;
+	unsigned int k;
+
+	carry = l[GF_AVX512_NLIMBS - 1] >> 28;
+	l[GF_AVX512_NLIMBS - 1] &= GF_AVX512_MASK28;
+	l[0] += carry;
+	l[GF_AVX512_HALF] += carry;
+	for (k = 0; k < GF_AVX512_NLIMBS - 1; k++) {
+		l[k + 1] += l[k] >> 28;
+		l[k] &= GF_AVX512_MASK28;
+	}
+	carry = l[GF_AVX512_NLIMBS - 1] >> 28;
+	l[GF_AVX512_NLIMBS - 1] &= GF_AVX512_MASK28;
+	l[0] += carry;
+	l[GF_AVX512_HALF] += carry;
+
+	/* Subtract p whose limbs are all 2^28 - 1 except limb 8 */
+	for (k = 0; k < GF_AVX512_NLIMBS; k++) {
+		scarry += (int64_t)l[k] - (int64_t)GF_AVX512_MASK28 +
+			  (k == GF_AVX512_HALF);
+		l[k] = (uint64_t)scarry & GF_AVX512_MASK28;
+		scarry >>= 28;
+	}
+
+	/* Add back p if the value was below p */
+	mask = (uint64_t)scarry;
+	carry = 0;
+	for (k = 0; k < GF_AVX512_NLIMBS; k++) {
+		carry += l[k] + ((GF_AVX512_MASK28 - (k == GF_AVX512_HALF)) &
+				 mask);
+		l[k] = carry & GF_AVX512_MASK28;
+		carry >>= 28;
+	}
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k += 2) {
+		uint64_t w = l[k] | (l[k + 1] << 28);
+		unsigned int i;
+
+		for (i = 0; i < 7; i++) {
+			out[7 * (k / 2) + i] = (uint8_t)(w >> (8 * i));
+			acc |= out[7 * (k / 2) + i];
+		}
+	}
+
+	/* An all-zero result indicates a point of small order */
+	return (int)(((acc - 1) >> 8) & 1);
+}
+
+struct x448_avx512_ws {
+	uint64_t limbs[GF_AVX512_NLIMBS][LC_X448_AVX512_LANES];
+	uint64_t l[GF_AVX512_NLIMBS];
+	uint8_t t[LC_X448_AVX512_LANES][LC_X448_SECRETKEYBYTES];
+	__mmask8 swap[LC_X448_SECRETKEYBYTES * 8];
+};
+
+int x448_scalarmult_avx512(uint8_t *const *out, const uint8_t *const *base,
+			   const uint8_t *const *scalar, unsigned int num)
+{
+	struct x448_avx512_ws ws;
+	gf_avx512 x1, x2, z2;
+	unsigned int i, k;
+	int pos, zero = 0;
+
+	memset(&ws, 0, sizeof(ws));
+
+	/*
+	 * Unused lanes operate on the zero scalar and point, their result is
+	 * discarded.
+	 */
+	for (i = 0; i < num; i++) {
+		for (k = 0; k < GF_AVX512_NLIMBS; k += 2) {
+			uint64_t w = 0;
+			unsigned int j;
+
+			for (j = 0; j < 7; j++)
+				w |= (uint64_t)base[i][7 * (k / 2) + j]
+				     << (8 * j);
+
+			ws.limbs[k][i] = w & GF_AVX512_MASK28;
+			ws.limbs[k + 1][i] = w >> 28;
+		}
+
+		memcpy(ws.t[i], scalar[i], sizeof(ws.t[i]));
+		ws.t[i][0] &= 252;
+		ws.t[i][LC_X448_SECRETKEYBYTES - 1] |= 128;
+	}
+
+	/* Collect the bits of all scalars at each position into one mask */
+	for (pos = 0; pos < LC_X448_SECRETKEYBYTES * 8; pos++) {
+		unsigned int m = 0;
+
+		for (i = 0; i < LC_X448_AVX512_LANES; i++)
+			m |= (unsigned int)((ws.t[i][pos >> 3] >> (pos & 7)) &
+					    1)
+			     << i;
+		ws.swap[pos] = (__mmask8)m;
+	}
+
+	LC_FPU_ENABLE;
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++)
+		x1[k] = _mm512_loadu_si512((const void *)ws.limbs[k]);
+
+	x448_avx512_ladder(x2, z2, x1, ws.swap);
+
+	gf_avx512_invert(z2, z2);
+	gf_avx512_mul(x2, x2, z2);
+
+	for (k = 0; k < GF_AVX512_NLIMBS; k++)
+		_mm512_storeu_si512((void *)ws.limbs[k], x2[k]);
+
+	LC_FPU_DISABLE;
+
+	lc_memset_secure(x1, 0, sizeof(x1));
+	lc_memset_secure(x2, 0, sizeof(x2));
+	lc_memset_secure(z2, 0, sizeof(z2));
+
+	for (i = 0; i < num; i++) {
+		for (k = 0; k < GF_AVX512_NLIMBS; k++)
+			ws.l[k] = ws.limbs[k][i];
+		zero |= x448_avx512_serialize(out[i], ws.l);
+	}
+
+	lc_memset_secure(&ws, 0, sizeof(ws));
+
+	return zero ? -EFAULT : 0;
+}
@@ -608,6 +608,96 @@ int curve448_base_double_scalarmul_non_secret(curve448_point_t combo,
 	return 0;
 }
 
+int curve448_base_multi_scalarmul_non_secret(
+	curve448_point_t combo, const curve448_scalar_t scalar1,
+	const curve448_point_t *base2, const curve448_scalar_t *scalar2,
+	unsigned int n)
+{
+	static const int table_bits_var = C448_WNAF_VAR_TABLE_BITS;
+	static const int table_bits_pre = C448_WNAF_FIXED_TABLE_BITS;
+	struct workspace {
+		struct smvt_control control_var
+			[C448_MULTI_SCALARMUL_MAX]
+			[C448_SCALAR_BITS / (C448_WNAF_VAR_TABLE_BITS + 1) + 3];
+		struct smvt_control
+			control_pre[C448_SCALAR_BITS /
+					    (C448_WNAF_FIXED_TABLE_BITS + 1) +
+				    3];
+		pniels_t precmp_var[C448_MULTI_SCALARMUL_MAX]
+				   [1 << C448_WNAF_VAR_TABLE_BITS];
+		unsigned int contv[C448_MULTI_SCALARMUL_MAX];
+	};
+	unsigned int j, contp = 0, nadd;
+	int i, top;
+	LC_DECLARE_MEM(ws, struct workspace, 8);
+
+	recode_wnaf(ws->control_pre, scalar1, table_bits_pre);
+	top = ws->control_pre[0].power;
+
+	for (j = 0; j < n; j++) {
+		recode_wnaf(ws->control_var[j], scalar2[j], table_bits_var);
+		prepare_wnaf_table(ws->precmp_var[j], base2[j], table_bits_var);
+		if (ws->control_var[j][0].power > top)
+			top = ws->control_var[j][0].power;
+	}
+
+	curve448_point_copy(combo, curve448_point_identity);
+
+	/*
+	 * All points share one doubling chain. The t coordinate is only
+	 * computed when the next operation is an addition.
+	 */
+	for (i = top; i >= 0; i--) {
+		nadd = (i == ws->control_pre[contp].power);
+		for (j = 0; j < n; j++)
+			nadd += (i == ws->control_var[j][ws->contv[j]].power);
+
+		if (i != top)
+			point_double_internal(combo, combo, i && !nadd);
+
+		for (j = 0; j < n; j++) {
+			const struct smvt_control *ctl =
+				&ws->control_var[j][ws->contv[j]];
+
+			if (i != ctl->power)
+				continue;
+
+			nadd--;
+			if (ctl->addend > 0)
+				add_pniels_to_pt(
+					combo,
+					ws->precmp_var[j][ctl->addend >> 1],
+					i && !nadd);
+			else
+				sub_pniels_from_pt(
+					combo,
+					ws->precmp_var[j][(-ctl->addend) >> 1],
+					i && !nadd);
+			ws->contv[j]++;
+		}
+
+		if (i == ws->control_pre[contp].power) {
+			const struct smvt_control *ctl =
+				&ws->control_pre[contp];
+
+			if (ctl->addend > 0)
+				add_niels_to_pt(
+					combo,
+					curve448_wnaf_base[ctl->addend >> 1],
+					i);
+			else
+				sub_niels_from_pt(
+					combo,
+					curve448_wnaf_base[(-ctl->addend) >> 1],
+					i);
+			contp++;
+		}
+	}
+
+	LC_RELEASE_MEM(ws);
+	return 0;
+}
+
 void curve448_point_destroy(curve448_point_t point)
 {
 	lc_memset_secure(point, 0, sizeof(curve448_point_t));
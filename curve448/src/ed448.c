@@ -43,6 +43,7 @@
 #include "ret_checkers.h"
 #include "selftest_rng.h"
 #include "signature_domain_separation.h"
+#include "small_stack_support.h"
 #include "timecop.h"
 #include "visibility.h"
 
@@ -662,14 +663,18 @@ static void lc_ed448_verify_tester(void)
 			    "ED448 Signature verification\n");
 }
 
-static int
-curveed448_verify(const uint8_t signature[LC_ED448_SIGBYTES],
-		  const uint8_t pubkey[LC_ED448_PUBLICKEYBYTES],
-		  const uint8_t *message, size_t message_len, uint8_t prehashed,
-		  struct lc_dilithium_ed448_ctx *composite_ml_dsa_ctx)
+/*
+ * Decode the public key (unless pk_decoded is set and pk_point already holds
+ * it) and R, compute the negated challenge and decode the response scalar.
+ */
+static int curveed448_verify_prepare(
+	const uint8_t signature[LC_ED448_SIGBYTES],
+	const uint8_t pubkey[LC_ED448_PUBLICKEYBYTES], const uint8_t *message,
+	size_t message_len, uint8_t prehashed,
+	struct lc_dilithium_ed448_ctx *composite_ml_dsa_ctx,
+	curve448_point_t pk_point, int pk_decoded, curve448_point_t r_point,
+	curve448_scalar_t challenge_scalar, curve448_scalar_t response_scalar)
 {
-	curve448_point_t pk_point, r_point;
-	curve448_scalar_t challenge_scalar, response_scalar;
 	struct lc_dilithium_ctx *dilithium_ctx = NULL;
 	uint8_t challenge[2 * LC_ED448_SECRETKEYBYTES];
 	int ret;
@@ -682,8 +687,10 @@ curveed448_verify(const uint8_t signature[LC_ED448_SIGBYTES],
 			dilithium_ctx = NULL;
 	}
 
-	CKINT(curve448_point_decode_like_eddsa_and_mul_by_ratio(pk_point,
-								pubkey));
+	if (!pk_decoded) {
+		CKINT(curve448_point_decode_like_eddsa_and_mul_by_ratio(
+			pk_point, pubkey));
+	}
 
 	CKINT(curve448_point_decode_like_eddsa_and_mul_by_ratio(r_point,
 								signature));
@@ -716,15 +723,48 @@ curveed448_verify(const uint8_t signature[LC_ED448_SIGBYTES],
 	CKINT(curve448_scalar_decode(response_scalar,
 				     &signature[LC_ED448_PUBLICKEYBYTES]));
 
-	/* pk_point = -c(x(P)) + (cx + k)G = kG */
+out:
+	lc_memset_secure(challenge, 0, sizeof(challenge));
+	lc_hash_zero(shake256_ctx);
+	return ret;
+}
+
+static int curveed448_verify_equation(const curve448_point_t pk_point,
+				      const curve448_point_t r_point,
+				      const curve448_scalar_t challenge_scalar,
+				      const curve448_scalar_t response_scalar)
+{
+	curve448_point_t check;
+	int ret;
+
+	/* check = -c(x(P)) + (cx + k)G = kG */
 	CKINT(curve448_base_double_scalarmul_non_secret(
-		pk_point, response_scalar, pk_point, challenge_scalar));
+		check, response_scalar, pk_point, challenge_scalar));
 
-	ret = curve448_point_eq(pk_point, r_point) ? 0 : -EBADMSG;
+	ret = curve448_point_eq(check, r_point) ? 0 : -EBADMSG;
+
+out:
+	return ret;
+}
+
+static int
+curveed448_verify(const uint8_t signature[LC_ED448_SIGBYTES],
+		  const uint8_t pubkey[LC_ED448_PUBLICKEYBYTES],
+		  const uint8_t *message, size_t message_len, uint8_t prehashed,
+		  struct lc_dilithium_ed448_ctx *composite_ml_dsa_ctx)
+{
+	curve448_point_t pk_point, r_point;
+	curve448_scalar_t challenge_scalar, response_scalar;
+	int ret;
+
+	CKINT(curveed448_verify_prepare(signature, pubkey, message, message_len,
+					prehashed, composite_ml_dsa_ctx,
+					pk_point, 0, r_point, challenge_scalar,
+					response_scalar));
+	CKINT(curveed448_verify_equation(pk_point, r_point, challenge_scalar,
+					 response_scalar));
 
 out:
-	lc_memset_secure(challenge, 0, sizeof(challenge));
-	lc_hash_zero(shake256_ctx);
 	return ret;
 }
 
@@ -783,3 +823,207 @@ int lc_ed448_verify_ctx(const struct lc_ed448_sig *sig, const uint8_t *msg,
 out:
 	return ret;
 }
+
+/*
+ * Number of signatures combined into one multi-scalar multiplication: each
+ * signature contributes R and A (unless A is shared with a preceding
+ * signature in the chunk) to the point set.
+ */
+#define LC_ED448_VERIFY_BATCH_CHUNK (C448_MULTI_SCALARMUL_MAX / 2)
+
+struct lc_ed448_verify_batch_ws {
+	curve448_point_t pk_point[LC_ED448_VERIFY_BATCH_CHUNK];
+	curve448_point_t r_point[LC_ED448_VERIFY_BATCH_CHUNK];
+	curve448_scalar_t challenge[LC_ED448_VERIFY_BATCH_CHUNK];
+	curve448_scalar_t response[LC_ED448_VERIFY_BATCH_CHUNK];
+	int ret[LC_ED448_VERIFY_BATCH_CHUNK];
+	unsigned int a_dup[LC_ED448_VERIFY_BATCH_CHUNK];
+	unsigned int a_idx[LC_ED448_VERIFY_BATCH_CHUNK];
+	curve448_point_t points[C448_MULTI_SCALARMUL_MAX];
+	curve448_scalar_t scalars[C448_MULTI_SCALARMUL_MAX];
+	curve448_scalar_t z, tmp, b;
+	curve448_point_t check;
+	uint8_t zbuf[16];
+};
+
+/*
+ * Verify up to LC_ED448_VERIFY_BATCH_CHUNK signatures with one randomized
+ * linear combination of the verification equations:
+ *
+ * (sum(z_i * S_i)) * B - sum((z_i * c_i) * A_i) - sum(z_i * R_i) = 0
+ *
+ * for 128 bit random z_i where z_0 = 1 for the first signature so that R_0
+ * is not part of the multi-scalar multiplication but the point compared
+ * with. As R_i and A_i are decoded with the 4-isogeny and compared modulo
+ * 2-torsion as done by curveed448_verify_equation, the batch accepts the
+ * same signatures. If the combination does not hold, each signature is
+ * verified on its own to identify the bad ones.
+ */
+static int lc_ed448_verify_batch_chunk(
+	struct lc_ed448_verify_batch_ws *ws, int *res,
+	const struct lc_ed448_sig *const *sig, const uint8_t *const *msg,
+	const size_t *mlen, unsigned int num,
+	const struct lc_ed448_pk *const *pk,
+	struct lc_dilithium_ed448_ctx *composite_ml_dsa_ctx)
+{
+	struct lc_rng_ctx *rng_ctx = NULL;
+	unsigned int i, j, first = num, npoints = 0;
+	int ret = 0;
+
+	for (i = 0; i < num; i++) {
+		if (!sig[i] || !pk[i]) {
+			ws->ret[i] = -EINVAL;
+			continue;
+		}
+
+		/* Decode each public key only once */
+		for (j = 0; j < i; j++) {
+			if (!ws->ret[j] &&
+			    !memcmp(pk[j]->pk, pk[i]->pk,
+				    LC_ED448_PUBLICKEYBYTES)) {
+				curve448_point_copy(ws->pk_point[i],
+						    ws->pk_point[j]);
+				break;
+			}
+		}
+		ws->a_dup[i] = j;
+
+		ws->ret[i] = curveed448_verify_prepare(
+			sig[i]->sig, pk[i]->pk, msg[i], mlen[i], 0,
+			composite_ml_dsa_ctx, ws->pk_point[i], j != i,
+			ws->r_point[i], ws->challenge[i], ws->response[i]);
+		if (!ws->ret[i] && first == num)
+			first = i;
+	}
+
+	if (first < num) {
+		lc_rng_check(&rng_ctx);
+
+		for (i = first; i < num; i++) {
+			if (ws->ret[i])
+				continue;
+
+			if (i == first) {
+				/* z_0 = 1, R_0 is compared with */
+				memset(ws->zbuf, 0, sizeof(ws->zbuf));
+				ws->zbuf[0] = 1;
+				curve448_scalar_decode_long(ws->z, ws->zbuf, 1);
+			} else {
+				CKINT(lc_rng_generate(rng_ctx, NULL, 0,
+						      ws->zbuf,
+						      sizeof(ws->zbuf)));
+				curve448_scalar_decode_long(ws->z, ws->zbuf,
+							    sizeof(ws->zbuf));
+
+				/* -z_i * R_i */
+				curve448_point_copy(ws->points[npoints],
+						    ws->r_point[i]);
+				curve448_scalar_sub(ws->scalars[npoints],
+						    curve448_scalar_zero,
+						    ws->z);
+				npoints++;
+			}
+
+			/* sum(z_i * S_i) */
+			curve448_scalar_mul(ws->tmp, ws->z, ws->response[i]);
+			if (i == first)
+				curve448_scalar_add(ws->b, curve448_scalar_zero,
+						    ws->tmp);
+			else
+				curve448_scalar_add(ws->b, ws->b, ws->tmp);
+
+			/*
+			 * -(z_i * c_i) * A_i with the challenge already
+			 * negated, merged for repeated public keys
+			 */
+			curve448_scalar_mul(ws->tmp, ws->z, ws->challenge[i]);
+			j = ws->a_dup[i];
+			if (j != i) {
+				ws->a_idx[i] = ws->a_idx[j];
+				curve448_scalar_add(ws->scalars[ws->a_idx[i]],
+						    ws->scalars[ws->a_idx[i]],
+						    ws->tmp);
+			} else {
+				ws->a_idx[i] = npoints;
+				curve448_point_copy(ws->points[npoints],
+						    ws->pk_point[i]);
+				curve448_scalar_add(ws->scalars[npoints],
+						    curve448_scalar_zero,
+						    ws->tmp);
+				npoints++;
+			}
+		}
+
+		CKINT(curve448_base_multi_scalarmul_non_secret(
+			ws->check, ws->b, (const curve448_point_t *)ws->points,
+			(const curve448_scalar_t *)ws->scalars, npoints));
+
+		if (!curve448_point_eq(ws->check, ws->r_point[first])) {
+			for (i = first; i < num; i++) {
+				if (ws->ret[i])
+					continue;
+
+				ws->ret[i] = curveed448_verify_equation(
+					ws->pk_point[i], ws->r_point[i],
+					ws->challenge[i], ws->response[i]);
+			}
+		}
+	}
+
+	for (i = 0; i < num; i++) {
+		if (res)
+			res[i] = ws->ret[i];
+		if (ws->ret[i])
+			ret = -EBADMSG;
+	}
+
+out:
+	return ret;
+}
+
+int lc_ed448_verify_batch_ctx(
+	int *res, const struct lc_ed448_sig *const *sig,
+	const uint8_t *const *msg, const size_t *mlen, unsigned int num,
+	const struct lc_ed448_pk *const *pk,
+	struct lc_dilithium_ed448_ctx *composite_ml_dsa_ctx)
+{
+	unsigned int i, n;
+	int ret = 0, tmp;
+	LC_DECLARE_MEM(ws, struct lc_ed448_verify_batch_ws, sizeof(uint64_t));
+
+	CKNULL(sig, -EINVAL);
+	CKNULL(msg, -EINVAL);
+	CKNULL(mlen, -EINVAL);
+	CKNULL(pk, -EINVAL);
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_ED448_VERIFY_BATCH_CHUNK)
+			n = LC_ED448_VERIFY_BATCH_CHUNK;
+
+		tmp = lc_ed448_verify_batch_chunk(ws, res ? res + i : NULL,
+						  sig + i, msg + i, mlen + i, n,
+						  pk + i, composite_ml_dsa_ctx);
+		if (tmp == -EBADMSG) {
+			ret = tmp;
+		} else if (tmp) {
+			ret = tmp;
+			goto out;
+		}
+	}
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_ed448_verify_batch, int *res,
+		      const struct lc_ed448_sig *const *sig,
+		      const uint8_t *const *msg, const size_t *mlen,
+		      unsigned int num, const struct lc_ed448_pk *const *pk)
+{
+	lc_ed448_verify_tester();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_ED448_SIGVER);
+
+	return lc_ed448_verify_batch_ctx(res, sig, msg, mlen, num, pk, NULL);
+}
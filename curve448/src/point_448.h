@@ -317,6 +317,30 @@ int curve448_base_double_scalarmul_non_secret(curve448_point_t combo,
 					      const curve448_point_t base2,
 					      const curve448_scalar_t scalar2);
 
+/* Maximum number of points for curve448_base_multi_scalarmul_non_secret. */
+#define C448_MULTI_SCALARMUL_MAX 32
+
+/*
+ * Multiply the base point and n further points by scalars:
+ * combo = scalar1*curve448_point_base + sum(scalar2[j]*base2[j]).
+ *
+ * All points are processed interleaved with the wNAF representations of
+ * curve448_base_double_scalarmul_non_secret sharing one doubling chain.
+ *
+ * combo (out): The linear combination.
+ * scalar1 (in): The scalar for the base point.
+ * base2 (in): Array of n points to be scaled.
+ * scalar2 (in): Array of n scalars to multiply by.
+ * n (in): Number of points, at most C448_MULTI_SCALARMUL_MAX.
+ *
+ * Warning: This function takes variable time, and may leak the scalars used.
+ * It is designed for batch signature verification.
+ */
+int curve448_base_multi_scalarmul_non_secret(
+	curve448_point_t combo, const curve448_scalar_t scalar1,
+	const curve448_point_t *base2, const curve448_scalar_t *scalar2,
+	unsigned int n);
+
 /*
  * Test that a point is valid, for debugging purposes.
  *
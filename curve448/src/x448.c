@@ -17,10 +17,13 @@
  * DAMAGE.
  */
 
+#include "build_bug_on.h"
 #include "compare.h"
+#include "cpufeatures.h"
 #include "ext_headers_internal.h"
 #include "fips_mode.h"
 #include "lc_x448.h"
+#include "math_helper.h"
 #include "ret_checkers.h"
 #include "static_rng.h"
 #include "timecop.h"
@@ -131,6 +134,111 @@ LC_INTERFACE_FUNCTION(int, lc_x448_keypair, struct lc_x448_pk *pk,
 	return lc_x448_keypair_nocheck(pk, sk, rng_ctx);
 }
 
+/* Number of operations handled with one invocation of the batch helper */
+#define LC_X448_BATCH_CHUNK 8
+
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+/*
+ * The AVX-512 ladder always calculates all of its lanes. It is faster than
+ * the AVX2 variable base ladder starting with 5 operations and faster than
+ * the AVX2 fixed base ladder starting with 6 operations.
+ */
+#define LC_X448_AVX512_MIN_SS 5
+#define LC_X448_AVX512_MIN_BASE 6
+#endif
+
+/*
+ * Calculate out[i] = scalar[i] * base[i] for num <= LC_X448_BATCH_CHUNK
+ * entries. If base is NULL, the base point is used.
+ */
+static int lc_x448_scalarmult_batch(uint8_t *const *out,
+				    const uint8_t *const *base,
+				    const uint8_t *const *scalar,
+				    unsigned int num)
+{
+	unsigned int i;
+	int ret = 0, tmp;
+
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+	BUILD_BUG_ON(LC_X448_BATCH_CHUNK != LC_X448_AVX512_LANES);
+
+	if ((lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX512) &&
+	    num >= (base ? LC_X448_AVX512_MIN_SS : LC_X448_AVX512_MIN_BASE)) {
+		static const uint8_t basepoint[LC_X448_PUBLICKEYBYTES] = { 5 };
+		const uint8_t *bp[LC_X448_AVX512_LANES];
+
+		if (!base) {
+			for (i = 0; i < num; i++)
+				bp[i] = basepoint;
+			base = bp;
+		}
+
+		return x448_scalarmult_avx512(out, base, scalar, num);
+	}
+#endif
+
+	for (i = 0; i < num; i++) {
+		if (base)
+			tmp = x448_scalarmult(out[i], base[i], scalar[i]);
+		else
+			tmp = x448_derive_public_key(out[i], scalar[i]);
+		if (tmp)
+			ret = tmp;
+	}
+
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_x448_keypair_batch, struct lc_x448_pk *const *pk,
+		      struct lc_x448_sk *const *sk, unsigned int num,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	uint8_t *out[LC_X448_BATCH_CHUNK];
+	const uint8_t *scalar[LC_X448_BATCH_CHUNK];
+	unsigned int i, j, todo;
+	int ret = 0;
+
+	CKNULL(sk, -EINVAL);
+	CKNULL(pk, -EINVAL);
+
+	lc_x448_keypair_selftest();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_X448_KEYGEN);
+
+	lc_rng_check(&rng_ctx);
+
+	for (i = 0; i < num; i += todo) {
+		todo = min_uint32(num - i, LC_X448_BATCH_CHUNK);
+
+		for (j = 0; j < todo; j++) {
+			CKNULL(sk[i + j], -EINVAL);
+			CKNULL(pk[i + j], -EINVAL);
+
+			CKINT(lc_rng_generate(rng_ctx, NULL, 0, sk[i + j]->sk,
+					      LC_X448_SECRETKEYBYTES));
+
+			/* Timecop: the random number is the sentitive data */
+			poison(sk[i + j]->sk, LC_X448_SECRETKEYBYTES);
+
+			out[j] = pk[i + j]->pk;
+			scalar[j] = sk[i + j]->sk;
+		}
+
+		CKINT(lc_x448_scalarmult_batch(out, NULL, scalar, todo));
+
+		/*
+		 * Timecop: pk and sk are not relevant for side-channels any
+		 * more.
+		 */
+		for (j = 0; j < todo; j++) {
+			unpoison(sk[i + j]->sk, LC_X448_SECRETKEYBYTES);
+			unpoison(pk[i + j]->pk, LC_X448_PUBLICKEYBYTES);
+		}
+	}
+
+out:
+	return ret;
+}
+
 static int lc_x448_ss_nocheck(struct lc_x448_ss *ss,
 			      const struct lc_x448_pk *pk,
 			      const struct lc_x448_sk *sk);
@@ -254,3 +362,54 @@ LC_INTERFACE_FUNCTION(int, lc_x448_ss, struct lc_x448_ss *ss,
 
 	return lc_x448_ss_nocheck(ss, pk, sk);
 }
+
+LC_INTERFACE_FUNCTION(int, lc_x448_ss_batch, struct lc_x448_ss *const *ss,
+		      const struct lc_x448_pk *const *pk,
+		      const struct lc_x448_sk *const *sk, unsigned int num)
+{
+	uint8_t *out[LC_X448_BATCH_CHUNK];
+	const uint8_t *base[LC_X448_BATCH_CHUNK], *scalar[LC_X448_BATCH_CHUNK];
+	unsigned int i, j, todo;
+	int ret = 0, tmp;
+
+	CKNULL(sk, -EINVAL);
+	CKNULL(pk, -EINVAL);
+	CKNULL(ss, -EINVAL);
+
+	lc_x448_ss_selftest();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_X448_SS);
+
+	for (i = 0; i < num; i += todo) {
+		todo = min_uint32(num - i, LC_X448_BATCH_CHUNK);
+
+		for (j = 0; j < todo; j++) {
+			CKNULL(sk[i + j], -EINVAL);
+			CKNULL(pk[i + j], -EINVAL);
+			CKNULL(ss[i + j], -EINVAL);
+
+			/* Timecop: mark the secret key as sensitive */
+			poison(sk[i + j]->sk, LC_X448_SECRETKEYBYTES);
+
+			out[j] = ss[i + j]->ss;
+			base[j] = pk[i + j]->pk;
+			scalar[j] = sk[i + j]->sk;
+		}
+
+		/* Process all entries even if one of them fails */
+		tmp = lc_x448_scalarmult_batch(out, base, scalar, todo);
+		if (tmp)
+			ret = tmp;
+
+		/*
+		 * Timecop: ss and sk are not relevant for side-channels any
+		 * more.
+		 */
+		for (j = 0; j < todo; j++) {
+			unpoison(sk[i + j]->sk, LC_X448_SECRETKEYBYTES);
+			unpoison(ss[i + j]->ss, LC_X448_SSBYTES);
+		}
+	}
+
+out:
+	return ret;
+}
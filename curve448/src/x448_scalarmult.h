@@ -32,6 +32,23 @@ int x448_scalarmult(uint8_t out[LC_X448_PUBLICKEYBYTES],
 		    const uint8_t base[LC_X448_PUBLICKEYBYTES],
 		    const uint8_t scalar[LC_X448_SECRETKEYBYTES]);
 
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL))
+/* Number of scalar multiplications performed in parallel */
+#define LC_X448_AVX512_LANES 8
+
+/*
+ * Perform num <= LC_X448_AVX512_LANES independent scalar multiplications
+ * out[i] = scalar[i] * base[i] with one Montgomery ladder operating on all
+ * lanes of AVX-512 registers.
+ *
+ * The caller must ensure that the CPU supports AVX-512.
+ *
+ * Returns -EFAULT if any of the results is the point at infinity.
+ */
+int x448_scalarmult_avx512(uint8_t *const *out, const uint8_t *const *base,
+			   const uint8_t *const *scalar, unsigned int num);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -149,6 +149,85 @@ out:
 	return !!ret;
 }
 
+#define ED448_BATCH_NUM 20
+static int ed448_batch_tester(void)
+{
+	struct lc_ed448_pk pk[2];
+	struct lc_ed448_sk sk[2];
+	struct lc_ed448_sig sig[ED448_BATCH_NUM];
+	uint8_t msg[ED448_BATCH_NUM][4];
+	const struct lc_ed448_sig *sigp[ED448_BATCH_NUM];
+	const struct lc_ed448_pk *pkp[ED448_BATCH_NUM];
+	const uint8_t *msgp[ED448_BATCH_NUM];
+	size_t mlen[ED448_BATCH_NUM];
+	int res[ED448_BATCH_NUM];
+	unsigned int i;
+	int ret;
+	LC_SELFTEST_DRNG_CTX_ON_STACK(selftest_rng);
+
+	CKINT(lc_ed448_keypair(&pk[0], &sk[0], selftest_rng));
+	CKINT(lc_ed448_keypair(&pk[1], &sk[1], selftest_rng));
+
+	/* Spans two chunks, every third signature uses the second key */
+	for (i = 0; i < ED448_BATCH_NUM; i++) {
+		msg[i][0] = (uint8_t)i;
+		msg[i][1] = 0x01;
+		msg[i][2] = 0x02;
+		msg[i][3] = 0x03;
+		msgp[i] = msg[i];
+		mlen[i] = sizeof(msg[i]);
+		sigp[i] = &sig[i];
+		pkp[i] = &pk[i % 3 ? 0 : 1];
+
+		CKINT(lc_ed448_sign(&sig[i], msg[i], sizeof(msg[i]),
+				    &sk[i % 3 ? 0 : 1], selftest_rng));
+	}
+
+	CKINT(lc_ed448_verify_batch(res, sigp, msgp, mlen, ED448_BATCH_NUM,
+				    pkp));
+	for (i = 0; i < ED448_BATCH_NUM; i++) {
+		if (res[i]) {
+			printf("Ed448 batch verification of signature %u failed\n",
+			       i);
+			ret = 1;
+			goto out;
+		}
+	}
+
+	/*
+	 * Modified message of the first signature of a chunk, modified S,
+	 * non-canonical S, wrong key
+	 */
+	msg[0][1] ^= 0x01;
+	sig[8].sig[LC_ED448_PUBLICKEYBYTES] ^= 0x01;
+	sig[12].sig[LC_ED448_SIGBYTES - 2] = 0xff;
+	pkp[17] = &pk[1];
+
+	if (lc_ed448_verify_batch(res, sigp, msgp, mlen, ED448_BATCH_NUM,
+				  pkp) != -EBADMSG) {
+		printf("Ed448 batch verification did not detect failure\n");
+		ret = 1;
+		goto out;
+	}
+	for (i = 0; i < ED448_BATCH_NUM; i++) {
+		if (res[i] != lc_ed448_verify(sigp[i], msgp[i], mlen[i],
+					      pkp[i])) {
+			printf("Ed448 batch verification result %d of signature %u differs from single verification\n",
+			       res[i], i);
+			ret = 1;
+			goto out;
+		}
+	}
+	if (!res[0] || !res[8] || !res[12] || !res[17]) {
+		printf("Ed448 batch verification missed a failure\n");
+		ret = 1;
+		goto out;
+	}
+
+out:
+	return ret ? 1 : 0;
+}
+
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	int ret = 0;
@@ -169,6 +248,7 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	ret += ed448_sigver_pos_tester();
 	ret += ed448_sigver_neg_tester();
 	ret += ed448_siggen_tester();
+	ret += ed448_batch_tester();
 
 	ret = test_validate_status(ret, LC_ALG_STATUS_ED448_KEYGEN, 1);
 	ret = test_validate_status(ret, LC_ALG_STATUS_ED448_SIGGEN, 1);
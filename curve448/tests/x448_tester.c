@@ -22,6 +22,7 @@
 #include "lc_x448.h"
 #include "compare.h"
 #include "ret_checkers.h"
+#include "small_stack_support.h"
 #include "static_rng.h"
 #include "test_helper_common.h"
 #include "visibility.h"
@@ -70,6 +71,67 @@ out:
 	return !!ret;
 }
 
+/*
+ * Compare the batch operations with the single operations - the number of
+ * entries covers a full and a partial chunk.
+ */
+#define X448_BATCH_NUM 11
+static int x448_batch_tester(void)
+{
+	static const struct lc_x448_pk basepoint = { .pk = { 5 } };
+	struct x448_batch_ws {
+		struct lc_x448_pk pk[X448_BATCH_NUM];
+		struct lc_x448_sk sk[X448_BATCH_NUM];
+		struct lc_x448_ss ss[X448_BATCH_NUM];
+		struct lc_x448_ss exp;
+		struct lc_x448_pk *pk_p[X448_BATCH_NUM];
+		struct lc_x448_sk *sk_p[X448_BATCH_NUM];
+		struct lc_x448_ss *ss_p[X448_BATCH_NUM];
+	};
+	unsigned int i;
+	int ret;
+	LC_DECLARE_MEM(ws, struct x448_batch_ws, sizeof(uint64_t));
+
+	for (i = 0; i < X448_BATCH_NUM; i++) {
+		ws->pk_p[i] = &ws->pk[i];
+		ws->sk_p[i] = &ws->sk[i];
+		ws->ss_p[i] = &ws->ss[i];
+	}
+
+	CKINT_LOG(lc_x448_keypair_batch(ws->pk_p, ws->sk_p, X448_BATCH_NUM,
+					NULL),
+		  "X448 batch key generation failed\n");
+
+	/* Public key must match the base point multiplication */
+	for (i = 0; i < X448_BATCH_NUM; i++) {
+		CKINT_LOG(lc_x448_ss(&ws->exp, &basepoint, &ws->sk[i]),
+			  "X448 scalar multiplication failed\n");
+		ret += lc_compare(ws->pk[i].pk, ws->exp.ss, sizeof(ws->exp.ss),
+				  "X448 batch key generation\n");
+	}
+
+	/* Entry i uses the public key of entry i + 1 */
+	for (i = 0; i < X448_BATCH_NUM; i++)
+		ws->pk_p[i] = &ws->pk[(i + 1) % X448_BATCH_NUM];
+
+	CKINT_LOG(lc_x448_ss_batch(ws->ss_p,
+				   (const struct lc_x448_pk *const *)ws->pk_p,
+				   (const struct lc_x448_sk *const *)ws->sk_p,
+				   X448_BATCH_NUM),
+		  "X448 batch scalar multiplication failed\n");
+
+	for (i = 0; i < X448_BATCH_NUM; i++) {
+		CKINT_LOG(lc_x448_ss(&ws->exp, ws->pk_p[i], &ws->sk[i]),
+			  "X448 scalar multiplication failed\n");
+		ret += lc_compare(ws->ss[i].ss, ws->exp.ss, sizeof(ws->exp.ss),
+				  "X448 batch scalar multiplication\n");
+	}
+
+out:
+	LC_RELEASE_MEM(ws);
+	return !!ret;
+}
+
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	unsigned int loops = 1;
@@ -91,11 +153,13 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	}
 
 	ret |= x448_ss_tester(loops);
+	ret |= x448_batch_tester();
 
 #ifdef LINUX_KERNEL
 	lc_cpu_feature_disable();
 	cpu_feature_enable = 1;
 	ret |= x448_ss_tester(loops);
+	ret |= x448_batch_tester();
 #endif
 
 	if (cpu_feature_enable)
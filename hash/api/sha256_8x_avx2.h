@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SHA256_8X_AVX2_H
+#define SHA256_8X_AVX2_H
+
+#include "ext_headers_internal.h"
+#include "lc_sha256.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 8-way parallel SHA-256: all 8 input buffers must have the same length, all
+ * 8 output buffers receive the first outlen bytes of the respective digest
+ * (outlen must not exceed LC_SHA256_SIZE_DIGEST).
+ */
+void sha256x8(uint8_t *out[8], size_t outlen, const uint8_t *in[8],
+	      size_t inlen);
+
+/*
+ * Identical to sha256x8, but all 8 lanes continue from the common SHA-256
+ * state seed. The seed must only have absorbed full blocks, i.e. its
+ * msg_len must be a multiple of LC_SHA256_SIZE_BLOCK.
+ */
+void sha256x8_seeded(uint8_t *out[8], size_t outlen,
+		     const struct lc_sha256_state *seed, const uint8_t *in[8],
+		     size_t inlen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHA256_8X_AVX2_H */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SHAKE_8X_AVX512_H
+#define SHAKE_8X_AVX512_H
+
+#include "ext_headers_internal.h"
+#include "ext_headers_x86.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+	__m512i s[25];
+} keccakx8_state;
+
+void shake128x8_absorb_once(keccakx8_state *state, const uint8_t *in[8],
+			    size_t inlen);
+
+void shake128x8_squeezeblocks(uint8_t *out[8], size_t nblocks,
+			      keccakx8_state *state);
+
+void shake256x8_absorb_once(keccakx8_state *state, const uint8_t *in[8],
+			    size_t inlen);
+
+void shake256x8_squeezeblocks(uint8_t *out[8], size_t nblocks,
+			      keccakx8_state *state);
+
+/*
+ * 8-way parallel SHAKE: all 8 input buffers must have the same length, all
+ * 8 output buffers receive the same amount of data.
+ */
+void shake128x8(uint8_t *out[8], size_t outlen, const uint8_t *in[8],
+		size_t inlen);
+
+void shake256x8(uint8_t *out[8], size_t outlen, const uint8_t *in[8],
+		size_t inlen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHAKE_8X_AVX512_H */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+Implementation by the Keccak, Keyak and Ketje Teams, namely, Guido Bertoni,
+Joan Daemen, Michaël Peeters, Gilles Van Assche and Ronny Van Keer, hereby
+denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our websites:
+http://keccak.noekeon.org/
+http://keyak.noekeon.org/
+http://ketje.noekeon.org/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+*/
+
+#include "alignment.h"
+#include "ext_headers_internal.h"
+#include "ext_headers_x86.h"
+#include "KeccakP-1600-times8-SnP.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error Expecting a little-endian platform
+#endif
+
+typedef __m512i V512;
+
+#define XOR512(a, b) _mm512_xor_si512(a, b)
+#define XOR3_512(a, b, c) _mm512_ternarylogic_epi64(a, b, c, 0x96)
+/* a ^ (~b & c) */
+#define CHI512(a, b, c) _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+#define ROL64in512(a, o) _mm512_rol_epi64(a, o)
+#define CONST512_64(a) _mm512_set1_epi64((long long)(a))
+
+LC_FIPS_RODATA_SECTION
+static const uint64_t KeccakP1600RoundConstants[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/*
+ * theta, rho and pi step for one lane: the lane at position a (x + 5 * y) is
+ * combined with the column parity D[x], rotated and stored at its position
+ * after pi in B.
+ */
+#define THETA_RHO_PI(a, x, b, r) B[b] = ROL64in512(XOR512(A[a], D[x]), r)
+
+/* chi step for one row of 5 lanes starting at position y */
+#define CHI_ROW(y)                                                             \
+	A[y + 0] = CHI512(B[y + 0], B[y + 1], B[y + 2]);                       \
+	A[y + 1] = CHI512(B[y + 1], B[y + 2], B[y + 3]);                       \
+	A[y + 2] = CHI512(B[y + 2], B[y + 3], B[y + 4]);                       \
+	A[y + 3] = CHI512(B[y + 3], B[y + 4], B[y + 0]);                       \
+	A[y + 4] = CHI512(B[y + 4], B[y + 0], B[y + 1])
+
+static inline void KeccakP1600times8_Round(V512 A[25], uint64_t rc)
+{
+	V512 B[25], C[5], D[5];
+	unsigned int x;
+
+	/* theta */
+	for (x = 0; x < 5; x++) {
+		C[x] = XOR3_512(A[x], A[x + 5], A[x + 10]);
+		C[x] = XOR3_512(C[x], A[x + 15], A[x + 20]);
+	}
+	for (x = 0; x < 5; x++)
+		D[x] = XOR512(C[(x + 4) % 5], ROL64in512(C[(x + 1) % 5], 1));
+
+	/* rho and pi */
+	THETA_RHO_PI(0, 0, 0, 0);
+	THETA_RHO_PI(1, 1, 10, 1);
+	THETA_RHO_PI(2, 2, 20, 62);
+	THETA_RHO_PI(3, 3, 5, 28);
+	THETA_RHO_PI(4, 4, 15, 27);
+	THETA_RHO_PI(5, 0, 16, 36);
+	THETA_RHO_PI(6, 1, 1, 44);
+	THETA_RHO_PI(7, 2, 11, 6);
+	THETA_RHO_PI(8, 3, 21, 55);
+	THETA_RHO_PI(9, 4, 6, 20);
+	THETA_RHO_PI(10, 0, 7, 3);
+	THETA_RHO_PI(11, 1, 17, 10);
+	THETA_RHO_PI(12, 2, 2, 43);
+	THETA_RHO_PI(13, 3, 12, 25);
+	THETA_RHO_PI(14, 4, 22, 39);
+	THETA_RHO_PI(15, 0, 23, 41);
+	THETA_RHO_PI(16, 1, 8, 45);
+	THETA_RHO_PI(17, 2, 18, 15);
+	THETA_RHO_PI(18, 3, 3, 21);
+	THETA_RHO_PI(19, 4, 13, 8);
+	THETA_RHO_PI(20, 0, 14, 18);
+	THETA_RHO_PI(21, 1, 24, 2);
+	THETA_RHO_PI(22, 2, 9, 61);
+	THETA_RHO_PI(23, 3, 19, 56);
+	THETA_RHO_PI(24, 4, 4, 14);
+
+	/* chi */
+	CHI_ROW(0);
+	CHI_ROW(5);
+	CHI_ROW(10);
+	CHI_ROW(15);
+	CHI_ROW(20);
+
+	/* iota */
+	A[0] = XOR512(A[0], CONST512_64(rc));
+}
+
+void KeccakP1600times8_PermuteAll_24rounds(void *states)
+{
+	V512 *statesAsLanes = (V512 *)states;
+	V512 A[25];
+	unsigned int i;
+
+	for (i = 0; i < 25; i++)
+		A[i] = statesAsLanes[i];
+
+	for (i = 0; i < 24; i++)
+		KeccakP1600times8_Round(A, KeccakP1600RoundConstants[i]);
+
+	for (i = 0; i < 25; i++)
+		statesAsLanes[i] = A[i];
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#include "bitshift_be.h"
+#include "ext_headers_internal.h"
+#include "ext_headers_x86.h"
+#include "lc_memset_secure.h"
+#include "sha256_8x_avx2.h"
+#include "visibility.h"
+
+static const uint32_t sha256x8_K[] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+	0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+	0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+	0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+	0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+	0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const struct lc_sha256_state sha256x8_iv = {
+	.H = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f,
+	       0x9b05688c, 0x1f83d9ab, 0x5be0cd19 },
+	.msg_len = 0,
+};
+
+#define ADD(a, b) _mm256_add_epi32(a, b)
+#define XOR(a, b) _mm256_xor_si256(a, b)
+#define ROTR(x, n)                                                             \
+	_mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n))
+#define SHR(x, n) _mm256_srli_epi32(x, n)
+
+#define CH(x, y, z)                                                            \
+	XOR(_mm256_and_si256(x, y), _mm256_andnot_si256(x, z))
+#define MAJ(x, y, z)                                                           \
+	_mm256_or_si256(_mm256_and_si256(x, y),                                \
+			_mm256_and_si256(z, _mm256_or_si256(x, y)))
+
+#define SIGMA0(x) XOR(XOR(ROTR(x, 2), ROTR(x, 13)), ROTR(x, 22))
+#define SIGMA1(x) XOR(XOR(ROTR(x, 6), ROTR(x, 11)), ROTR(x, 25))
+#define GAMMA0(x) XOR(XOR(ROTR(x, 7), ROTR(x, 18)), SHR(x, 3))
+#define GAMMA1(x) XOR(XOR(ROTR(x, 17), ROTR(x, 19)), SHR(x, 10))
+
+/*
+ * Transpose an 8x8 matrix of 32 bit words: on input, r[i] holds 8 words of
+ * lane i, on output r[i] holds word i of all 8 lanes.
+ */
+static inline void sha256x8_transpose(__m256i r[8])
+{
+	__m256i t0, t1, t2, t3, t4, t5, t6, t7;
+	__m256i u0, u1, u2, u3, u4, u5, u6, u7;
+
+	t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+	t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+	t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+	t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+	t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+	t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+	t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+	t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+	u0 = _mm256_unpacklo_epi64(t0, t2);
+	u1 = _mm256_unpackhi_epi64(t0, t2);
+	u2 = _mm256_unpacklo_epi64(t1, t3);
+	u3 = _mm256_unpackhi_epi64(t1, t3);
+	u4 = _mm256_unpacklo_epi64(t4, t6);
+	u5 = _mm256_unpackhi_epi64(t4, t6);
+	u6 = _mm256_unpacklo_epi64(t5, t7);
+	u7 = _mm256_unpackhi_epi64(t5, t7);
+
+	r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+	r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+	r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+	r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+	r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+	r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+	r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+	r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+static inline __m256i sha256x8_bswap_mask(void)
+{
+	return _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1,
+			       2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7,
+			       0, 1, 2, 3);
+}
+
+/* Process one 64 byte block at in[i] + offset of each lane */
+static void sha256x8_transform(__m256i s[8], const uint8_t *in[8],
+			       size_t offset)
+{
+	const __m256i bswap = sha256x8_bswap_mask();
+	__m256i w[16], a, b, c, d, e, f, g, h, t1, t2;
+	unsigned int i, j;
+
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 8; j++) {
+			w[8 * i + j] = _mm256_loadu_si256(
+				(const __m256i *)(in[j] + offset + 32 * i));
+		}
+		sha256x8_transpose(&w[8 * i]);
+		for (j = 0; j < 8; j++)
+			w[8 * i + j] = _mm256_shuffle_epi8(w[8 * i + j], bswap);
+	}
+
+	a = s[0];
+	b = s[1];
+	c = s[2];
+	d = s[3];
+	e = s[4];
+	f = s[5];
+	g = s[6];
+	h = s[7];
+
+	for (i = 0; i < 64; i++) {
+		if (i >= 16) {
+			w[i & 15] = ADD(ADD(GAMMA1(w[(i - 2) & 15]),
+					    w[(i - 7) & 15]),
+					ADD(GAMMA0(w[(i - 15) & 15]),
+					    w[i & 15]));
+		}
+
+		t1 = ADD(ADD(ADD(h, SIGMA1(e)), ADD(CH(e, f, g), w[i & 15])),
+			 _mm256_set1_epi32((int)sha256x8_K[i]));
+		t2 = ADD(SIGMA0(a), MAJ(a, b, c));
+		h = g;
+		g = f;
+		f = e;
+		e = ADD(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = ADD(t1, t2);
+	}
+
+	s[0] = ADD(s[0], a);
+	s[1] = ADD(s[1], b);
+	s[2] = ADD(s[2], c);
+	s[3] = ADD(s[3], d);
+	s[4] = ADD(s[4], e);
+	s[5] = ADD(s[5], f);
+	s[6] = ADD(s[6], g);
+	s[7] = ADD(s[7], h);
+}
+
+LC_INTERFACE_FUNCTION(void, sha256x8_seeded, uint8_t *out[8], size_t outlen,
+		      const struct lc_sha256_state *seed, const uint8_t *in[8],
+		      size_t inlen)
+{
+	uint8_t tail[8][2 * LC_SHA256_SIZE_BLOCK];
+	uint8_t digest[LC_SHA256_SIZE_DIGEST];
+	const uint8_t *tails[8];
+	__m256i s[8];
+	uint64_t bits = (uint64_t)(seed->msg_len + inlen) << 3;
+	size_t offset, rem, taillen;
+	unsigned int i;
+
+	LC_FPU_ENABLE;
+
+	for (i = 0; i < 8; i++)
+		s[i] = _mm256_set1_epi32((int)seed->H[i]);
+
+	for (offset = 0; inlen - offset >= LC_SHA256_SIZE_BLOCK;
+	     offset += LC_SHA256_SIZE_BLOCK)
+		sha256x8_transform(s, in, offset);
+
+	/* Pad the remaining data of each lane into one or two blocks */
+	rem = inlen - offset;
+	taillen = (rem + 9 > LC_SHA256_SIZE_BLOCK) ? 2 * LC_SHA256_SIZE_BLOCK :
+						     LC_SHA256_SIZE_BLOCK;
+	for (i = 0; i < 8; i++) {
+		memcpy(tail[i], in[i] + offset, rem);
+		tail[i][rem] = 0x80;
+		memset(tail[i] + rem + 1, 0, taillen - rem - 9);
+		be64_to_ptr(tail[i] + taillen - 8, bits);
+		tails[i] = tail[i];
+	}
+
+	sha256x8_transform(s, tails, 0);
+	if (taillen > LC_SHA256_SIZE_BLOCK)
+		sha256x8_transform(s, tails, LC_SHA256_SIZE_BLOCK);
+
+	sha256x8_transpose(s);
+	for (i = 0; i < 8; i++) {
+		_mm256_storeu_si256(
+			(__m256i *)digest,
+			_mm256_shuffle_epi8(s[i], sha256x8_bswap_mask()));
+		memcpy(out[i], digest, outlen);
+	}
+
+	lc_memset_secure(tail, 0, sizeof(tail));
+	lc_memset_secure(digest, 0, sizeof(digest));
+
+	LC_FPU_DISABLE;
+}
+
+LC_INTERFACE_FUNCTION(void, sha256x8, uint8_t *out[8], size_t outlen,
+		      const uint8_t *in[8], size_t inlen)
+{
+	sha256x8_seeded(out, outlen, &sha256x8_iv, in, inlen);
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/pq-crystals/kyber
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "ext_headers_internal.h"
+#include "ext_headers_x86.h"
+#include "lc_sha3.h"
+#include "lc_memcmp_secure.h"
+#include "shake_8x_avx512.h"
+#include "visibility.h"
+
+/* Use implementation from the Keccak Code Package */
+#define KeccakF1600_StatePermute8x KeccakP1600times8_PermuteAll_24rounds
+extern void KeccakF1600_StatePermute8x(__m512i *s);
+
+static void keccakx8_absorb_once(__m512i s[25], unsigned int r,
+				 const uint8_t *in[8], size_t inlen, uint8_t p)
+{
+	size_t i;
+	uint64_t pos = 0;
+	uint64_t tail[8];
+	unsigned int j;
+	__m512i t, idx;
+
+	for (i = 0; i < 25; ++i)
+		s[i] = _mm512_setzero_si512();
+
+	idx = _mm512_set_epi64((long long)in[7], (long long)in[6],
+			       (long long)in[5], (long long)in[4],
+			       (long long)in[3], (long long)in[2],
+			       (long long)in[1], (long long)in[0]);
+	while (inlen >= r) {
+		for (i = 0; i < r / 8; ++i) {
+			t = _mm512_i64gather_epi64(idx, (void *)pos, 1);
+			s[i] = _mm512_xor_si512(s[i], t);
+			pos += 8;
+		}
+		inlen -= r;
+
+		KeccakF1600_StatePermute8x(s);
+	}
+
+	for (i = 0; i < inlen / 8; ++i) {
+		t = _mm512_i64gather_epi64(idx, (void *)pos, 1);
+		s[i] = _mm512_xor_si512(s[i], t);
+		pos += 8;
+	}
+	inlen -= 8 * i;
+
+	/*
+	 * Do not read beyond the end of the input buffers for the final
+	 * partial lane.
+	 */
+	if (inlen) {
+		for (j = 0; j < 8; j++) {
+			tail[j] = 0;
+			memcpy(&tail[j], in[j] + pos, inlen);
+		}
+		t = _mm512_loadu_si512((const void *)tail);
+		s[i] = _mm512_xor_si512(s[i], t);
+	}
+
+	t = _mm512_set1_epi64((int64_t)p << 8 * inlen);
+	s[i] = _mm512_xor_si512(s[i], t);
+	t = _mm512_set1_epi64((long long)(1ULL << 63));
+	s[r / 8 - 1] = _mm512_xor_si512(s[r / 8 - 1], t);
+}
+
+static void keccakx8_squeezeblocks(uint8_t *out[8], size_t nblocks,
+				   unsigned int r, __m512i s[25])
+{
+	uint64_t lanes[8];
+	size_t offset = 0;
+	unsigned int i, j;
+
+	while (nblocks > 0) {
+		KeccakF1600_StatePermute8x(s);
+		for (i = 0; i < r / 8; ++i) {
+			_mm512_storeu_si512((void *)lanes, s[i]);
+			for (j = 0; j < 8; j++)
+				memcpy(out[j] + offset + 8 * i, &lanes[j], 8);
+		}
+
+		offset += r;
+		--nblocks;
+	}
+
+	lc_memset_secure(lanes, 0, sizeof(lanes));
+}
+
+void shake128x8_absorb_once(keccakx8_state *state, const uint8_t *in[8],
+			    size_t inlen)
+{
+	LC_FPU_ENABLE;
+	keccakx8_absorb_once(state->s, LC_SHAKE_128_SIZE_BLOCK, in, inlen,
+			     0x1F);
+	LC_FPU_DISABLE;
+}
+
+void shake128x8_squeezeblocks(uint8_t *out[8], size_t nblocks,
+			      keccakx8_state *state)
+{
+	LC_FPU_ENABLE;
+	keccakx8_squeezeblocks(out, nblocks, LC_SHAKE_128_SIZE_BLOCK,
+			       state->s);
+	LC_FPU_DISABLE;
+}
+
+void shake256x8_absorb_once(keccakx8_state *state, const uint8_t *in[8],
+			    size_t inlen)
+{
+	LC_FPU_ENABLE;
+	keccakx8_absorb_once(state->s, LC_SHAKE_256_SIZE_BLOCK, in, inlen,
+			     0x1F);
+	LC_FPU_DISABLE;
+}
+
+void shake256x8_squeezeblocks(uint8_t *out[8], size_t nblocks,
+			      keccakx8_state *state)
+{
+	LC_FPU_ENABLE;
+	keccakx8_squeezeblocks(out, nblocks, LC_SHAKE_256_SIZE_BLOCK,
+			       state->s);
+	LC_FPU_DISABLE;
+}
+
+LC_INTERFACE_FUNCTION(void, shake128x8, uint8_t *out[8], size_t outlen,
+		      const uint8_t *in[8], size_t inlen)
+{
+	unsigned int i, j;
+	size_t nblocks = outlen / LC_SHAKE_128_SIZE_BLOCK;
+	uint8_t t[8][LC_SHAKE_128_SIZE_BLOCK];
+	uint8_t *tp[8];
+	keccakx8_state state;
+
+	shake128x8_absorb_once(&state, in, inlen);
+	shake128x8_squeezeblocks(out, nblocks, &state);
+
+	outlen -= nblocks * LC_SHAKE_128_SIZE_BLOCK;
+
+	if (outlen) {
+		for (j = 0; j < 8; j++)
+			tp[j] = t[j];
+		shake128x8_squeezeblocks(tp, 1, &state);
+		for (j = 0; j < 8; j++) {
+			for (i = 0; i < outlen; ++i)
+				out[j][nblocks * LC_SHAKE_128_SIZE_BLOCK + i] =
+					t[j][i];
+		}
+		lc_memset_secure(t, 0, sizeof(t));
+	}
+
+	lc_memset_secure(&state, 0, sizeof(state));
+}
+
+LC_INTERFACE_FUNCTION(void, shake256x8, uint8_t *out[8], size_t outlen,
+		      const uint8_t *in[8], size_t inlen)
+{
+	unsigned int i, j;
+	size_t nblocks = outlen / LC_SHAKE_256_SIZE_BLOCK;
+	uint8_t t[8][LC_SHAKE_256_SIZE_BLOCK];
+	uint8_t *tp[8];
+	keccakx8_state state;
+
+	shake256x8_absorb_once(&state, in, inlen);
+	shake256x8_squeezeblocks(out, nblocks, &state);
+
+	outlen -= nblocks * LC_SHAKE_256_SIZE_BLOCK;
+
+	if (outlen) {
+		for (j = 0; j < 8; j++)
+			tp[j] = t[j];
+		shake256x8_squeezeblocks(tp, 1, &state);
+		for (j = 0; j < 8; j++) {
+			for (i = 0; i < outlen; ++i)
+				out[j][nblocks * LC_SHAKE_256_SIZE_BLOCK + i] =
+					t[j][i];
+		}
+		lc_memset_secure(t, 0, sizeof(t));
+	}
+
+	lc_memset_secure(&state, 0, sizeof(state));
+}
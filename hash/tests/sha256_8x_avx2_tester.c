@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#include "compare.h"
+#include "cpufeatures.h"
+#include "helper.h"
+#include "lc_sha256.h"
+#include "ret_checkers.h"
+#include "visibility.h"
+
+#include "sha256_8x_avx2.h"
+
+static int sha256_8x_tester(void)
+{
+	static const uint8_t msg1[] = { 0x06, 0x3A, 0x53 };
+	static const uint8_t exp1[] = { 0x8b, 0x05, 0x65, 0x59, 0x60, 0x71,
+					0xc7, 0x6e, 0x35, 0xe1, 0xea, 0x54,
+					0x48, 0x39, 0xe6, 0x47, 0x27, 0xdf,
+					0x89, 0xb4, 0xde, 0x27, 0x74, 0x44,
+					0xa7, 0x7f, 0x77, 0xcb, 0x97, 0x89,
+					0x6f, 0xf4 };
+	/*
+	 * Message lengths covering the one and two padding block cases as
+	 * well as multiple full blocks.
+	 */
+	static const size_t lens[] = { 0, 55, 56, 64, 119, 200 };
+	uint8_t msg2[8][200 + LC_SHA256_SIZE_BLOCK];
+	uint8_t exp2[LC_SHA256_SIZE_DIGEST];
+	uint8_t act[8][LC_SHA256_SIZE_DIGEST];
+	uint8_t *out[8];
+	const uint8_t *in[8];
+	struct lc_sha256_state seed;
+	unsigned int i, j, k;
+	int ret, rc = 0;
+	LC_HASH_CTX_ON_STACK(sha256, lc_sha256);
+
+	for (i = 0; i < 8; i++) {
+		out[i] = act[i];
+		in[i] = msg1;
+	}
+
+	sha256x8(out, sizeof(exp1), in, sizeof(msg1));
+
+	for (i = 0; i < 8; i++) {
+		rc += lc_compare(act[i], exp1, sizeof(exp1),
+				 "SHA-256 8x AVX2 lane");
+	}
+
+	for (i = 0; i < 8; i++) {
+		for (j = 0; j < sizeof(msg2[i]); j++)
+			msg2[i][j] = (uint8_t)(i * 31 + j);
+	}
+
+	for (k = 0; k < ARRAY_SIZE(lens); k++) {
+		for (i = 0; i < 8; i++)
+			in[i] = msg2[i];
+
+		sha256x8(out, sizeof(exp2), in, lens[k]);
+
+		for (i = 0; i < 8; i++) {
+			CKINT(lc_hash(lc_sha256, msg2[i], lens[k], exp2));
+			rc += lc_compare(act[i], exp2, sizeof(exp2),
+					 "SHA-256 8x AVX2 multi-block lane");
+		}
+
+		/* Continue from a state that absorbed one common block */
+		CKINT(lc_hash_init(sha256));
+		lc_hash_update(sha256, msg2[0], LC_SHA256_SIZE_BLOCK);
+		memcpy(&seed, sha256->hash_state, sizeof(seed));
+		for (i = 0; i < 8; i++)
+			in[i] = msg2[i] + LC_SHA256_SIZE_BLOCK;
+
+		/* Truncated output */
+		sha256x8_seeded(out, 16, &seed, in, lens[k]);
+
+		for (i = 0; i < 8; i++) {
+			CKINT(lc_hash_init(sha256));
+			lc_hash_update(sha256, msg2[0], LC_SHA256_SIZE_BLOCK);
+			lc_hash_update(sha256, in[i], lens[k]);
+			lc_hash_final(sha256, exp2);
+			rc += lc_compare(act[i], exp2, 16,
+					 "SHA-256 8x AVX2 seeded lane");
+		}
+	}
+
+out:
+	lc_hash_zero(sha256);
+	return ret ? ret : rc;
+}
+
+LC_TEST_FUNC(int, main, int argc, char *argv[])
+{
+	enum lc_cpu_features feat;
+
+	feat = lc_cpu_feature_available();
+	if (!(feat & LC_CPU_FEATURE_INTEL_AVX2))
+		return 77;
+
+	(void)argc;
+	(void)argv;
+	return sha256_8x_tester();
+}
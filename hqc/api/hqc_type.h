@@ -151,6 +151,21 @@ extern "C" {
 #define gf_generate_avx2 HQC_F(gf_generate_avx2)
 #define gf_mul_vect_avx2 HQC_F(gf_mul_vect_avx2)
 #define gf_mod_avx2 HQC_F(gf_mod_avx2)
+#define fft_gfni HQC_F(fft_gfni)
+#define reed_solomon_decode_gfni HQC_F(reed_solomon_decode_gfni)
+
+#define lc_hqc_keypair_avx512 HQC_F(keypair_avx512)
+#define lc_hqc_keypair_from_seed_avx512 HQC_F(keypair_from_seed_avx512)
+#define lc_hqc_enc_avx512 HQC_F(enc_avx512)
+#define lc_hqc_enc_kdf_avx512 HQC_F(enc_kdf_avx512)
+#define lc_hqc_enc_internal_avx512 HQC_F(enc_internal_avx512)
+#define lc_hqc_dec_avx512 HQC_F(dec_avx512)
+#define lc_hqc_dec_kdf_avx512 HQC_F(dec_kdf_avx512)
+
+#define hqc_pke_keygen_avx512 HQC_F(hqc_pke_keygen_avx512)
+#define hqc_pke_encrypt_avx512 HQC_F(hqc_pke_encrypt_avx512)
+#define hqc_pke_decrypt_avx512 HQC_F(hqc_pke_decrypt_avx512)
+#define vect_mul_avx512 HQC_F(vect_mul_avx512)
 
 #ifdef __cplusplus
 }
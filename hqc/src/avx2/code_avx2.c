@@ -28,8 +28,10 @@
  */
 
 #include "code_avx2.h"
+#include "cpufeatures.h"
 #include "reed_muller_avx2.h"
 #include "reed_solomon_avx2.h"
+#include "reed_solomon_gfni.h"
 
 /**
  *
@@ -65,6 +67,13 @@ void code_decode_avx2(uint64_t *m, const uint64_t *em,
 
 	memset(&ws->u.reed_solomon_decode_ws, 0,
 	       sizeof(ws->u.reed_solomon_decode_ws));
+#ifdef LC_HQC_GFNI
+	if (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_GFNI) {
+		reed_solomon_decode_gfni(m, ws->code_decode_tmp,
+					 &ws->u.reed_solomon_decode_ws);
+		return;
+	}
+#endif
 	reed_solomon_decode_avx2(m, ws->code_decode_tmp,
 				 &ws->u.reed_solomon_decode_ws);
 }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/**
+ * @file gf_gfni.h
+ * @brief GF(2^8) arithmetic using the GFNI instructions
+ *
+ * The GFNI multiplication gf2p8mulb operates in GF(2^8) defined by
+ * x^8 + x^4 + x^3 + x + 1 whereas HQC uses x^8 + x^4 + x^3 + x^2 + 1. Both
+ * fields are isomorphic: mapping the root alpha of the HQC polynomial to the
+ * root 0x03 of the GFNI polynomial yields a GF(2)-linear bijection which is
+ * applied with gf2p8affineqb. That bijection is an involution, i.e. the same
+ * matrix converts in both directions.
+ *
+ * The helpers operating on __m256i expect byte lanes unless noted otherwise.
+ * Elements converted with gf_to_gfni_vect are said to be in the GFNI domain.
+ */
+
+#ifndef GF_GFNI_H
+#define GF_GFNI_H
+
+#include "ext_headers_x86.h"
+#include "hqc_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Field isomorphism between the HQC field and the GFNI field (involution) */
+#define LC_HQC_GFNI_ISO 0xffaacc88f0a0c080ULL
+/* Identity matrix for gf2p8affineinvqb */
+#define LC_HQC_GFNI_IDENTITY 0x0102040810204080ULL
+
+static inline __m256i gf_to_gfni_vect(__m256i a)
+{
+	return _mm256_gf2p8affine_epi64_epi8(
+		a, _mm256_set1_epi64x((long long)LC_HQC_GFNI_ISO), 0);
+}
+
+static inline __m256i gf_from_gfni_vect(__m256i a)
+{
+	return gf_to_gfni_vect(a);
+}
+
+/**
+ * @brief Computes the inverse of 32 elements in the GFNI domain
+ *
+ * The inverse of 0 is 0.
+ */
+static inline __m256i gf_inverse_gfni_vect(__m256i a)
+{
+	return _mm256_gf2p8affineinv_epi64_epi8(
+		a, _mm256_set1_epi64x((long long)LC_HQC_GFNI_IDENTITY), 0);
+}
+
+/**
+ * @brief Computes the horizontal sum (XOR) of 32 bytes
+ */
+static inline uint8_t gf_hsum_gfni_vect(__m256i a)
+{
+	__m128i t = _mm_xor_si128(_mm256_castsi256_si128(a),
+				  _mm256_extracti128_si256(a, 1));
+	uint64_t r;
+
+	t = _mm_xor_si128(t, _mm_unpackhi_epi64(t, t));
+	r = (uint64_t)_mm_cvtsi128_si64(t);
+	r ^= r >> 32;
+	r ^= r >> 16;
+	r ^= r >> 8;
+
+	return (uint8_t)r;
+}
+
+/**
+ * @brief Multiplies two elements of GF(2^GF_M) in the HQC representation
+ * @returns the product a*b
+ */
+static inline uint16_t gf_mul_gfni(uint16_t a, uint16_t b)
+{
+	__m128i iso = _mm_set1_epi64x((long long)LC_HQC_GFNI_ISO);
+	__m128i va = _mm_gf2p8affine_epi64_epi8(_mm_cvtsi32_si128(a), iso, 0);
+	__m128i vb = _mm_gf2p8affine_epi64_epi8(_mm_cvtsi32_si128(b), iso, 0);
+
+	va = _mm_gf2p8affine_epi64_epi8(_mm_gf2p8mul_epi8(va, vb), iso, 0);
+
+	return (uint16_t)(_mm_cvtsi128_si32(va) & 0xff);
+}
+
+static inline uint16_t gf_square_gfni(uint16_t a)
+{
+	return gf_mul_gfni(a, a);
+}
+
+/**
+ * @brief Computes the inverse of an element of GF(2^GF_M) in the HQC
+ *	  representation
+ * @returns the inverse of a (0 if a is 0)
+ */
+static inline uint16_t gf_inverse_gfni(uint16_t a)
+{
+	__m128i iso = _mm_set1_epi64x((long long)LC_HQC_GFNI_ISO);
+	__m128i va = _mm_gf2p8affine_epi64_epi8(_mm_cvtsi32_si128(a), iso, 0);
+
+	/* gf2p8affineinvqb applies the matrix after inverting */
+	va = _mm_gf2p8affineinv_epi64_epi8(va, iso, 0);
+
+	return (uint16_t)(_mm_cvtsi128_si32(va) & 0xff);
+}
+
+/**
+ * @brief Compute 16 products in GF(2^GF_M) in the HQC representation
+ *
+ * Drop-in replacement for gf_mul_vect_avx2: the elements are stored as 16 bit
+ * integers with a cleared upper byte which remains zero as 0 maps to 0 and
+ * 0 * 0 = 0.
+ */
+static inline __m256i gf_mul_vect_gfni(__m256i a, __m256i b)
+{
+	return gf_from_gfni_vect(_mm256_gf2p8mul_epi8(gf_to_gfni_vect(a),
+						      gf_to_gfni_vect(b)));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GF_GFNI_H */
@@ -185,6 +185,19 @@ struct vect_mul_ws {
 	} karat_mult_1;
 };
 
+/*
+ * The AVX-512 multiplication operates on blocks of 1024 bits, the operands are
+ * zero-padded to a multiple thereof.
+ */
+#define LC_HQC_VEC_N_1024_SIZE_64 (LC_HQC_CEIL_DIVIDE(LC_HQC_PARAM_N, 1024) << 4)
+
+struct vect_mul_avx512_ws {
+	uint64_t a1[LC_HQC_VEC_N_1024_SIZE_64];
+	uint64_t a2[LC_HQC_VEC_N_1024_SIZE_64];
+	uint64_t a1_times_a2[LC_HQC_VEC_N_1024_SIZE_64 << 1];
+	uint64_t stack[(LC_HQC_VEC_N_1024_SIZE_64 << 2) + 512];
+};
+
 struct vect_set_random_fixed_weight_ws {
 	__m256i bit256[LC_HQC_PARAM_OMEGA_R];
 	__m256i bloc256[LC_HQC_PARAM_OMEGA_R];
@@ -211,6 +224,7 @@ struct hqc_pke_encrypt_ws {
 		struct vect_set_random_fixed_weight_ws vect_set_f_ws;
 		struct vect_set_random_ws vect_set_r_ws;
 		struct vect_mul_ws vect_mul_ws;
+		struct vect_mul_avx512_ws vect_mul_avx512_ws;
 	} wsu;
 	uint64_t tmp4[LC_HQC_VEC_N_256_SIZE_64];
 };
@@ -221,6 +235,7 @@ struct hqc_pke_decrypt_ws {
 	union {
 		struct vect_set_random_fixed_weight_ws vect_set_f_ws;
 		struct vect_mul_ws vect_mul_ws;
+		struct vect_mul_avx512_ws vect_mul_avx512_ws;
 		struct reed_decode_ws reed_decode_ws;
 	} wsu;
 	uint64_t tmp1[LC_HQC_VEC_N_256_SIZE_64];
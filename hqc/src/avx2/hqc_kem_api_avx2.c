@@ -21,13 +21,28 @@
 #include "cpufeatures.h"
 #include "hqc_internal_avx2.h"
 #include "hqc_kem_avx2.h"
+#include "../avx512/hqc_kem_avx512.h"
 #include "../hqc_selftest.h"
 #include "../hqc_kem_c.h"
 #include "visibility.h"
 
+static inline int hqc_avx512_available(void)
+{
+	return (lc_cpu_feature_available() &
+		(LC_CPU_FEATURE_INTEL_AVX512 | LC_CPU_FEATURE_INTEL_VPCLMUL)) ==
+	       (LC_CPU_FEATURE_INTEL_AVX512 | LC_CPU_FEATURE_INTEL_VPCLMUL);
+}
+
 LC_INTERFACE_FUNCTION(int, lc_hqc_keypair, struct lc_hqc_pk *pk,
 		      struct lc_hqc_sk *sk, struct lc_rng_ctx *rng_ctx)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_keygen_selftest(lc_hqc_keypair_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_KEYGEN);
+
+		return lc_hqc_keypair_avx512(pk, sk, rng_ctx);
+	}
+
 	if (lc_cpu_feature_available() &
 	    ((LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL))) {
 		hqc_kem_keygen_selftest(lc_hqc_keypair_avx2);
@@ -44,6 +59,13 @@ LC_INTERFACE_FUNCTION(int, lc_hqc_keypair, struct lc_hqc_pk *pk,
 LC_INTERFACE_FUNCTION(int, lc_hqc_keypair_from_seed, struct lc_hqc_pk *pk,
 		      struct lc_hqc_sk *sk, const uint8_t *seed, size_t seedlen)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_keygen_selftest(lc_hqc_keypair_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_KEYGEN);
+
+		return lc_hqc_keypair_from_seed_avx512(pk, sk, seed, seedlen);
+	}
+
 	if (lc_cpu_feature_available() &
 	    (LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL)) {
 		hqc_kem_keygen_selftest(lc_hqc_keypair_avx2);
@@ -61,6 +83,13 @@ LC_INTERFACE_FUNCTION(int, lc_hqc_enc_internal, struct lc_hqc_ct *ct,
 		      struct lc_hqc_ss *ss, const struct lc_hqc_pk *pk,
 		      struct lc_rng_ctx *rng_ctx)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_enc_selftest(lc_hqc_enc_internal_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_ENC);
+
+		return lc_hqc_enc_internal_avx512(ct, ss, pk, rng_ctx);
+	}
+
 	if (lc_cpu_feature_available() &
 	    (LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL)) {
 		hqc_kem_enc_selftest(lc_hqc_enc_internal_avx2);
@@ -77,6 +106,13 @@ LC_INTERFACE_FUNCTION(int, lc_hqc_enc_internal, struct lc_hqc_ct *ct,
 LC_INTERFACE_FUNCTION(int, lc_hqc_enc, struct lc_hqc_ct *ct,
 		      struct lc_hqc_ss *ss, const struct lc_hqc_pk *pk)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_enc_selftest(lc_hqc_enc_internal_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_ENC);
+
+		return lc_hqc_enc_avx512(ct, ss, pk);
+	}
+
 	if (lc_cpu_feature_available() &
 	    (LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL)) {
 		hqc_kem_enc_selftest(lc_hqc_enc_internal_avx2);
@@ -93,6 +129,13 @@ LC_INTERFACE_FUNCTION(int, lc_hqc_enc, struct lc_hqc_ct *ct,
 LC_INTERFACE_FUNCTION(int, lc_hqc_enc_kdf, struct lc_hqc_ct *ct, uint8_t *ss,
 		      size_t ss_len, const struct lc_hqc_pk *pk)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_enc_selftest(lc_hqc_enc_internal_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_ENC);
+
+		return lc_hqc_enc_kdf_avx512(ct, ss, ss_len, pk);
+	}
+
 	if (lc_cpu_feature_available() &
 	    (LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL)) {
 		hqc_kem_enc_selftest(lc_hqc_enc_internal_avx2);
@@ -109,6 +152,13 @@ LC_INTERFACE_FUNCTION(int, lc_hqc_enc_kdf, struct lc_hqc_ct *ct, uint8_t *ss,
 LC_INTERFACE_FUNCTION(int, lc_hqc_dec, struct lc_hqc_ss *ss,
 		      const struct lc_hqc_ct *ct, const struct lc_hqc_sk *sk)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_dec_selftest(lc_hqc_dec_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_DEC);
+
+		return lc_hqc_dec_avx512(ss, ct, sk);
+	}
+
 	if (lc_cpu_feature_available() &
 	    (LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL)) {
 		hqc_kem_dec_selftest(lc_hqc_dec_avx2);
@@ -125,6 +175,13 @@ LC_INTERFACE_FUNCTION(int, lc_hqc_dec, struct lc_hqc_ss *ss,
 LC_INTERFACE_FUNCTION(int, lc_hqc_dec_kdf, uint8_t *ss, size_t ss_len,
 		      const struct lc_hqc_ct *ct, const struct lc_hqc_sk *sk)
 {
+	if (hqc_avx512_available()) {
+		hqc_kem_dec_selftest(lc_hqc_dec_avx512);
+		LC_SELFTEST_COMPLETED(LC_ALG_STATUS_HQC_DEC);
+
+		return lc_hqc_dec_kdf_avx512(ss, ss_len, ct, sk);
+	}
+
 	if (lc_cpu_feature_available() &
 	    (LC_CPU_FEATURE_INTEL_AVX2 | LC_CPU_FEATURE_INTEL_PCLMUL)) {
 		hqc_kem_dec_selftest(lc_hqc_dec_avx2);
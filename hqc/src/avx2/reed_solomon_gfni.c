@@ -0,0 +1,400 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://pqc-hqc.org/
+ *
+ * The code is referenced as Public Domain
+ */
+/**
+ * @file reed_solomon_gfni.c
+ * @brief Constant time Reed-Solomon decoding using GFNI
+ *
+ * All polynomials of the decoder have at most 2 * PARAM_DELTA <= 64
+ * coefficients. They are stored bytewise in 256-bit registers and converted
+ * into the GFNI domain (see gf_gfni.h) so that one gf2p8mulb performs 32
+ * multiplications in GF(2^8). Only the error locator polynomial handed to the
+ * FFT and the final error values are converted back.
+ */
+
+#include "build_bug_on.h"
+#include "fft_avx2.h"
+#include "fft_gfni.h"
+#include "gf_avx2.h"
+#include "gf_gfni.h"
+#include "lc_memset_secure.h"
+#include "reed_solomon_gfni.h"
+
+#define LC_HQC_RS_GFNI_SYND_VEC LC_HQC_CEIL_DIVIDE(2 * LC_HQC_PARAM_DELTA, 32)
+#define LC_HQC_RS_GFNI_CDW_VEC LC_HQC_CEIL_DIVIDE(LC_HQC_PARAM_N1, 32)
+
+/* Byte lane index 0 ... 31 */
+static inline __m256i rs_gfni_lane_idx(void)
+{
+	return _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+				14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+				26, 27, 28, 29, 30, 31);
+}
+
+/* Mask of all byte lanes with an index smaller than n (n <= 32) */
+static inline __m256i rs_gfni_lane_mask(uint16_t n)
+{
+	return _mm256_cmpgt_epi8(_mm256_set1_epi8((char)n), rs_gfni_lane_idx());
+}
+
+/* Shift the bytes of a by one lane towards the higher index */
+static inline __m256i rs_gfni_shift1(__m256i a)
+{
+	return _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, 0x08), 15);
+}
+
+/**
+ * @brief Computes 2 * PARAM_DELTA syndromes in the GFNI domain
+ *
+ * Syndrome j is sum_i cdw[i] * alpha^((j + 1) * i). The powers are not taken
+ * from a table but obtained by multiplying the row of the previous i with
+ * alpha^(j + 1) in each lane j.
+ *
+ * @param[out] syndromes Array of size 32 * LC_HQC_RS_GFNI_SYND_VEC receiving
+ *			 the computed syndromes
+ * @param[in] cdw Array of size PARAM_N1 storing the received vector
+ */
+static void compute_syndromes(uint8_t *syndromes, const uint8_t *cdw)
+{
+	union {
+		uint8_t b[32 * LC_HQC_RS_GFNI_CDW_VEC];
+		__m256i v[LC_HQC_RS_GFNI_CDW_VEC];
+	} c = { 0 };
+	union {
+		uint8_t b[32 * LC_HQC_RS_GFNI_SYND_VEC];
+		__m256i v[LC_HQC_RS_GFNI_SYND_VEC];
+	} alpha;
+	__m256i row[LC_HQC_RS_GFNI_SYND_VEC], acc[LC_HQC_RS_GFNI_SYND_VEC];
+	size_t i, j;
+
+	memcpy(c.b, cdw, LC_HQC_PARAM_N1);
+	for (i = 0; i < LC_HQC_RS_GFNI_CDW_VEC; ++i)
+		c.v[i] = gf_to_gfni_vect(c.v[i]);
+
+	for (j = 0; j < sizeof(alpha.b); ++j)
+		alpha.b[j] = (uint8_t)gf_exp[j + 1];
+
+	for (j = 0; j < LC_HQC_RS_GFNI_SYND_VEC; ++j) {
+		alpha.v[j] = gf_to_gfni_vect(alpha.v[j]);
+		row[j] = _mm256_set1_epi8(1);
+		acc[j] = _mm256_setzero_si256();
+	}
+
+	for (i = 0; i < LC_HQC_PARAM_N1; ++i) {
+		__m256i c256 = _mm256_set1_epi8((char)c.b[i]);
+
+		for (j = 0; j < LC_HQC_RS_GFNI_SYND_VEC; ++j) {
+			acc[j] ^= _mm256_gf2p8mul_epi8(c256, row[j]);
+			row[j] = _mm256_gf2p8mul_epi8(row[j], alpha.v[j]);
+		}
+	}
+
+	for (j = 0; j < LC_HQC_RS_GFNI_SYND_VEC; ++j)
+		_mm256_storeu_si256((__m256i *)(syndromes + 32 * j), acc[j]);
+}
+
+/**
+ * @brief Computes the error locator polynomial (ELP) sigma
+ *
+ * This is the constant time Berlekamp's simplified algorithm of
+ * reed_solomon_avx2.c operating on all coefficients of sigma at once. The
+ * discrepancy d is the dot product of sigma with the window
+ * (S_{mu+1}, S_mu, ..., S_{mu+1-PARAM_DELTA}) of the syndromes which is
+ * loaded from the reversed syndromes.
+ *
+ * @returns the degree of the ELP sigma
+ * @param[out] sigma Array of PARAM_DELTA + 1 bytes receiving the ELP in the
+ *		     GFNI domain
+ * @param[in] syndromes Array of 2 * PARAM_DELTA syndromes in the GFNI domain
+ */
+static uint16_t compute_elp(uint8_t *sigma, const uint8_t *syndromes)
+{
+	uint8_t rev[2 * LC_HQC_PARAM_DELTA + 32] = { 0 };
+	__m256i keep = rs_gfni_lane_mask(LC_HQC_PARAM_DELTA + 1);
+	__m256i sigma256 = _mm256_set_epi64x(0, 0, 0, 1);
+	__m256i X_sigma_p256 = _mm256_set_epi64x(0, 0, 0, 0x100);
+	__m256i sigma_copy256, mask256;
+	uint16_t deg_sigma = 0;
+	uint16_t deg_sigma_p = 0;
+	uint16_t deg_sigma_copy = 0;
+	uint16_t pp = (uint16_t)-1; // 2*rho
+	uint16_t d_p = 1;
+	uint16_t d = syndromes[0];
+
+	uint16_t mask1, mask2, mask12;
+	uint16_t deg_X, deg_X_sigma_p;
+	uint16_t dd;
+	uint16_t mu;
+	size_t i;
+
+	for (i = 0; i < 2 * LC_HQC_PARAM_DELTA; ++i)
+		rev[i] = syndromes[2 * LC_HQC_PARAM_DELTA - 1 - i];
+
+	for (mu = 0; (mu < (2 * LC_HQC_PARAM_DELTA)); ++mu) {
+		// Save sigma in case we need it to update X_sigma_p
+		sigma_copy256 = sigma256;
+		deg_sigma_copy = deg_sigma;
+
+		dd = (uint16_t)_mm256_extract_epi8(
+			_mm256_gf2p8mul_epi8(
+				_mm256_set1_epi8((char)d),
+				gf_inverse_gfni_vect(
+					_mm256_set1_epi8((char)d_p))),
+			0);
+
+		/*
+		 * X_sigma_p has degree at most mu + 1 and PARAM_DELTA + 1
+		 * coefficients, the remaining lanes are zero.
+		 */
+		sigma256 ^= _mm256_gf2p8mul_epi8(_mm256_set1_epi8((char)dd),
+						 X_sigma_p256);
+
+		deg_X = mu - pp;
+		deg_X_sigma_p = deg_X + deg_sigma_p;
+
+		// mask1 = 0xffff if(d != 0) and 0 otherwise
+		mask1 = -((uint16_t)-d >> 15);
+
+		// mask2 = 0xffff if(deg_X_sigma_p > deg_sigma) and 0 otherwise
+		mask2 = -((uint16_t)(deg_sigma - deg_X_sigma_p) >> 15);
+
+		// mask12 = 0xffff if the deg_sigma increased and 0 otherwise
+		mask12 = mask1 & mask2;
+		deg_sigma ^= mask12 & (deg_X_sigma_p ^ deg_sigma);
+
+		if (mu == (2 * LC_HQC_PARAM_DELTA - 1)) {
+			break;
+		}
+
+		pp ^= mask12 & (mu ^ pp);
+		d_p ^= mask12 & (d ^ d_p);
+
+		mask256 = _mm256_set1_epi16((short)mask12);
+		X_sigma_p256 = (mask256 & sigma_copy256) ^
+			       _mm256_andnot_si256(mask256, X_sigma_p256);
+		X_sigma_p256 = rs_gfni_shift1(X_sigma_p256) & keep;
+
+		deg_sigma_p ^= mask12 & (deg_sigma_copy ^ deg_sigma_p);
+
+		/* Lane i of the window holds S_{mu+1-i} or 0 if mu+1-i < 0 */
+		d = gf_hsum_gfni_vect(_mm256_gf2p8mul_epi8(
+			sigma256,
+			_mm256_loadu_si256(
+				(const __m256i *)(rev + 2 * LC_HQC_PARAM_DELTA -
+						  2 - mu))));
+	}
+
+	_mm256_storeu_si256((__m256i *)sigma, sigma256);
+
+	return deg_sigma;
+}
+
+/**
+ * @brief Computes the polynomial z(x) in the GFNI domain
+ *
+ * z_i = sigma_i + S_{i-1} + sum_{j=1}^{i-1} sigma_j * S_{i-1-j} for
+ * i <= deg(sigma) and z_0 = 1 which equals
+ * sum_{j=0}^{PARAM_DELTA} sigma_j * (x^(j + 1) * S(x)) + sigma(x) truncated to
+ * deg(sigma) + 1 coefficients.
+ *
+ * @param[out] z Array of 32 bytes receiving the polynomial z(x)
+ * @param[in] sigma Array of 32 bytes storing the ELP
+ * @param[in] degree Integer that is the degree of polynomial sigma
+ * @param[in] syndromes Array of 2 * PARAM_DELTA storing the syndromes
+ */
+static void compute_z_poly(uint8_t *z, const uint8_t *sigma, uint16_t degree,
+			   const uint8_t *syndromes)
+{
+	uint8_t shifted[64] = { 0 };
+	__m256i z256 = _mm256_loadu_si256((const __m256i *)sigma);
+	size_t j;
+
+	memcpy(shifted + 32, syndromes, LC_HQC_PARAM_DELTA);
+
+	for (j = 0; j < LC_HQC_PARAM_DELTA; ++j) {
+		z256 ^= _mm256_gf2p8mul_epi8(
+			_mm256_set1_epi8((char)sigma[j]),
+			_mm256_loadu_si256(
+				(const __m256i *)(shifted + 32 - (j + 1))));
+	}
+
+	z256 &= rs_gfni_lane_mask((uint16_t)(degree + 1));
+	_mm256_storeu_si256((__m256i *)z, z256);
+}
+
+/**
+ * @brief Computes the error values
+ *
+ * See @cite lin1983error (Chapter 6 - BCH Codes) for more details. All
+ * PARAM_DELTA error values e_{j_i} are computed at once in the byte lanes.
+ *
+ * @param[out] error_values Array of PARAM_N1 elements receiving the error
+ *			    values
+ * @param[in] z Array of PARAM_DELTA + 1 elements storing the polynomial z(x) in
+ *		the GFNI domain
+ * @param[in] error Array of 2^PARAM_M elements storing the error positions
+ */
+static void compute_error_values(uint16_t *error_values, const uint8_t *z,
+				 const uint8_t *error)
+{
+	union {
+		uint8_t b[96];
+		__m256i v[3];
+	} beta_j = { 0 };
+	union {
+		uint8_t b[32];
+		__m256i v;
+	} e_j;
+	__m256i one = _mm256_set1_epi8(1);
+	__m256i inverse, inverse_power_j, tmp1, tmp2;
+	size_t i, j, k;
+
+	uint16_t delta_counter;
+	uint16_t delta_real_value;
+	uint16_t found;
+	uint16_t mask1;
+	uint16_t mask2;
+
+	// Compute the beta_{j_i} page 31 of the documentation
+	delta_counter = 0;
+	for (i = 0; i < LC_HQC_PARAM_N1; i++) {
+		found = 0;
+		mask1 = (uint16_t)(-((int32_t)error[i]) >> 31); // error[i] != 0
+		for (j = 0; j < LC_HQC_PARAM_DELTA; j++) {
+			mask2 = ~((uint16_t)(-((int32_t)j ^ delta_counter) >>
+					     31)); // j == delta_counter
+			beta_j.b[j] |= (uint8_t)(mask1 & mask2 & gf_exp[i]);
+			found += mask1 & mask2 & 1;
+		}
+		delta_counter += found;
+	}
+	delta_real_value = delta_counter;
+
+	/* Duplicate the betas to obtain beta_{(i + k) mod DELTA} by offset k */
+	memcpy(beta_j.b + LC_HQC_PARAM_DELTA, beta_j.b, LC_HQC_PARAM_DELTA);
+	for (i = 0; i < 3; ++i)
+		beta_j.v[i] = gf_to_gfni_vect(beta_j.v[i]);
+
+	// Compute the e_{j_i} page 31 of the documentation
+	inverse = gf_inverse_gfni_vect(beta_j.v[0]);
+	inverse_power_j = one;
+	tmp1 = one;
+	for (j = 1; j <= LC_HQC_PARAM_DELTA; ++j) {
+		inverse_power_j =
+			_mm256_gf2p8mul_epi8(inverse_power_j, inverse);
+		tmp1 ^= _mm256_gf2p8mul_epi8(inverse_power_j,
+					     _mm256_set1_epi8((char)z[j]));
+	}
+
+	tmp2 = one;
+	for (k = 1; k < LC_HQC_PARAM_DELTA; ++k) {
+		__m256i beta_k =
+			_mm256_loadu_si256((const __m256i *)(beta_j.b + k));
+
+		tmp2 = _mm256_gf2p8mul_epi8(
+			tmp2, one ^ _mm256_gf2p8mul_epi8(inverse, beta_k));
+	}
+
+	// i < delta_real_value
+	e_j.v = gf_from_gfni_vect(_mm256_gf2p8mul_epi8(
+			tmp1, gf_inverse_gfni_vect(tmp2))) &
+		rs_gfni_lane_mask(delta_real_value);
+
+	// Place the delta e_{j_i} values at the right coordinates of the output vector
+	delta_counter = 0;
+	for (i = 0; i < LC_HQC_PARAM_N1; ++i) {
+		found = 0;
+		mask1 = (uint16_t)(-((int32_t)error[i]) >> 31); // error[i] != 0
+		for (j = 0; j < LC_HQC_PARAM_DELTA; j++) {
+			mask2 = ~((uint16_t)(-((int32_t)j ^ delta_counter) >>
+					     31)); // j == delta_counter
+			error_values[i] +=
+				(uint16_t)(mask1 & mask2 & e_j.b[j]);
+			found += mask1 & mask2 & 1;
+		}
+		delta_counter += found;
+	}
+}
+
+/**
+ * @brief Decodes the received word
+ *
+ * This function follows the same six steps as reed_solomon_decode_avx2, see
+ * there for details.
+ *
+ * @param[out] msg Array of size VEC_K_SIZE_64 receiving the decoded message
+ * @param[in] cdw Array of size VEC_N1_SIZE_64 storing the received word
+ */
+void reed_solomon_decode_gfni(uint64_t *msg, uint64_t *cdw,
+			      struct reed_solomon_decode_ws *ws)
+{
+	uint8_t *syndromes = (uint8_t *)ws->syndromes256;
+	union {
+		uint8_t b[32];
+		__m256i v;
+	} sigma, sigma_hqc, z;
+	uint16_t w[1 << LC_HQC_PARAM_M];
+	uint16_t deg;
+	size_t i;
+
+	BUILD_BUG_ON(LC_HQC_PARAM_DELTA + 1 > 32);
+	BUILD_BUG_ON(sizeof(ws->syndromes256) < 32 * LC_HQC_RS_GFNI_SYND_VEC);
+
+	memset(ws->error, 0, sizeof(ws->error));
+	memset(ws->error_values, 0, sizeof(ws->error_values));
+
+	// Copy the vector in an array of bytes
+	memcpy(ws->cdw_bytes, cdw, LC_HQC_PARAM_N1);
+
+	// Calculate the 2*PARAM_DELTA syndromes
+	compute_syndromes(syndromes, ws->cdw_bytes);
+
+	// Compute the error locator polynomial sigma
+	deg = compute_elp(sigma.b, syndromes);
+
+	// Compute the error polynomial error
+	sigma_hqc.v = gf_from_gfni_vect(sigma.v);
+	for (i = 0; i <= LC_HQC_PARAM_DELTA; ++i)
+		ws->sigma[i] = sigma_hqc.b[i];
+	fft_gfni(w, ws->sigma, LC_HQC_PARAM_DELTA + 1);
+	fft_retrieve_error_poly_avx2(ws->error, w);
+
+	// Compute the polynomial z(x)
+	compute_z_poly(z.b, sigma.b, deg, syndromes);
+
+	// Compute the error values
+	compute_error_values(ws->error_values, z.b, ws->error);
+
+	// Correct the errors
+	for (i = 0; i < LC_HQC_PARAM_N1; ++i)
+		ws->cdw_bytes[i] ^= (uint8_t)ws->error_values[i];
+
+	// Retrieve the message from the decoded codeword
+	memcpy(msg, ws->cdw_bytes + (LC_HQC_PARAM_G - 1), LC_HQC_PARAM_K);
+
+	lc_memset_secure(w, 0, sizeof(w));
+	lc_memset_secure(&sigma, 0, sizeof(sigma));
+	lc_memset_secure(&sigma_hqc, 0, sizeof(sigma_hqc));
+	lc_memset_secure(&z, 0, sizeof(z));
+}
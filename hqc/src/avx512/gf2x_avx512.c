@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * The 1024 x 1024 bit base multiplication is derived in parts from the code
+ * distribution provided with https://github.com/awslabs/bike-kem
+ *
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0"
+ *
+ * Written by Nir Drucker, Shay Gueron and Dusan Kostic,
+ * AWS Cryptographic Algorithms Group.
+ */
+/**
+ * @file gf2x_avx512.c
+ * @brief AVX-512 / VPCLMULQDQ implementation of multiplication of two
+ *	  polynomials
+ */
+
+#include "ext_headers_x86.h"
+#include "gf2x_avx512.h"
+
+#define LC_HQC_QWORDS_IN_ZMM 8
+#define LC_HQC_QWORDS_IN_BASE (2 * LC_HQC_QWORDS_IN_ZMM)
+
+/**
+ * @brief Compute the four 128 x 128 bit products held in the 128-bit lanes of
+ *	  the registers a and b
+ */
+static inline void mul2_512(__m512i *h, __m512i *l, const __m512i a,
+			    const __m512i b)
+{
+	const __m512i mask_abq = _mm512_set_epi64(6, 7, 4, 5, 2, 3, 0, 1);
+	const __m512i s1 =
+		a ^ _mm512_permutex_epi64(a, _MM_SHUFFLE(2, 3, 0, 1));
+	const __m512i s2 =
+		b ^ _mm512_permutex_epi64(b, _MM_SHUFFLE(2, 3, 0, 1));
+	__m512i lq = _mm512_clmulepi64_epi128(a, b, 0x00);
+	__m512i hq = _mm512_clmulepi64_epi128(a, b, 0x11);
+	__m512i abq = lq ^ hq ^ _mm512_clmulepi64_epi128(s1, s2, 0x00);
+
+	abq = _mm512_permutexvar_epi64(mask_abq, abq);
+	*l = _mm512_mask_xor_epi64(lq, 0xaa, lq, abq);
+	*h = _mm512_mask_xor_epi64(hq, 0x55, hq, abq);
+}
+
+/**
+ * @brief Compute the 512 x 512 bit product zh || zl = a * b using Karatsuba
+ */
+static inline void mul8_512(__m512i *zh, __m512i *zl, const __m512i a,
+			    const __m512i b)
+{
+	const __m512i mask0 = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+	const __m512i mask1 = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+	const __m512i mask2 = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
+	const __m512i mask3 = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+	const __m512i mask4 = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+	const __m512i mask_s1 = _mm512_set_epi64(7, 6, 5, 4, 1, 0, 3, 2);
+	const __m512i mask_s2 = _mm512_set_epi64(3, 2, 7, 6, 5, 4, 1, 0);
+	__m512i xl, xh, xabl, xabh, xab, xab1, xab2, oxl, oxh;
+	__m512i yl, yh, yabl, yabh, yab;
+	__m512i t[4];
+
+	/*
+	 * Calculate:
+	 * AX1^AX3 || AX2^AX3 || AX0^AX2 || AX0^AX1
+	 * BX1^BX3 || BX2^BX3 || BX0^BX2 || BX0^BX1
+	 */
+	t[0] = _mm512_permutexvar_epi64(mask_s1, a) ^
+	       _mm512_permutexvar_epi64(mask_s2, a);
+	t[1] = _mm512_permutexvar_epi64(mask_s1, b) ^
+	       _mm512_permutexvar_epi64(mask_s2, b);
+
+	/*
+	 * Calculate:
+	 * Don't care || AX1^AX3^AX0^AX2
+	 * Don't care || BX1^BX3^BX0^BX2
+	 */
+	t[2] = t[0] ^ _mm512_alignr_epi64(t[0], t[0], 4);
+	t[3] = t[1] ^ _mm512_alignr_epi64(t[1], t[1], 4);
+
+	mul2_512(&xh, &xl, a, b);
+	mul2_512(&xabh, &xabl, t[0], t[1]);
+	mul2_512(&yabh, &yabl, t[2], t[3]);
+
+	xab = xl ^ xh ^ _mm512_permutex2var_epi64(xabl, mask0, xabh);
+	yl = _mm512_permutex2var_epi64(xl, mask3, xh);
+	yh = _mm512_permutex2var_epi64(xl, mask4, xh);
+	xab1 = _mm512_alignr_epi64(xab, xab, 6);
+	xab2 = _mm512_alignr_epi64(xab, xab, 2);
+	yl = _mm512_mask_xor_epi64(yl, 0x3c, yl, xab1);
+	yh = _mm512_mask_xor_epi64(yh, 0x3c, yh, xab2);
+
+	oxh = _mm512_permutex2var_epi64(xabl, mask1, xabh);
+	oxl = _mm512_alignr_epi64(oxh, oxh, 4);
+	yab = oxl ^ oxh ^ _mm512_permutex2var_epi64(yabl, mask0, yabh);
+	yab = _mm512_mask_xor_epi64(oxh, 0x3c, oxh,
+				    _mm512_alignr_epi64(yab, yab, 2));
+	yab ^= yl ^ yh;
+
+	/* Z0 (yl) + Z1 (yab) + Z2 (yh) */
+	yab = _mm512_permutexvar_epi64(mask2, yab);
+	*zl = _mm512_mask_xor_epi64(yl, 0xf0, yl, yab);
+	*zh = _mm512_mask_xor_epi64(yh, 0x0f, yh, yab);
+}
+
+/**
+ * @brief Compute the 1024 x 1024 bit product c = a * b using Karatsuba
+ *
+ * @param[out] c Pointer to the result of 32 64-bit words
+ * @param[in] a Pointer to the polynomial a(x) of 16 64-bit words
+ * @param[in] b Pointer to the polynomial b(x) of 16 64-bit words
+ */
+static inline void mul16_512(uint64_t *c, const uint64_t *a, const uint64_t *b)
+{
+	const __m512i a0 = _mm512_loadu_si512(a);
+	const __m512i a1 = _mm512_loadu_si512(a + LC_HQC_QWORDS_IN_ZMM);
+	const __m512i b0 = _mm512_loadu_si512(b);
+	const __m512i b1 = _mm512_loadu_si512(b + LC_HQC_QWORDS_IN_ZMM);
+	__m512i hi[2], lo[2], mi[2], m;
+
+	mul8_512(&lo[1], &lo[0], a0, b0);
+	mul8_512(&hi[1], &hi[0], a1, b1);
+	mul8_512(&mi[1], &mi[0], a0 ^ a1, b0 ^ b1);
+
+	m = lo[1] ^ hi[0];
+
+	_mm512_storeu_si512(c + 0 * LC_HQC_QWORDS_IN_ZMM, lo[0]);
+	_mm512_storeu_si512(c + 1 * LC_HQC_QWORDS_IN_ZMM, mi[0] ^ lo[0] ^ m);
+	_mm512_storeu_si512(c + 2 * LC_HQC_QWORDS_IN_ZMM, mi[1] ^ hi[1] ^ m);
+	_mm512_storeu_si512(c + 3 * LC_HQC_QWORDS_IN_ZMM, hi[1]);
+}
+
+/**
+ * @brief Compute o = a ^ b over len 64-bit words with len a multiple of 8
+ */
+static inline void xor_512(uint64_t *o, const uint64_t *a, const uint64_t *b,
+			   size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i += LC_HQC_QWORDS_IN_ZMM) {
+		_mm512_storeu_si512(o + i, _mm512_loadu_si512(a + i) ^
+						   _mm512_loadu_si512(b + i));
+	}
+}
+
+/**
+ * @brief Compute c(x) = a(x) * b(x) using Karatsuba
+ *
+ * The operands are split into a lower half of size h and an upper half of
+ * size n - h where h is rounded up to a multiple of the base multiplication
+ * size. This allows operand sizes that are not a power of two multiple of the
+ * base multiplication without padding them to the next power of two.
+ *
+ * @param[out] c Pointer to the result of 2 * n 64-bit words
+ * @param[in] a Pointer to the polynomial a(x) of n 64-bit words
+ * @param[in] b Pointer to the polynomial b(x) of n 64-bit words
+ * @param[in] n Size of the operands in 64-bit words - it must be a multiple of
+ *		LC_HQC_QWORDS_IN_BASE
+ * @param[in] stack Scratch memory of at least 4 * n + 512 64-bit words
+ */
+static void karat_mult_avx512(uint64_t *c, const uint64_t *a,
+			      const uint64_t *b, size_t n, uint64_t *stack)
+{
+	uint64_t *aa, *bb, *d1;
+	size_t h, l;
+
+	if (n == LC_HQC_QWORDS_IN_BASE) {
+		mul16_512(c, a, b);
+		return;
+	}
+
+	h = ((n >> 1) + LC_HQC_QWORDS_IN_BASE - 1) &
+	    ~(size_t)(LC_HQC_QWORDS_IN_BASE - 1);
+	l = n - h;
+	aa = stack;
+	bb = aa + h;
+	d1 = bb + h;
+
+	/* D0 = A0 * B0 and D2 = A1 * B1 are stored in place */
+	karat_mult_avx512(c, a, b, h, d1 + 2 * h);
+	karat_mult_avx512(c + 2 * h, a + h, b + h, l, d1 + 2 * h);
+
+	/* D1 = (A0 + A1) * (B0 + B1) */
+	xor_512(aa, a, a + h, l);
+	xor_512(bb, b, b + h, l);
+	memcpy(aa + l, a + l, (h - l) * sizeof(uint64_t));
+	memcpy(bb + l, b + l, (h - l) * sizeof(uint64_t));
+	karat_mult_avx512(d1, aa, bb, h, d1 + 2 * h);
+
+	/* C = D0 + (D1 - D0 - D2) X^h + D2 X^2h */
+	xor_512(d1, d1, c, 2 * h);
+	xor_512(d1, d1, c + 2 * h, 2 * l);
+	xor_512(c + h, c + h, d1, 2 * h);
+}
+
+/**
+ * @brief Compute o(x) = a(x) mod \f$ X^n - 1\f$
+ *
+ * This function computes the modular reduction of the polynomial a(x)
+ *
+ * @param[out] o Pointer to the result
+ * @param[in] a Pointer to the polynomial a(x)
+ */
+static inline void reduce(uint64_t *o, const uint64_t *a)
+{
+	const __m128i dec64 = _mm_cvtsi32_si128(LC_HQC_PARAM_N & 0x3f);
+	const __m128i d0 = _mm_cvtsi32_si128(64 - (LC_HQC_PARAM_N & 0x3f));
+	__m512i r, carry;
+	size_t i;
+
+	for (i = 0; i + LC_HQC_QWORDS_IN_ZMM <= LC_HQC_VEC_N_SIZE_64;
+	     i += LC_HQC_QWORDS_IN_ZMM) {
+		r = _mm512_srl_epi64(
+			_mm512_loadu_si512(a + i + LC_HQC_VEC_N_SIZE_64 - 1),
+			dec64);
+		carry = _mm512_sll_epi64(
+			_mm512_loadu_si512(a + i + LC_HQC_VEC_N_SIZE_64), d0);
+		_mm512_storeu_si512(o + i, _mm512_loadu_si512(a + i) ^ r ^ carry);
+	}
+
+	for (; i < LC_HQC_VEC_N_SIZE_64; i++) {
+		o[i] = a[i] ^
+		       (a[i + LC_HQC_VEC_N_SIZE_64 - 1] >>
+			(LC_HQC_PARAM_N & 0x3f)) ^
+		       (a[i + LC_HQC_VEC_N_SIZE_64]
+			<< (64 - (LC_HQC_PARAM_N & 0x3f)));
+	}
+
+	o[LC_HQC_VEC_N_SIZE_64 - 1] &= LC_HQC_RED_MASK;
+}
+
+/**
+ * @brief Multiply two polynomials modulo \f$ X^n - 1\f$.
+ *
+ * This functions multiplies the polynomials <b>a1</b> and <b>a2</b> of
+ * LC_HQC_VEC_N_SIZE_64 64-bit words each. The multiplication is done modulo
+ * \f$ X^n - 1\f$. The caller must enable the FPU.
+ *
+ * @param[out] o Pointer to the result of LC_HQC_VEC_N_SIZE_64 64-bit words
+ * @param[in] a1 Pointer to a polynomial
+ * @param[in] a2 Pointer to a polynomial
+ */
+void vect_mul_avx512(uint64_t *o, const uint64_t *a1, const uint64_t *a2,
+		     struct vect_mul_avx512_ws *ws)
+{
+	memcpy(ws->a1, a1, LC_HQC_VEC_N_SIZE_64 * sizeof(uint64_t));
+	memset(ws->a1 + LC_HQC_VEC_N_SIZE_64, 0,
+	       (LC_HQC_VEC_N_1024_SIZE_64 - LC_HQC_VEC_N_SIZE_64) *
+		       sizeof(uint64_t));
+	memcpy(ws->a2, a2, LC_HQC_VEC_N_SIZE_64 * sizeof(uint64_t));
+	memset(ws->a2 + LC_HQC_VEC_N_SIZE_64, 0,
+	       (LC_HQC_VEC_N_1024_SIZE_64 - LC_HQC_VEC_N_SIZE_64) *
+		       sizeof(uint64_t));
+
+	karat_mult_avx512(ws->a1_times_a2, ws->a1, ws->a2,
+			  LC_HQC_VEC_N_1024_SIZE_64, ws->stack);
+	reduce(o, ws->a1_times_a2);
+}
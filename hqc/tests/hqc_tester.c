@@ -149,8 +149,6 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	int ret = 0;
 	LC_DECLARE_MEM(ws, struct workspace, LC_HQC_ALIGN_BYTES);
 
-	(void)argv;
-
 #ifdef LC_FIPS140_DEBUG
 	/*
 	 * Both algos are used for the random number generation as part of
@@ -176,8 +174,21 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 #endif
 
 	/* Disable any accelerations when there is one parameter */
-	if (argc > 1)
-		lc_cpu_feature_disable();
+	if (argc > 1) {
+		/* Force the AVX2 implementation on AVX-512 capable systems */
+		if (argv[1][0] == 'a') {
+			if (!(lc_cpu_feature_available() &
+			      LC_CPU_FEATURE_INTEL_AVX2)) {
+				LC_RELEASE_MEM(ws);
+				return 77;
+			}
+			lc_cpu_feature_set(LC_CPU_FEATURE_INTEL |
+					   LC_CPU_FEATURE_INTEL_AVX2 |
+					   LC_CPU_FEATURE_INTEL_PCLMUL);
+		} else {
+			lc_cpu_feature_disable();
+		}
+	}
 
 	for (i = 0; i < count; i++) {
 		ret = hqc_tester_one(&hqc_test[i], ws);
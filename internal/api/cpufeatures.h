@@ -37,6 +37,8 @@ enum lc_cpu_features {
 	LC_CPU_FEATURE_INTEL_PCLMUL = 1 << 6,
 	LC_CPU_FEATURE_INTEL_SHANI = 1 << 7,
 	LC_CPU_FEATURE_INTEL_SHANI512 = 1 << 8,
+	LC_CPU_FEATURE_INTEL_GFNI = 1 << 9,
+	LC_CPU_FEATURE_INTEL_AVX512IFMA = 1 << 23,
 
 	/* ARM-specific */
 	LC_CPU_FEATURE_ARM = 1 << 10,
@@ -40,6 +40,8 @@
 /* Leaf 7, subleaf 0 of CPUID */
 #define LC_INTEL_AVX2_EBX (1 << 5)
 #define LC_INTEL_AVX512F_EBX (1 << 16)
+#define LC_INTEL_AVX512IFMA_EBX (1 << 21)
+#define LC_INTEL_GFNI_ECX (1 << 8)
 #define LC_INTEL_VPCLMUL_ECX (1 << 10)
 #define LC_INTEL_PCLMUL_ECX (1 << 1)
 #define LC_INTEL_SHANI_EBX (1 << 29)
@@ -118,9 +120,15 @@ LC_INTERFACE_FUNCTION(enum lc_cpu_features, lc_cpu_feature_available, void)
 	if (ebx & LC_INTEL_AVX512F_EBX)
 		feat |= LC_CPU_FEATURE_INTEL_AVX512;
 
+	if ((ebx & LC_INTEL_AVX512F_EBX) && (ebx & LC_INTEL_AVX512IFMA_EBX))
+		feat |= LC_CPU_FEATURE_INTEL_AVX512IFMA;
+
 	if (ecx & LC_INTEL_VPCLMUL_ECX)
 		feat |= LC_CPU_FEATURE_INTEL_VPCLMUL;
 
+	if (ecx & LC_INTEL_GFNI_ECX)
+		feat |= LC_CPU_FEATURE_INTEL_GFNI;
+
 	if (ebx & LC_INTEL_SHANI_EBX)
 		feat |= LC_CPU_FEATURE_INTEL_SHANI;
 
@@ -22,11 +22,13 @@
 #define _DEFAULT_SOURCE
 #endif
 
+#include "atomic.h"
 #include "build_bug_on.h"
 #include "ext_headers_internal.h"
 #include "lc_hash.h"
 #include "lc_memory_support.h"
 #include "lc_memset_secure.h"
+#include "mutex_w.h"
 #include "visibility.h"
 
 #define LC_MEM_DEF_ALIGNED_OFFSET 32
@@ -51,6 +53,290 @@ static int lc_alloc_have_memfd_secret = 1;
 static int lc_alloc_have_memfd_secret = 0;
 #endif
 
+/*
+ * Slab allocator for secure memory
+ *
+ * Secure memory allocations of up to LC_MEM_SLAB_MAX_SIZE bytes are carved out
+ * of chunks of LC_MEM_SLAB_CHUNK_SIZE bytes which are obtained with
+ * memfd_secret or are mlocked. This avoids the system calls and the file
+ * descriptor per allocation. The objects are managed in size classes of
+ * powers of two. Freed objects are zeroized and kept in free lists for reuse,
+ * the chunks are never returned to the kernel.
+ *
+ * Each thread uses its own shard of free lists assigned to the thread on its
+ * first allocation. Shards are not bound to the lifetime of a thread, objects
+ * freed by a terminated thread stay available to the other threads of the
+ * shard.
+ *
+ * A fork is detected with a page that is wiped in the child. The child
+ * discards all free lists and allocates new chunks as the memfd_secret chunks
+ * are shared with the parent. Objects inherited from the parent are not
+ * reused after being freed.
+ */
+#define LC_MEM_SLAB_MIN_SHIFT 6
+/* 64 bytes to 16 kBytes including the header */
+#define LC_MEM_SLAB_CLASSES 9
+#define LC_MEM_SLAB_MAX_SIZE                                                   \
+	(1UL << (LC_MEM_SLAB_MIN_SHIFT + LC_MEM_SLAB_CLASSES - 1))
+#define LC_MEM_SLAB_CHUNK_SIZE (1UL << 16)
+#define LC_MEM_SLAB_SHARDS 16
+
+/* Marker in struct lc_mem_def for objects of the slab allocator */
+#define LC_MEM_DEF_FD_SLAB (-2)
+
+struct lc_mem_slab_obj {
+	struct lc_mem_slab_obj *next;
+};
+
+struct lc_mem_slab_shard {
+	mutex_w_t lock;
+	struct lc_mem_slab_obj *free[LC_MEM_SLAB_CLASSES];
+};
+
+struct lc_mem_slab_chunk {
+	uint8_t *cur;
+	size_t avail;
+};
+
+static struct lc_mem_slab_shard lc_mem_slab_shards[LC_MEM_SLAB_SHARDS];
+static struct lc_mem_slab_chunk lc_mem_slab_chunks[LC_MEM_SLAB_CLASSES];
+static DEFINE_MUTEX_W_UNLOCKED(lc_mem_slab_chunk_lock);
+static atomic_t lc_mem_slab_next_shard = ATOMIC_INIT(0);
+static atomic_t lc_mem_slab_state = ATOMIC_INIT(0);
+#define LC_MEM_SLAB_STATE_UNINIT 0
+#define LC_MEM_SLAB_STATE_BUSY 1
+#define LC_MEM_SLAB_STATE_READY 2
+#define LC_MEM_SLAB_STATE_DISABLED 3
+static volatile uint8_t *lc_mem_slab_fork_canary;
+static size_t lc_mem_slab_generation;
+static __thread unsigned int lc_mem_slab_thread_shard;
+
+static void lc_mem_slab_reset(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < LC_MEM_SLAB_SHARDS; i++) {
+		mutex_w_init(&lc_mem_slab_shards[i].lock, false);
+		memset(lc_mem_slab_shards[i].free, 0,
+		       sizeof(lc_mem_slab_shards[i].free));
+	}
+	mutex_w_init(&lc_mem_slab_chunk_lock, false);
+	memset(lc_mem_slab_chunks, 0, sizeof(lc_mem_slab_chunks));
+	lc_mem_slab_generation++;
+}
+
+/*
+ * Page whose content is zero in a forked child process
+ */
+static void *lc_mem_slab_canary_alloc(void)
+{
+#ifdef MADV_WIPEONFORK
+	size_t pagesize = (size_t)sysconf(_SC_PAGESIZE);
+	void *page = mmap(NULL, pagesize, PROT_READ | PROT_WRITE,
+			  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (page == MAP_FAILED)
+		return NULL;
+
+	if (madvise(page, pagesize, MADV_WIPEONFORK)) {
+		munmap(page, pagesize);
+		return NULL;
+	}
+
+	return page;
+#else
+	/* Without fork detection, the slab allocator cannot be used */
+	return NULL;
+#endif
+}
+
+/*
+ * Returns true if the slab allocator is usable. The allocator is set up at
+ * the first invocation and after a fork.
+ */
+static int lc_mem_slab_ready(void)
+{
+	void *page;
+
+	for (;;) {
+		switch (atomic_read(&lc_mem_slab_state)) {
+		case LC_MEM_SLAB_STATE_READY:
+			if (*lc_mem_slab_fork_canary)
+				return 1;
+
+			/* Process was forked */
+			if (atomic_cmpxchg(&lc_mem_slab_state,
+					   LC_MEM_SLAB_STATE_READY,
+					   LC_MEM_SLAB_STATE_BUSY) !=
+			    LC_MEM_SLAB_STATE_READY)
+				continue;
+			lc_mem_slab_reset();
+			*lc_mem_slab_fork_canary = 1;
+			atomic_set(&lc_mem_slab_state,
+				   LC_MEM_SLAB_STATE_READY);
+			return 1;
+
+		case LC_MEM_SLAB_STATE_UNINIT:
+			if (atomic_cmpxchg(&lc_mem_slab_state,
+					   LC_MEM_SLAB_STATE_UNINIT,
+					   LC_MEM_SLAB_STATE_BUSY) !=
+			    LC_MEM_SLAB_STATE_UNINIT)
+				continue;
+
+			page = lc_mem_slab_canary_alloc();
+			if (!page) {
+				atomic_set(&lc_mem_slab_state,
+					   LC_MEM_SLAB_STATE_DISABLED);
+				return 0;
+			}
+
+			lc_mem_slab_fork_canary = page;
+			*lc_mem_slab_fork_canary = 1;
+			lc_mem_slab_reset();
+			atomic_set(&lc_mem_slab_state,
+				   LC_MEM_SLAB_STATE_READY);
+			return 1;
+
+		case LC_MEM_SLAB_STATE_BUSY:
+			/* Another thread sets up the allocator */
+			continue;
+
+		default:
+			return 0;
+		}
+	}
+}
+
+static struct lc_mem_slab_shard *lc_mem_slab_shard(void)
+{
+	if (!lc_mem_slab_thread_shard) {
+		lc_mem_slab_thread_shard =
+			((unsigned int)atomic_inc(&lc_mem_slab_next_shard) %
+			 LC_MEM_SLAB_SHARDS) +
+			1;
+	}
+
+	return &lc_mem_slab_shards[lc_mem_slab_thread_shard - 1];
+}
+
+static void *lc_mem_slab_chunk_alloc(void)
+{
+	void *chunk;
+
+#ifdef LC_USE_MEMFD_SECURE
+	if (lc_alloc_have_memfd_secret) {
+		int fd = (int)syscall(SYS_memfd_secret, O_CLOEXEC);
+
+		if (fd != -1) {
+			chunk = MAP_FAILED;
+			if (ftruncate(fd, (off_t)LC_MEM_SLAB_CHUNK_SIZE) != -1)
+				chunk = mmap(NULL, LC_MEM_SLAB_CHUNK_SIZE,
+					     PROT_READ | PROT_WRITE, MAP_SHARED,
+					     fd, 0);
+
+			/* The mapping keeps the secret memory alive */
+			close(fd);
+			if (chunk != MAP_FAILED)
+				return chunk;
+		}
+	}
+#endif
+
+	chunk = mmap(NULL, LC_MEM_SLAB_CHUNK_SIZE, PROT_READ | PROT_WRITE,
+		     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (chunk == MAP_FAILED)
+		return NULL;
+
+	/* prevent paging out of the memory state to swap space */
+	if (mlock(chunk, LC_MEM_SLAB_CHUNK_SIZE) && errno != EPERM &&
+	    errno != EAGAIN && errno != ENOMEM) {
+		munmap(chunk, LC_MEM_SLAB_CHUNK_SIZE);
+		return NULL;
+	}
+
+	return chunk;
+}
+
+/*
+ * Allocate an object from the slab allocator, returns 1 if the allocation
+ * was served.
+ */
+static int lc_mem_slab_alloc(void **memptr, size_t alignment, size_t size)
+{
+	struct lc_mem_slab_shard *shard;
+	struct lc_mem_slab_chunk *chunk;
+	struct lc_mem_slab_obj *obj;
+	struct lc_mem_def *mem;
+	size_t full_size = LC_MEM_DEF_ALIGNED_OFFSET + size, obj_size;
+	unsigned int cls = 0;
+
+	/* Objects are aligned to LC_MEM_DEF_ALIGNED_OFFSET */
+	if (full_size > LC_MEM_SLAB_MAX_SIZE ||
+	    alignment > LC_MEM_DEF_ALIGNED_OFFSET || !lc_mem_slab_ready())
+		return 0;
+
+	while ((1UL << (LC_MEM_SLAB_MIN_SHIFT + cls)) < full_size)
+		cls++;
+	obj_size = 1UL << (LC_MEM_SLAB_MIN_SHIFT + cls);
+
+	shard = lc_mem_slab_shard();
+	mutex_w_lock(&shard->lock);
+	obj = shard->free[cls];
+	if (obj)
+		shard->free[cls] = obj->next;
+	mutex_w_unlock(&shard->lock);
+
+	if (!obj) {
+		chunk = &lc_mem_slab_chunks[cls];
+
+		mutex_w_lock(&lc_mem_slab_chunk_lock);
+		if (chunk->avail < obj_size) {
+			chunk->cur = lc_mem_slab_chunk_alloc();
+			chunk->avail = chunk->cur ? LC_MEM_SLAB_CHUNK_SIZE : 0;
+		}
+		if (chunk->cur) {
+			obj = (struct lc_mem_slab_obj *)chunk->cur;
+			chunk->cur += obj_size;
+			chunk->avail -= obj_size;
+		}
+		mutex_w_unlock(&lc_mem_slab_chunk_lock);
+
+		if (!obj)
+			return 0;
+	}
+
+	/*
+	 * The object memory is zero as it is either fresh from the kernel or
+	 * zeroized when freed, except for the free list pointer in the header.
+	 */
+	mem = (struct lc_mem_def *)obj;
+	mem->fd = LC_MEM_DEF_FD_SLAB;
+	mem->size = cls | (lc_mem_slab_generation << 8);
+	*memptr = ((uint8_t *)mem) + LC_MEM_DEF_ALIGNED_OFFSET;
+
+	return 1;
+}
+
+static void lc_mem_slab_free(struct lc_mem_def *mem)
+{
+	struct lc_mem_slab_shard *shard;
+	struct lc_mem_slab_obj *obj = (struct lc_mem_slab_obj *)mem;
+	unsigned int cls = (unsigned int)(mem->size & 0xff);
+
+	/* Do not reuse objects shared with the parent process */
+	if (!lc_mem_slab_ready() ||
+	    (mem->size >> 8) != lc_mem_slab_generation)
+		return;
+
+	lc_memset_secure(mem, 0, 1UL << (LC_MEM_SLAB_MIN_SHIFT + cls));
+
+	shard = lc_mem_slab_shard();
+	mutex_w_lock(&shard->lock);
+	obj->next = shard->free[cls];
+	shard->free[cls] = obj;
+	mutex_w_unlock(&shard->lock);
+}
+
 static int alloc_aligned_secure_internal(void **memptr, size_t alignment,
 					 size_t size, int secure)
 {
@@ -100,6 +386,9 @@ LC_INTERFACE_FUNCTION(int, lc_alloc_aligned_secure, void **memptr,
 	size_t full_size = LC_MEM_DEF_ALIGNED_OFFSET + size;
 	int fd;
 
+	if (lc_mem_slab_alloc(memptr, alignment, size))
+		return 0;
+
 	if (!lc_alloc_have_memfd_secret)
 		return alloc_aligned_secure_internal(memptr, alignment, size,
 						     1);
@@ -137,6 +426,9 @@ err:
 LC_INTERFACE_FUNCTION(int, lc_alloc_aligned_secure, void **memptr,
 		      size_t alignment, size_t size)
 {
+	if (lc_mem_slab_alloc(memptr, alignment, size))
+		return 0;
+
 	return alloc_aligned_secure_internal(memptr, alignment, size, 1);
 }
 
@@ -167,6 +459,11 @@ static void lc_free_internal(void *ptr, int secure)
 	size = mem->size;
 	fd = mem->fd;
 
+	if (fd == LC_MEM_DEF_FD_SLAB) {
+		lc_mem_slab_free(mem);
+		return;
+	}
+
 	if (secure)
 		lc_memset_secure(mem, 0, size);
 
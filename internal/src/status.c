@@ -130,19 +130,19 @@ LC_INTERFACE_FUNCTION(int, lc_status, char *outbuf, size_t outlen)
 		 " ML-DSA: %s%s%s%s%s\n"
 #endif
 #ifdef LC_SPHINCS
-		 " SLH-DSA: %s%s\n"
+		 " SLH-DSA: %s%s%s\n"
 #endif
 #ifdef LC_BIKE
 		 " BIKE: %s%s\n"
 #endif
 #ifdef LC_HQC
-		 " HQC: %s\n"
+		 " HQC: %s%s%s\n"
 #endif
 #ifdef LC_CURVE25519
-		 " Curve25519: %s%s%s\n"
+		 " Curve25519: %s%s%s%s\n"
 #endif
 #ifdef LC_CURVE448
-		 " Curve448: %s\n"
+		 " Curve448: %s%s\n"
 #endif
 		 ,
 		 fips140_mode_enabled() ? "yes" : "no"
@@ -167,8 +167,9 @@ LC_INTERFACE_FUNCTION(int, lc_status, char *outbuf, size_t outlen)
 		 (lc_sha256_shani && lc_sha256_shani != lc_sha256_c) ?
 			 "SHANI " :
 			 "",
-		 (lc_sha256_avx2 && lc_sha256_avx2 != lc_sha256_c) ? "AVX2 " :
-								     "",
+		 (lc_sha256_avx2 && lc_sha256_avx2 != lc_sha256_c) ?
+			 "AVX2 AVX2-8x " :
+			 "",
 		 (lc_sha256_arm_ce && lc_sha256_arm_ce != lc_sha256_c) ?
 			 "ARM-CE " :
 			 "",
@@ -269,6 +270,9 @@ LC_INTERFACE_FUNCTION(int, lc_status, char *outbuf, size_t outlen)
 		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) ?
 			 "AVX2" :
 			 "",
+		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX512) ?
+			 "AVX512" :
+			 "",
 		 armv8
 #endif /* LC_DILITHIUM */
 
@@ -287,6 +291,13 @@ LC_INTERFACE_FUNCTION(int, lc_status, char *outbuf, size_t outlen)
 		 ,
 		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) ?
 			 "AVX2" :
+			 "",
+		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX512) ?
+			 "AVX512" :
+			 "",
+		 ((lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) &&
+		  (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_GFNI)) ?
+			 "GFNI" :
 			 ""
 #endif /* LC_HQC */
 
@@ -296,6 +307,9 @@ LC_INTERFACE_FUNCTION(int, lc_status, char *outbuf, size_t outlen)
 		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) ?
 			 "AVX2" :
 			 "",
+		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX512IFMA) ?
+			 "AVX512IFMA" :
+			 "",
 		 armv7, armv8
 #endif /* LC_CURVE25519 */
 
@@ -304,6 +318,9 @@ LC_INTERFACE_FUNCTION(int, lc_status, char *outbuf, size_t outlen)
 		 ,
 		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX2) ?
 			 "AVX2" :
+			 "",
+		 (lc_cpu_feature_available() & LC_CPU_FEATURE_INTEL_AVX512) ?
+			 "AVX512" :
 			 ""
 #endif /* LC_CURVE448 */
 	);
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#include "ext_headers_internal.h"
+#include "helper.h"
+#include "lc_memory_support.h"
+#include "ret_checkers.h"
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#endif
+
+#define MEMORY_SECURE_OBJECTS 4096
+
+static int memory_secure_zero(const uint8_t *ptr, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		if (ptr[i])
+			return 0;
+	}
+
+	return 1;
+}
+
+/*
+ * Allocate, use and release secure memory of the given size twice - the
+ * second allocation may reuse the memory of the first one which must be
+ * zeroized.
+ */
+static int memory_secure_size(size_t size)
+{
+	uint8_t *ptr = NULL;
+	unsigned int i;
+	int ret = 0;
+
+	for (i = 0; i < 2; i++) {
+		CKINT(lc_alloc_aligned_secure((void **)&ptr,
+					      LC_MEM_COMMON_ALIGNMENT, size));
+		CKNULL(ptr, -EFAULT);
+
+		if (!lc_mem_aligned(ptr, LC_MEM_COMMON_ALIGNMENT - 1)) {
+			printf("Secure memory of size %zu not aligned\n", size);
+			ret = -EFAULT;
+			goto out;
+		}
+
+		if (!memory_secure_zero(ptr, size)) {
+			printf("Secure memory of size %zu not zeroized\n",
+			       size);
+			ret = -EFAULT;
+			goto out;
+		}
+
+		memset(ptr, 0xff, size);
+		lc_free(ptr);
+		ptr = NULL;
+	}
+
+out:
+	lc_free(ptr);
+	return ret;
+}
+
+/*
+ * Allocate many objects at the same time, they must not overlap.
+ */
+static int memory_secure_many(void)
+{
+	uint32_t *ptr[MEMORY_SECURE_OBJECTS] = { 0 };
+	unsigned int i, j;
+	int ret = 0;
+
+	for (i = 0; i < MEMORY_SECURE_OBJECTS; i++) {
+		size_t words = (i % 64) + 1;
+
+		CKINT(lc_alloc_aligned_secure((void **)&ptr[i],
+					      LC_MEM_COMMON_ALIGNMENT,
+					      words * sizeof(uint32_t)));
+		for (j = 0; j < words; j++)
+			ptr[i][j] = i;
+	}
+
+	for (i = 0; i < MEMORY_SECURE_OBJECTS; i++) {
+		size_t words = (i % 64) + 1;
+
+		for (j = 0; j < words; j++) {
+			if (ptr[i][j] != i) {
+				printf("Secure memory object %u overwritten\n",
+				       i);
+				ret = -EFAULT;
+				goto out;
+			}
+		}
+	}
+
+out:
+	for (i = 0; i < MEMORY_SECURE_OBJECTS; i++)
+		lc_free(ptr[i]);
+	return ret;
+}
+
+#if defined(__linux__)
+/*
+ * Memory allocated in a child process must not overlap with memory of the
+ * parent process - the memfd_secret memory is shared between both.
+ */
+static int memory_secure_fork(void)
+{
+	uint8_t *ptr = NULL, *child_ptr;
+	pid_t pid;
+	int ret = 0, status;
+
+	CKINT(lc_alloc_aligned_secure((void **)&ptr, LC_MEM_COMMON_ALIGNMENT,
+				      64));
+	memset(ptr, 0x5a, 64);
+
+	/* Free object which may be handed out again to the child */
+	CKINT(lc_alloc_aligned_secure((void **)&child_ptr,
+				      LC_MEM_COMMON_ALIGNMENT, 64));
+	lc_free(child_ptr);
+
+	pid = fork();
+	if (pid < 0) {
+		ret = -errno;
+		goto out;
+	}
+
+	if (!pid) {
+		if (lc_alloc_aligned_secure((void **)&child_ptr,
+					    LC_MEM_COMMON_ALIGNMENT, 64))
+			_exit(1);
+		/* Leave the data behind */
+		memset(child_ptr, 0xa5, 64);
+		_exit(0);
+	}
+
+	if (waitpid(pid, &status, 0) < 0) {
+		ret = -errno;
+		goto out;
+	}
+	if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+		printf("Secure memory allocation in child failed\n");
+		ret = -EFAULT;
+		goto out;
+	}
+
+	if (ptr[0] != 0x5a || ptr[63] != 0x5a) {
+		printf("Secure memory modified by child\n");
+		ret = -EFAULT;
+		goto out;
+	}
+
+	CKINT(lc_alloc_aligned_secure((void **)&child_ptr,
+				      LC_MEM_COMMON_ALIGNMENT, 64));
+	if (!memory_secure_zero(child_ptr, 64)) {
+		printf("Secure memory of child used by parent\n");
+		ret = -EFAULT;
+	}
+	lc_free(child_ptr);
+
+out:
+	lc_free(ptr);
+	return ret;
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+	static const size_t sizes[] = { 1,    31,   32,    100,   1000,
+					4000, 4096, 16352, 16353, 100000 };
+	unsigned int i;
+	int ret = 0;
+
+	(void)argc;
+	(void)argv;
+
+	for (i = 0; i < ARRAY_SIZE(sizes); i++)
+		CKINT(memory_secure_size(sizes[i]));
+
+	CKINT(memory_secure_many());
+
+#if defined(__linux__)
+	CKINT(memory_secure_fork());
+#endif
+
+out:
+	return ret ? 1 : 0;
+}
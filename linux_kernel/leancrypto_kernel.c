@@ -39,6 +39,8 @@ EXPORT_SYMBOL(lc_disable_selftest);
 EXPORT_SYMBOL(crypto_scalarmult_curve25519);
 EXPORT_SYMBOL(crypto_scalarmult_curve25519_base);
 EXPORT_SYMBOL(lc_x25519_keypair);
+EXPORT_SYMBOL(lc_x25519_keypair_batch);
+EXPORT_SYMBOL(lc_x25519_ss_batch);
 #endif /* LC_CURVE25519 */
 #if (defined(LC_KYBER_X25519_KEM) || defined(LC_DILITHIUM_ED25519_SIG))
 EXPORT_SYMBOL(crypto_scalarmult_curve25519_c);
@@ -130,6 +130,7 @@ extern "C" {
 #define lc_dilithium_ed25519_sign_update DILITHIUM_F(ed25519_sign_update)
 #define lc_dilithium_ed25519_sign_final DILITHIUM_F(ed25519_sign_final)
 #define lc_dilithium_ed25519_verify DILITHIUM_F(ed25519_verify)
+#define lc_dilithium_ed25519_verify_batch DILITHIUM_F(ed25519_verify_batch)
 #define lc_dilithium_ed25519_verify_ctx DILITHIUM_F(ed25519_verify_ctx)
 #define lc_dilithium_ed25519_verify_init DILITHIUM_F(ed25519_verify_init)
 #define lc_dilithium_ed25519_verify_update DILITHIUM_F(ed25519_verify_update)
@@ -145,6 +146,7 @@ extern "C" {
 #define lc_dilithium_ed448_sign_update DILITHIUM_F(ed448_sign_update)
 #define lc_dilithium_ed448_sign_final DILITHIUM_F(ed448_sign_final)
 #define lc_dilithium_ed448_verify DILITHIUM_F(ed448_verify)
+#define lc_dilithium_ed448_verify_batch DILITHIUM_F(ed448_verify_batch)
 #define lc_dilithium_ed448_verify_ctx DILITHIUM_F(ed448_verify_ctx)
 #define lc_dilithium_ed448_verify_init DILITHIUM_F(ed448_verify_init)
 #define lc_dilithium_ed448_verify_update DILITHIUM_F(ed448_verify_update)
@@ -1205,6 +1205,32 @@ int lc_dilithium_ed25519_verify(const struct lc_dilithium_ed25519_sig *sig,
 				const uint8_t *m, size_t mlen,
 				const struct lc_dilithium_ed25519_pk *pk);
 
+/**
+ * @ingroup HybridDilithium
+ * @brief Verifies multiple signatures in one shot
+ *
+ * Each signature is verified as with \p lc_dilithium_ed25519_verify. The
+ * ML-DSA parts are verified one after another while the ED25519 parts are
+ * verified together with one randomized linear combination (see
+ * \p lc_ed25519_verify_batch). All keys must be of the same Dilithium type.
+ *
+ * @param [out] res array of \p num entries receiving the verification result
+ *		    of each signature - 0 if the signature could be verified
+ *		    correctly and -EBADMSG otherwise; may be NULL
+ * @param [in] sig array of \p num pointers to input signatures
+ * @param [in] m array of \p num pointers to the messages
+ * @param [in] mlen array of \p num message lengths
+ * @param [in] num number of signatures
+ * @param [in] pk array of \p num pointers to the public keys
+ *
+ * @return 0 if all signatures could be verified correctly and -EBADMSG when
+ * at least one signature cannot be verified, < 0 on other errors
+ */
+int lc_dilithium_ed25519_verify_batch(
+	int *res, const struct lc_dilithium_ed25519_sig *const *sig,
+	const uint8_t *const *m, const size_t *mlen, unsigned int num,
+	const struct lc_dilithium_ed25519_pk *const *pk);
+
 /**
  * @ingroup HybridDilithium
  * @brief Verifies signature with Dilithium context in one shot
@@ -1772,6 +1798,32 @@ int lc_dilithium_ed448_verify(const struct lc_dilithium_ed448_sig *sig,
 			      const uint8_t *m, size_t mlen,
 			      const struct lc_dilithium_ed448_pk *pk);
 
+/**
+ * @ingroup HybridDilithium
+ * @brief Verifies multiple signatures in one shot
+ *
+ * Each signature is verified as with \p lc_dilithium_ed448_verify. The
+ * ML-DSA parts are verified one after another while the ED448 parts are
+ * verified together with one randomized linear combination (see
+ * \p lc_ed448_verify_batch). All keys must be of the same Dilithium type.
+ *
+ * @param [out] res array of \p num entries receiving the verification result
+ *		    of each signature - 0 if the signature could be verified
+ *		    correctly and -EBADMSG otherwise; may be NULL
+ * @param [in] sig array of \p num pointers to input signatures
+ * @param [in] m array of \p num pointers to the messages
+ * @param [in] mlen array of \p num message lengths
+ * @param [in] num number of signatures
+ * @param [in] pk array of \p num pointers to the public keys
+ *
+ * @return 0 if all signatures could be verified correctly and -EBADMSG when
+ * at least one signature cannot be verified, < 0 on other errors
+ */
+int lc_dilithium_ed448_verify_batch(
+	int *res, const struct lc_dilithium_ed448_sig *const *sig,
+	const uint8_t *const *m, const size_t *mlen, unsigned int num,
+	const struct lc_dilithium_ed448_pk *const *pk);
+
 /**
  * @ingroup HybridDilithium
  * @brief Verifies signature with Dilithium context in one shot
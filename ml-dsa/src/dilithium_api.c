@@ -1580,6 +1580,119 @@ LC_INTERFACE_FUNCTION(int, lc_dilithium_ed25519_verify,
 	}
 }
 
+/*
+ * Number of signatures for which the type-specific pointer arrays are set up
+ * on the stack at once.
+ */
+#define LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK 16
+
+static int lc_dilithium_ed25519_verify_batch_chunk(
+	int *res, const struct lc_dilithium_ed25519_sig *const *sig,
+	const uint8_t *const *m, const size_t *mlen, unsigned int num,
+	const struct lc_dilithium_ed25519_pk *const *pk)
+{
+	unsigned int i;
+
+	for (i = 0; i < num; i++) {
+		if (!sig[i] || !pk[i] ||
+		    sig[i]->dilithium_type != pk[0]->dilithium_type ||
+		    pk[i]->dilithium_type != pk[0]->dilithium_type)
+			return -EINVAL;
+	}
+
+	switch (pk[0]->dilithium_type) {
+	case LC_DILITHIUM_87:
+#ifdef LC_DILITHIUM_87_ENABLED
+	{
+		const struct lc_dilithium_87_ed25519_sig
+			*sig_87[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+		const struct lc_dilithium_87_ed25519_pk
+			*pk_87[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			sig_87[i] = &sig[i]->sig.sig_87;
+			pk_87[i] = &pk[i]->key.pk_87;
+		}
+
+		return lc_dilithium_87_ed25519_verify_batch(res, sig_87, m,
+							     mlen, num, pk_87);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_DILITHIUM_65:
+#ifdef LC_DILITHIUM_65_ENABLED
+	{
+		const struct lc_dilithium_65_ed25519_sig
+			*sig_65[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+		const struct lc_dilithium_65_ed25519_pk
+			*pk_65[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			sig_65[i] = &sig[i]->sig.sig_65;
+			pk_65[i] = &pk[i]->key.pk_65;
+		}
+
+		return lc_dilithium_65_ed25519_verify_batch(res, sig_65, m,
+							     mlen, num, pk_65);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_DILITHIUM_44:
+#ifdef LC_DILITHIUM_44_ENABLED
+	{
+		const struct lc_dilithium_44_ed25519_sig
+			*sig_44[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+		const struct lc_dilithium_44_ed25519_pk
+			*pk_44[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			sig_44[i] = &sig[i]->sig.sig_44;
+			pk_44[i] = &pk[i]->key.pk_44;
+		}
+
+		return lc_dilithium_44_ed25519_verify_batch(res, sig_44, m,
+							     mlen, num, pk_44);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_DILITHIUM_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
+LC_INTERFACE_FUNCTION(int, lc_dilithium_ed25519_verify_batch, int *res,
+		      const struct lc_dilithium_ed25519_sig *const *sig,
+		      const uint8_t *const *m, const size_t *mlen,
+		      unsigned int num,
+		      const struct lc_dilithium_ed25519_pk *const *pk)
+{
+	unsigned int i, n;
+	int ret = 0, tmp;
+
+	if (!pk || !sig || !m || !mlen)
+		return -EINVAL;
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK)
+			n = LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK;
+
+		tmp = lc_dilithium_ed25519_verify_batch_chunk(
+			res ? res + i : NULL, sig + i, m + i, mlen + i, n,
+			pk + i);
+		if (tmp == -EBADMSG)
+			ret = tmp;
+		else if (tmp)
+			return tmp;
+	}
+
+	return ret;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_dilithium_ed25519_verify_ctx,
 		      const struct lc_dilithium_ed25519_sig *sig,
 		      struct lc_dilithium_ed25519_ctx *ctx, const uint8_t *m,
@@ -2410,6 +2523,119 @@ LC_INTERFACE_FUNCTION(int, lc_dilithium_ed448_verify,
 	}
 }
 
+/*
+ * Number of signatures for which the type-specific pointer arrays are set up
+ * on the stack at once.
+ */
+#define LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK 16
+
+static int lc_dilithium_ed448_verify_batch_chunk(
+	int *res, const struct lc_dilithium_ed448_sig *const *sig,
+	const uint8_t *const *m, const size_t *mlen, unsigned int num,
+	const struct lc_dilithium_ed448_pk *const *pk)
+{
+	unsigned int i;
+
+	for (i = 0; i < num; i++) {
+		if (!sig[i] || !pk[i] ||
+		    sig[i]->dilithium_type != pk[0]->dilithium_type ||
+		    pk[i]->dilithium_type != pk[0]->dilithium_type)
+			return -EINVAL;
+	}
+
+	switch (pk[0]->dilithium_type) {
+	case LC_DILITHIUM_87:
+#ifdef LC_DILITHIUM_87_ENABLED
+	{
+		const struct lc_dilithium_87_ed448_sig
+			*sig_87[LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK];
+		const struct lc_dilithium_87_ed448_pk
+			*pk_87[LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			sig_87[i] = &sig[i]->sig.sig_87;
+			pk_87[i] = &pk[i]->key.pk_87;
+		}
+
+		return lc_dilithium_87_ed448_verify_batch(res, sig_87, m,
+							   mlen, num, pk_87);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_DILITHIUM_65:
+#ifdef LC_DILITHIUM_65_ENABLED
+	{
+		const struct lc_dilithium_65_ed448_sig
+			*sig_65[LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK];
+		const struct lc_dilithium_65_ed448_pk
+			*pk_65[LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			sig_65[i] = &sig[i]->sig.sig_65;
+			pk_65[i] = &pk[i]->key.pk_65;
+		}
+
+		return lc_dilithium_65_ed448_verify_batch(res, sig_65, m,
+							   mlen, num, pk_65);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_DILITHIUM_44:
+#ifdef LC_DILITHIUM_44_ENABLED
+	{
+		const struct lc_dilithium_44_ed448_sig
+			*sig_44[LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK];
+		const struct lc_dilithium_44_ed448_pk
+			*pk_44[LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++) {
+			sig_44[i] = &sig[i]->sig.sig_44;
+			pk_44[i] = &pk[i]->key.pk_44;
+		}
+
+		return lc_dilithium_44_ed448_verify_batch(res, sig_44, m,
+							   mlen, num, pk_44);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_DILITHIUM_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
+LC_INTERFACE_FUNCTION(int, lc_dilithium_ed448_verify_batch, int *res,
+		      const struct lc_dilithium_ed448_sig *const *sig,
+		      const uint8_t *const *m, const size_t *mlen,
+		      unsigned int num,
+		      const struct lc_dilithium_ed448_pk *const *pk)
+{
+	unsigned int i, n;
+	int ret = 0, tmp;
+
+	if (!pk || !sig || !m || !mlen)
+		return -EINVAL;
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK)
+			n = LC_DILITHIUM_ED448_VERIFY_BATCH_CHUNK;
+
+		tmp = lc_dilithium_ed448_verify_batch_chunk(
+			res ? res + i : NULL, sig + i, m + i, mlen + i, n,
+			pk + i);
+		if (tmp == -EBADMSG)
+			ret = tmp;
+		else if (tmp)
+			return tmp;
+	}
+
+	return ret;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_dilithium_ed448_verify_ctx,
 		      const struct lc_dilithium_ed448_sig *sig,
 		      struct lc_dilithium_ed448_ctx *ctx, const uint8_t *m,
@@ -368,6 +368,79 @@ LC_INTERFACE_FUNCTION(int, lc_dilithium_ed25519_verify,
 	return ret;
 }
 
+/*
+ * Number of composite signatures whose ED25519 parts are handed to the
+ * ED25519 batch verification at once.
+ */
+#define LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK 16
+
+LC_INTERFACE_FUNCTION(int, lc_dilithium_ed25519_verify_batch, int *res,
+		      const struct lc_dilithium_ed25519_sig *const *sig,
+		      const uint8_t *const *m, const size_t *mlen,
+		      unsigned int num,
+		      const struct lc_dilithium_ed25519_pk *const *pk)
+{
+	const struct lc_ed25519_sig
+		*sig_ed25519[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+	const struct lc_ed25519_pk
+		*pk_ed25519[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+	int rete[LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK];
+	unsigned int i, j, n;
+	int retd, tmp, ret = 0;
+	LC_DILITHIUM_ED25519_CTX_ON_STACK(ctx);
+
+	CKNULL(sig, -EINVAL);
+	CKNULL(m, -EINVAL);
+	CKNULL(mlen, -EINVAL);
+	CKNULL(pk, -EINVAL);
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK)
+			n = LC_DILITHIUM_ED25519_VERIFY_BATCH_CHUNK;
+
+		for (j = 0; j < n; j++) {
+			sig_ed25519[j] =
+				sig[i + j] ? &sig[i + j]->sig_ed25519 : NULL;
+			pk_ed25519[j] = pk[i + j] ? &pk[i + j]->pk_ed25519 :
+						    NULL;
+		}
+
+		/* ED25519 parts with the composite domain separation */
+		ctx->dilithium_ctx.nist_category = LC_DILITHIUM_NIST_CATEGORY;
+		tmp = lc_ed25519_verify_batch_ctx(rete, sig_ed25519, m + i,
+						  mlen + i, n, pk_ed25519, ctx);
+		if (tmp && tmp != -EBADMSG) {
+			ret = tmp;
+			goto out;
+		}
+
+		for (j = 0; j < n; j++) {
+			if (!sig[i + j] || !pk[i + j]) {
+				retd = -EINVAL;
+			} else {
+				LC_DILITHIUM_SET_CTX(&ctx->dilithium_ctx);
+				ctx->dilithium_ctx.nist_category =
+					LC_DILITHIUM_NIST_CATEGORY;
+				retd = lc_dilithium_verify_ctx(
+					&sig[i + j]->sig, &ctx->dilithium_ctx,
+					m[i + j], mlen[i + j], &pk[i + j]->pk);
+				lc_dilithium_ed25519_ctx_zero(ctx);
+			}
+
+			tmp = lc_dilithium_ed25519_verify_check(retd, rete[j]);
+			if (res)
+				res[i + j] = tmp;
+			if (tmp)
+				ret = -EBADMSG;
+		}
+	}
+
+out:
+	lc_dilithium_ed25519_ctx_zero(ctx);
+	return ret;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_dilithium_ed25519_verify_init,
 		      struct lc_dilithium_ed25519_ctx *ctx,
 		      const struct lc_dilithium_ed25519_pk *pk)
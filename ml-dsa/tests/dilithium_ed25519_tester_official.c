@@ -95,6 +95,53 @@ out:
 	return ret;
 }
 
+static int dilithium_batch_tester_official(void)
+{
+	struct workspace {
+		struct lc_dilithium_ed25519_sk sk;
+		struct lc_dilithium_ed25519_pk pk;
+		struct lc_dilithium_ed25519_sig sig[3];
+		uint8_t msg[3][10];
+	};
+	const struct lc_dilithium_ed25519_sig *sig[3];
+	const struct lc_dilithium_ed25519_pk *pk[3];
+	const uint8_t *m[3];
+	size_t mlen[3];
+	int res[3];
+	unsigned int i;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+	int ret = 0;
+
+	CKINT(lc_dilithium_ed25519_keypair(&ws->pk, &ws->sk, lc_seeded_rng,
+					   DILITHIUM_TYPE));
+	for (i = 0; i < 3; i++) {
+		ws->msg[i][0] = (uint8_t)i;
+		CKINT(lc_dilithium_ed25519_sign(&ws->sig[i], ws->msg[i],
+						sizeof(ws->msg[i]), &ws->sk,
+						lc_seeded_rng));
+		sig[i] = &ws->sig[i];
+		pk[i] = &ws->pk;
+		m[i] = ws->msg[i];
+		mlen[i] = sizeof(ws->msg[i]);
+	}
+
+	CKINT_LOG(lc_dilithium_ed25519_verify_batch(res, sig, m, mlen, 3, pk),
+		  "Batch verification failed - ret %d\n", ret);
+
+	/* A modified message must be caught for the second signature only */
+	ws->msg[1][0] ^= 0x01;
+	if (lc_dilithium_ed25519_verify_batch(res, sig, m, mlen, 3, pk) !=
+		    -EBADMSG ||
+	    res[0] || res[1] != -EBADMSG || res[2]) {
+		printf("Batch verification did not detect modified message\n");
+		ret = -EFAULT;
+	}
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	struct lc_dilithium_ed25519_ctx *ctx_heap = NULL;
@@ -107,6 +154,7 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	CKINT(lc_dilithium_ed25519_ctx_alloc(&ctx_heap));
 
 	CKINT_LOG(dilithium_tester_official(), "Official stack\n");
+	CKINT_LOG(dilithium_batch_tester_official(), "Official batch\n");
 	CKINT_LOG(dilithium_iuf_tester_official(ctx), "Official IUT\n");
 	CKINT_LOG(dilithium_iuf_tester_official(ctx_heap), "Official heap\n");
 
@@ -127,6 +127,7 @@ extern "C" {
 #define lc_kyber_x448_keypair KYBER_F(x448_keypair)
 #define lc_kyber_x448_enc_kdf KYBER_F(x448_enc_kdf)
 #define lc_kyber_x448_dec_kdf KYBER_F(x448_dec_kdf)
+#define lc_kyber_x448_dec_kdf_batch KYBER_F(x448_dec_kdf_batch)
 
 #define lc_kyber_keypair KYBER_F(keypair)
 #define lc_kyber_keypair_from_seed KYBER_F(keypair_from_seed)
@@ -2056,6 +2056,28 @@ int lc_kyber_x448_dec_kdf(uint8_t *ss, size_t ss_len,
 			  const struct lc_kyber_x448_ct *ct,
 			  const struct lc_kyber_x448_sk *sk);
 
+/**
+ * @ingroup HybridKyber
+ * @brief Key decapsulation of multiple cipher texts with KDF applied to shared
+ *	  secret
+ *
+ * Equivalent to invoking lc_kyber_x448_dec_kdf for each cipher text with the
+ * same private key. The X448 scalar multiplications of the cipher texts are
+ * calculated in parallel if supported by the CPU.
+ *
+ * @param [out] ss array of pointers to output shared secrets
+ * @param [in] ss_len length of each shared secret to be generated
+ * @param [in] ct array of pointers to input cipher texts
+ * @param [in] num number of cipher texts
+ * @param [in] sk pointer to input private key
+ *
+ * @return 0 on success, < 0 on error of any of the cipher texts
+ */
+int lc_kyber_x448_dec_kdf_batch(uint8_t *const *ss, size_t ss_len,
+				const struct lc_kyber_x448_ct *const *ct,
+				unsigned int num,
+				const struct lc_kyber_x448_sk *sk);
+
 /****************************** Kyber X25510 KEX ******************************/
 
 /**
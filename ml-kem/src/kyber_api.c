@@ -2924,6 +2924,100 @@ LC_INTERFACE_FUNCTION(int, lc_kyber_x448_dec_kdf, uint8_t *ss, size_t ss_len,
 	}
 }
 
+/*
+ * Number of cipher texts for which the type-specific pointer arrays are set up
+ * on the stack at once.
+ */
+#define LC_KYBER_X448_DEC_BATCH_CHUNK 16
+
+static int lc_kyber_x448_dec_kdf_batch_chunk(
+	uint8_t *const *ss, size_t ss_len,
+	const struct lc_kyber_x448_ct *const *ct, unsigned int num,
+	const struct lc_kyber_x448_sk *sk)
+{
+	unsigned int i;
+
+	for (i = 0; i < num; i++) {
+		if (!ct[i] || ct[i]->kyber_type != sk->kyber_type)
+			return -EINVAL;
+	}
+
+	switch (sk->kyber_type) {
+	case LC_KYBER_1024:
+#ifdef LC_KYBER_1024_ENABLED
+	{
+		const struct lc_kyber_1024_x448_ct
+			*ct_1024[LC_KYBER_X448_DEC_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			ct_1024[i] = &ct[i]->key.ct_1024;
+
+		return lc_kyber_1024_x448_dec_kdf_batch(ss, ss_len, ct_1024,
+							num, &sk->key.sk_1024);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_KYBER_768:
+#ifdef LC_KYBER_768_ENABLED
+	{
+		const struct lc_kyber_768_x448_ct
+			*ct_768[LC_KYBER_X448_DEC_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			ct_768[i] = &ct[i]->key.ct_768;
+
+		return lc_kyber_768_x448_dec_kdf_batch(ss, ss_len, ct_768, num,
+						       &sk->key.sk_768);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_KYBER_512:
+#ifdef LC_KYBER_512_ENABLED
+	{
+		const struct lc_kyber_512_x448_ct
+			*ct_512[LC_KYBER_X448_DEC_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			ct_512[i] = &ct[i]->key.ct_512;
+
+		return lc_kyber_512_x448_dec_kdf_batch(ss, ss_len, ct_512, num,
+						       &sk->key.sk_512);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_KYBER_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
+LC_INTERFACE_FUNCTION(int, lc_kyber_x448_dec_kdf_batch, uint8_t *const *ss,
+		      size_t ss_len, const struct lc_kyber_x448_ct *const *ct,
+		      unsigned int num, const struct lc_kyber_x448_sk *sk)
+{
+	unsigned int i, n;
+	int ret;
+
+	if (!ss || !ct || !sk)
+		return -EINVAL;
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_KYBER_X448_DEC_BATCH_CHUNK)
+			n = LC_KYBER_X448_DEC_BATCH_CHUNK;
+
+		ret = lc_kyber_x448_dec_kdf_batch_chunk(ss + i, ss_len, ct + i,
+							n, sk);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
 /****************************** Kyber X25510 KEX ******************************/
 
 LC_INTERFACE_FUNCTION(int, lc_kex_x448_uake_initiator_init,
@@ -21,7 +21,9 @@
 #include "kyber_internal.h"
 #include "kyber_x448_internal.h"
 #include "kyber_x448_kdf.h"
+#include "math_helper.h"
 #include "ret_checkers.h"
+#include "small_stack_support.h"
 #include "visibility.h"
 #include "lc_x448.h"
 
@@ -108,3 +110,56 @@ out:
 	lc_memset_secure(&ss_k_x, 0, sizeof(ss_k_x));
 	return ret;
 }
+
+/*
+ * Number of cipher texts whose X448 shared secrets are calculated with one
+ * batch invocation.
+ */
+#define LC_KYBER_X448_DEC_BATCH_CHUNK 8
+
+LC_INTERFACE_FUNCTION(int, lc_kyber_x448_dec_kdf_batch, uint8_t *const *ss,
+		      size_t ss_len, const struct lc_kyber_x448_ct *const *ct,
+		      unsigned int num, const struct lc_kyber_x448_sk *sk)
+{
+	struct workspace {
+		struct lc_kyber_x448_ss ss_k_x[LC_KYBER_X448_DEC_BATCH_CHUNK];
+		struct lc_x448_ss *ss_x448[LC_KYBER_X448_DEC_BATCH_CHUNK];
+		const struct lc_x448_pk *pk_x448[LC_KYBER_X448_DEC_BATCH_CHUNK];
+		const struct lc_x448_sk *sk_x448[LC_KYBER_X448_DEC_BATCH_CHUNK];
+	};
+	unsigned int i, j, todo;
+	int ret = 0;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	CKNULL(ss, -EINVAL);
+	CKNULL(ct, -EINVAL);
+	CKNULL(sk, -EINVAL);
+
+	for (i = 0; i < num; i += todo) {
+		todo = min_uint32(num - i, LC_KYBER_X448_DEC_BATCH_CHUNK);
+
+		for (j = 0; j < todo; j++) {
+			CKNULL(ct[i + j], -EINVAL);
+			CKNULL(ss[i + j], -EINVAL);
+
+			CKINT(lc_kyber_dec(&ws->ss_k_x[j].ss, &ct[i + j]->ct,
+					   &sk->sk));
+
+			ws->ss_x448[j] = &ws->ss_k_x[j].ss_x448;
+			ws->pk_x448[j] = &ct[i + j]->pk_x448;
+			ws->sk_x448[j] = &sk->sk_x448;
+		}
+
+		/* The X448 operations of all cipher texts run in parallel */
+		CKINT(lc_x448_ss_batch(ws->ss_x448, ws->pk_x448, ws->sk_x448,
+				       todo));
+
+		for (j = 0; j < todo; j++)
+			kyber_x448_ss_kdf(ss[i + j], ss_len, ct[i + j],
+					  &ws->ss_k_x[j]);
+	}
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
@@ -1304,6 +1304,51 @@ out:
 	return ret ? !!ret : rc;
 }
 
+/*
+ * The batch decapsulation must deliver the same shared secrets as the
+ * encapsulation - the number of cipher texts covers a full and a partial
+ * X448 batch.
+ */
+#define KYBER_KEM_DOUBLE_BATCH_NUM 9
+static int kyber_kem_double_batch_tester(void)
+{
+	struct workspace {
+		struct lc_kyber_x448_pk pk;
+		struct lc_kyber_x448_sk sk;
+		struct lc_kyber_x448_ct ct[KYBER_KEM_DOUBLE_BATCH_NUM];
+		uint8_t ss1[KYBER_KEM_DOUBLE_BATCH_NUM][sizeof(ss_exp)];
+		uint8_t ss2[KYBER_KEM_DOUBLE_BATCH_NUM][sizeof(ss_exp)];
+		const struct lc_kyber_x448_ct *ct_p[KYBER_KEM_DOUBLE_BATCH_NUM];
+		uint8_t *ss_p[KYBER_KEM_DOUBLE_BATCH_NUM];
+	};
+	unsigned int i;
+	int ret, rc = 0;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+	LC_SELFTEST_DRNG_CTX_ON_STACK(selftest_rng);
+
+	CKINT(lc_kyber_x448_keypair(&ws->pk, &ws->sk, selftest_rng));
+
+	for (i = 0; i < KYBER_KEM_DOUBLE_BATCH_NUM; i++) {
+		CKINT(lc_kyber_x448_enc_kdf_internal(&ws->ct[i], ws->ss1[i],
+						     sizeof(ws->ss1[i]),
+						     &ws->pk, selftest_rng));
+		ws->ct_p[i] = &ws->ct[i];
+		ws->ss_p[i] = ws->ss2[i];
+	}
+
+	CKINT(lc_kyber_x448_dec_kdf_batch(ws->ss_p, sizeof(ws->ss2[0]),
+					  ws->ct_p, KYBER_KEM_DOUBLE_BATCH_NUM,
+					  &ws->sk));
+
+	for (i = 0; i < KYBER_KEM_DOUBLE_BATCH_NUM; i++)
+		rc += lc_compare(ws->ss1[i], ws->ss2[i], sizeof(ws->ss2[i]),
+				 "Kyber X448 batch SS comparison\n");
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret ? !!ret : rc;
+}
+
 static int kyber_kem_double_enc_tester(void)
 {
 	struct workspace {
@@ -1381,8 +1426,10 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	alg_status_set_result(lc_alg_status_result_passed, LC_ALG_STATUS_SHA3);
 #endif
 
-	if (argc != 2)
+	if (argc != 2) {
 		ret = kyber_kem_double_tester(1);
+		ret += kyber_kem_double_batch_tester();
+	}
 
 	else if (argv[1][0] == 'e')
 		ret = kyber_kem_double_enc_tester();
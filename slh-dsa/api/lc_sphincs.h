@@ -202,6 +202,39 @@ struct lc_sphincs_sig {
 	} sig;
 };
 
+/**
+ * @brief Sphincs secret key with cached hypertree layers
+ */
+struct lc_sphincs_prepared_sk {
+	enum lc_sphincs_type sphincs_type;
+	union {
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+		struct lc_sphincs_shake_256s_prepared_sk
+			*prepared_sk_shake_256s;
+#endif
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+		struct lc_sphincs_shake_256f_prepared_sk
+			*prepared_sk_shake_256f;
+#endif
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+		struct lc_sphincs_shake_192s_prepared_sk
+			*prepared_sk_shake_192s;
+#endif
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+		struct lc_sphincs_shake_192f_prepared_sk
+			*prepared_sk_shake_192f;
+#endif
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+		struct lc_sphincs_shake_128s_prepared_sk
+			*prepared_sk_shake_128s;
+#endif
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+		struct lc_sphincs_shake_128f_prepared_sk
+			*prepared_sk_shake_128f;
+#endif
+	} key;
+};
+
 /**
  * @ingroup Sphincs
  * @brief Allocates Sphincs context on heap
@@ -262,6 +295,27 @@ void lc_sphincs_ctx_hash(struct lc_sphincs_ctx *ctx,
 void lc_sphincs_ctx_userctx(struct lc_sphincs_ctx *ctx, const uint8_t *userctx,
 			    size_t userctxlen);
 
+/**
+ * @ingroup Sphincs
+ * @brief Register an executor to distribute the independent parts of the
+ *	  Sphincs key generation and signature generation.
+ *
+ * The FORS trees and the hypertree layers of a signature as well as the
+ * subtrees of the top-most Merkle tree during key generation are independent
+ * of each other. When an executor is registered, these computations are
+ * handed to the executor which may process them concurrently, e.g. with a
+ * thread pool. The generated keys and signatures are identical to the ones
+ * generated without an executor.
+ *
+ * @param [in] ctx Sphincs context
+ * @param [in] executor Executor callback or NULL to perform all operations in
+ *			the calling thread
+ * @param [in] executor_data Caller-provided data handed to the executor
+ */
+void lc_sphincs_ctx_executor(struct lc_sphincs_ctx *ctx,
+			     lc_sphincs_executor_f executor,
+			     void *executor_data);
+
 /**
  * @ingroup Sphincs
  * @brief Obtain Sphincs type from secret key
@@ -488,6 +542,24 @@ int lc_sphincs_keypair(struct lc_sphincs_pk *pk, struct lc_sphincs_sk *sk,
 		       struct lc_rng_ctx *rng_ctx,
 		       enum lc_sphincs_type sphincs_type);
 
+/**
+ * @ingroup Sphincs
+ * @brief Generates Sphincs public and private key using the executor
+ *	  registered with the Sphincs context.
+ *
+ * @param [out] pk pointer to allocated output public key
+ * @param [out] sk pointer to allocated output private key
+ * @param [in] ctx Sphincs context holding the executor
+ * @param [in] rng_ctx pointer to seeded random number generator context
+ * @param [in] sphincs_type type of the Sphincs key to generate
+ *
+ * @return 0 (success) or < 0 on error
+ */
+int lc_sphincs_keypair_ctx(struct lc_sphincs_pk *pk, struct lc_sphincs_sk *sk,
+			   struct lc_sphincs_ctx *ctx,
+			   struct lc_rng_ctx *rng_ctx,
+			   enum lc_sphincs_type sphincs_type);
+
 /**
  * @ingroup Sphincs
  * @brief Generates Sphincs public and private key from a given seed.
@@ -575,6 +647,103 @@ int lc_sphincs_sign_ctx(struct lc_sphincs_sig *sig, struct lc_sphincs_ctx *ctx,
 			const struct lc_sphincs_sk *sk,
 			struct lc_rng_ctx *rng_ctx);
 
+/**
+ * @ingroup Sphincs
+ * @brief Allocate a prepared Sphincs secret key
+ *
+ * The Merkle trees of the top-most hypertree layers only depend on the secret
+ * key and on the tree index, but not on the message. The prepared secret key
+ * caches all nodes of the trees of the requested number of top-most layers so
+ * that signing with \p lc_sphincs_sign_prepared only needs to compute the
+ * lower layers. This is beneficial for keys used to continuously generate
+ * signatures.
+ *
+ * The memory consumption and the one-time computation cost depend on the
+ * number of cached layers:
+ *
+ * * 1 layer: the top-most tree, i.e. (2^(h' - 2) - 1) * n bytes which is
+ *   comparable to one key generation
+ *
+ * * 2 layers: additionally all 2^h' trees of the layer below, i.e.
+ *   (2^h' + 1) * (2^(h' - 2) - 1) * n bytes which requires 2^h' times the
+ *   computation of a key generation - for the "s" parameter sets this
+ *   amounts to about 0.5 to 1.6 MBytes of memory
+ *
+ * The lowest 3 levels of the cached trees are not stored but recomputed
+ * during signing together with the WOTS signature. Thus, the prepared key
+ * provides the largest benefit for the "s" parameter sets.
+ *
+ * The prepared key contains a copy of the secret key and must be treated
+ * with the same care as the secret key. It must be released with
+ * \p lc_sphincs_prepared_sk_zero_free.
+ *
+ * @param [out] prepared_sk Allocated prepared secret key
+ * @param [in] sk pointer to secret key
+ * @param [in] layers Number of cached hypertree layers - allowed values are 1
+ *		      and 2
+ *
+ * @return 0 (success) or < 0 on error
+ */
+int lc_sphincs_prepared_sk_alloc(struct lc_sphincs_prepared_sk **prepared_sk,
+				 const struct lc_sphincs_sk *sk,
+				 unsigned int layers);
+
+/**
+ * @ingroup Sphincs
+ * @brief Zeroize and free a prepared Sphincs secret key
+ *
+ * @param [in] prepared_sk Prepared secret key to be zeroized and freed
+ */
+void lc_sphincs_prepared_sk_zero_free(
+	struct lc_sphincs_prepared_sk *prepared_sk);
+
+/**
+ * @ingroup Sphincs
+ * @brief Computes signature with a prepared secret key in one shot
+ *
+ * The generated signature is identical to the signature generated by
+ * \p lc_sphincs_sign with the secret key the prepared key was derived from.
+ *
+ * @param [out] sig pointer to output signature
+ * @param [in] m pointer to message to be signed
+ * @param [in] mlen length of message
+ * @param [in] prepared_sk pointer to prepared secret key
+ * @param [in] rng_ctx pointer to seeded random number generator context - when
+ *		       pointer is non-NULL, perform a randomized signing.
+ *		       Otherwise use deterministic signing.
+ *
+ * @return 0 (success) or < 0 on error
+ */
+int lc_sphincs_sign_prepared(struct lc_sphincs_sig *sig, const uint8_t *m,
+			     size_t mlen,
+			     const struct lc_sphincs_prepared_sk *prepared_sk,
+			     struct lc_rng_ctx *rng_ctx);
+
+/**
+ * @ingroup Sphincs
+ * @brief Computes signature with user context and a prepared secret key in one
+ *	  shot
+ *
+ * This call is identical to \p lc_sphincs_sign_ctx except that the prepared
+ * secret key is used.
+ *
+ * @param [out] sig pointer to output signature
+ * @param [in] ctx reference to the allocated Sphincs context handle
+ * @param [in] m pointer to message to be signed
+ * @param [in] mlen length of message
+ * @param [in] prepared_sk pointer to prepared secret key
+ * @param [in] rng_ctx pointer to seeded random number generator context - when
+ *		       pointer is non-NULL, perform a randomized signing.
+ *		       Otherwise use deterministic signing.
+ *
+ * @return 0 (success) or < 0 on error
+ */
+int lc_sphincs_sign_prepared_ctx(
+	struct lc_sphincs_sig *sig, struct lc_sphincs_ctx *ctx,
+	const uint8_t *m, size_t mlen,
+	const struct lc_sphincs_prepared_sk *prepared_sk,
+	struct lc_rng_ctx *rng_ctx);
+
 /**
  * @ingroup Sphincs
  * @brief Initializes a signature operation
@@ -684,6 +853,60 @@ int lc_sphincs_verify_ctx(const struct lc_sphincs_sig *sig,
 			  struct lc_sphincs_ctx *ctx, const uint8_t *m,
 			  size_t mlen, const struct lc_sphincs_pk *pk);
 
+/**
+ * @ingroup Sphincs
+ * @brief Verifies multiple signatures created with the same key in one shot
+ *
+ * The signatures are verified in lockstep where each signature occupies one
+ * lane of the vectorized hash implementation (4 lanes with AVX2, 8 lanes with
+ * AVX-512, 2 lanes with ARMv8). This keeps all lanes busy while computing the
+ * FORS trees and the Merkle tree roots which are processed serially when
+ * verifying a single signature.
+ *
+ * @param [out] res array of \p num entries receiving the verification result
+ *		    of each signature - 0 if the signature could be verified
+ *		    correctly and -EBADMSG otherwise; may be NULL
+ * @param [in] sig array of \p num pointers to input signatures
+ * @param [in] m array of \p num pointers to the messages
+ * @param [in] mlen array of \p num message lengths
+ * @param [in] num number of signatures
+ * @param [in] pk pointer to public key
+ *
+ * @return 0 if all signatures could be verified correctly and -EBADMSG when
+ * at least one signature cannot be verified, < 0 on other errors
+ */
+int lc_sphincs_verify_batch(int *res, const struct lc_sphincs_sig *const *sig,
+			    const uint8_t *const *m, const size_t *mlen,
+			    unsigned int num, const struct lc_sphincs_pk *pk);
+
+/**
+ * @ingroup Sphincs
+ * @brief Verifies multiple signatures created with the same key with Sphincs
+ *	  context in one shot
+ *
+ * This call is identical to \p lc_sphincs_verify_batch except that the
+ * Sphincs context is applied to all signatures.
+ *
+ * @param [out] res array of \p num entries receiving the verification result
+ *		    of each signature - 0 if the signature could be verified
+ *		    correctly and -EBADMSG otherwise; may be NULL
+ * @param [in] sig array of \p num pointers to input signatures
+ * @param [in] ctx reference to the allocated Sphincs context handle
+ * @param [in] m array of \p num pointers to the messages
+ * @param [in] mlen array of \p num message lengths
+ * @param [in] num number of signatures
+ * @param [in] pk pointer to public key
+ *
+ * @return 0 if all signatures could be verified correctly and -EBADMSG when
+ * at least one signature cannot be verified, < 0 on other errors
+ */
+int lc_sphincs_verify_batch_ctx(int *res,
+				const struct lc_sphincs_sig *const *sig,
+				struct lc_sphincs_ctx *ctx,
+				const uint8_t *const *m, const size_t *mlen,
+				unsigned int num,
+				const struct lc_sphincs_pk *pk);
+
 /**
  * @ingroup Sphincs
  * @brief Initializes a signature verification operation
@@ -27,6 +27,17 @@ extern "C" {
 /* Prevent Dilithium macros from getting undefined */
 #define LC_SPHINCS_INTERNAL
 
+#if defined(LC_SPHINCS_TYPE_128F_SHA2) ||                                      \
+	defined(LC_SPHINCS_TYPE_128S_SHA2) ||                                  \
+	defined(LC_SPHINCS_TYPE_192F_SHA2) ||                                  \
+	defined(LC_SPHINCS_TYPE_192S_SHA2) ||                                  \
+	defined(LC_SPHINCS_TYPE_256F_SHA2) || defined(LC_SPHINCS_TYPE_256S_SHA2)
+#define LC_SPHINCS_SHA2
+
+/* The SHA2 sets use SHA-256 as LC_SPHINCS_HASH_TYPE for F, PRF and H/T_l */
+#include "lc_sha256.h"
+#endif
+
 /*
  * This define replaces all symbol names accordingly to allow double compilation
  * of the same code base.
@@ -46,6 +57,7 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_shake_128f_pk
 #define lc_sphincs_sk lc_sphincs_shake_128f_sk
 #define lc_sphincs_sig lc_sphincs_shake_128f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_shake_128f_prepared_sk
 
 #include "lc_sphincs_shake_128f.h"
 
@@ -55,6 +67,7 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_ascon_128f_pk
 #define lc_sphincs_sk lc_sphincs_ascon_128f_sk
 #define lc_sphincs_sig lc_sphincs_ascon_128f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_ascon_128f_prepared_sk
 
 #include "lc_sphincs_ascon_128f.h"
 
@@ -64,6 +77,7 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_shake_128s_pk
 #define lc_sphincs_sk lc_sphincs_shake_128s_sk
 #define lc_sphincs_sig lc_sphincs_shake_128s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_shake_128s_prepared_sk
 
 #include "lc_sphincs_shake_128s.h"
 
@@ -73,6 +87,7 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_ascon_128s_pk
 #define lc_sphincs_sk lc_sphincs_ascon_128s_sk
 #define lc_sphincs_sig lc_sphincs_ascon_128s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_ascon_128s_prepared_sk
 
 #include "lc_sphincs_ascon_128s.h"
 
@@ -82,6 +97,7 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_shake_192f_pk
 #define lc_sphincs_sk lc_sphincs_shake_192f_sk
 #define lc_sphincs_sig lc_sphincs_shake_192f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_shake_192f_prepared_sk
 
 #include "lc_sphincs_shake_192f.h"
 
@@ -91,6 +107,7 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_shake_192s_pk
 #define lc_sphincs_sk lc_sphincs_shake_192s_sk
 #define lc_sphincs_sig lc_sphincs_shake_192s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_shake_192s_prepared_sk
 
 #include "lc_sphincs_shake_192s.h"
 
@@ -100,15 +117,77 @@ extern "C" {
 #define lc_sphincs_pk lc_sphincs_shake_256f_pk
 #define lc_sphincs_sk lc_sphincs_shake_256f_sk
 #define lc_sphincs_sig lc_sphincs_shake_256f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_shake_256f_prepared_sk
 
 #include "lc_sphincs_shake_256f.h"
 
+#elif defined(LC_SPHINCS_TYPE_128F_SHA2)
+
+#define SPHINCS_F(name) lc_sphincs_sha2_128f_##name
+#define lc_sphincs_pk lc_sphincs_sha2_128f_pk
+#define lc_sphincs_sk lc_sphincs_sha2_128f_sk
+#define lc_sphincs_sig lc_sphincs_sha2_128f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_sha2_128f_prepared_sk
+
+#include "lc_sphincs_sha2_128f.h"
+
+#elif defined(LC_SPHINCS_TYPE_128S_SHA2)
+
+#define SPHINCS_F(name) lc_sphincs_sha2_128s_##name
+#define lc_sphincs_pk lc_sphincs_sha2_128s_pk
+#define lc_sphincs_sk lc_sphincs_sha2_128s_sk
+#define lc_sphincs_sig lc_sphincs_sha2_128s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_sha2_128s_prepared_sk
+
+#include "lc_sphincs_sha2_128s.h"
+
+#elif defined(LC_SPHINCS_TYPE_192F_SHA2)
+
+#define SPHINCS_F(name) lc_sphincs_sha2_192f_##name
+#define lc_sphincs_pk lc_sphincs_sha2_192f_pk
+#define lc_sphincs_sk lc_sphincs_sha2_192f_sk
+#define lc_sphincs_sig lc_sphincs_sha2_192f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_sha2_192f_prepared_sk
+
+#include "lc_sphincs_sha2_192f.h"
+
+#elif defined(LC_SPHINCS_TYPE_192S_SHA2)
+
+#define SPHINCS_F(name) lc_sphincs_sha2_192s_##name
+#define lc_sphincs_pk lc_sphincs_sha2_192s_pk
+#define lc_sphincs_sk lc_sphincs_sha2_192s_sk
+#define lc_sphincs_sig lc_sphincs_sha2_192s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_sha2_192s_prepared_sk
+
+#include "lc_sphincs_sha2_192s.h"
+
+#elif defined(LC_SPHINCS_TYPE_256F_SHA2)
+
+#define SPHINCS_F(name) lc_sphincs_sha2_256f_##name
+#define lc_sphincs_pk lc_sphincs_sha2_256f_pk
+#define lc_sphincs_sk lc_sphincs_sha2_256f_sk
+#define lc_sphincs_sig lc_sphincs_sha2_256f_sig
+#define lc_sphincs_prepared_sk lc_sphincs_sha2_256f_prepared_sk
+
+#include "lc_sphincs_sha2_256f.h"
+
+#elif defined(LC_SPHINCS_TYPE_256S_SHA2)
+
+#define SPHINCS_F(name) lc_sphincs_sha2_256s_##name
+#define lc_sphincs_pk lc_sphincs_sha2_256s_pk
+#define lc_sphincs_sk lc_sphincs_sha2_256s_sk
+#define lc_sphincs_sig lc_sphincs_sha2_256s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_sha2_256s_prepared_sk
+
+#include "lc_sphincs_sha2_256s.h"
+
 #else
 
 #define SPHINCS_F(name) lc_sphincs_shake_256s_##name
 #define lc_sphincs_pk lc_sphincs_shake_256s_pk
 #define lc_sphincs_sk lc_sphincs_shake_256s_sk
 #define lc_sphincs_sig lc_sphincs_shake_256s_sig
+#define lc_sphincs_prepared_sk lc_sphincs_shake_256s_prepared_sk
 
 #include "lc_sphincs_shake_256s.h"
 
@@ -116,35 +195,49 @@ extern "C" {
 
 #define lc_sphincs_keypair SPHINCS_F(keypair)
 #define lc_sphincs_keypair_nocheck SPHINCS_F(keypair_nocheck)
+#define lc_sphincs_keypair_ctx SPHINCS_F(keypair_ctx)
 #define lc_sphincs_keypair_from_seed SPHINCS_F(keypair_from_seed)
 #define lc_sphincs_sign SPHINCS_F(sign)
 #define lc_sphincs_sign_ctx SPHINCS_F(sign_ctx)
 #define lc_sphincs_sign_ctx_nocheck SPHINCS_F(sign_ctx_nocheck)
+#define lc_sphincs_sign_prepared SPHINCS_F(sign_prepared)
+#define lc_sphincs_sign_prepared_ctx SPHINCS_F(sign_prepared_ctx)
 #define lc_sphincs_sign_init SPHINCS_F(sign_init)
 #define lc_sphincs_sign_update SPHINCS_F(sign_update)
 #define lc_sphincs_sign_final SPHINCS_F(sign_final)
 #define lc_sphincs_verify SPHINCS_F(verify)
 #define lc_sphincs_verify_ctx SPHINCS_F(verify_ctx)
 #define lc_sphincs_verify_ctx_nocheck SPHINCS_F(verify_ctx_nocheck)
+#define lc_sphincs_verify_batch SPHINCS_F(verify_batch)
+#define lc_sphincs_verify_batch_ctx SPHINCS_F(verify_batch_ctx)
 #define lc_sphincs_verify_init SPHINCS_F(verify_init)
 #define lc_sphincs_verify_update SPHINCS_F(verify_update)
 #define lc_sphincs_verify_final SPHINCS_F(verify_final)
 #define lc_sphincs_ctx_alloc SPHINCS_F(ctx_alloc)
 #define lc_sphincs_ctx_zero SPHINCS_F(ctx_zero)
 #define lc_sphincs_ctx_zero_free SPHINCS_F(ctx_zero_free)
+#define lc_sphincs_prepared_sk_alloc SPHINCS_F(prepared_sk_alloc)
+#define lc_sphincs_prepared_sk_zero_free SPHINCS_F(prepared_sk_zero_free)
 
 #define sphincs_selftest_keygen SPHINCS_F(selftest_keygen)
 #define sphincs_selftest_siggen SPHINCS_F(selftest_siggen)
 #define sphincs_selftest_sigver SPHINCS_F(selftest_sigver)
 
 #define fors_sign_c SPHINCS_F(fors_sign_c)
+#define fors_sign_trees_c SPHINCS_F(fors_sign_trees_c)
+#define fors_roots_to_pk SPHINCS_F(fors_roots_to_pk)
 #define fors_pk_from_sig_c SPHINCS_F(fors_pk_from_sig_c)
 #define gen_message_random SPHINCS_F(gen_message_random)
 #define hash_message SPHINCS_F(hash_message)
 #define sphincs_merkle_sign_c SPHINCS_F(sphincs_merkle_sign_c)
 #define sphincs_merkle_gen_root_c SPHINCS_F(sphincs_merkle_gen_root_c)
+#define sphincs_merkle_gen_subroot_c SPHINCS_F(sphincs_merkle_gen_subroot_c)
+#define sphincs_merkle_sign_subtree_c SPHINCS_F(sphincs_merkle_sign_subtree_c)
+#define sphincs_merkle_gen_nodes_c SPHINCS_F(sphincs_merkle_gen_nodes_c)
 #define thash SPHINCS_F(thash)
 #define thash_ascon SPHINCS_F(thash_ascon)
+#define thash_sha512 SPHINCS_F(thash_sha512)
+#define initialize_hash_function SPHINCS_F(initialize_hash_function)
 #define ull_to_bytes SPHINCS_F(ull_to_bytes)
 #define bytes_to_ull SPHINCS_F(bytes_to_ull)
 #define compute_root SPHINCS_F(compute_root)
@@ -159,24 +252,54 @@ extern "C" {
 #define thashx4 SPHINCS_F(thashx4)
 #define thashx4_12 SPHINCS_F(thashx4_12)
 #define treehashx4 SPHINCS_F(treehashx4)
+#define thashx4_batch SPHINCS_F(thashx4_batch)
 #define wots_gen_leafx4 SPHINCS_F(wots_gen_leafx4)
 #define sphincs_merkle_sign_avx2 SPHINCS_F(sphincs_merkle_sign_avx2)
 #define sphincs_merkle_gen_root_avx2 SPHINCS_F(sphincs_merkle_gen_root_avx2)
+#define sphincs_merkle_gen_subroot_avx2                                        \
+	SPHINCS_F(sphincs_merkle_gen_subroot_avx2)
+#define sphincs_merkle_sign_subtree_avx2                                       \
+	SPHINCS_F(sphincs_merkle_sign_subtree_avx2)
 #define fors_sign_avx2 SPHINCS_F(fors_sign_avx2)
+#define fors_sign_trees_avx2 SPHINCS_F(fors_sign_trees_avx2)
 #define fors_pk_from_sig_avx2 SPHINCS_F(fors_pk_from_sig_avx2)
 #define chain_lengths_avx2 SPHINCS_F(chain_lengths_avx2)
 #define wots_pk_from_sig_avx2 SPHINCS_F(wots_pk_from_sig_avx2)
 
+/* 8-way (AVX-512 SHAKE, AVX2 SHA-256) */
+#define prf_addrx8 SPHINCS_F(prf_addrx8)
+#define thashx8 SPHINCS_F(thashx8)
+#define thashx8_12 SPHINCS_F(thashx8_12)
+#define treehashx8 SPHINCS_F(treehashx8)
+#define thashx8_batch SPHINCS_F(thashx8_batch)
+#define wots_gen_leafx8 SPHINCS_F(wots_gen_leafx8)
+#define sphincs_merkle_sign_x8 SPHINCS_F(sphincs_merkle_sign_x8)
+#define sphincs_merkle_gen_root_x8 SPHINCS_F(sphincs_merkle_gen_root_x8)
+#define sphincs_merkle_gen_subroot_x8 SPHINCS_F(sphincs_merkle_gen_subroot_x8)
+#define sphincs_merkle_sign_subtree_x8                                         \
+	SPHINCS_F(sphincs_merkle_sign_subtree_x8)
+#define fors_sign_x8 SPHINCS_F(fors_sign_x8)
+#define fors_sign_trees_x8 SPHINCS_F(fors_sign_trees_x8)
+#define fors_pk_from_sig_x8 SPHINCS_F(fors_pk_from_sig_x8)
+#define chain_lengths_x8 SPHINCS_F(chain_lengths_x8)
+#define wots_pk_from_sig_x8 SPHINCS_F(wots_pk_from_sig_x8)
+
 /* ARMv8 */
 #define prf_addrx2 SPHINCS_F(prf_addrx2)
 #define thash_armv8 SPHINCS_F(thash_armv8)
 #define thashx2 SPHINCS_F(thashx2)
 #define thashx2_12 SPHINCS_F(thashx2_12)
 #define treehashx2 SPHINCS_F(treehashx2)
+#define thashx2_batch SPHINCS_F(thashx2_batch)
 #define wots_gen_leafx2 SPHINCS_F(wots_gen_leafx2)
 #define sphincs_merkle_sign_armv8 SPHINCS_F(sphincs_merkle_sign_armv8)
 #define sphincs_merkle_gen_root_armv8 SPHINCS_F(sphincs_merkle_gen_root_armv8)
+#define sphincs_merkle_gen_subroot_armv8                                       \
+	SPHINCS_F(sphincs_merkle_gen_subroot_armv8)
+#define sphincs_merkle_sign_subtree_armv8                                      \
+	SPHINCS_F(sphincs_merkle_sign_subtree_armv8)
 #define fors_sign_armv8 SPHINCS_F(fors_sign_armv8)
+#define fors_sign_trees_armv8 SPHINCS_F(fors_sign_trees_armv8)
 #define fors_pk_from_sig_armv8 SPHINCS_F(fors_pk_from_sig_armv8)
 #define chain_lengths_armv8 SPHINCS_F(chain_lengths_armv8)
 #define wots_pk_from_sig_armv8 SPHINCS_F(wots_pk_from_sig_armv8)
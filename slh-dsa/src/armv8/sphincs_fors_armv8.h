@@ -42,6 +42,17 @@ int fors_sign_armv8(uint8_t sig[LC_SPX_FORS_BYTES], uint8_t pk[LC_SPX_N],
 		    const uint8_t m[LC_SPX_FORS_MSG_BYTES], const spx_ctx *ctx,
 		    const uint32_t fors_addr[8]);
 
+/**
+ * Signs the FORS trees [first, first + num) of the message m. The signature
+ * parts and roots are written to the positions of the respective trees in
+ * sig and roots.
+ */
+int fors_sign_trees_armv8(uint8_t sig[LC_SPX_FORS_BYTES],
+			  uint8_t roots[LC_SPX_FORS_TREES * LC_SPX_N],
+			  const uint8_t m[LC_SPX_FORS_MSG_BYTES],
+			  const spx_ctx *ctx, const uint32_t fors_addr[8],
+			  unsigned int first, unsigned int num);
+
 /**
  * Derives the FORS public key from a signature.
  * This can be used for verification by comparing to a known public key, or to
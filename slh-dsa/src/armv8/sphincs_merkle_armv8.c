@@ -35,12 +35,15 @@
 #include "sphincs_wotsx2_armv8.h"
 
 /*
- * This generates a Merkle signature (WOTS signature followed by the Merkle
- * authentication path).
+ * Generate the Merkle tree nodes covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height) of the tree referenced by the
+ * addresses. If idx_leaf is within that range, the WOTS signature of the root
+ * and the authentication path is generated as well.
  */
-int sphincs_merkle_sign_armv8(uint8_t *sig, unsigned char *root,
-			      const spx_ctx *ctx, uint32_t wots_addr[8],
-			      uint32_t tree_addr[8], uint32_t idx_leaf)
+int sphincs_merkle_sign_subtree_armv8(
+	uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
+	uint32_t wots_addr[8], uint32_t tree_addr[8], uint32_t idx_leaf,
+	uint32_t idx_offset, uint32_t tree_height)
 {
 	struct workspace {
 		uint32_t tree_addrx2[2 * 8];
@@ -69,14 +72,27 @@ int sphincs_merkle_sign_armv8(uint8_t *sig, unsigned char *root,
 
 	ws->info.wots_sign_leaf = idx_leaf;
 
-	treehashx2(root, auth_path, ctx, idx_leaf, 0, LC_SPX_TREE_HEIGHT,
-		   wots_gen_leafx2, ws->tree_addrx2, &ws->info,
+	treehashx2(root, auth_path, ctx, idx_leaf - idx_offset, idx_offset,
+		   tree_height, wots_gen_leafx2, ws->tree_addrx2, &ws->info,
 		   ws->wots_pk_buffer, ws->thash_buf);
 
 	LC_RELEASE_MEM(ws);
 	return 0;
 }
 
+/*
+ * This generates a Merkle signature (WOTS signature followed by the Merkle
+ * authentication path).
+ */
+int sphincs_merkle_sign_armv8(uint8_t *sig, unsigned char *root,
+			      const spx_ctx *ctx, uint32_t wots_addr[8],
+			      uint32_t tree_addr[8], uint32_t idx_leaf)
+{
+	return sphincs_merkle_sign_subtree_armv8(sig, root, ctx, wots_addr,
+						 tree_addr, idx_leaf, 0,
+						 LC_SPX_TREE_HEIGHT);
+}
+
 /* Compute root node of the top-most subtree. */
 int sphincs_merkle_gen_root_armv8(unsigned char *root, const spx_ctx *ctx)
 {
@@ -103,3 +119,32 @@ int sphincs_merkle_gen_root_armv8(unsigned char *root, const spx_ctx *ctx)
 	LC_RELEASE_MEM(ws);
 	return 0;
 }
+
+/*
+ * Compute the root node of the subtree of the top-most tree covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height).
+ */
+int sphincs_merkle_gen_subroot_armv8(unsigned char *root, const spx_ctx *ctx,
+				     uint32_t idx_offset, uint32_t tree_height)
+{
+	struct workspace {
+		uint8_t auth_path[LC_SPX_TREE_HEIGHT * LC_SPX_N +
+				  LC_SPX_WOTS_BYTES];
+		uint32_t top_tree_addr[8];
+		uint32_t wots_addr[8];
+	};
+	int ret;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	set_layer_addr(ws->top_tree_addr, LC_SPX_D - 1);
+	set_layer_addr(ws->wots_addr, LC_SPX_D - 1);
+
+	/* ~0 means "don't bother generating an auth path */
+	ret = sphincs_merkle_sign_subtree_armv8(ws->auth_path, root, ctx,
+						ws->wots_addr,
+						ws->top_tree_addr, (uint32_t)~0,
+						idx_offset, tree_height);
+
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
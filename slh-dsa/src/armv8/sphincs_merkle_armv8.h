@@ -45,6 +45,24 @@ int sphincs_merkle_sign_armv8(uint8_t *sig, unsigned char *root,
 /* Compute the root node of the top-most subtree. */
 int sphincs_merkle_gen_root_armv8(unsigned char *root, const spx_ctx *ctx);
 
+/*
+ * Compute the root node of the subtree of the top-most tree covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height).
+ */
+int sphincs_merkle_gen_subroot_armv8(unsigned char *root, const spx_ctx *ctx,
+				     uint32_t idx_offset, uint32_t tree_height);
+
+/*
+ * Generate the Merkle tree nodes covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height) of the tree referenced by the
+ * addresses. If idx_leaf is within that range, the WOTS signature of the root
+ * and the authentication path is generated as well.
+ */
+int sphincs_merkle_sign_subtree_armv8(
+	uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
+	uint32_t wots_addr[8], uint32_t tree_addr[8], uint32_t idx_leaf,
+	uint32_t idx_offset, uint32_t tree_height);
+
 #ifdef __cplusplus
 }
 #endif
@@ -165,3 +165,15 @@ void treehashx2(
 		memcpy(&stackx2[h * 2 * LC_SPX_N], current_idx, 2 * LC_SPX_N);
 	}
 }
+
+void thashx2_batch(uint8_t *out[2], uint8_t *const in[2],
+		   unsigned int inblocks, const spx_ctx *ctx,
+		   uint32_t addrx2[2 * 8], uint8_t *thash_buf)
+{
+	if (inblocks <= 2) {
+		thashx2_12(out[0], out[1], in[0], in[1], inblocks, ctx, addrx2);
+	} else {
+		thashx2(out[0], out[1], in[0], in[1], inblocks, ctx, addrx2,
+			thash_buf);
+	}
+}
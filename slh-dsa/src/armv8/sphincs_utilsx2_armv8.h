@@ -55,6 +55,14 @@ void treehashx2(
 	uint32_t tree_addrx2[2 * 8], void *info, uint8_t *wots_pk_buffer,
 	uint8_t *thash_buf);
 
+/**
+ * Compute the tweakable hash of 2 independent inputs, one per lane. This is
+ * used to process 2 signatures in lockstep during batch verification.
+ */
+void thashx2_batch(uint8_t *out[2], uint8_t *const in[2],
+		   unsigned int inblocks, const spx_ctx *ctx,
+		   uint32_t addrx2[2 * 8], uint8_t *thash_buf);
+
 #ifdef __cplusplus
 }
 #endif
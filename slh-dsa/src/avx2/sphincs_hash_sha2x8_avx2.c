@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "lc_memset_secure.h"
+#include "sha256_8x_avx2.h"
+#include "sphincs_type.h"
+#include "sphincs_address.h"
+#include "x8/sphincs_hashx8.h"
+
+/*
+ * 8-way parallel version of prf_addr; takes 8x as much input and output
+ */
+void prf_addrx8(unsigned char *out[8], const spx_ctx *ctx,
+		const uint32_t addrx8[8 * 8])
+{
+	uint8_t buf[8][LC_SPX_SHA256_ADDR_BYTES + LC_SPX_N];
+	const uint8_t *bufs[8];
+	unsigned int j;
+
+	/* SHA-256(PK.seed || toByte(0, 64 - n) || ADRS^c || SK.seed) */
+	for (j = 0; j < 8; j++) {
+		memcpy(buf[j], addrx8 + j * 8, LC_SPX_SHA256_ADDR_BYTES);
+		memcpy(buf[j] + LC_SPX_SHA256_ADDR_BYTES, ctx->sk_seed,
+		       LC_SPX_N);
+		bufs[j] = buf[j];
+	}
+
+	sha256x8_seeded(out, LC_SPX_N, &ctx->state_seeded, bufs,
+			sizeof(buf[0]));
+
+	lc_memset_secure(buf, 0, sizeof(buf));
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "sha256_8x_avx2.h"
+#include "sphincs_type.h"
+#include "sphincs_address.h"
+#include "sphincs_thash.h"
+#include "x8/sphincs_thashx8.h"
+
+#if LC_SPX_N >= 24
+/*
+ * H and T_l of categories 3 and 5 use SHA-512 which is computed one lane
+ * after the other. The out and in buffers may overlap, thus all lanes are
+ * processed before the result is written.
+ */
+static void thashx8_sha512(unsigned char *out[8], unsigned char *const in[8],
+			   unsigned int inblocks, const spx_ctx *ctx,
+			   const uint32_t addrx8[8 * 8])
+{
+	uint8_t tmp[8][LC_SPX_N];
+	unsigned int j;
+
+	for (j = 0; j < 8; j++)
+		thash_sha512(tmp[j], in[j], inblocks, ctx, addrx8 + j * 8);
+	for (j = 0; j < 8; j++)
+		memcpy(out[j], tmp[j], LC_SPX_N);
+}
+#endif
+
+/**
+ * 8-way parallel version of thash; takes 8x as much input and output
+ */
+void thashx8_12(unsigned char *out[8], unsigned char *const in[8],
+		unsigned int inblocks, const spx_ctx *ctx,
+		uint32_t addrx8[8 * 8])
+{
+	uint8_t buf[8][LC_SPX_SHA256_ADDR_BYTES + 2 * LC_SPX_N];
+	const uint8_t *bufs[8];
+	unsigned int j;
+
+#if LC_SPX_N >= 24
+	if (inblocks > 1) {
+		thashx8_sha512(out, in, inblocks, ctx, addrx8);
+		return;
+	}
+#endif
+
+	for (j = 0; j < 8; j++) {
+		memcpy(buf[j], addrx8 + j * 8, LC_SPX_SHA256_ADDR_BYTES);
+		memcpy(buf[j] + LC_SPX_SHA256_ADDR_BYTES, in[j],
+		       inblocks * LC_SPX_N);
+		bufs[j] = buf[j];
+	}
+
+	sha256x8_seeded(out, LC_SPX_N, &ctx->state_seeded, bufs,
+			LC_SPX_SHA256_ADDR_BYTES + inblocks * LC_SPX_N);
+}
+
+void thashx8(unsigned char *out[8], unsigned char *const in[8],
+	     unsigned int inblocks, const spx_ctx *ctx, uint32_t addrx8[8 * 8],
+	     uint8_t *thash_buf)
+{
+	const uint8_t *bufs[8];
+	unsigned int j;
+
+#if LC_SPX_N >= 24
+	if (inblocks > 1) {
+		thashx8_sha512(out, in, inblocks, ctx, addrx8);
+		return;
+	}
+#endif
+
+	for (j = 0; j < 8; j++) {
+		uint8_t *buf = thash_buf + j * LC_THASHX8_BUFLEN;
+
+		memcpy(buf, addrx8 + j * 8, LC_SPX_SHA256_ADDR_BYTES);
+		memcpy(buf + LC_SPX_SHA256_ADDR_BYTES, in[j],
+		       inblocks * LC_SPX_N);
+		bufs[j] = buf;
+	}
+
+	sha256x8_seeded(out, LC_SPX_N, &ctx->state_seeded, bufs,
+			LC_SPX_SHA256_ADDR_BYTES + inblocks * LC_SPX_N);
+}
@@ -176,3 +176,16 @@ void treehashx4(
 		memcpy(&stackx4[h * 4 * LC_SPX_N], current_idx, 4 * LC_SPX_N);
 	}
 }
+
+void thashx4_batch(uint8_t *out[4], uint8_t *const in[4],
+		   unsigned int inblocks, const spx_ctx *ctx,
+		   uint32_t addrx4[4 * 8], uint8_t *thash_buf)
+{
+	if (inblocks <= 2) {
+		thashx4_12(out[0], out[1], out[2], out[3], in[0], in[1], in[2],
+			   in[3], inblocks, ctx, addrx4);
+	} else {
+		thashx4(out[0], out[1], out[2], out[3], in[0], in[1], in[2],
+			in[3], inblocks, ctx, addrx4, thash_buf);
+	}
+}
@@ -53,6 +53,14 @@ void treehashx4(
 	uint32_t tree_addrx4[4 * 8], void *info, uint8_t *stackx4, void *ws_buf,
 	uint8_t *thash_buf);
 
+/**
+ * Compute the tweakable hash of 4 independent inputs, one per lane. This is
+ * used to process 4 signatures in lockstep during batch verification.
+ */
+void thashx4_batch(uint8_t *out[4], uint8_t *const in[4],
+		   unsigned int inblocks, const spx_ctx *ctx,
+		   uint32_t addrx4[4 * 8], uint8_t *thash_buf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "ext_headers_x86.h"
+#include "shake_8x_avx512.h"
+#include "sphincs_type.h"
+#include "sphincs_address.h"
+#include "x8/sphincs_thashx8.h"
+#include "sphincs_utils.h"
+
+#define KeccakF1600_StatePermute8x KeccakP1600times8_PermuteAll_24rounds
+extern void KeccakF1600_StatePermute8x(__m512i *s);
+
+/**
+ * 8-way parallel version of thash; takes 8x as much input and output
+ */
+void thashx8_12(unsigned char *out[8], unsigned char *const in[8],
+		unsigned int inblocks, const spx_ctx *ctx,
+		uint32_t addrx8[8 * 8])
+{
+	uint64_t lanes[8];
+	unsigned int i, j;
+
+	/*
+	 * As we write and read only a few quadwords, it is more efficient to
+	 * build and extract from the eightway SHAKE256 state by hand.
+	 */
+	__m512i state[25];
+
+	LC_FPU_ENABLE;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+	for (i = 0; i < LC_SPX_N / 8; i++)
+		state[i] = _mm512_set1_epi64(((int64_t *)ctx->pub_seed)[i]);
+#pragma GCC diagnostic pop
+
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 8; j++) {
+			lanes[j] = (uint64_t)addrx8[j * 8 + 2 * i] |
+				   ((uint64_t)addrx8[j * 8 + 1 + 2 * i] << 32);
+		}
+		state[LC_SPX_N / 8 + i] = _mm512_loadu_si512((const void *)lanes);
+	}
+
+	for (i = 0; i < (LC_SPX_N / 8) * inblocks; i++) {
+		for (j = 0; j < 8; j++)
+			memcpy(&lanes[j], in[j] + 8 * i, sizeof(uint64_t));
+		state[LC_SPX_N / 8 + 4 + i] =
+			_mm512_loadu_si512((const void *)lanes);
+	}
+
+	/* Domain separator and padding. */
+	for (i = (LC_SPX_N / 8) * (1 + inblocks) + 4; i < 16; i++)
+		state[i] = _mm512_setzero_si512();
+
+	state[16] = _mm512_set1_epi64((long long)(0x80ULL << 56));
+
+	state[(LC_SPX_N / 8) * (1 + inblocks) + 4] =
+		_mm512_xor_si512(state[(LC_SPX_N / 8) * (1 + inblocks) + 4],
+				 _mm512_set1_epi64(0x1f));
+	for (i = 17; i < 25; i++)
+		state[i] = _mm512_setzero_si512();
+
+	KeccakF1600_StatePermute8x(&state[0]);
+
+	for (i = 0; i < LC_SPX_N / 8; i++) {
+		_mm512_storeu_si512((void *)lanes, state[i]);
+		for (j = 0; j < 8; j++)
+			memcpy(out[j] + 8 * i, &lanes[j], sizeof(uint64_t));
+	}
+
+	LC_FPU_DISABLE;
+}
+
+void thashx8(unsigned char *out[8], unsigned char *const in[8],
+	     unsigned int inblocks, const spx_ctx *ctx, uint32_t addrx8[8 * 8],
+	     uint8_t *thash_buf)
+{
+	const uint8_t *bufs[8];
+	unsigned int j;
+
+	for (j = 0; j < 8; j++) {
+		uint8_t *buf = thash_buf + j * LC_THASHX8_BUFLEN;
+
+		memcpy(buf, ctx->pub_seed, LC_SPX_N);
+		memcpy(buf + LC_SPX_N, addrx8 + j * 8, LC_SPX_ADDR_BYTES);
+		memcpy(buf + LC_SPX_N + LC_SPX_ADDR_BYTES, in[j],
+		       inblocks * LC_SPX_N);
+		bufs[j] = buf;
+	}
+
+	shake256x8(out, LC_SPX_N, bufs,
+		   LC_SPX_N + LC_SPX_ADDR_BYTES + inblocks * LC_SPX_N);
+}
@@ -29,7 +29,12 @@
 
 #include "bitshift_be.h"
 #include "ext_headers_internal.h"
+#include "sphincs_type.h"
+#ifdef LC_SPHINCS_SHA2
+#include "sphincs_sha2_offsets.h"
+#else
 #include "sphincs_shake_offsets.h"
+#endif
 #include "sphincs_utils.h"
 
 #ifdef __cplusplus
@@ -106,6 +106,15 @@ LC_INTERFACE_FUNCTION(void, lc_sphincs_ctx_userctx, struct lc_sphincs_ctx *ctx,
 	}
 }
 
+LC_INTERFACE_FUNCTION(void, lc_sphincs_ctx_executor, struct lc_sphincs_ctx *ctx,
+		      lc_sphincs_executor_f executor, void *executor_data)
+{
+	if (ctx) {
+		ctx->executor = executor;
+		ctx->executor_data = executor_data;
+	}
+}
+
 LC_INTERFACE_FUNCTION(enum lc_sphincs_type, lc_sphincs_sk_type,
 		      const struct lc_sphincs_sk *sk)
 {
@@ -832,6 +841,81 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair, struct lc_sphincs_pk *pk,
 	}
 }
 
+LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair_ctx, struct lc_sphincs_pk *pk,
+		      struct lc_sphincs_sk *sk, struct lc_sphincs_ctx *ctx,
+		      struct lc_rng_ctx *rng_ctx,
+		      enum lc_sphincs_type sphincs_type)
+{
+	if (!pk || !sk || !rng_ctx)
+		return -EINVAL;
+
+	switch (sphincs_type) {
+	case LC_SPHINCS_SHAKE_256s:
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+		pk->sphincs_type = sphincs_type;
+		sk->sphincs_type = sphincs_type;
+		return lc_sphincs_shake_256s_keypair_ctx(
+			&pk->key.pk_shake_256s, &sk->key.sk_shake_256s, ctx,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_256f:
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+		pk->sphincs_type = sphincs_type;
+		sk->sphincs_type = sphincs_type;
+		return lc_sphincs_shake_256f_keypair_ctx(
+			&pk->key.pk_shake_256f, &sk->key.sk_shake_256f, ctx,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192s:
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+		pk->sphincs_type = sphincs_type;
+		sk->sphincs_type = sphincs_type;
+		return lc_sphincs_shake_192s_keypair_ctx(
+			&pk->key.pk_shake_192s, &sk->key.sk_shake_192s, ctx,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192f:
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+		pk->sphincs_type = sphincs_type;
+		sk->sphincs_type = sphincs_type;
+		return lc_sphincs_shake_192f_keypair_ctx(
+			&pk->key.pk_shake_192f, &sk->key.sk_shake_192f, ctx,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128s:
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+		pk->sphincs_type = sphincs_type;
+		sk->sphincs_type = sphincs_type;
+		return lc_sphincs_shake_128s_keypair_ctx(
+			&pk->key.pk_shake_128s, &sk->key.sk_shake_128s, ctx,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128f:
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+		pk->sphincs_type = sphincs_type;
+		sk->sphincs_type = sphincs_type;
+		return lc_sphincs_shake_128f_keypair_ctx(
+			&pk->key.pk_shake_128f, &sk->key.sk_shake_128f, ctx,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair_from_seed,
 		      struct lc_sphincs_pk *pk, struct lc_sphincs_sk *sk,
 		      const uint8_t *seed, size_t seedlen,
@@ -1057,6 +1141,305 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_ctx, struct lc_sphincs_sig *sig,
 	}
 }
 
+LC_INTERFACE_FUNCTION(void, lc_sphincs_prepared_sk_zero_free,
+		      struct lc_sphincs_prepared_sk *prepared_sk)
+{
+	if (!prepared_sk)
+		return;
+
+	switch (prepared_sk->sphincs_type) {
+	case LC_SPHINCS_SHAKE_256s:
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+		lc_sphincs_shake_256s_prepared_sk_zero_free(
+			prepared_sk->key.prepared_sk_shake_256s);
+#endif
+		break;
+	case LC_SPHINCS_SHAKE_256f:
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+		lc_sphincs_shake_256f_prepared_sk_zero_free(
+			prepared_sk->key.prepared_sk_shake_256f);
+#endif
+		break;
+	case LC_SPHINCS_SHAKE_192s:
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+		lc_sphincs_shake_192s_prepared_sk_zero_free(
+			prepared_sk->key.prepared_sk_shake_192s);
+#endif
+		break;
+	case LC_SPHINCS_SHAKE_192f:
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+		lc_sphincs_shake_192f_prepared_sk_zero_free(
+			prepared_sk->key.prepared_sk_shake_192f);
+#endif
+		break;
+	case LC_SPHINCS_SHAKE_128s:
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+		lc_sphincs_shake_128s_prepared_sk_zero_free(
+			prepared_sk->key.prepared_sk_shake_128s);
+#endif
+		break;
+	case LC_SPHINCS_SHAKE_128f:
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+		lc_sphincs_shake_128f_prepared_sk_zero_free(
+			prepared_sk->key.prepared_sk_shake_128f);
+#endif
+		break;
+	case LC_SPHINCS_UNKNOWN:
+	default:
+		break;
+	}
+
+	lc_memset_secure(prepared_sk, 0, sizeof(*prepared_sk));
+	lc_free(prepared_sk);
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_prepared_sk_alloc,
+		      struct lc_sphincs_prepared_sk **prepared_sk,
+		      const struct lc_sphincs_sk *sk, unsigned int layers)
+{
+	struct lc_sphincs_prepared_sk *out_sk = NULL;
+	int ret;
+
+	if (!prepared_sk || !sk)
+		return -EINVAL;
+
+	ret = lc_alloc_aligned((void **)&out_sk, sizeof(uint64_t),
+			       sizeof(struct lc_sphincs_prepared_sk));
+	if (ret)
+		return -ret;
+
+	/* Only set the type once the key of that type is allocated */
+	out_sk->sphincs_type = LC_SPHINCS_UNKNOWN;
+
+	switch (sk->sphincs_type) {
+	case LC_SPHINCS_SHAKE_256s:
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+		ret = lc_sphincs_shake_256s_prepared_sk_alloc(
+			&out_sk->key.prepared_sk_shake_256s,
+			&sk->key.sk_shake_256s, layers);
+		break;
+#else
+		ret = -EOPNOTSUPP;
+		break;
+#endif
+	case LC_SPHINCS_SHAKE_256f:
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+		ret = lc_sphincs_shake_256f_prepared_sk_alloc(
+			&out_sk->key.prepared_sk_shake_256f,
+			&sk->key.sk_shake_256f, layers);
+		break;
+#else
+		ret = -EOPNOTSUPP;
+		break;
+#endif
+	case LC_SPHINCS_SHAKE_192s:
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+		ret = lc_sphincs_shake_192s_prepared_sk_alloc(
+			&out_sk->key.prepared_sk_shake_192s,
+			&sk->key.sk_shake_192s, layers);
+		break;
+#else
+		ret = -EOPNOTSUPP;
+		break;
+#endif
+	case LC_SPHINCS_SHAKE_192f:
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+		ret = lc_sphincs_shake_192f_prepared_sk_alloc(
+			&out_sk->key.prepared_sk_shake_192f,
+			&sk->key.sk_shake_192f, layers);
+		break;
+#else
+		ret = -EOPNOTSUPP;
+		break;
+#endif
+	case LC_SPHINCS_SHAKE_128s:
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+		ret = lc_sphincs_shake_128s_prepared_sk_alloc(
+			&out_sk->key.prepared_sk_shake_128s,
+			&sk->key.sk_shake_128s, layers);
+		break;
+#else
+		ret = -EOPNOTSUPP;
+		break;
+#endif
+	case LC_SPHINCS_SHAKE_128f:
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+		ret = lc_sphincs_shake_128f_prepared_sk_alloc(
+			&out_sk->key.prepared_sk_shake_128f,
+			&sk->key.sk_shake_128f, layers);
+		break;
+#else
+		ret = -EOPNOTSUPP;
+		break;
+#endif
+	case LC_SPHINCS_UNKNOWN:
+	default:
+		ret = -EOPNOTSUPP;
+		break;
+	}
+
+	if (ret) {
+		lc_sphincs_prepared_sk_zero_free(out_sk);
+		return ret;
+	}
+
+	out_sk->sphincs_type = sk->sphincs_type;
+	*prepared_sk = out_sk;
+
+	return 0;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_prepared, struct lc_sphincs_sig *sig,
+		      const uint8_t *m, size_t mlen,
+		      const struct lc_sphincs_prepared_sk *prepared_sk,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	if (!prepared_sk || !sig)
+		return -EINVAL;
+
+	switch (prepared_sk->sphincs_type) {
+	case LC_SPHINCS_SHAKE_256s:
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_256s;
+		return lc_sphincs_shake_256s_sign_prepared(
+			&sig->sig.sig_shake_256s, m, mlen,
+			prepared_sk->key.prepared_sk_shake_256s,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_256f:
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_256f;
+		return lc_sphincs_shake_256f_sign_prepared(
+			&sig->sig.sig_shake_256f, m, mlen,
+			prepared_sk->key.prepared_sk_shake_256f,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192s:
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_192s;
+		return lc_sphincs_shake_192s_sign_prepared(
+			&sig->sig.sig_shake_192s, m, mlen,
+			prepared_sk->key.prepared_sk_shake_192s,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192f:
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_192f;
+		return lc_sphincs_shake_192f_sign_prepared(
+			&sig->sig.sig_shake_192f, m, mlen,
+			prepared_sk->key.prepared_sk_shake_192f,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128s:
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_128s;
+		return lc_sphincs_shake_128s_sign_prepared(
+			&sig->sig.sig_shake_128s, m, mlen,
+			prepared_sk->key.prepared_sk_shake_128s,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128f:
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_128f;
+		return lc_sphincs_shake_128f_sign_prepared(
+			&sig->sig.sig_shake_128f, m, mlen,
+			prepared_sk->key.prepared_sk_shake_128f,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_prepared_ctx,
+		      struct lc_sphincs_sig *sig, struct lc_sphincs_ctx *ctx,
+		      const uint8_t *m, size_t mlen,
+		      const struct lc_sphincs_prepared_sk *prepared_sk,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	if (!prepared_sk || !sig)
+		return -EINVAL;
+
+	switch (prepared_sk->sphincs_type) {
+	case LC_SPHINCS_SHAKE_256s:
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_256s;
+		return lc_sphincs_shake_256s_sign_prepared_ctx(
+			&sig->sig.sig_shake_256s, ctx, m, mlen,
+			prepared_sk->key.prepared_sk_shake_256s,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_256f:
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_256f;
+		return lc_sphincs_shake_256f_sign_prepared_ctx(
+			&sig->sig.sig_shake_256f, ctx, m, mlen,
+			prepared_sk->key.prepared_sk_shake_256f,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192s:
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_192s;
+		return lc_sphincs_shake_192s_sign_prepared_ctx(
+			&sig->sig.sig_shake_192s, ctx, m, mlen,
+			prepared_sk->key.prepared_sk_shake_192s,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192f:
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_192f;
+		return lc_sphincs_shake_192f_sign_prepared_ctx(
+			&sig->sig.sig_shake_192f, ctx, m, mlen,
+			prepared_sk->key.prepared_sk_shake_192f,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128s:
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_128s;
+		return lc_sphincs_shake_128s_sign_prepared_ctx(
+			&sig->sig.sig_shake_128s, ctx, m, mlen,
+			prepared_sk->key.prepared_sk_shake_128s,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128f:
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+		sig->sphincs_type = LC_SPHINCS_SHAKE_128f;
+		return lc_sphincs_shake_128f_sign_prepared_ctx(
+			&sig->sig.sig_shake_128f, ctx, m, mlen,
+			prepared_sk->key.prepared_sk_shake_128f,
+			rng_ctx);
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_init, struct lc_sphincs_ctx *ctx,
 		      const struct lc_sphincs_sk *sk)
 {
@@ -1326,6 +1709,207 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_ctx,
 	}
 }
 
+/*
+ * Number of signatures converted from the generic to the type-specific
+ * representation at once.
+ */
+#define LC_SPHINCS_VERIFY_BATCH_CHUNK 8
+
+static int lc_sphincs_verify_batch_chunk(
+	int *res, const struct lc_sphincs_sig *const *sig,
+	struct lc_sphincs_ctx *ctx, const uint8_t *const *m,
+	const size_t *mlen, unsigned int num, const struct lc_sphincs_pk *pk)
+{
+	unsigned int i;
+
+	for (i = 0; i < num; i++) {
+		if (!sig[i] || sig[i]->sphincs_type != pk->sphincs_type)
+			return -EINVAL;
+	}
+
+	switch (pk->sphincs_type) {
+	case LC_SPHINCS_SHAKE_256s:
+#ifdef LC_SPHINCS_SHAKE_256s_ENABLED
+	{
+		const struct lc_sphincs_shake_256s_sig
+			*sig_shake_256s[LC_SPHINCS_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			sig_shake_256s[i] = &sig[i]->sig.sig_shake_256s;
+
+		if (ctx) {
+			return lc_sphincs_shake_256s_verify_batch_ctx(
+				res, sig_shake_256s, ctx, m, mlen, num,
+				&pk->key.pk_shake_256s);
+		}
+		return lc_sphincs_shake_256s_verify_batch(res, sig_shake_256s, m,
+							 mlen, num,
+							 &pk->key.pk_shake_256s);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_256f:
+#ifdef LC_SPHINCS_SHAKE_256f_ENABLED
+	{
+		const struct lc_sphincs_shake_256f_sig
+			*sig_shake_256f[LC_SPHINCS_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			sig_shake_256f[i] = &sig[i]->sig.sig_shake_256f;
+
+		if (ctx) {
+			return lc_sphincs_shake_256f_verify_batch_ctx(
+				res, sig_shake_256f, ctx, m, mlen, num,
+				&pk->key.pk_shake_256f);
+		}
+		return lc_sphincs_shake_256f_verify_batch(res, sig_shake_256f, m,
+							 mlen, num,
+							 &pk->key.pk_shake_256f);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192s:
+#ifdef LC_SPHINCS_SHAKE_192s_ENABLED
+	{
+		const struct lc_sphincs_shake_192s_sig
+			*sig_shake_192s[LC_SPHINCS_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			sig_shake_192s[i] = &sig[i]->sig.sig_shake_192s;
+
+		if (ctx) {
+			return lc_sphincs_shake_192s_verify_batch_ctx(
+				res, sig_shake_192s, ctx, m, mlen, num,
+				&pk->key.pk_shake_192s);
+		}
+		return lc_sphincs_shake_192s_verify_batch(res, sig_shake_192s, m,
+							 mlen, num,
+							 &pk->key.pk_shake_192s);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_192f:
+#ifdef LC_SPHINCS_SHAKE_192f_ENABLED
+	{
+		const struct lc_sphincs_shake_192f_sig
+			*sig_shake_192f[LC_SPHINCS_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			sig_shake_192f[i] = &sig[i]->sig.sig_shake_192f;
+
+		if (ctx) {
+			return lc_sphincs_shake_192f_verify_batch_ctx(
+				res, sig_shake_192f, ctx, m, mlen, num,
+				&pk->key.pk_shake_192f);
+		}
+		return lc_sphincs_shake_192f_verify_batch(res, sig_shake_192f, m,
+							 mlen, num,
+							 &pk->key.pk_shake_192f);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128s:
+#ifdef LC_SPHINCS_SHAKE_128s_ENABLED
+	{
+		const struct lc_sphincs_shake_128s_sig
+			*sig_shake_128s[LC_SPHINCS_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			sig_shake_128s[i] = &sig[i]->sig.sig_shake_128s;
+
+		if (ctx) {
+			return lc_sphincs_shake_128s_verify_batch_ctx(
+				res, sig_shake_128s, ctx, m, mlen, num,
+				&pk->key.pk_shake_128s);
+		}
+		return lc_sphincs_shake_128s_verify_batch(res, sig_shake_128s, m,
+							 mlen, num,
+							 &pk->key.pk_shake_128s);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_SHAKE_128f:
+#ifdef LC_SPHINCS_SHAKE_128f_ENABLED
+	{
+		const struct lc_sphincs_shake_128f_sig
+			*sig_shake_128f[LC_SPHINCS_VERIFY_BATCH_CHUNK];
+
+		for (i = 0; i < num; i++)
+			sig_shake_128f[i] = &sig[i]->sig.sig_shake_128f;
+
+		if (ctx) {
+			return lc_sphincs_shake_128f_verify_batch_ctx(
+				res, sig_shake_128f, ctx, m, mlen, num,
+				&pk->key.pk_shake_128f);
+		}
+		return lc_sphincs_shake_128f_verify_batch(res, sig_shake_128f, m,
+							 mlen, num,
+							 &pk->key.pk_shake_128f);
+	}
+#else
+		return -EOPNOTSUPP;
+#endif
+	case LC_SPHINCS_UNKNOWN:
+	default:
+		return -EOPNOTSUPP;
+	}
+}
+
+static int lc_sphincs_verify_batch_common(
+	int *res, const struct lc_sphincs_sig *const *sig,
+	struct lc_sphincs_ctx *ctx, const uint8_t *const *m,
+	const size_t *mlen, unsigned int num, const struct lc_sphincs_pk *pk)
+{
+	unsigned int i, n;
+	int ret = 0, tmp;
+
+	if (!pk || !sig || !m || !mlen)
+		return -EINVAL;
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > LC_SPHINCS_VERIFY_BATCH_CHUNK)
+			n = LC_SPHINCS_VERIFY_BATCH_CHUNK;
+
+		tmp = lc_sphincs_verify_batch_chunk(res ? res + i : NULL,
+						    sig + i, ctx, m + i,
+						    mlen + i, n, pk);
+		if (tmp == -EBADMSG)
+			ret = tmp;
+		else if (tmp)
+			return tmp;
+	}
+
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_batch, int *res,
+		      const struct lc_sphincs_sig *const *sig,
+		      const uint8_t *const *m, const size_t *mlen,
+		      unsigned int num, const struct lc_sphincs_pk *pk)
+{
+	return lc_sphincs_verify_batch_common(res, sig, NULL, m, mlen, num,
+					      pk);
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_batch_ctx, int *res,
+		      const struct lc_sphincs_sig *const *sig,
+		      struct lc_sphincs_ctx *ctx, const uint8_t *const *m,
+		      const size_t *mlen, unsigned int num,
+		      const struct lc_sphincs_pk *pk)
+{
+	if (!ctx)
+		return -EINVAL;
+
+	return lc_sphincs_verify_batch_common(res, sig, ctx, m, mlen, num,
+					      pk);
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_init, struct lc_sphincs_ctx *ctx,
 		      const struct lc_sphincs_pk *pk)
 {
@@ -52,7 +52,7 @@ static int fors_sk_to_leaf(uint8_t *leaf, const uint8_t *sk, const spx_ctx *ctx,
 	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPHINCS_HASH_TYPE);
 	int ret;
 
-	CKINT(thash(hash_ctx, leaf, sk, 1, ctx->pub_seed, fors_leaf_addr));
+	CKINT(thash(hash_ctx, leaf, sk, 1, ctx, fors_leaf_addr));
 	lc_hash_zero(hash_ctx);
 
 out:
@@ -104,26 +104,27 @@ static void message_to_indices(uint32_t *indices,
 }
 
 /**
- * Signs a message m, deriving the secret key from sk_seed and the FTS address.
+ * Signs the FORS trees [first, first + num) of the message m, deriving the
+ * secret key from sk_seed and the FTS address. The signature parts and roots
+ * are written to the positions of the respective trees in sig and roots.
  * Assumes m contains at least LC_SPX_FORS_HEIGHT * LC_SPX_FORS_TREES bits.
  */
-int fors_sign_c(uint8_t sig[LC_SPX_FORS_BYTES], uint8_t pk[LC_SPX_N],
-		const uint8_t m[LC_SPX_FORS_MSG_BYTES], const spx_ctx *ctx,
-		const uint32_t fors_addr[8])
+int fors_sign_trees_c(uint8_t sig[LC_SPX_FORS_BYTES],
+		      uint8_t roots[LC_SPX_FORS_TREES * LC_SPX_N],
+		      const uint8_t m[LC_SPX_FORS_MSG_BYTES],
+		      const spx_ctx *ctx, const uint32_t fors_addr[8],
+		      unsigned int first, unsigned int num)
 {
 	struct workspace {
 		uint32_t indices[LC_SPX_FORS_TREES];
 		uint32_t fors_tree_addr[8];
-		uint32_t fors_pk_addr[8];
 		struct fors_gen_leaf_info fors_info;
-		uint8_t roots[LC_SPX_FORS_TREES * LC_SPX_N];
 		uint8_t treehash_stack_sp[LC_SPX_FORS_HEIGHT * LC_SPX_N];
 	};
 	uint32_t *fors_leaf_addr;
 	uint32_t idx_offset;
 	unsigned int i;
 	int ret = 0;
-	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPHINCS_HASH_TYPE);
 	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
 
 	fors_leaf_addr = ws->fors_info.leaf_addrx;
@@ -131,12 +132,10 @@ int fors_sign_c(uint8_t sig[LC_SPX_FORS_BYTES], uint8_t pk[LC_SPX_N],
 	copy_keypair_addr(ws->fors_tree_addr, fors_addr);
 	copy_keypair_addr(fors_leaf_addr, fors_addr);
 
-	copy_keypair_addr(ws->fors_pk_addr, fors_addr);
-	set_type(ws->fors_pk_addr, LC_SPX_ADDR_TYPE_FORSPK);
-
 	message_to_indices(ws->indices, m);
 
-	for (i = 0; i < LC_SPX_FORS_TREES; i++) {
+	sig += first * LC_SPX_N * (LC_SPX_FORS_HEIGHT + 1);
+	for (i = first; i < first + num && i < LC_SPX_FORS_TREES; i++) {
 		idx_offset = i * (1 << LC_SPX_FORS_HEIGHT);
 
 		set_tree_height(ws->fors_tree_addr, 0);
@@ -155,7 +154,7 @@ int fors_sign_c(uint8_t sig[LC_SPX_FORS_BYTES], uint8_t pk[LC_SPX_N],
 		 * the additional parameters as thash_ascon which would
 		 * seem to convolute the code.
 		 */
-		CKINT(treehashx1(ws->roots + i * LC_SPX_N, sig, ctx,
+		CKINT(treehashx1(roots + i * LC_SPX_N, sig, ctx,
 				 ws->indices[i], idx_offset, LC_SPX_FORS_HEIGHT,
 				 ws->treehash_stack_sp, fors_gen_leafx1,
 				 ws->fors_tree_addr, &ws->fors_info));
@@ -163,14 +162,53 @@ int fors_sign_c(uint8_t sig[LC_SPX_FORS_BYTES], uint8_t pk[LC_SPX_N],
 		sig += LC_SPX_N * LC_SPX_FORS_HEIGHT;
 	}
 
-	/* Hash horizontally across all tree roots to derive the public key. */
-	CKINT(thash(hash_ctx, pk, ws->roots, LC_SPX_FORS_TREES, ctx->pub_seed,
-		    ws->fors_pk_addr));
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+/**
+ * Hash horizontally across all FORS tree roots to derive the public key.
+ */
+int fors_roots_to_pk(uint8_t pk[LC_SPX_N],
+		     const uint8_t roots[LC_SPX_FORS_TREES * LC_SPX_N],
+		     const spx_ctx *ctx, const uint32_t fors_addr[8])
+{
+	uint32_t fors_pk_addr[8] = { 0 };
+	int ret;
+	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPHINCS_HASH_TYPE);
+
+	copy_keypair_addr(fors_pk_addr, fors_addr);
+	set_type(fors_pk_addr, LC_SPX_ADDR_TYPE_FORSPK);
+
+	CKINT(thash(hash_ctx, pk, roots, LC_SPX_FORS_TREES, ctx, fors_pk_addr));
 
 out:
 	lc_hash_zero(hash_ctx);
+	return ret;
+}
+
+/**
+ * Signs a message m, deriving the secret key from sk_seed and the FTS address.
+ * Assumes m contains at least LC_SPX_FORS_HEIGHT * LC_SPX_FORS_TREES bits.
+ */
+int fors_sign_c(uint8_t sig[LC_SPX_FORS_BYTES], uint8_t pk[LC_SPX_N],
+		const uint8_t m[LC_SPX_FORS_MSG_BYTES], const spx_ctx *ctx,
+		const uint32_t fors_addr[8])
+{
+	struct workspace {
+		uint8_t roots[LC_SPX_FORS_TREES * LC_SPX_N];
+	};
+	int ret;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	CKINT(fors_sign_trees_c(sig, ws->roots, m, ctx, fors_addr, 0,
+				LC_SPX_FORS_TREES));
+	CKINT(fors_roots_to_pk(pk, ws->roots, ctx, fors_addr));
+
+out:
 	LC_RELEASE_MEM(ws);
-	return 0;
+	return ret;
 }
 
 /**
@@ -219,13 +257,13 @@ int fors_pk_from_sig_c(uint8_t pk[LC_SPX_N],
 		/* Derive the corresponding root node of this tree. */
 		CKINT(compute_root(ws->roots + i * LC_SPX_N, ws->leaf,
 				   ws->indices[i], idx_offset, sig,
-				   LC_SPX_FORS_HEIGHT, ctx->pub_seed,
+				   LC_SPX_FORS_HEIGHT, ctx,
 				   ws->fors_tree_addr));
 		sig += LC_SPX_N * LC_SPX_FORS_HEIGHT;
 	}
 
 	/* Hash horizontally across all tree roots to derive the public key. */
-	CKINT(thash(hash_ctx, pk, ws->roots, LC_SPX_FORS_TREES, ctx->pub_seed,
+	CKINT(thash(hash_ctx, pk, ws->roots, LC_SPX_FORS_TREES, ctx,
 		    ws->fors_pk_addr));
 
 out:
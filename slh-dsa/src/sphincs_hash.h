@@ -27,20 +27,63 @@
 #ifndef SPHINCS_HASH_H
 #define SPHINCS_HASH_H
 
+#include "lc_memset_secure.h"
 #include "ret_checkers.h"
 #include "sphincs_type.h"
+#include "sphincs_address.h"
 #include "sphincs_internal.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#ifdef LC_SPHINCS_SHA2
+
+/*
+ * Precompute the SHA-256 (and SHA-512) states after absorbing the PK.seed
+ * padded to a full block.
+ */
+int initialize_hash_function(spx_ctx *ctx);
+
+/*
+ * Load the precomputed PK.seed state into the SHA-256 context - the seeded
+ * state has no buffered data, thus the partial block need not be copied.
+ */
+static inline void sphincs_sha256_seeded(struct lc_hash_ctx *hash_ctx,
+					 const spx_ctx *ctx)
+{
+	memcpy(hash_ctx->hash_state, &ctx->state_seeded,
+	       offsetof(struct lc_sha256_state, partial));
+}
+
+#else
+
+static inline int initialize_hash_function(spx_ctx *ctx)
+{
+	(void)ctx;
+	return 0;
+}
+
+#endif
+
 /*
  * Computes PRF(pk_seed, sk_seed, addr)
  */
 static inline int prf_addr(struct lc_hash_ctx *hash_ctx, uint8_t out[LC_SPX_N],
 			   const spx_ctx *ctx, const uint32_t addr[8])
 {
+#ifdef LC_SPHINCS_SHA2
+	uint8_t digest[LC_SHA256_SIZE_DIGEST];
+
+	sphincs_sha256_seeded(hash_ctx, ctx);
+	lc_hash_update(hash_ctx, (uint8_t *)addr, LC_SPX_SHA256_ADDR_BYTES);
+	lc_hash_update(hash_ctx, ctx->sk_seed, LC_SPX_N);
+	lc_hash_final(hash_ctx, digest);
+	memcpy(out, digest, LC_SPX_N);
+	lc_memset_secure(digest, 0, sizeof(digest));
+
+	return 0;
+#else
 	int ret;
 
 	CKINT(lc_hash_init(hash_ctx));
@@ -52,6 +95,7 @@ static inline int prf_addr(struct lc_hash_ctx *hash_ctx, uint8_t out[LC_SPX_N],
 
 out:
 	return ret;
+#endif
 }
 
 static inline int prf_addr_ascon(struct lc_hash_ctx *hash_ctx,
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "bitshift_be.h"
+#include "lc_hmac.h"
+#include "lc_memset_secure.h"
+#include "lc_sha256.h"
+#include "lc_sha512.h"
+#include "signature_domain_separation.h"
+#include "sphincs_type.h"
+#include "sphincs_hash.h"
+#include "sphincs_address.h"
+#include "sphincs_utils.h"
+#include "ret_checkers.h"
+
+/*
+ * Category 1 uses SHA-256 for PRF_msg and H_msg, categories 3 and 5 use
+ * SHA-512 (FIPS 205 section 11.2).
+ */
+#if LC_SPX_N >= 24
+#define LC_SPX_SHAX lc_sha512
+#define LC_SPX_SHAX_SIZE_DIGEST LC_SHA512_SIZE_DIGEST
+#else
+#define LC_SPX_SHAX lc_sha256
+#define LC_SPX_SHAX_SIZE_DIGEST LC_SHA256_SIZE_DIGEST
+#endif
+
+int initialize_hash_function(spx_ctx *ctx)
+{
+	static const uint8_t zero[LC_SHA512_SIZE_BLOCK] = { 0 };
+	int ret;
+	LC_HASH_CTX_ON_STACK(sha256, lc_sha256);
+
+	/* SHA-256(PK.seed || toByte(0, 64 - n)) */
+	CKINT(lc_hash_init(sha256));
+	lc_hash_update(sha256, ctx->pub_seed, LC_SPX_N);
+	lc_hash_update(sha256, zero, LC_SHA256_SIZE_BLOCK - LC_SPX_N);
+	memcpy(&ctx->state_seeded, sha256->hash_state,
+	       sizeof(ctx->state_seeded));
+
+#if LC_SPX_N >= 24
+	{
+		LC_HASH_CTX_ON_STACK(sha512, lc_sha512);
+
+		/* SHA-512(PK.seed || toByte(0, 128 - n)) */
+		CKINT(lc_hash_init(sha512));
+		lc_hash_update(sha512, ctx->pub_seed, LC_SPX_N);
+		lc_hash_update(sha512, zero, LC_SHA512_SIZE_BLOCK - LC_SPX_N);
+		memcpy(&ctx->state_seeded_512, sha512->hash_state,
+		       sizeof(ctx->state_seeded_512));
+		lc_hash_zero(sha512);
+	}
+#endif
+
+out:
+	lc_hash_zero(sha256);
+	return ret;
+}
+
+/**
+ * Computes the message-dependent randomness R, using a secret seed and an
+ * optional randomization value as well as the message.
+ *
+ * PRF_msg(SK.prf, opt_rand, M) = HMAC-SHA-X(SK.prf, opt_rand || M)
+ */
+int gen_message_random(uint8_t R[LC_SPX_N], const uint8_t sk_prf[LC_SPX_N],
+		       const uint8_t optrand[LC_SPX_N], const uint8_t *m,
+		       size_t mlen, struct lc_sphincs_ctx *ctx)
+{
+	uint8_t mac[LC_SPX_SHAX_SIZE_DIGEST];
+	int ret;
+	LC_HMAC_CTX_ON_STACK(hmac_ctx, LC_SPX_SHAX);
+
+	CKINT(lc_hmac_init(hmac_ctx, sk_prf, LC_SPX_N));
+	lc_hmac_update(hmac_ctx, optrand, LC_SPX_N);
+
+	/* The message is absorbed by the inner hash of the HMAC */
+	CKINT(signature_domain_separation(
+		&hmac_ctx->hash_ctx, ctx->slh_dsa_internal,
+		ctx->sphincs_prehash_type, ctx->userctx, ctx->userctxlen, m,
+		mlen, NULL, 0, LC_SPHINCS_NIST_CATEGORY));
+	lc_hmac_final(hmac_ctx, mac);
+	memcpy(R, mac, LC_SPX_N);
+
+out:
+	lc_hmac_zero(hmac_ctx);
+	lc_memset_secure(mac, 0, sizeof(mac));
+	return ret;
+}
+
+/**
+ * Computes the message hash using R, the public key, and the message.
+ * Outputs the message digest and the index of the leaf. The index is split in
+ * the tree index and the leaf index, for convenient copying to an address.
+ *
+ * H_msg(R, PK.seed, PK.root, M) =
+ *	MGF1-SHA-X(R || PK.seed || SHA-X(R || PK.seed || PK.root || M), m)
+ */
+int hash_message(uint8_t *digest, uint64_t *tree, uint32_t *leaf_idx,
+		 const uint8_t R[LC_SPX_N], const uint8_t pk[LC_SPX_PK_BYTES],
+		 const uint8_t *m, size_t mlen, struct lc_sphincs_ctx *ctx)
+{
+#define LC_SPX_TREE_BITS (LC_SPX_TREE_HEIGHT * (LC_SPX_D - 1))
+#define LC_SPX_TREE_BYTES ((LC_SPX_TREE_BITS + 7) / 8)
+#define LC_SPX_LEAF_BITS LC_SPX_TREE_HEIGHT
+#define LC_SPX_LEAF_BYTES ((LC_SPX_LEAF_BITS + 7) / 8)
+#define LC_SPX_DGST_BYTES                                                      \
+	(LC_SPX_FORS_MSG_BYTES + LC_SPX_TREE_BYTES + LC_SPX_LEAF_BYTES)
+#define LC_SPX_MGF1_BLOCKS                                                     \
+	((LC_SPX_DGST_BYTES + LC_SPX_SHAX_SIZE_DIGEST - 1) /                   \
+	 LC_SPX_SHAX_SIZE_DIGEST)
+
+	uint8_t seed[2 * LC_SPX_N + LC_SPX_SHAX_SIZE_DIGEST];
+	uint8_t buf[LC_SPX_MGF1_BLOCKS * LC_SPX_SHAX_SIZE_DIGEST];
+	uint8_t counter[4];
+	uint8_t *bufp = buf;
+	uint32_t i;
+	int ret;
+	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPX_SHAX);
+
+	/* seed = R || PK.seed || SHA-X(R || PK.seed || PK.root || M) */
+	CKINT(lc_hash_init(hash_ctx));
+	lc_hash_update(hash_ctx, R, LC_SPX_N);
+	lc_hash_update(hash_ctx, pk, LC_SPX_PK_BYTES);
+	CKINT(signature_domain_separation(
+		hash_ctx, ctx->slh_dsa_internal, ctx->sphincs_prehash_type,
+		ctx->userctx, ctx->userctxlen, m, mlen, NULL, 0,
+		LC_SPHINCS_NIST_CATEGORY));
+	lc_hash_final(hash_ctx, seed + 2 * LC_SPX_N);
+	memcpy(seed, R, LC_SPX_N);
+	memcpy(seed + LC_SPX_N, pk, LC_SPX_N);
+
+	/* MGF1 */
+	for (i = 0; i < LC_SPX_MGF1_BLOCKS; i++) {
+		be32_to_ptr(counter, i);
+		CKINT(lc_hash_init(hash_ctx));
+		lc_hash_update(hash_ctx, seed, sizeof(seed));
+		lc_hash_update(hash_ctx, counter, sizeof(counter));
+		lc_hash_final(hash_ctx, buf + i * LC_SPX_SHAX_SIZE_DIGEST);
+	}
+
+	memcpy(digest, bufp, LC_SPX_FORS_MSG_BYTES);
+	bufp += LC_SPX_FORS_MSG_BYTES;
+
+#if LC_SPX_TREE_BITS > 64
+#error For given height and depth, 64 bits cannot represent all subtrees
+#endif
+
+	if (LC_SPX_D == 1) {
+		*tree = 0;
+	} else {
+		*tree = bytes_to_ull(bufp, LC_SPX_TREE_BYTES);
+		*tree &= (~(uint64_t)0) >> (64 - LC_SPX_TREE_BITS);
+	}
+	bufp += LC_SPX_TREE_BYTES;
+
+	*leaf_idx = (uint32_t)bytes_to_ull(bufp, LC_SPX_LEAF_BYTES);
+	*leaf_idx &= (~(uint32_t)0) >> (32 - LC_SPX_LEAF_BITS);
+
+out:
+	lc_hash_zero(hash_ctx);
+	return ret;
+}
@@ -20,6 +20,13 @@
 #ifndef SPHINCS_INTERNAL_H
 #define SPHINCS_INTERNAL_H
 
+#include "sphincs_type.h"
+
+#ifdef LC_SPHINCS_SHA2
+#include "lc_sha256.h"
+#include "lc_sha512.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -27,6 +34,18 @@ extern "C" {
 typedef struct {
 	const uint8_t *pub_seed;
 	const uint8_t *sk_seed;
+
+#ifdef LC_SPHINCS_SHA2
+	/*
+	 * SHA-256 state after absorbing PK.seed padded to a full block - all
+	 * SHA2-based F, PRF, H and T_l invocations start from this state.
+	 */
+	struct lc_sha256_state state_seeded;
+#if LC_SPX_N >= 24
+	/* SHA-512 counterpart used for H and T_l of categories 3 and 5 */
+	struct lc_sha512_state state_seeded_512;
+#endif
+#endif
 } spx_ctx;
 
 #ifdef __cplusplus
@@ -25,23 +25,26 @@
  */
 
 #include "ext_headers_internal.h"
+#include "ret_checkers.h"
 #include "small_stack_support.h"
 #include "sphincs_type.h"
 #include "sphincs_address.h"
 #include "sphincs_merkle.h"
+#include "sphincs_thash.h"
 #include "sphincs_utilsx1.h"
 #include "sphincs_wots.h"
 #include "sphincs_wotsx1.h"
 
 /*
- * This generates a Merkle signature (WOTS signature followed by the Merkle
- * authentication path). This is in this file because most of the complexity
- * is involved with the WOTS signature; the Merkle authentication path logic
- * is mostly hidden in treehashx4
+ * Generate the Merkle tree nodes covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height) of the tree referenced by the
+ * addresses. If idx_leaf is within that range, the WOTS signature of the root
+ * and the authentication path is generated as well.
  */
-int sphincs_merkle_sign_c(uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
-			  uint32_t wots_addr[8], uint32_t tree_addr[8],
-			  uint32_t idx_leaf)
+int sphincs_merkle_sign_subtree_c(uint8_t *sig, unsigned char *root,
+				  const spx_ctx *ctx, uint32_t wots_addr[8],
+				  uint32_t tree_addr[8], uint32_t idx_leaf,
+				  uint32_t idx_offset, uint32_t tree_height)
 {
 	struct workspace {
 		struct leaf_info_x1 info;
@@ -49,6 +52,7 @@ int sphincs_merkle_sign_c(uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
 		unsigned int steps[LC_SPX_WOTS_LEN];
 	};
 	uint8_t *auth_path = sig + LC_SPX_WOTS_BYTES;
+	int ret;
 	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
 
 	ws->info.wots_sig = sig;
@@ -62,12 +66,27 @@ int sphincs_merkle_sign_c(uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
 
 	ws->info.wots_sign_leaf = idx_leaf;
 
-	treehashx1(root, auth_path, ctx, idx_leaf, 0, LC_SPX_TREE_HEIGHT,
-		   ws->treehash_stack_sp, wots_gen_leafx1, tree_addr,
-		   &ws->info);
+	ret = treehashx1(root, auth_path, ctx, idx_leaf - idx_offset,
+			 idx_offset, tree_height, ws->treehash_stack_sp,
+			 wots_gen_leafx1, tree_addr, &ws->info);
 
 	LC_RELEASE_MEM(ws);
-	return 0;
+	return ret;
+}
+
+/*
+ * This generates a Merkle signature (WOTS signature followed by the Merkle
+ * authentication path). This is in this file because most of the complexity
+ * is involved with the WOTS signature; the Merkle authentication path logic
+ * is mostly hidden in treehashx4
+ */
+int sphincs_merkle_sign_c(uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
+			  uint32_t wots_addr[8], uint32_t tree_addr[8],
+			  uint32_t idx_leaf)
+{
+	return sphincs_merkle_sign_subtree_c(sig, root, ctx, wots_addr,
+					     tree_addr, idx_leaf, 0,
+					     LC_SPX_TREE_HEIGHT);
 }
 
 /* Compute root node of the top-most subtree. */
@@ -96,3 +115,77 @@ int sphincs_merkle_gen_root_c(unsigned char *root, const spx_ctx *ctx)
 	LC_RELEASE_MEM(ws);
 	return 0;
 }
+
+/*
+ * Compute the root node of the subtree of the top-most tree covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height).
+ */
+int sphincs_merkle_gen_subroot_c(unsigned char *root, const spx_ctx *ctx,
+				 uint32_t idx_offset, uint32_t tree_height)
+{
+	struct workspace {
+		uint32_t top_tree_addr[8];
+		uint32_t wots_addr[8];
+		uint8_t auth_path[LC_SPX_TREE_HEIGHT * LC_SPX_N +
+				  LC_SPX_WOTS_BYTES];
+	};
+	int ret;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	set_layer_addr(ws->top_tree_addr, LC_SPX_D - 1);
+	set_layer_addr(ws->wots_addr, LC_SPX_D - 1);
+
+	/* ~0 means "don't bother generating an auth path */
+	ret = sphincs_merkle_sign_subtree_c(ws->auth_path, root, ctx,
+					    ws->wots_addr, ws->top_tree_addr,
+					    (uint32_t)~0, idx_offset,
+					    tree_height);
+
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+/*
+ * Compute the nodes of the Merkle tree referenced by tree_addr above the given
+ * height. On entry, nodes holds the 2^(LC_SPX_TREE_HEIGHT - height) nodes at
+ * that height. The nodes of all levels above are appended level by level, i.e.
+ * the root is the last node.
+ */
+int sphincs_merkle_gen_nodes_c(uint8_t *nodes, const spx_ctx *ctx,
+			       uint32_t tree_addr[8], uint32_t height)
+{
+	uint64_t ascon_state[LC_ASCON_HASH_STATE_WORDS];
+	const uint8_t *in = nodes;
+	uint8_t *out = nodes + (1 << (LC_SPX_TREE_HEIGHT - height)) * LC_SPX_N;
+	uint32_t h, i;
+	int ret = 0;
+	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPHINCS_HASH_TYPE);
+
+	(void)ascon_state;
+
+	set_type(tree_addr, LC_SPX_ADDR_TYPE_HASHTREE);
+
+	for (h = height + 1; h <= LC_SPX_TREE_HEIGHT; h++) {
+		set_tree_height(tree_addr, h);
+
+		for (i = 0; i < (1U << (LC_SPX_TREE_HEIGHT - h)); i++) {
+			set_tree_index(tree_addr, i);
+
+#if defined(LC_SPHINCS_TYPE_128F_ASCON) || defined(LC_SPHINCS_TYPE_128S_ASCON)
+			CKINT(thash_ascon(hash_ctx, out, in, 2, ctx->pub_seed,
+					  tree_addr,
+					  LC_SPX_ADDR_BYTES -
+						  LC_ASCON_HASH_RATE,
+					  (uint8_t *)ascon_state, 1));
+#else
+			CKINT(thash(hash_ctx, out, in, 2, ctx, tree_addr));
+#endif
+			in += 2 * LC_SPX_N;
+			out += LC_SPX_N;
+		}
+	}
+
+out:
+	lc_hash_zero(hash_ctx);
+	return ret;
+}
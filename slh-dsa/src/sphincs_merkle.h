@@ -45,10 +45,41 @@ int sphincs_merkle_sign_c(uint8_t *sig, unsigned char *root, const spx_ctx *ctx,
 /* Compute the root node of the top-most subtree. */
 int sphincs_merkle_gen_root_c(unsigned char *root, const spx_ctx *ctx);
 
+/*
+ * Compute the root node of the subtree of the top-most tree covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height).
+ */
+int sphincs_merkle_gen_subroot_c(unsigned char *root, const spx_ctx *ctx,
+				 uint32_t idx_offset, uint32_t tree_height);
+
+/*
+ * Generate the Merkle tree nodes covering the leaves
+ * [idx_offset, idx_offset + 2^tree_height) of the tree referenced by the
+ * addresses. If idx_leaf is within that range, the WOTS signature of the root
+ * and the authentication path is generated as well.
+ */
+int sphincs_merkle_sign_subtree_c(uint8_t *sig, unsigned char *root,
+				  const spx_ctx *ctx, uint32_t wots_addr[8],
+				  uint32_t tree_addr[8], uint32_t idx_leaf,
+				  uint32_t idx_offset, uint32_t tree_height);
+
+/*
+ * Compute the nodes of the Merkle tree referenced by tree_addr above the given
+ * height from the nodes at that height.
+ */
+int sphincs_merkle_gen_nodes_c(uint8_t *nodes, const spx_ctx *ctx,
+			       uint32_t tree_addr[8], uint32_t height);
+
 typedef int (*merkle_sign_f)(uint8_t *sig, unsigned char *root,
 			     const spx_ctx *ctx, uint32_t wots_addr[8],
 			     uint32_t tree_addr[8], uint32_t idx_leaf);
 typedef int (*merkle_gen_root_f)(unsigned char *root, const spx_ctx *ctx);
+typedef int (*merkle_gen_subroot_f)(unsigned char *root, const spx_ctx *ctx,
+				    uint32_t idx_offset, uint32_t tree_height);
+typedef int (*merkle_sign_subtree_f)(uint8_t *sig, unsigned char *root,
+				     const spx_ctx *ctx, uint32_t wots_addr[8],
+				     uint32_t tree_addr[8], uint32_t idx_leaf,
+				     uint32_t idx_offset, uint32_t tree_height);
 
 #ifdef __cplusplus
 }
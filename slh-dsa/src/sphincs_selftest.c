@@ -52,6 +52,24 @@
 #elif defined(LC_SPHINCS_TYPE_256F)
 #include "lc_sphincs_shake_256f.h"
 #include "../tests/sphincs_tester_vectors_shake_256f.h"
+#elif defined(LC_SPHINCS_TYPE_128F_SHA2)
+#include "lc_sphincs_sha2_128f.h"
+#include "../tests/sphincs_tester_vectors_sha2_128f.h"
+#elif defined(LC_SPHINCS_TYPE_128S_SHA2)
+#include "lc_sphincs_sha2_128s.h"
+#include "../tests/sphincs_tester_vectors_sha2_128s.h"
+#elif defined(LC_SPHINCS_TYPE_192F_SHA2)
+#include "lc_sphincs_sha2_192f.h"
+#include "../tests/sphincs_tester_vectors_sha2_192f.h"
+#elif defined(LC_SPHINCS_TYPE_192S_SHA2)
+#include "lc_sphincs_sha2_192s.h"
+#include "../tests/sphincs_tester_vectors_sha2_192s.h"
+#elif defined(LC_SPHINCS_TYPE_256F_SHA2)
+#include "lc_sphincs_sha2_256f.h"
+#include "../tests/sphincs_tester_vectors_sha2_256f.h"
+#elif defined(LC_SPHINCS_TYPE_256S_SHA2)
+#include "lc_sphincs_sha2_256s.h"
+#include "../tests/sphincs_tester_vectors_sha2_256s.h"
 #else
 #include "lc_sphincs_shake_256s.h"
 #include "../tests/sphincs_tester_vectors_shake_256s.h"
@@ -42,30 +42,47 @@
 #include "sphincs_thash.h"
 #include "sphincs_utils.h"
 #include "sphincs_wots.h"
+#include "sphincs_wotsx1.h"
 #include "timecop.h"
 #include "ret_checkers.h"
 #include "visibility.h"
 
 #include "avx2/sphincs_fors_avx2.h"
 #include "avx2/sphincs_merkle_avx2.h"
+#include "avx2/sphincs_utilsx4_avx2.h"
 #include "avx2/sphincs_wots_avx2.h"
 
+#include "x8/sphincs_fors_x8.h"
+#include "x8/sphincs_merkle_x8.h"
+#include "x8/sphincs_utilsx8.h"
+#include "x8/sphincs_wots_x8.h"
+
 #include "armv8/sphincs_fors_armv8.h"
 #include "armv8/sphincs_merkle_armv8.h"
+#include "armv8/sphincs_utilsx2_armv8.h"
 #include "armv8/sphincs_wots_armv8.h"
 
 struct lc_sphincs_func_ctx {
 	merkle_sign_f merkle_sign;
 	merkle_gen_root_f merkle_gen_root;
+	merkle_gen_subroot_f merkle_gen_subroot;
+	merkle_sign_subtree_f merkle_sign_subtree;
 	fors_sign_f fors_sign;
+	fors_sign_trees_f fors_sign_trees;
 	fors_pk_from_sig_f fors_pk_from_sig;
 	wots_pk_from_sig_f wots_pk_from_sig;
+	/* Lockstep thash for batch verification, NULL if not vectorized */
+	thash_batch_f thash_batch;
+	unsigned int thash_batch_lanes;
 };
 
 static const struct lc_sphincs_func_ctx f_ctx_c = {
 	.merkle_sign = sphincs_merkle_sign_c,
 	.merkle_gen_root = sphincs_merkle_gen_root_c,
+	.merkle_gen_subroot = sphincs_merkle_gen_subroot_c,
+	.merkle_sign_subtree = sphincs_merkle_sign_subtree_c,
 	.fors_sign = fors_sign_c,
+	.fors_sign_trees = fors_sign_trees_c,
 	.fors_pk_from_sig = fors_pk_from_sig_c,
 	.wots_pk_from_sig = wots_pk_from_sig_c,
 };
@@ -73,32 +90,72 @@ static const struct lc_sphincs_func_ctx f_ctx_c = {
 static const struct lc_sphincs_func_ctx f_ctx_avx2 __maybe_unused = {
 	.merkle_sign = sphincs_merkle_sign_avx2,
 	.merkle_gen_root = sphincs_merkle_gen_root_avx2,
+	.merkle_gen_subroot = sphincs_merkle_gen_subroot_avx2,
+	.merkle_sign_subtree = sphincs_merkle_sign_subtree_avx2,
 	.fors_sign = fors_sign_avx2,
+	.fors_sign_trees = fors_sign_trees_avx2,
 	.fors_pk_from_sig = fors_pk_from_sig_avx2,
 	.wots_pk_from_sig = wots_pk_from_sig_avx2,
+	.thash_batch = thashx4_batch,
+	.thash_batch_lanes = 4,
+};
+
+static const struct lc_sphincs_func_ctx f_ctx_x8 __maybe_unused = {
+	.merkle_sign = sphincs_merkle_sign_x8,
+	.merkle_gen_root = sphincs_merkle_gen_root_x8,
+	.merkle_gen_subroot = sphincs_merkle_gen_subroot_x8,
+	.merkle_sign_subtree = sphincs_merkle_sign_subtree_x8,
+	.fors_sign = fors_sign_x8,
+	.fors_sign_trees = fors_sign_trees_x8,
+	.fors_pk_from_sig = fors_pk_from_sig_x8,
+	.wots_pk_from_sig = wots_pk_from_sig_x8,
+	.thash_batch = thashx8_batch,
+	.thash_batch_lanes = 8,
 };
 
 static const struct lc_sphincs_func_ctx f_ctx_armv8 __maybe_unused = {
 	.merkle_sign = sphincs_merkle_sign_armv8,
 	.merkle_gen_root = sphincs_merkle_gen_root_armv8,
+	.merkle_gen_subroot = sphincs_merkle_gen_subroot_armv8,
+	.merkle_sign_subtree = sphincs_merkle_sign_subtree_armv8,
 	.fors_sign = fors_sign_armv8,
+	.fors_sign_trees = fors_sign_trees_armv8,
 	.fors_pk_from_sig = fors_pk_from_sig_armv8,
 	.wots_pk_from_sig = wots_pk_from_sig_armv8,
+	.thash_batch = thashx2_batch,
+	.thash_batch_lanes = 2,
 };
 
 static const struct lc_sphincs_func_ctx *lc_sphincs_get_ctx(void)
 {
 	enum lc_cpu_features feat __maybe_unused = lc_cpu_feature_available();
 
-#if (defined(LC_HOST_X86_64) && !defined(LC_SPHINCS_TYPE_128F_ASCON) &&        \
+#if (defined(LC_HOST_X86_64) && !defined(LINUX_KERNEL) &&                      \
+     !defined(LC_SPHINCS_TYPE_128F_ASCON) &&                                   \
      !defined(LC_SPHINCS_TYPE_128S_ASCON))
+	/*
+	 * The 8-way code is not compiled for the Linux kernel. It is driven
+	 * by the 8-way AVX-512 Keccak for SHAKE and by the 8-way AVX2 SHA-256
+	 * for SHA2.
+	 */
+#ifdef LC_SPHINCS_SHA2
+	if (feat & LC_CPU_FEATURE_INTEL_AVX2)
+		return &f_ctx_x8;
+#else
+	if (feat & LC_CPU_FEATURE_INTEL_AVX512)
+		return &f_ctx_x8;
+#endif
+#endif /* LC_HOST_X86_64 */
+
+#if (defined(LC_HOST_X86_64) && !defined(LC_SPHINCS_TYPE_128F_ASCON) &&        \
+     !defined(LC_SPHINCS_TYPE_128S_ASCON) && !defined(LC_SPHINCS_SHA2))
 	if (feat & LC_CPU_FEATURE_INTEL_AVX2) {
 		return &f_ctx_avx2;
 	} else
 #endif /* LC_HOST_X86_64 */
 #if (defined(LC_HOST_AARCH64) && !defined(LINUX_KERNEL) &&                     \
      !defined(LC_SPHINCS_TYPE_128F_ASCON) &&                                   \
-     !defined(LC_SPHINCS_TYPE_128S_ASCON))
+     !defined(LC_SPHINCS_TYPE_128S_ASCON) && !defined(LC_SPHINCS_SHA2))
 		/*
 		 * TODO See issue in Kbuild.slh-dsa - enable NEON intrinsics
 		 * for the Linux kernel.
@@ -111,8 +168,99 @@ static const struct lc_sphincs_func_ctx *lc_sphincs_get_ctx(void)
 	return &f_ctx_c;
 }
 
-static int lc_sphincs_keypair_from_seed_internal(struct lc_sphincs_pk *pk,
-						 struct lc_sphincs_sk *sk)
+/*
+ * Number of the upper bits of the leaf index of the top-most tree selecting the
+ * subtree that is computed by one executor job during key generation. The
+ * subtrees must have a height of at least 2 to be processed by the
+ * vectorized tree hash implementations.
+ */
+#if (LC_SPX_TREE_HEIGHT >= 8)
+#define LC_SPX_KEYGEN_SPLIT_BITS 3
+#else
+#define LC_SPX_KEYGEN_SPLIT_BITS 0
+#endif
+#define LC_SPX_KEYGEN_JOBS (1 << LC_SPX_KEYGEN_SPLIT_BITS)
+
+struct sphincs_keygen_exec {
+	const struct lc_sphincs_func_ctx *f_ctx;
+	const spx_ctx *ctx;
+	uint8_t roots[LC_SPX_KEYGEN_JOBS * LC_SPX_N];
+	int ret[LC_SPX_KEYGEN_JOBS];
+};
+
+static int sphincs_keygen_job(void *job_data, unsigned int idx)
+{
+	struct sphincs_keygen_exec *exec = job_data;
+	uint32_t height = LC_SPX_TREE_HEIGHT - LC_SPX_KEYGEN_SPLIT_BITS;
+
+	if (idx >= LC_SPX_KEYGEN_JOBS)
+		return -EINVAL;
+
+	exec->ret[idx] = exec->f_ctx->merkle_gen_subroot(
+		exec->roots + idx * LC_SPX_N, exec->ctx, idx << height, height);
+	return exec->ret[idx];
+}
+
+/*
+ * Compute the root node of the top-most tree by computing its subtrees with
+ * the executor and combining the subtree roots afterwards.
+ */
+static int
+sphincs_merkle_gen_root_exec(uint8_t *root, const spx_ctx *ctx,
+			     const struct lc_sphincs_func_ctx *f_ctx,
+			     struct lc_sphincs_ctx *sphincs_ctx)
+{
+	struct workspace {
+		struct sphincs_keygen_exec exec;
+		uint32_t tree_addr[8];
+	};
+	uint32_t h, i;
+	int ret;
+	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPHINCS_HASH_TYPE);
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	ws->exec.f_ctx = f_ctx;
+	ws->exec.ctx = ctx;
+
+	CKINT(sphincs_ctx->executor(sphincs_ctx->executor_data,
+				    sphincs_keygen_job, &ws->exec,
+				    LC_SPX_KEYGEN_JOBS));
+
+	/* Report the error of the first failing job */
+	for (i = 0; i < LC_SPX_KEYGEN_JOBS; i++)
+		CKINT(ws->exec.ret[i]);
+
+	set_layer_addr(ws->tree_addr, LC_SPX_D - 1);
+	set_type(ws->tree_addr, LC_SPX_ADDR_TYPE_HASHTREE);
+
+	/*
+	 * Combine the subtree roots in place - the parent node i only
+	 * overwrites a child that was consumed before.
+	 */
+	for (h = LC_SPX_TREE_HEIGHT - LC_SPX_KEYGEN_SPLIT_BITS;
+	     h < LC_SPX_TREE_HEIGHT; h++) {
+		set_tree_height(ws->tree_addr, h + 1);
+
+		for (i = 0; i < (1U << (LC_SPX_TREE_HEIGHT - h - 1)); i++) {
+			set_tree_index(ws->tree_addr, i);
+			CKINT(thash(hash_ctx, ws->exec.roots + i * LC_SPX_N,
+				    ws->exec.roots + 2 * i * LC_SPX_N, 2, ctx,
+				    ws->tree_addr));
+		}
+	}
+
+	memcpy(root, ws->exec.roots, LC_SPX_N);
+
+out:
+	lc_hash_zero(hash_ctx);
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+static int
+lc_sphincs_keypair_from_seed_internal(struct lc_sphincs_pk *pk,
+				      struct lc_sphincs_sk *sk,
+				      struct lc_sphincs_ctx *sphincs_ctx)
 {
 	const struct lc_sphincs_func_ctx *f_ctx = lc_sphincs_get_ctx();
 	spx_ctx ctx;
@@ -128,9 +276,15 @@ static int lc_sphincs_keypair_from_seed_internal(struct lc_sphincs_pk *pk,
 
 	ctx.pub_seed = pk->pk;
 	ctx.sk_seed = sk->sk_seed;
+	CKINT(initialize_hash_function(&ctx));
 
 	/* Compute root node of the top-most subtree. */
-	CKINT(f_ctx->merkle_gen_root(sk->pk + LC_SPX_N, &ctx));
+	if (sphincs_ctx && sphincs_ctx->executor && LC_SPX_KEYGEN_JOBS > 1) {
+		CKINT(sphincs_merkle_gen_root_exec(sk->pk + LC_SPX_N, &ctx,
+						   f_ctx, sphincs_ctx));
+	} else {
+		CKINT(f_ctx->merkle_gen_root(sk->pk + LC_SPX_N, &ctx));
+	}
 
 	memcpy(pk->pk + LC_SPX_N, sk->pk + LC_SPX_N, LC_SPX_N);
 
@@ -175,7 +329,7 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair_from_seed,
 	/* Initialize SK_SEED, SK_PRF and PUB_SEED from seed. */
 	memcpy(sk, seed, LC_SPX_SEEDBYTES);
 
-	CKINT(lc_sphincs_keypair_from_seed_internal(pk, sk));
+	CKINT(lc_sphincs_keypair_from_seed_internal(pk, sk, NULL));
 
 out:
 	return ret;
@@ -194,9 +348,10 @@ out:
  * Format pk: [PUB_SEED || root]
  */
 
-int lc_sphincs_keypair_nocheck(struct lc_sphincs_pk *pk,
-			       struct lc_sphincs_sk *sk,
-			       struct lc_rng_ctx *rng_ctx)
+static int lc_sphincs_keypair_ctx_nocheck(struct lc_sphincs_pk *pk,
+					  struct lc_sphincs_sk *sk,
+					  struct lc_sphincs_ctx *ctx,
+					  struct lc_rng_ctx *rng_ctx)
 {
 	int ret;
 
@@ -206,12 +361,19 @@ int lc_sphincs_keypair_nocheck(struct lc_sphincs_pk *pk,
 
 	CKINT(lc_rng_generate(rng_ctx, NULL, 0, (uint8_t *)sk,
 			      LC_SPX_SEEDBYTES));
-	CKINT(lc_sphincs_keypair_from_seed_internal(pk, sk));
+	CKINT(lc_sphincs_keypair_from_seed_internal(pk, sk, ctx));
 
 out:
 	return ret;
 }
 
+int lc_sphincs_keypair_nocheck(struct lc_sphincs_pk *pk,
+			       struct lc_sphincs_sk *sk,
+			       struct lc_rng_ctx *rng_ctx)
+{
+	return lc_sphincs_keypair_ctx_nocheck(pk, sk, NULL, rng_ctx);
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair, struct lc_sphincs_pk *pk,
 		      struct lc_sphincs_sk *sk, struct lc_rng_ctx *rng_ctx)
 {
@@ -221,13 +383,365 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair, struct lc_sphincs_pk *pk,
 	return lc_sphincs_keypair_nocheck(pk, sk, rng_ctx);
 }
 
+LC_INTERFACE_FUNCTION(int, lc_sphincs_keypair_ctx, struct lc_sphincs_pk *pk,
+		      struct lc_sphincs_sk *sk, struct lc_sphincs_ctx *ctx,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	sphincs_selftest_keygen();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_SLHDSA_KEYGEN);
+
+	return lc_sphincs_keypair_ctx_nocheck(pk, sk, ctx, rng_ctx);
+}
+
+/*
+ * A prepared secret key caches the nodes of the top-most hypertree layers
+ * starting at the height LC_SPX_PREPARED_HEIGHT. The levels below are
+ * recomputed together with the WOTS signature when signing which only
+ * requires 2^LC_SPX_PREPARED_HEIGHT leaves and thus one invocation of the
+ * parallel leaf generation. This also reduces the memory footprint of the
+ * cache by that factor. The height is the minimum tree height supported by
+ * all Merkle tree implementations.
+ */
+#define LC_SPX_PREPARED_HEIGHT 3
+#define LC_SPX_PREPARED_LEVELS (LC_SPX_TREE_HEIGHT - LC_SPX_PREPARED_HEIGHT)
+
+/* Number of cached nodes of one tree */
+#define LC_SPX_PREPARED_NODES ((2U << LC_SPX_PREPARED_LEVELS) - 1)
+
+/*
+ * Index of the node idx at the given height within the cached nodes of one
+ * tree: the nodes are stored level by level, starting at the height
+ * LC_SPX_PREPARED_HEIGHT and ending with the root.
+ */
+#define LC_SPX_PREPARED_NODE(height, idx)                                      \
+	((2U << LC_SPX_PREPARED_LEVELS) -                                      \
+	 (2U << (LC_SPX_TREE_HEIGHT - (height))) + (idx))
+
+struct lc_sphincs_prepared_sk {
+	struct lc_sphincs_sk sk;
+	unsigned int layers;
+	/*
+	 * Cached nodes of the top-most tree followed by the cached nodes of
+	 * all trees of the layer below if two layers are cached.
+	 */
+	uint8_t *nodes;
+};
+
+static size_t sphincs_prepared_sk_size(unsigned int layers)
+{
+	size_t trees = (layers > 1) ? (1 << LC_SPX_TREE_HEIGHT) + 1 : 1;
+
+	return sizeof(struct lc_sphincs_prepared_sk) +
+	       trees * LC_SPX_PREPARED_NODES * LC_SPX_N;
+}
+
+/*
+ * Return the cached nodes of the tree of the given layer or NULL if the layer
+ * is not cached.
+ */
+static const uint8_t *
+sphincs_prepared_tree(const struct lc_sphincs_prepared_sk *prepared_sk,
+		      unsigned int layer, uint64_t tree)
+{
+	if (!prepared_sk || layer + prepared_sk->layers < LC_SPX_D)
+		return NULL;
+
+	if (layer == LC_SPX_D - 1)
+		return prepared_sk->nodes;
+
+	return prepared_sk->nodes +
+	       (tree + 1) * LC_SPX_PREPARED_NODES * LC_SPX_N;
+}
+
+/*
+ * Compute the cached nodes of the tree referenced by the layer and tree index.
+ */
+static int sphincs_prepared_gen_tree(uint8_t *nodes,
+				     const struct lc_sphincs_func_ctx *f_ctx,
+				     const spx_ctx *ctx, uint32_t layer,
+				     uint64_t tree)
+{
+	struct workspace {
+		uint8_t sig[LC_SPX_WOTS_BYTES + LC_SPX_TREE_HEIGHT * LC_SPX_N];
+		uint32_t wots_addr[8];
+		uint32_t tree_addr[8];
+	};
+	uint32_t i;
+	int ret = 0;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	set_layer_addr(ws->tree_addr, layer);
+	set_tree_addr(ws->tree_addr, tree);
+	set_type(ws->wots_addr, LC_SPX_ADDR_TYPE_WOTS);
+	copy_subtree_addr(ws->wots_addr, ws->tree_addr);
+
+	/* ~0 means "don't bother generating an auth path */
+	for (i = 0; i < (1 << LC_SPX_PREPARED_LEVELS); i++) {
+		CKINT(f_ctx->merkle_sign_subtree(
+			ws->sig, nodes + i * LC_SPX_N, ctx, ws->wots_addr,
+			ws->tree_addr, (uint32_t)~0,
+			i << LC_SPX_PREPARED_HEIGHT, LC_SPX_PREPARED_HEIGHT));
+	}
+
+	CKINT(sphincs_merkle_gen_nodes_c(nodes, ctx, ws->tree_addr,
+					 LC_SPX_PREPARED_HEIGHT));
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+/*
+ * Look up the cached part of the authentication path of the leaf and the root
+ * of a cached tree. The layout of the sig buffer is identical to
+ * sphincs_merkle_sign_c.
+ */
+static void sphincs_prepared_merkle_path(uint8_t *sig, uint8_t *root,
+					 const uint8_t *nodes,
+					 uint32_t idx_leaf)
+{
+	uint8_t *auth_path = sig + LC_SPX_WOTS_BYTES;
+	unsigned int h;
+
+	for (h = LC_SPX_PREPARED_HEIGHT; h < LC_SPX_TREE_HEIGHT; h++) {
+		memcpy(auth_path + h * LC_SPX_N,
+		       nodes + LC_SPX_PREPARED_NODE(h, (idx_leaf >> h) ^ 1) *
+				       LC_SPX_N,
+		       LC_SPX_N);
+	}
+
+	memcpy(root,
+	       nodes + LC_SPX_PREPARED_NODE(LC_SPX_TREE_HEIGHT, 0) * LC_SPX_N,
+	       LC_SPX_N);
+}
+
+/*
+ * Generate the WOTS signature and the non-cached part of the authentication
+ * path of a cached tree. The root buffer contains the message to be signed
+ * and receives the root of the subtree covering the signing leaf.
+ */
+static int sphincs_prepared_merkle_sign(const struct lc_sphincs_func_ctx *f_ctx,
+					uint8_t *sig, uint8_t *root,
+					const spx_ctx *ctx,
+					uint32_t wots_addr[8],
+					uint32_t tree_addr[8],
+					uint32_t idx_leaf)
+{
+	return f_ctx->merkle_sign_subtree(
+		sig, root, ctx, wots_addr, tree_addr, idx_leaf,
+		idx_leaf & ~((1U << LC_SPX_PREPARED_HEIGHT) - 1),
+		LC_SPX_PREPARED_HEIGHT);
+}
+
+#define LC_SPX_SIGN_JOBS (LC_SPX_FORS_TREES + LC_SPX_D)
+
+struct sphincs_sign_exec {
+	const struct lc_sphincs_func_ctx *f_ctx;
+	const struct lc_sphincs_prepared_sk *prepared_sk;
+	const spx_ctx *ctx;
+	struct lc_sphincs_sig *sig;
+	const uint8_t *mhash;
+	uint32_t fors_addr[8];
+	uint64_t tree[LC_SPX_D];
+	uint32_t idx_leaf[LC_SPX_D];
+	uint8_t fors_roots[LC_SPX_FORS_TREES * LC_SPX_N];
+	/*
+	 * The FORS public key followed by the roots of the hypertree layers,
+	 * i.e. the n-byte message signed by the WOTS key of each layer.
+	 */
+	uint8_t roots[(LC_SPX_D + 1) * LC_SPX_N];
+	int ret[LC_SPX_SIGN_JOBS];
+};
+
+static void sphincs_sign_exec_addr(const struct sphincs_sign_exec *exec,
+				   unsigned int layer, uint32_t wots_addr[8],
+				   uint32_t tree_addr[8])
+{
+	set_type(wots_addr, LC_SPX_ADDR_TYPE_WOTS);
+	set_type(tree_addr, LC_SPX_ADDR_TYPE_HASHTREE);
+
+	set_layer_addr(tree_addr, layer);
+	set_tree_addr(tree_addr, exec->tree[layer]);
+
+	copy_subtree_addr(wots_addr, tree_addr);
+	set_keypair_addr(wots_addr, exec->idx_leaf[layer]);
+}
+
+static uint8_t *sphincs_sign_exec_layer_sig(struct sphincs_sign_exec *exec,
+					    unsigned int layer)
+{
+	return exec->sig->sight +
+	       layer * (LC_SPX_WOTS_BYTES + LC_SPX_TREE_HEIGHT * LC_SPX_N);
+}
+
+/*
+ * First stage: one job per FORS tree and one job per hypertree layer. The
+ * Merkle tree of a layer and thus its root and authentication path do not
+ * depend on the message signed by that layer. Thus, the layers are computed
+ * with a placeholder message whose WOTS signature is replaced in the second
+ * stage.
+ */
+static int sphincs_sign_tree_job(void *job_data, unsigned int idx)
+{
+	struct sphincs_sign_exec *exec = job_data;
+	uint32_t wots_addr[8] = { 0 }, tree_addr[8] = { 0 };
+	const uint8_t *nodes;
+	unsigned int layer;
+
+	if (idx >= LC_SPX_SIGN_JOBS)
+		return -EINVAL;
+
+	if (idx < LC_SPX_FORS_TREES) {
+		exec->ret[idx] = exec->f_ctx->fors_sign_trees(
+			exec->sig->sigfors, exec->fors_roots, exec->mhash,
+			exec->ctx, exec->fors_addr, idx, 1);
+		return exec->ret[idx];
+	}
+
+	layer = idx - LC_SPX_FORS_TREES;
+
+	nodes = sphincs_prepared_tree(exec->prepared_sk, layer,
+				      exec->tree[layer]);
+	if (nodes) {
+		sphincs_prepared_merkle_path(
+			sphincs_sign_exec_layer_sig(exec, layer),
+			exec->roots + (layer + 1) * LC_SPX_N, nodes,
+			exec->idx_leaf[layer]);
+		exec->ret[idx] = 0;
+		return 0;
+	}
+
+	sphincs_sign_exec_addr(exec, layer, wots_addr, tree_addr);
+
+	exec->ret[idx] = exec->f_ctx->merkle_sign(
+		sphincs_sign_exec_layer_sig(exec, layer),
+		exec->roots + (layer + 1) * LC_SPX_N, exec->ctx, wots_addr,
+		tree_addr, exec->idx_leaf[layer]);
+	return exec->ret[idx];
+}
+
+/*
+ * Second stage: one job per hypertree layer generating the WOTS signature of
+ * the root of the layer below (or the FORS public key for the bottom layer).
+ */
+static int sphincs_sign_wots_job(void *job_data, unsigned int idx)
+{
+	struct workspace {
+		struct leaf_info_x1 info;
+		unsigned int steps[LC_SPX_WOTS_LEN];
+		uint32_t wots_addr[8];
+		uint32_t tree_addr[8];
+		uint8_t leaf[LC_SPX_N];
+	};
+	struct sphincs_sign_exec *exec = job_data;
+	int ret;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	if (idx >= LC_SPX_D) {
+		ret = -EINVAL;
+		goto err;
+	}
+
+	sphincs_sign_exec_addr(exec, idx, ws->wots_addr, ws->tree_addr);
+
+	/*
+	 * The cached part of the authentication path was filled in by the
+	 * first stage, generate the remainder along with the WOTS signature.
+	 */
+	if (sphincs_prepared_tree(exec->prepared_sk, idx, exec->tree[idx])) {
+		memcpy(ws->leaf, exec->roots + idx * LC_SPX_N, LC_SPX_N);
+		CKINT(sphincs_prepared_merkle_sign(
+			exec->f_ctx, sphincs_sign_exec_layer_sig(exec, idx),
+			ws->leaf, exec->ctx, ws->wots_addr, ws->tree_addr,
+			exec->idx_leaf[idx]));
+		goto out;
+	}
+
+	chain_lengths_c(ws->steps, exec->roots + idx * LC_SPX_N);
+	ws->info.wots_steps = ws->steps;
+	ws->info.wots_sig = sphincs_sign_exec_layer_sig(exec, idx);
+	ws->info.wots_sign_leaf = exec->idx_leaf[idx];
+
+	set_type(ws->info.pk_addr, LC_SPX_ADDR_TYPE_WOTSPK);
+	copy_subtree_addr(ws->info.leaf_addr, ws->wots_addr);
+	copy_subtree_addr(ws->info.pk_addr, ws->wots_addr);
+
+	CKINT(wots_gen_leafx1(ws->leaf, exec->ctx, exec->idx_leaf[idx],
+			      &ws->info));
+
+out:
+	exec->ret[idx] = ret;
+err:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
+static int
+sphincs_sign_exec(struct lc_sphincs_sig *sig,
+		  struct lc_sphincs_ctx *sphincs_ctx,
+		  const struct lc_sphincs_func_ctx *f_ctx,
+		  const struct lc_sphincs_prepared_sk *prepared_sk,
+		  const spx_ctx *ctx, const uint8_t *mhash, uint64_t tree,
+		  uint32_t idx_leaf)
+{
+	struct workspace {
+		struct sphincs_sign_exec exec;
+	};
+	unsigned int i;
+	int ret;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	ws->exec.f_ctx = f_ctx;
+	ws->exec.prepared_sk = prepared_sk;
+	ws->exec.ctx = ctx;
+	ws->exec.sig = sig;
+	ws->exec.mhash = mhash;
+
+	set_tree_addr(ws->exec.fors_addr, tree);
+	set_keypair_addr(ws->exec.fors_addr, idx_leaf);
+
+	/* Derive the indices of all layers upfront. */
+	for (i = 0; i < LC_SPX_D; i++) {
+		ws->exec.tree[i] = tree;
+		ws->exec.idx_leaf[i] = idx_leaf;
+
+		idx_leaf = (tree & ((1 << LC_SPX_TREE_HEIGHT) - 1));
+		tree = tree >> LC_SPX_TREE_HEIGHT;
+	}
+
+	CKINT(sphincs_ctx->executor(sphincs_ctx->executor_data,
+				    sphincs_sign_tree_job, &ws->exec,
+				    LC_SPX_SIGN_JOBS));
+
+	/* Report the error of the first failing job */
+	for (i = 0; i < LC_SPX_SIGN_JOBS; i++)
+		CKINT(ws->exec.ret[i]);
+
+	CKINT(fors_roots_to_pk(ws->exec.roots, ws->exec.fors_roots, ctx,
+			       ws->exec.fors_addr));
+
+	CKINT(sphincs_ctx->executor(sphincs_ctx->executor_data,
+				    sphincs_sign_wots_job, &ws->exec,
+				    LC_SPX_D));
+
+	for (i = 0; i < LC_SPX_D; i++)
+		CKINT(ws->exec.ret[i]);
+
+out:
+	LC_RELEASE_MEM(ws);
+	return ret;
+}
+
 /**
- * Returns an array containing a detached signature.
+ * Returns an array containing a detached signature. If a prepared secret key is
+ * provided, the cached hypertree layers are looked up instead of computed.
  */
-int lc_sphincs_sign_ctx_nocheck(struct lc_sphincs_sig *sig,
-				struct lc_sphincs_ctx *ctx, const uint8_t *m,
-				size_t mlen, const struct lc_sphincs_sk *sk,
-				struct lc_rng_ctx *rng_ctx)
+static int
+sphincs_sign_internal(struct lc_sphincs_sig *sig, struct lc_sphincs_ctx *ctx,
+		      const uint8_t *m, size_t mlen,
+		      const struct lc_sphincs_sk *sk,
+		      const struct lc_sphincs_prepared_sk *prepared_sk,
+		      struct lc_rng_ctx *rng_ctx)
 {
 	struct workspace {
 		uint64_t tree;
@@ -240,16 +754,20 @@ int lc_sphincs_sign_ctx_nocheck(struct lc_sphincs_sig *sig,
 	};
 	uint32_t i;
 	const struct lc_sphincs_func_ctx *f_ctx = lc_sphincs_get_ctx();
+	const uint8_t *nodes;
 	spx_ctx ctx_int;
-	const uint8_t *sk_prf = sk->sk_prf;
-	const uint8_t *pk = sk->pk;
-	uint8_t *wots_sig = sig->sight;
+	const uint8_t *sk_prf, *pk;
+	uint8_t *wots_sig;
 	int ret = 0;
 	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
 
 	CKNULL(sig, -EINVAL);
 	CKNULL(sk, -EINVAL);
 
+	sk_prf = sk->sk_prf;
+	pk = sk->pk;
+	wots_sig = sig->sight;
+
 	/*
 	 * Timecop: secret key is sensitive
 	 */
@@ -257,6 +775,7 @@ int lc_sphincs_sign_ctx_nocheck(struct lc_sphincs_sig *sig,
 
 	ctx_int.sk_seed = sk->sk_seed;
 	ctx_int.pub_seed = pk;
+	CKINT(initialize_hash_function(&ctx_int));
 
 	set_type(ws->wots_addr, LC_SPX_ADDR_TYPE_WOTS);
 	set_type(ws->tree_addr, LC_SPX_ADDR_TYPE_HASHTREE);
@@ -280,6 +799,12 @@ int lc_sphincs_sign_ctx_nocheck(struct lc_sphincs_sig *sig,
 	CKINT(hash_message(ws->mhash, &ws->tree, &ws->idx_leaf, sig->r, pk, m,
 			   mlen, ctx));
 
+	if (ctx && ctx->executor) {
+		CKINT(sphincs_sign_exec(sig, ctx, f_ctx, prepared_sk, &ctx_int,
+					ws->mhash, ws->tree, ws->idx_leaf));
+		goto out;
+	}
+
 	set_tree_addr(ws->wots_addr, ws->tree);
 	set_keypair_addr(ws->wots_addr, ws->idx_leaf);
 
@@ -307,9 +832,18 @@ int lc_sphincs_sign_ctx_nocheck(struct lc_sphincs_sig *sig,
 		copy_subtree_addr(ws->wots_addr, ws->tree_addr);
 		set_keypair_addr(ws->wots_addr, ws->idx_leaf);
 
-		CKINT(f_ctx->merkle_sign(wots_sig, ws->root, &ctx_int,
-					 ws->wots_addr, ws->tree_addr,
-					 ws->idx_leaf));
+		nodes = sphincs_prepared_tree(prepared_sk, i, ws->tree);
+		if (nodes) {
+			CKINT(sphincs_prepared_merkle_sign(
+				f_ctx, wots_sig, ws->root, &ctx_int,
+				ws->wots_addr, ws->tree_addr, ws->idx_leaf));
+			sphincs_prepared_merkle_path(wots_sig, ws->root, nodes,
+						     ws->idx_leaf);
+		} else {
+			CKINT(f_ctx->merkle_sign(wots_sig, ws->root, &ctx_int,
+						 ws->wots_addr, ws->tree_addr,
+						 ws->idx_leaf));
+		}
 		wots_sig += LC_SPX_WOTS_BYTES + LC_SPX_TREE_HEIGHT * LC_SPX_N;
 
 		/* Update the indices for the next layer. */
@@ -327,6 +861,14 @@ out:
 	return ret;
 }
 
+int lc_sphincs_sign_ctx_nocheck(struct lc_sphincs_sig *sig,
+				struct lc_sphincs_ctx *ctx, const uint8_t *m,
+				size_t mlen, const struct lc_sphincs_sk *sk,
+				struct lc_rng_ctx *rng_ctx)
+{
+	return sphincs_sign_internal(sig, ctx, m, mlen, sk, NULL, rng_ctx);
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_ctx, struct lc_sphincs_sig *sig,
 		      struct lc_sphincs_ctx *ctx, const uint8_t *m, size_t mlen,
 		      const struct lc_sphincs_sk *sk,
@@ -350,6 +892,121 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_sign, struct lc_sphincs_sig *sig,
 	return ret;
 }
 
+LC_INTERFACE_FUNCTION(void, lc_sphincs_prepared_sk_zero_free,
+		      struct lc_sphincs_prepared_sk *prepared_sk)
+{
+	if (!prepared_sk)
+		return;
+
+	lc_memset_secure(prepared_sk, 0,
+			 sphincs_prepared_sk_size(prepared_sk->layers));
+	lc_free(prepared_sk);
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_prepared_sk_alloc,
+		      struct lc_sphincs_prepared_sk **prepared_sk,
+		      const struct lc_sphincs_sk *sk, unsigned int layers)
+{
+	const struct lc_sphincs_func_ctx *f_ctx = lc_sphincs_get_ctx();
+	struct lc_sphincs_prepared_sk *out_sk = NULL;
+	spx_ctx ctx_int;
+	uint8_t *nodes;
+	uint32_t i;
+	int ret;
+
+	CKNULL(prepared_sk, -EINVAL);
+	CKNULL(sk, -EINVAL);
+	if (layers < 1 || layers > 2)
+		return -EINVAL;
+
+	sphincs_selftest_siggen();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_SLHDSA_SIGGEN);
+
+	ret = lc_alloc_aligned((void **)&out_sk, sizeof(uint64_t),
+			       sphincs_prepared_sk_size(layers));
+	if (ret)
+		return -ret;
+
+	memset(out_sk, 0, sphincs_prepared_sk_size(layers));
+	memcpy(&out_sk->sk, sk, sizeof(out_sk->sk));
+	out_sk->layers = layers;
+	out_sk->nodes = (uint8_t *)(out_sk + 1);
+
+	/*
+	 * Timecop: secret key is sensitive
+	 */
+	poison(&out_sk->sk, 2 * LC_SPX_N);
+
+	ctx_int.sk_seed = out_sk->sk.sk_seed;
+	ctx_int.pub_seed = out_sk->sk.pk;
+	CKINT(initialize_hash_function(&ctx_int));
+
+	/*
+	 * The Merkle tree nodes are public information, i.e. they are part of
+	 * the signature.
+	 */
+	CKINT(sphincs_prepared_gen_tree(out_sk->nodes, f_ctx, &ctx_int,
+					LC_SPX_D - 1, 0));
+	unpoison(out_sk->nodes, LC_SPX_PREPARED_NODES * LC_SPX_N);
+
+	/* The root of the top-most tree must match the public key. */
+	if (lc_memcmp_secure(out_sk->nodes +
+				     LC_SPX_PREPARED_NODE(LC_SPX_TREE_HEIGHT,
+							  0) *
+					     LC_SPX_N,
+			     LC_SPX_N, sk->pk + LC_SPX_N, LC_SPX_N)) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	/* All trees of the layer below */
+	for (i = 0; layers > 1 && i < (1 << LC_SPX_TREE_HEIGHT); i++) {
+		nodes = out_sk->nodes +
+			(i + 1) * LC_SPX_PREPARED_NODES * LC_SPX_N;
+		CKINT(sphincs_prepared_gen_tree(nodes, f_ctx, &ctx_int,
+						LC_SPX_D - 2, i));
+		unpoison(nodes, LC_SPX_PREPARED_NODES * LC_SPX_N);
+	}
+
+	unpoison(&out_sk->sk, sizeof(out_sk->sk));
+	*prepared_sk = out_sk;
+	return 0;
+
+out:
+	unpoison(&out_sk->sk, sizeof(out_sk->sk));
+	lc_sphincs_prepared_sk_zero_free(out_sk);
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_prepared_ctx,
+		      struct lc_sphincs_sig *sig, struct lc_sphincs_ctx *ctx,
+		      const uint8_t *m, size_t mlen,
+		      const struct lc_sphincs_prepared_sk *prepared_sk,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	if (!prepared_sk)
+		return -EINVAL;
+
+	sphincs_selftest_siggen();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_SLHDSA_SIGGEN);
+
+	return sphincs_sign_internal(sig, ctx, m, mlen, &prepared_sk->sk,
+				     prepared_sk, rng_ctx);
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_prepared,
+		      struct lc_sphincs_sig *sig, const uint8_t *m, size_t mlen,
+		      const struct lc_sphincs_prepared_sk *prepared_sk,
+		      struct lc_rng_ctx *rng_ctx)
+{
+	LC_SPHINCS_CTX_ON_STACK(sphincs_ctx);
+	int ret = lc_sphincs_sign_prepared_ctx(sig, sphincs_ctx, m, mlen,
+					       prepared_sk, rng_ctx);
+
+	lc_sphincs_ctx_zero(sphincs_ctx);
+	return ret;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_sign_init, struct lc_sphincs_ctx *ctx,
 		      const struct lc_sphincs_sk *sk)
 {
@@ -480,6 +1137,7 @@ int lc_sphincs_verify_ctx_nocheck(const struct lc_sphincs_sig *sig,
 	CKNULL(pk, -EINVAL);
 
 	ctx_int.pub_seed = pk->pk;
+	CKINT(initialize_hash_function(&ctx_int));
 
 	set_type(ws->wots_addr, LC_SPX_ADDR_TYPE_WOTS);
 	set_type(ws->tree_addr, LC_SPX_ADDR_TYPE_HASHTREE);
@@ -519,11 +1177,11 @@ int lc_sphincs_verify_ctx_nocheck(const struct lc_sphincs_sig *sig,
 
 		/* Compute the leaf node using the WOTS public key. */
 		CKINT(thash(hash_ctx, ws->leaf, ws->wots_pk, LC_SPX_WOTS_LEN,
-			    pk->pk, ws->wots_pk_addr));
+			    &ctx_int, ws->wots_pk_addr));
 
 		/* Compute the root node of this subtree. */
 		CKINT(compute_root(ws->root, ws->leaf, ws->idx_leaf, 0,
-				   wots_sig, LC_SPX_TREE_HEIGHT, pk->pk,
+				   wots_sig, LC_SPX_TREE_HEIGHT, &ctx_int,
 				   ws->tree_addr));
 		wots_sig += LC_SPX_TREE_HEIGHT * LC_SPX_N;
 
@@ -564,6 +1222,336 @@ LC_INTERFACE_FUNCTION(int, lc_sphincs_verify, const struct lc_sphincs_sig *sig,
 	return ret;
 }
 
+/*
+ * Maximum number of signatures verified in lockstep, i.e. the number of lanes
+ * of the widest thash_batch implementation.
+ */
+#define LC_SPX_VERIFY_BATCH_LANES 8
+#define LC_SPX_VERIFY_BATCH_BUFLEN                                             \
+	(LC_SPX_N + LC_SPX_ADDR_BYTES + LC_SPX_WOTS_LEN * LC_SPX_N)
+
+#if (LC_SPX_FORS_TREES > LC_SPX_WOTS_LEN)
+#error "The thash_batch buffer is too small for the FORS public key"
+#endif
+
+struct sphincs_verify_batch {
+	uint64_t tree[LC_SPX_VERIFY_BATCH_LANES];
+	uint32_t idx_leaf[LC_SPX_VERIFY_BATCH_LANES];
+	uint32_t leaf_idx[LC_SPX_VERIFY_BATCH_LANES];
+	uint32_t indices[LC_SPX_VERIFY_BATCH_LANES][LC_SPX_FORS_TREES];
+	uint32_t wots_addr[LC_SPX_VERIFY_BATCH_LANES][8];
+	uint32_t addr[LC_SPX_VERIFY_BATCH_LANES * 8];
+	const uint8_t *sig[LC_SPX_VERIFY_BATCH_LANES];
+	uint8_t *out[LC_SPX_VERIFY_BATCH_LANES];
+	uint8_t *in[LC_SPX_VERIFY_BATCH_LANES];
+	uint8_t mhash[LC_SPX_VERIFY_BATCH_LANES][LC_SPX_FORS_MSG_BYTES];
+	uint8_t leaf[LC_SPX_VERIFY_BATCH_LANES][LC_SPX_N];
+	uint8_t node[LC_SPX_VERIFY_BATCH_LANES][2 * LC_SPX_N];
+	uint8_t root[LC_SPX_VERIFY_BATCH_LANES][LC_SPX_N];
+	uint8_t fors_roots[LC_SPX_VERIFY_BATCH_LANES]
+			  [LC_SPX_FORS_TREES * LC_SPX_N];
+	uint8_t wots_pk[LC_SPX_VERIFY_BATCH_LANES][LC_SPX_WOTS_BYTES];
+	uint8_t thash_buf[LC_SPX_VERIFY_BATCH_LANES *
+			  LC_SPX_VERIFY_BATCH_BUFLEN];
+};
+
+static void message_to_indices(uint32_t *indices,
+			       const uint8_t m[LC_SPX_FORS_MSG_BYTES])
+{
+	unsigned int i, j;
+	unsigned int offset = 0;
+
+	for (i = 0; i < LC_SPX_FORS_TREES; i++) {
+		indices[i] = 0;
+		for (j = 0; j < LC_SPX_FORS_HEIGHT; j++) {
+			indices[i] ^= ((m[offset >> 3] >> (~offset & 0x7)) & 1u)
+				      << (LC_SPX_FORS_HEIGHT - 1 - j);
+			offset++;
+		}
+	}
+}
+
+/*
+ * Lockstep version of compute_root: compute the root node of the tree of each
+ * lane from the leaf and the authentication path the signature pointer of the
+ * lane refers to. The roots are written to the node buffers. The address of
+ * each lane must be complete other than the tree height and tree index.
+ */
+static void sphincs_verify_batch_root(struct sphincs_verify_batch *b,
+				      const struct lc_sphincs_func_ctx *f_ctx,
+				      const spx_ctx *ctx, uint32_t idx_offset,
+				      uint32_t tree_height)
+{
+	unsigned int j, lanes = f_ctx->thash_batch_lanes;
+	uint32_t h, right;
+
+	for (j = 0; j < lanes; j++) {
+		right = (b->leaf_idx[j] & 1) * LC_SPX_N;
+
+		memcpy(b->node[j] + right, b->leaf[j], LC_SPX_N);
+		memcpy(b->node[j] + (LC_SPX_N - right), b->sig[j], LC_SPX_N);
+		b->sig[j] += LC_SPX_N;
+	}
+
+	for (h = 1; h <= tree_height; h++) {
+		for (j = 0; j < lanes; j++) {
+			/* The root ends up at the left of the node buffer */
+			right = ((b->leaf_idx[j] >> h) & 1) * LC_SPX_N;
+
+			set_tree_height(b->addr + j * 8, h);
+			set_tree_index(b->addr + j * 8,
+				       (b->leaf_idx[j] >> h) + (idx_offset >> h));
+			b->in[j] = b->node[j];
+			b->out[j] = b->node[j] + right;
+		}
+
+		f_ctx->thash_batch(b->out, b->in, 2, ctx, b->addr, b->thash_buf);
+
+		if (h == tree_height)
+			break;
+
+		/* Pick the neighbor from the authentication path */
+		for (j = 0; j < lanes; j++) {
+			right = ((b->leaf_idx[j] >> h) & 1) * LC_SPX_N;
+
+			memcpy(b->node[j] + (LC_SPX_N - right), b->sig[j],
+			       LC_SPX_N);
+			b->sig[j] += LC_SPX_N;
+		}
+	}
+}
+
+/*
+ * Lockstep version of fors_pk_from_sig: derive the FORS public key of each
+ * lane into the root buffer. The signature pointer of each lane must refer to
+ * the FORS signature.
+ */
+static void sphincs_verify_batch_fors(struct sphincs_verify_batch *b,
+				      const struct lc_sphincs_func_ctx *f_ctx,
+				      const spx_ctx *ctx)
+{
+	unsigned int i, j, lanes = f_ctx->thash_batch_lanes;
+	uint32_t idx_offset;
+
+	for (i = 0; i < LC_SPX_FORS_TREES; i++) {
+		idx_offset = i * (1 << LC_SPX_FORS_HEIGHT);
+
+		/* Derive the leaves from the included secret key parts. */
+		for (j = 0; j < lanes; j++) {
+			memset(b->addr + j * 8, 0, sizeof(uint32_t) * 8);
+			copy_keypair_addr(b->addr + j * 8, b->wots_addr[j]);
+			set_type(b->addr + j * 8, LC_SPX_ADDR_TYPE_FORSTREE);
+			set_tree_height(b->addr + j * 8, 0);
+			set_tree_index(b->addr + j * 8,
+				       b->indices[j][i] + idx_offset);
+
+			memcpy(b->node[j], b->sig[j], LC_SPX_N);
+			b->sig[j] += LC_SPX_N;
+			b->in[j] = b->node[j];
+			b->out[j] = b->leaf[j];
+			b->leaf_idx[j] = b->indices[j][i];
+		}
+		f_ctx->thash_batch(b->out, b->in, 1, ctx, b->addr, b->thash_buf);
+
+		/* Derive the corresponding root nodes of this tree. */
+		sphincs_verify_batch_root(b, f_ctx, ctx, idx_offset,
+					  LC_SPX_FORS_HEIGHT);
+		for (j = 0; j < lanes; j++) {
+			memcpy(b->fors_roots[j] + i * LC_SPX_N, b->node[j],
+			       LC_SPX_N);
+		}
+	}
+
+	/* Hash horizontally across all tree roots to derive the public key. */
+	for (j = 0; j < lanes; j++) {
+		memset(b->addr + j * 8, 0, sizeof(uint32_t) * 8);
+		copy_keypair_addr(b->addr + j * 8, b->wots_addr[j]);
+		set_type(b->addr + j * 8, LC_SPX_ADDR_TYPE_FORSPK);
+		b->in[j] = b->fors_roots[j];
+		b->out[j] = b->root[j];
+	}
+	f_ctx->thash_batch(b->out, b->in, LC_SPX_FORS_TREES, ctx, b->addr,
+			   b->thash_buf);
+}
+
+/*
+ * Verify up to thash_batch_lanes signatures in lockstep. Each signature is
+ * processed in its own lane of the vectorized thash implementation. Unused
+ * lanes operate on a copy of the first lane and their result is discarded.
+ */
+static int sphincs_verify_batch_lanes(int *res,
+				      const struct lc_sphincs_sig *const *sig,
+				      struct lc_sphincs_ctx *ctx,
+				      const uint8_t *const *m,
+				      const size_t *mlen, unsigned int num,
+				      const struct lc_sphincs_pk *pk,
+				      const struct lc_sphincs_func_ctx *f_ctx)
+{
+	unsigned int i, j, lanes = f_ctx->thash_batch_lanes;
+	spx_ctx ctx_int;
+	const uint8_t *pub_root = pk->pk + LC_SPX_N;
+	int ret = 0;
+	LC_DECLARE_MEM(b, struct sphincs_verify_batch, sizeof(uint64_t));
+
+	ctx_int.pub_seed = pk->pk;
+	CKINT(initialize_hash_function(&ctx_int));
+
+	/* Derive the message digests and leaf indices from R || PK || M. */
+	for (j = 0; j < num; j++) {
+		CKINT(hash_message(b->mhash[j], &b->tree[j], &b->idx_leaf[j],
+				   sig[j]->r, pk->pk, m[j], mlen[j], ctx));
+		b->sig[j] = sig[j]->sigfors;
+	}
+	for (; j < lanes; j++) {
+		memcpy(b->mhash[j], b->mhash[0], LC_SPX_FORS_MSG_BYTES);
+		b->tree[j] = b->tree[0];
+		b->idx_leaf[j] = b->idx_leaf[0];
+		b->sig[j] = sig[0]->sigfors;
+	}
+
+	for (j = 0; j < lanes; j++) {
+		message_to_indices(b->indices[j], b->mhash[j]);
+
+		/* Layer correctly defaults to 0, so no need to set_layer_addr */
+		set_type(b->wots_addr[j], LC_SPX_ADDR_TYPE_WOTS);
+		set_tree_addr(b->wots_addr[j], b->tree[j]);
+		set_keypair_addr(b->wots_addr[j], b->idx_leaf[j]);
+	}
+
+	sphincs_verify_batch_fors(b, f_ctx, &ctx_int);
+
+	/* For each subtree.. */
+	for (i = 0; i < LC_SPX_D; i++) {
+		for (j = 0; j < lanes; j++) {
+			set_layer_addr(b->wots_addr[j], i);
+			set_tree_addr(b->wots_addr[j], b->tree[j]);
+			set_keypair_addr(b->wots_addr[j], b->idx_leaf[j]);
+
+			/*
+			 * The WOTS chains of one signature are already
+			 * computed with all lanes. Unused lanes are skipped.
+			 */
+			if (j < num) {
+				CKINT(f_ctx->wots_pk_from_sig(
+					b->wots_pk[j], b->sig[j], b->root[j],
+					&ctx_int, b->wots_addr[j]));
+			}
+			b->sig[j] += LC_SPX_WOTS_BYTES;
+
+			memset(b->addr + j * 8, 0, sizeof(uint32_t) * 8);
+			set_type(b->addr + j * 8, LC_SPX_ADDR_TYPE_WOTSPK);
+			copy_keypair_addr(b->addr + j * 8, b->wots_addr[j]);
+			b->in[j] = b->wots_pk[j];
+			b->out[j] = b->leaf[j];
+		}
+
+		/* Compute the leaf nodes using the WOTS public keys. */
+		f_ctx->thash_batch(b->out, b->in, LC_SPX_WOTS_LEN, &ctx_int,
+				   b->addr, b->thash_buf);
+
+		for (j = 0; j < lanes; j++) {
+			memset(b->addr + j * 8, 0, sizeof(uint32_t) * 8);
+			set_type(b->addr + j * 8, LC_SPX_ADDR_TYPE_HASHTREE);
+			set_layer_addr(b->addr + j * 8, i);
+			set_tree_addr(b->addr + j * 8, b->tree[j]);
+			b->leaf_idx[j] = b->idx_leaf[j];
+		}
+
+		/* Compute the root nodes of this subtree. */
+		sphincs_verify_batch_root(b, f_ctx, &ctx_int, 0,
+					  LC_SPX_TREE_HEIGHT);
+
+		for (j = 0; j < lanes; j++) {
+			memcpy(b->root[j], b->node[j], LC_SPX_N);
+
+			/* Update the indices for the next layer. */
+			b->idx_leaf[j] = (b->tree[j] &
+					  ((1 << LC_SPX_TREE_HEIGHT) - 1));
+			b->tree[j] = b->tree[j] >> LC_SPX_TREE_HEIGHT;
+		}
+	}
+
+	/* Check if the root nodes equal the root node in the public key. */
+	for (j = 0; j < num; j++) {
+		res[j] = 0;
+		if (lc_memcmp_secure(b->root[j], LC_SPX_N, pub_root, LC_SPX_N))
+			res[j] = -EBADMSG;
+	}
+
+out:
+	LC_RELEASE_MEM(b);
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_batch_ctx, int *res,
+		      const struct lc_sphincs_sig *const *sig,
+		      struct lc_sphincs_ctx *ctx, const uint8_t *const *m,
+		      const size_t *mlen, unsigned int num,
+		      const struct lc_sphincs_pk *pk)
+{
+	const struct lc_sphincs_func_ctx *f_ctx = lc_sphincs_get_ctx();
+	unsigned int i, j, n;
+	int lane_res[LC_SPX_VERIFY_BATCH_LANES];
+	int ret = 0;
+
+	CKNULL(sig, -EINVAL);
+	CKNULL(ctx, -EINVAL);
+	CKNULL(m, -EINVAL);
+	CKNULL(mlen, -EINVAL);
+	CKNULL(pk, -EINVAL);
+
+	for (i = 0; i < num; i++)
+		CKNULL(sig[i], -EINVAL);
+
+	sphincs_selftest_sigver();
+	LC_SELFTEST_COMPLETED(LC_ALG_STATUS_SLHDSA_SIGVER);
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+
+		/*
+		 * Without a vectorized thash, or for a single remaining
+		 * signature, the regular verification is at least as fast.
+		 */
+		if (!f_ctx->thash_batch || n == 1) {
+			n = 1;
+			lane_res[0] = lc_sphincs_verify_ctx_nocheck(
+				sig[i], ctx, m[i], mlen[i], pk);
+			if (lane_res[0] && lane_res[0] != -EBADMSG)
+				return lane_res[0];
+		} else {
+			if (n > f_ctx->thash_batch_lanes)
+				n = f_ctx->thash_batch_lanes;
+			CKINT(sphincs_verify_batch_lanes(lane_res, sig + i, ctx,
+							 m + i, mlen + i, n, pk,
+							 f_ctx));
+		}
+
+		for (j = 0; j < n; j++) {
+			if (res)
+				res[i + j] = lane_res[j];
+			if (lane_res[j])
+				ret = -EBADMSG;
+		}
+	}
+
+out:
+	return ret;
+}
+
+LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_batch, int *res,
+		      const struct lc_sphincs_sig *const *sig,
+		      const uint8_t *const *m, const size_t *mlen,
+		      unsigned int num, const struct lc_sphincs_pk *pk)
+{
+	LC_SPHINCS_CTX_ON_STACK(sphincs_ctx);
+	int ret = lc_sphincs_verify_batch_ctx(res, sig, sphincs_ctx, m, mlen,
+					      num, pk);
+
+	lc_sphincs_ctx_zero(sphincs_ctx);
+	return ret;
+}
+
 LC_INTERFACE_FUNCTION(int, lc_sphincs_verify_init, struct lc_sphincs_ctx *ctx,
 		      const struct lc_sphincs_pk *pk)
 {
@@ -28,19 +28,34 @@
 #define SPHINCS_THASH_H
 
 #include "sphincs_type.h"
+#include "sphincs_internal.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 int thash(struct lc_hash_ctx *hash_ctx, uint8_t out[LC_SPX_N],
-	  const uint8_t *in, unsigned int inblocks,
-	  const uint8_t pub_seed[LC_SPX_N], uint32_t addr[8]);
+	  const uint8_t *in, unsigned int inblocks, const spx_ctx *ctx,
+	  uint32_t addr[8]);
 int thash_ascon(struct lc_hash_ctx *hash_ctx, uint8_t out[LC_SPX_N],
 		const uint8_t *in, unsigned int inblocks,
 		const uint8_t pub_seed[LC_SPX_N], uint32_t addr[8],
 		unsigned int addr_static, uint8_t *ascon_state, int first);
 
+/*
+ * Compute the tweakable hash of independent inputs, one per lane of the SIMD
+ * implementation.
+ */
+typedef void (*thash_batch_f)(uint8_t *out[], uint8_t *const in[],
+			      unsigned int inblocks, const spx_ctx *ctx,
+			      uint32_t *addrs, uint8_t *thash_buf);
+
+#if defined(LC_SPHINCS_SHA2) && LC_SPX_N >= 24
+int thash_sha512(uint8_t out[LC_SPX_N], const uint8_t *in,
+		 unsigned int inblocks, const spx_ctx *ctx,
+		 const uint32_t addr[8]);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
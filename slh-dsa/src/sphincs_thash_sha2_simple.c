@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "lc_sha256.h"
+#include "lc_sha512.h"
+#include "sphincs_type.h"
+#include "sphincs_address.h"
+#include "sphincs_hash.h"
+#include "sphincs_thash.h"
+#include "ret_checkers.h"
+
+#if LC_SPX_N >= 24
+/*
+ * H and T_l of categories 3 and 5:
+ * SHA-512(PK.seed || toByte(0, 128 - n) || ADRS^c || M)
+ */
+int thash_sha512(uint8_t out[LC_SPX_N], const uint8_t *in,
+		 unsigned int inblocks, const spx_ctx *ctx,
+		 const uint32_t addr[8])
+{
+	uint8_t digest[LC_SHA512_SIZE_DIGEST];
+	LC_SHA512_CTX_ON_STACK(sha512);
+
+	memcpy(sha512->hash_state, &ctx->state_seeded_512,
+	       offsetof(struct lc_sha512_state, partial));
+	lc_hash_update(sha512, (const uint8_t *)addr,
+		       LC_SPX_SHA256_ADDR_BYTES);
+	lc_hash_update(sha512, in, LC_SPX_N * inblocks);
+	lc_hash_final(sha512, digest);
+	memcpy(out, digest, LC_SPX_N);
+
+	lc_hash_zero(sha512);
+	return 0;
+}
+#endif
+
+/**
+ * Takes an array of inblocks concatenated arrays of LC_SPX_N bytes.
+ *
+ * F, H and T_l: SHA-256(PK.seed || toByte(0, 64 - n) || ADRS^c || M)
+ */
+int thash(struct lc_hash_ctx *hash_ctx, uint8_t out[LC_SPX_N],
+	  const uint8_t *in, unsigned int inblocks, const spx_ctx *ctx,
+	  uint32_t addr[8])
+{
+	uint8_t digest[LC_SHA256_SIZE_DIGEST];
+
+#if LC_SPX_N >= 24
+	if (inblocks > 1)
+		return thash_sha512(out, in, inblocks, ctx, addr);
+#endif
+
+	/* Truncate the digest to n bytes */
+	sphincs_sha256_seeded(hash_ctx, ctx);
+	lc_hash_update(hash_ctx, (uint8_t *)addr, LC_SPX_SHA256_ADDR_BYTES);
+	lc_hash_update(hash_ctx, in, LC_SPX_N * inblocks);
+	lc_hash_final(hash_ctx, digest);
+	memcpy(out, digest, LC_SPX_N);
+
+	return 0;
+}
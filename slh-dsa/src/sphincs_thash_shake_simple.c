@@ -33,13 +33,13 @@
  * Takes an array of inblocks concatenated arrays of LC_SPX_N bytes.
  */
 int thash(struct lc_hash_ctx *hash_ctx, uint8_t out[LC_SPX_N],
-	  const uint8_t *in, unsigned int inblocks,
-	  const uint8_t pub_seed[LC_SPX_N], uint32_t addr[8])
+	  const uint8_t *in, unsigned int inblocks, const spx_ctx *ctx,
+	  uint32_t addr[8])
 {
 	int ret;
 
 	CKINT(lc_hash_init(hash_ctx));
-	lc_hash_update(hash_ctx, pub_seed, LC_SPX_N);
+	lc_hash_update(hash_ctx, ctx->pub_seed, LC_SPX_N);
 	lc_hash_update(hash_ctx, (uint8_t *)addr, LC_SPX_ADDR_BYTES);
 	lc_hash_update(hash_ctx, in, LC_SPX_N * inblocks);
 
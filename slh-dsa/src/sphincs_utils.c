@@ -64,8 +64,7 @@ unsigned long long bytes_to_ull(const uint8_t *in, unsigned int inlen)
  */
 int compute_root(uint8_t *root, const uint8_t *leaf, uint32_t leaf_idx,
 		 uint32_t idx_offset, const uint8_t *auth_path,
-		 uint32_t tree_height, const uint8_t pub_seed[LC_SPX_N],
-		 uint32_t addr[8])
+		 uint32_t tree_height, const spx_ctx *ctx, uint32_t addr[8])
 {
 	LC_HASH_CTX_ON_STACK(hash_ctx, LC_SPHINCS_HASH_TYPE);
 	uint64_t ascon_state[LC_ASCON_HASH_STATE_WORDS];
@@ -97,22 +96,22 @@ int compute_root(uint8_t *root, const uint8_t *leaf, uint32_t leaf_idx,
 		if (leaf_idx & 1) {
 #if defined(LC_SPHINCS_TYPE_128F_ASCON) || defined(LC_SPHINCS_TYPE_128S_ASCON)
 			CKINT(thash_ascon(hash_ctx, buffer + LC_SPX_N, buffer,
-					  2, pub_seed, addr,
+					  2, ctx->pub_seed, addr,
 					  LC_SPX_ADDR_BYTES -
 						  LC_ASCON_HASH_RATE,
 					  (uint8_t *)ascon_state, i == 0));
 #else
-			CKINT(thash(hash_ctx, buffer + LC_SPX_N, buffer, 2,
-				    pub_seed, addr));
+			CKINT(thash(hash_ctx, buffer + LC_SPX_N, buffer, 2, ctx,
+				    addr));
 #endif
 			memcpy(buffer, auth_path, LC_SPX_N);
 		} else {
 #if defined(LC_SPHINCS_TYPE_128F_ASCON) || defined(LC_SPHINCS_TYPE_128S_ASCON)
-			thash_ascon(hash_ctx, buffer, buffer, 2, pub_seed, addr,
-				    LC_SPX_ADDR_BYTES - LC_ASCON_HASH_RATE,
+			thash_ascon(hash_ctx, buffer, buffer, 2, ctx->pub_seed,
+				    addr, LC_SPX_ADDR_BYTES - LC_ASCON_HASH_RATE,
 				    (uint8_t *)ascon_state, i == 0);
 #else
-			thash(hash_ctx, buffer, buffer, 2, pub_seed, addr);
+			thash(hash_ctx, buffer, buffer, 2, ctx, addr);
 #endif
 			memcpy(buffer + LC_SPX_N, auth_path, LC_SPX_N);
 		}
@@ -124,7 +123,7 @@ int compute_root(uint8_t *root, const uint8_t *leaf, uint32_t leaf_idx,
 	idx_offset >>= 1;
 	set_tree_height(addr, tree_height);
 	set_tree_index(addr, leaf_idx + idx_offset);
-	CKINT(thash(hash_ctx, root, buffer, 2, pub_seed, addr));
+	CKINT(thash(hash_ctx, root, buffer, 2, ctx, addr));
 
 out:
 #if defined(LC_SPHINCS_TYPE_128F_ASCON) || defined(LC_SPHINCS_TYPE_128S_ASCON)
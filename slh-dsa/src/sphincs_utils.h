@@ -51,8 +51,7 @@ unsigned long long bytes_to_ull(const unsigned char *in, unsigned int inlen);
  */
 int compute_root(uint8_t *root, const uint8_t *leaf, uint32_t leaf_idx,
 		 uint32_t idx_offset, const uint8_t *auth_path,
-		 uint32_t tree_height, const uint8_t pub_seed[LC_SPX_N],
-		 uint32_t addr[8]);
+		 uint32_t tree_height, const spx_ctx *ctx, uint32_t addr[8]);
 
 #if 0
 /**
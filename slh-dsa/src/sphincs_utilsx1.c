@@ -131,8 +131,8 @@ int treehashx1(unsigned char *root, unsigned char *auth_path,
 					  (uint8_t *)ascon_state, h == 0));
 #else
 			CKINT(thash(hash_ctx, &current_idx[1 * LC_SPX_N],
-				    &current_idx[0 * LC_SPX_N], 2,
-				    ctx->pub_seed, tree_addr));
+				    &current_idx[0 * LC_SPX_N], 2, ctx,
+				    tree_addr));
 #endif
 		}
 
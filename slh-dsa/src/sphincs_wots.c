@@ -67,7 +67,7 @@ static int gen_chain(uint8_t *out, const uint8_t *in, unsigned int start,
 				  LC_SPX_ADDR_BYTES - LC_ASCON_HASH_RATE,
 				  (uint8_t *)ascon_state, i == start));
 #else
-		CKINT(thash(hash_ctx, out, out, 1, ctx->pub_seed, addr));
+		CKINT(thash(hash_ctx, out, out, 1, ctx, addr));
 #endif
 	}
 
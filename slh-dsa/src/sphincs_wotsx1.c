@@ -133,15 +133,14 @@ int wots_gen_leafx1(unsigned char *dest, const spx_ctx *ctx, uint32_t leaf_idx,
 						  LC_ASCON_HASH_RATE,
 					  (uint8_t *)ascon_state, i == 0));
 #else
-			CKINT(thash(hash_ctx, buffer, buffer, 1, ctx->pub_seed,
+			CKINT(thash(hash_ctx, buffer, buffer, 1, ctx,
 				    leaf_addr));
 #endif
 		}
 	}
 
 	/* Do the final thash to generate the public keys */
-	CKINT(thash(hash_ctx, dest, pk_buffer, LC_SPX_WOTS_LEN, ctx->pub_seed,
-		    pk_addr));
+	CKINT(thash(hash_ctx, dest, pk_buffer, LC_SPX_WOTS_LEN, ctx, pk_addr));
 
 out:
 	lc_hash_zero(hash_ctx);
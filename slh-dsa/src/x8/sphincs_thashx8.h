@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#ifndef SPHINCS_THASHX8_H
+#define SPHINCS_THASHX8_H
+
+#include "sphincs_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LC_THASHX8_BUFLEN                                                      \
+	(LC_SPX_N + LC_SPX_ADDR_BYTES + LC_SPX_WOTS_LEN * LC_SPX_N)
+
+/*
+ * 8-way parallel thash for one or two input blocks (F and H) which the hash
+ * backends compute without an intermediate buffer. The out and in buffers may
+ * overlap.
+ */
+void thashx8_12(unsigned char *out[8], unsigned char *const in[8],
+		unsigned int inblocks, const spx_ctx *ctx,
+		uint32_t addrx8[8 * 8]);
+void thashx8(unsigned char *out[8], unsigned char *const in[8],
+	     unsigned int inblocks, const spx_ctx *ctx, uint32_t addrx8[8 * 8],
+	     uint8_t *thash_buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_THASHX8_H */
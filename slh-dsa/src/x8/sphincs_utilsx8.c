@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#include "sphincs_type.h"
+#include "sphincs_address.h"
+#include "sphincs_utils.h"
+#include "sphincs_thashx8.h"
+#include "sphincs_utilsx8.h"
+
+/*
+ * Generate the entire Merkle tree, computing the authentication path for leaf_idx,
+ * and the resulting root node using Merkle's TreeHash algorithm.
+ * Expects the layer and tree parts of the tree_addr to be set, as well as the
+ * tree type (i.e. LC_SPX_ADDR_TYPE_HASHTREE or LC_SPX_ADDR_TYPE_FORSTREE)
+ *
+ * This expects tree_addrx8 to be initialized to 8 parallel addr structures for
+ * the Merkle tree nodes
+ *
+ * Applies the offset idx_offset to indices before building addresses, so that
+ * it is possible to continue counting indices across trees.
+ *
+ * This works by using the standard Merkle tree building algorithm, except
+ * that each 'node' tracked is actually 8 consecutive nodes in the real tree.
+ * When we combine two logical nodes ABCDEFGH and STUVWXYZ, we perform the H
+ * operation on adjacent real nodes, forming the parent logical node
+ * (AB)(CD)(EF)(GH)(ST)(UV)(WX)(YZ)
+ *
+ * When we get to the top three levels of the real tree (where there is only
+ * one logical node), we continue this operation three more times; the right
+ * most real node will by the actual root (and the other 7 nodes will be
+ * garbage).  We follow the same thashx8 logic so that the 'extract
+ * authentication path components' part of the loop is still executed (and
+ * to simplify the code somewhat)
+ *
+ * This currently assumes tree_height >= 3 which is true for all supported
+ * parameter sets.
+ */
+void treehashx8(
+	unsigned char *root, unsigned char *auth_path, const spx_ctx *ctx,
+	uint32_t leaf_idx, uint32_t idx_offset, uint32_t tree_height,
+	void (*gen_leafx8)(unsigned char * /* Where to write the leaves */,
+			   const spx_ctx * /* ctx */, uint32_t addr_idx,
+			   void *info, uint8_t *ws_buf, uint8_t *thash_buf),
+	uint32_t tree_addrx8[8 * 8], void *info, uint8_t *stackx8, void *ws_buf,
+	uint8_t *thash_buf)
+{
+	uint32_t left_adj = 0,
+		 prev_left_adj = 0; /* When we're doing the top 4 */
+	/* levels, the left-most part of the tree isn't at the beginning */
+	/* of current[].  These give the offset of the actual start */
+
+	uint32_t idx;
+	uint32_t max_idx = (uint32_t)((1 << (tree_height - 3)) - 1);
+
+	for (idx = 0;; idx++) {
+		/* Current logical node */
+		uint8_t current_idx[8 * LC_SPX_N];
+
+		gen_leafx8(current_idx, ctx, 8 * idx + idx_offset, info, ws_buf,
+			   thash_buf);
+
+		/* Now combine the freshly generated right node with previously */
+		/* generated left ones */
+		uint32_t internal_idx_offset = idx_offset;
+		uint32_t internal_idx = idx;
+		uint32_t internal_leaf = leaf_idx;
+		uint32_t h; /* The height we are in the Merkle tree */
+		for (h = 0;; h++, internal_idx >>= 1, internal_leaf >>= 1) {
+			/* Special processing if we're at the top of the tree */
+			if (h >= tree_height - 3) {
+				if (h == tree_height) {
+					/* We hit the root; return it */
+					memcpy(root, &current_idx[7 * LC_SPX_N],
+					       LC_SPX_N);
+					return;
+				}
+				/* The tree indexing logic is a bit off in this case */
+				/* Adjust it so that the left-most node of the part of */
+				/* the tree that we're processing has index 0 */
+				prev_left_adj = left_adj;
+				left_adj = (uint32_t)(8 - (1 << (tree_height -
+								 h - 1)));
+			}
+
+			/* Check if we hit the top of the tree */
+			if (h == tree_height) {
+				/* We hit the root; return it */
+				memcpy(root, &current_idx[7 * LC_SPX_N],
+				       LC_SPX_N);
+				return;
+			}
+
+			/*
+			 * Check if one of the nodes we have is a part of the
+			 * authentication path; if it is, write it out
+			 */
+			if ((((internal_idx << 3) ^ internal_leaf) &
+			     (uint32_t)~0x7) == 0) {
+				memcpy(&auth_path[h * LC_SPX_N],
+				       &current_idx[(((internal_leaf & 7) ^ 1) +
+						     prev_left_adj) *
+						    LC_SPX_N],
+				       LC_SPX_N);
+			}
+
+			/*
+			 * Check if we're at a left child; if so, stop going up the stack
+			 * Exception: if we've reached the end of the tree, keep on going
+			 * (so we combine the last 8 nodes into the one root node in three
+			 * more iterations)
+			 */
+			if ((internal_idx & 1) == 0 && idx < max_idx) {
+				break;
+			}
+
+			/* Ok, we're at a right node (or doing the top 4 levels) */
+			/* Now combine the left and right logical nodes together */
+
+			/* Set the address of the node we're creating. */
+			uint32_t j;
+			unsigned char *out[8], *in[8];
+			unsigned char *left = &stackx8[h * 8 * LC_SPX_N];
+
+			internal_idx_offset >>= 1;
+			for (j = 0; j < 8; j++) {
+				set_tree_height(tree_addrx8 + j * 8, h + 1);
+				set_tree_index(tree_addrx8 + j * 8,
+					       (8 / 2) * (internal_idx &
+							  (uint32_t)~1) +
+						       j - left_adj +
+						       internal_idx_offset);
+				out[j] = &current_idx[j * LC_SPX_N];
+			}
+			for (j = 0; j < 4; j++) {
+				in[j] = &left[2 * j * LC_SPX_N];
+				in[j + 4] = &current_idx[2 * j * LC_SPX_N];
+			}
+			thashx8_12(out, in, 2, ctx, tree_addrx8);
+		}
+
+		/* We've hit a left child; save the current for when we get the */
+		/* corresponding right right */
+		memcpy(&stackx8[h * 8 * LC_SPX_N], current_idx, 8 * LC_SPX_N);
+	}
+}
+
+void thashx8_batch(uint8_t *out[8], uint8_t *const in[8],
+		   unsigned int inblocks, const spx_ctx *ctx,
+		   uint32_t addrx8[8 * 8], uint8_t *thash_buf)
+{
+	if (inblocks <= 2)
+		thashx8_12(out, in, inblocks, ctx, addrx8);
+	else
+		thashx8(out, in, inblocks, ctx, addrx8, thash_buf);
+}
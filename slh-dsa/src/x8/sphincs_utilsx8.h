@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+/*
+ * This code is derived in parts from the code distribution provided with
+ * https://github.com/sphincs/sphincsplus
+ *
+ * That code is released under Public Domain
+ * (https://creativecommons.org/share-your-work/public-domain/cc0/).
+ */
+
+#ifndef SPHINCS_UTILSX8_H
+#define SPHINCS_UTILSX8_H
+
+#include "sphincs_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * For a given leaf index, computes the authentication path and the resulting
+ * root node using Merkle's TreeHash algorithm.
+ * Expects the layer and tree parts of the tree_addr to be set, as well as the
+ * tree type (i.e. SPX_ADDR_TYPE_HASHTREE or SPX_ADDR_TYPE_FORSTREE).
+ * Applies the offset idx_offset to indices before building addresses, so that
+ * it is possible to continue counting indices across trees.
+ *
+ * This implementation uses the 8-way hash backend to compute internal nodes 8
+ * at a time (in parallel)
+ */
+void treehashx8(
+	unsigned char *root, unsigned char *auth_path, const spx_ctx *ctx,
+	uint32_t leaf_idx, uint32_t idx_offset, uint32_t tree_height,
+	void (*gen_leafx8)(unsigned char * /* Where to write the leaves */,
+			   const spx_ctx * /* ctx */, uint32_t addr_idx,
+			   void *info, uint8_t *ws_buf, uint8_t *thash_buf),
+	uint32_t tree_addrx8[8 * 8], void *info, uint8_t *stackx8, void *ws_buf,
+	uint8_t *thash_buf);
+
+/**
+ * Compute the tweakable hash of 8 independent inputs, one per lane. This is
+ * used to process 8 signatures in lockstep during batch verification.
+ */
+void thashx8_batch(uint8_t *out[8], uint8_t *const in[8],
+		   unsigned int inblocks, const spx_ctx *ctx,
+		   uint32_t addrx8[8 * 8], uint8_t *thash_buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_UTILSX8_H */
@@ -47,6 +47,24 @@
 #elif defined(LC_SPHINCS_TYPE_256F)
 #include "lc_sphincs_shake_256f.h"
 #include "sphincs_tester_vectors_shake_256f.h"
+#elif defined(LC_SPHINCS_TYPE_128F_SHA2)
+#include "lc_sphincs_sha2_128f.h"
+#include "sphincs_tester_vectors_sha2_128f.h"
+#elif defined(LC_SPHINCS_TYPE_128S_SHA2)
+#include "lc_sphincs_sha2_128s.h"
+#include "sphincs_tester_vectors_sha2_128s.h"
+#elif defined(LC_SPHINCS_TYPE_192F_SHA2)
+#include "lc_sphincs_sha2_192f.h"
+#include "sphincs_tester_vectors_sha2_192f.h"
+#elif defined(LC_SPHINCS_TYPE_192S_SHA2)
+#include "lc_sphincs_sha2_192s.h"
+#include "sphincs_tester_vectors_sha2_192s.h"
+#elif defined(LC_SPHINCS_TYPE_256F_SHA2)
+#include "lc_sphincs_sha2_256f.h"
+#include "sphincs_tester_vectors_sha2_256f.h"
+#elif defined(LC_SPHINCS_TYPE_256S_SHA2)
+#include "lc_sphincs_sha2_256s.h"
+#include "sphincs_tester_vectors_sha2_256s.h"
 #else
 #include "lc_sphincs_shake_256s.h"
 #include "sphincs_tester_vectors_shake_256s.h"
@@ -57,10 +75,212 @@ enum lc_sphincs_test_type {
 	LC_SPHINCS_PERF_KEYGEN,
 	LC_SPHINCS_PERF_SIGN,
 	LC_SPHINCS_PERF_VERIFY,
+	LC_SPHINCS_PERF_SIGN_PREPARED,
+	LC_SPHINCS_PERF_VERIFY_BATCH,
 };
 
+/*
+ * Executor processing the jobs in reverse order to verify that the jobs are
+ * independent of each other.
+ */
+static int lc_sphincs_test_executor(void *exec_data,
+				    int (*job)(void *job_data,
+					       unsigned int idx),
+				    void *job_data, unsigned int njobs)
+{
+	unsigned int *invocations = exec_data;
+	int ret = 0;
+
+	(*invocations)++;
+
+	while (njobs) {
+		njobs--;
+		ret |= job(job_data, njobs);
+	}
+
+	return ret;
+}
+
+static int lc_sphincs_test_exec(const struct lc_sphincs_test *tc)
+{
+	struct workspace {
+		struct lc_sphincs_pk pk;
+		struct lc_sphincs_sk sk;
+		struct lc_sphincs_sig sig;
+	};
+	struct lc_static_rng_data s_rng_state;
+	unsigned int invocations = 0;
+	int ret = 0;
+	LC_STATIC_DRNG_ON_STACK(s_drng, &s_rng_state);
+	LC_SPHINCS_CTX_ON_STACK(ctx);
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	ctx->executor = lc_sphincs_test_executor;
+	ctx->executor_data = &invocations;
+
+	s_rng_state.seed = tc->seed;
+	s_rng_state.seedlen = sizeof(tc->seed);
+	ret |= lc_sphincs_keypair_ctx(&ws->pk, &ws->sk, ctx, &s_drng);
+	ret |= lc_compare((uint8_t *)&ws->pk, tc->pk, sizeof(tc->pk),
+			  "Executor PK");
+	ret |= lc_compare((uint8_t *)&ws->sk, tc->sk, sizeof(tc->sk),
+			  "Executor SK");
+
+	ret |= lc_sphincs_sign_ctx(&ws->sig, ctx, tc->msg, sizeof(tc->msg),
+				   (struct lc_sphincs_sk *)tc->sk, NULL);
+	ret |= lc_compare((uint8_t *)&ws->sig, tc->sig, sizeof(tc->sig),
+			  "Executor SIG");
+
+	/* The signature generation must have used the executor */
+	if (invocations < 2)
+		ret = 1;
+
+	lc_sphincs_ctx_zero(ctx);
+	LC_RELEASE_MEM(ws);
+	return !!ret;
+}
+
+static int lc_sphincs_test_prepared(const struct lc_sphincs_test *tc)
+{
+	struct workspace {
+		struct lc_sphincs_sk sk;
+		struct lc_sphincs_sig sig;
+	};
+	struct lc_sphincs_prepared_sk *prepared_sk = NULL;
+	unsigned int invocations = 0, layers;
+	int ret = 0;
+	LC_SPHINCS_CTX_ON_STACK(ctx);
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	ctx->executor_data = &invocations;
+
+	/*
+	 * Caching the second layer implies the generation of 2^h' trees which
+	 * is only tested with the "f" parameter sets to limit the test time.
+	 */
+	for (layers = 1; layers <= ((LC_SPX_TREE_HEIGHT <= 4) ? 2 : 1);
+	     layers++) {
+		CKINT(lc_sphincs_prepared_sk_alloc(
+			&prepared_sk, (struct lc_sphincs_sk *)tc->sk, layers));
+
+		ret |= lc_sphincs_sign_prepared(&ws->sig, tc->msg,
+						sizeof(tc->msg), prepared_sk,
+						NULL);
+		ret |= lc_compare((uint8_t *)&ws->sig, tc->sig,
+				  sizeof(tc->sig), "Prepared SIG");
+
+		ctx->executor = lc_sphincs_test_executor;
+		ret |= lc_sphincs_sign_prepared_ctx(&ws->sig, ctx, tc->msg,
+						    sizeof(tc->msg),
+						    prepared_sk, NULL);
+		ret |= lc_compare((uint8_t *)&ws->sig, tc->sig,
+				  sizeof(tc->sig), "Prepared executor SIG");
+		ctx->executor = NULL;
+
+		lc_sphincs_prepared_sk_zero_free(prepared_sk);
+		prepared_sk = NULL;
+	}
+
+	if (invocations < 2)
+		ret = 1;
+
+	/* A secret key not matching its public key must be rejected */
+	memcpy(&ws->sk, tc->sk, sizeof(ws->sk));
+	ws->sk.pk[LC_SPX_N] ^= 0x01;
+	if (lc_sphincs_prepared_sk_alloc(&prepared_sk, &ws->sk, 1) !=
+	    -EINVAL) {
+		printf("Prepared key with wrong public key not rejected\n");
+		ret = 1;
+	}
+
+	/* Only 1 or 2 layers can be cached */
+	if (lc_sphincs_prepared_sk_alloc(&prepared_sk,
+					 (struct lc_sphincs_sk *)tc->sk,
+					 3) != -EINVAL) {
+		printf("Prepared key with 3 layers not rejected\n");
+		ret = 1;
+	}
+
+out:
+	lc_sphincs_prepared_sk_zero_free(prepared_sk);
+	lc_sphincs_ctx_zero(ctx);
+	LC_RELEASE_MEM(ws);
+	return !!ret;
+}
+
+#define LC_SPHINCS_TEST_BATCH 6
+
+static int lc_sphincs_test_batch(const struct lc_sphincs_test *tc)
+{
+	struct workspace {
+		struct lc_sphincs_sig sig, sig_corrupt;
+		uint8_t msg[sizeof(tc->msg)];
+	};
+	const struct lc_sphincs_sig *sigs[LC_SPHINCS_TEST_BATCH];
+	const uint8_t *msgs[LC_SPHINCS_TEST_BATCH];
+	size_t mlens[LC_SPHINCS_TEST_BATCH];
+	int res[LC_SPHINCS_TEST_BATCH];
+	/* Expected results for the signatures set up below */
+	static const int exp[LC_SPHINCS_TEST_BATCH] = {
+		0, 0, 0, -EBADMSG, -EBADMSG, 0
+	};
+	unsigned int i;
+	int ret = 0, rc;
+	LC_DECLARE_MEM(ws, struct workspace, sizeof(uint64_t));
+
+	/* Second valid signature over a different message */
+	memcpy(ws->msg, tc->msg, sizeof(ws->msg));
+	ws->msg[0] ^= 0x01;
+	CKINT(lc_sphincs_sign(&ws->sig, ws->msg, sizeof(ws->msg),
+			      (struct lc_sphincs_sk *)tc->sk, NULL));
+
+	memcpy(&ws->sig_corrupt, tc->sig, sizeof(ws->sig_corrupt));
+	ws->sig_corrupt.sight[0] ^= 0x01;
+
+	for (i = 0; i < LC_SPHINCS_TEST_BATCH; i++) {
+		sigs[i] = (struct lc_sphincs_sig *)tc->sig;
+		msgs[i] = tc->msg;
+		mlens[i] = sizeof(tc->msg);
+	}
+	sigs[1] = &ws->sig;
+	msgs[1] = ws->msg;
+	/* Signature does not match the message */
+	sigs[3] = &ws->sig;
+	/* Modified signature */
+	sigs[4] = &ws->sig_corrupt;
+
+	rc = lc_sphincs_verify_batch(res, sigs, msgs, mlens,
+				     LC_SPHINCS_TEST_BATCH,
+				     (struct lc_sphincs_pk *)tc->pk);
+	if (rc != -EBADMSG) {
+		printf("Batch verification returned %d\n", rc);
+		ret = 1;
+	}
+
+	for (i = 0; i < LC_SPHINCS_TEST_BATCH; i++) {
+		if (res[i] != exp[i]) {
+			printf("Batch verification of signature %u returned %d, expected %d\n",
+			       i, res[i], exp[i]);
+			ret = 1;
+		}
+	}
+
+	/* All valid signatures */
+	rc = lc_sphincs_verify_batch(NULL, sigs, msgs, mlens, 3,
+				     (struct lc_sphincs_pk *)tc->pk);
+	if (rc) {
+		printf("Batch verification of valid signatures returned %d\n",
+		       rc);
+		ret = 1;
+	}
+
+out:
+	LC_RELEASE_MEM(ws);
+	return !!ret;
+}
+
 static int lc_sphincs_test(const struct lc_sphincs_test *tc,
-			   enum lc_sphincs_test_type t)
+			   enum lc_sphincs_test_type t, unsigned int layers)
 {
 	struct workspace {
 		struct lc_sphincs_pk pk;
@@ -103,6 +323,27 @@ static int lc_sphincs_test(const struct lc_sphincs_test *tc,
 			   "SIG");
 	}
 
+	if (t == LC_SPHINCS_PERF_SIGN_PREPARED) {
+		struct lc_sphincs_prepared_sk *prepared_sk;
+
+		if (lc_sphincs_prepared_sk_alloc(
+			    &prepared_sk, (struct lc_sphincs_sk *)tc->sk,
+			    layers)) {
+			ret = 1;
+			goto out;
+		}
+
+		for (i = 0; i < 10; i++) {
+			ret |= lc_sphincs_sign_prepared_ctx(
+				&ws->sig, ctx, tc->msg, sizeof(tc->msg),
+				prepared_sk, NULL);
+		}
+		lc_compare((uint8_t *)&ws->sig, tc->sig, sizeof(tc->sig),
+			   "Prepared SIG");
+
+		lc_sphincs_prepared_sk_zero_free(prepared_sk);
+	}
+
 	if (t == LC_SPHINCS_REGRESSION || t == LC_SPHINCS_PERF_VERIFY) {
 		rounds = (t == LC_SPHINCS_PERF_VERIFY) ? 1000 : 1;
 
@@ -114,6 +355,26 @@ static int lc_sphincs_test(const struct lc_sphincs_test *tc,
 		}
 	}
 
+	if (t == LC_SPHINCS_PERF_VERIFY_BATCH) {
+		const struct lc_sphincs_sig *sigs[8];
+		const uint8_t *msgs[8];
+		size_t mlens[8];
+
+		for (i = 0; i < 8; i++) {
+			sigs[i] = (struct lc_sphincs_sig *)tc->sig;
+			msgs[i] = tc->msg;
+			mlens[i] = sizeof(tc->msg);
+		}
+
+		/* 1000 signature verifications */
+		for (i = 0; i < 125; i++) {
+			ret |= lc_sphincs_verify_batch_ctx(
+				NULL, sigs, ctx, msgs, mlens, 8,
+				(struct lc_sphincs_pk *)tc->pk);
+		}
+	}
+
+out:
 	LC_RELEASE_MEM(ws);
 	return !!ret;
 }
@@ -121,6 +382,7 @@ static int lc_sphincs_test(const struct lc_sphincs_test *tc,
 LC_TEST_FUNC(int, main, int argc, char *argv[])
 {
 	enum lc_sphincs_test_type t = LC_SPHINCS_REGRESSION;
+	unsigned int layers = 1;
 	int ret = 0;
 	int feat_disabled = 0;
 
@@ -141,10 +403,27 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 			t = LC_SPHINCS_PERF_SIGN;
 		if (argv[1][0] == 'v')
 			t = LC_SPHINCS_PERF_VERIFY;
+		if (argv[1][0] == 'b')
+			t = LC_SPHINCS_PERF_VERIFY_BATCH;
+		/* "p" caches one hypertree layer, "p2" caches two layers */
+		if (argv[1][0] == 'p') {
+			t = LC_SPHINCS_PERF_SIGN_PREPARED;
+			if (argv[1][1] == '2')
+				layers = 2;
+		}
 		if (argv[1][0] == 'c') {
 			lc_cpu_feature_disable();
 			feat_disabled = 1;
 		}
+		/* Force the AVX2 implementation on AVX-512 capable systems */
+		if (argv[1][0] == 'a') {
+			if (!(lc_cpu_feature_available() &
+			      LC_CPU_FEATURE_INTEL_AVX2))
+				return 77;
+			lc_cpu_feature_set(LC_CPU_FEATURE_INTEL |
+					   LC_CPU_FEATURE_INTEL_AVX2);
+			feat_disabled = 1;
+		}
 	}
 
 	if (argc >= 3) {
@@ -159,7 +438,12 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 	feat_disabled = 1;
 #endif
 
-	ret = lc_sphincs_test(&tests[0], t);
+	ret = lc_sphincs_test(&tests[0], t, layers);
+	if (t == LC_SPHINCS_REGRESSION) {
+		ret += lc_sphincs_test_exec(&tests[0]);
+		ret += lc_sphincs_test_prepared(&tests[0]);
+		ret += lc_sphincs_test_batch(&tests[0]);
+	}
 
 	if (argc < 2) {
 		ret = test_validate_status(ret, LC_ALG_STATUS_SLHDSA_KEYGEN, 1);
@@ -168,6 +452,9 @@ LC_TEST_FUNC(int, main, int argc, char *argv[])
 
 #if (defined(LC_SPHINCS_TYPE_128F_ASCON) || defined(LC_SPHINCS_TYPE_128S_ASCON))
 		ret = test_validate_status(ret, LC_ALG_STATUS_ASCONXOF, 1);
+#elif defined(LC_SPHINCS_SHA2)
+		ret = test_validate_status(ret, LC_ALG_STATUS_SHA256, 1);
+		ret = test_validate_status(ret, LC_ALG_STATUS_HMAC, 1);
 #else
 #ifndef LC_FIPS140_DEBUG
 		ret = test_validate_status(ret, LC_ALG_STATUS_SHAKE, 1);
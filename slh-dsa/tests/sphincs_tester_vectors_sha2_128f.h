@@ -0,0 +1,2217 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SPHINCS_TESTER_VECTORS_SHA2_128F_H
+#define SPHINCS_TESTER_VECTORS_SHA2_128F_H
+
+#include "fips_mode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lc_sphincs_test {
+	uint8_t seed[LC_SPX_SEEDBYTES];
+	uint8_t msg[33];
+	uint8_t pk[sizeof(struct lc_sphincs_pk)];
+	uint8_t sk[sizeof(struct lc_sphincs_sk)];
+	uint8_t sig[sizeof(struct lc_sphincs_sig)];
+};
+
+LC_FIPS_RODATA_SECTION
+static const struct lc_sphincs_test tests[] =
+{
+	{
+		.seed = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47
+		},
+		.msg = {
+			0xd8, 0x1c, 0x4d, 0x8d, 0x73, 0x4f, 0xcb, 0xfb,
+			0xea, 0xde, 0x3d, 0x3f, 0x8a, 0x03, 0x9f, 0xaa,
+			0x2a, 0x2c, 0x99, 0x57, 0xe8, 0x35, 0xad, 0x55,
+			0xb2, 0x2e, 0x75, 0xbf, 0x57, 0xbb, 0x55, 0x6a,
+			0xc8
+		},
+		.pk = {
+			FIPS140_MOD(0xb5), 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0xfd, 0xf7, 0x40, 0x0a, 0xb7, 0xa5, 0xd8, 0xc7,
+			0xab, 0xa7, 0x35, 0x0a, 0xc4, 0x09, 0x2a, 0xdd
+		},
+		.sk = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0xfd, 0xf7, 0x40, 0x0a, 0xb7, 0xa5, 0xd8, 0xc7,
+			0xab, 0xa7, 0x35, 0x0a, 0xc4, 0x09, 0x2a, 0xdd
+		},
+		.sig = {
+			0x46, 0x5f, 0xcb, 0xf6, 0x34, 0x87, 0xb1, 0x02,
+			0x9d, 0x01, 0x5f, 0x1d, 0x2d, 0xb2, 0xeb, 0x11,
+			0x79, 0x78, 0xba, 0x56, 0x0d, 0x6e, 0xe4, 0x84,
+			0x17, 0x49, 0xf0, 0xff, 0x6c, 0xd4, 0xec, 0xea,
+			0x17, 0xf0, 0xd9, 0x4b, 0x27, 0xc1, 0xf6, 0x90,
+			0xd4, 0x89, 0xc9, 0x60, 0xc7, 0x69, 0x94, 0x6f,
+			0x99, 0xac, 0x78, 0xeb, 0xd1, 0xca, 0x99, 0x8a,
+			0x77, 0x00, 0x0d, 0x8c, 0xc9, 0x33, 0x27, 0xf7,
+			0xbb, 0xe1, 0x70, 0xee, 0x3a, 0x6a, 0x4b, 0x7b,
+			0xb1, 0xa9, 0x91, 0x8b, 0x87, 0x2a, 0x4b, 0xd5,
+			0xc8, 0xd1, 0x98, 0x6b, 0x75, 0xb0, 0xfd, 0xef,
+			0xf5, 0xa3, 0x4d, 0xa0, 0x4c, 0x5c, 0x4e, 0x6e,
+			0x2b, 0xd2, 0xe5, 0xb9, 0x29, 0x5a, 0x66, 0x9b,
+			0xa3, 0x27, 0xee, 0x87, 0x79, 0x12, 0x8c, 0x9f,
+			0x78, 0x62, 0xda, 0x7e, 0x6f, 0x23, 0x7f, 0xcb,
+			0x3a, 0x3f, 0x7b, 0xbf, 0xcd, 0x7b, 0x3b, 0x75,
+			0x95, 0x48, 0xdb, 0x9e, 0xf1, 0x38, 0x5d, 0x5d,
+			0xfd, 0x94, 0xd0, 0xaa, 0x27, 0x05, 0x25, 0xad,
+			0xe3, 0x5c, 0xbe, 0x67, 0x6f, 0x16, 0x17, 0xe0,
+			0xa4, 0x86, 0x95, 0xba, 0x8e, 0xc1, 0xd8, 0x09,
+			0x54, 0x77, 0xdf, 0x13, 0xe5, 0x4c, 0x1d, 0xd1,
+			0x28, 0xd4, 0xb4, 0xf0, 0xac, 0xd1, 0xb3, 0x8a,
+			0x07, 0x92, 0x8f, 0xb8, 0x0e, 0x6e, 0x64, 0x70,
+			0x34, 0x2e, 0x18, 0x25, 0xdf, 0x71, 0xd1, 0x25,
+			0xbe, 0xbb, 0x08, 0xea, 0x04, 0x8a, 0x09, 0xc1,
+			0xf0, 0xa8, 0x94, 0xe2, 0x2f, 0x70, 0x9c, 0x6a,
+			0x4f, 0x45, 0x66, 0x1b, 0x2d, 0x3b, 0xc7, 0xba,
+			0x2a, 0xae, 0x44, 0xe0, 0xc8, 0x8c, 0x45, 0x90,
+			0x01, 0xe4, 0x7c, 0xd2, 0x63, 0xf4, 0x14, 0xe3,
+			0xf2, 0x3c, 0xd9, 0xef, 0x8a, 0xee, 0x2a, 0x76,
+			0x06, 0x14, 0x58, 0x40, 0xa8, 0x63, 0x70, 0xfd,
+			0xd6, 0xc8, 0x2c, 0x79, 0x33, 0x33, 0x92, 0xd1,
+			0x46, 0x92, 0x5e, 0xd3, 0xd7, 0xf2, 0x45, 0xee,
+			0x4f, 0x14, 0x1c, 0xfb, 0xf0, 0x22, 0x30, 0x97,
+			0xbb, 0x29, 0x32, 0x99, 0x0f, 0x4f, 0xca, 0xe0,
+			0x07, 0xd6, 0x82, 0x8f, 0x23, 0xe0, 0xfd, 0xe5,
+			0x4a, 0xa7, 0xe4, 0xa9, 0xf1, 0x59, 0x38, 0x52,
+			0xee, 0x5d, 0x9d, 0xa5, 0x6f, 0x67, 0x4f, 0x63,
+			0x26, 0x71, 0x42, 0x11, 0x9e, 0xcd, 0xfa, 0x21,
+			0x93, 0x6e, 0x85, 0x7f, 0x55, 0xb7, 0x95, 0x59,
+			0xb1, 0x16, 0xa0, 0x48, 0x53, 0x04, 0x68, 0x68,
+			0x46, 0xbd, 0x4c, 0x04, 0x7d, 0x88, 0x9b, 0x1f,
+			0x6e, 0xf3, 0x5b, 0x77, 0x49, 0x1a, 0xf9, 0x95,
+			0x5e, 0x20, 0xa8, 0x41, 0x23, 0x01, 0xd5, 0x0b,
+			0xa3, 0x94, 0xb1, 0xb7, 0xa1, 0xb0, 0xcb, 0xc6,
+			0x61, 0x41, 0x55, 0xfc, 0xcb, 0x61, 0x26, 0x43,
+			0x1e, 0xd1, 0xf6, 0x4b, 0xc6, 0x8c, 0xd8, 0x85,
+			0x8e, 0xe4, 0x68, 0x1f, 0x81, 0x6f, 0x2a, 0xdc,
+			0x29, 0xce, 0xd9, 0xc4, 0xfd, 0x50, 0x4d, 0xa9,
+			0xf6, 0xed, 0xc1, 0x8b, 0x4e, 0x13, 0x3c, 0xd0,
+			0x9b, 0x83, 0x93, 0x25, 0x07, 0x2c, 0x2a, 0xab,
+			0xfa, 0x05, 0x0f, 0x5c, 0x85, 0xcc, 0x5b, 0x8a,
+			0xc2, 0x92, 0xa8, 0xaa, 0xb5, 0x59, 0x6e, 0x3e,
+			0xfe, 0xde, 0xa5, 0x1d, 0x08, 0x25, 0xd4, 0x42,
+			0x94, 0x72, 0x1a, 0xc0, 0x4d, 0x92, 0xdb, 0xfc,
+			0xad, 0xd2, 0x0d, 0x84, 0x3b, 0x69, 0x3d, 0x6e,
+			0x2a, 0x5f, 0xfb, 0xdd, 0x10, 0xf6, 0x86, 0xe6,
+			0xed, 0x21, 0x3c, 0x80, 0x3c, 0x9e, 0x87, 0x41,
+			0x45, 0x1d, 0xc7, 0xf3, 0x7f, 0x7a, 0x24, 0x69,
+			0xe4, 0xe1, 0x2e, 0x9b, 0xaa, 0x78, 0x95, 0x0e,
+			0x10, 0x1e, 0x24, 0x4f, 0xdf, 0x43, 0xee, 0x37,
+			0x03, 0x33, 0x1b, 0x33, 0x43, 0xa7, 0xcd, 0x06,
+			0x55, 0xae, 0x08, 0x88, 0xf9, 0xbc, 0xac, 0x0f,
+			0xe6, 0x95, 0x20, 0xb7, 0x14, 0x54, 0x69, 0x6a,
+			0x3b, 0x6b, 0x4f, 0xbe, 0x55, 0x13, 0xe8, 0x13,
+			0x92, 0xbe, 0x92, 0xa3, 0x39, 0x88, 0x4b, 0xa8,
+			0xe6, 0x95, 0x07, 0x87, 0xe3, 0xc6, 0x78, 0x65,
+			0xd5, 0x4b, 0x35, 0xd7, 0x7c, 0xc9, 0x0a, 0x60,
+			0x74, 0x95, 0x9f, 0xcf, 0x69, 0x6b, 0x00, 0x15,
+			0x9e, 0x0e, 0xf4, 0x1d, 0x9d, 0x99, 0x42, 0xc2,
+			0xe3, 0x4e, 0xe2, 0xfa, 0x25, 0x88, 0xab, 0x49,
+			0x05, 0x85, 0xbf, 0x2f, 0xea, 0x15, 0x2f, 0x8a,
+			0x27, 0x87, 0xa4, 0xba, 0xb3, 0x16, 0x09, 0x66,
+			0x63, 0x2a, 0x5e, 0x8b, 0x61, 0x43, 0x79, 0xfe,
+			0xcc, 0xcd, 0x72, 0xca, 0xa9, 0xf3, 0x3a, 0x88,
+			0x13, 0x89, 0xc9, 0x39, 0xe0, 0xda, 0xe7, 0x70,
+			0xce, 0x00, 0x5d, 0x48, 0x7b, 0x98, 0x89, 0x50,
+			0x89, 0x4d, 0xc6, 0xc7, 0x71, 0xcb, 0xef, 0xab,
+			0xb0, 0x98, 0x76, 0x73, 0xd1, 0x32, 0x10, 0xfa,
+			0x1e, 0xc1, 0xba, 0x4c, 0x51, 0xbc, 0xfb, 0x60,
+			0x67, 0x2e, 0xe8, 0x0b, 0x48, 0x41, 0x6c, 0x49,
+			0xac, 0xb8, 0x2a, 0x04, 0x7f, 0x47, 0xf9, 0xfa,
+			0x78, 0x6a, 0x9d, 0x19, 0xf1, 0x70, 0xc4, 0x29,
+			0xf0, 0x6e, 0xb0, 0xff, 0xe9, 0x76, 0x39, 0x16,
+			0x10, 0x1e, 0xc5, 0x2c, 0x26, 0x4b, 0x93, 0xeb,
+			0x78, 0x5c, 0x2c, 0x90, 0x60, 0xd7, 0x2e, 0x5b,
+			0x1f, 0x62, 0x95, 0x95, 0x7d, 0xda, 0x28, 0x8f,
+			0x1d, 0x0e, 0x75, 0x86, 0xd2, 0xb9, 0xc7, 0x2f,
+			0xac, 0xa1, 0x3f, 0xca, 0xc9, 0x52, 0xb0, 0x4b,
+			0xb5, 0x5e, 0xc4, 0x89, 0x80, 0x04, 0x2b, 0xf5,
+			0x72, 0xa3, 0xb1, 0x79, 0x70, 0x4f, 0xb3, 0x57,
+			0x8b, 0x35, 0x0e, 0xf3, 0xae, 0x43, 0x15, 0x96,
+			0x2d, 0x02, 0x3c, 0x74, 0xca, 0x40, 0x36, 0x6b,
+			0x43, 0x41, 0xdf, 0xf9, 0xeb, 0xe8, 0xc0, 0x3b,
+			0x48, 0xe2, 0x7b, 0xcd, 0x16, 0xbb, 0xcf, 0x9b,
+			0xa7, 0x81, 0xdf, 0x24, 0x41, 0xee, 0xf8, 0x47,
+			0x20, 0x22, 0xcb, 0xd4, 0xaa, 0xaf, 0x24, 0x15,
+			0x4f, 0xcf, 0x8a, 0x65, 0x57, 0xa2, 0x30, 0x6e,
+			0x78, 0x6e, 0xbd, 0xf4, 0x64, 0x42, 0xe9, 0x42,
+			0x5c, 0x1d, 0xfa, 0xc5, 0x18, 0x5b, 0xcc, 0x2a,
+			0x74, 0x2d, 0xe7, 0x64, 0xb4, 0xb9, 0xa2, 0x82,
+			0xc6, 0x29, 0xd1, 0xcb, 0x59, 0xcd, 0x4d, 0x53,
+			0x41, 0x6d, 0x45, 0xa9, 0x63, 0xe9, 0xe0, 0xa7,
+			0x05, 0x00, 0x73, 0xce, 0x2f, 0x8a, 0x02, 0x63,
+			0xf5, 0xd6, 0x32, 0xf8, 0xde, 0xfc, 0xb3, 0x85,
+			0xfa, 0xc4, 0x66, 0xec, 0xd0, 0x42, 0xa2, 0x97,
+			0x9a, 0xfd, 0xcc, 0x31, 0xbb, 0xf6, 0x57, 0x99,
+			0x01, 0xfc, 0x09, 0x53, 0xe0, 0xa9, 0x84, 0x39,
+			0xc9, 0xa8, 0x8f, 0x83, 0xbe, 0x63, 0x07, 0xd1,
+			0xcb, 0x32, 0x76, 0x1b, 0x64, 0x3b, 0x90, 0xdb,
+			0xf7, 0xf2, 0xaf, 0x20, 0xc0, 0x04, 0xb0, 0x41,
+			0xcf, 0x8c, 0x06, 0xfb, 0xd2, 0xf0, 0x5d, 0x09,
+			0x22, 0xc8, 0x96, 0x3c, 0x12, 0x4e, 0x93, 0x52,
+			0xb0, 0x5e, 0xc5, 0x34, 0x18, 0xe3, 0x6e, 0xf9,
+			0x51, 0x5f, 0xfe, 0x4c, 0xd9, 0xef, 0x70, 0x91,
+			0x64, 0xe2, 0x5f, 0xf2, 0x78, 0x00, 0xc3, 0xe1,
+			0x89, 0xd5, 0xed, 0x64, 0xb8, 0xf8, 0x74, 0x22,
+			0xab, 0x6e, 0x61, 0xb4, 0x4d, 0x34, 0x2f, 0x0b,
+			0xd8, 0x86, 0xf8, 0xa0, 0xac, 0x7a, 0x6f, 0x28,
+			0xee, 0x5d, 0x6b, 0x7f, 0xa5, 0xb0, 0xe4, 0xd8,
+			0xe4, 0xa3, 0x88, 0x65, 0xe1, 0x2a, 0x45, 0x00,
+			0xc8, 0x7f, 0xe8, 0x1d, 0x75, 0xd1, 0x65, 0xe3,
+			0xdb, 0x3f, 0x02, 0x49, 0x93, 0x7f, 0x1c, 0xdc,
+			0x44, 0x05, 0x25, 0x66, 0x96, 0xe3, 0x15, 0xa4,
+			0x12, 0xec, 0x20, 0xdc, 0xb5, 0x63, 0x7c, 0x67,
+			0x0f, 0x5c, 0xe3, 0xe2, 0xb6, 0x2c, 0x1c, 0xd0,
+			0x23, 0x0f, 0x98, 0x66, 0x6d, 0xca, 0x89, 0xe6,
+			0xe3, 0x22, 0x25, 0xb8, 0x78, 0x99, 0xa0, 0x9f,
+			0xfd, 0xe0, 0x48, 0x5f, 0x9b, 0x2c, 0x38, 0x24,
+			0x26, 0x2c, 0xd6, 0x3c, 0x12, 0x37, 0xcd, 0xe6,
+			0x50, 0xfe, 0xcf, 0xd2, 0x73, 0x0d, 0x27, 0x40,
+			0x02, 0xd3, 0x3c, 0x64, 0xc1, 0xc8, 0x1b, 0xe2,
+			0xe8, 0x8a, 0x5f, 0xa0, 0x65, 0x92, 0x9b, 0xba,
+			0x19, 0x9d, 0x7b, 0xc9, 0x66, 0x13, 0xe5, 0x01,
+			0x82, 0x57, 0x8b, 0xcd, 0x93, 0x03, 0xb1, 0x49,
+			0x79, 0x43, 0xff, 0xa6, 0x24, 0xd3, 0x4b, 0x9f,
+			0xc6, 0x1e, 0x39, 0x7c, 0x24, 0xef, 0x00, 0xea,
+			0xdc, 0x7c, 0x4a, 0x57, 0x6a, 0x29, 0x66, 0x90,
+			0xf9, 0xb2, 0x25, 0x24, 0x03, 0xe5, 0xdb, 0x3b,
+			0xb7, 0xa3, 0x78, 0xe6, 0x9d, 0x35, 0x46, 0x71,
+			0xc0, 0xa2, 0x24, 0x3c, 0x89, 0xd7, 0x24, 0x12,
+			0x2a, 0x62, 0x52, 0x61, 0x26, 0x8a, 0xc9, 0x3b,
+			0xbc, 0x5e, 0x1b, 0xdb, 0x97, 0x10, 0x35, 0x22,
+			0xf3, 0xc0, 0x16, 0x53, 0x5a, 0x65, 0x7a, 0xaf,
+			0xd8, 0xf4, 0x77, 0xc7, 0xb6, 0x54, 0x65, 0xee,
+			0x2d, 0x64, 0x84, 0xf7, 0x30, 0xa9, 0xdc, 0x20,
+			0xd4, 0xa3, 0x7c, 0x24, 0x89, 0x8a, 0xbe, 0xd5,
+			0xce, 0xa0, 0x65, 0xd7, 0xb3, 0xd0, 0x32, 0x73,
+			0x29, 0xa3, 0x02, 0xf1, 0x58, 0xdd, 0x91, 0xff,
+			0xdc, 0x9d, 0x21, 0x5a, 0xd6, 0xf2, 0x20, 0x03,
+			0x32, 0xa4, 0xa8, 0x29, 0x04, 0x88, 0x0f, 0xcd,
+			0x13, 0x0c, 0xc7, 0x48, 0x0a, 0x35, 0x2d, 0x2f,
+			0x61, 0x39, 0x00, 0x9b, 0xc1, 0xb7, 0x63, 0x1e,
+			0xc3, 0x40, 0x83, 0xcb, 0x1f, 0x1f, 0x49, 0x82,
+			0x3a, 0x23, 0x7d, 0x4e, 0xb0, 0x80, 0x6a, 0x1f,
+			0xf6, 0x63, 0x12, 0x07, 0xa7, 0x11, 0x8d, 0xa9,
+			0x78, 0x19, 0x50, 0x40, 0xa7, 0x9f, 0x91, 0x70,
+			0xa0, 0x7d, 0xe7, 0x08, 0xaf, 0x16, 0x19, 0x01,
+			0x81, 0x99, 0x5e, 0x3f, 0xe6, 0x08, 0x2c, 0xbc,
+			0x24, 0xab, 0x96, 0xdc, 0x20, 0x59, 0xd6, 0xcb,
+			0x12, 0x9e, 0x3b, 0x4b, 0xe2, 0xea, 0xdd, 0xb0,
+			0xd9, 0x51, 0xae, 0x84, 0x38, 0xe3, 0x32, 0xbe,
+			0x38, 0xcd, 0x1f, 0xd0, 0x28, 0x0e, 0x63, 0x45,
+			0x84, 0x33, 0xf1, 0x2f, 0x7a, 0xb0, 0x9b, 0xe4,
+			0xe6, 0x02, 0x91, 0x7f, 0x73, 0x14, 0x74, 0x88,
+			0xfe, 0x00, 0x20, 0xb0, 0x28, 0x45, 0x3c, 0xfc,
+			0xbe, 0x82, 0xe7, 0x4a, 0xb3, 0x19, 0x00, 0xef,
+			0x2b, 0x55, 0x33, 0x3d, 0xd1, 0xfd, 0xf4, 0xd9,
+			0x35, 0x49, 0x97, 0x2a, 0x33, 0x8a, 0xf3, 0xb5,
+			0xa2, 0x17, 0x60, 0x61, 0x9e, 0x04, 0x16, 0xfc,
+			0x3e, 0x37, 0x21, 0x32, 0x11, 0x8c, 0xba, 0x88,
+			0x10, 0xcd, 0xf3, 0xac, 0x05, 0x2e, 0x9d, 0x8e,
+			0xb9, 0x36, 0x20, 0x32, 0x06, 0xc3, 0x42, 0x65,
+			0xed, 0x5c, 0x4e, 0xca, 0x94, 0x8d, 0x30, 0x75,
+			0x99, 0xdf, 0xf4, 0x04, 0xd8, 0x42, 0xd6, 0x38,
+			0x78, 0xf6, 0xbb, 0x4e, 0x34, 0x6c, 0xda, 0x88,
+			0x44, 0xe3, 0x9f, 0x5d, 0x81, 0xfb, 0xf7, 0xa8,
+			0xdd, 0xdb, 0x57, 0xf8, 0x4a, 0xe3, 0x6a, 0xdd,
+			0x28, 0x03, 0x57, 0x20, 0xff, 0xa2, 0x14, 0x26,
+			0x92, 0x30, 0xf5, 0x6f, 0xab, 0x0f, 0x34, 0x63,
+			0xe5, 0x31, 0x73, 0xaf, 0x7e, 0x3f, 0x85, 0x44,
+			0x01, 0x8f, 0x3c, 0x2e, 0x72, 0xc5, 0xe3, 0x1e,
+			0x71, 0xe6, 0xf1, 0xd7, 0x9d, 0xac, 0xd0, 0x12,
+			0xf5, 0x98, 0x04, 0x8b, 0x76, 0x60, 0xdd, 0xd3,
+			0x14, 0xb3, 0x6b, 0x9d, 0xbe, 0x63, 0x40, 0x35,
+			0x9e, 0x09, 0xf5, 0x06, 0xab, 0x09, 0xc7, 0x3c,
+			0x92, 0xb0, 0xb8, 0xa2, 0x13, 0x77, 0x09, 0x86,
+			0xf2, 0x67, 0x6c, 0x0c, 0xe7, 0xa5, 0xd7, 0x29,
+			0x1e, 0xbb, 0xf7, 0x93, 0x16, 0x00, 0xe4, 0x24,
+			0x5b, 0xe2, 0xf9, 0x11, 0x9f, 0x07, 0x9c, 0x4c,
+			0x2d, 0x92, 0xeb, 0xb5, 0xb8, 0x7a, 0x33, 0xfb,
+			0x00, 0x6b, 0x20, 0xfb, 0x39, 0xc8, 0x27, 0xda,
+			0x9f, 0x75, 0x54, 0xc9, 0x46, 0x2d, 0x17, 0x46,
+			0x8c, 0x39, 0x45, 0xdc, 0xe4, 0x40, 0xe5, 0x3c,
+			0x4f, 0xa9, 0x57, 0xff, 0xdc, 0xe7, 0x7a, 0x7f,
+			0xc0, 0xc6, 0xaf, 0x6a, 0x84, 0xfa, 0xc3, 0x5e,
+			0xa9, 0xfe, 0x7b, 0xe3, 0x34, 0xe0, 0xa6, 0xf6,
+			0xfd, 0x8f, 0xaa, 0x2a, 0x0a, 0xbe, 0x64, 0xd8,
+			0xc9, 0x40, 0x78, 0xc8, 0xf0, 0x69, 0x43, 0x08,
+			0xbc, 0xc8, 0x7d, 0x88, 0x5f, 0xbb, 0x6c, 0xfe,
+			0x57, 0x30, 0xd5, 0x05, 0x0d, 0xc7, 0x69, 0x18,
+			0xf9, 0x62, 0x44, 0xd7, 0xb4, 0x35, 0xa2, 0x50,
+			0x3e, 0xd8, 0x1a, 0x02, 0x26, 0xd9, 0x3b, 0xdc,
+			0x04, 0x8a, 0x6b, 0x08, 0xdf, 0x87, 0xdd, 0x82,
+			0x9b, 0xfc, 0x36, 0x5b, 0x45, 0x1c, 0x46, 0xd8,
+			0x77, 0x71, 0xd4, 0x22, 0xf3, 0x80, 0x3f, 0x5e,
+			0x4a, 0x23, 0xe1, 0xed, 0x81, 0x7a, 0x44, 0x78,
+			0x13, 0x56, 0xbc, 0x7d, 0xea, 0x28, 0x8e, 0xff,
+			0xd3, 0x70, 0xc1, 0x5b, 0xf4, 0xd4, 0xda, 0xb5,
+			0x8b, 0x1f, 0xe7, 0x7c, 0xa7, 0x50, 0x7f, 0xdf,
+			0xef, 0x4d, 0x11, 0xe1, 0x8a, 0xde, 0xa3, 0xb4,
+			0x5f, 0x51, 0x79, 0x10, 0x2e, 0x8b, 0xfd, 0x42,
+			0x53, 0xb4, 0x0f, 0x65, 0xfb, 0x28, 0x20, 0x33,
+			0xf1, 0x37, 0xf7, 0x8d, 0x1b, 0x34, 0xbb, 0x25,
+			0x5c, 0xa2, 0xb1, 0x7e, 0x71, 0xac, 0x9a, 0xef,
+			0x54, 0x5a, 0x65, 0x72, 0x8b, 0xf0, 0xcb, 0x68,
+			0x9d, 0xe5, 0xa4, 0x5a, 0xa9, 0x3b, 0xb3, 0x94,
+			0x03, 0xd7, 0xfb, 0x07, 0xc9, 0x47, 0x02, 0x4b,
+			0xfd, 0xfe, 0xe0, 0x13, 0x6a, 0x53, 0x6d, 0xa8,
+			0xb4, 0x1c, 0x51, 0x13, 0xb1, 0x74, 0x6a, 0xa8,
+			0x09, 0x89, 0x15, 0x36, 0xa8, 0xba, 0x36, 0xc0,
+			0x1a, 0xb9, 0x0b, 0x6a, 0xd2, 0xf7, 0x13, 0x1d,
+			0x18, 0xd3, 0xdc, 0x98, 0x38, 0x11, 0xa0, 0xcd,
+			0x78, 0x8a, 0xa7, 0x74, 0x69, 0x85, 0x70, 0x71,
+			0xa3, 0xe8, 0x10, 0x8a, 0xf6, 0x14, 0x6c, 0x32,
+			0x4e, 0x20, 0xb4, 0xbb, 0x0c, 0x75, 0x92, 0x1c,
+			0x17, 0xef, 0xa9, 0x3a, 0x36, 0xa9, 0xdc, 0xd2,
+			0x46, 0x2b, 0xc7, 0xaf, 0xe5, 0xdd, 0x05, 0xd9,
+			0x67, 0xa6, 0xbb, 0xb9, 0x8f, 0xb4, 0x5c, 0xbc,
+			0xbe, 0x35, 0x21, 0xf6, 0x38, 0x75, 0x32, 0xf3,
+			0x4d, 0xd8, 0x3f, 0xd4, 0xb5, 0x58, 0xe8, 0x01,
+			0xd7, 0xbf, 0xf5, 0x37, 0xf9, 0x26, 0x1e, 0xb8,
+			0x11, 0xfc, 0x34, 0x22, 0xce, 0x96, 0xad, 0x7a,
+			0x02, 0x14, 0xd3, 0x66, 0x1a, 0x85, 0xd0, 0xea,
+			0xa9, 0x97, 0xf7, 0x35, 0x00, 0x12, 0x0d, 0xc3,
+			0xc8, 0x17, 0x96, 0xcf, 0x75, 0x82, 0xec, 0x74,
+			0x7d, 0xc7, 0x8d, 0xac, 0xfd, 0xea, 0x41, 0x00,
+			0x15, 0x8d, 0x2e, 0x97, 0x3e, 0x1f, 0xf7, 0x95,
+			0x18, 0xe2, 0xdf, 0x64, 0x66, 0xa2, 0x98, 0x28,
+			0x9a, 0xb0, 0xd1, 0xb8, 0x4c, 0x16, 0xe3, 0xf3,
+			0x43, 0x21, 0x43, 0x14, 0x3d, 0x56, 0x9a, 0x8b,
+			0xe0, 0x4a, 0x17, 0xc6, 0xe3, 0xc3, 0x55, 0xae,
+			0x87, 0xaa, 0x81, 0xc1, 0x41, 0x41, 0x6a, 0x39,
+			0xd1, 0x85, 0x87, 0xbf, 0xc3, 0xf2, 0x87, 0x64,
+			0xb2, 0x12, 0xd5, 0xf6, 0x78, 0xb6, 0x5d, 0x3d,
+			0xd5, 0x24, 0x75, 0x8e, 0x0c, 0x13, 0x50, 0x0d,
+			0x36, 0x9a, 0x42, 0x7f, 0x6d, 0x8c, 0x5c, 0x90,
+			0x14, 0x3b, 0xa6, 0x7c, 0x14, 0x72, 0x62, 0x4e,
+			0x07, 0x6b, 0x47, 0x19, 0x50, 0x81, 0x75, 0xc4,
+			0x95, 0x7d, 0x58, 0x39, 0xf9, 0x32, 0xb7, 0x0e,
+			0x2d, 0x57, 0xa2, 0x86, 0x5f, 0x8e, 0x73, 0x20,
+			0xc1, 0x76, 0x3e, 0xcf, 0x92, 0x4a, 0x4d, 0xe2,
+			0x99, 0x97, 0xa0, 0xb7, 0xa8, 0x57, 0xbc, 0xb1,
+			0x56, 0x21, 0xb2, 0x13, 0x92, 0x6b, 0x2b, 0xe8,
+			0x5f, 0x8d, 0x35, 0x98, 0xf4, 0x62, 0xed, 0x27,
+			0xe7, 0x64, 0xe2, 0x3b, 0x66, 0x16, 0x16, 0xb7,
+			0xfb, 0x3d, 0xd1, 0xdf, 0xf5, 0xd4, 0x62, 0xbe,
+			0x6e, 0x91, 0xf1, 0xc9, 0x99, 0x86, 0x99, 0xd8,
+			0x47, 0x2a, 0x61, 0x92, 0xc2, 0x97, 0x68, 0xcf,
+			0x04, 0x1b, 0x28, 0xa3, 0xf2, 0xc8, 0x52, 0xc4,
+			0x0a, 0x81, 0x83, 0xb0, 0x67, 0x93, 0x98, 0x6b,
+			0xa5, 0x1d, 0x29, 0xe0, 0xfd, 0x1a, 0xac, 0x66,
+			0xbd, 0x8a, 0xb7, 0xac, 0x38, 0x15, 0x66, 0x40,
+			0x40, 0x92, 0x17, 0xed, 0x56, 0x83, 0x67, 0xbb,
+			0x23, 0x40, 0x45, 0x7f, 0x45, 0x99, 0x50, 0x6b,
+			0xda, 0x42, 0x38, 0x31, 0x6a, 0x8e, 0xf6, 0x0a,
+			0x58, 0xd8, 0x95, 0xa2, 0x06, 0x84, 0x70, 0x3e,
+			0xcb, 0xbb, 0xaf, 0xf0, 0xc6, 0x75, 0x54, 0x13,
+			0x7e, 0x29, 0xdb, 0x15, 0x0d, 0x7b, 0xa6, 0x9d,
+			0xcc, 0x94, 0x40, 0x23, 0x97, 0x3c, 0x04, 0x89,
+			0xba, 0xd2, 0xe4, 0xdc, 0x4c, 0x6f, 0x7b, 0xc7,
+			0x55, 0x79, 0x2f, 0xae, 0x8f, 0xdb, 0xd4, 0x49,
+			0x84, 0x9c, 0x0a, 0xbb, 0x95, 0xdd, 0x70, 0xb2,
+			0xbe, 0x78, 0x03, 0xd4, 0xde, 0xf3, 0x50, 0xf0,
+			0x93, 0xce, 0xe9, 0x24, 0x14, 0x2d, 0x52, 0xfb,
+			0xfa, 0x58, 0xe3, 0x43, 0x0c, 0x54, 0x31, 0x73,
+			0xfe, 0x3c, 0x72, 0x6f, 0x0e, 0x51, 0x6c, 0xe9,
+			0x94, 0x04, 0x3e, 0x44, 0xfa, 0x41, 0xb4, 0xfc,
+			0x06, 0xb4, 0x7b, 0x10, 0x40, 0xfe, 0x5c, 0x79,
+			0x7c, 0xbe, 0x3b, 0x1d, 0x29, 0x86, 0x1a, 0x03,
+			0x83, 0xcc, 0xe2, 0x9c, 0x03, 0xfd, 0x1e, 0x26,
+			0x01, 0x8d, 0xe2, 0xe1, 0x39, 0x4a, 0x9a, 0x48,
+			0x53, 0xf6, 0xfa, 0x60, 0xf8, 0xd5, 0x78, 0x5b,
+			0x2d, 0x16, 0xf5, 0x6d, 0xaa, 0x08, 0x87, 0xb5,
+			0xfe, 0xb9, 0x2b, 0xd9, 0xcd, 0xf6, 0x48, 0x4f,
+			0x49, 0x43, 0x44, 0x51, 0x11, 0x8f, 0xc3, 0xa8,
+			0xad, 0x69, 0xba, 0x70, 0xfa, 0x5c, 0x7f, 0x1c,
+			0xfe, 0xc7, 0x1a, 0x6f, 0xa9, 0x5f, 0xf5, 0xa4,
+			0x19, 0xa1, 0xe7, 0x5c, 0xa4, 0x88, 0xad, 0x8e,
+			0x3d, 0xb7, 0xa1, 0x6b, 0x14, 0x9e, 0x3f, 0xfd,
+			0x6c, 0x50, 0x08, 0x85, 0x00, 0xfb, 0xc6, 0x96,
+			0x25, 0x9d, 0x4b, 0xcc, 0xe2, 0x3e, 0xf4, 0x40,
+			0x3d, 0x93, 0x18, 0x89, 0xd9, 0x0e, 0x91, 0xec,
+			0xaa, 0x1d, 0xcb, 0xb3, 0x0a, 0x83, 0x85, 0x7a,
+			0x0b, 0x7a, 0x74, 0x7c, 0x13, 0x35, 0xb6, 0xad,
+			0x36, 0x34, 0x44, 0x26, 0xc0, 0x77, 0xdb, 0xf2,
+			0x11, 0xb4, 0x7e, 0xde, 0x64, 0x0e, 0x9d, 0x0e,
+			0xc3, 0x38, 0xc9, 0x1c, 0x3c, 0x4d, 0xa8, 0x3b,
+			0x67, 0x79, 0x28, 0xdc, 0x91, 0x61, 0x71, 0x31,
+			0xb5, 0x0a, 0x3a, 0x44, 0x5d, 0x31, 0xe4, 0x43,
+			0xd6, 0x2a, 0xe7, 0x93, 0xe1, 0xe6, 0x06, 0x5b,
+			0xc1, 0xfd, 0xb5, 0x29, 0x52, 0x77, 0x51, 0x9d,
+			0x87, 0x00, 0xa4, 0x02, 0x99, 0x5b, 0x58, 0xa2,
+			0x72, 0xad, 0x96, 0x0d, 0xa5, 0x15, 0x2a, 0x46,
+			0xb9, 0x37, 0x27, 0xa7, 0x77, 0xf9, 0x10, 0x09,
+			0x5d, 0xde, 0x00, 0x31, 0x0a, 0xd6, 0x93, 0x60,
+			0x91, 0xfa, 0xe7, 0xe9, 0x9e, 0xc9, 0x63, 0x83,
+			0xf7, 0xfd, 0xdf, 0x8e, 0x57, 0x7c, 0x73, 0x20,
+			0xe3, 0x29, 0x19, 0xb2, 0x10, 0x4a, 0xf5, 0x49,
+			0xb2, 0xdb, 0xbc, 0x95, 0xe5, 0xd2, 0x70, 0x9d,
+			0xa9, 0x87, 0xf8, 0x03, 0x1f, 0x75, 0x53, 0x59,
+			0x33, 0xe5, 0x44, 0x13, 0x2d, 0x86, 0x55, 0xa4,
+			0x61, 0xb8, 0x9e, 0x8c, 0xc1, 0xe9, 0xff, 0x1e,
+			0x62, 0xfe, 0x74, 0xd3, 0x7e, 0xbc, 0xe0, 0x70,
+			0xf9, 0x45, 0x58, 0xb1, 0xb7, 0xb0, 0xaf, 0x22,
+			0x36, 0x7c, 0xc6, 0x11, 0xb6, 0x6a, 0xa4, 0xdc,
+			0xe3, 0xfb, 0x56, 0x80, 0x8d, 0x88, 0x38, 0xb0,
+			0x3c, 0xc9, 0xec, 0xf1, 0x94, 0xa6, 0xf8, 0x7d,
+			0x05, 0x10, 0xea, 0xb8, 0xe4, 0xa8, 0xbc, 0x74,
+			0x39, 0x84, 0xed, 0xef, 0xd6, 0x84, 0xbb, 0xd1,
+			0x83, 0x10, 0xce, 0xe2, 0x34, 0x21, 0x5d, 0x0f,
+			0x93, 0x92, 0xe8, 0x60, 0x20, 0x43, 0x80, 0x09,
+			0x47, 0x0f, 0x09, 0x7e, 0xb2, 0xef, 0x19, 0x2b,
+			0x39, 0x94, 0x54, 0xf7, 0xb4, 0x0b, 0x27, 0x2b,
+			0x57, 0xed, 0x18, 0xb3, 0xcb, 0xd4, 0x02, 0x86,
+			0x19, 0xa7, 0x58, 0xf8, 0xa5, 0xcd, 0xd8, 0x03,
+			0x32, 0x3c, 0x19, 0x79, 0x86, 0xa2, 0xae, 0xfb,
+			0x8f, 0x0e, 0x80, 0x9c, 0x7d, 0xb9, 0xd6, 0x65,
+			0xcf, 0x4e, 0x1e, 0xce, 0x17, 0x81, 0xe8, 0x2d,
+			0xa8, 0x65, 0x04, 0xd0, 0x38, 0x7c, 0x31, 0x02,
+			0x80, 0x01, 0x56, 0x4f, 0x4e, 0x87, 0x53, 0x50,
+			0x62, 0xa4, 0xb7, 0x82, 0x05, 0x3f, 0x65, 0x47,
+			0x61, 0xfc, 0xed, 0x46, 0xed, 0x10, 0x70, 0xcb,
+			0xc3, 0xef, 0xf1, 0x06, 0xc3, 0x06, 0x57, 0x93,
+			0x2d, 0xa1, 0x7e, 0x04, 0xad, 0x44, 0xef, 0x34,
+			0x39, 0x01, 0xc3, 0x46, 0xb5, 0xb7, 0x4d, 0x49,
+			0xe5, 0x4f, 0xa7, 0xb9, 0x04, 0xa4, 0xc8, 0x27,
+			0xe1, 0x9b, 0x0c, 0x11, 0xce, 0xbd, 0xed, 0xa8,
+			0xe3, 0xd3, 0x65, 0xa6, 0xf9, 0x47, 0xee, 0x2c,
+			0x58, 0xda, 0x50, 0x12, 0x54, 0xbd, 0x1c, 0xbe,
+			0x7e, 0xb3, 0x4c, 0x8a, 0x70, 0x64, 0xb2, 0xee,
+			0xac, 0xc9, 0x16, 0x18, 0xb6, 0xce, 0xef, 0x5a,
+			0x12, 0x9b, 0xec, 0x70, 0xa8, 0xd1, 0x2b, 0xba,
+			0x8e, 0x3c, 0xb0, 0x0a, 0xf3, 0x8c, 0x56, 0x21,
+			0xe4, 0x98, 0xa7, 0x3c, 0x38, 0x69, 0x3d, 0x64,
+			0x8c, 0x77, 0xbc, 0x27, 0xd7, 0xd4, 0x4c, 0x30,
+			0x50, 0x28, 0x73, 0x3f, 0x23, 0xe3, 0x87, 0x87,
+			0xea, 0x15, 0x43, 0xdb, 0x48, 0xe9, 0x09, 0x7c,
+			0x44, 0x3c, 0x07, 0x11, 0xc2, 0x5c, 0x93, 0x61,
+			0x44, 0xea, 0xd5, 0xee, 0x7c, 0x8b, 0x16, 0xda,
+			0x3c, 0x63, 0x0f, 0xe2, 0xa0, 0x89, 0x98, 0xd4,
+			0xf7, 0xce, 0xed, 0xde, 0xc2, 0x30, 0x76, 0xbf,
+			0xb1, 0x88, 0xc6, 0xbb, 0x77, 0xfc, 0x9f, 0xa3,
+			0x9a, 0xd7, 0xb3, 0x3f, 0x40, 0x71, 0x3f, 0x72,
+			0xe4, 0x6e, 0x48, 0x46, 0xd3, 0x13, 0x44, 0x0f,
+			0x0e, 0x83, 0x26, 0xfd, 0x1c, 0x17, 0x3b, 0xd7,
+			0xfc, 0x39, 0xa8, 0x2b, 0x3f, 0x60, 0x7f, 0xe6,
+			0x15, 0xf5, 0xee, 0x82, 0xda, 0xfe, 0xb3, 0x92,
+			0xeb, 0xbb, 0x02, 0xcd, 0xc8, 0x8f, 0x2a, 0x0f,
+			0x99, 0x5e, 0x90, 0x02, 0x0b, 0xb7, 0xf1, 0x4b,
+			0x3c, 0x16, 0x8e, 0xac, 0xf9, 0x42, 0x38, 0xbf,
+			0x43, 0xc4, 0x24, 0xbc, 0xd7, 0xdf, 0x38, 0xec,
+			0x33, 0xb0, 0x3e, 0x3a, 0xb6, 0xa5, 0x8f, 0x34,
+			0x74, 0xf5, 0x74, 0xf1, 0x39, 0x12, 0x44, 0x56,
+			0x84, 0x1b, 0xe9, 0x5f, 0xc4, 0x66, 0x1a, 0x59,
+			0xd2, 0xfb, 0x29, 0x6b, 0x2c, 0xc6, 0x59, 0xf7,
+			0x0c, 0xf0, 0x05, 0x4c, 0xce, 0x58, 0x5c, 0x2b,
+			0xc8, 0x1e, 0x20, 0x64, 0x35, 0x86, 0x5d, 0xfc,
+			0x16, 0xea, 0x40, 0x33, 0xc4, 0x18, 0x8b, 0x28,
+			0x30, 0xd5, 0x3a, 0x02, 0x3a, 0x0d, 0xa7, 0x7b,
+			0x4a, 0xb0, 0x4c, 0x9c, 0x74, 0x66, 0x74, 0xb8,
+			0xf8, 0xe8, 0xfb, 0x6c, 0x66, 0x01, 0x38, 0x4b,
+			0x28, 0x79, 0x72, 0x69, 0xf9, 0x86, 0x87, 0x6d,
+			0xca, 0x2c, 0x9c, 0x42, 0x69, 0xa1, 0xba, 0x80,
+			0x1d, 0x36, 0x70, 0x14, 0x3d, 0x9a, 0x84, 0xb5,
+			0xa5, 0x3c, 0xd9, 0x9c, 0xfb, 0x4c, 0xfb, 0xfc,
+			0x5e, 0x9d, 0x97, 0xbd, 0xbe, 0x90, 0x9b, 0x38,
+			0x8a, 0x21, 0x93, 0xa3, 0x09, 0x10, 0xd9, 0x8c,
+			0xf7, 0x50, 0x82, 0xdb, 0xb6, 0x89, 0x92, 0xe6,
+			0x96, 0xb9, 0x78, 0x67, 0x9f, 0x19, 0x80, 0xf7,
+			0x90, 0xfa, 0x83, 0xdb, 0x4e, 0xf4, 0x92, 0xb1,
+			0x1b, 0x89, 0x28, 0xa4, 0xd3, 0x35, 0xce, 0x9b,
+			0x0e, 0x9e, 0x6f, 0xc8, 0x71, 0x64, 0x3e, 0x4b,
+			0x23, 0x5d, 0xb4, 0xe8, 0x95, 0x85, 0xe8, 0x49,
+			0x1e, 0x24, 0x4c, 0xc3, 0xe0, 0x66, 0x4d, 0xfe,
+			0x80, 0x09, 0x43, 0xeb, 0x10, 0x9a, 0xd5, 0x99,
+			0x19, 0x52, 0xf5, 0x63, 0xfb, 0x42, 0xa3, 0x12,
+			0xb7, 0x33, 0x9d, 0x0b, 0xce, 0x81, 0x3a, 0xea,
+			0x77, 0x45, 0x02, 0xb5, 0xfd, 0xc1, 0x52, 0x54,
+			0xb6, 0x79, 0x1c, 0x09, 0x07, 0x82, 0xef, 0x03,
+			0x9d, 0xa2, 0x2b, 0x6a, 0x03, 0xa5, 0xf9, 0xf4,
+			0x5a, 0x64, 0x75, 0x70, 0x2d, 0x95, 0x41, 0x7b,
+			0x14, 0x49, 0xb8, 0x88, 0x58, 0x34, 0x4c, 0xfb,
+			0xee, 0x41, 0xe8, 0xe3, 0xdf, 0xc8, 0x17, 0xbd,
+			0xec, 0x37, 0x9b, 0x4f, 0x2d, 0x47, 0x69, 0x4f,
+			0x02, 0xe7, 0x4d, 0xdf, 0x7e, 0x05, 0xe2, 0x3d,
+			0x78, 0xf2, 0xaf, 0x33, 0xc8, 0x4c, 0x5c, 0x62,
+			0x58, 0xbb, 0xca, 0x35, 0xef, 0x4e, 0x6a, 0x31,
+			0x13, 0xd2, 0xfb, 0x8a, 0x6e, 0xfc, 0xc2, 0x6c,
+			0x0b, 0x13, 0xd9, 0x28, 0x9e, 0x53, 0xeb, 0xd1,
+			0x50, 0x79, 0x5b, 0x4c, 0xd1, 0x1b, 0x96, 0x97,
+			0x11, 0x68, 0xf7, 0x80, 0xea, 0xce, 0x77, 0x48,
+			0xd8, 0x02, 0x32, 0x71, 0xd7, 0x92, 0x18, 0xec,
+			0xbe, 0x85, 0x43, 0xf7, 0x39, 0x36, 0x7f, 0x2f,
+			0xab, 0x80, 0xe8, 0xfa, 0x3a, 0x45, 0x51, 0x29,
+			0xce, 0x94, 0xdf, 0x2b, 0x8b, 0x32, 0x5e, 0x68,
+			0x49, 0x24, 0x8e, 0x46, 0xc0, 0x41, 0xc8, 0x34,
+			0xc7, 0xe0, 0x99, 0x85, 0x15, 0xa6, 0x9a, 0x1f,
+			0x2a, 0x6f, 0xfe, 0xc9, 0xdd, 0x6e, 0x7e, 0x5b,
+			0x6c, 0xcb, 0x6a, 0x63, 0xdf, 0xda, 0xf2, 0xb6,
+			0x9a, 0xaa, 0x8f, 0x63, 0x3c, 0x8b, 0x70, 0x4b,
+			0x2b, 0x8e, 0x10, 0xd8, 0x77, 0x5f, 0xab, 0x2a,
+			0x86, 0xc9, 0xd5, 0x06, 0x9b, 0x3f, 0xdd, 0xc1,
+			0xed, 0xd3, 0x80, 0x64, 0x32, 0x70, 0x5c, 0x59,
+			0xb3, 0x22, 0x30, 0x47, 0x72, 0x87, 0x97, 0x75,
+			0x35, 0x69, 0x4d, 0x1a, 0x5d, 0x02, 0xd2, 0x14,
+			0x76, 0x5c, 0xb4, 0xe6, 0x38, 0x82, 0x22, 0xd9,
+			0xde, 0x8e, 0x85, 0x6b, 0x60, 0xb0, 0xdc, 0xa5,
+			0xcb, 0x58, 0x8b, 0x85, 0xde, 0x1c, 0x1f, 0x40,
+			0xe7, 0x8d, 0xfd, 0x4b, 0xc8, 0xf2, 0x2b, 0x77,
+			0x84, 0xf9, 0xc5, 0x55, 0x67, 0x01, 0x51, 0xcd,
+			0x78, 0x33, 0x1c, 0xc7, 0x08, 0x40, 0x2d, 0x85,
+			0x92, 0xc6, 0x1e, 0x61, 0x9e, 0x11, 0x7f, 0xe4,
+			0x31, 0xb3, 0x2f, 0x98, 0xf5, 0x54, 0x72, 0xe7,
+			0xd6, 0x06, 0x92, 0x0e, 0xf4, 0xb2, 0x7d, 0x4a,
+			0x1c, 0x9c, 0x70, 0xff, 0xdc, 0xf6, 0x28, 0xe5,
+			0x3c, 0x73, 0x04, 0xeb, 0xdc, 0xf3, 0xde, 0xff,
+			0x12, 0xf4, 0x8a, 0xc5, 0xc1, 0xd5, 0xd6, 0x81,
+			0x68, 0xac, 0x62, 0x35, 0xfd, 0x2f, 0xdc, 0x57,
+			0x91, 0xbb, 0xb6, 0x21, 0x2a, 0xb3, 0x21, 0x46,
+			0xfb, 0x66, 0x09, 0x73, 0x1c, 0x4a, 0x91, 0xe5,
+			0x06, 0x9b, 0x78, 0x5d, 0x74, 0x6d, 0xbc, 0x2b,
+			0x94, 0x48, 0x32, 0xd7, 0xf2, 0x15, 0x82, 0xc2,
+			0x35, 0x15, 0x33, 0xb2, 0x92, 0x3d, 0xf3, 0x28,
+			0x1f, 0xfc, 0x92, 0x17, 0x54, 0xee, 0x77, 0xdc,
+			0x6c, 0xec, 0x62, 0xf2, 0x7d, 0x87, 0x37, 0xa9,
+			0x4b, 0x65, 0xb2, 0xb6, 0xfa, 0xde, 0xf7, 0x76,
+			0x39, 0x3d, 0x8d, 0x55, 0x90, 0x6e, 0x22, 0xae,
+			0x85, 0x19, 0x4a, 0xa5, 0x2a, 0x93, 0x8a, 0xc1,
+			0xaf, 0xcd, 0x62, 0x17, 0xb9, 0xe3, 0x50, 0x5d,
+			0x15, 0xd3, 0x87, 0x2b, 0x7c, 0xcd, 0x6a, 0x90,
+			0x9c, 0xb6, 0x78, 0xe7, 0x9b, 0x9d, 0x3a, 0xc9,
+			0x2a, 0xcc, 0x7e, 0x8b, 0x76, 0x28, 0x59, 0x8c,
+			0x9a, 0x4d, 0xb6, 0x16, 0xd4, 0x96, 0x23, 0x88,
+			0x4d, 0xd1, 0xbc, 0x5e, 0xed, 0xfb, 0x1c, 0xcf,
+			0x49, 0x99, 0x74, 0xdb, 0x23, 0xbb, 0x98, 0x43,
+			0x37, 0x1f, 0xba, 0x62, 0xc4, 0x6c, 0x64, 0x5c,
+			0xde, 0xf7, 0xb8, 0xad, 0x2b, 0xd1, 0x56, 0x5f,
+			0x87, 0x32, 0x27, 0x24, 0xd6, 0xd0, 0x69, 0x1d,
+			0xf6, 0xe6, 0x73, 0xec, 0xe0, 0x2d, 0x66, 0xc8,
+			0x4e, 0x41, 0x9e, 0x96, 0xde, 0x59, 0x41, 0x16,
+			0x7b, 0x61, 0x1a, 0x3a, 0xff, 0xfa, 0xb6, 0x49,
+			0x41, 0xb9, 0xd3, 0x04, 0xce, 0x6a, 0xac, 0x4a,
+			0xc2, 0x36, 0x11, 0x35, 0x10, 0x4a, 0x10, 0x55,
+			0xb4, 0x4d, 0xfb, 0xe4, 0xea, 0x2c, 0x94, 0x29,
+			0x91, 0xb6, 0x3c, 0x3a, 0x54, 0xd8, 0x1e, 0xd0,
+			0x2b, 0x77, 0x7e, 0x79, 0x7f, 0x09, 0x3d, 0x75,
+			0xde, 0xe5, 0xc6, 0x00, 0x6d, 0x15, 0x88, 0xfc,
+			0xe4, 0x8b, 0x25, 0x71, 0xff, 0xf0, 0x31, 0xba,
+			0xde, 0xe4, 0x7e, 0x48, 0x2f, 0x0b, 0xed, 0x53,
+			0x43, 0xd0, 0x13, 0x2a, 0x79, 0xb6, 0x3c, 0xd3,
+			0x16, 0x69, 0x3f, 0x2f, 0x99, 0x19, 0xed, 0xe8,
+			0x3c, 0x1b, 0xd9, 0x52, 0x05, 0x3b, 0x33, 0x8e,
+			0x84, 0x54, 0xcb, 0xce, 0x86, 0xfc, 0x8e, 0xfe,
+			0xb0, 0xf2, 0x6e, 0x00, 0x8c, 0x40, 0x48, 0x31,
+			0x1a, 0x86, 0x69, 0x58, 0xee, 0xa0, 0xfa, 0x76,
+			0xd4, 0x1b, 0x03, 0xcb, 0x8d, 0xd2, 0x80, 0x0f,
+			0x3c, 0x57, 0x44, 0x48, 0x5f, 0x7f, 0x1a, 0xa8,
+			0x3b, 0x57, 0x09, 0x16, 0x84, 0xb2, 0xac, 0xbd,
+			0xfd, 0xdd, 0x54, 0x41, 0x8c, 0xf1, 0xeb, 0x5f,
+			0x10, 0x6a, 0x46, 0x50, 0xae, 0x6c, 0x3a, 0x29,
+			0x34, 0xd9, 0x6c, 0x76, 0xec, 0xa1, 0xf4, 0x38,
+			0xd4, 0x53, 0xb5, 0x51, 0xae, 0x39, 0x47, 0xad,
+			0xc2, 0x6a, 0x4d, 0x2c, 0x26, 0x53, 0xe2, 0x69,
+			0x2b, 0x01, 0xd9, 0x95, 0xfb, 0xfa, 0x26, 0x06,
+			0x04, 0x12, 0x5e, 0x7b, 0x2d, 0x54, 0xab, 0x80,
+			0x19, 0x97, 0xdd, 0xb7, 0xfb, 0x82, 0x07, 0xb3,
+			0x2e, 0x93, 0xcb, 0x49, 0x16, 0xe8, 0xc1, 0x94,
+			0x7b, 0x44, 0x85, 0x2f, 0x48, 0x30, 0xd9, 0xcc,
+			0x3d, 0x20, 0xd1, 0x6f, 0xce, 0x38, 0xcc, 0xe7,
+			0x76, 0x0e, 0x9f, 0xe6, 0x6f, 0xf0, 0x19, 0x93,
+			0x77, 0x32, 0x93, 0xe4, 0x5c, 0x75, 0xac, 0x13,
+			0xfc, 0x71, 0x52, 0x3a, 0x58, 0x8e, 0x93, 0xd8,
+			0xf6, 0xbb, 0xb7, 0x00, 0xd4, 0x09, 0xae, 0x6c,
+			0x8f, 0x34, 0x0c, 0x14, 0x02, 0x44, 0x61, 0x55,
+			0x8f, 0x3e, 0x65, 0xd4, 0xc5, 0x1f, 0xc2, 0xdf,
+			0x91, 0x61, 0x23, 0x2f, 0x68, 0xc2, 0xaa, 0xec,
+			0x41, 0x70, 0xbc, 0x51, 0x69, 0xaf, 0x43, 0xa4,
+			0x2a, 0x76, 0x87, 0x18, 0xfb, 0xca, 0xe7, 0x17,
+			0x31, 0x24, 0x77, 0xc6, 0xa7, 0x3a, 0x96, 0x11,
+			0x03, 0x56, 0x9f, 0xa8, 0x9e, 0x43, 0xd1, 0xaa,
+			0xb1, 0x40, 0x36, 0x8b, 0xbf, 0x05, 0xc3, 0x86,
+			0x77, 0x8f, 0x9e, 0x6b, 0x9b, 0x58, 0x22, 0xb1,
+			0x36, 0x4d, 0x8d, 0xb5, 0xf0, 0x98, 0x9b, 0xf8,
+			0x53, 0x15, 0x15, 0x8a, 0xa0, 0x7a, 0x92, 0x77,
+			0x16, 0x70, 0xce, 0x2a, 0x3b, 0x8a, 0xc1, 0x11,
+			0x5b, 0xfc, 0x11, 0xa1, 0xe7, 0x94, 0x4a, 0xf2,
+			0x7e, 0x5e, 0x91, 0x8c, 0x3d, 0x39, 0x9e, 0x4b,
+			0xda, 0x62, 0x35, 0x3a, 0x89, 0x0f, 0x91, 0x72,
+			0x30, 0x1b, 0x1f, 0xc2, 0xe3, 0x5e, 0xac, 0xe1,
+			0x65, 0x51, 0x5e, 0xb4, 0x32, 0x96, 0x2e, 0x61,
+			0x64, 0xdf, 0xa9, 0xd1, 0x5b, 0x50, 0xf9, 0x1b,
+			0xcd, 0x32, 0x00, 0x8e, 0x3f, 0x5b, 0xf0, 0x52,
+			0x74, 0xa4, 0x1f, 0x3c, 0xd1, 0xa8, 0xb0, 0xaa,
+			0x86, 0x5d, 0xd0, 0xc9, 0x31, 0xdb, 0x60, 0x1a,
+			0xc1, 0x49, 0x9b, 0x79, 0xad, 0xb3, 0x00, 0x96,
+			0x5c, 0x78, 0xe0, 0xe6, 0x95, 0xd2, 0x60, 0x58,
+			0x70, 0x68, 0x2b, 0xc6, 0x02, 0x72, 0x2e, 0xf2,
+			0xa4, 0xca, 0x50, 0xb8, 0x4a, 0xaf, 0xed, 0x45,
+			0x10, 0x16, 0x2a, 0xd9, 0x0c, 0x45, 0xbd, 0x5b,
+			0x7d, 0xac, 0xa3, 0xbe, 0x60, 0x07, 0x61, 0xac,
+			0x4e, 0xa2, 0xb4, 0xe3, 0xe4, 0x69, 0xa7, 0x81,
+			0x06, 0xd5, 0x9b, 0x6f, 0xe4, 0xd7, 0xa2, 0x68,
+			0xea, 0xb9, 0xad, 0x72, 0x51, 0x90, 0xec, 0x42,
+			0x84, 0x01, 0x89, 0x0d, 0x30, 0x54, 0x8c, 0xb7,
+			0x22, 0xc7, 0x0d, 0x36, 0xc9, 0x96, 0x95, 0x94,
+			0x2d, 0x7b, 0x71, 0xc8, 0xd1, 0xb2, 0x83, 0x19,
+			0x4f, 0xfa, 0x51, 0x5e, 0xc5, 0x29, 0xe7, 0xe0,
+			0xd3, 0x8e, 0xe6, 0x0e, 0x4d, 0x41, 0x01, 0xd2,
+			0xef, 0x93, 0xc2, 0x67, 0xa9, 0xff, 0x0b, 0xe9,
+			0x3c, 0x3d, 0x3b, 0x4d, 0xb6, 0x1f, 0xf0, 0x03,
+			0x9d, 0x56, 0x0e, 0xa6, 0x7e, 0xd1, 0x58, 0x74,
+			0xe1, 0x09, 0x1c, 0x80, 0xae, 0xc7, 0x66, 0x82,
+			0xca, 0xb3, 0x2e, 0x71, 0x54, 0xa0, 0xf1, 0xe3,
+			0x12, 0x27, 0xed, 0x40, 0x57, 0xc6, 0x15, 0x33,
+			0x31, 0x02, 0xde, 0x65, 0xf0, 0x04, 0x10, 0x75,
+			0x04, 0x91, 0x54, 0xcd, 0x42, 0x30, 0x6c, 0xa3,
+			0x9a, 0x66, 0x0e, 0xfe, 0x7c, 0x53, 0x43, 0x6b,
+			0x54, 0x39, 0x90, 0xe6, 0xe8, 0x1f, 0x06, 0x55,
+			0xad, 0x5c, 0xed, 0x3c, 0xa6, 0xb1, 0xcc, 0xd4,
+			0x94, 0x08, 0x1b, 0xeb, 0xf5, 0xa5, 0x51, 0x5d,
+			0xdb, 0x28, 0x4e, 0xac, 0xb2, 0xdd, 0x0a, 0xfa,
+			0xfb, 0xc1, 0x35, 0xcb, 0x8f, 0x73, 0x68, 0x60,
+			0x32, 0xcd, 0x90, 0xa1, 0x55, 0x48, 0x1e, 0x0c,
+			0x5c, 0xda, 0xd3, 0x86, 0x33, 0x2b, 0x85, 0xb8,
+			0xb9, 0xa5, 0x63, 0x00, 0xed, 0x3a, 0x1e, 0xaa,
+			0xf8, 0x76, 0x4e, 0xa9, 0x42, 0x72, 0xb6, 0xc4,
+			0x85, 0xbd, 0x54, 0xe9, 0x78, 0x51, 0xdc, 0x61,
+			0x22, 0x1d, 0x99, 0x4e, 0x6b, 0x89, 0x2f, 0xf4,
+			0x4f, 0xe8, 0xf7, 0xf6, 0xe0, 0xec, 0xd1, 0x14,
+			0xb7, 0x8e, 0x3e, 0x75, 0x53, 0xdc, 0xf7, 0x50,
+			0xf0, 0x1b, 0x6c, 0xe7, 0x16, 0x9f, 0x61, 0x82,
+			0xb7, 0x2f, 0x84, 0xd2, 0x02, 0xd5, 0x5b, 0xfb,
+			0x85, 0xde, 0xd1, 0xe6, 0xb4, 0x79, 0x08, 0xf0,
+			0x7c, 0xc4, 0x62, 0xac, 0xe2, 0xee, 0xaf, 0x0e,
+			0x39, 0xc8, 0xb0, 0x5f, 0xd3, 0x1f, 0xd2, 0x99,
+			0x03, 0xb3, 0xe3, 0xd0, 0x29, 0x4e, 0x77, 0xd8,
+			0xc8, 0xdb, 0x45, 0x67, 0xe8, 0x65, 0x4d, 0x3d,
+			0xb1, 0xe9, 0x45, 0x9c, 0x1d, 0x93, 0xfb, 0x4d,
+			0x5a, 0xcf, 0xbd, 0x23, 0x8e, 0xe8, 0x01, 0x79,
+			0xea, 0xec, 0x49, 0xd0, 0x7b, 0xd3, 0x3b, 0x24,
+			0xcc, 0x69, 0x1d, 0x47, 0x35, 0x23, 0x4f, 0x9b,
+			0x73, 0xf3, 0x0e, 0x75, 0xbb, 0x9b, 0xfa, 0xb7,
+			0x2d, 0x78, 0xcd, 0x40, 0xdb, 0x63, 0xc2, 0xaf,
+			0x27, 0xe1, 0x45, 0xa4, 0x6d, 0x36, 0x27, 0x82,
+			0x4c, 0x27, 0x8a, 0x04, 0xb5, 0x43, 0xae, 0xeb,
+			0x71, 0x6e, 0xb0, 0x49, 0x83, 0x99, 0xa2, 0x96,
+			0x71, 0x4e, 0x2e, 0x4b, 0xaa, 0xd5, 0x7b, 0xf6,
+			0xa5, 0xcc, 0x39, 0x8f, 0x9b, 0xfc, 0x0c, 0x3d,
+			0x18, 0x62, 0x08, 0x08, 0x36, 0x57, 0xe8, 0xc3,
+			0x29, 0xff, 0x6b, 0x17, 0x3e, 0x5a, 0xcd, 0x08,
+			0x1b, 0x6d, 0x37, 0xcc, 0x5c, 0x26, 0xe2, 0xec,
+			0xa5, 0x34, 0x64, 0x49, 0x96, 0x41, 0x5b, 0xa0,
+			0x87, 0x60, 0x8f, 0x85, 0x71, 0xf9, 0x42, 0xfb,
+			0x91, 0xef, 0xf3, 0xa5, 0x96, 0x58, 0xb7, 0x29,
+			0x8b, 0xe6, 0x6c, 0x41, 0xdc, 0x87, 0x78, 0x67,
+			0xe5, 0xa3, 0xc1, 0xd5, 0xb3, 0xcb, 0xaf, 0xd2,
+			0xec, 0xb0, 0x9f, 0x79, 0x32, 0xb6, 0xec, 0xd6,
+			0x00, 0xed, 0x6d, 0x77, 0x31, 0xca, 0xb8, 0x6a,
+			0x02, 0xf4, 0x6e, 0x16, 0x4e, 0xaa, 0x25, 0x94,
+			0xda, 0x1f, 0x8f, 0x2f, 0x56, 0x88, 0xe6, 0x99,
+			0x8c, 0x3d, 0x17, 0xdc, 0x9a, 0x86, 0xef, 0x05,
+			0x94, 0x8b, 0x40, 0x74, 0x63, 0xf5, 0xdd, 0x51,
+			0x1c, 0xdb, 0x68, 0x43, 0x6d, 0x41, 0x25, 0xb0,
+			0x02, 0xc6, 0x4d, 0x4b, 0xaa, 0x05, 0x09, 0x16,
+			0xcf, 0xc3, 0xc5, 0xbf, 0xdf, 0x13, 0x28, 0x28,
+			0x6f, 0x37, 0x55, 0x80, 0xf5, 0x32, 0xa7, 0xed,
+			0x5c, 0x32, 0xe1, 0x87, 0x3d, 0x8d, 0xa0, 0x25,
+			0x0a, 0x5b, 0xb0, 0xf2, 0x48, 0x0f, 0x5c, 0xb5,
+			0x9b, 0xc7, 0xd7, 0xb9, 0xf0, 0xbe, 0x96, 0xbc,
+			0x63, 0x33, 0x49, 0x42, 0x1f, 0x0c, 0x26, 0x8e,
+			0x95, 0x0b, 0xfb, 0xdd, 0xc4, 0x5a, 0xe6, 0x18,
+			0xfe, 0xd3, 0x20, 0x78, 0x28, 0xe0, 0x45, 0x68,
+			0x0e, 0xab, 0x5b, 0x9b, 0x2b, 0x65, 0x73, 0x3a,
+			0xaa, 0x7f, 0x06, 0xca, 0x25, 0x01, 0x9f, 0xfa,
+			0x3c, 0x3d, 0x49, 0xe8, 0x36, 0xc6, 0xfb, 0x23,
+			0x58, 0x75, 0x1d, 0x73, 0xf7, 0xbb, 0x41, 0xf9,
+			0xd6, 0xf5, 0x59, 0xa8, 0x6c, 0xdc, 0x99, 0x5d,
+			0xe4, 0x8c, 0xd8, 0x21, 0x1c, 0xff, 0x86, 0x63,
+			0x70, 0x3d, 0xfa, 0x9c, 0xdc, 0x07, 0x4a, 0xc1,
+			0xf2, 0x15, 0xee, 0x12, 0x2f, 0x16, 0x17, 0xbb,
+			0xe5, 0x34, 0x8c, 0xf2, 0x63, 0xcf, 0xeb, 0x94,
+			0x00, 0x23, 0x2c, 0x3b, 0xfb, 0x70, 0x2a, 0xe1,
+			0x8f, 0xb9, 0xb9, 0x69, 0x68, 0x69, 0x12, 0x59,
+			0x17, 0x61, 0x2d, 0x27, 0xf5, 0xc3, 0xf8, 0xa5,
+			0x17, 0xa8, 0x42, 0xde, 0xb4, 0x46, 0x05, 0xab,
+			0x8c, 0x21, 0x51, 0xdd, 0x9f, 0x3e, 0xf0, 0xd1,
+			0x6b, 0x58, 0x1f, 0x74, 0x28, 0xb6, 0x4e, 0x9c,
+			0x19, 0x5e, 0x00, 0x19, 0x13, 0xb0, 0x59, 0xa6,
+			0xb4, 0x12, 0x2a, 0x9e, 0x8a, 0xd0, 0xcc, 0x73,
+			0x82, 0xe9, 0xfa, 0x68, 0xf4, 0x81, 0xd4, 0x9f,
+			0x08, 0x43, 0x16, 0xf7, 0x4a, 0x51, 0x14, 0x93,
+			0x51, 0xf5, 0xc5, 0x8f, 0x57, 0x32, 0xc7, 0x4b,
+			0xae, 0x2b, 0xbd, 0x27, 0xa5, 0x1b, 0xbb, 0x00,
+			0x49, 0x7f, 0x19, 0xaa, 0x4a, 0xde, 0xa7, 0xb0,
+			0x18, 0xf6, 0xaf, 0x90, 0xf0, 0x78, 0x4f, 0x53,
+			0xd8, 0x96, 0x5d, 0xc9, 0xc7, 0xd6, 0x22, 0x4b,
+			0xd6, 0xdc, 0x34, 0xc7, 0x33, 0x8f, 0xac, 0xbd,
+			0x74, 0x02, 0xd4, 0x07, 0xab, 0x91, 0xbe, 0x84,
+			0x39, 0x33, 0xe2, 0xbc, 0x99, 0x49, 0xa2, 0x4e,
+			0x30, 0x91, 0x09, 0x83, 0x45, 0x86, 0xf1, 0xa9,
+			0xb1, 0x55, 0xda, 0xd9, 0x7e, 0x6e, 0xac, 0xbd,
+			0x4d, 0xc9, 0x1a, 0x04, 0x1b, 0x32, 0x04, 0x1e,
+			0x96, 0xd2, 0xf0, 0x67, 0x98, 0xfd, 0xef, 0xfd,
+			0x14, 0x25, 0x88, 0x8a, 0x65, 0x65, 0x32, 0xbd,
+			0x1e, 0x3e, 0x8c, 0x63, 0x46, 0xfe, 0x3b, 0xda,
+			0x7c, 0xcd, 0x62, 0x41, 0x94, 0x11, 0xcb, 0x2d,
+			0x52, 0x77, 0x01, 0xf5, 0xd7, 0x17, 0x25, 0x42,
+			0x31, 0x03, 0xd9, 0x33, 0x92, 0x49, 0x1b, 0x8d,
+			0x89, 0x40, 0x93, 0x21, 0x81, 0x65, 0xba, 0x54,
+			0x99, 0xa4, 0x0b, 0xcc, 0x62, 0x93, 0x3e, 0xa4,
+			0xeb, 0xce, 0x98, 0xcc, 0x29, 0x2e, 0x6d, 0x93,
+			0x69, 0x23, 0xcb, 0xee, 0x78, 0xe3, 0x84, 0x44,
+			0x8c, 0x3d, 0xc2, 0x59, 0x9a, 0x12, 0xbf, 0x72,
+			0x8b, 0x49, 0x54, 0xae, 0xb3, 0x03, 0x0d, 0xa9,
+			0xaf, 0x37, 0xa8, 0x95, 0xd9, 0xb8, 0xa6, 0x48,
+			0x88, 0xdc, 0xe9, 0x1f, 0x4c, 0xc2, 0x1c, 0xd9,
+			0x51, 0xaf, 0xa3, 0x07, 0xeb, 0x50, 0x01, 0xde,
+			0x89, 0xa7, 0xea, 0x09, 0xee, 0x76, 0xb4, 0xa6,
+			0x6f, 0x28, 0xaa, 0xb0, 0x5f, 0xe4, 0x76, 0x55,
+			0x77, 0x8b, 0x34, 0x55, 0xc2, 0x5e, 0x40, 0xf0,
+			0x4d, 0xac, 0x1e, 0x8a, 0x96, 0xd7, 0xea, 0xfd,
+			0x79, 0x2d, 0x03, 0xfb, 0x6e, 0xa7, 0xdb, 0x4a,
+			0x30, 0xce, 0x9b, 0xe7, 0x08, 0xc0, 0xe1, 0x7a,
+			0xbf, 0xec, 0xa9, 0xa2, 0xe9, 0x38, 0xad, 0x9b,
+			0x88, 0x1a, 0xbb, 0xfa, 0x19, 0x2d, 0x48, 0x93,
+			0x54, 0x15, 0x59, 0x22, 0x0c, 0x16, 0xf8, 0xfd,
+			0xb2, 0xde, 0xa1, 0xb6, 0x2d, 0xe8, 0x84, 0xa5,
+			0x39, 0x0e, 0x6e, 0x0f, 0x0c, 0xef, 0xe1, 0x8b,
+			0x0a, 0xcb, 0x1c, 0xf6, 0xbe, 0xd6, 0xdd, 0xfb,
+			0x87, 0xc1, 0xf5, 0x83, 0xb2, 0xad, 0xbc, 0xbe,
+			0xc3, 0x45, 0x84, 0x44, 0x38, 0xab, 0x99, 0x6a,
+			0xbb, 0x30, 0x1f, 0x39, 0xfc, 0x73, 0x58, 0x7a,
+			0x6f, 0x85, 0xa6, 0xd2, 0x25, 0x86, 0xcc, 0x3c,
+			0x4d, 0x05, 0x81, 0xec, 0x10, 0x34, 0xa1, 0xaa,
+			0x60, 0xfb, 0x40, 0x81, 0xc3, 0xfc, 0xe2, 0x4e,
+			0xf3, 0x2c, 0xf0, 0xd7, 0x18, 0xad, 0x76, 0xfe,
+			0x08, 0x1e, 0x56, 0xed, 0x95, 0xef, 0xb9, 0xc7,
+			0x41, 0xd5, 0xc3, 0x4f, 0x45, 0xf9, 0x8d, 0xc5,
+			0x71, 0x26, 0x0c, 0x3b, 0x83, 0xcc, 0x84, 0x87,
+			0xc6, 0x1b, 0x0b, 0xd9, 0xeb, 0x23, 0xb6, 0xc2,
+			0x00, 0xcf, 0xc1, 0xdb, 0x3d, 0xfb, 0x6c, 0x8f,
+			0x05, 0xde, 0x60, 0x81, 0xbc, 0x7b, 0x0d, 0x91,
+			0x47, 0x37, 0x09, 0xba, 0xef, 0x0b, 0x80, 0x23,
+			0xd2, 0xef, 0x6a, 0x9a, 0xc7, 0x82, 0x7d, 0xa1,
+			0x28, 0x81, 0xde, 0x78, 0x1e, 0x57, 0x68, 0x51,
+			0x1d, 0x4f, 0x93, 0xc5, 0xb3, 0x5c, 0xb5, 0xb7,
+			0xa6, 0x6f, 0x11, 0x5c, 0xb1, 0xa8, 0xf8, 0x77,
+			0x6e, 0x39, 0xf6, 0xb6, 0x5b, 0x33, 0xdf, 0xc0,
+			0x53, 0xd0, 0xb3, 0x27, 0x51, 0xdc, 0xb3, 0x67,
+			0x7f, 0xff, 0x54, 0x69, 0x8d, 0x53, 0xef, 0x06,
+			0xc0, 0x4f, 0xc0, 0x8b, 0xdd, 0x0a, 0xfe, 0x58,
+			0x25, 0xf3, 0x3f, 0x64, 0xd3, 0x04, 0x9b, 0x47,
+			0xab, 0x14, 0x70, 0xea, 0x60, 0xb3, 0xd4, 0x14,
+			0xdc, 0xca, 0x7a, 0x73, 0x89, 0xcb, 0x97, 0xe6,
+			0xef, 0x07, 0x99, 0x6a, 0x86, 0xa1, 0x9a, 0xa5,
+			0xb7, 0x9a, 0xbf, 0xdd, 0xa5, 0xfe, 0xfa, 0x3f,
+			0x7c, 0xb6, 0x9d, 0x5c, 0x09, 0xef, 0xba, 0xc4,
+			0xe2, 0x38, 0x57, 0xbe, 0x4f, 0xe2, 0x27, 0x41,
+			0x15, 0x97, 0x1a, 0x74, 0x8b, 0x50, 0x63, 0x05,
+			0x2c, 0x86, 0x7f, 0xd8, 0x76, 0xe2, 0x43, 0x36,
+			0x42, 0xb7, 0xfa, 0x46, 0x9e, 0x22, 0x76, 0x88,
+			0xcd, 0xfb, 0x4b, 0xdd, 0xd4, 0xe2, 0x93, 0x17,
+			0xf7, 0x2a, 0x44, 0x01, 0x02, 0x4c, 0x7a, 0x7e,
+			0xfc, 0x0a, 0xc3, 0x4f, 0x47, 0x4e, 0x48, 0x0d,
+			0x66, 0xbd, 0xab, 0x35, 0x7a, 0x71, 0x28, 0x07,
+			0x6b, 0x3e, 0xef, 0xe7, 0x0d, 0x49, 0xb3, 0x3b,
+			0xfc, 0x41, 0x76, 0x07, 0xff, 0x01, 0xe4, 0x5b,
+			0x80, 0xc4, 0x1a, 0x87, 0x3c, 0x04, 0xb9, 0xbe,
+			0x5e, 0x23, 0x27, 0x2f, 0x6a, 0x11, 0x3e, 0x09,
+			0xc4, 0x36, 0x2b, 0x41, 0x7c, 0x6f, 0x24, 0x8c,
+			0x97, 0x75, 0xb8, 0x4d, 0x1b, 0x51, 0x74, 0xb7,
+			0x21, 0x93, 0x1c, 0xf7, 0xf9, 0x4f, 0x37, 0x98,
+			0xbc, 0x00, 0xcd, 0xc8, 0xc1, 0x22, 0x7b, 0xd8,
+			0xa8, 0x54, 0xfe, 0xa2, 0x56, 0x9a, 0xc6, 0x51,
+			0x35, 0x1a, 0x5d, 0x88, 0xdf, 0x22, 0xb6, 0x43,
+			0x41, 0x42, 0x4b, 0xff, 0x22, 0xa5, 0x21, 0xcd,
+			0x9c, 0x04, 0x21, 0x51, 0x75, 0xc0, 0x7b, 0xb1,
+			0x19, 0x50, 0x68, 0x64, 0x48, 0xe7, 0x23, 0x08,
+			0x78, 0xd4, 0xf8, 0xf2, 0x3e, 0x05, 0x71, 0x00,
+			0x13, 0x53, 0xe5, 0x91, 0x36, 0xba, 0x3d, 0xdd,
+			0x02, 0x2a, 0x86, 0x38, 0x47, 0x6a, 0x4e, 0xb4,
+			0x86, 0xbe, 0x9e, 0x86, 0x94, 0xb3, 0xd7, 0x5e,
+			0x93, 0x57, 0xfe, 0x95, 0x8a, 0xf4, 0xa6, 0x34,
+			0x27, 0xd5, 0x8d, 0xab, 0x97, 0x09, 0xbc, 0x39,
+			0x73, 0xb6, 0xdc, 0x8c, 0x65, 0xa7, 0x77, 0x95,
+			0xb1, 0xb0, 0x52, 0xaf, 0xce, 0x1e, 0x87, 0xea,
+			0x67, 0x72, 0xe1, 0xd4, 0x86, 0x84, 0x28, 0xc4,
+			0xcc, 0x1f, 0xe4, 0xe9, 0x1d, 0x69, 0x6a, 0x6a,
+			0xdb, 0x0b, 0xa8, 0x5f, 0xda, 0x3a, 0x97, 0x95,
+			0x3a, 0x3c, 0x5e, 0xb5, 0xdb, 0xdf, 0xb5, 0x86,
+			0x84, 0xe9, 0x1e, 0x75, 0x44, 0x60, 0x39, 0x95,
+			0x92, 0x14, 0xde, 0x61, 0x37, 0xf1, 0x8e, 0xa0,
+			0xb4, 0xf4, 0x4e, 0x8e, 0x67, 0x78, 0x2b, 0xd9,
+			0xee, 0x9c, 0xa4, 0xea, 0x54, 0xc6, 0x99, 0xd2,
+			0xa7, 0xa6, 0x02, 0xcc, 0x87, 0xac, 0xdf, 0x0c,
+			0xaa, 0xda, 0xcf, 0x32, 0x42, 0x9f, 0x12, 0x91,
+			0xa6, 0x78, 0x77, 0x27, 0x54, 0xae, 0xb2, 0xc0,
+			0xb3, 0x02, 0x97, 0xdc, 0x3c, 0xaf, 0x66, 0x1c,
+			0x28, 0xbb, 0x51, 0xa7, 0x92, 0xa6, 0xb3, 0xa3,
+			0x13, 0xbf, 0xda, 0xcb, 0x6c, 0xf9, 0x0f, 0x10,
+			0x4d, 0x30, 0xd8, 0x37, 0xe5, 0x82, 0x3c, 0x04,
+			0xd2, 0x89, 0x7a, 0xa1, 0xf8, 0xd6, 0x79, 0x66,
+			0xcd, 0x6e, 0x2f, 0x58, 0x48, 0x7d, 0xcf, 0x69,
+			0xce, 0x0e, 0x21, 0x04, 0xf8, 0x9d, 0x32, 0x64,
+			0x62, 0x53, 0x57, 0x9a, 0x5b, 0x62, 0x59, 0x67,
+			0x64, 0x1e, 0x1d, 0x27, 0x11, 0xad, 0xe5, 0xe1,
+			0x51, 0x48, 0x22, 0xad, 0x21, 0xa4, 0x14, 0x5d,
+			0x26, 0xf2, 0x85, 0xdd, 0xdc, 0x43, 0x52, 0x74,
+			0xd0, 0xa2, 0x5f, 0x50, 0x90, 0x8c, 0x1f, 0xdb,
+			0x54, 0x74, 0xf7, 0xea, 0x4c, 0xa0, 0xc9, 0x44,
+			0x4d, 0x64, 0xb2, 0xe7, 0xf2, 0x21, 0x25, 0x70,
+			0x2d, 0xb8, 0xb8, 0x6a, 0x0e, 0x98, 0xb3, 0xf7,
+			0xf4, 0x47, 0x76, 0xda, 0xf6, 0x52, 0xd1, 0x9a,
+			0x07, 0x1d, 0x48, 0xa9, 0xa9, 0xc0, 0x34, 0x85,
+			0x3c, 0x65, 0xeb, 0x49, 0xfe, 0x2e, 0x79, 0x55,
+			0x05, 0x06, 0x20, 0xd8, 0xb6, 0x20, 0x00, 0xc8,
+			0x2b, 0x66, 0x4f, 0x80, 0x46, 0x9a, 0xaf, 0x66,
+			0x1c, 0xe3, 0x8e, 0x31, 0x75, 0x80, 0x7f, 0x9a,
+			0xb8, 0xa8, 0xcb, 0x8a, 0x96, 0x55, 0xd1, 0xf7,
+			0xe3, 0xc6, 0x52, 0x51, 0x27, 0xad, 0xe4, 0x91,
+			0xfe, 0x4c, 0x4b, 0x29, 0xec, 0xbc, 0x23, 0x23,
+			0x76, 0x80, 0x67, 0x09, 0x4d, 0xb9, 0xab, 0x0e,
+			0x3a, 0xf1, 0x3b, 0x58, 0x7f, 0xe4, 0x2c, 0x66,
+			0xa5, 0x4d, 0x4c, 0xc7, 0x24, 0x5c, 0xf8, 0x4d,
+			0xaf, 0x4d, 0xef, 0xf7, 0x9b, 0x4b, 0xc3, 0x67,
+			0xc5, 0x69, 0x5c, 0xd4, 0xfd, 0x6f, 0x35, 0xa7,
+			0x27, 0x3f, 0xeb, 0x0e, 0x1b, 0x4d, 0xe2, 0x4b,
+			0x41, 0x0e, 0xd7, 0x6e, 0x25, 0xe5, 0xfa, 0x4c,
+			0x52, 0xde, 0x7a, 0x15, 0x25, 0x87, 0xb4, 0x02,
+			0xd1, 0xd7, 0x4f, 0xa9, 0xee, 0xc8, 0x29, 0xe5,
+			0x37, 0xd5, 0x6b, 0xcc, 0x2a, 0x90, 0xdd, 0x80,
+			0xae, 0x0c, 0xb4, 0x16, 0x4c, 0xc5, 0xd1, 0x81,
+			0xf2, 0x5c, 0x03, 0xe8, 0x14, 0xa6, 0x2c, 0xd6,
+			0xdc, 0xde, 0xd5, 0x55, 0xea, 0x81, 0xc2, 0xf7,
+			0x0a, 0x4b, 0x55, 0xf0, 0xcb, 0xb7, 0x86, 0x34,
+			0xd6, 0xbc, 0x0d, 0x58, 0x87, 0x6b, 0x93, 0x6b,
+			0xa5, 0x0c, 0x01, 0x3e, 0x51, 0x8b, 0x40, 0x64,
+			0xbc, 0x3c, 0xfa, 0xa3, 0x19, 0x75, 0x51, 0xc6,
+			0xc6, 0x64, 0x6b, 0x36, 0x45, 0xfe, 0x4d, 0x9f,
+			0xd2, 0xcc, 0x90, 0xd7, 0x5a, 0x82, 0x02, 0xa4,
+			0x53, 0xf3, 0x1a, 0xb2, 0x19, 0x1b, 0xca, 0x61,
+			0xda, 0x57, 0xb6, 0x2b, 0xe9, 0x91, 0xce, 0xba,
+			0x7a, 0xbd, 0x95, 0x1b, 0xb8, 0x51, 0x4a, 0xc0,
+			0xa5, 0x58, 0x65, 0xef, 0x9a, 0xab, 0xa1, 0x87,
+			0xba, 0x7e, 0xaf, 0x16, 0x87, 0x5e, 0xc0, 0x5f,
+			0xb5, 0xed, 0xc1, 0x54, 0x18, 0xf2, 0xc4, 0x16,
+			0x49, 0x1e, 0x4e, 0xd9, 0xaa, 0x40, 0x04, 0xc6,
+			0xdb, 0x6e, 0xc4, 0xe0, 0x21, 0xa9, 0xd7, 0xfa,
+			0xfa, 0xdc, 0xb6, 0x1f, 0x6d, 0x4a, 0x29, 0xf7,
+			0x54, 0x30, 0x3c, 0x31, 0x36, 0xe3, 0xda, 0x50,
+			0x7b, 0xc9, 0xa0, 0x4a, 0x36, 0xea, 0x8a, 0x74,
+			0xb7, 0x53, 0x8d, 0xfb, 0x4e, 0xb8, 0x37, 0x58,
+			0x7a, 0xa6, 0x75, 0x55, 0x68, 0x23, 0x37, 0x82,
+			0x41, 0x86, 0x90, 0x15, 0xe9, 0x50, 0x9d, 0xab,
+			0x63, 0x87, 0x05, 0x8e, 0xaa, 0xd4, 0xf9, 0x6d,
+			0xb0, 0x7b, 0x6d, 0xdc, 0x93, 0x9a, 0x97, 0x6b,
+			0x71, 0x55, 0xfc, 0xaa, 0x63, 0x8a, 0xe3, 0xf3,
+			0xb0, 0x03, 0xf7, 0x85, 0xa9, 0x9c, 0x13, 0xd1,
+			0xfa, 0x4c, 0x27, 0x4e, 0x3e, 0xfc, 0x8f, 0x21,
+			0x81, 0xf9, 0xe2, 0x7b, 0xff, 0x53, 0xd2, 0x3f,
+			0x84, 0xfd, 0x11, 0x1b, 0xa3, 0x39, 0x9e, 0x51,
+			0x36, 0x52, 0x6d, 0xe6, 0xae, 0xb1, 0x50, 0x58,
+			0xec, 0x1a, 0xfe, 0x75, 0x0d, 0xd4, 0xb2, 0x26,
+			0x4e, 0x87, 0x8c, 0x20, 0xb3, 0x7b, 0xfa, 0x7d,
+			0xa8, 0x18, 0x51, 0x6b, 0xee, 0x05, 0xe5, 0x91,
+			0x3f, 0xeb, 0x52, 0xe8, 0xfb, 0xfe, 0xc2, 0xe5,
+			0xe8, 0xbf, 0xf7, 0xfd, 0x2d, 0xdd, 0xb6, 0x2e,
+			0x55, 0x4c, 0x78, 0xaf, 0x0e, 0x64, 0x3e, 0xe0,
+			0x33, 0x89, 0xcf, 0x1d, 0xba, 0x1e, 0x2b, 0x28,
+			0xbe, 0xaa, 0xaa, 0xdd, 0x82, 0x9b, 0x23, 0xea,
+			0x03, 0x02, 0x28, 0xa8, 0xf6, 0xfd, 0x59, 0x40,
+			0xcb, 0xee, 0x94, 0x09, 0x88, 0xc5, 0x93, 0xe5,
+			0xf0, 0x7a, 0x7b, 0x55, 0x92, 0xde, 0x83, 0xbb,
+			0x6d, 0x75, 0x6e, 0x6c, 0x84, 0xb6, 0x70, 0x35,
+			0x58, 0xeb, 0x21, 0x8b, 0x05, 0x77, 0x95, 0xc6,
+			0x8f, 0xca, 0xd8, 0x36, 0x84, 0x61, 0xc1, 0x2c,
+			0x8f, 0xbe, 0x55, 0xb7, 0x83, 0x15, 0x13, 0x51,
+			0x17, 0x66, 0x25, 0x36, 0xe3, 0x87, 0x45, 0x68,
+			0x4f, 0xa7, 0x2a, 0xce, 0x5e, 0x62, 0xad, 0x18,
+			0x45, 0x45, 0x11, 0x8d, 0xf9, 0x1d, 0xb4, 0x26,
+			0x06, 0x2f, 0xac, 0xc8, 0xd6, 0x65, 0x58, 0xad,
+			0xdc, 0x59, 0x30, 0xc1, 0x91, 0xc9, 0xc9, 0xa0,
+			0xe4, 0x48, 0xef, 0x19, 0x3d, 0xec, 0x2a, 0x78,
+			0x4a, 0x04, 0x0f, 0x55, 0x96, 0xa5, 0x6f, 0xcf,
+			0x3b, 0x18, 0xf3, 0xc4, 0x06, 0x8a, 0x29, 0x0b,
+			0x56, 0xff, 0xf3, 0x20, 0x8f, 0xf0, 0xb3, 0xa7,
+			0x38, 0x3b, 0x50, 0xc8, 0x55, 0x39, 0xf2, 0xc2,
+			0xda, 0x15, 0xd3, 0x75, 0x43, 0xdf, 0x68, 0x11,
+			0x69, 0xa9, 0x4d, 0x7d, 0xc9, 0x7a, 0x3d, 0x0f,
+			0x7b, 0x43, 0xb5, 0x88, 0xa2, 0xf9, 0x28, 0x80,
+			0x8c, 0x58, 0x08, 0x3b, 0x30, 0xc0, 0xcd, 0x73,
+			0xd0, 0x6b, 0xb6, 0x12, 0x9c, 0x24, 0x36, 0x3a,
+			0xd8, 0x9a, 0xa6, 0xa3, 0x1d, 0xea, 0x77, 0x1f,
+			0xf0, 0x19, 0xa9, 0xb6, 0x2f, 0x04, 0x0b, 0xd8,
+			0xd9, 0x7a, 0x79, 0x4a, 0x9c, 0x21, 0x8a, 0x3e,
+			0x27, 0xa7, 0x0d, 0x54, 0x23, 0xd5, 0x05, 0x64,
+			0x63, 0x72, 0x72, 0x94, 0x4e, 0xc1, 0x1c, 0x91,
+			0x2e, 0xfe, 0xfd, 0x90, 0x0f, 0x06, 0xdd, 0x8c,
+			0x71, 0x43, 0x0d, 0xad, 0xaa, 0xea, 0xab, 0xc3,
+			0x60, 0xae, 0xfd, 0xc8, 0xf9, 0x9f, 0xa5, 0x99,
+			0x0a, 0x42, 0xd4, 0x0e, 0x91, 0xaa, 0x24, 0x38,
+			0x56, 0xd5, 0x45, 0x94, 0x2d, 0x0e, 0xd0, 0x58,
+			0x09, 0x65, 0xf2, 0x3b, 0x97, 0x91, 0x10, 0x5f,
+			0xa1, 0x1d, 0xf8, 0x65, 0x7f, 0x5f, 0x65, 0x08,
+			0xcc, 0x27, 0x4d, 0x78, 0x13, 0xfd, 0x9e, 0x3e,
+			0xb8, 0x07, 0xbf, 0x98, 0x96, 0x9c, 0xb5, 0x33,
+			0x08, 0xbb, 0x71, 0xa3, 0x54, 0x2d, 0x37, 0xc5,
+			0xe7, 0x7e, 0x9b, 0x52, 0x2c, 0x0a, 0xc2, 0x06,
+			0xf3, 0x39, 0x85, 0x30, 0x48, 0x39, 0x11, 0x77,
+			0x60, 0xf9, 0x8c, 0xd8, 0x8b, 0x07, 0xf4, 0xcd,
+			0xe8, 0xf8, 0xe7, 0x03, 0x6f, 0x88, 0xdb, 0xac,
+			0x8e, 0x57, 0x58, 0xe3, 0x39, 0x24, 0xe3, 0xb4,
+			0xf8, 0xdc, 0xc9, 0x7a, 0xc6, 0x10, 0xa8, 0x28,
+			0x71, 0x30, 0x01, 0xc0, 0x54, 0x37, 0x15, 0xbf,
+			0x00, 0xb6, 0x6c, 0xcc, 0xf4, 0x86, 0x2c, 0xea,
+			0xa9, 0x5d, 0x81, 0xaf, 0xdb, 0xc2, 0x66, 0x18,
+			0x8b, 0xaa, 0xb6, 0x1c, 0x30, 0x63, 0x5e, 0xe6,
+			0x47, 0x24, 0x0c, 0x31, 0xe3, 0x14, 0xc5, 0xfd,
+			0x7c, 0xcf, 0xd0, 0xbd, 0x8c, 0xa0, 0xe1, 0x97,
+			0x65, 0xf6, 0xee, 0xd6, 0xf4, 0x7e, 0x09, 0x1a,
+			0x0c, 0x79, 0x1c, 0xba, 0x23, 0xfc, 0x22, 0xf6,
+			0xb3, 0xec, 0x5d, 0xe5, 0x9a, 0x7d, 0xc8, 0x4c,
+			0xc8, 0xa0, 0x82, 0xed, 0xba, 0x62, 0x78, 0x07,
+			0x7c, 0x3a, 0xa1, 0xd9, 0x47, 0xe5, 0x0f, 0x1f,
+			0x08, 0x0f, 0x57, 0xf1, 0xc4, 0x00, 0x0b, 0x73,
+			0x34, 0x29, 0xa9, 0x4f, 0x42, 0xcd, 0x1d, 0xff,
+			0x34, 0x8d, 0x0e, 0x87, 0x48, 0x3f, 0x9f, 0xf8,
+			0x94, 0x9c, 0xf3, 0x9c, 0x97, 0x75, 0x89, 0x7f,
+			0x47, 0x33, 0xc2, 0x65, 0x10, 0xcf, 0xd7, 0x77,
+			0x1e, 0x72, 0x70, 0x67, 0x7f, 0x82, 0x9a, 0xc5,
+			0x9b, 0xb7, 0x79, 0x1b, 0x22, 0xe0, 0x2e, 0x46,
+			0xda, 0x18, 0x8b, 0x79, 0xd4, 0xf0, 0x00, 0xc5,
+			0x12, 0x08, 0xe7, 0xdd, 0x5d, 0x1f, 0xa9, 0xc7,
+			0x86, 0x5b, 0x5e, 0xf3, 0x5a, 0xa9, 0x71, 0x8c,
+			0xfb, 0x0d, 0xaf, 0x50, 0x5a, 0xc5, 0x09, 0x75,
+			0x1e, 0x0b, 0xee, 0x22, 0x34, 0x8d, 0xb0, 0x4c,
+			0x0c, 0xab, 0x16, 0xd8, 0xa0, 0xe1, 0xc5, 0x2c,
+			0x26, 0x3b, 0x27, 0xc4, 0x28, 0xbc, 0x57, 0x16,
+			0xdd, 0x3c, 0x2d, 0x4f, 0x0a, 0xe0, 0x1f, 0x39,
+			0x60, 0x8a, 0x37, 0x44, 0x28, 0xf6, 0x45, 0x78,
+			0xef, 0x69, 0x72, 0xcf, 0x2b, 0x7a, 0x85, 0x6e,
+			0xa9, 0xf6, 0x81, 0xf7, 0x39, 0x80, 0x19, 0xa8,
+			0xaa, 0x6c, 0xc7, 0xd7, 0xef, 0x47, 0x43, 0xe3,
+			0xb9, 0x68, 0x80, 0x0f, 0xaa, 0x81, 0x45, 0x06,
+			0xca, 0x58, 0xed, 0xa4, 0xa3, 0x02, 0x33, 0x09,
+			0xbe, 0x6e, 0x32, 0x26, 0x82, 0xd6, 0x90, 0xdb,
+			0x03, 0xd2, 0xeb, 0xa9, 0x9f, 0x43, 0x1c, 0x6d,
+			0x95, 0x3e, 0xe4, 0x03, 0xd2, 0xbc, 0x33, 0x65,
+			0x97, 0xcd, 0x76, 0x64, 0x82, 0xdb, 0xa7, 0xf9,
+			0x40, 0xa1, 0x09, 0x3f, 0x54, 0xaf, 0x7a, 0x4f,
+			0x23, 0x47, 0xd4, 0x41, 0x3f, 0x29, 0x27, 0x17,
+			0x41, 0x0e, 0x65, 0x63, 0xb7, 0xd1, 0xbf, 0xdb,
+			0x57, 0xdd, 0x9a, 0x03, 0x0c, 0x28, 0xe4, 0xc1,
+			0x84, 0xfc, 0x16, 0x03, 0x8f, 0xeb, 0x6b, 0x3a,
+			0x33, 0x0c, 0x86, 0x56, 0x9f, 0xc7, 0x1e, 0x02,
+			0xf8, 0xb1, 0x97, 0x82, 0x5d, 0xb0, 0x99, 0x26,
+			0x25, 0xb1, 0xeb, 0x22, 0x3d, 0xfa, 0x89, 0x37,
+			0x43, 0x3f, 0x45, 0x10, 0xff, 0x82, 0x0c, 0xc6,
+			0x37, 0xf6, 0x34, 0x60, 0xf0, 0xf2, 0x16, 0xfd,
+			0xe8, 0x43, 0x40, 0x14, 0xa4, 0x44, 0xc4, 0x7c,
+			0x0c, 0x72, 0xea, 0x24, 0x96, 0xe0, 0x9c, 0x88,
+			0x54, 0xb1, 0x7c, 0x73, 0x93, 0xe3, 0xbe, 0xe5,
+			0xee, 0x1b, 0xe6, 0x85, 0x68, 0xa8, 0xab, 0x7c,
+			0xc2, 0xf7, 0x22, 0x11, 0x65, 0xd3, 0x02, 0x42,
+			0xc9, 0xa7, 0x53, 0xee, 0xba, 0x92, 0x00, 0x13,
+			0xb7, 0x9e, 0xf6, 0x66, 0x54, 0x96, 0x26, 0xb7,
+			0xea, 0x79, 0x0a, 0x0b, 0xb8, 0xd6, 0x02, 0x93,
+			0xae, 0x45, 0xad, 0x16, 0xde, 0x18, 0xcb, 0x8a,
+			0x67, 0x3b, 0xd0, 0xdb, 0x09, 0x07, 0xc2, 0xf9,
+			0xff, 0xe7, 0x9b, 0x0f, 0x11, 0xb8, 0xd7, 0xce,
+			0xbf, 0x75, 0xc2, 0x81, 0x07, 0x88, 0x43, 0x49,
+			0x8c, 0xc4, 0x03, 0x82, 0x39, 0xf4, 0x5e, 0x06,
+			0x69, 0xd7, 0xc6, 0xa5, 0xcb, 0x64, 0x3b, 0xcc,
+			0x0b, 0x32, 0x56, 0x9d, 0xe2, 0x7d, 0x09, 0x4b,
+			0x5b, 0x76, 0x6a, 0x2c, 0xfa, 0xee, 0x0d, 0x61,
+			0x9d, 0xae, 0x59, 0x3d, 0xea, 0xfe, 0xb1, 0x6a,
+			0x54, 0x11, 0x73, 0x9c, 0x12, 0x1d, 0xb3, 0xb9,
+			0x1a, 0x98, 0x9b, 0x70, 0xbf, 0xdd, 0x21, 0x15,
+			0xa3, 0x8c, 0x3d, 0x57, 0x7d, 0x4a, 0x29, 0x79,
+			0x77, 0x41, 0x45, 0x4b, 0xa8, 0x8f, 0x26, 0x6e,
+			0x97, 0xd1, 0x18, 0x88, 0x11, 0x8b, 0xa1, 0xf8,
+			0x0b, 0x25, 0xbf, 0x0e, 0xb4, 0x82, 0x64, 0x30,
+			0x42, 0x42, 0xfc, 0x78, 0x96, 0x98, 0x9b, 0x1a,
+			0xd5, 0x46, 0x95, 0xdd, 0xec, 0x04, 0xf5, 0xb1,
+			0x4b, 0x49, 0x42, 0x35, 0xf9, 0xa6, 0xf2, 0x22,
+			0xee, 0x12, 0x91, 0x8e, 0xb6, 0x88, 0xcc, 0x19,
+			0xae, 0x3e, 0xdb, 0x10, 0xbc, 0xe7, 0x4a, 0xb6,
+			0xac, 0x47, 0x83, 0xce, 0x48, 0xa1, 0x37, 0x19,
+			0xe9, 0xc4, 0x42, 0xec, 0xaf, 0x06, 0x70, 0xef,
+			0x84, 0xa5, 0x69, 0xca, 0x1c, 0x35, 0xbe, 0xb6,
+			0xf7, 0xe7, 0xe8, 0x5e, 0x5f, 0xa2, 0xee, 0x43,
+			0xb0, 0x69, 0x88, 0xfc, 0x2e, 0xd2, 0x2f, 0xe9,
+			0xd5, 0x2d, 0x79, 0x1a, 0x28, 0x31, 0x52, 0x94,
+			0x89, 0xe7, 0xb2, 0x19, 0xd9, 0xd5, 0x33, 0xe8,
+			0xd8, 0x7d, 0x56, 0xd2, 0x78, 0x37, 0x84, 0xbc,
+			0x52, 0xd6, 0xf7, 0x68, 0xd2, 0xcb, 0xe0, 0xca,
+			0xec, 0x17, 0x61, 0xc0, 0x68, 0x5d, 0xf5, 0x6d,
+			0x3e, 0x81, 0x39, 0xc1, 0xca, 0x26, 0x22, 0x2b,
+			0x11, 0x98, 0x84, 0xe0, 0xfb, 0xfb, 0x5e, 0xaa,
+			0x15, 0x0e, 0xf8, 0xd6, 0x7b, 0xd7, 0x55, 0x3c,
+			0xfd, 0xc5, 0xfa, 0xf8, 0x66, 0xdd, 0x48, 0x47,
+			0x6c, 0x43, 0x36, 0x24, 0xa6, 0x69, 0x79, 0xa0,
+			0xb5, 0x7c, 0xf1, 0xf1, 0x0c, 0xa3, 0x21, 0x4c,
+			0x3f, 0x99, 0xb8, 0xfb, 0x8e, 0x9c, 0xb1, 0x28,
+			0x2f, 0xdb, 0x0f, 0x95, 0xf8, 0x14, 0x85, 0xa6,
+			0xb6, 0x85, 0x9b, 0xba, 0xb0, 0x8b, 0x05, 0x7d,
+			0x17, 0x50, 0x8e, 0x08, 0x91, 0xee, 0x25, 0x63,
+			0xa9, 0xc2, 0x36, 0x4e, 0x44, 0xd8, 0x6e, 0x14,
+			0xb8, 0x6f, 0x1b, 0xf7, 0x5e, 0xc7, 0xf8, 0x16,
+			0xdd, 0x0f, 0x7a, 0xcb, 0x1f, 0x50, 0x34, 0xc6,
+			0xa1, 0xa6, 0x16, 0xb6, 0x5a, 0x8b, 0xc5, 0x23,
+			0xab, 0x14, 0x28, 0xaa, 0x06, 0x3a, 0x22, 0x1e,
+			0xd9, 0x7f, 0xbb, 0x9d, 0xe6, 0x96, 0xa7, 0x67,
+			0x7f, 0x57, 0x03, 0x4e, 0x1a, 0xec, 0x75, 0x56,
+			0x14, 0xc8, 0x28, 0x83, 0xfc, 0xd9, 0x16, 0x40,
+			0x79, 0x2f, 0xb2, 0x8c, 0x7c, 0xec, 0x2f, 0x1c,
+			0xa7, 0xdd, 0xdc, 0x01, 0xf7, 0xdd, 0x37, 0x0c,
+			0xea, 0x3e, 0x2b, 0x20, 0x81, 0x5a, 0x30, 0xb9,
+			0x32, 0x93, 0xbc, 0xd8, 0x0e, 0x00, 0xe8, 0x75,
+			0x6b, 0x9e, 0x0e, 0xda, 0x9f, 0x1c, 0x31, 0x96,
+			0xeb, 0x7b, 0x11, 0xe7, 0xe8, 0x6e, 0x6f, 0xa1,
+			0x0f, 0x5c, 0xde, 0xe7, 0x3e, 0x7d, 0xc2, 0x54,
+			0x54, 0xbb, 0x24, 0x54, 0x53, 0xd1, 0xc2, 0x9b,
+			0xae, 0x4f, 0x07, 0x56, 0x51, 0x56, 0x77, 0x5d,
+			0x38, 0x4b, 0xa5, 0xd9, 0x76, 0x53, 0x5f, 0xc6,
+			0x3c, 0xee, 0x94, 0xe6, 0x27, 0x29, 0xa6, 0x29,
+			0x92, 0xb2, 0x3d, 0xb4, 0xf1, 0x6b, 0xa1, 0x3f,
+			0x07, 0xe0, 0x81, 0x72, 0xe8, 0xfa, 0x24, 0xc0,
+			0xd6, 0x48, 0xdb, 0x7a, 0xda, 0xde, 0xe6, 0x55,
+			0x97, 0x95, 0xeb, 0xb9, 0xa0, 0xd5, 0x1f, 0x04,
+			0x2c, 0xde, 0x15, 0x72, 0xc1, 0xc0, 0x70, 0x81,
+			0x8a, 0xc0, 0xb1, 0xb0, 0xcf, 0xd8, 0x09, 0xa6,
+			0x57, 0xb4, 0x56, 0x79, 0xf4, 0xbd, 0x99, 0x68,
+			0xb3, 0x2b, 0xa5, 0xe1, 0xe7, 0xfb, 0x30, 0xbe,
+			0x38, 0x50, 0x7f, 0x22, 0xdb, 0x8b, 0x15, 0xd9,
+			0xa8, 0xe7, 0x6e, 0x0c, 0x51, 0x84, 0x0b, 0x4f,
+			0x82, 0x92, 0x52, 0x05, 0x5a, 0x06, 0x22, 0x1f,
+			0x3c, 0xee, 0xa4, 0x41, 0x6c, 0x9f, 0xfc, 0xee,
+			0xb7, 0x79, 0x74, 0xb7, 0xaf, 0xe5, 0x84, 0xea,
+			0x82, 0x40, 0xbe, 0x19, 0xf7, 0x46, 0x50, 0xe6,
+			0x39, 0xa5, 0x1a, 0x98, 0xe7, 0x1d, 0x51, 0xb1,
+			0x54, 0x87, 0x69, 0x23, 0xad, 0x25, 0x34, 0xf4,
+			0xc4, 0xe3, 0xb9, 0x0c, 0x42, 0x12, 0x70, 0x1b,
+			0xdc, 0x70, 0x4b, 0xcd, 0x47, 0x5c, 0xb5, 0xe0,
+			0x50, 0xd3, 0x96, 0x17, 0x73, 0xbd, 0x70, 0x76,
+			0x25, 0x82, 0xe3, 0x57, 0x5c, 0x7e, 0x96, 0xb4,
+			0x55, 0xb9, 0x46, 0xb5, 0x5e, 0xc3, 0xe6, 0xdb,
+			0x76, 0x23, 0x7e, 0x5f, 0x36, 0x09, 0xed, 0x4a,
+			0x56, 0x3e, 0xa4, 0x44, 0x6a, 0x06, 0x42, 0xb7,
+			0x2a, 0xb5, 0x9e, 0x15, 0x47, 0x70, 0x7f, 0xb1,
+			0x41, 0x2f, 0x12, 0x5b, 0x21, 0xf5, 0x27, 0x8b,
+			0x3b, 0xfd, 0xd8, 0x02, 0xe8, 0x90, 0xf2, 0xa8,
+			0x2f, 0xd4, 0xb2, 0x1e, 0x5f, 0x02, 0xab, 0xcb,
+			0xf1, 0xa6, 0x16, 0x5d, 0x9b, 0xed, 0x59, 0xf5,
+			0x01, 0xb7, 0x2d, 0x7f, 0x3d, 0xc5, 0x0b, 0x81,
+			0x68, 0x89, 0xf4, 0xea, 0xf0, 0x16, 0xe0, 0xb8,
+			0x5f, 0xe1, 0xbb, 0xb0, 0xca, 0xe1, 0xae, 0xd1,
+			0xde, 0xeb, 0xf6, 0x40, 0x06, 0xf9, 0x54, 0x74,
+			0x8f, 0x5f, 0xa8, 0xfa, 0x8f, 0x41, 0x65, 0xb4,
+			0xb8, 0xa6, 0x07, 0xde, 0xc4, 0x6a, 0x05, 0xba,
+			0x12, 0xe8, 0xb7, 0xb7, 0x1e, 0xdd, 0x39, 0x0e,
+			0x33, 0x4e, 0x92, 0x2b, 0xd9, 0xa8, 0x07, 0x2b,
+			0xbe, 0x93, 0xeb, 0x06, 0x7e, 0xaa, 0x35, 0x53,
+			0x7a, 0x36, 0x7b, 0x78, 0xf5, 0x5f, 0x6b, 0x4d,
+			0xb0, 0xc0, 0xbb, 0x51, 0x24, 0xac, 0xe2, 0xec,
+			0x7b, 0x81, 0xc2, 0x73, 0x0a, 0x0b, 0x5c, 0x20,
+			0x33, 0xf8, 0x90, 0x1c, 0xc6, 0x4b, 0x6f, 0x43,
+			0x3d, 0xa2, 0xc1, 0xee, 0x10, 0xa0, 0xa8, 0x1d,
+			0x01, 0x5d, 0x20, 0x12, 0xba, 0xb7, 0x78, 0x40,
+			0x49, 0xc2, 0x87, 0x1e, 0xe1, 0xbf, 0x0c, 0x8b,
+			0xa6, 0x16, 0xc9, 0xdd, 0x5c, 0xc7, 0xba, 0xc7,
+			0xfa, 0x8d, 0xeb, 0x60, 0x00, 0x93, 0xb5, 0xbb,
+			0x07, 0xa8, 0xf3, 0x38, 0xd4, 0x9e, 0x75, 0x59,
+			0xb4, 0x51, 0x33, 0x69, 0x1a, 0x85, 0x0b, 0xe8,
+			0x72, 0x69, 0x1f, 0x91, 0x6e, 0x31, 0xb3, 0xc2,
+			0x91, 0x81, 0xfe, 0x28, 0xf4, 0xea, 0x00, 0xce,
+			0x00, 0x2f, 0x6c, 0x77, 0x14, 0x46, 0x8c, 0xb8,
+			0x35, 0xb6, 0x93, 0x02, 0xf5, 0xea, 0x0d, 0xf7,
+			0x10, 0xed, 0x6f, 0x1d, 0xc6, 0x30, 0x75, 0x65,
+			0x81, 0x9b, 0x4d, 0x33, 0xf7, 0x1a, 0x91, 0x1b,
+			0x27, 0xe0, 0x24, 0xa8, 0x6e, 0xbe, 0x01, 0x18,
+			0x8c, 0xa9, 0xe4, 0x58, 0x5b, 0x12, 0x85, 0xb6,
+			0x8c, 0x1a, 0xa0, 0x2d, 0x8e, 0x72, 0x84, 0x13,
+			0xea, 0x2c, 0x5f, 0xc4, 0x9f, 0xea, 0x90, 0xa9,
+			0x9a, 0x7c, 0x6c, 0xb0, 0x79, 0xac, 0x99, 0x29,
+			0x6b, 0x03, 0x5e, 0x0a, 0x14, 0x38, 0x4f, 0x3e,
+			0xae, 0x93, 0xd0, 0xb5, 0x9a, 0xcb, 0x84, 0x95,
+			0xf0, 0x0d, 0x66, 0x92, 0x7b, 0xe8, 0xab, 0xf2,
+			0x4f, 0xf8, 0xa6, 0x42, 0x7f, 0x04, 0x11, 0x98,
+			0xef, 0x0d, 0x17, 0xe7, 0xde, 0x69, 0x80, 0xea,
+			0x3b, 0x8b, 0xe2, 0xb1, 0x43, 0x9d, 0x33, 0xf9,
+			0x72, 0xbb, 0xc1, 0x8c, 0xb5, 0x99, 0xe4, 0x00,
+			0x0e, 0xb4, 0x8f, 0xb0, 0x92, 0x26, 0x6a, 0xfb,
+			0x8e, 0x9f, 0xb6, 0x59, 0xc3, 0x3b, 0x64, 0x2c,
+			0x9c, 0x8a, 0xb3, 0x7a, 0x4d, 0x21, 0x01, 0x8f,
+			0xd4, 0xd8, 0x4a, 0x91, 0x4f, 0xca, 0xf1, 0x4c,
+			0xb8, 0xfc, 0xfb, 0x3e, 0xb0, 0x50, 0x55, 0x7f,
+			0x99, 0xa7, 0x14, 0xbf, 0x5a, 0x1c, 0x9f, 0x28,
+			0x53, 0x49, 0xb7, 0x7b, 0xba, 0x41, 0x34, 0xc6,
+			0x08, 0x6d, 0x84, 0x3b, 0xc6, 0xa5, 0xa9, 0x56,
+			0xf5, 0x99, 0x20, 0x3d, 0x7f, 0x3a, 0x46, 0x1e,
+			0x64, 0xcc, 0x04, 0xc3, 0x36, 0xab, 0xdb, 0x61,
+			0x91, 0xad, 0x99, 0xec, 0x83, 0x8b, 0x72, 0xfb,
+			0x03, 0x9f, 0xf9, 0x19, 0xac, 0x4c, 0x22, 0x5d,
+			0x68, 0xce, 0x32, 0xc6, 0x59, 0x43, 0xe7, 0x80,
+			0x1d, 0x7f, 0x59, 0xfa, 0x6b, 0xb1, 0xf0, 0xd2,
+			0x98, 0xb6, 0x51, 0x77, 0x05, 0x65, 0x4e, 0xa3,
+			0x78, 0xd2, 0xd5, 0x8d, 0x1a, 0xc5, 0x62, 0xe5,
+			0xe8, 0x43, 0x77, 0x9a, 0x22, 0x93, 0xff, 0x68,
+			0xb4, 0xc6, 0x00, 0x8d, 0x00, 0xfc, 0xeb, 0x13,
+			0xa7, 0x00, 0x39, 0x73, 0x9f, 0x47, 0xcd, 0x08,
+			0x19, 0x7d, 0xbb, 0x1d, 0x75, 0xc6, 0x8a, 0x17,
+			0x84, 0xf6, 0x2a, 0x6c, 0x9f, 0xc5, 0x31, 0x17,
+			0xb7, 0xee, 0x6d, 0x1c, 0x3d, 0xc4, 0x1f, 0xfc,
+			0x46, 0xf7, 0x53, 0x49, 0xc1, 0x20, 0x19, 0x7e,
+			0x6a, 0x30, 0x72, 0x75, 0x27, 0xab, 0x10, 0xfa,
+			0x84, 0x56, 0x93, 0xed, 0xe8, 0x96, 0x3b, 0x3f,
+			0xe0, 0xee, 0x56, 0x1d, 0x27, 0x94, 0xbc, 0xb9,
+			0x64, 0xb6, 0x1c, 0x2b, 0x47, 0x3b, 0x80, 0x0b,
+			0x93, 0x0e, 0x52, 0x98, 0x0d, 0x5b, 0x62, 0x39,
+			0x72, 0x6d, 0x4a, 0x5b, 0x0e, 0x96, 0xad, 0xd3,
+			0xd3, 0x75, 0xe5, 0x63, 0x05, 0x3b, 0x70, 0x2e,
+			0x7e, 0xbd, 0x8c, 0x10, 0xbc, 0xf9, 0xd0, 0xce,
+			0x79, 0x99, 0x7e, 0x81, 0x0a, 0xa9, 0x23, 0x41,
+			0xd9, 0x68, 0xe3, 0x78, 0xd0, 0x74, 0x25, 0xde,
+			0x3d, 0xba, 0x9d, 0xd8, 0xbe, 0x8b, 0xb2, 0x71,
+			0xa5, 0x08, 0x28, 0x51, 0x11, 0xad, 0x19, 0xb6,
+			0x76, 0x4f, 0x2b, 0x00, 0x8d, 0xdb, 0x88, 0xa7,
+			0xd0, 0x8a, 0x6f, 0xee, 0xd8, 0x8d, 0x0e, 0x6f,
+			0xee, 0x48, 0xd7, 0x26, 0x46, 0x40, 0xd8, 0x04,
+			0x83, 0xb8, 0x0d, 0x46, 0x12, 0xef, 0xd3, 0x19,
+			0x89, 0x65, 0xef, 0x0c, 0x87, 0x12, 0x35, 0xad,
+			0xfe, 0xb9, 0x94, 0xcb, 0x24, 0x10, 0x36, 0x4a,
+			0x00, 0xfc, 0xcd, 0x33, 0x67, 0x60, 0x80, 0x2f,
+			0xc3, 0x32, 0xfc, 0x5c, 0xd0, 0xdc, 0xe3, 0xec,
+			0x51, 0x95, 0xdd, 0x16, 0x09, 0x05, 0x5b, 0xfd,
+			0x99, 0x06, 0x13, 0x9a, 0xc4, 0xca, 0x2c, 0xf9,
+			0xa7, 0xac, 0xfd, 0x8f, 0xe8, 0xd2, 0x0e, 0xcb,
+			0x78, 0xac, 0x28, 0xcf, 0x68, 0x36, 0x34, 0x58,
+			0xe9, 0xd1, 0x6c, 0xa7, 0x22, 0x3c, 0x7c, 0x7b,
+			0xc1, 0x66, 0x71, 0x6d, 0x7e, 0x98, 0x9b, 0x58,
+			0x92, 0xde, 0xd8, 0xef, 0x18, 0x5b, 0x9f, 0x27,
+			0xdc, 0x0f, 0xd2, 0x7b, 0xbb, 0x91, 0x95, 0xe4,
+			0x93, 0x7f, 0x6e, 0x08, 0x77, 0x5f, 0xbf, 0x97,
+			0x77, 0xd9, 0x70, 0xf8, 0x52, 0xd1, 0xfd, 0xcc,
+			0x27, 0x77, 0xb2, 0x85, 0x49, 0x36, 0x61, 0x8b,
+			0x9f, 0xc2, 0x8d, 0x02, 0x15, 0xfa, 0xc4, 0xe2,
+			0x0e, 0xa5, 0xe6, 0x5c, 0x3f, 0x62, 0x37, 0x20,
+			0xca, 0x7a, 0x7a, 0x5b, 0x79, 0xb8, 0xe2, 0xac,
+			0xbd, 0x35, 0x63, 0xd7, 0x52, 0xc3, 0x44, 0x5f,
+			0x48, 0xc5, 0x3a, 0x45, 0xac, 0x33, 0xec, 0xd9,
+			0x09, 0xc4, 0x2b, 0xda, 0x21, 0x93, 0x24, 0x41,
+			0xe0, 0xec, 0x76, 0xba, 0x91, 0xbb, 0x7a, 0x8d,
+			0xff, 0x84, 0x1e, 0x7a, 0x6e, 0x8d, 0x0b, 0x2a,
+			0xc4, 0xe5, 0xd0, 0xf1, 0x64, 0x62, 0x98, 0x8b,
+			0x94, 0xe2, 0xea, 0x64, 0x82, 0x20, 0x69, 0x9e,
+			0xe2, 0x3e, 0x5d, 0x7e, 0xd6, 0xb8, 0xa6, 0xf0,
+			0x24, 0x49, 0x70, 0xf8, 0xa0, 0x6b, 0x00, 0xf2,
+			0x13, 0x23, 0x2a, 0xce, 0xa3, 0x33, 0x45, 0xc3,
+			0x18, 0xf0, 0x55, 0xa9, 0xf7, 0x99, 0xe3, 0x34,
+			0xde, 0x1a, 0x3f, 0xfa, 0x44, 0xb6, 0x60, 0x86,
+			0x76, 0xc3, 0x10, 0x13, 0x56, 0x91, 0x72, 0x4e,
+			0x39, 0x3c, 0x41, 0x6c, 0xa7, 0x54, 0x4f, 0xae,
+			0x09, 0x94, 0xf2, 0xd7, 0x84, 0xb8, 0xa6, 0x49,
+			0x80, 0x65, 0x1f, 0x43, 0x04, 0x85, 0x23, 0x86,
+			0x64, 0x86, 0x41, 0xb8, 0x75, 0xf7, 0x67, 0x6d,
+			0x0f, 0x26, 0xac, 0xe6, 0x5d, 0x91, 0x3e, 0xe0,
+			0xd2, 0x36, 0x3e, 0xef, 0x6d, 0xb4, 0x75, 0xfe,
+			0x80, 0xd9, 0xd0, 0x96, 0x2a, 0x88, 0x97, 0x99,
+			0x2e, 0x99, 0x75, 0x0f, 0xec, 0xb9, 0x7b, 0x5d,
+			0xa5, 0x91, 0xb9, 0xae, 0x87, 0xbf, 0x50, 0x98,
+			0x3b, 0xa6, 0xad, 0xae, 0x5c, 0xa2, 0x93, 0xc7,
+			0x6b, 0x98, 0x52, 0xea, 0x80, 0x3a, 0x38, 0xbb,
+			0x4c, 0xef, 0xe3, 0x79, 0x96, 0x3e, 0xc3, 0x83,
+			0x11, 0xfc, 0x02, 0x16, 0xec, 0xdd, 0xd2, 0x0f,
+			0x44, 0x2a, 0x30, 0xf6, 0x11, 0x76, 0x8a, 0xb1,
+			0x5e, 0x83, 0xfe, 0x63, 0xe3, 0xc8, 0xd8, 0x0a,
+			0xdd, 0xbd, 0x2f, 0x32, 0xd2, 0xf8, 0x36, 0x67,
+			0x9b, 0xd2, 0xee, 0x9e, 0x45, 0xc0, 0xb1, 0x29,
+			0x75, 0x82, 0xcb, 0x01, 0x99, 0xd1, 0xfb, 0xb8,
+			0x93, 0x54, 0xb7, 0x62, 0x74, 0x0f, 0xea, 0x05,
+			0xd3, 0xd9, 0xf7, 0x6d, 0x44, 0x41, 0x38, 0xa5,
+			0x68, 0xa7, 0x51, 0x7f, 0x74, 0xaf, 0x63, 0x6a,
+			0xb4, 0x07, 0x2a, 0x24, 0x6c, 0x70, 0x82, 0xda,
+			0x23, 0xcb, 0xf6, 0x65, 0xb4, 0x4d, 0x41, 0xfc,
+			0xee, 0xd1, 0x3a, 0x86, 0x9e, 0x72, 0x12, 0xcd,
+			0xd6, 0x25, 0xd5, 0xae, 0x7f, 0xf6, 0xa2, 0xbf,
+			0x54, 0xc4, 0xec, 0xaa, 0x78, 0x16, 0x75, 0x0a,
+			0x85, 0x55, 0xae, 0x43, 0xf4, 0xfd, 0xe9, 0xa9,
+			0xf8, 0xa6, 0xf9, 0x7e, 0xc2, 0x64, 0x15, 0x48,
+			0xf6, 0xf7, 0xa0, 0xef, 0x93, 0x0a, 0x08, 0x91,
+			0xfa, 0xcd, 0xf3, 0x0f, 0xe5, 0x20, 0x4a, 0x87,
+			0x0d, 0xfb, 0xf8, 0xf2, 0x5c, 0x66, 0xff, 0xc6,
+			0x96, 0xa1, 0xd9, 0x53, 0x55, 0x98, 0x8d, 0x16,
+			0x40, 0x07, 0x79, 0xde, 0xb0, 0xc0, 0x46, 0xb9,
+			0x3b, 0x34, 0x4e, 0xc9, 0xea, 0x04, 0x3f, 0xaa,
+			0x54, 0x66, 0x66, 0xfe, 0xfc, 0x39, 0x16, 0x35,
+			0xba, 0x69, 0xbb, 0x20, 0xf5, 0x83, 0x9a, 0x9f,
+			0x65, 0xb0, 0x78, 0xde, 0x6b, 0xc7, 0x5b, 0xbb,
+			0xc3, 0x8e, 0x81, 0x16, 0x32, 0x83, 0x3c, 0x66,
+			0x41, 0x12, 0x76, 0xe5, 0xd4, 0x3b, 0x11, 0xd0,
+			0x2d, 0x11, 0xa4, 0x16, 0xfb, 0xf4, 0x39, 0x17,
+			0x44, 0x41, 0x09, 0x3e, 0x96, 0xc4, 0x31, 0x4b,
+			0xd3, 0x21, 0xc6, 0xe1, 0x32, 0xea, 0x28, 0xaf,
+			0xc5, 0x0f, 0xf5, 0x52, 0x08, 0xc1, 0x42, 0xef,
+			0xc4, 0x7a, 0x1b, 0x6e, 0xae, 0x06, 0xd8, 0x64,
+			0xfe, 0x59, 0xf0, 0x83, 0xe5, 0x94, 0x0a, 0x14,
+			0x80, 0x83, 0x96, 0x39, 0x19, 0xcc, 0x22, 0xb9,
+			0xae, 0x85, 0x06, 0xcb, 0xef, 0x24, 0x77, 0xac,
+			0x3d, 0x91, 0x75, 0xab, 0x86, 0x7a, 0xc6, 0x04,
+			0x19, 0xcf, 0xe7, 0x90, 0xba, 0xee, 0x3c, 0x11,
+			0x69, 0x4a, 0x52, 0x13, 0x02, 0xa8, 0x57, 0xdf,
+			0x17, 0xbd, 0x8c, 0x8a, 0x61, 0x23, 0x49, 0x0d,
+			0x1a, 0xc1, 0x4a, 0xa8, 0x5d, 0xbf, 0x29, 0x11,
+			0xd4, 0xbc, 0xb2, 0xc0, 0xcd, 0x2f, 0x80, 0x5e,
+			0x41, 0x35, 0xe7, 0x05, 0xa1, 0xc1, 0x49, 0xd3,
+			0x09, 0xb3, 0x9e, 0x11, 0x5c, 0xc5, 0x2c, 0xeb,
+			0x30, 0x96, 0xf7, 0x29, 0xe1, 0xb6, 0x97, 0x82,
+			0x03, 0x45, 0xdd, 0x6e, 0x2c, 0xb0, 0xa1, 0xbf,
+			0x19, 0xf3, 0xd6, 0x96, 0xea, 0xc8, 0xc8, 0xc2,
+			0x32, 0x5a, 0x78, 0x1e, 0x2b, 0x44, 0x7a, 0xc6,
+			0x6d, 0xee, 0x46, 0x7a, 0x06, 0xc8, 0xd5, 0x98,
+			0x07, 0xa0, 0xda, 0x8a, 0xce, 0x67, 0xa2, 0xde,
+			0x6e, 0x87, 0x06, 0x18, 0x02, 0x11, 0x37, 0x7c,
+			0x22, 0x91, 0x85, 0xd0, 0x47, 0xff, 0xb6, 0xef,
+			0x1e, 0x33, 0xc6, 0x0e, 0x5b, 0x11, 0xf7, 0x7d,
+			0x4a, 0x25, 0x0d, 0x4c, 0x42, 0xfd, 0xec, 0x07,
+			0x9d, 0x81, 0x8b, 0x7d, 0x6d, 0x28, 0xb0, 0x8e,
+			0x22, 0x4f, 0x2b, 0x26, 0xde, 0x7e, 0x89, 0x46,
+			0x95, 0xcb, 0x34, 0xd7, 0x9c, 0xbf, 0x3b, 0x27,
+			0x76, 0xf2, 0x91, 0x5b, 0xf4, 0x0d, 0x79, 0x9c,
+			0x87, 0x98, 0x62, 0x5c, 0xd6, 0xd4, 0x28, 0x4b,
+			0x6c, 0x37, 0x99, 0xd0, 0xfe, 0xfe, 0x00, 0xa7,
+			0xd4, 0x97, 0xad, 0x8a, 0xf5, 0x01, 0x19, 0xee,
+			0x64, 0x0b, 0x79, 0xcf, 0x8e, 0xb3, 0xe4, 0xa4,
+			0x3a, 0x4d, 0xb0, 0x32, 0x6e, 0x9c, 0x0c, 0x60,
+			0xe8, 0x02, 0xd8, 0x07, 0xce, 0xb8, 0xe7, 0xa8,
+			0xe8, 0x99, 0xe5, 0x5b, 0x24, 0x6e, 0x54, 0x83,
+			0xd4, 0x11, 0xce, 0xdf, 0x8a, 0xdd, 0x1c, 0x78,
+			0x48, 0x2a, 0x93, 0x94, 0xa9, 0x18, 0x36, 0x55,
+			0x5e, 0x1f, 0x81, 0x51, 0x46, 0x04, 0x42, 0x57,
+			0xd1, 0x63, 0x74, 0x82, 0xcf, 0x38, 0x87, 0xe7,
+			0xfc, 0x63, 0xa2, 0x39, 0x30, 0x40, 0x55, 0x8f,
+			0xe1, 0x80, 0x2a, 0xfd, 0xe7, 0x3a, 0x66, 0x1f,
+			0xb1, 0x9e, 0x33, 0x30, 0x54, 0xfe, 0x97, 0xc0,
+			0xcc, 0x00, 0x38, 0x38, 0x24, 0x10, 0x29, 0x19,
+			0x2f, 0x24, 0x87, 0xea, 0x69, 0x53, 0x8e, 0x05,
+			0xc1, 0x4d, 0xcf, 0xe1, 0xaa, 0x41, 0x53, 0x22,
+			0x61, 0xe3, 0xe5, 0x3e, 0x45, 0x81, 0x65, 0xff,
+			0x3f, 0x5d, 0xde, 0xb5, 0x0b, 0x4c, 0xd7, 0x49,
+			0x1d, 0x1e, 0xe7, 0x32, 0x4e, 0x06, 0x58, 0x12,
+			0x0a, 0xd8, 0x21, 0xe1, 0x8d, 0xb3, 0x8d, 0xe9,
+			0xe0, 0xdf, 0x80, 0xd0, 0xb8, 0x52, 0xa1, 0x3e,
+			0x9d, 0xb8, 0x2c, 0x9f, 0x82, 0x35, 0xa1, 0xbe,
+			0x83, 0x53, 0x0f, 0x47, 0x57, 0xa2, 0xd2, 0x85,
+			0x2f, 0xf0, 0x76, 0x19, 0x3a, 0xc5, 0x0d, 0xb5,
+			0xa6, 0x07, 0x07, 0xa4, 0xd4, 0x75, 0xb4, 0x1f,
+			0x01, 0xc3, 0x20, 0x8b, 0x53, 0x4d, 0x54, 0x44,
+			0x69, 0x4a, 0xba, 0x1b, 0x6b, 0xf5, 0xc8, 0x80,
+			0xbb, 0x53, 0x3b, 0x10, 0x2b, 0x3f, 0x1e, 0x82,
+			0x5a, 0x00, 0xda, 0x8d, 0xa4, 0x60, 0xb0, 0x82,
+			0xbf, 0xf5, 0x28, 0xba, 0xfd, 0x8a, 0x7e, 0x68,
+			0xc8, 0x96, 0x88, 0x31, 0x9e, 0x8c, 0x17, 0xca,
+			0x74, 0x22, 0xe6, 0x74, 0x91, 0x72, 0x88, 0xb7,
+			0x03, 0x99, 0x60, 0xd5, 0xb6, 0xc7, 0x56, 0x27,
+			0x47, 0xa3, 0xa7, 0xfb, 0x7a, 0x99, 0xa1, 0x17,
+			0x94, 0x5b, 0x8a, 0x5f, 0xb1, 0xbe, 0xe1, 0x2b,
+			0x56, 0x8c, 0x18, 0xcc, 0xfb, 0x31, 0x0b, 0x17,
+			0x53, 0xe4, 0x10, 0xba, 0x36, 0xf9, 0x8d, 0xb9,
+			0x47, 0xd4, 0x35, 0x93, 0x5e, 0xfc, 0x85, 0x18,
+			0x44, 0xaf, 0xda, 0x29, 0xa7, 0x35, 0xff, 0xd9,
+			0xfd, 0xbe, 0xf2, 0x3a, 0x48, 0xe0, 0x81, 0x40,
+			0x1f, 0xf3, 0x4f, 0xe0, 0xd9, 0x75, 0x55, 0xe7,
+			0x58, 0x27, 0x51, 0x63, 0x77, 0x52, 0x27, 0x53,
+			0x37, 0x1c, 0xb9, 0x06, 0x28, 0x98, 0x1c, 0xdf,
+			0x93, 0x3f, 0xf8, 0x66, 0x70, 0xae, 0x7e, 0x0a,
+			0xa4, 0x5c, 0x24, 0xcd, 0x55, 0xab, 0x90, 0x69,
+			0x86, 0xa6, 0xa0, 0x58, 0xa6, 0x4c, 0xe0, 0xc5,
+			0x46, 0x27, 0x15, 0x7e, 0xea, 0x0d, 0x11, 0x44,
+			0x80, 0xd0, 0xd8, 0xcc, 0xab, 0xe7, 0x1e, 0x61,
+			0xda, 0xe8, 0x95, 0x9c, 0x3f, 0x40, 0x42, 0x2d,
+			0x9f, 0xcc, 0xe7, 0x63, 0xaa, 0x18, 0xe9, 0xc7,
+			0x0b, 0x70, 0x62, 0x97, 0xfd, 0xc4, 0x94, 0xeb,
+			0x99, 0x6b, 0x7c, 0x7c, 0x63, 0x62, 0xda, 0xdd,
+			0x1e, 0x6e, 0xa3, 0x36, 0xe3, 0xec, 0xd9, 0x0e,
+			0x89, 0x53, 0xb0, 0x28, 0xc7, 0xf4, 0xd0, 0xf6,
+			0xb5, 0xd8, 0x63, 0x90, 0x0e, 0xf0, 0x4e, 0x12,
+			0xaf, 0xae, 0xad, 0xb8, 0x31, 0x4c, 0x5d, 0xf7,
+			0xe2, 0xca, 0x19, 0x11, 0x1d, 0xf3, 0x62, 0x40,
+			0x6b, 0x7c, 0x17, 0x3e, 0xaf, 0xa7, 0x77, 0x72,
+			0xc2, 0x90, 0x23, 0x04, 0xbd, 0x03, 0x92, 0xea,
+			0xcb, 0x54, 0x77, 0x69, 0xc7, 0xfb, 0x05, 0xbe,
+			0x02, 0x6f, 0xcb, 0xb8, 0xa2, 0xd5, 0x4b, 0x4e,
+			0x7e, 0x08, 0xd8, 0x21, 0x9f, 0x83, 0xf7, 0xc2,
+			0x5b, 0xc8, 0x47, 0xfd, 0xb8, 0x95, 0x7e, 0xe0,
+			0xfd, 0x1f, 0x41, 0x7c, 0x9d, 0xfb, 0x31, 0x9c,
+			0xa9, 0xdf, 0x54, 0xf0, 0x02, 0x42, 0xb4, 0xf5,
+			0xc7, 0x16, 0x71, 0x19, 0x3b, 0x44, 0x1c, 0xe5,
+			0xf1, 0x58, 0x64, 0x20, 0xec, 0xb1, 0x2a, 0xd3,
+			0x96, 0x58, 0xb2, 0x09, 0xf9, 0xab, 0xcd, 0xae,
+			0x18, 0x6e, 0x98, 0x67, 0x38, 0x8c, 0x5d, 0x62,
+			0xfe, 0x10, 0x59, 0x50, 0xe2, 0x56, 0x69, 0x8f,
+			0xc0, 0x51, 0x29, 0xd8, 0xd9, 0x90, 0x4d, 0x46,
+			0xec, 0x4c, 0xe6, 0x23, 0x9c, 0xa0, 0x2a, 0x6c,
+			0x14, 0x0f, 0x7b, 0x0e, 0xe5, 0xb5, 0xe6, 0x78,
+			0xf7, 0xb2, 0x58, 0x92, 0x78, 0x28, 0xba, 0xd3,
+			0xec, 0x0e, 0xc0, 0x26, 0xf9, 0x60, 0xb5, 0xae,
+			0x5a, 0x7f, 0xd9, 0xf0, 0xf6, 0x8d, 0xf5, 0x15,
+			0x35, 0x6d, 0x69, 0x79, 0xa8, 0x22, 0xef, 0x18,
+			0xcc, 0x91, 0x5b, 0x5d, 0x00, 0xe3, 0xfc, 0x61,
+			0x34, 0x5d, 0x59, 0x8e, 0x14, 0x41, 0x3a, 0x93,
+			0xce, 0x0d, 0xe0, 0xa1, 0x17, 0x6d, 0xb2, 0x72,
+			0x4b, 0x0a, 0x46, 0x08, 0xe3, 0x0d, 0xf6, 0xa9,
+			0xe7, 0x00, 0x22, 0xda, 0x5d, 0x10, 0x46, 0x23,
+			0x82, 0x36, 0x81, 0xa9, 0x4c, 0x5b, 0xbf, 0xcc,
+			0x5e, 0xc2, 0xec, 0xff, 0x36, 0xe5, 0x0b, 0x66,
+			0xc1, 0xee, 0x5a, 0xa8, 0x60, 0x28, 0x26, 0x9a,
+			0x68, 0x7f, 0x89, 0x31, 0xcb, 0xda, 0x58, 0xfe,
+			0x30, 0x02, 0x09, 0xc2, 0xa0, 0x14, 0xed, 0x53,
+			0x4c, 0x81, 0xb9, 0x14, 0x71, 0x20, 0x26, 0x01,
+			0xe1, 0x23, 0xa4, 0x4f, 0x35, 0x2d, 0x0d, 0x97,
+			0x4e, 0xca, 0x56, 0xa5, 0x2e, 0x4e, 0x48, 0x63,
+			0x78, 0x4c, 0x34, 0xd5, 0xb5, 0x5f, 0xa9, 0x46,
+			0x3b, 0x93, 0xb6, 0xd6, 0x9b, 0x13, 0xd9, 0x3f,
+			0x4a, 0xca, 0xe9, 0x1a, 0xe6, 0x75, 0x95, 0xc8,
+			0x85, 0xf7, 0x8c, 0x95, 0x4c, 0x09, 0xd1, 0x16,
+			0x17, 0x0f, 0x5f, 0x02, 0xb3, 0x5f, 0xbf, 0x5a,
+			0x47, 0xae, 0xe6, 0xb2, 0x11, 0xca, 0xfb, 0x88,
+			0xf8, 0xea, 0xd8, 0xe1, 0x6e, 0x5f, 0x3c, 0x93,
+			0x07, 0xb1, 0x64, 0x7c, 0xca, 0xb6, 0x63, 0xcd,
+			0x53, 0x7e, 0xd9, 0xbd, 0x92, 0xbd, 0x96, 0x6f,
+			0x73, 0x06, 0xfb, 0x24, 0x80, 0x95, 0xbd, 0xf1,
+			0xe8, 0xb7, 0x3f, 0x1b, 0x3c, 0x97, 0x93, 0x07,
+			0x5d, 0x54, 0x9b, 0x45, 0x9b, 0x43, 0x23, 0xee,
+			0xa9, 0x2a, 0xa9, 0x1e, 0xf3, 0x45, 0x35, 0x20,
+			0x7a, 0x75, 0xb2, 0xaf, 0xa2, 0x52, 0x95, 0x72,
+			0x61, 0xf6, 0x1c, 0x6b, 0xa2, 0x19, 0x40, 0x93,
+			0x50, 0xf9, 0x66, 0x16, 0xf8, 0x92, 0x40, 0x92,
+			0x2d, 0xe7, 0x96, 0x4f, 0xde, 0xdd, 0x16, 0x04,
+			0x6b, 0x04, 0x74, 0xe1, 0xcb, 0x2a, 0x62, 0x83,
+			0x60, 0xf9, 0xcf, 0x52, 0x0e, 0x02, 0x2a, 0x16,
+			0x55, 0x5b, 0x8c, 0xcd, 0x0b, 0xa8, 0xdf, 0x79,
+			0x21, 0x8c, 0x7e, 0xbb, 0x24, 0x92, 0xf7, 0x8c,
+			0x30, 0xd7, 0x30, 0x42, 0x84, 0x4d, 0x4f, 0xdf,
+			0xbc, 0xce, 0x5d, 0x8f, 0x28, 0xb3, 0x48, 0xf3,
+			0x68, 0xa9, 0xeb, 0x06, 0x76, 0x47, 0x51, 0x1e,
+			0xb7, 0x6d, 0xee, 0xc5, 0xed, 0xf8, 0x8e, 0x4a,
+			0x47, 0xa4, 0x7b, 0xb9, 0xa6, 0x39, 0xdd, 0xe3,
+			0x2f, 0xeb, 0x45, 0xaa, 0xe4, 0x12, 0x0a, 0xe1,
+			0x57, 0x6a, 0xf1, 0x03, 0xe9, 0xe2, 0xd2, 0x37,
+			0x11, 0xb7, 0x0b, 0xb8, 0x51, 0x24, 0xe8, 0xf1,
+			0x4d, 0x91, 0xd3, 0xf3, 0xe4, 0x38, 0x91, 0x84,
+			0x48, 0xe0, 0x73, 0x29, 0x65, 0x26, 0xf2, 0x32,
+			0xc5, 0xce, 0xad, 0xe9, 0x8f, 0x58, 0xba, 0xb1,
+			0x6a, 0x8d, 0x90, 0x20, 0x1d, 0xf8, 0xf0, 0x63,
+			0x72, 0xa8, 0xee, 0x13, 0x0d, 0xe7, 0x5b, 0xed,
+			0xe1, 0xbf, 0x6e, 0x44, 0x21, 0x4d, 0xe0, 0x40,
+			0xd0, 0x0b, 0x16, 0x5b, 0xc0, 0x50, 0x18, 0x49,
+			0x19, 0x17, 0xe9, 0x45, 0xba, 0x2e, 0xd8, 0x60,
+			0xc0, 0xda, 0x55, 0x1a, 0x94, 0x11, 0x8c, 0xc8,
+			0xb4, 0x2e, 0x36, 0xee, 0xd3, 0x4e, 0x34, 0xeb,
+			0x97, 0xe2, 0xf5, 0x3c, 0x32, 0x01, 0xfa, 0xca,
+			0xe9, 0x59, 0x5a, 0x64, 0xcf, 0x5f, 0x2d, 0x5a,
+			0xb0, 0xd1, 0x53, 0xb2, 0x36, 0x41, 0xd4, 0xbe,
+			0x33, 0x76, 0x1a, 0x02, 0x84, 0xea, 0x29, 0x63,
+			0x9c, 0x43, 0xb9, 0xb6, 0xeb, 0xc2, 0x25, 0x1a,
+			0x40, 0xa3, 0xd2, 0x51, 0xe2, 0x42, 0x1b, 0x26,
+			0x7b, 0xb9, 0xa4, 0x10, 0xfc, 0xca, 0x7b, 0xc2,
+			0x0b, 0x89, 0x58, 0xb6, 0x16, 0x94, 0xee, 0xc9,
+			0xf7, 0x0e, 0x05, 0xe0, 0xc0, 0x5d, 0xe5, 0x52,
+			0x22, 0x34, 0xf4, 0x5c, 0x1f, 0xa4, 0x0b, 0x5e,
+			0xb5, 0x5a, 0x11, 0xa4, 0x0f, 0x5d, 0x16, 0x2b,
+			0xa0, 0x9d, 0xb0, 0xf4, 0x0d, 0xc8, 0xc3, 0x68,
+			0x9b, 0xf2, 0x72, 0xf8, 0x2b, 0xd7, 0xb3, 0xfd,
+			0x5d, 0xc5, 0x2a, 0x10, 0xa6, 0x85, 0x3d, 0xfd,
+			0x4c, 0x9d, 0x7c, 0x75, 0x8e, 0xbb, 0x24, 0x6d,
+			0x70, 0xe5, 0x6d, 0x30, 0x12, 0x8c, 0x4b, 0x9b,
+			0xc0, 0x11, 0xe7, 0xeb, 0x0e, 0xd4, 0xf6, 0x1b,
+			0x62, 0xb8, 0xb8, 0xf2, 0xe7, 0x9e, 0x67, 0x6a,
+			0x01, 0x9c, 0xaa, 0xda, 0x5f, 0x17, 0xd9, 0x63,
+			0xe9, 0x0c, 0x92, 0xc8, 0xb0, 0x2a, 0xa3, 0xdc,
+			0x66, 0x46, 0xec, 0x00, 0x3c, 0xb6, 0xa9, 0xc0,
+			0xaa, 0x9c, 0xac, 0x28, 0x6c, 0xcd, 0x94, 0x0c,
+			0xa8, 0xa6, 0x4a, 0xe5, 0x5b, 0x82, 0x43, 0x10,
+			0xa4, 0xa8, 0x06, 0x77, 0x94, 0xb6, 0x56, 0xb4,
+			0xb5, 0xf6, 0x45, 0x8e, 0x5c, 0xa6, 0xc8, 0xde,
+			0x50, 0xe3, 0xd8, 0xd6, 0x04, 0x2c, 0x8f, 0x36,
+			0xba, 0x57, 0xbb, 0x65, 0xec, 0xcb, 0x1c, 0x05,
+			0xa2, 0x33, 0xa4, 0x92, 0xe0, 0x12, 0xc7, 0xa5,
+			0x5e, 0x24, 0xf1, 0x3b, 0xb6, 0x51, 0x66, 0x6c,
+			0x30, 0xa8, 0xd9, 0x3d, 0xf2, 0x73, 0x94, 0x8a,
+			0x59, 0xe0, 0x50, 0xcf, 0x5e, 0x4c, 0xad, 0x75,
+			0xee, 0x10, 0xf5, 0xb8, 0x8a, 0xbc, 0x3d, 0x39,
+			0x85, 0x61, 0xdc, 0xc7, 0xdd, 0xc1, 0x4c, 0x64,
+			0x40, 0x00, 0x69, 0xee, 0xd4, 0x1e, 0x01, 0x60,
+			0x05, 0xc1, 0xea, 0x8e, 0xb9, 0x84, 0xb7, 0x51,
+			0x14, 0x08, 0x05, 0x81, 0xb7, 0x9f, 0xdb, 0xfb,
+			0x25, 0x96, 0x2b, 0x2e, 0xb0, 0x41, 0xc9, 0x12,
+			0xe6, 0xd2, 0x6d, 0xba, 0x92, 0x0e, 0x38, 0x52,
+			0xd7, 0x06, 0x79, 0x16, 0x96, 0xa1, 0x0c, 0x49,
+			0x62, 0x53, 0xf9, 0xcf, 0x4a, 0xde, 0xe7, 0x1d,
+			0x14, 0x6f, 0x85, 0xa9, 0x18, 0xba, 0x0c, 0x5b,
+			0x6d, 0x10, 0xd0, 0xa4, 0x4e, 0xf6, 0x32, 0x69,
+			0x08, 0x44, 0x88, 0xaf, 0xa7, 0x2c, 0xb1, 0x4c,
+			0xf3, 0x01, 0xd7, 0x4c, 0xcf, 0x34, 0x8f, 0x81,
+			0xb7, 0x5e, 0xe7, 0xea, 0x70, 0x5f, 0x17, 0x83,
+			0x67, 0x3b, 0x54, 0x38, 0x36, 0xa7, 0x28, 0x39,
+			0x97, 0x6d, 0x20, 0x8e, 0xd8, 0x39, 0x52, 0x99,
+			0xfb, 0x43, 0xf9, 0x05, 0xa4, 0x3c, 0xd1, 0x83,
+			0x59, 0xe1, 0x87, 0xb5, 0xd9, 0xd5, 0xe4, 0xe1,
+			0xb9, 0xda, 0x9a, 0xeb, 0xbf, 0x85, 0xdd, 0xbe,
+			0xd9, 0x13, 0xab, 0x4d, 0x6b, 0x64, 0xb2, 0x33,
+			0x7d, 0xe9, 0x9a, 0xf1, 0x6e, 0x36, 0xf1, 0x90,
+			0x63, 0xb5, 0xaf, 0x82, 0xe4, 0x17, 0xb8, 0xf0,
+			0x2b, 0x02, 0xc5, 0x58, 0x77, 0x44, 0x5b, 0x7c,
+			0xfb, 0xd0, 0x16, 0x78, 0xb1, 0x7f, 0xde, 0x37,
+			0x31, 0x01, 0x8c, 0x80, 0x1b, 0xd6, 0x2c, 0xec,
+			0x5a, 0x4a, 0x17, 0xfc, 0x8f, 0x5d, 0x1e, 0xe3,
+			0xa4, 0x65, 0xd1, 0xf8, 0xef, 0x04, 0xe2, 0x16,
+			0xa7, 0x34, 0xc7, 0xd1, 0x43, 0xc9, 0xc5, 0x6e,
+			0x6a, 0x79, 0xd4, 0xb6, 0x86, 0xc9, 0x9f, 0x20,
+			0x43, 0x79, 0xb3, 0x7c, 0x79, 0xb3, 0x21, 0xb0,
+			0xf6, 0x47, 0x29, 0x78, 0xdc, 0x4a, 0xbe, 0xa4,
+			0xad, 0xf0, 0xa6, 0xd5, 0x06, 0xf7, 0x10, 0xbb,
+			0x92, 0x4f, 0xa8, 0xd6, 0x1c, 0x1f, 0x4c, 0x5a,
+			0xa6, 0xfe, 0xcd, 0x86, 0xe4, 0xc5, 0xd7, 0xa7,
+			0xb1, 0x9b, 0xbf, 0x9d, 0x20, 0x58, 0xc0, 0x65,
+			0x73, 0xdd, 0x6f, 0xc0, 0x29, 0xa5, 0x0f, 0xc0,
+			0xbd, 0x38, 0xc5, 0x3d, 0x4f, 0xfb, 0x12, 0xe7,
+			0xd9, 0xd1, 0xf2, 0x40, 0xac, 0x35, 0xde, 0x01,
+			0xfb, 0xba, 0x3a, 0xc2, 0x0f, 0x16, 0xa5, 0x3f,
+			0x99, 0xe9, 0x64, 0xdf, 0xad, 0x16, 0x04, 0xbf,
+			0xac, 0xf5, 0x82, 0x56, 0xda, 0x74, 0xd5, 0x16,
+			0x7f, 0xa6, 0x79, 0x67, 0x4b, 0x9e, 0xe5, 0xda,
+			0x72, 0x73, 0x32, 0x01, 0x7b, 0xf3, 0x5b, 0x4d,
+			0xbd, 0x09, 0xf6, 0x6d, 0x50, 0x6d, 0x58, 0xbd,
+			0x27, 0x01, 0x25, 0x36, 0xaf, 0x40, 0x36, 0x58,
+			0x34, 0x9e, 0x1e, 0x5d, 0x69, 0xce, 0x9a, 0x8e,
+			0x98, 0xac, 0x5d, 0x06, 0x84, 0x64, 0x8e, 0x6a,
+			0x5f, 0xa1, 0xeb, 0x5f, 0xfd, 0x68, 0xd6, 0x81,
+			0x72, 0x06, 0xfb, 0x9e, 0x03, 0xbc, 0x1d, 0x83,
+			0x89, 0x8c, 0xee, 0x47, 0xcb, 0x93, 0x03, 0x76,
+			0x64, 0x91, 0x51, 0x4d, 0x07, 0x97, 0xc5, 0xb0,
+			0xde, 0xde, 0x37, 0xf5, 0x38, 0x71, 0x73, 0x39,
+			0x90, 0x8e, 0x8a, 0xc3, 0x4d, 0xaa, 0x03, 0x4f,
+			0x24, 0xfd, 0xc7, 0x58, 0xee, 0xf0, 0xd3, 0x1b,
+			0x0c, 0xce, 0x7d, 0xdb, 0xc0, 0xfc, 0xa2, 0x1b,
+			0x24, 0xaf, 0x62, 0xf7, 0x33, 0xdb, 0xa5, 0x52,
+			0x0f, 0xa4, 0xc2, 0xd1, 0x04, 0xc3, 0x03, 0xfa,
+			0x80, 0x29, 0x06, 0x26, 0x66, 0x04, 0x6b, 0x81,
+			0x29, 0xdb, 0xdc, 0xfe, 0xeb, 0xc7, 0x67, 0x98,
+			0xf9, 0x4a, 0xe7, 0xfe, 0x0d, 0x60, 0x41, 0xb9,
+			0xf2, 0xda, 0xcc, 0x0d, 0xa9, 0xc3, 0xa3, 0x6e,
+			0xbf, 0xb1, 0x6b, 0xb1, 0x48, 0xcb, 0x8e, 0x18,
+			0x94, 0xda, 0x0e, 0x53, 0xb3, 0x5c, 0x5a, 0x19,
+			0xa5, 0xa6, 0x20, 0x0e, 0x58, 0x21, 0x2c, 0xc6,
+			0x78, 0x3f, 0x05, 0xd7, 0x47, 0xbb, 0x59, 0x4e,
+			0xf2, 0x45, 0x63, 0x93, 0xd4, 0x8d, 0x38, 0x6a,
+			0x48, 0x76, 0xe8, 0x34, 0xa5, 0x02, 0xb2, 0x55,
+			0x5a, 0x95, 0x22, 0xa2, 0x7d, 0xa8, 0xf7, 0x35,
+			0x2d, 0x12, 0xcb, 0xc6, 0xa1, 0x2a, 0xf1, 0x9b,
+			0x7f, 0x77, 0x27, 0xb1, 0x74, 0x06, 0x24, 0xdb,
+			0x65, 0x0a, 0x0e, 0xfe, 0x0f, 0xc0, 0x93, 0x9f,
+			0xe3, 0xc1, 0xac, 0x1f, 0xfe, 0xae, 0x15, 0xb7,
+			0xd5, 0xf5, 0xce, 0x93, 0xf3, 0x78, 0xcc, 0x35,
+			0x86, 0x85, 0xaa, 0x60, 0x36, 0x79, 0x0c, 0x40,
+			0x49, 0xfc, 0x2a, 0x2e, 0x92, 0x2e, 0xc8, 0xf7,
+			0x7c, 0xa1, 0x6a, 0xe8, 0x97, 0x25, 0x51, 0xc1,
+			0x5f, 0x57, 0x28, 0x64, 0xc6, 0x83, 0xb1, 0x9c,
+			0x63, 0x34, 0xe6, 0xc7, 0x71, 0xd6, 0x44, 0x93,
+			0x04, 0x9a, 0xa5, 0xbd, 0x37, 0x4b, 0x7b, 0x59,
+			0xd0, 0xe0, 0xd6, 0x37, 0x87, 0x30, 0x1a, 0xf5,
+			0x28, 0x8e, 0x52, 0xa6, 0x06, 0xd4, 0xdc, 0xb8,
+			0xfa, 0xa7, 0x53, 0x80, 0x70, 0x74, 0x43, 0x45,
+			0x51, 0x3e, 0x96, 0xee, 0x34, 0x45, 0x15, 0xc0,
+			0xd4, 0xff, 0x34, 0x5c, 0x6b, 0x06, 0x7d, 0xf2,
+			0xa7, 0x62, 0x71, 0x61, 0xed, 0x2b, 0xdb, 0x78,
+			0x3c, 0x27, 0x1c, 0x8f, 0x84, 0x42, 0x14, 0x66,
+			0xe1, 0x05, 0x17, 0xe7, 0x65, 0x00, 0xa5, 0x80,
+			0xe3, 0xd5, 0x64, 0x7d, 0x14, 0xbd, 0xe8, 0xca,
+			0x10, 0x62, 0x19, 0xe0, 0x50, 0xbb, 0x8e, 0x2b,
+			0x2d, 0x2e, 0xb5, 0xc4, 0x60, 0x86, 0x7c, 0x65,
+			0x9b, 0xde, 0xb3, 0xfa, 0xf7, 0x94, 0xcc, 0x24,
+			0xa8, 0xcb, 0xaa, 0x81, 0x35, 0x8c, 0x01, 0x02,
+			0xc6, 0x4a, 0x43, 0x1e, 0xe5, 0xae, 0xda, 0xf4,
+			0x5d, 0x36, 0x32, 0x92, 0x45, 0x66, 0x00, 0x25,
+			0x62, 0xe2, 0x7b, 0xde, 0x09, 0x23, 0xf0, 0x75,
+			0x33, 0x9e, 0x49, 0x4b, 0xa6, 0x98, 0x69, 0x6c,
+			0xc9, 0x37, 0xd7, 0xec, 0xbd, 0xd3, 0xaf, 0x77,
+			0xe2, 0xe2, 0x81, 0x54, 0x75, 0x73, 0x20, 0x52,
+			0x29, 0x97, 0x39, 0x72, 0x78, 0x79, 0x93, 0xf9,
+			0x04, 0x2f, 0xa1, 0x03, 0xa1, 0x22, 0x74, 0x41,
+			0x0d, 0x59, 0x6a, 0xfc, 0x56, 0x11, 0x03, 0x59,
+			0x9c, 0x02, 0xad, 0xf2, 0xb2, 0x56, 0x7a, 0x4b,
+			0xa0, 0x2e, 0xe4, 0x86, 0x72, 0xf4, 0x71, 0x65,
+			0xfa, 0xef, 0x02, 0xfd, 0xa1, 0xea, 0xc3, 0x3c,
+			0x75, 0xab, 0x8d, 0x5d, 0xfe, 0x88, 0x5c, 0x87,
+			0x8d, 0x91, 0x5e, 0x5e, 0x5e, 0x84, 0xea, 0x7b,
+			0x5e, 0x45, 0x14, 0xc2, 0xa8, 0x77, 0x56, 0xf5,
+			0x66, 0x38, 0x09, 0x75, 0x95, 0x41, 0x70, 0xe3,
+			0x7a, 0xbd, 0x6d, 0xa6, 0xbd, 0xa4, 0xca, 0x56,
+			0xce, 0x63, 0xf9, 0x61, 0x45, 0x89, 0x79, 0xda,
+			0x28, 0xef, 0x63, 0x9a, 0x0e, 0xd4, 0xb6, 0xf0,
+			0xf0, 0xee, 0x73, 0x5e, 0x77, 0x81, 0xc5, 0xde,
+			0x90, 0xdb, 0xe6, 0x55, 0xac, 0x81, 0x17, 0x87,
+			0xca, 0xef, 0xed, 0x61, 0xb5, 0x9f, 0x99, 0x56,
+			0xee, 0xe2, 0x18, 0x94, 0x18, 0x07, 0x23, 0x4e,
+			0x7b, 0xea, 0x4b, 0xc7, 0x80, 0xa1, 0xc9, 0x9b,
+			0xad, 0xd5, 0x30, 0x29, 0xe7, 0xd1, 0xbc, 0x27,
+			0x7d, 0xac, 0x1b, 0x34, 0x10, 0x86, 0x05, 0x5d,
+			0xcb, 0x05, 0x5b, 0x09, 0x43, 0x9a, 0x72, 0xde,
+			0xa1, 0x50, 0xc3, 0x27, 0xf5, 0x2d, 0xcb, 0x2e,
+			0xb0, 0x59, 0xea, 0xb8, 0xbf, 0x9a, 0x70, 0x09,
+			0x97, 0xa5, 0x90, 0x00, 0xda, 0x5c, 0xb8, 0xa7,
+			0x42, 0x7c, 0xc1, 0x4d, 0xe9, 0xf8, 0x03, 0xe4,
+			0x23, 0x96, 0x55, 0x1c, 0x33, 0x02, 0x57, 0xae,
+			0x90, 0xb6, 0x23, 0x19, 0x50, 0xe9, 0xc2, 0xe3,
+			0xd3, 0x12, 0x36, 0x6a, 0x39, 0x3e, 0x73, 0x4b,
+			0x99, 0x72, 0x30, 0xce, 0xbe, 0x85, 0xb1, 0xa6,
+			0xf4, 0xb4, 0xd1, 0x41, 0x1e, 0xc9, 0x79, 0x04,
+			0xf2, 0x56, 0x66, 0x70, 0x5b, 0x54, 0xa9, 0x16,
+			0xa3, 0x25, 0x17, 0xde, 0x1b, 0xf4, 0x1c, 0x04,
+			0x0b, 0x1e, 0xf4, 0xf6, 0x68, 0x92, 0x36, 0x72,
+			0x59, 0x71, 0xbf, 0xce, 0x68, 0x27, 0x26, 0xe0,
+			0x11, 0x27, 0x61, 0x5b, 0xb5, 0xde, 0x25, 0x4c,
+			0xb5, 0x74, 0xf8, 0x54, 0xe5, 0x0d, 0xf7, 0x04,
+			0x39, 0x91, 0x58, 0x79, 0xb7, 0x01, 0x06, 0xf4,
+			0x01, 0xa4, 0xb0, 0x4e, 0xab, 0xe4, 0x2d, 0x98,
+			0xe5, 0x4f, 0x8d, 0x9e, 0x81, 0x3d, 0x0a, 0xcb,
+			0x19, 0x2d, 0xf0, 0x5e, 0x98, 0x19, 0x74, 0xfe,
+			0xc7, 0x1d, 0x34, 0x75, 0x17, 0xca, 0xfa, 0x34,
+			0x31, 0x37, 0x79, 0xc1, 0x0c, 0x25, 0xd0, 0x3c,
+			0x8e, 0x3b, 0x5a, 0x29, 0x41, 0x4e, 0xad, 0x9b,
+			0xa1, 0xc6, 0x84, 0xb6, 0x2a, 0x0b, 0x0b, 0x8c,
+			0xac, 0x47, 0x00, 0x5d, 0x9f, 0x1d, 0x89, 0x8e,
+			0x92, 0x69, 0x4d, 0xcd, 0xad, 0x27, 0x3f, 0xec,
+			0x66, 0x85, 0xbf, 0xba, 0xdd, 0x3a, 0x7d, 0x67,
+			0xce, 0xe6, 0x5c, 0xa1, 0x99, 0xe7, 0x2a, 0x22,
+			0x2c, 0x4b, 0xb2, 0x2d, 0x85, 0x76, 0x09, 0x9b,
+			0x85, 0x6c, 0x7a, 0x78, 0xb4, 0xd0, 0x7a, 0x22,
+			0x72, 0xdc, 0x91, 0xae, 0x1e, 0x5b, 0xdb, 0xba,
+			0xf3, 0x1a, 0xa9, 0x4e, 0xd7, 0xd5, 0x41, 0xf2,
+			0xcd, 0x6b, 0xc9, 0x75, 0xdf, 0x9f, 0x78, 0x51,
+			0x95, 0xf8, 0x86, 0xe1, 0x94, 0xf9, 0xb7, 0xa2,
+			0x00, 0xa4, 0x4c, 0x8f, 0x7b, 0xde, 0x6d, 0x40,
+			0x99, 0xfa, 0xd4, 0x30, 0xd9, 0xe2, 0xeb, 0x36,
+			0xac, 0x0a, 0x35, 0x26, 0x8c, 0xf6, 0x2b, 0x84,
+			0xe0, 0x09, 0x23, 0xd4, 0x5e, 0xf2, 0xe4, 0xd7,
+			0x50, 0x34, 0xd4, 0xaf, 0xaf, 0x4a, 0xd3, 0xf8,
+			0xc5, 0x60, 0x09, 0xa5, 0x4b, 0xba, 0x71, 0xba,
+			0xda, 0x3c, 0xa4, 0xbd, 0x4b, 0x81, 0x7c, 0xab,
+			0xf1, 0x46, 0x74, 0x96, 0xa9, 0xcc, 0xbc, 0x18,
+			0x68, 0xaa, 0x9e, 0xae, 0xbf, 0x2d, 0xa8, 0xbe,
+			0x86, 0xb2, 0xcd, 0xe7, 0xd0, 0xc1, 0x4e, 0xb2,
+			0x17, 0xa5, 0x09, 0xf9, 0xa6, 0x3c, 0x8a, 0x8c,
+			0xac, 0x93, 0x32, 0xe4, 0x66, 0x59, 0x4e, 0x32,
+			0x70, 0xee, 0x13, 0x39, 0x09, 0x01, 0x2a, 0x77,
+			0x81, 0xf6, 0x5e, 0x12, 0x2b, 0x63, 0x70, 0xd6,
+			0x6a, 0x13, 0x7b, 0xcd, 0xde, 0x11, 0x99, 0x9c,
+			0x29, 0xdc, 0xd3, 0x6d, 0x25, 0x21, 0x83, 0x31,
+			0x44, 0x1c, 0x02, 0x92, 0x0e, 0x7a, 0xc0, 0xdb,
+			0xf2, 0xea, 0x7e, 0x98, 0x65, 0x59, 0xb1, 0x55,
+			0x95, 0xc1, 0xfc, 0x15, 0xb1, 0x0d, 0x8d, 0x17,
+			0x4e, 0xc3, 0x3b, 0xcb, 0x8f, 0xd4, 0x0b, 0x31,
+			0x4a, 0x83, 0x6b, 0x93, 0xd1, 0xa0, 0x78, 0x9d,
+			0x41, 0x01, 0xc3, 0x2a, 0xb2, 0x68, 0xe8, 0x0e,
+			0xc8, 0x7c, 0x38, 0xc9, 0x4b, 0xab, 0xc7, 0xb4,
+			0xb9, 0x2c, 0x1e, 0x63, 0xf5, 0xcc, 0x33, 0x7c,
+			0xeb, 0xb4, 0x4d, 0xf8, 0xb1, 0xa9, 0x06, 0x73,
+			0xc8, 0xb5, 0x2c, 0x6c, 0x73, 0xf1, 0x8a, 0xd0,
+			0x50, 0x21, 0xef, 0xb1, 0x1b, 0x60, 0x93, 0x18,
+			0xed, 0x7c, 0x72, 0x58, 0x9a, 0x7b, 0x78, 0xf2,
+			0x3b, 0x8f, 0x78, 0x0a, 0xbf, 0x0a, 0xbd, 0x65,
+			0x15, 0x50, 0x69, 0xb4, 0xd5, 0xf6, 0xaf, 0xd5,
+			0x4d, 0x06, 0xf2, 0x68, 0xfa, 0xad, 0x47, 0x9e,
+			0x0a, 0x00, 0x52, 0xf2, 0xc0, 0x3f, 0x88, 0x1e,
+			0x04, 0x6a, 0x69, 0x14, 0xd8, 0xd4, 0x52, 0x9a,
+			0xd7, 0xb6, 0x11, 0x2e, 0xed, 0xc8, 0x5f, 0xb9,
+			0x12, 0xc4, 0xce, 0xb2, 0x12, 0x78, 0x07, 0x68,
+			0xe8, 0x05, 0x03, 0x77, 0x97, 0x96, 0xed, 0xd7,
+			0x2b, 0x8d, 0xb6, 0x84, 0x64, 0x4c, 0x52, 0x87,
+			0xbe, 0x26, 0x53, 0x35, 0xf7, 0x8b, 0xdd, 0x54,
+			0x9b, 0x75, 0x78, 0xf8, 0x09, 0x20, 0xfa, 0xa5,
+			0xe8, 0xf9, 0x94, 0xce, 0x3a, 0x21, 0x5c, 0x7d,
+			0x62, 0xf0, 0x3f, 0xb3, 0xf7, 0x90, 0xcb, 0x06,
+			0xbb, 0x30, 0x2f, 0xa5, 0x99, 0x97, 0x4e, 0x1c,
+			0x00, 0x4c, 0xb6, 0xec, 0x64, 0x22, 0x8e, 0x78,
+			0xc8, 0x6c, 0xb0, 0xec, 0x2e, 0x7c, 0x99, 0x87,
+			0x0b, 0xe2, 0xb5, 0x2e, 0x1d, 0xe8, 0xb7, 0x3c,
+			0xf9, 0xab, 0x34, 0x3a, 0x70, 0x63, 0x58, 0xcf,
+			0x53, 0xb1, 0x26, 0x49, 0xf6, 0xae, 0x82, 0xb0,
+			0x7f, 0x04, 0x7d, 0xbb, 0xe0, 0xbb, 0x6b, 0x0d,
+			0x0e, 0x76, 0x10, 0x23, 0xfa, 0x2d, 0xc7, 0x7d,
+			0x0f, 0x87, 0x1f, 0xd3, 0xb9, 0x6b, 0xc6, 0xa0,
+			0x64, 0x4c, 0xa8, 0x46, 0x4a, 0x0b, 0xd4, 0x7b,
+			0x10, 0xcd, 0xb0, 0xb1, 0xd5, 0x17, 0xd1, 0xc7,
+			0x24, 0xb4, 0xd2, 0xd4, 0x08, 0xc9, 0x4c, 0xea,
+			0x98, 0xb8, 0x19, 0x16, 0x5b, 0x8e, 0x47, 0x60,
+			0x9a, 0xab, 0x5a, 0x6a, 0x49, 0xcd, 0xa3, 0x2b,
+			0x83, 0x1d, 0x7d, 0x2d, 0xcf, 0x5a, 0xeb, 0x43,
+			0xf5, 0xd2, 0x4b, 0xce, 0xe3, 0xef, 0x5d, 0x1b,
+			0x98, 0xc0, 0x72, 0x1e, 0x3c, 0x6d, 0xd8, 0x00,
+			0x0d, 0xf6, 0xce, 0x07, 0x3f, 0x39, 0x9e, 0xc0,
+			0xd4, 0x49, 0x3d, 0xfe, 0x65, 0xe0, 0x9b, 0xbd,
+			0x84, 0x7d, 0xf4, 0x05, 0x99, 0x82, 0x93, 0x52,
+			0xbe, 0x86, 0xf6, 0x5a, 0xe3, 0x37, 0x45, 0x71,
+			0x36, 0x5c, 0x7f, 0xba, 0x3b, 0xf9, 0xfd, 0x93,
+			0xbd, 0xed, 0x11, 0x30, 0xc8, 0x5a, 0x67, 0x21,
+			0x36, 0x51, 0x08, 0x40, 0xc0, 0xb3, 0xa5, 0x1b,
+			0x7c, 0xdc, 0x75, 0x59, 0x0c, 0x66, 0xec, 0x4c,
+			0x42, 0x2c, 0xfc, 0xb4, 0x8e, 0x68, 0xe9, 0x84,
+			0x3b, 0x86, 0xcb, 0xd2, 0x4c, 0x12, 0x67, 0x6c,
+			0xcb, 0x91, 0xd3, 0xf0, 0x55, 0x22, 0x09, 0x03,
+			0xab, 0xb2, 0x8e, 0xbf, 0xdb, 0x8f, 0xe4, 0x26,
+			0x9b, 0x5f, 0xac, 0x54, 0x1d, 0x52, 0x79, 0xc1,
+			0x15, 0x88, 0xce, 0x2a, 0xa7, 0x22, 0xdd, 0x3d,
+			0x8d, 0xfc, 0xc9, 0x28, 0x76, 0xb3, 0x3e, 0x58,
+			0x1d, 0xa5, 0xd7, 0x20, 0xd4, 0x57, 0xd9, 0x7b,
+			0x6b, 0x2d, 0x4d, 0x80, 0x3b, 0x46, 0x9f, 0xed,
+			0x48, 0x66, 0xc4, 0x88, 0x28, 0x54, 0x2b, 0x65,
+			0x4d, 0xb3, 0x49, 0x35, 0xa8, 0xda, 0x47, 0x05,
+			0x0f, 0x42, 0x8a, 0x09, 0x9b, 0x3d, 0xc4, 0xc7,
+			0xa5, 0x82, 0xc1, 0x90, 0x65, 0xa2, 0xb9, 0x72,
+			0xbc, 0xe4, 0x8b, 0xdf, 0xab, 0xf8, 0x2c, 0xa8,
+			0x91, 0x7d, 0x6d, 0x1d, 0xbe, 0x6d, 0xed, 0x82,
+			0x52, 0xde, 0x88, 0xd1, 0xe8, 0x52, 0x1c, 0x41,
+			0x7c, 0x53, 0x67, 0x8a, 0x44, 0x13, 0xee, 0x33,
+			0xa4, 0xf7, 0x55, 0x6d, 0x8c, 0x09, 0x58, 0x6c,
+			0x1e, 0x6b, 0xc1, 0xba, 0x66, 0x91, 0x3c, 0x5a,
+			0xbe, 0x12, 0xa9, 0xeb, 0x90, 0x66, 0x30, 0xd3,
+			0x6f, 0xa8, 0x57, 0xc3, 0x8c, 0x04, 0xd5, 0xf2,
+			0xb2, 0x9b, 0x56, 0x83, 0xe1, 0xd4, 0x7f, 0x10,
+			0xcb, 0xb4, 0xf2, 0x6b, 0x6d, 0xdb, 0xfb, 0x70,
+			0x4c, 0xb8, 0x6d, 0x92, 0x3f, 0x6c, 0x0b, 0x48,
+			0x99, 0xcc, 0xb8, 0x72, 0x30, 0xb9, 0xcb, 0xd0,
+			0xa1, 0xb3, 0x18, 0xe4, 0x1a, 0xb8, 0x53, 0x99,
+			0x80, 0x6f, 0xd5, 0x4d, 0x09, 0x52, 0x9f, 0x68,
+			0xb9, 0x39, 0xa1, 0x86, 0x8d, 0x21, 0x97, 0x80,
+			0x7f, 0x8d, 0x94, 0xc0, 0x2a, 0x3d, 0x28, 0x50,
+			0x54, 0xd7, 0x55, 0x51, 0xd6, 0x37, 0xa2, 0x09,
+			0x7b, 0xc5, 0xcb, 0x1e, 0xce, 0x3b, 0x13, 0x2d,
+			0xf4, 0x75, 0xa1, 0x75, 0x0b, 0x4d, 0x51, 0x5f,
+			0x3e, 0x8e, 0x52, 0x11, 0x2a, 0x5d, 0xd1, 0x88,
+			0x09, 0x83, 0xac, 0x3b, 0x29, 0x44, 0xa2, 0x75,
+			0x85, 0x8c, 0x37, 0x16, 0x71, 0x93, 0xcf, 0x8e,
+			0x53, 0x33, 0x25, 0xc5, 0xc3, 0x30, 0x89, 0x8e,
+			0xe8, 0xe3, 0xf4, 0x6a, 0x29, 0x15, 0xa0, 0xd2,
+			0x76, 0x38, 0x66, 0x1d, 0xd5, 0xb9, 0xc7, 0xb3,
+			0x6d, 0x1e, 0xeb, 0x87, 0xed, 0xcc, 0x3f, 0x29,
+			0x58, 0x21, 0xd2, 0xee, 0x79, 0x71, 0x33, 0x4b,
+			0x0e, 0x57, 0x21, 0xa9, 0xc3, 0xe1, 0x8d, 0xa4,
+			0x23, 0x50, 0xda, 0xfc, 0x9f, 0x2c, 0x9c, 0x3c,
+			0x12, 0x9e, 0xf3, 0xb5, 0x71, 0xd1, 0x73, 0x63,
+			0xdb, 0x85, 0xfd, 0xcf, 0x8c, 0x60, 0x03, 0x35,
+			0xdf, 0xf2, 0x3f, 0xb2, 0xbf, 0xbc, 0xee, 0xf2,
+			0x94, 0x8d, 0x44, 0xbb, 0x8b, 0x40, 0x91, 0xbe,
+			0x1f, 0x41, 0x72, 0xea, 0x4b, 0x0a, 0xc3, 0xab,
+			0x43, 0xd4, 0xff, 0x59, 0x80, 0x70, 0x04, 0xb3,
+			0xc4, 0xf0, 0x59, 0x3e, 0x9a, 0x23, 0x4d, 0xc1,
+			0xb9, 0xa4, 0x8d, 0x34, 0xb6, 0x5d, 0xfe, 0xda,
+			0x5a, 0xd9, 0x89, 0xbb, 0xb3, 0x80, 0x05, 0xa5,
+			0x0f, 0xc6, 0x5a, 0xa5, 0xc2, 0x5c, 0x47, 0x40,
+			0x1b, 0x55, 0x15, 0xa8, 0x5c, 0xc4, 0x4e, 0x62,
+			0x7d, 0xb5, 0xf8, 0x7e, 0x96, 0x42, 0x4c, 0x6a,
+			0x78, 0x83, 0xd4, 0xf0, 0x6a, 0x0d, 0xb5, 0xbb,
+			0x87, 0x7b, 0x9e, 0xec, 0x92, 0xf0, 0xaf, 0xf1,
+			0x61, 0x24, 0xc6, 0x29, 0x5d, 0xc3, 0x0e, 0x24,
+			0xcb, 0x82, 0xe3, 0xfa, 0x0c, 0x87, 0x8a, 0x04,
+			0x2f, 0x0e, 0xdd, 0x33, 0x01, 0xc8, 0xd4, 0xed,
+			0xfd, 0x19, 0x9a, 0x28, 0xd3, 0xfd, 0x11, 0x75,
+			0x34, 0x3c, 0x74, 0xf2, 0x8b, 0xab, 0x80, 0x9a,
+			0xf7, 0x07, 0x5f, 0x68, 0xd7, 0x4c, 0xae, 0x8a,
+			0x00, 0xa6, 0x88, 0x19, 0x5b, 0xbe, 0x80, 0x5e,
+			0x49, 0x94, 0x13, 0xd6, 0x10, 0x70, 0x09, 0xc4,
+			0x23, 0xa9, 0x6d, 0x09, 0x33, 0xa2, 0x6b, 0x93,
+			0xa5, 0x83, 0x01, 0x42, 0x93, 0xfc, 0xd2, 0xd9,
+			0x34, 0x8a, 0x20, 0xeb, 0xd7, 0x67, 0x0b, 0xdd,
+			0x96, 0x98, 0x18, 0x07, 0xc9, 0xd6, 0xf9, 0xb5,
+			0x9a, 0x19, 0xcc, 0x67, 0x52, 0xc1, 0x17, 0x59,
+			0x29, 0xf8, 0x1d, 0x95, 0x31, 0x1c, 0xf6, 0x3c,
+			0xa6, 0xb1, 0x19, 0x73, 0xa6, 0x3e, 0xb3, 0x66,
+			0xa8, 0x77, 0x30, 0x51, 0x99, 0xe0, 0x02, 0xb3,
+			0xd6, 0x3c, 0x99, 0xcc, 0x62, 0x40, 0xf7, 0x63,
+			0xf8, 0xdd, 0xbf, 0x70, 0x43, 0xca, 0xea, 0xc2,
+			0x6b, 0xf1, 0x14, 0x05, 0x75, 0xb8, 0x4d, 0x31,
+			0x02, 0xa9, 0x2d, 0x4c, 0x09, 0xb4, 0x26, 0xc0,
+			0x1f, 0xbf, 0xda, 0x70, 0xae, 0x54, 0x97, 0x10,
+			0x53, 0xb6, 0x47, 0xc1, 0x4b, 0xb3, 0x87, 0xcd,
+			0xe3, 0xd1, 0xb5, 0x64, 0x41, 0x33, 0xb7, 0x07,
+			0x9c, 0xb6, 0xcd, 0x97, 0x2f, 0x45, 0xc8, 0x99,
+			0x50, 0xb0, 0xc2, 0x02, 0xa5, 0x60, 0x03, 0x1b,
+			0xa6, 0x49, 0xd1, 0xf6, 0x30, 0x86, 0x13, 0x7a,
+			0x32, 0x55, 0x14, 0xd7, 0x58, 0xf6, 0x50, 0x7d,
+			0xff, 0xea, 0x16, 0x17, 0xe7, 0xde, 0xed, 0xac,
+			0x75, 0x1f, 0x09, 0x02, 0x8e, 0xa4, 0x5d, 0x83,
+			0x90, 0xa8, 0x81, 0x84, 0x8c, 0x7b, 0xde, 0x7e,
+			0xe9, 0xa5, 0xfc, 0x91, 0x9d, 0x17, 0x1c, 0x33,
+			0x60, 0x78, 0x8e, 0xe0, 0x72, 0x6b, 0x03, 0x18,
+			0x4d, 0x7c, 0x42, 0x52, 0xe4, 0x8a, 0xd4, 0xc6,
+			0x5f, 0xb0, 0x5e, 0xe3, 0x61, 0x0c, 0x5d, 0x0a,
+			0x99, 0xc3, 0x8f, 0xf1, 0x39, 0x74, 0x30, 0xf6,
+			0x15, 0x10, 0x4c, 0xe0, 0x5c, 0xd2, 0x26, 0x65,
+			0x2c, 0x00, 0x86, 0x31, 0xe1, 0xca, 0x70, 0x25,
+			0x27, 0xbd, 0x68, 0xd3, 0xeb, 0xe4, 0xd1, 0x7b,
+			0x90, 0x76, 0x6e, 0x35, 0xd6, 0x78, 0x23, 0x43,
+			0x5b, 0x81, 0xb3, 0xef, 0xb5, 0x1f, 0x43, 0xd3,
+			0xb1, 0xa1, 0x3a, 0x66, 0x3d, 0x6b, 0x45, 0xdf,
+			0x70, 0xb8, 0xb5, 0xb2, 0xca, 0x0f, 0xb4, 0xae,
+			0x95, 0x70, 0x01, 0x04, 0xcb, 0x1a, 0xd4, 0x53,
+			0x20, 0x3c, 0x25, 0x20, 0x95, 0x96, 0xa8, 0x09,
+			0xa2, 0xa2, 0x2a, 0xb7, 0x9d, 0xdf, 0x3d, 0xb1,
+			0x24, 0xa7, 0xc6, 0xd1, 0x9b, 0x09, 0xef, 0xd8,
+			0xeb, 0xc5, 0x37, 0x36, 0xdd, 0xf2, 0xed, 0x89,
+			0x12, 0x82, 0x81, 0xb6, 0xb6, 0x4c, 0xf3, 0xa2,
+			0x94, 0xdd, 0x16, 0xb5, 0x33, 0x42, 0x2b, 0xf8,
+			0x10, 0xaf, 0xb6, 0xdf, 0x59, 0x8e, 0x0c, 0x1b,
+			0xcf, 0x4a, 0x24, 0x5f, 0x99, 0x0e, 0x9c, 0xbe,
+			0xd5, 0x8a, 0x16, 0x28, 0xbb, 0xac, 0x2f, 0xa2,
+			0x89, 0x31, 0x7a, 0x1d, 0xfc, 0x16, 0x8e, 0x25,
+			0xca, 0x9a, 0x55, 0xff, 0xd8, 0xc9, 0x41, 0x86,
+			0x65, 0xdf, 0x4e, 0xeb, 0x58, 0x54, 0x95, 0xf2,
+			0x7b, 0xdc, 0x53, 0x02, 0x1e, 0x85, 0x6e, 0x64,
+			0xf5, 0x55, 0x94, 0xe3, 0x67, 0xa6, 0x74, 0xd8,
+			0xf3, 0x67, 0xd3, 0x28, 0x59, 0xd4, 0x54, 0xa6,
+			0x93, 0xd9, 0x30, 0x18, 0x87, 0x19, 0x38, 0x6f,
+			0x68, 0x7b, 0x7c, 0x2f, 0x46, 0x83, 0xab, 0xdb,
+			0xb6, 0x34, 0x79, 0xe7, 0x8c, 0xe2, 0xe0, 0xee,
+			0x52, 0x9d, 0xad, 0x54, 0x12, 0x9b, 0x61, 0x8b,
+			0x7e, 0x78, 0x81, 0x5e, 0x5a, 0xd4, 0xf0, 0x20,
+			0x74, 0x86, 0xdb, 0xf1, 0xdc, 0xbc, 0x7c, 0x7d,
+			0x73, 0xff, 0x0c, 0xf4, 0x6e, 0x9e, 0x8c, 0x59,
+			0xe6, 0xe2, 0x21, 0xdd, 0xcc, 0x6f, 0x5d, 0xf8,
+			0x48, 0x7b, 0x19, 0x23, 0x44, 0xf3, 0xcb, 0xe1,
+			0x55, 0xb5, 0x83, 0xb2, 0x5d, 0x92, 0xe3, 0xa8,
+			0xf1, 0x65, 0xa2, 0xa3, 0xe9, 0xf4, 0x88, 0xf4,
+			0x7a, 0x2e, 0xc2, 0x8b, 0x75, 0x66, 0xfe, 0xf0,
+			0x67, 0x6d, 0x85, 0x90, 0xa7, 0xb5, 0x83, 0xd5,
+			0x73, 0xd5, 0xbf, 0xff, 0x38, 0x0a, 0x30, 0x91,
+			0x0a, 0x7a, 0xe3, 0xbf, 0xe8, 0x76, 0x5a, 0xc7,
+			0xa5, 0x53, 0x8d, 0xf7, 0x8c, 0xed, 0x5a, 0x21,
+			0x3d, 0x8c, 0x05, 0x81, 0x20, 0xc7, 0x4d, 0x7d,
+			0xcf, 0x68, 0x50, 0xf7, 0x96, 0x69, 0xad, 0x12,
+			0xdc, 0x51, 0x07, 0x22, 0x20, 0x22, 0x48, 0x5e,
+			0xa2, 0x95, 0xe3, 0x9e, 0xef, 0xb3, 0xcf, 0x2f,
+			0x1f, 0x63, 0x96, 0x4d, 0xdc, 0xb9, 0x60, 0xdf,
+			0x34, 0xa8, 0xa4, 0x10, 0x3d, 0xac, 0x00, 0x49,
+			0x82, 0xf6, 0x16, 0xc9, 0x54, 0x73, 0x40, 0x23,
+			0xae, 0xe8, 0x05, 0x82, 0x83, 0xde, 0xea, 0x75,
+			0x59, 0xee, 0x58, 0x38, 0xa0, 0x21, 0x95, 0xba,
+			0x48, 0x6f, 0xdf, 0x72, 0x0d, 0xea, 0xeb, 0xad,
+			0x13, 0xc2, 0x83, 0x8a, 0x34, 0x4f, 0xbf, 0xec,
+			0x61, 0xc1, 0x17, 0x9f, 0x2b, 0x9c, 0x8b, 0x8b,
+			0x98, 0xfb, 0xa4, 0xf2, 0xba, 0x46, 0x56, 0xe8,
+			0x7b, 0x2f, 0x41, 0xa0, 0xcb, 0x35, 0x04, 0x6a,
+			0x38, 0xe1, 0xde, 0x05, 0x66, 0x05, 0xd2, 0xca,
+			0x0c, 0x8c, 0xed, 0x32, 0x21, 0x34, 0x7f, 0x68,
+			0x38, 0x1c, 0x24, 0xce, 0xe1, 0xb0, 0x38, 0xb2,
+			0x4b, 0xed, 0xbd, 0x65, 0xf2, 0x60, 0x1c, 0x81,
+			0x05, 0x34, 0x4c, 0x0c, 0xe5, 0xd4, 0xe2, 0xa0,
+			0xb4, 0x4f, 0xca, 0x5b, 0xfc, 0x5d, 0x43, 0x8a,
+			0x17, 0x49, 0x0d, 0xba, 0x51, 0x2c, 0x08, 0x57,
+			0x47, 0xa9, 0x96, 0xde, 0x72, 0xf2, 0xda, 0x54,
+			0xbf, 0x8b, 0xc7, 0xb4, 0x31, 0x7d, 0x96, 0x4a,
+			0x64, 0x16, 0x2d, 0x80, 0x5e, 0x4e, 0x38, 0xac,
+			0x2f, 0xc4, 0xdf, 0x02, 0x5e, 0x0c, 0x46, 0x03,
+			0x0f, 0x0a, 0x48, 0x2e, 0x46, 0x76, 0x06, 0x4e,
+			0xb9, 0xd4, 0x42, 0x2f, 0xca, 0x68, 0xd6, 0x96,
+			0xb9, 0x44, 0xcf, 0x83, 0x08, 0x7f, 0x3f, 0x2a,
+			0x55, 0x55, 0x9d, 0x4b, 0x18, 0x14, 0x62, 0x18,
+			0xa2, 0xa1, 0x41, 0x36, 0x74, 0x45, 0xc7, 0x99,
+			0x76, 0x14, 0x54, 0x5e, 0x2b, 0x5b, 0x85, 0x1c,
+			0xca, 0xfa, 0xae, 0xd0, 0xc6, 0x47, 0x12, 0x94,
+			0xee, 0x38, 0x8c, 0x30, 0xe8, 0xc0, 0x41, 0xdc,
+			0x52, 0x03, 0xfa, 0x27, 0x90, 0xd9, 0x1b, 0x99,
+			0x7d, 0xc4, 0x03, 0xf3, 0xee, 0x02, 0xa9, 0x7c,
+			0x92, 0x0b, 0x23, 0x8c, 0x80, 0xe8, 0x2c, 0x03,
+			0x5d, 0x7f, 0x73, 0xfa, 0xb2, 0x99, 0x61, 0x9f,
+			0x77, 0x43, 0x29, 0xe7, 0xef, 0x43, 0x6a, 0xe5,
+			0x10, 0x70, 0x5c, 0x39, 0xa0, 0x75, 0x6f, 0x64,
+			0xd1, 0x42, 0xe1, 0x29, 0x9c, 0x18, 0x06, 0xcf,
+			0xf3, 0xba, 0x3b, 0x0e, 0x29, 0x41, 0x01, 0x34,
+			0xcf, 0x83, 0xaa, 0x66, 0xb3, 0x4f, 0x2c, 0x8f,
+			0xbf, 0x7a, 0x84, 0x0c, 0x09, 0x89, 0x7a, 0x4e,
+			0xbe, 0x90, 0x27, 0x83, 0xa5, 0x90, 0x2c, 0x93,
+			0xf6, 0x32, 0xd2, 0x40, 0xd6, 0x84, 0xb5, 0xa5,
+			0x46, 0xbe, 0x41, 0xb7, 0x83, 0xac, 0x25, 0x54,
+			0xdf, 0x93, 0x68, 0x73, 0x26, 0x6b, 0xa1, 0x35,
+			0x2d, 0x6d, 0xf1, 0x84, 0x51, 0xa4, 0x21, 0xf6,
+			0xfd, 0x4d, 0xb2, 0x50, 0x15, 0x9f, 0xf5, 0x38,
+			0x21, 0x9c, 0x0a, 0xa6, 0x49, 0xde, 0x7e, 0xac,
+			0x01, 0xf6, 0x58, 0x55, 0x81, 0x7c, 0xec, 0x7c,
+			0xb1, 0xec, 0x44, 0xb7, 0xd1, 0xf3, 0xcf, 0x62,
+			0xd3, 0x8b, 0xe0, 0x40, 0x04, 0xcb, 0x44, 0x94,
+			0xe7, 0xeb, 0x5f, 0x1a, 0x99, 0xc6, 0x87, 0xe1,
+			0x18, 0xce, 0x79, 0x6f, 0x3c, 0x6b, 0x10, 0xb7,
+			0xe4, 0xd1, 0xc3, 0x6a, 0x77, 0x36, 0x0e, 0xa4,
+			0x8a, 0x0c, 0x0b, 0xdf, 0x5b, 0x57, 0xb9, 0xa8,
+			0x03, 0x2d, 0xde, 0x28, 0xb3, 0xc2, 0x71, 0xf6,
+			0x57, 0x38, 0x22, 0x28, 0x6c, 0x7b, 0xb9, 0xfb,
+			0xc9, 0x8c, 0xe7, 0xf5, 0x34, 0x6d, 0x5b, 0x53,
+			0x03, 0xef, 0x63, 0x36, 0xc2, 0xe1, 0x95, 0x47,
+			0x3c, 0x73, 0xb2, 0x4a, 0x68, 0xb7, 0x86, 0xbe,
+			0xe5, 0x94, 0x1a, 0x3b, 0xb9, 0xec, 0x75, 0x2c,
+			0x9b, 0xed, 0xe6, 0x4a, 0xef, 0xbd, 0x41, 0x55,
+			0x2e, 0xd7, 0xc1, 0x42, 0x3a, 0xfb, 0x30, 0x90,
+			0x35, 0x23, 0x4f, 0xb1, 0x97, 0xc1, 0x1c, 0x5e,
+			0x27, 0xd4, 0xfd, 0xf6, 0xb2, 0xbc, 0x5c, 0x9d,
+			0xe6, 0xb6, 0x88, 0xbd, 0x39, 0x4f, 0x0e, 0xad,
+			0x7b, 0x76, 0xce, 0x16, 0x93, 0x4c, 0x4d, 0x89,
+			0x8b, 0xcd, 0x72, 0x75, 0xd5, 0x97, 0x52, 0x63,
+			0xa3, 0x38, 0xc5, 0xb5, 0xf9, 0x08, 0x29, 0xdc,
+			0x03, 0x25, 0xc9, 0x16, 0x9a, 0xf8, 0x6d, 0xe5,
+			0x8d, 0x75, 0x29, 0xd3, 0x41, 0x5b, 0x01, 0xda,
+			0x80, 0xbe, 0x6b, 0xf2, 0xe5, 0x7e, 0x79, 0x9e,
+			0x6b, 0x9c, 0xc0, 0xd2, 0xe3, 0x68, 0xfb, 0xb7,
+			0xba, 0x8e, 0x97, 0x39, 0xbb, 0xe5, 0xeb, 0x41,
+			0x13, 0xf8, 0x8c, 0x5b, 0xf2, 0x87, 0xb1, 0x45,
+			0x2f, 0xcd, 0x5f, 0x5a, 0xd1, 0xa9, 0xdf, 0xe1,
+			0x03, 0x80, 0x7f, 0x3c, 0xf5, 0xf7, 0x68, 0x08,
+			0xde, 0x0c, 0x7b, 0x4a, 0xf0, 0x76, 0xd4, 0xc2,
+			0xd3, 0xeb, 0xaf, 0xa8, 0x05, 0x39, 0xad, 0xa7,
+			0x9b, 0x96, 0xcc, 0xca, 0x5a, 0xb4, 0x7e, 0xfb,
+			0x9d, 0x56, 0xcc, 0x08, 0xdc, 0x87, 0x41, 0x5f,
+			0xaf, 0x9b, 0xb8, 0xc1, 0x4b, 0x1e, 0x33, 0x42,
+			0x92, 0xc1, 0x59, 0xd4, 0x32, 0xb6, 0x29, 0x66,
+			0x60, 0xc6, 0xb3, 0x06, 0xba, 0xfb, 0x6e, 0x4c,
+			0x22, 0x7f, 0x38, 0x53, 0xbf, 0x2b, 0xdf, 0xa4,
+			0x5d, 0x86, 0x02, 0x16, 0xae, 0x28, 0x14, 0xd8,
+			0x05, 0xf3, 0x8c, 0x91, 0x94, 0x34, 0x35, 0x86,
+			0xfb, 0x25, 0xa4, 0xe8, 0x67, 0x1c, 0x53, 0x89,
+			0xa0, 0xb2, 0x40, 0xcb, 0x49, 0xf0, 0xa7, 0xee,
+			0xfb, 0x18, 0xac, 0x01, 0xfc, 0x67, 0xc9, 0xae,
+			0x52, 0xaf, 0x4c, 0x30, 0x71, 0x34, 0x73, 0x13,
+			0x24, 0xdb, 0xbf, 0xcf, 0x50, 0x86, 0x12, 0xc2,
+			0xe8, 0x4e, 0x48, 0x31, 0x1d, 0x44, 0xc1, 0x7b,
+			0x9a, 0x80, 0x87, 0xef, 0xab, 0x22, 0xcf, 0xff,
+			0xeb, 0x3e, 0xe5, 0x66, 0x4c, 0xe1, 0xe9, 0x31,
+			0xf3, 0x91, 0x63, 0x14, 0xd3, 0x2a, 0x4b, 0x2b,
+			0x32, 0x16, 0x6b, 0x86, 0xfb, 0x4a, 0x87, 0x25,
+			0xe1, 0x9c, 0x71, 0x9c, 0x51, 0x82, 0x03, 0x41,
+			0x6a, 0x5e, 0x58, 0x8c, 0x34, 0x64, 0xe1, 0xd0,
+			0xa1, 0xf9, 0xdb, 0x27, 0x16, 0xd1, 0x36, 0x8e,
+			0x63, 0x08, 0x11, 0x08, 0xa1, 0x4a, 0x16, 0x8b,
+			0x61, 0xe8, 0x5f, 0xed, 0x01, 0x3e, 0xb7, 0x72,
+			0xc5, 0x17, 0x34, 0xac, 0x74, 0x76, 0x98, 0x1d,
+			0xb3, 0x82, 0xf2, 0xd9, 0xdb, 0xc7, 0xc6, 0x5c,
+			0x3c, 0x7c, 0x63, 0x07, 0x74, 0x49, 0x1d, 0x6f,
+			0x0c, 0xb7, 0xaa, 0xda, 0x05, 0xc5, 0xea, 0x53,
+			0x0b, 0x20, 0x08, 0xb3, 0x94, 0x74, 0x8c, 0x9c,
+			0x4f, 0x8a, 0xfc, 0xc4, 0xa5, 0x41, 0x74, 0xd3,
+			0x3d, 0xdc, 0x78, 0x44, 0x50, 0x62, 0xba, 0x56,
+			0x0d, 0x30, 0x41, 0x53, 0x7d, 0x28, 0x70, 0x85,
+			0x24, 0x14, 0x53, 0xb1, 0x62, 0x62, 0xb5, 0xc5,
+			0xf4, 0xae, 0x74, 0x13, 0x63, 0x56, 0xdd, 0xd6,
+			0xac, 0x8b, 0x96, 0xa5, 0xda, 0x64, 0xd1, 0xea,
+			0x28, 0x2a, 0xd5, 0xc2, 0x2e, 0x6b, 0xd7, 0xab,
+			0xc9, 0x5a, 0xaa, 0xb8, 0xd5, 0x9f, 0x0a, 0x9b,
+			0xf3, 0xa5, 0x4d, 0xa9, 0xc8, 0xbf, 0x85, 0x80,
+			0x54, 0x8d, 0x3c, 0x45, 0xe2, 0x99, 0x57, 0x15,
+			0xb1, 0x28, 0x98, 0x46, 0x34, 0xc3, 0x9b, 0x98,
+			0x0c, 0xd9, 0x48, 0xc4, 0xf6, 0xdb, 0xd4, 0x2d,
+			0x82, 0x93, 0xa5, 0xa9, 0xd9, 0x31, 0x71, 0xaa,
+			0x3a, 0x8b, 0x51, 0xfd, 0x83, 0xad, 0x3e, 0x38,
+			0x52, 0xe1, 0xc0, 0x39, 0x17, 0x2b, 0x9d, 0xe8,
+			0xb2, 0x1f, 0xb7, 0xce, 0x07, 0x81, 0xb2, 0x07,
+			0xe3, 0x7b, 0xb9, 0x76, 0x0f, 0xd2, 0xc3, 0x86,
+			0x78, 0xa0, 0xb4, 0x82, 0x85, 0xa5, 0x6b, 0x84,
+			0xbd, 0x50, 0xe5, 0x80, 0xdc, 0x45, 0x36, 0xf0,
+			0x7f, 0x0f, 0xc9, 0x11, 0x0c, 0x43, 0xf2, 0xc9,
+			0x7e, 0x95, 0x9f, 0x60, 0xdd, 0xa9, 0xf5, 0x7c,
+			0xd8, 0x96, 0x21, 0x8e, 0xe0, 0x03, 0xe6, 0x03,
+			0x39, 0xc9, 0xb8, 0x4d, 0x27, 0x19, 0x39, 0xdc,
+			0xdc, 0x8e, 0x27, 0x71, 0x70, 0x82, 0x78, 0xeb,
+			0x4c, 0x9b, 0x75, 0x5e, 0xfc, 0x66, 0xc8, 0x8b,
+			0x00, 0x1f, 0x67, 0xbb, 0x26, 0x7b, 0xb3, 0x16,
+			0x7d, 0x91, 0x43, 0x65, 0x42, 0x93, 0x1e, 0xef,
+			0x30, 0x4e, 0xdc, 0x56, 0x8e, 0xc8, 0x46, 0xff,
+			0xee, 0xd6, 0xe6, 0xb2, 0x58, 0x2b, 0xf9, 0x09,
+			0x3d, 0x4a, 0xe0, 0x30, 0x5d, 0xc8, 0x3d, 0x6e,
+			0xd9, 0x3d, 0x96, 0x36, 0x55, 0xb4, 0xaf, 0x6a,
+			0xef, 0x63, 0x2c, 0x21, 0xfd, 0x51, 0x85, 0x6b,
+			0xae, 0x13, 0xf4, 0x22, 0x09, 0x4f, 0x4f, 0xd1,
+			0x4d, 0xb5, 0xc8, 0xf3, 0x40, 0x2b, 0x57, 0x9a,
+			0x19, 0x36, 0xb6, 0xfa, 0x1e, 0x07, 0xac, 0x36,
+			0x39, 0x9d, 0x2b, 0x40, 0xc1, 0xb1, 0x3a, 0xff,
+			0xcc, 0x55, 0xdc, 0x6d, 0xb7, 0x8c, 0xd2, 0x33,
+			0x5a, 0xc7, 0x5f, 0x9b, 0xd0, 0xea, 0xce, 0x61,
+			0x3e, 0x17, 0xf1, 0x0f, 0xe9, 0xe0, 0x0c, 0xee,
+			0x78, 0x81, 0x2d, 0x43, 0x6c, 0xd6, 0xaa, 0x7a,
+			0x01, 0x8f, 0xf6, 0xbb, 0x9c, 0x02, 0x02, 0x55,
+			0x34, 0x33, 0xc7, 0xab, 0xbd, 0xc0, 0x84, 0xea,
+			0x0a, 0x1b, 0xb3, 0x75, 0x69, 0xb2, 0x7b, 0x2d,
+			0x1b, 0x41, 0xa2, 0xb7, 0xb1, 0x2d, 0x4f, 0xb7,
+			0xa7, 0xcc, 0x8f, 0x30, 0xeb, 0x53, 0xc0, 0x7c,
+			0xde, 0xbe, 0x4b, 0x2a, 0xbd, 0xd8, 0x99, 0x0d,
+			0x2b, 0x1b, 0x4d, 0x92, 0x53, 0xd1, 0xe8, 0x42,
+			0x9c, 0xfc, 0x0e, 0xea, 0xea, 0x91, 0xe1, 0x15,
+			0x6e, 0x5e, 0x4c, 0xbd, 0x93, 0x5b, 0xb0, 0x3d,
+			0x4d, 0xc9, 0x32, 0xea, 0xa3, 0xd7, 0xa2, 0x52,
+			0x74, 0x70, 0x26, 0xb1, 0x82, 0xb8, 0xc4, 0x14,
+			0xe5, 0x9f, 0x11, 0x95, 0x96, 0xca, 0x63, 0x10,
+			0x06, 0x90, 0x3b, 0x2e, 0xcd, 0x16, 0x0f, 0xee,
+			0x1d, 0x41, 0x24, 0xbf, 0x68, 0x32, 0x55, 0x94,
+			0xf0, 0x35, 0x17, 0xaf, 0x00, 0xc9, 0x6b, 0x87,
+			0x70, 0xe5, 0x07, 0x82, 0x28, 0x1b, 0xf5, 0x86,
+			0x4f, 0x3c, 0xe9, 0x0b, 0xd9, 0x53, 0x95, 0xb3,
+			0x7a, 0x86, 0x88, 0xd1, 0x43, 0xcc, 0x23, 0xda,
+			0xa9, 0xcb, 0xff, 0x36, 0x67, 0x47, 0x48, 0x01,
+			0xe0, 0x8f, 0xab, 0x08, 0x5b, 0x8b, 0x97, 0x0e,
+			0x01, 0x81, 0x07, 0xfe, 0xe9, 0xd5, 0xf7, 0xf2,
+			0x81, 0x20, 0x2d, 0x2a, 0xcb, 0xef, 0x80, 0xa9,
+			0x42, 0xc4, 0x82, 0x4d, 0xce, 0x9d, 0x6f, 0x3f,
+			0x9b, 0x8e, 0xd1, 0x12, 0x76, 0xa5, 0xaf, 0x82,
+			0x31, 0x92, 0x85, 0xfc, 0xf4, 0x3b, 0xc4, 0x8a,
+			0xca, 0x37, 0xa8, 0x49, 0x1e, 0x7c, 0xed, 0x7b,
+			0x4b, 0xc3, 0x8a, 0x7f, 0x73, 0x2e, 0xc6, 0x9b,
+			0x55, 0xa1, 0xd6, 0xfa, 0x41, 0x70, 0xf8, 0x47,
+			0x3c, 0x89, 0x68, 0xd8, 0xd0, 0xea, 0xc2, 0x88,
+			0xad, 0x35, 0xd3, 0x43, 0x08, 0xa0, 0x6a, 0x83,
+			0x1e, 0x2a, 0x25, 0xab, 0x79, 0x41, 0x65, 0x23,
+			0xec, 0xa3, 0xf7, 0x37, 0xc6, 0x32, 0xd2, 0xa2,
+			0xb8, 0x15, 0x98, 0xf9, 0x26, 0x1b, 0xb3, 0x07,
+			0x4c, 0x42, 0x15, 0x72, 0xb2, 0x8f, 0xb2, 0x44,
+			0xf3, 0x77, 0x81, 0x38, 0xb4, 0xe6, 0x10, 0x15,
+			0x48, 0x53, 0x9a, 0xfd, 0xdd, 0x19, 0x9d, 0x83,
+			0x38, 0x19, 0xd7, 0xbf, 0xd3, 0xcd, 0xa3, 0xbd,
+			0xf3, 0x67, 0xd2, 0x2f, 0x71, 0xcf, 0x2d, 0x6d,
+			0x9b, 0x87, 0x28, 0xf9, 0x0c, 0x16, 0x84, 0xc9,
+			0x23, 0xe5, 0x44, 0x55, 0x91, 0xe6, 0x66, 0xd2,
+			0x72, 0x14, 0x26, 0x93, 0xcf, 0xb4, 0xd7, 0xa0,
+			0x8a, 0xc4, 0x6f, 0x19, 0x7a, 0x34, 0x9e, 0x38,
+			0x09, 0x79, 0x9d, 0x98, 0x25, 0xd7, 0x56, 0x9f,
+			0x4d, 0x2c, 0x5d, 0x16, 0x4f, 0x8b, 0x97, 0x2e,
+			0xd8, 0xd9, 0x80, 0x3f, 0xa4, 0x15, 0x9f, 0xb4,
+			0x3f, 0x81, 0xd3, 0x84, 0x7d, 0x8a, 0x7e, 0x7b,
+			0x08, 0xaa, 0x96, 0x9a, 0x77, 0x46, 0x5f, 0x19,
+			0x08, 0x14, 0xbb, 0xdd, 0xd9, 0x1c, 0xbe, 0x2c,
+			0xa4, 0x8a, 0x6d, 0xde, 0xe2, 0x00, 0xe0, 0x6a,
+			0xfc, 0x18, 0x77, 0x2d, 0x9e, 0x8b, 0x9b, 0xbb,
+			0xc5, 0x70, 0x4e, 0x9c, 0x12, 0x7f, 0xa8, 0x1b,
+			0xfc, 0x75, 0x51, 0x9e, 0x7a, 0x1b, 0xd4, 0xcc,
+			0xb3, 0xaa, 0xfc, 0x30, 0xde, 0xa5, 0x21, 0x0d,
+			0x72, 0x28, 0xc1, 0x2a, 0x59, 0xd0, 0xc9, 0xf3,
+			0x32, 0xe5, 0x7f, 0xbf, 0x8c, 0x5c, 0x8b, 0xc1,
+			0xe6, 0x98, 0x30, 0xd2, 0xbf, 0x9e, 0x41, 0x06,
+			0x22, 0x56, 0x5e, 0x98, 0x6e, 0x35, 0x63, 0x30,
+			0x6c, 0x4a, 0x86, 0xea, 0xc6, 0x3a, 0xd3, 0x12,
+			0x42, 0xb3, 0xa3, 0xa2, 0xdd, 0xb1, 0xd7, 0x13,
+			0xcb, 0x94, 0xc0, 0xa2, 0xb6, 0x49, 0x9c, 0x83,
+			0x3b, 0x93, 0x07, 0xc7, 0x44, 0x66, 0xd1, 0x98,
+			0x30, 0xe5, 0x27, 0xe1, 0x49, 0xe5, 0x56, 0xce,
+			0x4c, 0x84, 0x62, 0x32, 0xa7, 0x9f, 0xca, 0xe5,
+			0x03, 0x9f, 0x87, 0x1d, 0x9b, 0x74, 0xaa, 0xed,
+			0x6d, 0x99, 0x84, 0x85, 0x87, 0xd8, 0xe7, 0xe0,
+			0x4e, 0x1a, 0x5d, 0xa8, 0xd6, 0x8e, 0xca, 0xe7,
+			0xbe, 0x06, 0x90, 0xe6, 0xde, 0x63, 0xf8, 0xfd,
+			0xbc, 0x41, 0x83, 0x0e, 0xc1, 0xad, 0xb4, 0x0a,
+			0xc7, 0xc5, 0x9c, 0x2c, 0xad, 0xec, 0x18, 0xe9,
+			0x76, 0x61, 0x07, 0xf0, 0xb3, 0xc1, 0x3e, 0x31,
+			0xe3, 0x0e, 0x1a, 0x64, 0x0d, 0xba, 0x9e, 0x72,
+			0xc2, 0xce, 0x36, 0x9d, 0x68, 0x46, 0x8f, 0x5c,
+			0x25, 0x9f, 0x7b, 0x59, 0x7c, 0xa2, 0x79, 0xd9,
+			0x5d, 0x9f, 0xf1, 0x6c, 0x9a, 0x4d, 0x11, 0xfa,
+			0xa1, 0xe2, 0xd9, 0x04, 0xd2, 0xe5, 0x39, 0xcb,
+			0x81, 0xc4, 0x9f, 0x54, 0xe1, 0x2f, 0x53, 0xa7,
+			0x09, 0xb8, 0x03, 0x5a, 0xdc, 0x01, 0xc4, 0xe5,
+			0x2f, 0x4c, 0xba, 0x64, 0x3f, 0x74, 0xcc, 0x9a,
+			0x93, 0x43, 0xf5, 0xb3, 0x0b, 0x68, 0xb4, 0x67,
+			0xd1, 0x31, 0xc8, 0x34, 0x77, 0xf8, 0x0b, 0x80,
+			0x46, 0x41, 0x9c, 0xb7, 0xf3, 0x6b, 0x9c, 0x50,
+			0x21, 0x43, 0x6d, 0xee, 0xad, 0xf9, 0xf5, 0xf7,
+			0x88, 0x62, 0xb9, 0xf0, 0xf1, 0x4e, 0xb6, 0xa4,
+			0x9e, 0xe2, 0x33, 0x84, 0x9d, 0x18, 0x7f, 0x2e,
+			0xba, 0xde, 0x08, 0x04, 0xcd, 0xfb, 0x91, 0x07,
+			0x73, 0xad, 0x0e, 0x80, 0x3c, 0xc6, 0x8b, 0x7e,
+			0x32, 0x2c, 0x10, 0xbd, 0xc1, 0xfe, 0x33, 0xff,
+			0x24, 0x35, 0x48, 0x38, 0x8d, 0x7c, 0xf7, 0x0e,
+			0xf3, 0x17, 0x08, 0xed, 0xb0, 0x00, 0x46, 0x80,
+			0x52, 0x42, 0x69, 0xea, 0xb4, 0x81, 0x05, 0xa6,
+			0x40, 0x84, 0xa9, 0xe2, 0xca, 0x92, 0x1a, 0xcd,
+			0xfb, 0xfa, 0x7b, 0x8e, 0x23, 0x3a, 0x2c, 0x41,
+			0x19, 0x18, 0x40, 0x1e, 0xba, 0xd5, 0x59, 0xd2,
+			0x6c, 0x22, 0xf8, 0x74, 0x5f, 0x16, 0x5e, 0x20,
+			0x7f, 0xd9, 0x5c, 0xab, 0x0f, 0x28, 0x7d, 0x7f,
+			0x15, 0xad, 0x3a, 0x74, 0x15, 0x0c, 0x37, 0xe5,
+			0x8a, 0x55, 0xfb, 0xaa, 0x16, 0x40, 0x24, 0x71,
+			0x5a, 0x58, 0x26, 0x84, 0x43, 0xfb, 0xe3, 0xb8,
+			0x55, 0x77, 0x02, 0xf5, 0xc8, 0x59, 0xed, 0x1d,
+			0x5e, 0x1f, 0x2e, 0xab, 0xb8, 0x64, 0xec, 0x35,
+			0x81, 0xb4, 0xf4, 0x7a, 0x61, 0x67, 0xfe, 0x3d,
+			0x9e, 0x1a, 0xea, 0xef, 0xad, 0x8b, 0xbb, 0xbe,
+			0xe1, 0x66, 0x63, 0x47, 0x2c, 0xb1, 0x87, 0x26,
+			0x92, 0x2e, 0x14, 0x3f, 0x1d, 0xb8, 0x14, 0xbe,
+			0x86, 0xe5, 0x34, 0x50, 0xb3, 0xe7, 0xf8, 0x00,
+			0x42, 0x1c, 0xee, 0xa3, 0xef, 0xec, 0x94, 0xab,
+			0x6e, 0xae, 0x56, 0x05, 0x78, 0xb4, 0xbf, 0x1d,
+			0x8f, 0x6b, 0x4b, 0x50, 0x43, 0xa7, 0x07, 0x6b,
+			0x95, 0x8a, 0x59, 0x41, 0x8b, 0x24, 0xc7, 0x74,
+			0x49, 0x2b, 0x1f, 0x9d, 0xb5, 0xcc, 0x7c, 0x74,
+			0xda, 0x47, 0xa6, 0xbd, 0xbb, 0x42, 0x42, 0xfa,
+			0x1c, 0x8d, 0x66, 0x96, 0x6e, 0xe4, 0x1a, 0xc1,
+			0x49, 0xcf, 0xe2, 0x4c, 0xf2, 0xc3, 0x90, 0x18,
+			0xf2, 0xc5, 0x1a, 0xe7, 0xf2, 0x9f, 0x88, 0x54,
+			0xf2, 0xd9, 0xa6, 0xc6, 0x4e, 0x5e, 0x70, 0x5c,
+			0x02, 0xc8, 0x36, 0x0b, 0xed, 0xc4, 0x40, 0x20,
+			0xb3, 0x3b, 0x9b, 0x06, 0x99, 0x3d, 0xbe, 0xf1,
+			0x91, 0xc3, 0x89, 0x92, 0x19, 0x26, 0x73, 0x38,
+			0x19, 0x8e, 0x30, 0xf7, 0x9e, 0x0c, 0xc9, 0x6e,
+			0xca, 0xb2, 0x29, 0x52, 0xbd, 0x37, 0x3f, 0x54,
+			0xce, 0xfb, 0x67, 0xff, 0x47, 0x67, 0x68, 0xf4,
+			0x82, 0x06, 0xa2, 0x59, 0x48, 0x03, 0xaf, 0xaa,
+			0x2f, 0x5b, 0x21, 0x0c, 0x79, 0xa7, 0x39, 0x72,
+			0x81, 0x22, 0x33, 0x10, 0x2a, 0x2f, 0xb7, 0xd8,
+			0x68, 0x20, 0x55, 0xd3, 0x04, 0x65, 0xab, 0x08,
+			0xae, 0xd2, 0x84, 0xbe, 0x68, 0x70, 0xf8, 0xc3,
+			0xb5, 0xf0, 0x44, 0x83, 0x6d, 0x79, 0xba, 0xb7,
+			0x6a, 0xf6, 0x34, 0x73, 0x1a, 0x76, 0xa3, 0xda,
+			0x73, 0x30, 0x30, 0x35, 0xb1, 0xce, 0x63, 0x43,
+			0x9b, 0x84, 0x83, 0x24, 0xf4, 0xa4, 0x5f, 0x18,
+			0x4f, 0xc2, 0x4c, 0xf8, 0x97, 0x63, 0xa6, 0x6f,
+			0xf0, 0x2f, 0x37, 0x2b, 0x66, 0xff, 0x8e, 0x79,
+			0xaf, 0x77, 0x55, 0x2b, 0x17, 0x8b, 0x8e, 0xcc,
+			0x74, 0x19, 0x13, 0x2f, 0x2d, 0xc4, 0x10, 0xe9,
+			0xf3, 0x44, 0x18, 0x64, 0x19, 0x18, 0xa7, 0x60,
+			0x3a, 0xee, 0x0c, 0x23, 0x36, 0xad, 0xc2, 0x72,
+			0xec, 0x7f, 0xa0, 0xf6, 0xfc, 0xc1, 0x07, 0x6f,
+			0xad, 0x8e, 0x98, 0x1d, 0xea, 0x07, 0x46, 0xed,
+			0x9b, 0xa8, 0xd1, 0xe0, 0x47, 0x48, 0x1f, 0xc9,
+			0x09, 0xb9, 0xaf, 0x01, 0xdd, 0xe3, 0x19, 0x5b,
+			0x83, 0x89, 0xd7, 0xf5, 0x06, 0xc5, 0x33, 0xd5,
+			0x54, 0x0d, 0xfe, 0x66, 0x2f, 0x2b, 0x17, 0x5c,
+			0xb8, 0x9e, 0xcd, 0xd8, 0x9d, 0x1e, 0x06, 0x71,
+			0x3a, 0x2e, 0x86, 0x98, 0x73, 0x80, 0xc5, 0x53,
+			0xed, 0xea, 0x55, 0x46, 0xb3, 0xc2, 0xce, 0xbe,
+			0xc1, 0x63, 0x4a, 0x0e, 0x1a, 0x3a, 0xa4, 0xe1,
+			0x24, 0xbc, 0x67, 0x63, 0x84, 0x65, 0xc7, 0xef,
+			0x58, 0x2f, 0x2f, 0x46, 0x81, 0x4a, 0x53, 0x24,
+			0xeb, 0xb7, 0x70, 0x8b, 0x44, 0x18, 0xc4, 0x0c,
+			0x6b, 0x04, 0x68, 0x79, 0x8b, 0x7b, 0x84, 0xe4,
+			0x07, 0x88, 0xad, 0x19, 0xe2, 0xd8, 0x3c, 0xa3,
+			0xa8, 0x7a, 0xd6, 0xef, 0x18, 0x33, 0xa9, 0x24,
+			0x20, 0x67, 0xe7, 0xd1, 0x50, 0x3a, 0xda, 0xff,
+			0x47, 0xc4, 0x70, 0x54, 0xc5, 0x36, 0xa6, 0xa3,
+			0x02, 0x76, 0x52, 0x41, 0xa4, 0x1f, 0xbb, 0x75,
+			0x26, 0x64, 0xa9, 0x24, 0xe0, 0x7c, 0xdd, 0x1e,
+			0xee, 0x4e, 0xe6, 0x40, 0xd8, 0x31, 0x37, 0xb3,
+			0x81, 0xb2, 0x39, 0xc1, 0x8f, 0x79, 0xf4, 0x84,
+			0xa9, 0x02, 0x56, 0x1e, 0xd4, 0xab, 0xd0, 0x51,
+			0x7b, 0x7a, 0x1b, 0xdd, 0x37, 0xde, 0x69, 0x62,
+			0x7e, 0x9f, 0x94, 0xc0, 0xc9, 0x5b, 0x87, 0x7d,
+			0xf4, 0x18, 0x16, 0x90, 0x1c, 0x44, 0x14, 0x58,
+			0x59, 0xfe, 0x20, 0x94, 0x6b, 0x39, 0x9a, 0x06,
+			0x9b, 0x33, 0x0b, 0x20, 0x99, 0xd8, 0x31, 0xb8,
+			0x32, 0x72, 0xf3, 0xac, 0xe2, 0x34, 0xe2, 0x7c,
+			0xd8, 0x8d, 0xf5, 0xec, 0x2e, 0x16, 0x62, 0xbb,
+			0x95, 0x65, 0x2a, 0x4f, 0x8a, 0xa0, 0x16, 0xc0,
+			0x34, 0x04, 0x09, 0x7f, 0x8e, 0xbf, 0x5a, 0x5d,
+			0x66, 0xef, 0x09, 0x72, 0x89, 0x06, 0x23, 0x4b,
+			0x8a, 0xc0, 0x60, 0x62, 0x79, 0xdc, 0x22, 0xb6,
+			0xf8, 0x34, 0x8a, 0x52, 0xb8, 0x70, 0x4f, 0xaf,
+			0x8e, 0xca, 0x08, 0x71, 0xc7, 0xa4, 0x2f, 0x16,
+			0xc4, 0xde, 0xa1, 0x29, 0xcc, 0x10, 0xff, 0x6d,
+			0xfc, 0xfa, 0x1a, 0x88, 0x0c, 0x48, 0xd3, 0x1c,
+			0x70, 0x86, 0x7f, 0xc2, 0xd0, 0x52, 0xa1, 0xe5,
+			0x6d, 0x66, 0x80, 0x3a, 0x29, 0x48, 0x8e, 0x22,
+			0x3d, 0xf4, 0xdf, 0xbd, 0xd4, 0x8d, 0xfe, 0xba,
+			0x99, 0x8c, 0x08, 0x94, 0xdb, 0x13, 0xa4, 0x2f,
+			0x35, 0xcc, 0xa1, 0x9c, 0x4d, 0xb0, 0x80, 0x5b,
+			0x27, 0x2e, 0x75, 0x92, 0xa6, 0xb7, 0x51, 0x5f,
+			0xc3, 0x59, 0xcc, 0x30, 0xff, 0x65, 0x35, 0xfa,
+			0x7b, 0x49, 0x54, 0x1e, 0xaf, 0x04, 0xdd, 0x7b,
+			0xcb, 0x4f, 0x02, 0x20, 0x64, 0x88, 0x57, 0xa2,
+			0x15, 0x1d, 0x79, 0x4e, 0x04, 0xfc, 0x74, 0xef,
+			0x99, 0x03, 0xad, 0x7e, 0xe9, 0x39, 0x9a, 0x52,
+			0x83, 0xa6, 0x6b, 0x91, 0xd3, 0x9c, 0x38, 0x24,
+			0x34, 0x33, 0x74, 0xf7, 0xc4, 0x13, 0xc1, 0xd1,
+			0x7d, 0xa1, 0xa6, 0xe8, 0x67, 0x6a, 0x83, 0xca,
+			0x5c, 0x61, 0xad, 0xae, 0x54, 0x6d, 0x54, 0xb7,
+			0x29, 0x1c, 0x39, 0x0b, 0x0e, 0x96, 0x97, 0xb6,
+			0xb5, 0x50, 0x30, 0xa9, 0x32, 0x71, 0x07, 0xa7,
+			0x6d, 0xad, 0x41, 0x83, 0xf0, 0x75, 0x48, 0x02,
+			0x0a, 0x3b, 0x0b, 0xfe, 0x47, 0x90, 0xfe, 0x97,
+			0x06, 0x93, 0x26, 0xd7, 0xb4, 0x0d, 0xbb, 0x2a,
+			0x86, 0x54, 0xe4, 0x70, 0xd6, 0x80, 0xd4, 0x3a,
+			0x03, 0x7f, 0x1c, 0x81, 0x31, 0x01, 0x24, 0xc6,
+			0x5e, 0xed, 0xc3, 0x93, 0x87, 0xae, 0xc9, 0x20,
+			0x17, 0x36, 0x56, 0x46, 0x61, 0xbb, 0x3f, 0x4b,
+			0x78, 0xd0, 0x66, 0x56, 0xfb, 0x29, 0x15, 0xe3,
+			0x94, 0x23, 0xbe, 0x9b, 0x7b, 0x1f, 0xfa, 0x2e,
+			0xd1, 0xb3, 0xbc, 0x84, 0x78, 0x89, 0xb2, 0x8e,
+			0x37, 0x39, 0xf2, 0xaf, 0x53, 0xfc, 0x80, 0x0a,
+			0xd9, 0xfb, 0xe0, 0x45, 0xe4, 0x47, 0x2d, 0xbb,
+			0xe7, 0xe0, 0x81, 0xc0, 0xfc, 0xaa, 0x48, 0xec,
+			0x08, 0xda, 0xac, 0xb2, 0x0e, 0xb5, 0x83, 0x7c,
+			0xd9, 0xd1, 0x19, 0xe1, 0x79, 0x5f, 0xb7, 0xc9,
+			0x08, 0xff, 0xcd, 0xe4, 0x1e, 0xb9, 0xac, 0xa0,
+			0x1f, 0x92, 0x05, 0x52, 0x41, 0x8e, 0xc5, 0xc2,
+			0x34, 0x26, 0xfb, 0x59, 0x3c, 0x9c, 0x1c, 0x8c,
+			0x1e, 0x54, 0x0a, 0x88, 0x79, 0x9a, 0xa8, 0x7d,
+			0x47, 0x04, 0xc2, 0x16, 0xaa, 0xa0, 0x14, 0xd8,
+			0x36, 0xc0, 0x1e, 0xb4, 0xd8, 0xd9, 0x7a, 0xd5,
+			0x64, 0xc0, 0xee, 0xe4, 0x20, 0x8e, 0x66, 0xd8,
+			0xbb, 0x7f, 0x2d, 0x55, 0x3e, 0x63, 0x99, 0xbb,
+			0x84, 0x54, 0xfb, 0x71, 0xf9, 0xe3, 0x28, 0x2e,
+			0xd9, 0x74, 0x9a, 0x25, 0x88, 0x2b, 0xf5, 0xf5,
+			0x78, 0x67, 0x14, 0x46, 0x95, 0xb0, 0x1b, 0x36,
+			0x56, 0xcf, 0x32, 0x19, 0x36, 0x5f, 0x78, 0xc2,
+			0xf7, 0x0d, 0xa5, 0xc9, 0x81, 0xd3, 0xcd, 0x65,
+			0xb3, 0x26, 0xb6, 0xf0, 0x7f, 0x40, 0xd6, 0xc2,
+			0xf7, 0x0a, 0x20, 0x81, 0xe6, 0xfa, 0x9f, 0xf1,
+			0xc8, 0x5e, 0xe2, 0x98, 0x34, 0xb2, 0x37, 0x3e,
+			0xb4, 0xf1, 0x46, 0x63, 0xd9, 0x5d, 0x28, 0x30,
+			0xec, 0x0e, 0x76, 0xd3, 0xe2, 0x83, 0x9c, 0xeb,
+			0x77, 0xfd, 0xfa, 0x85, 0xea, 0x35, 0x94, 0xb9,
+			0xc7, 0x9c, 0xee, 0x47, 0x8f, 0xf3, 0x51, 0x47,
+			0xd5, 0x72, 0xff, 0x73, 0x84, 0x54, 0x48, 0x58,
+			0x27, 0x32, 0x2d, 0xb9, 0xd0, 0xf0, 0x70, 0x4d,
+			0x59, 0xc2, 0xc2, 0x36, 0xad, 0x19, 0xf8, 0x1d,
+			0x52, 0x3b, 0x13, 0xb2, 0xd7, 0x35, 0xac, 0xcf,
+			0x61, 0x8f, 0x20, 0x9a, 0xbf, 0xb2, 0x7d, 0x37,
+			0x07, 0xec, 0xd3, 0x35, 0x07, 0x28, 0xd5, 0xb0,
+			0x04, 0x3e, 0xa6, 0xd0, 0xee, 0x17, 0x82, 0x45,
+			0xa3, 0xe0, 0xf2, 0xe9, 0xd1, 0x09, 0xd4, 0x5c,
+			0xda, 0x55, 0x78, 0x8e, 0x28, 0x8c, 0x43, 0x2d,
+			0xc7, 0x16, 0x32, 0x36, 0x09, 0x97, 0x6b, 0x83,
+			0xed, 0x7e, 0x3d, 0x13, 0x84, 0x42, 0xd9, 0xa9,
+			0xf0, 0xa9, 0x9b, 0xe7, 0x92, 0xd6, 0xc3, 0x9d,
+			0x0f, 0x84, 0x86, 0x22, 0xba, 0x82, 0x59, 0xa6,
+			0x1c, 0x2d, 0x43, 0x55, 0x93, 0xa4, 0x3b, 0x76,
+			0xb4, 0x71, 0xb4, 0x49, 0x08, 0xa7, 0xee, 0x26,
+			0x63, 0xbc, 0x22, 0x91, 0xd5, 0x27, 0x3c, 0x0d,
+			0xff, 0x73, 0x50, 0x20, 0xe5, 0x28, 0xd9, 0xd0,
+			0xf5, 0x17, 0xb0, 0x57, 0x0b, 0x86, 0xb7, 0xfb,
+			0xee, 0x57, 0xd2, 0x85, 0x0a, 0xa0, 0x8e, 0x7b,
+			0x36, 0x5c, 0x90, 0xd7, 0x25, 0xb2, 0x84, 0x2e,
+			0xd7, 0x6c, 0xa3, 0x8e, 0xea, 0x52, 0xdc, 0x6b,
+			0xd4, 0xc5, 0x61, 0xd4, 0x12, 0x61, 0xc5, 0x84,
+			0x17, 0xb8, 0xd2, 0xec, 0x3a, 0xab, 0x20, 0x22,
+			0xd8, 0x20, 0x8e, 0xfd, 0xf3, 0x04, 0xcc, 0x4f,
+			0x04, 0x35, 0x15, 0x31, 0x96, 0xe9, 0xf8, 0xbd,
+			0x34, 0x70, 0xca, 0xa6, 0x50, 0x95, 0x56, 0x22,
+			0x1f, 0x8e, 0xfe, 0x40, 0x46, 0x04, 0x8c, 0x99,
+			0xfc, 0xcc, 0x00, 0x70, 0xe2, 0x51, 0x0f, 0x63,
+			0x63, 0x0e, 0xf4, 0xb1, 0x3d, 0xc9, 0x3e, 0xb3,
+			0xf3, 0x7b, 0x32, 0x03, 0xce, 0x22, 0xba, 0xc9,
+			0xbb, 0x1c, 0x07, 0xb7, 0xfa, 0xaf, 0x05, 0xe1,
+			0xda, 0xb5, 0x97, 0xd0, 0x9e, 0x11, 0xdb, 0x07,
+			0x29, 0x4f, 0x90, 0xcf, 0x9a, 0xa9, 0xd8, 0x7a,
+			0xc4, 0x2e, 0xb6, 0x86, 0x94, 0xb6, 0xf7, 0x5b,
+			0xf2, 0x35, 0x5f, 0xb3, 0x2d, 0xee, 0x70, 0x8e,
+			0x35, 0x77, 0x52, 0x65, 0xa4, 0x29, 0x4e, 0x54,
+			0xdd, 0x9e, 0x1f, 0x21, 0x2d, 0x5c, 0x54, 0x64,
+			0x8e, 0x48, 0x47, 0x8c, 0x73, 0x2b, 0x90, 0x12,
+			0x88, 0x0b, 0xfc, 0x01, 0x3d, 0x15, 0xff, 0x67,
+			0xb1, 0xed, 0x48, 0x15, 0xef, 0x1b, 0x42, 0xde,
+			0x0c, 0x40, 0x20, 0x8c, 0xf0, 0x0e, 0x23, 0x1f,
+			0xf2, 0x24, 0x12, 0xa6, 0x3f, 0x68, 0xa8, 0x7f,
+			0x79, 0xa9, 0x18, 0x62, 0x79, 0x09, 0x75, 0x44,
+			0xf2, 0xd5, 0xb4, 0xbc, 0x3b, 0xd1, 0x6c, 0xfa,
+			0x81, 0xf5, 0xb8, 0x63, 0x60, 0xd4, 0xc1, 0xc2,
+			0x64, 0x7c, 0x18, 0x53, 0x50, 0x61, 0x18, 0x41,
+			0x3e, 0x2b, 0x19, 0x83, 0x2a, 0x83, 0xc1, 0x05,
+			0x25, 0x31, 0x39, 0x11, 0xf1, 0x4c, 0x0b, 0x80,
+			0x0a, 0xcf, 0x24, 0xec, 0xdc, 0x9f, 0x4e, 0x28,
+			0x5e, 0x30, 0x06, 0x7a, 0xd0, 0x35, 0x68, 0x0d,
+			0x00, 0x93, 0x9b, 0x3d, 0x89, 0xe6, 0xc7, 0x5e,
+			0x41, 0x23, 0xa1, 0xde, 0x7e, 0xf9, 0xae, 0x37,
+			0xd7, 0x67, 0x40, 0xfe, 0x7b, 0xbf, 0xfe, 0x06,
+			0xef, 0x4e, 0xbd, 0xf9, 0x75, 0x6b, 0x3b, 0xc8,
+			0x44, 0xc6, 0x24, 0xea, 0x18, 0x66, 0x84, 0x02,
+			0x0d, 0x0a, 0x28, 0x51, 0xda, 0x07, 0xa5, 0xfb,
+			0xfd, 0x73, 0xbb, 0x91, 0x2e, 0xb7, 0x37, 0x38,
+			0x3a, 0x97, 0x2d, 0x5f, 0x8e, 0x4c, 0x0d, 0x94,
+			0x02, 0xef, 0xec, 0x23, 0xb4, 0xfa, 0x94, 0x94,
+			0xaf, 0x51, 0x29, 0x06, 0x55, 0xd7, 0x74, 0xf6,
+			0x03, 0x29, 0xe2, 0x3b, 0xcc, 0x42, 0x86, 0x23,
+			0xfe, 0x38, 0x4a, 0xf7, 0x88, 0x29, 0x4e, 0xea,
+			0x00, 0x11, 0x51, 0x04, 0x2f, 0x50, 0xab, 0xac,
+			0xa4, 0xb6, 0x24, 0xfb, 0x6b, 0xcd, 0x66, 0xd1,
+			0x01, 0x40, 0x50, 0x44, 0x28, 0x6b, 0xfe, 0x6d,
+			0x7f, 0x5d, 0x96, 0x83, 0xda, 0xab, 0xec, 0xe0,
+			0x19, 0x13, 0x06, 0x92, 0xfa, 0x40, 0xbf, 0xef,
+			0xa0, 0x04, 0x9e, 0x1a, 0x57, 0x6f, 0xb4, 0x41,
+			0x75, 0xb8, 0x48, 0x38, 0xcd, 0xa5, 0x50, 0xba,
+			0x14, 0xc0, 0x5f, 0x78, 0x95, 0x34, 0x47, 0x6e,
+			0x60, 0x43, 0x62, 0xb1, 0xa4, 0x42, 0x5a, 0x0e,
+			0xdc, 0xbe, 0xe2, 0x1a, 0x8b, 0xec, 0x85, 0xb2,
+			0x1d, 0x12, 0x59, 0x43, 0xa0, 0xf1, 0x92, 0x98,
+			0x8c, 0x18, 0x51, 0x85, 0x0c, 0xb0, 0x5d, 0x3c,
+			0x3b, 0x06, 0xa5, 0x66, 0xcf, 0xe6, 0x36, 0xb7,
+			0xaf, 0x78, 0x88, 0x3d, 0xa9, 0x48, 0x0e, 0x57,
+			0xf6, 0x0c, 0xe7, 0x54, 0xbb, 0x27, 0xe1, 0x3c,
+			0x20, 0xe6, 0x46, 0xed, 0x6e, 0x47, 0xb9, 0x88,
+			0xda, 0x86, 0xe8, 0xe6, 0xbd, 0xe2, 0xde, 0x29,
+			0xd8, 0x8c, 0x75, 0x8f, 0x7b, 0x10, 0xce, 0xb8,
+			0x01, 0xbc, 0xc5, 0x59, 0x48, 0xb2, 0x88, 0xf3,
+			0x96, 0x16, 0xb8, 0xb0, 0xc3, 0x68, 0x27, 0x00,
+			0xed, 0xb5, 0x0c, 0x57, 0x51, 0x59, 0xf7, 0xd7,
+			0x28, 0xa5, 0x2b, 0xf6, 0x4c, 0xc4, 0x2e, 0x60,
+			0x5b, 0x09, 0x04, 0x59, 0xb5, 0xd1, 0x14, 0xab,
+			0xff, 0xab, 0xa3, 0xe3, 0x2a, 0xe7, 0x4a, 0x2c,
+			0x58, 0x9e, 0xc1, 0x1e, 0x4c, 0x45, 0xba, 0xd0,
+			0xa0, 0x90, 0xd8, 0x47, 0x97, 0xa8, 0xe9, 0xf4,
+			0x7f, 0xe9, 0x84, 0xc0, 0xf3, 0x87, 0x5c, 0x8e,
+			0x3e, 0xef, 0x93, 0x07, 0x9c, 0x62, 0x1d, 0x13,
+			0x68, 0xb2, 0x35, 0x85, 0x1a, 0x98, 0x8b, 0xdf,
+			0x9f, 0x70, 0xe6, 0xa1, 0x38, 0x61, 0x8a, 0xc6,
+			0x98, 0x2f, 0xa2, 0x82, 0xad, 0xba, 0x06, 0xb7,
+			0xfb, 0x0c, 0x06, 0x38, 0x20, 0x5b, 0xe0, 0xfb,
+			0xd4, 0x46, 0xde, 0x9d, 0xf6, 0xde, 0x5f, 0x0d,
+			0xe6, 0x93, 0x9a, 0xff, 0x76, 0x3a, 0x46, 0x53,
+			0x25, 0xfe, 0x07, 0xb5, 0x1c, 0x40, 0xdf, 0x19,
+			0x81, 0x17, 0xf5, 0x5f, 0xee, 0x7a, 0x66, 0x07,
+			0x26, 0xea, 0x09, 0x6d, 0xb8, 0x3f, 0xc2, 0xc8,
+			0x02, 0x8a, 0x4f, 0x7c, 0x22, 0xfb, 0xb2, 0xf9,
+			0x21, 0x69, 0x55, 0x5f, 0x95, 0xcb, 0x79, 0xca,
+			0x3c, 0x05, 0x8e, 0x40, 0x22, 0x2d, 0xd6, 0x6b,
+			0x17, 0xab, 0x01, 0xf8, 0x35, 0x0e, 0xa6, 0xc4,
+			0x26, 0x1c, 0xe8, 0x64, 0x5b, 0x39, 0x91, 0x52,
+			0x5e, 0x8f, 0x3a, 0xff, 0xbf, 0xf3, 0x90, 0x1f,
+			0x85, 0xe1, 0xe8, 0xed, 0x75, 0xd2, 0x78, 0x05,
+			0xfc, 0x7b, 0xfc, 0xdf, 0x2d, 0x8b, 0x70, 0x5e,
+			0x04, 0x82, 0xe2, 0xf4, 0xa9, 0x20, 0xee, 0x21,
+			0xd0, 0xf7, 0xbe, 0x22, 0x83, 0xaf, 0x91, 0x35,
+			0x8c, 0x9f, 0x92, 0x63, 0x36, 0xc6, 0x49, 0xd1
+		},
+	}
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_TESTER_VECTORS_SHA2_128F_H */
@@ -0,0 +1,1063 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SPHINCS_TESTER_VECTORS_SHA2_128S_H
+#define SPHINCS_TESTER_VECTORS_SHA2_128S_H
+
+#include "fips_mode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lc_sphincs_test {
+	uint8_t seed[LC_SPX_SEEDBYTES];
+	uint8_t msg[33];
+	uint8_t pk[sizeof(struct lc_sphincs_pk)];
+	uint8_t sk[sizeof(struct lc_sphincs_sk)];
+	uint8_t sig[sizeof(struct lc_sphincs_sig)];
+};
+
+LC_FIPS_RODATA_SECTION
+static const struct lc_sphincs_test tests[] =
+{
+	{
+		.seed = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47
+		},
+		.msg = {
+			0xd8, 0x1c, 0x4d, 0x8d, 0x73, 0x4f, 0xcb, 0xfb,
+			0xea, 0xde, 0x3d, 0x3f, 0x8a, 0x03, 0x9f, 0xaa,
+			0x2a, 0x2c, 0x99, 0x57, 0xe8, 0x35, 0xad, 0x55,
+			0xb2, 0x2e, 0x75, 0xbf, 0x57, 0xbb, 0x55, 0x6a,
+			0xc8
+		},
+		.pk = {
+			FIPS140_MOD(0xb5), 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x6d, 0x2e, 0x59, 0x93, 0xd9, 0x19, 0xb7, 0xf2,
+			0x88, 0xcc, 0x82, 0x31, 0x33, 0x04, 0x6c, 0xf9
+		},
+		.sk = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x6d, 0x2e, 0x59, 0x93, 0xd9, 0x19, 0xb7, 0xf2,
+			0x88, 0xcc, 0x82, 0x31, 0x33, 0x04, 0x6c, 0xf9
+		},
+		.sig = {
+			0x46, 0x5f, 0xcb, 0xf6, 0x34, 0x87, 0xb1, 0x02,
+			0x9d, 0x01, 0x5f, 0x1d, 0x2d, 0xb2, 0xeb, 0x11,
+			0xed, 0xb2, 0x63, 0x0f, 0xf8, 0x26, 0xb3, 0x60,
+			0x8d, 0x97, 0x91, 0xfe, 0xea, 0xd7, 0x82, 0xc0,
+			0x4a, 0x07, 0x47, 0x2c, 0xf2, 0xa0, 0x71, 0x2b,
+			0x6f, 0xa8, 0xdb, 0x98, 0x20, 0x28, 0x32, 0x5b,
+			0x19, 0x1f, 0x05, 0x7e, 0x5b, 0xd7, 0x19, 0x5c,
+			0x3c, 0x7e, 0xe7, 0xd4, 0xe4, 0xa1, 0x31, 0x4e,
+			0x02, 0xb9, 0xd4, 0xc3, 0xc0, 0x47, 0xf4, 0x46,
+			0xce, 0x9d, 0xa2, 0xfc, 0xec, 0x19, 0xd7, 0xc0,
+			0x3d, 0xd2, 0x43, 0x1e, 0xd3, 0xc0, 0x3c, 0xd2,
+			0x68, 0x1a, 0xc2, 0x9d, 0x77, 0x63, 0xb9, 0x4e,
+			0x39, 0x88, 0x5d, 0xdd, 0x4d, 0x89, 0xbd, 0xe1,
+			0x46, 0x44, 0x22, 0xf6, 0xf2, 0x86, 0x5d, 0x40,
+			0x0c, 0x07, 0xd8, 0x15, 0xaa, 0x79, 0x2b, 0xc0,
+			0x34, 0x35, 0x4e, 0x41, 0xac, 0x16, 0xd2, 0xbc,
+			0xd7, 0x65, 0x21, 0xd4, 0x53, 0xd5, 0xb1, 0xe7,
+			0x9a, 0x30, 0x42, 0x8f, 0x86, 0x50, 0x59, 0xdb,
+			0xef, 0x2d, 0x53, 0x66, 0x2c, 0x59, 0x25, 0x4f,
+			0x99, 0xea, 0x01, 0x12, 0x7e, 0x59, 0xd0, 0x1a,
+			0xe2, 0x34, 0xaf, 0x04, 0xfc, 0x76, 0x64, 0xad,
+			0x00, 0x20, 0x0d, 0x4c, 0x0c, 0xeb, 0x9d, 0x3b,
+			0x91, 0x10, 0x81, 0xe5, 0x89, 0xf6, 0x59, 0xb0,
+			0xfc, 0x10, 0xfd, 0xac, 0x92, 0x0a, 0xa0, 0x28,
+			0x0b, 0x3d, 0xec, 0xaf, 0xf6, 0xe9, 0x2c, 0x5a,
+			0x8e, 0x20, 0x4a, 0x37, 0x32, 0x0c, 0x1f, 0x02,
+			0xe4, 0xe8, 0xc5, 0x6e, 0x3f, 0xd8, 0x44, 0x24,
+			0xb8, 0x0f, 0x5e, 0x5a, 0x57, 0x3f, 0x58, 0x6d,
+			0x81, 0x3b, 0x98, 0xd2, 0x27, 0xb8, 0x24, 0x65,
+			0x29, 0xb1, 0x25, 0x16, 0xf3, 0xac, 0x9c, 0xf0,
+			0x23, 0xf2, 0xaa, 0x0a, 0x54, 0x83, 0x10, 0xa9,
+			0x0c, 0x39, 0x48, 0x9c, 0x1c, 0x96, 0xca, 0x16,
+			0xe5, 0x39, 0x16, 0xfe, 0xa7, 0xb4, 0x11, 0x13,
+			0x0c, 0x3e, 0x34, 0x7e, 0xc2, 0x07, 0xcd, 0xe8,
+			0xda, 0x46, 0x2c, 0x62, 0xdb, 0xfd, 0x5c, 0x81,
+			0xf5, 0x06, 0x30, 0x11, 0xdc, 0x3a, 0x55, 0x52,
+			0x73, 0x3a, 0x6b, 0xed, 0x8d, 0xce, 0x74, 0xf5,
+			0x0e, 0x47, 0xcb, 0xa5, 0xc3, 0x5a, 0x10, 0x33,
+			0xc2, 0xba, 0x75, 0x4e, 0xe2, 0xbb, 0x8d, 0x71,
+			0x85, 0x3c, 0xa3, 0xd2, 0x87, 0xf8, 0x44, 0xdf,
+			0x39, 0xa3, 0x44, 0x9d, 0xc3, 0xe3, 0x68, 0x51,
+			0xcc, 0x84, 0xb6, 0x74, 0x1a, 0x7f, 0xb5, 0x33,
+			0x51, 0x1b, 0x8f, 0x2a, 0x15, 0x5d, 0x05, 0xa9,
+			0xdd, 0x3a, 0x06, 0x12, 0xab, 0xb5, 0x86, 0xd7,
+			0xba, 0x05, 0xa7, 0x45, 0x55, 0xf4, 0x0f, 0x56,
+			0xef, 0x69, 0xf9, 0xa3, 0xf3, 0xeb, 0x0c, 0x97,
+			0xec, 0x37, 0xa2, 0x4a, 0x4d, 0x1e, 0x75, 0x27,
+			0xff, 0xd5, 0x54, 0x38, 0xdc, 0x9b, 0xa8, 0xb2,
+			0xbc, 0x3e, 0x65, 0xf0, 0x5c, 0x69, 0xd7, 0x5e,
+			0xa1, 0xc1, 0x8f, 0x22, 0xa7, 0xbf, 0x8b, 0x48,
+			0x29, 0x1a, 0x2d, 0x83, 0x21, 0xe2, 0x4d, 0x49,
+			0x33, 0x1c, 0xd8, 0x7a, 0x16, 0x05, 0xb8, 0xfa,
+			0x51, 0x3c, 0x26, 0x10, 0x59, 0x21, 0x94, 0xb7,
+			0x75, 0x0a, 0x8b, 0xb6, 0x75, 0x14, 0xfc, 0x2a,
+			0x8a, 0x25, 0x91, 0x37, 0x54, 0xf3, 0xa9, 0xd1,
+			0xd2, 0x09, 0xd6, 0x09, 0xd4, 0x09, 0xfc, 0x68,
+			0x55, 0x52, 0x53, 0x85, 0x10, 0x6d, 0x1e, 0xce,
+			0x34, 0xb9, 0x54, 0xdc, 0x25, 0x27, 0xe5, 0xf9,
+			0xf0, 0x40, 0xa5, 0xbf, 0xfd, 0xb5, 0x92, 0x2c,
+			0xa0, 0xcc, 0x39, 0x12, 0x31, 0xc4, 0x31, 0xf9,
+			0x6e, 0xc5, 0x0e, 0x23, 0x71, 0xb4, 0x46, 0x20,
+			0x4f, 0x02, 0xc2, 0x5d, 0xff, 0x04, 0x76, 0x5f,
+			0x0e, 0x3d, 0x45, 0x7f, 0x1c, 0x0b, 0xb7, 0x6d,
+			0x20, 0x4e, 0x90, 0x04, 0x03, 0x65, 0xa7, 0xc4,
+			0x8f, 0x01, 0x76, 0xf5, 0x30, 0x36, 0x80, 0xb7,
+			0xdd, 0x8c, 0x3a, 0x58, 0x23, 0xd6, 0x13, 0x2e,
+			0x27, 0x7a, 0x8c, 0x86, 0xf7, 0x2f, 0x20, 0xce,
+			0x51, 0xe4, 0xd7, 0xdc, 0xd5, 0xb3, 0xdf, 0x92,
+			0x31, 0x3f, 0x15, 0x6c, 0x47, 0xed, 0xff, 0x59,
+			0xd6, 0xa0, 0x17, 0x24, 0x6b, 0xed, 0x3c, 0x82,
+			0xa3, 0x23, 0x30, 0xa8, 0x8f, 0x06, 0x98, 0xc7,
+			0x5f, 0x85, 0xf0, 0x51, 0xeb, 0x38, 0x82, 0xc5,
+			0xdd, 0x9a, 0x07, 0x6e, 0x89, 0x49, 0x0e, 0xb0,
+			0xc8, 0xce, 0xf8, 0x9e, 0x34, 0x56, 0xea, 0x43,
+			0x03, 0xa9, 0xc8, 0x51, 0x99, 0xd4, 0x3f, 0xf6,
+			0x58, 0xbb, 0x9c, 0x3b, 0xc6, 0xbb, 0x97, 0x64,
+			0x1c, 0x68, 0x25, 0xb6, 0xcc, 0xc3, 0x47, 0x37,
+			0x31, 0x32, 0x76, 0xd2, 0x97, 0x05, 0xf8, 0x82,
+			0x4f, 0x6c, 0xae, 0x19, 0xee, 0x8b, 0x7f, 0x53,
+			0x39, 0x6a, 0x71, 0x0e, 0x86, 0x9f, 0x49, 0x7e,
+			0x19, 0x3f, 0xa4, 0x73, 0x04, 0x8a, 0x53, 0x37,
+			0x3a, 0x4e, 0x17, 0xe0, 0x5f, 0xb1, 0x8f, 0xf3,
+			0x6c, 0xa3, 0xb4, 0xfc, 0x4b, 0x7b, 0x5d, 0x8f,
+			0x77, 0x9c, 0xc2, 0x5d, 0x2a, 0xee, 0xc2, 0x41,
+			0x67, 0x5a, 0x70, 0xdd, 0x62, 0x6b, 0x87, 0xcc,
+			0xac, 0x9c, 0xbb, 0x6f, 0x8e, 0x37, 0xf6, 0x15,
+			0xa8, 0xac, 0xf3, 0x65, 0x5b, 0x84, 0x7a, 0x6f,
+			0x97, 0xab, 0x98, 0x64, 0x69, 0xe6, 0x93, 0xb2,
+			0x85, 0x4c, 0x17, 0x45, 0x81, 0x12, 0x17, 0x4d,
+			0x1c, 0x91, 0x47, 0xba, 0x79, 0x4c, 0x74, 0xdb,
+			0x2a, 0xc9, 0x37, 0x3c, 0xf4, 0x89, 0x74, 0x99,
+			0xd3, 0x89, 0x8d, 0x00, 0x29, 0xac, 0x35, 0xc2,
+			0xf4, 0xe4, 0xdc, 0x66, 0x42, 0x27, 0x8d, 0xb7,
+			0xda, 0xbe, 0xd7, 0xaa, 0x8f, 0x33, 0x53, 0xd9,
+			0x32, 0xfe, 0x07, 0xc2, 0x83, 0x7d, 0x71, 0x4a,
+			0x31, 0xda, 0x3b, 0xf6, 0x35, 0xb7, 0xac, 0x9d,
+			0xe2, 0x73, 0x48, 0x9c, 0x29, 0x12, 0x6c, 0xab,
+			0xa3, 0x6d, 0x1d, 0x74, 0x5f, 0x10, 0x67, 0x2f,
+			0x9a, 0x7c, 0x28, 0x26, 0x6c, 0x18, 0x85, 0xf8,
+			0xea, 0x7e, 0xd2, 0x7e, 0x62, 0xf2, 0xea, 0x59,
+			0x64, 0x5c, 0x5f, 0x7e, 0xc5, 0xa5, 0xaf, 0x62,
+			0x3e, 0xbb, 0xf4, 0x48, 0x99, 0x6f, 0x18, 0xc3,
+			0xfd, 0xc1, 0x8d, 0xf8, 0x30, 0x33, 0x66, 0xee,
+			0x42, 0x1d, 0xdc, 0x28, 0xa7, 0x40, 0xc0, 0xc6,
+			0xf4, 0x21, 0xfe, 0x40, 0x63, 0xa4, 0x3a, 0xee,
+			0x32, 0xd0, 0x2f, 0x7c, 0xfe, 0x3e, 0x4c, 0x44,
+			0x6f, 0xa3, 0xd9, 0x49, 0xb7, 0x7a, 0xc7, 0x5f,
+			0xff, 0xdd, 0x1b, 0x5d, 0xa7, 0x75, 0xe1, 0xc0,
+			0xce, 0xb5, 0x31, 0x1e, 0x0a, 0xfe, 0x1f, 0xc7,
+			0x59, 0xe9, 0x4f, 0x04, 0x1d, 0xd8, 0x6b, 0xd9,
+			0x0f, 0xcd, 0x46, 0xe1, 0x70, 0x0d, 0x71, 0x2f,
+			0xdd, 0x28, 0xcc, 0x2b, 0x96, 0xf3, 0x45, 0x42,
+			0x88, 0x93, 0xea, 0x75, 0xe5, 0x35, 0x02, 0x13,
+			0x03, 0x1b, 0x9c, 0x82, 0x7f, 0xfc, 0xdb, 0xd4,
+			0x60, 0x2d, 0xea, 0xe2, 0x7a, 0x28, 0x42, 0x8a,
+			0x34, 0x47, 0x92, 0xca, 0x51, 0x76, 0xa9, 0x34,
+			0xf9, 0x98, 0x4b, 0x5f, 0x33, 0x02, 0x69, 0x9e,
+			0x20, 0x15, 0xf4, 0x83, 0x51, 0xb6, 0x4e, 0xb1,
+			0x78, 0x49, 0xc9, 0xa7, 0x84, 0xfb, 0x7c, 0xc6,
+			0xa4, 0x11, 0xfe, 0x1f, 0x80, 0xa5, 0x04, 0x2b,
+			0xab, 0x09, 0x74, 0xb0, 0xdf, 0x6d, 0x2c, 0x73,
+			0x0b, 0x45, 0x23, 0x76, 0x99, 0xb9, 0x7c, 0xa1,
+			0xa5, 0xba, 0x66, 0x27, 0xb9, 0x6c, 0x5c, 0xf4,
+			0xf8, 0x19, 0x72, 0xd6, 0xa8, 0x6d, 0x3d, 0xff,
+			0xc4, 0xa5, 0xd1, 0x0a, 0x3c, 0x77, 0x6a, 0x03,
+			0x4d, 0x29, 0xaa, 0xb1, 0x94, 0x7e, 0x54, 0x6a,
+			0xf2, 0x8a, 0xb2, 0xaf, 0x04, 0xc0, 0xb1, 0x3d,
+			0xd2, 0x5f, 0x90, 0xfc, 0x3d, 0x3d, 0xac, 0x51,
+			0x02, 0x46, 0xfc, 0xdc, 0xbe, 0x06, 0x3b, 0x50,
+			0x91, 0xb4, 0x93, 0x02, 0x29, 0x75, 0x00, 0x84,
+			0x1d, 0xb5, 0x6f, 0x65, 0x1f, 0x78, 0xbf, 0x76,
+			0xc3, 0xc5, 0x7d, 0x0c, 0xa2, 0x02, 0x20, 0x2a,
+			0x8a, 0xc1, 0x35, 0xbe, 0x60, 0xe5, 0x61, 0xba,
+			0xe9, 0x2e, 0x90, 0xac, 0x4e, 0xee, 0xd5, 0x1a,
+			0xb7, 0xc6, 0x77, 0xfa, 0x1c, 0x3a, 0x92, 0xeb,
+			0x99, 0x46, 0x98, 0xff, 0x78, 0x7d, 0xce, 0x5b,
+			0x53, 0x66, 0xbd, 0x0c, 0x0c, 0xde, 0x22, 0xf6,
+			0x94, 0x3a, 0xe7, 0xea, 0x7c, 0x9a, 0x63, 0x18,
+			0xbb, 0x61, 0x2b, 0x89, 0x55, 0x24, 0x7d, 0x80,
+			0x21, 0x1a, 0x46, 0x89, 0x9a, 0x89, 0xd8, 0xc1,
+			0xd0, 0x11, 0xd5, 0x5d, 0x8d, 0x71, 0xc2, 0x43,
+			0x4b, 0xf6, 0x96, 0xb8, 0x76, 0xce, 0x2f, 0xae,
+			0xa7, 0x73, 0xc0, 0x81, 0x8f, 0xa5, 0xc0, 0xd6,
+			0x33, 0xdd, 0xbd, 0x1c, 0x2c, 0x07, 0x9b, 0xfe,
+			0x7c, 0xf8, 0x11, 0x45, 0x84, 0x94, 0x56, 0x85,
+			0x0f, 0xcc, 0xfd, 0xc8, 0x27, 0xa1, 0x79, 0x80,
+			0x79, 0xed, 0x8e, 0xf4, 0xb4, 0xe5, 0x3a, 0x01,
+			0x92, 0xc5, 0x22, 0x71, 0xa9, 0x63, 0x62, 0x64,
+			0xae, 0xd7, 0x95, 0xca, 0xb0, 0x37, 0x47, 0x4f,
+			0xfe, 0x90, 0xb3, 0xc3, 0xc7, 0xd1, 0x6b, 0x79,
+			0xe6, 0x99, 0xcf, 0x8c, 0x1d, 0x12, 0xdc, 0xd0,
+			0x66, 0x68, 0x13, 0x86, 0x58, 0xb3, 0x1f, 0x02,
+			0xdb, 0x73, 0x4b, 0x17, 0x31, 0x09, 0x47, 0xa8,
+			0xd3, 0x25, 0x35, 0x2f, 0x9c, 0x8b, 0x6e, 0xad,
+			0x72, 0xaa, 0x9f, 0xd3, 0xf3, 0xb7, 0x34, 0x74,
+			0xb3, 0x6b, 0xfa, 0x66, 0x54, 0xee, 0x70, 0x77,
+			0x0b, 0x30, 0xd5, 0x38, 0xea, 0xdd, 0x19, 0x28,
+			0x0b, 0xe1, 0xe5, 0x43, 0xc4, 0x31, 0xfd, 0xd0,
+			0xb8, 0xc9, 0xf2, 0x22, 0x88, 0x85, 0x7a, 0x19,
+			0x92, 0x55, 0x2f, 0x80, 0xd7, 0x39, 0x47, 0xc6,
+			0xf9, 0xa0, 0x47, 0x5d, 0x7e, 0x14, 0xf3, 0xa6,
+			0x44, 0xec, 0xc0, 0xc2, 0x28, 0x41, 0xf3, 0x1d,
+			0x92, 0x4e, 0x9a, 0xe4, 0x5c, 0x04, 0xc5, 0x27,
+			0x35, 0x95, 0xfb, 0xeb, 0xa1, 0xc4, 0x31, 0xb4,
+			0x6d, 0x74, 0xf9, 0x58, 0xca, 0x68, 0xa6, 0x20,
+			0xed, 0x08, 0xb8, 0x6f, 0x82, 0xbc, 0xc9, 0x4d,
+			0xa0, 0x49, 0xc1, 0x12, 0x98, 0x05, 0xf9, 0x7d,
+			0xaf, 0x9a, 0xd9, 0x23, 0x0a, 0x93, 0x3a, 0xcf,
+			0x45, 0xbf, 0x63, 0xf5, 0x72, 0xf8, 0xc1, 0x42,
+			0xf1, 0xb0, 0x29, 0x51, 0xd7, 0x16, 0xd6, 0x20,
+			0xd0, 0x16, 0x7a, 0xf7, 0x4f, 0x43, 0x61, 0xac,
+			0x72, 0xbb, 0x3c, 0xcc, 0x02, 0x2e, 0x59, 0x9b,
+			0x2a, 0x5f, 0x9d, 0xc5, 0x95, 0x89, 0x09, 0x74,
+			0x41, 0x27, 0x58, 0xa2, 0x36, 0x9b, 0x24, 0x17,
+			0x9c, 0x60, 0xfa, 0x0d, 0x3c, 0xec, 0x53, 0xc9,
+			0x74, 0xc3, 0x28, 0x28, 0x93, 0x5f, 0xa2, 0x6a,
+			0xab, 0x03, 0x50, 0xc3, 0xa7, 0x4d, 0xdd, 0x83,
+			0xc0, 0x83, 0xfc, 0x9a, 0xb1, 0x5c, 0xe9, 0x9b,
+			0x4a, 0xd6, 0xd3, 0xf6, 0x6a, 0x2c, 0x91, 0x80,
+			0x4f, 0x6d, 0x96, 0xc9, 0xbf, 0x62, 0x5b, 0x98,
+			0xa5, 0x1a, 0x06, 0xcf, 0x9d, 0x47, 0x37, 0x26,
+			0x20, 0x30, 0x6e, 0x6e, 0xe5, 0x19, 0x30, 0x3e,
+			0xdc, 0x86, 0x62, 0x8e, 0x6d, 0xe8, 0xd6, 0xaf,
+			0xb6, 0xdb, 0x9c, 0xf2, 0x6c, 0xde, 0x10, 0x32,
+			0xe5, 0x28, 0xc3, 0x03, 0xd1, 0xf0, 0x92, 0x4b,
+			0x91, 0x47, 0x84, 0x76, 0x54, 0xe5, 0xa7, 0x32,
+			0xb1, 0xb0, 0x4b, 0xcd, 0x2e, 0xa3, 0xa6, 0xe6,
+			0xd3, 0x77, 0x80, 0x57, 0xcb, 0x22, 0x99, 0x7e,
+			0x10, 0xd4, 0x8d, 0x78, 0xaf, 0x81, 0x63, 0x90,
+			0x6e, 0x9e, 0xe6, 0xb4, 0x19, 0xe3, 0x26, 0xd1,
+			0xac, 0x79, 0x45, 0x55, 0xeb, 0x96, 0xe7, 0x96,
+			0xff, 0x38, 0x32, 0x2e, 0x24, 0xae, 0xf2, 0x99,
+			0x0b, 0x2b, 0xcc, 0x30, 0x83, 0xda, 0x5f, 0xe6,
+			0x2c, 0xa4, 0xa6, 0x40, 0x75, 0x6e, 0xaf, 0x4e,
+			0xb8, 0xb4, 0x07, 0xae, 0x83, 0xa0, 0x8f, 0xc5,
+			0xf9, 0xf6, 0xba, 0x39, 0x49, 0xf2, 0xc1, 0x6b,
+			0x3e, 0xcb, 0x4d, 0x1c, 0xe8, 0x13, 0x23, 0x87,
+			0xdb, 0xc0, 0x82, 0xe4, 0xf6, 0x1c, 0x0a, 0x1c,
+			0xde, 0x9a, 0x5d, 0x01, 0x2f, 0x29, 0x40, 0x3d,
+			0x2a, 0x9c, 0x35, 0x29, 0x5d, 0xdf, 0x9c, 0x34,
+			0x28, 0x74, 0xb8, 0xba, 0x3b, 0xaf, 0x22, 0x52,
+			0x88, 0x0c, 0x6c, 0x03, 0x99, 0x78, 0x4e, 0x79,
+			0x90, 0x43, 0xa0, 0xae, 0x60, 0x6c, 0x2e, 0x80,
+			0x80, 0x4f, 0x83, 0x1b, 0xa7, 0xb4, 0xd5, 0xbd,
+			0xef, 0xb5, 0xf0, 0xb3, 0x3e, 0x90, 0xc7, 0x3d,
+			0x3f, 0x20, 0xd1, 0x6e, 0xe1, 0x5c, 0x51, 0xfb,
+			0xbd, 0x76, 0x7f, 0x40, 0x64, 0xba, 0x1d, 0x12,
+			0xd7, 0xe7, 0xa9, 0x08, 0x01, 0x62, 0xf6, 0x84,
+			0xf5, 0xeb, 0xc5, 0xfc, 0x14, 0xd8, 0x0a, 0x0b,
+			0xee, 0x0e, 0x8d, 0xd8, 0xe8, 0x24, 0xc4, 0x25,
+			0x8a, 0x6d, 0xd6, 0x85, 0xa9, 0xb7, 0x5b, 0xd2,
+			0x16, 0x22, 0x43, 0xdd, 0x14, 0xa2, 0x45, 0xbd,
+			0x39, 0x5a, 0xec, 0xcb, 0x0f, 0x6e, 0x45, 0x42,
+			0xc7, 0xd2, 0x25, 0x3e, 0x94, 0x2e, 0xfa, 0xf6,
+			0x79, 0x87, 0xd3, 0xd9, 0xbc, 0x96, 0x2a, 0x2c,
+			0x9d, 0x3f, 0x58, 0x0f, 0xe9, 0xdb, 0xa9, 0x69,
+			0xa2, 0x17, 0x26, 0xa9, 0x92, 0x36, 0x46, 0xa0,
+			0xc4, 0x18, 0x3d, 0x11, 0xaf, 0x28, 0x89, 0xb5,
+			0xbd, 0x10, 0xc0, 0x45, 0x43, 0x8f, 0xab, 0x0c,
+			0xfc, 0xc3, 0xd8, 0xa9, 0xcd, 0x01, 0x2e, 0x9a,
+			0x24, 0xc8, 0xce, 0x9b, 0x42, 0x0a, 0x29, 0xf1,
+			0xed, 0xdb, 0xf7, 0x89, 0x58, 0xdd, 0xbe, 0xd8,
+			0xea, 0x5b, 0x80, 0xa6, 0x38, 0x31, 0x3d, 0xe3,
+			0x38, 0x8f, 0xc0, 0x60, 0x24, 0x7d, 0xdf, 0x78,
+			0x47, 0xe3, 0xd9, 0x11, 0x48, 0xf8, 0xa8, 0x33,
+			0x13, 0x5c, 0x95, 0x4f, 0x88, 0x40, 0x1f, 0x7f,
+			0xde, 0xc6, 0xbc, 0x25, 0xa5, 0xfd, 0x1d, 0x90,
+			0xe3, 0xc7, 0xb3, 0x91, 0xd6, 0xdd, 0x39, 0xed,
+			0x2a, 0xf3, 0x5f, 0xdb, 0x46, 0x6e, 0x1f, 0xbb,
+			0x8c, 0xe3, 0xdb, 0xd8, 0x42, 0x59, 0xc9, 0x6e,
+			0xa5, 0xd8, 0x16, 0x9b, 0xfb, 0x2a, 0x9b, 0xfb,
+			0x46, 0x2e, 0xcb, 0x03, 0xb5, 0xe6, 0x06, 0x7d,
+			0x75, 0x64, 0xe7, 0x4d, 0x80, 0xf5, 0x42, 0xe9,
+			0xf5, 0x2d, 0x5e, 0x7a, 0x08, 0xef, 0xb6, 0x57,
+			0xb2, 0x00, 0x4a, 0xf8, 0x96, 0xf1, 0xff, 0xc4,
+			0x8d, 0x1e, 0xa4, 0xe9, 0xa5, 0x1d, 0x10, 0x14,
+			0x2c, 0x63, 0x2e, 0xca, 0x6b, 0xab, 0xc3, 0x3f,
+			0x02, 0x35, 0x2c, 0x51, 0xe0, 0x2f, 0x1a, 0xca,
+			0x02, 0x7f, 0x47, 0x59, 0x3b, 0xd6, 0x22, 0x01,
+			0xe1, 0xda, 0x4f, 0xc4, 0xb2, 0x3d, 0xc6, 0xf2,
+			0x75, 0x7a, 0x89, 0x59, 0x85, 0x9c, 0xba, 0x87,
+			0xad, 0xbd, 0xb5, 0x82, 0x9a, 0x64, 0xcd, 0x38,
+			0x40, 0xd9, 0xb5, 0x4e, 0x3e, 0xa0, 0xc8, 0x8f,
+			0xa8, 0x4a, 0x5c, 0x43, 0x34, 0x51, 0x6a, 0xfd,
+			0x0e, 0x54, 0xc0, 0xc5, 0x87, 0xfc, 0x49, 0x60,
+			0x18, 0x12, 0xdf, 0xb0, 0x3d, 0x73, 0x52, 0x8f,
+			0xd2, 0x52, 0x3f, 0xec, 0x0b, 0xbc, 0xb9, 0xa6,
+			0xad, 0xe0, 0x69, 0xe8, 0xca, 0x51, 0xce, 0x8a,
+			0xbd, 0xc9, 0x64, 0xca, 0x7b, 0x04, 0x77, 0x19,
+			0xb2, 0xb7, 0x19, 0x83, 0x0f, 0xa8, 0xa7, 0x1e,
+			0xb6, 0x5b, 0xae, 0xdd, 0x37, 0xf7, 0xf4, 0x46,
+			0x4b, 0xfb, 0x64, 0x65, 0x8b, 0x69, 0x91, 0x33,
+			0x57, 0xa5, 0xd4, 0x0e, 0x48, 0x71, 0xe4, 0x16,
+			0x02, 0x86, 0x71, 0x00, 0x29, 0xd2, 0xb8, 0x9c,
+			0x15, 0x7e, 0xaf, 0x1c, 0x4b, 0x45, 0xb7, 0x63,
+			0xcc, 0x5e, 0x38, 0x42, 0xcd, 0x79, 0x8e, 0x46,
+			0x90, 0x07, 0x01, 0x32, 0xfd, 0xab, 0xc6, 0x3b,
+			0x46, 0xaa, 0x71, 0xa3, 0x2a, 0x5d, 0xb6, 0x29,
+			0xf6, 0x48, 0xf7, 0x1c, 0x4d, 0x05, 0xf4, 0xef,
+			0xdc, 0x90, 0xe9, 0x34, 0xdd, 0xf5, 0x60, 0xcb,
+			0x1d, 0x5f, 0xb8, 0x4b, 0x05, 0xc7, 0x7d, 0x3c,
+			0x8f, 0x20, 0xd0, 0x94, 0xd7, 0xef, 0xa4, 0xaf,
+			0xb1, 0x61, 0x6a, 0x83, 0xbf, 0xa8, 0x6d, 0xb7,
+			0x4c, 0x0f, 0x1f, 0x83, 0x08, 0x15, 0x65, 0xd8,
+			0x4e, 0xac, 0xdb, 0xc1, 0x48, 0x35, 0xf2, 0x5f,
+			0x3f, 0x97, 0x05, 0x5f, 0xd5, 0xc0, 0xd5, 0xa4,
+			0x79, 0x87, 0x3f, 0x4d, 0xb5, 0x2a, 0x15, 0x2c,
+			0x08, 0x2a, 0xd1, 0x5d, 0xe3, 0x85, 0x53, 0x44,
+			0x49, 0x21, 0x01, 0x84, 0xe8, 0x40, 0x7c, 0xb1,
+			0x35, 0x7b, 0x26, 0xa6, 0x73, 0x61, 0x14, 0xf3,
+			0x5a, 0x87, 0x7d, 0x0f, 0x63, 0x50, 0xf2, 0x87,
+			0xfc, 0x8c, 0xad, 0x87, 0x64, 0x27, 0x03, 0xe5,
+			0xb5, 0x81, 0xaa, 0x66, 0x89, 0x81, 0xcf, 0x27,
+			0xa3, 0xdd, 0x54, 0x9e, 0xee, 0x72, 0x07, 0x87,
+			0x76, 0xe9, 0x4d, 0xf7, 0xef, 0x65, 0x40, 0x33,
+			0x3e, 0x11, 0x22, 0x60, 0x8a, 0x33, 0x3e, 0x12,
+			0x94, 0x51, 0x7e, 0x26, 0x85, 0xf3, 0x38, 0x24,
+			0x01, 0xac, 0xf2, 0x4c, 0xd8, 0xb4, 0x56, 0xae,
+			0x57, 0x08, 0xf3, 0x4b, 0xbb, 0xa9, 0xe0, 0x22,
+			0x6a, 0x25, 0x5c, 0x85, 0x9c, 0x5f, 0xa2, 0xae,
+			0x48, 0x96, 0x98, 0x3e, 0x6b, 0xbd, 0x0a, 0x86,
+			0x3d, 0xff, 0xe2, 0x68, 0x0a, 0x39, 0x95, 0x32,
+			0x4a, 0xe6, 0xc4, 0x35, 0x15, 0x16, 0x8c, 0x8f,
+			0x29, 0xae, 0x7e, 0x32, 0x3b, 0x71, 0x83, 0x4a,
+			0xc0, 0x39, 0x69, 0xc1, 0xf7, 0x7b, 0x19, 0x6f,
+			0x6f, 0x52, 0x0c, 0x45, 0x98, 0xac, 0x68, 0x3c,
+			0xd0, 0xb2, 0x0f, 0x58, 0xff, 0x53, 0x19, 0x15,
+			0x3a, 0xc6, 0x98, 0x89, 0xa8, 0xcd, 0x6e, 0x90,
+			0x58, 0x9d, 0x15, 0xa5, 0xb1, 0xd5, 0xe1, 0x79,
+			0x60, 0xc2, 0xd4, 0x4d, 0x4f, 0xe4, 0x65, 0x16,
+			0x42, 0xc1, 0x4c, 0xeb, 0x40, 0x8b, 0x90, 0xad,
+			0x85, 0xbf, 0xb5, 0x5d, 0xb5, 0x28, 0x5b, 0x18,
+			0x7a, 0x18, 0xb2, 0x06, 0x76, 0x88, 0xb2, 0x63,
+			0x8c, 0x85, 0x04, 0x23, 0x79, 0xf5, 0xdc, 0xe5,
+			0x35, 0x05, 0x25, 0x08, 0x87, 0xd3, 0xda, 0x0a,
+			0xcd, 0xbd, 0xfc, 0xc9, 0x6e, 0x96, 0x24, 0x55,
+			0x36, 0xf7, 0xc0, 0x3b, 0x64, 0x26, 0x31, 0x0f,
+			0x87, 0x3f, 0xc2, 0x5b, 0x75, 0x0b, 0x88, 0xc1,
+			0x81, 0x00, 0x32, 0x26, 0x1d, 0x6c, 0xb8, 0x86,
+			0xa8, 0xdb, 0x88, 0xf0, 0x4c, 0x2e, 0x0f, 0xe9,
+			0x76, 0x73, 0xdd, 0x73, 0x08, 0x30, 0x58, 0xeb,
+			0xca, 0x3f, 0x8c, 0x93, 0x76, 0xc2, 0xc8, 0xc5,
+			0x83, 0xc4, 0x6a, 0xd2, 0x43, 0x21, 0xeb, 0x76,
+			0x88, 0x4d, 0x27, 0x8f, 0xd1, 0xab, 0xfc, 0xe4,
+			0x2b, 0x5a, 0xae, 0xda, 0x22, 0x93, 0x52, 0xef,
+			0x76, 0x2f, 0x92, 0xc0, 0x78, 0xd3, 0xf9, 0x09,
+			0xd9, 0xce, 0x05, 0x43, 0xce, 0x71, 0x47, 0x30,
+			0x74, 0x5f, 0xa6, 0xe2, 0x61, 0x12, 0x0a, 0xd6,
+			0xeb, 0x62, 0x9c, 0xbe, 0x96, 0x3e, 0xae, 0x95,
+			0xfd, 0x3e, 0x2c, 0x5b, 0x05, 0x01, 0x71, 0x79,
+			0x65, 0x5c, 0x53, 0x28, 0x20, 0xde, 0x54, 0xf6,
+			0x07, 0x6a, 0xc6, 0x8b, 0x3d, 0xc5, 0xec, 0x56,
+			0x4f, 0x38, 0x00, 0xb4, 0x4c, 0xa6, 0x9a, 0xcc,
+			0x63, 0x7a, 0xa0, 0x56, 0x60, 0xbb, 0xda, 0xa4,
+			0x3f, 0x1d, 0x94, 0x7e, 0x5c, 0x1e, 0x03, 0x35,
+			0x9a, 0xdd, 0x99, 0xbb, 0xf8, 0x60, 0xb5, 0x9e,
+			0x02, 0x96, 0x30, 0xd7, 0x18, 0xee, 0x37, 0xfa,
+			0x5c, 0x9c, 0x81, 0x04, 0x9f, 0xf8, 0x60, 0xaf,
+			0x48, 0xc7, 0x2b, 0xf7, 0x53, 0xf5, 0x3d, 0xa9,
+			0x79, 0x12, 0x60, 0x1b, 0x48, 0x90, 0x80, 0xa5,
+			0xbe, 0x37, 0x07, 0x1c, 0x88, 0xde, 0x45, 0x3d,
+			0x4b, 0xd7, 0x4e, 0x33, 0xf5, 0x23, 0xb7, 0x9c,
+			0x97, 0x1e, 0xe3, 0x16, 0xbc, 0xd1, 0xf9, 0xac,
+			0xb4, 0x40, 0xbc, 0xf0, 0x47, 0x81, 0xef, 0x24,
+			0x7f, 0x08, 0x33, 0x76, 0x7b, 0x07, 0x88, 0x71,
+			0x49, 0xb6, 0x9a, 0x24, 0x9a, 0x6d, 0xe0, 0xcf,
+			0xeb, 0x5c, 0x90, 0x01, 0x6e, 0x8a, 0x45, 0xab,
+			0x7f, 0x6c, 0xb5, 0x91, 0x99, 0xf4, 0xe3, 0x3a,
+			0x1e, 0x75, 0xf2, 0xe2, 0xe2, 0x54, 0xde, 0xce,
+			0x16, 0x6e, 0x7e, 0x79, 0x74, 0x3d, 0x42, 0x54,
+			0x96, 0x86, 0xc0, 0x3a, 0x7a, 0xda, 0x4e, 0xf2,
+			0x68, 0x23, 0x28, 0x00, 0xbf, 0xe8, 0xd9, 0x53,
+			0xeb, 0xe1, 0x66, 0x89, 0x16, 0x2c, 0xbe, 0xb7,
+			0xba, 0x2a, 0x46, 0xcb, 0xec, 0xf7, 0x78, 0x52,
+			0xfa, 0xb1, 0x34, 0x76, 0x44, 0x3b, 0xa6, 0x77,
+			0xc3, 0x8a, 0x01, 0x9e, 0x0d, 0x2d, 0x8b, 0xa3,
+			0x95, 0x42, 0xd2, 0xb5, 0x50, 0xb8, 0x1b, 0x72,
+			0xeb, 0xb3, 0x69, 0x70, 0xe0, 0xee, 0xa7, 0x43,
+			0x4a, 0x61, 0x06, 0x00, 0xcf, 0xeb, 0xa1, 0xc0,
+			0x81, 0x84, 0xf4, 0x67, 0x2c, 0x53, 0xd4, 0x80,
+			0x37, 0x96, 0xdc, 0x29, 0x60, 0xee, 0xd6, 0x19,
+			0x63, 0x2e, 0x66, 0xd2, 0xd3, 0xcc, 0x5f, 0xdc,
+			0x96, 0xdc, 0x1b, 0xd6, 0x1a, 0xbb, 0x6a, 0x89,
+			0x76, 0xa5, 0xfe, 0xe4, 0x13, 0x61, 0x29, 0x92,
+			0xae, 0x09, 0xfe, 0xdd, 0xe7, 0x73, 0x17, 0xac,
+			0x7d, 0x14, 0x07, 0x0e, 0xc8, 0xb3, 0x32, 0xed,
+			0xe2, 0xfa, 0x02, 0xe7, 0x91, 0xe7, 0x11, 0x91,
+			0xd4, 0xd5, 0xf7, 0x2b, 0x62, 0xb1, 0x2d, 0x6e,
+			0xbd, 0xd4, 0xde, 0x92, 0x34, 0x1f, 0xa7, 0x1c,
+			0x54, 0xb8, 0x2b, 0x16, 0xb3, 0x65, 0x2d, 0x9f,
+			0xe7, 0x27, 0x09, 0x7c, 0xb1, 0xd9, 0x85, 0x5c,
+			0xbe, 0x7c, 0x2b, 0xc7, 0xfe, 0xa5, 0x3f, 0x70,
+			0x54, 0x63, 0xde, 0x00, 0x55, 0x09, 0xda, 0xd2,
+			0x53, 0x8d, 0x8c, 0x3e, 0x30, 0xe5, 0xb7, 0x01,
+			0x2a, 0x43, 0x3a, 0x4a, 0x2e, 0xc4, 0xf8, 0xf4,
+			0x26, 0x8f, 0x3f, 0xfd, 0x2b, 0x63, 0x09, 0x23,
+			0xba, 0x2d, 0xf1, 0x69, 0x0b, 0x74, 0xb1, 0x3b,
+			0x36, 0x4d, 0xc3, 0xc2, 0xbc, 0xd2, 0x40, 0x81,
+			0xfa, 0x6c, 0x2c, 0xec, 0x5e, 0xd1, 0xe4, 0x26,
+			0x18, 0x2d, 0x66, 0x03, 0xc9, 0xc4, 0xc5, 0x4b,
+			0xa5, 0xcf, 0xfe, 0x27, 0x27, 0x60, 0xe3, 0xeb,
+			0x2b, 0xd7, 0x36, 0xf0, 0xfc, 0xe3, 0xa8, 0xec,
+			0xa1, 0x20, 0xbe, 0xb3, 0x2e, 0xaf, 0x62, 0xf9,
+			0x19, 0x9d, 0x80, 0xb9, 0xf7, 0xf3, 0x5e, 0x67,
+			0x4d, 0xb8, 0x9f, 0x62, 0x5a, 0x5d, 0x55, 0x23,
+			0xab, 0x8a, 0x24, 0xdc, 0x2b, 0xb1, 0x7e, 0xb7,
+			0xf8, 0x73, 0x59, 0xa6, 0xfe, 0x09, 0x56, 0x06,
+			0xf0, 0x84, 0x2a, 0xe9, 0xe8, 0xa2, 0x00, 0x70,
+			0x99, 0x7f, 0xde, 0x88, 0xcf, 0xae, 0xfd, 0x47,
+			0x61, 0x6e, 0xba, 0xd2, 0xee, 0x2c, 0xda, 0xad,
+			0xa1, 0xc5, 0x5c, 0x8d, 0x17, 0xc5, 0xa6, 0x26,
+			0x26, 0x32, 0xc4, 0x48, 0x3c, 0x41, 0xcc, 0x24,
+			0xd9, 0x5b, 0x15, 0xec, 0xc6, 0xab, 0xdc, 0xa7,
+			0x70, 0xae, 0xa2, 0x1e, 0x60, 0xe5, 0x79, 0x3f,
+			0x8e, 0x67, 0xb9, 0x72, 0x1f, 0xc4, 0xa6, 0x77,
+			0xb9, 0x54, 0x72, 0x63, 0x32, 0x4b, 0x3b, 0x86,
+			0xf2, 0xc6, 0x14, 0xc6, 0x36, 0xf0, 0x43, 0x20,
+			0xef, 0x8e, 0x12, 0xc0, 0x1e, 0x3a, 0x8b, 0xd9,
+			0x6a, 0x64, 0xa4, 0x4d, 0x4e, 0xb5, 0x37, 0xc7,
+			0x56, 0xba, 0xd8, 0x83, 0x4a, 0x94, 0xc1, 0x5f,
+			0x89, 0x3e, 0x05, 0x83, 0x9a, 0x5e, 0xeb, 0xbd,
+			0x1c, 0x64, 0xe8, 0xe3, 0x33, 0x72, 0xba, 0x95,
+			0x19, 0x04, 0x4a, 0xd2, 0xab, 0x54, 0xc7, 0x95,
+			0xed, 0x02, 0x99, 0x15, 0x62, 0xac, 0x60, 0x38,
+			0xd0, 0x83, 0x59, 0x19, 0xc2, 0xd8, 0xfa, 0x9d,
+			0xb0, 0x57, 0x93, 0x12, 0x73, 0xfd, 0xae, 0x8b,
+			0xa1, 0x48, 0x5f, 0x4e, 0x12, 0x04, 0x6e, 0x5d,
+			0xca, 0xde, 0x08, 0x62, 0xb3, 0xef, 0xbd, 0xe0,
+			0xa2, 0x22, 0x5c, 0x79, 0x7e, 0x28, 0xb5, 0x20,
+			0xa8, 0x12, 0x5f, 0xbf, 0x05, 0x39, 0x6f, 0xeb,
+			0x8f, 0x24, 0x79, 0x7a, 0x23, 0x2a, 0x8c, 0xaa,
+			0x96, 0x7d, 0x60, 0xe6, 0x8f, 0x63, 0x2e, 0xe9,
+			0x97, 0x2b, 0xa3, 0x7d, 0x9a, 0x86, 0xaa, 0x8f,
+			0x50, 0xee, 0xe1, 0x3f, 0xfe, 0x64, 0xa6, 0x64,
+			0x97, 0x04, 0x88, 0x36, 0xb2, 0x02, 0x95, 0x4f,
+			0xaa, 0x88, 0xaf, 0x6d, 0x80, 0xb9, 0x9f, 0x3d,
+			0x44, 0x0b, 0xc6, 0xbf, 0xcd, 0x99, 0x28, 0xe4,
+			0xbb, 0xdf, 0x79, 0x78, 0xd1, 0xae, 0x14, 0x0c,
+			0x93, 0xa8, 0x2a, 0x2e, 0x9a, 0x64, 0x98, 0x04,
+			0x47, 0xe0, 0x61, 0xc3, 0xc8, 0xe4, 0xad, 0xa9,
+			0xe2, 0xac, 0x23, 0x1f, 0x1e, 0x17, 0x39, 0xd1,
+			0x84, 0xa2, 0x68, 0x0e, 0x92, 0x16, 0x95, 0xfb,
+			0xf8, 0xdf, 0xfd, 0x36, 0x18, 0x97, 0x69, 0x29,
+			0x02, 0xc2, 0x7e, 0xd6, 0x0a, 0x35, 0x1b, 0xc0,
+			0x02, 0x42, 0x61, 0x70, 0x2a, 0x58, 0xa1, 0xe4,
+			0x4f, 0x18, 0x6d, 0xd6, 0x80, 0x12, 0x2f, 0xac,
+			0xce, 0x69, 0x86, 0x68, 0x3f, 0x97, 0x15, 0x88,
+			0x12, 0x23, 0x62, 0xd2, 0x15, 0xb2, 0xc2, 0xf8,
+			0xa4, 0x2a, 0x16, 0x21, 0xe6, 0x53, 0x85, 0x0b,
+			0x33, 0x7b, 0xa0, 0xf8, 0x32, 0x60, 0x30, 0xba,
+			0x15, 0xd2, 0xe1, 0x5b, 0xd0, 0xb4, 0x67, 0x34,
+			0x66, 0x1f, 0x0f, 0x84, 0x7d, 0x8e, 0xf6, 0xf3,
+			0xdc, 0x67, 0x53, 0x9b, 0x81, 0x2d, 0xa7, 0x91,
+			0x49, 0x33, 0xa4, 0xf9, 0x1c, 0x26, 0x4d, 0x2e,
+			0x36, 0x31, 0xef, 0x53, 0x68, 0x8f, 0xb0, 0xa9,
+			0xd7, 0x2c, 0x3b, 0xcc, 0x56, 0xb2, 0x7b, 0xb4,
+			0xa5, 0xca, 0xe2, 0x3d, 0xa5, 0x67, 0x3b, 0xbc,
+			0x79, 0xf9, 0x41, 0xa8, 0x06, 0xa1, 0xe9, 0x5d,
+			0x16, 0xe1, 0x1e, 0x25, 0x63, 0xb5, 0x0c, 0x3b,
+			0x1a, 0x74, 0xdd, 0xc3, 0xfa, 0x06, 0xe0, 0x48,
+			0xfb, 0x88, 0x84, 0x17, 0x5b, 0xbf, 0x0e, 0x80,
+			0x71, 0x96, 0xee, 0x86, 0xda, 0x32, 0x50, 0x9a,
+			0x07, 0x30, 0xfc, 0x0c, 0x94, 0xb7, 0x49, 0x8d,
+			0xa7, 0xd1, 0x7f, 0x85, 0xf7, 0xd4, 0xad, 0x38,
+			0xa2, 0x59, 0xd2, 0x3f, 0xa2, 0x6f, 0x5d, 0x4d,
+			0xdf, 0x96, 0x81, 0x7b, 0x57, 0xd7, 0xfa, 0x69,
+			0xe4, 0xd5, 0xd2, 0x14, 0xb6, 0xca, 0x30, 0xc0,
+			0xcf, 0x6b, 0xbd, 0xf2, 0x7f, 0xb6, 0x93, 0x30,
+			0x97, 0xba, 0x03, 0x27, 0xf2, 0x4e, 0xc9, 0x1b,
+			0xfd, 0xd0, 0x94, 0xaa, 0xeb, 0x37, 0x4c, 0x4f,
+			0xa8, 0xd8, 0xa3, 0x49, 0xc2, 0xdc, 0xa4, 0xb5,
+			0x78, 0xde, 0x2a, 0x6f, 0xc8, 0x8d, 0xeb, 0xec,
+			0x3c, 0x1f, 0xf9, 0x02, 0xdf, 0x86, 0xcc, 0x29,
+			0xb0, 0xaa, 0x9a, 0xf0, 0x48, 0x15, 0x9a, 0x73,
+			0xee, 0x75, 0x87, 0xcd, 0x10, 0x36, 0xb8, 0x6d,
+			0x35, 0xce, 0xa6, 0x7a, 0x04, 0x1e, 0xe1, 0x1e,
+			0x23, 0x0e, 0xd4, 0x58, 0x35, 0x9e, 0x93, 0x50,
+			0x18, 0xd6, 0x38, 0xa0, 0xcd, 0x19, 0xb6, 0x36,
+			0xdf, 0x78, 0x93, 0x5d, 0x71, 0x77, 0x18, 0xde,
+			0xbc, 0xc8, 0xa4, 0xc0, 0x45, 0xa1, 0xb0, 0x9e,
+			0x95, 0x64, 0x35, 0x07, 0x0d, 0xc5, 0x6e, 0x5c,
+			0xed, 0xb8, 0xb1, 0xf5, 0xa4, 0xd4, 0x78, 0x2d,
+			0x01, 0x90, 0x1c, 0xb9, 0xba, 0xef, 0x9d, 0x0e,
+			0xfc, 0x0a, 0xa0, 0x43, 0x6d, 0xf9, 0x17, 0x57,
+			0x68, 0xbb, 0x8c, 0x9b, 0x47, 0x74, 0x9c, 0xfa,
+			0x51, 0xc7, 0x98, 0x97, 0x99, 0x7e, 0xa4, 0x0f,
+			0xad, 0x6e, 0x1a, 0x21, 0x05, 0x0d, 0xf2, 0xcd,
+			0x02, 0xe6, 0x6c, 0x31, 0x30, 0xce, 0x82, 0xc8,
+			0x64, 0xa7, 0xb7, 0xfb, 0x4c, 0x92, 0x9c, 0xd8,
+			0xd7, 0x32, 0xd0, 0x52, 0xf5, 0x2b, 0xe1, 0x71,
+			0xa7, 0x08, 0xf2, 0xa4, 0x8c, 0x84, 0x6f, 0xfe,
+			0xf9, 0x80, 0xcb, 0x8b, 0xef, 0x42, 0xd0, 0x18,
+			0x68, 0x5e, 0x4e, 0x5d, 0xcf, 0x11, 0x43, 0xb6,
+			0xfc, 0x99, 0x3d, 0x55, 0xbb, 0x27, 0xfd, 0xf0,
+			0xbe, 0xa1, 0xb1, 0xc8, 0xba, 0x0a, 0x3c, 0x8f,
+			0x57, 0x22, 0x2f, 0xcd, 0x46, 0xc3, 0xe3, 0x9f,
+			0x9b, 0xeb, 0x36, 0x32, 0xff, 0xd5, 0xd9, 0x3e,
+			0x01, 0x71, 0xab, 0x34, 0x2e, 0xc3, 0x32, 0x50,
+			0x90, 0xed, 0x5b, 0x24, 0xcb, 0x7f, 0xd9, 0x10,
+			0xbe, 0x8a, 0xc3, 0x01, 0x8b, 0x8b, 0x2d, 0xd7,
+			0xcf, 0x22, 0x2d, 0x88, 0xa2, 0x69, 0xa6, 0x98,
+			0x5c, 0xec, 0xb7, 0xeb, 0xc3, 0x40, 0xe8, 0x30,
+			0x52, 0x96, 0x8e, 0xae, 0x81, 0x15, 0x73, 0x3c,
+			0xd5, 0xea, 0x43, 0x30, 0xe2, 0xc7, 0x12, 0x8c,
+			0xe0, 0x2d, 0xaf, 0x83, 0x34, 0x6e, 0x0e, 0x55,
+			0xa2, 0xe4, 0xd0, 0xde, 0x02, 0x33, 0x07, 0x51,
+			0xc0, 0x0c, 0x01, 0x98, 0x48, 0xf4, 0x9e, 0xd5,
+			0x1b, 0xdc, 0x29, 0x41, 0x6c, 0xf3, 0x1f, 0x36,
+			0x76, 0x51, 0xd2, 0x5d, 0x9e, 0x28, 0x2d, 0xcf,
+			0xc5, 0x62, 0x65, 0x09, 0x9f, 0xc9, 0x49, 0x7f,
+			0xa2, 0x7f, 0xf3, 0x56, 0x45, 0xe8, 0x52, 0x81,
+			0xee, 0xa3, 0x3c, 0x42, 0xe7, 0xaa, 0x8f, 0xb1,
+			0x8d, 0x45, 0xda, 0xd3, 0x75, 0xaa, 0x0c, 0xe3,
+			0xd8, 0xaf, 0xf1, 0x14, 0xf8, 0xb1, 0x43, 0x6c,
+			0xca, 0x0f, 0xea, 0x09, 0x0c, 0x2f, 0xb6, 0x62,
+			0xad, 0x5b, 0x5c, 0x46, 0x6a, 0x38, 0xb8, 0x35,
+			0x43, 0x3e, 0x51, 0x6e, 0x81, 0x8a, 0x81, 0xb7,
+			0xf2, 0x57, 0x4c, 0x8e, 0x88, 0x21, 0x6f, 0x9f,
+			0x55, 0xd2, 0xf3, 0x6e, 0xba, 0xa6, 0x4a, 0x8a,
+			0xc3, 0x7d, 0x94, 0xd3, 0x85, 0x8c, 0xa1, 0x46,
+			0x94, 0x2f, 0x87, 0xe1, 0x9c, 0xe0, 0xed, 0x29,
+			0x92, 0xd0, 0x7a, 0x5e, 0x9d, 0x37, 0x86, 0x4f,
+			0x8b, 0x1f, 0xa2, 0x21, 0x41, 0x07, 0x02, 0x7c,
+			0xb8, 0xa9, 0xed, 0x40, 0x07, 0x5a, 0x7d, 0x7a,
+			0x1d, 0x68, 0xc0, 0xe6, 0x60, 0x8e, 0xb0, 0xd3,
+			0x0e, 0x1d, 0x16, 0xdb, 0xc1, 0x0f, 0x94, 0x56,
+			0x51, 0xc7, 0xa8, 0x82, 0x6a, 0xc9, 0x5d, 0x1f,
+			0xa7, 0x7d, 0x02, 0x41, 0x06, 0x7c, 0x8c, 0x43,
+			0xca, 0x0c, 0x70, 0x82, 0x79, 0x54, 0x16, 0x1b,
+			0xd9, 0x5c, 0x1d, 0x22, 0x51, 0xe1, 0x77, 0x5e,
+			0x54, 0xde, 0x4d, 0xac, 0x31, 0xf3, 0x79, 0x53,
+			0xbe, 0xbf, 0x80, 0x28, 0x98, 0xfa, 0x12, 0x09,
+			0x12, 0x5c, 0xc8, 0x68, 0x5d, 0xd4, 0x1c, 0x4c,
+			0x38, 0x27, 0x51, 0xd3, 0xc9, 0x07, 0x6e, 0xdf,
+			0x89, 0xfa, 0x02, 0x19, 0xc5, 0xa0, 0x81, 0x5a,
+			0xad, 0xf2, 0x71, 0x23, 0x3a, 0x31, 0x44, 0x77,
+			0x90, 0xb2, 0x15, 0x9a, 0x66, 0x33, 0x32, 0xdd,
+			0xde, 0xed, 0xc6, 0xd5, 0x64, 0xd0, 0x04, 0xe3,
+			0xab, 0x73, 0x6e, 0x11, 0xbc, 0x76, 0xa5, 0xe0,
+			0x14, 0xde, 0xa0, 0xc9, 0x87, 0x74, 0xd7, 0x69,
+			0x5b, 0xa0, 0xdf, 0x3e, 0xf2, 0x22, 0xdd, 0x50,
+			0x15, 0xbf, 0x32, 0x3f, 0x26, 0xc5, 0x24, 0x88,
+			0x57, 0x01, 0xcc, 0xd0, 0x43, 0xe8, 0x96, 0xe3,
+			0xce, 0x42, 0x85, 0x8f, 0x51, 0x03, 0x62, 0x74,
+			0xdb, 0x94, 0x51, 0x43, 0xb3, 0xce, 0xb9, 0x4b,
+			0x53, 0x63, 0xea, 0x1d, 0x4a, 0xf1, 0x57, 0xe8,
+			0x71, 0x8c, 0x75, 0x67, 0x97, 0x8b, 0x81, 0x90,
+			0x95, 0xfc, 0x60, 0x35, 0x27, 0xce, 0xe0, 0x50,
+			0x3e, 0x8a, 0xc2, 0xcb, 0xd4, 0xfb, 0x4c, 0x93,
+			0x38, 0x82, 0x98, 0xd8, 0xcb, 0x6e, 0x69, 0x7b,
+			0x64, 0x63, 0x11, 0x5c, 0xc5, 0x23, 0x26, 0x9e,
+			0x7d, 0x99, 0x90, 0xf4, 0xc6, 0x20, 0x10, 0xe3,
+			0x2c, 0x66, 0xe4, 0x53, 0x13, 0xad, 0xaf, 0x28,
+			0x39, 0xcc, 0x68, 0x77, 0x57, 0x7d, 0xd7, 0xb0,
+			0xdc, 0x40, 0x8a, 0xca, 0x81, 0xfb, 0x63, 0x82,
+			0x75, 0xff, 0xc1, 0xd3, 0x6a, 0x75, 0x1b, 0xa7,
+			0xa5, 0xfa, 0xe1, 0xb7, 0xcc, 0x01, 0x8b, 0x4e,
+			0x89, 0xbe, 0x72, 0xb0, 0x98, 0xa4, 0x0c, 0xf4,
+			0x3f, 0xb8, 0x8f, 0x64, 0x5b, 0x5c, 0x20, 0xb1,
+			0x2e, 0x41, 0xf8, 0xe4, 0x2b, 0xe8, 0x56, 0x21,
+			0x54, 0x91, 0x84, 0x2d, 0x09, 0x4c, 0x1a, 0x93,
+			0xfa, 0xad, 0x8f, 0x2d, 0xdd, 0x51, 0xb8, 0x42,
+			0x6d, 0xe1, 0x07, 0x9f, 0xa2, 0xc0, 0x5f, 0xe7,
+			0x99, 0x6b, 0xc0, 0x18, 0x8a, 0x85, 0x13, 0x87,
+			0x71, 0x7a, 0xad, 0x10, 0x66, 0x1b, 0x1c, 0x00,
+			0x61, 0x9a, 0x8f, 0x32, 0x98, 0xf2, 0x8c, 0x58,
+			0x41, 0x2b, 0x6e, 0xfa, 0x72, 0x1b, 0x15, 0xb2,
+			0x78, 0x36, 0xdc, 0x62, 0x7a, 0x6c, 0x28, 0xe1,
+			0xf7, 0x8b, 0xee, 0xa1, 0xa9, 0x4d, 0x97, 0xda,
+			0x64, 0xac, 0xe5, 0x4f, 0xb0, 0x9f, 0x33, 0x30,
+			0xce, 0x60, 0x9c, 0x92, 0x8a, 0x32, 0x27, 0xd6,
+			0x0d, 0x8f, 0x0e, 0xbd, 0x28, 0x14, 0x16, 0x70,
+			0x5b, 0x83, 0x08, 0xe4, 0x62, 0x98, 0x3e, 0x08,
+			0x2f, 0x1d, 0x16, 0xca, 0x42, 0x6e, 0xb1, 0xc2,
+			0xe7, 0x75, 0xed, 0x5a, 0xb2, 0x98, 0xd1, 0x9e,
+			0x5d, 0x5c, 0xda, 0xca, 0x87, 0xad, 0x1a, 0x21,
+			0xb9, 0x6e, 0xc4, 0xaa, 0xc3, 0xd8, 0xfa, 0xe3,
+			0xd4, 0x88, 0xd0, 0xd9, 0x1e, 0x85, 0xab, 0x6a,
+			0xd4, 0xa3, 0x9e, 0x18, 0xe8, 0x4a, 0x0e, 0x95,
+			0xdd, 0xa9, 0xc4, 0x97, 0x61, 0x55, 0x20, 0x40,
+			0x1d, 0xdf, 0x0a, 0x70, 0xaf, 0xfb, 0xc7, 0xad,
+			0xc4, 0x16, 0x7c, 0xdd, 0x18, 0x44, 0xe1, 0x40,
+			0xd5, 0x4c, 0xbb, 0x03, 0x81, 0xd2, 0x26, 0xa5,
+			0x7c, 0x1c, 0x1c, 0x30, 0x5e, 0xac, 0x68, 0x49,
+			0x8d, 0xb9, 0x84, 0xe1, 0x62, 0x84, 0x20, 0x36,
+			0x51, 0x58, 0xdf, 0x09, 0xa3, 0x42, 0x22, 0x28,
+			0xa4, 0x18, 0xe7, 0x0d, 0xc8, 0xbb, 0x01, 0x6f,
+			0xd1, 0x21, 0x45, 0xa0, 0xcf, 0xd0, 0x31, 0xdb,
+			0xf3, 0xa0, 0x99, 0xea, 0x79, 0xd1, 0x51, 0xd6,
+			0x30, 0xf1, 0x92, 0x21, 0xf5, 0x15, 0x84, 0x8e,
+			0x25, 0x50, 0x09, 0x14, 0xf5, 0xda, 0x01, 0x3f,
+			0x27, 0xd5, 0xee, 0xf5, 0xa3, 0x3c, 0x79, 0x22,
+			0x87, 0xa1, 0xd7, 0x18, 0x53, 0x0f, 0x90, 0x2d,
+			0x79, 0x90, 0xb5, 0xe2, 0xb4, 0x45, 0xe1, 0xf2,
+			0x14, 0x19, 0x80, 0xbc, 0x5a, 0x54, 0x6e, 0x5d,
+			0xc2, 0x9b, 0xe8, 0xb6, 0x6f, 0x8d, 0x2f, 0x80,
+			0xe2, 0xca, 0xfc, 0xff, 0xd2, 0x1f, 0xb0, 0x3b,
+			0x41, 0xac, 0x14, 0x5a, 0xdb, 0x7a, 0x63, 0x5d,
+			0x77, 0x92, 0xfe, 0x3e, 0x4e, 0x07, 0x71, 0x20,
+			0x45, 0xb5, 0xa2, 0x5b, 0xd2, 0xf0, 0x18, 0xc0,
+			0x5d, 0x6b, 0x95, 0x45, 0xb8, 0xb2, 0x35, 0x8a,
+			0x67, 0x1a, 0xc0, 0x68, 0x7f, 0xab, 0x5f, 0xef,
+			0xef, 0x35, 0xf5, 0xfc, 0x45, 0x7a, 0xe9, 0x3d,
+			0x64, 0xe8, 0x88, 0x84, 0x9b, 0x19, 0x9b, 0x67,
+			0xb8, 0x2c, 0xa8, 0xbd, 0x96, 0x42, 0xc5, 0x10,
+			0x8f, 0x4f, 0x78, 0x46, 0x07, 0x3c, 0x7c, 0x85,
+			0x11, 0x41, 0xe6, 0x3b, 0x4c, 0xde, 0x03, 0x8c,
+			0xce, 0x9f, 0x12, 0x1e, 0xf0, 0x82, 0x18, 0x19,
+			0xcd, 0xc7, 0xb6, 0xbf, 0xcf, 0x74, 0x2b, 0x73,
+			0xb4, 0x6d, 0x2a, 0x6e, 0x74, 0x21, 0x55, 0x9e,
+			0x3c, 0x18, 0x48, 0x66, 0x8a, 0xb0, 0xa0, 0xfa,
+			0x83, 0xce, 0xc9, 0xc1, 0xb3, 0xa1, 0xb2, 0x22,
+			0x34, 0xdf, 0x3f, 0x06, 0x60, 0xe5, 0x57, 0x5e,
+			0x79, 0x73, 0x15, 0xe5, 0x7d, 0x99, 0xe6, 0xd1,
+			0x22, 0x49, 0x81, 0xf2, 0x17, 0x32, 0xde, 0x9c,
+			0xa2, 0xc3, 0xef, 0x00, 0xdd, 0x2a, 0xc5, 0x8c,
+			0x52, 0x3a, 0x7d, 0x72, 0x83, 0x65, 0x3b, 0x51,
+			0x11, 0xf7, 0x0b, 0xbd, 0x91, 0x54, 0xe5, 0x35,
+			0xcc, 0xa2, 0x27, 0x1d, 0x17, 0x7d, 0x1e, 0x97,
+			0x92, 0x56, 0x14, 0xdc, 0xef, 0x3a, 0x36, 0xba,
+			0x1a, 0x36, 0x33, 0x60, 0x35, 0x64, 0x0b, 0xd8,
+			0xff, 0x78, 0x3a, 0x4e, 0xd5, 0x7d, 0xff, 0x7a,
+			0x10, 0x6a, 0x80, 0xf4, 0x04, 0xd8, 0xe2, 0x4b,
+			0x79, 0xe9, 0x76, 0x7f, 0xcd, 0xda, 0x41, 0x0d,
+			0xd3, 0x7a, 0x5c, 0xae, 0xbb, 0x23, 0xaa, 0xee,
+			0xe2, 0xb2, 0xad, 0x0a, 0x06, 0xd3, 0x83, 0x7e,
+			0x20, 0x77, 0x57, 0xf2, 0xda, 0x13, 0x81, 0x9c,
+			0x40, 0xf2, 0xbf, 0x44, 0x3b, 0x07, 0x24, 0xd2,
+			0x26, 0x85, 0x3a, 0xe4, 0x44, 0xf0, 0xe9, 0x3b,
+			0xa1, 0xe8, 0xd8, 0x07, 0x08, 0x5d, 0x19, 0xa2,
+			0x27, 0xaa, 0x77, 0xee, 0xd3, 0x2f, 0x82, 0x95,
+			0xfc, 0x59, 0xb9, 0x68, 0xe7, 0x1c, 0xe3, 0xc6,
+			0x13, 0x85, 0xb9, 0x4d, 0xa8, 0xea, 0x89, 0x6d,
+			0xb2, 0xae, 0x15, 0x00, 0xd8, 0xe3, 0x08, 0x02,
+			0x39, 0x86, 0x3b, 0x82, 0x88, 0xc8, 0x99, 0x56,
+			0x26, 0xc1, 0xcf, 0xc8, 0xbc, 0x59, 0xfb, 0x5e,
+			0x55, 0x4b, 0x26, 0x1e, 0xbe, 0x03, 0xdf, 0x5d,
+			0x11, 0xee, 0x95, 0x01, 0x73, 0xd1, 0x5a, 0x40,
+			0x25, 0xc5, 0x4e, 0x97, 0xe9, 0x1b, 0x15, 0x44,
+			0x50, 0x3f, 0x90, 0xd3, 0xc9, 0xb9, 0xe3, 0xcc,
+			0x93, 0xdb, 0xed, 0x60, 0x38, 0x6c, 0xaf, 0xee,
+			0x9b, 0x73, 0x86, 0xce, 0x82, 0x10, 0xc2, 0xe4,
+			0x62, 0x99, 0x9b, 0x4f, 0x86, 0x8b, 0xa8, 0x65,
+			0x71, 0x23, 0x44, 0xd0, 0x38, 0x31, 0x8c, 0xa1,
+			0x04, 0xb8, 0x45, 0x4f, 0x93, 0x98, 0x57, 0x69,
+			0xf9, 0x9f, 0x66, 0xa6, 0x51, 0xf2, 0xa9, 0xbf,
+			0x98, 0x9e, 0x52, 0xde, 0x44, 0xdf, 0x93, 0x41,
+			0x6f, 0xfb, 0xd1, 0xf2, 0x2a, 0xa4, 0x9f, 0x0d,
+			0x7c, 0x04, 0x4e, 0x47, 0x96, 0xfb, 0xc6, 0x14,
+			0x5e, 0x44, 0x4a, 0xd8, 0x72, 0x81, 0xb3, 0x02,
+			0x7a, 0x71, 0x3a, 0x6f, 0x2b, 0x25, 0x2a, 0x2a,
+			0x8d, 0x39, 0xcc, 0x8a, 0x4e, 0x4e, 0x9f, 0x45,
+			0x3a, 0x85, 0x83, 0xc6, 0xc9, 0x18, 0xf0, 0x04,
+			0x71, 0x8b, 0x68, 0xdf, 0x63, 0x32, 0x24, 0x59,
+			0x68, 0x0c, 0x2c, 0xa4, 0x01, 0x31, 0xab, 0xae,
+			0xfa, 0x82, 0x8b, 0x60, 0x7e, 0xbb, 0x53, 0x2d,
+			0x39, 0xfc, 0x9a, 0xfa, 0x6e, 0x91, 0x64, 0xc8,
+			0x83, 0x47, 0x94, 0x51, 0x3e, 0xc7, 0xf9, 0x0e,
+			0x1d, 0x87, 0x6f, 0x8d, 0x9d, 0x48, 0xf5, 0xfd,
+			0x49, 0xa6, 0x87, 0xe0, 0xe8, 0x44, 0x48, 0xf5,
+			0x26, 0x4c, 0x01, 0xdc, 0xee, 0xf2, 0x57, 0x81,
+			0xa5, 0x2d, 0x41, 0x51, 0xec, 0x2e, 0x61, 0x11,
+			0x1d, 0x94, 0x79, 0xe8, 0xd0, 0xe6, 0xcb, 0x8a,
+			0xc1, 0xe2, 0x19, 0xe5, 0xb3, 0xf0, 0x80, 0xc4,
+			0xc1, 0x34, 0xde, 0x4f, 0x1d, 0x0b, 0xa3, 0x74,
+			0x2e, 0x2a, 0x31, 0xcb, 0x2b, 0xe6, 0x07, 0x2b,
+			0xc2, 0x28, 0xa1, 0x54, 0xe4, 0xb9, 0xf6, 0x56,
+			0xb8, 0x4b, 0x0a, 0xc0, 0xfe, 0xb9, 0xad, 0x1e,
+			0x60, 0xb0, 0x8f, 0x43, 0xa3, 0x5b, 0xee, 0x36,
+			0x91, 0xdf, 0x6f, 0x71, 0xa4, 0xc7, 0x26, 0xb4,
+			0x59, 0xfe, 0xb4, 0x34, 0xb7, 0x1b, 0xbe, 0xeb,
+			0x50, 0xe9, 0xfd, 0xf5, 0xc6, 0xb9, 0x6b, 0x78,
+			0x0d, 0xdc, 0xb3, 0x5e, 0x40, 0x11, 0xd8, 0xae,
+			0x96, 0xb7, 0xae, 0x72, 0x98, 0x0f, 0x1b, 0x1a,
+			0x1b, 0x93, 0x40, 0xcc, 0xac, 0xf9, 0x8f, 0xe5,
+			0xc0, 0x1c, 0x96, 0x31, 0x2b, 0x6c, 0x35, 0x8c,
+			0xbb, 0xb2, 0xf0, 0x45, 0x53, 0xe1, 0x43, 0x74,
+			0x01, 0xfb, 0x29, 0x5a, 0x39, 0x2e, 0x18, 0xd3,
+			0xd8, 0xd4, 0x64, 0x0f, 0x3a, 0x8a, 0xbc, 0xc2,
+			0x46, 0xd5, 0x05, 0x54, 0xcd, 0x9b, 0x8d, 0xe0,
+			0xf4, 0x22, 0xa2, 0xdd, 0xf0, 0x85, 0x41, 0x83,
+			0xb4, 0x40, 0x71, 0x30, 0x7c, 0xfd, 0xe4, 0xe7,
+			0xda, 0xd4, 0xa4, 0xee, 0x7c, 0x57, 0x19, 0xaa,
+			0x08, 0xf8, 0x43, 0xa5, 0x67, 0x73, 0x86, 0x77,
+			0x4a, 0x6d, 0xd5, 0x54, 0x0c, 0x7e, 0x11, 0x70,
+			0x5d, 0x70, 0x54, 0xc9, 0xed, 0xd8, 0x57, 0x84,
+			0x67, 0xea, 0xba, 0x1e, 0x23, 0xe7, 0x0b, 0xaf,
+			0xe3, 0x4d, 0xf9, 0x7b, 0xe4, 0x31, 0xf8, 0x2c,
+			0xf4, 0x29, 0x1f, 0x26, 0x5b, 0x91, 0xe8, 0xd0,
+			0x5f, 0xc8, 0x8c, 0x6c, 0x4c, 0x85, 0x4e, 0x55,
+			0xa8, 0x2d, 0x46, 0xd3, 0x9a, 0xf8, 0x94, 0x91,
+			0x27, 0xc8, 0xe7, 0x20, 0xd8, 0x74, 0x73, 0xe4,
+			0x79, 0xc6, 0x79, 0xfb, 0xb1, 0x06, 0x9e, 0xd5,
+			0xce, 0xc0, 0xce, 0x6c, 0x56, 0x44, 0x7f, 0xbc,
+			0x8f, 0x11, 0x0a, 0xad, 0x89, 0xd2, 0xc9, 0xcb,
+			0xe0, 0x8c, 0x0e, 0xe4, 0x7f, 0x86, 0xc3, 0xf5,
+			0x3b, 0x9b, 0x96, 0xea, 0x5a, 0x33, 0xc7, 0x42,
+			0xea, 0x84, 0x66, 0x4e, 0x12, 0x55, 0x63, 0xeb,
+			0xe5, 0x33, 0x1d, 0xef, 0xd9, 0x7c, 0x25, 0x98,
+			0xa5, 0x37, 0xd2, 0x20, 0x07, 0xb3, 0x46, 0xa2,
+			0xba, 0x9c, 0x34, 0xab, 0xdc, 0xea, 0xd9, 0x8a,
+			0x42, 0x48, 0x24, 0x22, 0xe8, 0x1a, 0x6b, 0xa5,
+			0xfa, 0xc5, 0xda, 0xd5, 0xf1, 0x0f, 0x02, 0x3e,
+			0xb8, 0xae, 0xa9, 0x3a, 0x9d, 0xc2, 0xbc, 0x34,
+			0xb6, 0x58, 0x20, 0x08, 0xe2, 0x2c, 0x44, 0xaf,
+			0x44, 0x9e, 0x92, 0xc1, 0xfa, 0x91, 0x03, 0x9b,
+			0xee, 0x17, 0x3b, 0xc0, 0x44, 0x3e, 0x13, 0xc9,
+			0x6c, 0xd1, 0xba, 0xf0, 0x37, 0xc9, 0x48, 0xd9,
+			0xe0, 0x45, 0x63, 0x6f, 0x08, 0xef, 0x2b, 0x25,
+			0x4b, 0xf4, 0x96, 0xf0, 0xbb, 0x81, 0x56, 0x9c,
+			0x35, 0xa2, 0xb2, 0x0f, 0x15, 0xa1, 0xaa, 0x7e,
+			0x93, 0xad, 0x62, 0x25, 0xeb, 0xa4, 0x83, 0xdc,
+			0x23, 0x3d, 0x59, 0x32, 0xd0, 0x5a, 0x5b, 0x62,
+			0x49, 0x8e, 0x5e, 0x6a, 0xbf, 0x3d, 0xee, 0xae,
+			0x5f, 0xad, 0x7d, 0x48, 0x98, 0x02, 0x13, 0x8a,
+			0x3d, 0x58, 0x7f, 0x0d, 0x2c, 0x98, 0xea, 0xef,
+			0x16, 0x99, 0xc1, 0xc2, 0x3a, 0x00, 0xbe, 0xb3,
+			0xc2, 0x6d, 0x92, 0xdd, 0x92, 0xcb, 0x39, 0xc9,
+			0x67, 0x03, 0xdd, 0xf9, 0x1c, 0xf4, 0x67, 0x1f,
+			0x84, 0x12, 0x97, 0x74, 0xa6, 0x78, 0xb1, 0xb5,
+			0xd0, 0x72, 0xd2, 0x1b, 0xa2, 0x1f, 0xb9, 0x8e,
+			0x59, 0x48, 0x13, 0x59, 0x1e, 0x42, 0x1d, 0x08,
+			0x5d, 0x44, 0x18, 0x65, 0xfd, 0xd2, 0xf9, 0xee,
+			0xca, 0x33, 0x84, 0x9f, 0x33, 0xad, 0x52, 0xdb,
+			0xd9, 0xaf, 0x9b, 0xc3, 0x0f, 0x2f, 0x51, 0xb9,
+			0x44, 0x1c, 0x59, 0xb4, 0x23, 0xd5, 0x0a, 0xd9,
+			0x98, 0xb8, 0xf2, 0x65, 0x0f, 0xc8, 0x56, 0x0c,
+			0x80, 0x46, 0x29, 0xab, 0x3e, 0x12, 0xc7, 0xf1,
+			0xcc, 0x38, 0x97, 0x04, 0x92, 0x9b, 0xfb, 0x1e,
+			0xa6, 0x6e, 0x31, 0xed, 0xbc, 0x4f, 0x59, 0x4e,
+			0x83, 0x09, 0x55, 0x9a, 0x0a, 0x1b, 0xc4, 0xef,
+			0xad, 0x81, 0xa0, 0x10, 0x29, 0xe7, 0x08, 0x20,
+			0xf2, 0x34, 0xb7, 0x24, 0xd3, 0x21, 0x09, 0x50,
+			0x17, 0x3a, 0x2d, 0xc6, 0x81, 0x66, 0x82, 0xa4,
+			0xd2, 0xbf, 0x01, 0xe8, 0xf2, 0x73, 0xc7, 0x6c,
+			0x17, 0xee, 0xb6, 0x80, 0xdc, 0x3c, 0x70, 0xc3,
+			0x23, 0x4d, 0x1d, 0xe7, 0xd2, 0x7f, 0x12, 0xfd,
+			0x03, 0x47, 0x05, 0x1c, 0x27, 0xc3, 0xc2, 0x45,
+			0xa2, 0x7e, 0xc0, 0xd4, 0xa8, 0x36, 0x07, 0x75,
+			0x0f, 0x8c, 0x83, 0x07, 0xaf, 0xef, 0xca, 0xc9,
+			0x50, 0xa3, 0x55, 0xd7, 0x4e, 0xeb, 0x14, 0xb8,
+			0xab, 0x30, 0x40, 0x51, 0xe3, 0x96, 0xc8, 0x76,
+			0x2d, 0x2d, 0x56, 0xe3, 0x0b, 0x62, 0xbc, 0x47,
+			0xaa, 0xd6, 0x61, 0xea, 0xb4, 0x67, 0x31, 0x3a,
+			0xaa, 0x3a, 0xff, 0xe6, 0x8d, 0x5c, 0x83, 0xcb,
+			0x18, 0x5b, 0x24, 0x07, 0x3c, 0x68, 0xbd, 0x38,
+			0x2b, 0x48, 0x0c, 0xda, 0xd4, 0xbc, 0x18, 0x04,
+			0xc4, 0x56, 0x7e, 0x6b, 0x9c, 0x40, 0x0d, 0xca,
+			0xa7, 0x53, 0x2d, 0x45, 0x9b, 0x7b, 0x82, 0x07,
+			0x20, 0x2a, 0x45, 0xad, 0x07, 0xdd, 0xaf, 0x0a,
+			0xb6, 0xc6, 0x71, 0x27, 0x64, 0xc8, 0x65, 0x2d,
+			0x7d, 0x34, 0x99, 0xd0, 0xe8, 0xb2, 0xad, 0x6b,
+			0x1f, 0x29, 0x50, 0x56, 0x2d, 0xa2, 0x81, 0x3e,
+			0x49, 0xbc, 0x68, 0x39, 0x85, 0x4c, 0xf0, 0x06,
+			0x56, 0xd9, 0x66, 0xa2, 0x75, 0x06, 0xc5, 0xe0,
+			0x4f, 0x8e, 0xd5, 0xa3, 0xb2, 0x90, 0x14, 0x57,
+			0xf5, 0xc1, 0x3c, 0x93, 0xcc, 0x22, 0x8c, 0xcc,
+			0xa4, 0xdb, 0x7c, 0x69, 0xb4, 0x5b, 0x08, 0xbd,
+			0xba, 0x8b, 0x7e, 0xc0, 0x86, 0x67, 0xda, 0x0c,
+			0x48, 0x9d, 0x00, 0xb8, 0xce, 0xc0, 0xd8, 0x6d,
+			0xc1, 0x1c, 0xa2, 0xf2, 0xfb, 0x62, 0x52, 0x8c,
+			0x79, 0x46, 0x01, 0xb6, 0x62, 0x38, 0x0e, 0xeb,
+			0x44, 0xfb, 0x51, 0x32, 0x3c, 0x4a, 0x46, 0x82,
+			0x4a, 0x44, 0x7d, 0x74, 0xe1, 0x33, 0xa1, 0x7f,
+			0xb1, 0x0d, 0x41, 0x8a, 0x1e, 0x36, 0xd2, 0x87,
+			0x9e, 0xb2, 0xcf, 0x66, 0x65, 0x57, 0xea, 0x5e,
+			0xed, 0x10, 0x4b, 0xa3, 0x03, 0x8e, 0x59, 0x83,
+			0x4d, 0x7d, 0x57, 0x5f, 0x8e, 0x1d, 0x53, 0x06,
+			0xc9, 0x35, 0x4c, 0xc3, 0xbe, 0x69, 0x8e, 0xa9,
+			0x51, 0xa3, 0x87, 0x41, 0xe1, 0x92, 0x7c, 0x97,
+			0x72, 0xf9, 0x28, 0x58, 0x73, 0x89, 0x07, 0xe2,
+			0xc5, 0xc3, 0x82, 0x83, 0x3a, 0x01, 0xda, 0xbb,
+			0xe3, 0x76, 0xdf, 0x28, 0x46, 0xe7, 0xb4, 0xc0,
+			0x7b, 0xed, 0x22, 0x99, 0xbd, 0x90, 0xaf, 0x5f,
+			0xa5, 0x12, 0xcc, 0x43, 0x5b, 0x62, 0xca, 0x51,
+			0xfe, 0xd3, 0x54, 0xe4, 0x20, 0x9b, 0x39, 0x30,
+			0x95, 0xa8, 0x60, 0xee, 0x41, 0x27, 0xf0, 0x15,
+			0x9f, 0xf5, 0x0e, 0x76, 0xaa, 0x1f, 0x21, 0xdd,
+			0x5e, 0x3e, 0xb9, 0xe7, 0x76, 0x81, 0x53, 0x98,
+			0x20, 0x0b, 0x19, 0x00, 0xb1, 0x93, 0xba, 0xa2,
+			0xda, 0x59, 0xbb, 0x6b, 0x65, 0x5c, 0x99, 0x89,
+			0xda, 0x07, 0xd5, 0xe7, 0x41, 0x26, 0x61, 0x3e,
+			0x3c, 0x90, 0x7a, 0xfb, 0xac, 0xb9, 0xae, 0x5e,
+			0x76, 0x60, 0xef, 0xaa, 0xdd, 0xca, 0x25, 0x03,
+			0xde, 0x5e, 0x66, 0xa5, 0x00, 0x84, 0x40, 0xcc,
+			0x37, 0x10, 0x25, 0x88, 0x50, 0x49, 0x2d, 0xbd,
+			0x51, 0xa1, 0xe5, 0x6a, 0xa0, 0x91, 0x78, 0x90,
+			0xda, 0x67, 0x96, 0x27, 0xce, 0x81, 0xe2, 0x16,
+			0x46, 0xc4, 0xc8, 0x7c, 0x83, 0x69, 0x3a, 0x32,
+			0xee, 0xa9, 0x60, 0xcc, 0x51, 0x80, 0xf2, 0x47,
+			0x3c, 0x17, 0xf9, 0xe7, 0x28, 0xe0, 0xa4, 0x4c,
+			0x67, 0xd1, 0x15, 0xd9, 0xee, 0x5e, 0x4e, 0x12,
+			0x51, 0x57, 0x2f, 0xca, 0x5d, 0x50, 0x3f, 0x8b,
+			0x09, 0x26, 0xc4, 0x6e, 0x9c, 0x10, 0x49, 0x62,
+			0x2b, 0xbf, 0xb6, 0x62, 0xc1, 0xaa, 0x7a, 0x2d,
+			0xc4, 0x9a, 0x9a, 0xc9, 0x2d, 0x45, 0xc8, 0x86,
+			0xd8, 0xe3, 0xbc, 0x7c, 0xbf, 0x1f, 0xfd, 0x83,
+			0xd4, 0xd2, 0xdd, 0x7a, 0xbb, 0xe2, 0x5c, 0x21,
+			0x0a, 0xa2, 0xbd, 0x4c, 0x4e, 0xcf, 0xd5, 0x80,
+			0x81, 0xf5, 0x1c, 0x09, 0x4b, 0x58, 0x42, 0xa2,
+			0x91, 0x57, 0xda, 0x26, 0x9e, 0xa3, 0xa6, 0x86,
+			0xb0, 0x16, 0x8b, 0x99, 0xbe, 0x85, 0x06, 0x4d,
+			0x4b, 0x15, 0xeb, 0x29, 0xdf, 0x63, 0x82, 0x8a,
+			0xf0, 0x6d, 0xaa, 0x3c, 0xa8, 0xbb, 0x0d, 0xb3,
+			0x70, 0xcf, 0x92, 0x84, 0x8d, 0xc1, 0x27, 0xd4,
+			0x62, 0x22, 0x0a, 0x8f, 0x9d, 0xe0, 0xd8, 0x88,
+			0x82, 0xc8, 0x22, 0xa8, 0xc1, 0x8c, 0xe8, 0xa6,
+			0x77, 0x64, 0xc9, 0x84, 0x40, 0x7d, 0x30, 0xc9,
+			0x61, 0x37, 0xe6, 0xd1, 0x59, 0xb4, 0xdd, 0xce,
+			0xd7, 0xfa, 0x5e, 0xa9, 0x62, 0x1d, 0x27, 0xa7,
+			0x48, 0x72, 0xb4, 0x75, 0x92, 0x7d, 0xa2, 0xcb,
+			0xd1, 0x76, 0x0b, 0xf1, 0xcf, 0x8c, 0x44, 0x84,
+			0xcf, 0x2a, 0xe7, 0xa3, 0x3b, 0x33, 0x8f, 0x0f,
+			0x7f, 0xa5, 0xdb, 0xa7, 0xb0, 0xb4, 0x84, 0x64,
+			0x04, 0xa6, 0xb3, 0x12, 0x67, 0x0f, 0x9a, 0x9d,
+			0x38, 0x16, 0x57, 0xd8, 0xeb, 0xd7, 0xef, 0x48,
+			0xe4, 0x00, 0xa1, 0x59, 0x40, 0x12, 0x1d, 0x9b,
+			0x0f, 0xec, 0x16, 0x83, 0x00, 0xfe, 0x9b, 0x51,
+			0x96, 0x79, 0x24, 0x6c, 0x6c, 0x8a, 0xd5, 0x4d,
+			0x66, 0xaf, 0x93, 0xf2, 0x2e, 0x10, 0xb9, 0xd0,
+			0x55, 0xc9, 0xf2, 0x60, 0x0b, 0xe5, 0x1b, 0x4f,
+			0x3a, 0x7e, 0x3f, 0xe8, 0x2d, 0x00, 0x39, 0x39,
+			0x9e, 0xe9, 0x7a, 0x51, 0xb7, 0x6a, 0xd2, 0xf7,
+			0x88, 0xb9, 0x12, 0xbd, 0xdf, 0x77, 0x04, 0xc2,
+			0x03, 0x4b, 0x76, 0xcc, 0xe1, 0xca, 0x59, 0x90,
+			0x98, 0xcd, 0x1a, 0x06, 0xc6, 0x1c, 0x87, 0xe7,
+			0xfb, 0x1e, 0x14, 0x88, 0x0c, 0x78, 0x6f, 0x47,
+			0x62, 0x09, 0x30, 0xc6, 0x2f, 0xfc, 0x0d, 0xbe,
+			0xb2, 0x34, 0x20, 0x5e, 0xac, 0x83, 0x53, 0xb4,
+			0xe0, 0x5a, 0xe8, 0xb2, 0xf2, 0x61, 0x77, 0xef,
+			0x56, 0x7c, 0x4e, 0xd5, 0xb7, 0x9e, 0xfc, 0x70,
+			0xb9, 0x05, 0x21, 0xeb, 0x20, 0x1a, 0x77, 0xc0,
+			0xe3, 0x4b, 0xac, 0xb1, 0x6f, 0xa2, 0xf1, 0x57,
+			0xa8, 0x10, 0x1c, 0x79, 0xca, 0xe1, 0x33, 0xce,
+			0xd7, 0xbe, 0x51, 0x98, 0x73, 0x26, 0xbb, 0x7f,
+			0x1b, 0x51, 0xd5, 0xbd, 0xf1, 0xd2, 0xd1, 0x18,
+			0x25, 0xc9, 0x9e, 0xbf, 0xfb, 0x1e, 0x49, 0xdc,
+			0x53, 0x13, 0xee, 0x54, 0xfc, 0xc5, 0xe8, 0x10,
+			0xa1, 0x0b, 0x15, 0x06, 0xa8, 0xc4, 0x5d, 0x1c,
+			0x77, 0x65, 0xa2, 0xc7, 0x28, 0xd8, 0x2a, 0xee,
+			0xd8, 0xc2, 0xe3, 0xa6, 0xb5, 0x9e, 0xc2, 0x0d,
+			0x3d, 0x36, 0xfb, 0x43, 0xf9, 0x5d, 0x27, 0x67,
+			0x12, 0xe6, 0x0f, 0xcb, 0xda, 0x5d, 0x29, 0x8f,
+			0x89, 0xc4, 0x01, 0xbd, 0x91, 0xd9, 0xad, 0xc4,
+			0x80, 0xf5, 0x3a, 0xa9, 0x0a, 0x7e, 0x62, 0x92,
+			0x9b, 0x58, 0xf0, 0x39, 0x18, 0x1b, 0xb1, 0x78,
+			0xd9, 0xaf, 0x7d, 0xae, 0xb0, 0x14, 0x95, 0xd3,
+			0xa0, 0x4e, 0xac, 0xec, 0x3d, 0x52, 0xfe, 0xcb,
+			0xca, 0x08, 0x5c, 0xd3, 0x27, 0x80, 0xbf, 0xeb,
+			0x9e, 0xc2, 0x80, 0xcd, 0x1e, 0xfc, 0xaa, 0x7f,
+			0xf5, 0xee, 0x49, 0x83, 0x09, 0x21, 0x7f, 0xc4,
+			0x0d, 0x73, 0x24, 0x28, 0xe9, 0x85, 0x68, 0x69,
+			0xca, 0x1d, 0x23, 0x93, 0x58, 0x02, 0xdf, 0x6e,
+			0xf2, 0xb6, 0x24, 0x2f, 0x76, 0x85, 0xd2, 0x3b,
+			0x20, 0xd6, 0x72, 0x82, 0xa0, 0xe7, 0xd6, 0xa0,
+			0x64, 0x45, 0x3e, 0xe3, 0xb2, 0x28, 0x40, 0xfe,
+			0xe4, 0xd4, 0x43, 0x3c, 0x5f, 0x45, 0xba, 0xfb,
+			0x9c, 0xe4, 0x0b, 0xce, 0x8f, 0x70, 0xe4, 0xdf,
+			0xba, 0x78, 0x75, 0x61, 0x8f, 0x80, 0x70, 0x61,
+			0x3a, 0x4b, 0xed, 0xa1, 0xb6, 0x9a, 0x87, 0x3b,
+			0xcc, 0x6d, 0xc2, 0xfb, 0xb9, 0x32, 0x69, 0xbc,
+			0xde, 0xcb, 0x36, 0x67, 0x4b, 0x9c, 0x2a, 0x5e,
+			0x08, 0xfe, 0xb5, 0xab, 0x2a, 0xc3, 0xe8, 0x13,
+			0xd0, 0x04, 0x26, 0x36, 0x68, 0x67, 0x87, 0x82,
+			0x5e, 0xdf, 0x79, 0x21, 0xc2, 0xdc, 0xff, 0x71,
+			0xee, 0xd2, 0x05, 0x2d, 0xf4, 0x93, 0x68, 0x9c,
+			0xa4, 0x09, 0x8c, 0xbb, 0xed, 0x33, 0x01, 0x00,
+			0xb9, 0xd0, 0x2f, 0xb4, 0x90, 0x88, 0x2e, 0x78,
+			0x57, 0xca, 0xf5, 0xeb, 0xec, 0x8d, 0x4a, 0xca,
+			0xc2, 0x4e, 0xc9, 0xae, 0x9d, 0xdd, 0x8a, 0x87,
+			0x0e, 0xf2, 0x89, 0x86, 0xd7, 0xc2, 0x54, 0x87,
+			0xca, 0x60, 0x25, 0x30, 0x53, 0x64, 0xf6, 0x07,
+			0xaf, 0x69, 0x22, 0xe9, 0x78, 0x40, 0x45, 0xa6,
+			0x94, 0x0d, 0x00, 0xe0, 0x8e, 0x77, 0xab, 0x08,
+			0x85, 0xed, 0x48, 0x95, 0xba, 0xd6, 0x49, 0x29,
+			0x01, 0x0b, 0x70, 0x4b, 0xd5, 0x4d, 0xfa, 0x1c,
+			0x18, 0x09, 0x90, 0xfd, 0xa0, 0xe2, 0x69, 0x77,
+			0x27, 0x0d, 0x5e, 0xe7, 0x53, 0xad, 0xd1, 0x73,
+			0x58, 0xc6, 0x9c, 0x56, 0x4e, 0x89, 0x1c, 0x0c,
+			0x51, 0xc4, 0xcb, 0x07, 0x33, 0x87, 0x09, 0xdc,
+			0x2c, 0x9f, 0x43, 0xcd, 0xd5, 0x02, 0x05, 0x77,
+			0x3f, 0x19, 0x0d, 0xf7, 0xd2, 0xcc, 0xd4, 0x21,
+			0x7f, 0x9c, 0x4a, 0x40, 0x06, 0x68, 0x3e, 0xa9,
+			0x6d, 0x32, 0x65, 0x66, 0x7c, 0xcf, 0xb5, 0x5e,
+			0x60, 0x26, 0x27, 0xe5, 0xbb, 0x06, 0x85, 0xde,
+			0x07, 0xda, 0x7e, 0x25, 0xcb, 0x1f, 0x52, 0x94,
+			0x78, 0x72, 0x49, 0x29, 0x15, 0x4b, 0x3e, 0x44,
+			0x9f, 0xa6, 0x46, 0xcc, 0xe3, 0x73, 0xee, 0x02,
+			0x1a, 0x4d, 0x31, 0xf9, 0x26, 0xc0, 0xa0, 0x30,
+			0xa4, 0x51, 0x62, 0x6d, 0x76, 0x35, 0xeb, 0xac,
+			0x4e, 0x7b, 0xd4, 0x32, 0x72, 0x74, 0x74, 0xcc,
+			0x1c, 0xad, 0xfc, 0xb8, 0x19, 0x0d, 0x7a, 0x0b,
+			0xb0, 0xd2, 0x5c, 0xa7, 0x3b, 0x1b, 0xcb, 0x11,
+			0x25, 0x7f, 0x2c, 0x5c, 0xfc, 0x76, 0x01, 0x62,
+			0x3b, 0x5d, 0x48, 0xee, 0xc7, 0x11, 0xed, 0x11,
+			0x75, 0x8c, 0xa3, 0x9d, 0xe9, 0x3b, 0xdc, 0x66,
+			0xde, 0x8b, 0x27, 0x91, 0x71, 0xaa, 0x6f, 0x83,
+			0x7d, 0x4e, 0xe9, 0xfa, 0xab, 0x0a, 0x9e, 0xd9,
+			0xdd, 0xdf, 0x42, 0xf5, 0xfe, 0x17, 0x37, 0xa4,
+			0x14, 0xc3, 0x8d, 0x2b, 0x94, 0xe2, 0xa0, 0x7d,
+			0xa8, 0x9e, 0xda, 0x92, 0x4a, 0xbf, 0x89, 0x35,
+			0x33, 0x30, 0x8f, 0x4a, 0xe5, 0xdb, 0xcc, 0x1e,
+			0x64, 0x23, 0x51, 0x29, 0xac, 0x32, 0x9c, 0xfc,
+			0xdd, 0x4f, 0xf4, 0xa3, 0x07, 0xe3, 0xe1, 0x0e,
+			0xeb, 0x5b, 0x76, 0x24, 0x0a, 0xc7, 0x7b, 0x15,
+			0xb8, 0xc4, 0x9d, 0xe7, 0xf9, 0xd4, 0x03, 0x0d,
+			0xbf, 0x92, 0x5b, 0xef, 0x4c, 0x5b, 0x95, 0x30,
+			0x0a, 0xaa, 0xf4, 0x64, 0xcc, 0xdb, 0x7c, 0xda,
+			0x45, 0xa6, 0x81, 0x64, 0xdc, 0x2a, 0xd4, 0x0a,
+			0x52, 0x55, 0xca, 0x22, 0xeb, 0xfc, 0x03, 0x7f,
+			0x7c, 0x10, 0xc1, 0xf0, 0xd5, 0xec, 0x09, 0x4e,
+			0x4b, 0xf2, 0x38, 0x07, 0x89, 0xc3, 0x60, 0x8b,
+			0x1f, 0x70, 0x66, 0x0b, 0xb3, 0x7a, 0x71, 0x79,
+			0x61, 0x8e, 0xce, 0x9e, 0xea, 0x3b, 0x27, 0x4a,
+			0xd9, 0xe8, 0x8c, 0xcb, 0xca, 0xf4, 0xc4, 0x09,
+			0x52, 0x9c, 0x38, 0x3d, 0xba, 0x0b, 0x45, 0xa0,
+			0x9a, 0x89, 0xbb, 0x75, 0xf0, 0x74, 0x47, 0xa8,
+			0x45, 0x6a, 0xbd, 0xe8, 0x88, 0x2e, 0xaa, 0x6b,
+			0x2f, 0x35, 0xb8, 0xf7, 0x37, 0xf1, 0x7b, 0x08,
+			0x35, 0xd2, 0x35, 0x0e, 0x69, 0x93, 0x35, 0x41,
+			0xc9, 0xe6, 0x9c, 0x07, 0x6f, 0xf2, 0xbf, 0x31,
+			0xc0, 0xfa, 0xcc, 0xa0, 0x04, 0x60, 0xd1, 0x73,
+			0x73, 0x0e, 0xfe, 0xc3, 0xa1, 0x74, 0xf3, 0xf1,
+			0xc4, 0xe4, 0x64, 0x4d, 0xc9, 0x14, 0xea, 0x07,
+			0x8d, 0xa2, 0xcf, 0x27, 0x47, 0xc2, 0x46, 0x8d,
+			0x5c, 0x2a, 0xb8, 0x26, 0x67, 0x2b, 0xe3, 0xd2,
+			0xca, 0x63, 0x3f, 0x33, 0x94, 0x41, 0xee, 0x7e,
+			0x08, 0x52, 0x3b, 0xcf, 0x32, 0xd5, 0xf2, 0xa4,
+			0xea, 0xdc, 0x76, 0x5a, 0x1c, 0x35, 0xd1, 0xd1,
+			0xe0, 0x23, 0x26, 0xf4, 0x83, 0x4b, 0x4d, 0x61,
+			0x37, 0x9d, 0x98, 0xfe, 0x41, 0x4e, 0x30, 0x97,
+			0x78, 0x78, 0xe5, 0x0f, 0x84, 0x66, 0x56, 0x74,
+			0x3e, 0xec, 0x86, 0x70, 0x84, 0x50, 0x02, 0x2f,
+			0x08, 0x1c, 0xaa, 0xf3, 0x99, 0x25, 0xed, 0xd7,
+			0x4b, 0x21, 0xa2, 0xea, 0x07, 0xa9, 0xc5, 0xcb,
+			0xa7, 0x20, 0x4c, 0x35, 0xcf, 0x16, 0x96, 0xb3,
+			0x39, 0xa9, 0xdf, 0x76, 0xbd, 0xa9, 0xc8, 0x86,
+			0x5f, 0x65, 0x17, 0x12, 0x3a, 0xb2, 0x18, 0x87,
+			0xd1, 0xeb, 0x1a, 0xe8, 0x88, 0xec, 0x7c, 0xd7,
+			0xcd, 0x05, 0x29, 0xb5, 0x0e, 0x6f, 0xe3, 0x06,
+			0x83, 0xff, 0xbb, 0x53, 0xd3, 0xf3, 0x6c, 0xf6,
+			0xca, 0xe6, 0x7d, 0xaf, 0x6b, 0xfd, 0x9e, 0xaf,
+			0x9a, 0x25, 0xf4, 0x97, 0x9b, 0xdd, 0xd0, 0x30,
+			0x11, 0xd3, 0x32, 0x57, 0xf7, 0xba, 0x99, 0xac,
+			0x85, 0x98, 0x35, 0x0e, 0xf3, 0xcc, 0xf7, 0x73,
+			0x79, 0xa8, 0xe9, 0x7f, 0x21, 0xfc, 0x57, 0xa9,
+			0x64, 0xb2, 0x26, 0xd3, 0x00, 0x2f, 0xb9, 0x0e,
+			0xda, 0xae, 0x0d, 0x1b, 0x7f, 0x75, 0xc6, 0x96,
+			0x33, 0xb5, 0x09, 0x72, 0x21, 0x15, 0x94, 0xda,
+			0x08, 0x5f, 0x88, 0x0d, 0x2a, 0x18, 0x73, 0x23,
+			0x2f, 0x29, 0x35, 0x7e, 0xe6, 0xca, 0xc4, 0x02,
+			0xfc, 0x21, 0x6b, 0x54, 0x8a, 0xd7, 0x74, 0xa8,
+			0x57, 0xd8, 0x57, 0xfd, 0x83, 0x0a, 0x6b, 0x98,
+			0xe1, 0x43, 0xd1, 0xfc, 0xad, 0x46, 0x16, 0x85,
+			0x97, 0xf4, 0x0b, 0x0d, 0x47, 0x65, 0x73, 0xa9,
+			0xad, 0x79, 0xb9, 0x96, 0x9d, 0x19, 0xbb, 0xb2,
+			0xc6, 0xc2, 0x6a, 0x5a, 0x94, 0x84, 0x28, 0x43,
+			0x7d, 0x7d, 0x27, 0x43, 0x6b, 0xc0, 0x29, 0x3e,
+			0xc6, 0xdc, 0x24, 0xe1, 0x3c, 0x0d, 0xf1, 0x95,
+			0x7a, 0x88, 0xab, 0xd4, 0x56, 0x52, 0xee, 0x5d,
+			0x22, 0x16, 0x92, 0xf7, 0x4d, 0xe8, 0xaa, 0xdf,
+			0x92, 0x3f, 0x93, 0x01, 0x63, 0x53, 0x34, 0x7d,
+			0xf1, 0xa6, 0x6b, 0xec, 0x6d, 0x6c, 0x16, 0x57,
+			0x59, 0x4b, 0xae, 0xd8, 0xf3, 0x02, 0x56, 0x10,
+			0x9b, 0xd5, 0x42, 0x84, 0xd5, 0xa0, 0x99, 0xe7,
+			0x07, 0xdb, 0x88, 0xb0, 0x7c, 0xdf, 0xd7, 0x00,
+			0xdd, 0x2a, 0x6d, 0xad, 0xa9, 0xb4, 0x6f, 0xc0,
+			0x2e, 0x49, 0x6d, 0x0b, 0xc3, 0x90, 0x73, 0x3b,
+			0x26, 0xf1, 0x1d, 0xa5, 0xc7, 0x16, 0xc6, 0x7b,
+			0x8a, 0x44, 0xb8, 0x0c, 0x22, 0x51, 0x2d, 0x09,
+			0x67, 0xd8, 0xe5, 0xc2, 0x89, 0xb9, 0x86, 0x28,
+			0xef, 0xa5, 0x5f, 0x08, 0x47, 0x7b, 0xd4, 0xb3,
+			0xe6, 0x89, 0xb4, 0x26, 0x6a, 0xf1, 0x3f, 0x79,
+			0x39, 0x82, 0x86, 0xc1, 0xa6, 0xeb, 0x72, 0x9b,
+			0xb5, 0x24, 0x34, 0xab, 0x83, 0xb3, 0xe4, 0x23,
+			0xe3, 0x64, 0x5f, 0xf2, 0x76, 0xa1, 0x95, 0x7b,
+			0xf6, 0xe2, 0x24, 0x97, 0x15, 0x1b, 0xa7, 0xce,
+			0x6a, 0x38, 0xab, 0x3c, 0x2f, 0xc9, 0xc0, 0xe3,
+			0xb5, 0x64, 0x16, 0xd1, 0x78, 0x9e, 0x80, 0x36,
+			0x00, 0x3f, 0x68, 0x0b, 0xcf, 0x5a, 0x5d, 0x7c,
+			0x0a, 0xaa, 0x0f, 0xd1, 0x4f, 0x5a, 0xe9, 0x3c,
+			0x62, 0xfb, 0x09, 0xac, 0x39, 0x52, 0x16, 0xe4,
+			0x02, 0xe3, 0xf9, 0x0f, 0x16, 0xde, 0x3e, 0x6d,
+			0xda, 0x0b, 0x25, 0x58, 0x81, 0x8d, 0x82, 0xba,
+			0x82, 0x84, 0xc1, 0x0c, 0x20, 0xf9, 0xf4, 0x66,
+			0xd5, 0x45, 0x6f, 0x92, 0xea, 0x7a, 0x2b, 0xe7,
+			0xaf, 0x27, 0xd0, 0x4e, 0x09, 0xe6, 0x48, 0xe5,
+			0xa4, 0x5e, 0x75, 0x1c, 0x22, 0x90, 0x81, 0xdd,
+			0xdb, 0xdb, 0x19, 0x50, 0xf8, 0xb9, 0x99, 0xb3,
+			0xc5, 0x79, 0x1a, 0x5f, 0x45, 0xa0, 0xd9, 0x8c,
+			0x31, 0xe3, 0xfb, 0x58, 0x2f, 0xdd, 0x85, 0xa4,
+			0xbb, 0x4c, 0x7a, 0x47, 0xaf, 0xc4, 0x22, 0xec,
+			0x99, 0x8e, 0x0e, 0x4e, 0x5b, 0x7d, 0x76, 0x47,
+			0x3e, 0xe3, 0xc4, 0xe0, 0x94, 0x16, 0xf6, 0xf9,
+			0x8d, 0xdd, 0x53, 0xd2, 0x87, 0x51, 0x6a, 0x23,
+			0xa8, 0x4f, 0xc5, 0xb8, 0xc5, 0xc5, 0xdf, 0x4b,
+			0x62, 0xf8, 0x4c, 0x78, 0xa9, 0xb9, 0xdc, 0xc7,
+			0xa2, 0xa3, 0x42, 0x5d, 0x99, 0xe7, 0xed, 0x83,
+			0xda, 0x21, 0xb5, 0x6d, 0x4f, 0xad, 0xb4, 0x84,
+			0xba, 0x4c, 0x70, 0xf9, 0x8a, 0x91, 0x73, 0xef,
+			0x82, 0xbd, 0x20, 0x68, 0x25, 0xbc, 0x79, 0xf0,
+			0x0a, 0x7e, 0xf3, 0xed, 0x8e, 0x33, 0x2b, 0x68,
+			0xf1, 0xf3, 0x4f, 0x70, 0xc3, 0xab, 0x0b, 0x1d,
+			0xbc, 0xda, 0x56, 0x6d, 0x6c, 0x7f, 0x2b, 0xe4,
+			0xce, 0xee, 0x32, 0xb3, 0x67, 0xdd, 0x95, 0x17,
+			0x9f, 0x27, 0x35, 0x67, 0x08, 0x67, 0x96, 0xa6,
+			0x9a, 0xc0, 0x4a, 0xf2, 0x28, 0xe9, 0xfc, 0xe4,
+			0xb8, 0x83, 0x95, 0x09, 0x5a, 0xc9, 0x57, 0xc4,
+			0x02, 0x20, 0x0f, 0x1e, 0x67, 0x02, 0x68, 0xab,
+			0x10, 0x96, 0x3a, 0x7a, 0x89, 0x45, 0xae, 0xb1,
+			0xab, 0xd8, 0x90, 0x61, 0x00, 0xdb, 0xa7, 0xa6,
+			0xd1, 0x2f, 0xa6, 0xf1, 0x34, 0xba, 0xd6, 0xf2,
+			0x38, 0x3c, 0x89, 0xe8, 0x6a, 0xb2, 0x0d, 0xb3,
+			0x3b, 0xb6, 0xc1, 0xaa, 0xc6, 0x28, 0x9b, 0x7e,
+			0xec, 0xea, 0x32, 0x27, 0x7e, 0x92, 0x80, 0x10,
+			0x58, 0xbd, 0xb2, 0x46, 0x2a, 0xa4, 0x31, 0x7e,
+			0xb1, 0x83, 0xf1, 0x94, 0x3c, 0x94, 0x3e, 0xde,
+			0x56, 0x56, 0x29, 0x61, 0x73, 0xb5, 0x8d, 0x5b,
+			0x8b, 0x42, 0xac, 0x3e, 0x8d, 0xb1, 0xe1, 0x2d,
+			0xcf, 0x79, 0x50, 0x2b, 0x69, 0xed, 0xe0, 0x67,
+			0x4d, 0xb0, 0x78, 0xba, 0xd3, 0x60, 0xe8, 0x38,
+			0x16, 0x23, 0xb2, 0xfe, 0xe0, 0xeb, 0xd3, 0x7a
+		},
+	}
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_TESTER_VECTORS_SHA2_128S_H */
@@ -0,0 +1,4548 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SPHINCS_TESTER_VECTORS_SHA2_192F_H
+#define SPHINCS_TESTER_VECTORS_SHA2_192F_H
+
+#include "fips_mode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lc_sphincs_test {
+	uint8_t seed[LC_SPX_SEEDBYTES];
+	uint8_t msg[33];
+	uint8_t pk[sizeof(struct lc_sphincs_pk)];
+	uint8_t sk[sizeof(struct lc_sphincs_sk)];
+	uint8_t sig[sizeof(struct lc_sphincs_sig)];
+};
+
+LC_FIPS_RODATA_SECTION
+static const struct lc_sphincs_test tests[] =
+{
+	{
+		.seed = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x92, 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd
+		},
+		.msg = {
+			0xd8, 0x1c, 0x4d, 0x8d, 0x73, 0x4f, 0xcb, 0xfb,
+			0xea, 0xde, 0x3d, 0x3f, 0x8a, 0x03, 0x9f, 0xaa,
+			0x2a, 0x2c, 0x99, 0x57, 0xe8, 0x35, 0xad, 0x55,
+			0xb2, 0x2e, 0x75, 0xbf, 0x57, 0xbb, 0x55, 0x6a,
+			0xc8
+		},
+		.pk = {
+			FIPS140_MOD(0x92), 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0xad, 0x7e, 0xf8, 0x67, 0x98, 0x1e, 0x22, 0x87,
+			0x7a, 0xa4, 0xc2, 0xa8, 0x82, 0x9f, 0x65, 0x7e,
+			0x93, 0x1c, 0x55, 0x40, 0x9b, 0x89, 0x7d, 0x2e
+		},
+		.sk = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x92, 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0xad, 0x7e, 0xf8, 0x67, 0x98, 0x1e, 0x22, 0x87,
+			0x7a, 0xa4, 0xc2, 0xa8, 0x82, 0x9f, 0x65, 0x7e,
+			0x93, 0x1c, 0x55, 0x40, 0x9b, 0x89, 0x7d, 0x2e
+		},
+		.sig = {
+			0x7f, 0x42, 0x8d, 0x1a, 0xaa, 0x56, 0xd3, 0xa4,
+			0x5f, 0x6b, 0xe1, 0x05, 0x4f, 0xcc, 0xe4, 0xbb,
+			0x02, 0x4f, 0xc1, 0x74, 0xc2, 0x7f, 0x48, 0x1b,
+			0xb7, 0xd4, 0xb4, 0xef, 0xf6, 0x55, 0x8b, 0x4b,
+			0x98, 0x1c, 0x52, 0xaf, 0x37, 0x03, 0xa2, 0x3c,
+			0x43, 0xd4, 0x93, 0x86, 0x19, 0x37, 0x50, 0x04,
+			0xc6, 0xab, 0xf7, 0xec, 0x92, 0xd3, 0x6f, 0xef,
+			0xc1, 0xeb, 0xa2, 0x4f, 0x3c, 0x48, 0xa3, 0xc5,
+			0x3a, 0x71, 0xad, 0xdb, 0x12, 0x4d, 0xdb, 0x30,
+			0xf8, 0x2d, 0x02, 0xff, 0x60, 0xab, 0x5c, 0xa5,
+			0x6d, 0x21, 0x26, 0x6e, 0xdd, 0x11, 0xde, 0xab,
+			0xf0, 0xce, 0x83, 0x52, 0xe8, 0x53, 0x7b, 0x34,
+			0x50, 0x7b, 0x53, 0xea, 0x4c, 0x61, 0xca, 0xf9,
+			0x87, 0x59, 0xfa, 0x80, 0xc4, 0x3c, 0xd3, 0x21,
+			0x9e, 0xb4, 0x3c, 0x89, 0x27, 0xf3, 0x5b, 0x26,
+			0xc3, 0x72, 0x69, 0x72, 0x24, 0xbd, 0x87, 0x0e,
+			0x6c, 0xdf, 0xde, 0x06, 0x77, 0xac, 0xf8, 0x20,
+			0x1a, 0xb9, 0x6d, 0x3b, 0xd5, 0xc0, 0x72, 0x99,
+			0x0e, 0x1b, 0xb6, 0xd8, 0x22, 0x72, 0x96, 0xa8,
+			0xda, 0xc6, 0xc8, 0x74, 0xdc, 0x3e, 0xeb, 0xac,
+			0xc5, 0xba, 0x13, 0x05, 0x78, 0xe8, 0xda, 0xb6,
+			0xdf, 0xf4, 0xe6, 0x74, 0xbb, 0x16, 0xac, 0xff,
+			0xbc, 0x8a, 0xa2, 0x21, 0xa1, 0x78, 0xed, 0x43,
+			0x47, 0x4a, 0xb9, 0xfb, 0xcb, 0x06, 0x43, 0x1c,
+			0x49, 0xcd, 0x52, 0xb7, 0x16, 0x2b, 0x1c, 0x0a,
+			0xd8, 0xf6, 0xf8, 0x4d, 0x3d, 0x25, 0x3c, 0xac,
+			0x87, 0x12, 0x0f, 0xb2, 0x4f, 0xe8, 0xe2, 0xb0,
+			0xbb, 0xe5, 0x9e, 0xde, 0xf8, 0x1c, 0xf4, 0x84,
+			0x06, 0xd6, 0x8d, 0xe0, 0xdf, 0xac, 0x15, 0xc7,
+			0xa7, 0x37, 0xb2, 0x5e, 0x9b, 0x58, 0x05, 0x24,
+			0x55, 0x62, 0xd0, 0x70, 0x47, 0xaf, 0x0d, 0x7f,
+			0xbd, 0x93, 0xf2, 0xcc, 0xc0, 0x8f, 0x04, 0x73,
+			0x75, 0x4e, 0x27, 0x1f, 0x6f, 0xe3, 0xe1, 0xfc,
+			0x6d, 0x3a, 0xa2, 0x47, 0x84, 0x44, 0xe6, 0x5a,
+			0xcc, 0x46, 0x50, 0x02, 0xa7, 0xf9, 0x1e, 0x30,
+			0x1c, 0xd6, 0x1e, 0x49, 0x87, 0xe2, 0x17, 0x21,
+			0xf6, 0x4f, 0xef, 0x98, 0x86, 0x6f, 0xe0, 0x14,
+			0x49, 0x1d, 0x39, 0x4e, 0xef, 0x65, 0x1e, 0x78,
+			0xd1, 0xc0, 0x73, 0xef, 0x87, 0x68, 0x66, 0x21,
+			0xc3, 0xc0, 0x92, 0x08, 0xb0, 0x67, 0xb4, 0xe0,
+			0xc6, 0x77, 0xc1, 0xb9, 0x09, 0x06, 0x7f, 0xc1,
+			0xcc, 0x2d, 0x7c, 0x40, 0xe7, 0xe6, 0x9b, 0xfe,
+			0xc5, 0x02, 0x0d, 0xc8, 0x6c, 0x43, 0x59, 0x6a,
+			0x6f, 0xab, 0x4d, 0xea, 0x88, 0x6c, 0x94, 0x6d,
+			0xfa, 0x93, 0x33, 0x47, 0xb7, 0x64, 0x9d, 0xe0,
+			0x00, 0xba, 0x6a, 0x4b, 0x96, 0x47, 0xbc, 0x65,
+			0xd8, 0x67, 0xbd, 0x63, 0x40, 0x2b, 0xb8, 0xb4,
+			0x0f, 0x52, 0xb1, 0x89, 0x1e, 0xca, 0x9e, 0xd5,
+			0x04, 0xa8, 0x71, 0x35, 0x9f, 0x1c, 0x0f, 0x4e,
+			0x77, 0x4f, 0x93, 0xda, 0x51, 0xa1, 0x1e, 0x34,
+			0x09, 0xa3, 0xe0, 0xb9, 0xcd, 0x0b, 0x6d, 0xe6,
+			0x5c, 0x18, 0xd6, 0xd4, 0x36, 0xcf, 0x82, 0xf1,
+			0xd6, 0x0e, 0xc8, 0xf3, 0x16, 0x5b, 0x85, 0x19,
+			0x97, 0xaa, 0x1e, 0x61, 0xb2, 0xb2, 0x56, 0x20,
+			0x44, 0x2f, 0xf8, 0x83, 0x89, 0x74, 0x26, 0x84,
+			0xf6, 0xbb, 0x21, 0xfc, 0x4b, 0x77, 0xc3, 0x5e,
+			0x37, 0x52, 0x21, 0x99, 0xb3, 0xfa, 0xd4, 0x81,
+			0xeb, 0x92, 0x37, 0xc0, 0xbd, 0xf7, 0xb8, 0xf6,
+			0xe6, 0xa6, 0xb1, 0x90, 0xc8, 0x79, 0xb5, 0xd4,
+			0x38, 0x59, 0xdd, 0x99, 0x0c, 0xb0, 0xc6, 0xc8,
+			0x85, 0xae, 0xf5, 0x70, 0x92, 0x5b, 0xab, 0x2d,
+			0x4f, 0x5e, 0x9a, 0xb4, 0xa0, 0xce, 0x4c, 0x65,
+			0xd5, 0x71, 0xc7, 0xc9, 0xf7, 0xb2, 0xd8, 0x30,
+			0x40, 0xf0, 0xf0, 0x15, 0x7e, 0x29, 0xe5, 0xda,
+			0x26, 0x7a, 0x59, 0xdb, 0x51, 0x87, 0xac, 0x48,
+			0xc2, 0xf2, 0xaf, 0xe4, 0xfb, 0x83, 0x82, 0xf0,
+			0xf7, 0x4b, 0xc2, 0x68, 0x36, 0x58, 0x69, 0x6f,
+			0x4c, 0x30, 0xdc, 0x9f, 0xe7, 0x3a, 0x33, 0x48,
+			0x02, 0x4a, 0xfd, 0x05, 0x6f, 0x4f, 0x6e, 0x2f,
+			0xcd, 0x97, 0xeb, 0x0d, 0x09, 0x84, 0xf7, 0x8e,
+			0x13, 0x67, 0x77, 0xc1, 0x53, 0x0b, 0x15, 0x60,
+			0x42, 0x50, 0xd5, 0x8a, 0xed, 0xc5, 0xe5, 0x1d,
+			0x8d, 0x9c, 0x73, 0xd9, 0xb6, 0x4c, 0x12, 0xc6,
+			0x67, 0x29, 0xc7, 0x56, 0xcb, 0xda, 0x41, 0x20,
+			0x34, 0x55, 0x12, 0x2a, 0x2e, 0x37, 0x56, 0x4e,
+			0x97, 0x73, 0xb4, 0xec, 0x9d, 0x3e, 0x44, 0x7a,
+			0xb4, 0xcc, 0x0b, 0x2c, 0xb7, 0x9a, 0xfb, 0xa8,
+			0xea, 0x75, 0x62, 0x39, 0xbb, 0x7e, 0x2d, 0xe0,
+			0xcb, 0x67, 0x3a, 0x69, 0x93, 0xb8, 0xe2, 0x11,
+			0xae, 0x3c, 0x00, 0x6f, 0xe9, 0xbf, 0x81, 0x16,
+			0x9d, 0x1a, 0x02, 0x7b, 0x84, 0x6d, 0x74, 0x4d,
+			0x2f, 0x39, 0xe0, 0x44, 0xe4, 0x4c, 0xe3, 0xb5,
+			0x3e, 0x8d, 0x0e, 0x64, 0x65, 0x71, 0xfa, 0x5c,
+			0x05, 0xe0, 0x79, 0x64, 0x80, 0x0f, 0x9e, 0xf1,
+			0x4d, 0x39, 0x49, 0xde, 0xda, 0x66, 0xec, 0x2a,
+			0x6e, 0x1d, 0x97, 0x8e, 0xde, 0x34, 0xa7, 0x99,
+			0xfd, 0xdb, 0x2e, 0x56, 0x62, 0xb5, 0xed, 0x76,
+			0x2b, 0x83, 0xfb, 0xe5, 0xb8, 0x8a, 0x28, 0x42,
+			0x1f, 0x6e, 0x80, 0x69, 0xb7, 0x2b, 0x84, 0x1b,
+			0xb5, 0x6e, 0x87, 0xe3, 0x1a, 0xca, 0x4c, 0xc8,
+			0x2f, 0x1e, 0xda, 0xc1, 0xe7, 0xa3, 0x14, 0x0b,
+			0xd0, 0xad, 0x27, 0xd3, 0xf4, 0x4a, 0x78, 0x38,
+			0x0f, 0x25, 0x13, 0xac, 0x34, 0x01, 0x77, 0xf6,
+			0x33, 0x12, 0xd2, 0x6e, 0x54, 0xa5, 0xb3, 0x34,
+			0x3d, 0x1a, 0x3b, 0xcf, 0xe3, 0x86, 0x9c, 0x2b,
+			0x69, 0xed, 0x8e, 0x2a, 0x98, 0xce, 0x47, 0x96,
+			0x14, 0xf9, 0x71, 0x5c, 0x5a, 0x05, 0x8f, 0x54,
+			0x4a, 0x00, 0x20, 0xcd, 0xbf, 0xe6, 0x87, 0x8b,
+			0xe8, 0x50, 0x9c, 0xc8, 0xab, 0x65, 0x88, 0x30,
+			0x22, 0xde, 0xe3, 0x82, 0xfa, 0xa0, 0xe3, 0xfd,
+			0xd3, 0xc4, 0x46, 0xac, 0x48, 0x5f, 0x83, 0x20,
+			0x61, 0x51, 0xf4, 0xaa, 0x7c, 0x80, 0x78, 0x03,
+			0x1a, 0x51, 0x99, 0x7a, 0x22, 0x06, 0x13, 0x17,
+			0x9c, 0xcd, 0x11, 0x77, 0xc7, 0x38, 0x46, 0xa4,
+			0x1f, 0x4a, 0xad, 0x7d, 0x40, 0xc5, 0x2d, 0x5c,
+			0xab, 0x99, 0xfc, 0x19, 0x00, 0x98, 0x8b, 0xdb,
+			0xf7, 0xd2, 0xf0, 0x45, 0x1a, 0x09, 0x4f, 0x30,
+			0x37, 0x2f, 0xcb, 0xac, 0xa1, 0x7e, 0x90, 0x5e,
+			0x0e, 0xca, 0x7a, 0xb8, 0xa3, 0xe0, 0xb6, 0x94,
+			0x4f, 0xd3, 0xf0, 0x67, 0xa2, 0x28, 0xdb, 0x99,
+			0xbe, 0x15, 0x77, 0x59, 0x48, 0xa1, 0x31, 0x58,
+			0x6b, 0x0c, 0x44, 0x24, 0xe8, 0x27, 0x31, 0x53,
+			0x6a, 0x0e, 0x06, 0xea, 0x37, 0x44, 0x59, 0x5e,
+			0x6a, 0x1a, 0xec, 0x0a, 0x19, 0x8f, 0xf9, 0x29,
+			0xf0, 0xa7, 0x3e, 0x68, 0x07, 0xb9, 0x68, 0xee,
+			0x7c, 0x45, 0x4e, 0x31, 0xb2, 0x7a, 0xad, 0xaf,
+			0xa4, 0x1d, 0x9d, 0x12, 0x19, 0x94, 0x1b, 0x1f,
+			0x24, 0xfa, 0xeb, 0xfa, 0x9c, 0xd8, 0x9d, 0x4d,
+			0xb3, 0xb3, 0x72, 0x0a, 0x9e, 0x05, 0x6e, 0xe3,
+			0x2d, 0x0a, 0xff, 0xd8, 0x7b, 0xfc, 0xd3, 0x38,
+			0xc4, 0x54, 0x05, 0xac, 0x50, 0x63, 0x9f, 0xb1,
+			0xfa, 0x88, 0xa7, 0x4b, 0xe2, 0xf2, 0x3e, 0x8d,
+			0x83, 0xb0, 0x3b, 0xe6, 0x9f, 0x91, 0x91, 0x18,
+			0xc8, 0x4d, 0xcf, 0x79, 0x19, 0x79, 0x11, 0x6b,
+			0x14, 0xec, 0xea, 0xab, 0xfb, 0x26, 0x81, 0x6f,
+			0xd0, 0xb3, 0xe2, 0x22, 0x9d, 0xd6, 0x47, 0xdb,
+			0xcd, 0x0d, 0x4b, 0x22, 0x6e, 0x69, 0x05, 0x63,
+			0x57, 0x59, 0x09, 0xd1, 0xb4, 0x24, 0xc6, 0x68,
+			0x03, 0x8b, 0xdc, 0x11, 0x8c, 0x9c, 0x78, 0x7a,
+			0xaa, 0xa3, 0xd2, 0x9e, 0xe8, 0x29, 0x0f, 0x9b,
+			0x78, 0x36, 0xc9, 0xd9, 0x73, 0x8f, 0x15, 0x80,
+			0x46, 0xb4, 0x5d, 0x28, 0x34, 0x2f, 0x78, 0xb6,
+			0xd4, 0x0e, 0xe0, 0x26, 0xe6, 0x78, 0x13, 0x5f,
+			0x8e, 0x43, 0xd4, 0x47, 0xc5, 0xe1, 0x60, 0xe2,
+			0xd5, 0xc2, 0x7e, 0xc2, 0xb9, 0x17, 0xbc, 0xcf,
+			0x7f, 0x6d, 0x68, 0x1d, 0xae, 0xf6, 0x6f, 0x8b,
+			0x94, 0xf3, 0x8f, 0xec, 0x70, 0xcf, 0xe2, 0xbb,
+			0x40, 0x81, 0x0e, 0xdc, 0xda, 0xd2, 0xcf, 0x77,
+			0x89, 0xd2, 0xa8, 0x6c, 0x01, 0x70, 0xcf, 0x8b,
+			0x0b, 0xca, 0x43, 0x6d, 0xc8, 0x40, 0xbb, 0xe8,
+			0x4f, 0xd8, 0x11, 0x62, 0xa8, 0xb6, 0x87, 0x91,
+			0x5f, 0xf0, 0x8b, 0x0b, 0x41, 0xb4, 0x4e, 0x48,
+			0x26, 0xad, 0x6d, 0xaf, 0xed, 0xec, 0x0c, 0x92,
+			0xe0, 0x68, 0x38, 0x97, 0x6e, 0x5c, 0xef, 0xb8,
+			0xcb, 0x54, 0x1e, 0x70, 0x33, 0xd0, 0x1b, 0x2d,
+			0xdb, 0x86, 0xe6, 0x3a, 0xe2, 0x9a, 0x00, 0xa8,
+			0xd6, 0xfe, 0x1c, 0x9a, 0x85, 0xd6, 0x05, 0x03,
+			0xc2, 0x80, 0x1c, 0xaa, 0x09, 0xf9, 0x42, 0xb2,
+			0xe5, 0x15, 0x99, 0x82, 0xbb, 0x12, 0x31, 0x26,
+			0xbc, 0x58, 0xff, 0x1c, 0x92, 0x7e, 0xfa, 0x75,
+			0x21, 0x5c, 0xc9, 0x65, 0x55, 0x17, 0xa5, 0x40,
+			0x29, 0xa4, 0x06, 0x6f, 0xf0, 0x50, 0x50, 0x6d,
+			0xb5, 0x19, 0x1b, 0xb7, 0x31, 0x60, 0xe5, 0xfc,
+			0xe7, 0x4e, 0x4b, 0xfb, 0x71, 0xfa, 0xc0, 0x93,
+			0xe4, 0x91, 0xb4, 0x8e, 0x97, 0x8c, 0x14, 0x69,
+			0x0e, 0xe9, 0xf9, 0x63, 0xfc, 0x94, 0xd7, 0x07,
+			0x21, 0xee, 0x36, 0xbb, 0x5f, 0x46, 0xa1, 0x7f,
+			0x29, 0x64, 0x2c, 0x3c, 0x3e, 0x12, 0x57, 0xf2,
+			0x24, 0xf5, 0x92, 0x5f, 0xaf, 0xff, 0xb5, 0x8b,
+			0xc4, 0x36, 0x9f, 0x10, 0x76, 0xd0, 0x0d, 0x24,
+			0xd3, 0xfe, 0x5f, 0xd2, 0xc9, 0xbc, 0x41, 0x91,
+			0xf1, 0x31, 0xa3, 0x84, 0xa9, 0xa1, 0xf1, 0x53,
+			0x32, 0x12, 0x71, 0xc5, 0x90, 0x82, 0xdb, 0x46,
+			0xcb, 0x77, 0xce, 0xb3, 0x11, 0xec, 0x71, 0xc7,
+			0xd5, 0x96, 0x2c, 0x6c, 0xe7, 0x6c, 0xbf, 0x52,
+			0x80, 0xf4, 0xa4, 0x39, 0x46, 0x2c, 0x73, 0x9c,
+			0x34, 0x98, 0x2d, 0xdf, 0x22, 0xa2, 0x48, 0x6a,
+			0x5f, 0x54, 0x10, 0xbc, 0x1e, 0x49, 0x6a, 0xf7,
+			0xd5, 0xfb, 0x55, 0x29, 0xa2, 0x18, 0x01, 0x6e,
+			0x32, 0xd9, 0x0d, 0x12, 0x64, 0xa7, 0x17, 0x46,
+			0x13, 0x71, 0x86, 0x96, 0xa9, 0xd4, 0xd3, 0xc5,
+			0x32, 0xfb, 0x57, 0x87, 0x3d, 0xb5, 0x04, 0x1f,
+			0xc8, 0x38, 0x1b, 0x8f, 0xd0, 0x2a, 0x81, 0x3a,
+			0xbc, 0xee, 0x53, 0x4e, 0x4e, 0x8d, 0x14, 0x23,
+			0x4a, 0xcd, 0x53, 0xe4, 0xb8, 0x68, 0xa5, 0x92,
+			0x1d, 0xf5, 0x42, 0x5c, 0x6b, 0x00, 0x55, 0xd7,
+			0x40, 0x29, 0xab, 0x06, 0x99, 0x98, 0x4a, 0x08,
+			0x40, 0xd8, 0x7d, 0xf0, 0xc0, 0x11, 0xef, 0xab,
+			0x58, 0xbd, 0xc8, 0xe6, 0x76, 0xba, 0xd8, 0xe4,
+			0x52, 0x41, 0x9f, 0x57, 0xc4, 0x34, 0x30, 0x7d,
+			0x96, 0x13, 0xa3, 0xa9, 0x85, 0xdc, 0x6e, 0xf0,
+			0x66, 0x05, 0x48, 0x06, 0x09, 0xf7, 0xc1, 0x70,
+			0x47, 0x4f, 0x17, 0x9d, 0xc9, 0xac, 0x0d, 0x33,
+			0x21, 0x5a, 0x62, 0x89, 0xf9, 0xd7, 0x5f, 0xa5,
+			0x0f, 0x14, 0x61, 0x1e, 0x47, 0xcd, 0x00, 0x09,
+			0xb5, 0x56, 0x48, 0xc5, 0xcd, 0xae, 0x2a, 0x8e,
+			0xa1, 0x07, 0x83, 0xb6, 0x78, 0xd5, 0x81, 0x47,
+			0xf9, 0x1e, 0x8f, 0x16, 0xbc, 0xc9, 0x4a, 0xa5,
+			0xb5, 0xbd, 0xec, 0x52, 0x25, 0x77, 0x03, 0x08,
+			0xc3, 0x54, 0x57, 0xb7, 0x95, 0x22, 0x02, 0x75,
+			0xb3, 0x04, 0x2e, 0x0e, 0x83, 0x3e, 0x2a, 0x42,
+			0x11, 0xaf, 0x95, 0x10, 0x5a, 0xc0, 0x79, 0x0e,
+			0x72, 0x29, 0xbf, 0x55, 0x20, 0x46, 0xcc, 0xd9,
+			0x1c, 0x61, 0x64, 0xf6, 0x6a, 0xa8, 0x5d, 0x15,
+			0xd2, 0x41, 0x43, 0x95, 0x10, 0xf7, 0x8f, 0x0b,
+			0x0e, 0x85, 0x90, 0x49, 0xc8, 0x9e, 0xc0, 0x71,
+			0x9c, 0xa4, 0x7f, 0xea, 0x98, 0xae, 0x0e, 0x93,
+			0x79, 0xa6, 0xd3, 0x0c, 0xd3, 0xe6, 0x03, 0x76,
+			0x0e, 0xa6, 0x9e, 0xcb, 0x6c, 0x78, 0x88, 0x3a,
+			0x32, 0x58, 0x56, 0x0a, 0xd1, 0x35, 0x91, 0x0e,
+			0x62, 0x28, 0xdf, 0x3a, 0xbf, 0x3a, 0x55, 0x0f,
+			0x7a, 0x0e, 0x35, 0xda, 0x09, 0x79, 0x34, 0xac,
+			0x67, 0x0b, 0xeb, 0x16, 0x2b, 0x1c, 0x67, 0x36,
+			0xe9, 0xbe, 0xd2, 0xdf, 0xa4, 0xd3, 0x8e, 0xd2,
+			0xec, 0x92, 0xc5, 0x28, 0xeb, 0xc8, 0xa2, 0xce,
+			0xc8, 0x32, 0xca, 0xdf, 0xe3, 0x25, 0x90, 0x72,
+			0x47, 0xa8, 0xbb, 0x84, 0xfb, 0xd6, 0x07, 0xee,
+			0x16, 0xe8, 0x15, 0x9a, 0x7e, 0x9a, 0x65, 0x3b,
+			0x8b, 0xf0, 0xfd, 0x93, 0x88, 0xd2, 0xa8, 0x41,
+			0x50, 0xbf, 0xca, 0x0c, 0xa8, 0x45, 0xf5, 0x97,
+			0xa3, 0xdd, 0x07, 0xd8, 0xed, 0x1b, 0x76, 0x9a,
+			0x46, 0x58, 0x1c, 0x01, 0x1e, 0x25, 0x68, 0x6d,
+			0x8a, 0x3c, 0x0f, 0x08, 0x70, 0xfe, 0xff, 0x07,
+			0xff, 0x07, 0xbc, 0x9c, 0x8e, 0x5d, 0x77, 0xeb,
+			0xbb, 0xfc, 0x6c, 0x71, 0x4b, 0xc9, 0xa6, 0xc4,
+			0xc8, 0x4c, 0x20, 0x99, 0x43, 0x05, 0x57, 0x29,
+			0xd3, 0x40, 0xd9, 0xdf, 0xf6, 0x56, 0x86, 0x9d,
+			0x6a, 0x9f, 0x10, 0xf1, 0x79, 0x1b, 0x7d, 0x87,
+			0x48, 0xf0, 0xd8, 0xa3, 0xc7, 0x16, 0x1e, 0xd6,
+			0x59, 0x57, 0xbf, 0x8c, 0xfe, 0xa0, 0x21, 0xb3,
+			0x27, 0x90, 0x5e, 0xc6, 0x6e, 0xe7, 0xe3, 0x14,
+			0x7e, 0x45, 0xc1, 0xd0, 0x55, 0x1c, 0x3b, 0x88,
+			0xa5, 0x77, 0x36, 0x29, 0x52, 0x85, 0xed, 0xd7,
+			0x81, 0x12, 0x5c, 0x3c, 0x14, 0xd4, 0xa8, 0xed,
+			0x86, 0x14, 0x31, 0xf7, 0x23, 0xca, 0xd8, 0x82,
+			0x3d, 0x69, 0x0b, 0x6e, 0xb2, 0xf9, 0x53, 0x44,
+			0x7c, 0x15, 0x72, 0x19, 0x30, 0x70, 0x5c, 0x41,
+			0xb7, 0x5b, 0x9e, 0xc2, 0xca, 0x54, 0x64, 0x4e,
+			0xdd, 0x5c, 0x41, 0x94, 0x17, 0x65, 0xe2, 0x95,
+			0x39, 0xe6, 0x60, 0x95, 0x31, 0x38, 0xe7, 0xa1,
+			0x16, 0x32, 0x7e, 0xe6, 0x4d, 0x67, 0x32, 0x89,
+			0xc6, 0x20, 0x70, 0x8b, 0x97, 0x27, 0x08, 0x86,
+			0x35, 0xc2, 0x4f, 0xbc, 0x5e, 0x02, 0x62, 0xd2,
+			0x0b, 0x0d, 0xd7, 0x42, 0x01, 0x65, 0xe7, 0xc4,
+			0x3b, 0xb9, 0xa4, 0x2c, 0x25, 0xe5, 0xba, 0x68,
+			0xae, 0xcf, 0xf7, 0x5d, 0x6c, 0xe9, 0xad, 0x50,
+			0x53, 0x62, 0x1d, 0x6f, 0x90, 0xda, 0xde, 0xb7,
+			0x35, 0xda, 0x46, 0x1b, 0xc1, 0x87, 0x10, 0x4b,
+			0xed, 0x93, 0xb4, 0xd8, 0x41, 0x8d, 0x9c, 0xc7,
+			0x66, 0x73, 0x62, 0x49, 0xbb, 0xa1, 0x67, 0x4f,
+			0xf9, 0x6a, 0xfc, 0xad, 0x2e, 0xce, 0xee, 0xb0,
+			0xe8, 0x61, 0xeb, 0x88, 0x0f, 0x4d, 0xac, 0xfe,
+			0x43, 0x8d, 0x72, 0x9a, 0xdd, 0x6a, 0xe1, 0x4f,
+			0xc3, 0xc2, 0xbe, 0x33, 0x38, 0xb7, 0xbc, 0x42,
+			0xdd, 0x2c, 0x96, 0xfb, 0x74, 0x4b, 0x74, 0x8e,
+			0x2b, 0xa3, 0x44, 0x8e, 0xaf, 0x8c, 0xed, 0x04,
+			0x3f, 0xaa, 0x05, 0x3b, 0xa6, 0x92, 0xd5, 0xf2,
+			0x11, 0xfd, 0x24, 0xa2, 0xfd, 0xc4, 0xa1, 0x7b,
+			0xae, 0x64, 0xcd, 0x79, 0x99, 0x2a, 0x1e, 0xa6,
+			0x35, 0xee, 0x25, 0x05, 0x04, 0xd9, 0x01, 0x45,
+			0x75, 0xd6, 0x5e, 0x71, 0x97, 0xc4, 0xa8, 0x8a,
+			0x93, 0xa5, 0xc6, 0xb2, 0x7d, 0x51, 0xf2, 0x52,
+			0x74, 0x3b, 0x52, 0xbc, 0xb3, 0x4d, 0xaa, 0x93,
+			0xd4, 0xce, 0xeb, 0x7b, 0x8a, 0x27, 0x79, 0xf0,
+			0xad, 0x00, 0x19, 0xfb, 0x5a, 0xa2, 0x82, 0x45,
+			0x5f, 0x5e, 0xad, 0xc5, 0xa8, 0x97, 0x75, 0x29,
+			0xb2, 0xc7, 0x68, 0xf0, 0x5a, 0x5c, 0xd7, 0xed,
+			0x26, 0x2d, 0x0c, 0x1d, 0x87, 0x59, 0xce, 0xc8,
+			0x71, 0x68, 0xac, 0x76, 0xb1, 0xbf, 0x26, 0xe7,
+			0x4f, 0x16, 0x04, 0xbb, 0x25, 0xeb, 0x5a, 0x2f,
+			0x3c, 0x39, 0x4d, 0x0d, 0x8e, 0x12, 0xbb, 0x1f,
+			0xdc, 0x3b, 0x6e, 0x20, 0xe5, 0xab, 0x62, 0xdc,
+			0xb1, 0x06, 0xbd, 0xe4, 0x62, 0x49, 0xe7, 0xd0,
+			0xdd, 0x40, 0x6c, 0x89, 0xff, 0x9e, 0x29, 0x7c,
+			0x8c, 0x3b, 0x15, 0x81, 0x6d, 0xe8, 0xc0, 0x07,
+			0x4c, 0x05, 0x65, 0xca, 0x73, 0xf8, 0x7c, 0x54,
+			0xe9, 0x4b, 0xb3, 0x4c, 0xd7, 0xd4, 0xf7, 0xd7,
+			0x89, 0xe9, 0xbe, 0xc9, 0x4f, 0xe8, 0x6c, 0x16,
+			0x3a, 0xe5, 0x8e, 0x8c, 0x03, 0xe2, 0xe1, 0xa8,
+			0xac, 0x02, 0x6c, 0x73, 0x55, 0x1d, 0xea, 0xea,
+			0xfe, 0x88, 0x84, 0x5d, 0xe5, 0xb2, 0x90, 0xc4,
+			0x06, 0x89, 0xc9, 0x8d, 0x3e, 0x9d, 0x08, 0xd4,
+			0x88, 0x9b, 0x07, 0xbe, 0xe4, 0x2f, 0x7c, 0xcf,
+			0x12, 0x09, 0xe2, 0x8e, 0xbd, 0x74, 0x08, 0xe8,
+			0x51, 0x07, 0xe5, 0xac, 0x55, 0x9c, 0xe5, 0xee,
+			0x1d, 0x9d, 0xee, 0x88, 0x99, 0x78, 0x20, 0xf7,
+			0xa8, 0x48, 0xef, 0x14, 0xce, 0xf1, 0x40, 0xeb,
+			0x8e, 0x36, 0x45, 0x2c, 0xcd, 0xdd, 0x8b, 0x51,
+			0x02, 0x4b, 0x5c, 0xd2, 0xe6, 0xaa, 0x90, 0x8f,
+			0xeb, 0x86, 0x4a, 0x9b, 0x33, 0x4d, 0x04, 0x02,
+			0xd8, 0x05, 0x8f, 0x8e, 0x3a, 0x09, 0xde, 0x98,
+			0xb9, 0x6d, 0x4c, 0x60, 0x42, 0x69, 0xc1, 0x2a,
+			0x1d, 0x65, 0xf7, 0xe0, 0x3f, 0x30, 0xe4, 0x83,
+			0x3c, 0x03, 0xda, 0xde, 0x0c, 0x1e, 0x74, 0x1b,
+			0x60, 0x55, 0x30, 0x01, 0x3f, 0xe6, 0x3b, 0xa2,
+			0x3c, 0xcb, 0x88, 0x84, 0xc3, 0xb3, 0x1a, 0xfd,
+			0x1d, 0xae, 0x94, 0xfb, 0xa1, 0xd5, 0x17, 0x9d,
+			0xf8, 0x40, 0xe6, 0x89, 0xa5, 0x1f, 0xeb, 0x99,
+			0x7c, 0xdf, 0x61, 0x8d, 0x3c, 0xf8, 0xfb, 0x48,
+			0x33, 0xf8, 0x43, 0x8b, 0x83, 0x0f, 0x2e, 0x88,
+			0x4a, 0x8a, 0x14, 0x47, 0x36, 0xa1, 0xd8, 0x49,
+			0x3e, 0xb2, 0xa5, 0x2c, 0x28, 0x23, 0x4c, 0x1b,
+			0x0f, 0x60, 0x59, 0xa6, 0x37, 0x99, 0x1e, 0x35,
+			0x0f, 0xcf, 0x79, 0x09, 0x4e, 0x18, 0x8e, 0x34,
+			0x68, 0x44, 0x18, 0xab, 0x63, 0x3f, 0x4a, 0x75,
+			0xc1, 0xf4, 0x31, 0xd8, 0xe9, 0x7d, 0xa0, 0x9d,
+			0xf3, 0xce, 0x4a, 0x9e, 0x9e, 0xdc, 0xa2, 0xa9,
+			0x41, 0xd2, 0x7c, 0xb7, 0xc9, 0xc3, 0x9d, 0x05,
+			0x99, 0x44, 0xc8, 0x59, 0xcd, 0xc8, 0x73, 0xf4,
+			0x52, 0x4e, 0x99, 0x7a, 0xa2, 0x62, 0x33, 0x0e,
+			0x85, 0x39, 0x27, 0xb9, 0xa0, 0x9c, 0xa4, 0x35,
+			0x4d, 0x26, 0xe9, 0x4f, 0x33, 0x6a, 0x83, 0x6f,
+			0x76, 0x79, 0x81, 0x0f, 0x01, 0xfa, 0xf8, 0xa1,
+			0x4b, 0xe2, 0x89, 0x2a, 0x87, 0xde, 0x63, 0x17,
+			0x41, 0x71, 0xd7, 0xd8, 0xf3, 0x84, 0x8a, 0x19,
+			0xb6, 0x24, 0x6c, 0x50, 0xc6, 0x35, 0xc8, 0x2f,
+			0xe6, 0xde, 0x6e, 0x6a, 0xde, 0x85, 0xad, 0x3b,
+			0x29, 0xa5, 0xe0, 0x89, 0xae, 0x19, 0x2d, 0xb1,
+			0x97, 0xe5, 0xe7, 0x8d, 0x18, 0x8c, 0xa0, 0xe2,
+			0x05, 0xc8, 0x3b, 0xda, 0x59, 0xef, 0x74, 0xe0,
+			0xed, 0x91, 0x88, 0x69, 0x68, 0xde, 0xb4, 0x2a,
+			0x11, 0x33, 0x80, 0x77, 0xb5, 0x80, 0x37, 0x54,
+			0x63, 0x5a, 0xf3, 0x66, 0xd8, 0x68, 0x60, 0xf4,
+			0xfe, 0x4c, 0x2e, 0x7a, 0xf1, 0xeb, 0x42, 0xef,
+			0xf9, 0x46, 0x88, 0x93, 0x7b, 0x5d, 0xb8, 0xad,
+			0x22, 0x90, 0xd8, 0x14, 0x32, 0xff, 0xc3, 0x67,
+			0x1a, 0x0f, 0xda, 0x69, 0xcf, 0x8f, 0x5a, 0x18,
+			0xde, 0x10, 0x55, 0x5a, 0x8c, 0x89, 0x36, 0x67,
+			0xbe, 0x39, 0x6e, 0x2a, 0xc4, 0x8c, 0xc3, 0xb0,
+			0x8f, 0x59, 0x8a, 0xca, 0x20, 0xfe, 0xd4, 0x62,
+			0xf4, 0x61, 0x69, 0xd3, 0x20, 0x77, 0x51, 0xbd,
+			0x9a, 0x89, 0x61, 0x9f, 0x52, 0x73, 0xf5, 0xd4,
+			0xae, 0x36, 0xe8, 0xcb, 0x66, 0xd3, 0xdf, 0x4f,
+			0xcb, 0xff, 0xdb, 0x32, 0xa7, 0x10, 0xa8, 0x04,
+			0x3d, 0x15, 0xc3, 0xe6, 0xd7, 0x26, 0x1e, 0xff,
+			0x45, 0x36, 0xe0, 0x15, 0x09, 0x40, 0xd0, 0x02,
+			0xf3, 0x70, 0xf5, 0x3a, 0x79, 0x6a, 0x31, 0xfb,
+			0x13, 0x9a, 0x80, 0x84, 0xae, 0x81, 0x37, 0xa8,
+			0x86, 0xae, 0xbb, 0xf2, 0xf0, 0x14, 0x64, 0x3c,
+			0xa7, 0x9e, 0xd6, 0xcc, 0xf4, 0x0f, 0x84, 0xf4,
+			0xf1, 0x95, 0x9a, 0x72, 0xd4, 0x32, 0xb0, 0xbf,
+			0x86, 0x0b, 0x82, 0xf9, 0x89, 0xf9, 0x64, 0x97,
+			0xa3, 0x8b, 0x75, 0xca, 0xe3, 0x79, 0xc4, 0x75,
+			0xe6, 0xdb, 0xad, 0xdc, 0xe9, 0x32, 0x05, 0x5b,
+			0xc6, 0xd1, 0xf1, 0x53, 0xc0, 0x1c, 0xa3, 0x8a,
+			0x5c, 0xee, 0xc3, 0xea, 0x29, 0x95, 0x56, 0x3b,
+			0xd8, 0xe6, 0x18, 0xd9, 0x6a, 0xe5, 0x4a, 0x84,
+			0x59, 0xc2, 0x21, 0x20, 0xeb, 0x1a, 0x0e, 0x32,
+			0x2f, 0x02, 0xc2, 0xe3, 0x92, 0x6a, 0x5d, 0x70,
+			0x75, 0x19, 0xad, 0x69, 0x73, 0x90, 0xc3, 0x02,
+			0x3f, 0x27, 0xcd, 0x80, 0x08, 0x79, 0x18, 0x9e,
+			0xb9, 0xa0, 0x20, 0x0f, 0xa3, 0x96, 0xc6, 0x0d,
+			0x7c, 0x5a, 0x51, 0x05, 0x67, 0x14, 0x28, 0x53,
+			0x74, 0xbf, 0x37, 0x6b, 0x8f, 0x0c, 0x1d, 0xf8,
+			0xfb, 0x74, 0x89, 0x28, 0xe3, 0x71, 0x0c, 0xab,
+			0x2a, 0xcc, 0x28, 0xea, 0x5a, 0x11, 0x2b, 0x58,
+			0xe7, 0x89, 0x12, 0x2b, 0xf9, 0x2c, 0x21, 0x8d,
+			0x9b, 0xa0, 0x39, 0x8f, 0x73, 0xac, 0xd6, 0x3e,
+			0x63, 0x6a, 0x57, 0x61, 0xcf, 0x42, 0x17, 0x4c,
+			0x82, 0x95, 0x4e, 0x8c, 0xf9, 0xbc, 0x95, 0xae,
+			0x2f, 0x33, 0x17, 0x77, 0xb3, 0xc2, 0x2d, 0xfa,
+			0x9d, 0x22, 0x91, 0x52, 0x87, 0x8a, 0x9c, 0x27,
+			0x0e, 0x23, 0xa5, 0xe2, 0x34, 0xd0, 0x3c, 0xf0,
+			0x8b, 0xdf, 0x75, 0x31, 0xfa, 0xed, 0x5b, 0xfc,
+			0x03, 0x0b, 0x81, 0x2c, 0x23, 0xc3, 0xf3, 0x52,
+			0x4f, 0x60, 0xb0, 0x6c, 0x68, 0x86, 0xc8, 0xc9,
+			0x73, 0x75, 0xb5, 0x07, 0x46, 0x86, 0x54, 0x76,
+			0x03, 0x70, 0x9a, 0x5c, 0x6f, 0x1a, 0xec, 0x37,
+			0xd1, 0xd2, 0xd6, 0x2a, 0xd8, 0x4f, 0x1a, 0x5d,
+			0x1a, 0xe2, 0x0a, 0xb1, 0x90, 0x17, 0x65, 0xcc,
+			0x18, 0xd9, 0xc3, 0x31, 0xf3, 0x33, 0x87, 0xc6,
+			0xd3, 0xf0, 0xdc, 0xd8, 0x20, 0x07, 0xc2, 0x1e,
+			0xa9, 0xf2, 0x52, 0x3b, 0xf5, 0x3a, 0xe9, 0x2a,
+			0x46, 0x99, 0x33, 0xd3, 0x5c, 0xe5, 0x25, 0x77,
+			0x67, 0x17, 0x1f, 0x13, 0x68, 0x82, 0xe0, 0x56,
+			0x5e, 0x69, 0xdd, 0xdf, 0x6f, 0x62, 0xe2, 0x24,
+			0x93, 0x4d, 0x8a, 0xb4, 0xeb, 0xf5, 0x7a, 0x86,
+			0x2b, 0x5a, 0x0b, 0x4f, 0xdf, 0x8f, 0x74, 0x76,
+			0xfe, 0xd0, 0xe2, 0x1f, 0x3a, 0x7a, 0x71, 0x57,
+			0xdd, 0xdb, 0x14, 0x1b, 0xed, 0xe8, 0xfe, 0x1e,
+			0x90, 0xbd, 0xd3, 0xe9, 0x11, 0xe8, 0x29, 0x1e,
+			0xe1, 0x9e, 0x69, 0x43, 0xb2, 0xb4, 0xb2, 0x22,
+			0xca, 0xce, 0xdf, 0x98, 0xd7, 0xf0, 0xdb, 0x44,
+			0x58, 0x39, 0x8f, 0x42, 0xd5, 0xae, 0x17, 0x4f,
+			0x5d, 0xe4, 0xe1, 0x33, 0xa4, 0x44, 0x93, 0xcf,
+			0x5d, 0x83, 0x05, 0x70, 0x26, 0x84, 0x5a, 0xad,
+			0x04, 0x44, 0x44, 0x63, 0xae, 0xd7, 0x33, 0x9d,
+			0x62, 0x44, 0x64, 0xae, 0x0d, 0xe0, 0x11, 0xc3,
+			0x92, 0x85, 0x86, 0xf2, 0x6a, 0xca, 0x30, 0x0e,
+			0xd1, 0x60, 0xcd, 0x09, 0x84, 0xd9, 0xa9, 0x27,
+			0x89, 0x66, 0x30, 0x7e, 0xec, 0x5c, 0x17, 0x1e,
+			0x90, 0xef, 0xf0, 0x69, 0x50, 0xbb, 0xde, 0x35,
+			0x88, 0xb4, 0xea, 0xce, 0x6c, 0x9f, 0x75, 0xc4,
+			0xaa, 0x5e, 0x5d, 0x3e, 0xf3, 0x84, 0xad, 0xb8,
+			0x47, 0x45, 0xfb, 0x83, 0x8f, 0xe5, 0xe8, 0xfc,
+			0xe7, 0x35, 0x7f, 0xdd, 0xc6, 0xcd, 0xb2, 0xad,
+			0x71, 0x9c, 0x11, 0xc9, 0xdf, 0xcc, 0xac, 0x23,
+			0xb4, 0x09, 0x1e, 0xf2, 0x3f, 0xbe, 0xbe, 0xb4,
+			0x71, 0x44, 0x65, 0xff, 0x83, 0xcf, 0x10, 0x46,
+			0x2b, 0x86, 0xc1, 0x5f, 0x15, 0xe0, 0x2d, 0x1e,
+			0xa1, 0xe4, 0x2d, 0x7a, 0x02, 0x68, 0x1b, 0xe3,
+			0x32, 0x53, 0xa5, 0x0c, 0x95, 0xff, 0x8c, 0x28,
+			0x07, 0x1d, 0x94, 0x28, 0x98, 0x27, 0xfd, 0x75,
+			0x44, 0xbb, 0xa9, 0x03, 0xaa, 0xa9, 0xdd, 0x0d,
+			0x2f, 0x54, 0xa0, 0x36, 0xe5, 0x7f, 0xad, 0x23,
+			0xea, 0x1c, 0x6d, 0xfe, 0x0c, 0x18, 0x1a, 0xff,
+			0xed, 0x75, 0xd9, 0xb1, 0xbd, 0x4f, 0x2d, 0x02,
+			0x9f, 0x28, 0x5d, 0x23, 0x85, 0xff, 0xf7, 0xcb,
+			0xcd, 0xe9, 0xa6, 0xd3, 0x56, 0x59, 0x38, 0x38,
+			0x22, 0xa9, 0xa9, 0x4f, 0x6c, 0x72, 0x73, 0x1d,
+			0x1b, 0x25, 0xf1, 0x30, 0x26, 0x64, 0xbd, 0xe6,
+			0xc3, 0x06, 0xf7, 0x1b, 0xb3, 0xeb, 0xcb, 0x51,
+			0x2f, 0xbf, 0xa1, 0x07, 0xc9, 0x3c, 0x27, 0x58,
+			0xce, 0xc5, 0x87, 0x3c, 0x54, 0xf0, 0x67, 0xb7,
+			0x08, 0x79, 0xb8, 0x6b, 0xdc, 0xd8, 0x45, 0x88,
+			0x35, 0xd9, 0x82, 0x76, 0xe6, 0x17, 0xa9, 0xf0,
+			0x1c, 0x22, 0x10, 0xa3, 0x04, 0x21, 0xdb, 0x59,
+			0x4b, 0xf8, 0x33, 0x09, 0x30, 0xf7, 0xfe, 0x13,
+			0xf9, 0xef, 0xbf, 0x12, 0xe5, 0x79, 0x0f, 0x82,
+			0x65, 0x6e, 0x28, 0x0c, 0xb3, 0xff, 0x44, 0x7d,
+			0x59, 0x8a, 0x0e, 0xa1, 0x93, 0x5c, 0x58, 0xe7,
+			0xd0, 0x28, 0xda, 0x62, 0x5a, 0x7c, 0x9d, 0x88,
+			0xb5, 0x31, 0x7a, 0x4f, 0x59, 0xe6, 0x63, 0x2c,
+			0xb6, 0xd4, 0x45, 0xe6, 0xb9, 0x7b, 0xc1, 0x38,
+			0x66, 0x53, 0x49, 0x21, 0x5c, 0xa0, 0x50, 0xe7,
+			0xc4, 0x37, 0x94, 0x1e, 0xb5, 0xcc, 0x85, 0xb8,
+			0x7c, 0x36, 0x7f, 0x27, 0x47, 0x40, 0x14, 0x47,
+			0xea, 0xe8, 0x72, 0x8b, 0x08, 0x3f, 0x27, 0x5f,
+			0xaa, 0x4d, 0xe9, 0x40, 0x74, 0x0c, 0x75, 0xcf,
+			0x10, 0xbf, 0x6b, 0x1f, 0x22, 0x04, 0x26, 0x78,
+			0xb4, 0xf8, 0xb9, 0xc5, 0x8e, 0x77, 0xdc, 0xe0,
+			0x75, 0xa3, 0xe2, 0x4e, 0xee, 0xc2, 0x69, 0xcf,
+			0x81, 0x99, 0x0c, 0x3f, 0x05, 0xce, 0xdd, 0x0a,
+			0x60, 0x7d, 0x05, 0x30, 0xcd, 0x60, 0x63, 0xbb,
+			0x9b, 0x3c, 0x60, 0xd6, 0x52, 0xab, 0xaf, 0x10,
+			0x3d, 0x2d, 0xa3, 0x6b, 0x41, 0xb4, 0x00, 0x9c,
+			0xdc, 0x39, 0x47, 0xff, 0x75, 0x1e, 0x2e, 0xcb,
+			0x87, 0x9e, 0x8d, 0xdd, 0xdb, 0xee, 0x74, 0xe9,
+			0xec, 0x23, 0xf1, 0xfa, 0x0d, 0x93, 0x3e, 0x95,
+			0xfb, 0x85, 0xa8, 0xfc, 0xd0, 0xc9, 0x3d, 0x07,
+			0x32, 0x34, 0x97, 0x7d, 0x61, 0xc8, 0x0d, 0xef,
+			0xeb, 0x24, 0xe3, 0x4b, 0x1e, 0x06, 0x73, 0x92,
+			0xd0, 0xd0, 0x9a, 0xb6, 0xfa, 0x7d, 0xc9, 0x7f,
+			0xf6, 0xb7, 0x69, 0x5f, 0xfc, 0xf2, 0x3b, 0xfd,
+			0x66, 0x2f, 0x6b, 0x48, 0xe8, 0xa7, 0x53, 0x3e,
+			0x69, 0xd0, 0xa9, 0x79, 0xd0, 0x0c, 0xf1, 0xbc,
+			0x31, 0xcb, 0x21, 0xf0, 0x45, 0x4e, 0xb8, 0x8a,
+			0x16, 0xd4, 0xe9, 0x80, 0x59, 0x15, 0x56, 0xda,
+			0x31, 0x02, 0xcd, 0xaa, 0x10, 0x40, 0x1a, 0xf1,
+			0xb6, 0x68, 0x24, 0x45, 0x9c, 0xdc, 0x74, 0xa1,
+			0x42, 0x62, 0xba, 0xb2, 0x84, 0x0b, 0xfb, 0xf5,
+			0xb5, 0x61, 0x3b, 0xb6, 0x02, 0xaf, 0x53, 0x58,
+			0x92, 0x0b, 0xc1, 0x2a, 0xd5, 0x00, 0xa6, 0x3b,
+			0x4a, 0x80, 0x37, 0x97, 0xeb, 0xec, 0xfd, 0x64,
+			0x7e, 0xba, 0xb9, 0x7d, 0x82, 0xf7, 0x39, 0x30,
+			0xfd, 0x5a, 0xfa, 0x9a, 0x8a, 0x5e, 0x01, 0xce,
+			0x17, 0xf3, 0xe2, 0x13, 0x8f, 0x03, 0xc7, 0xfb,
+			0x97, 0x5e, 0x3b, 0x1a, 0x3f, 0x6a, 0x2d, 0x00,
+			0xfc, 0xb3, 0x9e, 0xe5, 0x3d, 0x5c, 0x5b, 0x59,
+			0x4d, 0x77, 0x25, 0x19, 0xde, 0x98, 0x9e, 0x63,
+			0x56, 0xa1, 0x30, 0xa5, 0xc2, 0x82, 0x82, 0xaa,
+			0xbe, 0xbf, 0xcb, 0x8b, 0x6f, 0xcb, 0x0f, 0xca,
+			0x80, 0x69, 0xdd, 0x7f, 0x78, 0x62, 0x6a, 0x61,
+			0x7c, 0x99, 0x94, 0x45, 0xbf, 0x6e, 0x26, 0xb3,
+			0xb2, 0xf7, 0x8c, 0x28, 0x25, 0x70, 0x4b, 0x32,
+			0x04, 0x0e, 0xf1, 0xe6, 0x3f, 0x2b, 0x16, 0x2f,
+			0x73, 0x6f, 0x17, 0x45, 0x7d, 0x27, 0xa4, 0x9a,
+			0x22, 0x18, 0x6d, 0x70, 0xf9, 0xca, 0x63, 0x78,
+			0x1f, 0xc9, 0xc8, 0xac, 0x08, 0xec, 0x42, 0xa0,
+			0x88, 0xdd, 0xda, 0x13, 0x14, 0xe4, 0xa4, 0xff,
+			0xeb, 0x84, 0xd8, 0x97, 0x4a, 0xbc, 0x6b, 0x60,
+			0x08, 0x04, 0x15, 0x54, 0x38, 0xd9, 0x3d, 0xbc,
+			0x3a, 0x30, 0x2c, 0xd5, 0x70, 0x96, 0xdc, 0xf8,
+			0xcf, 0x00, 0x8a, 0xc2, 0x10, 0xd5, 0x60, 0x45,
+			0x8f, 0x8b, 0xa1, 0x73, 0xcc, 0x09, 0xf6, 0x71,
+			0x76, 0x88, 0x83, 0xd8, 0x57, 0xb5, 0xd4, 0xf6,
+			0xeb, 0x46, 0xb4, 0xff, 0x09, 0xaa, 0xca, 0x33,
+			0x0c, 0xca, 0xec, 0x7c, 0xed, 0x4a, 0x30, 0xab,
+			0x04, 0x98, 0x14, 0x74, 0xe0, 0xda, 0x9c, 0x83,
+			0xf2, 0x61, 0x4f, 0x9d, 0x8a, 0x5e, 0x8e, 0xe7,
+			0xac, 0xa5, 0xcb, 0x61, 0x6f, 0x30, 0xe6, 0x76,
+			0xe5, 0xf1, 0x0c, 0x23, 0xb3, 0x13, 0x08, 0x0e,
+			0xbb, 0xc2, 0x75, 0x72, 0xb6, 0xe1, 0x9b, 0xd6,
+			0xf2, 0x91, 0x83, 0xae, 0x9f, 0x8d, 0x18, 0xfb,
+			0x5a, 0xa5, 0x77, 0xd8, 0x98, 0x53, 0x6b, 0x41,
+			0x9d, 0x88, 0x81, 0x68, 0x0a, 0x4e, 0x52, 0x74,
+			0x1b, 0x1e, 0x4a, 0x9c, 0xa7, 0x8d, 0x78, 0x2a,
+			0x19, 0xde, 0x05, 0xd5, 0x28, 0x6a, 0x4c, 0xe4,
+			0x4a, 0xdd, 0x40, 0x8b, 0x2e, 0x12, 0x2f, 0x42,
+			0x88, 0x3e, 0xfb, 0x9b, 0x6e, 0xc7, 0xe4, 0xb5,
+			0xc6, 0x40, 0x5a, 0x5b, 0xd5, 0xc9, 0x82, 0x1a,
+			0x2f, 0xd0, 0x21, 0xce, 0x39, 0x5f, 0x20, 0xce,
+			0x15, 0x36, 0xd9, 0xa2, 0xfd, 0xb8, 0x5c, 0x19,
+			0x6a, 0x30, 0x42, 0xe0, 0x81, 0xb4, 0xdb, 0xe3,
+			0x10, 0xf4, 0x3e, 0x9a, 0xc5, 0x15, 0x56, 0x73,
+			0x04, 0xff, 0x47, 0xa3, 0x00, 0x7e, 0x85, 0x01,
+			0x8a, 0x99, 0x55, 0x75, 0xf9, 0xc1, 0xf8, 0x99,
+			0x74, 0x2a, 0x0a, 0x02, 0xe6, 0x3c, 0x1f, 0x80,
+			0xea, 0x44, 0xfc, 0x33, 0x5b, 0xb1, 0xfa, 0x37,
+			0x27, 0x74, 0x5c, 0xf7, 0x11, 0x29, 0x1c, 0x1c,
+			0x6f, 0x6e, 0xda, 0xdc, 0x17, 0x68, 0xde, 0xa3,
+			0x11, 0xf7, 0xd2, 0x86, 0x76, 0xbc, 0xc3, 0x11,
+			0xde, 0x89, 0xf2, 0xd6, 0x64, 0x07, 0x9d, 0x4a,
+			0x64, 0x96, 0xcc, 0xa6, 0xed, 0x69, 0xa8, 0xd1,
+			0x9d, 0x7e, 0x63, 0xdf, 0xed, 0xab, 0x1a, 0x87,
+			0xb5, 0xd1, 0xd7, 0xe9, 0x3f, 0x39, 0x56, 0x93,
+			0xdd, 0xe4, 0xb4, 0x5f, 0xc9, 0x27, 0xd1, 0x2c,
+			0xb5, 0x82, 0x2e, 0x6b, 0x1c, 0x41, 0x2e, 0x2d,
+			0x55, 0xcb, 0x99, 0x09, 0xeb, 0xa5, 0x79, 0xa1,
+			0x58, 0xf1, 0xf5, 0x3e, 0xf0, 0x42, 0xad, 0xfe,
+			0x1f, 0x6d, 0x8b, 0x93, 0xe5, 0x2c, 0x4a, 0xa3,
+			0xe5, 0x0d, 0xfb, 0xc7, 0x8a, 0xb0, 0x2f, 0x78,
+			0x29, 0x7a, 0x86, 0x2d, 0x18, 0x40, 0x94, 0xe1,
+			0xd5, 0xb1, 0xf3, 0x71, 0xf2, 0x87, 0xb7, 0xe9,
+			0x11, 0xc4, 0x7d, 0xbd, 0x93, 0x6c, 0x0f, 0xd3,
+			0xba, 0x28, 0x01, 0x6a, 0x91, 0x8d, 0x8c, 0xb2,
+			0xca, 0x7c, 0xe8, 0x71, 0xa6, 0xc8, 0xd8, 0xdd,
+			0xf5, 0xbf, 0xe3, 0x41, 0xd0, 0x90, 0xe4, 0x3c,
+			0xca, 0xf4, 0x80, 0x6a, 0x43, 0x13, 0xe0, 0xbb,
+			0x11, 0x00, 0xe6, 0x13, 0x2b, 0x22, 0xb3, 0xd6,
+			0x62, 0x4c, 0x5c, 0xa1, 0xfe, 0xdd, 0xc9, 0x42,
+			0xef, 0x7a, 0x5e, 0x12, 0x8c, 0x0a, 0x0f, 0x6a,
+			0x0c, 0x7a, 0xa2, 0x73, 0x2f, 0x6f, 0xf1, 0x28,
+			0xad, 0x9c, 0xb9, 0x62, 0x7f, 0xff, 0x5e, 0xa7,
+			0x26, 0xf0, 0xfa, 0x1b, 0xad, 0x81, 0x71, 0x0a,
+			0xcb, 0x01, 0x74, 0x6a, 0xf5, 0xd8, 0x92, 0xde,
+			0xf9, 0x5a, 0x63, 0xbf, 0x7f, 0x1d, 0xb5, 0xc7,
+			0x8a, 0xe7, 0x56, 0xaa, 0x25, 0x47, 0xbe, 0x8d,
+			0x99, 0x20, 0xf2, 0xf2, 0xb1, 0x63, 0x08, 0xcd,
+			0x37, 0xc9, 0xfb, 0x22, 0xe9, 0x8e, 0xcf, 0xc5,
+			0x49, 0x04, 0xc8, 0xf8, 0x63, 0xbe, 0xde, 0x2f,
+			0xd3, 0xd4, 0xb7, 0x47, 0xbb, 0xde, 0xef, 0x1b,
+			0x1f, 0xfa, 0x80, 0x49, 0x64, 0x8c, 0xa2, 0xdf,
+			0xa9, 0xe4, 0xbe, 0xe1, 0xce, 0x61, 0x7d, 0x8b,
+			0xef, 0x66, 0x3c, 0x90, 0xee, 0x7d, 0xaf, 0xf7,
+			0x42, 0x8f, 0x1f, 0xba, 0x52, 0x3f, 0xd7, 0xc0,
+			0xbb, 0x2a, 0xec, 0x74, 0xbf, 0x5b, 0xfd, 0x6a,
+			0xc7, 0xe9, 0x27, 0x55, 0xd5, 0x43, 0xdc, 0x92,
+			0x05, 0x89, 0x69, 0x46, 0xf0, 0xbb, 0xfe, 0x51,
+			0xdc, 0xb6, 0x36, 0x69, 0xae, 0xd4, 0x0b, 0x47,
+			0xe3, 0x92, 0x89, 0x1e, 0x00, 0x56, 0xb7, 0x27,
+			0x37, 0x89, 0x84, 0x11, 0xf5, 0x89, 0xff, 0xe5,
+			0x19, 0x8b, 0x39, 0x2a, 0xa8, 0x48, 0x84, 0x69,
+			0xc3, 0x3a, 0x61, 0x77, 0x40, 0x71, 0x63, 0x95,
+			0x40, 0xab, 0xc6, 0x93, 0x3b, 0x4e, 0x45, 0x4e,
+			0xe0, 0x65, 0x23, 0xe3, 0xb3, 0x1a, 0x9a, 0xa7,
+			0x50, 0x01, 0x75, 0x74, 0xb9, 0xdc, 0x8d, 0xbe,
+			0x48, 0xdb, 0x6f, 0x67, 0x26, 0x3c, 0x9f, 0xf5,
+			0x35, 0xd7, 0xac, 0x72, 0xf0, 0x5f, 0x90, 0xe1,
+			0xa5, 0x32, 0x18, 0x41, 0xb0, 0x88, 0x11, 0x5c,
+			0x70, 0xb8, 0x2a, 0x86, 0x82, 0xe3, 0x7e, 0x4f,
+			0x54, 0xa1, 0xd0, 0x29, 0xd0, 0xbf, 0x99, 0x90,
+			0x07, 0x2c, 0xd3, 0x51, 0x7e, 0xaf, 0xe4, 0x92,
+			0xa0, 0xc9, 0xf4, 0xcb, 0x09, 0x6f, 0xe0, 0xd5,
+			0xd6, 0x0c, 0x49, 0x8b, 0xe2, 0xfb, 0xc4, 0xca,
+			0xdd, 0xba, 0x7a, 0xff, 0xeb, 0x19, 0x87, 0xea,
+			0x73, 0xcf, 0x23, 0x65, 0x88, 0x57, 0x7b, 0x04,
+			0xc1, 0x0f, 0x43, 0xdc, 0x43, 0x73, 0x9d, 0xdf,
+			0x13, 0x56, 0x59, 0x61, 0xed, 0xac, 0x29, 0x94,
+			0xd4, 0xb4, 0x54, 0x04, 0x55, 0xf5, 0xa4, 0xd9,
+			0xa1, 0x73, 0x9e, 0x77, 0x45, 0xfe, 0x4d, 0x92,
+			0x6a, 0xd2, 0xfd, 0xa3, 0x1b, 0x4f, 0x77, 0x18,
+			0x4b, 0xa4, 0x6f, 0xd9, 0x18, 0x44, 0x7c, 0x38,
+			0x52, 0xb3, 0x99, 0x17, 0x97, 0xc3, 0x50, 0x7c,
+			0x41, 0x85, 0x96, 0x87, 0x93, 0x90, 0x84, 0x3e,
+			0xe5, 0x64, 0xa6, 0xb2, 0xdf, 0x2c, 0xe5, 0x30,
+			0x6f, 0x69, 0x11, 0xbd, 0xfb, 0x97, 0xba, 0x3b,
+			0x1c, 0x76, 0xf7, 0x75, 0x71, 0xf5, 0xe8, 0x0e,
+			0x51, 0xac, 0x9d, 0x76, 0x30, 0x76, 0x2c, 0x59,
+			0x70, 0x9e, 0xdf, 0x7e, 0xae, 0xd1, 0x83, 0xcf,
+			0xd8, 0xa7, 0xd0, 0xdf, 0xcc, 0x6e, 0xf4, 0xdb,
+			0xf1, 0x93, 0xb9, 0x40, 0x22, 0x3d, 0xa3, 0x24,
+			0x88, 0x13, 0x85, 0xf1, 0xdb, 0x8b, 0xc2, 0x39,
+			0xbc, 0x11, 0xd9, 0x90, 0x2a, 0x07, 0xe5, 0xd3,
+			0xc7, 0x2e, 0x12, 0x28, 0x2c, 0x73, 0xa2, 0x45,
+			0x80, 0xab, 0x6f, 0x43, 0x03, 0x56, 0xbc, 0x18,
+			0xb7, 0x40, 0x1d, 0x99, 0x3f, 0x84, 0xd9, 0x90,
+			0x45, 0x42, 0x00, 0x59, 0x4e, 0x4e, 0xce, 0x5a,
+			0x2b, 0x99, 0x31, 0x2a, 0xf5, 0xd8, 0x96, 0x73,
+			0xc2, 0xc8, 0x61, 0xc9, 0xcd, 0x6d, 0xad, 0x42,
+			0xfa, 0x75, 0x82, 0xe4, 0xd1, 0xb9, 0xbf, 0x7f,
+			0xdd, 0xfd, 0x87, 0x32, 0x1e, 0x78, 0x02, 0xcb,
+			0xe8, 0xad, 0x38, 0xa9, 0x95, 0x23, 0x34, 0x22,
+			0xca, 0x68, 0x78, 0xe3, 0x1e, 0xa4, 0xcf, 0x05,
+			0x36, 0xf6, 0x7b, 0x8e, 0x29, 0x30, 0x9a, 0x7b,
+			0x72, 0x5e, 0xd0, 0x5a, 0x5a, 0xaf, 0x22, 0xc3,
+			0xef, 0xc9, 0x1b, 0xe5, 0xca, 0x51, 0x62, 0xbf,
+			0x5c, 0x81, 0x73, 0xb2, 0xaa, 0x59, 0xb5, 0x25,
+			0x6e, 0x06, 0x4b, 0x61, 0x15, 0x17, 0x8c, 0x65,
+			0xbe, 0x27, 0xf7, 0xc2, 0x37, 0x37, 0x19, 0xb1,
+			0x07, 0x66, 0x21, 0x61, 0xf8, 0xd4, 0xb3, 0xaf,
+			0x7b, 0xee, 0x93, 0x61, 0xaf, 0x14, 0xf1, 0xa6,
+			0x14, 0x01, 0xc3, 0x62, 0x15, 0x5c, 0x7f, 0x12,
+			0xb0, 0x80, 0x24, 0x4e, 0x94, 0x59, 0x19, 0x01,
+			0xf7, 0xa7, 0xb6, 0x02, 0x08, 0xfb, 0x22, 0xc5,
+			0x1d, 0xea, 0x83, 0xc5, 0xb5, 0xbd, 0xbd, 0x2d,
+			0xc3, 0x01, 0xa6, 0xa5, 0x72, 0xf1, 0xba, 0x69,
+			0xee, 0x68, 0xbb, 0xa3, 0x3b, 0xe6, 0x12, 0xd9,
+			0xa2, 0x35, 0x26, 0x19, 0x99, 0x5d, 0xd7, 0x0e,
+			0xa4, 0xf0, 0x60, 0x30, 0x77, 0xbc, 0x30, 0x32,
+			0x07, 0xba, 0x74, 0x26, 0x7a, 0x47, 0xaf, 0xc0,
+			0x3c, 0x55, 0xa7, 0xf2, 0x4c, 0x0f, 0xe4, 0xb1,
+			0x8b, 0xcd, 0x01, 0x55, 0x18, 0x03, 0xb1, 0x12,
+			0xd4, 0x6b, 0x31, 0xfb, 0x35, 0x86, 0x75, 0xd8,
+			0xfd, 0xa1, 0xcd, 0x8c, 0x4d, 0x97, 0x9f, 0x80,
+			0x5c, 0x61, 0xdd, 0xc4, 0x08, 0xac, 0x62, 0xab,
+			0xed, 0x11, 0xa1, 0x98, 0x12, 0x9f, 0xa6, 0x04,
+			0xa6, 0x48, 0x3a, 0x5f, 0xde, 0x68, 0x8e, 0x7f,
+			0x63, 0x56, 0x5b, 0x50, 0x5d, 0xb3, 0xac, 0x76,
+			0x0a, 0x65, 0xe3, 0x06, 0x84, 0x38, 0xae, 0xf2,
+			0xde, 0x33, 0xb4, 0x52, 0x0c, 0x0b, 0x47, 0xa5,
+			0x20, 0xf6, 0xa4, 0xc9, 0xef, 0x45, 0x50, 0x33,
+			0x32, 0x74, 0xf3, 0xc2, 0x51, 0x9b, 0x2c, 0xf3,
+			0x50, 0xd5, 0x04, 0x45, 0x1b, 0xaf, 0xe8, 0x32,
+			0x40, 0xd1, 0x84, 0x9b, 0x41, 0xf7, 0x54, 0x58,
+			0xc6, 0xcd, 0xdb, 0xa2, 0x80, 0xae, 0xbc, 0xf9,
+			0x00, 0xc8, 0x42, 0x11, 0x35, 0x08, 0x8b, 0x82,
+			0xd0, 0x90, 0x89, 0x5b, 0x4a, 0x3f, 0x41, 0x13,
+			0x04, 0x6f, 0xbe, 0x76, 0x19, 0x5d, 0x56, 0x1f,
+			0x64, 0x93, 0xfb, 0x07, 0xf6, 0xa5, 0x97, 0x28,
+			0xf0, 0x09, 0xc5, 0xa4, 0xb5, 0x77, 0x4b, 0x79,
+			0x44, 0x60, 0xe8, 0x04, 0x4f, 0x03, 0x9d, 0xa1,
+			0x11, 0x8a, 0x1b, 0xad, 0x0b, 0xe3, 0x02, 0x57,
+			0xa0, 0x18, 0xcb, 0x15, 0x2c, 0x6e, 0x6a, 0xfc,
+			0x34, 0x4f, 0x22, 0x9d, 0x4c, 0x15, 0xf7, 0xe1,
+			0x96, 0x1c, 0x43, 0x36, 0x77, 0x4a, 0xb6, 0x80,
+			0x50, 0xb0, 0x3e, 0xcd, 0xfe, 0xa9, 0x80, 0x0f,
+			0x96, 0xc2, 0x43, 0xa2, 0x70, 0x94, 0xde, 0x7c,
+			0x28, 0x54, 0xc5, 0xfe, 0x74, 0xcb, 0x49, 0x9f,
+			0xf9, 0xe3, 0x6d, 0xe4, 0x1d, 0x5b, 0xd3, 0x92,
+			0xfc, 0xf3, 0x4d, 0xff, 0x54, 0xfb, 0x61, 0xcb,
+			0xb9, 0x17, 0x8c, 0x17, 0x18, 0x30, 0x1d, 0xc7,
+			0x05, 0x7b, 0x61, 0x85, 0x93, 0x56, 0x04, 0x77,
+			0xe6, 0x5f, 0x6b, 0xbe, 0x0c, 0x78, 0x54, 0xf4,
+			0x8e, 0xe6, 0xe5, 0xd8, 0x6e, 0x1f, 0x26, 0x6f,
+			0x29, 0xee, 0x49, 0x64, 0x7b, 0xed, 0x4b, 0x40,
+			0x6c, 0xad, 0xcf, 0x46, 0x60, 0xc1, 0x7e, 0x07,
+			0x2e, 0xff, 0xb3, 0x4a, 0x04, 0x14, 0xaf, 0xff,
+			0x98, 0x62, 0x9a, 0x7d, 0x1b, 0xd0, 0x5f, 0x9c,
+			0x7d, 0x1f, 0xe5, 0xfc, 0xc6, 0x1b, 0xf0, 0x2a,
+			0x74, 0x82, 0xb8, 0x13, 0x63, 0x2d, 0xb3, 0xbd,
+			0x2b, 0x83, 0xaa, 0x7e, 0x05, 0x71, 0x01, 0xe4,
+			0xf6, 0x08, 0xdc, 0x05, 0x79, 0x52, 0xbb, 0xc8,
+			0x1d, 0x33, 0x98, 0x81, 0x1e, 0xdb, 0x1d, 0x57,
+			0xff, 0x76, 0x70, 0xf7, 0xae, 0xd5, 0x3a, 0x7d,
+			0x4a, 0x47, 0xfd, 0xdc, 0xe4, 0xcc, 0xe5, 0x2a,
+			0xf8, 0xc7, 0x44, 0xe0, 0x6d, 0x50, 0x30, 0xe7,
+			0xe1, 0x23, 0xc3, 0x78, 0x7e, 0x44, 0x10, 0x2a,
+			0xb1, 0xa9, 0xff, 0xf8, 0xa8, 0x9c, 0x06, 0x34,
+			0x79, 0x81, 0x5c, 0xd3, 0x48, 0x24, 0x2c, 0x45,
+			0x5a, 0xac, 0x2b, 0x3c, 0x80, 0x16, 0xd0, 0x5b,
+			0x27, 0x8e, 0x01, 0xe5, 0x0c, 0xe0, 0x32, 0x36,
+			0xf5, 0x6e, 0xed, 0xf2, 0x21, 0xfb, 0x9e, 0x79,
+			0xcf, 0x8f, 0xa4, 0x2d, 0x3e, 0xff, 0x9d, 0xf1,
+			0x19, 0xa6, 0x78, 0xcc, 0x70, 0x48, 0xdd, 0x07,
+			0xfd, 0xe7, 0xf3, 0x11, 0xc4, 0x72, 0x42, 0x45,
+			0xcf, 0xa5, 0x52, 0x68, 0xcd, 0xe5, 0x74, 0x50,
+			0x4c, 0x8d, 0xbb, 0xa6, 0x76, 0x8a, 0x09, 0xc2,
+			0x63, 0x7f, 0xf1, 0xd9, 0x2e, 0x18, 0xaa, 0xff,
+			0x11, 0x59, 0x9f, 0x5f, 0x7e, 0x18, 0x1b, 0x18,
+			0xda, 0x25, 0xf6, 0xe6, 0xfd, 0x9c, 0xf4, 0xcf,
+			0xbc, 0xe1, 0x52, 0xfb, 0xc7, 0x94, 0xaf, 0xb3,
+			0x96, 0xf2, 0x70, 0x22, 0xf0, 0x05, 0x08, 0xd1,
+			0x98, 0xea, 0xde, 0x41, 0x42, 0x44, 0x28, 0x13,
+			0x21, 0x3c, 0x32, 0x97, 0xfe, 0xb1, 0x67, 0x91,
+			0x3d, 0x85, 0x94, 0x02, 0x1d, 0x36, 0x9c, 0x54,
+			0x96, 0x89, 0xa8, 0xe7, 0xf1, 0xca, 0xe1, 0xeb,
+			0xfc, 0x70, 0xc8, 0xae, 0x2e, 0xb8, 0xa5, 0xaa,
+			0x74, 0xef, 0xe6, 0x3a, 0x51, 0x4b, 0xff, 0xc6,
+			0x81, 0x0b, 0x54, 0x51, 0xd0, 0xfa, 0x99, 0x61,
+			0xa1, 0x49, 0xf5, 0x9f, 0xb3, 0xe9, 0x6e, 0xf0,
+			0x8f, 0xd3, 0x35, 0xd5, 0x2c, 0x8c, 0xb1, 0x41,
+			0xa1, 0x79, 0xd9, 0x2a, 0xe6, 0x52, 0xd0, 0x8a,
+			0x17, 0x28, 0xf0, 0xf8, 0x34, 0x96, 0xe0, 0xe8,
+			0x7f, 0x9d, 0x18, 0x13, 0xb8, 0x33, 0xa8, 0xa4,
+			0x8a, 0xe1, 0x52, 0xca, 0x89, 0x7c, 0x25, 0x79,
+			0xa6, 0xe3, 0xd3, 0xb7, 0x9d, 0x5c, 0x29, 0xbf,
+			0xad, 0xa5, 0x5d, 0x4b, 0xf4, 0xf9, 0x63, 0x1a,
+			0x27, 0x5a, 0x3e, 0x4c, 0x38, 0x02, 0xe1, 0xd4,
+			0xe7, 0xb6, 0x25, 0x99, 0xbe, 0x62, 0x59, 0x16,
+			0x90, 0x24, 0x1e, 0x7c, 0x2f, 0x7d, 0x1a, 0x37,
+			0x13, 0x41, 0x77, 0x0c, 0x98, 0xe3, 0x7f, 0x00,
+			0xb8, 0xee, 0xe4, 0x79, 0x7e, 0xef, 0xb0, 0xf4,
+			0x84, 0xda, 0xc6, 0xb5, 0xf2, 0xe4, 0xb1, 0x4f,
+			0x70, 0x41, 0x8f, 0x86, 0x7c, 0x43, 0x28, 0xb0,
+			0xe7, 0x5d, 0x9c, 0x2e, 0x6b, 0xd3, 0x79, 0x6e,
+			0xcd, 0x40, 0xea, 0xb4, 0xb9, 0x2e, 0x89, 0x6b,
+			0xe0, 0xf1, 0x50, 0x85, 0x94, 0xaa, 0x78, 0x7f,
+			0x8e, 0xec, 0xc4, 0x5d, 0x4d, 0x69, 0x88, 0x80,
+			0x44, 0xad, 0x0e, 0xe2, 0xaf, 0xde, 0x61, 0x68,
+			0x86, 0x69, 0x4b, 0x1f, 0xc4, 0x99, 0x1d, 0x7a,
+			0xea, 0xa9, 0x61, 0x39, 0xc6, 0x1d, 0xf8, 0xc9,
+			0xef, 0x7c, 0xae, 0x41, 0x45, 0x37, 0x2c, 0x02,
+			0x25, 0x22, 0x94, 0x26, 0x06, 0x97, 0xd2, 0x11,
+			0xf9, 0x64, 0x0d, 0xbf, 0xa1, 0x25, 0xee, 0xd0,
+			0x8a, 0x29, 0xe6, 0xf7, 0xb6, 0x7a, 0x6e, 0x8a,
+			0xc6, 0xf7, 0xcd, 0xdc, 0x37, 0xac, 0x1a, 0x08,
+			0x08, 0x56, 0xfd, 0x74, 0xb5, 0xdb, 0xc0, 0x29,
+			0x32, 0xe0, 0x00, 0xcb, 0x25, 0x35, 0x9d, 0xc6,
+			0x82, 0x93, 0x10, 0xf4, 0xd2, 0x0d, 0x7a, 0xe3,
+			0x5d, 0x46, 0x8e, 0xbe, 0x0d, 0x71, 0x92, 0xbb,
+			0x04, 0xd8, 0x31, 0x62, 0x06, 0x36, 0xdc, 0x10,
+			0x23, 0x65, 0xfe, 0x55, 0x10, 0x31, 0x8b, 0x58,
+			0x6d, 0x13, 0x55, 0xd6, 0x17, 0x1d, 0x24, 0x9a,
+			0xde, 0x6f, 0xe4, 0x7b, 0x7a, 0xf1, 0x07, 0x5e,
+			0x33, 0x36, 0x74, 0xa3, 0x6b, 0x90, 0x5a, 0xf8,
+			0xdf, 0x68, 0x93, 0x61, 0xa5, 0x0c, 0x26, 0x76,
+			0x97, 0xcd, 0x67, 0x3b, 0x03, 0x90, 0xe4, 0xc8,
+			0x83, 0xe1, 0xa4, 0x07, 0xb1, 0x72, 0x5e, 0x88,
+			0xc5, 0xa9, 0xa2, 0x43, 0xc8, 0x16, 0x5e, 0x3f,
+			0x7a, 0x0d, 0xf0, 0x16, 0x8e, 0x33, 0x0b, 0xe9,
+			0x4e, 0xaa, 0x0f, 0xa0, 0xd9, 0xc4, 0x2d, 0x45,
+			0x9b, 0x34, 0xd9, 0x28, 0x06, 0x75, 0x41, 0x0c,
+			0xf6, 0x82, 0x89, 0x08, 0x99, 0x80, 0xc4, 0x4e,
+			0xb7, 0x3a, 0x14, 0x59, 0x3d, 0xdd, 0x67, 0x0d,
+			0xe1, 0x0d, 0x18, 0x85, 0x71, 0x8b, 0x08, 0x87,
+			0xf4, 0x65, 0xd6, 0x19, 0xd3, 0x9c, 0x78, 0x86,
+			0x81, 0xfd, 0x37, 0xee, 0xc7, 0x57, 0x8b, 0x0a,
+			0x85, 0xd9, 0x35, 0x94, 0xa7, 0xb7, 0x2d, 0x75,
+			0xa5, 0x3a, 0xa9, 0x6f, 0xce, 0x43, 0xaf, 0xb7,
+			0xfe, 0x89, 0xc5, 0xc3, 0x3c, 0x97, 0x99, 0xab,
+			0xee, 0x6c, 0xe8, 0x5d, 0x4a, 0x36, 0x32, 0x51,
+			0xc3, 0x62, 0xee, 0xeb, 0xbd, 0x3c, 0x65, 0xed,
+			0xb9, 0x09, 0x06, 0x65, 0x67, 0x07, 0xa0, 0x39,
+			0x2d, 0x95, 0x75, 0xee, 0xf0, 0x0d, 0xe5, 0xdc,
+			0x45, 0x88, 0xdc, 0x6c, 0x0e, 0x5e, 0x8e, 0x33,
+			0x49, 0x00, 0x74, 0x01, 0x5d, 0x0b, 0xe5, 0x00,
+			0xc7, 0xc0, 0xfc, 0x15, 0xb7, 0x7b, 0xc0, 0x51,
+			0x67, 0x3a, 0xcc, 0x3f, 0xd8, 0xfe, 0xfd, 0x4b,
+			0x7e, 0xe8, 0x93, 0x48, 0x8d, 0x1b, 0xc8, 0x10,
+			0x3f, 0x80, 0x9e, 0x51, 0x2a, 0xda, 0xba, 0xc3,
+			0xcd, 0x89, 0xb2, 0x41, 0xde, 0x8b, 0x1a, 0xad,
+			0xc7, 0x83, 0xbc, 0x4b, 0x06, 0xa9, 0x56, 0xbe,
+			0xb1, 0xb0, 0x4f, 0x4c, 0x3f, 0x01, 0xcf, 0x22,
+			0x4e, 0x47, 0x1f, 0x24, 0x48, 0x30, 0xbb, 0xc4,
+			0x78, 0x5a, 0xe5, 0x9a, 0xef, 0xc5, 0x43, 0xea,
+			0x21, 0x1a, 0x94, 0xf6, 0x35, 0x92, 0x2f, 0xff,
+			0xcc, 0xfe, 0x5a, 0x61, 0x14, 0x70, 0x60, 0xc9,
+			0xa7, 0x8b, 0xd2, 0x8e, 0xa7, 0xc4, 0xfd, 0xb5,
+			0x85, 0xc0, 0x30, 0x38, 0x3a, 0x8d, 0x1d, 0x4c,
+			0x1c, 0x89, 0x5e, 0x67, 0xdd, 0x91, 0x10, 0x8d,
+			0x75, 0x5e, 0x2b, 0x22, 0x5b, 0xcb, 0xf9, 0xd8,
+			0x0a, 0x26, 0x47, 0x25, 0xcf, 0x25, 0xee, 0x3c,
+			0x20, 0xce, 0x90, 0x17, 0x52, 0x49, 0x8e, 0x79,
+			0xa2, 0x01, 0x04, 0xe6, 0xd1, 0xaf, 0xb9, 0x69,
+			0x21, 0x8a, 0xf8, 0xb3, 0x32, 0x17, 0x96, 0x4f,
+			0x22, 0xaa, 0x2d, 0xf6, 0xba, 0x70, 0x70, 0x8c,
+			0xcd, 0x89, 0x65, 0x25, 0x31, 0x7a, 0xcb, 0x06,
+			0xa6, 0x12, 0xe8, 0x21, 0xd2, 0x3f, 0xa1, 0x0e,
+			0xe9, 0xb0, 0xca, 0x29, 0xe8, 0x49, 0x34, 0x33,
+			0x03, 0x6b, 0x53, 0x6a, 0xb4, 0x5a, 0x0f, 0xe3,
+			0x42, 0x0b, 0x2a, 0x67, 0xe6, 0x91, 0xd0, 0x10,
+			0x5a, 0xca, 0xf9, 0x4c, 0xed, 0xa1, 0xf0, 0x03,
+			0x9f, 0x7d, 0x8b, 0x57, 0xc7, 0x12, 0x49, 0x94,
+			0xf8, 0xad, 0x58, 0x7f, 0x8e, 0xc0, 0xb2, 0x46,
+			0xc2, 0xf5, 0xf5, 0xea, 0xa8, 0x72, 0x94, 0x85,
+			0x34, 0x56, 0x88, 0x9c, 0xfe, 0xa7, 0x9d, 0xf9,
+			0x6a, 0xec, 0xf1, 0x56, 0x82, 0xfe, 0x36, 0x9f,
+			0x00, 0x14, 0x1f, 0x38, 0x0f, 0x5a, 0xa8, 0xef,
+			0xec, 0xca, 0x60, 0x53, 0x7b, 0xe1, 0xfa, 0xd7,
+			0x64, 0xbb, 0xe8, 0xf5, 0xde, 0x65, 0xe9, 0xeb,
+			0xc0, 0xbb, 0x4b, 0x10, 0x03, 0x2a, 0x5b, 0x3d,
+			0x9e, 0x24, 0xbf, 0x7d, 0xcf, 0x74, 0x47, 0xc1,
+			0x13, 0x49, 0xfb, 0xa7, 0x24, 0x84, 0x17, 0x82,
+			0x3a, 0xd7, 0x32, 0xef, 0xba, 0xcc, 0x76, 0x16,
+			0xe4, 0x2a, 0xa2, 0x5f, 0x58, 0x15, 0x70, 0x61,
+			0x11, 0x47, 0x83, 0x18, 0x61, 0x11, 0xdf, 0x31,
+			0x78, 0x19, 0xf7, 0x45, 0x05, 0x89, 0x42, 0xc5,
+			0x66, 0xb1, 0x90, 0x84, 0x45, 0x81, 0x3c, 0x96,
+			0x9b, 0x1c, 0xc1, 0x48, 0x0c, 0xf5, 0xd4, 0x3a,
+			0x75, 0x8d, 0x99, 0x46, 0x27, 0x38, 0xb2, 0xb6,
+			0x70, 0x8f, 0xc2, 0xdc, 0xfc, 0x3c, 0x0f, 0xb5,
+			0xf1, 0xd1, 0x6d, 0xc0, 0x15, 0x1b, 0x8f, 0x6a,
+			0xc3, 0x25, 0xc3, 0x0c, 0xf6, 0x2f, 0xcd, 0x94,
+			0x5d, 0x9a, 0x7a, 0x06, 0x73, 0x4d, 0xb5, 0x07,
+			0x6c, 0xe9, 0xa8, 0x83, 0xc2, 0xa1, 0x4d, 0xd6,
+			0x00, 0xca, 0xd7, 0x04, 0xda, 0x85, 0xec, 0x79,
+			0xe6, 0x61, 0xf9, 0xe7, 0x04, 0xce, 0x94, 0xdc,
+			0xb6, 0x6c, 0xf7, 0x4b, 0x57, 0x8f, 0xf5, 0x5b,
+			0xb7, 0xe9, 0x86, 0x2b, 0x72, 0x41, 0x84, 0x3a,
+			0xfd, 0x35, 0x0d, 0xd6, 0xe0, 0x27, 0x49, 0xa7,
+			0xd1, 0x54, 0xe2, 0xbd, 0xd9, 0xfb, 0xeb, 0x93,
+			0xb9, 0x18, 0x1b, 0xef, 0x91, 0xf1, 0x5f, 0xb7,
+			0x0c, 0x96, 0xa0, 0x64, 0x1a, 0xed, 0x44, 0x3a,
+			0x3b, 0xc7, 0x90, 0x2f, 0x05, 0x86, 0xcd, 0x8e,
+			0x83, 0x70, 0x81, 0xf1, 0x0b, 0x42, 0xe6, 0xc8,
+			0x62, 0x5b, 0x6e, 0x2b, 0xc9, 0xbf, 0xf4, 0xa5,
+			0x71, 0x17, 0x48, 0x98, 0xb4, 0x64, 0x88, 0x45,
+			0x73, 0x8f, 0x73, 0x2e, 0x99, 0xa9, 0x4d, 0x0b,
+			0xe3, 0xbb, 0x94, 0xb2, 0xf5, 0xd2, 0x28, 0x34,
+			0x32, 0xce, 0x9d, 0x0d, 0x07, 0x15, 0xa4, 0x9f,
+			0xe4, 0x0d, 0x17, 0x29, 0x58, 0x18, 0x33, 0xdd,
+			0x2f, 0x71, 0xb8, 0x7b, 0xdd, 0x75, 0xd3, 0x20,
+			0x9f, 0xb1, 0x3b, 0x75, 0xbc, 0xbb, 0xb7, 0x74,
+			0x53, 0xdc, 0xb3, 0xbc, 0x1e, 0x11, 0x77, 0x23,
+			0xab, 0xad, 0x5f, 0xa8, 0x1b, 0xa4, 0x84, 0xb3,
+			0x77, 0x03, 0x4f, 0xa9, 0x08, 0x04, 0x55, 0xbd,
+			0x14, 0x3c, 0x5a, 0x5d, 0xac, 0x6e, 0x10, 0x8a,
+			0xdb, 0x99, 0x28, 0xf9, 0x90, 0x3a, 0x16, 0xb5,
+			0x8f, 0xe6, 0xd3, 0x75, 0x56, 0x3e, 0x10, 0x1e,
+			0xdf, 0x87, 0x74, 0x35, 0xc2, 0xd3, 0xcb, 0x49,
+			0x7b, 0x8e, 0x8d, 0x7b, 0x5f, 0x83, 0xbd, 0x6c,
+			0x1a, 0x81, 0x71, 0x03, 0xe7, 0x4b, 0xfc, 0x27,
+			0x2f, 0x99, 0x8a, 0xd6, 0x6c, 0x45, 0xea, 0x9f,
+			0x7d, 0x22, 0x85, 0x36, 0x35, 0x4b, 0x4c, 0x6d,
+			0x63, 0x49, 0x43, 0xd6, 0x7b, 0x8c, 0x09, 0xb9,
+			0xb0, 0xc0, 0x58, 0xee, 0x92, 0xcf, 0x03, 0x01,
+			0xdb, 0x31, 0x6a, 0xa4, 0xad, 0x6e, 0x86, 0x86,
+			0x16, 0x50, 0x6a, 0xc1, 0xb4, 0x1d, 0x32, 0xca,
+			0x08, 0xd6, 0x82, 0xf5, 0xaa, 0x54, 0xbe, 0xc8,
+			0x81, 0x71, 0x86, 0xac, 0x58, 0xe5, 0x5d, 0x70,
+			0x32, 0x18, 0x44, 0xcc, 0x61, 0x91, 0x53, 0xc9,
+			0xf3, 0xd9, 0x1d, 0x72, 0xe9, 0xf0, 0xc6, 0xe7,
+			0x18, 0x52, 0x13, 0x41, 0x82, 0x2f, 0x1f, 0xb8,
+			0x69, 0x6a, 0xbc, 0x24, 0x13, 0xc5, 0x63, 0x22,
+			0xca, 0xbd, 0xbb, 0x2c, 0x5f, 0x71, 0x21, 0xc5,
+			0x9e, 0x32, 0x33, 0x5a, 0x90, 0xcf, 0xf6, 0xf9,
+			0xb3, 0x30, 0x7b, 0x78, 0xc0, 0x7a, 0x64, 0xb6,
+			0x2b, 0x5a, 0x9e, 0x36, 0xd2, 0xc9, 0x30, 0xaa,
+			0x68, 0x17, 0xac, 0x0b, 0x18, 0xb0, 0x4d, 0x46,
+			0xc3, 0xeb, 0x66, 0x56, 0xb2, 0xdd, 0x7b, 0x66,
+			0x46, 0xa7, 0x20, 0x5b, 0xbc, 0x08, 0x28, 0x8a,
+			0xb6, 0x86, 0x81, 0x0d, 0x76, 0x12, 0x2f, 0x3d,
+			0x03, 0x74, 0x6c, 0x4b, 0xda, 0xcb, 0xbe, 0x13,
+			0x8f, 0xec, 0x06, 0x71, 0x24, 0xbb, 0xdf, 0x48,
+			0x55, 0x33, 0xbe, 0x1f, 0x77, 0x76, 0x0e, 0x7c,
+			0x36, 0x7e, 0x40, 0x0f, 0xa1, 0x43, 0x98, 0x1b,
+			0xe9, 0x31, 0x77, 0xb9, 0xb7, 0xa1, 0xd7, 0x9b,
+			0xa0, 0xc5, 0xbc, 0x74, 0xa0, 0xc8, 0x18, 0xd4,
+			0xe7, 0x20, 0x61, 0xef, 0x51, 0x8d, 0x7d, 0x30,
+			0x2f, 0xae, 0xc9, 0x4c, 0x37, 0xc8, 0xd0, 0x5d,
+			0x3b, 0x25, 0x09, 0xd9, 0x56, 0x8c, 0xd6, 0x59,
+			0xb3, 0x81, 0xf3, 0xc2, 0x16, 0x67, 0x42, 0x1e,
+			0x03, 0x8a, 0x4e, 0xf0, 0xe2, 0x6b, 0x3d, 0xd5,
+			0x2a, 0x62, 0x0a, 0xe5, 0x13, 0xed, 0xfd, 0xf9,
+			0x38, 0xf1, 0xbc, 0x48, 0x39, 0xa4, 0x73, 0x3a,
+			0xc3, 0x5c, 0xab, 0x0e, 0xc7, 0xe8, 0x53, 0x51,
+			0x66, 0x3e, 0x40, 0x93, 0x9b, 0x59, 0x38, 0x2f,
+			0xfe, 0x33, 0x4e, 0xb8, 0xc0, 0xd1, 0x4b, 0xfb,
+			0x0a, 0xd4, 0x2d, 0xad, 0xa3, 0x2a, 0x60, 0x67,
+			0xd4, 0x8d, 0x87, 0x65, 0x0d, 0x17, 0x0c, 0xe7,
+			0x15, 0xb8, 0x57, 0x02, 0x69, 0xb2, 0xc2, 0xae,
+			0x4a, 0x21, 0x72, 0xe7, 0xc5, 0xe6, 0xf3, 0x00,
+			0x85, 0x35, 0x07, 0x73, 0xbc, 0x31, 0xbb, 0x63,
+			0x98, 0x8f, 0xb9, 0x55, 0x20, 0xe8, 0x07, 0x1a,
+			0x66, 0x5f, 0xf8, 0x18, 0xb3, 0xd6, 0xcf, 0x1f,
+			0x53, 0x22, 0xac, 0xa8, 0x28, 0xd4, 0xfb, 0x12,
+			0x2b, 0x9f, 0x1b, 0xed, 0xe5, 0xd6, 0x17, 0x65,
+			0x2b, 0x6b, 0x27, 0xa8, 0x5a, 0x3e, 0x20, 0x43,
+			0xa1, 0xb0, 0x54, 0xc1, 0xee, 0xc0, 0xff, 0xc8,
+			0x4d, 0x23, 0x12, 0xca, 0xa2, 0xfd, 0xa9, 0xbe,
+			0x0c, 0x65, 0x60, 0xcc, 0x7f, 0x29, 0xc0, 0xbb,
+			0xd2, 0x61, 0x01, 0x96, 0xe4, 0x39, 0x34, 0x9c,
+			0x0b, 0xe9, 0x0f, 0x69, 0xdf, 0xf3, 0xa8, 0xa0,
+			0xe8, 0x7e, 0xb4, 0xc9, 0xd9, 0xe1, 0x20, 0xaf,
+			0x98, 0x52, 0x64, 0x2f, 0xd1, 0x05, 0x2f, 0x4f,
+			0xe2, 0xd5, 0x98, 0x32, 0xf1, 0x66, 0x1d, 0xcb,
+			0xee, 0xc9, 0xc0, 0x47, 0xab, 0xc8, 0x59, 0x6a,
+			0x40, 0x58, 0x6f, 0x60, 0x5b, 0xe0, 0x89, 0xdc,
+			0x42, 0x62, 0xb8, 0x1f, 0x4f, 0x37, 0xea, 0x46,
+			0x06, 0x43, 0x73, 0xd5, 0xfc, 0xee, 0xd7, 0x4e,
+			0x00, 0x9b, 0x5a, 0x8a, 0x6d, 0x37, 0x94, 0x0f,
+			0x2f, 0x7c, 0x81, 0xd7, 0xff, 0x1c, 0x97, 0x5b,
+			0x01, 0xa9, 0xe2, 0x1d, 0x9f, 0x34, 0xf5, 0x79,
+			0xa2, 0x4a, 0x2f, 0x04, 0x7d, 0x7d, 0x6b, 0x9d,
+			0x64, 0x1c, 0x74, 0xc8, 0x4f, 0x4d, 0x01, 0xdb,
+			0x16, 0x7e, 0x9b, 0xea, 0xe8, 0x20, 0x70, 0xba,
+			0x62, 0xb7, 0x8e, 0x59, 0x08, 0x7d, 0xba, 0x92,
+			0x32, 0x00, 0x3d, 0xf9, 0x30, 0x5b, 0x31, 0x93,
+			0x07, 0x6b, 0x43, 0x55, 0x9f, 0xa1, 0x6c, 0x73,
+			0x7e, 0xfc, 0xe2, 0x43, 0xc8, 0xec, 0x90, 0xe9,
+			0x32, 0x78, 0xd4, 0xbf, 0x3c, 0x01, 0xa5, 0xf1,
+			0x04, 0x77, 0x0b, 0xfb, 0x83, 0x4e, 0x6f, 0x91,
+			0x8e, 0xb4, 0x16, 0xfd, 0x4b, 0xfb, 0xb2, 0x1b,
+			0x4c, 0xfc, 0x21, 0xe5, 0x51, 0x8a, 0x5e, 0x69,
+			0x63, 0xef, 0xd2, 0xeb, 0xa1, 0x11, 0x82, 0x98,
+			0x93, 0xc6, 0x21, 0x94, 0x94, 0xbb, 0x62, 0x8b,
+			0x4e, 0xb3, 0x20, 0x81, 0x3c, 0xe3, 0x42, 0x01,
+			0x7f, 0x38, 0x0f, 0x89, 0x07, 0x1a, 0xf4, 0x95,
+			0x03, 0xbb, 0x2c, 0x19, 0x5e, 0x19, 0xd1, 0xb1,
+			0xc5, 0x6a, 0x09, 0xa7, 0x98, 0x29, 0xae, 0xc2,
+			0x6a, 0xa8, 0xaf, 0xc8, 0xa1, 0xf8, 0xe4, 0x48,
+			0x1f, 0x11, 0xeb, 0x62, 0x5e, 0x3f, 0x53, 0x7a,
+			0x06, 0xfb, 0x83, 0x7d, 0xd5, 0x0f, 0x3d, 0xd1,
+			0x46, 0xb8, 0xa7, 0xd7, 0xa4, 0x0a, 0x12, 0xd7,
+			0x66, 0x08, 0x8d, 0x21, 0xe6, 0x0b, 0x62, 0x0a,
+			0x44, 0x5d, 0x8a, 0xf2, 0x2a, 0x08, 0x76, 0x32,
+			0x9c, 0x86, 0x7b, 0x72, 0x24, 0x0b, 0xfb, 0xeb,
+			0x94, 0xd5, 0xd3, 0xc4, 0xf4, 0xa4, 0x01, 0xd0,
+			0x01, 0x34, 0xf3, 0x5a, 0x90, 0x97, 0x8e, 0xcc,
+			0x02, 0x6c, 0x0f, 0x25, 0x74, 0x20, 0x0b, 0x79,
+			0xe4, 0x79, 0x01, 0x92, 0x9c, 0x00, 0x7a, 0xdc,
+			0xe4, 0xd4, 0x76, 0xcb, 0x36, 0xad, 0xed, 0xf2,
+			0x1f, 0x69, 0xce, 0xbc, 0x58, 0xf5, 0x82, 0x29,
+			0xcb, 0x1a, 0x62, 0x72, 0xe8, 0xf1, 0x35, 0xb1,
+			0xa6, 0xc0, 0x58, 0x70, 0x8c, 0xea, 0xbf, 0x2f,
+			0xa3, 0x46, 0xd9, 0x5c, 0xe6, 0x34, 0x19, 0x23,
+			0xe1, 0xab, 0x2e, 0x5b, 0x4c, 0x32, 0x73, 0xa0,
+			0x9d, 0x9f, 0x92, 0xff, 0x06, 0x3b, 0xa9, 0x71,
+			0x38, 0x19, 0x47, 0x7d, 0x4a, 0x37, 0x5d, 0x07,
+			0x59, 0x0a, 0x87, 0xbc, 0xb5, 0x10, 0x2c, 0x8b,
+			0x48, 0xaf, 0xa7, 0x20, 0xcb, 0x09, 0xbe, 0x28,
+			0x43, 0x61, 0xd3, 0x74, 0x7c, 0xcd, 0x62, 0x8a,
+			0x1d, 0x90, 0xa5, 0x03, 0x10, 0xe0, 0x01, 0xf1,
+			0x5f, 0x3e, 0x81, 0x23, 0xbe, 0x21, 0xef, 0x8d,
+			0x5b, 0x1d, 0xaf, 0x36, 0xf0, 0xa9, 0x4e, 0xe0,
+			0x7f, 0x57, 0x1d, 0xa0, 0xaf, 0x95, 0x55, 0x61,
+			0xff, 0xee, 0xa6, 0x0b, 0x6e, 0xd4, 0x36, 0xd8,
+			0x28, 0x71, 0x8b, 0x88, 0x7a, 0xc2, 0x99, 0x60,
+			0x93, 0xc2, 0x35, 0xda, 0x61, 0x2d, 0xa6, 0x06,
+			0x71, 0x18, 0xd5, 0x35, 0xe0, 0x02, 0x08, 0x7b,
+			0xa5, 0x6c, 0xe2, 0x03, 0x02, 0xad, 0xcb, 0x4b,
+			0x0b, 0xdc, 0x6c, 0xc6, 0x71, 0x3d, 0x1d, 0x3a,
+			0x5d, 0xbf, 0x3a, 0x49, 0x2a, 0x8d, 0x49, 0x22,
+			0x0e, 0x35, 0x81, 0xf0, 0x09, 0xbd, 0xdc, 0xfc,
+			0xc3, 0xb4, 0xdb, 0x24, 0xe8, 0xe4, 0x3e, 0x5d,
+			0x34, 0x50, 0x8d, 0xb0, 0x91, 0xba, 0x2c, 0xe7,
+			0xb9, 0x02, 0x92, 0x50, 0x50, 0x5c, 0x03, 0x6b,
+			0xc8, 0xcd, 0xe3, 0x9b, 0x98, 0x47, 0x48, 0xc0,
+			0x5a, 0xf2, 0x0b, 0x7a, 0x4a, 0xbe, 0x05, 0x6f,
+			0x01, 0x6b, 0x3a, 0x1c, 0xe8, 0xc1, 0xcf, 0x90,
+			0x88, 0x62, 0x76, 0x46, 0xb5, 0x89, 0x16, 0xbd,
+			0xea, 0xc1, 0x77, 0x13, 0xe5, 0x78, 0x50, 0x01,
+			0x8e, 0x97, 0xe7, 0x64, 0xdd, 0xa9, 0x2c, 0x93,
+			0xae, 0x96, 0xe7, 0x16, 0xb4, 0x33, 0xef, 0xb0,
+			0xef, 0x28, 0x55, 0x05, 0x3c, 0x26, 0xaa, 0x2a,
+			0x6c, 0x0f, 0x8f, 0x8d, 0x07, 0x01, 0xe9, 0x1f,
+			0x47, 0x94, 0x53, 0x3a, 0x40, 0xf7, 0x09, 0x13,
+			0x50, 0x73, 0x09, 0xab, 0x35, 0x9f, 0x0a, 0x08,
+			0x17, 0xfe, 0x8f, 0xdd, 0x3c, 0xba, 0xd3, 0x05,
+			0x33, 0xf8, 0x35, 0x04, 0xf4, 0xc2, 0x1e, 0xad,
+			0xc2, 0x16, 0xe0, 0x39, 0x1a, 0x2e, 0x51, 0xf0,
+			0x3c, 0xa4, 0x90, 0x44, 0xdf, 0x9d, 0x90, 0x5b,
+			0xa1, 0xea, 0x54, 0x5a, 0xaa, 0x60, 0x9c, 0x0b,
+			0x50, 0xea, 0x50, 0xe4, 0xdf, 0x41, 0x06, 0xff,
+			0x87, 0x49, 0x2c, 0x9a, 0x30, 0x87, 0xa9, 0xbc,
+			0x55, 0x53, 0xc7, 0xc2, 0xaf, 0x6b, 0x36, 0x2b,
+			0x09, 0x2c, 0x72, 0x57, 0xd0, 0x7b, 0xc3, 0x75,
+			0xa0, 0x26, 0xca, 0x7e, 0xe0, 0x0c, 0x3f, 0x6c,
+			0x10, 0xd4, 0x71, 0xa7, 0xc2, 0x0f, 0xc6, 0xac,
+			0x14, 0x12, 0x8e, 0xd9, 0x88, 0x10, 0x22, 0x65,
+			0x2a, 0x7f, 0x14, 0xc5, 0x4f, 0x7b, 0x78, 0x87,
+			0xea, 0x0e, 0x2f, 0x20, 0xad, 0x10, 0x20, 0x13,
+			0xae, 0x1a, 0x10, 0xed, 0x9d, 0x1c, 0x4b, 0xe6,
+			0x97, 0x6b, 0x72, 0x33, 0x77, 0xac, 0x6f, 0xd4,
+			0x0f, 0xe3, 0xd8, 0x32, 0x01, 0xeb, 0x9e, 0x3f,
+			0x8b, 0xdb, 0x65, 0xdb, 0x90, 0xff, 0xd0, 0x62,
+			0x36, 0x9f, 0x0c, 0x2c, 0x73, 0x62, 0x29, 0xc6,
+			0x11, 0xa0, 0xf4, 0x11, 0x45, 0x21, 0x50, 0x60,
+			0xac, 0xee, 0x79, 0xeb, 0x67, 0xfd, 0x26, 0xe6,
+			0x85, 0x68, 0x28, 0x26, 0x28, 0xe4, 0xe0, 0x2f,
+			0xde, 0xac, 0x83, 0xfd, 0xd7, 0x94, 0xeb, 0xb7,
+			0xfc, 0xa2, 0x23, 0xce, 0xe2, 0xc2, 0x11, 0x0c,
+			0xbb, 0x95, 0x1f, 0xd6, 0xbe, 0xe5, 0x21, 0x59,
+			0xb7, 0x5c, 0x2e, 0xf0, 0x4d, 0x7e, 0x0a, 0x5c,
+			0xf4, 0xe3, 0x81, 0x2d, 0x32, 0xe1, 0xb4, 0x54,
+			0x07, 0x63, 0x12, 0xd6, 0x3a, 0xeb, 0xc1, 0x9d,
+			0x4a, 0xe1, 0x6c, 0x5f, 0xac, 0xee, 0xd8, 0x8c,
+			0xbf, 0xd9, 0xf4, 0x8c, 0x1a, 0x44, 0x24, 0xa6,
+			0x36, 0x2a, 0xde, 0xa8, 0x0b, 0x5f, 0x9e, 0x0e,
+			0xab, 0xd2, 0xd0, 0x0f, 0x55, 0xdc, 0x50, 0x87,
+			0xc4, 0x4e, 0xbc, 0x6a, 0xb9, 0x2a, 0xe5, 0x8d,
+			0x81, 0x79, 0xd7, 0x8d, 0x74, 0x01, 0x40, 0xf8,
+			0xb9, 0x5a, 0xaa, 0x76, 0x3c, 0x53, 0x07, 0x8b,
+			0xd1, 0x1c, 0x7c, 0x56, 0xa9, 0x05, 0x7f, 0x89,
+			0x96, 0x13, 0xee, 0x50, 0x38, 0x88, 0x60, 0xde,
+			0xcc, 0x2c, 0xca, 0x3a, 0x19, 0x35, 0x20, 0x1d,
+			0xfa, 0x46, 0x2a, 0x84, 0x2d, 0x45, 0x93, 0x22,
+			0x96, 0x50, 0xa7, 0xd2, 0x3d, 0xcb, 0x09, 0x67,
+			0x9c, 0x35, 0x82, 0xb6, 0xed, 0x6d, 0xc7, 0x1e,
+			0x0a, 0xc7, 0x9e, 0x84, 0x41, 0x52, 0xe5, 0x10,
+			0x6e, 0xda, 0x34, 0xfb, 0x1c, 0x49, 0x0c, 0x86,
+			0xc7, 0xc6, 0xde, 0x19, 0x64, 0xca, 0x40, 0x3f,
+			0x3a, 0x83, 0x92, 0xaa, 0x1b, 0xf5, 0xf8, 0x8d,
+			0x83, 0x07, 0x8d, 0x0a, 0x83, 0xb6, 0xa6, 0x63,
+			0x6d, 0xce, 0xe0, 0x68, 0xa9, 0x12, 0xc4, 0x48,
+			0x00, 0x16, 0x31, 0xdb, 0xb4, 0x3c, 0x54, 0x53,
+			0xb5, 0x81, 0x23, 0xcf, 0x2d, 0xd4, 0x49, 0xee,
+			0xec, 0xea, 0x59, 0xb7, 0xb8, 0x77, 0x02, 0xbf,
+			0xc2, 0xfb, 0x91, 0xd8, 0xa7, 0x8f, 0x3b, 0xf7,
+			0x55, 0x74, 0x36, 0x13, 0x51, 0x2d, 0x25, 0x80,
+			0xc6, 0x39, 0x6e, 0x45, 0x3f, 0x76, 0xe0, 0xfa,
+			0xb3, 0x6d, 0x0a, 0x34, 0xb3, 0x0f, 0x92, 0xa2,
+			0x7d, 0xce, 0xd4, 0x52, 0xd5, 0x4b, 0x24, 0xf1,
+			0x73, 0xd5, 0x35, 0x39, 0x5f, 0x50, 0x3e, 0x42,
+			0x94, 0x06, 0xaf, 0x5a, 0x39, 0x71, 0x09, 0x10,
+			0xdb, 0x34, 0x88, 0x19, 0x8d, 0x86, 0x0a, 0x91,
+			0xe8, 0x70, 0x38, 0xa1, 0xc3, 0x8d, 0xce, 0xc6,
+			0x97, 0x38, 0xeb, 0x9d, 0x89, 0xe3, 0x24, 0xc2,
+			0xcd, 0xf3, 0x57, 0x7c, 0xc9, 0x02, 0x60, 0x4f,
+			0x41, 0x2b, 0x9d, 0x77, 0x7b, 0x65, 0xe2, 0xae,
+			0x7e, 0x0d, 0x28, 0x01, 0x55, 0x2d, 0xb4, 0x0d,
+			0xa8, 0xdb, 0x5a, 0xf4, 0xc4, 0x0f, 0xc9, 0xfb,
+			0x95, 0xaf, 0x41, 0xb1, 0x77, 0xe5, 0xf2, 0xfe,
+			0x78, 0xc2, 0x4f, 0xd7, 0x10, 0x2c, 0x3e, 0xea,
+			0x1c, 0x8f, 0x57, 0xa7, 0xcf, 0x2a, 0x33, 0x89,
+			0xa3, 0x54, 0x5a, 0xb2, 0x63, 0x57, 0xae, 0x84,
+			0x49, 0x31, 0xfe, 0x51, 0x57, 0x36, 0x02, 0xe7,
+			0x21, 0x1e, 0x8e, 0x04, 0xae, 0xc2, 0xc2, 0xfb,
+			0x18, 0xb0, 0x25, 0x74, 0x42, 0xf4, 0x31, 0x14,
+			0xfa, 0x25, 0x90, 0xb0, 0xba, 0x2f, 0x2f, 0x2b,
+			0x7f, 0x03, 0x1e, 0xbe, 0x41, 0xe1, 0xc3, 0xfa,
+			0x46, 0xf5, 0x93, 0xab, 0x2d, 0x31, 0x38, 0x49,
+			0x80, 0x27, 0x16, 0x8f, 0x07, 0x0d, 0xf2, 0xea,
+			0xac, 0xf4, 0x1b, 0x00, 0x23, 0x63, 0x2c, 0xe4,
+			0xe2, 0x00, 0xeb, 0xc6, 0x2c, 0xec, 0xe8, 0xd5,
+			0x1c, 0x3e, 0xed, 0xac, 0x18, 0xa8, 0x62, 0xe0,
+			0xe4, 0x93, 0xa5, 0x00, 0x3f, 0xde, 0x86, 0xc0,
+			0x6e, 0x50, 0xd0, 0x68, 0x59, 0xf1, 0xbc, 0x81,
+			0x25, 0x6e, 0x3c, 0xf8, 0x39, 0xb3, 0x7c, 0xe1,
+			0xaa, 0x6d, 0x49, 0xea, 0x77, 0xf9, 0xdc, 0x28,
+			0xc1, 0x38, 0x6e, 0xe5, 0x2d, 0x1f, 0xfa, 0xe7,
+			0xfc, 0x09, 0xe7, 0x3e, 0x7d, 0xd0, 0x07, 0x73,
+			0x90, 0x0e, 0x90, 0xf8, 0x42, 0x39, 0xf6, 0xef,
+			0xb5, 0xb3, 0xd6, 0x33, 0x5a, 0x5b, 0x65, 0xf9,
+			0x55, 0xc0, 0x01, 0x35, 0x0a, 0xdf, 0x35, 0x4d,
+			0xb8, 0x9f, 0x01, 0x01, 0xe4, 0x24, 0x59, 0x66,
+			0x55, 0x6d, 0x63, 0xbd, 0x1b, 0xfe, 0x58, 0x49,
+			0xf0, 0x78, 0x35, 0x5a, 0x3e, 0xe0, 0x59, 0x3b,
+			0x6e, 0xc5, 0xbc, 0xda, 0x81, 0x4b, 0xde, 0xb8,
+			0x8a, 0xfc, 0x5d, 0xe2, 0x91, 0xbe, 0xbf, 0xec,
+			0x19, 0x42, 0x35, 0xf6, 0x54, 0xfd, 0xbe, 0x9b,
+			0x9e, 0xfa, 0xf6, 0x05, 0xba, 0x44, 0x77, 0x2b,
+			0xe1, 0xc8, 0x75, 0x87, 0x5a, 0x27, 0x92, 0x1f,
+			0xff, 0x35, 0x1f, 0xb4, 0x5d, 0x1e, 0xf5, 0x82,
+			0x79, 0x70, 0xf9, 0x86, 0xdc, 0xbb, 0xb7, 0x8a,
+			0x02, 0x85, 0x83, 0xfa, 0xf1, 0xa4, 0xde, 0x12,
+			0x94, 0x42, 0x85, 0x67, 0x2c, 0x3c, 0x7c, 0x4b,
+			0x0b, 0x51, 0x00, 0x22, 0x6b, 0xcb, 0x94, 0x93,
+			0x5f, 0x9f, 0x57, 0x93, 0x74, 0x93, 0x9c, 0xcd,
+			0x93, 0xed, 0x19, 0x0e, 0x9f, 0xbb, 0x85, 0xbc,
+			0x87, 0xb4, 0x15, 0x63, 0x04, 0x19, 0xbe, 0x97,
+			0x76, 0x90, 0xe0, 0x77, 0xe4, 0x91, 0x5f, 0xd5,
+			0xa0, 0xd2, 0x35, 0xcc, 0xd4, 0xff, 0x0f, 0x34,
+			0xbc, 0xe1, 0x2a, 0xf1, 0xeb, 0x5a, 0x5d, 0xf2,
+			0xd4, 0x43, 0x44, 0x86, 0xed, 0xd1, 0x14, 0x77,
+			0x99, 0x9d, 0x66, 0x4a, 0x81, 0xf3, 0x3b, 0x30,
+			0xf6, 0xb1, 0x68, 0x12, 0x1e, 0x31, 0xb0, 0xf0,
+			0xfc, 0x2c, 0x32, 0xd4, 0x3e, 0x7a, 0x3d, 0x26,
+			0x8b, 0x77, 0x6f, 0x19, 0xc9, 0x9c, 0xfd, 0xe6,
+			0x7c, 0x08, 0x51, 0x73, 0x3e, 0xcd, 0x69, 0xa8,
+			0x43, 0xf9, 0xa0, 0x88, 0x82, 0xf9, 0xa1, 0x5c,
+			0x50, 0x56, 0xd2, 0x2a, 0x97, 0x06, 0x4b, 0x65,
+			0x9e, 0x5e, 0x4f, 0x13, 0x80, 0x3c, 0x45, 0xcb,
+			0xc4, 0x64, 0x13, 0xb5, 0x95, 0x28, 0x7a, 0x15,
+			0x65, 0xee, 0x57, 0x2c, 0xf0, 0xe2, 0x8b, 0xce,
+			0xb8, 0x52, 0x7b, 0xae, 0xa2, 0x2e, 0xd1, 0x69,
+			0x36, 0x48, 0xfb, 0x4b, 0x74, 0xb3, 0x10, 0xab,
+			0xe3, 0x9c, 0x87, 0x47, 0xf0, 0xaf, 0x55, 0x9f,
+			0x94, 0x5e, 0x23, 0xbc, 0xf6, 0xc9, 0xfe, 0xaa,
+			0x15, 0x69, 0x9a, 0xdb, 0x75, 0xdb, 0x49, 0xee,
+			0x3f, 0x7e, 0xbc, 0x84, 0x42, 0x17, 0x79, 0x6a,
+			0xb6, 0xf8, 0x16, 0xd7, 0x90, 0xae, 0x3f, 0x8c,
+			0xbd, 0x47, 0x1c, 0x31, 0x07, 0x11, 0x72, 0x49,
+			0xd5, 0xbf, 0x23, 0x20, 0x4e, 0xb3, 0xaa, 0x2f,
+			0xd7, 0x13, 0x1d, 0x37, 0xda, 0x0b, 0xa0, 0xd5,
+			0x77, 0x9a, 0xc0, 0xd9, 0x01, 0xd6, 0x9c, 0x41,
+			0x10, 0x3c, 0x32, 0xff, 0x9e, 0x2e, 0x38, 0x10,
+			0x19, 0x68, 0xe6, 0xe2, 0xf8, 0x7a, 0xba, 0x75,
+			0xf5, 0xd3, 0xbc, 0xf4, 0x46, 0x5d, 0x21, 0x35,
+			0x07, 0xc7, 0x42, 0x2a, 0x5b, 0x19, 0x37, 0x2c,
+			0x2a, 0x56, 0x36, 0x31, 0x5f, 0x2c, 0xc8, 0x1d,
+			0xb1, 0xf0, 0xb9, 0xaa, 0x69, 0x0b, 0x65, 0x54,
+			0x2b, 0xf1, 0x44, 0xa2, 0xb1, 0x57, 0x6f, 0xeb,
+			0x85, 0x0d, 0x2a, 0xdb, 0x02, 0xf7, 0x38, 0xd3,
+			0x64, 0x33, 0xf2, 0xa0, 0x74, 0x6d, 0xd3, 0x70,
+			0x59, 0x57, 0x8e, 0x8d, 0xbe, 0x8a, 0x89, 0x80,
+			0x44, 0xa8, 0x24, 0x79, 0x3e, 0x4c, 0x8b, 0xd3,
+			0x99, 0x7e, 0x7a, 0x42, 0x98, 0x9a, 0xb0, 0x87,
+			0x0f, 0x96, 0x07, 0xf3, 0x18, 0x06, 0x9d, 0x9a,
+			0x9a, 0xc3, 0xfa, 0x6b, 0x51, 0xfa, 0x20, 0x69,
+			0x53, 0xcb, 0xb5, 0x3a, 0xde, 0x57, 0x19, 0x58,
+			0x6f, 0x52, 0x87, 0x5a, 0x2d, 0x01, 0x0a, 0x26,
+			0x29, 0x36, 0xcc, 0x7e, 0x34, 0xec, 0x0f, 0x1b,
+			0xf5, 0x18, 0x47, 0xb6, 0x77, 0x24, 0xe5, 0x16,
+			0xcc, 0x6f, 0xf4, 0x17, 0x33, 0x6f, 0x7b, 0x56,
+			0x39, 0xf9, 0xcc, 0x18, 0x3d, 0x21, 0x3a, 0x65,
+			0x5a, 0x12, 0x7b, 0x88, 0x25, 0x6d, 0x0e, 0x12,
+			0x7f, 0x1a, 0xdd, 0x70, 0x4f, 0x09, 0xb9, 0x68,
+			0x3c, 0x99, 0x52, 0x7a, 0xc9, 0x2a, 0x2d, 0xd6,
+			0xcd, 0x51, 0x61, 0xcd, 0xac, 0x04, 0xe5, 0x2a,
+			0x08, 0x95, 0x83, 0x77, 0x02, 0x01, 0xa6, 0xf9,
+			0x63, 0x1e, 0x36, 0x83, 0x31, 0x81, 0x57, 0x79,
+			0x62, 0xaf, 0x19, 0xb5, 0x3a, 0xd4, 0xc7, 0xe0,
+			0xfe, 0x37, 0xed, 0xb3, 0x06, 0x12, 0xe7, 0x1b,
+			0xd5, 0x4a, 0x0c, 0x52, 0x7c, 0x15, 0x04, 0xec,
+			0xe4, 0x21, 0x39, 0xe8, 0xa3, 0x34, 0x55, 0x21,
+			0x84, 0xf7, 0xfa, 0xa3, 0x79, 0x5a, 0xa4, 0xcc,
+			0x63, 0xf6, 0xe8, 0x5b, 0x22, 0x8d, 0x4b, 0xdd,
+			0x72, 0x1a, 0xa3, 0xb7, 0xf6, 0xfb, 0x93, 0xef,
+			0xb3, 0xf2, 0x61, 0xc3, 0x5e, 0xf1, 0x9c, 0x55,
+			0x0f, 0x52, 0x27, 0xeb, 0x65, 0x57, 0x5e, 0x72,
+			0xf4, 0xbf, 0xb5, 0x14, 0x13, 0xb9, 0xc3, 0x60,
+			0x44, 0x31, 0xae, 0x4f, 0xea, 0x1e, 0x55, 0x62,
+			0x98, 0x88, 0x4b, 0xcd, 0x99, 0x40, 0x3d, 0xfd,
+			0xc5, 0x54, 0xea, 0x6a, 0x2d, 0x79, 0x3c, 0xb1,
+			0x86, 0x5c, 0x9f, 0x4d, 0xf5, 0x8b, 0x50, 0x60,
+			0x31, 0x21, 0x9d, 0x5b, 0x64, 0x44, 0xee, 0xe3,
+			0x83, 0x60, 0xe8, 0xc2, 0xff, 0x5b, 0x2a, 0x1a,
+			0xe7, 0xd7, 0x94, 0x04, 0x0d, 0x3f, 0x02, 0x11,
+			0x1a, 0xaa, 0x2e, 0xf2, 0xf5, 0x9c, 0xbb, 0xb6,
+			0xde, 0x76, 0x6e, 0xf8, 0x5e, 0x81, 0x19, 0x42,
+			0x21, 0xea, 0x54, 0xd2, 0xa6, 0xee, 0x83, 0x25,
+			0xc6, 0x75, 0x82, 0x41, 0xd2, 0x83, 0x2e, 0xb7,
+			0xa2, 0x10, 0x2f, 0xed, 0x51, 0x35, 0xca, 0x20,
+			0xde, 0x17, 0x7b, 0xf4, 0xbc, 0xfd, 0x02, 0x82,
+			0xf9, 0x59, 0x36, 0xd2, 0x94, 0xf6, 0x7a, 0x39,
+			0xe4, 0xa3, 0xe0, 0x10, 0x7e, 0x45, 0xed, 0xba,
+			0x21, 0x34, 0x8a, 0xfd, 0x0b, 0xe1, 0x74, 0x1d,
+			0xbc, 0xc8, 0x06, 0x2e, 0x38, 0x53, 0x24, 0x78,
+			0x69, 0xf7, 0x44, 0x66, 0x0c, 0xd6, 0x61, 0xcb,
+			0xbd, 0x58, 0xdc, 0xd7, 0xb2, 0x6c, 0x41, 0xb0,
+			0x1b, 0xa4, 0xf4, 0x85, 0x28, 0xc0, 0x0f, 0xe4,
+			0xb9, 0x98, 0x32, 0x8e, 0xcf, 0x68, 0x14, 0xa4,
+			0x4a, 0x5d, 0xec, 0xd0, 0x48, 0x61, 0xe1, 0xd5,
+			0x80, 0x03, 0x65, 0xe3, 0x97, 0xa7, 0xad, 0x66,
+			0x32, 0xea, 0x8f, 0xc1, 0x2c, 0xca, 0x08, 0xd7,
+			0x15, 0x7d, 0x5e, 0x2a, 0x74, 0x1d, 0x15, 0x2f,
+			0x68, 0x0a, 0xe4, 0x75, 0x66, 0xd9, 0x2b, 0x6f,
+			0x66, 0xe3, 0xcc, 0x82, 0xfd, 0x43, 0x8c, 0xa5,
+			0x16, 0x34, 0x60, 0x1c, 0x05, 0x26, 0x42, 0xdf,
+			0x0b, 0xe1, 0x0f, 0x9b, 0xd1, 0x38, 0xfc, 0xff,
+			0xac, 0x37, 0x78, 0x60, 0xfc, 0x7f, 0x60, 0x09,
+			0x7d, 0x20, 0x06, 0xd1, 0xa1, 0x9e, 0xfe, 0xeb,
+			0x34, 0xa7, 0x89, 0xf9, 0xf8, 0xe2, 0xed, 0x9b,
+			0x2f, 0x6b, 0xf8, 0x47, 0x91, 0x04, 0x01, 0xdb,
+			0x03, 0x51, 0x5c, 0xc1, 0x79, 0x7b, 0x63, 0x6a,
+			0x03, 0x47, 0xd5, 0xbb, 0xd6, 0x97, 0x6f, 0xc0,
+			0x82, 0x8a, 0xb4, 0x47, 0x94, 0x42, 0x12, 0x82,
+			0xba, 0x23, 0x76, 0xcc, 0x36, 0x75, 0x95, 0x4d,
+			0xb6, 0x31, 0xf4, 0x50, 0x23, 0x85, 0xee, 0xad,
+			0x43, 0x39, 0xb5, 0xfb, 0x49, 0x0a, 0xa5, 0xdb,
+			0x83, 0xd3, 0xd1, 0x0a, 0x0f, 0x7b, 0xd4, 0x06,
+			0xba, 0x6d, 0x03, 0x1b, 0xe2, 0xf0, 0x21, 0xa2,
+			0xf9, 0xf4, 0x64, 0xc2, 0xfb, 0xe1, 0xa8, 0x62,
+			0x68, 0x90, 0xd4, 0xaf, 0x41, 0x4d, 0x68, 0x07,
+			0x20, 0xa4, 0x9c, 0xf5, 0xd6, 0xd0, 0x2a, 0xb7,
+			0x0c, 0x53, 0xe5, 0xeb, 0x91, 0x4b, 0xc1, 0x45,
+			0x42, 0x93, 0xa8, 0x2f, 0x6f, 0xec, 0x89, 0x72,
+			0x48, 0x70, 0xd8, 0x91, 0xa3, 0x45, 0x21, 0x6a,
+			0x2b, 0xf9, 0x12, 0x48, 0x8d, 0x5d, 0xcd, 0x4e,
+			0x0b, 0x6c, 0xb4, 0x21, 0xd7, 0x3b, 0x3f, 0xf5,
+			0xda, 0x40, 0xff, 0x2a, 0x9a, 0xeb, 0x11, 0x7d,
+			0xf7, 0xd4, 0xe4, 0xa9, 0x1f, 0xf0, 0x60, 0x6e,
+			0xb4, 0xc0, 0x0c, 0x08, 0x78, 0x23, 0x83, 0xd4,
+			0x85, 0x6f, 0x2b, 0x2b, 0x7d, 0x21, 0x24, 0x78,
+			0x8a, 0xd5, 0x83, 0x3f, 0x74, 0x26, 0xe3, 0xb5,
+			0xd2, 0x6c, 0xf2, 0xaf, 0xaf, 0x16, 0x82, 0xa3,
+			0x1c, 0xff, 0x46, 0xbc, 0x10, 0x56, 0xfc, 0x20,
+			0x55, 0x9c, 0xf6, 0x5f, 0x05, 0x57, 0xce, 0xd0,
+			0x1a, 0x8e, 0x10, 0x89, 0x63, 0xe9, 0x25, 0x1d,
+			0x4b, 0x20, 0xff, 0x34, 0x8b, 0x6a, 0x40, 0xda,
+			0x14, 0xaf, 0x0b, 0x30, 0x3e, 0x70, 0x1d, 0xba,
+			0x1a, 0x0e, 0xe9, 0x5e, 0xbf, 0x9a, 0x67, 0x80,
+			0x16, 0x32, 0x24, 0xa4, 0xb8, 0xa7, 0x5d, 0x45,
+			0x49, 0x96, 0x05, 0x6d, 0x8e, 0x0e, 0x93, 0xe1,
+			0xc0, 0x88, 0x56, 0x61, 0x57, 0xdf, 0x60, 0x55,
+			0x15, 0xc5, 0x8d, 0x1d, 0x23, 0x69, 0x81, 0xfa,
+			0xa3, 0xf2, 0x61, 0xb9, 0x9b, 0xcc, 0xd9, 0x69,
+			0xac, 0x0c, 0x30, 0xf8, 0x4c, 0x5f, 0x58, 0x6f,
+			0x88, 0x98, 0xef, 0xde, 0xae, 0x9e, 0xbf, 0x79,
+			0xd6, 0xe6, 0x1e, 0xd8, 0xc4, 0x67, 0x08, 0xc5,
+			0x87, 0xb9, 0x8b, 0xfc, 0x8b, 0xcf, 0xca, 0xad,
+			0x73, 0x42, 0xa1, 0x5f, 0x32, 0x8b, 0x0e, 0x11,
+			0x31, 0x41, 0xf2, 0x3b, 0x8a, 0xa2, 0x22, 0xc5,
+			0xcb, 0xc8, 0x6a, 0x42, 0x23, 0x2a, 0x2f, 0xd4,
+			0x1e, 0x06, 0x82, 0xb6, 0xaa, 0x0c, 0x25, 0x4d,
+			0xd9, 0x87, 0x21, 0xa0, 0xc0, 0xe9, 0x27, 0xd6,
+			0xb4, 0x2e, 0x5e, 0xb4, 0x90, 0x81, 0x22, 0xe4,
+			0x3c, 0x75, 0x5a, 0xef, 0x6b, 0x13, 0x4d, 0x04,
+			0xde, 0x61, 0xb2, 0x7f, 0x38, 0x22, 0x31, 0xd5,
+			0x9a, 0x2b, 0x71, 0x96, 0x0a, 0xf8, 0xb3, 0x5c,
+			0x2d, 0x80, 0xbe, 0xee, 0x36, 0x25, 0xda, 0xd5,
+			0x20, 0x3a, 0x16, 0xe4, 0x76, 0xe9, 0x94, 0xaa,
+			0x57, 0x98, 0x5c, 0x42, 0x82, 0x24, 0x0c, 0x7f,
+			0xe7, 0x6e, 0x5b, 0x6e, 0xc3, 0x5e, 0xa2, 0x77,
+			0x86, 0x44, 0x20, 0x8b, 0xc7, 0x9e, 0x8c, 0xb8,
+			0x14, 0x1b, 0xbc, 0x0f, 0xa7, 0x90, 0xce, 0x72,
+			0x78, 0x26, 0x3b, 0xcf, 0xd3, 0x47, 0xd7, 0x91,
+			0xe2, 0xa6, 0xe8, 0xf1, 0xf8, 0x0a, 0x12, 0x17,
+			0x3c, 0xc2, 0xa2, 0xbd, 0x4d, 0xe8, 0x27, 0xfc,
+			0x27, 0x7b, 0xa4, 0x2d, 0x5e, 0x73, 0x21, 0x0e,
+			0x62, 0xa0, 0x95, 0xbf, 0x83, 0x12, 0x12, 0x2b,
+			0x05, 0x82, 0xf2, 0x14, 0x38, 0x94, 0xf2, 0xb9,
+			0x4d, 0xc7, 0x91, 0x4d, 0x2c, 0x2a, 0x18, 0xdb,
+			0xae, 0x7d, 0x6b, 0x2a, 0x2f, 0xb1, 0xc4, 0x0a,
+			0x30, 0x46, 0x4a, 0x36, 0xa1, 0xe3, 0x02, 0x34,
+			0xf7, 0xce, 0x77, 0xae, 0x2f, 0x4d, 0x92, 0x6e,
+			0xe5, 0xe6, 0x51, 0x24, 0x4c, 0x4d, 0x63, 0xae,
+			0x9e, 0xfe, 0x4e, 0x27, 0xeb, 0x19, 0xcd, 0x57,
+			0xb9, 0xb2, 0x25, 0x88, 0xac, 0xaa, 0xb1, 0x13,
+			0xc5, 0x8d, 0xc6, 0x9e, 0xcf, 0x5c, 0x8a, 0x46,
+			0x01, 0xdf, 0x4d, 0x43, 0x3c, 0xfe, 0x37, 0x69,
+			0x1b, 0x89, 0xba, 0xb3, 0x03, 0x3f, 0xa6, 0x16,
+			0x09, 0xa8, 0xb9, 0x72, 0xca, 0x41, 0x18, 0xdd,
+			0xe4, 0x31, 0x14, 0x96, 0xe5, 0xdd, 0x9f, 0xc6,
+			0x21, 0x1b, 0xec, 0x41, 0xad, 0x65, 0x51, 0xfa,
+			0x59, 0x8f, 0x5f, 0xca, 0x35, 0xd9, 0x9b, 0x0a,
+			0x8d, 0x31, 0x74, 0x91, 0x0f, 0x51, 0x7d, 0x17,
+			0x9e, 0xe5, 0xd9, 0x0e, 0xb0, 0x63, 0x91, 0xb3,
+			0x32, 0xe8, 0xc8, 0xb2, 0x5f, 0x99, 0xc8, 0xc4,
+			0x1d, 0x8e, 0x6e, 0xd7, 0x6c, 0xcf, 0x55, 0xc8,
+			0xf0, 0x88, 0xac, 0xa0, 0x22, 0x07, 0xe7, 0x2f,
+			0x38, 0x1c, 0xd5, 0x4b, 0x13, 0x56, 0xf1, 0x4e,
+			0x42, 0x66, 0x41, 0xae, 0x45, 0x7a, 0xee, 0x14,
+			0xfe, 0x26, 0xd9, 0xd9, 0xf9, 0x22, 0x40, 0xc4,
+			0xc8, 0x1c, 0x77, 0xcd, 0xf3, 0x3f, 0x66, 0xa2,
+			0x98, 0xef, 0x69, 0x1f, 0x48, 0x29, 0xbe, 0xf9,
+			0xdd, 0x3c, 0xe9, 0x0b, 0x32, 0xaf, 0x59, 0xd7,
+			0x7d, 0x5a, 0x71, 0xff, 0x1f, 0x3e, 0xa0, 0xb3,
+			0x34, 0x2f, 0x45, 0x8d, 0x25, 0xea, 0xfd, 0x62,
+			0x88, 0xae, 0x2a, 0x80, 0x44, 0x93, 0xab, 0x44,
+			0x1d, 0x7b, 0xe0, 0x0e, 0x9f, 0xe9, 0xe4, 0x4d,
+			0x81, 0xb8, 0x9b, 0x9a, 0x0f, 0x90, 0x0b, 0x26,
+			0xdf, 0xb3, 0xdc, 0x97, 0x69, 0xdb, 0x68, 0xe9,
+			0xda, 0xd0, 0xc9, 0x6a, 0xdd, 0x82, 0x57, 0x7f,
+			0xa0, 0xb1, 0xaa, 0x6d, 0x3e, 0x68, 0x9d, 0xd6,
+			0x93, 0xbd, 0x20, 0xbf, 0x2b, 0x66, 0xaf, 0x2d,
+			0x4a, 0xba, 0x9b, 0xd9, 0x70, 0x3f, 0xc8, 0xbc,
+			0xd6, 0x21, 0x12, 0xdf, 0x90, 0xfe, 0x3c, 0xd9,
+			0x45, 0xc7, 0x5b, 0x83, 0xfb, 0x22, 0x79, 0x1e,
+			0xbf, 0x7a, 0x80, 0xb8, 0x65, 0xee, 0x01, 0x09,
+			0x3e, 0x83, 0x23, 0xd9, 0xba, 0x10, 0x87, 0x2d,
+			0x08, 0x07, 0x89, 0x4f, 0xad, 0xd3, 0x22, 0x79,
+			0xcb, 0xd7, 0xb9, 0xf3, 0x32, 0xd4, 0xc0, 0xd2,
+			0x9c, 0x24, 0xf4, 0xe7, 0xa9, 0xd4, 0x2b, 0x04,
+			0x2d, 0x29, 0x07, 0x80, 0x77, 0xaa, 0x74, 0xc2,
+			0x1f, 0xdb, 0xda, 0xa9, 0x08, 0x79, 0x9d, 0x34,
+			0xc5, 0x14, 0x64, 0xdf, 0x72, 0xc0, 0x67, 0x6d,
+			0x0f, 0xbf, 0x17, 0x39, 0x8f, 0x36, 0x8f, 0x59,
+			0xce, 0x83, 0x6f, 0x84, 0x5f, 0x67, 0xef, 0x46,
+			0x6a, 0xa4, 0x91, 0xf0, 0x40, 0x02, 0x22, 0xea,
+			0x28, 0xde, 0xa7, 0x74, 0x14, 0xae, 0xe1, 0xd5,
+			0x7d, 0xa5, 0x9b, 0xb7, 0xc2, 0x40, 0xea, 0x89,
+			0x03, 0xca, 0x03, 0x15, 0x10, 0x38, 0x11, 0x18,
+			0xd3, 0x3c, 0xc8, 0xc0, 0xe1, 0x24, 0x9f, 0xc5,
+			0xa9, 0xd1, 0x3e, 0x6b, 0x83, 0xf5, 0x5a, 0x67,
+			0x3b, 0x71, 0x0a, 0x28, 0x76, 0x2e, 0x55, 0xea,
+			0x94, 0xff, 0xca, 0xb6, 0x03, 0xf5, 0x4e, 0xfe,
+			0x97, 0x21, 0xb0, 0xbd, 0x37, 0xf0, 0x78, 0xfa,
+			0x1c, 0xad, 0x02, 0xca, 0x8d, 0x63, 0x7c, 0x65,
+			0xda, 0x19, 0x4c, 0x81, 0x06, 0xa0, 0x48, 0x24,
+			0xe8, 0xe1, 0x6d, 0x31, 0x66, 0x08, 0x27, 0xf1,
+			0x64, 0xa3, 0xc3, 0x23, 0xb7, 0x8f, 0xa6, 0x0d,
+			0x88, 0x68, 0x20, 0xef, 0xa1, 0xb8, 0x25, 0x23,
+			0x3e, 0xf1, 0xcd, 0x72, 0xb1, 0xd9, 0x17, 0x6c,
+			0xaf, 0x7f, 0x40, 0x55, 0xbc, 0x93, 0x20, 0x86,
+			0x8d, 0x4a, 0x2a, 0xa7, 0xcb, 0x37, 0x7c, 0xd7,
+			0xf1, 0x8a, 0x9b, 0x8a, 0x02, 0x4b, 0x91, 0x70,
+			0x61, 0xf4, 0xb7, 0xd5, 0x95, 0x86, 0xb5, 0x54,
+			0xc6, 0x2d, 0xbc, 0x2c, 0x9b, 0x22, 0x5d, 0xd0,
+			0x7b, 0xd2, 0xc1, 0x33, 0x70, 0x15, 0xb8, 0xef,
+			0x15, 0xdc, 0x01, 0x8e, 0xe6, 0x75, 0x0e, 0xd7,
+			0x01, 0x79, 0x4a, 0x29, 0xcc, 0xab, 0x93, 0x6b,
+			0xb2, 0xb9, 0x2b, 0x11, 0xf5, 0xdc, 0x23, 0xcd,
+			0x66, 0x30, 0x49, 0xa3, 0x74, 0x77, 0x0f, 0x09,
+			0x36, 0xf7, 0x0b, 0x55, 0x15, 0x1f, 0x29, 0xb7,
+			0x58, 0xa5, 0xef, 0xa9, 0x71, 0x20, 0xd9, 0xe7,
+			0x7c, 0x9e, 0x38, 0xff, 0x4d, 0xc9, 0x88, 0xf0,
+			0x43, 0x93, 0xae, 0x5b, 0xeb, 0x49, 0x4d, 0x47,
+			0x52, 0x9a, 0x0f, 0x44, 0xb5, 0x6e, 0xb7, 0x9e,
+			0x1d, 0x42, 0x8d, 0xd9, 0x6a, 0x51, 0x6b, 0x01,
+			0x3e, 0x8e, 0xc7, 0x59, 0x86, 0xde, 0xee, 0x87,
+			0x53, 0x01, 0xe0, 0x08, 0x3c, 0x17, 0xb0, 0xb1,
+			0x90, 0x40, 0x4a, 0x5f, 0xa6, 0xa9, 0x94, 0x7f,
+			0xd9, 0x48, 0xbd, 0x88, 0x3c, 0x71, 0xa4, 0xbb,
+			0x3b, 0x46, 0x3a, 0x5a, 0x04, 0x72, 0x52, 0x72,
+			0xa1, 0x0f, 0x4f, 0x88, 0x29, 0xf8, 0x9e, 0xe6,
+			0xda, 0x5d, 0x22, 0x22, 0x31, 0xd9, 0xb6, 0xed,
+			0x08, 0xcf, 0xf6, 0x7b, 0x83, 0xb6, 0x5f, 0x5e,
+			0x46, 0x53, 0xcf, 0x97, 0x5b, 0x88, 0x9a, 0x2d,
+			0x62, 0x80, 0xd7, 0xbb, 0xa5, 0xcb, 0x05, 0x5e,
+			0x88, 0x81, 0xf0, 0xee, 0x48, 0xfa, 0x3c, 0xec,
+			0xd2, 0xae, 0x11, 0x5b, 0xa7, 0xb0, 0x7f, 0x33,
+			0x8c, 0x72, 0x37, 0x66, 0x21, 0xaa, 0x6f, 0x71,
+			0xf7, 0xc3, 0x15, 0xef, 0x52, 0x54, 0x6c, 0x4a,
+			0xac, 0x75, 0xf8, 0x9f, 0xe6, 0x6a, 0x66, 0x3d,
+			0xb6, 0x09, 0x5a, 0x1f, 0x1d, 0x14, 0x36, 0xe6,
+			0x76, 0x47, 0x6c, 0xe3, 0x7f, 0x8b, 0x7d, 0xaa,
+			0xeb, 0xf7, 0xe1, 0xd4, 0x25, 0x71, 0xbf, 0xae,
+			0x3f, 0x66, 0x9a, 0x20, 0x8f, 0x09, 0xd7, 0x20,
+			0x8b, 0x9a, 0xb5, 0x83, 0x58, 0xbe, 0x03, 0x0f,
+			0xb5, 0xca, 0xc5, 0xd8, 0x70, 0x93, 0x8f, 0x94,
+			0x66, 0xc4, 0x33, 0xa3, 0x0f, 0xe6, 0x73, 0x79,
+			0x76, 0xfc, 0x77, 0x3b, 0xd3, 0x9a, 0xc3, 0xa8,
+			0x15, 0xfb, 0x3a, 0x40, 0xad, 0x12, 0x8c, 0x6b,
+			0x88, 0xdb, 0x70, 0x00, 0xf8, 0x0a, 0x3c, 0xce,
+			0x68, 0x29, 0x0a, 0xbd, 0xc4, 0x24, 0x31, 0x92,
+			0x8f, 0x19, 0xa6, 0x00, 0xf6, 0xbc, 0x00, 0xa8,
+			0xa8, 0x46, 0xc0, 0x9f, 0x7e, 0xab, 0x79, 0x23,
+			0x46, 0x6a, 0x1d, 0xa0, 0x18, 0xa6, 0x41, 0xed,
+			0xcf, 0x90, 0x49, 0xd8, 0x72, 0x69, 0x62, 0x0f,
+			0x68, 0x42, 0x1a, 0x60, 0xd8, 0x8f, 0x68, 0xdc,
+			0xd7, 0xe2, 0x4d, 0x34, 0x83, 0x2b, 0x42, 0xd2,
+			0x9b, 0x5d, 0x1e, 0x9c, 0x04, 0x49, 0xec, 0x3b,
+			0x9b, 0xaa, 0x9d, 0xc9, 0x75, 0xaf, 0x0d, 0xe1,
+			0x2d, 0x65, 0x5c, 0x8e, 0x71, 0x22, 0x41, 0xed,
+			0x51, 0x38, 0xe2, 0x8b, 0xcd, 0x62, 0x15, 0x5a,
+			0xd8, 0xc5, 0xdb, 0xcc, 0x91, 0x72, 0x47, 0x0a,
+			0x7e, 0xd7, 0x53, 0xff, 0x80, 0x48, 0x98, 0xed,
+			0x90, 0xb0, 0x96, 0x11, 0x1f, 0xe9, 0x38, 0xc0,
+			0x3b, 0xb2, 0xec, 0x90, 0x1c, 0x17, 0x66, 0x05,
+			0x31, 0x09, 0x69, 0xfd, 0x0d, 0x59, 0x68, 0x5e,
+			0x56, 0xf3, 0x6b, 0x93, 0x18, 0x06, 0x01, 0x67,
+			0x3e, 0x49, 0x45, 0xb3, 0x90, 0x15, 0x28, 0xe9,
+			0x9d, 0xc7, 0x79, 0x88, 0x37, 0x9a, 0xc3, 0x77,
+			0xd7, 0x35, 0x77, 0xd1, 0x29, 0x30, 0x53, 0x39,
+			0xa9, 0x64, 0x94, 0x90, 0x0c, 0xb8, 0x54, 0x12,
+			0x59, 0xfb, 0x47, 0xf0, 0xde, 0xdc, 0x95, 0x2a,
+			0xe0, 0xd5, 0x22, 0x04, 0xff, 0xca, 0x14, 0x92,
+			0xe2, 0x2b, 0x8e, 0x2c, 0xe5, 0xc6, 0xd2, 0x4c,
+			0xcb, 0x19, 0x9e, 0x8d, 0x41, 0xc3, 0x29, 0xe5,
+			0xfd, 0x42, 0xae, 0xe7, 0x20, 0x08, 0x63, 0x32,
+			0x32, 0x6b, 0x73, 0x7d, 0x88, 0x8a, 0x34, 0xec,
+			0x79, 0x21, 0xaa, 0xf1, 0x3e, 0x14, 0x69, 0x01,
+			0x9c, 0xbd, 0x6a, 0x3f, 0x16, 0xb9, 0x18, 0x19,
+			0x3e, 0xf5, 0xf8, 0x9d, 0x3b, 0x7a, 0x36, 0x9a,
+			0xee, 0x4a, 0x4b, 0xec, 0x70, 0x50, 0xba, 0xb1,
+			0xb5, 0x0e, 0x0a, 0x0b, 0x1b, 0xda, 0x6d, 0x99,
+			0xaa, 0x06, 0x62, 0x86, 0x1f, 0x89, 0x6e, 0xf1,
+			0x2d, 0x61, 0x6e, 0x71, 0x17, 0x57, 0xc1, 0x58,
+			0x34, 0xdb, 0x6a, 0x1e, 0x94, 0x1e, 0xb0, 0x96,
+			0x8f, 0x6c, 0x89, 0xc1, 0x80, 0xf7, 0x71, 0xa2,
+			0x50, 0xff, 0x10, 0x53, 0xf1, 0xe6, 0x26, 0x1c,
+			0x06, 0x08, 0xde, 0x54, 0xef, 0x70, 0xe9, 0xdf,
+			0x9a, 0x17, 0xbb, 0xd7, 0x1d, 0xf2, 0xe5, 0x6b,
+			0x41, 0xec, 0xac, 0x89, 0x23, 0x25, 0x33, 0x5f,
+			0xaf, 0x8e, 0x57, 0x87, 0x72, 0xd3, 0x35, 0xf8,
+			0x0b, 0xf4, 0x84, 0x7e, 0x63, 0x4e, 0xc4, 0x3c,
+			0x94, 0xec, 0x10, 0x27, 0x11, 0xa3, 0x92, 0xee,
+			0x51, 0x49, 0x49, 0xd7, 0xc0, 0xfb, 0xb7, 0x75,
+			0xd7, 0x70, 0xf8, 0x6a, 0xa5, 0x2e, 0xc7, 0x79,
+			0x68, 0x2b, 0x15, 0x8d, 0xa6, 0x0f, 0x50, 0x63,
+			0xdb, 0xa7, 0x39, 0x4b, 0x9e, 0xf2, 0xd2, 0x46,
+			0xf8, 0x53, 0xa5, 0x07, 0xed, 0x30, 0x28, 0x2c,
+			0x71, 0x45, 0x15, 0x86, 0xbe, 0x7f, 0x15, 0xd3,
+			0xf1, 0xc4, 0x33, 0xd5, 0x0c, 0x43, 0x49, 0x2e,
+			0xcc, 0xd5, 0x36, 0xe9, 0x03, 0xde, 0xba, 0x24,
+			0xae, 0xe0, 0x80, 0xaa, 0x32, 0x73, 0xce, 0xa3,
+			0xac, 0xf0, 0xa7, 0x51, 0xdf, 0x56, 0x71, 0xf5,
+			0x3b, 0xd1, 0x3e, 0x32, 0x7c, 0xde, 0xed, 0x0d,
+			0x7f, 0x9f, 0xbc, 0x25, 0x58, 0xf3, 0x8d, 0xc4,
+			0x4f, 0x82, 0xb7, 0xdf, 0x8c, 0xfc, 0x34, 0x2e,
+			0x37, 0x71, 0xfe, 0x71, 0x6f, 0xa7, 0x44, 0x2e,
+			0x24, 0x46, 0x25, 0x73, 0xaa, 0xc2, 0x7d, 0x8c,
+			0x86, 0x54, 0x65, 0xed, 0x1d, 0xe3, 0x44, 0xb1,
+			0xfb, 0xf9, 0x5a, 0xe7, 0xd0, 0x20, 0xbf, 0x0e,
+			0x69, 0xf2, 0x21, 0xac, 0x76, 0x3c, 0x27, 0xb7,
+			0xe0, 0xd6, 0x57, 0x34, 0xd1, 0xef, 0x34, 0x3d,
+			0xc9, 0x5c, 0xd1, 0x1e, 0x25, 0x08, 0x6c, 0xc9,
+			0x00, 0xd7, 0x27, 0x16, 0x1a, 0x1f, 0x1d, 0xe3,
+			0x0b, 0x95, 0xc4, 0x12, 0x07, 0xbb, 0x1d, 0x54,
+			0x76, 0x88, 0xd7, 0x05, 0xe4, 0x88, 0x0c, 0xdc,
+			0x63, 0x6f, 0x8a, 0x46, 0xe0, 0xc4, 0x0a, 0xa4,
+			0x51, 0x55, 0x92, 0xf0, 0x6f, 0xd2, 0x7e, 0xe9,
+			0x6d, 0x58, 0x5b, 0xf6, 0xff, 0x03, 0x16, 0x33,
+			0x20, 0x66, 0xc0, 0xec, 0x51, 0x82, 0xc4, 0x08,
+			0xdb, 0x98, 0x3e, 0x6b, 0x32, 0xaa, 0xd3, 0xf9,
+			0x9e, 0x8d, 0xdb, 0x32, 0xfb, 0x67, 0x59, 0x30,
+			0xa5, 0x44, 0x85, 0xc2, 0xd7, 0x91, 0xd9, 0xf9,
+			0xc4, 0x00, 0x1d, 0x43, 0x9a, 0x0d, 0x1f, 0x35,
+			0x6d, 0x3b, 0x68, 0x35, 0x3d, 0xf1, 0xff, 0x33,
+			0x31, 0x81, 0xb5, 0xf1, 0x72, 0x94, 0x53, 0xce,
+			0xf4, 0x28, 0xeb, 0x84, 0x36, 0xd4, 0x8b, 0x71,
+			0xf1, 0x96, 0x65, 0x5d, 0x20, 0x69, 0xe5, 0x5d,
+			0x9e, 0x38, 0xf5, 0xeb, 0x88, 0x3f, 0x72, 0x05,
+			0x79, 0xb5, 0xd7, 0x0f, 0x48, 0xa1, 0xfe, 0xb0,
+			0x2f, 0x7e, 0x79, 0x71, 0x99, 0x01, 0x57, 0xf3,
+			0x2e, 0xfc, 0x5a, 0xac, 0x9a, 0x9a, 0x92, 0xe9,
+			0xe5, 0x77, 0x75, 0x68, 0x1f, 0x11, 0xd8, 0xce,
+			0x76, 0xf8, 0x44, 0x44, 0x3f, 0xab, 0x2a, 0xad,
+			0x1c, 0xf5, 0x7a, 0x52, 0xf7, 0x31, 0x25, 0x94,
+			0x29, 0xe3, 0xef, 0xd2, 0xf1, 0xd9, 0xbe, 0x80,
+			0x61, 0x5e, 0x10, 0x1f, 0x0d, 0x85, 0x64, 0x3c,
+			0x84, 0xe9, 0x61, 0xe0, 0x55, 0xce, 0xc2, 0xc2,
+			0x85, 0x55, 0xd8, 0xc6, 0x87, 0x48, 0xf5, 0xbf,
+			0x24, 0xdf, 0xfd, 0x0a, 0xe6, 0x2f, 0xa1, 0xa7,
+			0x18, 0x4c, 0x4b, 0x05, 0x17, 0x91, 0x0c, 0x21,
+			0x54, 0x47, 0x3a, 0x68, 0xfd, 0x35, 0xff, 0x15,
+			0x54, 0xfa, 0xa9, 0x08, 0x82, 0xbb, 0x9f, 0xf5,
+			0x63, 0x85, 0xbc, 0x28, 0x14, 0xdf, 0x88, 0x3b,
+			0xee, 0x7f, 0xbc, 0xab, 0x99, 0x43, 0xa6, 0xc6,
+			0xcd, 0x6f, 0x10, 0x17, 0x9f, 0x5f, 0x44, 0x02,
+			0xab, 0x7d, 0x55, 0x9b, 0xef, 0x58, 0xc7, 0xe5,
+			0xda, 0xe9, 0x08, 0xc7, 0x86, 0x01, 0x6b, 0xd5,
+			0x02, 0x11, 0xb0, 0x18, 0xa0, 0x8e, 0x3c, 0xe4,
+			0x12, 0x48, 0xab, 0x2d, 0xc6, 0x73, 0xec, 0xc7,
+			0x7b, 0x44, 0x55, 0x23, 0x31, 0x3f, 0x60, 0x58,
+			0xeb, 0x70, 0x59, 0x49, 0xe0, 0xb9, 0x50, 0x3b,
+			0xe6, 0xcd, 0xfa, 0x82, 0xdb, 0x69, 0x82, 0x22,
+			0x71, 0x7d, 0xf2, 0xd9, 0x52, 0xfa, 0x62, 0x06,
+			0x7a, 0xf8, 0xd1, 0x71, 0xc7, 0xc8, 0xdf, 0xf1,
+			0xe3, 0xa5, 0xd9, 0x21, 0x45, 0x29, 0x59, 0xfe,
+			0x56, 0x6f, 0xdb, 0x80, 0xbd, 0xf1, 0xb5, 0x07,
+			0x99, 0xca, 0x28, 0x2a, 0x6c, 0xe5, 0x00, 0x72,
+			0xd6, 0xa4, 0xc6, 0x9c, 0xa8, 0x17, 0x9d, 0xe6,
+			0x63, 0x61, 0x0a, 0xd2, 0xee, 0x5e, 0xf9, 0x1c,
+			0x3c, 0x1a, 0x60, 0x9c, 0x96, 0xeb, 0xc3, 0x67,
+			0x92, 0x05, 0x18, 0x5b, 0xa9, 0xab, 0x1c, 0xd9,
+			0x7b, 0x64, 0x9c, 0x77, 0x33, 0xfa, 0xfe, 0xea,
+			0xa8, 0x3e, 0x90, 0xf8, 0x92, 0x4a, 0x98, 0xfa,
+			0x04, 0x14, 0x45, 0x95, 0xf2, 0x76, 0xfc, 0x3c,
+			0xf6, 0x81, 0xde, 0x80, 0x02, 0xf6, 0x40, 0xda,
+			0x02, 0xc5, 0xff, 0x4c, 0xf2, 0xe2, 0x83, 0xa4,
+			0xd5, 0x5c, 0x7a, 0x9a, 0xfc, 0x45, 0xbc, 0x7e,
+			0xfa, 0xcb, 0x67, 0xb9, 0x81, 0x50, 0x12, 0x9c,
+			0x9b, 0xa0, 0x9f, 0xe8, 0xe0, 0x05, 0x29, 0xa3,
+			0xea, 0x13, 0x18, 0x42, 0x43, 0xe7, 0xfd, 0xb5,
+			0xc6, 0x47, 0x27, 0x41, 0x06, 0xac, 0x73, 0x1a,
+			0x15, 0xe0, 0x1d, 0xfc, 0x1a, 0xd2, 0xbd, 0x07,
+			0x4d, 0x6f, 0x6d, 0x56, 0xe9, 0x01, 0x6b, 0xfa,
+			0x21, 0xc8, 0x05, 0x59, 0x19, 0x12, 0xd4, 0x5c,
+			0xc4, 0x2e, 0xf0, 0x9c, 0xfa, 0x71, 0x64, 0x49,
+			0xdc, 0xee, 0x32, 0xff, 0xd8, 0xe2, 0x8b, 0x21,
+			0xbe, 0x44, 0xaa, 0x50, 0xf4, 0xb7, 0x25, 0xe5,
+			0x9a, 0xd1, 0xca, 0x55, 0x62, 0x03, 0xc8, 0xbd,
+			0x56, 0x89, 0x05, 0x90, 0x95, 0x6a, 0x10, 0x96,
+			0x06, 0x2c, 0xca, 0xc7, 0x16, 0x5c, 0x4d, 0x5e,
+			0x25, 0x9c, 0x40, 0x4b, 0xe7, 0x8c, 0x30, 0x5b,
+			0x74, 0xb1, 0x97, 0xaf, 0xd5, 0x19, 0x9d, 0x0a,
+			0xce, 0x11, 0x6e, 0x28, 0xb9, 0xa0, 0x77, 0x1d,
+			0x2e, 0xbc, 0x95, 0x47, 0x73, 0xf9, 0x89, 0xeb,
+			0xe9, 0x83, 0x02, 0xa6, 0x13, 0xf6, 0x67, 0xe4,
+			0x2b, 0x8c, 0xe0, 0x9e, 0x7c, 0xcd, 0x25, 0x61,
+			0xb4, 0x69, 0xb4, 0x94, 0x4b, 0x1c, 0x74, 0x4d,
+			0xe9, 0x12, 0x57, 0x4a, 0x1f, 0x84, 0x2a, 0x1c,
+			0x9f, 0xfb, 0x7e, 0x6d, 0x11, 0x4a, 0x7f, 0x9e,
+			0x57, 0x77, 0x44, 0x16, 0x41, 0x8c, 0x10, 0xdd,
+			0xf0, 0xae, 0xeb, 0x11, 0xc4, 0x9a, 0x97, 0x2c,
+			0x33, 0xc5, 0x76, 0x29, 0x68, 0x1b, 0x54, 0x19,
+			0x53, 0x10, 0x10, 0x5f, 0x8e, 0x8d, 0x09, 0xd8,
+			0x00, 0x2d, 0x37, 0xc2, 0x15, 0xa8, 0x62, 0xa6,
+			0xb3, 0xf3, 0xc4, 0x03, 0xb4, 0xf1, 0x18, 0xe2,
+			0x1c, 0x7c, 0x8a, 0x14, 0x3a, 0x94, 0xbe, 0xb2,
+			0xbb, 0x7d, 0x17, 0xb0, 0x21, 0xfa, 0x03, 0xc8,
+			0x2c, 0x81, 0xf9, 0x49, 0xee, 0xc3, 0x95, 0x6a,
+			0x37, 0x10, 0x76, 0x3d, 0x60, 0x12, 0xbf, 0x3b,
+			0xb2, 0xa1, 0x0e, 0x0e, 0x5c, 0x5c, 0x53, 0x61,
+			0xdd, 0x57, 0x41, 0x1a, 0x31, 0x07, 0x12, 0xba,
+			0x7c, 0xa6, 0xe7, 0x4b, 0x91, 0xb5, 0x43, 0x0f,
+			0xe4, 0x93, 0x48, 0x0d, 0xc6, 0xa0, 0x2b, 0x23,
+			0x34, 0x18, 0xbd, 0x59, 0x85, 0x92, 0x21, 0x2b,
+			0xee, 0xd0, 0x84, 0x18, 0x49, 0x99, 0x9a, 0xdf,
+			0xb3, 0x9d, 0x31, 0xda, 0xf7, 0xd3, 0x52, 0xbc,
+			0x85, 0x1d, 0x48, 0x71, 0xf3, 0x9a, 0xb2, 0x07,
+			0xb0, 0x5e, 0xbb, 0x77, 0x67, 0x79, 0xdf, 0xc4,
+			0xf0, 0xd3, 0x73, 0x7a, 0x35, 0xcd, 0x2a, 0xc9,
+			0x39, 0x8d, 0x63, 0xca, 0x0e, 0xf4, 0x8a, 0xf8,
+			0x1c, 0x6a, 0x5d, 0x10, 0x01, 0xcc, 0xbb, 0xaa,
+			0x32, 0x1e, 0x0d, 0x38, 0xa5, 0x76, 0x29, 0x06,
+			0x30, 0xdf, 0x0a, 0xd9, 0xec, 0xc7, 0x11, 0xdd,
+			0x56, 0xaf, 0xb1, 0x71, 0x1c, 0x48, 0x5e, 0xd4,
+			0xae, 0xf8, 0x6f, 0x8b, 0xe3, 0x2c, 0x12, 0xf0,
+			0x80, 0xa8, 0xf8, 0xbc, 0xd4, 0xf6, 0x0d, 0x65,
+			0x84, 0xb4, 0x30, 0xfb, 0xb5, 0xb9, 0x24, 0x00,
+			0xcd, 0xa0, 0x3e, 0xfa, 0x31, 0xec, 0x5a, 0xed,
+			0xbe, 0xd6, 0xdf, 0x0a, 0x5a, 0xd9, 0xc8, 0xc9,
+			0x58, 0x1d, 0x1b, 0xba, 0x81, 0xaa, 0x2a, 0xe3,
+			0xf1, 0x45, 0xd1, 0x3c, 0xa8, 0xcc, 0x80, 0x36,
+			0xe6, 0x51, 0x0c, 0x99, 0xdf, 0x8e, 0x1f, 0x59,
+			0xc9, 0xbc, 0xd2, 0x10, 0xce, 0xbe, 0xea, 0xbf,
+			0x0f, 0x47, 0x56, 0x34, 0xf2, 0x13, 0x18, 0x23,
+			0xd6, 0x6d, 0x6d, 0x11, 0x2e, 0xac, 0xcf, 0x9d,
+			0x78, 0x3f, 0x1b, 0x49, 0x92, 0xff, 0x9b, 0x95,
+			0x6b, 0x67, 0xce, 0x94, 0x5b, 0xe4, 0x32, 0x42,
+			0x9b, 0x1b, 0xd5, 0x35, 0xb4, 0xd8, 0xd3, 0x33,
+			0x62, 0x46, 0x52, 0xc3, 0x4d, 0x4e, 0x86, 0x09,
+			0x1a, 0xcc, 0xc5, 0xa1, 0xbe, 0xcd, 0x0f, 0x27,
+			0x46, 0x96, 0x52, 0xca, 0x6e, 0x21, 0x66, 0xf5,
+			0x44, 0x11, 0x5f, 0xf7, 0x12, 0x48, 0x34, 0x31,
+			0xc9, 0x0a, 0x1f, 0x43, 0x1d, 0xda, 0xc2, 0x51,
+			0x82, 0x6a, 0xcb, 0x72, 0x7a, 0x1a, 0xdc, 0x10,
+			0x99, 0x12, 0x68, 0xa6, 0x0e, 0xb6, 0x20, 0x6f,
+			0x50, 0x2b, 0x0e, 0x88, 0x9f, 0x41, 0xcb, 0x21,
+			0xd3, 0x4d, 0xeb, 0xed, 0xce, 0xf8, 0x8e, 0x20,
+			0xa3, 0xcc, 0xdd, 0x93, 0xb2, 0x6c, 0xdc, 0xe2,
+			0x6c, 0x83, 0x4f, 0x0a, 0x0c, 0xab, 0xca, 0x90,
+			0x37, 0x44, 0x3f, 0x5a, 0x12, 0xf2, 0x4f, 0x67,
+			0x5d, 0x12, 0xf7, 0x4e, 0x6c, 0x2e, 0xc7, 0x25,
+			0xbc, 0x50, 0x97, 0xdf, 0x09, 0x91, 0xa6, 0x0c,
+			0xda, 0x71, 0x53, 0x77, 0xba, 0xe8, 0x22, 0x92,
+			0x33, 0xd1, 0xd1, 0x6b, 0x69, 0xa8, 0x9e, 0x27,
+			0x0f, 0xad, 0x99, 0xc9, 0xac, 0x28, 0x8d, 0x78,
+			0xe5, 0xee, 0xf5, 0xed, 0x20, 0xd8, 0xd7, 0x55,
+			0x4c, 0x48, 0x1b, 0xdc, 0x92, 0x42, 0x5a, 0x23,
+			0xab, 0x13, 0xbc, 0xa7, 0x29, 0x36, 0xaa, 0x25,
+			0xfa, 0x71, 0x5b, 0x2d, 0x1f, 0x64, 0xbe, 0x9e,
+			0x4a, 0x4b, 0x64, 0x9b, 0xed, 0xa7, 0x9d, 0x66,
+			0x1b, 0x98, 0xe3, 0xac, 0x8a, 0xfe, 0xd5, 0xe0,
+			0x56, 0x71, 0x8f, 0xce, 0xd6, 0xe2, 0x18, 0x92,
+			0x32, 0x45, 0x0d, 0x2e, 0x28, 0x80, 0x3f, 0x8c,
+			0x93, 0x43, 0x45, 0x3e, 0x47, 0x8a, 0x7d, 0xb7,
+			0x26, 0x0f, 0x99, 0x4a, 0xfa, 0xd9, 0xdc, 0xe8,
+			0xcc, 0xb7, 0x4e, 0x49, 0x0d, 0xe1, 0x90, 0xbd,
+			0x70, 0x72, 0x71, 0x0d, 0x44, 0x79, 0x08, 0x78,
+			0x35, 0x56, 0xc6, 0x00, 0x25, 0x80, 0x8e, 0x13,
+			0x03, 0xb5, 0x7b, 0x43, 0x03, 0x21, 0x14, 0x02,
+			0x25, 0x31, 0x00, 0x71, 0x1b, 0x6c, 0x2e, 0x28,
+			0xb8, 0x6e, 0xdc, 0x1b, 0xc4, 0xdf, 0xba, 0x34,
+			0xce, 0x58, 0x15, 0x23, 0x85, 0x4a, 0x87, 0xba,
+			0x60, 0x05, 0x7b, 0x8a, 0x87, 0x9a, 0x6d, 0x7b,
+			0x3c, 0xc0, 0x4c, 0xfb, 0x8e, 0x80, 0xdf, 0xb3,
+			0x5f, 0x6a, 0x29, 0xbd, 0x68, 0xcc, 0x95, 0xc5,
+			0x96, 0xc0, 0x95, 0x1d, 0xc9, 0x5a, 0x15, 0xa5,
+			0xdf, 0x55, 0x45, 0x1f, 0x53, 0x7f, 0x63, 0x2c,
+			0x82, 0x73, 0x84, 0x75, 0xda, 0xab, 0xd9, 0x16,
+			0x51, 0x78, 0x56, 0x53, 0x88, 0xe8, 0x19, 0x4b,
+			0xe0, 0x9f, 0x55, 0x7e, 0xb7, 0x3d, 0x10, 0xf9,
+			0x1e, 0xd5, 0x5e, 0x95, 0x86, 0x57, 0xc1, 0x71,
+			0xb9, 0xce, 0x28, 0x05, 0xbc, 0x8f, 0x87, 0x02,
+			0x56, 0x82, 0x57, 0xfe, 0x62, 0x2a, 0x31, 0x90,
+			0x45, 0xee, 0xb3, 0x66, 0xb7, 0x08, 0x08, 0x4a,
+			0x70, 0x6e, 0xaa, 0xa3, 0xbe, 0x2c, 0x7c, 0xa9,
+			0xf1, 0x04, 0x8a, 0x83, 0x80, 0xd8, 0x22, 0x72,
+			0xe1, 0xe6, 0xf1, 0x70, 0x99, 0x82, 0x35, 0x99,
+			0xa4, 0xfa, 0x43, 0x31, 0x32, 0xa4, 0x42, 0xb9,
+			0xf0, 0x57, 0x2a, 0xec, 0xba, 0x84, 0x46, 0x79,
+			0xf3, 0xac, 0xef, 0x91, 0xef, 0xee, 0xdb, 0xec,
+			0xa0, 0x4f, 0x15, 0x9b, 0xc8, 0x63, 0xf0, 0xed,
+			0x3a, 0x32, 0x1e, 0xfb, 0xf6, 0xc4, 0x2a, 0x2c,
+			0x39, 0xcc, 0x37, 0x3b, 0x27, 0xc7, 0xaa, 0x81,
+			0x39, 0x25, 0x90, 0x90, 0x00, 0x2d, 0x04, 0xaf,
+			0xcb, 0x08, 0xb6, 0x22, 0xdd, 0xb8, 0x80, 0x82,
+			0x16, 0x78, 0xee, 0x0c, 0xea, 0xce, 0x59, 0x40,
+			0x87, 0x97, 0xdd, 0x7d, 0x7d, 0x0c, 0x8f, 0xb4,
+			0x1a, 0x50, 0xc7, 0x60, 0x5c, 0x56, 0x5d, 0x89,
+			0xf0, 0x07, 0x8d, 0x3d, 0x09, 0x29, 0x0f, 0x36,
+			0xc5, 0x35, 0xbf, 0xe5, 0xfa, 0xed, 0x50, 0xfe,
+			0x37, 0xae, 0xe8, 0x46, 0xfd, 0xf9, 0xbb, 0xd8,
+			0x9e, 0xd4, 0x46, 0xe3, 0xce, 0xc4, 0x7d, 0xe8,
+			0xb5, 0xa1, 0x79, 0xa5, 0xbb, 0xcb, 0x2c, 0x2c,
+			0x84, 0xe2, 0x1d, 0x31, 0x9e, 0xb0, 0xa8, 0xe2,
+			0x02, 0x2a, 0x87, 0x50, 0x40, 0x8a, 0xd9, 0xe9,
+			0xae, 0xba, 0x00, 0xec, 0x5d, 0x4a, 0xd2, 0x36,
+			0x57, 0x35, 0x49, 0x46, 0xad, 0xf0, 0xe4, 0x46,
+			0x3d, 0xbb, 0x58, 0xe0, 0x0b, 0x49, 0x09, 0x17,
+			0xa6, 0x31, 0x22, 0xcc, 0x53, 0xae, 0x6c, 0xa7,
+			0xdc, 0xb0, 0x56, 0x17, 0xe5, 0x20, 0x8a, 0x91,
+			0x4b, 0xbd, 0xed, 0xc8, 0xf2, 0xcc, 0xa6, 0xb5,
+			0xaa, 0xce, 0x60, 0x6c, 0x5b, 0x7d, 0x80, 0x55,
+			0x41, 0x22, 0xc3, 0x0e, 0x3e, 0xd4, 0x76, 0x3e,
+			0x95, 0x08, 0xd4, 0x62, 0x1a, 0x64, 0xcc, 0x53,
+			0x61, 0x4b, 0xef, 0x3d, 0x91, 0x66, 0x80, 0x42,
+			0x6b, 0x12, 0x82, 0x75, 0x83, 0x9c, 0xd8, 0xd4,
+			0x8f, 0x48, 0x71, 0xc3, 0x24, 0xbd, 0xa6, 0xfb,
+			0x65, 0xe9, 0xef, 0xd6, 0xab, 0xde, 0xb8, 0xc6,
+			0xd1, 0x5e, 0x02, 0x51, 0x9e, 0xf9, 0x51, 0x5a,
+			0x05, 0x6a, 0x68, 0xad, 0x1a, 0x1e, 0x06, 0x89,
+			0xe4, 0x25, 0x2f, 0xf4, 0xf8, 0xf4, 0xd8, 0xa6,
+			0x84, 0x61, 0x55, 0x69, 0xb1, 0x39, 0xaa, 0x66,
+			0x88, 0xc4, 0x91, 0xe3, 0x00, 0x3e, 0x7b, 0xa5,
+			0xfa, 0xbe, 0x32, 0xd4, 0xfa, 0x0a, 0x2a, 0x49,
+			0x47, 0xbf, 0x3c, 0xc6, 0x29, 0x00, 0x75, 0xed,
+			0x77, 0xf1, 0x48, 0xcd, 0x00, 0x2f, 0x1e, 0x61,
+			0x21, 0xa3, 0x5c, 0x5b, 0xce, 0x6c, 0x76, 0xcc,
+			0x22, 0xaa, 0x33, 0xa4, 0xa0, 0x24, 0xaf, 0xee,
+			0xc7, 0xc8, 0x7c, 0x05, 0xc2, 0xd7, 0xa0, 0x1b,
+			0xf6, 0x84, 0x0a, 0x08, 0x75, 0x64, 0xff, 0xda,
+			0x67, 0xf2, 0xea, 0xcb, 0x0d, 0x99, 0x36, 0x11,
+			0xe3, 0x86, 0xb1, 0x04, 0xad, 0x73, 0xf3, 0x7b,
+			0xbb, 0x0b, 0xb4, 0xf3, 0xce, 0xdf, 0xe3, 0x54,
+			0x31, 0xb9, 0xef, 0x8a, 0xbd, 0x38, 0xd5, 0xc5,
+			0x12, 0x34, 0x47, 0x96, 0xc0, 0xbb, 0x25, 0x19,
+			0xae, 0x02, 0x74, 0xb5, 0x77, 0xb1, 0xbe, 0x48,
+			0xfd, 0x38, 0x69, 0x27, 0x85, 0x8b, 0x37, 0x52,
+			0x65, 0x14, 0xd0, 0x87, 0x5b, 0xa1, 0x17, 0xcd,
+			0x6b, 0xa8, 0x55, 0x0b, 0xde, 0xa2, 0xcd, 0x5e,
+			0x53, 0x7c, 0x72, 0x95, 0x2c, 0x55, 0xdf, 0xee,
+			0xc7, 0x44, 0x84, 0x6a, 0x12, 0x62, 0x64, 0xfb,
+			0x47, 0x64, 0x3f, 0xb9, 0xd4, 0xaf, 0x1c, 0x57,
+			0x26, 0xd1, 0xdc, 0x77, 0x01, 0x5c, 0x18, 0x63,
+			0x60, 0x5b, 0x9c, 0x07, 0xdd, 0xf5, 0xdf, 0xbd,
+			0xe3, 0x9b, 0x59, 0x66, 0x1f, 0x0e, 0x32, 0x6c,
+			0x77, 0x33, 0x15, 0xf8, 0x97, 0x14, 0xf8, 0x2d,
+			0x3e, 0x9b, 0xc8, 0x7b, 0xd6, 0x92, 0x16, 0x11,
+			0x9f, 0x16, 0xc3, 0x04, 0x4b, 0x72, 0xe5, 0xde,
+			0xc4, 0x9b, 0x87, 0x75, 0x2a, 0x8d, 0x04, 0x73,
+			0xfb, 0x6c, 0x49, 0x95, 0x14, 0x98, 0x8a, 0x83,
+			0xbb, 0x2e, 0x03, 0x29, 0x73, 0x88, 0x45, 0x6b,
+			0xd7, 0xdb, 0x99, 0x03, 0x8d, 0x7e, 0x16, 0x50,
+			0x3e, 0x34, 0x72, 0x0e, 0xe9, 0x4b, 0x46, 0xaf,
+			0x35, 0x77, 0x08, 0x98, 0x5f, 0xeb, 0xd2, 0xe6,
+			0x64, 0xcf, 0x1c, 0x05, 0xb2, 0xa1, 0x8a, 0x95,
+			0x75, 0x10, 0xfc, 0xc3, 0x63, 0x5d, 0xdf, 0xf9,
+			0x04, 0x78, 0x3b, 0xb4, 0x30, 0x06, 0x83, 0x58,
+			0x6d, 0x1b, 0xbc, 0xe9, 0x61, 0xca, 0xeb, 0x6b,
+			0xa2, 0x05, 0x25, 0x9d, 0x3b, 0xb9, 0x4f, 0x3e,
+			0x27, 0x8a, 0x25, 0x3c, 0x95, 0xd7, 0x2b, 0xb1,
+			0x6f, 0x7e, 0xe6, 0x93, 0x66, 0x8b, 0x51, 0x73,
+			0xe0, 0xad, 0x51, 0x3d, 0xbc, 0xdd, 0xd7, 0x95,
+			0x61, 0x33, 0x71, 0x0c, 0xa6, 0x7a, 0xaf, 0x41,
+			0xa1, 0x24, 0x48, 0xd9, 0xad, 0x85, 0x34, 0x17,
+			0x1d, 0x27, 0xea, 0xc0, 0xf6, 0x2d, 0xdf, 0xef,
+			0x67, 0x22, 0x44, 0x08, 0x3c, 0xed, 0x68, 0x92,
+			0xe0, 0x18, 0x6e, 0xc4, 0x60, 0xdd, 0x7c, 0x7c,
+			0xf9, 0xe9, 0xb3, 0x20, 0x5a, 0x0e, 0xce, 0xe0,
+			0x0d, 0x90, 0xe6, 0x47, 0xa4, 0x63, 0xfc, 0x81,
+			0xe3, 0xe3, 0x15, 0xe9, 0x4f, 0x5b, 0x28, 0x0c,
+			0x8a, 0x57, 0x34, 0x91, 0x31, 0xdd, 0xf3, 0x47,
+			0x9a, 0xb5, 0xe1, 0x13, 0x51, 0xb2, 0x73, 0x1d,
+			0xda, 0x86, 0x2b, 0xac, 0xc0, 0xd1, 0x13, 0x63,
+			0x0a, 0xa5, 0x65, 0xc2, 0xb5, 0xab, 0xd1, 0xfb,
+			0xda, 0xfb, 0x19, 0x45, 0x08, 0x70, 0xa9, 0xea,
+			0x2d, 0x2e, 0xef, 0x83, 0x3c, 0x07, 0xab, 0xb6,
+			0xcc, 0x4a, 0x33, 0xb3, 0x8f, 0x14, 0xf4, 0x87,
+			0x3a, 0x05, 0xa6, 0x0c, 0x3b, 0x7a, 0x9e, 0xe6,
+			0x5f, 0xf5, 0xc5, 0xd9, 0x74, 0x07, 0xc4, 0x4d,
+			0x4d, 0x69, 0xce, 0x05, 0xd7, 0x7c, 0x16, 0xb3,
+			0x64, 0xfa, 0xa5, 0x7d, 0xc1, 0xa0, 0xee, 0x0f,
+			0x7b, 0x9e, 0x45, 0xe3, 0x6d, 0x30, 0x4e, 0x90,
+			0x31, 0x24, 0xd6, 0x5e, 0x40, 0x09, 0xac, 0x25,
+			0xab, 0x34, 0x48, 0x2c, 0x28, 0x4d, 0x5d, 0x34,
+			0xbe, 0x02, 0x80, 0x35, 0x70, 0x25, 0xc6, 0x06,
+			0x2e, 0x38, 0xe0, 0xd7, 0x09, 0x62, 0xae, 0x12,
+			0xee, 0x32, 0x49, 0x3d, 0x46, 0x2d, 0xb5, 0xa4,
+			0x74, 0xee, 0xa9, 0x8b, 0xde, 0x3b, 0xcf, 0x92,
+			0x5a, 0x96, 0x7b, 0x04, 0xa5, 0x3b, 0x9b, 0x9b,
+			0xa8, 0xf3, 0x15, 0x20, 0xf7, 0x3f, 0x8c, 0x31,
+			0x83, 0x52, 0xeb, 0xba, 0x8c, 0x63, 0x8f, 0xd2,
+			0xee, 0x48, 0x2d, 0xa9, 0x9b, 0xe8, 0x4d, 0x02,
+			0x9a, 0x1b, 0xd5, 0x07, 0xb6, 0xe0, 0xbe, 0x21,
+			0x94, 0xce, 0xef, 0xad, 0x7c, 0xee, 0x1a, 0x86,
+			0x26, 0xe2, 0xcc, 0x27, 0x15, 0xf6, 0x8d, 0xc8,
+			0x72, 0xa1, 0x18, 0xfc, 0xc1, 0x71, 0x14, 0x26,
+			0x1f, 0xed, 0x6d, 0xe4, 0x96, 0xbd, 0x88, 0x76,
+			0x16, 0x1b, 0x33, 0x16, 0xa4, 0xe3, 0x3e, 0xe3,
+			0x39, 0x2f, 0x11, 0x63, 0xbd, 0x88, 0x00, 0x5a,
+			0xa9, 0x2c, 0x5e, 0x94, 0x6e, 0xc8, 0x2a, 0x50,
+			0xc2, 0x05, 0x50, 0x45, 0x9b, 0xec, 0xc1, 0x36,
+			0xe3, 0xec, 0x1f, 0x3a, 0xc8, 0xd8, 0x1b, 0x3b,
+			0x52, 0x0a, 0x6c, 0xaa, 0x44, 0x25, 0xed, 0x74,
+			0xaf, 0xe2, 0xa2, 0x0a, 0xc7, 0xb6, 0xb5, 0x4a,
+			0x6b, 0x01, 0xf0, 0x1b, 0x72, 0x84, 0xb2, 0x0f,
+			0x8f, 0x7b, 0x65, 0x78, 0x46, 0x24, 0x54, 0x0d,
+			0x0f, 0x5c, 0xff, 0xf5, 0xca, 0x8f, 0x87, 0x52,
+			0x1e, 0x55, 0xc0, 0x8b, 0x58, 0xa6, 0x95, 0x7f,
+			0xf5, 0xd2, 0x77, 0x4a, 0x36, 0xe7, 0x8c, 0x1a,
+			0x66, 0xad, 0x98, 0x9f, 0x73, 0x6f, 0x41, 0x4e,
+			0x02, 0x08, 0x3b, 0xb7, 0x1e, 0xe8, 0xb1, 0x88,
+			0x69, 0x56, 0x4c, 0xdb, 0xf8, 0xc6, 0xea, 0x91,
+			0x74, 0x80, 0x48, 0x05, 0xf0, 0xda, 0x80, 0x44,
+			0xf6, 0x1a, 0x5b, 0x31, 0x6a, 0x21, 0x20, 0x9d,
+			0x2a, 0x7b, 0xb4, 0x87, 0xab, 0x86, 0x00, 0x8d,
+			0xd3, 0x98, 0xdb, 0xfb, 0xac, 0x54, 0x49, 0x9d,
+			0x1b, 0x74, 0x1a, 0x6c, 0xa7, 0xf5, 0xba, 0xc7,
+			0xb7, 0x54, 0xd3, 0x11, 0x0c, 0x0d, 0x3a, 0x1b,
+			0x53, 0x21, 0xc1, 0xf0, 0x20, 0xbc, 0xcd, 0x2e,
+			0xb8, 0x48, 0xc8, 0xa1, 0x82, 0xc6, 0x25, 0x9a,
+			0x0f, 0x35, 0xe4, 0x88, 0xef, 0x52, 0x86, 0xf2,
+			0x63, 0x65, 0x8b, 0x3c, 0xfb, 0x3c, 0x0c, 0xeb,
+			0x45, 0x81, 0x2c, 0x83, 0xd0, 0x5a, 0xd9, 0xa3,
+			0xf5, 0xf4, 0x5d, 0x47, 0x98, 0xe8, 0xa9, 0x39,
+			0x86, 0xd4, 0x88, 0x5c, 0x4a, 0xcc, 0x19, 0x79,
+			0xdd, 0x92, 0x2a, 0x56, 0x64, 0x02, 0xe4, 0xe2,
+			0xa1, 0x58, 0x51, 0xfb, 0xa6, 0xbe, 0x40, 0x5a,
+			0xff, 0xab, 0x57, 0x1f, 0xa3, 0xc2, 0xd1, 0x20,
+			0x71, 0xe2, 0x70, 0xf5, 0xb8, 0x38, 0x24, 0x44,
+			0x9a, 0x66, 0x5f, 0x3b, 0x15, 0xc8, 0x44, 0xc1,
+			0x47, 0x8a, 0xd9, 0x9f, 0xc5, 0x74, 0x1d, 0x0b,
+			0xe6, 0x63, 0x83, 0xe0, 0x56, 0x4b, 0x76, 0x56,
+			0x7a, 0x94, 0x7d, 0x13, 0xfc, 0xde, 0x2d, 0xae,
+			0xff, 0xba, 0xb9, 0x92, 0x3d, 0x24, 0x79, 0x05,
+			0x50, 0x5e, 0x88, 0x4b, 0x6e, 0x6e, 0x63, 0x73,
+			0x92, 0x4d, 0x13, 0x88, 0xc0, 0x71, 0xcc, 0x05,
+			0xc5, 0xad, 0xb2, 0xf7, 0xdd, 0x83, 0x22, 0x7d,
+			0x30, 0xb4, 0x05, 0xb9, 0x13, 0x12, 0x3f, 0x71,
+			0x07, 0x1b, 0xc8, 0x31, 0xb8, 0x98, 0x27, 0x2d,
+			0x35, 0x9e, 0x8c, 0x14, 0xfd, 0x69, 0x5b, 0xaa,
+			0xa2, 0x7f, 0x87, 0x77, 0xe0, 0x32, 0xe6, 0x75,
+			0xbd, 0x0a, 0xe3, 0x01, 0xf2, 0x3d, 0x1d, 0x95,
+			0x02, 0xad, 0xb6, 0x97, 0xbc, 0x47, 0xe2, 0xad,
+			0xd9, 0xb9, 0xae, 0xc2, 0x91, 0x03, 0xca, 0x6c,
+			0x3e, 0x06, 0x2c, 0x83, 0x89, 0x80, 0xbd, 0x1a,
+			0xf5, 0xdf, 0xeb, 0x8d, 0xe7, 0xbd, 0x66, 0xef,
+			0x47, 0x55, 0x42, 0x03, 0x9e, 0xdc, 0xa1, 0x5b,
+			0xbf, 0xe0, 0x4b, 0x7f, 0xa4, 0x95, 0x38, 0xb6,
+			0x83, 0xe8, 0x04, 0x51, 0x4d, 0x47, 0x5c, 0x57,
+			0xed, 0xf8, 0xaa, 0x40, 0xf2, 0x12, 0x31, 0xe7,
+			0x16, 0xd3, 0x29, 0xd3, 0x58, 0x4e, 0x09, 0x8f,
+			0x05, 0xb3, 0x60, 0xfb, 0xbd, 0xe9, 0xe0, 0xc8,
+			0xa4, 0x25, 0x10, 0x5e, 0x80, 0x9b, 0x36, 0x78,
+			0xf2, 0x15, 0xda, 0x33, 0xaa, 0xa0, 0x32, 0x07,
+			0x66, 0x05, 0xfd, 0x4f, 0xce, 0x87, 0xaf, 0x0d,
+			0x5b, 0xd6, 0x93, 0x12, 0x63, 0x14, 0x54, 0xa5,
+			0xe6, 0xc3, 0x11, 0x59, 0x02, 0x24, 0x46, 0xa7,
+			0x3a, 0x63, 0xa8, 0x7c, 0x35, 0x0a, 0x45, 0x75,
+			0xc4, 0x7a, 0xa9, 0x7f, 0xf0, 0xfc, 0xda, 0xde,
+			0x0f, 0x31, 0x49, 0xb8, 0x9a, 0x10, 0x70, 0x8f,
+			0xac, 0xfa, 0x80, 0x61, 0x52, 0x2f, 0xda, 0x41,
+			0xde, 0x5a, 0x53, 0x76, 0x3d, 0x0b, 0x83, 0xf1,
+			0xf7, 0x35, 0x3a, 0xa0, 0xd4, 0xcb, 0xdb, 0x0f,
+			0xfa, 0xcd, 0x05, 0x0b, 0xd6, 0xe6, 0x61, 0xb9,
+			0x3e, 0x1d, 0xec, 0x1e, 0x5e, 0xa1, 0xdc, 0x4b,
+			0x03, 0x1f, 0x5a, 0xde, 0x7f, 0xb2, 0xce, 0x98,
+			0x41, 0xfd, 0xa2, 0xfa, 0x8d, 0x70, 0x93, 0xdd,
+			0xba, 0xee, 0x7a, 0xc8, 0x37, 0xc9, 0xf3, 0x8f,
+			0xf6, 0x1b, 0x93, 0x0a, 0xf2, 0x5a, 0xf8, 0x01,
+			0x78, 0x7c, 0x79, 0x4f, 0x4c, 0x56, 0x5a, 0x95,
+			0xf4, 0xc0, 0x7a, 0xd2, 0x63, 0xb0, 0x9d, 0xdf,
+			0xf9, 0x93, 0x10, 0x32, 0x1b, 0xc4, 0x5c, 0x4f,
+			0x36, 0x0c, 0x5c, 0x60, 0x93, 0x68, 0x0d, 0x49,
+			0x35, 0x1e, 0xf8, 0x94, 0x46, 0x0f, 0x3f, 0x6a,
+			0xb8, 0xfb, 0xe9, 0xe1, 0xb0, 0x5a, 0x1a, 0xd8,
+			0x8a, 0xa1, 0x7f, 0xce, 0x45, 0x4e, 0x49, 0xfc,
+			0x65, 0x54, 0x53, 0x94, 0xd5, 0x98, 0x62, 0xf2,
+			0x25, 0x11, 0x29, 0x5c, 0xc0, 0x9b, 0x5c, 0xce,
+			0x84, 0x25, 0x99, 0x7d, 0x61, 0xfa, 0x3f, 0x31,
+			0xfe, 0x7d, 0x6e, 0xb6, 0xa2, 0x19, 0xf1, 0xbf,
+			0x60, 0x26, 0x1c, 0xcc, 0x98, 0x18, 0x4e, 0xbf,
+			0x05, 0xbd, 0x0e, 0x0a, 0xa0, 0x31, 0x8c, 0x2c,
+			0xaa, 0x10, 0x76, 0x48, 0x6c, 0x29, 0x12, 0xe3,
+			0x96, 0x0d, 0x2f, 0xb3, 0xe3, 0xb3, 0x8d, 0x98,
+			0x3f, 0x5b, 0x35, 0xfe, 0x93, 0x35, 0x41, 0x7b,
+			0x3c, 0x72, 0x87, 0x5d, 0x3f, 0xd2, 0xdb, 0x4b,
+			0x82, 0x11, 0x81, 0x22, 0xe8, 0x72, 0x12, 0xb9,
+			0xf9, 0x26, 0x0d, 0x62, 0xc1, 0xb6, 0xe9, 0xae,
+			0x31, 0xa8, 0x0d, 0xbe, 0xa8, 0xd2, 0x56, 0x3e,
+			0xb3, 0x6b, 0xb6, 0x01, 0x31, 0x1f, 0x40, 0x3f,
+			0x3f, 0x7a, 0xa5, 0xe5, 0x20, 0x24, 0x6c, 0xcc,
+			0xa3, 0x5c, 0x1b, 0xf4, 0x4f, 0x9e, 0xef, 0xef,
+			0xbc, 0xc4, 0xef, 0x39, 0xbe, 0xb3, 0xad, 0xcb,
+			0x0a, 0x4e, 0x7b, 0x67, 0x0f, 0x9c, 0xc6, 0x5c,
+			0x67, 0x3f, 0xd8, 0xb5, 0x39, 0xfb, 0x29, 0x43,
+			0x5e, 0x8c, 0x5e, 0xdf, 0xc5, 0x16, 0x74, 0x05,
+			0x31, 0x67, 0xc1, 0xe9, 0x66, 0x03, 0x4d, 0xf4,
+			0x56, 0x98, 0xc1, 0xbb, 0xe7, 0xba, 0x50, 0x5c,
+			0x9e, 0x16, 0x3d, 0xc7, 0xa2, 0x70, 0x46, 0xd8,
+			0x17, 0x80, 0xc4, 0x39, 0x02, 0x8d, 0x1d, 0x37,
+			0x8b, 0x4c, 0x73, 0x6d, 0xa3, 0xe4, 0x27, 0xb7,
+			0xb5, 0x98, 0x02, 0xda, 0x96, 0x14, 0x89, 0xba,
+			0x1c, 0xd1, 0x1a, 0xa5, 0x21, 0xd8, 0x2e, 0x94,
+			0x9a, 0x19, 0x3c, 0x6d, 0xb1, 0xbe, 0xb0, 0x87,
+			0xce, 0xa0, 0xed, 0xc0, 0xd7, 0x10, 0xb8, 0xfc,
+			0x8e, 0x72, 0xfe, 0xdf, 0x92, 0x08, 0x4e, 0x85,
+			0xed, 0x23, 0x0c, 0xab, 0x11, 0xf1, 0x68, 0xc1,
+			0xe2, 0x51, 0xa4, 0x9c, 0xd3, 0x74, 0x17, 0x8c,
+			0x49, 0x39, 0x3f, 0x59, 0xeb, 0x73, 0x2f, 0x44,
+			0xcd, 0x2d, 0xff, 0xcc, 0xbf, 0xf1, 0x38, 0x29,
+			0xf6, 0x91, 0x3b, 0x09, 0xdc, 0xcb, 0x74, 0x02,
+			0xe4, 0x42, 0x59, 0x98, 0x98, 0xc7, 0xdc, 0x82,
+			0x11, 0xd2, 0x59, 0x69, 0x32, 0x2a, 0x47, 0xb8,
+			0x8c, 0xc8, 0xb0, 0x57, 0x29, 0x61, 0x01, 0x09,
+			0xdb, 0x59, 0x2e, 0x2d, 0x9d, 0x22, 0xa2, 0x6c,
+			0x0d, 0xc4, 0x14, 0x8f, 0xf9, 0x55, 0x65, 0x33,
+			0x58, 0x4c, 0x35, 0xaf, 0xce, 0xb2, 0x7a, 0xa8,
+			0xbb, 0xd8, 0xd5, 0x6d, 0x51, 0x71, 0x39, 0x8e,
+			0x77, 0x5d, 0xb6, 0x09, 0xbf, 0x84, 0x87, 0xc0,
+			0x52, 0x8b, 0x50, 0x8a, 0xf9, 0xd5, 0xf7, 0x9a,
+			0xfb, 0x0f, 0x9c, 0x4a, 0xb5, 0x33, 0x9a, 0x17,
+			0x30, 0x6e, 0xf3, 0xed, 0xca, 0x14, 0x5e, 0xf8,
+			0x1a, 0xff, 0x17, 0x66, 0x1c, 0x46, 0x33, 0x0b,
+			0x96, 0x01, 0xe1, 0x4a, 0xd3, 0x54, 0x20, 0x2d,
+			0x13, 0x4e, 0xf2, 0x9a, 0xd8, 0x3c, 0xcf, 0x58,
+			0x37, 0x72, 0xd8, 0xeb, 0xfd, 0x4b, 0x83, 0x61,
+			0x74, 0xeb, 0x65, 0x41, 0x2e, 0xc0, 0xb6, 0xbe,
+			0xcb, 0x4f, 0xd5, 0x1b, 0x4d, 0xd3, 0x6d, 0xff,
+			0x96, 0x11, 0xde, 0x41, 0x33, 0x74, 0x19, 0x58,
+			0xf2, 0x71, 0xa8, 0x7a, 0x6f, 0x99, 0x72, 0x86,
+			0x48, 0x3c, 0xb4, 0x5b, 0xd3, 0x15, 0xfc, 0x59,
+			0x13, 0x48, 0x4c, 0xd3, 0x79, 0x5f, 0x04, 0x81,
+			0x3f, 0xc5, 0x9a, 0x43, 0x3f, 0xdd, 0x7e, 0x1f,
+			0x3b, 0x74, 0xc1, 0x40, 0xbe, 0x43, 0x6a, 0xed,
+			0xb2, 0x17, 0xe0, 0x4d, 0xc6, 0xba, 0xed, 0x17,
+			0xe0, 0xfd, 0x48, 0xd7, 0xa4, 0xe3, 0xc4, 0xd2,
+			0xb4, 0xea, 0xf0, 0x84, 0x3c, 0xbc, 0x71, 0x86,
+			0x10, 0xb3, 0x72, 0x10, 0xea, 0xdf, 0x0b, 0x0c,
+			0x7a, 0x95, 0xd8, 0xd7, 0x22, 0x01, 0xeb, 0xce,
+			0x35, 0x64, 0x36, 0x7c, 0x6f, 0xdc, 0xa0, 0x58,
+			0xc2, 0x5a, 0x7c, 0x31, 0xe8, 0x88, 0x4d, 0x6c,
+			0xec, 0xd7, 0x6f, 0xc8, 0x14, 0xc8, 0x23, 0x7c,
+			0x2f, 0xe7, 0x3f, 0xc0, 0x7c, 0xdb, 0xee, 0xed,
+			0x95, 0x27, 0x56, 0x38, 0x47, 0x2f, 0xf6, 0x84,
+			0xcd, 0xee, 0x8e, 0xb6, 0xa2, 0x98, 0xca, 0xb3,
+			0xe2, 0x76, 0x82, 0x62, 0x5a, 0xf0, 0xe5, 0xf7,
+			0x02, 0x3c, 0x42, 0x0f, 0x2f, 0x27, 0xb0, 0x5d,
+			0x09, 0xd3, 0xd9, 0x0a, 0x83, 0x2d, 0xb3, 0x75,
+			0xcd, 0x1d, 0x9d, 0xff, 0xa7, 0x1c, 0x75, 0x91,
+			0xad, 0xf0, 0x87, 0xe9, 0xe6, 0x92, 0x85, 0x6e,
+			0x09, 0x68, 0x51, 0xe4, 0x86, 0x85, 0x33, 0x04,
+			0x2a, 0xc3, 0x12, 0x5e, 0xce, 0xbb, 0xf2, 0xfc,
+			0x1b, 0xfd, 0x77, 0x72, 0xf4, 0xf0, 0x4e, 0x9b,
+			0x46, 0x6a, 0x9c, 0xe3, 0xe1, 0xef, 0xb1, 0x86,
+			0x63, 0xfb, 0x9d, 0xe5, 0x2e, 0x43, 0xb0, 0x69,
+			0xd0, 0x1b, 0xae, 0x03, 0xb0, 0x92, 0xbe, 0xda,
+			0xc9, 0x39, 0x14, 0x0d, 0xa5, 0x42, 0x3b, 0x9e,
+			0xef, 0xd4, 0x3e, 0xf8, 0x98, 0x64, 0xcc, 0x9a,
+			0x26, 0x03, 0x26, 0x89, 0xd8, 0x0c, 0xa4, 0xfa,
+			0x26, 0x0e, 0xcb, 0x43, 0x40, 0xd3, 0xc2, 0xab,
+			0xf6, 0xee, 0x66, 0xaf, 0xc4, 0xca, 0xde, 0x9c,
+			0x4c, 0x20, 0x7a, 0x94, 0xff, 0x73, 0xe7, 0x9e,
+			0x3a, 0x20, 0x3d, 0x49, 0xc6, 0x4e, 0xad, 0xed,
+			0x51, 0x3d, 0xf1, 0xb2, 0xf1, 0x0d, 0x11, 0x17,
+			0xd9, 0x18, 0x47, 0xd6, 0xaa, 0x9f, 0x26, 0x1b,
+			0xca, 0xb6, 0x87, 0x14, 0x6d, 0xe0, 0xeb, 0xf1,
+			0xe7, 0x70, 0x11, 0xa3, 0x8f, 0xe3, 0xba, 0x21,
+			0xf9, 0x8d, 0xe7, 0xb7, 0xca, 0x67, 0xf8, 0xc0,
+			0xe8, 0xcd, 0x9e, 0x4b, 0x73, 0x5a, 0x7c, 0x3f,
+			0xe9, 0x9a, 0x17, 0xf1, 0x1d, 0x90, 0xf5, 0x20,
+			0x4a, 0x84, 0x16, 0x2c, 0x46, 0xcd, 0x4a, 0x5c,
+			0x31, 0xe9, 0xe7, 0xbd, 0xc2, 0x1c, 0xe6, 0xa8,
+			0xec, 0xe8, 0xef, 0xcf, 0x9e, 0x47, 0xb4, 0x42,
+			0x93, 0x63, 0x98, 0x52, 0x22, 0x9f, 0xe9, 0x07,
+			0x31, 0x5f, 0x97, 0x84, 0xf6, 0x7c, 0x2e, 0x0d,
+			0x7e, 0x02, 0x9d, 0x71, 0x40, 0x48, 0x3e, 0x67,
+			0xa9, 0xfd, 0xf0, 0x2d, 0xeb, 0xf1, 0x56, 0x0c,
+			0x59, 0x42, 0xd5, 0x30, 0x98, 0xdc, 0x9d, 0x2e,
+			0x50, 0xf1, 0xe1, 0x15, 0x7b, 0x55, 0x7e, 0x81,
+			0xf9, 0xe4, 0x30, 0xe2, 0xab, 0xa3, 0xf7, 0xb9,
+			0xba, 0x3e, 0xd0, 0x8a, 0x78, 0x0c, 0x3d, 0xf0,
+			0x9d, 0x6c, 0xb9, 0x7f, 0x13, 0x4f, 0x87, 0x22,
+			0x12, 0x4a, 0xdf, 0x8e, 0xf2, 0x75, 0xc2, 0x34,
+			0x5b, 0x39, 0xf1, 0xe6, 0x44, 0x5b, 0x35, 0x33,
+			0x0d, 0x3f, 0x67, 0x5a, 0xd6, 0xa3, 0x54, 0x04,
+			0xb6, 0x85, 0x86, 0x26, 0x1b, 0x4e, 0xc2, 0x5c,
+			0xcc, 0xb8, 0xe3, 0xd7, 0x27, 0x10, 0x51, 0x1b,
+			0x47, 0xe3, 0xe9, 0x7e, 0x17, 0xfe, 0x29, 0x61,
+			0xfe, 0xec, 0xec, 0xfc, 0x4d, 0x15, 0x5e, 0x0e,
+			0x92, 0x3d, 0x2a, 0xc8, 0xdd, 0x12, 0x02, 0xa0,
+			0x8e, 0xe7, 0xf2, 0x0e, 0x71, 0x5b, 0xc8, 0x4a,
+			0x97, 0x77, 0xf7, 0xea, 0x20, 0xd0, 0x03, 0xa2,
+			0x49, 0xba, 0x7f, 0x3b, 0x8a, 0x26, 0x44, 0x49,
+			0x01, 0x7b, 0x32, 0xec, 0x49, 0x50, 0xb1, 0x09,
+			0xb0, 0x61, 0x36, 0x33, 0x80, 0x69, 0x37, 0xe9,
+			0x0b, 0x56, 0xd7, 0xad, 0xa0, 0x65, 0x5e, 0x9c,
+			0xcb, 0xbb, 0xb4, 0x84, 0x6d, 0x44, 0x1a, 0x28,
+			0x53, 0x2e, 0x9d, 0x0a, 0xcf, 0x41, 0xf4, 0x45,
+			0x73, 0x48, 0x14, 0xe8, 0xd7, 0x08, 0x05, 0x05,
+			0xc9, 0x4e, 0x67, 0x83, 0x91, 0x15, 0x7c, 0x80,
+			0xab, 0xd5, 0x40, 0xd0, 0xba, 0x76, 0x6d, 0xf9,
+			0xea, 0x8e, 0x7d, 0x5d, 0x8e, 0x0c, 0x53, 0xc4,
+			0xe7, 0xc2, 0xbc, 0xfe, 0xbf, 0xa2, 0xe7, 0xdd,
+			0x1a, 0xf0, 0xba, 0x9e, 0xd8, 0x26, 0x0d, 0x77,
+			0x6c, 0xde, 0x9e, 0xef, 0x54, 0x33, 0xc1, 0x57,
+			0x3f, 0x79, 0xf9, 0x86, 0x3d, 0x77, 0x92, 0xb1,
+			0x7d, 0xad, 0xd0, 0xa6, 0x4d, 0x39, 0x0c, 0xc9,
+			0x45, 0x2a, 0x09, 0xe3, 0x24, 0x35, 0xcd, 0xef,
+			0xeb, 0x2b, 0xce, 0x6d, 0xc5, 0x8c, 0x3e, 0xc1,
+			0x8d, 0x71, 0xfc, 0xe7, 0x4b, 0xd0, 0x54, 0xf2,
+			0x50, 0xe1, 0x23, 0x83, 0x46, 0xa4, 0x5b, 0x96,
+			0xdd, 0x40, 0x92, 0x00, 0x79, 0x5f, 0xc1, 0xc0,
+			0xfe, 0xb1, 0x4a, 0xea, 0x1b, 0x6a, 0xf6, 0xaf,
+			0xbc, 0x2b, 0xa6, 0xfe, 0x97, 0x0e, 0xf4, 0x32,
+			0x1a, 0x22, 0x9e, 0x11, 0x8a, 0x16, 0x3c, 0x5d,
+			0xf4, 0x96, 0x58, 0xc4, 0xae, 0xb9, 0x9e, 0x97,
+			0x50, 0x21, 0x92, 0x9b, 0x69, 0xdc, 0x6a, 0xfe,
+			0xed, 0xf8, 0x66, 0x25, 0xb8, 0x2d, 0xed, 0x06,
+			0x57, 0x98, 0xdc, 0x9b, 0x41, 0x1f, 0x67, 0x50,
+			0x89, 0xaa, 0x24, 0xed, 0xb9, 0xf7, 0xaf, 0xc8,
+			0x19, 0xde, 0x69, 0xaf, 0x04, 0x7b, 0x83, 0x22,
+			0x44, 0x05, 0x1b, 0x63, 0x7a, 0x5d, 0x3f, 0xc9,
+			0x12, 0x9d, 0x06, 0x7a, 0x3d, 0x0f, 0x81, 0xb5,
+			0xd1, 0x36, 0xde, 0xc3, 0xb6, 0xea, 0x6e, 0x6e,
+			0x5d, 0x55, 0x77, 0x8f, 0xca, 0x21, 0x22, 0xff,
+			0xfb, 0xce, 0x11, 0x24, 0x10, 0x34, 0x9c, 0xeb,
+			0x6e, 0x3a, 0xb0, 0xe2, 0xaa, 0xf5, 0x35, 0x1a,
+			0x79, 0x94, 0x5e, 0x09, 0xe6, 0x7f, 0xf8, 0x4a,
+			0x71, 0xd3, 0xe4, 0x77, 0x01, 0x31, 0xd3, 0x8d,
+			0x60, 0xac, 0x9d, 0x4c, 0xd9, 0xb6, 0xe0, 0x67,
+			0x13, 0x53, 0x52, 0x4f, 0xce, 0xc2, 0x28, 0xcb,
+			0xd5, 0x50, 0x17, 0x3f, 0x4c, 0x10, 0x77, 0x8b,
+			0x14, 0x0d, 0xfd, 0xa7, 0x2f, 0x0a, 0xe8, 0xbc,
+			0x8f, 0xf6, 0xfc, 0x38, 0x12, 0xfb, 0x19, 0x9d,
+			0x0e, 0xa6, 0x7e, 0x35, 0x72, 0xb7, 0x1c, 0xeb,
+			0xb8, 0x0c, 0xda, 0x7e, 0x53, 0x18, 0x4c, 0x50,
+			0x3a, 0x9a, 0x8f, 0xf9, 0x16, 0xb4, 0xdc, 0x8b,
+			0xd9, 0xe1, 0x8b, 0x1e, 0xf6, 0xe0, 0x9a, 0x4f,
+			0x10, 0x76, 0x10, 0x69, 0x32, 0xa4, 0xe9, 0x17,
+			0x80, 0x8b, 0xce, 0x52, 0xb2, 0x54, 0xf3, 0x62,
+			0xb8, 0xdd, 0x31, 0xe4, 0xae, 0xfe, 0xa2, 0x9a,
+			0x41, 0x23, 0x01, 0x1c, 0xed, 0x53, 0x52, 0xc6,
+			0x73, 0xff, 0x27, 0xd8, 0x5c, 0x52, 0x8c, 0x4c,
+			0x96, 0x35, 0xc8, 0x66, 0x2c, 0x94, 0xd3, 0x20,
+			0xc2, 0x4e, 0xcb, 0xb7, 0x5a, 0xef, 0xea, 0xeb,
+			0x71, 0x0e, 0x28, 0xf0, 0x38, 0xa9, 0xf9, 0xb9,
+			0xe3, 0x78, 0x08, 0x44, 0x7f, 0xa7, 0x96, 0x8c,
+			0xd8, 0xaa, 0x39, 0xf9, 0xf3, 0x62, 0x7d, 0xc5,
+			0x1c, 0x15, 0xbe, 0x07, 0x3b, 0xc2, 0x18, 0x1c,
+			0x47, 0xde, 0x2a, 0x62, 0x39, 0xea, 0xb0, 0xbb,
+			0xc6, 0xf5, 0x8e, 0x36, 0x64, 0xab, 0x8a, 0xf3,
+			0xba, 0x43, 0x99, 0xb9, 0x26, 0xbf, 0xd4, 0x6b,
+			0xab, 0xdc, 0x14, 0xd2, 0x94, 0xdf, 0x5d, 0xfa,
+			0x9a, 0x9e, 0x84, 0x3f, 0xeb, 0x29, 0x0d, 0x23,
+			0xbf, 0x81, 0x08, 0xdf, 0x2f, 0xd6, 0x81, 0x63,
+			0xb7, 0x70, 0x73, 0xb2, 0x39, 0xca, 0x9b, 0xf0,
+			0x86, 0x88, 0xbb, 0xe3, 0x0e, 0x9a, 0x9b, 0xd2,
+			0x52, 0x95, 0xa9, 0xdc, 0xe4, 0xda, 0x88, 0x6b,
+			0x4d, 0x17, 0x0d, 0x13, 0x46, 0x82, 0x38, 0xbb,
+			0x9e, 0xf4, 0x17, 0xfa, 0x10, 0xa4, 0x2c, 0xdd,
+			0xa9, 0x42, 0xa9, 0xb5, 0x88, 0x71, 0xc0, 0x96,
+			0xde, 0xce, 0x96, 0x40, 0x36, 0xb1, 0x9e, 0x6e,
+			0x17, 0x61, 0xca, 0x09, 0x27, 0x38, 0xd9, 0xf9,
+			0x01, 0xed, 0x75, 0x20, 0xd5, 0x9e, 0xf8, 0x2d,
+			0x81, 0x15, 0x40, 0x29, 0x29, 0x3d, 0xbe, 0x75,
+			0xb1, 0xeb, 0x55, 0xde, 0x0f, 0xb9, 0x1b, 0xac,
+			0x91, 0xde, 0x61, 0x71, 0x5a, 0x1d, 0x33, 0xe4,
+			0x52, 0xcc, 0x5c, 0xed, 0x48, 0x6f, 0xf6, 0xa1,
+			0x82, 0x2d, 0x8c, 0x83, 0xe9, 0xd4, 0xfe, 0x76,
+			0x2b, 0xba, 0xeb, 0x03, 0x69, 0x54, 0xe8, 0x19,
+			0x42, 0xaf, 0xbb, 0x34, 0x98, 0xfe, 0xf6, 0xb9,
+			0x3f, 0x80, 0xcb, 0xf5, 0x01, 0x8e, 0xb3, 0xd9,
+			0x0c, 0xca, 0x65, 0x28, 0x89, 0x47, 0x93, 0xe7,
+			0x2c, 0x0d, 0x4c, 0x06, 0x45, 0x6e, 0xdc, 0x96,
+			0x84, 0x3b, 0x9a, 0x4f, 0xc8, 0x79, 0xb2, 0xf2,
+			0x23, 0x5c, 0xef, 0xe6, 0x9a, 0x22, 0xbf, 0x05,
+			0x6d, 0x8c, 0x31, 0xb1, 0x8c, 0xe7, 0xe6, 0x43,
+			0x7d, 0x35, 0xdf, 0x6d, 0x68, 0xf0, 0x6e, 0x11,
+			0x0d, 0xa9, 0xc8, 0x9c, 0xc0, 0x0a, 0x5d, 0xc3,
+			0x03, 0x0d, 0x59, 0x53, 0x8a, 0xa8, 0xcb, 0x40,
+			0xdf, 0xd0, 0xba, 0x60, 0x32, 0x79, 0x59, 0xba,
+			0x25, 0xf7, 0xfc, 0x8b, 0x1a, 0xa3, 0x51, 0x22,
+			0x7d, 0x5f, 0x7f, 0xf6, 0xf8, 0x74, 0x91, 0x86,
+			0xdf, 0x7d, 0x3e, 0x92, 0xe3, 0xdb, 0x30, 0x11,
+			0x55, 0x4e, 0xad, 0xd2, 0x04, 0xa9, 0x68, 0x4b,
+			0x06, 0xdd, 0x77, 0xe0, 0x48, 0x91, 0xea, 0xaf,
+			0xfe, 0xe2, 0x55, 0xc8, 0x3f, 0x0d, 0xc6, 0xa7,
+			0x66, 0x6b, 0x6f, 0x2a, 0xf1, 0x56, 0x71, 0x5a,
+			0x3d, 0xb2, 0x66, 0xde, 0x5b, 0x09, 0x7d, 0x17,
+			0x25, 0x33, 0x7a, 0x58, 0x7d, 0x84, 0xe1, 0x7c,
+			0xd7, 0x10, 0x01, 0xa6, 0xcc, 0x70, 0x97, 0xfe,
+			0x48, 0x03, 0xf7, 0xc0, 0xa7, 0x04, 0xf5, 0x37,
+			0x53, 0xf5, 0x9d, 0x31, 0x7e, 0x06, 0xe4, 0x81,
+			0x8e, 0xd8, 0x19, 0x08, 0x34, 0xae, 0xad, 0xb9,
+			0x70, 0x71, 0x7f, 0x0a, 0x15, 0xa2, 0xd3, 0xaa,
+			0x7e, 0xff, 0x2f, 0x8e, 0xab, 0x74, 0xcb, 0xd7,
+			0x21, 0xff, 0x8a, 0x12, 0x3a, 0xf6, 0x98, 0xe3,
+			0x44, 0xc6, 0x55, 0xc1, 0xca, 0x01, 0x05, 0x72,
+			0xc2, 0x43, 0x8a, 0xfb, 0xf2, 0xbb, 0x0c, 0x5c,
+			0x42, 0x66, 0xa1, 0xf1, 0x67, 0xa2, 0xbb, 0x7d,
+			0x26, 0xce, 0x77, 0xb5, 0x42, 0x10, 0x84, 0xdf,
+			0x9f, 0xab, 0x35, 0x61, 0x66, 0xe9, 0x5c, 0x8b,
+			0x64, 0x07, 0x9b, 0x15, 0x1e, 0x7b, 0x5d, 0x5e,
+			0xfb, 0x13, 0xcb, 0xc9, 0x96, 0x7b, 0x7e, 0xd2,
+			0xac, 0x66, 0x78, 0x23, 0x1f, 0x42, 0xf4, 0xdc,
+			0x0a, 0x25, 0xda, 0xdd, 0xde, 0x1e, 0x3f, 0x41,
+			0xa3, 0x2c, 0x65, 0xb6, 0xcd, 0xda, 0x76, 0xa9,
+			0xcb, 0x89, 0x30, 0x27, 0x37, 0x62, 0x54, 0x26,
+			0x73, 0xc7, 0x37, 0xb4, 0x95, 0x61, 0xcd, 0x86,
+			0x23, 0x32, 0xe5, 0xe1, 0xd1, 0x52, 0xfc, 0x2b,
+			0xc5, 0x3f, 0x80, 0x4e, 0xd5, 0x00, 0x8f, 0xa7,
+			0x58, 0xb7, 0x75, 0x40, 0x9b, 0x0d, 0xf2, 0x17,
+			0xbe, 0x31, 0xdf, 0x01, 0x53, 0xce, 0x85, 0xba,
+			0x26, 0xae, 0xdc, 0x56, 0xc1, 0x64, 0xaf, 0x51,
+			0xee, 0xc1, 0x75, 0x8f, 0xf9, 0xdb, 0xf3, 0xfe,
+			0xb4, 0xc9, 0x1a, 0xa0, 0x2e, 0xc6, 0x35, 0x8f,
+			0x21, 0x30, 0x56, 0x19, 0x7f, 0xa2, 0x5d, 0x49,
+			0x76, 0xca, 0xca, 0x5f, 0x57, 0xc1, 0xb0, 0xab,
+			0x8d, 0x99, 0xed, 0x1f, 0x8e, 0x03, 0x80, 0x5f,
+			0x31, 0x77, 0x8e, 0xd6, 0x84, 0x59, 0xc6, 0xa4,
+			0xd4, 0x7c, 0xdf, 0x01, 0xfe, 0xe1, 0xd0, 0xcf,
+			0xd8, 0x74, 0xe8, 0x2d, 0x78, 0x03, 0xdb, 0x42,
+			0xb2, 0x32, 0x41, 0xdb, 0x87, 0xce, 0x6f, 0xca,
+			0x44, 0x25, 0x82, 0xf3, 0xad, 0x15, 0x83, 0x94,
+			0xbf, 0x09, 0xd1, 0x46, 0x42, 0xd8, 0xfd, 0xb8,
+			0x7d, 0xf3, 0xb9, 0x8d, 0x07, 0x0a, 0x0f, 0x05,
+			0x8b, 0xfe, 0xe1, 0xfc, 0xda, 0xe8, 0x48, 0x8d,
+			0xc6, 0xfe, 0x4a, 0x8a, 0x15, 0xf3, 0x25, 0xe6,
+			0x1b, 0x8c, 0x24, 0xbd, 0x01, 0x1c, 0x24, 0x50,
+			0x8b, 0x28, 0x4e, 0xf9, 0x5d, 0x4d, 0x85, 0xc3,
+			0x35, 0x7a, 0xc6, 0x4e, 0x51, 0xc2, 0x7f, 0x1a,
+			0x30, 0x0e, 0xc0, 0x18, 0x10, 0xcf, 0x3b, 0x50,
+			0xd7, 0x7d, 0x57, 0xff, 0xf8, 0xb6, 0xea, 0xe1,
+			0xad, 0x8c, 0x6d, 0x3c, 0x4c, 0x1b, 0x46, 0x78,
+			0x13, 0x8b, 0x96, 0xdc, 0xb5, 0x0a, 0x51, 0xc1,
+			0xa9, 0xe9, 0xc5, 0x9d, 0x8a, 0xc5, 0x15, 0xc0,
+			0xeb, 0x8b, 0x06, 0x28, 0xaf, 0x25, 0x11, 0xa0,
+			0x13, 0x68, 0xbe, 0x91, 0x07, 0x28, 0xd7, 0x0a,
+			0x32, 0x9f, 0xb3, 0x4f, 0xf5, 0x26, 0x4a, 0x1b,
+			0xe3, 0xb5, 0x7e, 0x5a, 0x1b, 0xef, 0xcc, 0xe1,
+			0x33, 0x72, 0x42, 0xf8, 0x37, 0xa0, 0x24, 0x04,
+			0x8c, 0x85, 0x08, 0x90, 0xaa, 0xb6, 0x61, 0x7e,
+			0x7e, 0xf4, 0x65, 0x33, 0x76, 0x5d, 0xc3, 0xa0,
+			0xd3, 0xfb, 0x23, 0x6a, 0x24, 0x28, 0x78, 0xf7,
+			0x6b, 0xea, 0xe4, 0x53, 0xcd, 0xb6, 0x69, 0x51,
+			0xd2, 0xb3, 0x2b, 0x3c, 0xe3, 0x13, 0x7e, 0x4c,
+			0x5c, 0xdf, 0xd0, 0xa2, 0x3b, 0x1c, 0xd7, 0xc5,
+			0xb9, 0xd4, 0xcf, 0x1d, 0xd7, 0xc0, 0x6f, 0x9a,
+			0xc5, 0x94, 0xfb, 0xe3, 0x07, 0xdd, 0x80, 0x83,
+			0x5d, 0x19, 0xad, 0x44, 0x8f, 0x23, 0xb3, 0xb6,
+			0xf0, 0x13, 0x09, 0x1f, 0x09, 0x41, 0xb2, 0xff,
+			0x8e, 0xfb, 0x6f, 0x0f, 0x4b, 0x87, 0x82, 0xad,
+			0xd5, 0x3f, 0x4d, 0x5f, 0xac, 0x64, 0x9e, 0xb4,
+			0x0f, 0x39, 0x0c, 0xe3, 0x26, 0x58, 0xa1, 0x7c,
+			0x6e, 0x35, 0x3c, 0xa6, 0x81, 0x41, 0xcc, 0x41,
+			0x0e, 0x8f, 0xf5, 0x4a, 0x61, 0x4c, 0xd2, 0x48,
+			0xd4, 0x34, 0xf0, 0xd7, 0x0e, 0x60, 0x03, 0xaa,
+			0x32, 0x86, 0xcd, 0x18, 0xd2, 0xfb, 0x46, 0x49,
+			0x62, 0x5b, 0x5e, 0x86, 0xa8, 0x06, 0x83, 0xdd,
+			0x97, 0x3c, 0x40, 0xf2, 0x22, 0x2b, 0x76, 0x00,
+			0xd1, 0x81, 0x6b, 0x2c, 0xb6, 0x5d, 0x7a, 0xdd,
+			0xa1, 0x92, 0x84, 0x67, 0x15, 0xe7, 0xca, 0x05,
+			0x24, 0xdb, 0x51, 0x0e, 0xef, 0xc6, 0x0a, 0x9b,
+			0x92, 0x56, 0xba, 0xb8, 0x82, 0x9e, 0x9b, 0xba,
+			0x30, 0xc4, 0x33, 0x8d, 0xe6, 0x20, 0x0a, 0x5a,
+			0x1b, 0x4e, 0xc9, 0xff, 0x61, 0x03, 0x61, 0x5a,
+			0x2c, 0x54, 0x33, 0xe3, 0x96, 0x3e, 0x1d, 0x05,
+			0x84, 0xf9, 0x12, 0x3f, 0xb7, 0x39, 0xee, 0xee,
+			0x38, 0xbe, 0xe6, 0xf3, 0xb4, 0xf6, 0x37, 0xbf,
+			0xbb, 0x70, 0x40, 0x71, 0x59, 0xf0, 0x25, 0x61,
+			0x2e, 0xf7, 0x0b, 0x16, 0xea, 0x17, 0xa5, 0x97,
+			0xaf, 0x00, 0x9f, 0x7b, 0x55, 0x81, 0xd2, 0xa5,
+			0x71, 0x68, 0x7a, 0x66, 0x6e, 0xc9, 0xf8, 0x7a,
+			0xe7, 0x70, 0x64, 0x75, 0x8f, 0xde, 0x77, 0xb1,
+			0xeb, 0xcc, 0xca, 0x44, 0x65, 0x9b, 0x8b, 0xb5,
+			0x47, 0x9d, 0x19, 0x4b, 0xf6, 0x80, 0x39, 0x91,
+			0x72, 0x53, 0xe5, 0x52, 0x0e, 0x12, 0x8b, 0x98,
+			0x25, 0x1f, 0x1b, 0x8f, 0x9e, 0x69, 0xd5, 0xdc,
+			0xf3, 0x6c, 0xb3, 0x22, 0x9c, 0x08, 0xe5, 0xc6,
+			0x46, 0x32, 0xcf, 0x5a, 0x90, 0x83, 0xe0, 0x62,
+			0xfc, 0xd2, 0x2e, 0xb4, 0xb0, 0xb7, 0x67, 0x02,
+			0xcc, 0x2d, 0x77, 0x57, 0xc6, 0xd6, 0xd1, 0xad,
+			0xfb, 0x4c, 0xf8, 0x93, 0xef, 0x7a, 0xbe, 0xa5,
+			0xc3, 0x1d, 0x5b, 0x61, 0x7f, 0x4e, 0x30, 0x9c,
+			0x39, 0x5c, 0x39, 0xc5, 0xe7, 0xa0, 0x9e, 0x09,
+			0x90, 0x3d, 0x97, 0xe8, 0x76, 0x0e, 0xac, 0x4d,
+			0x07, 0xa6, 0x33, 0xd6, 0x19, 0x8d, 0x4b, 0xc2,
+			0xe4, 0x99, 0x30, 0x58, 0xa5, 0xac, 0x2b, 0x14,
+			0xf8, 0x4f, 0x9e, 0xb4, 0xbb, 0x31, 0xc8, 0x9b,
+			0xd6, 0xef, 0xe3, 0xcb, 0xae, 0xc4, 0x43, 0x32,
+			0x81, 0x2b, 0x90, 0xca, 0x43, 0xfe, 0xb5, 0x90,
+			0x3b, 0x65, 0x99, 0x9e, 0xc7, 0xd6, 0x1c, 0x5b,
+			0xfe, 0xae, 0x36, 0x94, 0xe2, 0x86, 0x15, 0x96,
+			0xf0, 0x31, 0xe8, 0xa0, 0xa3, 0x20, 0xb6, 0x4e,
+			0x1d, 0xad, 0xb6, 0xae, 0x27, 0x30, 0x58, 0xb0,
+			0x0f, 0x41, 0x5e, 0x14, 0x21, 0x05, 0x1c, 0x8e,
+			0x15, 0x09, 0x70, 0xb2, 0x5a, 0x1f, 0x80, 0x8d,
+			0x4a, 0xf6, 0x2e, 0x89, 0xc1, 0xe7, 0xfe, 0x98,
+			0x8f, 0x4c, 0x6f, 0xba, 0xff, 0x64, 0xce, 0x3a,
+			0x3f, 0x71, 0x3e, 0x20, 0xf1, 0x1c, 0xdc, 0x93,
+			0x4c, 0x92, 0x34, 0x49, 0xe6, 0x8b, 0xe4, 0x86,
+			0x78, 0x47, 0xe1, 0xb5, 0x67, 0x5c, 0xbd, 0x22,
+			0xba, 0x71, 0x58, 0xd2, 0xaf, 0x84, 0x9c, 0x69,
+			0x63, 0xfb, 0x64, 0x1e, 0xca, 0xc3, 0x5a, 0xc3,
+			0x36, 0x0e, 0x0e, 0x7d, 0x9a, 0x9f, 0x27, 0xa9,
+			0x4c, 0xef, 0xa4, 0x27, 0xc0, 0x9f, 0xac, 0xcf,
+			0x54, 0x94, 0xbc, 0xde, 0x92, 0xb3, 0xf8, 0x10,
+			0x23, 0x20, 0x30, 0x4e, 0x26, 0xd1, 0xa0, 0x5a,
+			0xc0, 0xb0, 0x3b, 0x32, 0xd7, 0x7b, 0x33, 0x69,
+			0x34, 0xe3, 0x06, 0x2e, 0x63, 0x2c, 0x42, 0x87,
+			0x6d, 0xf3, 0x83, 0xbc, 0x84, 0x4c, 0x24, 0x99,
+			0x89, 0x31, 0x32, 0xef, 0xfc, 0xcc, 0x51, 0xc1,
+			0x8b, 0x0b, 0xab, 0x01, 0xc1, 0x86, 0x9f, 0x30,
+			0xf5, 0xd3, 0x88, 0xe7, 0xac, 0xfb, 0x3b, 0x8c,
+			0xb4, 0x37, 0x58, 0x76, 0x99, 0x1e, 0x1a, 0xff,
+			0x89, 0x86, 0xde, 0x5e, 0xf8, 0x4d, 0x87, 0x89,
+			0xf0, 0xcb, 0x0e, 0x99, 0x3d, 0xc0, 0x0d, 0x57,
+			0x12, 0x9c, 0xb6, 0x67, 0xf9, 0x13, 0x27, 0xb3,
+			0x5b, 0xa9, 0xe3, 0xc5, 0xcd, 0x2d, 0x45, 0xc8,
+			0x92, 0x40, 0xda, 0x5e, 0xfd, 0x47, 0x67, 0x17,
+			0xbb, 0x3d, 0xff, 0x9e, 0x68, 0xec, 0x2c, 0x13,
+			0x4b, 0x69, 0x76, 0x48, 0x0f, 0x6a, 0xcb, 0xee,
+			0xd4, 0xd4, 0xda, 0xc8, 0x38, 0x28, 0x41, 0x5b,
+			0x13, 0x6a, 0xcf, 0x20, 0x8c, 0x11, 0xc2, 0xa9,
+			0x73, 0xad, 0x65, 0xf2, 0x52, 0xac, 0xd3, 0xf8,
+			0xcd, 0xc9, 0x18, 0xb9, 0x8c, 0x8b, 0xc4, 0xf7,
+			0xc0, 0x99, 0x9d, 0x4f, 0x9b, 0xec, 0x2d, 0x4d,
+			0x52, 0x6b, 0xcd, 0xe2, 0x57, 0x93, 0x4e, 0x08,
+			0x99, 0x31, 0xbe, 0xc8, 0xfc, 0x16, 0x94, 0x47,
+			0xca, 0xae, 0x0b, 0x21, 0xc3, 0x4f, 0x51, 0xfe,
+			0x9f, 0x62, 0xb8, 0xdc, 0xa1, 0x85, 0xa7, 0x72,
+			0xa9, 0xc4, 0x10, 0x37, 0x8e, 0x50, 0x66, 0xf0,
+			0x2f, 0x72, 0xde, 0xe0, 0x16, 0x9f, 0x7c, 0xe7,
+			0x00, 0x3c, 0xdf, 0x59, 0x62, 0x07, 0x52, 0xcc,
+			0x32, 0x63, 0x83, 0xe1, 0x22, 0xd2, 0x86, 0x19,
+			0x71, 0x15, 0xd3, 0x82, 0xea, 0xdd, 0xc7, 0x98,
+			0x40, 0xad, 0xa1, 0xae, 0xf5, 0x3b, 0x60, 0x03,
+			0x74, 0xb0, 0xca, 0x38, 0xd9, 0x1a, 0xd6, 0x9a,
+			0xe8, 0xf1, 0x44, 0xf6, 0x76, 0xee, 0x4d, 0xc6,
+			0xf8, 0xd6, 0x62, 0x59, 0x5d, 0x71, 0xfe, 0xe2,
+			0xb1, 0x02, 0x35, 0xbe, 0xb3, 0x58, 0xac, 0x4c,
+			0xd2, 0xac, 0xcc, 0xab, 0x37, 0x2c, 0x48, 0x7f,
+			0xc6, 0xaf, 0x39, 0xa4, 0x5c, 0x79, 0x2a, 0x71,
+			0x11, 0x51, 0x7b, 0xbd, 0x05, 0x25, 0xdf, 0xa6,
+			0x75, 0xb8, 0x25, 0xa8, 0x40, 0x30, 0x53, 0xe6,
+			0x73, 0xe5, 0x32, 0x1a, 0xa8, 0xef, 0x81, 0x82,
+			0xe4, 0xfe, 0x5b, 0x52, 0x0d, 0xf2, 0xcb, 0x3b,
+			0x5d, 0x2d, 0x07, 0xd7, 0x9e, 0x31, 0x86, 0x02,
+			0x09, 0x2c, 0xce, 0xf5, 0x83, 0xb7, 0x92, 0x87,
+			0x89, 0xac, 0xe7, 0xe2, 0xb2, 0x6e, 0x1b, 0xbe,
+			0x48, 0x3e, 0xa9, 0x26, 0xb5, 0x28, 0x1c, 0xca,
+			0xea, 0x6c, 0xaa, 0xe9, 0x6f, 0x6a, 0xf0, 0x8f,
+			0x8e, 0x6f, 0x54, 0x6e, 0x08, 0xc0, 0x00, 0x39,
+			0x14, 0xbf, 0x46, 0x06, 0xcb, 0x63, 0xc0, 0xe3,
+			0x26, 0xbd, 0xd9, 0xe4, 0x36, 0xac, 0x01, 0x86,
+			0x6d, 0x8b, 0x81, 0x78, 0xdc, 0x66, 0xb3, 0x0b,
+			0x1c, 0x52, 0x2b, 0x3a, 0x7a, 0x11, 0x97, 0x2a,
+			0xed, 0x38, 0x28, 0x52, 0x89, 0xf0, 0x39, 0x57,
+			0x6e, 0xa8, 0xe1, 0x92, 0x58, 0x3d, 0x75, 0xe2,
+			0x67, 0xe8, 0x06, 0x7b, 0x2a, 0xdb, 0x0f, 0xe5,
+			0x87, 0x41, 0x1e, 0xe4, 0xa3, 0xd9, 0xc0, 0xf6,
+			0xf3, 0x8e, 0x53, 0x6b, 0x88, 0x43, 0x4a, 0xab,
+			0x8b, 0x1c, 0x5e, 0x64, 0x02, 0x81, 0x43, 0xea,
+			0x28, 0xb9, 0x4e, 0x7e, 0x77, 0xf0, 0xdb, 0x46,
+			0x16, 0xc5, 0xa4, 0x67, 0x44, 0x72, 0xfb, 0x65,
+			0x81, 0x7f, 0x44, 0xc1, 0xed, 0x71, 0xd5, 0xbc,
+			0x4a, 0x3b, 0x60, 0x52, 0xf8, 0xe8, 0x2d, 0xab,
+			0xaa, 0x09, 0x06, 0x5f, 0x6b, 0x59, 0x47, 0xc8,
+			0x47, 0xc3, 0xca, 0xf6, 0xb3, 0xd2, 0xbc, 0xff,
+			0x3a, 0x61, 0x4f, 0x8f, 0x53, 0x95, 0xf8, 0xa4,
+			0xc2, 0xab, 0x50, 0xbe, 0xd5, 0x60, 0x8f, 0xed,
+			0x07, 0x87, 0x67, 0x72, 0x2f, 0x13, 0xa4, 0xbb,
+			0x61, 0x25, 0x56, 0x37, 0x83, 0x2f, 0x71, 0x82,
+			0x5d, 0xc2, 0x7b, 0xe1, 0xdb, 0x44, 0x1f, 0x16,
+			0x66, 0x6c, 0xcb, 0x5a, 0xc4, 0x30, 0x47, 0xc6,
+			0xdb, 0x1f, 0x5d, 0xe1, 0x18, 0xf7, 0x19, 0x58,
+			0x5e, 0x08, 0xf8, 0xd6, 0xa7, 0x24, 0xc3, 0xed,
+			0x97, 0xc1, 0xcc, 0x72, 0x92, 0x9a, 0x08, 0x6c,
+			0x0f, 0x5a, 0xd4, 0x52, 0x0d, 0xed, 0x8b, 0x91,
+			0x3e, 0x5d, 0x2a, 0x50, 0x62, 0x14, 0xbd, 0x99,
+			0xdc, 0xcf, 0xab, 0xc8, 0xa0, 0xfa, 0x53, 0xb1,
+			0xab, 0x12, 0x4e, 0x38, 0x42, 0xc0, 0x37, 0x4c,
+			0x6e, 0xa3, 0x55, 0xdd, 0x2f, 0x3c, 0x7a, 0x5f,
+			0xb9, 0x01, 0x23, 0xb5, 0x86, 0x79, 0x63, 0xca,
+			0xb4, 0xd2, 0x0d, 0xe7, 0x8e, 0xad, 0x0f, 0x8c,
+			0xb4, 0x2a, 0x87, 0x67, 0x83, 0xd9, 0x08, 0x60,
+			0x4c, 0xdf, 0x02, 0x96, 0x0f, 0x4a, 0x03, 0x6e,
+			0xa8, 0xb5, 0xf2, 0x76, 0x73, 0xf2, 0x8e, 0x46,
+			0x3b, 0x45, 0x3d, 0x05, 0x4c, 0x34, 0x42, 0x79,
+			0xac, 0x2a, 0x7e, 0x04, 0x8e, 0xc5, 0xda, 0xf4,
+			0xd7, 0xe2, 0x19, 0x59, 0x6e, 0x18, 0x64, 0xb5,
+			0xb8, 0xda, 0x27, 0x12, 0x33, 0x03, 0x22, 0xad,
+			0xc1, 0x34, 0xe3, 0xa7, 0xcd, 0xc4, 0xb5, 0x6e,
+			0x1e, 0x3c, 0x12, 0xd4, 0xd4, 0xa1, 0xd5, 0x6f,
+			0xcb, 0x59, 0xa6, 0xb3, 0xfc, 0xd8, 0x42, 0x6e,
+			0xfd, 0x3a, 0x23, 0x55, 0x6a, 0xf3, 0x5b, 0xea,
+			0x8a, 0x76, 0x29, 0x9f, 0x03, 0x70, 0x98, 0xc3,
+			0x43, 0xcf, 0xaf, 0x7f, 0xba, 0xc9, 0x84, 0x0f,
+			0xcc, 0x1e, 0xff, 0x14, 0xda, 0x66, 0xe5, 0xbb,
+			0x3c, 0x49, 0x4c, 0x2b, 0x42, 0x4b, 0x32, 0x95,
+			0x22, 0xe5, 0x62, 0x4b, 0xfc, 0x25, 0x15, 0xce,
+			0x5e, 0xe6, 0xb5, 0x2e, 0x57, 0xa7, 0xd4, 0x54,
+			0x40, 0x81, 0x36, 0x39, 0x05, 0xe0, 0xf1, 0xdb,
+			0xf3, 0x42, 0xed, 0x09, 0x3d, 0x15, 0xd4, 0xa5,
+			0xfe, 0x5f, 0x36, 0xfb, 0xe0, 0x1b, 0x17, 0x45,
+			0x70, 0xf1, 0x2c, 0x92, 0x4a, 0x31, 0xc6, 0x90,
+			0x75, 0xe8, 0x80, 0x21, 0xd6, 0x90, 0x46, 0x21,
+			0x6d, 0x9a, 0x82, 0x55, 0xc6, 0x61, 0xba, 0x78,
+			0xf2, 0xc2, 0x15, 0x51, 0x8b, 0x35, 0xf7, 0x70,
+			0x36, 0xb5, 0x22, 0x59, 0x5c, 0x70, 0x6b, 0x9d,
+			0xeb, 0x13, 0x72, 0xb9, 0xfd, 0x01, 0xed, 0x0f,
+			0xcb, 0xc0, 0xb1, 0xed, 0xb4, 0xe8, 0xe1, 0xde,
+			0x65, 0x9f, 0x8c, 0x8b, 0xe7, 0x84, 0x4e, 0x18,
+			0xca, 0x41, 0x6d, 0x2f, 0x81, 0xc7, 0x29, 0x65,
+			0x85, 0x32, 0xfa, 0xaf, 0x82, 0xf4, 0xb3, 0x07,
+			0x90, 0x6a, 0x9c, 0x17, 0xa9, 0x8c, 0xd5, 0x6b,
+			0xb3, 0x3d, 0x4d, 0x9b, 0xc8, 0x09, 0x3d, 0xcc,
+			0x8b, 0xa6, 0x99, 0xcc, 0xcc, 0x70, 0x55, 0x7f,
+			0xf7, 0xd3, 0x1d, 0x31, 0x35, 0x12, 0x60, 0x40,
+			0xac, 0x9b, 0xa4, 0xf2, 0xe7, 0x95, 0xa5, 0x87,
+			0x20, 0x29, 0xfd, 0x8e, 0x33, 0x2b, 0xeb, 0x52,
+			0x53, 0xcc, 0xc2, 0x04, 0x2c, 0xb0, 0x78, 0x93,
+			0x31, 0x5a, 0x0a, 0x78, 0x93, 0x91, 0xc0, 0x86,
+			0xd4, 0x08, 0x56, 0xdb, 0xc4, 0xca, 0xf2, 0xb9,
+			0x25, 0x99, 0x17, 0x8f, 0xda, 0x79, 0x22, 0x8f,
+			0x60, 0xd6, 0x6c, 0x5f, 0xd1, 0x0a, 0x3e, 0x19,
+			0x96, 0x30, 0x34, 0x60, 0x88, 0x7e, 0x32, 0x6d,
+			0xa9, 0xb7, 0xe0, 0xbb, 0x50, 0x4f, 0x8f, 0xe3,
+			0x21, 0xcd, 0xee, 0x67, 0xe9, 0x79, 0x5a, 0xfc,
+			0x42, 0xdd, 0x4e, 0xf0, 0x2c, 0xba, 0x69, 0x59,
+			0x06, 0x30, 0x77, 0x74, 0x58, 0xce, 0x0f, 0x78,
+			0xb7, 0xca, 0xe4, 0xd7, 0x1b, 0x64, 0x22, 0x4d,
+			0xe8, 0x0c, 0xe0, 0x14, 0xd1, 0x90, 0xd2, 0xfd,
+			0x91, 0x9c, 0xc2, 0xf4, 0x65, 0x71, 0xf8, 0xaa,
+			0x43, 0xe9, 0x23, 0xd7, 0xd4, 0x4f, 0xd0, 0x50,
+			0x4a, 0xfd, 0x5e, 0x54, 0x3e, 0xc2, 0x2a, 0x71,
+			0x2d, 0xea, 0x09, 0xb0, 0xc2, 0x12, 0x3e, 0xc8,
+			0xff, 0xbe, 0xa5, 0xc4, 0xb9, 0x0e, 0x8d, 0x42,
+			0x21, 0x04, 0xe8, 0x7f, 0xd8, 0xf4, 0xbd, 0x90,
+			0x1c, 0x99, 0xb5, 0x6b, 0x97, 0xb8, 0xa3, 0x7d,
+			0xd3, 0x40, 0x8f, 0x3d, 0xc2, 0x0a, 0x35, 0xc3,
+			0xe3, 0x81, 0x05, 0x62, 0x0a, 0x77, 0x04, 0x40,
+			0xe2, 0x24, 0x08, 0xb2, 0x89, 0x80, 0xae, 0xd2,
+			0x66, 0x5f, 0xc9, 0xfa, 0xe3, 0x46, 0x76, 0xac,
+			0x57, 0xcb, 0x18, 0xd1, 0x4d, 0xa1, 0x88, 0x95,
+			0x6e, 0xbb, 0x03, 0x2c, 0x9f, 0x90, 0xbb, 0xf8,
+			0xc6, 0x40, 0xc9, 0xee, 0xd8, 0x2b, 0xce, 0x5c,
+			0xc3, 0x58, 0xe7, 0xb2, 0xad, 0xae, 0xbe, 0xbf,
+			0x20, 0x73, 0x21, 0x29, 0xf6, 0xe5, 0xa5, 0xf4,
+			0x78, 0xfd, 0xce, 0x8c, 0x45, 0xb5, 0xcc, 0x35,
+			0xd2, 0xfb, 0x6e, 0x66, 0x08, 0x08, 0xf9, 0x70,
+			0xad, 0xbf, 0xa7, 0x32, 0x69, 0x09, 0xe9, 0x2b,
+			0x62, 0x13, 0x10, 0x30, 0x85, 0xb1, 0x1b, 0xb2,
+			0xa1, 0x30, 0x35, 0x4c, 0x48, 0xbb, 0xb0, 0x63,
+			0xfd, 0xca, 0xa2, 0x9d, 0xdb, 0xb0, 0x1d, 0xef,
+			0x91, 0xd2, 0xbf, 0x2b, 0xe9, 0xe4, 0x86, 0x9f,
+			0x76, 0xb2, 0x25, 0x39, 0x57, 0x91, 0xb6, 0x37,
+			0x36, 0x2d, 0xa1, 0x36, 0x40, 0xc0, 0x45, 0x06,
+			0x69, 0xcd, 0x08, 0x75, 0x29, 0x5b, 0x9f, 0x1d,
+			0x14, 0xe9, 0x68, 0x5a, 0xcb, 0xf9, 0x5d, 0xea,
+			0x87, 0x29, 0xad, 0xd9, 0xdb, 0xac, 0x9c, 0x51,
+			0x75, 0xb2, 0xd2, 0xca, 0xe7, 0xa0, 0xad, 0xb9,
+			0x15, 0x9d, 0x5b, 0x7a, 0x5d, 0x41, 0x40, 0xd7,
+			0x9e, 0xaa, 0x0f, 0xfe, 0x1c, 0x25, 0x7d, 0xc0,
+			0xa6, 0xa9, 0x6c, 0x95, 0x39, 0x30, 0x88, 0x7a,
+			0x81, 0x6f, 0xce, 0x60, 0xfa, 0xea, 0x3b, 0x5b,
+			0x5d, 0x86, 0x22, 0xfb, 0x87, 0x2f, 0xb3, 0x69,
+			0xf0, 0x00, 0x72, 0x23, 0xac, 0xce, 0x43, 0x86,
+			0x18, 0x85, 0x54, 0x78, 0x2d, 0x5b, 0x5f, 0x16,
+			0x11, 0x68, 0x82, 0x7f, 0xcf, 0xe3, 0x92, 0xf2,
+			0xd2, 0x51, 0x5d, 0x1a, 0xde, 0x3f, 0x26, 0xf4,
+			0xed, 0x22, 0x0d, 0xfe, 0x48, 0x25, 0x53, 0x10,
+			0xb0, 0x0f, 0x07, 0xc7, 0x86, 0xc7, 0x26, 0xb5,
+			0xb0, 0x8b, 0xef, 0x74, 0x23, 0xf8, 0x9f, 0xb3,
+			0x6c, 0x37, 0x69, 0xc4, 0xb1, 0x0d, 0xe7, 0xbd,
+			0x90, 0xb7, 0x8f, 0xd6, 0x37, 0x2c, 0xbd, 0xb4,
+			0xa8, 0xb1, 0x6c, 0x79, 0x70, 0x50, 0x5c, 0xb6,
+			0x09, 0x14, 0x31, 0x5c, 0xf5, 0x42, 0x48, 0x2b,
+			0x75, 0xbf, 0xe7, 0x9b, 0xb0, 0xa0, 0xf7, 0xa7,
+			0x41, 0x40, 0x44, 0x7c, 0x0c, 0x44, 0x3d, 0xe6,
+			0x30, 0xce, 0xd7, 0x5e, 0xba, 0x2a, 0xb2, 0x55,
+			0xfc, 0x5c, 0x44, 0x22, 0x8b, 0xed, 0xfe, 0xc3,
+			0xcc, 0x08, 0xab, 0x04, 0xb7, 0x24, 0x28, 0xcb,
+			0x51, 0x75, 0x91, 0x9d, 0xd0, 0xce, 0x14, 0xfc,
+			0xc5, 0xf6, 0x3a, 0x9d, 0xe3, 0x9e, 0xae, 0xb2,
+			0x8d, 0xbf, 0xdd, 0xdf, 0x83, 0xd7, 0x81, 0x73,
+			0x74, 0xb1, 0xc4, 0x29, 0x3e, 0x7c, 0x61, 0xda,
+			0xc2, 0xdf, 0x15, 0x39, 0x3a, 0x54, 0x0b, 0x67,
+			0x78, 0x87, 0x3b, 0x19, 0xab, 0xbc, 0x96, 0xec,
+			0xd1, 0xf3, 0xf7, 0x59, 0x63, 0xe5, 0x05, 0x81,
+			0xb0, 0x18, 0xb9, 0xec, 0x08, 0xdb, 0x3e, 0x7e,
+			0xdc, 0xfc, 0xcd, 0xe8, 0x8d, 0x9b, 0xc0, 0x44,
+			0x7d, 0xfd, 0x6d, 0x23, 0x65, 0x74, 0xe5, 0x36,
+			0x8c, 0xb7, 0xf2, 0xc1, 0xc1, 0x75, 0xbb, 0x4c,
+			0x19, 0xb8, 0x56, 0xd5, 0xde, 0xf1, 0xcd, 0x38,
+			0x48, 0xe4, 0xdb, 0x79, 0x36, 0xdc, 0xa1, 0x88,
+			0x39, 0x4d, 0x18, 0x9d, 0xb9, 0x2c, 0x95, 0x86,
+			0xb8, 0x82, 0x59, 0xae, 0xe1, 0x4f, 0xe7, 0x0e,
+			0x0d, 0xd2, 0xac, 0xc4, 0x1f, 0x6b, 0xde, 0x92,
+			0x72, 0x81, 0xa9, 0xae, 0x38, 0x97, 0x44, 0xfc,
+			0xee, 0x0a, 0x5a, 0x4d, 0x7c, 0x69, 0xac, 0x58,
+			0xc3, 0xd0, 0x20, 0xcb, 0x3f, 0xdc, 0x63, 0xd4,
+			0xd1, 0x25, 0xa0, 0xbf, 0x59, 0xd1, 0xfc, 0x72,
+			0x34, 0x10, 0x5b, 0x5a, 0xc4, 0x0b, 0xe8, 0x89,
+			0xa4, 0x94, 0x30, 0x55, 0x91, 0x7f, 0x29, 0x8c,
+			0x66, 0x4f, 0x3c, 0x14, 0xdc, 0xa7, 0x78, 0xed,
+			0xbd, 0x87, 0xd8, 0x98, 0x47, 0xd7, 0x6e, 0x83,
+			0x1e, 0xa1, 0x70, 0x3a, 0x86, 0xc5, 0x6d, 0x3d,
+			0xd3, 0xb7, 0x82, 0xfe, 0x87, 0x3a, 0x04, 0xfd,
+			0xf4, 0xb9, 0xd5, 0x7e, 0xd0, 0x73, 0x20, 0x26,
+			0xa4, 0xc1, 0x1b, 0xf2, 0x70, 0xc2, 0xae, 0xe8,
+			0xf6, 0x39, 0x7c, 0x83, 0x2f, 0xed, 0x97, 0x35,
+			0x94, 0xed, 0x87, 0xf6, 0xc6, 0xeb, 0xd8, 0x71,
+			0xec, 0x41, 0x8c, 0x79, 0x0d, 0x59, 0x3c, 0x50,
+			0xee, 0x48, 0x61, 0xfd, 0xf0, 0xb5, 0x8d, 0x9f,
+			0xc5, 0x5e, 0x0b, 0x1e, 0x3f, 0x5a, 0xb3, 0x5a,
+			0xdf, 0x4c, 0x60, 0x23, 0x97, 0x50, 0x78, 0x3c,
+			0x8f, 0x97, 0x41, 0xe7, 0x97, 0xa7, 0x64, 0xcd,
+			0x90, 0x37, 0x11, 0xa4, 0xe1, 0x26, 0x59, 0x41,
+			0x8d, 0xa2, 0x5b, 0xf4, 0x5d, 0xe6, 0xb3, 0xb2,
+			0x57, 0x6f, 0x1e, 0x91, 0x47, 0x81, 0x67, 0x36,
+			0x88, 0x7b, 0xcd, 0xbd, 0x94, 0xab, 0x40, 0xfb,
+			0x07, 0xaf, 0xf2, 0x90, 0xb1, 0xbf, 0x87, 0x88,
+			0x52, 0x71, 0xa4, 0x1c, 0xeb, 0x82, 0x94, 0xe7,
+			0x52, 0xd2, 0xe1, 0xad, 0x13, 0x62, 0x5f, 0xe6,
+			0x67, 0xc4, 0x6f, 0x34, 0x8e, 0x51, 0x7e, 0xed,
+			0x57, 0x4a, 0x1d, 0x87, 0xa8, 0x88, 0xbf, 0x59,
+			0xca, 0x96, 0xa6, 0x82, 0xb8, 0x51, 0x58, 0x55,
+			0xc4, 0x02, 0x57, 0x60, 0x12, 0x6a, 0x00, 0x91,
+			0xa7, 0xf0, 0xf7, 0xf2, 0xd7, 0xf3, 0x6c, 0x41,
+			0xfd, 0x38, 0x2a, 0x50, 0x3a, 0x0e, 0xe9, 0x05,
+			0xf5, 0xd6, 0xbd, 0x52, 0x79, 0x6d, 0xb7, 0x69,
+			0x66, 0x4c, 0x59, 0x5c, 0x49, 0x7a, 0xde, 0x35,
+			0x3a, 0xda, 0x4a, 0x1e, 0xc3, 0xe6, 0xd2, 0xe7,
+			0x4b, 0xbd, 0x1a, 0xd0, 0xd3, 0x0f, 0x35, 0xda,
+			0x02, 0x3a, 0xd2, 0x2a, 0x7b, 0xae, 0xa2, 0x17,
+			0xbd, 0x64, 0x65, 0x1d, 0x09, 0x36, 0x0e, 0xa0,
+			0x9f, 0xc1, 0xe2, 0x7d, 0xab, 0xd2, 0x69, 0x76,
+			0x49, 0x74, 0xdf, 0x3d, 0xed, 0x78, 0xda, 0x01,
+			0xce, 0xb7, 0x36, 0x8c, 0x09, 0x66, 0xc2, 0xa4,
+			0xae, 0xd0, 0xda, 0xa2, 0xc6, 0x44, 0xd8, 0xf4,
+			0x50, 0x41, 0x16, 0x97, 0xb3, 0xf8, 0x4d, 0x76,
+			0x05, 0x74, 0x39, 0x90, 0x82, 0x46, 0xb8, 0xca,
+			0x5f, 0xfb, 0x51, 0xcb, 0xcf, 0x83, 0xf9, 0x23,
+			0x4d, 0x11, 0x8a, 0x57, 0xdd, 0x15, 0x50, 0x04,
+			0x86, 0xef, 0xfc, 0xc9, 0xab, 0x5e, 0x91, 0xeb,
+			0x5b, 0x2f, 0xf4, 0x36, 0x97, 0x75, 0xcb, 0xac,
+			0xda, 0xb4, 0xca, 0xe8, 0x1a, 0xfd, 0x29, 0xa4,
+			0x99, 0x60, 0xf3, 0x0c, 0x3d, 0xea, 0x1e, 0xd4,
+			0x41, 0x8b, 0xea, 0xa9, 0x9f, 0x71, 0xa0, 0xd2,
+			0x97, 0xca, 0x4f, 0x47, 0xd9, 0xb5, 0x78, 0xcb,
+			0xc8, 0x62, 0xcb, 0x21, 0xb6, 0x67, 0x10, 0x6e,
+			0xf0, 0xaf, 0x0f, 0x41, 0x07, 0x70, 0x91, 0xae,
+			0xfe, 0xad, 0x6d, 0x53, 0x86, 0x71, 0xe5, 0xcb,
+			0x8a, 0x0c, 0x71, 0x1f, 0xe1, 0x01, 0xe0, 0x9c,
+			0xdc, 0xc6, 0x86, 0x80, 0x6e, 0xc0, 0x4f, 0xeb,
+			0xb2, 0x23, 0x09, 0x48, 0xe4, 0xfb, 0x7d, 0x3e,
+			0x44, 0x34, 0x9c, 0x83, 0xaa, 0x82, 0x6e, 0xf7,
+			0x33, 0x51, 0xfb, 0x76, 0x80, 0x87, 0x6c, 0xa3,
+			0x70, 0x91, 0xe6, 0x1b, 0xde, 0x89, 0xc3, 0x3e,
+			0x48, 0xf8, 0x1f, 0x58, 0xa5, 0x7d, 0x5c, 0x68,
+			0xb7, 0x3b, 0xf5, 0xd8, 0x11, 0xf7, 0x6b, 0x9c,
+			0x85, 0x26, 0xdd, 0xe9, 0x3c, 0x7b, 0xab, 0x47,
+			0x12, 0xf4, 0xb3, 0xc9, 0xd2, 0x2b, 0x04, 0x28,
+			0xed, 0x5f, 0x42, 0x50, 0x84, 0x28, 0x3c, 0xe1,
+			0xb3, 0xc6, 0x61, 0x66, 0x89, 0xdb, 0x44, 0x2e,
+			0x8b, 0xc2, 0x3a, 0x78, 0x81, 0x89, 0xd8, 0x4c,
+			0xee, 0x74, 0x60, 0x8a, 0x82, 0xf2, 0x38, 0xa9,
+			0x2b, 0x37, 0xfe, 0xaf, 0xf8, 0x84, 0x96, 0xf1,
+			0x84, 0xe1, 0x22, 0x92, 0x81, 0x06, 0x07, 0xdc,
+			0x54, 0x77, 0x2f, 0xc7, 0x11, 0x88, 0x03, 0x9c,
+			0x63, 0x27, 0xbb, 0xc8, 0x22, 0x3f, 0xb8, 0xae,
+			0xf3, 0x4b, 0x57, 0xd7, 0x39, 0x96, 0x5b, 0xaf,
+			0x7a, 0x5b, 0x28, 0xc9, 0x5f, 0x34, 0x87, 0x9b,
+			0xc2, 0xf5, 0x74, 0xdf, 0x0f, 0x64, 0xef, 0x37,
+			0x45, 0x8e, 0xe8, 0xda, 0xed, 0xf9, 0x24, 0xe0,
+			0x22, 0xf5, 0x1b, 0x8b, 0x6d, 0x96, 0x6a, 0xbd,
+			0x3e, 0x37, 0x24, 0xbc, 0xbb, 0x2d, 0x17, 0xdb,
+			0x32, 0x12, 0x1f, 0xd2, 0x7c, 0x1c, 0x4b, 0x86,
+			0xfb, 0xc4, 0x03, 0x7f, 0x08, 0x9a, 0xe0, 0x0a,
+			0xe4, 0xe4, 0xe7, 0x36, 0xb5, 0x02, 0x0c, 0x33,
+			0x97, 0x13, 0x85, 0x6c, 0xa9, 0x87, 0x79, 0x49,
+			0xfa, 0xa8, 0xd9, 0x6d, 0x3f, 0xe7, 0x70, 0x8e,
+			0xff, 0xed, 0x00, 0xa4, 0xe1, 0x5f, 0xef, 0x59,
+			0xb9, 0x9a, 0x69, 0x1a, 0x11, 0xe5, 0x42, 0xb2,
+			0x25, 0x4f, 0x4f, 0x57, 0xd3, 0x36, 0x36, 0x40,
+			0x45, 0xd3, 0x8a, 0x77, 0x01, 0x1e, 0xf9, 0x2a,
+			0x44, 0xfc, 0xed, 0xc9, 0xd7, 0xa4, 0xe9, 0x26,
+			0x97, 0x91, 0x15, 0x53, 0xe7, 0xa7, 0xba, 0x0e,
+			0xa7, 0x41, 0x65, 0x81, 0x2c, 0x20, 0x7c, 0x7b,
+			0xfa, 0x6b, 0xc8, 0x63, 0x35, 0x84, 0x6b, 0x10,
+			0x88, 0x80, 0x35, 0x3b, 0xb2, 0x62, 0x2a, 0xed,
+			0x52, 0x23, 0xa2, 0x27, 0xeb, 0x6b, 0x62, 0xd3,
+			0x98, 0xe2, 0xbd, 0x3a, 0x03, 0x4b, 0x21, 0xac,
+			0x03, 0xc2, 0xc1, 0x34, 0x2e, 0x0e, 0x5b, 0xfc,
+			0x91, 0xa5, 0xea, 0x0b, 0x03, 0x44, 0xb6, 0xdc,
+			0x16, 0xff, 0x13, 0x6b, 0xfb, 0x3c, 0x9d, 0x5c,
+			0x1b, 0x62, 0x12, 0x04, 0x05, 0xab, 0xe1, 0xe5,
+			0xd4, 0xb8, 0xa7, 0xe5, 0x33, 0x47, 0x83, 0x6c,
+			0xc2, 0xb3, 0xc3, 0x25, 0x29, 0x99, 0x8b, 0xe6,
+			0x6c, 0x22, 0x3b, 0xa5, 0x9d, 0xd3, 0x65, 0xf2,
+			0x43, 0xf8, 0xec, 0x40, 0x8e, 0x69, 0x3b, 0x8c,
+			0xac, 0x1b, 0xa4, 0xf4, 0x0d, 0xab, 0x1c, 0x79,
+			0x01, 0xcb, 0xcc, 0x80, 0x03, 0xe7, 0x98, 0x36,
+			0x58, 0x63, 0x5c, 0xb0, 0xb0, 0x14, 0x75, 0xed,
+			0x22, 0x71, 0x02, 0x93, 0x25, 0x4f, 0xee, 0x91,
+			0xe3, 0x9f, 0x6e, 0xf4, 0xa0, 0x3e, 0x76, 0x25,
+			0x54, 0xae, 0xd2, 0xcd, 0x14, 0x5b, 0x49, 0x78,
+			0xb3, 0x56, 0x41, 0x8d, 0x52, 0x96, 0x8f, 0x81,
+			0xc5, 0x7e, 0x74, 0x61, 0xea, 0x38, 0x3d, 0x7f,
+			0x5c, 0x65, 0x24, 0xa3, 0x5f, 0xaa, 0xbd, 0x05,
+			0x19, 0x00, 0x45, 0x1e, 0xa3, 0x14, 0xd1, 0xbf,
+			0xdc, 0xee, 0x15, 0xc1, 0x6e, 0xe5, 0xd2, 0xac,
+			0x4c, 0xe0, 0xec, 0x13, 0x0e, 0x26, 0xb7, 0x2f,
+			0x7a, 0xed, 0x48, 0x0d, 0xad, 0x0d, 0x03, 0x91,
+			0x40, 0xd0, 0xc0, 0xed, 0xaa, 0x7c, 0x65, 0x6e,
+			0xed, 0xbb, 0x8f, 0x5f, 0xba, 0xc6, 0xd6, 0x28,
+			0x45, 0x3c, 0x54, 0xf2, 0x27, 0x90, 0xa5, 0x93,
+			0x74, 0xa2, 0x1a, 0x9c, 0x1b, 0x60, 0x37, 0xdb,
+			0x48, 0x1a, 0x27, 0x61, 0x8b, 0xe6, 0xd4, 0xf5,
+			0x06, 0xba, 0x68, 0x1c, 0x5a, 0x60, 0x97, 0x49,
+			0x9e, 0x88, 0x50, 0x59, 0x31, 0x50, 0x93, 0x57,
+			0x66, 0xc3, 0xc1, 0xd3, 0xf4, 0xd0, 0xa8, 0xb3,
+			0x2c, 0x19, 0x8b, 0xea, 0x29, 0x73, 0x79, 0xa0,
+			0xc5, 0xcc, 0x8c, 0x1a, 0x63, 0x29, 0xcd, 0x29,
+			0xb4, 0xee, 0x9d, 0x0e, 0x14, 0x03, 0x11, 0xf2,
+			0x1c, 0xc1, 0x4c, 0x26, 0x79, 0x7e, 0x21, 0x49,
+			0xea, 0xee, 0x6e, 0x1a, 0x2d, 0x4a, 0x06, 0x02,
+			0x4a, 0x23, 0x4b, 0xab, 0xcd, 0x47, 0xf6, 0x74,
+			0x7b, 0xab, 0xe9, 0x43, 0x5b, 0x69, 0x81, 0x65,
+			0x84, 0x47, 0xd9, 0xf2, 0x90, 0xfa, 0x34, 0x90,
+			0xf8, 0x9e, 0x12, 0x99, 0xf5, 0x06, 0x25, 0x94,
+			0xb0, 0x66, 0xfa, 0xaa, 0x78, 0x61, 0x9c, 0x91,
+			0x4c, 0x1f, 0xcd, 0x4d, 0x95, 0xb5, 0x98, 0x6e,
+			0x9d, 0x10, 0xc3, 0x39, 0x8a, 0x63, 0xcb, 0xbe,
+			0x0b, 0x7f, 0xdd, 0x89, 0x8e, 0x46, 0x61, 0x65,
+			0x7b, 0xa1, 0x5c, 0xbd, 0x6f, 0x8b, 0x97, 0xca,
+			0x3d, 0x49, 0xb8, 0x19, 0xd0, 0xef, 0xc0, 0x19,
+			0x81, 0xea, 0x86, 0x1f, 0x6e, 0x62, 0x55, 0x7a,
+			0xad, 0xdf, 0x07, 0xb3, 0x79, 0x57, 0x71, 0xbc,
+			0x9b, 0x98, 0x08, 0x09, 0xa4, 0x5a, 0xff, 0x86,
+			0x80, 0x35, 0x09, 0x0a, 0xc4, 0xd1, 0xa1, 0x11,
+			0x91, 0xc4, 0x91, 0xfc, 0x4d, 0x47, 0x47, 0x78,
+			0x5b, 0xdf, 0x95, 0xb3, 0xd8, 0x67, 0x94, 0xe4,
+			0xcc, 0x82, 0x40, 0x92, 0xb7, 0xf0, 0xcf, 0x33,
+			0x2f, 0x0c, 0x18, 0xbe, 0x03, 0xfb, 0x68, 0xdf,
+			0x49, 0xb9, 0x26, 0x53, 0x67, 0x99, 0x4c, 0x63,
+			0xfb, 0x76, 0x82, 0xba, 0xce, 0x63, 0x0a, 0xec,
+			0xc7, 0x2c, 0x38, 0xf6, 0x63, 0xf4, 0x50, 0x1c,
+			0xf0, 0x24, 0x31, 0xd1, 0x4b, 0x09, 0x02, 0x72,
+			0x6a, 0x95, 0x4c, 0x36, 0x89, 0xab, 0xb0, 0x24,
+			0xfa, 0xdc, 0x3e, 0x47, 0x6f, 0xe6, 0x87, 0x03,
+			0x07, 0x6e, 0x1f, 0x63, 0x27, 0x10, 0xeb, 0x71,
+			0x5e, 0x1f, 0xe5, 0x69, 0x1c, 0xee, 0x35, 0xe3,
+			0x61, 0x4c, 0xdd, 0x93, 0xa4, 0xa9, 0xf0, 0xd4,
+			0xe6, 0x55, 0x1a, 0x36, 0x16, 0x71, 0xbc, 0x89,
+			0x61, 0xd7, 0xb1, 0xaf, 0x4a, 0x46, 0x7d, 0xe6,
+			0x91, 0xf0, 0x4c, 0x16, 0x20, 0xac, 0xaf, 0x68,
+			0x00, 0x7c, 0x6f, 0x5c, 0x1e, 0x32, 0x0a, 0x30,
+			0x6e, 0x2b, 0x4e, 0x39, 0x37, 0xaf, 0x92, 0x5d,
+			0x64, 0x19, 0xc2, 0x38, 0xcb, 0x34, 0x49, 0x47,
+			0x21, 0x81, 0x72, 0x2c, 0x16, 0xbf, 0x04, 0x89,
+			0x13, 0x36, 0xd1, 0x11, 0x5d, 0xbc, 0x8b, 0x2b,
+			0x48, 0x23, 0xe0, 0x20, 0x58, 0x22, 0xac, 0x69,
+			0xaa, 0x4a, 0xdf, 0x5b, 0x96, 0x65, 0xe1, 0xf2,
+			0x17, 0xcc, 0x24, 0x1b, 0xdd, 0xbc, 0x5d, 0x6f,
+			0xe9, 0x80, 0xf7, 0xbd, 0x22, 0xa1, 0x07, 0x73,
+			0x89, 0xc1, 0x9a, 0x35, 0x0f, 0x2d, 0x15, 0xc2,
+			0x07, 0xa2, 0xfc, 0x1c, 0x36, 0xe6, 0x17, 0xcd,
+			0xd7, 0x69, 0x17, 0xc4, 0xb1, 0x50, 0x80, 0x0f,
+			0x6d, 0x6d, 0x9b, 0x70, 0x06, 0x8b, 0x52, 0x8b,
+			0x64, 0x7f, 0xf8, 0x45, 0x86, 0x69, 0x05, 0x09,
+			0xc2, 0x3d, 0x26, 0x78, 0x0f, 0x35, 0x02, 0x34,
+			0xf6, 0xf9, 0xc8, 0xf5, 0x27, 0x74, 0x00, 0xb2,
+			0x08, 0xc8, 0x2c, 0xd1, 0x39, 0xe7, 0x68, 0xd2,
+			0xb9, 0xfb, 0xf6, 0x26, 0xe9, 0x48, 0x4c, 0x49,
+			0x19, 0x1c, 0x16, 0x89, 0x52, 0xdf, 0xc6, 0xda,
+			0xaf, 0x03, 0xd1, 0xbb, 0x1f, 0x77, 0x0d, 0x60,
+			0x48, 0xc6, 0x05, 0xfc, 0x2d, 0xab, 0xc2, 0xe2,
+			0xb2, 0x6a, 0xc7, 0x88, 0x25, 0xfe, 0x54, 0x85,
+			0x1d, 0xd2, 0x11, 0xcf, 0x22, 0xdd, 0x2c, 0xdd,
+			0x62, 0x7c, 0x75, 0x41, 0xbd, 0x68, 0xc3, 0xb5,
+			0x8a, 0x3c, 0x60, 0x60, 0xef, 0x8d, 0xe2, 0x63,
+			0x62, 0x85, 0x7c, 0x57, 0x1f, 0x46, 0x56, 0xbb,
+			0x51, 0x47, 0xfa, 0x59, 0x59, 0x46, 0x6b, 0x0e,
+			0xe2, 0xad, 0xc4, 0xc1, 0xdc, 0x51, 0xfb, 0x9a,
+			0x54, 0x43, 0xb5, 0xd0, 0xe5, 0x94, 0x41, 0xfe,
+			0x5c, 0x86, 0xb7, 0x6d, 0x54, 0x2f, 0x1f, 0xdb,
+			0x86, 0x3d, 0x4f, 0x14, 0x52, 0x80, 0x62, 0x39,
+			0x1e, 0x9e, 0x70, 0xa1, 0xdc, 0xde, 0xf0, 0xd4,
+			0xd9, 0x0e, 0x3f, 0x8b, 0x24, 0xc4, 0xe3, 0x44,
+			0x5f, 0xcb, 0x6a, 0x3d, 0x47, 0xaf, 0x26, 0x37,
+			0xb8, 0x8d, 0x96, 0x51, 0x88, 0x6b, 0xdf, 0x96,
+			0xd3, 0x74, 0x26, 0xc9, 0xe3, 0x65, 0x67, 0x94,
+			0x65, 0xaf, 0xcc, 0x47, 0xf0, 0xac, 0x38, 0x6e,
+			0x28, 0x2c, 0x55, 0xb6, 0x6c, 0x2f, 0xc5, 0x24,
+			0x3e, 0xe6, 0xe0, 0x4b, 0xee, 0xcc, 0xfb, 0x30,
+			0x2b, 0x22, 0xa9, 0xce, 0xe3, 0x08, 0x14, 0x22,
+			0x3f, 0xc4, 0xb0, 0x9c, 0x06, 0xd2, 0x6a, 0x94,
+			0x85, 0x8e, 0x62, 0x14, 0x93, 0xfa, 0x3b, 0xfd,
+			0xa3, 0x47, 0x17, 0x2d, 0x33, 0x96, 0x01, 0x53,
+			0x10, 0x3d, 0xa2, 0xa5, 0xb8, 0xfc, 0x9e, 0xed,
+			0x98, 0x0b, 0x75, 0x01, 0x47, 0xfd, 0x35, 0xf3,
+			0x57, 0x8f, 0xdb, 0x3b, 0x6a, 0x5b, 0xf5, 0x9b,
+			0xfb, 0x0f, 0x37, 0x72, 0x9d, 0xfa, 0x1e, 0x70,
+			0xdd, 0xd8, 0xc8, 0xbb, 0x24, 0xfd, 0xcd, 0x0f,
+			0x49, 0x0a, 0x3c, 0x02, 0x68, 0x62, 0xab, 0xd8,
+			0x14, 0x95, 0x56, 0xa0, 0xd3, 0xcb, 0x62, 0xdc,
+			0xef, 0xd9, 0x9f, 0x08, 0x11, 0xca, 0xdf, 0x47,
+			0xc6, 0xf7, 0x9a, 0xd5, 0x75, 0x60, 0x86, 0x49,
+			0x3a, 0x5d, 0xeb, 0xa2, 0xe0, 0x48, 0x94, 0x25,
+			0x0f, 0x9e, 0x41, 0x9c, 0x8e, 0x92, 0x82, 0x65,
+			0x6f, 0xd0, 0xa2, 0x73, 0x60, 0xa5, 0xea, 0x3c,
+			0x42, 0xa1, 0xb8, 0x6e, 0xe0, 0x10, 0x3b, 0x7b,
+			0xf3, 0x9e, 0xcd, 0x7b, 0xbc, 0xc2, 0x35, 0xb3,
+			0x16, 0xe5, 0xa6, 0x58, 0x21, 0x47, 0xcc, 0x1d,
+			0xf4, 0xfb, 0xfd, 0x09, 0x54, 0x28, 0x85, 0x92,
+			0x07, 0x84, 0xbe, 0x57, 0x29, 0x35, 0x28, 0x25,
+			0x29, 0xe3, 0x7c, 0x88, 0x5c, 0x01, 0xc0, 0xd3,
+			0x42, 0xa0, 0x3e, 0x1c, 0x92, 0x08, 0x57, 0x9d,
+			0xd8, 0xb7, 0x7f, 0x6c, 0xe4, 0x1f, 0x89, 0xb8,
+			0xe2, 0x28, 0xd2, 0xe9, 0x85, 0x3a, 0x34, 0xc8,
+			0x36, 0xda, 0x1e, 0xe5, 0xf3, 0x9c, 0xca, 0xc6,
+			0x81, 0xc8, 0x4e, 0xc0, 0x7a, 0xb9, 0x23, 0x1f,
+			0x1e, 0xda, 0xc3, 0x99, 0xa6, 0x44, 0x4e, 0x0a,
+			0x8c, 0x9a, 0x3a, 0xe2, 0x54, 0xb7, 0xef, 0x44,
+			0xc0, 0xb0, 0x3d, 0xdc, 0x48, 0x56, 0xe8, 0xfd,
+			0x37, 0x19, 0xa3, 0x3f, 0xd8, 0xe3, 0xcd, 0x35,
+			0xdb, 0x4e, 0xc7, 0x9b, 0xb3, 0xe9, 0x52, 0xeb,
+			0x2a, 0x59, 0xff, 0x6c, 0x6f, 0x36, 0x95, 0x92,
+			0xd3, 0x12, 0xc7, 0x96, 0x31, 0xea, 0x90, 0xa6,
+			0x96, 0xdb, 0x67, 0x45, 0x80, 0x9b, 0xd0, 0x72,
+			0xf6, 0x16, 0x2c, 0xf6, 0xd0, 0xf7, 0x1c, 0x57,
+			0x84, 0x24, 0x64, 0xa0, 0x65, 0x95, 0xa9, 0x45,
+			0x71, 0xd2, 0xc9, 0x5e, 0x1e, 0x35, 0xe8, 0x2c,
+			0x8c, 0xc9, 0x0c, 0x41, 0x20, 0x9a, 0x86, 0xf1,
+			0x27, 0xc5, 0xbe, 0x0f, 0xd4, 0x12, 0x6f, 0x53,
+			0x53, 0x24, 0xe3, 0x41, 0x51, 0xff, 0x40, 0x54,
+			0xe3, 0xd0, 0x5e, 0x08, 0xeb, 0x9e, 0x02, 0x31,
+			0x4c, 0xd2, 0x67, 0x17, 0x88, 0x18, 0xd5, 0xd0,
+			0x5e, 0xfe, 0x4b, 0xe3, 0xae, 0xe3, 0x8d, 0x9c,
+			0x60, 0xcb, 0x19, 0xea, 0xc2, 0xaf, 0xe6, 0x50,
+			0xd0, 0x54, 0x65, 0x59, 0x35, 0x93, 0x8d, 0x10,
+			0xc4, 0xfb, 0x08, 0xa8, 0x5b, 0xc3, 0xf5, 0xce,
+			0x7d, 0x82, 0x93, 0xee, 0xd2, 0x1c, 0x52, 0x66,
+			0xb1, 0x25, 0x64, 0x56, 0xfb, 0x6c, 0x16, 0x81,
+			0x98, 0x19, 0xa6, 0xfc, 0x72, 0x8d, 0xb4, 0x3e,
+			0x2f, 0x50, 0xd3, 0x6c, 0xd1, 0x87, 0x31, 0x12,
+			0xed, 0x07, 0xc5, 0x1d, 0x17, 0xf3, 0x27, 0x43,
+			0x92, 0x6e, 0x5d, 0x1b, 0x8c, 0xeb, 0xbf, 0xc7,
+			0x38, 0x11, 0xbd, 0x3e, 0x5a, 0x0d, 0x73, 0xe7,
+			0x18, 0x9f, 0x9b, 0x94, 0xe8, 0x33, 0x45, 0x24,
+			0x97, 0xfd, 0x15, 0x2d, 0x41, 0xda, 0x7b, 0xc4,
+			0xe0, 0x55, 0x24, 0x94, 0x7f, 0x40, 0x26, 0xa7,
+			0xbf, 0x8d, 0x25, 0x5a, 0x3a, 0x78, 0x9c, 0x0c,
+			0xd7, 0x31, 0x06, 0x1d, 0xe9, 0x20, 0xe5, 0xb0,
+			0x71, 0x0f, 0x4d, 0x12, 0x82, 0x6b, 0x49, 0x9f,
+			0x51, 0x3a, 0x7f, 0x47, 0x92, 0xaf, 0xaa, 0x3e,
+			0x0c, 0x8d, 0xb7, 0xf1, 0xdb, 0xd3, 0x6e, 0x6a,
+			0x56, 0x1d, 0x40, 0xfb, 0xe5, 0x44, 0xa4, 0x67,
+			0xfe, 0xc7, 0x67, 0xc7, 0x09, 0x33, 0x64, 0x4d,
+			0x3c, 0x82, 0xcc, 0x02, 0x68, 0x2b, 0x84, 0x70,
+			0x6a, 0xbc, 0x01, 0x01, 0x30, 0xb5, 0x06, 0xf7,
+			0x85, 0xf1, 0xe8, 0x33, 0x89, 0xfa, 0x40, 0xd2,
+			0x01, 0x7c, 0xa2, 0xd3, 0xa1, 0xc2, 0x32, 0xcb,
+			0x7a, 0x92, 0x12, 0x83, 0x91, 0x52, 0xa2, 0x28,
+			0x91, 0x5e, 0x7d, 0xff, 0xf8, 0x1f, 0x2d, 0x19,
+			0x08, 0x10, 0x6d, 0x7e, 0x15, 0x5a, 0x4d, 0x82,
+			0xdf, 0xa2, 0x1d, 0x19, 0x75, 0xb1, 0xe5, 0x99,
+			0xb9, 0x45, 0x7d, 0x5e, 0xf4, 0x7f, 0x88, 0x4d,
+			0x94, 0x36, 0x2b, 0x40, 0xe5, 0xad, 0xfa, 0x56,
+			0x80, 0xd2, 0x03, 0xff, 0xe9, 0xad, 0x4d, 0xac,
+			0x5f, 0x8e, 0xb4, 0x20, 0x61, 0x45, 0x3f, 0x39,
+			0xcc, 0x93, 0xe2, 0x4e, 0x71, 0x5a, 0xd0, 0x9d,
+			0x41, 0x25, 0x20, 0xb1, 0x40, 0x8c, 0xa9, 0xd7,
+			0x09, 0xf6, 0xb8, 0xcf, 0x47, 0xe2, 0x74, 0xed,
+			0x27, 0xb6, 0x55, 0x47, 0x84, 0xe6, 0x41, 0xcd,
+			0xf4, 0xa1, 0x6a, 0xe9, 0xca, 0xb1, 0xdd, 0xe1,
+			0xe2, 0xba, 0x06, 0x27, 0xaf, 0xae, 0xea, 0xca,
+			0x32, 0xe1, 0x3f, 0x15, 0x2a, 0xfd, 0x7c, 0xf4,
+			0x7f, 0x61, 0x04, 0xd0, 0xd1, 0x06, 0xac, 0x4e,
+			0x92, 0x3d, 0x92, 0x7f, 0x84, 0xce, 0x0a, 0x60,
+			0x5f, 0x42, 0xb5, 0xa3, 0xf7, 0x44, 0x31, 0x53,
+			0xd7, 0x5e, 0xec, 0x9f, 0x51, 0x97, 0x5b, 0xc9,
+			0x28, 0x0b, 0xc6, 0x60, 0xf4, 0x85, 0x17, 0x0f,
+			0x87, 0x71, 0x9c, 0xf3, 0x65, 0x98, 0x0a, 0xad,
+			0xff, 0x01, 0x8a, 0x69, 0xb1, 0x22, 0x50, 0x8d,
+			0xd1, 0xb8, 0xb0, 0xa0, 0x58, 0x70, 0xac, 0x60,
+			0xc1, 0x4b, 0x92, 0xc7, 0x3c, 0xff, 0x36, 0x39,
+			0xc8, 0x38, 0x40, 0xc3, 0xf3, 0xd0, 0xa2, 0x4e,
+			0xe2, 0xfa, 0x5f, 0x76, 0xcf, 0x15, 0x60, 0x6c,
+			0xad, 0xa9, 0xd8, 0x62, 0x4d, 0xf7, 0x15, 0x31,
+			0x35, 0xda, 0x6d, 0x74, 0xc0, 0xea, 0x40, 0x1e,
+			0xc9, 0x91, 0x31, 0x29, 0x2f, 0xaf, 0x67, 0x97,
+			0x95, 0xe7, 0xbe, 0xac, 0x85, 0xa5, 0xf5, 0xea,
+			0x87, 0x28, 0xff, 0xe9, 0x52, 0x30, 0x46, 0x5d,
+			0x1c, 0x2a, 0x18, 0xff, 0x51, 0x15, 0x5c, 0x26,
+			0x5e, 0x9e, 0xb4, 0xe9, 0x40, 0x25, 0x81, 0xd4,
+			0xa9, 0x4b, 0xd6, 0xaa, 0x7d, 0xc7, 0x19, 0x52,
+			0xe3, 0xf0, 0xa5, 0xd3, 0x67, 0xfe, 0x79, 0xac,
+			0xd0, 0x8e, 0xb2, 0x0a, 0x56, 0x3e, 0x20, 0x8c,
+			0x3c, 0x0c, 0xdc, 0x2d, 0xaf, 0x96, 0xb5, 0x1c,
+			0x83, 0xb3, 0xd9, 0x4b, 0x7c, 0x60, 0x68, 0x4c,
+			0xde, 0x3f, 0x71, 0x3a, 0x19, 0x57, 0x79, 0x4e,
+			0xa8, 0x7c, 0xfe, 0x6f, 0xf0, 0x1f, 0x92, 0x62,
+			0x9d, 0xf8, 0x13, 0xb4, 0x52, 0x43, 0x76, 0x57,
+			0xb7, 0xdb, 0x83, 0xb6, 0xce, 0x90, 0x12, 0x1d,
+			0x5a, 0xcf, 0xee, 0x9d, 0x24, 0xca, 0x24, 0xb5,
+			0x7d, 0xa1, 0xdb, 0x6d, 0x5c, 0xd0, 0x01, 0x6f,
+			0xcc, 0x85, 0x21, 0x96, 0x4e, 0x67, 0x4a, 0x96,
+			0xc7, 0xbd, 0x24, 0x3d, 0x96, 0x07, 0x61, 0x0d,
+			0xb9, 0x20, 0x4f, 0x43, 0x1e, 0x3f, 0xed, 0x45,
+			0x07, 0x7b, 0xdc, 0xc0, 0xb0, 0xf4, 0x4d, 0x38,
+			0x85, 0x58, 0x14, 0x83, 0x52, 0xcc, 0xd7, 0x3d,
+			0xa2, 0xe4, 0x48, 0xf5, 0x9c, 0x84, 0x18, 0x96,
+			0x87, 0x98, 0x43, 0x7a, 0x8b, 0xdb, 0xa6, 0xde,
+			0xde, 0xa7, 0x95, 0x1f, 0xb6, 0x28, 0x4c, 0x14,
+			0xe0, 0xec, 0xbf, 0xa6, 0xcb, 0x78, 0x01, 0xa7,
+			0x83, 0xbf, 0xa3, 0xb2, 0xac, 0x51, 0x98, 0x13,
+			0x46, 0x06, 0xbf, 0xee, 0x3b, 0xed, 0xde, 0x48,
+			0x24, 0xff, 0x56, 0x08, 0x81, 0x9e, 0x78, 0x52,
+			0x18, 0xf4, 0x3d, 0xd6, 0x83, 0x6f, 0x33, 0xe3,
+			0x34, 0xae, 0x3d, 0xde, 0x66, 0x5b, 0x85, 0xc7,
+			0x41, 0x06, 0x4a, 0xc9, 0x92, 0x7f, 0x5a, 0xe6,
+			0xdf, 0x85, 0x95, 0x45, 0x09, 0x35, 0x4a, 0x40,
+			0x51, 0x78, 0x20, 0xc3, 0x9c, 0x97, 0xde, 0x53,
+			0xec, 0x9e, 0xba, 0x86, 0x61, 0x6c, 0xbe, 0xf3,
+			0x64, 0x8a, 0x56, 0x33, 0x82, 0xd4, 0x4c, 0x2e,
+			0xe4, 0xb7, 0x38, 0xab, 0x4e, 0xc2, 0x34, 0x7f,
+			0x62, 0xec, 0x42, 0xd2, 0x1c, 0x39, 0x0e, 0xc2,
+			0x73, 0x0d, 0xa2, 0x9a, 0xb5, 0x1b, 0x03, 0xe6,
+			0x29, 0x96, 0x28, 0x11, 0xd7, 0x70, 0xc3, 0x14,
+			0x7e, 0x55, 0x54, 0x78, 0xa1, 0x4e, 0x83, 0xbc,
+			0x40, 0x2f, 0xac, 0xe1, 0x4d, 0x7e, 0x05, 0x26,
+			0xb2, 0xce, 0xa2, 0x74, 0x45, 0x63, 0xa6, 0x13,
+			0x93, 0xb8, 0x19, 0xf3, 0x66, 0xeb, 0x14, 0x9b,
+			0x86, 0xd4, 0x20, 0x4a, 0x49, 0x31, 0x61, 0xbe,
+			0x1d, 0x9c, 0xf0, 0x87, 0x87, 0x03, 0x06, 0x00,
+			0xaa, 0xba, 0x1f, 0x7b, 0xcf, 0x94, 0x71, 0x1c,
+			0xae, 0x24, 0x7f, 0xaf, 0x85, 0x46, 0xfb, 0xe6,
+			0x80, 0x18, 0x3c, 0x1b, 0x7b, 0x67, 0xed, 0x91,
+			0xd2, 0x4e, 0xfb, 0x1a, 0x79, 0xf8, 0x0a, 0x7c,
+			0xe2, 0x06, 0x21, 0x0e, 0x5a, 0xfb, 0x9d, 0xd1,
+			0x80, 0x08, 0xf1, 0xa7, 0x0c, 0x6b, 0xc6, 0xa6,
+			0xda, 0xf4, 0x9c, 0x36, 0x09, 0x5d, 0xe9, 0xc8,
+			0x6d, 0x98, 0x69, 0x1d, 0x9a, 0xb3, 0x16, 0x85,
+			0x7a, 0xb0, 0x3e, 0x52, 0x42, 0x15, 0x56, 0xbf,
+			0xb0, 0xc6, 0x45, 0x65, 0x65, 0x18, 0xb0, 0x16,
+			0x35, 0x66, 0xbd, 0xc7, 0x5d, 0x51, 0x98, 0x58,
+			0x53, 0xb9, 0x28, 0xd5, 0xa6, 0x3d, 0x3e, 0x82,
+			0x50, 0x68, 0x7a, 0x4f, 0x1b, 0xdd, 0xc1, 0xb8,
+			0xd1, 0x59, 0xbe, 0xf1, 0xb2, 0x19, 0x9b, 0x32,
+			0x4f, 0xed, 0x78, 0xc4, 0x86, 0xfb, 0x20, 0xae,
+			0xf4, 0x81, 0x4d, 0x10, 0x28, 0x7e, 0x74, 0xaf,
+			0x1e, 0xde, 0x00, 0x43, 0xe8, 0x21, 0xac, 0xe3,
+			0xcb, 0x92, 0x05, 0x6f, 0xf3, 0x26, 0xee, 0x13,
+			0xb7, 0x93, 0xad, 0x47, 0x1f, 0xec, 0x56, 0xb2,
+			0xca, 0xbf, 0x96, 0xc7, 0xcd, 0x45, 0xca, 0x57,
+			0xfc, 0x62, 0x91, 0x2b, 0x76, 0x68, 0xfa, 0x25,
+			0xd8, 0x87, 0x5d, 0x94, 0xae, 0x4a, 0xbb, 0x76,
+			0x9d, 0xfc, 0xf6, 0xfb, 0xad, 0xa5, 0x1d, 0xcc,
+			0xde, 0x21, 0x6f, 0x41, 0xca, 0xc5, 0x0d, 0xe5,
+			0x97, 0xaa, 0x88, 0x81, 0x4f, 0x2e, 0x85, 0xf0,
+			0x61, 0x21, 0x19, 0x84, 0x9e, 0x6b, 0xb7, 0x49,
+			0xfd, 0x7c, 0xe1, 0xc8, 0xeb, 0x46, 0x5e, 0x38,
+			0xfa, 0x22, 0xdf, 0x6e, 0xec, 0xec, 0x42, 0x80,
+			0xd7, 0x0a, 0xce, 0x5d, 0x23, 0xcd, 0x07, 0xb5,
+			0x06, 0x47, 0x17, 0x70, 0x26, 0x64, 0x97, 0xb8,
+			0xc5, 0x2a, 0x2b, 0x21, 0x96, 0xb0, 0xea, 0xb4,
+			0xe5, 0x55, 0x72, 0xcd, 0x63, 0xc1, 0x75, 0xe1,
+			0x9f, 0x61, 0x4c, 0xa3, 0x6d, 0xe7, 0x18, 0x1b,
+			0x29, 0x2c, 0x32, 0x3e, 0x2c, 0x76, 0x19, 0x1d,
+			0x0f, 0x9a, 0xf3, 0x97, 0x3d, 0xee, 0xd0, 0x1c,
+			0x33, 0xda, 0x67, 0x73, 0x74, 0x82, 0xd3, 0x4c,
+			0xa9, 0x72, 0x72, 0x23, 0xff, 0x52, 0xaf, 0xcf,
+			0x3d, 0x04, 0xd0, 0x25, 0x03, 0x95, 0xc5, 0xaf,
+			0x96, 0x17, 0x80, 0x21, 0x15, 0x37, 0x1d, 0x98,
+			0x3f, 0x24, 0x1f, 0xa3, 0x0b, 0xe4, 0x25, 0x94,
+			0x78, 0x26, 0x7b, 0x21, 0x4f, 0x0a, 0x77, 0x31,
+			0xef, 0x43, 0xde, 0x2f, 0x4f, 0x57, 0x41, 0x14,
+			0x49, 0xf7, 0xc3, 0xd2, 0xf5, 0x59, 0x69, 0x5f,
+			0xb3, 0xc1, 0xd6, 0x26, 0x22, 0xa8, 0x90, 0x45,
+			0x26, 0x6c, 0x88, 0x5b, 0x58, 0xe1, 0xdb, 0xf8,
+			0xf4, 0x95, 0x95, 0xcd, 0x8b, 0x30, 0xac, 0x02,
+			0x83, 0xb3, 0x31, 0xa2, 0x86, 0x00, 0xed, 0x8b,
+			0xde, 0x92, 0x5d, 0xd6, 0x8d, 0x0e, 0xc2, 0xa2,
+			0x8d, 0x93, 0x61, 0xf1, 0xd8, 0xac, 0x19, 0xd4,
+			0x62, 0x5e, 0x87, 0x11, 0x53, 0x60, 0x15, 0xe9,
+			0xfb, 0x5a, 0x9a, 0xcc, 0x14, 0x6f, 0xdf, 0x1a,
+			0x40, 0x39, 0xa7, 0x72, 0xea, 0x59, 0x95, 0x72,
+			0x2a, 0xea, 0xc8, 0x2e, 0x55, 0x35, 0xca, 0xf5,
+			0x6b, 0x9f, 0x53, 0xb5, 0x6d, 0xa3, 0x5b, 0xc9,
+			0x9e, 0x8c, 0x38, 0x98, 0xef, 0xb0, 0x7b, 0xe7,
+			0x94, 0x72, 0x21, 0x39, 0xe0, 0x73, 0x80, 0x0f,
+			0x44, 0x80, 0x71, 0x7b, 0xf5, 0x75, 0x61, 0xab,
+			0x2f, 0xe6, 0x65, 0x47, 0xe7, 0x30, 0xf5, 0x04,
+			0x02, 0x81, 0x24, 0x4c, 0xdd, 0xea, 0x57, 0x71,
+			0xca, 0x71, 0x36, 0x7c, 0x78, 0x6c, 0xb0, 0x40,
+			0x2f, 0x84, 0x51, 0x0a, 0x6f, 0x54, 0xcf, 0xdc,
+			0x98, 0xfc, 0x85, 0xf5, 0xb7, 0x00, 0x0e, 0x9c,
+			0x53, 0x2b, 0x57, 0x73, 0x32, 0xbe, 0x95, 0x50,
+			0x4b, 0x01, 0xf3, 0xde, 0xc3, 0x78, 0xf0, 0x8e,
+			0x6e, 0x69, 0xe4, 0x00, 0x71, 0xbd, 0x3d, 0x7d,
+			0x22, 0x1e, 0x55, 0xf9, 0x20, 0x0c, 0xfe, 0x38,
+			0x14, 0x5f, 0x33, 0x6c, 0x98, 0x55, 0x08, 0x6d,
+			0x92, 0x4b, 0x01, 0xed, 0x23, 0x5c, 0x80, 0xea,
+			0xc3, 0xb1, 0xde, 0x26, 0x8a, 0xb5, 0xe5, 0x33,
+			0xef, 0x03, 0x8d, 0xd9, 0x94, 0x92, 0x01, 0x1e,
+			0x35, 0xdf, 0xb7, 0xf2, 0x9e, 0x7e, 0xa3, 0x66,
+			0x77, 0x33, 0x92, 0x3a, 0x7d, 0x36, 0x0a, 0xb1,
+			0x7b, 0x49, 0x38, 0x0d, 0x68, 0x36, 0x1d, 0x2e,
+			0xa3, 0xf6, 0xb2, 0x29, 0x91, 0x64, 0xbe, 0x05,
+			0xe0, 0x56, 0xd7, 0x9c, 0xaf, 0xf4, 0xf4, 0xdc,
+			0x54, 0x78, 0xb1, 0xca, 0x8c, 0x69, 0x59, 0xac,
+			0x6f, 0xae, 0x1e, 0x03, 0x78, 0xc0, 0x42, 0x66,
+			0x16, 0x4a, 0xd7, 0x09, 0x2e, 0x81, 0x85, 0xc4,
+			0x10, 0xd5, 0x1b, 0x9a, 0x4d, 0x21, 0xb2, 0xbe,
+			0x8c, 0xad, 0xb5, 0x9e, 0xbf, 0x80, 0x2c, 0x52,
+			0x50, 0x07, 0xf7, 0xa1, 0x7c, 0xf2, 0x26, 0xbb,
+			0x14, 0xd0, 0x49, 0x7b, 0x49, 0xda, 0x9c, 0xe0,
+			0x84, 0x06, 0x53, 0xd9, 0x0c, 0x30, 0xa5, 0xfc,
+			0x71, 0x7e, 0x4a, 0x0d, 0xa4, 0x67, 0x19, 0x19,
+			0x57, 0xd5, 0xa1, 0xf7, 0x0f, 0x0f, 0x43, 0xbf,
+			0x87, 0xe7, 0xb3, 0xb8, 0x16, 0x59, 0x50, 0x28,
+			0xec, 0xc1, 0xf3, 0x0e, 0xef, 0x28, 0xd4, 0x89,
+			0x5e, 0x99, 0xae, 0xcb, 0xc9, 0xf4, 0x58, 0xa0,
+			0x8b, 0x83, 0xb7, 0x85, 0x0b, 0xc8, 0xca, 0x15,
+			0x51, 0xff, 0xc0, 0x9d, 0xd8, 0xea, 0xfa, 0x0e,
+			0x60, 0xcf, 0x66, 0xbe, 0x87, 0x22, 0x74, 0x6b,
+			0xd5, 0x64, 0x3b, 0x27, 0x51, 0x02, 0x5f, 0xa6,
+			0x27, 0x11, 0xb1, 0xe7, 0x23, 0x03, 0x41, 0x24,
+			0x81, 0x26, 0xbd, 0x27, 0x20, 0x4f, 0x33, 0xf2,
+			0x06, 0x2c, 0x7a, 0xd7, 0xb4, 0x8e, 0xa3, 0x34,
+			0x5f, 0x67, 0xe8, 0x83, 0xd6, 0x0b, 0x66, 0xbe,
+			0x4f, 0xc0, 0xbc, 0xb2, 0xc5, 0xe2, 0x04, 0xb1,
+			0xf6, 0x93, 0x09, 0x4f, 0x1f, 0xac, 0x96, 0xa9,
+			0xcf, 0x9f, 0xa0, 0xcf, 0x84, 0x01, 0xb7, 0x0b,
+			0xd6, 0xd8, 0xbf, 0xf8, 0x80, 0x0a, 0x0f, 0xfc,
+			0x5d, 0x2d, 0x7a, 0xd7, 0x38, 0x42, 0x02, 0x08,
+			0x1b, 0xef, 0x50, 0x75, 0xde, 0x4d, 0x16, 0xe4,
+			0x07, 0xbc, 0x71, 0xc0, 0xba, 0x07, 0xe6, 0xdb,
+			0x98, 0xec, 0x4b, 0x1d, 0xaa, 0x6f, 0x49, 0xc6,
+			0xcc, 0x1b, 0x26, 0xa5, 0xea, 0x4a, 0x3f, 0x1b,
+			0xf5, 0xe5, 0xf3, 0xf4, 0xf8, 0x27, 0xde, 0xc4,
+			0xea, 0x68, 0x70, 0x30, 0x31, 0xf3, 0x41, 0x96,
+			0x08, 0x85, 0xd5, 0xa7, 0x0b, 0xa3, 0x14, 0x8d,
+			0x2d, 0x50, 0x05, 0x02, 0x6b, 0xfe, 0x75, 0x5e,
+			0xa5, 0x8d, 0xa6, 0x97, 0xe7, 0x09, 0x6d, 0xc1,
+			0xf2, 0x1a, 0x17, 0x96, 0xe1, 0x77, 0x35, 0x6c,
+			0x58, 0xd3, 0xcb, 0xe4, 0x9d, 0x4a, 0xc3, 0x7e,
+			0x49, 0xce, 0x24, 0x66, 0x63, 0xbb, 0xae, 0x8b,
+			0xcb, 0x76, 0x6f, 0x19, 0x2e, 0xe0, 0x8c, 0xd0,
+			0x88, 0x95, 0x3b, 0xde, 0xf3, 0xc2, 0x19, 0x23,
+			0xb3, 0xb0, 0xe6, 0xb3, 0x9c, 0xe1, 0xf1, 0x47,
+			0x39, 0x69, 0xb8, 0xf9, 0x73, 0x90, 0x18, 0xe8,
+			0xce, 0x4c, 0x1c, 0xcf, 0x1a, 0xbb, 0x0c, 0x7b,
+			0xbe, 0xe1, 0x07, 0xdc, 0x73, 0x49, 0x9a, 0x11,
+			0x61, 0x59, 0x5d, 0x37, 0x96, 0xae, 0x2e, 0x0d,
+			0x67, 0x63, 0x7f, 0x39, 0x42, 0x3a, 0x45, 0x12,
+			0xed, 0x4c, 0x1c, 0xd6, 0xe8, 0x3a, 0x25, 0x6f,
+			0xb6, 0xd2, 0x76, 0x00, 0x82, 0x12, 0x27, 0xb7,
+			0x7c, 0x05, 0xcb, 0xf3, 0x8a, 0x78, 0x99, 0xc6,
+			0xcd, 0xb2, 0xde, 0x71, 0x7b, 0x21, 0xfb, 0xde,
+			0xcc, 0x52, 0x40, 0x09, 0xfa, 0x40, 0x9d, 0x11,
+			0x91, 0xc3, 0xb7, 0x80, 0xab, 0x8c, 0x53, 0x67,
+			0xd0, 0x5c, 0x46, 0xb7, 0xb2, 0xef, 0x65, 0x51,
+			0x00, 0x66, 0x5f, 0xf0, 0x8c, 0x56, 0x18, 0x06,
+			0x41, 0xe4, 0x78, 0x27, 0x42, 0xfe, 0x4f, 0x3e,
+			0x56, 0x3d, 0xaa, 0x2b, 0x5a, 0x8f, 0x9a, 0xd8,
+			0xc0, 0xe9, 0xd8, 0xcb, 0xe8, 0x1d, 0x80, 0xaf,
+			0xf5, 0x49, 0x64, 0x71, 0x5e, 0x9f, 0x2a, 0x2b,
+			0xc6, 0x50, 0x1c, 0xaf, 0x72, 0x65, 0x2d, 0xe6,
+			0x59, 0x5d, 0xc6, 0x08, 0x7f, 0x83, 0xfa, 0x83,
+			0xfc, 0x65, 0xef, 0xdc, 0xac, 0xb0, 0xa2, 0x82,
+			0xdc, 0xaf, 0x76, 0xcf, 0x2a, 0x7a, 0x47, 0xed,
+			0x7e, 0x1d, 0x43, 0x6d, 0xc0, 0x34, 0x47, 0xbf,
+			0x92, 0x3f, 0xb8, 0xcf, 0xff, 0xae, 0xd6, 0x4e,
+			0x2e, 0x6b, 0x61, 0x3f, 0xcb, 0xcf, 0x1c, 0xe2,
+			0x69, 0xdf, 0x0d, 0x54, 0xbd, 0xa2, 0xe5, 0x72,
+			0xe3, 0xb6, 0x42, 0xa9, 0xc1, 0x6c, 0x57, 0x55,
+			0x90, 0x73, 0x24, 0x68, 0x06, 0x94, 0x48, 0x14,
+			0x00, 0xa3, 0xb8, 0xb5, 0xf5, 0xa3, 0x66, 0x5c,
+			0x1a, 0x90, 0xd8, 0x13, 0x21, 0x19, 0x59, 0x3d,
+			0x72, 0xc7, 0xd7, 0x67, 0x77, 0x53, 0x83, 0x4f,
+			0x24, 0x5f, 0xe8, 0xed, 0xb6, 0x05, 0xdd, 0x6f,
+			0x64, 0x22, 0x62, 0xdc, 0x7d, 0x9a, 0xdf, 0x6b,
+			0xf2, 0xce, 0xf1, 0x09, 0x56, 0x66, 0x36, 0x44,
+			0xff, 0xd8, 0xc7, 0x87, 0x46, 0x7e, 0x67, 0x6a,
+			0x21, 0x4e, 0x74, 0x53, 0x7e, 0xc7, 0xb4, 0xe0,
+			0xd6, 0x74, 0x2d, 0x3a, 0xd9, 0x60, 0x87, 0x21,
+			0x47, 0xb4, 0x54, 0xa2, 0xc1, 0x21, 0xd6, 0x51,
+			0x3e, 0x7a, 0x89, 0xd8, 0x22, 0x5c, 0x23, 0x21,
+			0x4d, 0xfd, 0xac, 0xff, 0x66, 0x9e, 0xfb, 0x43,
+			0xbf, 0x13, 0x5c, 0x45, 0x5e, 0xac, 0xb4, 0xa6,
+			0xda, 0xe6, 0x46, 0x03, 0xb1, 0x87, 0x33, 0x29,
+			0x19, 0x32, 0x50, 0x18, 0xd3, 0x57, 0x5a, 0xc1,
+			0xaa, 0x19, 0xe5, 0x40, 0x8e, 0x7d, 0x2a, 0xa7,
+			0xa1, 0x39, 0xdb, 0x87, 0xda, 0x82, 0x41, 0x14,
+			0xa2, 0xb1, 0x72, 0x6e, 0xfe, 0x71, 0xea, 0x80,
+			0xb2, 0xf3, 0xe8, 0x21, 0x27, 0xc1, 0x2a, 0xc9,
+			0x25, 0x73, 0x79, 0x52, 0x3f, 0x57, 0xbb, 0xf0,
+			0xb2, 0x05, 0xda, 0xcb, 0x41, 0xc2, 0x97, 0x6d,
+			0xc5, 0xca, 0xe3, 0xd4, 0x74, 0xab, 0x1f, 0xb0,
+			0x4f, 0xb8, 0x40, 0x93, 0x12, 0x12, 0x52, 0x48,
+			0xa5, 0x76, 0xed, 0x05, 0xdd, 0x22, 0xf7, 0x23,
+			0xf5, 0x79, 0x1e, 0x32, 0x69, 0x85, 0x74, 0x3a,
+			0x0e, 0x62, 0xf2, 0x13, 0x30, 0x7c, 0xcd, 0xf5,
+			0x46, 0xa2, 0xcd, 0x0f, 0x48, 0x2c, 0x32, 0xf7,
+			0xb6, 0x6a, 0xad, 0x89, 0x7a, 0x87, 0xb4, 0x74,
+			0x2d, 0xa6, 0x3b, 0xcc, 0xf9, 0xda, 0xf0, 0xf3,
+			0x21, 0xaf, 0xda, 0x99, 0xa2, 0x07, 0xa9, 0xec,
+			0x37, 0x7a, 0x51, 0x75, 0x8f, 0x98, 0x9f, 0x91,
+			0x08, 0x4b, 0xfb, 0x32, 0xe6, 0x45, 0xfa, 0xc5,
+			0x7b, 0xf1, 0x5f, 0xd5, 0x44, 0x5b, 0x35, 0x85,
+			0x16, 0x52, 0x52, 0xde, 0x77, 0x06, 0xe6, 0xd3,
+			0x60, 0x4e, 0x98, 0x2e, 0xc6, 0xd0, 0x0f, 0xbd,
+			0xa5, 0x01, 0xa0, 0x9c, 0x8f, 0x34, 0x9b, 0x37,
+			0x0b, 0xaa, 0x2b, 0x46, 0x0d, 0xf0, 0xd9, 0xca,
+			0x51, 0xe0, 0x1d, 0xe9, 0x4e, 0x07, 0xed, 0x31,
+			0xe5, 0xc0, 0x17, 0x82, 0xca, 0xd3, 0x5c, 0x10,
+			0xf3, 0xf5, 0xf8, 0xc4, 0xca, 0x84, 0x1f, 0x84,
+			0x73, 0x84, 0x78, 0x02, 0x61, 0xae, 0xf9, 0xd4,
+			0x15, 0x1a, 0x42, 0xe7, 0x93, 0x8f, 0xc8, 0x07,
+			0x79, 0xb3, 0x17, 0xb9, 0xb8, 0xc4, 0x9d, 0x2b,
+			0xb4, 0xa2, 0x5d, 0x7c, 0x28, 0x76, 0xa6, 0x64,
+			0xbb, 0xf8, 0xab, 0xb2, 0xca, 0x58, 0xe3, 0xf0,
+			0xf3, 0xa2, 0x48, 0x78, 0xf9, 0x7e, 0xcc, 0x74,
+			0xc1, 0xfd, 0x09, 0x3a, 0xa0, 0x60, 0xbc, 0x9f,
+			0x05, 0x00, 0x8d, 0xbc, 0xe3, 0xfa, 0xa5, 0x38,
+			0xd3, 0xba, 0xf5, 0x95, 0x59, 0x64, 0x3b, 0x87,
+			0x83, 0x5a, 0x53, 0x82, 0xee, 0x6c, 0xbf, 0xcf,
+			0x7c, 0x2c, 0x73, 0x3b, 0x37, 0x7c, 0x50, 0xd6,
+			0x56, 0x19, 0xfe, 0x60, 0xda, 0x5b, 0x2e, 0x4c,
+			0x94, 0x9e, 0xee, 0x44, 0x25, 0xa7, 0x8f, 0xb3,
+			0xad, 0x95, 0x7f, 0x65, 0xbe, 0xcb, 0xce, 0x32,
+			0x80, 0x61, 0x01, 0xc7, 0xf9, 0xc2, 0x95, 0x38,
+			0x5f, 0x9b, 0x99, 0xaa, 0xad, 0xfc, 0xb3, 0x9d,
+			0x2b, 0xe9, 0xd1, 0x96, 0xd8, 0xae, 0x9d, 0x80,
+			0x48, 0xcb, 0xc2, 0x1e, 0xaf, 0x46, 0x6f, 0x5e,
+			0x2e, 0xb8, 0x8f, 0x84, 0x01, 0xc8, 0x9a, 0x68,
+			0x4f, 0xbe, 0x9d, 0x1e, 0x21, 0x98, 0xaa, 0x77,
+			0x8a, 0x8a, 0x3f, 0x10, 0x89, 0xa2, 0x19, 0x50,
+			0x41, 0x4e, 0x64, 0x5c, 0x7b, 0x0f, 0x64, 0x30,
+			0xa2, 0xb1, 0xac, 0xe3, 0x75, 0xf8, 0x4d, 0xbe,
+			0x09, 0xb7, 0x1f, 0x40, 0x77, 0xd2, 0xeb, 0x31,
+			0xfb, 0xc2, 0x62, 0xf0, 0xa6, 0x9d, 0xad, 0xd2,
+			0xd4, 0xbb, 0x49, 0x1c, 0x84, 0x53, 0x0d, 0x6f,
+			0xe9, 0x8c, 0x86, 0x99, 0xbc, 0xf2, 0x64, 0x32,
+			0x46, 0x15, 0xf6, 0x73, 0x22, 0x99, 0xc5, 0x5a,
+			0x48, 0xb1, 0xdc, 0xdd, 0xc4, 0xc8, 0xff, 0xf0,
+			0xd5, 0x6e, 0x8c, 0x9a, 0x18, 0x7a, 0x32, 0x1c,
+			0xd0, 0xce, 0x4f, 0x57, 0x19, 0xb0, 0xcf, 0x43,
+			0xcd, 0x08, 0xf3, 0x69, 0x5b, 0x77, 0x39, 0x15,
+			0xfd, 0x66, 0x50, 0x52, 0xc0, 0xde, 0x1c, 0xb1,
+			0xfd, 0xaf, 0x81, 0x90, 0x6d, 0xb3, 0x5b, 0x01,
+			0x6e, 0xd5, 0xdc, 0x4e, 0x46, 0x2b, 0x25, 0xc5,
+			0x6a, 0x44, 0x14, 0xaa, 0x04, 0x2f, 0xaa, 0xd4,
+			0x26, 0x59, 0x7c, 0xc5, 0x7f, 0x9a, 0x99, 0x09,
+			0xb9, 0x93, 0x55, 0xed, 0xd8, 0x29, 0x37, 0xf0,
+			0xfc, 0x8e, 0xc2, 0xbf, 0xdb, 0xb8, 0xea, 0xdc,
+			0xdc, 0x97, 0x72, 0x07, 0x37, 0x60, 0x5d, 0x1d,
+			0xc4, 0x35, 0x33, 0xcf, 0x2a, 0xad, 0x5d, 0x0a,
+			0x0b, 0x82, 0xa6, 0xab, 0xc3, 0x86, 0xdd, 0x3d,
+			0xf6, 0xed, 0xd3, 0xd3, 0x2d, 0x8e, 0x46, 0xee,
+			0xd5, 0xe6, 0xe0, 0x3a, 0x82, 0x15, 0x0a, 0xad,
+			0xea, 0xe0, 0x22, 0xec, 0x33, 0x2c, 0xc3, 0x94,
+			0xdd, 0xbf, 0x25, 0x97, 0xa2, 0xbd, 0x2c, 0x15,
+			0xb9, 0x29, 0x33, 0x9c, 0xbd, 0x4d, 0x32, 0x4d,
+			0x9a, 0xf9, 0x65, 0x4a, 0xd9, 0x10, 0x2f, 0xd9,
+			0xf9, 0x24, 0xd2, 0x81, 0x72, 0xe2, 0x25, 0x1c,
+			0xe6, 0xae, 0xbd, 0xce, 0x17, 0xf8, 0x7c, 0xda,
+			0x02, 0xf0, 0x33, 0x1c, 0x77, 0x1f, 0x55, 0x30,
+			0x4c, 0x00, 0x57, 0x44, 0xe0, 0xd1, 0x07, 0xd3,
+			0x01, 0xd1, 0x04, 0x71, 0xf8, 0x36, 0x67, 0x0e,
+			0x83, 0x83, 0x25, 0x19, 0xab, 0xa9, 0xdb, 0x40,
+			0x23, 0xa9, 0xa2, 0x74, 0x3e, 0x71, 0x29, 0x07,
+			0x23, 0xd5, 0x59, 0xf1, 0x55, 0x19, 0xb9, 0x76,
+			0xaf, 0x0c, 0xad, 0xe7, 0xcf, 0xfd, 0x2a, 0x36,
+			0x74, 0xc7, 0xf7, 0xff, 0xc7, 0x3d, 0x64, 0xbc,
+			0xa2, 0x88, 0x33, 0x6b, 0x3b, 0x2c, 0xfe, 0x51,
+			0xda, 0xb1, 0x48, 0x83, 0x9d, 0x26, 0x69, 0x85,
+			0xd3, 0x24, 0x04, 0x87, 0x74, 0xa6, 0xf7, 0xaa,
+			0xb5, 0xd6, 0x3e, 0xae, 0x01, 0xa9, 0x05, 0xdb,
+			0xd0, 0x90, 0xaa, 0xaa, 0x87, 0x1b, 0x03, 0x66,
+			0x3e, 0x3a, 0x8d, 0xc1, 0xe5, 0x6e, 0x1c, 0x3d,
+			0x92, 0x8a, 0x47, 0xbd, 0x29, 0x26, 0x4b, 0x68,
+			0x38, 0x5f, 0x5a, 0xf8, 0xbb, 0x78, 0x52, 0x14,
+			0x93, 0xd8, 0x0a, 0x66, 0x4e, 0xe9, 0x11, 0xfb,
+			0x0e, 0xb2, 0x73, 0x43, 0x75, 0xa9, 0x20, 0x33,
+			0x02, 0x3b, 0xd5, 0xcc, 0x65, 0x1d, 0xac, 0xcb,
+			0xd1, 0x00, 0xf5, 0xa6, 0x13, 0x1b, 0x2b, 0x58,
+			0x34, 0x6f, 0x0b, 0x15, 0xf1, 0x47, 0x24, 0x49,
+			0xca, 0xac, 0xda, 0x3b, 0xc3, 0x83, 0xb1, 0x00,
+			0xcd, 0x19, 0x4d, 0xdb, 0x8b, 0x5b, 0x93, 0x72,
+			0xd2, 0x20, 0x55, 0xf2, 0x1b, 0x89, 0xd1, 0x82,
+			0xc5, 0xb4, 0xb3, 0x7c, 0x8f, 0x08, 0x55, 0x24,
+			0xac, 0xe8, 0x8e, 0x52, 0xa0, 0x08, 0x9d, 0x70,
+			0x84, 0x94, 0xcf, 0x6d, 0x5d, 0x6e, 0x04, 0xe9,
+			0x3e, 0x69, 0xed, 0x9b, 0x1a, 0x66, 0x3d, 0x63,
+			0x12, 0x21, 0x11, 0xba, 0x21, 0xe6, 0xc5, 0x58,
+			0x34, 0xba, 0x93, 0x50, 0x58, 0xfa, 0xbd, 0x97,
+			0x8d, 0x70, 0x3b, 0x18, 0x7a, 0xf1, 0x1c, 0xa4,
+			0x7a, 0xe1, 0xd7, 0xc9, 0x64, 0x5f, 0x04, 0x59,
+			0xc9, 0xd2, 0xac, 0xd8, 0x4e, 0x57, 0x9d, 0x1a,
+			0x0c, 0x1b, 0x56, 0x61, 0xc4, 0xec, 0x55, 0x4c,
+			0x06, 0x94, 0xe0, 0xf0, 0x96, 0x85, 0x5a, 0x2a,
+			0xbb, 0x6a, 0x5c, 0xf1, 0xde, 0x32, 0x72, 0xd4,
+			0x72, 0xa3, 0x89, 0x7d, 0x83, 0x21, 0xa6, 0xc4,
+			0x59, 0x9a, 0x09, 0xbb, 0x9e, 0xa0, 0x09, 0x51,
+			0x7d, 0x4c, 0xc4, 0x3a, 0x51, 0x84, 0x80, 0x7e,
+			0x92, 0x5c, 0xf3, 0x47, 0xbb, 0x3c, 0x3f, 0xeb,
+			0x36, 0x60, 0xa7, 0xcf, 0x98, 0xfc, 0x51, 0xca,
+			0x49, 0x88, 0x8b, 0x14, 0xd8, 0x33, 0xf8, 0xca,
+			0x1a, 0x78, 0x78, 0x9b, 0x6c, 0xad, 0x7d, 0x54,
+			0x94, 0x39, 0x58, 0x49, 0xbd, 0x78, 0x0c, 0xe0,
+			0x64, 0xf9, 0x5f, 0xc3, 0x4b, 0x46, 0x66, 0xc9,
+			0x65, 0xc1, 0x9b, 0xc2, 0xb4, 0xbd, 0x82, 0x6c,
+			0x58, 0xce, 0x6e, 0x40, 0xff, 0x54, 0x07, 0x7e,
+			0x6b, 0x3b, 0x74, 0xa3, 0x0a, 0xd7, 0x9d, 0xa5,
+			0x48, 0x02, 0xe0, 0x85, 0x3a, 0x81, 0x78, 0xca,
+			0xfe, 0x0d, 0x5c, 0x40, 0x3c, 0xa1, 0x4b, 0x06,
+			0x43, 0x03, 0x17, 0x88, 0x63, 0x59, 0x66, 0xe6,
+			0x88, 0x90, 0xa8, 0x88, 0xf8, 0xe8, 0x12, 0xfe,
+			0x05, 0x4a, 0xf8, 0x94, 0xb9, 0xd5, 0x8a, 0xc5,
+			0xb0, 0xa4, 0x4f, 0x57, 0x8d, 0x1d, 0xca, 0x8b,
+			0xfd, 0xee, 0xc2, 0x6a, 0xec, 0x33, 0xcb, 0x5c,
+			0xdc, 0x77, 0x2d, 0x84, 0xf3, 0xcf, 0xf0, 0x25,
+			0xd0, 0x8c, 0x7d, 0x62, 0x5e, 0x8e, 0xf7, 0x0e,
+			0x58, 0x68, 0x77, 0xbe, 0xaf, 0x5e, 0xc5, 0x29,
+			0x65, 0xb3, 0xd9, 0xa0, 0x91, 0x2e, 0x59, 0x0b,
+			0x0c, 0x5a, 0x6b, 0x4d, 0x46, 0xbc, 0x8f, 0x85,
+			0xb5, 0x46, 0xe6, 0x37, 0xf9, 0x9e, 0x05, 0x2c,
+			0xf3, 0xaf, 0x86, 0x3d, 0x8d, 0x1b, 0xf1, 0xe8,
+			0xc3, 0xd4, 0x0c, 0x8a, 0x83, 0x82, 0x27, 0xf7,
+			0xd2, 0x64, 0x9d, 0x04, 0xb7, 0x0f, 0x6d, 0xd2,
+			0x12, 0xbf, 0x1b, 0xcc, 0x7d, 0xe4, 0x6c, 0x94,
+			0x16, 0xab, 0x8e, 0xed, 0xf3, 0xc5, 0x8b, 0x5f,
+			0x88, 0x13, 0x90, 0x65, 0x73, 0x78, 0x47, 0x6b,
+			0x0c, 0xbc, 0xda, 0x4d, 0x32, 0x91, 0xdf, 0xbf,
+			0x6e, 0x32, 0x46, 0x66, 0xbc, 0xcd, 0x1c, 0xd1,
+			0x59, 0x7b, 0x63, 0xb9, 0x3d, 0x07, 0xec, 0xe3,
+			0xa8, 0xca, 0xfc, 0x07, 0x53, 0x81, 0x1d, 0x3d,
+			0x56, 0x77, 0x27, 0xa4, 0x66, 0x5a, 0x00, 0x83,
+			0x15, 0xce, 0x02, 0xf0, 0x78, 0x40, 0x7f, 0x98,
+			0x73, 0x64, 0xc6, 0x0d, 0x5a, 0xef, 0xb5, 0x66,
+			0x35, 0x95, 0x60, 0x9d, 0x9b, 0x6a, 0xbd, 0xba,
+			0x7e, 0x7b, 0xd3, 0xe7, 0x84, 0xf4, 0x99, 0xcb,
+			0x0d, 0xdd, 0xf3, 0xa9, 0xd5, 0x81, 0xe0, 0xa4,
+			0x1b, 0x04, 0x18, 0x4b, 0xf5, 0x44, 0x32, 0x44,
+			0x35, 0x4b, 0x46, 0x3b, 0x8b, 0xd8, 0x87, 0xd3,
+			0x20, 0xbc, 0x11, 0xd6, 0x6d, 0xb0, 0x71, 0x8d,
+			0xf1, 0x29, 0x09, 0xcc, 0xd0, 0xdd, 0xb8, 0x3a,
+			0x5a, 0x95, 0x8c, 0xe6, 0xfa, 0x8e, 0xf5, 0x3e,
+			0xa8, 0xa3, 0x3a, 0xe4, 0xc1, 0xa7, 0x97, 0xe1,
+			0x2e, 0x68, 0xf1, 0x1d, 0x93, 0x6d, 0x55, 0x41,
+			0x14, 0x90, 0xd0, 0xc0, 0x1f, 0x88, 0x61, 0x06,
+			0xff, 0xa9, 0x00, 0xe5, 0xe3, 0xfe, 0xa0, 0xa1,
+			0xe6, 0xa1, 0x23, 0xe8, 0x2c, 0xe9, 0x7b, 0x94,
+			0xbc, 0x49, 0x3d, 0xe2, 0x65, 0xcc, 0xe9, 0x87,
+			0xb5, 0x78, 0xa9, 0x57, 0x9a, 0x91, 0xce, 0x42,
+			0xb2, 0xe1, 0xea, 0xb5, 0x38, 0x60, 0x41, 0x07,
+			0x7b, 0xc6, 0x0b, 0xbc, 0x74, 0x27, 0xf7, 0x7b,
+			0xd4, 0xae, 0x95, 0x0c, 0x5a, 0xc1, 0xd0, 0x53,
+			0x87, 0x97, 0xa6, 0xf0, 0x89, 0x8d, 0x2d, 0xba,
+			0x3d, 0x79, 0x17, 0x3e, 0x7a, 0xb1, 0xa7, 0x28,
+			0x87, 0x48, 0xf2, 0x8e, 0x29, 0xe8, 0xa3, 0xf7,
+			0xcd, 0x21, 0x5f, 0x2d, 0x30, 0xef, 0x6a, 0x68,
+			0x5e, 0x48, 0x64, 0x6a, 0xf4, 0xbb, 0xb7, 0xae,
+			0x48, 0x58, 0xdd, 0x5d, 0x3e, 0xdf, 0x47, 0x30,
+			0x0a, 0x5b, 0x36, 0xba, 0xba, 0xf6, 0xf5, 0x0c,
+			0x3f, 0x97, 0xfc, 0x1d, 0x02, 0x05, 0x4b, 0x6d,
+			0x07, 0x94, 0x9e, 0x02, 0x5c, 0x50, 0x81, 0xc4,
+			0xf0, 0xb6, 0xe7, 0x49, 0xfe, 0x00, 0x92, 0x26,
+			0x5e, 0xf2, 0x7b, 0x31, 0xca, 0xd6, 0x95, 0x5a,
+			0x53, 0x8a, 0xfd, 0xb6, 0x04, 0x92, 0x28, 0xe8,
+			0x8a, 0x8e, 0xe8, 0x54, 0x0d, 0x5a, 0x09, 0x8f,
+			0x3b, 0x39, 0xd4, 0xdc, 0x3b, 0x04, 0xc3, 0xc1,
+			0x1d, 0x44, 0x89, 0xe1, 0xdf, 0xba, 0xa8, 0xb2,
+			0x92, 0x26, 0x47, 0x87, 0x01, 0x96, 0x9e, 0xcf,
+			0xab, 0x7a, 0x69, 0xe1, 0xab, 0xfe, 0x62, 0xd5,
+			0x91, 0x24, 0x89, 0x50, 0x7a, 0xee, 0x00, 0x48,
+			0xf8, 0xe3, 0x3f, 0x04, 0x9e, 0x12, 0x25, 0x8a,
+			0xea, 0x6a, 0x07, 0xac, 0x59, 0xde, 0x42, 0xd5,
+			0xb9, 0xdc, 0x5b, 0xa9, 0x79, 0x1f, 0xeb, 0x6d,
+			0x69, 0x87, 0xad, 0x70, 0x3c, 0x96, 0xcf, 0x8f,
+			0x7d, 0x81, 0x19, 0xaf, 0xbf, 0x27, 0x55, 0xbb,
+			0x4c, 0x42, 0x92, 0xd4, 0xda, 0xbe, 0x22, 0x95,
+			0xae, 0xf2, 0xd4, 0xa3, 0x0e, 0xfa, 0x65, 0x71,
+			0x24, 0xc5, 0x18, 0x65, 0x75, 0x16, 0xb3, 0x59,
+			0xb1, 0x62, 0x0f, 0x16, 0x32, 0x35, 0xe2, 0xb2,
+			0x57, 0xaa, 0xc2, 0x7d, 0xf8, 0x68, 0x7f, 0xae,
+			0xea, 0x20, 0x63, 0x65, 0xbe, 0x38, 0xb7, 0x0f,
+			0x98, 0xcd, 0x0f, 0x5f, 0xa3, 0xbc, 0xc8, 0x17,
+			0xe6, 0x49, 0x93, 0x50, 0xfd, 0xd0, 0xf4, 0xbe,
+			0xd3, 0x80, 0x90, 0xa0, 0xce, 0x28, 0xbb, 0x1c,
+			0x88, 0xa3, 0xd6, 0x80, 0x7d, 0xf6, 0x80, 0x3e,
+			0x3a, 0xe6, 0x88, 0xea, 0xe8, 0x39, 0xd2, 0x14,
+			0x66, 0x8c, 0xfe, 0x95, 0xed, 0xc3, 0x9c, 0x08,
+			0x79, 0x4e, 0xb6, 0x1a, 0x5b, 0xa1, 0x78, 0xab,
+			0xf6, 0xef, 0xd4, 0x69, 0xc7, 0x04, 0x55, 0x81,
+			0xf2, 0xbf, 0xd7, 0xe8, 0x68, 0xd5, 0xe8, 0xea,
+			0xfa, 0x1c, 0x2c, 0x9c, 0xbf, 0x50, 0x7a, 0x77,
+			0x81, 0xf8, 0xd4, 0xe8, 0xb5, 0x7a, 0x82, 0x70,
+			0x41, 0xde, 0x15, 0xd7, 0x8a, 0x09, 0xba, 0x08,
+			0x72, 0x6d, 0xba, 0x53, 0xc5, 0x96, 0xd6, 0x63,
+			0xd2, 0xf1, 0xa7, 0x69, 0xbe, 0x24, 0x55, 0xab,
+			0xcf, 0x0b, 0xe1, 0x6d, 0x7a, 0x9e, 0xb0, 0xb2,
+			0x4c, 0xb9, 0xdf, 0xe6, 0x3d, 0x16, 0xb4, 0x6d,
+			0xca, 0x0e, 0x09, 0x01, 0x0d, 0x3f, 0xd4, 0x28,
+			0xf9, 0x0b, 0x7e, 0x16, 0x43, 0x4e, 0x27, 0xb4,
+			0x1c, 0x44, 0x43, 0xcd, 0x31, 0x35, 0x53, 0x2d,
+			0x4a, 0x75, 0x9d, 0xc9, 0xbf, 0xe1, 0x18, 0xcf,
+			0x5c, 0xa3, 0x16, 0xe9, 0x41, 0x3e, 0x00, 0xa2,
+			0x2d, 0x85, 0xa6, 0x47, 0x07, 0x25, 0xd7, 0x2f,
+			0xed, 0x46, 0x5b, 0xc1, 0x75, 0xf3, 0x82, 0xcd,
+			0xd9, 0x67, 0x63, 0x70, 0x05, 0xb7, 0x1a, 0x3c,
+			0xb4, 0x6a, 0xa2, 0x90, 0x1c, 0xc4, 0x4c, 0xd1,
+			0xd9, 0xbd, 0x40, 0x76, 0x49, 0x1a, 0x56, 0xc6,
+			0x68, 0xb4, 0xb8, 0xc1, 0xb3, 0x78, 0xa0, 0x4c,
+			0xfc, 0xcc, 0x08, 0xa5, 0x5a, 0x8d, 0x85, 0xd8,
+			0xae, 0x72, 0xe1, 0xa7, 0x37, 0x44, 0x75, 0x56,
+			0xa9, 0x22, 0xbf, 0x15, 0x05, 0x11, 0x65, 0x0b,
+			0x18, 0x1b, 0x68, 0xba, 0x38, 0x34, 0x79, 0x32,
+			0xb1, 0xc8, 0x14, 0x04, 0xd2, 0x23, 0xf6, 0x4b,
+			0x1f, 0x48, 0x34, 0xf8, 0xe7, 0x76, 0xb1, 0x9a,
+			0x08, 0x36, 0x84, 0x14, 0xd0, 0x74, 0x26, 0x6f,
+			0xad, 0x17, 0x46, 0xfe, 0x1e, 0xdc, 0x36, 0xa5,
+			0x9a, 0x5a, 0x1b, 0xa1, 0x5e, 0xdc, 0x70, 0x23,
+			0x4a, 0xbf, 0x63, 0x2e, 0x35, 0x3b, 0xe9, 0x7b,
+			0xb2, 0x8f, 0xb1, 0xed, 0x56, 0x6f, 0x36, 0xdb,
+			0x57, 0xd8, 0x0b, 0x57, 0xc5, 0xf3, 0x41, 0xe9,
+			0xf5, 0x08, 0x2e, 0xc5, 0xb8, 0x91, 0x5f, 0x6d,
+			0x34, 0xa3, 0x61, 0xf2, 0xaf, 0xf8, 0x9c, 0x49,
+			0xe7, 0x3c, 0xb4, 0x24, 0x71, 0xfa, 0xfd, 0x1b,
+			0xfd, 0x5f, 0x59, 0x37, 0x50, 0x62, 0xfa, 0x39,
+			0xf1, 0x39, 0xa4, 0xe4, 0x01, 0x61, 0x6b, 0x75,
+			0x59, 0x10, 0xc2, 0xe6, 0x6e, 0xb6, 0x12, 0xd2,
+			0x9e, 0x95, 0x0c, 0x76, 0xdf, 0xfa, 0x81, 0x86,
+			0xde, 0x4d, 0x2c, 0x54, 0x6e, 0x8f, 0xc8, 0xd1,
+			0xa9, 0x47, 0x6d, 0x6e, 0xc3, 0xb3, 0xbb, 0x8d,
+			0x2d, 0xba, 0x30, 0x0b, 0x5f, 0x7d, 0x99, 0x84,
+			0x16, 0xc0, 0xd7, 0x9e, 0xdf, 0x3f, 0x57, 0x15,
+			0x93, 0xa2, 0xdb, 0x40, 0x2c, 0x58, 0x97, 0x53,
+			0x54, 0xa6, 0xed, 0xf2, 0xf4, 0x17, 0x57, 0x98,
+			0xe2, 0x1d, 0x35, 0xa0, 0x11, 0x45, 0xf9, 0xd3,
+			0x66, 0xde, 0xbc, 0x7c, 0xb5, 0x88, 0xda, 0xa2,
+			0x36, 0xbb, 0x01, 0x52, 0x9f, 0x6c, 0x0b, 0xd6,
+			0x88, 0xfd, 0x7f, 0x67, 0xb6, 0x14, 0x0e, 0x26,
+			0x06, 0x4f, 0x6b, 0x7a, 0x10, 0xc6, 0xfc, 0xb8,
+			0xa4, 0xb1, 0xe2, 0xfb, 0x34, 0xff, 0x91, 0x1b,
+			0x2f, 0x36, 0x96, 0xf0, 0x95, 0xda, 0x5b, 0x70,
+			0xbb, 0x43, 0x0f, 0x2d, 0xc9, 0x37, 0x61, 0x48,
+			0x58, 0x11, 0xd4, 0x79, 0xdf, 0xfe, 0xa7, 0xd3,
+			0x20, 0x39, 0x56, 0xcf, 0x1c, 0xb8, 0x18, 0x11,
+			0x45, 0x82, 0x40, 0xfd, 0x33, 0x7a, 0xa1, 0x95,
+			0xb5, 0xda, 0xd3, 0xcb, 0x3d, 0x31, 0x91, 0x86,
+			0x10, 0xfc, 0x0d, 0x62, 0x7b, 0xea, 0x88, 0x4c,
+			0xf2, 0xe4, 0x1d, 0x17, 0x49, 0xbb, 0x70, 0xcc,
+			0x2d, 0x08, 0xfa, 0xbb, 0x51, 0x7a, 0x1b, 0x79,
+			0x44, 0xd9, 0x8f, 0x6b, 0x58, 0xad, 0xb7, 0x4d,
+			0x19, 0x62, 0xda, 0x6b, 0xb8, 0xd6, 0x2f, 0xd4,
+			0xd1, 0x18, 0x18, 0xb2, 0xf5, 0xa4, 0xaf, 0x89,
+			0x81, 0x96, 0xd1, 0x9d, 0xfa, 0x36, 0xb1, 0x6c,
+			0x81, 0x94, 0x04, 0xff, 0xa8, 0xef, 0x15, 0xa7,
+			0x6a, 0x70, 0x4e, 0xea, 0xfc, 0xc9, 0x67, 0x4e,
+			0xaa, 0x22, 0xf2, 0xe8, 0xdb, 0x27, 0xde, 0x22,
+			0x1d, 0x5b, 0xc3, 0xee, 0x8e, 0x87, 0x70, 0x8d,
+			0xe2, 0x5b, 0x0a, 0x3f, 0x68, 0x69, 0x8a, 0xf3,
+			0x49, 0x10, 0x3b, 0x7c, 0x11, 0x76, 0xf0, 0x16,
+			0xf1, 0x83, 0xa1, 0x26, 0xcc, 0x81, 0x7c, 0xf1,
+			0x19, 0x4e, 0xff, 0xa9, 0x48, 0x20, 0x45, 0x80,
+			0x52, 0xe1, 0x06, 0xba, 0xb8, 0x25, 0x55, 0xf3,
+			0xdd, 0x0f, 0x77, 0x61, 0x90, 0x9c, 0xa8, 0xca,
+			0x27, 0xa7, 0x85, 0x2d, 0xa8, 0x49, 0xc2, 0x40,
+			0x6f, 0xe2, 0xd8, 0x8d, 0xf2, 0x54, 0x08, 0x11,
+			0xb5, 0xd1, 0x96, 0x18, 0xe1, 0xff, 0x88, 0xc3,
+			0xa2, 0xe9, 0x3d, 0xb6, 0x5f, 0xc5, 0x52, 0x34,
+			0x32, 0xef, 0x19, 0xbd, 0xaf, 0x2e, 0xbf, 0x29,
+			0x08, 0xaf, 0x73, 0x21, 0x26, 0x4f, 0xd2, 0x9f,
+			0xbb, 0x68, 0x69, 0x46, 0x15, 0x22, 0xc0, 0xbf,
+			0x21, 0x46, 0x9b, 0x5f, 0x24, 0x56, 0xbf, 0x27,
+			0xa6, 0x94, 0x0e, 0xcf, 0x65, 0xbf, 0x62, 0x5d,
+			0x5b, 0xbb, 0x48, 0x00, 0x6a, 0x28, 0xe2, 0xe4,
+			0x1b, 0x83, 0x50, 0x3f, 0x4e, 0x81, 0x8a, 0xa8,
+			0xf9, 0x8e, 0x8f, 0x99, 0xa7, 0x34, 0x42, 0xf3,
+			0x05, 0x4f, 0xf1, 0xbd, 0xd5, 0x13, 0x4d, 0xb0,
+			0x86, 0xfb, 0x2a, 0x21, 0xa5, 0xad, 0x76, 0xc2,
+			0x77, 0x04, 0x86, 0xf5, 0xf3, 0x7b, 0xa5, 0x95,
+			0xdf, 0x7b, 0x44, 0xc9, 0xf6, 0xd1, 0xaa, 0x2c,
+			0xe4, 0x5b, 0x00, 0x3f, 0x9f, 0x45, 0x85, 0x36,
+			0x17, 0xf4, 0xfb, 0xd7, 0x91, 0x23, 0x86, 0x9a,
+			0x38, 0xca, 0xb7, 0x2e, 0x2d, 0xd6, 0x0a, 0xca,
+			0xa7, 0xe8, 0x70, 0xc8, 0x24, 0xc7, 0x30, 0x62,
+			0x93, 0x25, 0xee, 0xdb, 0x18, 0xc7, 0x9e, 0x7c,
+			0x5d, 0xd4, 0x2c, 0x44, 0x3d, 0x56, 0xc0, 0x9e,
+			0x22, 0xfc, 0x5a, 0x78, 0xfb, 0xfb, 0x66, 0xc2,
+			0x0b, 0x55, 0x6f, 0xc4, 0xad, 0x2f, 0x82, 0x75,
+			0xc1, 0x2c, 0xc5, 0x4d, 0xde, 0x3a, 0x4b, 0x23,
+			0x45, 0x1e, 0xda, 0x95, 0x19, 0xbc, 0x2d, 0x60,
+			0xef, 0x76, 0x6e, 0xe0, 0x3c, 0x94, 0x67, 0x09,
+			0x3d, 0xa4, 0x4a, 0x62, 0x92, 0x23, 0x9a, 0x99,
+			0x89, 0xbf, 0xbf, 0x87, 0x7a, 0x6d, 0xa6, 0xdb,
+			0xdb, 0xad, 0xf3, 0x7c, 0xad, 0x21, 0xff, 0x2b,
+			0x64, 0x1c, 0x79, 0xba, 0x8b, 0x7b, 0xe5, 0x52,
+			0x9b, 0x62, 0xa5, 0x3c, 0xb6, 0x8e, 0x72, 0xf4,
+			0x35, 0xe8, 0x67, 0x42, 0xb6, 0xa5, 0x8a, 0x9d,
+			0x8c, 0x48, 0x80, 0xca, 0x30, 0xd0, 0xb5, 0xa9,
+			0xdc, 0x46, 0x5b, 0x4f, 0xb3, 0x0e, 0xf4, 0x95,
+			0x63, 0x59, 0xa6, 0x86, 0x43, 0xc3, 0x77, 0xe5,
+			0xff, 0x8c, 0x36, 0x66, 0x9a, 0xd7, 0x52, 0x5c,
+			0x49, 0x32, 0xf9, 0xff, 0x41, 0x1a, 0x27, 0x2e,
+			0x12, 0x95, 0x6a, 0xf6, 0x2d, 0xdf, 0x5b, 0xc3,
+			0xb1, 0x89, 0x7e, 0x1b, 0xfc, 0x05, 0x64, 0x73,
+			0x55, 0xdb, 0xf3, 0xac, 0xb0, 0xb8, 0xaf, 0xd5,
+			0x65, 0xed, 0x4f, 0xdc, 0xff, 0x53, 0x30, 0x61,
+			0xd5, 0xdd, 0xfb, 0xcb, 0xf2, 0xea, 0xc7, 0x85,
+			0x28, 0x83, 0xe1, 0x47, 0xdc, 0x2f, 0x6b, 0xb0,
+			0xb7, 0x8b, 0x0e, 0x84, 0x43, 0xe6, 0x15, 0x96,
+			0x27, 0x94, 0x8d, 0xc3, 0xa7, 0xcd, 0x0d, 0x42,
+			0x17, 0xed, 0x21, 0x24, 0x01, 0xaf, 0x26, 0xdf,
+			0x78, 0x68, 0x0c, 0x92, 0x35, 0x53, 0x53, 0x17,
+			0x9f, 0x4e, 0x5e, 0x49, 0x2b, 0x1f, 0xae, 0x52,
+			0xee, 0xaf, 0xce, 0x8e, 0x9e, 0x0d, 0x9e, 0xe7,
+			0x63, 0xe7, 0xc2, 0x44, 0x7f, 0x69, 0x8b, 0xfc,
+			0x5f, 0x44, 0x35, 0xed, 0xd0, 0xf4, 0xd2, 0x63,
+			0xc6, 0xf7, 0x16, 0x48, 0x55, 0x6a, 0x2a, 0x45,
+			0xc0, 0x98, 0xfd, 0xb5, 0x49, 0x71, 0x80, 0xa7,
+			0x3d, 0xd7, 0x54, 0xa3, 0x2c, 0x42, 0xcd, 0x77,
+			0x17, 0x18, 0x41, 0x44, 0xc0, 0x07, 0xe5, 0x0c,
+			0xc0, 0x2e, 0x12, 0x79, 0x6b, 0x7b, 0x27, 0x56,
+			0x00, 0x32, 0xc2, 0x25, 0xf1, 0x97, 0xc0, 0x95,
+			0x0e, 0xad, 0x2e, 0xc5, 0x55, 0x05, 0x6f, 0x37,
+			0x8c, 0xbb, 0x21, 0x2a, 0x88, 0xd6, 0x99, 0x5f,
+			0x3d, 0xa1, 0xb3, 0xcd, 0x1a, 0xae, 0x2f, 0x7c,
+			0x91, 0x8a, 0x98, 0xe1, 0x8d, 0xa6, 0xfb, 0x6f,
+			0x02, 0x55, 0xe2, 0x42, 0x00, 0x3b, 0xca, 0x6d,
+			0xc0, 0x98, 0xb8, 0x07, 0xe7, 0xbc, 0xb7, 0x79,
+			0xe5, 0x4d, 0xf2, 0xd3, 0x7c, 0x9a, 0x06, 0x79,
+			0xce, 0x82, 0x51, 0x7f, 0xe2, 0xe7, 0xfc, 0x2f,
+			0x25, 0x3b, 0xcc, 0x9b, 0xf5, 0x5b, 0x18, 0x04,
+			0x87, 0xaf, 0x45, 0x48, 0xc8, 0xf5, 0xc4, 0xa2,
+			0x5e, 0xa5, 0xa5, 0xe5, 0x26, 0xea, 0xea, 0x5b,
+			0x78, 0x0f, 0x73, 0x42, 0x76, 0x30, 0xaa, 0xa5,
+			0x5a, 0xc9, 0x64, 0x21, 0xdb, 0x1f, 0x3a, 0x00,
+			0x9a, 0x09, 0xbd, 0xbb, 0x41, 0x42, 0xa9, 0x92,
+			0x9c, 0x13, 0x9b, 0xe2, 0x95, 0x30, 0x45, 0xb2,
+			0x34, 0x5a, 0x97, 0x97, 0xe3, 0x5e, 0x7e, 0xd5,
+			0x80, 0xe0, 0xe8, 0x89, 0xf5, 0xf4, 0x7e, 0x4e,
+			0x2c, 0x86, 0x3c, 0x41, 0x47, 0xec, 0x5a, 0x13,
+			0xae, 0x2e, 0xd5, 0xd2, 0x46, 0xea, 0x4f, 0xd6,
+			0xea, 0x73, 0x62, 0xa1, 0x5c, 0xc3, 0xac, 0x17,
+			0x7e, 0xbe, 0xdc, 0x3f, 0xb7, 0xf3, 0x87, 0xbd,
+			0x1e, 0xd2, 0x1a, 0x72, 0xe9, 0x00, 0x2e, 0x8d,
+			0xf0, 0xdd, 0x13, 0x60, 0xd8, 0x9f, 0x19, 0xef,
+			0x2a, 0xd3, 0x21, 0x27, 0x7d, 0x1a, 0x2c, 0x1b,
+			0x7a, 0xab, 0xa9, 0xd4, 0xfa, 0x45, 0xb4, 0x2b,
+			0x1e, 0xe9, 0xa3, 0x0a, 0x6e, 0xf2, 0x6b, 0x7e,
+			0x4a, 0x28, 0xd2, 0x84, 0xa1, 0x82, 0x49, 0xee,
+			0xc2, 0xb6, 0x18, 0x4d, 0x69, 0x16, 0xfe, 0xef,
+			0xc5, 0x33, 0x82, 0x33, 0xb3, 0xa7, 0xde, 0x1f,
+			0x7d, 0x72, 0x56, 0x50, 0x0b, 0x78, 0xce, 0x1d,
+			0x25, 0xdf, 0x3e, 0x2c, 0x62, 0xf3, 0x81, 0x1d,
+			0xb6, 0xc7, 0x3e, 0x3c, 0xda, 0xb4, 0x30, 0xe1,
+			0x96, 0xd9, 0xb8, 0x21, 0x43, 0x02, 0xc4, 0x68,
+			0x80, 0xc9, 0xe0, 0x24, 0xc2, 0x5b, 0x4d, 0x31,
+			0xd2, 0xa9, 0x48, 0x26, 0x29, 0x94, 0xa2, 0x1a,
+			0x4d, 0xa9, 0x1d, 0x28, 0x81, 0x80, 0xbd, 0x29,
+			0xb8, 0x63, 0x57, 0xc7, 0xf4, 0xf2, 0xf7, 0xa3,
+			0x26, 0xc8, 0x4f, 0x69, 0xd9, 0xd1, 0x20, 0x57,
+			0x83, 0x93, 0x96, 0x7b, 0x67, 0x91, 0x10, 0x3e,
+			0x68, 0x89, 0x3c, 0xa9, 0x22, 0x05, 0xf8, 0x55,
+			0x76, 0x47, 0x96, 0x3b, 0xf7, 0xf0, 0xb7, 0x27,
+			0x93, 0x2b, 0x65, 0x69, 0x08, 0x7f, 0xdd, 0x4a,
+			0xdf, 0xca, 0xaf, 0xc1, 0xf8, 0x17, 0xed, 0x3a,
+			0x43, 0x91, 0x3a, 0xba, 0x5b, 0xac, 0x47, 0x7b,
+			0xfa, 0x2d, 0x60, 0x0a, 0xeb, 0x4c, 0x13, 0x7b,
+			0xe4, 0x1f, 0x4d, 0x73, 0xea, 0x0e, 0x67, 0xa5,
+			0xd8, 0x5b, 0x58, 0x48, 0x72, 0x4b, 0x1f, 0xa4,
+			0x99, 0x0d, 0x26, 0x5a, 0x78, 0x25, 0x6d, 0x71,
+			0xe7, 0x83, 0x7d, 0x32, 0x0a, 0x16, 0x64, 0xd0,
+			0x18, 0x83, 0xc8, 0x99, 0xa7, 0x59, 0x84, 0xee,
+			0x58, 0xda, 0xa8, 0xb2, 0x26, 0x51, 0xee, 0xa6,
+			0xf7, 0xb1, 0xd8, 0xa4, 0x95, 0xb7, 0xd7, 0xe6,
+			0xeb, 0xf5, 0x83, 0x48, 0x1f, 0x58, 0x85, 0xc5,
+			0xc1, 0x0c, 0xe2, 0x3a, 0xa5, 0xb5, 0x70, 0x43,
+			0x50, 0x82, 0xb6, 0xa4, 0x61, 0x0f, 0x89, 0xbe,
+			0x55, 0xb4, 0xd8, 0xd4, 0x46, 0xf5, 0x9a, 0x0d,
+			0x6c, 0xdf, 0xc2, 0x5d, 0x7c, 0x40, 0x52, 0x01,
+			0x0b, 0x0f, 0x04, 0x09, 0x1a, 0xbb, 0x21, 0x90,
+			0x99, 0x27, 0x42, 0x26, 0x2e, 0xdc, 0xcb, 0xf8,
+			0x0b, 0x0e, 0x56, 0x6e, 0x6f, 0x99, 0xc8, 0x33,
+			0x11, 0xdb, 0x7e, 0xef, 0xa3, 0xfb, 0x89, 0x97,
+			0xcb, 0x24, 0x92, 0x3d, 0x94, 0x34, 0x88, 0x54,
+			0xdc, 0x95, 0x95, 0xb8, 0xa3, 0x99, 0x7e, 0x0c,
+			0xf1, 0x67, 0x08, 0x92, 0x42, 0x41, 0x7c, 0xec,
+			0x20, 0xb9, 0x7d, 0x38, 0x60, 0x8a, 0xcc, 0x7d,
+			0xe7, 0x61, 0xda, 0x29, 0xc0, 0x62, 0x07, 0x56,
+			0xf0, 0x7d, 0x7e, 0x41, 0xd8, 0x87, 0xd8, 0xaf,
+			0x8d, 0x5b, 0x1a, 0x54, 0x8a, 0x0d, 0xf6, 0x09,
+			0x9f, 0xa3, 0xe8, 0xdf, 0x31, 0x64, 0xfc, 0xce,
+			0xd0, 0xed, 0x91, 0xcd, 0xf2, 0x3e, 0x82, 0xf0,
+			0x6e, 0xab, 0xf2, 0x0b, 0x03, 0x57, 0x97, 0xc5,
+			0x1a, 0x60, 0xb7, 0x24, 0xfc, 0x73, 0x1c, 0xee,
+			0x46, 0xe6, 0xf5, 0x02, 0x41, 0xab, 0x10, 0x48,
+			0xb5, 0x29, 0xb5, 0x1b, 0x1c, 0x8d, 0x18, 0x74,
+			0xa6, 0x36, 0x8a, 0xe0, 0xad, 0x7b, 0x68, 0xae,
+			0xc2, 0x8c, 0x0b, 0x7d, 0xae, 0x92, 0xa6, 0x04,
+			0x7a, 0x60, 0xe7, 0xf1, 0xbe, 0xc3, 0x6a, 0xcb,
+			0xe0, 0x6c, 0xed, 0x0b, 0x88, 0x96, 0xcf, 0xb2,
+			0x52, 0xa9, 0xeb, 0x83, 0x53, 0xde, 0xc9, 0x79,
+			0xd2, 0xcd, 0x96, 0xfb, 0x8b, 0xd4, 0xe5, 0x73,
+			0xb6, 0xa4, 0x5d, 0x3e, 0x16, 0x64, 0xcc, 0xf0,
+			0x59, 0x28, 0x4f, 0xc8, 0xa8, 0x1c, 0xe9, 0x89,
+			0xb9, 0x54, 0x22, 0x7e, 0x48, 0x0b, 0x2c, 0x05,
+			0x14, 0x9c, 0x35, 0x7d, 0xeb, 0x0f, 0xd9, 0x89,
+			0x4d, 0x06, 0x6f, 0x50, 0x2d, 0x1c, 0xce, 0xc5,
+			0xfb, 0x5b, 0xfe, 0xe7, 0x3a, 0x33, 0x67, 0x6a,
+			0xa5, 0x7e, 0xb3, 0x62, 0xff, 0x49, 0x5e, 0xe4,
+			0xf9, 0x8c, 0xbc, 0xf9, 0xe9, 0x5a, 0xb9, 0x67,
+			0x1c, 0xee, 0x0b, 0xb6, 0x8d, 0xb3, 0x51, 0x4f,
+			0x8c, 0x1c, 0xb1, 0xa4, 0x08, 0xd9, 0x0c, 0xb9,
+			0xf7, 0x79, 0x88, 0x4b, 0xa8, 0x60, 0xdb, 0xa2,
+			0x1a, 0x1f, 0xff, 0xbb, 0x31, 0x41, 0xc2, 0x76,
+			0x28, 0xff, 0xb8, 0xaf, 0x33, 0x4a, 0x62, 0x4f,
+			0x87, 0x81, 0x80, 0xa2, 0x90, 0xce, 0x20, 0x26,
+			0x6a, 0x77, 0x2a, 0x96, 0x6e, 0x46, 0x12, 0x7f,
+			0x2f, 0x13, 0xab, 0x4e, 0xbb, 0xd2, 0xae, 0x16,
+			0xaa, 0xf7, 0x70, 0x12, 0xb0, 0x9c, 0xc9, 0x40,
+			0x07, 0xcc, 0x98, 0x40, 0x6c, 0x36, 0x64, 0x2f,
+			0x75, 0xc0, 0xbd, 0xf7, 0x54, 0xab, 0x69, 0x1e,
+			0x83, 0xf3, 0xe8, 0x75, 0x69, 0xb2, 0xf6, 0xf2,
+			0x2d, 0x17, 0x9e, 0x0c, 0x79, 0xa4, 0x56, 0xaa,
+			0x38, 0xb3, 0x8a, 0xb1, 0x21, 0x3c, 0x15, 0xfa,
+			0xb2, 0x20, 0xcc, 0x4c, 0xc6, 0xaf, 0x54, 0x46,
+			0xc7, 0xad, 0x96, 0xed, 0x49, 0xef, 0x12, 0xfc,
+			0x96, 0x25, 0xea, 0x48, 0x8c, 0xd5, 0x69, 0xa1,
+			0x6d, 0xff, 0xc2, 0x39, 0xc9, 0xeb, 0x44, 0xfc,
+			0xed, 0xb6, 0x6f, 0xb3, 0xdf, 0x9a, 0x17, 0x88,
+			0xa9, 0x77, 0xe5, 0x5d, 0x98, 0x88, 0x29, 0x98,
+			0x4b, 0xeb, 0xa3, 0x40, 0xc8, 0x3b, 0xdb, 0x7a,
+			0xd7, 0x85, 0xa3, 0x30, 0x81, 0xa0, 0x4e, 0xb1,
+			0x75, 0x04, 0xa1, 0x03, 0xd9, 0x8c, 0x93, 0x6c,
+			0x72, 0x29, 0x8e, 0xea, 0xfa, 0x40, 0x9c, 0x3d,
+			0xb1, 0x72, 0xfd, 0x6e, 0x15, 0x10, 0x73, 0x17,
+			0x0e, 0x3f, 0xa1, 0x44, 0xa2, 0x50, 0xdb, 0xb0,
+			0xa5, 0xc7, 0x13, 0x4a, 0x77, 0xf7, 0xcd, 0x4e,
+			0xa8, 0x99, 0xab, 0x53, 0xa6, 0xad, 0x9b, 0x34,
+			0xd0, 0x4a, 0x3c, 0xcc, 0x7a, 0x1a, 0x34, 0x49,
+			0x26, 0x02, 0x88, 0xc7, 0xc3, 0xa7, 0xbb, 0xf3,
+			0x23, 0x4c, 0xb9, 0xa1, 0x4c, 0xda, 0x4a, 0xac,
+			0xcf, 0xbe, 0xe5, 0x3d, 0xd0, 0x66, 0x1e, 0xd7,
+			0x16, 0x4a, 0xb2, 0x58, 0xfb, 0x44, 0x9d, 0x3d,
+			0x22, 0xfb, 0x94, 0x31, 0x70, 0x6f, 0xe9, 0x85,
+			0x8f, 0xeb, 0xbb, 0x65, 0x7d, 0xe6, 0x84, 0xee,
+			0x4e, 0x27, 0x5b, 0x5a, 0xf1, 0xe6, 0x38, 0x90,
+			0x88, 0xc8, 0xe8, 0xaf, 0x09, 0x32, 0x23, 0x54,
+			0x0e, 0x13, 0x27, 0xd9, 0x20, 0xc5, 0xe9, 0x69,
+			0x2b, 0x55, 0x97, 0x21, 0x73, 0x62, 0xed, 0x20,
+			0x76, 0x1d, 0xe3, 0x30, 0x84, 0xbd, 0xec, 0x9c,
+			0xbc, 0xe3, 0x79, 0x9d, 0x51, 0x15, 0x28, 0x66,
+			0xb9, 0x25, 0x04, 0xa0, 0x0a, 0xec, 0x03, 0xd1,
+			0xf3, 0x66, 0xd7, 0x67, 0xfe, 0x58, 0x9e, 0xd8,
+			0x83, 0xbc, 0xbe, 0x40, 0x01, 0x67, 0x9d, 0xf3,
+			0x51, 0xf8, 0xa0, 0xc6, 0x80, 0xf0, 0x63, 0xd7,
+			0x0a, 0xce, 0x85, 0xc6, 0xde, 0x08, 0x30, 0x6d,
+			0xb6, 0x5b, 0x3f, 0x8b, 0x45, 0x12, 0x0b, 0xb6,
+			0xa8, 0x1d, 0x70, 0x61, 0x37, 0x2d, 0xc8, 0x6a,
+			0xae, 0x5d, 0x64, 0xd1, 0xbb, 0x1a, 0x5a, 0x63,
+			0xdf, 0xd0, 0x9f, 0xb7, 0x7d, 0xbc, 0x29, 0x4e,
+			0xb8, 0x0c, 0xa9, 0x8a, 0x5f, 0x8b, 0x17, 0xbf,
+			0xf5, 0x6f, 0xd8, 0xb4, 0xdb, 0x67, 0x0c, 0x59,
+			0x58, 0x4f, 0x32, 0xbd, 0xa2, 0xbf, 0x70, 0x13,
+			0xff, 0x51, 0x3a, 0x59, 0x88, 0x44, 0x9c, 0xbd,
+			0xd1, 0x46, 0x5c, 0x2e, 0x24, 0x03, 0xe2, 0x04,
+			0x11, 0xa8, 0x91, 0x48, 0x30, 0x4b, 0x27, 0x64,
+			0x04, 0x14, 0xe4, 0xc3, 0xc3, 0x8d, 0xd9, 0x76,
+			0x01, 0x95, 0x2d, 0x8e, 0xe6, 0x33, 0x13, 0x77,
+			0x3d, 0xd3, 0x64, 0xbc, 0x6a, 0x52, 0x79, 0x37,
+			0x72, 0x21, 0x0f, 0x77, 0xc5, 0x06, 0xb2, 0x1f,
+			0x11, 0xf3, 0x6a, 0x52, 0xe9, 0x4a, 0xaf, 0x12,
+			0xdc, 0xec, 0xd7, 0x84, 0x1e, 0x77, 0x6c, 0xca,
+			0x74, 0x66, 0xe1, 0x9e, 0x28, 0x71, 0xc5, 0x03,
+			0xe2, 0x90, 0x40, 0xac, 0x58, 0xe4, 0xc1, 0x9c,
+			0x14, 0x07, 0x3e, 0x0a, 0x63, 0x27, 0x2e, 0x17,
+			0x54, 0x1e, 0x18, 0x36, 0x52, 0x0f, 0x4d, 0x25,
+			0xa9, 0x3f, 0x41, 0x80, 0x5c, 0xe8, 0xdb, 0x7a,
+			0xab, 0xc9, 0xb4, 0xb8, 0x99, 0xa2, 0xc6, 0x3e,
+			0x9d, 0xe1, 0xb7, 0x20, 0xc3, 0x64, 0x24, 0xb9,
+			0x3b, 0x8b, 0xa2, 0xa7, 0x92, 0xc5, 0x1d, 0xf1,
+			0xeb, 0x37, 0xfb, 0xdf, 0x4b, 0xdf, 0x9e, 0xeb,
+			0xb5, 0x2b, 0x2e, 0x33, 0x79, 0xc8, 0xae, 0x43,
+			0x91, 0xc5, 0x9f, 0x52, 0xa2, 0x66, 0x56, 0x6f,
+			0xd6, 0x01, 0x8c, 0x06, 0x00, 0xeb, 0xdf, 0x29,
+			0xd0, 0x93, 0x60, 0x1a, 0xea, 0xd4, 0x16, 0xaf,
+			0x34, 0x50, 0x74, 0xfc, 0x5b, 0x61, 0xe2, 0xb4,
+			0x18, 0x4a, 0x84, 0x0b, 0xc1, 0x75, 0xd1, 0x0e,
+			0x56, 0xf8, 0x74, 0x0c, 0xbe, 0x82, 0xf3, 0x7e,
+			0x84, 0x86, 0x1e, 0xcc, 0x42, 0x40, 0x2f, 0xda,
+			0x46, 0x76, 0xc9, 0x9c, 0x40, 0x50, 0xca, 0xb8,
+			0xc6, 0x12, 0x03, 0x6c, 0xc3, 0x44, 0x2f, 0xd6,
+			0x75, 0xce, 0x98, 0x16, 0xa9, 0x06, 0x6c, 0xf6,
+			0xbc, 0x74, 0xdb, 0xd2, 0x7c, 0xce, 0xce, 0x31,
+			0xff, 0x0a, 0x36, 0x23, 0x4c, 0xd2, 0x2a, 0x11,
+			0xa7, 0xad, 0xe6, 0xcb, 0x65, 0x24, 0x94, 0xb6,
+			0x9e, 0xfa, 0xa4, 0x1c, 0xa6, 0xab, 0x43, 0xfd,
+			0x28, 0xce, 0x18, 0x09, 0xb4, 0x69, 0xcc, 0x9c,
+			0x03, 0xc7, 0xd0, 0x0a, 0xce, 0x01, 0x0a, 0x9f,
+			0x57, 0xc6, 0xe3, 0x41, 0x0f, 0xb8, 0xf1, 0xe9,
+			0x8e, 0x18, 0x4a, 0x99, 0x7c, 0x88, 0xea, 0xbe,
+			0xe5, 0xf9, 0x0c, 0x46, 0x14, 0xd7, 0x4a, 0x6e,
+			0xed, 0x02, 0x61, 0x66, 0xcb, 0xa6, 0xe7, 0x66,
+			0xbc, 0x89, 0x90, 0xad, 0xf3, 0x83, 0xef, 0x7f,
+			0x4d, 0x95, 0x50, 0xf1, 0xbf, 0x49, 0x73, 0x7c,
+			0x95, 0x16, 0x67, 0x7f, 0x21, 0x05, 0xd1, 0xa8,
+			0x67, 0xe0, 0x9f, 0x59, 0x45, 0x49, 0x72, 0x49,
+			0xdb, 0x0a, 0x15, 0xf8, 0x46, 0x94, 0x6f, 0x10,
+			0x65, 0x08, 0x90, 0x17, 0xda, 0x52, 0x58, 0x2e,
+			0x2c, 0xe4, 0xdd, 0x25, 0x59, 0x3e, 0xe2, 0x81,
+			0x76, 0x94, 0xba, 0xc3, 0x2e, 0x77, 0xdd, 0xf9,
+			0x92, 0x5f, 0x4b, 0x93, 0xa7, 0xe1, 0x4b, 0x07,
+			0x6f, 0x7a, 0xf1, 0x1a, 0xae, 0x34, 0xf8, 0x9a,
+			0x47, 0xfd, 0xcb, 0xfa, 0xc4, 0xb8, 0x04, 0x1f,
+			0x2c, 0x78, 0x2e, 0xe7, 0x3d, 0x6a, 0x44, 0xc6,
+			0x3b, 0x15, 0xbc, 0xe2, 0x3d, 0xbc, 0x22, 0x58,
+			0x36, 0x6d, 0xfd, 0xc3, 0xe1, 0xd4, 0x81, 0x27,
+			0xf3, 0xe7, 0xa0, 0x84, 0xaf, 0x0d, 0xb5, 0x83,
+			0x31, 0x44, 0xd9, 0xe5, 0xf3, 0x88, 0x2d, 0x2c,
+			0xc5, 0xbc, 0x0a, 0x67, 0x34, 0x87, 0xa4, 0x16,
+			0x70, 0x89, 0x2d, 0x3e, 0x4e, 0xab, 0x4f, 0x34,
+			0x73, 0x7a, 0x31, 0x02, 0xa8, 0x3b, 0x3b, 0x72,
+			0x18, 0x92, 0xc9, 0x5c, 0x03, 0xb2, 0xa4, 0x4b,
+			0x85, 0x9d, 0x36, 0xd5, 0xcc, 0xdf, 0x0c, 0xdd,
+			0x98, 0x7f, 0x53, 0xac, 0x91, 0x64, 0xac, 0xd3,
+			0x35, 0xff, 0xfd, 0x40, 0xde, 0x41, 0xca, 0xf9,
+			0x13, 0x09, 0xca, 0x26, 0x93, 0xe6, 0x6d, 0x35,
+			0xdc, 0x08, 0x84, 0xe8, 0x82, 0x4d, 0xc2, 0xb7,
+			0xd7, 0x40, 0xbf, 0x01, 0xbc, 0x27, 0xbe, 0x9c,
+			0x59, 0x17, 0x20, 0x2f, 0x2a, 0x1a, 0xd4, 0x3f,
+			0x1a, 0x7b, 0x30, 0x49, 0xb3, 0xf4, 0xf1, 0x5a,
+			0x14, 0xe7, 0x66, 0x86, 0x71, 0xc7, 0x30, 0x16,
+			0x45, 0x26, 0x95, 0x6e, 0x50, 0x03, 0x78, 0xaa,
+			0x78, 0xc6, 0xfc, 0x3a, 0x52, 0xa4, 0x41, 0x00,
+			0x43, 0x33, 0x88, 0x15, 0x34, 0x18, 0x91, 0xd2,
+			0x6c, 0x67, 0x36, 0xe2, 0x78, 0x31, 0x53, 0x0a,
+			0x54, 0xb7, 0x11, 0xf3, 0x4f, 0x3d, 0x70, 0xad,
+			0xa3, 0x95, 0x46, 0x26, 0xdd, 0xc4, 0x80, 0x55,
+			0x27, 0x95, 0x61, 0xc8, 0xec, 0x07, 0x43, 0xf4,
+			0x10, 0xfa, 0x50, 0x5e, 0xa2, 0x74, 0x8e, 0xfa,
+			0xae, 0x1b, 0x29, 0xd4, 0xf4, 0xce, 0x00, 0x12,
+			0x74, 0x99, 0xae, 0xca, 0x31, 0xa7, 0x9d, 0x24,
+			0x12, 0xaa, 0x9a, 0x16, 0x9a, 0xbd, 0x1b, 0x64,
+			0xe5, 0xdf, 0xfa, 0x99, 0xbf, 0xe7, 0x7d, 0x10,
+			0x14, 0x61, 0x33, 0x82, 0x76, 0x60, 0xd9, 0xf9,
+			0x03, 0x28, 0x94, 0x49, 0x7b, 0x2c, 0x33, 0xb2,
+			0xd1, 0xe9, 0x60, 0x1b, 0x26, 0x88, 0x22, 0xb7,
+			0x82, 0xf3, 0x55, 0x20, 0xc4, 0x3d, 0x52, 0x1c,
+			0x82, 0xa3, 0x1b, 0x57, 0xf7, 0x42, 0xa2, 0x32,
+			0xf4, 0x5e, 0x16, 0x97, 0x8e, 0xc7, 0x47, 0x4a,
+			0xf3, 0x5a, 0x83, 0x07, 0x4d, 0x70, 0x85, 0xfe,
+			0xec, 0x51, 0x60, 0xff, 0xa7, 0x65, 0x3e, 0x26,
+			0x3d, 0x6f, 0x38, 0x9c, 0x3a, 0xb8, 0x94, 0xf7,
+			0x1c, 0x88, 0xcb, 0xed, 0x52, 0x49, 0x5d, 0x1b,
+			0xc7, 0xaa, 0xaf, 0x76, 0x13, 0xdb, 0x15, 0x34,
+			0x1b, 0x22, 0xbd, 0x1a, 0xb9, 0xde, 0x55, 0x11,
+			0x2a, 0x75, 0xc4, 0x99, 0x28, 0x3c, 0x9c, 0xc7,
+			0xee, 0x54, 0x19, 0x18, 0xca, 0x47, 0xc1, 0x9b,
+			0x89, 0xd6, 0x3d, 0x8d, 0x37, 0x21, 0x73, 0xac,
+			0xac, 0xe2, 0x0a, 0x28, 0x26, 0x36, 0x99, 0x37,
+			0x40, 0xe8, 0x2c, 0x42, 0x9a, 0x84, 0x09, 0x5d,
+			0x43, 0x3f, 0x25, 0x61, 0xe8, 0xd2, 0xac, 0xa3,
+			0x9f, 0x8c, 0x85, 0x0e, 0xd8, 0xb5, 0x6f, 0xc2,
+			0x6f, 0x3a, 0xe0, 0x1f, 0xe8, 0xd6, 0x35, 0x83,
+			0x9a, 0x60, 0x01, 0x52, 0xfa, 0x5c, 0xa9, 0x8e,
+			0x41, 0xac, 0xce, 0x61, 0xd9, 0x3f, 0x4c, 0x3a,
+			0x7a, 0xc6, 0x7f, 0xb8, 0x3d, 0xdd, 0xe5, 0x2a,
+			0x83, 0x03, 0x36, 0x80, 0x30, 0xcc, 0x8d, 0x63,
+			0xa1, 0x83, 0x4b, 0x74, 0x49, 0xb6, 0xcf, 0x06,
+			0x57, 0x4e, 0xb0, 0x88, 0xf7, 0x1e, 0xa9, 0xd8,
+			0xf3, 0x75, 0x4a, 0x34, 0xe4, 0xf0, 0xce, 0x7a,
+			0x0d, 0x65, 0x87, 0x16, 0x8a, 0xef, 0x2d, 0xd2,
+			0x9c, 0x58, 0xda, 0x72, 0x2d, 0x28, 0xf1, 0xaf,
+			0xa2, 0x8d, 0x9b, 0xd7, 0x19, 0x75, 0x15, 0x0c,
+			0xbb, 0x1a, 0x26, 0x8b, 0x03, 0x7d, 0x71, 0x35,
+			0x67, 0x85, 0x8b, 0xcd, 0xc7, 0xa9, 0xec, 0x24,
+			0x07, 0xa7, 0xc8, 0x14, 0xd8, 0x1d, 0x04, 0x31,
+			0x36, 0x02, 0xcf, 0x94, 0xab, 0x08, 0x2f, 0x6e,
+			0xb8, 0xce, 0x14, 0x2a, 0xde, 0xd7, 0xd6, 0xcc,
+			0x72, 0x5b, 0x3d, 0x38, 0x8d, 0xb6, 0x5f, 0xbc,
+			0xa2, 0x3b, 0x76, 0x7c, 0xc2, 0x77, 0x84, 0xa7,
+			0x0e, 0xe7, 0x52, 0x96, 0xd1, 0x73, 0x6a, 0x9c,
+			0x79, 0xa5, 0x06, 0x6b, 0x82, 0x4d, 0x4a, 0xda,
+			0x4d, 0xed, 0xab, 0x56, 0x40, 0x5b, 0xc9, 0xca,
+			0xf5, 0xd7, 0xb0, 0x20, 0xe3, 0x80, 0xe8, 0x5d,
+			0xee, 0x26, 0x74, 0x43, 0x78, 0xb7, 0x98, 0x57,
+			0xb2, 0x12, 0x22, 0x70, 0x7e, 0x7a, 0x2c, 0x3a,
+			0xc4, 0x0d, 0xa4, 0x87, 0xe3, 0x09, 0xb1, 0x08,
+			0x1a, 0xd8, 0xc1, 0x0f, 0x1e, 0x5d, 0xaa, 0xe8,
+			0xf5, 0x24, 0x93, 0xf5, 0xd6, 0x86, 0x35, 0xfd,
+			0x02, 0x9c, 0xd8, 0x1f, 0xb7, 0xb9, 0x5b, 0x9f,
+			0x7f, 0xdd, 0xe0, 0x11, 0xdb, 0x8a, 0x55, 0xa0,
+			0x4e, 0x32, 0x95, 0x53, 0x53, 0x87, 0x2f, 0xa8,
+			0x35, 0xd0, 0x9d, 0x76, 0xe3, 0xf8, 0x68, 0xaa,
+			0x04, 0x8d, 0x27, 0x03, 0x7b, 0xd5, 0x97, 0xd8,
+			0x4c, 0x0a, 0xdb, 0xf5, 0xdc, 0x96, 0xa4, 0xf9,
+			0xf0, 0xda, 0x17, 0x67, 0xdd, 0x87, 0xeb, 0x68,
+			0xe0, 0xa7, 0x8a, 0x02, 0x78, 0x7b, 0xf6, 0x0b,
+			0xf3, 0x7d, 0xa2, 0x86, 0x00, 0x4f, 0x0c, 0x2d,
+			0x69, 0xab, 0xde, 0x11, 0x48, 0x81, 0xa2, 0xd8,
+			0x5e, 0x8e, 0xae, 0x5d, 0x0d, 0x8e, 0xba, 0x7d,
+			0x91, 0xbd, 0x85, 0x16, 0x1a, 0x1b, 0x7b, 0x4f,
+			0x40, 0xce, 0x00, 0x41, 0xdf, 0x9d, 0x47, 0x57,
+			0x12, 0x47, 0xee, 0x77, 0xd6, 0xb3, 0x56, 0x0d,
+			0xb7, 0x40, 0xa4, 0x99, 0x4e, 0x90, 0x68, 0x7a,
+			0x12, 0x7d, 0x4b, 0x69, 0x6b, 0xa5, 0xf1, 0x11,
+			0x60, 0x78, 0xab, 0x26, 0x01, 0x55, 0x59, 0x79,
+			0x7f, 0x86, 0x7c, 0x91, 0xe5, 0x29, 0xa7, 0xb1,
+			0x90, 0xdb, 0xcb, 0xf4, 0x6e, 0x72, 0x23, 0x80,
+			0x8c, 0x41, 0xd2, 0x1f, 0xeb, 0xe3, 0x1f, 0xe3,
+			0xe9, 0xf2, 0x2b, 0xef, 0xf7, 0xa3, 0xb5, 0x94,
+			0x2a, 0xd4, 0xe9, 0x8b, 0x87, 0x18, 0xb4, 0x11,
+			0x4b, 0xcb, 0xd8, 0xd5, 0x64, 0xeb, 0xcd, 0x03,
+			0x76, 0x23, 0xae, 0xb0, 0x4d, 0x28, 0xd2, 0x92,
+			0xe2, 0x10, 0x74, 0xb0, 0x95, 0x9d, 0x02, 0x62,
+			0x45, 0x93, 0x6f, 0xd9, 0x82, 0xa4, 0xb0, 0x59,
+			0x38, 0x53, 0x06, 0x3a, 0xc9, 0xfc, 0x72, 0x1b,
+			0x5b, 0xe1, 0x43, 0x94, 0x43, 0x9b, 0x79, 0x53,
+			0xf1, 0x1f, 0x93, 0x98, 0xf4, 0xb3, 0x7a, 0xe3,
+			0xf8, 0x78, 0x49, 0xef, 0x5e, 0x15, 0x44, 0x6b,
+			0x60, 0xc2, 0x6c, 0xd6, 0x7e, 0x39, 0xb0, 0x5f,
+			0x5a, 0x10, 0x39, 0xc2, 0x0e, 0x2f, 0x60, 0xbd,
+			0xa8, 0x5b, 0xdb, 0x30, 0x57, 0xb9, 0x9d, 0x2d,
+			0x3d, 0x8a, 0x66, 0xc2, 0xfa, 0xbc, 0xb4, 0x68,
+			0x39, 0xde, 0x8c, 0xd0, 0x2f, 0xa2, 0xe5, 0x54,
+			0x75, 0xbe, 0x79, 0x2f, 0x47, 0x9f, 0x2b, 0x79,
+			0xa1, 0xfb, 0x57, 0x59, 0x14, 0x1b, 0x0e, 0x52,
+			0x9e, 0xa2, 0xcd, 0xf8, 0x01, 0xf2, 0x71, 0xf7,
+			0xdb, 0x3b, 0x0f, 0xee, 0xc6, 0x16, 0xb2, 0x89,
+			0x58, 0x72, 0x7c, 0xf7, 0x93, 0x1f, 0x0e, 0x3d,
+			0xc5, 0x93, 0x99, 0x78, 0x58, 0x34, 0xf3, 0x97,
+			0x4c, 0xdd, 0x18, 0xe6, 0x55, 0xca, 0xf2, 0xda,
+			0x40, 0x82, 0xc0, 0xc6, 0x7d, 0x4b, 0x99, 0x37,
+			0xd1, 0x59, 0x4e, 0xed, 0x61, 0xb3, 0x38, 0x19,
+			0x4c, 0x21, 0xd6, 0x81, 0xc5, 0x8d, 0xae, 0xea,
+			0xd7, 0xf4, 0xbf, 0x39, 0xb6, 0x9d, 0x59, 0x61,
+			0x0c, 0x71, 0x00, 0x95, 0xd7, 0xd8, 0x9a, 0x0a,
+			0x17, 0x43, 0xc5, 0xe6, 0x2a, 0x90, 0x4a, 0xdf,
+			0xa5, 0x5c, 0xe1, 0x95, 0x98, 0xed, 0x91, 0x7a,
+			0x94, 0x87, 0xa0, 0x48, 0x38, 0x30, 0xad, 0x3d,
+			0xc2, 0x81, 0x87, 0x2b, 0xbe, 0x06, 0x15, 0xc5,
+			0xa3, 0xad, 0x30, 0x6a, 0x4d, 0xc8, 0xb3, 0x09,
+			0xe9, 0x23, 0x2b, 0x9d, 0x1c, 0x0f, 0x53, 0x71,
+			0x60, 0x3f, 0xbe, 0xb7, 0x0c, 0xb6, 0x7f, 0x2a,
+			0xed, 0x67, 0x86, 0xc3, 0x5a, 0xb1, 0xd6, 0x42,
+			0x5d, 0xde, 0x8d, 0xfe, 0x65, 0xe0, 0x57, 0x72,
+			0x6d, 0xb8, 0x1c, 0xca, 0x98, 0x62, 0x39, 0x03,
+			0x74, 0xfe, 0x25, 0x24, 0x12, 0x2d, 0x41, 0x04,
+			0x29, 0xd9, 0x0c, 0x28, 0x8a, 0x39, 0xf7, 0xc2,
+			0x3b, 0x73, 0x31, 0x57, 0xdc, 0x4d, 0x83, 0xf8,
+			0x58, 0xde, 0x88, 0xa1, 0x1f, 0x0b, 0x62, 0x5b,
+			0xdb, 0xa5, 0x00, 0xba, 0x87, 0x25, 0x37, 0xba,
+			0x7f, 0x9f, 0x7e, 0x0b, 0x72, 0x0a, 0x3f, 0xc0,
+			0x71, 0x0b, 0xce, 0x20, 0x94, 0x1c, 0x57, 0x53,
+			0x4c, 0xfe, 0x2d, 0x51, 0x58, 0x1c, 0xa5, 0x82,
+			0x2b, 0xd5, 0x1c, 0x17, 0xfb, 0xf1, 0x8a, 0x89,
+			0xc4, 0x15, 0x3d, 0xc8, 0x8f, 0xd4, 0x3c, 0x5c,
+			0x34, 0xa7, 0x4a, 0x56, 0xaf, 0x60, 0xdf, 0x4b,
+			0x0d, 0x46, 0xf1, 0xb0, 0x06, 0xab, 0x12, 0x67,
+			0x65, 0x6e, 0xb6, 0xa4, 0xa2, 0x0d, 0x44, 0x3f,
+			0x8d, 0xca, 0xfe, 0xb3, 0x31, 0xc7, 0xe2, 0x92,
+			0x5e, 0x62, 0xcd, 0x5b, 0xa4, 0x81, 0x4c, 0x28,
+			0xa5, 0x98, 0xad, 0x38, 0x45, 0xca, 0xd4, 0xe9,
+			0x7e, 0x88, 0x3c, 0x57, 0x2c, 0xde, 0x44, 0xe1,
+			0x4e, 0x27, 0x48, 0x94, 0xbe, 0x60, 0xc7, 0x6d,
+			0xd9, 0x16, 0x73, 0xd1, 0x93, 0xae, 0x77, 0xec,
+			0x34, 0x42, 0x33, 0x3d, 0x71, 0x46, 0x2d, 0x21,
+			0x5c, 0xad, 0x41, 0xeb, 0x02, 0xee, 0x9d, 0x3c,
+			0xe8, 0xa1, 0x10, 0x25, 0xc6, 0xe4, 0x9f, 0x1f,
+			0x54, 0x86, 0xdb, 0x18, 0x7b, 0xef, 0x22, 0x42,
+			0xa6, 0x8b, 0x0e, 0xd9, 0x9c, 0xd5, 0xa9, 0x98,
+			0x53, 0xbd, 0xf5, 0x08, 0x5e, 0x43, 0x2e, 0xe7,
+			0xb9, 0x3e, 0xb4, 0x9f, 0x42, 0x42, 0x09, 0x88,
+			0xbc, 0x75, 0x5f, 0x0f, 0xb5, 0x5f, 0xcb, 0xdb,
+			0x28, 0xb9, 0xd0, 0xf9, 0xc3, 0x9d, 0x71, 0xef,
+			0x01, 0xfb, 0x37, 0x67, 0x61, 0xdd, 0x83, 0x95,
+			0xef, 0xc6, 0x0f, 0xbb, 0xbf, 0x91, 0xc2, 0xc6,
+			0x37, 0xbd, 0x03, 0x61, 0x32, 0x27, 0xd2, 0xfa,
+			0x74, 0xc6, 0x35, 0x5c, 0xdc, 0xeb, 0x07, 0xb5,
+			0x87, 0x6a, 0x9e, 0x23, 0xff, 0x62, 0x6c, 0x63,
+			0xd8, 0xbc, 0x71, 0x96, 0x40, 0x3d, 0xc2, 0x41,
+			0x0c, 0x76, 0x32, 0xf2, 0x6b, 0x0b, 0xc6, 0xd1,
+			0xd9, 0xca, 0xa0, 0x41, 0xa1, 0xeb, 0x9d, 0xe5,
+			0x0d, 0x03, 0x27, 0xde, 0x6f, 0x42, 0x47, 0x9e,
+			0x47, 0x75, 0x1f, 0x23, 0xb1, 0x04, 0x14, 0x20,
+			0xde, 0xc4, 0x15, 0x8b, 0x46, 0xdb, 0x7c, 0x77,
+			0x0e, 0x48, 0x66, 0x0e, 0x86, 0x57, 0x88, 0xa3,
+			0x44, 0xd9, 0x2f, 0x47, 0xa5, 0x4a, 0x39, 0x7b,
+			0x3e, 0x43, 0xe4, 0x5f, 0x13, 0x8a, 0x07, 0xe1,
+			0x1b, 0x96, 0x68, 0xb4, 0x87, 0x21, 0xa1, 0xc1,
+			0xba, 0x25, 0x61, 0x74, 0x2d, 0x33, 0x4e, 0x08,
+			0xd6, 0x3b, 0xf7, 0xab, 0xd0, 0xeb, 0x85, 0xaf,
+			0xc7, 0xa8, 0x6c, 0xc6, 0x01, 0x67, 0x29, 0x46,
+			0xb4, 0xef, 0x74, 0xc8, 0xb1, 0xfc, 0x0d, 0x30,
+			0x2d, 0x19, 0x2a, 0x86, 0x13, 0x6a, 0x40, 0xf7,
+			0x9d, 0xd8, 0x83, 0x7a, 0xe4, 0xfc, 0x23, 0x90,
+			0x72, 0x41, 0xa1, 0x75, 0x29, 0x92, 0xb3, 0x56,
+			0xb2, 0x95, 0xe2, 0x6f, 0xe3, 0xd9, 0x3e, 0x04,
+			0xa5, 0xc0, 0x5a, 0xcc, 0x0d, 0xe1, 0x81, 0xf6,
+			0xfb, 0xfd, 0x1a, 0x9c, 0x7d, 0xf2, 0x29, 0x38,
+			0xbb, 0x2f, 0x47, 0x8d, 0xbb, 0x6c, 0xf1, 0xae,
+			0xfc, 0xe1, 0x0f, 0x48, 0xfa, 0xdf, 0x18, 0x31,
+			0xf5, 0xc9, 0xa1, 0x7a, 0x76, 0xc9, 0x5c, 0xd7,
+			0x2a, 0x61, 0x94, 0x9d, 0xe1, 0xb2, 0x16, 0xff,
+			0x5f, 0x73, 0x43, 0x02, 0x7d, 0xf3, 0x00, 0x4a,
+			0xf9, 0xaf, 0x8d, 0x03, 0x84, 0x18, 0xc6, 0x29,
+			0x66, 0xcb, 0x4b, 0x82, 0x96, 0xb2, 0x73, 0x9c,
+			0xa1, 0x9d, 0xe8, 0xc2, 0x69, 0xb1, 0x78, 0x96,
+			0xcc, 0x3f, 0x55, 0x78, 0x36, 0x52, 0x52, 0xc8,
+			0x18, 0x86, 0x1e, 0xc0, 0x33, 0xdc, 0x85, 0x34,
+			0x06, 0xbc, 0x71, 0x51, 0xc5, 0x08, 0x1a, 0xfe,
+			0xb8, 0x84, 0x88, 0x10, 0xf2, 0x66, 0x04, 0x5a,
+			0xa7, 0x31, 0x3c, 0x3c, 0xeb, 0x8a, 0x3c, 0x7a,
+			0x41, 0xf8, 0x37, 0xa2, 0x08, 0xc8, 0x58, 0x07,
+			0xa6, 0xe4, 0x12, 0x4e, 0xcf, 0x38, 0xe1, 0xfb,
+			0x9c, 0x38, 0x57, 0x60, 0xa4, 0xe2, 0xa3, 0x21,
+			0xca, 0x90, 0x76, 0x13, 0x22, 0x01, 0xe7, 0x24,
+			0xfb, 0x9e, 0xf0, 0x92, 0x8a, 0xf5, 0x9a, 0x7f,
+			0x2d, 0x90, 0x9e, 0x12, 0x5c, 0x31, 0x62, 0xe8,
+			0x76, 0x7b, 0xa4, 0x2a, 0xf8, 0xe1, 0xe9, 0xb8,
+			0x56, 0xf6, 0x0e, 0xe0, 0x3f, 0x40, 0x24, 0xd1,
+			0xc2, 0x87, 0xdc, 0xa2, 0x4b, 0x74, 0xe4, 0x58,
+			0xf2, 0xd4, 0x1d, 0x76, 0xba, 0xee, 0x7b, 0x3b,
+			0xaa, 0x83, 0xeb, 0x1c, 0xbd, 0xc9, 0xf9, 0xcb,
+			0x91, 0xf8, 0x80, 0x3b, 0x9a, 0x7b, 0x6e, 0xab,
+			0xa0, 0x2a, 0x41, 0xe4, 0xfd, 0xb8, 0xb7, 0xa7,
+			0x9e, 0x2d, 0x5c, 0x9f, 0x61, 0xf8, 0x51, 0xd1,
+			0x63, 0xc3, 0x99, 0x85, 0xa2, 0xaf, 0x17, 0x5b,
+			0xc4, 0xca, 0xb9, 0x4c, 0x02, 0x54, 0xb6, 0x4b,
+			0xa4, 0x55, 0x2e, 0xf0, 0xab, 0xe2, 0x08, 0x05,
+			0x62, 0x77, 0x19, 0xc8, 0xe7, 0x61, 0x7c, 0x04,
+			0x30, 0x27, 0x59, 0x7a, 0xfb, 0x5a, 0xc4, 0x0a,
+			0xd3, 0xc0, 0x96, 0x45, 0x9d, 0xb6, 0xbe, 0xe6,
+			0x01, 0xbe, 0x7d, 0x00, 0xcd, 0xa1, 0xb8, 0xbc,
+			0xfa, 0xa6, 0xa3, 0x28, 0x8c, 0x9c, 0xd7, 0x29,
+			0xff, 0x71, 0xe3, 0x5c, 0x7e, 0x9b, 0x83, 0xa8,
+			0xe7, 0x4b, 0xad, 0xe0, 0x52, 0xac, 0xc9, 0x55,
+			0x0c, 0xae, 0xfd, 0x78, 0xd8, 0x57, 0x28, 0x09,
+			0xb0, 0xe5, 0x52, 0x7f, 0x19, 0x40, 0x0a, 0x79,
+			0xaa, 0x3e, 0x87, 0xc1, 0xcc, 0x0a, 0xe6, 0x54,
+			0x19, 0xc4, 0xcd, 0x15, 0x13, 0x83, 0x58, 0xd1,
+			0x31, 0xcf, 0xcd, 0x72, 0x08, 0x7b, 0x32, 0xcf,
+			0x9f, 0x1b, 0xf9, 0xcb, 0xfd, 0xca, 0x46, 0xb0,
+			0x84, 0x12, 0xd4, 0xf4, 0x04, 0xca, 0x6c, 0xb6,
+			0x65, 0xa3, 0xfd, 0xfa, 0xca, 0x71, 0x4a, 0x08,
+			0xd3, 0xe3, 0x47, 0xac, 0xa4, 0x51, 0x76, 0x9d,
+			0x5b, 0xed, 0x17, 0xc5, 0x54, 0x69, 0xe4, 0x34,
+			0x40, 0x5a, 0xf2, 0xd9, 0x1a, 0x32, 0x67, 0x48,
+			0x23, 0xf0, 0x5b, 0xa9, 0x4d, 0x3e, 0x50, 0x94,
+			0x13, 0x66, 0x31, 0xe7, 0x58, 0xd7, 0x29, 0xae,
+			0xf7, 0x54, 0xe5, 0x4f, 0x12, 0x46, 0x6e, 0xf8,
+			0x34, 0x86, 0x01, 0xe4, 0xbf, 0x1b, 0x50, 0x74,
+			0x46, 0x59, 0xa4, 0xa0, 0x8c, 0xb0, 0x8d, 0x75,
+			0x98, 0x25, 0x1a, 0x26, 0x28, 0xc3, 0x5a, 0x06,
+			0xe7, 0xa4, 0xe4, 0x6a, 0x35, 0x50, 0x59, 0x1f,
+			0x1a, 0x36, 0xdb, 0x65, 0xca, 0xf8, 0xd8, 0xe7,
+			0x47, 0xb7, 0x63, 0xc6, 0x3c, 0x73, 0xfe, 0x42,
+			0x3b, 0x6c, 0x9b, 0xb3, 0x3e, 0x96, 0x56, 0xe4,
+			0x05, 0x02, 0x76, 0x24, 0xa4, 0x4a, 0xc5, 0x2e,
+			0x3b, 0x98, 0x63, 0xcb, 0x6d, 0xab, 0xde, 0x44,
+			0x0c, 0xaa, 0xc6, 0x2d, 0xc0, 0x29, 0x77, 0x98,
+			0x16, 0x99, 0xf3, 0xce, 0x38, 0x93, 0x76, 0xed,
+			0x67, 0x0d, 0x76, 0x1e, 0x8d, 0x0a, 0xb4, 0xd6,
+			0x19, 0x84, 0x0f, 0x82, 0xe4, 0xb0, 0xec, 0x92,
+			0x95, 0x34, 0x35, 0x2c, 0x13, 0x36, 0x90, 0x4c,
+			0x55, 0x3d, 0x49, 0xaa, 0x30, 0x87, 0xdd, 0x28,
+			0xaf, 0x45, 0x45, 0xa1, 0xbc, 0x72, 0xf0, 0x2d,
+			0xce, 0xa7, 0x1a, 0x06, 0x54, 0xd1, 0xed, 0x89,
+			0x54, 0xa6, 0x29, 0x5c, 0xfe, 0x2b, 0x63, 0x17,
+			0x9d, 0xb0, 0x4d, 0x2f, 0x96, 0xbc, 0x17, 0xaf,
+			0x55, 0xc8, 0x4e, 0x9c, 0x01, 0xae, 0x79, 0xff,
+			0x5f, 0xe8, 0x50, 0xae, 0x97, 0x42, 0x99, 0x0e,
+			0xc4, 0x78, 0xf1, 0xd2, 0xbc, 0x05, 0xa8, 0xe7,
+			0x04, 0x60, 0xd5, 0x04, 0x6f, 0x5b, 0x63, 0xf4,
+			0x84, 0x23, 0x82, 0x3a, 0x0c, 0x75, 0xa1, 0x07,
+			0x4d, 0x4b, 0x47, 0xf1, 0x76, 0x1c, 0xcb, 0x9a,
+			0x13, 0xf6, 0xc2, 0x38, 0xd4, 0xb4, 0x2e, 0x0e,
+			0xee, 0x24, 0x89, 0x13, 0x1c, 0xfc, 0xdb, 0x8e,
+			0x1c, 0x47, 0x76, 0x6b, 0x8c, 0x69, 0xa4, 0x06,
+			0xbe, 0xb4, 0xdb, 0xd0, 0x18, 0x83, 0x89, 0xe0,
+			0x51, 0x51, 0x2d, 0x35, 0x28, 0x4e, 0xe0, 0xff,
+			0xbc, 0xcd, 0x8d, 0xae, 0x46, 0x9b, 0x43, 0x05,
+			0x06, 0xb5, 0x1c, 0x10, 0x6b, 0xdc, 0xb0, 0x66,
+			0x43, 0x48, 0xa0, 0xce, 0x34, 0xb8, 0x0b, 0x61,
+			0xa9, 0x87, 0x91, 0x9a, 0xe8, 0x8e, 0x1f, 0xee,
+			0xc1, 0x93, 0xf5, 0x07, 0x21, 0x82, 0xda, 0x23,
+			0xb8, 0xfa, 0xf5, 0x81, 0xee, 0xdf, 0xaa, 0x64,
+			0xdd, 0x04, 0x96, 0x82, 0xcc, 0x4b, 0xb0, 0x3b,
+			0x80, 0xef, 0x98, 0x7a, 0x56, 0x93, 0xcc, 0x0e,
+			0x80, 0xd1, 0xdb, 0x77, 0x45, 0x36, 0x7f, 0x16,
+			0xa5, 0x4c, 0xb5, 0xc4, 0xc1, 0x81, 0x0c, 0xfc,
+			0xe7, 0x6b, 0x5f, 0x7d, 0x42, 0x0d, 0xe6, 0xd9,
+			0xfa, 0x17, 0xab, 0x3f, 0x4c, 0x76, 0x4f, 0x4f,
+			0x6a, 0x73, 0x01, 0x52, 0x8b, 0x8e, 0x34, 0xb5,
+			0xb5, 0x92, 0x31, 0x02, 0x64, 0x8e, 0x73, 0x48,
+			0x16, 0x4c, 0xc4, 0x0d, 0x28, 0x95, 0x9f, 0x65,
+			0x14, 0x65, 0xa2, 0x18, 0xcc, 0x2b, 0x09, 0x01,
+			0x1e, 0xda, 0xea, 0xa7, 0xec, 0x18, 0x41, 0x82,
+			0x09, 0xbf, 0xa1, 0xb5, 0x15, 0xa1, 0xb6, 0xc9,
+			0xa6, 0x15, 0x1a, 0x6d, 0x64, 0xe8, 0x11, 0xd0,
+			0xea, 0xd7, 0x16, 0x87, 0x47, 0x0d, 0x95, 0x13,
+			0x78, 0x79, 0x83, 0xe6, 0x81, 0x24, 0x0b, 0x43,
+			0xfb, 0x14, 0xd4, 0xef, 0x45, 0x72, 0x92, 0x33,
+			0x2f, 0x37, 0xce, 0x90, 0x20, 0x7c, 0xb8, 0x4e,
+			0xa2, 0x90, 0x42, 0xaf, 0x7b, 0x7e, 0x4f, 0x5f,
+			0xf4, 0x09, 0x8b, 0x06, 0xab, 0x9f, 0x81, 0xfb,
+			0xc3, 0xa9, 0xe1, 0x45, 0x95, 0x1b, 0x3f, 0x0b,
+			0xb9, 0x54, 0xba, 0x1f, 0x9c, 0xdc, 0x47, 0x2b,
+			0x46, 0xe0, 0xaa, 0x73, 0x0a, 0xfb, 0x34, 0x3e,
+			0x89, 0x12, 0x46, 0x37, 0x60, 0xd1, 0x91, 0xf1,
+			0xf2, 0x16, 0xb1, 0xd6, 0xdf, 0xed, 0x3f, 0xb6,
+			0xab, 0x57, 0xe1, 0x17, 0x9f, 0x3c, 0x13, 0x08,
+			0x33, 0x95, 0xf9, 0xd9, 0x8f, 0x08, 0x79, 0x93,
+			0xa4, 0x3d, 0xb7, 0xc1, 0xcc, 0xb0, 0x6c, 0xdd,
+			0x10, 0xc0, 0x07, 0xd0, 0x08, 0x82, 0xa6, 0x85,
+			0x64, 0x55, 0x7c, 0x7e, 0x2f, 0x98, 0x45, 0xf9,
+			0xf3, 0x8e, 0x61, 0x1c, 0xd0, 0xa8, 0x4c, 0xc4,
+			0xb3, 0xb6, 0x6c, 0x4a, 0x58, 0x73, 0x85, 0x1e,
+			0x1c, 0x77, 0x3a, 0xb4, 0xf6, 0x0c, 0x27, 0x95,
+			0xac, 0xeb, 0x29, 0xe8, 0xc2, 0x46, 0xfd, 0x6d,
+			0xf3, 0x4a, 0x30, 0x96, 0xde, 0x84, 0x74, 0xe8,
+			0xdc, 0xcd, 0x34, 0xc9, 0x0f, 0x4e, 0x97, 0x0c,
+			0x86, 0x6e, 0x5a, 0xec, 0x49, 0x27, 0xe9, 0x23,
+			0x4d, 0x32, 0x98, 0xc5, 0xe2, 0xb0, 0xac, 0xec,
+			0x57, 0x58, 0x44, 0x2c, 0x8c, 0xd1, 0x2a, 0x0a,
+			0xe1, 0xe7, 0xda, 0x4c, 0x89, 0x41, 0x62, 0x59,
+			0x2d, 0xba, 0x15, 0x25, 0x78, 0x12, 0x49, 0x6f,
+			0x8a, 0xf5, 0x02, 0xda, 0xf2, 0xc1, 0x09, 0x9e,
+			0x57, 0xe4, 0x9f, 0x10, 0x14, 0xca, 0xe5, 0xaa,
+			0x13, 0xd4, 0x98, 0x19, 0xd5, 0x29, 0x1f, 0x11,
+			0x2d, 0xd0, 0x25, 0xbb, 0x14, 0x0e, 0x7c, 0xf9,
+			0x5e, 0x81, 0x80, 0x8c, 0x59, 0xbf, 0x69, 0x3d,
+			0x04, 0x68, 0x40, 0x93, 0xae, 0xfa, 0x36, 0x97,
+			0xa1, 0x73, 0x72, 0x47, 0xaa, 0x8b, 0x75, 0xc1,
+			0x32, 0xfd, 0x07, 0xa5, 0xb5, 0xcd, 0x6c, 0x12,
+			0x5b, 0xe4, 0x2f, 0x3e, 0x25, 0x13, 0xe2, 0xf3,
+			0xc5, 0x94, 0x5c, 0x36, 0xbb, 0xd4, 0x31, 0x35,
+			0x4f, 0x0a, 0xb0, 0x40, 0x01, 0xec, 0xae, 0x47,
+			0x79, 0x71, 0x99, 0xb2, 0x88, 0xd7, 0x62, 0xe3,
+			0xbb, 0xbc, 0x0e, 0xcf, 0x8b, 0x03, 0xab, 0xf0,
+			0x75, 0x23, 0x16, 0x6e, 0xff, 0xd7, 0x6b, 0x44,
+			0xde, 0x02, 0x0d, 0x63, 0x7c, 0x08, 0x02, 0x8e,
+			0xcd, 0x15, 0x54, 0xf4, 0xb5, 0xf3, 0x20, 0xf5,
+			0x08, 0x58, 0xbf, 0x1b, 0xe5, 0x67, 0x10, 0xda,
+			0x35, 0x25, 0x00, 0x30, 0x7f, 0xc6, 0xd6, 0xb5,
+			0xaf, 0x04, 0x58, 0x95, 0x1a, 0xaa, 0x7e, 0xdc,
+			0xe0, 0x62, 0x38, 0xa8, 0x1c, 0xb1, 0x3e, 0x90,
+			0x46, 0x32, 0x56, 0x63, 0xdf, 0x84, 0xd9, 0x60,
+			0x34, 0x76, 0x58, 0xd8, 0xb0, 0xdc, 0x4b, 0x67,
+			0x8c, 0xa2, 0xd8, 0x59, 0x3a, 0x8c, 0x23, 0xd9,
+			0xed, 0xb2, 0x2d, 0x77, 0xbf, 0x2e, 0xbf, 0x13,
+			0x28, 0xe8, 0x46, 0x25, 0x4f, 0x93, 0x65, 0xdc,
+			0x71, 0x5f, 0x59, 0x95, 0xe4, 0x82, 0x68, 0x25,
+			0x8d, 0xd3, 0xda, 0xd9, 0x6c, 0xa1, 0x48, 0xdf,
+			0xd1, 0x71, 0x64, 0x12, 0xb8, 0xd5, 0x7b, 0x5a,
+			0x00, 0xcc, 0x05, 0x91, 0xc4, 0x08, 0xeb, 0x6a,
+			0x53, 0x79, 0xec, 0x6b, 0x4d, 0x7a, 0xde, 0x6e,
+			0x45, 0x2e, 0x26, 0xc6, 0xd2, 0x54, 0xe4, 0x7e,
+			0xb0, 0x12, 0x7e, 0x49, 0xb2, 0xa3, 0xd4, 0xae,
+			0xfa, 0x78, 0x19, 0x48, 0xe2, 0x97, 0xf8, 0x52,
+			0xcc, 0xd7, 0x47, 0x93, 0xb7, 0xc7, 0x8f, 0x5e,
+			0x29, 0x0c, 0xb9, 0x82, 0x92, 0x97, 0xfc, 0x43,
+			0xbe, 0xd4, 0xc8, 0x33, 0x59, 0x06, 0x21, 0x75,
+			0x77, 0x87, 0xc3, 0x83, 0x27, 0xc7, 0x74, 0xa5,
+			0x2c, 0x95, 0xed, 0xea, 0x48, 0xb4, 0x94, 0xbf,
+			0xd1, 0x1b, 0x0e, 0xa7, 0x41, 0x34, 0xf5, 0x61,
+			0x45, 0x41, 0x0f, 0x84, 0xc5, 0x3e, 0x1a, 0x3e,
+			0x92, 0xb6, 0x5c, 0xc1, 0x9a, 0x4a, 0x99, 0x53,
+			0x06, 0xe3, 0x3a, 0x98, 0x9d, 0x35, 0xb0, 0x2a,
+			0xe5, 0x95, 0x27, 0xbc, 0x49, 0x45, 0x46, 0xd3,
+			0xbe, 0x65, 0x4b, 0x26, 0x5f, 0x03, 0x94, 0xb5,
+			0x49, 0x91, 0x7c, 0x3a, 0x33, 0xd2, 0xe3, 0x0d,
+			0x88, 0x29, 0xdf, 0x47, 0x3f, 0x9a, 0x0b, 0x27,
+			0x44, 0x97, 0xa4, 0x1a, 0x4f, 0x5d, 0x25, 0x4d,
+			0x84, 0xed, 0x4b, 0x1e, 0x3f, 0x16, 0xfb, 0x6a,
+			0xe5, 0x6e, 0x48, 0xa6, 0x0c, 0xf5, 0x99, 0x27,
+			0x4b, 0x9e, 0x16, 0x76, 0x5b, 0x04, 0xb7, 0xe3,
+			0xe1, 0x67, 0x70, 0x34, 0x85, 0x26, 0x7f, 0x2e,
+			0x33, 0xc4, 0x74, 0x6d, 0xa7, 0xe7, 0xb6, 0x19,
+			0x48, 0x60, 0x2a, 0x99, 0x51, 0xec, 0x86, 0x9d,
+			0xd2, 0x3b, 0x72, 0xcf, 0x57, 0x8c, 0x70, 0xd0,
+			0x9b, 0x2c, 0x6a, 0xbb, 0x4c, 0x85, 0x70, 0xef,
+			0xc3, 0x15, 0x4e, 0xb0, 0x65, 0xae, 0xb8, 0x9d,
+			0x56, 0xf4, 0x45, 0x9e, 0x1e, 0xf7, 0xe9, 0x96,
+			0xea, 0x07, 0xa3, 0xad, 0xcc, 0x8f, 0xd9, 0x7a,
+			0x53, 0xa8, 0x62, 0x43, 0xde, 0x37, 0x38, 0x2d,
+			0x0c, 0x9e, 0xf9, 0x3d, 0x24, 0x11, 0xf3, 0x80,
+			0x47, 0x27, 0x10, 0xd6, 0xf8, 0x44, 0x5f, 0x41,
+			0xac, 0x8e, 0x42, 0x0e, 0x41, 0x0a, 0x4b, 0x1d,
+			0x4f, 0xd4, 0xca, 0x1b, 0xd3, 0x08, 0x8f, 0x59,
+			0xff, 0x83, 0xbd, 0x60, 0xa8, 0x89, 0x3d, 0x78,
+			0x29, 0x51, 0xcc, 0xa1, 0x06, 0xfa, 0x46, 0x15,
+			0xb5, 0xa2, 0x18, 0x8b, 0x46, 0x33, 0x07, 0x75,
+			0xfd, 0x39, 0x83, 0xee, 0x91, 0x3f, 0xe9, 0x99,
+			0x9e, 0x27, 0x6e, 0x4c, 0xc2, 0x74, 0xc8, 0xb1,
+			0x9f, 0x38, 0x62, 0x7e, 0x6e, 0x34, 0x22, 0x6c,
+			0x2b, 0x10, 0x03, 0x57, 0xf8, 0x84, 0x74, 0x0e,
+			0x03, 0xed, 0xc3, 0xae, 0x06, 0xc1, 0xb0, 0x02,
+			0x39, 0xd0, 0xcc, 0x42, 0x5f, 0x96, 0x0b, 0xb4,
+			0x70, 0x26, 0xde, 0x1a, 0x75, 0x55, 0xbc, 0xf4,
+			0xd6, 0x3d, 0xca, 0x4c, 0xfc, 0x48, 0x9d, 0x37,
+			0x66, 0x86, 0x0d, 0x72, 0xf6, 0x8b, 0x24, 0x8a,
+			0x01, 0x57, 0xfa, 0xe5, 0x77, 0xe8, 0x30, 0xbf,
+			0x0f, 0x4f, 0x4f, 0x0d, 0x51, 0xa6, 0x5e, 0x34,
+			0x3a, 0xca, 0xd6, 0xbb, 0x93, 0x55, 0xf5, 0xb7,
+			0xa9, 0x64, 0x46, 0x53, 0xc5, 0x1d, 0xcb, 0xcc,
+			0x34, 0x0d, 0x01, 0xe8, 0x6e, 0xe8, 0x79, 0xcc,
+			0x03, 0xfa, 0x0a, 0xbb, 0x51, 0xe8, 0x06, 0xa7,
+			0x3e, 0x54, 0x14, 0x35, 0x66, 0x9e, 0x89, 0x34,
+			0x19, 0x78, 0x90, 0xf5, 0x18, 0x2a, 0x74, 0xc4,
+			0x89, 0xed, 0x75, 0xc3, 0x32, 0xa5, 0xe6, 0x14,
+			0xb5, 0x7a, 0x39, 0x5d, 0x2c, 0xa6, 0x9c, 0x74,
+			0xbb, 0x4d, 0xbb, 0x29, 0xbb, 0x64, 0x05, 0x26,
+			0x65, 0x03, 0xac, 0x34, 0x46, 0xe8, 0x6e, 0x63,
+			0x47, 0x51, 0xab, 0x60, 0xe3, 0xc8, 0x36, 0x66,
+			0x6f, 0xdb, 0xf9, 0x86, 0x88, 0xb6, 0x87, 0xf5,
+			0x56, 0x95, 0xd4, 0x8d, 0x91, 0x01, 0x24, 0xbf,
+			0xb8, 0x99, 0xb9, 0x5e, 0x97, 0x4b, 0x6c, 0xbd,
+			0x31, 0x2d, 0xc5, 0x61, 0x5f, 0x56, 0xf1, 0x08,
+			0x3d, 0x64, 0x72, 0xab, 0xb5, 0x70, 0x8e, 0x90,
+			0xed, 0x83, 0x2b, 0x6c, 0xfd, 0x7e, 0x0d, 0x35,
+			0x5c, 0x71, 0x33, 0x24, 0x6b, 0x0e, 0xd9, 0x0b,
+			0x84, 0x50, 0x98, 0xfd, 0xf3, 0x5b, 0x07, 0xbe,
+			0x87, 0xe6, 0xaf, 0x83, 0x08, 0x4b, 0xf3, 0x86,
+			0x26, 0x73, 0x10, 0xcf, 0x95, 0x0d, 0x56, 0xe9,
+			0xaa, 0x8f, 0xe6, 0xb8, 0x08, 0x10, 0x31, 0xab,
+			0xe8, 0x11, 0x1a, 0x6c, 0x2b, 0x12, 0xc0, 0x4c,
+			0x86, 0x60, 0x91, 0x5e, 0xfe, 0x16, 0x66, 0x20,
+			0xbe, 0x39, 0x95, 0xba, 0xc3, 0x5f, 0xc0, 0x95,
+			0x21, 0x8e, 0x00, 0x8d, 0x57, 0x58, 0xd8, 0x73,
+			0x69, 0x36, 0xef, 0xab, 0x66, 0x29, 0x09, 0x46,
+			0xa9, 0xf2, 0xd6, 0x72, 0x5c, 0x26, 0x6c, 0x24,
+			0x13, 0xa4, 0x63, 0x7b, 0x88, 0x0e, 0x06, 0x73,
+			0x13, 0x19, 0x42, 0xa7, 0xae, 0xb0, 0x00, 0x7d,
+			0x5f, 0xeb, 0x33, 0x71, 0x5c, 0x8a, 0x2d, 0xf0,
+			0xbd, 0x9b, 0x9f, 0x96, 0x74, 0xb4, 0xe4, 0xb6,
+			0x8e, 0x69, 0x6c, 0x90, 0xe9, 0x4c, 0xbc, 0xeb,
+			0x41, 0xe3, 0xec, 0x68, 0x2a, 0x1c, 0xf1, 0xcb,
+			0xad, 0x0c, 0x23, 0x30, 0xb9, 0x19, 0x21, 0xd9,
+			0x9f, 0x4e, 0x29, 0x76, 0xf9, 0xf7, 0xfc, 0xc4,
+			0xb5, 0x28, 0x7b, 0xb6, 0xa3, 0xf6, 0x6f, 0x47,
+			0xdb, 0xe2, 0x2a, 0xb4, 0xf6, 0x61, 0xba, 0xbc,
+			0xd9, 0xb0, 0xff, 0x51, 0xde, 0xe0, 0xbb, 0x17,
+			0x8f, 0x34, 0xd6, 0x41, 0x9b, 0x96, 0xfd, 0xed,
+			0x73, 0xef, 0xde, 0x9e, 0xbe, 0x9c, 0x0d, 0x44,
+			0x36, 0x41, 0x26, 0x8b, 0xe1, 0x02, 0xd8, 0xce,
+			0xdb, 0xba, 0xd0, 0x6b, 0xc4, 0x72, 0x66, 0x30,
+			0x62, 0xf9, 0xef, 0x1a, 0x0f, 0x41, 0x8e, 0xd9,
+			0xbc, 0xfc, 0x76, 0x29, 0x14, 0x8a, 0x80, 0x0a,
+			0x39, 0xea, 0x44, 0x90, 0xec, 0xfd, 0xaa, 0x3a,
+			0xeb, 0xc2, 0xc4, 0x17, 0x4c, 0x79, 0x14, 0x9b,
+			0x9a, 0xfb, 0xac, 0x9f, 0x22, 0xd8, 0x6c, 0xb7,
+			0x44, 0x6f, 0xb6, 0x72, 0xa6, 0xc5, 0x49, 0xda,
+			0xb7, 0x50, 0x45, 0x44, 0xf0, 0xd8, 0x6d, 0xb7,
+			0xe1, 0xb8, 0x27, 0x67, 0x02, 0x63, 0xb1, 0x78,
+			0x52, 0xc5, 0x74, 0x93, 0xd3, 0xc8, 0xde, 0x93,
+			0xd0, 0x54, 0x16, 0xb0, 0xef, 0x3d, 0xf0, 0xe5,
+			0x83, 0x5d, 0x22, 0x05, 0xf6, 0x9d, 0xa3, 0x62,
+			0x8d, 0xd7, 0x93, 0x70, 0xc1, 0xb6, 0x79, 0xc7,
+			0xa4, 0x42, 0x29, 0xca, 0x21, 0xfd, 0xa4, 0xae,
+			0x41, 0x8c, 0x41, 0xd3, 0xa8, 0x92, 0x47, 0x6a,
+			0x76, 0x68, 0xca, 0x86, 0xb6, 0xb0, 0x64, 0xd9,
+			0x06, 0xb1, 0x61, 0xc1, 0xda, 0xaf, 0x3f, 0x67,
+			0x6c, 0x0d, 0xfa, 0xfd, 0xc4, 0xd2, 0x3a, 0xa8,
+			0x47, 0x81, 0x98, 0x97, 0x7c, 0x0d, 0xeb, 0xb6,
+			0x59, 0xbc, 0xca, 0xe6, 0x58, 0x4e, 0x5b, 0x12,
+			0x53, 0xe9, 0x43, 0x30, 0x06, 0x01, 0x1c, 0x48,
+			0x7c, 0x87, 0xa0, 0x6d, 0x31, 0x56, 0xee, 0x63,
+			0x57, 0xb3, 0x0a, 0x3b, 0x11, 0x10, 0xf7, 0x1b,
+			0x7f, 0x08, 0x41, 0xb1, 0x52, 0xb1, 0x1f, 0xb2,
+			0x9f, 0xa9, 0x94, 0x9a, 0xe0, 0xc2, 0xa0, 0x34,
+			0x3f, 0x0b, 0xd7, 0x87, 0xa8, 0x12, 0xbc, 0x43,
+			0xcf, 0xe8, 0xee, 0xe1, 0x54, 0x3a, 0xb9, 0x1d,
+			0x54, 0xdb, 0x10, 0xfd, 0x0e, 0x84, 0xac, 0xb7,
+			0x5a, 0x92, 0x8e, 0x3f, 0x5b, 0x4c, 0x51, 0x57,
+			0x6e, 0x0d, 0xe0, 0x17, 0x63, 0x3f, 0xe9, 0xb3,
+			0xad, 0x2b, 0x37, 0xb8, 0x61, 0x89, 0x01, 0x71,
+			0xf6, 0xb6, 0x93, 0x30, 0xb9, 0xdf, 0x58, 0xb2,
+			0xcb, 0x83, 0xe8, 0xec, 0xb3, 0x73, 0x9e, 0xea,
+			0xdc, 0xd1, 0x05, 0x36, 0xf6, 0x91, 0x26, 0x0d,
+			0xa3, 0x63, 0x66, 0xc6, 0xf9, 0x67, 0x84, 0x1d,
+			0x13, 0xe9, 0x03, 0xa2, 0xaf, 0x88, 0x8c, 0x44,
+			0x2a, 0x77, 0xe2, 0x14, 0x31, 0xe3, 0xb9, 0x90,
+			0xb0, 0xa0, 0xe5, 0x38, 0x4b, 0xf6, 0xc8, 0x28,
+			0x18, 0x41, 0x6b, 0xb1, 0x25, 0x12, 0x0c, 0x02,
+			0x3b, 0x0a, 0x3d, 0x29, 0xf1, 0x4a, 0xc5, 0xdb,
+			0x2c, 0xad, 0x9f, 0x56, 0xe0, 0xc1, 0xe1, 0x83,
+			0xe8, 0xe5, 0x0a, 0xbc, 0x41, 0x18, 0x19, 0xc0,
+			0x9e, 0x5c, 0x9b, 0x31, 0x5a, 0x6b, 0x7e, 0x1a,
+			0xd6, 0xa5, 0x7e, 0x85, 0xb7, 0x7a, 0x45, 0xd2,
+			0xc4, 0x2a, 0xb1, 0x03, 0x2c, 0x95, 0xb8, 0x74,
+			0x8f, 0xf0, 0xbe, 0xef, 0xda, 0xd8, 0xe8, 0xbf,
+			0x9b, 0x2e, 0x26, 0xc1, 0x9b, 0xd7, 0xb9, 0x42,
+			0xd8, 0x74, 0xab, 0xe7, 0x64, 0x26, 0x22, 0x81,
+			0x48, 0x04, 0x8e, 0x99, 0xbd, 0x9f, 0x71, 0xd8,
+			0x6c, 0xfd, 0xa3, 0xba, 0x28, 0x3a, 0x9d, 0x42,
+			0xfa, 0xa0, 0x9a, 0x91, 0x3c, 0xaa, 0x0d, 0x0d,
+			0xb4, 0x7d, 0xab, 0x80, 0x70, 0x8e, 0x24, 0x86,
+			0x45, 0x4d, 0x05, 0x45, 0x2f, 0x06, 0x3e, 0x0c,
+			0xd5, 0x43, 0x6e, 0x58, 0x39, 0xfa, 0x3f, 0x65,
+			0xd3, 0x28, 0x15, 0x9c, 0x59, 0x14, 0x7e, 0x21,
+			0x7f, 0x30, 0x44, 0x3d, 0x04, 0x6b, 0x1f, 0xbc,
+			0x7d, 0x37, 0x90, 0xd2, 0x59, 0x94, 0x23, 0x26,
+			0x21, 0xda, 0x54, 0x93, 0x81, 0x26, 0xc2, 0x1b,
+			0x13, 0x74, 0xcb, 0x8c, 0x08, 0x21, 0x86, 0xcf,
+			0x53, 0x3b, 0xeb, 0x54, 0x94, 0xe0, 0xe4, 0x59,
+			0x68, 0x23, 0x63, 0xd2, 0x12, 0xc3, 0xd9, 0x9d,
+			0x90, 0x2e, 0xc0, 0x12, 0x68, 0xde, 0xce, 0x55,
+			0x89, 0x51, 0x87, 0xbf, 0x75, 0xb4, 0x43, 0x59,
+			0x43, 0xde, 0x17, 0x46, 0x0d, 0x29, 0xd8, 0x35,
+			0xa6, 0x24, 0x9a, 0xb1, 0x34, 0xf5, 0xd0, 0x60,
+			0xbb, 0x47, 0x68, 0x50, 0xd5, 0x9a, 0x11, 0xaa,
+			0x4b, 0xd9, 0x12, 0x80, 0x3c, 0x2a, 0x79, 0x76,
+			0x58, 0x9f, 0xc7, 0xf5, 0xf1, 0xdd, 0x1f, 0xab,
+			0x7d, 0x36, 0x48, 0x3d, 0x6b, 0xc3, 0x9c, 0x97,
+			0x03, 0xe4, 0xa1, 0xde, 0x11, 0x14, 0x77, 0xb8,
+			0x61, 0xaf, 0x1b, 0xbf, 0x11, 0x81, 0x93, 0xa6,
+			0x59, 0x49, 0xf6, 0x18, 0xe7, 0xce, 0x6a, 0xf6,
+			0x6f, 0xc7, 0xa6, 0xfc, 0x6e, 0x05, 0x12, 0x65,
+			0x5b, 0xb6, 0x53, 0x78, 0x27, 0x6b, 0x3d, 0x64,
+			0xa1, 0x98, 0x5c, 0x17, 0x73, 0x46, 0x7b, 0xf9,
+			0x86, 0xd4, 0x3b, 0x36, 0x3a, 0xd2, 0x10, 0x63,
+			0xb6, 0x8c, 0xc8, 0x80, 0xaa, 0x55, 0x22, 0x3c,
+			0x88, 0x66, 0x71, 0x11, 0x63, 0xbd, 0xdd, 0xb8,
+			0x46, 0xab, 0xea, 0xbb, 0xed, 0x74, 0x8e, 0x64,
+			0x93, 0x19, 0x57, 0xc5, 0x6c, 0x6e, 0xb4, 0x62,
+			0xfc, 0xf8, 0x32, 0xf0, 0x39, 0xc8, 0x4e, 0xbb,
+			0x5f, 0xbf, 0xdd, 0x1b, 0x5d, 0xbd, 0xb7, 0x6c,
+			0xe2, 0xce, 0xf0, 0x79, 0x58, 0xec, 0x3d, 0x80,
+			0xfe, 0xe1, 0x8c, 0x02, 0x32, 0x43, 0xd0, 0x86,
+			0x94, 0x2a, 0x4c, 0xf3, 0x9f, 0xa2, 0xe3, 0xc9,
+			0x1f, 0x58, 0x51, 0xa9, 0x84, 0x6a, 0x5e, 0x22,
+			0x60, 0xe1, 0x55, 0x2b, 0xb3, 0xc6, 0x97, 0x05,
+			0xbf, 0x05, 0x40, 0xe6, 0xeb, 0x82, 0x47, 0x42,
+			0xa4, 0x15, 0x78, 0x35, 0x73, 0x5c, 0xe7, 0x71,
+			0x7d, 0xdd, 0x67, 0xaf, 0xf7, 0x56, 0x71, 0x36,
+			0xf9, 0x97, 0x51, 0x7f, 0xbb, 0xac, 0x72, 0x32,
+			0x7a, 0x33, 0xd0, 0xb0, 0xf2, 0x8c, 0x89, 0x74,
+			0x16, 0x10, 0xb4, 0xac, 0x4d, 0xeb, 0x08, 0xb5,
+			0x62, 0x07, 0x66, 0x8e, 0x3f, 0xd7, 0x5c, 0x49,
+			0x25, 0x7e, 0xbd, 0x0c, 0xfc, 0xac, 0xf9, 0x48,
+			0x80, 0x0f, 0xbe, 0x11, 0x78, 0x6e, 0x19, 0xd3,
+			0xf7, 0x6c, 0xa1, 0x4f, 0x9a, 0x7c, 0x0e, 0x8c,
+			0xe2, 0xbc, 0xba, 0xb2, 0x0a, 0xd8, 0x20, 0x93,
+			0xc1, 0xb4, 0x61, 0x13, 0x1d, 0x8a, 0xef, 0xac,
+			0xa8, 0x59, 0x91, 0xe9, 0xf0, 0x75, 0x3e, 0x22,
+			0xfc, 0xe0, 0xc9, 0xda, 0x91, 0x90, 0xe9, 0xd9,
+			0x67, 0x04, 0xad, 0x02, 0xd8, 0xc0, 0x0a, 0x9d,
+			0xaa, 0xd9, 0xd0, 0xa2, 0xf8, 0x84, 0x38, 0x63,
+			0x0b, 0x1c, 0x0c, 0x59, 0xea, 0xbd, 0x65, 0x6d,
+			0x9d, 0xd1, 0xf8, 0x2f, 0x69, 0xd3, 0x98, 0xe6,
+			0x34, 0x28, 0xd9, 0x48, 0x2a, 0x0a, 0x73, 0x6f,
+			0x52, 0xae, 0x6c, 0xcd, 0x0f, 0x45, 0xb6, 0xa2,
+			0xcc, 0xf3, 0xeb, 0x1c, 0x0e, 0x84, 0x62, 0x27,
+			0xfd, 0x2f, 0x1b, 0xd4, 0x25, 0xba, 0xa1, 0xdc,
+			0x61, 0x8a, 0xc3, 0xe5, 0xc8, 0x93, 0x92, 0x89,
+			0x3b, 0x11, 0xc3, 0x2b, 0xdf, 0xa5, 0x09, 0xcf,
+			0x03, 0xe0, 0xb5, 0x08, 0x92, 0xd1, 0xce, 0x73,
+			0x76, 0x80, 0xaf, 0x9c, 0xac, 0xd8, 0x40, 0xe1,
+			0x0f, 0xc1, 0x14, 0x45, 0x62, 0x1a, 0x59, 0x89,
+			0x22, 0x8f, 0xc1, 0x5a, 0x6c, 0x83, 0xf9, 0x5c,
+			0x44, 0x27, 0xd0, 0x4b, 0x55, 0xed, 0x91, 0xb7,
+			0xbf, 0x49, 0x48, 0x4e, 0x72, 0x07, 0x25, 0xc1,
+			0xd8, 0x7c, 0x95, 0xd6, 0x6a, 0x2c, 0x08, 0x7d,
+			0xa2, 0xdc, 0x20, 0x90, 0x8b, 0x0c, 0x59, 0x68,
+			0x6e, 0xa7, 0x25, 0xa5, 0x3c, 0x9c, 0xd8, 0x1a,
+			0xc8, 0xd6, 0x61, 0xf2, 0x8a, 0x53, 0xbc, 0x6a,
+			0x6c, 0x64, 0x3a, 0x40, 0x25, 0x6f, 0xd0, 0x97,
+			0xd7, 0x9c, 0x3b, 0x39, 0xba, 0xc7, 0x10, 0x05,
+			0xb0, 0x5a, 0x37, 0x47, 0x8a, 0x48, 0x38, 0xa5,
+			0xf6, 0xfe, 0xc5, 0xa3, 0x84, 0x5d, 0x5d, 0x68,
+			0x7e, 0x52, 0xa4, 0x7a, 0x75, 0x2d, 0xd0, 0x52,
+			0x18, 0xc6, 0x10, 0x7b, 0x37, 0xbc, 0x0e, 0xea,
+			0x37, 0x08, 0xb7, 0x84, 0x92, 0x66, 0xc1, 0x63,
+			0xf5, 0xcb, 0x62, 0xa7, 0xf5, 0x55, 0x4c, 0xd4,
+			0x84, 0xe6, 0xcd, 0xc9, 0x8d, 0xdb, 0x51, 0xf8,
+			0x53, 0x6b, 0xb5, 0x97, 0xf2, 0x75, 0xcd, 0xae,
+			0x0d, 0x21, 0x97, 0xc3, 0x4e, 0x91, 0xa7, 0xe6,
+			0x9e, 0x90, 0x27, 0x1b, 0x07, 0xe8, 0x5d, 0xa0,
+			0x81, 0x49, 0xb3, 0xf1, 0x12, 0x51, 0x85, 0x4b,
+			0x1d, 0x9f, 0x4d, 0x7e, 0x72, 0x99, 0xcb, 0x69,
+			0xca, 0x21, 0x59, 0x8f, 0x1d, 0x00, 0xad, 0xe0,
+			0x75, 0x78, 0xee, 0xe1, 0x08, 0x89, 0xfe, 0xbe,
+			0xab, 0x8b, 0x23, 0xbe, 0xa4, 0x52, 0xda, 0x81,
+			0xb4, 0x75, 0xe7, 0xb3, 0x9a, 0x44, 0xaf, 0xb2,
+			0x04, 0xc9, 0x68, 0x99, 0x83, 0xdd, 0xbd, 0xc3,
+			0x61, 0x20, 0xee, 0xa1, 0x4e, 0x1e, 0x79, 0xe3,
+			0xa1, 0x7c, 0x59, 0xfe, 0xc7, 0xb8, 0xe3, 0x53,
+			0x10, 0xb5, 0x89, 0xf7, 0x43, 0x4a, 0x9a, 0x07,
+			0x0d, 0x8f, 0x66, 0xc2, 0x30, 0x2c, 0x69, 0xe0,
+			0xed, 0xb0, 0x18, 0x18, 0x9a, 0xf7, 0xd0, 0x1f,
+			0x77, 0xef, 0x03, 0xa4, 0xd3, 0x03, 0xb8, 0xb8,
+			0xc2, 0x5b, 0xfb, 0x20, 0xb4, 0x81, 0x65, 0xdf,
+			0xbc, 0xc0, 0x7e, 0xe1, 0x9f, 0x83, 0x5e, 0xb1,
+			0xe7, 0xf9, 0xe3, 0xcf, 0xf8, 0x2e, 0xce, 0xd7,
+			0x31, 0xb5, 0x84, 0x82, 0xdc, 0x25, 0x90, 0xb6,
+			0xc3, 0xfb, 0x45, 0x8b, 0xad, 0x94, 0xf4, 0x09,
+			0x74, 0x6f, 0x1b, 0xc6, 0x9a, 0x87, 0x49, 0x4d,
+			0xb6, 0xc2, 0x37, 0x0d, 0xef, 0x3f, 0x2a, 0xeb,
+			0xae, 0xec, 0x0b, 0x3a, 0xaa, 0x3c, 0xb7, 0x79,
+			0xfb, 0x67, 0xc1, 0x1b, 0x98, 0xef, 0xbe, 0xf5,
+			0x9e, 0x8b, 0x8d, 0x07, 0x96, 0x8a, 0xb1, 0xcf,
+			0xb7, 0x47, 0xf1, 0x8f, 0xd2, 0x7b, 0xe1, 0x94,
+			0x21, 0x1c, 0xf3, 0xdf, 0x8f, 0xf4, 0xbc, 0x8c,
+			0xd4, 0x2d, 0xe6, 0x8b, 0xc3, 0x14, 0xd7, 0x32,
+			0x0e, 0x81, 0x29, 0x2a, 0x08, 0x52, 0xa3, 0x4b,
+			0x25, 0xc0, 0x4f, 0x8c, 0xcd, 0x37, 0x45, 0xbc,
+			0xc6, 0x35, 0xcb, 0x2b, 0x22, 0x11, 0x2c, 0x7c,
+			0x88, 0x95, 0xb4, 0x09, 0xe4, 0x08, 0x6f, 0x0f,
+			0xe6, 0xa0, 0x17, 0x98, 0x90, 0xbf, 0x26, 0x7a,
+			0x44, 0x50, 0x53, 0xb7, 0x97, 0x88, 0x37, 0x3b,
+			0x26, 0xe5, 0xf9, 0x42, 0x95, 0xf0, 0x93, 0x84,
+			0x52, 0x7d, 0xa3, 0xb0, 0x51, 0xe1, 0x2b, 0xd5,
+			0x46, 0x77, 0xa8, 0xbb, 0x97, 0xd8, 0x83, 0xad,
+			0x2e, 0xad, 0xc2, 0x64, 0xd0, 0xab, 0x74, 0x84,
+			0x39, 0x3e, 0x13, 0x84, 0x14, 0x62, 0xb2, 0x7c,
+			0xe2, 0x4a, 0x50, 0xc4, 0x5d, 0x2b, 0x5a, 0x2a,
+			0x39, 0xbe, 0x20, 0xb1, 0x8b, 0x3c, 0x92, 0x39,
+			0xfc, 0x2e, 0x65, 0x1b, 0x24, 0xb2, 0x37, 0x54,
+			0x8e, 0x83, 0x3e, 0x83, 0xcc, 0x83, 0x3b, 0xe7,
+			0x80, 0x36, 0x03, 0xe7, 0x1c, 0x40, 0x2a, 0xb7,
+			0xa4, 0x02, 0x7c, 0x31, 0x3a, 0x19, 0x13, 0x13,
+			0x63, 0x16, 0x8b, 0x75, 0xa4, 0x93, 0xe3, 0x26,
+			0x92, 0x83, 0xc0, 0xd3, 0x0c, 0x78, 0xf3, 0x0c,
+			0x21, 0xf1, 0xa8, 0x99, 0x85, 0xd5, 0x3d, 0xe4,
+			0x29, 0x97, 0xa2, 0xd3, 0xac, 0xda, 0xb0, 0xea,
+			0x17, 0x0e, 0x2d, 0x95, 0xeb, 0x62, 0x15, 0x79,
+			0x2d, 0x10, 0x2c, 0x65, 0xa4, 0xc9, 0x73, 0xd7,
+			0x82, 0xf5, 0xd6, 0xf4, 0xaf, 0x63, 0x6c, 0x8e,
+			0x91, 0x88, 0xee, 0xe7, 0xae, 0x9b, 0xc4, 0x03,
+			0x02, 0x16, 0xc8, 0x32, 0x05, 0xbb, 0x99, 0x50,
+			0x17, 0x3f, 0xe1, 0x23, 0xac, 0xfc, 0xf9, 0x7d,
+			0xa0, 0x2f, 0x9c, 0x8e, 0x05, 0x8d, 0x56, 0x8f,
+			0xdb, 0x79, 0x6d, 0xf1, 0x9a, 0xe3, 0x26, 0xf9,
+			0x1f, 0x2e, 0x74, 0x85, 0xd2, 0x1a, 0xca, 0x9b,
+			0x1c, 0x9b, 0x19, 0x0b, 0xfa, 0xd3, 0x4c, 0xcf,
+			0xe8, 0x99, 0xa9, 0xb5, 0x3c, 0xd2, 0xdd, 0xfa,
+			0x8c, 0x21, 0xc8, 0xe0, 0xcb, 0x51, 0xa8, 0x3d,
+			0xc8, 0x7e, 0x8b, 0x62, 0x70, 0x1a, 0x7e, 0x87,
+			0x8a, 0xb0, 0xb5, 0x09, 0xe6, 0x79, 0xe9, 0xbf,
+			0x48, 0xd1, 0x60, 0x0f, 0x20, 0x87, 0x22, 0x1e,
+			0xd7, 0x99, 0xa4, 0x91, 0xd6, 0x61, 0x24, 0xfc,
+			0x01, 0x07, 0x11, 0x3d, 0xfc, 0xb1, 0x4f, 0x2e,
+			0xf0, 0xd0, 0x77, 0xa1, 0xc8, 0xd3, 0xc6, 0xbb,
+			0x9c, 0x5a, 0xf8, 0xf3, 0x75, 0xe3, 0x44, 0x22,
+			0xba, 0xf3, 0xfa, 0x27, 0x2e, 0x53, 0x3f, 0xf4,
+			0x3b, 0xd0, 0x45, 0xf5, 0xe1, 0xbf, 0x84, 0x89,
+			0x63, 0x47, 0xc5, 0xe5, 0x15, 0x26, 0xe1, 0x8f,
+			0xd0, 0x4b, 0xf4, 0xdd, 0x97, 0x03, 0x5e, 0x09,
+			0x1c, 0x3c, 0xea, 0xf7, 0x53, 0xb1, 0xae, 0xdb,
+			0xa2, 0x94, 0xba, 0x7b, 0xea, 0xaa, 0x61, 0xda,
+			0x76, 0x59, 0x6c, 0x4e, 0x7c, 0x3d, 0x1e, 0x95,
+			0x43, 0x19, 0x02, 0xf6, 0x14, 0x13, 0xc0, 0xde,
+			0xaa, 0x45, 0x6e, 0x70, 0xf0, 0xdb, 0x5b, 0x80,
+			0x8d, 0x73, 0x1d, 0x0d, 0xa7, 0xdd, 0x5f, 0xba,
+			0x60, 0xf5, 0xbc, 0x67, 0xe1, 0xfd, 0x12, 0x96,
+			0xd0, 0x63, 0x78, 0x16, 0x4a, 0x04, 0x86, 0xd4,
+			0x99, 0xcc, 0xe5, 0xbf, 0xb2, 0x58, 0xb7, 0x20,
+			0xc5, 0xa9, 0x4e, 0xfe, 0xb3, 0x8c, 0x05, 0x58,
+			0xf1, 0xcc, 0x83, 0x60, 0xbf, 0xec, 0xa5, 0x62,
+			0xb1, 0x40, 0x30, 0x7a, 0xf3, 0x52, 0x0b, 0xac,
+			0x05, 0x63, 0x3e, 0xe5, 0x8e, 0x6d, 0xca, 0x91,
+			0x04, 0xb4, 0x1b, 0xce, 0xcf, 0xc5, 0x3b, 0xff,
+			0x26, 0x7d, 0xa4, 0x33, 0x57, 0x65, 0xbf, 0x5a,
+			0x88, 0xd4, 0x74, 0xa4, 0xed, 0x1c, 0xbf, 0x26,
+			0xa7, 0x1a, 0x0f, 0xd0, 0xa1, 0xee, 0x92, 0xd6,
+			0x65, 0xae, 0x5e, 0xde, 0xca, 0xfc, 0xb0, 0xde,
+			0x44, 0xc4, 0xe2, 0x07, 0xde, 0xa5, 0xeb, 0x6f,
+			0x16, 0xb1, 0x63, 0xcb, 0x78, 0x14, 0x08, 0xfc,
+			0xb0, 0x97, 0x4e, 0x2f, 0x97, 0x5f, 0x58, 0x49,
+			0xbb, 0x23, 0x3a, 0xbd, 0xbc, 0x18, 0x1d, 0x53,
+			0xbd, 0xba, 0x26, 0xa1, 0xf8, 0xe4, 0x5e, 0x0b,
+			0xc7, 0xe7, 0x94, 0xad, 0x64, 0x1f, 0x0c, 0x2d,
+			0xb5, 0x17, 0x51, 0x0e, 0x0b, 0x73, 0x36, 0x7a,
+			0x1d, 0x48, 0x12, 0xd4, 0x86, 0xff, 0x52, 0x9f,
+			0x1d, 0x25, 0x99, 0xe5, 0x00, 0xa9, 0x88, 0x4e,
+			0xa6, 0x7c, 0x18, 0x1b, 0x23, 0x87, 0xec, 0x4b,
+			0xfa, 0x35, 0x93, 0x7f, 0x23, 0x4d, 0xd4, 0x49,
+			0xc2, 0x7a, 0x3c, 0x05, 0xff, 0xbf, 0xe4, 0xf2,
+			0x73, 0xe2, 0x95, 0x86, 0x19, 0xf5, 0x5a, 0xa2,
+			0xed, 0xa1, 0x37, 0x5f, 0x11, 0x29, 0x7d, 0x6c,
+			0xc4, 0xe7, 0x65, 0xa6, 0x44, 0xf9, 0xf8, 0xe7,
+			0x0c, 0xba, 0x71, 0x33, 0xc0, 0xb4, 0x6e, 0x91,
+			0xfb, 0xbd, 0x9e, 0x48, 0x2c, 0xff, 0xcc, 0x8b,
+			0x5f, 0xfa, 0x01, 0x21, 0x44, 0xbb, 0x35, 0xf1,
+			0x75, 0x54, 0x1e, 0x8c, 0x65, 0x13, 0xb5, 0x32,
+			0x62, 0xef, 0x0e, 0x52, 0x17, 0xad, 0x53, 0x17,
+			0x04, 0xb8, 0xb7, 0x30, 0xdf, 0xe6, 0xa3, 0x58,
+			0x55, 0xfa, 0x48, 0x72, 0x34, 0x58, 0x20, 0x12,
+			0x38, 0xe2, 0x4a, 0x25, 0x5b, 0xaf, 0x11, 0xab,
+			0x0d, 0xb2, 0x2a, 0x0b, 0xbc, 0xb1, 0xe4, 0x47,
+			0x78, 0x19, 0x8c, 0x1d, 0xcb, 0x4f, 0xd7, 0x1c,
+			0xa5, 0xcd, 0xeb, 0x44, 0x7f, 0x0c, 0x07, 0xbe,
+			0xaf, 0xad, 0x2b, 0x18, 0xed, 0x1d, 0xee, 0x42,
+			0x82, 0x86, 0x11, 0x03, 0x85, 0x58, 0xee, 0xe5,
+			0x06, 0x6d, 0x66, 0x13, 0x6d, 0xd8, 0xe4, 0xe0,
+			0xbc, 0x0a, 0x84, 0x49, 0xbf, 0xe1, 0x0f, 0x50,
+			0xd6, 0x17, 0x30, 0xc2, 0x1a, 0x8d, 0x93, 0xf4,
+			0x36, 0x67, 0xd1, 0xae, 0x4d, 0x9e, 0xdf, 0xa4,
+			0xe8, 0x71, 0xbc, 0x42, 0xfb, 0xf7, 0xbb, 0x78,
+			0xde, 0x95, 0x1c, 0x5a, 0x9c, 0x67, 0x72, 0xb7,
+			0x52, 0xdc, 0x55, 0x51, 0x42, 0x9d, 0xd3, 0x37,
+			0xd2, 0xf1, 0x17, 0x1f, 0xe0, 0xd1, 0x58, 0x94,
+			0x89, 0xb9, 0x94, 0x13, 0x53, 0xd4, 0x6e, 0x03,
+			0x1a, 0xb6, 0x81, 0x07, 0x34, 0x79, 0x92, 0x4d,
+			0x02, 0x7f, 0x97, 0x7e, 0x5a, 0x41, 0xf8, 0x6c,
+			0xfc, 0x21, 0x13, 0x02, 0xb4, 0x3d, 0x0b, 0x4e,
+			0x36, 0xfd, 0x11, 0x29, 0xdf, 0xe3, 0xff, 0xbb,
+			0xa0, 0xc5, 0x67, 0x7f, 0x97, 0xde, 0xd1, 0x8a,
+			0x38, 0xa0, 0xea, 0x83, 0x32, 0x22, 0xe8, 0xa4,
+			0x2a, 0x71, 0xaa, 0x78, 0x90, 0xf3, 0xe1, 0x1a,
+			0xc8, 0xc9, 0xa7, 0xe8, 0xc0, 0x27, 0x36, 0x36,
+			0xda, 0xc3, 0xbd, 0xc1, 0x3d, 0x5e, 0xe1, 0xd2,
+			0xc9, 0x8b, 0x32, 0x35, 0x7b, 0x13, 0x16, 0x90,
+			0xbc, 0xbe, 0xec, 0xf7, 0x7c, 0x36, 0x5e, 0xf3,
+			0xe5, 0x17, 0xab, 0xb4, 0xea, 0xe0, 0xe7, 0x2d,
+			0x2a, 0x11, 0xd8, 0x63, 0xdb, 0x1d, 0x30, 0x9d,
+			0xa1, 0xa7, 0x71, 0xe9, 0xd1, 0xdd, 0xca, 0xe3,
+			0xe5, 0x6b, 0x34, 0xb9, 0x9b, 0x70, 0x2b, 0x05,
+			0xba, 0xb4, 0xc1, 0xe9, 0x74, 0xd3, 0x0f, 0x3b,
+			0xa3, 0xef, 0x31, 0x28, 0xc5, 0x5f, 0x1b, 0x47,
+			0xf7, 0x62, 0xcb, 0x85, 0xb7, 0x0e, 0x3a, 0xa2,
+			0x62, 0x53, 0x6e, 0xac, 0x54, 0xf8, 0xac, 0x0b,
+			0xc7, 0xb3, 0x53, 0x21, 0xbf, 0xec, 0x52, 0x1d,
+			0x4c, 0x00, 0x4d, 0xed, 0xc2, 0xae, 0x71, 0x0a,
+			0xb4, 0x98, 0x9d, 0x6c, 0x90, 0x62, 0xfa, 0xad,
+			0x75, 0x8d, 0xa0, 0x5c, 0x20, 0x0c, 0x60, 0x27,
+			0x15, 0xa3, 0x98, 0x81, 0xae, 0x0b, 0x68, 0x4c,
+			0x02, 0xf0, 0x6d, 0x39, 0x3d, 0x24, 0xf1, 0x29,
+			0x05, 0xb2, 0x5e, 0x4c, 0xc6, 0xd0, 0x87, 0x48,
+			0xed, 0xd2, 0x5f, 0xff, 0x9d, 0x2c, 0x9f, 0x32,
+			0xb1, 0x06, 0x7a, 0xc4, 0xcb, 0x70, 0xee, 0x54,
+			0x7a, 0x18, 0x89, 0x47, 0x89, 0x51, 0xcc, 0xfa,
+			0x33, 0xa6, 0x02, 0xda, 0xc8, 0x9a, 0x35, 0x41,
+			0x22, 0x52, 0x67, 0xb9, 0xe9, 0x3a, 0xdd, 0x7b,
+			0xc7, 0x2f, 0x60, 0x72, 0x95, 0xc7, 0xb6, 0x99,
+			0x18, 0x1b, 0xfa, 0xb1, 0x30, 0xb8, 0xb7, 0x54,
+			0xc1, 0xaf, 0x61, 0xb1, 0xf4, 0x12, 0xd3, 0xaf,
+			0x81, 0xf1, 0x53, 0x6f, 0xdb, 0x67, 0xfc, 0x83,
+			0x7d, 0x90, 0xb4, 0xe1, 0x22, 0xd1, 0x3b, 0xa2,
+			0xe1, 0x5d, 0xbe, 0xcb, 0xfc, 0x02, 0xfe, 0xad,
+			0x65, 0x6d, 0xfc, 0xef, 0x02, 0x34, 0xb6, 0x73,
+			0x18, 0x55, 0x04, 0x81, 0x9f, 0x37, 0xc9, 0x21,
+			0x2a, 0x3c, 0x1a, 0x44, 0x97, 0x23, 0x7b, 0x11,
+			0x77, 0x58, 0x2e, 0xc4, 0x64, 0xcd, 0x28, 0x29,
+			0x64, 0x27, 0x89, 0x13, 0xaa, 0x43, 0x6a, 0xb0,
+			0x6a, 0x6b, 0xb7, 0x4a, 0xeb, 0x2e, 0xdb, 0x40,
+			0xcc, 0x00, 0x97, 0x14, 0x01, 0x23, 0x0b, 0xa5,
+			0x60, 0xe4, 0x7c, 0x9c, 0xe1, 0x5f, 0x3b, 0x2c,
+			0x9f, 0x99, 0xee, 0xdc, 0x8c, 0xc6, 0x73, 0xec,
+			0xb8, 0x69, 0x7c, 0x62, 0x0e, 0xe1, 0x9f, 0x75,
+			0x39, 0xaf, 0xb6, 0x18, 0x32, 0x75, 0x2f, 0xfd,
+			0x33, 0x47, 0xda, 0xff, 0x81, 0xac, 0x8b, 0x58,
+			0x11, 0xc4, 0x6a, 0x53, 0xba, 0x91, 0xf3, 0x71,
+			0x86, 0x0f, 0xac, 0xe9, 0x07, 0x68, 0xf5, 0x4a,
+			0x8d, 0x91, 0xca, 0x6e, 0xe8, 0x9c, 0xae, 0x49,
+			0x83, 0xcc, 0x4b, 0xe3, 0x05, 0x40, 0xc1, 0x01,
+			0x5a, 0xfe, 0xc4, 0x7c, 0x3e, 0x63, 0x47, 0x6e,
+			0x5d, 0x6e, 0x60, 0x05, 0x4d, 0x8b, 0x46, 0x9b,
+			0xa9, 0xbc, 0x48, 0xf8, 0x96, 0x81, 0x05, 0x90,
+			0xd8, 0x70, 0x4a, 0x92, 0x5d, 0x7f, 0x74, 0xbd,
+			0xbe, 0x9d, 0x62, 0x1d, 0x5a, 0x8d, 0x6e, 0x6a,
+			0x15, 0x86, 0x99, 0x85, 0x59, 0x9d, 0x55, 0x1f,
+			0xa9, 0xf6, 0xfd, 0x9d, 0x7e, 0xc2, 0xfc, 0x69,
+			0xf7, 0xba, 0x52, 0x26, 0x9e, 0x16, 0xbb, 0x6f,
+			0xb5, 0xdf, 0xb8, 0x8b, 0xb2, 0x05, 0x4e, 0x2e,
+			0x5d, 0xcb, 0xd7, 0x05, 0xfe, 0x29, 0x46, 0xbf,
+			0xde, 0x22, 0xc7, 0x85, 0x07, 0x63, 0xeb, 0x92,
+			0xca, 0x88, 0xa0, 0x61, 0x08, 0x19, 0x9e, 0x45,
+			0x26, 0xcd, 0x3b, 0x3c, 0x2f, 0xc4, 0xa9, 0x1c,
+			0xa6, 0x51, 0x58, 0xa3, 0x2b, 0xc5, 0x7f, 0xb6,
+			0x91, 0x5d, 0x2e, 0xb2, 0x00, 0xc6, 0x71, 0x5e,
+			0x6b, 0xee, 0xe9, 0xb9, 0xb6, 0xb4, 0x08, 0xe7,
+			0xcf, 0x7f, 0x68, 0x7b, 0x2a, 0xaf, 0x27, 0x49,
+			0x7e, 0x3f, 0x93, 0x9b, 0x6c, 0x13, 0x1b, 0xe6,
+			0xb1, 0x25, 0x60, 0xa5, 0x70, 0x34, 0x3c, 0x9c,
+			0xf1, 0x2c, 0x1f, 0x30, 0xe5, 0xce, 0x8d, 0xdb,
+			0x7e, 0x6c, 0x2a, 0x84, 0x14, 0x28, 0x11, 0x2e,
+			0x5c, 0x20, 0x70, 0x7f, 0x7e, 0x09, 0x04, 0xc5,
+			0x5d, 0x3d, 0xdd, 0xa4, 0x00, 0xf0, 0x13, 0x01,
+			0x94, 0xeb, 0xca, 0xed, 0xff, 0x62, 0x4d, 0x0d,
+			0x55, 0x55, 0x9c, 0xf3, 0xf3, 0x67, 0x8c, 0xe8,
+			0xaf, 0x02, 0xe0, 0x74, 0x75, 0x10, 0x1a, 0xcd,
+			0x8f, 0x72, 0x7c, 0xd5, 0xf2, 0x19, 0xc8, 0xec,
+			0x40, 0xdf, 0xce, 0x21, 0x41, 0x48, 0x5e, 0x8d,
+			0x48, 0xf2, 0x6b, 0x06, 0xf9, 0x90, 0xae, 0xc5,
+			0xb8, 0xd7, 0xaf, 0x51, 0x4e, 0xd0, 0x0e, 0x47,
+			0x30, 0xd6, 0x8f, 0x4f, 0xe3, 0xc3, 0x55, 0x61,
+			0xc1, 0xc5, 0x60, 0x32, 0xe8, 0x1d, 0xf0, 0xe5,
+			0xc0, 0x83, 0x9d, 0xea, 0x33, 0x69, 0xf2, 0x2d,
+			0x00, 0xdb, 0x55, 0xc5, 0x46, 0x4a, 0x2b, 0x53,
+			0x44, 0xdf, 0x43, 0x29, 0xa3, 0x9a, 0x86, 0xb4,
+			0xb6, 0x7d, 0x6f, 0xde, 0xf6, 0x70, 0x5e, 0x51,
+			0x7d, 0x6f, 0xda, 0x99, 0x76, 0x5f, 0x45, 0xc2,
+			0xe7, 0xd8, 0xcc, 0x1c, 0x46, 0xca, 0x62, 0x8f,
+			0x7d, 0x42, 0xc7, 0x7f, 0xd2, 0x01, 0x7c, 0x7c,
+			0x4f, 0x1d, 0x88, 0x79, 0x21, 0xe6, 0xb3, 0xd6,
+			0x41, 0x8b, 0x95, 0x4d, 0xec, 0xec, 0x45, 0x3a,
+			0x21, 0xe6, 0x2b, 0xd2, 0x99, 0x51, 0x60, 0x80,
+			0x87, 0x3f, 0xfb, 0xa3, 0x3f, 0x0b, 0xfc, 0x62,
+			0x86, 0x51, 0x97, 0x6b, 0x0a, 0xdd, 0xb2, 0x49,
+			0xc5, 0xbc, 0x41, 0xc1, 0x40, 0x1e, 0xdc, 0x03,
+			0x05, 0xb0, 0x7f, 0x66, 0xbe, 0xf6, 0xef, 0x54,
+			0xd5, 0x09, 0xcd, 0xa6, 0xed, 0xe5, 0x44, 0xb2,
+			0x78, 0x8d, 0xbf, 0x7f, 0x96, 0xaf, 0x96, 0x26,
+			0x73, 0x45, 0xa0, 0xb7, 0xec, 0x1c, 0x5c, 0x7f,
+			0xd3, 0x97, 0x10, 0xdf, 0x68, 0xee, 0xfe, 0x96,
+			0x31, 0x2f, 0x96, 0x0f, 0x69, 0xaf, 0x3b, 0x3f,
+			0x13, 0x29, 0x79, 0x76, 0xa8, 0xa1, 0x39, 0x8b,
+			0xbe, 0xc2, 0x14, 0x94, 0x68, 0x7a, 0x51, 0x63,
+			0xde, 0xb3, 0xa9, 0x59, 0x26, 0x2f, 0xe5, 0xef,
+			0x9d, 0x7c, 0xa7, 0x76, 0x4d, 0x65, 0x3c, 0x33,
+			0x72, 0xd2, 0x71, 0x3a, 0xb7, 0x77, 0x44, 0x45,
+			0xbf, 0xa8, 0x64, 0x53, 0xc3, 0x23, 0x54, 0xdf,
+			0x25, 0x80, 0xe0, 0x54, 0x3a, 0xf7, 0x29, 0x41,
+			0x29, 0x02, 0x11, 0x3f, 0x76, 0x0e, 0x8c, 0x8e,
+			0x9d, 0xa8, 0xe2, 0x92, 0x5d, 0x8e, 0x59, 0xd4,
+			0xd9, 0xb3, 0x37, 0x7b, 0xde, 0x3f, 0xef, 0x4a,
+			0x75, 0x36, 0xb8, 0x10, 0x89, 0x26, 0x5d, 0x4a,
+			0xf6, 0x49, 0x4a, 0x58, 0x45, 0xce, 0xeb, 0x44,
+			0xa1, 0xf9, 0x74, 0x36, 0x5a, 0xf3, 0x1b, 0xa1,
+			0xc8, 0xb0, 0x03, 0xfb, 0xc0, 0xee, 0xe2, 0x46,
+			0x68, 0xa5, 0xe2, 0x82, 0xcc, 0x62, 0x1d, 0xe7,
+			0x24, 0x01, 0x65, 0x65, 0xce, 0x97, 0xc6, 0xee,
+			0x24, 0xf6, 0xef, 0xb8, 0x7c, 0x82, 0x8c, 0x7e,
+			0x6b, 0x23, 0x14, 0xb6, 0x03, 0x00, 0x4b, 0x3b,
+			0xb3, 0x1c, 0xa2, 0xa4, 0x5f, 0x9e, 0x83, 0xb5,
+			0xb6, 0x01, 0xc2, 0x8a, 0x7b, 0x95, 0x86, 0xa9,
+			0xba, 0x96, 0x7c, 0x92, 0x0b, 0xdb, 0xf7, 0x82,
+			0x26, 0xcf, 0xfd, 0x71, 0x0d, 0xb4, 0xc7, 0xbb,
+			0x73, 0xbe, 0xb6, 0x60, 0x91, 0xe8, 0xd2, 0x46,
+			0x90, 0x2c, 0x26, 0x68, 0x03, 0x7e, 0x4e, 0x44,
+			0x41, 0x83, 0x95, 0x9d, 0xb2, 0xff, 0x22, 0xea,
+			0x8c, 0xa1, 0x02, 0x94, 0x4d, 0x1e, 0x5f, 0x9f,
+			0x74, 0xec, 0xe8, 0x7b, 0xa9, 0x64, 0xdc, 0xa6,
+			0x77, 0xe9, 0xc8, 0x6a, 0x65, 0x61, 0xe4, 0xe1,
+			0x35, 0x75, 0xed, 0x36, 0xed, 0x1e, 0xdd, 0x61,
+			0xb1, 0xac, 0x13, 0x28, 0x85, 0x05, 0x2e, 0xeb,
+			0x87, 0xc3, 0x39, 0x55, 0xd6, 0x49, 0x49, 0x26,
+			0x4a, 0xde, 0xdd, 0xb9, 0xad, 0xd0, 0x2c, 0xf8,
+			0x8b, 0x39, 0x0e, 0xe0, 0x79, 0x3f, 0xb7, 0xf9,
+			0x09, 0x88, 0xfe, 0x06, 0x94, 0x68, 0xb5, 0xe8,
+			0x38, 0x4c, 0xe4, 0x2c, 0xad, 0xd9, 0x0e, 0x75,
+			0x53, 0x4d, 0x08, 0x75, 0xc8, 0x23, 0xca, 0xfd,
+			0x13, 0xe3, 0x56, 0xa3, 0x59, 0xf5, 0x97, 0xce,
+			0x69, 0xcf, 0x20, 0x3b, 0x79, 0xe8, 0x2d, 0x68,
+			0xe3, 0x12, 0xbc, 0xa8, 0xdc, 0x53, 0xc2, 0xc2,
+			0x3e, 0xa6, 0x3d, 0xab, 0x15, 0x5d, 0x20, 0x29,
+			0xfe, 0xdd, 0x85, 0x9e, 0x4e, 0xaf, 0x41, 0xb1,
+			0x2c, 0x2b, 0x96, 0x46, 0xb1, 0xbe, 0x0d, 0x44,
+			0x8f, 0xf9, 0x80, 0x02, 0xfc, 0x5f, 0x8b, 0x32,
+			0xac, 0x0d, 0xbd, 0x60, 0xd8, 0x5a, 0xd4, 0xde,
+			0x76, 0x1b, 0x95, 0xd3, 0x5e, 0xe1, 0x83, 0x85,
+			0x52, 0x30, 0x50, 0x2c, 0x83, 0xb6, 0x86, 0x73,
+			0xb1, 0xa2, 0xe5, 0x67, 0x49, 0x0a, 0x40, 0x01,
+			0xa0, 0xb8, 0xf2, 0x5e, 0x03, 0xa8, 0xa4, 0x40,
+			0x45, 0x48, 0xf8, 0x25, 0xb0, 0x1f, 0xba, 0xea,
+			0xa5, 0x41, 0xfb, 0x89, 0x01, 0x1a, 0xad, 0xf4,
+			0x86, 0x2c, 0xeb, 0x17, 0x13, 0x86, 0xcf, 0xa3,
+			0x81, 0x14, 0x16, 0x28, 0x39, 0x7d, 0xe3, 0x67,
+			0x59, 0xe2, 0x06, 0xee, 0x63, 0x13, 0xfc, 0xd0,
+			0x12, 0x4a, 0xc1, 0x58, 0x98, 0x72, 0x17, 0x5f,
+			0xd7, 0x0a, 0x11, 0x2e, 0x68, 0x23, 0xa2, 0xed,
+			0x80, 0x61, 0x83, 0x95, 0x13, 0x3d, 0xed, 0x71,
+			0x89, 0x87, 0x11, 0xb7, 0x76, 0x4a, 0x1a, 0xb5,
+			0x2a, 0x0a, 0xa0, 0x93, 0x85, 0x94, 0xe0, 0xc6,
+			0x80, 0xaf, 0x7b, 0xfe, 0x04, 0x76, 0xd7, 0x9e,
+			0x11, 0x65, 0xd4, 0x21, 0x17, 0x71, 0xcb, 0x0d,
+			0xbd, 0xc1, 0xdf, 0x7b, 0x3c, 0xff, 0x2e, 0x88,
+			0x73, 0x18, 0x4c, 0x02, 0x16, 0x21, 0x43, 0x57,
+			0xd0, 0x1f, 0xe9, 0x36, 0x42, 0xd1, 0x83, 0xe1,
+			0xa0, 0xe0, 0x22, 0x92, 0x9a, 0x86, 0x20, 0xe6,
+			0x65, 0xce, 0x59, 0x2e, 0xf8, 0xac, 0x24, 0x27,
+			0x9b, 0x07, 0xe2, 0x24, 0xc6, 0xeb, 0x1f, 0xdf,
+			0xe7, 0x11, 0x1a, 0xee, 0xd8, 0xc0, 0x55, 0x21,
+			0x64, 0xf9, 0x08, 0x1e, 0x74, 0xb7, 0x0c, 0xcc,
+			0x4c, 0xd5, 0x6d, 0xf4, 0xe6, 0xc8, 0x0b, 0x20,
+			0x8b, 0x5a, 0x58, 0x0e, 0xf6, 0xbd, 0xc6, 0x3f,
+			0xad, 0x3d, 0xe0, 0x75, 0xf4, 0x28, 0xa6, 0x92,
+			0xd9, 0x6c, 0x48, 0x1a, 0x0e, 0x69, 0x77, 0xca,
+			0x2f, 0x04, 0xbb, 0x72, 0xb7, 0x93, 0x0a, 0x77,
+			0x2d, 0xc4, 0x1c, 0xd5, 0x3e, 0xe5, 0x26, 0x3f,
+			0xaf, 0x7f, 0x44, 0x2c, 0xda, 0x4c, 0xaa, 0xf7,
+			0x13, 0x2d, 0x4d, 0x51, 0x29, 0x7c, 0x75, 0x20,
+			0x38, 0x0f, 0xed, 0xaf, 0x03, 0x20, 0x56, 0x06,
+			0xd2, 0x94, 0xda, 0x2b, 0x2b, 0x35, 0x63, 0xa9,
+			0x5f, 0x65, 0xad, 0xfa, 0x0f, 0xba, 0x44, 0x28,
+			0xb1, 0xd3, 0x1d, 0x7f, 0xe0, 0xc4, 0xed, 0xdd,
+			0xcb, 0x07, 0x21, 0x5d, 0x7c, 0x3c, 0x76, 0xdb,
+			0x52, 0x64, 0xab, 0xa3, 0x2a, 0x98, 0x9f, 0x9f,
+			0xba, 0xf3, 0xfa, 0x81, 0x86, 0x0f, 0xcf, 0x85,
+			0x58, 0xa6, 0x85, 0xc1, 0x89, 0x7c, 0x14, 0xec,
+			0x66, 0x5e, 0xd1, 0x80, 0xcd, 0x84, 0xd4, 0x4f,
+			0xf6, 0x2f, 0x17, 0x7d, 0x0e, 0xa9, 0x67, 0x86,
+			0xd0, 0x27, 0xcc, 0x78, 0x3d, 0xc7, 0xde, 0x01,
+			0x14, 0xc1, 0x2f, 0x0b, 0xcb, 0x11, 0x99, 0xd5,
+			0xb9, 0x57, 0x97, 0x2b, 0xbd, 0xa7, 0xcb, 0x25,
+			0xe2, 0xc6, 0x9a, 0x79, 0xb1, 0x22, 0x99, 0x1d,
+			0x93, 0x44, 0x82, 0x7d, 0xa2, 0x47, 0x97, 0x46,
+			0x1d, 0xf6, 0xbf, 0x3a, 0xb7, 0xe5, 0x34, 0xaa,
+			0x0b, 0xee, 0xac, 0x73, 0x95, 0xc1, 0x6b, 0xe5,
+			0xd4, 0x66, 0x1a, 0x7b, 0xfb, 0x8c, 0x11, 0x47,
+			0x9e, 0x56, 0xa1, 0x49, 0x7c, 0x6a, 0x55, 0x68,
+			0xb2, 0x5a, 0xdc, 0x5d, 0xc4, 0x83, 0x6f, 0xc9,
+			0x2b, 0x0a, 0x2f, 0x29, 0xf6, 0xc5, 0x3b, 0xe1,
+			0xe9, 0x74, 0x10, 0xc8, 0xf4, 0x8f, 0x84, 0xe4,
+			0x3e, 0x95, 0xa3, 0x66, 0x8f, 0x26, 0x3e, 0x31,
+			0x21, 0x8a, 0x10, 0x1c, 0x5b, 0x53, 0xce, 0xc1,
+			0x2f, 0x62, 0x11, 0xf6, 0xca, 0xd5, 0x30, 0x7e,
+			0x40, 0xe2, 0xa7, 0x41, 0xcc, 0x58, 0x9c, 0x26,
+			0x80, 0x39, 0x20, 0x89, 0xba, 0x2f, 0x79, 0x67,
+			0x06, 0xf4, 0xc0, 0x51, 0x25, 0x9d, 0xcf, 0x29,
+			0xd9, 0x7f, 0xbd, 0xa0, 0xbe, 0xf0, 0xe9, 0x15,
+			0x5c, 0x33, 0xcb, 0x7c, 0xa7, 0x92, 0x76, 0x99,
+			0xb3, 0xb4, 0xa2, 0x3a, 0x7b, 0xd0, 0x74, 0x25,
+			0xca, 0x1f, 0x18, 0xc6, 0xbd, 0x3d, 0x22, 0x58,
+			0xe5, 0x95, 0xe1, 0xbe, 0x14, 0x3d, 0xee, 0x40,
+			0x68, 0xf3, 0x3d, 0xef, 0x6e, 0xe6, 0x5a, 0x6d,
+			0xc6, 0x47, 0xc5, 0x0e, 0xb0, 0x18, 0xba, 0x3b,
+			0xd3, 0x01, 0xb2, 0xe4, 0x5c, 0x85, 0x9b, 0x72,
+			0xb1, 0xbf, 0x8f, 0xb0, 0x2c, 0x59, 0xa2, 0x43,
+			0xbd, 0x1e, 0xbd, 0xe3, 0x9e, 0x72, 0x43, 0xbe,
+			0x43, 0x59, 0xe3, 0xdf, 0x5b, 0x31, 0x15, 0x78,
+			0x05, 0x2c, 0x04, 0x58, 0xc7, 0x2e, 0xdb, 0x13,
+			0x8a, 0x23, 0x9c, 0x5f, 0xcb, 0x47, 0xf3, 0x0a,
+			0x9b, 0x22, 0xf2, 0xa7, 0xea, 0x30, 0xf1, 0x61,
+			0xef, 0x2d, 0x58, 0xbc, 0x8b, 0x2e, 0x5c, 0xa3,
+			0x0d, 0xe3, 0x8f, 0x52, 0x89, 0x20, 0xc9, 0x51,
+			0xc6, 0xba, 0x13, 0xf0, 0x1d, 0xa3, 0x90, 0x66,
+			0x8a, 0x03, 0xe0, 0x06, 0xec, 0x13, 0x42, 0x5f,
+			0x9b, 0x9b, 0x06, 0x54, 0x2b, 0xfd, 0x6e, 0xf2,
+			0xf5, 0x28, 0x08, 0x04, 0xe8, 0x2b, 0xb0, 0xf9,
+			0x3c, 0xcf, 0xf1, 0x53, 0x68, 0x34, 0x7b, 0xad,
+			0x81, 0x37, 0x3a, 0x86, 0x17, 0x5c, 0x10, 0x9d,
+			0x11, 0x7e, 0x51, 0xb1, 0x63, 0xa6, 0x57, 0x0d,
+			0xdf, 0x97, 0x4e, 0x34, 0xaa, 0xf4, 0x9d, 0x93,
+			0x98, 0xee, 0xe4, 0x2b, 0x4d, 0x78, 0xc8, 0x08,
+			0xac, 0x5a, 0xca, 0xc1, 0xb1, 0xd3, 0x3e, 0x74,
+			0x72, 0x9f, 0x06, 0xab, 0xd6, 0x38, 0x11, 0xb4,
+			0xf7, 0x99, 0x61, 0xb7, 0xfd, 0x3d, 0x1b, 0xfe,
+			0x9f, 0x5a, 0x45, 0x74, 0xf3, 0x30, 0x60, 0xd5,
+			0x19, 0xa2, 0x7e, 0x90, 0x3c, 0x94, 0x70, 0x18,
+			0x59, 0x02, 0x21, 0xfb, 0x37, 0xb1, 0xb3, 0xe4,
+			0x0d, 0x11, 0xf2, 0x78, 0xc0, 0x17, 0x30, 0x67,
+			0xb3, 0x29, 0x53, 0x50, 0x4c, 0xfc, 0xa0, 0x60,
+			0x9c, 0x0d, 0xaa, 0x7d, 0x46, 0x5d, 0xf4, 0xa8,
+			0x38, 0xcf, 0x54, 0xdd, 0x91, 0xbb, 0x67, 0x41,
+			0x1d, 0x3b, 0xa1, 0x44, 0x38, 0x25, 0x84, 0xfb,
+			0x62, 0xc4, 0xa3, 0x38, 0x7c, 0xbe, 0xc8, 0xd4,
+			0xbe, 0x8e, 0xbf, 0xdb, 0x30, 0xe7, 0x6e, 0x70,
+			0x8e, 0x67, 0xa4, 0xe8, 0x04, 0x1e, 0x7b, 0x91,
+			0x92, 0xb7, 0x5d, 0xf7, 0x6e, 0x6a, 0xb8, 0x57,
+			0x5b, 0x86, 0x7f, 0xb4, 0xca, 0x9d, 0xbc, 0x59,
+			0x2c, 0x2a, 0xf6, 0x4e, 0xbf, 0x31, 0x6a, 0xb2,
+			0x6e, 0x8d, 0x83, 0xc2, 0x03, 0x0f, 0x58, 0xb5,
+			0x00, 0x0f, 0xe4, 0x70, 0x02, 0x5e, 0xe3, 0xef,
+			0xb7, 0xfc, 0x3f, 0xe7, 0x47, 0x50, 0xb3, 0xdd,
+			0x90, 0x60, 0x86, 0x17, 0xec, 0x82, 0xbd, 0x26,
+			0x46, 0xca, 0xad, 0xf7, 0x82, 0x3f, 0xd8, 0x3d,
+			0xef, 0x17, 0x83, 0x68, 0x9c, 0x3d, 0x8d, 0x8d,
+			0xd6, 0x4d, 0xbf, 0x1c, 0xcd, 0x57, 0x3b, 0xe1,
+			0x1e, 0x91, 0x6e, 0xb4, 0x06, 0x64, 0xb3, 0x5c,
+			0xd2, 0xd7, 0x59, 0x69, 0x93, 0x32, 0x8d, 0x8d,
+			0xb4, 0x46, 0x7a, 0x20, 0x58, 0x50, 0x07, 0x0d,
+			0x5b, 0xe9, 0x71, 0x75, 0xd4, 0xe1, 0xf4, 0xf2,
+			0x8e, 0x0b, 0x82, 0x18, 0x2f, 0x1b, 0x82, 0x06,
+			0x82, 0x5f, 0xc2, 0x71, 0xfb, 0xc1, 0x7a, 0x87,
+			0xb8, 0x8d, 0xd9, 0x11, 0xca, 0xba, 0xd7, 0x30,
+			0xe1, 0xa9, 0x39, 0x4c, 0x62, 0xba, 0x2e, 0xa4,
+			0xba, 0x33, 0x35, 0x30, 0xd3, 0x62, 0xf5, 0x1f,
+			0xd1, 0xdd, 0x49, 0x83, 0x15, 0x35, 0x7c, 0x24,
+			0x75, 0x0b, 0xc6, 0xbf, 0xc8, 0x71, 0x78, 0xd8,
+			0x78, 0x29, 0xb5, 0x41, 0x6a, 0x20, 0x4d, 0xd8,
+			0xe2, 0x48, 0xfd, 0x4c, 0x9b, 0x33, 0x86, 0x18,
+			0x8b, 0x8a, 0x10, 0xe4, 0xa2, 0x9d, 0xa1, 0x48,
+			0x64, 0x7a, 0xe2, 0x6b, 0x29, 0x6a, 0xfe, 0x69,
+			0x83, 0x72, 0x45, 0x63, 0x59, 0x5a, 0xc7, 0x86,
+			0xd7, 0xcb, 0x62, 0x53, 0xeb, 0xf1, 0x44, 0xa2,
+			0x73, 0x91, 0x81, 0xaa, 0xaf, 0x60, 0xf6, 0xdf,
+			0x47, 0x4c, 0x6b, 0x81, 0x1c, 0x72, 0x16, 0x31,
+			0xda, 0xeb, 0x8a, 0x16, 0x90, 0x37, 0xa1, 0x13,
+			0x52, 0xf4, 0x38, 0xb4, 0x7a, 0x75, 0xc9, 0x72,
+			0xe6, 0x2d, 0xd4, 0x28, 0x2d, 0x01, 0x94, 0xc2,
+			0x4c, 0x77, 0x13, 0xf3, 0x54, 0x1a, 0xe5, 0x58,
+			0x6c, 0xe3, 0x65, 0x39, 0x7b, 0xb9, 0x4c, 0x06,
+			0xb5, 0xf4, 0x01, 0x79, 0x9d, 0xef, 0xee, 0x50,
+			0xae, 0x7e, 0x57, 0x5e, 0xf5, 0xe7, 0x88, 0xe6,
+			0x94, 0x48, 0xc3, 0xb2, 0x45, 0x77, 0xa3, 0xe7,
+			0x87, 0x91, 0xf9, 0x40, 0x3c, 0xe0, 0x08, 0x67,
+			0x47, 0x5f, 0xc8, 0xa5, 0x43, 0x88, 0x6f, 0xc5,
+			0x3f, 0xf5, 0x33, 0x59, 0xad, 0xd2, 0x9f, 0xa6,
+			0xee, 0x66, 0xef, 0x76, 0x43, 0x0a, 0x0f, 0xf8,
+			0x2d, 0xce, 0x3f, 0xbd, 0xb6, 0x12, 0x2b, 0xd1,
+			0xe7, 0xb1, 0xdc, 0xab, 0x1f, 0x32, 0xfc, 0x99,
+			0x58, 0xb6, 0xf4, 0x90, 0xc7, 0x94, 0x58, 0xcc,
+			0x2a, 0x30, 0xcb, 0xa4, 0x89, 0xd0, 0x2f, 0xdb,
+			0x8b, 0xfa, 0xaf, 0xbe, 0xc5, 0x61, 0xee, 0xd9,
+			0x03, 0xf6, 0x84, 0xd5, 0x93, 0xee, 0x50, 0xd0,
+			0x04, 0x12, 0x44, 0x02, 0x5e, 0x89, 0xb6, 0x9c,
+			0xc7, 0xba, 0x90, 0x4b, 0x96, 0x05, 0x52, 0xd9,
+			0x76, 0xdf, 0x14, 0xd2, 0x1e, 0xed, 0x47, 0xfa,
+			0xf1, 0x8f, 0x34, 0xf5, 0xa8, 0x44, 0x67, 0x14,
+			0x27, 0x04, 0x79, 0x75, 0x2a, 0xd4, 0x2e, 0x5c,
+			0x5c, 0x4d, 0x2f, 0x37, 0x21, 0x11, 0xe7, 0xf1,
+			0xe1, 0x3c, 0xe8, 0xb2, 0x6d, 0x59, 0xe6, 0x22,
+			0xef, 0xbd, 0x21, 0xdd, 0x12, 0xec, 0x4e, 0x9f,
+			0x00, 0x8c, 0x93, 0xea, 0x69, 0x2f, 0x43, 0x9a,
+			0x67, 0x46, 0xec, 0xad, 0xa7, 0x6d, 0x7b, 0xb0,
+			0x42, 0xa2, 0x80, 0xd7, 0xa7, 0x62, 0xa8, 0xb1,
+			0x16, 0x71, 0x30, 0xe3, 0xcb, 0x63, 0xf6, 0xcd,
+			0x4f, 0x82, 0x9b, 0xa1, 0xfc, 0x09, 0xbd, 0x56,
+			0x8c, 0xf6, 0x38, 0x70, 0x46, 0x40, 0xa8, 0x6d,
+			0x61, 0x1c, 0x1f, 0xd7, 0x39, 0x0d, 0x96, 0xe3,
+			0x53, 0xe4, 0x70, 0xc5, 0xe9, 0x47, 0x7a, 0xc9,
+			0xa5, 0x3c, 0xe8, 0xab, 0xca, 0xcf, 0x99, 0xf1,
+			0x3c, 0x9a, 0xa3, 0xcf, 0x2a, 0x7c, 0xee, 0x92,
+			0x08, 0xd9, 0xfb, 0xb5, 0x41, 0x9f, 0x3c, 0xb8,
+			0x15, 0x7e, 0x54, 0x7c, 0xe6, 0x82, 0x8b, 0xb0,
+			0xbc, 0xe2, 0xa2, 0xa3, 0xcb, 0x05, 0x65, 0xc9,
+			0x5c, 0xae, 0x8e, 0x0b, 0x5a, 0x37, 0xb7, 0x50,
+			0xd5, 0xa5, 0x15, 0xe2, 0x43, 0xac, 0x15, 0xe3,
+			0x53, 0xc3, 0xc9, 0xda, 0x1e, 0x7f, 0x02, 0xe1,
+			0x7a, 0x00, 0xe2, 0x08, 0x63, 0x7f, 0x46, 0xa7,
+			0x36, 0x6b, 0x5b, 0x41, 0x80, 0x91, 0xc3, 0x78,
+			0xd5, 0x77, 0x10, 0xfb, 0xd9, 0x39, 0x65, 0x2f,
+			0x7b, 0x15, 0xe5, 0x3d, 0x72, 0x99, 0x67, 0x96,
+			0x9f, 0x5e, 0x62, 0xcd, 0xb3, 0x6e, 0xd9, 0x83,
+			0x89, 0x94, 0xa2, 0x70, 0x09, 0x8e, 0xf1, 0x83,
+			0x62, 0x78, 0x64, 0x5e, 0xb0, 0xd1, 0x79, 0x8b,
+			0x9b, 0x44, 0x18, 0x76, 0x39, 0x1d, 0xa2, 0x12,
+			0x9d, 0x6b, 0x64, 0x2b, 0xac, 0xbf, 0x63, 0x9e,
+			0x14, 0x74, 0xc2, 0xd6, 0xfd, 0x7d, 0x16, 0xad,
+			0x38, 0x67, 0x25, 0x25, 0x38, 0xf2, 0xe7, 0xf7,
+			0x50, 0x93, 0x63, 0x19, 0x5f, 0xd0, 0x59, 0x5d,
+			0xd4, 0xb6, 0xb4, 0x34, 0x5c, 0x41, 0xf5, 0xf1,
+			0x45, 0xbb, 0x49, 0x34, 0xc4, 0x70, 0x92, 0xba,
+			0x32, 0x91, 0xc5, 0x2a, 0xf4, 0x9a, 0x4a, 0xe6,
+			0x36, 0x09, 0x60, 0x3f, 0x15, 0x50, 0xd7, 0xf6,
+			0xa3, 0x04, 0x85, 0x17, 0x37, 0xa3, 0xfd, 0x83,
+			0xec, 0x16, 0x47, 0xbc, 0x5e, 0x7f, 0xd9, 0x26,
+			0x2b, 0xcf, 0xa2, 0xf5, 0x89, 0x3d, 0x56, 0xd9,
+			0x0b, 0x99, 0x4e, 0x1b, 0xa9, 0x72, 0x15, 0xcd,
+			0x44, 0x21, 0xae, 0xc7, 0x1a, 0x9f, 0x60, 0x35,
+			0x70, 0x79, 0xa6, 0x0e, 0x0e, 0x7e, 0xd2, 0xbe,
+			0xba, 0x8e, 0xb4, 0xa5, 0x51, 0x4e, 0x05, 0xae,
+			0xa4, 0xc2, 0x1c, 0xc6, 0x68, 0x95, 0xd3, 0xb8,
+			0xcd, 0xc5, 0x8a, 0xff, 0xc9, 0x6c, 0xda, 0x87,
+			0x44, 0xa6, 0x1e, 0xda, 0xc7, 0x3b, 0x90, 0xbd,
+			0xa3, 0xbc, 0x40, 0x97, 0xae, 0x86, 0x98, 0x13,
+			0xcb, 0xc9, 0x5d, 0x2b, 0x77, 0x4c, 0x2c, 0x78,
+			0x4b, 0x0d, 0x35, 0x4c, 0xdb, 0xb8, 0xb5, 0xac,
+			0x2e, 0xad, 0x9f, 0xc2, 0xd5, 0xe4, 0x0c, 0x2c,
+			0xfc, 0xd5, 0x3b, 0x29, 0xcc, 0x8c, 0x6b, 0x8f,
+			0xac, 0xff, 0xdb, 0x44, 0x32, 0xc3, 0x3b, 0x97,
+			0xb9, 0xba, 0x87, 0x28, 0x79, 0x2f, 0x8f, 0xca,
+			0xdf, 0xf6, 0x21, 0x56, 0x03, 0xec, 0xd1, 0x1b,
+			0x7c, 0x99, 0x41, 0x64, 0x76, 0xcc, 0x98, 0xb5,
+			0x04, 0x01, 0xc0, 0x60, 0x07, 0xfb, 0x73, 0xbe,
+			0xa3, 0xd9, 0x6e, 0x9f, 0x72, 0xaf, 0xc1, 0x37,
+			0x1b, 0x9a, 0x3b, 0x90, 0x3b, 0x93, 0xf5, 0xf3,
+			0x01, 0xda, 0x5f, 0xda, 0x30, 0x4e, 0x4b, 0x02,
+			0xce, 0x7d, 0xed, 0xc1, 0x8c, 0x83, 0x84, 0xb4,
+			0x35, 0xa9, 0x20, 0xb6, 0x0f, 0x49, 0x33, 0xf1,
+			0xad, 0x9e, 0x7f, 0x75, 0xb4, 0x0f, 0x98, 0xa1,
+			0x4a, 0x64, 0x02, 0xa2, 0x38, 0xf0, 0x3c, 0xbc,
+			0x9f, 0x6b, 0x0a, 0x71, 0x8d, 0x07, 0x65, 0x19,
+			0xa4, 0x6d, 0x48, 0x89, 0x05, 0xa0, 0xdc, 0x30,
+			0xa8, 0x53, 0x9c, 0xc0, 0x08, 0x2a, 0xf9, 0x6c,
+			0xaf, 0xbf, 0x13, 0x03, 0xcd, 0x2c, 0x69, 0x6c,
+			0x82, 0xb3, 0x9f, 0x22, 0x09, 0xf9, 0xc7, 0x57,
+			0x14, 0x81, 0xa2, 0xab, 0xb1, 0x15, 0xeb, 0x97,
+			0x3b, 0x29, 0x75, 0x4c, 0xce, 0xf4, 0xe0, 0xdf,
+			0xc6, 0x0c, 0x16, 0x7a, 0x38, 0x80, 0x45, 0xb3,
+			0x6f, 0xc7, 0x34, 0x24, 0xb1, 0xa8, 0x5e, 0xd9,
+			0x1c, 0x28, 0xce, 0x16, 0xb3, 0x9a, 0xb4, 0xc2,
+			0x37, 0xe2, 0xdf, 0xe1, 0x03, 0xa6, 0x54, 0x79,
+			0x93, 0x17, 0xae, 0x6c, 0xd6, 0x37, 0xe9, 0x6a,
+			0xeb, 0x2d, 0x2c, 0xb3, 0xdd, 0xd8, 0x48, 0x51,
+			0xe8, 0x83, 0x0f, 0xe5, 0xe4, 0x96, 0x89, 0xbb,
+			0xcf, 0x5e, 0xf5, 0x65, 0x6a, 0x63, 0xbf, 0xb0,
+			0x05, 0x6c, 0xd6, 0xb0, 0xf9, 0x41, 0x3f, 0x4f,
+			0xd9, 0x0c, 0xec, 0xae, 0x85, 0xe3, 0xf4, 0xa6,
+			0x26, 0x08, 0x7c, 0xb5, 0x9c, 0x44, 0xad, 0x88,
+			0xb7, 0x57, 0x23, 0x0b, 0xec, 0xea, 0xbb, 0xf4,
+			0x10, 0xd3, 0x4d, 0x44, 0x08, 0x6f, 0xaa, 0x38,
+			0xad, 0x9f, 0xdb, 0xa9, 0x48, 0x96, 0x1c, 0xbe,
+			0xa6, 0xf3, 0xf2, 0xfe, 0x56, 0xef, 0x7e, 0x54,
+			0x05, 0xea, 0x27, 0xc7, 0x3c, 0x3d, 0x8d, 0x65,
+			0x93, 0xc7, 0x93, 0x1a, 0x9f, 0xda, 0xfb, 0x80,
+			0xcb, 0xe9, 0x0d, 0x8f, 0xcb, 0x3d, 0x6a, 0x7c,
+			0x01, 0xa5, 0xf3, 0x02, 0xd9, 0x41, 0x0a, 0xe0,
+			0xd8, 0x0b, 0x40, 0x80, 0x20, 0xf6, 0xd1, 0x52,
+			0x9f, 0x1c, 0xf6, 0x4f, 0x86, 0x93, 0x49, 0x01,
+			0x92, 0xb5, 0xca, 0x2a, 0x11, 0x5e, 0x56, 0xbf,
+			0x89, 0x8b, 0x78, 0xb7, 0x9f, 0x82, 0x46, 0x4a,
+			0xc2, 0x40, 0x3d, 0x51, 0xb6, 0x5d, 0x26, 0xd2,
+			0xa7, 0x3a, 0x9c, 0x24, 0x57, 0x2e, 0x50, 0xf2,
+			0x36, 0xf2, 0xa8, 0x13, 0xea, 0xd4, 0x6b, 0x00,
+			0x07, 0x48, 0xa2, 0x15, 0x4c, 0xa9, 0xf8, 0x60,
+			0x0f, 0xb1, 0x10, 0x2e, 0xce, 0x05, 0xc6, 0x2c,
+			0x4e, 0xea, 0x61, 0x7e, 0x36, 0x29, 0x50, 0x23,
+			0x9c, 0x3c, 0x4e, 0x65, 0xef, 0x7e, 0x2e, 0xad,
+			0xe4, 0xa2, 0xd6, 0x55, 0xcd, 0xa7, 0x6d, 0xd4,
+			0x79, 0x2a, 0xf9, 0x68, 0x93, 0x20, 0x94, 0xab,
+			0x13, 0xd1, 0x99, 0x9a, 0xa9, 0x87, 0x82, 0xab,
+			0x16, 0x6c, 0x22, 0x95, 0x44, 0x83, 0x84, 0xc8,
+			0x9b, 0x98, 0xc6, 0x00, 0x64, 0x30, 0x9b, 0x45,
+			0xc4, 0x74, 0x3d, 0x6a, 0xb8, 0x28, 0x03, 0x22,
+			0x93, 0xb9, 0xeb, 0x60, 0x5b, 0x24, 0xee, 0x00,
+			0xcd, 0x02, 0x37, 0xbc, 0x39, 0x5e, 0x8a, 0x97,
+			0x19, 0xc4, 0x5e, 0xed, 0xe3, 0xa3, 0xc5, 0x37,
+			0x31, 0x5e, 0x1f, 0x70, 0xe2, 0x4b, 0x5f, 0xe6,
+			0xa6, 0x3b, 0x02, 0x8b, 0x30, 0x53, 0xf0, 0x79,
+			0xc6, 0xd4, 0x71, 0x92, 0x3e, 0xcc, 0x06, 0x91,
+			0x66, 0x72, 0x37, 0xe1, 0xa0, 0xe7, 0x34, 0x01,
+			0xf6, 0x37, 0x75, 0xf6, 0x5d, 0x08, 0x32, 0x78,
+			0x29, 0x52, 0x18, 0xcc, 0xb3, 0xf4, 0xd7, 0x8d,
+			0x36, 0x97, 0x46, 0x10, 0x34, 0xa6, 0x77, 0x68,
+			0xb5, 0x43, 0x01, 0x94, 0x53, 0x43, 0x32, 0xec,
+			0x4f, 0xb9, 0xea, 0x95, 0xbe, 0x3c, 0xab, 0x1e,
+			0x64, 0xeb, 0x21, 0x66, 0x39, 0xa1, 0xbd, 0x8a,
+			0x70, 0x15, 0x45, 0x18, 0x3e, 0xb2, 0x44, 0xd0,
+			0x66, 0x88, 0x66, 0xf5, 0xa9, 0x5d, 0x53, 0xea,
+			0x86, 0xaf, 0x2b, 0xdc, 0x20, 0x9f, 0xbf, 0x45,
+			0xbd, 0x96, 0xdf, 0x86, 0x6c, 0x5d, 0x3b, 0x1f,
+			0xd6, 0x21, 0x57, 0xd9, 0xb3, 0xb6, 0x86, 0xe7,
+			0x01, 0xa7, 0x2c, 0x59, 0x60, 0xe6, 0xaf, 0xf1,
+			0xf1, 0xec, 0x19, 0xad, 0x66, 0x4b, 0xa6, 0x52,
+			0x34, 0x67, 0x59, 0x4d, 0xde, 0x51, 0x8a, 0x16,
+			0x69, 0x90, 0x9d, 0xbd, 0x17, 0xb5, 0x4c, 0x4f,
+			0x32, 0x0e, 0x26, 0xff, 0x52, 0x7c, 0xa5, 0x91,
+			0xa5, 0x7c, 0xf6, 0x9c, 0xa4, 0xfe, 0xc9, 0xb7,
+			0x81, 0x3f, 0xc0, 0xc9, 0x35, 0xbb, 0x02, 0x77,
+			0xff, 0xc2, 0xd3, 0x52, 0xd9, 0x4a, 0x73, 0xe5,
+			0x40, 0xf9, 0xdb, 0xb9, 0xef, 0xd1, 0xf6, 0x4f,
+			0xe6, 0x5d, 0xea, 0x55, 0x89, 0x6a, 0x2c, 0xe1,
+			0x6e, 0x08, 0x8e, 0x7f, 0xb4, 0xbd, 0x92, 0xfa,
+			0x32, 0x4d, 0x81, 0xd0, 0x4e, 0x51, 0x41, 0xd0,
+			0xef, 0x56, 0x82, 0x8b, 0x5d, 0xb4, 0xb6, 0xbd,
+			0x3e, 0x92, 0x83, 0x29, 0x86, 0x30, 0x69, 0x9e,
+			0x28, 0x75, 0x24, 0x6f, 0x49, 0x90, 0x60, 0x26,
+			0xe0, 0x35, 0xfa, 0x54, 0x5f, 0x9c, 0x61, 0x06,
+			0xfa, 0xeb, 0x6c, 0x4b, 0x8f, 0x6e, 0xfb, 0xc2,
+			0x82, 0xd8, 0xd4, 0x03, 0xb2, 0x77, 0x99, 0xe7,
+			0x2f, 0x7b, 0xb1, 0x4f, 0xfe, 0xaf, 0xa7, 0xcd,
+			0xd8, 0xb1, 0x1e, 0x6b, 0x21, 0xbc, 0x35, 0x4c,
+			0x06, 0x49, 0xb8, 0x12, 0xdb, 0xd6, 0x8c, 0x89,
+			0x9f, 0x19, 0x63, 0x2a, 0x5d, 0x09, 0x50, 0x79,
+			0x7d, 0x5f, 0xd0, 0x57, 0x9a, 0x1b, 0xff, 0xfc,
+			0x14, 0xed, 0xdc, 0x3e, 0x42, 0xcb, 0xb5, 0x63,
+			0x58, 0x35, 0x59, 0xfb, 0xeb, 0x4e, 0x7c, 0x0f,
+			0x89, 0xa3, 0x57, 0xcd, 0x49, 0x74, 0x55, 0x2a,
+			0x7f, 0xf4, 0xa2, 0x80, 0x6c, 0xf3, 0xf8, 0x62,
+			0x01, 0x9c, 0xbc, 0x2f, 0x0f, 0xb1, 0x6a, 0x56,
+			0xd0, 0xfa, 0x93, 0xd0, 0x96, 0x54, 0xc9, 0xd1,
+			0x4a, 0x2d, 0xd5, 0x72, 0xaf, 0x80, 0xb8, 0xf7,
+			0xc2, 0x0c, 0x4d, 0x39, 0xcf, 0x51, 0x9a, 0x64,
+			0xb1, 0xc5, 0x2b, 0xda, 0x35, 0xe0, 0x0d, 0x8a,
+			0x4d, 0xe2, 0xbe, 0x7f, 0x38, 0xee, 0xed, 0x0d,
+			0xf7, 0x22, 0x6e, 0x05, 0x5d, 0x7b, 0xc8, 0x9a,
+			0x3e, 0x02, 0xf0, 0xa1, 0xd4, 0x21, 0x16, 0xae,
+			0x14, 0x22, 0x4e, 0x4e, 0x9e, 0xc0, 0xda, 0x51,
+			0xe7, 0x27, 0x77, 0xdf, 0xfc, 0x36, 0x67, 0xcf,
+			0xfe, 0x09, 0x57, 0xec, 0x54, 0x11, 0x2a, 0x30,
+			0x7f, 0x32, 0x2f, 0x23, 0x65, 0xfe, 0x51, 0xc7,
+			0x43, 0xb1, 0xb2, 0x53, 0x3e, 0xc3, 0x33, 0x88,
+			0x27, 0x8e, 0x4a, 0xcc, 0xcf, 0xa9, 0xd4, 0x88,
+			0x24, 0x55, 0x12, 0x63, 0x3a, 0x2b, 0xa1, 0xaf,
+			0x97, 0xda, 0xf9, 0x58, 0x8a, 0x67, 0x13, 0x80,
+			0x2c, 0xa4, 0x3a, 0x60, 0x01, 0x4c, 0x2b, 0x57,
+			0x22, 0x3c, 0x24, 0xce, 0xa5, 0xf5, 0xe8, 0xc5,
+			0xed, 0xd4, 0xd8, 0x05, 0x91, 0xd7, 0x6a, 0xdc,
+			0x8e, 0x86, 0x27, 0x8d, 0x18, 0x3f, 0xc4, 0xd1,
+			0x00, 0xf8, 0xf5, 0x9b, 0x8e, 0x74, 0x32, 0x7e,
+			0x26, 0x69, 0xc2, 0xd1, 0xe2, 0x30, 0x6b, 0x11,
+			0xdc, 0x2d, 0x93, 0xfd, 0xb4, 0xbc, 0x40, 0x45,
+			0xd6, 0x5f, 0xbf, 0x52, 0x6b, 0x10, 0x2f, 0xd3,
+			0xf0, 0x94, 0x9e, 0x01, 0xed, 0x78, 0x9f, 0x7f,
+			0x01, 0x06, 0x92, 0xc5, 0xa9, 0x34, 0x84, 0xbc,
+			0x95, 0x43, 0xfa, 0x2f, 0xe5, 0x9d, 0xfc, 0x74,
+			0xdf, 0x39, 0x7f, 0x74, 0x35, 0x18, 0xb5, 0x7a,
+			0x67, 0xf7, 0x24, 0xab, 0xe3, 0x88, 0x9c, 0x28,
+			0x9e, 0x3e, 0x80, 0xe3, 0x54, 0xb2, 0xb5, 0xda,
+			0x85, 0xcb, 0xe1, 0xa5, 0xda, 0x4b, 0x0d, 0x9f,
+			0x50, 0x7c, 0x74, 0x10, 0xd2, 0xf5, 0x42, 0xcf,
+			0xee, 0x07, 0x7e, 0x5b, 0x79, 0x99, 0xa0, 0x4c,
+			0x8f, 0xa7, 0xf0, 0xd8, 0x96, 0xd0, 0x08, 0x8f,
+			0x1f, 0x65, 0xd7, 0x69, 0x75, 0x62, 0x37, 0xa7,
+			0xde, 0xab, 0xab, 0x86, 0x4a, 0xb4, 0xdd, 0x1d,
+			0xf0, 0xe4, 0xf7, 0x30, 0xe9, 0xc8, 0x5b, 0xfb,
+			0xfb, 0x58, 0x03, 0x32, 0xf2, 0x07, 0xc6, 0x38,
+			0x76, 0xe6, 0x30, 0x84, 0x38, 0x70, 0xc8, 0x53,
+			0x41, 0x7f, 0xff, 0xac, 0x8c, 0x09, 0x4d, 0x4f,
+			0x6c, 0xb2, 0x32, 0xc8, 0xe5, 0x0c, 0xbd, 0xce,
+			0x7c, 0x42, 0x34, 0x8b, 0x31, 0x70, 0xce, 0x44,
+			0x51, 0xee, 0xd9, 0x91, 0x73, 0xa4, 0xad, 0x4f,
+			0x4f, 0x83, 0xac, 0x98, 0xc4, 0xc2, 0xf4, 0xf2,
+			0x9b, 0x8e, 0x54, 0x64, 0xe4, 0xed, 0x94, 0x14,
+			0x4f, 0xd1, 0x1a, 0xd7, 0x19, 0x3f, 0x16, 0x0f,
+			0x93, 0x53, 0xca, 0x26, 0x75, 0x6a, 0x2c, 0x3b,
+			0xf4, 0xd2, 0x20, 0x97, 0x19, 0x3f, 0xaa, 0x92,
+			0x65, 0x71, 0x1c, 0xd7, 0xf9, 0x86, 0x11, 0x02,
+			0x8d, 0x6f, 0x86, 0xe9, 0xf9, 0x08, 0x6a, 0xf6,
+			0x23, 0x9a, 0x97, 0x84, 0x97, 0xbe, 0x8c, 0x1f,
+			0xfb, 0xb2, 0x7f, 0x52, 0x28, 0xf7, 0x40, 0x59,
+			0xd1, 0xff, 0xe9, 0x09, 0xb6, 0xe5, 0x51, 0xf7,
+			0xfe, 0xc8, 0x78, 0x08, 0xb2, 0xe5, 0x0c, 0x94,
+			0x44, 0x1a, 0xef, 0x6f, 0xe8, 0x7c, 0xe4, 0xdd,
+			0xb6, 0xe2, 0xcb, 0x19, 0x9d, 0x97, 0x3b, 0xfc,
+			0x85, 0x8b, 0xe8, 0x4b, 0xb0, 0x72, 0x8e, 0x54,
+			0xb8, 0x33, 0x8d, 0xdf, 0x7b, 0xaf, 0xee, 0x59,
+			0x80, 0x16, 0x06, 0x70, 0x8b, 0xec, 0x66, 0x74,
+			0x52, 0x5d, 0xa1, 0xec, 0xe9, 0x11, 0xb5, 0xa2,
+			0x1c, 0x47, 0xa3, 0x37, 0xac, 0xbd, 0x88, 0xbe,
+			0x23, 0xb3, 0x37, 0x27, 0xf3, 0xca, 0x87, 0xb6,
+			0x12, 0xfd, 0x0d, 0xfd, 0x81, 0xc8, 0xb3, 0x8f,
+			0xf0, 0x7b, 0x45, 0x11, 0xea, 0x05, 0x2d, 0xd4,
+			0x16, 0xf6, 0xc7, 0xe1, 0x29, 0x1d, 0xc8, 0x34,
+			0x4d, 0x20, 0xa9, 0x44, 0x93, 0xe5, 0xe3, 0x34,
+			0xfb, 0x34, 0x88, 0x2e, 0xb3, 0x75, 0x20, 0x15,
+			0xfd, 0x3f, 0x16, 0x27, 0x27, 0x52, 0xad, 0x4d,
+			0xca, 0x15, 0x27, 0x6a, 0xe1, 0x62, 0xf7, 0xa5,
+			0xd5, 0x3e, 0xd4, 0x97, 0x56, 0x56, 0xaa, 0x6f,
+			0x5b, 0x6d, 0xa0, 0xe7, 0x22, 0x26, 0xee, 0xd0,
+			0xeb, 0xb6, 0xe8, 0x48, 0x51, 0x3e, 0xb3, 0xfc,
+			0xd1, 0x7c, 0xe9, 0x0b, 0x1e, 0x58, 0x37, 0x1b,
+			0xf2, 0xb4, 0x48, 0x36, 0xa8, 0x20, 0x8a, 0xe8,
+			0xb7, 0x26, 0x04, 0x6f, 0x57, 0x70, 0xb7, 0x78,
+			0x37, 0xa5, 0xc8, 0x8f, 0xf7, 0x93, 0x76, 0x2c,
+			0x44, 0x0e, 0xab, 0x06, 0xe6, 0xcd, 0x74, 0x4b,
+			0xe7, 0x08, 0xff, 0xc1, 0x41, 0x10, 0x04, 0xe6,
+			0xcf, 0x43, 0x6d, 0xca, 0x38, 0xfc, 0xfa, 0x39
+		},
+	}
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_TESTER_VECTORS_SHA2_192F_H */
@@ -0,0 +1,2117 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SPHINCS_TESTER_VECTORS_SHA2_192S_H
+#define SPHINCS_TESTER_VECTORS_SHA2_192S_H
+
+#include "fips_mode.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lc_sphincs_test {
+	uint8_t seed[LC_SPX_SEEDBYTES];
+	uint8_t msg[33];
+	uint8_t pk[sizeof(struct lc_sphincs_pk)];
+	uint8_t sk[sizeof(struct lc_sphincs_sk)];
+	uint8_t sig[sizeof(struct lc_sphincs_sig)];
+};
+
+LC_FIPS_RODATA_SECTION
+static const struct lc_sphincs_test tests[] =
+{
+	{
+		.seed = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x92, 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd
+		},
+		.msg = {
+			0xd8, 0x1c, 0x4d, 0x8d, 0x73, 0x4f, 0xcb, 0xfb,
+			0xea, 0xde, 0x3d, 0x3f, 0x8a, 0x03, 0x9f, 0xaa,
+			0x2a, 0x2c, 0x99, 0x57, 0xe8, 0x35, 0xad, 0x55,
+			0xb2, 0x2e, 0x75, 0xbf, 0x57, 0xbb, 0x55, 0x6a,
+			0xc8
+		},
+		.pk = {
+			FIPS140_MOD(0x92), 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0xee, 0x27, 0x69, 0x2e, 0xf3, 0x0b, 0xad, 0x87,
+			0xb5, 0x5c, 0x4e, 0x2a, 0x25, 0xe7, 0xf4, 0x78,
+			0x75, 0xc1, 0xf5, 0x37, 0x23, 0xce, 0x31, 0xc6
+		},
+		.sk = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x92, 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0xee, 0x27, 0x69, 0x2e, 0xf3, 0x0b, 0xad, 0x87,
+			0xb5, 0x5c, 0x4e, 0x2a, 0x25, 0xe7, 0xf4, 0x78,
+			0x75, 0xc1, 0xf5, 0x37, 0x23, 0xce, 0x31, 0xc6
+		},
+		.sig = {
+			0x7f, 0x42, 0x8d, 0x1a, 0xaa, 0x56, 0xd3, 0xa4,
+			0x5f, 0x6b, 0xe1, 0x05, 0x4f, 0xcc, 0xe4, 0xbb,
+			0x02, 0x4f, 0xc1, 0x74, 0xc2, 0x7f, 0x48, 0x1b,
+			0x86, 0xe4, 0x98, 0x9d, 0x02, 0xc7, 0x20, 0x11,
+			0x14, 0xf8, 0xae, 0x0f, 0x17, 0x5f, 0x2f, 0x72,
+			0xf3, 0x7c, 0x8e, 0x70, 0x4f, 0x3f, 0x09, 0xa1,
+			0x7e, 0xa4, 0x9b, 0x62, 0xcc, 0x47, 0x75, 0x81,
+			0x91, 0x4f, 0x29, 0x8f, 0xa6, 0x04, 0x9a, 0xe2,
+			0x76, 0x3f, 0xf6, 0x91, 0xd6, 0x3f, 0xff, 0x61,
+			0xa5, 0xb9, 0x70, 0x1f, 0x4e, 0x12, 0x7a, 0xd3,
+			0x4c, 0x1f, 0x1d, 0xf3, 0xf1, 0x57, 0x9f, 0x2d,
+			0xc7, 0xad, 0xaf, 0x0d, 0x60, 0x33, 0xba, 0x61,
+			0xce, 0x41, 0xc2, 0xb1, 0x76, 0x2f, 0x13, 0x29,
+			0xbf, 0x00, 0x66, 0x76, 0x0c, 0x5f, 0xf9, 0xed,
+			0x4d, 0xb8, 0x07, 0x44, 0xb2, 0x95, 0xbb, 0x77,
+			0x98, 0xcf, 0xbf, 0x38, 0x86, 0x38, 0x55, 0x32,
+			0x53, 0xf0, 0xbf, 0xaf, 0x76, 0x8c, 0x56, 0x1c,
+			0x6a, 0x93, 0xb8, 0x23, 0xfa, 0x37, 0xff, 0x13,
+			0x00, 0x39, 0x76, 0xed, 0x03, 0xdb, 0x65, 0xaf,
+			0xe1, 0x57, 0x7a, 0xe7, 0x8a, 0x5d, 0x3f, 0xcd,
+			0xb6, 0xdb, 0x5a, 0x3e, 0xb3, 0x66, 0xac, 0x35,
+			0x31, 0xf4, 0x84, 0x90, 0xcc, 0xf1, 0x97, 0x00,
+			0x33, 0x1a, 0x87, 0x07, 0x2a, 0x5d, 0x5d, 0x62,
+			0x45, 0x26, 0xcc, 0x25, 0x68, 0x45, 0x1c, 0xac,
+			0xe1, 0x1c, 0x85, 0x64, 0x90, 0x79, 0xff, 0x38,
+			0x25, 0x1c, 0xb9, 0x33, 0x35, 0x6f, 0x30, 0x95,
+			0xae, 0xda, 0xaf, 0x76, 0xe2, 0x39, 0xab, 0x20,
+			0x7d, 0x06, 0xbe, 0xb9, 0xb1, 0x0e, 0x5b, 0xff,
+			0xbe, 0x94, 0x84, 0x68, 0xd4, 0x2b, 0x5a, 0xba,
+			0x11, 0x35, 0x05, 0x93, 0xed, 0x74, 0xbe, 0xdf,
+			0xec, 0xc6, 0x6e, 0x59, 0x93, 0xd7, 0x1f, 0x28,
+			0x84, 0xbc, 0x47, 0x6c, 0x95, 0x47, 0x39, 0x4f,
+			0x43, 0xde, 0x3c, 0xf7, 0x10, 0xb7, 0x19, 0x47,
+			0x2f, 0xe3, 0xb5, 0x1a, 0x8d, 0x3e, 0xe2, 0x06,
+			0xe8, 0x8c, 0xd9, 0x5f, 0x1f, 0xfa, 0x68, 0x99,
+			0x15, 0xbc, 0x28, 0x9d, 0x7f, 0xa9, 0x01, 0x99,
+			0x97, 0xf0, 0x14, 0x65, 0x34, 0xe3, 0x6d, 0xff,
+			0x56, 0x5c, 0x93, 0xdb, 0x8f, 0x48, 0xa5, 0xf3,
+			0x21, 0x48, 0x86, 0x36, 0x9c, 0xd5, 0x5a, 0xfd,
+			0x9c, 0x99, 0x94, 0xd1, 0xcc, 0x5e, 0xc4, 0xda,
+			0xc7, 0x60, 0x76, 0xcf, 0x6c, 0x6a, 0x73, 0xd8,
+			0x62, 0x68, 0x97, 0x78, 0x56, 0x42, 0xc3, 0xa8,
+			0x8d, 0x75, 0x7c, 0xfb, 0xf9, 0xaa, 0x01, 0x5e,
+			0xda, 0xe3, 0xd5, 0x40, 0xdf, 0x84, 0xa5, 0x75,
+			0x19, 0x21, 0x01, 0x34, 0x55, 0xc2, 0x60, 0xa0,
+			0xf9, 0x38, 0x26, 0xec, 0x03, 0x86, 0x22, 0x17,
+			0x66, 0x90, 0x4f, 0x2c, 0x18, 0xa6, 0xaa, 0xbd,
+			0xd9, 0xd8, 0xf9, 0xcb, 0xa2, 0x5f, 0xfd, 0x10,
+			0xf6, 0xd5, 0x12, 0xc6, 0x72, 0xeb, 0x08, 0xf5,
+			0x2b, 0x5a, 0x44, 0x0f, 0x54, 0x43, 0xaa, 0xb5,
+			0xb6, 0x23, 0x17, 0xa6, 0x8b, 0x71, 0x91, 0xff,
+			0x20, 0x62, 0xa3, 0xe6, 0x0e, 0x55, 0x64, 0xcb,
+			0xdf, 0x98, 0xcd, 0xba, 0x47, 0x9c, 0x6b, 0xbe,
+			0xc8, 0xb0, 0x95, 0x98, 0x60, 0xeb, 0x88, 0x08,
+			0xee, 0x75, 0x95, 0x9f, 0x67, 0x79, 0x7c, 0x49,
+			0x49, 0xdc, 0xd9, 0x1b, 0x74, 0x0e, 0x8b, 0x67,
+			0xf3, 0x47, 0x5c, 0x7e, 0x7f, 0x09, 0x0f, 0x19,
+			0x0d, 0xe8, 0xd3, 0x97, 0x3f, 0xb3, 0x09, 0x2b,
+			0x41, 0xb6, 0xdf, 0xe7, 0xeb, 0x15, 0x85, 0xb1,
+			0xb4, 0x2f, 0x16, 0x0d, 0xdd, 0x3d, 0x06, 0x05,
+			0xea, 0x87, 0x0e, 0x19, 0x5f, 0x0f, 0xbd, 0x4e,
+			0xfc, 0x88, 0x72, 0xb5, 0x73, 0x02, 0xd0, 0x51,
+			0x7e, 0x98, 0x7b, 0x38, 0x6c, 0x4b, 0x18, 0x8c,
+			0x56, 0xf8, 0xc2, 0x8d, 0x17, 0x2f, 0x2b, 0x6e,
+			0x66, 0x56, 0x22, 0x26, 0x9c, 0xf2, 0x02, 0x5e,
+			0x3b, 0xab, 0xff, 0x65, 0x31, 0x9f, 0x86, 0xe3,
+			0xe4, 0x49, 0x64, 0x53, 0xba, 0x4d, 0x4f, 0xcd,
+			0x3b, 0x56, 0xa6, 0x09, 0x65, 0x8c, 0x2b, 0x24,
+			0x16, 0xa6, 0xee, 0xd8, 0x05, 0x59, 0xdc, 0x5e,
+			0x03, 0x04, 0xf1, 0xc0, 0x11, 0xa0, 0xd6, 0x02,
+			0xe5, 0x53, 0xdd, 0x50, 0x3c, 0xdf, 0xd4, 0x2f,
+			0x9c, 0x89, 0xcb, 0x0f, 0x4c, 0x61, 0x92, 0x98,
+			0x79, 0x2e, 0xd7, 0x71, 0x69, 0xf0, 0x6f, 0x5b,
+			0xd9, 0x8b, 0xe0, 0xdd, 0x91, 0x63, 0xf6, 0x66,
+			0xf2, 0xbb, 0xbc, 0x3f, 0x45, 0x7e, 0xdf, 0xe4,
+			0x53, 0xc5, 0x29, 0x54, 0x29, 0xc4, 0x33, 0x02,
+			0x0f, 0x35, 0xfc, 0x41, 0x28, 0xa9, 0x10, 0x0a,
+			0x32, 0x16, 0x8e, 0xc7, 0x4a, 0xc5, 0xe3, 0x29,
+			0xc4, 0x78, 0x98, 0xcd, 0x13, 0xe5, 0xa8, 0xa7,
+			0x23, 0xae, 0xaa, 0x27, 0xa3, 0x3f, 0xb5, 0x56,
+			0x2a, 0x73, 0x7c, 0xdc, 0x0b, 0xef, 0x96, 0x7e,
+			0x65, 0x42, 0xcf, 0x35, 0xe5, 0x92, 0x71, 0x63,
+			0xee, 0x10, 0x77, 0xda, 0x70, 0x6b, 0xbe, 0xad,
+			0xbe, 0x89, 0x3e, 0x81, 0x1f, 0x48, 0x6e, 0xae,
+			0x37, 0xff, 0x15, 0xe1, 0xff, 0xa8, 0x25, 0x7d,
+			0xab, 0xee, 0xcf, 0x09, 0xf0, 0x59, 0x56, 0x4b,
+			0x15, 0x8f, 0x9b, 0xc0, 0xc4, 0xc5, 0x05, 0xa5,
+			0x73, 0x37, 0x98, 0xa3, 0x23, 0x07, 0xe8, 0x34,
+			0x3e, 0x50, 0xfa, 0x53, 0xa4, 0xea, 0x2d, 0xe8,
+			0x86, 0xe2, 0x8a, 0x4e, 0xb7, 0x77, 0x63, 0xa0,
+			0x0e, 0xf1, 0xa6, 0xac, 0xb5, 0x34, 0x6c, 0xd9,
+			0x22, 0xea, 0x52, 0xe8, 0xe7, 0xb5, 0xee, 0x84,
+			0xa5, 0xb5, 0x0e, 0xc3, 0x93, 0x77, 0x48, 0xb2,
+			0x44, 0x41, 0x74, 0xfd, 0x15, 0xef, 0x15, 0x38,
+			0x1b, 0x4f, 0x07, 0xbb, 0xd6, 0x41, 0x5b, 0x24,
+			0x65, 0x9a, 0x6f, 0x74, 0xc8, 0xc0, 0x8f, 0x33,
+			0x4f, 0x8e, 0x40, 0xe0, 0xdc, 0x58, 0xf0, 0x5a,
+			0x5a, 0x75, 0xdc, 0x11, 0x92, 0xdc, 0x27, 0x8d,
+			0xb2, 0x20, 0xb5, 0xd5, 0x0e, 0x2c, 0x80, 0xf7,
+			0xee, 0x61, 0x60, 0x65, 0x72, 0xe7, 0xcc, 0x05,
+			0xff, 0x57, 0x7b, 0x0c, 0xa4, 0x86, 0x02, 0xda,
+			0xe4, 0x94, 0xe3, 0x33, 0x3d, 0xef, 0xff, 0xe3,
+			0x3d, 0x86, 0x10, 0x4c, 0xf9, 0xa9, 0x42, 0xd8,
+			0xd7, 0x9c, 0x57, 0xb7, 0x83, 0x38, 0x2f, 0x01,
+			0x80, 0x8d, 0xae, 0x76, 0x12, 0x92, 0xaf, 0xfd,
+			0xb4, 0x22, 0xe7, 0x9e, 0xbf, 0xf0, 0x44, 0xfc,
+			0x28, 0x67, 0x27, 0x1d, 0x03, 0x01, 0xe0, 0xdf,
+			0x75, 0xad, 0x1c, 0x3b, 0x18, 0x28, 0x05, 0x74,
+			0x34, 0xc3, 0x47, 0x57, 0x68, 0xf6, 0x7b, 0xf7,
+			0x99, 0xcb, 0xfc, 0x4f, 0x1f, 0xa7, 0x44, 0xbd,
+			0x22, 0xc9, 0x80, 0x3e, 0x55, 0xcc, 0xe4, 0x81,
+			0x87, 0x1e, 0x37, 0x1c, 0xf0, 0x46, 0x94, 0x15,
+			0xfd, 0xc8, 0x84, 0x3f, 0x14, 0x07, 0xe0, 0x17,
+			0xf0, 0x5c, 0x8c, 0xf0, 0x69, 0xaf, 0x47, 0x7f,
+			0x70, 0x74, 0x33, 0xc7, 0x89, 0x29, 0xe5, 0x91,
+			0x13, 0x28, 0x56, 0x6e, 0x74, 0x79, 0x52, 0x10,
+			0x2a, 0x75, 0xe6, 0x32, 0x2b, 0x57, 0x8d, 0xf4,
+			0x9d, 0x34, 0xf2, 0x14, 0x2a, 0x4c, 0xdb, 0x85,
+			0x52, 0x87, 0x0c, 0x3b, 0x19, 0x04, 0x18, 0x44,
+			0x59, 0xd0, 0xef, 0x15, 0x3e, 0xa7, 0xf9, 0x72,
+			0x61, 0x93, 0x10, 0x6b, 0x16, 0xbb, 0x59, 0x15,
+			0x26, 0x03, 0x1e, 0x89, 0x43, 0x6d, 0x5d, 0xb8,
+			0x91, 0x44, 0x93, 0x99, 0xee, 0x05, 0x01, 0x39,
+			0xb8, 0xad, 0x97, 0xd4, 0x83, 0xee, 0x69, 0xf6,
+			0x2a, 0x6c, 0x10, 0xeb, 0x75, 0xf0, 0xe9, 0x34,
+			0xf3, 0x00, 0xab, 0x1e, 0x1b, 0x04, 0x36, 0x49,
+			0xaa, 0x82, 0xe2, 0x05, 0x49, 0xb3, 0xa5, 0x32,
+			0xae, 0x4d, 0xbd, 0x44, 0x89, 0x66, 0xf0, 0x36,
+			0x7f, 0x9f, 0xf4, 0xb9, 0x9b, 0x8e, 0x5b, 0x5e,
+			0x96, 0x32, 0xec, 0x4c, 0x0d, 0x50, 0xed, 0xf9,
+			0x2b, 0x48, 0x9f, 0x24, 0x0e, 0x74, 0x09, 0x21,
+			0x85, 0xea, 0x04, 0xb3, 0x6e, 0x14, 0x75, 0x9c,
+			0x96, 0x7b, 0x3b, 0xec, 0xa2, 0x61, 0x04, 0x40,
+			0x5c, 0x77, 0x12, 0xa8, 0x54, 0x14, 0x63, 0x12,
+			0xa5, 0xd6, 0xa8, 0x8a, 0xcd, 0x30, 0x35, 0x05,
+			0xd8, 0xba, 0x52, 0xef, 0x00, 0x92, 0x45, 0x31,
+			0xc8, 0x7d, 0x8e, 0xaa, 0xac, 0xe0, 0x4a, 0x48,
+			0x74, 0xd8, 0x78, 0xb0, 0x51, 0x3d, 0xe0, 0x3e,
+			0xf6, 0x1b, 0xd9, 0xdf, 0x55, 0xcc, 0x88, 0x56,
+			0x0c, 0xa1, 0x3f, 0xf6, 0xe2, 0x15, 0x29, 0x8b,
+			0x52, 0x83, 0xd6, 0x21, 0x50, 0xf3, 0xbd, 0xb7,
+			0xc4, 0x5e, 0x7a, 0x74, 0xe2, 0x91, 0xcc, 0x61,
+			0x7c, 0x41, 0x8f, 0xdf, 0x9f, 0xea, 0xbb, 0x23,
+			0xfd, 0xf2, 0xf1, 0x1e, 0x36, 0xe0, 0x7e, 0x5b,
+			0x09, 0xc3, 0xe9, 0xe8, 0x4e, 0x37, 0xee, 0x3f,
+			0x49, 0x1a, 0x8f, 0x11, 0xcf, 0x3a, 0x0e, 0x11,
+			0x25, 0xc9, 0x9d, 0x8e, 0xf6, 0x2d, 0xd7, 0xcf,
+			0xce, 0x17, 0x0f, 0x37, 0x51, 0x88, 0xaa, 0x64,
+			0x6f, 0x02, 0x43, 0x6f, 0x4c, 0xe9, 0x42, 0x89,
+			0xa2, 0x51, 0xb0, 0x94, 0x81, 0x4d, 0xd6, 0x3e,
+			0x26, 0x43, 0xc0, 0x0e, 0x99, 0xb9, 0xcb, 0x21,
+			0x14, 0x6f, 0xbf, 0xf7, 0x9c, 0x19, 0xd5, 0x4a,
+			0xfb, 0x0c, 0xa9, 0x8a, 0x60, 0x0b, 0x90, 0x09,
+			0x18, 0x92, 0xa2, 0x23, 0xfa, 0xcd, 0xb4, 0x99,
+			0xc8, 0x20, 0x4f, 0x15, 0x06, 0x05, 0xbd, 0xdb,
+			0xbf, 0x1c, 0x78, 0x0b, 0x56, 0x99, 0xc8, 0x4a,
+			0x52, 0x70, 0x8b, 0x82, 0x9f, 0xce, 0xaf, 0x6b,
+			0xca, 0xef, 0x41, 0x52, 0xd5, 0xaf, 0x87, 0x56,
+			0x35, 0x45, 0x22, 0xad, 0x62, 0x79, 0x9f, 0xe5,
+			0xf9, 0xf0, 0x10, 0x65, 0x2e, 0xa9, 0x94, 0x5b,
+			0xbb, 0xd6, 0xb7, 0x77, 0x68, 0xf4, 0xde, 0x6d,
+			0xd9, 0x72, 0x48, 0x81, 0xa9, 0x35, 0x6a, 0x67,
+			0xa1, 0xb9, 0x87, 0x8f, 0x43, 0x9e, 0x36, 0x0b,
+			0x0a, 0xfe, 0xd5, 0x19, 0x2d, 0xf4, 0xdc, 0xcb,
+			0xb8, 0x02, 0xb2, 0x2e, 0xb1, 0xb4, 0xc0, 0x80,
+			0x35, 0xa8, 0xf2, 0x9b, 0xc2, 0x4e, 0x91, 0x67,
+			0xd8, 0x14, 0x57, 0x4e, 0x2a, 0x33, 0xfd, 0xdb,
+			0x60, 0xea, 0x53, 0x88, 0xb7, 0x2a, 0x37, 0x57,
+			0x54, 0xfb, 0x90, 0x75, 0x80, 0xb9, 0x39, 0x27,
+			0x90, 0x06, 0x17, 0x68, 0xf8, 0x2c, 0x81, 0x7b,
+			0xc8, 0xf7, 0x4b, 0x75, 0x75, 0x91, 0xe2, 0x83,
+			0x96, 0x38, 0x90, 0x9d, 0xf1, 0x24, 0x9e, 0x1c,
+			0x11, 0x0c, 0x5e, 0x1c, 0x16, 0x1e, 0xd8, 0xb1,
+			0xbe, 0xec, 0x79, 0x8a, 0xe5, 0x7c, 0x3b, 0x4a,
+			0x34, 0x0a, 0x86, 0xe8, 0xa6, 0x5a, 0xb0, 0x58,
+			0x2e, 0x56, 0x6c, 0x01, 0xa8, 0xdb, 0xd2, 0x5d,
+			0x96, 0xe7, 0x13, 0xc3, 0x22, 0x16, 0xdb, 0x1d,
+			0x4b, 0x2f, 0xc2, 0x14, 0x1e, 0x5a, 0x69, 0xb4,
+			0x0f, 0x4e, 0xc8, 0x48, 0xed, 0x02, 0x0b, 0x8a,
+			0x24, 0xc0, 0x9c, 0x01, 0x4c, 0x7d, 0xa7, 0x6a,
+			0xa5, 0x15, 0x9b, 0x99, 0x7f, 0x88, 0xb6, 0xb0,
+			0x40, 0xad, 0xcc, 0xe1, 0x9b, 0xe9, 0x37, 0x44,
+			0xde, 0x70, 0xb3, 0x70, 0x06, 0x34, 0xb1, 0xd1,
+			0xb2, 0x50, 0xaf, 0xbc, 0xc9, 0xc9, 0x68, 0x20,
+			0x5d, 0x4a, 0x6d, 0xa3, 0x32, 0x72, 0x46, 0xf9,
+			0x39, 0xcd, 0xde, 0x35, 0xee, 0x66, 0x81, 0x33,
+			0x1b, 0x87, 0xa4, 0xde, 0x20, 0x1c, 0x77, 0xda,
+			0xee, 0xd3, 0x7a, 0xd8, 0x95, 0xd8, 0x26, 0xcd,
+			0xeb, 0x1f, 0x6f, 0x71, 0xa0, 0x92, 0xc1, 0xc3,
+			0x36, 0xbf, 0x4c, 0x2c, 0x5f, 0x67, 0xa0, 0x34,
+			0x22, 0xb2, 0xab, 0xed, 0xaa, 0x5a, 0xbf, 0x9c,
+			0x3e, 0x28, 0xc9, 0x95, 0xed, 0xb0, 0x12, 0x9b,
+			0x4c, 0x30, 0x95, 0xc0, 0xb6, 0xb8, 0x52, 0xae,
+			0xdb, 0xfb, 0x29, 0x09, 0xb8, 0xf9, 0x80, 0x10,
+			0xc9, 0x13, 0xc5, 0x86, 0x71, 0xe5, 0x37, 0x36,
+			0x64, 0xed, 0x30, 0xb9, 0xba, 0x5a, 0x90, 0x8d,
+			0x1a, 0xb7, 0xf0, 0xea, 0x4f, 0xd9, 0x04, 0x28,
+			0xc7, 0x39, 0x13, 0xbf, 0xea, 0xc1, 0x15, 0x93,
+			0xf1, 0x69, 0x61, 0xbd, 0x8c, 0x62, 0x27, 0xee,
+			0x41, 0x0c, 0xb8, 0x4c, 0xbf, 0x4d, 0x39, 0x81,
+			0x85, 0x24, 0x8d, 0xac, 0x29, 0xb9, 0x00, 0x28,
+			0x39, 0x1b, 0x72, 0x59, 0xdf, 0xf6, 0x1c, 0x64,
+			0x76, 0x28, 0x46, 0x86, 0x88, 0xc3, 0x21, 0x66,
+			0x52, 0xbc, 0xa9, 0xdb, 0x48, 0x68, 0xac, 0x3b,
+			0x6f, 0xc4, 0xbc, 0xcb, 0xb7, 0xd2, 0xbb, 0x89,
+			0x39, 0x72, 0xa0, 0x6d, 0x90, 0x02, 0x77, 0xf6,
+			0x6a, 0x38, 0x19, 0xfc, 0x56, 0xf6, 0x31, 0xc0,
+			0x28, 0x23, 0x6b, 0xe3, 0xe2, 0x16, 0x63, 0xab,
+			0xd6, 0x6b, 0xd2, 0x98, 0x0f, 0x20, 0x3d, 0x5d,
+			0x94, 0x73, 0x7f, 0x6d, 0x7e, 0xc0, 0x77, 0xa5,
+			0xb5, 0x67, 0xeb, 0x02, 0x1e, 0x2e, 0x63, 0xe1,
+			0x5b, 0x00, 0x88, 0x36, 0x3f, 0xe5, 0xa3, 0x5c,
+			0xad, 0xec, 0xc1, 0xcb, 0xde, 0xd5, 0x99, 0xd8,
+			0xd0, 0xf2, 0x41, 0x0e, 0x13, 0x55, 0xaf, 0x7b,
+			0x9b, 0xa6, 0x06, 0xeb, 0xae, 0x68, 0x5e, 0xed,
+			0xfe, 0x16, 0xda, 0x95, 0x9a, 0xaf, 0xa9, 0x30,
+			0x87, 0x37, 0xcb, 0x98, 0x73, 0x0a, 0xc1, 0x2f,
+			0x0c, 0x15, 0x1c, 0x43, 0x61, 0xc0, 0xd7, 0x30,
+			0x16, 0xd3, 0xf7, 0x84, 0x3b, 0x27, 0xba, 0xbf,
+			0xda, 0x48, 0xb6, 0x81, 0x74, 0x8a, 0x8d, 0xf2,
+			0xe0, 0xa3, 0xa3, 0x7b, 0x80, 0xa6, 0x74, 0x7d,
+			0x8b, 0x04, 0xf1, 0x8c, 0x93, 0x8c, 0xd4, 0xc1,
+			0xeb, 0xa3, 0x1a, 0x2c, 0x40, 0xc8, 0x3a, 0xed,
+			0x62, 0x93, 0x04, 0x6f, 0x6f, 0xaa, 0x4e, 0xaa,
+			0x5f, 0x8a, 0x3e, 0x84, 0x8c, 0xe6, 0xa8, 0x6b,
+			0x45, 0x34, 0x99, 0x31, 0xed, 0xec, 0x86, 0x86,
+			0x5d, 0xf0, 0x91, 0x7c, 0x03, 0x3d, 0x7f, 0x60,
+			0x92, 0x5e, 0x43, 0xe5, 0x42, 0x7c, 0x71, 0xb7,
+			0x7b, 0x16, 0x2d, 0x1c, 0x19, 0x49, 0xed, 0x1d,
+			0x00, 0xeb, 0xaf, 0x96, 0x7d, 0x97, 0xbc, 0xa6,
+			0x87, 0x75, 0x4d, 0x9d, 0x66, 0x98, 0x89, 0x39,
+			0x1d, 0xbd, 0x62, 0x4f, 0xed, 0x02, 0x5d, 0xba,
+			0x90, 0x6c, 0xf0, 0x6f, 0xf2, 0xdb, 0x02, 0xfc,
+			0x30, 0x6a, 0x4f, 0x9a, 0x90, 0xeb, 0x71, 0xc0,
+			0x95, 0xfe, 0xac, 0x13, 0x1a, 0xce, 0x47, 0x27,
+			0xcc, 0xe5, 0x75, 0x7b, 0xae, 0xc0, 0x82, 0xd0,
+			0x6a, 0xaa, 0xbe, 0xc6, 0x12, 0x04, 0x96, 0x93,
+			0xd8, 0x77, 0xfd, 0xa3, 0xba, 0x8b, 0x62, 0x14,
+			0xbd, 0x05, 0xf7, 0x6c, 0x36, 0xf7, 0xb0, 0x5d,
+			0xe1, 0xb8, 0x42, 0x74, 0xdf, 0x11, 0x78, 0x3a,
+			0x4f, 0x73, 0x44, 0x96, 0x23, 0x00, 0xbe, 0x9c,
+			0x9e, 0xbf, 0x8f, 0x09, 0xc2, 0xbf, 0xf9, 0x80,
+			0x54, 0x2c, 0x59, 0x4e, 0xbb, 0xfb, 0x35, 0xb7,
+			0x8a, 0xb2, 0xe9, 0xf4, 0xc4, 0xbd, 0xca, 0x87,
+			0x5a, 0xb0, 0x42, 0x55, 0xf1, 0x1d, 0x9c, 0x80,
+			0xc2, 0x33, 0x0e, 0xdc, 0x97, 0xe9, 0x19, 0xb5,
+			0x2d, 0x0e, 0x5b, 0x0a, 0x11, 0x6c, 0xcb, 0xac,
+			0x09, 0x05, 0x0a, 0xa0, 0xeb, 0xa1, 0xc6, 0x38,
+			0x2d, 0x6c, 0x4e, 0x92, 0xb1, 0x24, 0xfc, 0x75,
+			0x73, 0xe6, 0x13, 0x22, 0xb3, 0xa0, 0x4d, 0xae,
+			0x94, 0xab, 0xac, 0xc0, 0xca, 0xac, 0x94, 0x29,
+			0x71, 0xe6, 0x4a, 0xa8, 0xec, 0x44, 0x42, 0x78,
+			0x7f, 0x0c, 0xdb, 0x25, 0xb3, 0x76, 0xf6, 0xff,
+			0x8c, 0xdd, 0xe7, 0x93, 0x5e, 0xdc, 0x88, 0x03,
+			0x5f, 0x87, 0x57, 0xcc, 0x41, 0x56, 0x0d, 0x54,
+			0xbc, 0x6b, 0xce, 0x9f, 0x04, 0x37, 0x79, 0x2a,
+			0x8e, 0x47, 0xb7, 0x57, 0xaa, 0x45, 0xaf, 0xa2,
+			0xa8, 0x5d, 0xd6, 0x48, 0xc8, 0x66, 0xbc, 0x88,
+			0x64, 0xb2, 0xbd, 0xb7, 0x54, 0xa3, 0x40, 0x6b,
+			0xa3, 0x78, 0xc3, 0xd2, 0xd4, 0x9e, 0xa7, 0x46,
+			0xab, 0x8c, 0x59, 0xd2, 0xa8, 0x80, 0x20, 0x66,
+			0xa1, 0x5f, 0xc2, 0x71, 0x19, 0xf7, 0xe2, 0x87,
+			0xab, 0x4e, 0x89, 0x0e, 0x5c, 0x33, 0x09, 0x8c,
+			0xe1, 0x78, 0x9c, 0xca, 0x34, 0x12, 0x87, 0x17,
+			0xc0, 0xd1, 0x25, 0xfb, 0xc8, 0x60, 0xd4, 0xdf,
+			0x14, 0x9f, 0xd5, 0x06, 0x96, 0x1a, 0x28, 0x56,
+			0x24, 0x4b, 0xec, 0x4d, 0x51, 0x69, 0xba, 0xf1,
+			0xc2, 0x81, 0x6d, 0xfb, 0xbc, 0x0e, 0xaf, 0x72,
+			0xf6, 0x9c, 0xc4, 0xee, 0x68, 0xdf, 0xa8, 0xbd,
+			0x5f, 0x62, 0xa4, 0x60, 0x94, 0xd7, 0x2b, 0xe6,
+			0xb0, 0xe5, 0x33, 0x28, 0xe1, 0x86, 0x15, 0xf6,
+			0x81, 0x2a, 0x98, 0x16, 0x70, 0x1c, 0x92, 0x1d,
+			0xf5, 0x26, 0x42, 0x98, 0x65, 0xf6, 0x2a, 0x25,
+			0x0c, 0x26, 0xb6, 0xc0, 0xed, 0xc2, 0x02, 0x70,
+			0x59, 0x9e, 0xab, 0x9e, 0x65, 0xaa, 0x15, 0x62,
+			0xa8, 0xac, 0xef, 0x93, 0x21, 0xd4, 0x4f, 0x46,
+			0x17, 0x59, 0xa3, 0x81, 0xc9, 0xa3, 0xab, 0x95,
+			0x3f, 0x32, 0xb6, 0x97, 0x70, 0x10, 0xae, 0x40,
+			0x14, 0x57, 0xec, 0x48, 0x30, 0x31, 0xc7, 0xe2,
+			0x76, 0xde, 0xe8, 0x26, 0x21, 0x4b, 0xa4, 0x6f,
+			0x44, 0xeb, 0xbb, 0x2c, 0x0c, 0x59, 0x01, 0x5b,
+			0xc3, 0xba, 0x30, 0x47, 0x99, 0x2f, 0x64, 0x6f,
+			0xfa, 0xb2, 0x0a, 0x6e, 0xc2, 0xe7, 0xab, 0x96,
+			0xf7, 0xb1, 0x1c, 0x08, 0x43, 0x92, 0xc4, 0xb7,
+			0xa9, 0x75, 0x10, 0x93, 0x52, 0xc7, 0xce, 0x2e,
+			0xc6, 0x9a, 0x30, 0x55, 0x4f, 0xab, 0x8e, 0x43,
+			0x16, 0x94, 0xdc, 0xb0, 0x46, 0xd6, 0x28, 0x08,
+			0xf6, 0xfd, 0xbd, 0x8d, 0xe5, 0xd0, 0xee, 0x24,
+			0xdc, 0xae, 0x8a, 0x58, 0xd8, 0xb3, 0x22, 0x4c,
+			0x51, 0xd3, 0x2b, 0x59, 0x9f, 0x9a, 0xf3, 0x18,
+			0x7e, 0xca, 0x88, 0x95, 0xfc, 0x53, 0x28, 0x40,
+			0xfb, 0x32, 0x8a, 0xb3, 0x9d, 0x08, 0xea, 0x6d,
+			0xfb, 0xcc, 0x82, 0x3a, 0x88, 0x69, 0xc5, 0x2d,
+			0x8d, 0xf2, 0xdb, 0x3f, 0x3f, 0xc1, 0x85, 0x6d,
+			0x0a, 0x64, 0xc4, 0xda, 0x8e, 0xbe, 0x0d, 0x96,
+			0xf3, 0x4f, 0x7b, 0x33, 0x09, 0xa7, 0xf8, 0x11,
+			0x3a, 0x38, 0x41, 0xac, 0x79, 0x92, 0x98, 0xce,
+			0x8f, 0x65, 0xc0, 0x2a, 0x0e, 0x57, 0x11, 0x6b,
+			0xc8, 0x87, 0x0b, 0xd0, 0x6b, 0x28, 0x98, 0xcc,
+			0x9f, 0x0d, 0xe7, 0x66, 0x7b, 0xf3, 0xbe, 0xd4,
+			0x5c, 0xe6, 0x5f, 0xa0, 0x4b, 0x9e, 0x3b, 0xa2,
+			0x73, 0xca, 0xa8, 0x6b, 0xb3, 0x2d, 0x11, 0x2c,
+			0xfa, 0x72, 0x42, 0xb0, 0x69, 0xc2, 0x02, 0x3d,
+			0x2a, 0xf7, 0xf2, 0xb8, 0x5f, 0x35, 0x92, 0xe2,
+			0xfb, 0x50, 0xc5, 0xdc, 0x2d, 0xe3, 0xc8, 0x63,
+			0xad, 0x7b, 0x01, 0x6a, 0x16, 0xcd, 0xb8, 0xf5,
+			0x09, 0x78, 0xf4, 0x06, 0x8f, 0xa4, 0xb4, 0x68,
+			0x3c, 0x90, 0x9d, 0x49, 0x7f, 0x93, 0x14, 0xb1,
+			0x69, 0xb3, 0x15, 0x8b, 0x00, 0xc3, 0xc9, 0xc1,
+			0x26, 0xfa, 0x40, 0x41, 0x34, 0x54, 0x1a, 0x2a,
+			0x14, 0x4f, 0x82, 0xa9, 0xea, 0x1f, 0xd3, 0x2b,
+			0x00, 0xeb, 0xee, 0x1e, 0xbe, 0xd2, 0x55, 0xe3,
+			0x10, 0x35, 0x27, 0x89, 0x46, 0xdb, 0xac, 0x64,
+			0x48, 0x4f, 0x61, 0x23, 0x2e, 0x3c, 0xd8, 0xcf,
+			0x7a, 0xf3, 0xac, 0xb3, 0xc2, 0x5f, 0xef, 0x5c,
+			0x08, 0x88, 0x89, 0x14, 0x0f, 0xe2, 0xcd, 0xfe,
+			0x13, 0xbd, 0x8e, 0xc8, 0xef, 0x76, 0x0d, 0xed,
+			0xeb, 0x99, 0xdb, 0x1c, 0xad, 0xdd, 0x98, 0xa6,
+			0xd1, 0x34, 0x61, 0xf1, 0xe0, 0x05, 0x7e, 0x56,
+			0x67, 0xe7, 0x90, 0xf5, 0x9e, 0xb4, 0xa8, 0xe5,
+			0xf6, 0xc6, 0x86, 0x92, 0xc9, 0x3a, 0xc3, 0x84,
+			0x8e, 0xa0, 0x94, 0xe1, 0x62, 0xb0, 0xe9, 0xc5,
+			0xce, 0xed, 0xb8, 0xf6, 0x24, 0x33, 0xc3, 0x80,
+			0x3a, 0xd7, 0xc1, 0x39, 0x36, 0xdd, 0xd7, 0x4a,
+			0x0f, 0x85, 0x6d, 0x2b, 0xb7, 0x05, 0x07, 0x87,
+			0x93, 0x3e, 0xd7, 0xf9, 0x13, 0x3f, 0x1a, 0xcd,
+			0x17, 0x84, 0x4e, 0x78, 0x3d, 0xf4, 0x25, 0xb0,
+			0x48, 0xb3, 0x01, 0x09, 0x10, 0xa3, 0xa9, 0x6f,
+			0x46, 0xc0, 0x44, 0x86, 0x58, 0x7a, 0xdc, 0xb6,
+			0x0e, 0x8a, 0xeb, 0xe9, 0x60, 0x9c, 0x25, 0x9c,
+			0x4c, 0x59, 0xac, 0x36, 0xad, 0x37, 0xfb, 0xda,
+			0x64, 0xc4, 0xb8, 0x8e, 0x23, 0xad, 0x8e, 0xf3,
+			0x04, 0x48, 0xf5, 0x4f, 0x23, 0x0f, 0xce, 0x68,
+			0x01, 0xf6, 0xb0, 0x65, 0x39, 0xb3, 0xda, 0x50,
+			0xc5, 0xb3, 0x6f, 0x40, 0x00, 0x72, 0x2b, 0xa8,
+			0x74, 0xfb, 0x6e, 0xf2, 0xc9, 0x9a, 0x6a, 0x90,
+			0x7e, 0x90, 0x98, 0x3b, 0x1a, 0x63, 0xff, 0x78,
+			0xc3, 0x60, 0xaf, 0x4e, 0xe8, 0x63, 0xab, 0x55,
+			0x6b, 0x43, 0xd9, 0x50, 0x4a, 0x87, 0x13, 0xcf,
+			0x3d, 0x91, 0x94, 0x0b, 0x5d, 0x56, 0xb0, 0x8f,
+			0x62, 0x90, 0x05, 0x7d, 0x05, 0xc1, 0x29, 0x54,
+			0x6d, 0x2e, 0x19, 0x98, 0x18, 0xe6, 0x28, 0x5c,
+			0xa9, 0x37, 0x2b, 0x55, 0x22, 0xe2, 0x31, 0x0b,
+			0x2c, 0x6f, 0xbc, 0xd4, 0x87, 0xe8, 0xc6, 0x0e,
+			0x64, 0xa6, 0x89, 0xd2, 0xa8, 0xde, 0xd7, 0x0d,
+			0x0d, 0x29, 0x22, 0xf8, 0x65, 0x4f, 0x0d, 0x97,
+			0x6f, 0xad, 0x34, 0x27, 0x8f, 0x43, 0xa0, 0x4e,
+			0x3a, 0x5c, 0x29, 0xd6, 0xb0, 0x8b, 0x36, 0x30,
+			0x0c, 0x61, 0x0b, 0x9e, 0xd0, 0x0b, 0x60, 0x84,
+			0xab, 0xa0, 0xbc, 0x74, 0x14, 0x1f, 0xf8, 0xbb,
+			0x68, 0x09, 0x62, 0x2b, 0xd9, 0x2d, 0xeb, 0x63,
+			0xca, 0x98, 0x4a, 0x4d, 0x4b, 0x22, 0xf0, 0x44,
+			0x38, 0x63, 0x61, 0x4f, 0x2d, 0x80, 0x00, 0xef,
+			0xa9, 0xd0, 0xda, 0x3b, 0xf4, 0x8b, 0xd4, 0xd1,
+			0x74, 0x1d, 0xf9, 0x1c, 0x1c, 0xca, 0xba, 0xec,
+			0x14, 0x14, 0x9d, 0x51, 0x4b, 0x65, 0x07, 0xf0,
+			0xb3, 0xcb, 0x73, 0xa5, 0x40, 0x7c, 0x3a, 0xdb,
+			0x25, 0x36, 0xec, 0x47, 0xd9, 0xb3, 0x66, 0x1f,
+			0x28, 0x7e, 0x4e, 0x89, 0x06, 0x7f, 0x01, 0x61,
+			0x0e, 0xa0, 0xda, 0xf0, 0x07, 0xfe, 0xf4, 0x4f,
+			0x64, 0x4f, 0xce, 0xdd, 0x19, 0x76, 0x7b, 0x9b,
+			0x6f, 0x41, 0xc9, 0xf9, 0x48, 0x79, 0x2d, 0x3d,
+			0xbd, 0xfb, 0x3b, 0x90, 0x50, 0x96, 0x97, 0xfe,
+			0xf0, 0x9a, 0x8d, 0x77, 0x24, 0xc1, 0xbe, 0x31,
+			0xa3, 0x70, 0x86, 0x38, 0x94, 0xce, 0xd3, 0xbc,
+			0x94, 0x61, 0x9c, 0x91, 0xca, 0xa2, 0xd3, 0x2a,
+			0x54, 0x85, 0xc1, 0xf2, 0x20, 0x7d, 0xdb, 0x35,
+			0xd5, 0x6a, 0xec, 0x85, 0x60, 0x5a, 0x92, 0xa3,
+			0x94, 0x6e, 0xaf, 0x9e, 0xa8, 0x60, 0xf4, 0xb8,
+			0x16, 0xe1, 0xdd, 0x18, 0x30, 0x21, 0x33, 0x51,
+			0xb7, 0xed, 0x88, 0x73, 0x57, 0x5d, 0x09, 0x76,
+			0x9a, 0x2f, 0xcf, 0x6d, 0xef, 0x5a, 0x5e, 0x37,
+			0x86, 0xf8, 0x4b, 0xba, 0xd1, 0x25, 0xa0, 0xe9,
+			0x43, 0xc4, 0x6a, 0xb8, 0xfc, 0x0f, 0x1d, 0xf1,
+			0xcb, 0x72, 0x4a, 0x06, 0x49, 0x84, 0x78, 0x2a,
+			0x40, 0x04, 0xa5, 0x36, 0xae, 0x1d, 0x4e, 0xbe,
+			0x2c, 0xd2, 0x47, 0x63, 0x7f, 0xee, 0x3e, 0xbe,
+			0xe9, 0x95, 0x9b, 0x38, 0x9c, 0x9b, 0x80, 0x82,
+			0x88, 0xc7, 0xa5, 0x44, 0x68, 0x50, 0x65, 0x65,
+			0x3e, 0x56, 0x92, 0xc4, 0xa4, 0x70, 0x8a, 0xc2,
+			0x54, 0x44, 0x03, 0xea, 0x69, 0x35, 0xc0, 0x90,
+			0x17, 0xc9, 0xa4, 0x6d, 0x0e, 0x7a, 0xf0, 0xba,
+			0x02, 0x36, 0xa3, 0x2e, 0x88, 0x81, 0x8e, 0xfe,
+			0xc7, 0x57, 0xb1, 0x53, 0xf2, 0x2f, 0x41, 0x5b,
+			0x00, 0x55, 0x04, 0x5d, 0x7d, 0x37, 0xb4, 0xb4,
+			0xdf, 0xed, 0xc0, 0x2a, 0xc3, 0x63, 0x45, 0x6b,
+			0x78, 0x4d, 0xd8, 0x76, 0xe0, 0xa6, 0xb3, 0x93,
+			0x99, 0x15, 0x93, 0x2d, 0xbc, 0x08, 0x83, 0x35,
+			0x7d, 0x03, 0x27, 0xf9, 0x1d, 0xe6, 0xdf, 0x0b,
+			0x35, 0xe2, 0xad, 0x3e, 0x44, 0xc3, 0xf0, 0x0f,
+			0x28, 0xe9, 0x9e, 0x4f, 0x21, 0x8d, 0x8d, 0xd8,
+			0x62, 0x3e, 0xa7, 0x80, 0xb3, 0xaa, 0xdd, 0xc6,
+			0x52, 0xb8, 0x3c, 0xee, 0x52, 0x1d, 0x37, 0x19,
+			0x80, 0x67, 0x0a, 0x9c, 0xcb, 0x2b, 0x25, 0xf4,
+			0x4f, 0x4b, 0xbe, 0xb1, 0xe4, 0x8a, 0x27, 0x2e,
+			0xe7, 0x1b, 0x81, 0x4e, 0x66, 0x77, 0xb2, 0xbc,
+			0x47, 0xf3, 0x6f, 0x21, 0xe3, 0x0a, 0xe8, 0x3d,
+			0x0e, 0x65, 0x8e, 0x27, 0xc2, 0x19, 0xa6, 0x7e,
+			0xfd, 0x29, 0x3f, 0xff, 0xed, 0xfa, 0xfe, 0x29,
+			0x51, 0xdd, 0xe1, 0xa3, 0x85, 0x29, 0xf1, 0x95,
+			0xe9, 0xaa, 0x49, 0x47, 0x7d, 0x83, 0x8f, 0x1a,
+			0x25, 0xb7, 0xe5, 0xbf, 0xe9, 0xf8, 0xe6, 0x04,
+			0x49, 0xd1, 0x87, 0xaf, 0x0a, 0x23, 0xa2, 0x9b,
+			0x59, 0x47, 0x23, 0x8e, 0x53, 0x9e, 0x00, 0xae,
+			0x78, 0xfb, 0xe9, 0xca, 0x17, 0x20, 0xb1, 0x53,
+			0xec, 0x46, 0x23, 0x78, 0x8b, 0x57, 0x82, 0xd4,
+			0xa0, 0xe7, 0xbf, 0xda, 0xba, 0xa9, 0xac, 0xf9,
+			0xca, 0x38, 0x98, 0x96, 0xe2, 0xda, 0x33, 0x3e,
+			0x96, 0x0f, 0xd4, 0xab, 0xc9, 0x01, 0x02, 0x79,
+			0xeb, 0xb7, 0x94, 0xf1, 0x44, 0x8c, 0xee, 0x37,
+			0x99, 0xb2, 0xdc, 0xd1, 0xa5, 0xe3, 0x2f, 0xee,
+			0xc4, 0xba, 0x3e, 0xcd, 0xa2, 0x7d, 0xe2, 0x20,
+			0x59, 0xbe, 0xb9, 0x1b, 0xf2, 0x7d, 0x68, 0x53,
+			0x22, 0xb8, 0x1c, 0x57, 0x33, 0xce, 0x45, 0xfb,
+			0xde, 0x0d, 0xcb, 0x1f, 0x2b, 0x78, 0xc6, 0x9d,
+			0xee, 0x5b, 0x61, 0x18, 0xc7, 0xfb, 0x33, 0x31,
+			0x57, 0xed, 0xdc, 0xfa, 0xb7, 0x31, 0xb4, 0xf4,
+			0x2b, 0x78, 0x7e, 0x3f, 0x68, 0x53, 0x44, 0xa7,
+			0xf4, 0x86, 0x14, 0xab, 0x7f, 0xa2, 0x29, 0xd5,
+			0xc8, 0xb8, 0xba, 0x62, 0xe2, 0x7b, 0xe5, 0x46,
+			0xb2, 0xa3, 0xb5, 0xc1, 0xfe, 0x56, 0xef, 0x3b,
+			0x56, 0x33, 0x7b, 0x2e, 0x0a, 0x90, 0x95, 0x74,
+			0x76, 0x55, 0x54, 0x1b, 0xcb, 0xe6, 0x61, 0xc3,
+			0x6c, 0x44, 0xbf, 0xaf, 0x29, 0x37, 0x54, 0x10,
+			0x52, 0xf1, 0x02, 0x59, 0x5f, 0xee, 0x2b, 0x3d,
+			0x2d, 0x4f, 0x0b, 0xb7, 0x83, 0x26, 0xca, 0xdc,
+			0x93, 0x99, 0x8e, 0xf0, 0x8f, 0x45, 0x48, 0x79,
+			0xc9, 0xdb, 0xf3, 0x3b, 0x51, 0x9b, 0xe4, 0x9f,
+			0x8d, 0xaf, 0xc0, 0x01, 0x17, 0xdb, 0x98, 0x29,
+			0xd9, 0xb2, 0x65, 0x34, 0x83, 0x8e, 0x1d, 0x83,
+			0x9e, 0xfa, 0x82, 0x06, 0xb5, 0xb0, 0xc6, 0x31,
+			0x62, 0x7e, 0x65, 0xa8, 0x13, 0x42, 0x51, 0x6d,
+			0x00, 0x2a, 0xfa, 0x50, 0xbe, 0xb9, 0xe6, 0x3f,
+			0x4b, 0xf6, 0x12, 0x8c, 0xdc, 0x26, 0x6c, 0x92,
+			0x1c, 0xd2, 0x8c, 0xd6, 0xd3, 0x6a, 0x2b, 0xc5,
+			0x46, 0x0f, 0xbf, 0xd4, 0x3c, 0x7b, 0x99, 0xcc,
+			0x7f, 0xf0, 0x02, 0xc7, 0xcb, 0xef, 0x65, 0x5b,
+			0x55, 0x4a, 0x9e, 0x13, 0x16, 0x7d, 0xcf, 0x94,
+			0x4d, 0x88, 0x15, 0x90, 0xf8, 0x42, 0x0b, 0xf9,
+			0x92, 0x6f, 0x47, 0x36, 0xed, 0x70, 0x61, 0x42,
+			0x20, 0xa6, 0xb8, 0x47, 0xd0, 0xa1, 0x9f, 0xbe,
+			0xf5, 0xcc, 0x33, 0xbd, 0xfe, 0xb5, 0x14, 0x06,
+			0x68, 0xb8, 0xa7, 0x38, 0xb9, 0xe2, 0xb4, 0x54,
+			0x64, 0x85, 0x86, 0xa1, 0xa6, 0x2b, 0xcf, 0x15,
+			0xf5, 0xca, 0x30, 0xd4, 0x3f, 0xcc, 0x10, 0x01,
+			0xb0, 0x39, 0x3d, 0xc6, 0x96, 0x14, 0xda, 0xc2,
+			0xd9, 0xcd, 0x04, 0xfb, 0x53, 0x3b, 0x3b, 0xe2,
+			0x37, 0x3b, 0x81, 0x26, 0x7f, 0x2f, 0xba, 0xcb,
+			0xdb, 0x2b, 0xea, 0x91, 0x0e, 0x17, 0x96, 0x70,
+			0xf6, 0xc2, 0x8e, 0xc7, 0xeb, 0x4f, 0xd5, 0xcb,
+			0x96, 0xc5, 0x0f, 0xb3, 0x55, 0xbc, 0xae, 0x14,
+			0xe7, 0x6f, 0x24, 0x88, 0x69, 0x70, 0x80, 0x74,
+			0x34, 0xa4, 0x3e, 0x0d, 0xd2, 0x9c, 0x5e, 0x05,
+			0x91, 0x6d, 0xef, 0x6c, 0x96, 0x50, 0xf1, 0x31,
+			0x02, 0xd2, 0xf0, 0x3f, 0x11, 0xaa, 0x35, 0x92,
+			0x71, 0xfd, 0x0e, 0xd1, 0x29, 0xb5, 0xf6, 0x85,
+			0x4c, 0xe0, 0x8f, 0x1a, 0xad, 0x03, 0x5f, 0xa6,
+			0x5c, 0x46, 0xe2, 0x70, 0x48, 0x34, 0x13, 0x7c,
+			0x35, 0x9a, 0x03, 0x19, 0x77, 0x23, 0x7b, 0xcc,
+			0x57, 0xc2, 0x7f, 0x87, 0x96, 0x26, 0x28, 0xb4,
+			0x2d, 0xd6, 0xc7, 0x1c, 0x5f, 0xde, 0xb9, 0xa5,
+			0xd2, 0x5f, 0x96, 0xf4, 0x33, 0x51, 0xad, 0x49,
+			0xd4, 0x37, 0x7b, 0x30, 0x0b, 0x0b, 0x39, 0xc2,
+			0xdb, 0x3f, 0xf8, 0x57, 0x69, 0x32, 0xba, 0x9d,
+			0x1c, 0x05, 0xc7, 0xc8, 0x1b, 0x45, 0xf2, 0xfb,
+			0x0c, 0xf7, 0x16, 0x67, 0xb1, 0x3c, 0x58, 0x9e,
+			0x48, 0x0a, 0x14, 0xf2, 0x90, 0x93, 0x7a, 0x85,
+			0x73, 0x22, 0x5d, 0x2c, 0x23, 0x39, 0xf5, 0x62,
+			0x2d, 0xf2, 0x78, 0x6d, 0x4f, 0x11, 0x3a, 0x85,
+			0xcb, 0x9f, 0xb5, 0x2c, 0x1a, 0x89, 0x5b, 0x7b,
+			0xc3, 0xa1, 0x36, 0xf1, 0x33, 0x9a, 0x01, 0xeb,
+			0x8d, 0x6f, 0xf5, 0xdf, 0x08, 0x82, 0x65, 0x0e,
+			0x98, 0x8e, 0x9d, 0x1d, 0x25, 0x92, 0x62, 0xef,
+			0x70, 0x2c, 0xef, 0x49, 0x32, 0x72, 0x03, 0x87,
+			0x73, 0x10, 0xf6, 0xd4, 0x2c, 0x1e, 0x2e, 0x74,
+			0x88, 0x3c, 0x9d, 0x53, 0x0d, 0x3f, 0x5a, 0xfc,
+			0xdd, 0x6a, 0xf7, 0xc6, 0x60, 0x03, 0x02, 0xda,
+			0x20, 0x45, 0x76, 0xe2, 0xb0, 0x28, 0x24, 0x11,
+			0xcd, 0x8a, 0xbe, 0x1e, 0x6f, 0x5d, 0xe1, 0x26,
+			0xab, 0xf7, 0xd5, 0x49, 0xb1, 0x08, 0x21, 0x03,
+			0x73, 0xf8, 0x16, 0xb9, 0xa7, 0x30, 0x8e, 0x39,
+			0xb7, 0x1d, 0xff, 0x72, 0x12, 0x77, 0x69, 0xec,
+			0xa3, 0x21, 0x70, 0x6d, 0x6a, 0x70, 0xc9, 0xa4,
+			0x55, 0x7f, 0x51, 0xea, 0x36, 0x1c, 0x48, 0x51,
+			0x64, 0x1f, 0x48, 0x25, 0x82, 0x1d, 0x53, 0x50,
+			0x01, 0xf8, 0x0f, 0x51, 0xe7, 0x77, 0xb2, 0x83,
+			0xe4, 0xa6, 0xee, 0xa2, 0x54, 0xb0, 0x0f, 0xaf,
+			0xd4, 0x24, 0x72, 0xdf, 0xed, 0x8e, 0x32, 0x2e,
+			0xd4, 0x41, 0x6c, 0x10, 0x32, 0x23, 0x40, 0x61,
+			0x7a, 0xa8, 0xd4, 0xe9, 0x5a, 0xfa, 0x51, 0x64,
+			0x34, 0xd6, 0xf2, 0x58, 0xf3, 0xc7, 0xdb, 0x92,
+			0x30, 0xb8, 0xae, 0xcf, 0x20, 0xd0, 0x67, 0xc6,
+			0x71, 0x98, 0x5d, 0x71, 0x63, 0x2c, 0xb7, 0x05,
+			0x56, 0x88, 0x1b, 0x71, 0x6b, 0x89, 0x1b, 0x20,
+			0xa7, 0x11, 0xbd, 0x92, 0x31, 0x71, 0xa1, 0xb5,
+			0xe1, 0x71, 0xf7, 0x7d, 0x73, 0xb4, 0x53, 0xea,
+			0xc2, 0x70, 0x6c, 0x8d, 0xb9, 0x19, 0x22, 0x8a,
+			0x4b, 0x66, 0x28, 0xdc, 0xa5, 0x5e, 0x7f, 0x1b,
+			0x1c, 0xd9, 0x0d, 0x42, 0x1b, 0xc4, 0x76, 0x5c,
+			0x9f, 0x2a, 0xb4, 0xb5, 0x8f, 0x41, 0xab, 0xcd,
+			0xe0, 0xd2, 0x69, 0x94, 0xa5, 0x5e, 0x49, 0x5c,
+			0x43, 0xa4, 0x72, 0x51, 0x24, 0x44, 0x2d, 0x2b,
+			0xf0, 0x99, 0x62, 0x06, 0xfa, 0xc9, 0xc5, 0xfc,
+			0x08, 0x9d, 0xd5, 0xe4, 0x3f, 0xab, 0xbc, 0xf4,
+			0x11, 0x6d, 0xec, 0x57, 0x16, 0xe3, 0x94, 0xe4,
+			0x20, 0xb4, 0xc4, 0x85, 0x12, 0xf2, 0xf2, 0xef,
+			0x39, 0xa0, 0x9c, 0x94, 0x06, 0x74, 0x68, 0xd1,
+			0x1d, 0xf5, 0xc1, 0xd3, 0x91, 0x9a, 0x32, 0xa1,
+			0x01, 0xea, 0x88, 0xfe, 0x98, 0xc3, 0x2b, 0xd0,
+			0xd5, 0x55, 0x6c, 0x98, 0xca, 0x57, 0xb4, 0xfe,
+			0xce, 0x74, 0x03, 0x20, 0xe7, 0x56, 0xab, 0xfb,
+			0xd2, 0x36, 0xea, 0xad, 0xba, 0x8d, 0xd3, 0x57,
+			0xc1, 0x18, 0xa0, 0xea, 0x46, 0xce, 0x33, 0x6f,
+			0x31, 0x05, 0xde, 0x49, 0x22, 0xe2, 0x71, 0xeb,
+			0xf1, 0x60, 0xf8, 0xba, 0xa1, 0xb8, 0xd4, 0x05,
+			0x02, 0x14, 0x14, 0xd3, 0xc6, 0xcb, 0x56, 0xb3,
+			0x20, 0xda, 0x62, 0x31, 0xce, 0x92, 0x48, 0xff,
+			0x2b, 0x9d, 0x9d, 0xf0, 0x7c, 0x02, 0x82, 0x6c,
+			0x44, 0xfc, 0x13, 0x8e, 0x21, 0x79, 0xca, 0xa8,
+			0x4d, 0xac, 0x11, 0xc0, 0xd4, 0x14, 0x5a, 0x7e,
+			0xf9, 0x3e, 0x78, 0x4a, 0x36, 0xf3, 0x79, 0x87,
+			0x88, 0x38, 0xef, 0x6c, 0xd9, 0x71, 0x70, 0x7c,
+			0x1d, 0x6f, 0x3c, 0x45, 0xe7, 0x7a, 0x9a, 0x7c,
+			0x9e, 0x21, 0x92, 0x03, 0xe0, 0x06, 0xf6, 0x36,
+			0x7f, 0x21, 0x7b, 0xd7, 0x82, 0xd8, 0xfd, 0x80,
+			0x0a, 0x85, 0x3d, 0x26, 0x59, 0x30, 0xc7, 0x00,
+			0xad, 0x2a, 0xce, 0x99, 0x4f, 0x82, 0x7d, 0x16,
+			0x68, 0xba, 0x10, 0xea, 0x36, 0xaf, 0x74, 0x73,
+			0x08, 0xf8, 0x45, 0x46, 0x04, 0xbf, 0xc0, 0x8e,
+			0x1e, 0x68, 0xe1, 0x7c, 0x56, 0xf4, 0xf0, 0xa3,
+			0x0e, 0x1c, 0x62, 0x68, 0x6c, 0x4c, 0x20, 0x42,
+			0xa4, 0x3c, 0xfa, 0x0e, 0xdf, 0xa8, 0x3d, 0x51,
+			0x45, 0x2e, 0xa1, 0x4d, 0xa3, 0x84, 0xb6, 0x2a,
+			0x2e, 0x1a, 0x2b, 0xba, 0x39, 0x63, 0x6c, 0x28,
+			0x69, 0x26, 0x6e, 0x16, 0xac, 0x10, 0xf4, 0x4e,
+			0x4e, 0x20, 0xc0, 0xba, 0xb7, 0x27, 0x8e, 0x27,
+			0x18, 0xa6, 0xbf, 0xe3, 0x34, 0x54, 0xa6, 0xca,
+			0x91, 0x3f, 0x89, 0x7d, 0x68, 0x75, 0xc1, 0x40,
+			0x90, 0x73, 0x40, 0xff, 0x19, 0x3f, 0xa7, 0x35,
+			0xed, 0x58, 0x60, 0xf0, 0xed, 0xf2, 0x52, 0x6f,
+			0x4a, 0x3f, 0xbb, 0x83, 0x0a, 0x73, 0x62, 0x76,
+			0x04, 0xcd, 0x0b, 0xa4, 0x83, 0x31, 0x1f, 0x82,
+			0xa5, 0x03, 0xc7, 0xd9, 0x19, 0xf8, 0x0c, 0xf3,
+			0x7b, 0xe5, 0xeb, 0x0f, 0xa3, 0xeb, 0x48, 0x2a,
+			0x0f, 0x97, 0xfe, 0x9f, 0xda, 0xf9, 0x24, 0xe6,
+			0x1c, 0xe9, 0xd9, 0x55, 0x53, 0x2a, 0x21, 0x43,
+			0x8e, 0x63, 0xe4, 0x4f, 0x05, 0xe4, 0x96, 0xee,
+			0x82, 0x1b, 0xcb, 0x0d, 0x69, 0xd0, 0xdd, 0x42,
+			0x2a, 0x43, 0xfb, 0x57, 0x70, 0x93, 0x6b, 0x48,
+			0x60, 0x65, 0xaf, 0x8e, 0xe1, 0x75, 0x42, 0x86,
+			0xd1, 0x19, 0x65, 0x09, 0x6a, 0xcb, 0x5d, 0x94,
+			0x0c, 0x33, 0x9d, 0xa3, 0xd9, 0x2b, 0x40, 0x17,
+			0x11, 0x12, 0xf3, 0x4d, 0x17, 0x09, 0xac, 0x95,
+			0x63, 0x42, 0x12, 0x02, 0x53, 0x07, 0xe1, 0xca,
+			0xa3, 0x23, 0x0c, 0x31, 0x1a, 0x39, 0xc0, 0x98,
+			0xb8, 0x41, 0x1d, 0x48, 0x4d, 0x84, 0x72, 0x1f,
+			0x08, 0xca, 0x16, 0x60, 0xa5, 0x86, 0x6f, 0x02,
+			0xff, 0x50, 0x02, 0xe8, 0xe5, 0xdf, 0xdd, 0xb5,
+			0x23, 0x4c, 0xcb, 0x68, 0xd7, 0xfd, 0x49, 0xa0,
+			0x6b, 0x78, 0xfe, 0x4f, 0x5a, 0x26, 0x10, 0xb9,
+			0xb5, 0xc0, 0x13, 0xc8, 0xac, 0x05, 0xc7, 0x70,
+			0x2b, 0xd7, 0xc3, 0x3f, 0xce, 0x06, 0xf8, 0x9e,
+			0xee, 0xf8, 0x30, 0xe3, 0x47, 0xfd, 0x89, 0xed,
+			0x4c, 0x1d, 0xd3, 0xbf, 0x74, 0xff, 0x9b, 0x0c,
+			0x34, 0x89, 0xf2, 0x91, 0x63, 0xcc, 0xa7, 0xfa,
+			0xb2, 0x53, 0xec, 0x49, 0xae, 0x9d, 0xb4, 0x44,
+			0xde, 0xa3, 0x4a, 0x4c, 0x51, 0xb4, 0x7a, 0x86,
+			0xc9, 0x3c, 0xaa, 0x82, 0xaf, 0x31, 0x13, 0x0a,
+			0xfd, 0xa9, 0x41, 0x7d, 0xec, 0x6a, 0xd5, 0xb1,
+			0x4d, 0x47, 0xcb, 0x1e, 0x33, 0x9f, 0xa1, 0xe0,
+			0xdc, 0x37, 0x3e, 0x02, 0x13, 0xaf, 0x54, 0xfa,
+			0x83, 0x6f, 0x9a, 0x30, 0x10, 0xa7, 0x31, 0xc6,
+			0xad, 0xb1, 0x97, 0x65, 0x2f, 0xfe, 0xfa, 0x8d,
+			0x98, 0x4c, 0xd1, 0x7e, 0x77, 0x7e, 0x4c, 0x52,
+			0xbe, 0x90, 0x36, 0x85, 0x2f, 0xba, 0xb0, 0xae,
+			0xed, 0x87, 0xdf, 0x74, 0x90, 0x6a, 0x28, 0x35,
+			0xfd, 0xe4, 0x94, 0xf7, 0xa8, 0x83, 0x8f, 0x53,
+			0x81, 0x73, 0x66, 0x76, 0x63, 0xe9, 0xc9, 0x8f,
+			0xdb, 0xa8, 0x90, 0x56, 0x3a, 0x3a, 0xdc, 0xd4,
+			0x12, 0xbd, 0x8c, 0x54, 0x89, 0x24, 0x5d, 0xa6,
+			0xe7, 0xd3, 0x52, 0x2d, 0x15, 0x27, 0xf7, 0xc7,
+			0xa7, 0x69, 0xb0, 0x3a, 0x4c, 0xe5, 0x77, 0xd6,
+			0x8b, 0xe4, 0x09, 0x86, 0x96, 0xc5, 0xd7, 0xbd,
+			0x83, 0x70, 0x3e, 0x34, 0xb0, 0x1b, 0x51, 0x0c,
+			0x1f, 0x2c, 0x68, 0xd4, 0x87, 0xb7, 0xb4, 0x4a,
+			0x63, 0x00, 0x0d, 0xf2, 0xb8, 0x66, 0xc9, 0xe2,
+			0xf8, 0x18, 0x21, 0xd0, 0xad, 0xff, 0xd1, 0x53,
+			0xf9, 0xb0, 0x87, 0xed, 0x20, 0xb9, 0x16, 0x6f,
+			0x33, 0x75, 0xe0, 0xaf, 0x67, 0x2f, 0x2a, 0xc9,
+			0x59, 0x71, 0x03, 0x6b, 0x44, 0xf5, 0x61, 0x79,
+			0xf3, 0xea, 0x74, 0x84, 0xab, 0x76, 0x09, 0x65,
+			0xf4, 0x84, 0x72, 0xe1, 0xdf, 0x11, 0xdd, 0xbb,
+			0xd4, 0x84, 0x92, 0xc8, 0xd5, 0x01, 0x96, 0x76,
+			0x97, 0x33, 0x14, 0x2b, 0x81, 0x11, 0x49, 0x77,
+			0xb9, 0x1f, 0x8e, 0xd9, 0x8b, 0xaa, 0xc3, 0xa3,
+			0x34, 0x87, 0x7a, 0xfd, 0x57, 0x70, 0x61, 0x7f,
+			0x0f, 0x59, 0x36, 0x35, 0x70, 0x84, 0x21, 0x41,
+			0x0b, 0x2e, 0x93, 0x6d, 0x8e, 0x46, 0x61, 0x4c,
+			0x24, 0xe2, 0x50, 0x68, 0x9d, 0xac, 0xcb, 0xa3,
+			0x24, 0xc2, 0x78, 0xcb, 0xb1, 0x26, 0x22, 0x43,
+			0x35, 0x38, 0x32, 0x93, 0x6f, 0x38, 0xcc, 0xbb,
+			0xa2, 0xe5, 0xf0, 0xfe, 0x1a, 0x7f, 0x73, 0x3b,
+			0x01, 0x3b, 0x4b, 0x53, 0x00, 0x91, 0xe6, 0x3e,
+			0xb5, 0x42, 0x49, 0x23, 0x4c, 0xbb, 0x69, 0xfa,
+			0x6f, 0x3d, 0x97, 0x02, 0x34, 0x5d, 0xa6, 0xf3,
+			0x34, 0x42, 0x1b, 0x66, 0x5c, 0xd9, 0xd7, 0xcc,
+			0xf4, 0xa9, 0x21, 0x0b, 0x6c, 0x4b, 0xf5, 0xbc,
+			0xaf, 0x74, 0x20, 0x33, 0x39, 0x46, 0x4d, 0x88,
+			0xf9, 0x75, 0x04, 0x9e, 0x31, 0x87, 0x2b, 0x9a,
+			0xc6, 0x0e, 0x38, 0x94, 0x81, 0xca, 0x47, 0x69,
+			0x1c, 0xb1, 0xdc, 0x53, 0x7c, 0xc6, 0x39, 0x55,
+			0x2d, 0x30, 0x00, 0x65, 0x5c, 0x9d, 0x4a, 0x2b,
+			0x28, 0x0c, 0x6b, 0x90, 0xd5, 0x95, 0x47, 0xa4,
+			0xa3, 0xf1, 0xb3, 0x63, 0x9a, 0x3f, 0xf2, 0x46,
+			0xf4, 0x74, 0xe3, 0x81, 0xb0, 0xcc, 0xba, 0x93,
+			0xdd, 0xb6, 0x86, 0xbb, 0xd5, 0x90, 0x63, 0xf4,
+			0x01, 0x07, 0x3f, 0x37, 0xd7, 0x29, 0x5a, 0xc8,
+			0x48, 0xf0, 0x11, 0x3b, 0x40, 0x5b, 0xd8, 0xe6,
+			0x5d, 0x57, 0x47, 0x95, 0x9e, 0xa9, 0xf3, 0x07,
+			0x2e, 0x58, 0xd2, 0x89, 0x1d, 0x83, 0xc8, 0x5f,
+			0x2b, 0xb1, 0x4c, 0x7b, 0xda, 0x69, 0x0b, 0xfe,
+			0xce, 0xa0, 0x8b, 0xf7, 0xee, 0x21, 0x91, 0xa3,
+			0xcf, 0xda, 0x71, 0x98, 0x61, 0xdc, 0x37, 0x34,
+			0x43, 0xf8, 0x58, 0x21, 0x93, 0xa7, 0x1b, 0xfd,
+			0x18, 0x9e, 0xc4, 0xda, 0xcd, 0x13, 0x99, 0x34,
+			0x2f, 0xfb, 0xf6, 0x62, 0x79, 0xcc, 0xfe, 0xcc,
+			0x80, 0x93, 0x7c, 0x06, 0x95, 0x07, 0x1e, 0xaf,
+			0x94, 0xd4, 0x18, 0x96, 0xbd, 0x97, 0x02, 0xd7,
+			0x71, 0x1f, 0x01, 0x75, 0x76, 0x85, 0x46, 0x0c,
+			0x1c, 0x3c, 0x03, 0xa9, 0x6e, 0xb3, 0xb9, 0xf2,
+			0x9d, 0x73, 0x9c, 0x39, 0x02, 0xe7, 0x73, 0x0d,
+			0x39, 0xcf, 0xc0, 0xba, 0xbd, 0x7d, 0x09, 0x54,
+			0x78, 0x86, 0x70, 0x3b, 0x3a, 0xe2, 0x17, 0xfa,
+			0xd6, 0x79, 0xeb, 0x99, 0x33, 0x28, 0xa4, 0xe5,
+			0xe7, 0x91, 0xe4, 0x80, 0x4a, 0x0e, 0x65, 0xf4,
+			0x03, 0xee, 0x95, 0x14, 0xa7, 0x9a, 0xbb, 0xa1,
+			0x10, 0xc6, 0x6d, 0xc3, 0xcc, 0xa0, 0x55, 0x95,
+			0x5d, 0xff, 0xaf, 0x66, 0xd6, 0xae, 0xa9, 0x4a,
+			0x09, 0xcc, 0xad, 0x45, 0x1a, 0x29, 0xec, 0x45,
+			0x8a, 0xd4, 0x77, 0x64, 0xb6, 0xd3, 0xe7, 0x02,
+			0x66, 0x43, 0x1b, 0x43, 0xe4, 0x0f, 0x91, 0x2b,
+			0xbd, 0x88, 0xfd, 0xa1, 0xf4, 0x5e, 0xda, 0x32,
+			0x91, 0x9b, 0xf5, 0xf0, 0xb2, 0x12, 0xdd, 0x9f,
+			0xc3, 0x78, 0x29, 0x33, 0x06, 0x71, 0xeb, 0x5e,
+			0xce, 0x4d, 0x42, 0x80, 0x75, 0x5d, 0x66, 0x46,
+			0xbf, 0xa1, 0x1a, 0xcf, 0x3a, 0xe3, 0xda, 0xd2,
+			0xad, 0x47, 0x7e, 0x50, 0xba, 0x15, 0x95, 0xae,
+			0x7b, 0x63, 0x78, 0x8a, 0x8e, 0xa9, 0x4f, 0x73,
+			0xd7, 0xcc, 0x28, 0x7b, 0x46, 0x03, 0xb8, 0x7d,
+			0x1c, 0x7c, 0xa9, 0xf8, 0x25, 0x81, 0x34, 0x7d,
+			0x72, 0x66, 0x6e, 0x26, 0x92, 0x7b, 0x75, 0x4a,
+			0x81, 0x85, 0xdd, 0x78, 0x45, 0x1a, 0x24, 0xc7,
+			0x62, 0x7a, 0xc8, 0x33, 0xe8, 0x3f, 0x4b, 0x00,
+			0x3c, 0xf8, 0x99, 0xd8, 0x24, 0x34, 0xf9, 0xd7,
+			0x32, 0xd5, 0xed, 0x35, 0xa7, 0x0c, 0xcd, 0x20,
+			0xe6, 0xe7, 0xf8, 0xa4, 0xa1, 0xc0, 0x17, 0xaa,
+			0x29, 0x51, 0x03, 0x6a, 0x56, 0x39, 0x1c, 0xe8,
+			0x17, 0x87, 0x5f, 0xbb, 0xc3, 0xf9, 0x5b, 0xa2,
+			0x22, 0xb9, 0xaf, 0x74, 0x34, 0x4c, 0x42, 0x99,
+			0xc2, 0xc5, 0x07, 0xa3, 0xd7, 0xe3, 0x02, 0xb5,
+			0x1e, 0xfe, 0x5d, 0x0b, 0x7d, 0xdf, 0x44, 0x07,
+			0xc3, 0xe2, 0x49, 0x92, 0x60, 0x8f, 0x2f, 0x63,
+			0x8e, 0x3e, 0x12, 0xa7, 0xe3, 0x35, 0x35, 0xb0,
+			0x70, 0xaf, 0x1f, 0xb7, 0x10, 0xba, 0x9b, 0x2a,
+			0x98, 0x52, 0x2e, 0x96, 0x5f, 0xbd, 0x40, 0x35,
+			0x53, 0x1f, 0x6b, 0x88, 0x50, 0x10, 0x5d, 0x06,
+			0x18, 0x70, 0xcc, 0xe1, 0xcd, 0x1b, 0x45, 0x8e,
+			0x6d, 0x19, 0x88, 0x2d, 0x09, 0xb1, 0x38, 0xb0,
+			0x2c, 0x61, 0x51, 0x25, 0x60, 0x63, 0x92, 0x28,
+			0xf0, 0x70, 0x7e, 0x79, 0x49, 0xad, 0xf3, 0x2f,
+			0x6e, 0x11, 0xf6, 0xdf, 0x0c, 0x6b, 0xa1, 0xf7,
+			0xf0, 0x3e, 0x4c, 0xd1, 0xa2, 0x1b, 0xef, 0x27,
+			0x97, 0x46, 0x9d, 0xab, 0x3a, 0xbf, 0x4a, 0xe0,
+			0x06, 0x53, 0x2e, 0x70, 0xe0, 0xf8, 0x75, 0x91,
+			0x93, 0xf3, 0x4a, 0xbf, 0x6a, 0xa8, 0x92, 0x14,
+			0x55, 0x9d, 0x92, 0x33, 0x75, 0x4e, 0x58, 0xee,
+			0xe0, 0x21, 0xd5, 0x77, 0x28, 0xfd, 0xe6, 0xbe,
+			0xa6, 0xb9, 0xda, 0x97, 0x52, 0xe4, 0xfa, 0xd8,
+			0x0c, 0x44, 0x33, 0x70, 0xbf, 0x93, 0xa6, 0x72,
+			0x42, 0xd6, 0x05, 0xf3, 0x16, 0xe5, 0xbb, 0x2f,
+			0xa8, 0xc1, 0x88, 0x7a, 0x38, 0x62, 0xc0, 0xcd,
+			0x2a, 0x2a, 0xd8, 0xc5, 0x35, 0xf5, 0x0c, 0x9b,
+			0xfa, 0x50, 0xce, 0x37, 0x25, 0xb0, 0x14, 0x00,
+			0xab, 0xda, 0x13, 0xef, 0x3f, 0x0b, 0x0e, 0x39,
+			0x55, 0x15, 0x5d, 0x09, 0x32, 0x4d, 0x4c, 0xf3,
+			0x1d, 0x68, 0x0e, 0xad, 0x46, 0x4f, 0x6e, 0x9d,
+			0x4c, 0xd6, 0x5e, 0xef, 0x1d, 0xf9, 0xe3, 0xf3,
+			0x99, 0x28, 0x0e, 0xe8, 0x0a, 0xe4, 0x16, 0xc3,
+			0x98, 0x79, 0x71, 0x8c, 0x80, 0x52, 0x5e, 0x8e,
+			0xae, 0x6b, 0x4f, 0xb9, 0x03, 0xe2, 0xc0, 0xfd,
+			0x3a, 0xc2, 0xf9, 0xa3, 0x00, 0xf1, 0x88, 0x68,
+			0x71, 0x92, 0x90, 0xab, 0x18, 0x5c, 0xec, 0x20,
+			0xe1, 0x43, 0x5e, 0xcf, 0xbb, 0x03, 0x58, 0x52,
+			0xe6, 0x9e, 0x7c, 0xb6, 0xde, 0xf7, 0x62, 0x35,
+			0xa3, 0x31, 0xac, 0x94, 0x0f, 0x95, 0x37, 0x09,
+			0xd9, 0xe7, 0x86, 0xcb, 0xc0, 0x88, 0x60, 0xba,
+			0x76, 0x8c, 0xd4, 0x50, 0x04, 0x29, 0xcb, 0x73,
+			0x24, 0xdb, 0x06, 0xf4, 0x1e, 0x51, 0x1b, 0xb8,
+			0x79, 0x54, 0x46, 0xa6, 0x9b, 0x13, 0x64, 0xed,
+			0x23, 0x0d, 0x57, 0x4b, 0x83, 0xe4, 0xd4, 0x50,
+			0xf8, 0xca, 0x86, 0x84, 0x37, 0xea, 0xf2, 0x0d,
+			0x60, 0xa6, 0xd8, 0x1c, 0xed, 0x7a, 0x6f, 0xc4,
+			0x38, 0x51, 0x9b, 0x61, 0xd8, 0x84, 0xc5, 0x6b,
+			0x65, 0xf0, 0xc5, 0x01, 0x50, 0x2a, 0x50, 0x04,
+			0xa8, 0x02, 0xa2, 0xac, 0x26, 0x1a, 0x42, 0xd3,
+			0x44, 0x70, 0x16, 0x23, 0x96, 0xcb, 0x3c, 0x7e,
+			0xed, 0x6e, 0xd6, 0x0d, 0x6b, 0x97, 0x7b, 0xf9,
+			0x6e, 0x6d, 0xdb, 0x72, 0xf9, 0xaa, 0xd6, 0x19,
+			0xea, 0x0b, 0x5b, 0x93, 0x9c, 0xa2, 0xa9, 0xf3,
+			0x96, 0x2b, 0x8f, 0x40, 0x94, 0x09, 0x1b, 0xbe,
+			0x10, 0x36, 0xf7, 0x99, 0xbc, 0xe4, 0x97, 0x7a,
+			0x32, 0x99, 0x66, 0x02, 0x5a, 0x1b, 0x40, 0x24,
+			0xc7, 0x53, 0xc3, 0x31, 0xf3, 0x79, 0x58, 0x69,
+			0x60, 0x43, 0xc8, 0x3e, 0xbb, 0x7f, 0x49, 0x85,
+			0xc2, 0x3d, 0xea, 0xdc, 0x2b, 0xec, 0x35, 0x85,
+			0xd9, 0x40, 0x9d, 0xea, 0x6c, 0xf0, 0x89, 0x16,
+			0x42, 0x29, 0x42, 0x6f, 0x38, 0x17, 0x46, 0xd1,
+			0x45, 0x69, 0xdb, 0x97, 0xf2, 0xcf, 0xd4, 0x57,
+			0x02, 0x6c, 0xda, 0x51, 0xd7, 0x73, 0x8b, 0xdf,
+			0x39, 0x8f, 0x54, 0xbb, 0x18, 0xbc, 0xb1, 0x0a,
+			0x98, 0xce, 0xc8, 0xc0, 0x70, 0x8a, 0x13, 0x87,
+			0x27, 0x8c, 0x73, 0x76, 0x4a, 0x77, 0xab, 0x18,
+			0x5e, 0xe2, 0x2c, 0xbb, 0x90, 0x1b, 0x39, 0x03,
+			0x97, 0x75, 0x4f, 0x10, 0x9b, 0x0e, 0x72, 0x14,
+			0x56, 0xbc, 0xb2, 0x1c, 0x26, 0xe6, 0x97, 0xb2,
+			0x5d, 0xef, 0x3e, 0xce, 0xa0, 0x38, 0x27, 0x3e,
+			0x53, 0x8e, 0xc3, 0xdd, 0xc6, 0x0b, 0x2a, 0x32,
+			0xd2, 0xfe, 0xe1, 0xbf, 0xe3, 0x83, 0x37, 0xaf,
+			0xbe, 0x4b, 0x76, 0x2f, 0xe4, 0x3d, 0x1c, 0x85,
+			0xe9, 0xab, 0xbe, 0x25, 0x9b, 0x53, 0xf0, 0xb0,
+			0x79, 0x7e, 0x8e, 0x97, 0xdf, 0x91, 0x14, 0x29,
+			0x11, 0x3e, 0xde, 0x44, 0xf0, 0x0c, 0x71, 0x85,
+			0x9e, 0x83, 0x37, 0x09, 0x18, 0x96, 0x09, 0x69,
+			0x18, 0xef, 0x86, 0x98, 0xaa, 0x68, 0x41, 0xe9,
+			0x55, 0x37, 0xb3, 0x76, 0x69, 0x28, 0x0c, 0xd7,
+			0xcd, 0x62, 0x06, 0x5e, 0x04, 0x74, 0xdd, 0x93,
+			0xbd, 0xa4, 0x22, 0xf6, 0x49, 0xb0, 0x93, 0x37,
+			0xcd, 0x26, 0xac, 0x90, 0xf1, 0x92, 0xb3, 0xe9,
+			0x6a, 0x18, 0x3d, 0x1a, 0x87, 0x29, 0x5c, 0xb4,
+			0xdc, 0x2a, 0xbf, 0xdb, 0xc3, 0x1a, 0xd6, 0x52,
+			0x52, 0x10, 0x95, 0x97, 0x2e, 0xfd, 0xef, 0x16,
+			0x74, 0x31, 0x5f, 0x28, 0x33, 0xe7, 0xea, 0x00,
+			0x04, 0x79, 0x52, 0x58, 0xb5, 0x32, 0xa8, 0xb9,
+			0xa0, 0xe2, 0x11, 0x5d, 0xba, 0x99, 0x95, 0x78,
+			0xa7, 0x5f, 0xb3, 0x3b, 0xe7, 0x39, 0x21, 0xd9,
+			0xd6, 0x56, 0xfd, 0x6c, 0x8c, 0x6c, 0xea, 0xe9,
+			0x2a, 0xf4, 0x97, 0xcc, 0x9f, 0xf8, 0x15, 0x44,
+			0x32, 0xdf, 0x20, 0xaf, 0x50, 0xe5, 0x74, 0xc8,
+			0x5d, 0x33, 0xa7, 0x47, 0xd6, 0xa7, 0x89, 0x5e,
+			0x20, 0xd2, 0x94, 0x28, 0x8e, 0x3c, 0xdf, 0x34,
+			0x2d, 0x1f, 0x17, 0x29, 0xa2, 0x96, 0x80, 0x73,
+			0x5a, 0x2d, 0x0e, 0xd7, 0x36, 0x95, 0x21, 0x1e,
+			0x12, 0x25, 0xec, 0x51, 0x7a, 0x2a, 0x5e, 0x3f,
+			0xef, 0xdc, 0x7a, 0x57, 0x91, 0x22, 0xc4, 0x34,
+			0x4f, 0xd6, 0xeb, 0x60, 0x29, 0x59, 0x0d, 0x50,
+			0xa4, 0x28, 0x8b, 0x2c, 0x92, 0x34, 0x4c, 0x79,
+			0x59, 0xe4, 0x70, 0xb6, 0x1c, 0xe5, 0xd7, 0x35,
+			0x8a, 0xfe, 0x7c, 0x2d, 0xe4, 0x55, 0x51, 0xbd,
+			0x8b, 0xa3, 0xa0, 0x7f, 0x24, 0x1d, 0xba, 0x5f,
+			0x57, 0x07, 0xed, 0x4e, 0x19, 0x7e, 0x1a, 0xc6,
+			0x1a, 0xd4, 0x84, 0xe2, 0x44, 0xf9, 0xf5, 0x2b,
+			0x0b, 0x7c, 0x8f, 0x0e, 0x95, 0x5a, 0x1d, 0x17,
+			0x6a, 0x42, 0xea, 0xb1, 0x7c, 0x19, 0x47, 0x18,
+			0xa9, 0xd5, 0x68, 0xb1, 0x0a, 0x75, 0x45, 0x9d,
+			0x68, 0xf8, 0xe8, 0xf2, 0xd4, 0x7a, 0xf6, 0x8b,
+			0x4c, 0xb0, 0xd9, 0x3a, 0xe0, 0xd4, 0x1c, 0xbf,
+			0x37, 0x1f, 0x6d, 0x15, 0x89, 0xef, 0x4e, 0xb8,
+			0xd6, 0x3b, 0x82, 0xe6, 0xec, 0x4a, 0xf2, 0x06,
+			0xd6, 0xa7, 0x6b, 0xca, 0x10, 0xb4, 0xe5, 0x87,
+			0x62, 0xb0, 0x6d, 0x25, 0xcc, 0x2f, 0x0c, 0xfe,
+			0x18, 0x8c, 0xbc, 0xef, 0x12, 0xd1, 0x98, 0xea,
+			0xde, 0x1e, 0x12, 0xa8, 0x9d, 0x3a, 0x1a, 0x67,
+			0x44, 0xd7, 0xb1, 0x43, 0x68, 0x16, 0x8d, 0x62,
+			0xbc, 0x01, 0x20, 0x54, 0xd2, 0x13, 0x60, 0x4c,
+			0xb7, 0xf2, 0x56, 0xb7, 0x2f, 0x32, 0x21, 0x6f,
+			0xc0, 0x04, 0x14, 0x85, 0x8c, 0xcb, 0xa9, 0x66,
+			0xa8, 0xf1, 0xd7, 0x48, 0x2d, 0x5b, 0xd1, 0x8e,
+			0x7a, 0xf7, 0xbc, 0x04, 0x29, 0x11, 0x93, 0x76,
+			0x3f, 0xa4, 0xc8, 0x87, 0xdc, 0x17, 0x06, 0xc6,
+			0x3f, 0x3c, 0xf5, 0xb0, 0x29, 0x1d, 0x0b, 0x44,
+			0xdf, 0x25, 0xc1, 0xbd, 0x2b, 0x92, 0x2d, 0x1d,
+			0xe4, 0x99, 0x9f, 0xd7, 0x5b, 0xe7, 0x60, 0x59,
+			0xb7, 0x7e, 0x10, 0x6c, 0x2b, 0xe5, 0x34, 0xba,
+			0x1d, 0x6d, 0x0b, 0xb6, 0x5b, 0x29, 0x26, 0x55,
+			0xf5, 0x07, 0xb6, 0x79, 0x0b, 0xeb, 0x5a, 0x20,
+			0x3f, 0xf8, 0x17, 0x5f, 0x94, 0xfb, 0xd5, 0x2a,
+			0x24, 0xf6, 0x4a, 0xfb, 0xfc, 0x3c, 0xd4, 0x71,
+			0x00, 0x4e, 0x50, 0x26, 0xa1, 0xf6, 0x00, 0x34,
+			0x96, 0x8e, 0x84, 0xf1, 0xc6, 0x97, 0xaa, 0xa2,
+			0x32, 0xd8, 0x18, 0xdd, 0x34, 0x69, 0x7c, 0x19,
+			0xa9, 0xaf, 0x97, 0xb2, 0xb8, 0xe9, 0x09, 0x1f,
+			0x4d, 0xaa, 0x53, 0x7a, 0x14, 0xf6, 0xb2, 0x22,
+			0x0d, 0xba, 0xe7, 0xe0, 0xcb, 0xb0, 0x7f, 0x9b,
+			0xfc, 0xa1, 0x34, 0xd8, 0xab, 0x82, 0x9a, 0x99,
+			0xac, 0x8e, 0x7e, 0x30, 0xfe, 0x80, 0x71, 0xcb,
+			0xa5, 0x97, 0x15, 0xf7, 0x8c, 0x8a, 0x2c, 0x60,
+			0xfa, 0xee, 0xac, 0xf4, 0x00, 0x05, 0x54, 0x8a,
+			0xe8, 0xa5, 0xda, 0x4e, 0xce, 0x53, 0x53, 0x1b,
+			0x47, 0x81, 0xab, 0xe4, 0x3b, 0xad, 0x60, 0x57,
+			0xe3, 0xba, 0xd8, 0x64, 0xb8, 0xd7, 0x61, 0x5c,
+			0x61, 0xe9, 0x5a, 0x17, 0x3d, 0xa4, 0x69, 0x73,
+			0xc5, 0x08, 0xc3, 0xc5, 0x28, 0x59, 0x15, 0x99,
+			0x68, 0xbf, 0x8c, 0x93, 0x75, 0x01, 0x61, 0x24,
+			0x3b, 0x95, 0xaa, 0xa3, 0x4d, 0x62, 0xdd, 0x28,
+			0x79, 0x43, 0xe7, 0x03, 0x6b, 0x72, 0x3a, 0x7e,
+			0xfd, 0x92, 0x00, 0xbb, 0xd8, 0xf6, 0x13, 0xf0,
+			0xac, 0x04, 0x04, 0x30, 0x53, 0x29, 0x2c, 0xaf,
+			0xed, 0x6a, 0x96, 0x22, 0xa0, 0xaa, 0xb3, 0x92,
+			0x72, 0xac, 0x5c, 0x66, 0xa1, 0x56, 0x07, 0xf6,
+			0xd6, 0xa1, 0x1c, 0x78, 0x86, 0x20, 0x8b, 0x57,
+			0xfa, 0xea, 0x2b, 0x3d, 0x0c, 0x68, 0x2b, 0x8d,
+			0xea, 0x9e, 0x2d, 0x14, 0x6e, 0xba, 0x83, 0x75,
+			0xae, 0x72, 0x99, 0x6c, 0xf0, 0xd5, 0xec, 0x4e,
+			0x2f, 0x20, 0x97, 0xb3, 0x56, 0x67, 0xe3, 0x4f,
+			0x30, 0x47, 0x1c, 0x00, 0xb6, 0xe8, 0x32, 0xc7,
+			0xbe, 0x31, 0x9e, 0xe4, 0x8a, 0xe5, 0x3b, 0xfc,
+			0x51, 0x4f, 0x87, 0xa3, 0x1e, 0x73, 0x39, 0x38,
+			0x32, 0xbb, 0xd0, 0xa5, 0x9b, 0xfc, 0x45, 0xfa,
+			0x3e, 0xdc, 0xfa, 0x8b, 0xe1, 0xc3, 0xfb, 0x84,
+			0x4a, 0xd5, 0x2e, 0x46, 0x92, 0x6b, 0x36, 0xed,
+			0xb3, 0x12, 0xe6, 0xf1, 0xe2, 0x10, 0xe8, 0x19,
+			0x6d, 0xab, 0x3a, 0x1e, 0x15, 0x1d, 0xae, 0x36,
+			0x3f, 0xea, 0x80, 0x23, 0xb6, 0x86, 0x3c, 0xa6,
+			0x8b, 0x1d, 0xe8, 0x33, 0xaa, 0x4d, 0xa0, 0x3a,
+			0x60, 0x82, 0xd2, 0x6e, 0x25, 0x01, 0x87, 0x3d,
+			0x23, 0xc7, 0x33, 0x95, 0x1b, 0x62, 0x62, 0x26,
+			0xc4, 0xed, 0xb1, 0x3c, 0x0d, 0x29, 0xff, 0xa9,
+			0x4f, 0x2b, 0x9a, 0xb1, 0x0c, 0x4a, 0xc3, 0x43,
+			0x34, 0xe6, 0x9a, 0xcd, 0xff, 0xd6, 0xbd, 0x02,
+			0x0d, 0x9d, 0x3a, 0xf3, 0x57, 0xa9, 0xc3, 0x09,
+			0xa3, 0x14, 0x16, 0xba, 0x95, 0x21, 0xe2, 0x30,
+			0xcd, 0x77, 0xa6, 0x67, 0x4a, 0x61, 0x31, 0x52,
+			0xca, 0x16, 0x55, 0xa7, 0x70, 0xe9, 0x83, 0x1a,
+			0xd6, 0x5e, 0x5c, 0x51, 0x1f, 0xd1, 0xdf, 0x32,
+			0x53, 0x5b, 0x30, 0x4d, 0x10, 0x2b, 0x87, 0x18,
+			0x7e, 0x22, 0x6e, 0xfe, 0x46, 0xc3, 0x4a, 0x63,
+			0xc7, 0xf4, 0x7a, 0xde, 0x34, 0xcb, 0x16, 0xb5,
+			0xca, 0xb9, 0x19, 0x08, 0xc5, 0x84, 0xab, 0xec,
+			0x8e, 0xba, 0x66, 0x0b, 0xa4, 0x0e, 0x41, 0x43,
+			0x8d, 0x9a, 0x42, 0x72, 0x6a, 0x18, 0x00, 0xdc,
+			0xc0, 0x37, 0x35, 0xa7, 0x84, 0x8e, 0xea, 0x58,
+			0x2f, 0xfc, 0xbf, 0xb0, 0x86, 0x6e, 0xf5, 0x4a,
+			0xbe, 0x55, 0x6b, 0x30, 0xf2, 0x01, 0xc6, 0xa4,
+			0xc1, 0xa7, 0x79, 0xa4, 0x1f, 0x1f, 0xbb, 0xef,
+			0xe3, 0x95, 0x1a, 0x8f, 0xa9, 0x2d, 0xaa, 0x9f,
+			0x2a, 0x40, 0x09, 0x06, 0xf6, 0x90, 0x86, 0xf6,
+			0xee, 0x89, 0xab, 0x3b, 0x69, 0x9f, 0xd7, 0x03,
+			0x01, 0xf9, 0x72, 0x53, 0x58, 0x60, 0x38, 0x90,
+			0x63, 0xb4, 0x54, 0x8c, 0x55, 0xc9, 0x19, 0x02,
+			0xa6, 0x8f, 0x1f, 0x64, 0x1a, 0x3d, 0xb7, 0xc8,
+			0xd8, 0x58, 0x6d, 0x4d, 0x34, 0xbb, 0x06, 0xba,
+			0x5c, 0xf8, 0xb4, 0xaf, 0xa3, 0xb2, 0x35, 0x45,
+			0xf0, 0xd9, 0x86, 0x07, 0xae, 0xac, 0x78, 0x63,
+			0xa6, 0xbf, 0xc5, 0xe8, 0xfc, 0x1a, 0x9d, 0xca,
+			0xa8, 0xa1, 0x4d, 0xac, 0xa9, 0x9e, 0xde, 0xc4,
+			0xab, 0xe1, 0xd5, 0x9c, 0x7a, 0x92, 0xca, 0x83,
+			0xb4, 0x90, 0x52, 0xc7, 0xef, 0x31, 0x0f, 0x81,
+			0xc7, 0x7f, 0xd3, 0xf8, 0x52, 0xa8, 0x3b, 0x8f,
+			0x7e, 0x90, 0x8b, 0xd6, 0xf2, 0x22, 0x9f, 0x05,
+			0x37, 0x4f, 0xe4, 0x3a, 0x11, 0xab, 0xfd, 0xbb,
+			0xf4, 0xbb, 0xaa, 0xf3, 0x78, 0xf7, 0xb4, 0x68,
+			0x87, 0xc8, 0xf1, 0x19, 0x65, 0x30, 0xaf, 0x44,
+			0x91, 0x16, 0xf8, 0x77, 0xb2, 0xf0, 0xaf, 0xa5,
+			0x95, 0xb3, 0x25, 0xec, 0x00, 0x79, 0xf7, 0x30,
+			0xbf, 0x7e, 0x5e, 0x74, 0xd0, 0xd5, 0xb4, 0x65,
+			0xf7, 0x97, 0x8a, 0x2a, 0xf2, 0x48, 0x53, 0x15,
+			0x45, 0x6c, 0x56, 0x05, 0xe6, 0x65, 0xd6, 0x30,
+			0xe3, 0x32, 0x4c, 0x04, 0xf3, 0x10, 0xec, 0xa7,
+			0xbb, 0xd5, 0xca, 0x40, 0x0d, 0x89, 0x49, 0xb1,
+			0xc7, 0x9e, 0xb4, 0xc4, 0x9f, 0x6a, 0x89, 0x3c,
+			0x77, 0xd7, 0x66, 0xc8, 0x8f, 0xcb, 0xb5, 0xba,
+			0xec, 0xae, 0x34, 0x82, 0x05, 0x36, 0x6e, 0x7a,
+			0x98, 0x56, 0x6a, 0x09, 0xd2, 0x80, 0x59, 0x96,
+			0x87, 0xc3, 0x8f, 0x9b, 0x2b, 0x94, 0x6d, 0xd8,
+			0xea, 0x45, 0x7c, 0x42, 0x11, 0xaa, 0xbe, 0x88,
+			0xaa, 0x5d, 0xbf, 0x49, 0x92, 0x1d, 0xb3, 0xa6,
+			0x03, 0x01, 0x3d, 0xfe, 0xe2, 0x68, 0x67, 0xee,
+			0x40, 0x14, 0x1a, 0xad, 0x4c, 0x40, 0x0b, 0x5b,
+			0x77, 0x9f, 0xc9, 0x14, 0xfc, 0xf3, 0x7e, 0x32,
+			0x79, 0xd2, 0xdb, 0x1e, 0x19, 0x5d, 0xcf, 0x3e,
+			0x29, 0x2c, 0x5f, 0x19, 0xde, 0x5d, 0xf4, 0x8f,
+			0x59, 0xf3, 0xd6, 0x0d, 0x0f, 0x86, 0xb7, 0x38,
+			0x88, 0x5b, 0x62, 0x29, 0x62, 0xc3, 0x84, 0x00,
+			0x63, 0x86, 0xff, 0x8c, 0xfe, 0xfb, 0x11, 0x96,
+			0xf9, 0x1a, 0xe0, 0x12, 0xe0, 0x87, 0x14, 0xae,
+			0xcf, 0x53, 0x66, 0xf2, 0x8f, 0xc8, 0xdf, 0xc0,
+			0xfe, 0xf5, 0x22, 0x5b, 0x7e, 0x4f, 0xac, 0xaf,
+			0x03, 0xb3, 0x31, 0xd8, 0x3b, 0xc0, 0xb5, 0xf1,
+			0x87, 0x8a, 0x67, 0x37, 0x20, 0x5c, 0x71, 0xd1,
+			0x7f, 0xb9, 0x82, 0x04, 0xe5, 0x6e, 0x87, 0x51,
+			0x7a, 0xc5, 0x92, 0x29, 0x6f, 0x37, 0xf9, 0x60,
+			0x59, 0x3a, 0x61, 0x07, 0x26, 0x35, 0x11, 0xb4,
+			0x4e, 0x88, 0x5f, 0x19, 0xd3, 0x1f, 0xb2, 0x1e,
+			0xb3, 0x0b, 0x20, 0xf0, 0xa7, 0x23, 0x50, 0xbc,
+			0x3b, 0x1d, 0x5c, 0x6c, 0xbb, 0x28, 0x5b, 0xee,
+			0x61, 0xb4, 0x0e, 0x25, 0xb4, 0x93, 0xd4, 0x32,
+			0x03, 0x49, 0xe3, 0xd5, 0x4a, 0x1d, 0x98, 0x4d,
+			0xb7, 0x8e, 0x64, 0x09, 0x78, 0x0e, 0x65, 0x18,
+			0x5a, 0x0c, 0x06, 0x60, 0xce, 0xbc, 0x49, 0xac,
+			0x76, 0x4f, 0x0c, 0x25, 0x13, 0x70, 0x24, 0xc8,
+			0xc4, 0x8d, 0xae, 0x97, 0xef, 0x84, 0x5f, 0x94,
+			0x6e, 0x53, 0x77, 0x51, 0x00, 0x1e, 0xd4, 0x8d,
+			0xd2, 0x32, 0xc7, 0x29, 0x13, 0x4f, 0x35, 0xf5,
+			0x29, 0x96, 0xdb, 0x62, 0x77, 0x3d, 0xa3, 0x9e,
+			0x49, 0xc2, 0x8b, 0xeb, 0x8d, 0xd1, 0x29, 0x2d,
+			0x9e, 0x04, 0x10, 0x3c, 0x69, 0x4c, 0x9c, 0xb1,
+			0x42, 0x2c, 0x96, 0x14, 0x3c, 0x9e, 0x38, 0x40,
+			0x18, 0xa7, 0x69, 0xfe, 0x93, 0xef, 0xb0, 0x54,
+			0xed, 0xe6, 0xe5, 0x85, 0x01, 0x93, 0xd5, 0xe4,
+			0x70, 0x0e, 0xeb, 0x1f, 0xf7, 0x31, 0x34, 0x8f,
+			0xbf, 0x22, 0xae, 0xa1, 0x96, 0x54, 0x5f, 0x78,
+			0x59, 0x56, 0x15, 0x53, 0xee, 0x25, 0x0a, 0xe0,
+			0x8c, 0xbd, 0xaa, 0x08, 0x0d, 0x09, 0x09, 0x77,
+			0x5d, 0x57, 0x32, 0x58, 0xba, 0x08, 0xcf, 0x4d,
+			0xea, 0x1a, 0xf8, 0x4b, 0x22, 0x07, 0x1a, 0xdf,
+			0x02, 0xa5, 0x5d, 0x5f, 0x4d, 0xc7, 0xba, 0x24,
+			0xb9, 0x98, 0xda, 0x42, 0xa7, 0x99, 0x8d, 0x15,
+			0x69, 0x5d, 0x7d, 0x51, 0x11, 0xb4, 0xa7, 0xee,
+			0x57, 0x66, 0x81, 0x2c, 0xf3, 0x97, 0xe9, 0x78,
+			0x6c, 0x00, 0x3d, 0xdd, 0x34, 0x01, 0xdc, 0x16,
+			0x91, 0x33, 0xd0, 0x67, 0x1a, 0x71, 0x71, 0x5e,
+			0xba, 0xf4, 0x00, 0xb1, 0x24, 0x3c, 0xf2, 0x46,
+			0x60, 0xeb, 0x5a, 0x89, 0x14, 0xd8, 0x8d, 0x64,
+			0x39, 0xd7, 0x42, 0x9a, 0xe4, 0xf9, 0x7f, 0xb1,
+			0x94, 0xd5, 0xf5, 0x3e, 0x24, 0x02, 0x8c, 0x25,
+			0xbd, 0x10, 0x10, 0x91, 0x5b, 0x4b, 0x2a, 0x9b,
+			0xc9, 0xdc, 0x37, 0x6f, 0x5b, 0x48, 0x4f, 0x77,
+			0x93, 0x59, 0x7e, 0xcd, 0xb7, 0x33, 0x2b, 0x6e,
+			0x70, 0x60, 0x6f, 0xe2, 0xfd, 0x58, 0x5f, 0x08,
+			0xe0, 0xcd, 0x21, 0xb8, 0xdb, 0x36, 0x7e, 0x41,
+			0x73, 0x4a, 0x8e, 0x39, 0x6d, 0x24, 0x29, 0x75,
+			0xab, 0x3d, 0xf4, 0x52, 0x3f, 0xaa, 0xe1, 0x3c,
+			0x71, 0x00, 0xa7, 0x3a, 0x55, 0xfa, 0x38, 0x3a,
+			0x7f, 0xfd, 0x8b, 0xd5, 0x1f, 0xef, 0x92, 0x63,
+			0x51, 0x57, 0x80, 0x6d, 0x7c, 0xfc, 0xcf, 0x55,
+			0xd2, 0xa8, 0xa9, 0x23, 0xb5, 0x7e, 0xda, 0x94,
+			0x67, 0x3c, 0x95, 0x45, 0xd1, 0xf2, 0xaa, 0xc6,
+			0x84, 0x58, 0xef, 0x8d, 0x6d, 0xba, 0x31, 0xc0,
+			0x47, 0xb1, 0xd2, 0x39, 0xa8, 0x2b, 0x71, 0x3e,
+			0x16, 0x77, 0x89, 0x41, 0x11, 0x43, 0x59, 0x9d,
+			0xca, 0x58, 0x9e, 0xf6, 0x71, 0x25, 0x93, 0xe7,
+			0x4d, 0x30, 0x36, 0x3e, 0x67, 0x6c, 0x12, 0xa1,
+			0x13, 0x59, 0x94, 0xb9, 0x7a, 0xdb, 0xa7, 0x8b,
+			0x12, 0x3a, 0xbc, 0x5d, 0x82, 0x33, 0x65, 0x79,
+			0x56, 0xd3, 0x98, 0x4d, 0xc8, 0xb4, 0x6f, 0xff,
+			0xad, 0xaa, 0x28, 0x99, 0x1c, 0xfa, 0xd5, 0x57,
+			0x92, 0x79, 0xdf, 0x96, 0xb0, 0x1b, 0x4f, 0xf5,
+			0xd4, 0x0f, 0xf5, 0x92, 0x7e, 0xb0, 0xf3, 0x95,
+			0xab, 0x59, 0x58, 0x34, 0xda, 0x4e, 0xe5, 0xc2,
+			0x3c, 0x83, 0xf3, 0x47, 0x43, 0x27, 0xdb, 0x1f,
+			0x77, 0x73, 0xad, 0x8b, 0xeb, 0xbc, 0xac, 0x0e,
+			0x19, 0x8b, 0x37, 0xc5, 0xfb, 0xf4, 0xe8, 0xd3,
+			0x02, 0xb3, 0x96, 0x9f, 0x02, 0xf3, 0x39, 0xaa,
+			0x66, 0x73, 0xd6, 0x9c, 0x57, 0xda, 0x3d, 0x79,
+			0xcc, 0x9b, 0x3a, 0xdf, 0xca, 0xfb, 0x24, 0x53,
+			0xf4, 0x83, 0xad, 0x29, 0x45, 0x9c, 0x8c, 0xe0,
+			0x51, 0x89, 0xcd, 0xb8, 0xf3, 0x91, 0x33, 0xb6,
+			0x8d, 0x3a, 0xe0, 0xda, 0x3e, 0x20, 0x99, 0xe2,
+			0x73, 0xc8, 0x1e, 0x17, 0xde, 0xbc, 0x21, 0x85,
+			0xbe, 0x82, 0x60, 0x16, 0xe9, 0xcf, 0xa0, 0xc9,
+			0x20, 0xdb, 0x69, 0x7e, 0x34, 0xc6, 0x02, 0x59,
+			0x81, 0x70, 0xc5, 0xbb, 0x03, 0x2a, 0xf3, 0xd1,
+			0xaa, 0x3f, 0xa2, 0x20, 0x07, 0x08, 0xd6, 0x71,
+			0x00, 0xb1, 0x9d, 0x00, 0xf6, 0x6c, 0x4e, 0x4f,
+			0x41, 0x9f, 0xd2, 0x78, 0x40, 0x2d, 0x42, 0x97,
+			0x5a, 0x9a, 0x4f, 0x2f, 0xd2, 0xeb, 0x5b, 0x21,
+			0x34, 0x4b, 0xd2, 0xa7, 0x1a, 0xe7, 0x8a, 0x18,
+			0x3f, 0xb5, 0x61, 0x99, 0x99, 0xfa, 0xc4, 0x87,
+			0x8e, 0x9c, 0x87, 0x3a, 0x7c, 0x5b, 0x08, 0xa7,
+			0x9d, 0x30, 0x12, 0xcc, 0x7d, 0x68, 0x4e, 0xba,
+			0xfc, 0xc1, 0x1f, 0x2b, 0x33, 0x34, 0x1d, 0x71,
+			0xc9, 0x23, 0xe5, 0xff, 0x0d, 0xd9, 0xfb, 0x49,
+			0xbc, 0xdc, 0x56, 0x5b, 0x21, 0x5c, 0xff, 0x55,
+			0xed, 0x3f, 0xe3, 0xe1, 0x97, 0x23, 0x4d, 0xa7,
+			0x08, 0xf7, 0xb8, 0x9a, 0x26, 0xa6, 0xfb, 0x91,
+			0x87, 0x07, 0x4c, 0x88, 0xed, 0xe5, 0x27, 0x40,
+			0xdb, 0x2f, 0x01, 0xe7, 0x9e, 0x33, 0xc0, 0x5b,
+			0x1d, 0x5b, 0x4e, 0xb6, 0x0a, 0x01, 0x4f, 0xe2,
+			0xd9, 0x1f, 0xb0, 0xc3, 0xbb, 0x4f, 0x42, 0xa1,
+			0x68, 0x15, 0xf4, 0xde, 0x31, 0x89, 0xcb, 0xe9,
+			0x6f, 0x97, 0xbe, 0xfb, 0x48, 0xb5, 0xfb, 0x2f,
+			0x6d, 0xeb, 0x6e, 0x23, 0x6a, 0x3a, 0x78, 0x1a,
+			0x89, 0x5e, 0x28, 0x66, 0x1f, 0x2b, 0x7b, 0xfb,
+			0xc6, 0x27, 0x97, 0x4f, 0x53, 0x08, 0x11, 0xa7,
+			0xce, 0xef, 0x9a, 0x73, 0x78, 0xf3, 0xdd, 0x8c,
+			0x1d, 0xdf, 0xae, 0xba, 0x48, 0xf0, 0xcf, 0x9f,
+			0x87, 0xc7, 0x37, 0x03, 0xe7, 0x77, 0x6f, 0x18,
+			0xf8, 0x04, 0x2a, 0x97, 0x86, 0xe1, 0x3c, 0xc3,
+			0xf9, 0x39, 0xc2, 0x29, 0x64, 0x12, 0xad, 0x86,
+			0xaa, 0x4e, 0xe6, 0x27, 0xff, 0xf8, 0x59, 0x26,
+			0x9e, 0x59, 0xf9, 0xb2, 0xf7, 0x81, 0xa5, 0x4c,
+			0xe0, 0xe7, 0x34, 0x15, 0x76, 0xa2, 0x61, 0x58,
+			0x6e, 0xc0, 0x3f, 0x44, 0x54, 0x64, 0x7d, 0xc4,
+			0x93, 0xb9, 0xfb, 0xa3, 0x76, 0x90, 0x08, 0xc4,
+			0x1e, 0x03, 0x52, 0x1b, 0x4e, 0xaf, 0x2a, 0x16,
+			0xc8, 0x25, 0xb1, 0x3f, 0x0d, 0xc2, 0xfd, 0xe4,
+			0xb5, 0x6c, 0x38, 0x03, 0x89, 0x76, 0x84, 0xda,
+			0x86, 0x52, 0x12, 0x64, 0x31, 0x94, 0x2d, 0xde,
+			0xbc, 0xd2, 0xd2, 0xde, 0xc6, 0x7b, 0x7e, 0xb1,
+			0x4b, 0xec, 0xa3, 0xa2, 0x55, 0x72, 0x11, 0x74,
+			0x35, 0xd8, 0xa8, 0x08, 0x20, 0xe4, 0xcb, 0x4d,
+			0xcb, 0x75, 0x18, 0xa4, 0x9d, 0x70, 0xad, 0x08,
+			0x99, 0x6a, 0x3e, 0xc8, 0x9a, 0x24, 0x85, 0x5f,
+			0xc8, 0x82, 0x1a, 0x08, 0x54, 0x84, 0x0e, 0x14,
+			0x7a, 0x3a, 0xbd, 0x7b, 0x0e, 0x52, 0x96, 0xbd,
+			0x38, 0x14, 0xae, 0x6d, 0xf9, 0x6c, 0x88, 0xb7,
+			0x5f, 0xea, 0x37, 0xba, 0xb5, 0xf7, 0xc5, 0xf0,
+			0x95, 0x72, 0x36, 0x07, 0x35, 0xfd, 0x65, 0x76,
+			0x27, 0x5f, 0x42, 0x70, 0x88, 0xd5, 0x21, 0x42,
+			0x71, 0x77, 0x84, 0xb5, 0x75, 0xc3, 0xe5, 0xa3,
+			0x8d, 0xad, 0x05, 0x13, 0x9a, 0x3a, 0x33, 0x40,
+			0x3a, 0xfe, 0x07, 0x29, 0x34, 0x0a, 0x9a, 0x7a,
+			0x11, 0x12, 0x85, 0x09, 0x25, 0xd1, 0xa3, 0x90,
+			0x3e, 0x17, 0xd9, 0x8d, 0xbf, 0x99, 0x5d, 0x23,
+			0x36, 0xcc, 0x54, 0x4d, 0x38, 0xa7, 0x81, 0x3e,
+			0x39, 0xbe, 0x55, 0xa2, 0x51, 0xef, 0x9b, 0xc6,
+			0x0e, 0x42, 0x7f, 0x6d, 0x50, 0xcb, 0xc2, 0xc9,
+			0x76, 0x82, 0xb7, 0xcc, 0xdb, 0x27, 0x1b, 0x2f,
+			0xfa, 0xdb, 0x3c, 0x13, 0x3f, 0x65, 0x51, 0x17,
+			0x0d, 0x83, 0x6f, 0x57, 0x5b, 0xf8, 0x25, 0xb7,
+			0x01, 0xb8, 0xe0, 0xcc, 0x95, 0x5f, 0x0d, 0xc4,
+			0xc3, 0xf4, 0x73, 0xce, 0xa8, 0xa3, 0x19, 0xf9,
+			0xfb, 0x47, 0x72, 0x29, 0x14, 0x98, 0xb7, 0xf0,
+			0x4c, 0x41, 0x28, 0xf9, 0xdf, 0x51, 0x97, 0xd4,
+			0x7c, 0x60, 0xf8, 0xc8, 0xf9, 0xbb, 0xdd, 0x13,
+			0xc8, 0xbe, 0xe4, 0x0b, 0x51, 0x94, 0xa9, 0xba,
+			0x8c, 0x6c, 0xa8, 0x50, 0xcc, 0x23, 0x14, 0x91,
+			0x64, 0x8c, 0x62, 0x97, 0xb9, 0xc3, 0x2c, 0x14,
+			0xcf, 0x6e, 0xfe, 0xcf, 0x9f, 0x58, 0x08, 0xf9,
+			0xd3, 0x38, 0x20, 0x99, 0xb4, 0xe2, 0x19, 0xbb,
+			0x3a, 0x6b, 0x8a, 0x81, 0xf3, 0x3b, 0x47, 0xb1,
+			0x97, 0x02, 0x71, 0xa5, 0x77, 0x02, 0x8d, 0x85,
+			0x76, 0xff, 0x8c, 0xcb, 0x02, 0x82, 0xa4, 0x58,
+			0x3b, 0xe9, 0x55, 0x4c, 0x62, 0x35, 0xf8, 0x0b,
+			0xc9, 0xb0, 0x6a, 0x46, 0xdd, 0x05, 0xd3, 0x84,
+			0x7f, 0xb0, 0xdd, 0xb5, 0x3e, 0x17, 0x15, 0xff,
+			0xaf, 0x36, 0xcf, 0x77, 0x12, 0x97, 0xa8, 0xb2,
+			0xb4, 0x52, 0x1a, 0xe8, 0x42, 0x11, 0x4a, 0x36,
+			0x30, 0x7d, 0x32, 0xd4, 0x96, 0x84, 0xe9, 0x06,
+			0x24, 0x79, 0x89, 0x76, 0x1c, 0x0b, 0x2b, 0x4f,
+			0x9a, 0xc7, 0x7a, 0xe6, 0xd3, 0x23, 0x19, 0xfe,
+			0x24, 0x4b, 0x81, 0xef, 0x32, 0x23, 0xc1, 0x7c,
+			0x67, 0x6a, 0xf1, 0xee, 0xfe, 0x4e, 0xd3, 0xf1,
+			0x78, 0xa9, 0x2b, 0x59, 0x0e, 0xab, 0x77, 0xff,
+			0x34, 0xae, 0xc8, 0xdd, 0xd4, 0xe1, 0xd0, 0x0a,
+			0x25, 0x08, 0x31, 0x18, 0x62, 0x04, 0x53, 0xcd,
+			0x9f, 0x98, 0x1d, 0xe4, 0xf1, 0x2d, 0xe4, 0x96,
+			0x55, 0x1b, 0xf5, 0xc2, 0x86, 0xfa, 0xf6, 0xed,
+			0xc3, 0xdb, 0x45, 0x81, 0xd0, 0x58, 0x53, 0x7b,
+			0xc1, 0x68, 0x9f, 0x31, 0xe7, 0xe3, 0x68, 0x0b,
+			0xdb, 0x80, 0x38, 0xb3, 0xd0, 0x1c, 0xa7, 0x64,
+			0x84, 0x0e, 0xc0, 0x6c, 0xcf, 0xe6, 0x77, 0x0a,
+			0x16, 0x33, 0xcc, 0x29, 0x65, 0xdd, 0x88, 0xae,
+			0xdc, 0xf6, 0x7f, 0xb0, 0x10, 0xcb, 0xce, 0xb6,
+			0xe2, 0xb4, 0xd9, 0x2d, 0x3b, 0x62, 0x84, 0xe9,
+			0xb1, 0xe3, 0x04, 0x00, 0x37, 0xce, 0xef, 0x09,
+			0xfb, 0xa0, 0x80, 0x7e, 0xb1, 0xeb, 0xd7, 0x01,
+			0x73, 0x96, 0x12, 0x34, 0x6f, 0x01, 0x9b, 0x7a,
+			0xe4, 0xb3, 0xac, 0x59, 0xdb, 0xdb, 0xd0, 0x85,
+			0x41, 0x0c, 0xff, 0xbf, 0x07, 0xfa, 0xc5, 0x96,
+			0xe8, 0x6d, 0x92, 0xc3, 0x53, 0x39, 0x80, 0xfb,
+			0x3a, 0x3c, 0xbf, 0xd2, 0xd9, 0x4b, 0x32, 0x5d,
+			0x33, 0x4e, 0x90, 0xe1, 0x79, 0xb0, 0x95, 0x10,
+			0x5b, 0x02, 0x7d, 0x9d, 0x9b, 0x40, 0x2e, 0x02,
+			0xb6, 0x73, 0x02, 0xfa, 0xf2, 0x4c, 0xde, 0x98,
+			0xaa, 0x41, 0xe6, 0x62, 0x4c, 0x94, 0x9d, 0xcf,
+			0xf5, 0x09, 0xc4, 0x13, 0xf4, 0xb6, 0x22, 0xfa,
+			0xaf, 0xb4, 0x8e, 0x7c, 0x38, 0x35, 0xbe, 0xcf,
+			0xe9, 0x49, 0xb8, 0xe1, 0x6d, 0xe8, 0x20, 0x04,
+			0x3d, 0xc9, 0x07, 0x96, 0x6c, 0x39, 0x46, 0x0d,
+			0x92, 0x4c, 0xb3, 0xee, 0x1b, 0x72, 0xb3, 0x3b,
+			0x5e, 0x65, 0xed, 0xb8, 0x7c, 0x6e, 0x76, 0x76,
+			0x1b, 0x4e, 0xf6, 0x8d, 0x3c, 0xb5, 0x8b, 0x58,
+			0xee, 0x26, 0xe3, 0x5a, 0x6e, 0x76, 0x17, 0x87,
+			0x1b, 0xe2, 0xf2, 0xce, 0xc5, 0xb3, 0x7e, 0x3c,
+			0x2f, 0x54, 0xd9, 0x23, 0x95, 0x94, 0x2f, 0x46,
+			0x4e, 0x06, 0x6e, 0x92, 0x4d, 0x64, 0xc8, 0x5b,
+			0x27, 0x6c, 0xd7, 0x52, 0x76, 0xa0, 0x57, 0x54,
+			0xd7, 0xd9, 0x64, 0x3d, 0x29, 0x7e, 0xf6, 0x1c,
+			0xd2, 0x20, 0x19, 0x76, 0x39, 0xa3, 0x02, 0xc1,
+			0xbe, 0x5d, 0x11, 0x4d, 0xe1, 0x6c, 0x5b, 0x6e,
+			0x21, 0x8e, 0x45, 0xcc, 0x4b, 0xdb, 0xa7, 0x3d,
+			0xba, 0xa5, 0x0a, 0x9c, 0xa7, 0x94, 0x35, 0x84,
+			0x31, 0xaf, 0xd0, 0xd5, 0x97, 0xa3, 0xb0, 0xc1,
+			0xb7, 0xda, 0x0d, 0x62, 0x57, 0xeb, 0xa4, 0xce,
+			0xc6, 0xe3, 0x02, 0x33, 0x96, 0xdf, 0x96, 0x49,
+			0xd1, 0x73, 0x18, 0x62, 0x7b, 0x62, 0xdd, 0xdf,
+			0x0c, 0x24, 0x18, 0x3c, 0xba, 0xde, 0xca, 0x52,
+			0x58, 0xa2, 0x8e, 0x1f, 0x5f, 0xef, 0x81, 0x9f,
+			0x11, 0xd9, 0xd5, 0x88, 0x75, 0xf4, 0x1e, 0x6f,
+			0xfd, 0x63, 0xa9, 0x2b, 0x01, 0xc2, 0xf6, 0xf0,
+			0xca, 0x55, 0xfc, 0x92, 0x06, 0xc7, 0xa1, 0x4b,
+			0xfa, 0x16, 0xe1, 0x5b, 0x75, 0x5d, 0x34, 0x57,
+			0x68, 0xb2, 0x4f, 0x7c, 0xc0, 0x67, 0xca, 0xe1,
+			0xb2, 0x20, 0x0e, 0x81, 0x9a, 0xe4, 0xc6, 0x1c,
+			0x14, 0x8f, 0x4e, 0x17, 0x8d, 0x4a, 0xc9, 0xbd,
+			0x26, 0x01, 0x21, 0x97, 0x47, 0xd7, 0x1a, 0xc0,
+			0xb0, 0xc9, 0x7b, 0xbd, 0x32, 0x57, 0xf9, 0x25,
+			0xe8, 0x65, 0x4b, 0xd7, 0xcc, 0x29, 0xad, 0x86,
+			0x53, 0x5e, 0x38, 0x40, 0xb9, 0xcd, 0xd1, 0xad,
+			0x09, 0x65, 0xe2, 0x0c, 0x2c, 0x88, 0xa4, 0x1c,
+			0xdd, 0x2a, 0x16, 0xf9, 0x3f, 0x98, 0x5a, 0xaa,
+			0x7e, 0x26, 0x99, 0x6c, 0x8d, 0xdc, 0x10, 0xc1,
+			0x73, 0x0b, 0xb3, 0x16, 0x25, 0x79, 0x44, 0x7c,
+			0xd1, 0x8c, 0x03, 0x48, 0xf1, 0x83, 0x8e, 0x42,
+			0xe0, 0x0b, 0x54, 0x4f, 0xb5, 0xa4, 0xe4, 0xef,
+			0xa7, 0x88, 0x18, 0x27, 0xfa, 0x7a, 0xcc, 0xcd,
+			0x97, 0x78, 0x78, 0x89, 0x44, 0xc8, 0xed, 0x9e,
+			0x8f, 0xee, 0x67, 0xbb, 0x53, 0xbf, 0x4a, 0x2f,
+			0x59, 0x08, 0x4d, 0xc7, 0x3a, 0xdd, 0xec, 0xc7,
+			0x59, 0x61, 0xb3, 0xeb, 0x6e, 0x18, 0x15, 0x50,
+			0x66, 0xd4, 0x0e, 0x48, 0x43, 0x75, 0x1e, 0x69,
+			0x01, 0x60, 0x0b, 0xb9, 0xbf, 0xe4, 0x9b, 0x2b,
+			0x4c, 0x55, 0xc3, 0x8b, 0x81, 0xed, 0xa9, 0x21,
+			0xf7, 0x55, 0xe1, 0xc5, 0x89, 0x03, 0x9d, 0x01,
+			0x2e, 0x7c, 0xa5, 0x12, 0xbe, 0xee, 0x1f, 0x25,
+			0x08, 0x24, 0x98, 0xae, 0xe4, 0xb3, 0x26, 0x97,
+			0x36, 0xba, 0xaf, 0x35, 0xa5, 0x51, 0xa4, 0xbf,
+			0x7c, 0x25, 0xd0, 0x81, 0x43, 0x08, 0x56, 0xda,
+			0xe8, 0xc7, 0x97, 0xd4, 0xab, 0x19, 0xac, 0x2f,
+			0xb9, 0xfb, 0xba, 0x0a, 0x16, 0x75, 0xe7, 0xd2,
+			0xa9, 0x69, 0x0c, 0x4b, 0x71, 0xb6, 0x43, 0xfe,
+			0xef, 0xf9, 0x4f, 0xb8, 0x71, 0xe5, 0x66, 0xa7,
+			0x9d, 0xd1, 0x7d, 0xba, 0x0c, 0xde, 0x72, 0xa9,
+			0xce, 0xfb, 0x83, 0x18, 0x10, 0xba, 0xcf, 0x27,
+			0xc6, 0x22, 0x95, 0x1d, 0x42, 0xff, 0x7d, 0x80,
+			0x5e, 0xf5, 0x6e, 0x93, 0x6f, 0xa3, 0x68, 0x03,
+			0x05, 0x07, 0xe6, 0xfc, 0xb4, 0x54, 0xb5, 0x08,
+			0x52, 0xd3, 0x8a, 0x00, 0x3f, 0x4e, 0x01, 0x10,
+			0x9d, 0x60, 0x60, 0x42, 0xc3, 0x28, 0xb1, 0xd3,
+			0xf4, 0x53, 0x62, 0x49, 0x3f, 0xef, 0xf3, 0x08,
+			0x77, 0x51, 0x30, 0x32, 0x40, 0x9a, 0x48, 0xa4,
+			0x3a, 0x71, 0x6b, 0x47, 0x22, 0x49, 0x48, 0xdb,
+			0x65, 0xac, 0x48, 0x2d, 0xc9, 0x91, 0x29, 0x96,
+			0x14, 0xe5, 0xb4, 0x8b, 0xa4, 0x05, 0x6c, 0x11,
+			0x1a, 0x4e, 0x28, 0xf7, 0x52, 0xba, 0x2a, 0xb0,
+			0xbd, 0x78, 0x02, 0xdb, 0x9a, 0x03, 0x1c, 0xd5,
+			0xfe, 0xbd, 0x54, 0x05, 0x86, 0x79, 0x06, 0xb8,
+			0x5f, 0x39, 0x3e, 0xe9, 0x1b, 0x69, 0xae, 0xbe,
+			0xde, 0x77, 0x29, 0x9d, 0x3c, 0xa9, 0xaa, 0x25,
+			0xd3, 0xb4, 0xfc, 0x05, 0x94, 0x51, 0x98, 0x8e,
+			0x8a, 0xac, 0x63, 0xf4, 0x71, 0x93, 0x7f, 0x80,
+			0x6a, 0x23, 0x49, 0x06, 0x6d, 0x54, 0xf6, 0xd3,
+			0x00, 0x50, 0x2d, 0xbe, 0x66, 0xa7, 0x81, 0x51,
+			0x11, 0x3f, 0xfa, 0x40, 0xdc, 0xd5, 0x07, 0x11,
+			0xe3, 0xc5, 0x78, 0x22, 0xbc, 0x63, 0xe6, 0xb8,
+			0x8f, 0x9a, 0x1d, 0xb2, 0x53, 0x95, 0xa0, 0xb5,
+			0x2a, 0x5a, 0xb6, 0xcc, 0x2c, 0x59, 0x44, 0x6d,
+			0xda, 0x03, 0x32, 0x0c, 0x74, 0x70, 0xd6, 0x2b,
+			0xe3, 0x62, 0x55, 0x73, 0xa1, 0x41, 0xf6, 0x89,
+			0x22, 0x62, 0xf8, 0xee, 0xcc, 0x64, 0x16, 0x6e,
+			0xb4, 0x4a, 0x36, 0x73, 0x23, 0xfc, 0xa2, 0xf2,
+			0xfe, 0xfc, 0xe7, 0x36, 0xbd, 0xcd, 0xa0, 0xcb,
+			0x9e, 0x75, 0xbc, 0xa4, 0x03, 0x8f, 0x12, 0x43,
+			0xfa, 0x13, 0xd7, 0x67, 0xa7, 0x9c, 0x0b, 0x5b,
+			0x6e, 0x38, 0x87, 0x8d, 0x59, 0xe9, 0x8e, 0x53,
+			0x50, 0xff, 0x00, 0xe9, 0xf3, 0x41, 0x17, 0xf6,
+			0x23, 0x03, 0xc2, 0xe4, 0xa5, 0x45, 0x9c, 0x1d,
+			0x1e, 0xed, 0xf9, 0x37, 0x52, 0x89, 0x56, 0x0f,
+			0x96, 0x8f, 0xf5, 0x53, 0x02, 0xe9, 0x90, 0x6b,
+			0x38, 0x1c, 0x1d, 0x68, 0x2a, 0x34, 0xf2, 0x63,
+			0xdb, 0xa3, 0x39, 0x6d, 0x27, 0x15, 0x5b, 0x70,
+			0x44, 0x51, 0x2f, 0xf5, 0x15, 0x03, 0x75, 0xec,
+			0x5b, 0x55, 0x39, 0x8a, 0xbf, 0x55, 0xb3, 0x42,
+			0xd2, 0x6d, 0x0c, 0xeb, 0xa6, 0x20, 0xe8, 0xa8,
+			0xa6, 0x94, 0x0b, 0x34, 0xfd, 0xb3, 0x09, 0x91,
+			0xb3, 0x43, 0xc2, 0x81, 0xc8, 0x39, 0x2f, 0x37,
+			0x57, 0x60, 0x8e, 0x48, 0x48, 0x98, 0xcb, 0x4a,
+			0xb9, 0xf4, 0x56, 0x7b, 0x13, 0x44, 0xd7, 0xd8,
+			0xf9, 0xb1, 0xfa, 0x11, 0x0b, 0x6f, 0x76, 0x03,
+			0xbc, 0x4c, 0x2a, 0x0a, 0xde, 0x06, 0x2b, 0x55,
+			0xd6, 0xc2, 0x5b, 0x51, 0x3c, 0x00, 0x45, 0x86,
+			0x15, 0xaa, 0x01, 0xcb, 0x82, 0x06, 0x7c, 0xc5,
+			0x47, 0x50, 0x2b, 0xa2, 0x2c, 0xd6, 0x67, 0xd4,
+			0x9c, 0x8e, 0x4c, 0x81, 0x4b, 0x4a, 0x9b, 0x1a,
+			0x21, 0x7d, 0x3f, 0xb3, 0x36, 0xd7, 0xb1, 0x8a,
+			0x26, 0x55, 0x2e, 0x27, 0x5b, 0xc7, 0x07, 0x4b,
+			0xf6, 0xe8, 0xce, 0x5d, 0xed, 0x5d, 0x4d, 0x0b,
+			0x91, 0x4f, 0x47, 0xc7, 0x5e, 0xae, 0x22, 0xe5,
+			0xff, 0x69, 0x0b, 0x25, 0xf0, 0x64, 0xf3, 0x34,
+			0xe9, 0x83, 0x6f, 0x75, 0x0e, 0x78, 0x15, 0x79,
+			0xea, 0x77, 0x12, 0xd2, 0x6f, 0xfe, 0x0f, 0x60,
+			0x81, 0x94, 0xe8, 0x2f, 0xef, 0xe1, 0xeb, 0x71,
+			0x65, 0x72, 0xbe, 0x6f, 0x32, 0xc4, 0xc5, 0x35,
+			0x9a, 0xd6, 0xd9, 0x57, 0xb9, 0x24, 0xe4, 0x6e,
+			0xaa, 0x9c, 0x15, 0x26, 0xc3, 0x1f, 0x96, 0xa3,
+			0x5f, 0x37, 0x0e, 0x7d, 0x2d, 0x6a, 0x83, 0x7e,
+			0x9f, 0x78, 0x8f, 0x6d, 0x12, 0x24, 0x2c, 0x59,
+			0x32, 0xbc, 0xd5, 0xe9, 0x16, 0xae, 0x03, 0xe5,
+			0xf7, 0x87, 0x08, 0xa6, 0x9e, 0x15, 0xf6, 0x49,
+			0x38, 0x8d, 0x80, 0xa4, 0x4f, 0xe4, 0xea, 0xd8,
+			0x1d, 0x72, 0xb4, 0xe6, 0x03, 0xee, 0xb1, 0x7e,
+			0x61, 0x58, 0x6a, 0x7b, 0x01, 0x3a, 0x00, 0x8d,
+			0xdb, 0x63, 0x02, 0x21, 0xd4, 0x9b, 0xd3, 0x05,
+			0x78, 0xd6, 0x5e, 0x46, 0xe3, 0x8f, 0x6d, 0xcf,
+			0xea, 0xbb, 0x97, 0xed, 0xc6, 0x4f, 0xfa, 0x1d,
+			0xe3, 0x88, 0xe3, 0x03, 0xe2, 0x12, 0xa9, 0x81,
+			0x3b, 0xd8, 0xa3, 0x83, 0x2c, 0x49, 0x8c, 0xd5,
+			0x63, 0xb3, 0x63, 0x49, 0x1b, 0x17, 0x8f, 0xbb,
+			0x0b, 0x03, 0x84, 0xd0, 0xd4, 0x10, 0x6f, 0xde,
+			0xb7, 0xfa, 0x22, 0x6d, 0xf0, 0xf2, 0x89, 0x1f,
+			0xa8, 0x2f, 0x49, 0x83, 0x77, 0xde, 0x9a, 0xd1,
+			0xe0, 0x69, 0xb3, 0xf8, 0x69, 0x7f, 0x8f, 0x74,
+			0xac, 0x97, 0x42, 0xb4, 0x9d, 0x3d, 0xb0, 0x98,
+			0x4c, 0x7f, 0x53, 0xed, 0x7a, 0x33, 0xbd, 0xba,
+			0x00, 0x41, 0x1f, 0xec, 0x7f, 0x98, 0x70, 0xa0,
+			0x84, 0x01, 0x90, 0xc2, 0x78, 0x78, 0x1f, 0x2a,
+			0x55, 0x0a, 0x59, 0x03, 0xa5, 0x92, 0xb1, 0xe0,
+			0xf2, 0xb6, 0x7f, 0x83, 0xd6, 0x41, 0x76, 0x27,
+			0x04, 0x8e, 0x21, 0x34, 0xb9, 0x68, 0x1d, 0x93,
+			0x44, 0xf6, 0xb3, 0xeb, 0x44, 0x0e, 0xcf, 0xbb,
+			0xf1, 0x44, 0x1b, 0x95, 0x27, 0xad, 0xfe, 0x64,
+			0xe1, 0xe1, 0xec, 0x4f, 0x74, 0xae, 0xb9, 0xe5,
+			0x8a, 0x7a, 0x92, 0x49, 0xdf, 0xf0, 0xf0, 0x5e,
+			0x4c, 0xea, 0x85, 0xdb, 0x15, 0x79, 0x8d, 0x08,
+			0x5a, 0xa3, 0xb5, 0x3d, 0x9f, 0xa0, 0x88, 0x41,
+			0x16, 0x84, 0x80, 0x1b, 0xa4, 0x6b, 0x52, 0x4d,
+			0x09, 0x7a, 0x10, 0x44, 0x46, 0x0e, 0xc8, 0xa0,
+			0x14, 0x12, 0xe2, 0xcf, 0x34, 0x10, 0xc7, 0xd1,
+			0x12, 0x5d, 0x67, 0xd8, 0x3c, 0xa7, 0x16, 0x59,
+			0xb9, 0xbf, 0x7d, 0xf6, 0x1f, 0x4e, 0x14, 0xbb,
+			0x22, 0x07, 0x4f, 0x7b, 0xa7, 0x52, 0xe9, 0x23,
+			0xcc, 0x8a, 0x7a, 0x88, 0xea, 0xb3, 0xc5, 0x9b,
+			0xe0, 0xe3, 0xa0, 0x21, 0xbf, 0x77, 0x86, 0x37,
+			0x1c, 0xbc, 0xec, 0x08, 0xa8, 0x8a, 0x33, 0xff,
+			0x13, 0xf4, 0x16, 0xda, 0xb1, 0xa0, 0x36, 0x7f,
+			0x86, 0x6f, 0x20, 0x2f, 0xe6, 0xb2, 0x0a, 0xd5,
+			0xf6, 0xdd, 0x8b, 0x68, 0x02, 0x5c, 0x35, 0x7c,
+			0xc4, 0x8f, 0xc5, 0x12, 0xb6, 0xa6, 0x8d, 0x34,
+			0x83, 0x94, 0xaf, 0x52, 0x8c, 0x30, 0x73, 0x12,
+			0x27, 0xcf, 0x95, 0x8a, 0x02, 0x67, 0xcf, 0xeb,
+			0x67, 0xd2, 0x56, 0xe9, 0x63, 0xdc, 0x70, 0xbe,
+			0xf6, 0x66, 0x83, 0x89, 0xfc, 0x55, 0x13, 0x97,
+			0xbd, 0xbb, 0x25, 0x45, 0xee, 0x05, 0xd2, 0x00,
+			0xae, 0xca, 0x86, 0x70, 0x55, 0x0d, 0x88, 0x5e,
+			0xd3, 0x41, 0xa9, 0x20, 0x13, 0x54, 0xc2, 0x9a,
+			0x9a, 0x62, 0x23, 0x26, 0x1d, 0x1d, 0xe0, 0x84,
+			0x70, 0xd3, 0x03, 0x78, 0x05, 0x24, 0x8e, 0xd7,
+			0x75, 0x46, 0x3d, 0x04, 0x5d, 0x2e, 0x63, 0x4e,
+			0x44, 0x70, 0x85, 0x38, 0xea, 0x34, 0x9b, 0x40,
+			0xf7, 0xaf, 0xb5, 0xbd, 0x65, 0x6c, 0x58, 0x19,
+			0x04, 0xcf, 0x92, 0xe2, 0x06, 0x1e, 0xb4, 0xd5,
+			0x76, 0xd3, 0x69, 0xe3, 0x1a, 0xe1, 0x8c, 0xcd,
+			0x21, 0x17, 0x3d, 0xa4, 0xc1, 0x24, 0xf9, 0x08,
+			0x82, 0x01, 0xa5, 0xb4, 0xc8, 0x7d, 0x09, 0x94,
+			0x6a, 0x8e, 0xc7, 0x32, 0x07, 0x4b, 0xf5, 0x00,
+			0x7c, 0x80, 0x0b, 0xe4, 0x8c, 0xdb, 0xed, 0xfb,
+			0xa9, 0xd9, 0xfc, 0xcc, 0xdb, 0x46, 0xf9, 0xaa,
+			0xe5, 0x83, 0xd2, 0xa5, 0x37, 0xb2, 0x9d, 0xfc,
+			0x96, 0x2f, 0xee, 0x16, 0xef, 0x37, 0x40, 0x21,
+			0x31, 0x5a, 0x97, 0xe2, 0x03, 0xf1, 0xa5, 0x5d,
+			0x05, 0x79, 0xf9, 0xde, 0x58, 0x29, 0x24, 0xcc,
+			0x92, 0x92, 0xa8, 0xcd, 0x79, 0xa3, 0x6b, 0xf5,
+			0x77, 0x6e, 0x10, 0x0a, 0x6b, 0x7c, 0xe6, 0xc4,
+			0xb9, 0xb6, 0x4b, 0xd3, 0xe7, 0x8d, 0x35, 0xc6,
+			0x04, 0xc4, 0xba, 0x61, 0xfc, 0x89, 0x3a, 0x73,
+			0x47, 0x1c, 0x14, 0x5b, 0x20, 0x51, 0xca, 0x65,
+			0x0c, 0x99, 0x45, 0xf9, 0x73, 0xa0, 0x30, 0xfe,
+			0x06, 0x3d, 0x09, 0xfe, 0xbf, 0xba, 0xa6, 0x0a,
+			0x5e, 0x78, 0x31, 0x8a, 0x23, 0x94, 0x22, 0x2d,
+			0x3e, 0x17, 0x82, 0xed, 0x8b, 0xf9, 0xec, 0xb5,
+			0x5e, 0x58, 0x0d, 0x56, 0xfa, 0x4f, 0x17, 0xf0,
+			0xd5, 0xf0, 0x00, 0x2a, 0x9c, 0x9c, 0xfe, 0x4b,
+			0xc2, 0x8f, 0xee, 0x06, 0x8d, 0x7d, 0x84, 0x0e,
+			0xf4, 0x0c, 0x5f, 0xaf, 0x95, 0xcb, 0x28, 0xac,
+			0x00, 0x88, 0x06, 0xb4, 0xfa, 0x5c, 0x48, 0x6b,
+			0x22, 0xf4, 0xd4, 0xe4, 0x36, 0x25, 0xba, 0x7f,
+			0x21, 0xc9, 0x73, 0x37, 0x7b, 0x59, 0x65, 0x84,
+			0x4a, 0x7a, 0xb7, 0x80, 0x6e, 0x97, 0xb7, 0x22,
+			0xe7, 0x16, 0x9c, 0x3e, 0x92, 0x84, 0x9c, 0xa5,
+			0x18, 0xc6, 0x4a, 0xc6, 0xda, 0xbc, 0xbe, 0x06,
+			0x5e, 0xc8, 0xfc, 0xc3, 0x2a, 0x3c, 0xa7, 0xb1,
+			0xd0, 0x0e, 0x96, 0x5e, 0xfa, 0xe6, 0xc0, 0xc4,
+			0x75, 0x1f, 0x06, 0xe8, 0xe0, 0xee, 0x5d, 0xab,
+			0x28, 0x32, 0x5c, 0xbe, 0x7e, 0x5f, 0xa1, 0x30,
+			0x56, 0x7a, 0xf5, 0x77, 0xf7, 0x4c, 0x8d, 0xbd,
+			0x96, 0x3f, 0x32, 0x72, 0xe7, 0x8d, 0xf6, 0xbe,
+			0x97, 0xaf, 0x42, 0x66, 0x05, 0x83, 0x3b, 0xba,
+			0xa3, 0x54, 0x23, 0xcb, 0xd6, 0x1d, 0x17, 0x10,
+			0xc3, 0xb6, 0xab, 0xe1, 0xc8, 0xcf, 0x74, 0xac,
+			0x33, 0x0e, 0x7f, 0x11, 0x84, 0x69, 0xfc, 0xc8,
+			0xe1, 0x01, 0x93, 0x83, 0x7c, 0xbd, 0xd9, 0x1b,
+			0x40, 0x35, 0x10, 0xad, 0x00, 0x55, 0x14, 0xfb,
+			0x48, 0x5a, 0xc4, 0x56, 0x28, 0x3d, 0x3c, 0x71,
+			0x10, 0xbe, 0x18, 0x81, 0x92, 0xdb, 0xa9, 0x40,
+			0x54, 0x39, 0x52, 0x09, 0xad, 0x82, 0x20, 0xe5,
+			0x01, 0x34, 0xea, 0x4f, 0x31, 0xf2, 0xdc, 0x01,
+			0xd1, 0xff, 0x08, 0xe0, 0x93, 0x73, 0x79, 0x86,
+			0x96, 0xf7, 0x94, 0x6e, 0x12, 0x09, 0x4a, 0x65,
+			0x78, 0x37, 0x45, 0xc7, 0x8b, 0x8d, 0x15, 0x7b,
+			0xec, 0xde, 0x2b, 0x6a, 0x55, 0xeb, 0xac, 0xb8,
+			0x58, 0x3f, 0x70, 0x3f, 0xb3, 0x38, 0xf7, 0x2d,
+			0x75, 0x65, 0xda, 0xa3, 0x81, 0xc5, 0x31, 0x81,
+			0xa2, 0xfb, 0xa8, 0x68, 0xed, 0x0a, 0x9b, 0xb2,
+			0x6f, 0x4b, 0xb0, 0x65, 0xd9, 0x45, 0x31, 0x40,
+			0x07, 0xbb, 0x7d, 0x9f, 0x7b, 0x7b, 0xaf, 0xc5,
+			0xb9, 0xe4, 0x35, 0xe7, 0xca, 0x7c, 0x0d, 0x0f,
+			0xd1, 0xa6, 0xbc, 0x5c, 0x13, 0xee, 0x65, 0xfe,
+			0x50, 0xc4, 0x92, 0x9f, 0x00, 0x38, 0x91, 0xe9,
+			0x6d, 0xf9, 0x91, 0x3d, 0x87, 0xa8, 0xc4, 0xd3,
+			0x12, 0xe8, 0x50, 0x7f, 0x42, 0x40, 0x50, 0x32,
+			0xcb, 0x23, 0x8a, 0x9a, 0xf6, 0x78, 0xf9, 0x15,
+			0x29, 0xbc, 0x06, 0x39, 0xc4, 0xd2, 0xc9, 0xb7,
+			0xbb, 0x0b, 0x29, 0x28, 0x27, 0xd0, 0xe2, 0xf2,
+			0xc2, 0xdf, 0xee, 0x60, 0x33, 0x7b, 0xe0, 0x7b,
+			0x37, 0x91, 0x0d, 0xf9, 0x52, 0x4d, 0xd6, 0xec,
+			0x19, 0x58, 0x60, 0xeb, 0x51, 0x07, 0x60, 0xb2,
+			0x9e, 0xee, 0x22, 0xc9, 0xe8, 0xe6, 0x95, 0x04,
+			0x9b, 0xd9, 0x82, 0xe9, 0x5b, 0x51, 0xd4, 0x53,
+			0x79, 0x49, 0x9d, 0xf9, 0x6c, 0xe7, 0x4e, 0x4a,
+			0x38, 0x9b, 0x9d, 0xdc, 0x28, 0xed, 0xbc, 0x93,
+			0x10, 0xfa, 0x38, 0x78, 0xda, 0xd3, 0x26, 0x82,
+			0x74, 0x5e, 0x65, 0xe7, 0x7b, 0xc8, 0xce, 0x18,
+			0x1d, 0xd7, 0x79, 0x1d, 0xa6, 0x64, 0x59, 0x9f,
+			0xc5, 0xf1, 0x21, 0xe4, 0x0c, 0xea, 0x8d, 0xfb,
+			0x9b, 0x41, 0x01, 0xb4, 0xfd, 0xcb, 0x15, 0x45,
+			0x71, 0xc6, 0x3b, 0x53, 0xe7, 0x49, 0x82, 0xf9,
+			0x9b, 0x58, 0x84, 0xce, 0x97, 0x63, 0xcb, 0xae,
+			0x59, 0x07, 0xcb, 0x2a, 0xd5, 0x2a, 0xb9, 0xe0,
+			0x16, 0x8e, 0x6a, 0xc8, 0xb5, 0x2c, 0x03, 0x5e,
+			0xbb, 0xf5, 0x3f, 0xed, 0xd6, 0x84, 0x33, 0x22,
+			0xf0, 0x01, 0x75, 0x31, 0x08, 0xfb, 0x53, 0x48,
+			0xf5, 0x63, 0xae, 0x30, 0x3d, 0xc6, 0x9a, 0xe3,
+			0x16, 0xac, 0x3a, 0x29, 0xae, 0x6a, 0x9c, 0x02,
+			0xd5, 0xbd, 0xbb, 0x43, 0x9e, 0x97, 0x72, 0x40,
+			0xcb, 0xc5, 0x93, 0x53, 0xed, 0xbb, 0xa1, 0x75,
+			0x12, 0x31, 0xc7, 0x9a, 0x9f, 0xd8, 0xc7, 0x18,
+			0xf7, 0x20, 0xb2, 0xb8, 0xe5, 0x17, 0x42, 0x6c,
+			0x61, 0x2e, 0x80, 0x47, 0xae, 0x26, 0x33, 0xcf,
+			0x44, 0x5f, 0x99, 0xcc, 0x00, 0x48, 0xcc, 0xf8,
+			0xa9, 0xcf, 0xa3, 0xc1, 0xa9, 0xcb, 0xf6, 0x58,
+			0xc4, 0x12, 0x5a, 0xe8, 0x67, 0x9b, 0x09, 0xe7,
+			0x1c, 0xc7, 0xe4, 0x34, 0x5d, 0xaf, 0x66, 0x6f,
+			0x03, 0x19, 0x60, 0xab, 0x9d, 0xf8, 0x1d, 0xfa,
+			0xfb, 0x45, 0x42, 0xaa, 0x13, 0x23, 0xf7, 0x31,
+			0x7f, 0xad, 0x80, 0xfc, 0x76, 0x5a, 0x44, 0x0e,
+			0x3c, 0xc6, 0x59, 0xaf, 0x8f, 0xbb, 0x76, 0x11,
+			0x63, 0x61, 0x1e, 0x5f, 0xca, 0x16, 0xa8, 0x45,
+			0x09, 0xb9, 0x24, 0x91, 0x9e, 0xae, 0xbb, 0xa4,
+			0x74, 0xb3, 0x95, 0xc0, 0xc9, 0x46, 0xda, 0x03,
+			0xdf, 0xd7, 0x4e, 0xf9, 0xf9, 0x6a, 0x32, 0x01,
+			0x6b, 0x01, 0xa0, 0xdf, 0x51, 0xbe, 0x56, 0x82,
+			0x37, 0xef, 0x23, 0xdc, 0x37, 0xe1, 0x80, 0x7b,
+			0x78, 0x76, 0x7e, 0x05, 0x92, 0xa8, 0xd1, 0x23,
+			0xab, 0x22, 0xb8, 0x9f, 0x27, 0xc5, 0x42, 0x9b,
+			0x06, 0x2f, 0x1c, 0xe8, 0xad, 0x41, 0x37, 0x65,
+			0xfe, 0x9e, 0xfc, 0x5c, 0x36, 0x49, 0xd2, 0x42,
+			0x4c, 0xe9, 0x61, 0x88, 0x2d, 0x23, 0x0e, 0x22,
+			0xac, 0x1f, 0xcf, 0x9f, 0x7b, 0x47, 0x77, 0x17,
+			0xea, 0x88, 0x63, 0x56, 0x3a, 0xcc, 0x51, 0x24,
+			0x6d, 0x40, 0xda, 0xcd, 0x84, 0xc4, 0xea, 0x4b,
+			0x84, 0x0a, 0x79, 0x2a, 0x65, 0xf8, 0x0c, 0x46,
+			0x4f, 0xd3, 0xd4, 0xc8, 0x24, 0x05, 0x14, 0xe3,
+			0xf6, 0x02, 0x5c, 0x6c, 0x75, 0x2a, 0x1a, 0x07,
+			0xd5, 0x21, 0x2b, 0x65, 0xd9, 0xe4, 0xf2, 0x50,
+			0xfc, 0xcc, 0x17, 0xe7, 0xd5, 0xca, 0x9c, 0xa6,
+			0x13, 0xb9, 0x59, 0xd8, 0xb0, 0x5a, 0x89, 0x45,
+			0xaf, 0x89, 0xb5, 0xf5, 0x37, 0xa4, 0x4f, 0x08,
+			0x06, 0x25, 0x94, 0x89, 0x5a, 0xa8, 0x17, 0x78,
+			0xcd, 0x60, 0x6b, 0x50, 0xa1, 0x9c, 0xb6, 0x26,
+			0x6b, 0xb3, 0xfb, 0x2e, 0xc4, 0x39, 0x4f, 0x4e,
+			0x0e, 0xd3, 0x21, 0x21, 0x24, 0x58, 0xc8, 0xcb,
+			0x5d, 0x52, 0x40, 0x40, 0x63, 0x05, 0x10, 0xd3,
+			0xc3, 0x32, 0x3b, 0xec, 0x43, 0x04, 0x21, 0x0a,
+			0xd1, 0x2e, 0x56, 0x8f, 0xe5, 0xf8, 0xda, 0x37,
+			0xcd, 0x27, 0xff, 0xcf, 0x53, 0xf8, 0xdb, 0x48,
+			0xf2, 0x83, 0xe0, 0x26, 0xfc, 0x03, 0xa8, 0xb3,
+			0x05, 0x60, 0x64, 0x1f, 0x6a, 0x2a, 0x50, 0x67,
+			0x0a, 0x8c, 0x7d, 0xf5, 0x74, 0x73, 0xb6, 0xae,
+			0xd3, 0x70, 0xa1, 0x17, 0xd1, 0xed, 0x6b, 0xf0,
+			0x1d, 0x33, 0xb9, 0x77, 0x53, 0x1f, 0xd5, 0x7e,
+			0x36, 0x30, 0xa0, 0x79, 0x97, 0xf7, 0x69, 0x1f,
+			0xa1, 0x45, 0x77, 0xe3, 0x13, 0x23, 0x61, 0xe1,
+			0xea, 0x2b, 0x1d, 0xde, 0x2b, 0x86, 0xbc, 0x61,
+			0xe2, 0x59, 0x0c, 0x95, 0x8c, 0xd0, 0x93, 0x43,
+			0x14, 0x99, 0x62, 0xd1, 0x10, 0x3d, 0x60, 0x84,
+			0x2b, 0x15, 0x61, 0xc1, 0xd2, 0x9d, 0xa8, 0x51,
+			0xe9, 0xec, 0xe1, 0x5a, 0x7d, 0x8a, 0xac, 0xb9,
+			0xac, 0xfa, 0x2e, 0xb5, 0x0e, 0x4f, 0x66, 0xfe,
+			0xd9, 0xba, 0x2d, 0xd2, 0x66, 0x89, 0x17, 0xf4,
+			0x20, 0x1c, 0xff, 0x4e, 0x38, 0xf0, 0x57, 0xf7,
+			0x65, 0x17, 0xde, 0x64, 0x47, 0xd2, 0x3e, 0xf8,
+			0xd4, 0xcd, 0x66, 0x57, 0xb5, 0x66, 0xd4, 0x68,
+			0x81, 0xc8, 0x0f, 0x29, 0x28, 0xba, 0x53, 0x32,
+			0x99, 0x6c, 0x61, 0x74, 0xcb, 0xf5, 0xad, 0xcb,
+			0xb1, 0x04, 0x96, 0xa8, 0x61, 0xe1, 0x4a, 0xc4,
+			0x01, 0xf0, 0xd1, 0xf7, 0xf8, 0xab, 0x8b, 0x8c,
+			0xbb, 0x9f, 0xee, 0x0b, 0xb8, 0x65, 0x15, 0x9f,
+			0x23, 0xe6, 0xe5, 0xa7, 0xc0, 0x4c, 0x4c, 0x84,
+			0xdb, 0x5a, 0xec, 0x6a, 0x35, 0xa6, 0xbe, 0x5d,
+			0x06, 0x2f, 0xb4, 0x52, 0xa3, 0x4e, 0xe6, 0x61,
+			0x01, 0x88, 0xa3, 0x2b, 0xe6, 0x79, 0xba, 0xa7,
+			0x70, 0x4b, 0x18, 0xbb, 0x56, 0x0b, 0x59, 0x00,
+			0xbf, 0x6c, 0xac, 0x83, 0x7b, 0x58, 0x5d, 0x71,
+			0x00, 0x5f, 0x91, 0xd7, 0xc6, 0x2a, 0xb4, 0xad,
+			0x59, 0x87, 0x91, 0xb3, 0xcb, 0x81, 0x84, 0xfe,
+			0x3d, 0xf5, 0x32, 0x5e, 0x23, 0xe6, 0xa2, 0x83,
+			0xf2, 0x32, 0x86, 0x14, 0x17, 0xbb, 0x4b, 0xf5,
+			0xd3, 0xc7, 0x88, 0x83, 0x90, 0x95, 0xf1, 0x8c,
+			0xba, 0x39, 0x06, 0x1e, 0xd5, 0x37, 0x66, 0x8f,
+			0x08, 0xc6, 0xc2, 0xd8, 0xec, 0xef, 0x19, 0xaf,
+			0x20, 0xbc, 0xe7, 0x68, 0xcc, 0xeb, 0x0f, 0xa1,
+			0x39, 0xb5, 0x7f, 0x07, 0x23, 0xa1, 0x01, 0x62,
+			0x4f, 0x28, 0xd5, 0x9f, 0xc7, 0x1b, 0x2e, 0xc5,
+			0x59, 0x4c, 0x28, 0xe2, 0x61, 0x40, 0xce, 0xdc,
+			0xdc, 0x95, 0xd8, 0x56, 0x9c, 0x95, 0x10, 0xfe,
+			0xf6, 0x7e, 0x53, 0x34, 0x4f, 0xb8, 0x37, 0xc7,
+			0xef, 0x7e, 0x3e, 0x6c, 0xba, 0xe6, 0xdf, 0xdb,
+			0x75, 0xcd, 0x0e, 0x83, 0xd7, 0x9d, 0xca, 0xaf,
+			0xaa, 0x2e, 0x99, 0xb6, 0xe1, 0xbc, 0xbd, 0x02,
+			0x00, 0xb3, 0xf2, 0x81, 0x81, 0xf5, 0x44, 0x20,
+			0x35, 0xb7, 0x83, 0x7e, 0x89, 0x54, 0xd7, 0xce,
+			0x71, 0x97, 0x29, 0x20, 0xcf, 0x12, 0x64, 0xe0,
+			0xaa, 0x33, 0xd1, 0x7e, 0xbe, 0xcb, 0xf8, 0xc2,
+			0x8c, 0x34, 0x14, 0xbe, 0xd5, 0x62, 0x1f, 0xe8,
+			0xbc, 0xce, 0xfc, 0x61, 0x60, 0x73, 0xf9, 0x59,
+			0x51, 0xcb, 0xaf, 0x90, 0x44, 0xdf, 0x27, 0xee,
+			0x3a, 0x0d, 0x17, 0xf1, 0x26, 0xa1, 0x0a, 0xc8,
+			0x53, 0x38, 0xb2, 0xdf, 0x35, 0x3f, 0x3f, 0xbb,
+			0xad, 0xcf, 0x1c, 0x9a, 0x9d, 0xca, 0xc0, 0x88,
+			0x25, 0xe0, 0xd9, 0xfe, 0xfa, 0xe4, 0xcf, 0x41,
+			0x47, 0xaa, 0x04, 0x2c, 0xc1, 0x24, 0x3d, 0xf6,
+			0xf4, 0x7e, 0x42, 0xe0, 0x59, 0x08, 0x06, 0x14,
+			0xd5, 0x6e, 0xb0, 0x48, 0xf3, 0x69, 0x5d, 0x00,
+			0x35, 0x1e, 0xd1, 0x9a, 0x06, 0x71, 0xf3, 0x92,
+			0x45, 0x6d, 0xf5, 0xad, 0x52, 0x8d, 0x38, 0x5d,
+			0x83, 0x73, 0x86, 0x92, 0x45, 0x65, 0x11, 0x74,
+			0x94, 0xb8, 0x1b, 0x56, 0x41, 0x7b, 0x67, 0xce,
+			0x4d, 0x42, 0x44, 0x36, 0xf3, 0xf9, 0x29, 0x19,
+			0xa2, 0xd5, 0xe3, 0xc7, 0x8f, 0x7f, 0x9c, 0x24,
+			0x21, 0x2f, 0xaa, 0xe0, 0x19, 0x65, 0x21, 0xbb,
+			0x81, 0x68, 0x0c, 0x4c, 0x2b, 0xc8, 0x25, 0x47,
+			0xa0, 0x22, 0x39, 0xb4, 0x90, 0x19, 0x70, 0x0e,
+			0xd7, 0x7a, 0xbe, 0x00, 0x11, 0x23, 0x50, 0x99,
+			0x2e, 0x1b, 0xec, 0xa1, 0x8f, 0x6e, 0xf5, 0x60,
+			0x9a, 0x7b, 0x20, 0x7d, 0x98, 0x17, 0x12, 0x6c,
+			0x59, 0x8c, 0x29, 0x5f, 0xd6, 0x17, 0x28, 0x36,
+			0xa8, 0x16, 0xa1, 0x17, 0x37, 0x26, 0xf1, 0x67,
+			0x0a, 0x3b, 0xb0, 0x75, 0xf7, 0x73, 0x87, 0xdc,
+			0xeb, 0x89, 0x4c, 0xc9, 0x4b, 0x6a, 0xa2, 0x04,
+			0xe2, 0x92, 0xfa, 0x94, 0x19, 0x1f, 0x99, 0x82,
+			0x7f, 0xba, 0xbb, 0x21, 0x8d, 0xe7, 0x91, 0xb9,
+			0x0e, 0x26, 0x81, 0x47, 0xb9, 0x94, 0xa1, 0xe0,
+			0x3b, 0xdf, 0xda, 0x5a, 0x22, 0x6e, 0x36, 0xea,
+			0xc8, 0x69, 0x4f, 0xa8, 0xb2, 0x82, 0x32, 0x46,
+			0x5c, 0xc0, 0x21, 0x18, 0x7d, 0xb2, 0xfb, 0x8e,
+			0x4d, 0x93, 0xb4, 0x57, 0x20, 0x6f, 0xae, 0xa9,
+			0x99, 0x8c, 0x28, 0xba, 0xd1, 0x7a, 0x7d, 0x36,
+			0xe9, 0x4a, 0xaf, 0xb5, 0x7d, 0x38, 0x46, 0xc1,
+			0x96, 0xa2, 0x79, 0xcb, 0x57, 0x4e, 0xda, 0x58,
+			0x7e, 0x63, 0x94, 0x74, 0xbb, 0xae, 0x78, 0x2b,
+			0x72, 0x29, 0xa5, 0xfb, 0x49, 0x91, 0x0e, 0x9c,
+			0x70, 0x6d, 0x45, 0x59, 0x2a, 0x3c, 0x14, 0x76,
+			0x19, 0x3c, 0x80, 0x41, 0x09, 0x98, 0xd2, 0x1e,
+			0xeb, 0xd4, 0xd5, 0x5c, 0xe3, 0xcf, 0x97, 0x39,
+			0x89, 0xe2, 0xb8, 0xfd, 0x75, 0x19, 0x83, 0x30,
+			0x1d, 0xb7, 0x97, 0x5c, 0x28, 0x37, 0x85, 0xee,
+			0x07, 0x34, 0xbe, 0x9f, 0xe7, 0xd4, 0xfb, 0x36,
+			0x58, 0xd9, 0x15, 0xaf, 0xbe, 0xaf, 0xe6, 0x11,
+			0xe1, 0xbe, 0x20, 0x12, 0xde, 0x8a, 0x36, 0xcd,
+			0x81, 0x06, 0xcc, 0x7d, 0x56, 0xb3, 0x0d, 0xb4,
+			0xa6, 0xbb, 0xf1, 0xb7, 0x77, 0xc2, 0x90, 0x51,
+			0x3e, 0xc7, 0x8e, 0x01, 0xcb, 0xa3, 0x29, 0x6d,
+			0x94, 0xb9, 0xa7, 0x5a, 0xda, 0xbc, 0x12, 0x39,
+			0x26, 0xe4, 0xe2, 0xd4, 0xcc, 0xfe, 0x6c, 0x4d,
+			0x7e, 0xc0, 0x22, 0xf5, 0x6c, 0xff, 0xde, 0xc2,
+			0x6d, 0xb8, 0xb1, 0x96, 0x52, 0x57, 0x9d, 0x37,
+			0x3e, 0xdb, 0x32, 0x43, 0x80, 0x1b, 0x62, 0x74,
+			0x83, 0xbe, 0x48, 0xbe, 0x98, 0x1f, 0x7d, 0xdf,
+			0x7c, 0x31, 0xca, 0xd1, 0xfd, 0xb9, 0xec, 0x86,
+			0x57, 0x9a, 0xc8, 0x55, 0xa7, 0x53, 0xd3, 0x20,
+			0x0c, 0x88, 0xcb, 0xfa, 0xa7, 0x27, 0x91, 0xcb,
+			0xdd, 0x8b, 0xc3, 0xe8, 0x32, 0x2d, 0x74, 0xfa,
+			0xc1, 0x90, 0x07, 0xd9, 0xc1, 0xe5, 0xe1, 0xe4,
+			0x15, 0xdb, 0xf8, 0xc5, 0x97, 0xbc, 0x2a, 0x8d,
+			0x3d, 0x9d, 0xdf, 0x03, 0x32, 0xaf, 0x52, 0xbe,
+			0xcd, 0xae, 0x9e, 0x2a, 0xcd, 0xc6, 0x3b, 0x05,
+			0xb2, 0x30, 0x93, 0x22, 0x2f, 0x41, 0x87, 0x6c,
+			0x67, 0xef, 0x6c, 0x9d, 0x1d, 0x9b, 0x28, 0x76,
+			0x5d, 0xc5, 0x4f, 0xc6, 0x7f, 0xda, 0x0f, 0xa0,
+			0x8d, 0x4b, 0x80, 0xe0, 0xb0, 0xf7, 0xd6, 0x2c,
+			0x66, 0xa1, 0x2f, 0x66, 0xc3, 0x69, 0xa7, 0x70,
+			0x86, 0x1a, 0x4a, 0x3b, 0xd7, 0x0a, 0xce, 0xbe,
+			0xcd, 0xb5, 0xb2, 0x08, 0xfc, 0x13, 0x18, 0x81,
+			0x72, 0xeb, 0x71, 0x3f, 0xa1, 0x32, 0xd8, 0xea,
+			0x7a, 0x7c, 0x82, 0x94, 0x56, 0xa7, 0x56, 0xe2,
+			0xb9, 0x2b, 0xeb, 0x58, 0x8f, 0xd1, 0x22, 0x46,
+			0x88, 0xbc, 0xff, 0xcf, 0x31, 0xf4, 0x47, 0x1c,
+			0xab, 0x52, 0xa8, 0x28, 0x47, 0xa7, 0x01, 0xe2,
+			0xd9, 0xae, 0xe2, 0xb6, 0x95, 0x45, 0x7b, 0xf4,
+			0x18, 0x56, 0xb5, 0x41, 0xbf, 0x9f, 0xed, 0x04,
+			0x1b, 0x29, 0xf2, 0xd3, 0xf4, 0x98, 0x19, 0x6f,
+			0xe7, 0x37, 0xa0, 0x82, 0x6b, 0x4c, 0xe6, 0x36,
+			0x68, 0xba, 0x10, 0x9c, 0xc1, 0xf7, 0xa6, 0x21,
+			0xfa, 0x16, 0x06, 0xf9, 0x2a, 0x03, 0x43, 0xdb,
+			0xd9, 0x5e, 0x6d, 0x82, 0x27, 0x04, 0xa0, 0x85,
+			0x02, 0x99, 0x6f, 0xd1, 0x4f, 0x93, 0x41, 0x63,
+			0x48, 0x78, 0xa5, 0x5c, 0x51, 0xa2, 0xda, 0x8b,
+			0xa4, 0xc5, 0x4f, 0xe9, 0xb9, 0x52, 0x18, 0x4c,
+			0x18, 0x63, 0x76, 0x89, 0xaf, 0x06, 0x66, 0x0c,
+			0x4c, 0x5f, 0xb4, 0xff, 0x90, 0x00, 0x48, 0x5a,
+			0x85, 0xad, 0xad, 0x75, 0x9a, 0x64, 0xbf, 0x18,
+			0xa8, 0xac, 0x1f, 0x97, 0xdd, 0xf4, 0x40, 0x6b,
+			0xbe, 0x9a, 0x92, 0x9e, 0xd7, 0x57, 0xc0, 0xb3,
+			0x7d, 0xd2, 0x91, 0xc2, 0x34, 0xe7, 0x0d, 0xb8,
+			0xea, 0x43, 0x32, 0xda, 0x30, 0x0a, 0x35, 0x21,
+			0x09, 0x62, 0xd4, 0xcc, 0xc4, 0x70, 0x0b, 0xa6,
+			0x39, 0x6a, 0x36, 0x60, 0x4f, 0x7e, 0x95, 0xed,
+			0x65, 0x33, 0x88, 0x01, 0xc6, 0xd0, 0x34, 0x64,
+			0xee, 0x85, 0x30, 0xcb, 0xfb, 0xad, 0x62, 0xc9,
+			0x31, 0xb8, 0x56, 0x46, 0x5b, 0xfe, 0xe9, 0x11,
+			0xa7, 0x4e, 0x9a, 0x17, 0x50, 0x34, 0xe1, 0x27,
+			0x3e, 0xd8, 0x64, 0xc1, 0xb5, 0x1d, 0x09, 0x42,
+			0xb6, 0xec, 0xee, 0x7b, 0xc5, 0xac, 0xad, 0x57,
+			0x88, 0x20, 0x92, 0xc3, 0xe1, 0x2b, 0xd0, 0xe1,
+			0x1c, 0x0b, 0xe4, 0x65, 0x2f, 0xcd, 0xca, 0x33,
+			0xd6, 0x86, 0x6b, 0x11, 0x99, 0xcb, 0x65, 0xfb,
+			0x13, 0xf3, 0x8d, 0x28, 0x38, 0x81, 0xbb, 0x57,
+			0x31, 0x20, 0x87, 0x26, 0xbf, 0x80, 0x27, 0xf9,
+			0xc5, 0x4a, 0xea, 0xfe, 0xd8, 0x61, 0xa2, 0x44,
+			0x14, 0xc5, 0x37, 0x94, 0x33, 0x4a, 0x35, 0xbd,
+			0xb0, 0x52, 0xcd, 0x20, 0x9c, 0x70, 0x91, 0x04,
+			0x9f, 0x31, 0x28, 0x9a, 0xf1, 0x9a, 0x50, 0x4c,
+			0xc5, 0x90, 0x4c, 0x25, 0xa7, 0x87, 0x2d, 0xd1,
+			0xfd, 0x8e, 0xf2, 0xfe, 0xb1, 0x92, 0xaa, 0x7c,
+			0xfc, 0x91, 0x4b, 0xd5, 0xa8, 0x7d, 0x6f, 0x60,
+			0xf2, 0x23, 0x62, 0x61, 0xb5, 0xfd, 0x1c, 0x00,
+			0x7a, 0xa4, 0x3b, 0x1a, 0xc6, 0x61, 0x6f, 0x38,
+			0x02, 0x10, 0x4b, 0x4c, 0x65, 0x14, 0x85, 0x30,
+			0xdc, 0xb3, 0x01, 0x30, 0xe2, 0x63, 0xbf, 0xc8,
+			0xe8, 0xcc, 0x71, 0x80, 0x3d, 0x86, 0xff, 0xe3,
+			0x78, 0x6c, 0xfe, 0x22, 0x0e, 0x38, 0x11, 0x87,
+			0xf3, 0x0f, 0x7c, 0x78, 0x07, 0xd0, 0xc5, 0x47,
+			0x94, 0xd8, 0x82, 0x9c, 0xff, 0x08, 0xb3, 0x8d,
+			0x83, 0xa8, 0xdc, 0x08, 0xa5, 0xbd, 0x08, 0x2e,
+			0xe3, 0x16, 0x46, 0x13, 0x52, 0x63, 0x9c, 0x7e,
+			0x43, 0x5b, 0xfb, 0xba, 0x5d, 0x30, 0xaf, 0xd3,
+			0xfc, 0xe2, 0xa7, 0xa1, 0xd0, 0x10, 0x91, 0x8f,
+			0x2b, 0xe3, 0x9f, 0x9d, 0xa9, 0xb7, 0xd7, 0x10,
+			0x05, 0x30, 0x84, 0x9a, 0x9a, 0x79, 0xbe, 0x12,
+			0xd0, 0x0b, 0x2d, 0xc9, 0x99, 0x62, 0x21, 0x39,
+			0xb0, 0xc0, 0x76, 0xb6, 0x1d, 0x99, 0x32, 0xa7,
+			0xdf, 0x80, 0x68, 0xbe, 0xe8, 0xfb, 0xbe, 0x24,
+			0x9b, 0xfe, 0xce, 0x86, 0x69, 0xad, 0xde, 0xec,
+			0x90, 0x1c, 0xfe, 0x02, 0xfc, 0x77, 0x8f, 0xc3,
+			0x6e, 0xca, 0x0e, 0x78, 0x1c, 0xd9, 0x6f, 0xc5,
+			0x88, 0x0a, 0x8a, 0xb7, 0xd8, 0x0e, 0x11, 0x39,
+			0x57, 0x13, 0x02, 0xbb, 0xd9, 0x90, 0x58, 0xf2,
+			0x60, 0x06, 0x2f, 0xac, 0xc9, 0x28, 0xfd, 0x7c,
+			0xa1, 0x14, 0xaf, 0xae, 0xf6, 0x9c, 0x93, 0xaa,
+			0x46, 0x75, 0x30, 0x60, 0xb6, 0x7e, 0xa1, 0xd4,
+			0xc9, 0x5b, 0x2c, 0xbf, 0xad, 0x72, 0x7f, 0x68,
+			0x15, 0x3f, 0x9f, 0xec, 0x64, 0x81, 0x8b, 0x93,
+			0x41, 0x50, 0x52, 0x33, 0x07, 0xa4, 0xfa, 0xe3,
+			0x42, 0xc7, 0x7b, 0xa8, 0x48, 0x49, 0xcf, 0xb6,
+			0x57, 0xda, 0x10, 0x11, 0x53, 0x19, 0xae, 0x84,
+			0xbf, 0x63, 0x0a, 0x86, 0x18, 0x1d, 0xa6, 0xb8,
+			0x54, 0x4a, 0xf9, 0x62, 0x4f, 0x7c, 0xd0, 0xa3,
+			0xed, 0x89, 0xd5, 0x75, 0xa5, 0x4a, 0xf1, 0x46,
+			0xa8, 0x1e, 0xa0, 0xfc, 0xc5, 0x4f, 0xb4, 0x17,
+			0x89, 0xff, 0xe6, 0x71, 0x34, 0x18, 0xae, 0xa9,
+			0xe7, 0x6f, 0x3b, 0x2f, 0xf3, 0xc9, 0xbc, 0xa8,
+			0x9c, 0xbb, 0x51, 0x42, 0x03, 0x59, 0xd8, 0xb5,
+			0x4b, 0x78, 0x86, 0x13, 0x73, 0xec, 0x6e, 0x94,
+			0xb7, 0x91, 0x53, 0x62, 0x18, 0xaf, 0x2f, 0xb2,
+			0xd3, 0x91, 0xa9, 0xa3, 0x0a, 0x7b, 0xed, 0x7a,
+			0x94, 0x5d, 0xb1, 0x86, 0xe6, 0x26, 0xc4, 0xac,
+			0x5b, 0xaf, 0x91, 0x40, 0xc7, 0x74, 0x9f, 0xd9,
+			0x05, 0xa9, 0xcf, 0x61, 0xe3, 0x76, 0x8d, 0x24,
+			0x1c, 0xa8, 0x58, 0x94, 0x2a, 0x5f, 0x18, 0x66,
+			0xe5, 0xc2, 0x52, 0x29, 0x88, 0xf4, 0x4d, 0x87,
+			0xd5, 0xdf, 0xae, 0xa8, 0x64, 0xde, 0x12, 0xc8,
+			0x35, 0xfc, 0xf6, 0x4a, 0xa5, 0x2d, 0xc2, 0xd1,
+			0x40, 0x67, 0x0e, 0xb0, 0x5c, 0x77, 0x4f, 0xe0,
+			0xbb, 0xa3, 0xfd, 0x68, 0x03, 0xbb, 0x9d, 0xa3,
+			0x76, 0x23, 0x5d, 0x94, 0x83, 0x8a, 0x1a, 0x30,
+			0x81, 0x8f, 0x4a, 0x08, 0xe7, 0xee, 0x00, 0xbc,
+			0xdd, 0x86, 0xcd, 0x58, 0x95, 0xa6, 0xeb, 0xdb,
+			0x7a, 0xc3, 0x15, 0xac, 0xab, 0xef, 0x02, 0x28,
+			0x07, 0xa9, 0x06, 0xc0, 0xea, 0xc8, 0xe1, 0xbe,
+			0x00, 0x00, 0xbb, 0xf5, 0xff, 0x3d, 0x7f, 0xa2,
+			0xff, 0x0f, 0x3e, 0x1a, 0xe6, 0xe2, 0x82, 0x19,
+			0xd1, 0x8a, 0x6a, 0xab, 0xe6, 0xd1, 0x7a, 0x1e,
+			0xa0, 0x50, 0xe2, 0x54, 0x18, 0x85, 0xdb, 0x29,
+			0x67, 0x53, 0x2b, 0x24, 0xbe, 0x3d, 0xe3, 0xfb,
+			0x00, 0x0a, 0x06, 0xa7, 0x71, 0xf0, 0x55, 0x97,
+			0x8b, 0x05, 0x50, 0x4a, 0x8f, 0x1a, 0x69, 0xbd,
+			0x00, 0x6b, 0x96, 0x39, 0x3c, 0x0b, 0xe3, 0xd4,
+			0x1e, 0x16, 0x72, 0x64, 0xf8, 0x0e, 0xe8, 0xbd,
+			0x80, 0xfc, 0xa3, 0xcf, 0x1d, 0x21, 0xf1, 0x5c,
+			0x35, 0x72, 0xda, 0xc0, 0x1f, 0xf1, 0xd8, 0xe0,
+			0x87, 0x75, 0xe0, 0xfa, 0x21, 0x17, 0x09, 0x92,
+			0x10, 0xf3, 0xb9, 0x76, 0x3c, 0x64, 0x08, 0x28,
+			0x53, 0xcc, 0x33, 0xdd, 0x2a, 0x14, 0x9b, 0x8b,
+			0xae, 0xad, 0xd4, 0x94, 0xe9, 0x65, 0x50, 0x6d,
+			0x8f, 0x27, 0xea, 0x4f, 0xa7, 0x31, 0x69, 0xfa,
+			0x7f, 0xeb, 0xcf, 0x47, 0xe9, 0xa3, 0xdf, 0x1b,
+			0xa6, 0xc1, 0x9e, 0xcf, 0xc3, 0xb5, 0x84, 0x69,
+			0x49, 0xa7, 0xfa, 0xdf, 0xd5, 0xb1, 0x1e, 0xe7,
+			0xa5, 0x7c, 0x3c, 0x52, 0x3a, 0xf3, 0x8a, 0x3c,
+			0xd9, 0x2c, 0x9a, 0xd7, 0x58, 0xdc, 0x8c, 0x37,
+			0xce, 0x64, 0xc9, 0xff, 0x6d, 0x61, 0x35, 0x21,
+			0x09, 0xcc, 0x1b, 0x32, 0x58, 0x54, 0x34, 0x3b,
+			0x7c, 0x45, 0x25, 0x5b, 0xf0, 0xec, 0x42, 0xfb,
+			0xe7, 0xe5, 0xc0, 0xa2, 0xc1, 0xe0, 0x6e, 0x8a,
+			0x56, 0x67, 0xeb, 0x8b, 0x86, 0x0c, 0x80, 0x46,
+			0x8c, 0x9d, 0x2c, 0xb5, 0x66, 0xa1, 0x0e, 0xce,
+			0x13, 0x8f, 0xbf, 0x0b, 0x07, 0x8b, 0xa6, 0xd8,
+			0x91, 0xba, 0x80, 0x3e, 0x13, 0x51, 0x78, 0x72,
+			0xac, 0xc7, 0xf4, 0xc0, 0x92, 0x7e, 0x4a, 0xf0,
+			0xee, 0x26, 0x96, 0x90, 0x2f, 0x95, 0xa2, 0x8f,
+			0xc3, 0x61, 0x32, 0xb9, 0x68, 0xa5, 0xad, 0xb8,
+			0xf7, 0xb8, 0xcc, 0x17, 0x83, 0x30, 0x3c, 0xa1,
+			0xc5, 0x68, 0x3e, 0x2a, 0xf7, 0x94, 0x01, 0xf7,
+			0x08, 0x26, 0x79, 0x36, 0xb4, 0x87, 0x5a, 0x39,
+			0xba, 0xf0, 0xf1, 0xc9, 0x5a, 0xa8, 0xa6, 0x4f,
+			0x6a, 0x71, 0x49, 0x21, 0x7c, 0xe0, 0x06, 0xea,
+			0x7c, 0x60, 0x3f, 0x32, 0xa9, 0xee, 0x5e, 0x31,
+			0xa5, 0xd2, 0xb2, 0x47, 0xf6, 0x20, 0xae, 0x08,
+			0x05, 0xd1, 0xd8, 0xd4, 0x46, 0xa3, 0xe0, 0x22,
+			0x17, 0x77, 0x45, 0xbc, 0x13, 0xef, 0x18, 0xff,
+			0xf6, 0xcb, 0xcd, 0x0b, 0xbf, 0xa1, 0xcc, 0x78,
+			0x88, 0x34, 0x7e, 0xbe, 0x6f, 0xb6, 0x5d, 0x32,
+			0x33, 0x63, 0x10, 0x52, 0x28, 0x78, 0xb5, 0xbe,
+			0xbb, 0x68, 0x9c, 0x86, 0x65, 0xb7, 0xe3, 0x2c,
+			0xff, 0x20, 0x74, 0x67, 0x32, 0x22, 0xe0, 0x66,
+			0x54, 0xeb, 0x46, 0x2f, 0xa0, 0x99, 0x41, 0xf1,
+			0xe4, 0x7b, 0x97, 0xe4, 0xf6, 0xd8, 0x2c, 0x57,
+			0x74, 0x6c, 0x49, 0x24, 0x6a, 0x69, 0xf4, 0x63,
+			0x15, 0x1b, 0xbf, 0xd7, 0xa1, 0x09, 0x82, 0xcc,
+			0xdb, 0xaa, 0xa6, 0x81, 0x59, 0x59, 0x35, 0x23,
+			0x6c, 0x2a, 0x9a, 0xa0, 0x8a, 0xa4, 0xfb, 0x59,
+			0x12, 0x6b, 0xe0, 0xd0, 0x9b, 0x4d, 0x1b, 0xdd,
+			0x96, 0x64, 0x53, 0x48, 0x2a, 0x52, 0xff, 0x85,
+			0xc9, 0xa2, 0x34, 0xd1, 0x9f, 0xcc, 0xa2, 0xdc,
+			0xc5, 0x6d, 0x3d, 0x24, 0x66, 0x87, 0x8e, 0x31,
+			0x2e, 0xaa, 0x8f, 0xd2, 0x39, 0xd3, 0xf0, 0x5a,
+			0xa2, 0x53, 0xaa, 0x26, 0x27, 0xe6, 0xd9, 0xf2,
+			0x7b, 0x45, 0x8b, 0x57, 0x83, 0xc7, 0xac, 0xff,
+			0x63, 0x95, 0xaa, 0x91, 0xf6, 0x7f, 0xe8, 0xf0,
+			0xe8, 0xcf, 0x06, 0x6b, 0x70, 0xe5, 0x64, 0x16,
+			0x93, 0x64, 0x70, 0x61, 0x1b, 0x1d, 0x5b, 0xfd,
+			0x3b, 0x8f, 0xbd, 0x3a, 0x99, 0x31, 0xdf, 0x59,
+			0x4e, 0xda, 0xe2, 0x00, 0x82, 0x0c, 0x31, 0xb5,
+			0xdb, 0xf4, 0x1a, 0xc9, 0x88, 0x04, 0x94, 0x0b,
+			0xe7, 0xad, 0xe5, 0xaf, 0x68, 0xa8, 0x92, 0xe0,
+			0x9a, 0x57, 0xd3, 0xb5, 0xc6, 0xa4, 0x57, 0x30,
+			0xcf, 0x5f, 0xcb, 0xbc, 0x3f, 0x42, 0x21, 0x07,
+			0x4b, 0xe2, 0x73, 0x03, 0x98, 0xdd, 0xfc, 0x6c,
+			0x81, 0x3b, 0x26, 0x0c, 0x32, 0x68, 0x25, 0xe9,
+			0x91, 0xc1, 0xd1, 0xe2, 0x9f, 0xe7, 0x8a, 0xde,
+			0x8c, 0xab, 0x08, 0xd0, 0x2c, 0x97, 0x86, 0xe4,
+			0xa0, 0xe5, 0xff, 0x0a, 0x8e, 0x9f, 0x62, 0xd4,
+			0x21, 0x5b, 0xc6, 0x27, 0xcf, 0x18, 0xcb, 0xef,
+			0x10, 0xb7, 0xcd, 0x56, 0x9b, 0xbe, 0x2d, 0x02,
+			0x56, 0x3e, 0x19, 0xe0, 0x43, 0xd7, 0x2e, 0xd6,
+			0x19, 0xdf, 0xb6, 0xe9, 0x17, 0x9f, 0x0c, 0x29,
+			0x76, 0xef, 0x01, 0x68, 0xfd, 0xb4, 0x6a, 0x6a,
+			0x9a, 0x11, 0x22, 0x72, 0x7d, 0xef, 0xc4, 0x79,
+			0xc0, 0x8f, 0xc3, 0x83, 0xb9, 0x87, 0xee, 0x54,
+			0xff, 0x8f, 0x57, 0xb1, 0xaf, 0x1b, 0xfa, 0xfb,
+			0x2c, 0xdf, 0xc8, 0xda, 0x35, 0x77, 0x44, 0x29,
+			0x75, 0xd9, 0x08, 0x86, 0x9c, 0xa9, 0xca, 0x1d,
+			0x5d, 0x63, 0x73, 0x6f, 0xa7, 0xae, 0x94, 0x74,
+			0xc3, 0x23, 0x39, 0x49, 0xc6, 0x0b, 0x49, 0xe3,
+			0x40, 0xd2, 0x36, 0x1a, 0x12, 0x83, 0x81, 0x29,
+			0xf5, 0x80, 0xdb, 0xf1, 0x4a, 0x31, 0xee, 0x40,
+			0x8c, 0x89, 0x4b, 0x26, 0x37, 0xef, 0xf3, 0x78,
+			0x9a, 0x7f, 0xe2, 0x00, 0xf4, 0x7c, 0x92, 0x01,
+			0x1a, 0xa0, 0x54, 0xbb, 0x63, 0x38, 0x58, 0xeb,
+			0xa9, 0xe4, 0x33, 0x06, 0xfe, 0xeb, 0x1f, 0x8c,
+			0x93, 0x28, 0xa4, 0x88, 0xe7, 0x7d, 0xd7, 0x88,
+			0x7a, 0xb5, 0xbd, 0xa2, 0xb6, 0x9d, 0x09, 0x87,
+			0xff, 0x6e, 0x9c, 0xca, 0x0e, 0x54, 0xe3, 0xad,
+			0x2d, 0x73, 0x53, 0x64, 0xc9, 0xe3, 0x3c, 0x98,
+			0x38, 0xe7, 0x00, 0x19, 0x26, 0x25, 0x98, 0x54,
+			0x37, 0x6c, 0xa5, 0xd1, 0x72, 0x85, 0x16, 0x70,
+			0x25, 0x48, 0x70, 0x8d, 0x05, 0xd1, 0x22, 0xc6,
+			0x1c, 0x4b, 0xdc, 0x3e, 0xeb, 0xb8, 0x1b, 0x61,
+			0x42, 0x25, 0x0a, 0xe3, 0x40, 0x98, 0x30, 0xa8,
+			0xf5, 0xba, 0x0a, 0x8b, 0x9c, 0x7f, 0xeb, 0xca,
+			0x30, 0xbc, 0x89, 0x32, 0xc5, 0xe4, 0x27, 0x2d,
+			0x13, 0x4a, 0x4f, 0xf7, 0x4c, 0xdf, 0x0f, 0x2b,
+			0x5d, 0x23, 0xc7, 0xd5, 0xaf, 0x32, 0x4b, 0x91,
+			0x24, 0x07, 0x6a, 0xff, 0x9b, 0xf3, 0xaa, 0x51,
+			0x52, 0x20, 0xca, 0x3c, 0xb3, 0x42, 0x9b, 0x9d,
+			0x87, 0xc7, 0xde, 0x19, 0x2a, 0xb8, 0x77, 0xb6,
+			0x2d, 0x13, 0xac, 0xaa, 0xfa, 0x0c, 0xe2, 0x0c,
+			0x1e, 0x17, 0x42, 0xbb, 0xd3, 0xda, 0x12, 0x41,
+			0x99, 0xf5, 0x0c, 0xc6, 0x6e, 0x2a, 0xdc, 0xe3,
+			0xf1, 0xf8, 0x9d, 0xb3, 0x0e, 0xa7, 0xb1, 0xf9,
+			0x6e, 0xeb, 0xfa, 0xc6, 0x3d, 0xa8, 0xa9, 0x97,
+			0x8a, 0x32, 0x70, 0x94, 0xab, 0xe9, 0x2f, 0x97,
+			0xbc, 0x76, 0x3b, 0x31, 0x2b, 0xb2, 0x85, 0x8f,
+			0xa2, 0x19, 0xd2, 0x40, 0x16, 0x14, 0x30, 0xc5,
+			0x30, 0x37, 0x7b, 0x28, 0x3f, 0xc9, 0x32, 0x4c,
+			0x21, 0xa4, 0x01, 0x21, 0x37, 0x5d, 0x51, 0x80,
+			0xe6, 0xd1, 0x33, 0xc3, 0x30, 0xd9, 0x37, 0x3f,
+			0x33, 0x73, 0x2e, 0x2e, 0x2a, 0x53, 0xd7, 0x02,
+			0x67, 0xe7, 0xf7, 0xaa, 0x28, 0x3a, 0xb2, 0x0c,
+			0xbe, 0x1c, 0xd5, 0x8d, 0x7d, 0x87, 0x66, 0xf6,
+			0x5c, 0x43, 0x97, 0xba, 0x52, 0x0e, 0xed, 0xcf,
+			0x8c, 0x72, 0xd1, 0x1d, 0xdb, 0x6b, 0x66, 0x85,
+			0x3d, 0x96, 0xa0, 0x1e, 0xdb, 0xb4, 0x6b, 0xfc,
+			0x6f, 0x14, 0xaf, 0xff, 0x08, 0x30, 0xb3, 0xe0,
+			0xdc, 0xe5, 0x1c, 0x1b, 0xf2, 0x3a, 0xa5, 0xf8,
+			0xb4, 0x8d, 0x55, 0xa3, 0x08, 0xdd, 0xfc, 0xc5,
+			0x05, 0x54, 0xbc, 0x26, 0x00, 0x98, 0x1b, 0xe5,
+			0xa0, 0xee, 0xbf, 0xf5, 0x00, 0xd1, 0x03, 0x5d,
+			0xed, 0x3b, 0xc8, 0xc2, 0xf3, 0x3a, 0x8c, 0x04,
+			0x0f, 0x9a, 0x76, 0xc9, 0xf6, 0x59, 0x69, 0x04,
+			0x0e, 0x50, 0x59, 0x40, 0x32, 0xcb, 0x30, 0xd4,
+			0x79, 0xbf, 0x52, 0x0e, 0xf2, 0xe6, 0xdf, 0x97,
+			0x1f, 0x08, 0x01, 0xb0, 0xbb, 0x34, 0x8f, 0xa6,
+			0x1c, 0x50, 0x31, 0x4f, 0xbf, 0xf8, 0x9f, 0x3c,
+			0x75, 0xb0, 0xe3, 0x0a, 0x4d, 0xc5, 0x80, 0x21,
+			0x96, 0x58, 0x93, 0xd8, 0x92, 0xf5, 0xe1, 0xd7,
+			0x55, 0x69, 0xe0, 0xfb, 0x40, 0xab, 0x03, 0x2b,
+			0xbb, 0xdb, 0x6c, 0xa8, 0xe1, 0x73, 0x45, 0xaf,
+			0x8c, 0x98, 0x44, 0xf1, 0xfd, 0x7c, 0x60, 0xde,
+			0xad, 0x27, 0xa1, 0x04, 0x6b, 0x5f, 0x65, 0x02,
+			0x52, 0x2f, 0x55, 0x27, 0x68, 0x64, 0x2d, 0xd8,
+			0xc6, 0xc9, 0x0a, 0xf5, 0xb7, 0x7b, 0xd6, 0xbd,
+			0xcc, 0x6d, 0x2d, 0x2c, 0x97, 0xbc, 0x0e, 0x67,
+			0xfb, 0xfd, 0x61, 0x4d, 0xe6, 0x4f, 0x05, 0x12,
+			0xdd, 0xd5, 0xf8, 0xa5, 0x77, 0x44, 0x2a, 0xef,
+			0x6e, 0xd9, 0x53, 0x85, 0x62, 0xee, 0xb5, 0x88,
+			0xd6, 0x4c, 0xfb, 0x67, 0x34, 0x45, 0x71, 0x3b,
+			0x6d, 0x20, 0x96, 0xd7, 0x1a, 0xbc, 0x4b, 0x4c,
+			0xac, 0x96, 0x8b, 0x38, 0x22, 0x45, 0x29, 0xb1,
+			0x02, 0x3d, 0x77, 0x93, 0x98, 0x0b, 0xf9, 0x97,
+			0x7d, 0x2f, 0xe3, 0x80, 0xbc, 0x05, 0x9b, 0x15,
+			0xd2, 0x26, 0xe2, 0xd7, 0x42, 0x16, 0x03, 0x38,
+			0xaf, 0xb1, 0x98, 0x26, 0xfd, 0x14, 0x39, 0xb1,
+			0xa2, 0x1c, 0x0e, 0xe9, 0x58, 0xe2, 0xdd, 0x10,
+			0x33, 0x5c, 0x2b, 0xb2, 0x04, 0x83, 0xe1, 0x19,
+			0x0a, 0xb4, 0x53, 0x22, 0xd9, 0x5f, 0x20, 0x3d,
+			0x56, 0x53, 0x8c, 0x1e, 0xcb, 0xbe, 0x37, 0xce,
+			0x8f, 0x6e, 0x33, 0x7a, 0xc4, 0x5b, 0x05, 0x69,
+			0xb2, 0xbb, 0x81, 0x15, 0xd7, 0xd3, 0x7e, 0x63,
+			0x03, 0x98, 0x49, 0x9e, 0x2e, 0xcf, 0x98, 0x1c,
+			0x1f, 0xf2, 0xe2, 0xe6, 0x40, 0x6a, 0x97, 0xb8,
+			0x1e, 0xe3, 0xfa, 0xab, 0xee, 0x19, 0x8c, 0x3f,
+			0xfa, 0xfd, 0xfb, 0x2d, 0x86, 0xca, 0xdd, 0xf9,
+			0x8c, 0xf3, 0xec, 0x6b, 0x35, 0x39, 0x1f, 0x8b,
+			0xbb, 0xb7, 0xb3, 0x79, 0x25, 0x6f, 0xc2, 0xe9,
+			0xc3, 0xb8, 0x3d, 0xdd, 0x5b, 0x09, 0x82, 0x1e,
+			0x15, 0x59, 0xaa, 0x9a, 0xad, 0xbb, 0xbe, 0x5d,
+			0xa4, 0xc0, 0x72, 0x4e, 0x21, 0x83, 0x2c, 0x5b,
+			0x63, 0xf0, 0xe2, 0xe3, 0xa8, 0x6b, 0x0e, 0x72,
+			0x5e, 0xc1, 0x4e, 0x11, 0x50, 0xe6, 0xb9, 0xe1,
+			0x90, 0xef, 0xda, 0x2e, 0x4e, 0x44, 0x44, 0x27,
+			0x40, 0xfa, 0x99, 0x88, 0x1b, 0xb6, 0x50, 0x3d,
+			0xc2, 0xc1, 0xf0, 0x97, 0xdf, 0x93, 0x1f, 0x56,
+			0x0b, 0x5f, 0xd2, 0x11, 0xcb, 0x30, 0x97, 0x4b,
+			0x6d, 0xbc, 0xed, 0x70, 0xff, 0x26, 0x03, 0xb1,
+			0xbb, 0xd8, 0xb6, 0xbe, 0x04, 0xd7, 0x6a, 0x38,
+			0xe6, 0xa9, 0xf4, 0x6f, 0xa5, 0x8a, 0xf1, 0xdc,
+			0x9d, 0xae, 0xc5, 0x3d, 0x05, 0x7b, 0xdb, 0xc6,
+			0xc6, 0x62, 0xf1, 0xbf, 0x7e, 0xae, 0x4f, 0x2d,
+			0x83, 0xad, 0x6f, 0x57, 0xa3, 0xc1, 0x36, 0x9f,
+			0x02, 0x9c, 0xca, 0x2f, 0xa4, 0x44, 0x71, 0xf6,
+			0xd0, 0xd5, 0x7b, 0xcd, 0x70, 0x62, 0xe4, 0x31,
+			0x0d, 0xf0, 0x42, 0x99, 0x09, 0x46, 0xa2, 0xf8,
+			0x15, 0x45, 0xc0, 0xb4, 0x7f, 0xff, 0x1a, 0x4b,
+			0xba, 0x1d, 0x25, 0x05, 0x50, 0x97, 0x5f, 0x52,
+			0x40, 0x54, 0xda, 0x25, 0xfd, 0x86, 0x5a, 0xfe,
+			0x54, 0xf6, 0x5c, 0xf6, 0x9d, 0x7c, 0xb7, 0xb6,
+			0x50, 0x76, 0x8d, 0x01, 0x4c, 0x12, 0x93, 0x6f,
+			0x24, 0xd0, 0x58, 0xe4, 0x69, 0x93, 0x3f, 0x4a,
+			0x0d, 0x5a, 0x8e, 0x12, 0x0f, 0x31, 0x8a, 0xa1,
+			0x29, 0xb8, 0x7a, 0x54, 0xb4, 0x32, 0x62, 0x09,
+			0xda, 0x6f, 0x1e, 0x8e, 0x5c, 0xb2, 0x5c, 0x63,
+			0x4e, 0xd4, 0x79, 0x18, 0x6a, 0x22, 0x46, 0x8a,
+			0x1e, 0xfd, 0x63, 0x38, 0x01, 0x72, 0xd4, 0x0f,
+			0x87, 0x73, 0x37, 0x92, 0xeb, 0x05, 0x5d, 0x6a,
+			0xc3, 0x53, 0x27, 0x83, 0x63, 0x4d, 0xce, 0x60,
+			0x79, 0x5a, 0x5a, 0x29, 0x93, 0x22, 0x79, 0xf1,
+			0x8c, 0xd6, 0x78, 0xd9, 0x3c, 0x34, 0xf1, 0x0c,
+			0x43, 0x1f, 0x72, 0xcd, 0x44, 0x8d, 0xc4, 0xc7,
+			0xde, 0x55, 0x5c, 0x0d, 0x0b, 0x4e, 0xe8, 0x2b,
+			0xb3, 0x94, 0x44, 0x6f, 0x6d, 0x34, 0xb2, 0x3d,
+			0x80, 0x49, 0x19, 0xb5, 0x7c, 0x32, 0xe5, 0xee,
+			0x57, 0x8e, 0x39, 0x87, 0xe5, 0x40, 0x35, 0xbb,
+			0xa9, 0xeb, 0xe2, 0xce, 0x50, 0x5b, 0x8e, 0xdf,
+			0x32, 0xb2, 0xd0, 0x06, 0x40, 0xd7, 0x42, 0x5d,
+			0x96, 0x58, 0x7b, 0x07, 0x4d, 0x54, 0x37, 0x33,
+			0x39, 0x3a, 0xde, 0xf8, 0xf2, 0xd2, 0x26, 0x6f,
+			0xea, 0x77, 0xdc, 0xca, 0xde, 0xc0, 0x51, 0x91,
+			0x4e, 0x76, 0x44, 0x87, 0xe1, 0x71, 0xf9, 0x64,
+			0x61, 0x9b, 0x64, 0x89, 0xd2, 0xf2, 0x77, 0xf3,
+			0x7e, 0xc4, 0x93, 0xaf, 0xe4, 0xf4, 0x5c, 0x54,
+			0x84, 0xe9, 0x70, 0xf8, 0x18, 0xeb, 0xf5, 0x5c,
+			0x72, 0xec, 0xa0, 0x20, 0x0b, 0x46, 0x2d, 0x84,
+			0xc7, 0xdc, 0xd7, 0x1e, 0x35, 0x9e, 0x99, 0x14,
+			0xdb, 0x65, 0x24, 0x42, 0x00, 0xc6, 0x2a, 0x92,
+			0x08, 0xe1, 0x21, 0x3e, 0x63, 0x6f, 0x21, 0x07,
+			0xec, 0x7d, 0xf0, 0xed, 0xa0, 0x78, 0x2d, 0xae,
+			0xb7, 0x58, 0x86, 0xbb, 0x07, 0x35, 0x19, 0x6e,
+			0x1f, 0x3e, 0x2b, 0x0e, 0x3a, 0x57, 0x2f, 0xce,
+			0xbc, 0x6a, 0xf9, 0x10, 0x57, 0x8b, 0x94, 0x67,
+			0x22, 0x99, 0xc9, 0x3d, 0x86, 0x4b, 0x77, 0xf9,
+			0x73, 0x16, 0x2b, 0x57, 0xad, 0x21, 0xe2, 0x0b,
+			0x68, 0xc6, 0x3d, 0x2e, 0xd2, 0x3b, 0x65, 0xbd,
+			0x8f, 0xf9, 0xfa, 0xe7, 0x0c, 0x0c, 0xbd, 0xd5,
+			0x89, 0x5e, 0x7d, 0xe0, 0x34, 0xee, 0xe7, 0x9e,
+			0x11, 0x04, 0x62, 0x52, 0x07, 0xb9, 0x82, 0x03,
+			0x88, 0x87, 0xbb, 0x9f, 0x0f, 0x89, 0x27, 0xa8,
+			0x07, 0x1d, 0x51, 0x38, 0xc4, 0x09, 0x24, 0xbe,
+			0xf8, 0xed, 0xcc, 0x5e, 0x4e, 0xee, 0x0b, 0x22,
+			0xe0, 0x21, 0xfe, 0xd0, 0x56, 0xab, 0x58, 0x0f,
+			0xc5, 0x23, 0xa4, 0x6e, 0xae, 0x85, 0x4c, 0x29,
+			0x2b, 0x10, 0x22, 0xed, 0x6d, 0x44, 0x84, 0xd1,
+			0xb8, 0x29, 0x44, 0xaf, 0x3d, 0x83, 0xfb, 0x1d,
+			0x82, 0x86, 0x5f, 0x3b, 0xd9, 0x7c, 0x97, 0xf7,
+			0x48, 0x9f, 0x26, 0x89, 0x8d, 0xc5, 0xc8, 0x1a,
+			0x16, 0xcd, 0xde, 0xe9, 0xd0, 0xdc, 0x0a, 0xcf,
+			0x54, 0x1c, 0x66, 0xd7, 0x32, 0x94, 0xa3, 0x9e,
+			0x94, 0x91, 0xa9, 0x00, 0xa2, 0xb1, 0xcc, 0x8f,
+			0xa8, 0x53, 0x04, 0x60, 0x6f, 0x47, 0x64, 0xb6,
+			0xad, 0xd4, 0x62, 0x80, 0xd5, 0x1e, 0x74, 0x5c,
+			0x1d, 0xe1, 0x16, 0xcc, 0x0a, 0x93, 0xb4, 0x0e,
+			0xd8, 0xe8, 0xa8, 0xda, 0x18, 0x8b, 0x4b, 0x42,
+			0x3a, 0x8f, 0xbc, 0xef, 0x05, 0x31, 0x52, 0xb0,
+			0xb1, 0x50, 0x4b, 0x57, 0x27, 0x8a, 0x35, 0x05,
+			0x45, 0xf3, 0x45, 0x2c, 0x1e, 0x5b, 0x4a, 0xe8,
+			0x13, 0xcd, 0x04, 0x20, 0x9b, 0x34, 0xaf, 0x93,
+			0xee, 0x89, 0xea, 0x61, 0xff, 0x39, 0x70, 0x92,
+			0x21, 0x83, 0x04, 0xb1, 0x46, 0xf5, 0x3d, 0xf0,
+			0x3b, 0x17, 0xb4, 0x92, 0xce, 0x2f, 0x87, 0x5f,
+			0x9a, 0x80, 0x50, 0x98, 0xb1, 0x17, 0xed, 0x83,
+			0xd5, 0x40, 0x5e, 0xd4, 0xd4, 0x94, 0x60, 0xb2,
+			0xfc, 0x8b, 0x44, 0x80, 0xfe, 0xf5, 0x1f, 0xdb,
+			0x4c, 0x3c, 0x13, 0xce, 0x22, 0xe3, 0x84, 0x4c,
+			0x9c, 0xfe, 0x63, 0x80, 0xf2, 0xe7, 0xab, 0x7d,
+			0xa7, 0x5b, 0x41, 0xa2, 0x70, 0x4a, 0x93, 0x40,
+			0xb3, 0x0c, 0xdb, 0x59, 0x48, 0xe5, 0xc8, 0x50,
+			0x38, 0xc0, 0x51, 0xb6, 0x0f, 0x72, 0x1a, 0x03,
+			0x8c, 0x95, 0x5f, 0x6e, 0x36, 0x07, 0xfd, 0x06,
+			0x19, 0x36, 0x23, 0x20, 0xb7, 0x9c, 0x74, 0x37,
+			0xaa, 0x1d, 0x90, 0x70, 0xb9, 0xbd, 0x65, 0xdd,
+			0x41, 0x40, 0x73, 0x19, 0x9c, 0x26, 0x08, 0xfe,
+			0xc5, 0x55, 0x40, 0x66, 0xd2, 0x99, 0x2f, 0xfe,
+			0xf9, 0x8d, 0xdb, 0xe7, 0xe9, 0x18, 0xb4, 0x02,
+			0x50, 0x75, 0xfd, 0xac, 0x7a, 0xa8, 0x4d, 0xf7,
+			0x1d, 0x60, 0x17, 0xc9, 0xef, 0xa9, 0x12, 0x48,
+			0x25, 0xa7, 0x8c, 0x43, 0xe1, 0xa6, 0xda, 0xc9,
+			0xbd, 0x91, 0x27, 0xc7, 0xb8, 0x53, 0x4b, 0x9a,
+			0xfb, 0xe8, 0x8b, 0x61, 0x00, 0xd4, 0x61, 0x53,
+			0x36, 0xce, 0x42, 0xae, 0x07, 0x59, 0x71, 0x6e,
+			0x61, 0x39, 0x85, 0x96, 0x3f, 0x0d, 0x38, 0x35,
+			0x0d, 0xf9, 0xf3, 0x49, 0xf5, 0x9d, 0xca, 0x18,
+			0x58, 0xf1, 0xd1, 0x9a, 0xb4, 0x44, 0x87, 0x3e,
+			0xd1, 0x31, 0x52, 0x9d, 0x47, 0xbc, 0xce, 0xc1,
+			0x3d, 0x9f, 0xce, 0xc1, 0xcb, 0xf5, 0x9f, 0x49,
+			0x80, 0xa6, 0x3a, 0xce, 0x17, 0x27, 0xbf, 0x68,
+			0x03, 0xda, 0xee, 0xce, 0xa4, 0x2c, 0x91, 0xae,
+			0xf9, 0xd7, 0x3c, 0xb9, 0x4f, 0x10, 0xf8, 0x6e,
+			0x9f, 0x6b, 0x69, 0x2d, 0xb6, 0x92, 0x8c, 0xca,
+			0x26, 0x28, 0xe7, 0xd3, 0x7d, 0x39, 0xed, 0x0e,
+			0x54, 0x7a, 0x01, 0x51, 0xa1, 0xb1, 0x00, 0x54,
+			0x35, 0xe7, 0x23, 0xef, 0x0a, 0x4f, 0x6a, 0x53,
+			0x5a, 0xe7, 0xa3, 0x20, 0xea, 0x88, 0x38, 0x1a,
+			0x0e, 0x82, 0x75, 0xad, 0x43, 0x19, 0x02, 0x29,
+			0x6d, 0x4c, 0x89, 0x00, 0xa4, 0x11, 0x15, 0xc2,
+			0x68, 0xb7, 0xd7, 0x62, 0xfc, 0x26, 0x02, 0xa3,
+			0xe2, 0x0d, 0xad, 0x4c, 0xee, 0x79, 0x57, 0xf2,
+			0xb9, 0xbb, 0x4d, 0x7e, 0x0b, 0x03, 0xb3, 0x51,
+			0x35, 0xaa, 0x3c, 0xed, 0x89, 0xa9, 0x23, 0x7b,
+			0x31, 0x2c, 0xee, 0xbd, 0xdc, 0x5c, 0x47, 0xe8,
+			0x40, 0xfd, 0x77, 0x3a, 0x34, 0x09, 0xc0, 0xa5,
+			0x4c, 0xa2, 0x7d, 0x72, 0xa8, 0x93, 0x5a, 0xda,
+			0xf7, 0xb8, 0x8a, 0xde, 0xc7, 0x6e, 0x12, 0x9d,
+			0xd5, 0x3e, 0x8e, 0x1b, 0xf3, 0xcc, 0x65, 0x9c,
+			0x6d, 0x47, 0xf7, 0xeb, 0xa3, 0xc8, 0x64, 0x7e,
+			0xc2, 0xdb, 0xb3, 0xbd, 0xfd, 0xd8, 0x75, 0x02,
+			0xf4, 0x83, 0xa1, 0xa4, 0xc9, 0xda, 0x88, 0xa9,
+			0x71, 0x82, 0x2b, 0x84, 0xfd, 0x31, 0xd6, 0xca,
+			0x40, 0x2c, 0x5b, 0xf0, 0x42, 0xa0, 0x60, 0xf1,
+			0x03, 0x9b, 0xeb, 0x06, 0x5d, 0xdb, 0x4b, 0xb3,
+			0x41, 0x25, 0x7e, 0x9c, 0x3e, 0xd9, 0x24, 0x9b,
+			0x15, 0x7b, 0x60, 0x80, 0x17, 0x7c, 0x49, 0xbf,
+			0xca, 0xea, 0x92, 0xc7, 0xf3, 0x04, 0xa7, 0x21,
+			0x4a, 0xa0, 0x26, 0xe6, 0x65, 0x35, 0xb7, 0xfc,
+			0x9c, 0xf8, 0x36, 0x47, 0x44, 0xde, 0xb6, 0x3d,
+			0x01, 0xe9, 0x21, 0xd4, 0xf9, 0xf5, 0x9b, 0x2e,
+			0xdd, 0x9b, 0xbd, 0x33, 0x40, 0x03, 0xec, 0x7a,
+			0x25, 0x76, 0x1f, 0x7e, 0xfe, 0x8f, 0x2a, 0xe1,
+			0x91, 0x28, 0x02, 0x4b, 0x48, 0xdc, 0x6a, 0xaf,
+			0x2d, 0xe7, 0xe6, 0xd1, 0x50, 0x8e, 0xf8, 0xa9,
+			0x72, 0x88, 0xb8, 0x12, 0x38, 0xf3, 0xef, 0x44,
+			0xd8, 0x9b, 0x7d, 0x33, 0x60, 0xaa, 0x71, 0x0f,
+			0x3a, 0xbb, 0xb0, 0x6f, 0xd3, 0xc4, 0xcb, 0x31,
+			0xf1, 0xe2, 0xec, 0x1a, 0x82, 0xd4, 0xf8, 0x1b,
+			0x40, 0x05, 0xc3, 0x52, 0x1f, 0x59, 0xf2, 0x05,
+			0xb0, 0xc3, 0xe1, 0x4c, 0xb8, 0xd2, 0xf1, 0xe6,
+			0x42, 0x6f, 0xce, 0x80, 0xa9, 0xb9, 0x9f, 0xc2,
+			0x18, 0xc8, 0xbc, 0xd6, 0xa1, 0xa0, 0x70, 0xc2,
+			0xf0, 0x41, 0xdd, 0x8b, 0xb9, 0xb4, 0x46, 0xbc,
+			0x92, 0x8e, 0xc2, 0x95, 0x3f, 0x3b, 0x50, 0xfb,
+			0x13, 0x8a, 0xa6, 0x83, 0x0f, 0x95, 0x8b, 0xf3,
+			0x72, 0xa0, 0xfa, 0xf4, 0x4a, 0x3d, 0x5a, 0xdc,
+			0x05, 0xa9, 0xd8, 0xa6, 0xa5, 0xda, 0xbd, 0x6b,
+			0x0b, 0x86, 0x3f, 0xcc, 0x60, 0xfd, 0x8c, 0xa9,
+			0xaf, 0x58, 0xb1, 0xc4, 0xb0, 0x84, 0xfc, 0xbb,
+			0xd1, 0xa4, 0x60, 0xfb, 0xb8, 0xff, 0x3e, 0xdf,
+			0x55, 0x58, 0xb0, 0x69, 0x5f, 0xa1, 0x8b, 0x4e,
+			0xe0, 0x00, 0xec, 0xb4, 0x6e, 0x09, 0xfe, 0xa2,
+			0x75, 0x60, 0x3b, 0x0e, 0x34, 0x8d, 0x13, 0xb0,
+			0x13, 0xe1, 0xcd, 0x4d, 0x06, 0xc3, 0x23, 0xca,
+			0xf6, 0x3e, 0x3e, 0x4f, 0xc5, 0x44, 0xcd, 0x01,
+			0x3a, 0x86, 0x30, 0xba, 0xa0, 0x99, 0xd3, 0x8a,
+			0xa9, 0xe6, 0x49, 0x5a, 0x94, 0xf4, 0xc2, 0xec,
+			0xa3, 0xb2, 0x68, 0xbf, 0x40, 0xab, 0x93, 0xd2,
+			0x77, 0x66, 0x69, 0x25, 0x28, 0xa1, 0xf1, 0x20,
+			0x20, 0x57, 0x17, 0xe9, 0x3d, 0x3c, 0x61, 0xa8,
+			0xf0, 0x3f, 0x95, 0x64, 0x71, 0x9c, 0x20, 0xba,
+			0xae, 0x16, 0x8b, 0xb7, 0x7c, 0x92, 0x5c, 0x3e,
+			0xe9, 0xbb, 0xad, 0x08, 0x92, 0xa2, 0x29, 0xd1,
+			0x63, 0x31, 0x4d, 0x89, 0x79, 0xc9, 0x26, 0x48,
+			0xe6, 0xd4, 0x59, 0x62, 0x36, 0x99, 0xa3, 0xf5,
+			0xd9, 0x3b, 0x6c, 0x33, 0xf0, 0xe5, 0x0c, 0x92,
+			0x38, 0xbd, 0xce, 0x0b, 0xd5, 0x08, 0x60, 0xa4,
+			0x9d, 0x0e, 0x4c, 0xaf, 0xe1, 0xd5, 0x65, 0x04,
+			0xa4, 0x6f, 0xa7, 0xb4, 0x27, 0x55, 0xa0, 0x2f,
+			0x31, 0x19, 0xd7, 0xb1, 0x85, 0x16, 0xef, 0x37,
+			0x62, 0xa7, 0x2c, 0xd0, 0xcd, 0x48, 0x39, 0x78,
+			0xb1, 0xf1, 0x14, 0xaf, 0x7e, 0x37, 0xdc, 0x4d,
+			0xd8, 0x6e, 0xa9, 0x3a, 0xab, 0x23, 0x96, 0xe3,
+			0x68, 0xae, 0xf4, 0x4c, 0x79, 0x5f, 0x06, 0xb5,
+			0x14, 0x56, 0x0d, 0xc7, 0xb7, 0xda, 0x4b, 0x53,
+			0x43, 0xed, 0xc7, 0x78, 0x16, 0xfa, 0x35, 0x69,
+			0xf3, 0x92, 0x59, 0x07, 0x47, 0x4b, 0x41, 0x66,
+			0x0a, 0x21, 0x26, 0xad, 0x6f, 0x9f, 0x06, 0x66,
+			0x44, 0x05, 0xbb, 0x2f, 0x04, 0x63, 0x9b, 0x8b,
+			0x62, 0xbb, 0x94, 0x7b, 0x14, 0x70, 0x93, 0xd9,
+			0xf9, 0xfe, 0xa0, 0x86, 0xdf, 0x53, 0xff, 0x57,
+			0x6e, 0x10, 0x47, 0x48, 0x9b, 0x69, 0x25, 0x97,
+			0x0e, 0xcb, 0x07, 0xf0, 0xd7, 0x75, 0xd5, 0xa7,
+			0x39, 0xa9, 0xbb, 0xe1, 0x16, 0x5d, 0x88, 0x49,
+			0x3d, 0xbe, 0xa7, 0x06, 0xf8, 0x90, 0xa3, 0x49,
+			0x81, 0x48, 0x66, 0x6b, 0xa2, 0xea, 0xe0, 0xa8,
+			0x4b, 0xde, 0xce, 0x2a, 0x5f, 0x41, 0x97, 0xb7,
+			0x12, 0x1f, 0xf5, 0x16, 0x2e, 0x44, 0x89, 0x87,
+			0x12, 0xd4, 0x7b, 0x8c, 0x22, 0xb7, 0x38, 0xfd,
+			0xc3, 0xa4, 0xdb, 0x45, 0xbc, 0x27, 0xab, 0xa1,
+			0xeb, 0xcc, 0xd1, 0x38, 0xfa, 0x1c, 0x4a, 0x66,
+			0xb6, 0x9d, 0x42, 0x45, 0x65, 0x99, 0x7c, 0xa7,
+			0x94, 0x4d, 0xfc, 0x72, 0x10, 0x72, 0x2c, 0xd0,
+			0x5c, 0xf5, 0xfc, 0x80, 0xbc, 0x14, 0xe4, 0xdc,
+			0x6c, 0x31, 0xe7, 0x6f, 0x3a, 0x43, 0xb4, 0x02,
+			0x0a, 0xb2, 0xf2, 0xec, 0xab, 0x0d, 0x54, 0x78,
+			0x45, 0x5e, 0x82, 0x1c, 0x30, 0x9a, 0x8b, 0xeb,
+			0x55, 0x52, 0x1f, 0x2f, 0x4b, 0x38, 0xe2, 0xd7,
+			0x67, 0x02, 0x3e, 0x42, 0xd3, 0xbe, 0xed, 0x8c,
+			0xf0, 0x65, 0x5a, 0x4d, 0x1d, 0xef, 0xac, 0x5a,
+			0x5a, 0x9c, 0xa4, 0x60, 0xc3, 0x9b, 0x3a, 0x20,
+			0x4c, 0x54, 0x1a, 0x83, 0x6f, 0x8b, 0x4b, 0x95,
+			0x58, 0x53, 0x78, 0x0d, 0x64, 0xb7, 0x2d, 0xf0,
+			0x23, 0xfc, 0xe8, 0x32, 0x49, 0xd8, 0x31, 0xb1,
+			0x9f, 0xf7, 0xe6, 0x21, 0x55, 0xa9, 0x4a, 0x0f,
+			0xe2, 0x64, 0xf0, 0x75, 0x38, 0x2f, 0xa4, 0xed,
+			0x34, 0xd5, 0xc1, 0xc6, 0xa2, 0xfb, 0x3a, 0xd4,
+			0x5c, 0x6c, 0x25, 0x7f, 0xc0, 0x11, 0x19, 0x79,
+			0x8c, 0xe4, 0x38, 0x8c, 0x54, 0x3d, 0xbf, 0xcf,
+			0x28, 0x78, 0x46, 0xea, 0x0e, 0x51, 0xde, 0x3a,
+			0xfd, 0xad, 0xf2, 0x63, 0x12, 0x32, 0x0f, 0x83,
+			0x0b, 0x0b, 0x0f, 0x6c, 0x5f, 0xe2, 0x36, 0xf3,
+			0x65, 0xe8, 0x17, 0x44, 0x53, 0x5d, 0x17, 0x9d,
+			0x9d, 0xc3, 0xbd, 0x53, 0x48, 0xe0, 0x0d, 0x49,
+			0x23, 0x82, 0xbd, 0x1f, 0x0f, 0x0e, 0x0f, 0x08,
+			0xbb, 0x8d, 0x53, 0xc6, 0x28, 0xd1, 0x1d, 0xe2,
+			0xa1, 0xfc, 0x55, 0xb2, 0x66, 0x23, 0x1e, 0x10,
+			0x39, 0x15, 0xa7, 0x7d, 0xd7, 0xc8, 0x47, 0x50,
+			0x9a, 0x95, 0x25, 0x39, 0x77, 0x5d, 0x13, 0xa9,
+			0x50, 0x64, 0x2b, 0xb9, 0x9a, 0xea, 0xb5, 0x05,
+			0xa4, 0xaa, 0x1a, 0xfa, 0x70, 0x9e, 0x32, 0x0d,
+			0x4a, 0xed, 0xd4, 0xea, 0x46, 0x62, 0x31, 0xa9,
+			0x15, 0x89, 0x6f, 0x0a, 0xdc, 0x6a, 0x62, 0x5f,
+			0x04, 0x09, 0xb7, 0x0b, 0xc7, 0xbc, 0x7d, 0x71,
+			0x10, 0x29, 0x0c, 0x21, 0x2d, 0x77, 0x7e, 0x70,
+			0xb8, 0x83, 0x3b, 0x18, 0xa0, 0xfb, 0x51, 0x27,
+			0x0d, 0x98, 0x33, 0x0b, 0x9a, 0x5e, 0x00, 0x07,
+			0x4b, 0x8a, 0x29, 0x3e, 0x5c, 0xc9, 0xd1, 0x21,
+			0x26, 0xea, 0xa7, 0x99, 0xd6, 0xf3, 0xbe, 0x3f,
+			0xd6, 0x04, 0x80, 0x53, 0x6d, 0x1a, 0xbe, 0x41,
+			0xc4, 0xc1, 0xaf, 0x6a, 0x77, 0xe9, 0xa1, 0xa6,
+			0xae, 0x62, 0xf5, 0x52, 0xf5, 0x69, 0x7f, 0xdf,
+			0xc5, 0x51, 0xed, 0x45, 0x9a, 0x76, 0xf9, 0x68,
+			0x01, 0xdd, 0x72, 0x26, 0xe3, 0x08, 0xa7, 0x27,
+			0xa7, 0xa7, 0xcc, 0xdb, 0x9d, 0xd2, 0x37, 0x28,
+			0x79, 0xab, 0x0d, 0xa7, 0x22, 0xc9, 0x9a, 0xdd,
+			0x01, 0x66, 0x34, 0xf0, 0xd0, 0x4f, 0x1b, 0x6c,
+			0xd8, 0x47, 0x6d, 0x58, 0x26, 0x7a, 0x96, 0x63,
+			0xf0, 0x98, 0xef, 0xe8, 0xf3, 0x0f, 0x69, 0x71,
+			0x46, 0x79, 0xe2, 0xc1, 0xbf, 0x41, 0x46, 0x04,
+			0x26, 0x52, 0x19, 0x48, 0x35, 0x8d, 0x3e, 0xfd,
+			0xbe, 0x81, 0x22, 0x28, 0x66, 0x48, 0x08, 0x9a,
+			0x84, 0x9e, 0x2f, 0xdc, 0x05, 0xda, 0xa5, 0xb7,
+			0x87, 0xe2, 0xbc, 0xc3, 0x2f, 0x29, 0x60, 0x2b,
+			0xfb, 0x75, 0xdc, 0xfa, 0x36, 0xfd, 0xea, 0xa5,
+			0x81, 0xbb, 0x44, 0x93, 0x6f, 0xcb, 0x17, 0xc6,
+			0xbc, 0xe0, 0xf7, 0x73, 0xd7, 0x27, 0xdb, 0x78,
+			0xec, 0xe4, 0xec, 0xe1, 0xcb, 0xc6, 0xee, 0xc8,
+			0x6d, 0x99, 0xcd, 0xaf, 0x69, 0x5c, 0x4d, 0x8a,
+			0x5d, 0x0c, 0xa8, 0x02, 0xc2, 0xb7, 0x26, 0xe6,
+			0x59, 0x50, 0x1d, 0x3f, 0xa9, 0xae, 0xe2, 0xd7,
+			0x8d, 0x9e, 0xc3, 0x53, 0x5e, 0x65, 0xe9, 0xb0,
+			0xc4, 0x91, 0x81, 0xb8, 0xf0, 0x67, 0xbf, 0x78,
+			0xac, 0x12, 0x43, 0xa9, 0x03, 0xec, 0x33, 0x63,
+			0x66, 0x82, 0x67, 0x75, 0x30, 0x12, 0xe5, 0xd9,
+			0xac, 0x56, 0x0c, 0x9e, 0x39, 0x2e, 0x49, 0xa8,
+			0x3c, 0x4b, 0x59, 0x26, 0x12, 0xb1, 0x9d, 0xc1,
+			0xbd, 0xd3, 0xb2, 0xb2, 0x5e, 0x85, 0x03, 0xbd,
+			0xa2, 0x85, 0x21, 0x30, 0x8e, 0xe7, 0x5f, 0xc2,
+			0x8e, 0x2e, 0x17, 0x19, 0xb3, 0x95, 0x7b, 0x9d,
+			0x1d, 0x7e, 0x00, 0x8f, 0x2f, 0x87, 0x25, 0xb7,
+			0x4b, 0x7a, 0xac, 0x34, 0x62, 0x2a, 0x8c, 0xc3,
+			0x67, 0xdb, 0xf4, 0x6c, 0x19, 0xbb, 0x6d, 0x08,
+			0x63, 0x6c, 0xbd, 0x94, 0xcb, 0xc4, 0xdf, 0x4a,
+			0x68, 0x35, 0x9a, 0x1a, 0x1d, 0x9b, 0x55, 0x91,
+			0x97, 0x95, 0x75, 0x6a, 0x68, 0xe4, 0x58, 0x4c,
+			0x75, 0x2c, 0xcc, 0x6b, 0x1c, 0x21, 0x6e, 0xe2,
+			0x8b, 0x27, 0xae, 0xd8, 0xdc, 0x61, 0x64, 0xb0,
+			0xd4, 0xc7, 0xda, 0x5f, 0xd4, 0xef, 0x5d, 0x99,
+			0x2c, 0x42, 0x0c, 0x7d, 0x1a, 0xc5, 0x44, 0xfe,
+			0x7b, 0xb2, 0x14, 0xa3, 0xe4, 0xb4, 0xa6, 0x93,
+			0x71, 0x9f, 0x48, 0x1f, 0xdd, 0x59, 0xf8, 0xd1
+		},
+	}
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_TESTER_VECTORS_SHA2_192S_H */
@@ -0,0 +1,3823 @@
+/*
+ * Copyright (C) 2025, Stephan Mueller <smueller@chronox.de>
+ *
+ * License: see LICENSE file in root directory
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ALL OF
+ * WHICH ARE HEREBY DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF NOT ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ */
+
+#ifndef SPHINCS_TESTER_VECTORS_SHA2_256S_H
+#define SPHINCS_TESTER_VECTORS_SHA2_256S_H
+
+#include "fips_mode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lc_sphincs_test {
+	uint8_t seed[LC_SPX_SEEDBYTES];
+	uint8_t msg[33];
+	uint8_t pk[sizeof(struct lc_sphincs_pk)];
+	uint8_t sk[sizeof(struct lc_sphincs_sk)];
+	uint8_t sig[sizeof(struct lc_sphincs_sig)];
+};
+
+LC_FIPS_RODATA_SECTION
+static const struct lc_sphincs_test tests[] =
+{
+	{
+		.seed = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x92, 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0x45, 0x54, 0x2b, 0x7f, 0x6a, 0xf7, 0x78, 0x74,
+			0x2e, 0x0f, 0x44, 0x79, 0x17, 0x50, 0x84, 0xaa,
+			0x48, 0x8b, 0x3b, 0x74, 0x34, 0x06, 0x78, 0xaa
+		},
+		.msg = {
+			0xd8, 0x1c, 0x4d, 0x8d, 0x73, 0x4f, 0xcb, 0xfb,
+			0xea, 0xde, 0x3d, 0x3f, 0x8a, 0x03, 0x9f, 0xaa,
+			0x2a, 0x2c, 0x99, 0x57, 0xe8, 0x35, 0xad, 0x55,
+			0xb2, 0x2e, 0x75, 0xbf, 0x57, 0xbb, 0x55, 0x6a,
+			0xc8
+		},
+		.pk = {
+			FIPS140_MOD(0x3e), 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0x45, 0x54, 0x2b, 0x7f, 0x6a, 0xf7, 0x78, 0x74,
+			0x2e, 0x0f, 0x44, 0x79, 0x17, 0x50, 0x84, 0xaa,
+			0x48, 0x8b, 0x3b, 0x74, 0x34, 0x06, 0x78, 0xaa,
+			0x02, 0x6f, 0x56, 0x6c, 0xdc, 0xd2, 0x98, 0x7e,
+			0xb7, 0xab, 0x1e, 0xc7, 0x1e, 0x86, 0xb6, 0x17,
+			0xf9, 0x7b, 0x98, 0xef, 0x63, 0x90, 0x2e, 0x28,
+			0x3f, 0xb5, 0x24, 0x91, 0x19, 0xc6, 0xce, 0xb0
+		},
+		.sk = {
+			FIPS140_MOD(0x7c), 0x99, 0x35, 0xa0, 0xb0, 0x76, 0x94, 0xaa,
+			0x0c, 0x6d, 0x10, 0xe4, 0xdb, 0x6b, 0x1a, 0xdd,
+			0x2f, 0xd8, 0x1a, 0x25, 0xcc, 0xb1, 0x48, 0x03,
+			0x2d, 0xcd, 0x73, 0x99, 0x36, 0x73, 0x7f, 0x2d,
+			0xb5, 0x05, 0xd7, 0xcf, 0xad, 0x1b, 0x49, 0x74,
+			0x99, 0x32, 0x3c, 0x86, 0x86, 0x32, 0x5e, 0x47,
+			0x92, 0xf2, 0x67, 0xaa, 0xfa, 0x3f, 0x87, 0xca,
+			0x60, 0xd0, 0x1c, 0xb5, 0x4f, 0x29, 0x20, 0x2a,
+			0x3e, 0x78, 0x4c, 0xcb, 0x7e, 0xbc, 0xdc, 0xfd,
+			0x45, 0x54, 0x2b, 0x7f, 0x6a, 0xf7, 0x78, 0x74,
+			0x2e, 0x0f, 0x44, 0x79, 0x17, 0x50, 0x84, 0xaa,
+			0x48, 0x8b, 0x3b, 0x74, 0x34, 0x06, 0x78, 0xaa,
+			0x02, 0x6f, 0x56, 0x6c, 0xdc, 0xd2, 0x98, 0x7e,
+			0xb7, 0xab, 0x1e, 0xc7, 0x1e, 0x86, 0xb6, 0x17,
+			0xf9, 0x7b, 0x98, 0xef, 0x63, 0x90, 0x2e, 0x28,
+			0x3f, 0xb5, 0x24, 0x91, 0x19, 0xc6, 0xce, 0xb0
+		},
+		.sig = {
+			0x63, 0x87, 0xcb, 0xb1, 0x64, 0x8c, 0x64, 0x21,
+			0x02, 0x1b, 0x03, 0xe5, 0xd8, 0x06, 0xbd, 0xbb,
+			0x49, 0x7e, 0xed, 0x6b, 0x59, 0x2a, 0x95, 0xa8,
+			0x0b, 0xf8, 0xc3, 0xab, 0x5a, 0xff, 0x11, 0x94,
+			0x6a, 0xf3, 0x53, 0x54, 0xe3, 0xc1, 0x76, 0x08,
+			0x3d, 0xa4, 0x63, 0xa1, 0x00, 0xc6, 0xde, 0xeb,
+			0x05, 0xde, 0x72, 0x64, 0xa7, 0x5d, 0xb4, 0x27,
+			0xe4, 0x59, 0xa8, 0x03, 0xf7, 0xb6, 0xc3, 0x52,
+			0xdb, 0x69, 0xdc, 0x0e, 0xb4, 0x99, 0xae, 0x6e,
+			0x56, 0x7e, 0x45, 0x7f, 0x54, 0x73, 0xfb, 0x88,
+			0x07, 0x6f, 0x66, 0x2d, 0x9f, 0x7f, 0xc0, 0xe9,
+			0x63, 0xa3, 0x51, 0xdb, 0xca, 0xa2, 0x03, 0x68,
+			0x01, 0x8a, 0xbe, 0x66, 0x54, 0x76, 0x7f, 0x3a,
+			0x63, 0xd3, 0xb9, 0x22, 0x1e, 0x2c, 0xaf, 0x25,
+			0xc8, 0x5a, 0x5a, 0x63, 0x19, 0xf2, 0x3e, 0xf1,
+			0x94, 0x00, 0x9c, 0x59, 0x37, 0x16, 0x1e, 0xce,
+			0x84, 0xc6, 0x37, 0xff, 0x7f, 0x67, 0x73, 0xf5,
+			0xd5, 0x23, 0x7a, 0x00, 0xee, 0x8b, 0xe9, 0x32,
+			0x69, 0x17, 0xcc, 0x9a, 0x89, 0xfc, 0xb7, 0xf5,
+			0x02, 0x68, 0x73, 0x8e, 0xe6, 0x0c, 0x0d, 0x9a,
+			0x1d, 0xb6, 0x09, 0xf4, 0xbb, 0xf1, 0x72, 0x0b,
+			0xbf, 0x81, 0xa3, 0xd6, 0x27, 0x3f, 0x80, 0x20,
+			0x59, 0x87, 0xcb, 0xa2, 0xf1, 0x63, 0xe4, 0xf9,
+			0x33, 0xe6, 0xe4, 0xc2, 0x85, 0x92, 0x4a, 0x1c,
+			0x9d, 0xc9, 0xd7, 0xa6, 0x4e, 0x43, 0xae, 0x3e,
+			0xb4, 0x14, 0xf0, 0x65, 0x5c, 0xe3, 0x0f, 0xaa,
+			0x06, 0x14, 0x7b, 0xd7, 0xf4, 0x2a, 0xc5, 0x79,
+			0x4b, 0x6a, 0x15, 0xaf, 0x0a, 0x28, 0xdb, 0x62,
+			0x83, 0x4c, 0xc2, 0x11, 0x77, 0x61, 0x81, 0x35,
+			0xb2, 0xec, 0xb5, 0x20, 0xcc, 0x4c, 0x44, 0x1b,
+			0x19, 0x1e, 0x1e, 0x15, 0xbb, 0x76, 0x26, 0xc7,
+			0xdb, 0x2f, 0x87, 0x37, 0x5d, 0x88, 0xea, 0x5e,
+			0x26, 0x5f, 0x62, 0xcb, 0x82, 0xe5, 0xb2, 0x95,
+			0x5f, 0x80, 0x1f, 0x14, 0xb3, 0xf2, 0xb7, 0x57,
+			0xd0, 0x37, 0xee, 0x6f, 0x0b, 0x6e, 0x23, 0x78,
+			0x03, 0x9a, 0x92, 0xd2, 0xb8, 0x2d, 0x5c, 0xc6,
+			0x5c, 0xee, 0x0d, 0x45, 0x0d, 0x3f, 0x57, 0x0e,
+			0xab, 0x57, 0x7d, 0xe5, 0xf7, 0x45, 0xc8, 0x5c,
+			0x09, 0xa3, 0x76, 0xae, 0x7b, 0x54, 0x15, 0x8d,
+			0x8d, 0x83, 0x52, 0x05, 0xcd, 0x00, 0xd4, 0x8e,
+			0x25, 0x2a, 0x44, 0x78, 0x5f, 0xe1, 0x5e, 0xe5,
+			0x70, 0x0b, 0x72, 0xfb, 0x38, 0x95, 0xbd, 0x71,
+			0xb4, 0x95, 0x6c, 0xfe, 0x33, 0xe8, 0x6d, 0x52,
+			0x9f, 0x93, 0x5d, 0x09, 0xe2, 0xf0, 0xed, 0xff,
+			0x1b, 0x72, 0xf1, 0xe6, 0xc9, 0x63, 0x18, 0x07,
+			0x6f, 0x6a, 0x3e, 0xb1, 0xf8, 0xff, 0x0b, 0xab,
+			0xe1, 0xe9, 0x9f, 0xe4, 0xc1, 0xa0, 0xa9, 0x0c,
+			0xfe, 0xb5, 0xf7, 0x1c, 0xd3, 0xd6, 0xd4, 0x1d,
+			0x1e, 0x75, 0xd9, 0x98, 0x79, 0xfc, 0x46, 0x52,
+			0x23, 0xc6, 0x97, 0xbb, 0xb5, 0x48, 0x7b, 0x5f,
+			0x75, 0x73, 0xc6, 0xb2, 0x00, 0xe4, 0xa1, 0xe6,
+			0xd2, 0x3a, 0xa2, 0x93, 0xc4, 0x4a, 0x11, 0xc3,
+			0xd8, 0xa2, 0x8e, 0xa6, 0x2d, 0xb5, 0xc5, 0xea,
+			0x58, 0xf2, 0xc4, 0x31, 0x7e, 0xa5, 0xe9, 0x13,
+			0x3a, 0xa2, 0xab, 0x39, 0x7b, 0x2b, 0xc4, 0xc1,
+			0xa0, 0x17, 0xda, 0x83, 0xeb, 0xb1, 0xfd, 0xc0,
+			0x47, 0x08, 0xb5, 0x43, 0xd4, 0xc7, 0x64, 0x7e,
+			0x9d, 0x43, 0xea, 0xbe, 0xab, 0xa2, 0x43, 0x28,
+			0xb3, 0xe9, 0xdc, 0x91, 0x8b, 0x4b, 0xc0, 0xf0,
+			0x42, 0xf5, 0x31, 0xc7, 0x7e, 0x65, 0xe0, 0x0e,
+			0x47, 0x85, 0x4f, 0x0b, 0x5d, 0x40, 0x64, 0x54,
+			0x61, 0x17, 0xc2, 0xf2, 0x96, 0x7c, 0x67, 0xde,
+			0x35, 0xe8, 0x91, 0x03, 0x3f, 0x6d, 0x7f, 0x18,
+			0x44, 0xb5, 0x46, 0x8e, 0x8b, 0xfa, 0x05, 0x32,
+			0xa8, 0x48, 0x4d, 0x26, 0x5f, 0xdd, 0xf7, 0xa3,
+			0x66, 0x05, 0x30, 0xc0, 0x60, 0xba, 0x25, 0xc9,
+			0x58, 0x1f, 0x23, 0x5a, 0x1a, 0xcf, 0x13, 0x9d,
+			0xc8, 0x6b, 0xc2, 0x69, 0x2a, 0x3f, 0x39, 0xf6,
+			0xea, 0x70, 0xf3, 0xe0, 0x7c, 0x93, 0xea, 0x3b,
+			0xd4, 0xa8, 0xb9, 0x05, 0xe4, 0xb4, 0x6b, 0x05,
+			0x1f, 0xcb, 0x63, 0xa1, 0x5f, 0xc9, 0xc7, 0x0f,
+			0x01, 0xa5, 0x36, 0x15, 0xf0, 0x4f, 0x90, 0xa0,
+			0x50, 0x38, 0xd2, 0xef, 0xd0, 0xd5, 0xba, 0xa8,
+			0xde, 0xba, 0xcd, 0x54, 0xd8, 0xab, 0x6b, 0x99,
+			0xdc, 0x65, 0xba, 0x9b, 0x43, 0x13, 0xf5, 0x88,
+			0xd3, 0x8d, 0x34, 0x0f, 0xb2, 0xca, 0x65, 0xdf,
+			0x92, 0x77, 0xbe, 0x2c, 0x30, 0xdd, 0x07, 0xbe,
+			0x09, 0x87, 0x95, 0x0c, 0xb0, 0x57, 0x51, 0xfb,
+			0x57, 0x61, 0x5f, 0xe7, 0xb3, 0x32, 0x32, 0x9e,
+			0xc7, 0x9e, 0x3a, 0x53, 0x1f, 0x1e, 0xf4, 0x13,
+			0x38, 0xfc, 0xee, 0x8e, 0xe2, 0x9f, 0x9f, 0x73,
+			0x06, 0xb0, 0x48, 0xd2, 0x5a, 0x40, 0x4f, 0x8a,
+			0x5a, 0x97, 0x79, 0xf2, 0xc9, 0xcf, 0xc3, 0x7d,
+			0xce, 0x2f, 0xd5, 0x1b, 0x33, 0x42, 0xae, 0x77,
+			0xfa, 0x07, 0x8b, 0x81, 0xcf, 0x5c, 0xaf, 0xdd,
+			0xcc, 0xaa, 0x7e, 0x03, 0x91, 0xc2, 0xe9, 0xc1,
+			0x0f, 0x12, 0x7c, 0x75, 0xb5, 0xed, 0x41, 0xb1,
+			0xf4, 0x4b, 0x8d, 0xa1, 0xd2, 0x78, 0xad, 0xc0,
+			0x1e, 0x80, 0x18, 0x4a, 0x92, 0xea, 0xed, 0x75,
+			0xa2, 0x65, 0xd7, 0xf2, 0x78, 0x03, 0x54, 0xce,
+			0x8f, 0x1f, 0xd5, 0xa0, 0xb4, 0xd3, 0xac, 0x95,
+			0x16, 0x6b, 0x17, 0xcb, 0x66, 0x1f, 0x72, 0xe9,
+			0x91, 0xd0, 0xaa, 0xf1, 0x91, 0xd5, 0x59, 0xc7,
+			0xa9, 0x91, 0x9d, 0x04, 0xec, 0x7a, 0xfd, 0xab,
+			0xf9, 0xa0, 0x35, 0x33, 0xfa, 0xb2, 0xf7, 0xdb,
+			0x5c, 0x45, 0x47, 0xa1, 0xdc, 0x40, 0x21, 0xe5,
+			0xc9, 0xa9, 0x8c, 0x8a, 0x5a, 0x1e, 0x9e, 0xaf,
+			0x58, 0x19, 0x6a, 0x0d, 0x72, 0xcf, 0x62, 0x65,
+			0x39, 0x17, 0xd8, 0x83, 0x1e, 0x63, 0x21, 0xb7,
+			0x2a, 0xac, 0x6c, 0xbc, 0x3f, 0xa9, 0xae, 0x76,
+			0xfc, 0xde, 0x5a, 0x58, 0xff, 0xbd, 0x15, 0x16,
+			0x80, 0x28, 0x05, 0x6a, 0x9d, 0x27, 0x7d, 0xca,
+			0x01, 0x7d, 0x89, 0xb5, 0x08, 0x36, 0xc3, 0xaa,
+			0xb0, 0xc2, 0xf0, 0x55, 0x88, 0xde, 0xd3, 0xbc,
+			0x69, 0xa3, 0xd6, 0x4b, 0xe6, 0x33, 0x4f, 0x31,
+			0x38, 0x1c, 0x41, 0x71, 0x77, 0x59, 0xcb, 0x88,
+			0x5e, 0x45, 0xe8, 0x71, 0x4f, 0xfb, 0x0c, 0x03,
+			0x61, 0x03, 0xf0, 0xa5, 0x5c, 0x16, 0x4c, 0x2a,
+			0xb1, 0x17, 0xe6, 0x47, 0xd6, 0xb3, 0x59, 0xfd,
+			0x86, 0xba, 0xc6, 0x00, 0xb3, 0x89, 0xf8, 0x89,
+			0x7c, 0xa6, 0xf7, 0x57, 0x2c, 0xd7, 0xdc, 0xa4,
+			0x1a, 0x37, 0x79, 0xf3, 0x66, 0x51, 0xbd, 0x9f,
+			0x92, 0xfd, 0x4b, 0x9d, 0xbd, 0xc3, 0xf9, 0x44,
+			0xea, 0xc7, 0xd0, 0xa3, 0x1f, 0x25, 0x91, 0x55,
+			0xe7, 0x47, 0x26, 0x51, 0x1a, 0xe7, 0x39, 0x9c,
+			0xf6, 0x8e, 0xc1, 0x66, 0x0a, 0xb0, 0x9c, 0x23,
+			0x43, 0x14, 0x46, 0x16, 0x16, 0x4c, 0xc2, 0xff,
+			0xa7, 0x98, 0xa5, 0x3e, 0x23, 0x40, 0x4f, 0xa1,
+			0x6d, 0x0e, 0x0b, 0x64, 0x3a, 0x13, 0x3e, 0x9b,
+			0x29, 0xd2, 0xcf, 0xfd, 0xd5, 0xb9, 0x4e, 0x83,
+			0x52, 0x8d, 0x84, 0x82, 0x3e, 0x90, 0x73, 0xba,
+			0x17, 0x0b, 0x61, 0x7a, 0xf7, 0x8a, 0x1f, 0xac,
+			0xcc, 0x78, 0xfe, 0x78, 0x7c, 0x05, 0xec, 0x98,
+			0xb2, 0xba, 0xbe, 0x60, 0xcd, 0x23, 0x85, 0xa9,
+			0xaa, 0x7e, 0xf5, 0x64, 0xa9, 0xd9, 0x89, 0xdc,
+			0x53, 0x6e, 0x6e, 0x64, 0xa8, 0x96, 0x39, 0x75,
+			0x85, 0x85, 0xa3, 0x30, 0x50, 0x30, 0xad, 0x82,
+			0x71, 0xc0, 0xd1, 0x28, 0x50, 0xdb, 0xc7, 0x7d,
+			0xfe, 0xc4, 0xb0, 0x24, 0xa2, 0x6c, 0x12, 0xcd,
+			0x2e, 0xcf, 0xb8, 0x0d, 0xab, 0x5e, 0x87, 0x46,
+			0x37, 0xc8, 0xae, 0xca, 0x22, 0x8f, 0xe2, 0x4e,
+			0x52, 0x04, 0xda, 0x04, 0x72, 0x9e, 0xcd, 0x0e,
+			0x64, 0xcc, 0x46, 0x3a, 0x8b, 0xe2, 0x6f, 0x26,
+			0xfc, 0x82, 0xec, 0x45, 0xb7, 0xbc, 0xd4, 0xe9,
+			0xd4, 0xcf, 0x0d, 0x25, 0x8c, 0xfc, 0xe3, 0x7f,
+			0x30, 0xea, 0x18, 0xed, 0x2b, 0xd9, 0x23, 0x3a,
+			0xaf, 0x28, 0x08, 0xd5, 0x49, 0xb9, 0xed, 0xc9,
+			0xd7, 0xc2, 0x98, 0x88, 0x75, 0xf3, 0x27, 0xd7,
+			0x4c, 0xad, 0x45, 0x98, 0x1d, 0x3c, 0x77, 0xde,
+			0xf2, 0xa3, 0xb1, 0xe1, 0xb7, 0xee, 0xda, 0x19,
+			0xa1, 0xca, 0xb8, 0x3c, 0x77, 0x89, 0x72, 0xfd,
+			0x1a, 0x5f, 0x45, 0x37, 0x64, 0xa4, 0xe3, 0x29,
+			0x51, 0x1f, 0xc1, 0x80, 0x4d, 0xe8, 0xdf, 0xf0,
+			0xc1, 0x89, 0x94, 0xfa, 0xde, 0xed, 0xab, 0x46,
+			0xa1, 0x4d, 0x40, 0x99, 0x30, 0x52, 0xcb, 0xe0,
+			0x83, 0xc1, 0xf6, 0xdd, 0x98, 0x70, 0x3a, 0x43,
+			0x52, 0xb9, 0x80, 0x56, 0xda, 0x35, 0x3a, 0xb7,
+			0x90, 0x2b, 0x2c, 0xd1, 0x6a, 0x4a, 0x1e, 0x9b,
+			0xca, 0x97, 0xa1, 0xcc, 0xcd, 0x1f, 0xb9, 0xa3,
+			0xa8, 0xe9, 0x08, 0xde, 0xfe, 0x9c, 0xac, 0x08,
+			0x1e, 0x0b, 0xf5, 0x19, 0x27, 0x09, 0xf0, 0x25,
+			0x9b, 0x83, 0xdd, 0xa4, 0xd7, 0xa1, 0xc5, 0xd5,
+			0xc4, 0x55, 0x26, 0x45, 0x73, 0x25, 0xd1, 0x14,
+			0xd2, 0x2a, 0x4b, 0x26, 0x7b, 0xdd, 0x8d, 0xe6,
+			0xa7, 0x0c, 0x19, 0xca, 0x1e, 0x4a, 0x5d, 0xac,
+			0xc0, 0x9f, 0x46, 0x20, 0x7d, 0x1d, 0xf8, 0xac,
+			0xc6, 0xb6, 0x8c, 0xae, 0x1a, 0xcc, 0x4c, 0xc3,
+			0x5a, 0x27, 0xc2, 0xee, 0x46, 0x32, 0xc2, 0x7d,
+			0xb4, 0x39, 0xe8, 0xbc, 0x6a, 0xb3, 0x2a, 0x9d,
+			0xb2, 0x83, 0xfe, 0x56, 0xd1, 0xaa, 0x6f, 0xa6,
+			0x6d, 0x73, 0x45, 0xf4, 0x17, 0x8e, 0x8f, 0x0a,
+			0x82, 0x4b, 0xbb, 0x8b, 0x4c, 0x37, 0x78, 0x3f,
+			0x2b, 0x04, 0xa8, 0x0d, 0xfd, 0x6c, 0xd9, 0xa0,
+			0xa6, 0xd6, 0x7c, 0x05, 0x7e, 0x94, 0x20, 0x1a,
+			0x2d, 0xd7, 0x74, 0x95, 0x5c, 0xa7, 0xc2, 0x3a,
+			0x38, 0xc8, 0xd6, 0x92, 0x6d, 0xf5, 0x22, 0xeb,
+			0x59, 0xa3, 0xe3, 0xe9, 0xf1, 0x3f, 0xb1, 0xab,
+			0xa8, 0xd1, 0x7e, 0x85, 0xc4, 0xb3, 0x4a, 0x75,
+			0x04, 0x4c, 0x9f, 0x8d, 0x02, 0x48, 0xb6, 0x50,
+			0xc6, 0x2d, 0xfa, 0x53, 0xf4, 0x82, 0x0a, 0x5c,
+			0x26, 0x67, 0x2c, 0x1b, 0xa1, 0xe3, 0x4b, 0x90,
+			0x04, 0x49, 0x48, 0xee, 0x02, 0x7a, 0xdf, 0x38,
+			0x1d, 0x0a, 0x6b, 0xd8, 0xb8, 0x32, 0xb9, 0x68,
+			0xb4, 0x82, 0x1c, 0x34, 0x3f, 0x88, 0x99, 0x27,
+			0x7c, 0x74, 0xcf, 0x5e, 0x98, 0x97, 0x06, 0x96,
+			0xd8, 0x13, 0xb6, 0x40, 0x52, 0x7c, 0x0b, 0x85,
+			0x7d, 0x66, 0xa0, 0xe0, 0x8c, 0x5d, 0x73, 0x02,
+			0xb6, 0x39, 0xca, 0x77, 0x28, 0xa1, 0xd9, 0xe3,
+			0x28, 0xd7, 0x00, 0x37, 0x08, 0x0f, 0x02, 0x3c,
+			0xc0, 0xb7, 0xca, 0x9f, 0x38, 0x41, 0x66, 0x3b,
+			0xff, 0x06, 0x95, 0x9c, 0x6d, 0x5d, 0xd4, 0xda,
+			0x16, 0x98, 0xe6, 0x3c, 0xea, 0x6c, 0x27, 0x1d,
+			0x5b, 0xb5, 0x4c, 0x48, 0x01, 0x40, 0xf3, 0x8f,
+			0x75, 0xbf, 0x01, 0x36, 0x24, 0xaf, 0x29, 0x97,
+			0x95, 0xc6, 0x4c, 0x1e, 0x72, 0x32, 0xca, 0xdf,
+			0xbb, 0x21, 0x08, 0xd2, 0xcf, 0xa2, 0xa2, 0x9c,
+			0xef, 0x8f, 0x71, 0xce, 0xb7, 0x36, 0xcc, 0xc1,
+			0x93, 0x9d, 0xf4, 0x6d, 0xfe, 0x83, 0x37, 0xdd,
+			0xb6, 0x59, 0x6a, 0x29, 0x34, 0xff, 0x4f, 0xca,
+			0xb2, 0xec, 0x6b, 0xa6, 0xc0, 0x26, 0x5e, 0xd1,
+			0xd3, 0xfd, 0xb0, 0x87, 0x79, 0xf1, 0x5a, 0x92,
+			0xbe, 0x69, 0x66, 0x2f, 0x83, 0xa6, 0xac, 0x5d,
+			0x95, 0xc6, 0xb9, 0x8f, 0x0b, 0x8e, 0xde, 0x87,
+			0x55, 0x08, 0x13, 0x50, 0xb1, 0xb6, 0x8f, 0xe9,
+			0x44, 0x3e, 0x99, 0xdb, 0x9d, 0xf6, 0xe2, 0x7e,
+			0x53, 0x98, 0x7b, 0x56, 0xe4, 0x38, 0xbe, 0xcd,
+			0x24, 0x74, 0xea, 0x28, 0x88, 0xb4, 0x13, 0x15,
+			0x88, 0xb8, 0xf2, 0x95, 0x20, 0xde, 0x0d, 0x3b,
+			0x86, 0x8c, 0x34, 0x3c, 0x3c, 0x75, 0x08, 0x7e,
+			0xe0, 0xfa, 0x57, 0xa6, 0x2f, 0x32, 0xcf, 0x4d,
+			0x36, 0x93, 0x76, 0x24, 0x31, 0xbf, 0xb6, 0xb5,
+			0xbf, 0xdf, 0x4f, 0x55, 0x05, 0x40, 0x22, 0x5a,
+			0x2c, 0x75, 0x13, 0x7e, 0x03, 0x1e, 0xed, 0x56,
+			0x24, 0xa8, 0xdb, 0xaa, 0xe4, 0xbf, 0x62, 0x06,
+			0x7b, 0x41, 0x1e, 0x81, 0xb6, 0x3f, 0x02, 0x90,
+			0x29, 0x7f, 0x79, 0x40, 0xb0, 0x5b, 0xb5, 0x7b,
+			0x15, 0xf4, 0xf4, 0xcc, 0x09, 0xaa, 0x89, 0x05,
+			0xef, 0x5b, 0x85, 0xf9, 0xc4, 0x1d, 0x03, 0x9f,
+			0x7a, 0x36, 0x95, 0xc7, 0x92, 0xa0, 0xf7, 0x78,
+			0x7a, 0x06, 0x5d, 0xe9, 0xc4, 0xb3, 0x66, 0x2a,
+			0x7d, 0xbc, 0x41, 0x48, 0x70, 0x51, 0xf3, 0xc8,
+			0x10, 0x2c, 0x57, 0x8c, 0xe1, 0xa1, 0xd9, 0x57,
+			0x8d, 0x94, 0xd9, 0xb9, 0xfe, 0xf8, 0x8f, 0xdd,
+			0x2b, 0xca, 0xe3, 0x5f, 0x6d, 0xb8, 0xc5, 0xf0,
+			0x8e, 0xf0, 0x50, 0x51, 0xf7, 0xcd, 0x79, 0x18,
+			0x29, 0xf9, 0xfc, 0x28, 0xc1, 0x82, 0xcb, 0xf1,
+			0xa4, 0x2a, 0xbb, 0x99, 0xc6, 0xee, 0x86, 0xe9,
+			0xbd, 0x1f, 0x5e, 0x9d, 0xb3, 0xe4, 0x98, 0x24,
+			0xf0, 0x6d, 0xc2, 0xd0, 0x41, 0x88, 0xa0, 0x80,
+			0xb0, 0x0a, 0xc2, 0x41, 0x76, 0x26, 0x67, 0x17,
+			0x1b, 0x45, 0x7b, 0xa7, 0xc1, 0x4d, 0x1b, 0xb2,
+			0x27, 0x74, 0x2b, 0xf4, 0x55, 0x3a, 0xf4, 0xeb,
+			0x69, 0x21, 0x8b, 0x24, 0xfb, 0x7e, 0x22, 0xae,
+			0xab, 0x63, 0xf1, 0xa2, 0x45, 0xef, 0x0c, 0xb5,
+			0x05, 0x6d, 0x8e, 0x3f, 0x90, 0xe7, 0x44, 0xff,
+			0x87, 0x6a, 0xef, 0x4d, 0xf2, 0x07, 0x88, 0xd8,
+			0x29, 0xcc, 0xb3, 0x5d, 0x0f, 0xe1, 0x40, 0x85,
+			0xbd, 0x76, 0x5a, 0x30, 0x07, 0x15, 0x94, 0x39,
+			0x8e, 0x89, 0x2e, 0x9d, 0x4c, 0x9c, 0x00, 0x1c,
+			0x85, 0x6d, 0x12, 0xb5, 0x43, 0x01, 0x16, 0x95,
+			0x55, 0x5c, 0x4d, 0xfb, 0x26, 0x4a, 0x63, 0x81,
+			0xcd, 0xb7, 0x53, 0xe8, 0x8a, 0xf7, 0x90, 0x7b,
+			0x87, 0xc5, 0xd4, 0xef, 0x7f, 0x61, 0xaa, 0xa0,
+			0x9e, 0xdf, 0xb7, 0x90, 0x6d, 0x9e, 0xe4, 0x11,
+			0x4d, 0xd6, 0x00, 0x1f, 0xba, 0x93, 0x58, 0x45,
+			0x5f, 0xc4, 0x85, 0x3f, 0x64, 0x98, 0x66, 0x8e,
+			0x65, 0x56, 0x13, 0x07, 0xdb, 0x9f, 0x8f, 0x56,
+			0xf8, 0x41, 0xe1, 0x52, 0xf9, 0xea, 0xe4, 0x0e,
+			0xc2, 0x7f, 0x51, 0xf3, 0x56, 0x47, 0x29, 0x67,
+			0x28, 0xd0, 0x40, 0xa8, 0xda, 0x5f, 0x7d, 0x41,
+			0x96, 0x9e, 0x7d, 0x94, 0x9d, 0x2e, 0x1d, 0xce,
+			0xdb, 0x84, 0xe6, 0x93, 0xc8, 0xa5, 0xf2, 0xd2,
+			0x69, 0xd3, 0x39, 0xaa, 0x18, 0x0e, 0x9f, 0x12,
+			0xf6, 0x0d, 0x3c, 0xc5, 0xc6, 0xca, 0xbc, 0xa1,
+			0x3c, 0x8c, 0x6b, 0x1c, 0xa5, 0x3a, 0x70, 0x54,
+			0x4c, 0xd7, 0xdd, 0x75, 0x5d, 0xc7, 0xe0, 0x34,
+			0x9e, 0x6e, 0x5b, 0xf7, 0x93, 0xc2, 0x2f, 0x8a,
+			0xe0, 0x41, 0xfa, 0x0a, 0x37, 0x40, 0x6b, 0xec,
+			0x6c, 0x12, 0x8a, 0x89, 0x88, 0x1f, 0xd5, 0xc5,
+			0x33, 0x66, 0x4c, 0xef, 0x82, 0x70, 0x78, 0x04,
+			0xb1, 0x82, 0xad, 0xa4, 0x36, 0xdb, 0xb6, 0x76,
+			0x21, 0x3c, 0xf9, 0xc3, 0xe1, 0xf1, 0xf0, 0x0e,
+			0x69, 0xc5, 0xac, 0xfd, 0xae, 0x14, 0x52, 0x19,
+			0x61, 0x8e, 0xe9, 0x41, 0x16, 0x63, 0x16, 0xcd,
+			0xca, 0x55, 0x0a, 0xf3, 0x08, 0x2c, 0xff, 0x2e,
+			0x67, 0xd4, 0x7c, 0xb8, 0xac, 0xd5, 0x90, 0xf7,
+			0xb7, 0xd2, 0x60, 0xc3, 0x66, 0x86, 0xd1, 0x6a,
+			0x4d, 0x09, 0xa7, 0x23, 0x46, 0xfb, 0x80, 0xc3,
+			0x30, 0xea, 0x14, 0xeb, 0xb2, 0x76, 0xe2, 0xfa,
+			0x7a, 0x06, 0xe4, 0xe8, 0xe7, 0x88, 0xb3, 0x5e,
+			0x64, 0x3f, 0x6f, 0x9d, 0x3f, 0x29, 0xea, 0x29,
+			0xf8, 0x51, 0x4d, 0x80, 0x58, 0xd8, 0xfe, 0x0c,
+			0x5f, 0xe3, 0x31, 0xae, 0x57, 0x3f, 0x2e, 0x83,
+			0x35, 0x4f, 0xdd, 0xd2, 0x2f, 0x6c, 0xd8, 0x82,
+			0x75, 0xed, 0xd6, 0x77, 0x34, 0x58, 0x75, 0x37,
+			0xe7, 0x22, 0x83, 0xcc, 0x67, 0x25, 0x28, 0xb9,
+			0x9a, 0x5a, 0x8b, 0x27, 0xe5, 0x89, 0x4e, 0x21,
+			0xd3, 0xbb, 0x50, 0x81, 0x04, 0xb1, 0xd7, 0x99,
+			0xdf, 0x4c, 0xe6, 0x2c, 0xc6, 0x41, 0x45, 0xf1,
+			0xeb, 0x8b, 0x53, 0x4d, 0x89, 0x11, 0xa4, 0x84,
+			0x70, 0xd3, 0x63, 0x3c, 0x43, 0xef, 0xd9, 0x1d,
+			0x58, 0x18, 0x90, 0x3f, 0x6c, 0x78, 0x22, 0x9e,
+			0xef, 0xeb, 0x9b, 0xda, 0x2d, 0xaf, 0xb7, 0x4b,
+			0xf9, 0x87, 0xe3, 0x65, 0x0e, 0x83, 0x84, 0xd5,
+			0x9f, 0xa4, 0x32, 0x56, 0x9d, 0xd4, 0x6b, 0xbe,
+			0x0e, 0x48, 0x10, 0xd0, 0x2b, 0x5c, 0xba, 0x72,
+			0x3e, 0xee, 0xa6, 0x1e, 0x12, 0xd1, 0xd4, 0x56,
+			0xb7, 0xb9, 0x38, 0x64, 0xc6, 0x8d, 0x8b, 0x1b,
+			0xde, 0xa4, 0x2e, 0xed, 0x47, 0xd3, 0x07, 0x26,
+			0xfe, 0xf3, 0xd2, 0x6f, 0x62, 0x03, 0x6d, 0xa3,
+			0x52, 0x47, 0xae, 0x8f, 0x8a, 0x4d, 0x02, 0xd4,
+			0x9b, 0xbd, 0xde, 0x5a, 0x3b, 0xc0, 0x2d, 0x97,
+			0x44, 0x6d, 0x49, 0x20, 0x4d, 0x4e, 0x36, 0xed,
+			0xfb, 0x5d, 0xb1, 0xdf, 0x13, 0xb2, 0x3e, 0x78,
+			0x37, 0xcb, 0xd3, 0x91, 0x1d, 0x35, 0x07, 0x66,
+			0xb9, 0xc4, 0x63, 0xb9, 0xaf, 0x47, 0xfe, 0x00,
+			0xa2, 0x93, 0x63, 0x87, 0xb4, 0x17, 0x34, 0xb3,
+			0x84, 0xdd, 0x68, 0xbc, 0x89, 0x40, 0x1f, 0x0e,
+			0x99, 0x79, 0xea, 0x53, 0x4c, 0xaf, 0x9a, 0x05,
+			0x7f, 0xeb, 0xd7, 0xb3, 0x58, 0x46, 0x87, 0x56,
+			0x28, 0x59, 0x5b, 0x42, 0xcb, 0x05, 0x2c, 0xec,
+			0xa0, 0x20, 0xf6, 0xa4, 0x93, 0x60, 0xe6, 0xd9,
+			0xbd, 0x05, 0xf9, 0xb8, 0xd7, 0x61, 0xa7, 0x80,
+			0x82, 0x5c, 0x49, 0x14, 0xeb, 0xb3, 0x1b, 0xd3,
+			0xef, 0xa4, 0xc4, 0x28, 0xc0, 0x5d, 0xfa, 0x06,
+			0xb0, 0x5f, 0x43, 0xc0, 0x28, 0x89, 0xa9, 0x4e,
+			0x94, 0x01, 0x8b, 0x48, 0xef, 0x75, 0x3a, 0x01,
+			0xae, 0xa5, 0x52, 0x68, 0xe7, 0x06, 0xc2, 0x5c,
+			0x60, 0x8d, 0x08, 0xcc, 0x88, 0x75, 0xed, 0xeb,
+			0xcf, 0x76, 0xe3, 0x09, 0x1d, 0x35, 0x57, 0xa7,
+			0x57, 0x8b, 0x45, 0xd4, 0x74, 0x9c, 0x53, 0x87,
+			0x31, 0x5e, 0x93, 0x12, 0x78, 0x5e, 0x04, 0xd2,
+			0x39, 0x14, 0x76, 0xec, 0x65, 0xd6, 0x75, 0x1f,
+			0x0e, 0x3a, 0x6f, 0x1c, 0x94, 0xd2, 0x86, 0x77,
+			0x10, 0xb1, 0x43, 0xad, 0xf6, 0x6d, 0x9f, 0x3f,
+			0x17, 0xe3, 0x4c, 0xe0, 0xe9, 0xd9, 0x5a, 0xdb,
+			0xad, 0xf8, 0x99, 0x4b, 0xed, 0xf9, 0x6d, 0xa4,
+			0x76, 0x3f, 0xa0, 0x92, 0xee, 0xb8, 0xba, 0xe8,
+			0x90, 0x73, 0x7b, 0x60, 0xe5, 0x81, 0x53, 0x1b,
+			0xdd, 0x73, 0xf9, 0x7e, 0x83, 0x82, 0x83, 0xe9,
+			0xd1, 0xba, 0x9a, 0x31, 0xa8, 0xf4, 0x96, 0x92,
+			0xc0, 0x5b, 0x5f, 0xdf, 0xdc, 0x45, 0x79, 0x8c,
+			0x8e, 0xe8, 0x9c, 0x19, 0x25, 0xdf, 0x7d, 0x19,
+			0xa6, 0x2a, 0xb1, 0x1c, 0x10, 0xda, 0x5d, 0xe8,
+			0xc9, 0x6a, 0x15, 0x05, 0xf4, 0x1c, 0x6d, 0x01,
+			0x2d, 0xda, 0x40, 0xcb, 0x61, 0x12, 0x2c, 0x82,
+			0x60, 0xcb, 0x71, 0xa6, 0x1b, 0x92, 0x4d, 0x76,
+			0x0e, 0xdc, 0xfe, 0x6e, 0x07, 0x11, 0x2e, 0x30,
+			0xdb, 0x7d, 0x7b, 0x16, 0xb3, 0x64, 0x60, 0xae,
+			0x4f, 0x97, 0x0c, 0xbc, 0x39, 0xf0, 0x12, 0xa0,
+			0xb9, 0x1c, 0xd5, 0xc8, 0x03, 0x8e, 0x44, 0xd8,
+			0xab, 0x10, 0xe5, 0x3f, 0xaa, 0x08, 0x72, 0xb7,
+			0x74, 0xfc, 0x8b, 0x49, 0xa8, 0xaa, 0x6e, 0xaf,
+			0xf8, 0x73, 0x95, 0x1a, 0x0c, 0x07, 0xfb, 0x3a,
+			0xd8, 0x32, 0xaf, 0x54, 0x58, 0xaa, 0x1e, 0x96,
+			0xf5, 0x6f, 0x66, 0x3c, 0x3f, 0xad, 0xfd, 0xe7,
+			0x0f, 0x45, 0x5f, 0x8e, 0xcd, 0x4f, 0x4b, 0xbb,
+			0x7b, 0x4e, 0x60, 0x30, 0xdb, 0xf8, 0x4e, 0xa4,
+			0xa8, 0x8b, 0x05, 0x3c, 0x85, 0x78, 0x4f, 0x73,
+			0xe9, 0x30, 0x4c, 0x6b, 0xe1, 0xdc, 0xf9, 0x15,
+			0xca, 0xa7, 0xde, 0x51, 0xff, 0xf7, 0xa8, 0x75,
+			0xa3, 0xf4, 0xd1, 0x52, 0xcc, 0x57, 0x28, 0x74,
+			0x9a, 0xe2, 0xa7, 0xbb, 0x94, 0x25, 0x7a, 0xb2,
+			0x03, 0x90, 0xb9, 0xad, 0xe7, 0xdd, 0x70, 0x5e,
+			0x89, 0x9e, 0x8d, 0xaf, 0xee, 0xf6, 0xad, 0xbf,
+			0xb8, 0x9e, 0x44, 0x28, 0x28, 0x80, 0xd2, 0xf8,
+			0xca, 0x07, 0x08, 0xe1, 0xca, 0x6d, 0x8c, 0xe6,
+			0x33, 0xee, 0x02, 0xec, 0x09, 0xce, 0xbe, 0x08,
+			0x22, 0x53, 0x05, 0x74, 0xdd, 0x01, 0x6a, 0xce,
+			0x65, 0x2d, 0xd1, 0x94, 0xc3, 0x9a, 0x01, 0x9a,
+			0xc7, 0x3c, 0xac, 0xa1, 0x37, 0x86, 0x36, 0xc6,
+			0x83, 0xd3, 0x64, 0x30, 0x6b, 0x2f, 0x10, 0xb5,
+			0xc6, 0xa4, 0xee, 0xb4, 0x54, 0xac, 0xe3, 0x0c,
+			0x0e, 0x51, 0x52, 0xae, 0x29, 0xd5, 0x6c, 0xf2,
+			0xb5, 0x63, 0x1d, 0x89, 0xe2, 0x7f, 0xbe, 0x55,
+			0xbf, 0x12, 0xa2, 0x66, 0x92, 0x00, 0x4f, 0x59,
+			0x16, 0x14, 0x67, 0x5b, 0xe5, 0xe4, 0x30, 0x52,
+			0xcd, 0x42, 0xd9, 0x47, 0xdc, 0xdc, 0x0b, 0xb6,
+			0x7b, 0x72, 0x84, 0x6a, 0x3c, 0x72, 0xac, 0x02,
+			0x91, 0x7f, 0xf0, 0xef, 0x16, 0x06, 0xd7, 0x87,
+			0x49, 0x19, 0xcc, 0xb1, 0xea, 0x7d, 0x8e, 0x1b,
+			0xdc, 0x1d, 0xf6, 0xa8, 0xf1, 0x55, 0xb9, 0xfd,
+			0xc0, 0x49, 0xb0, 0x0f, 0x4b, 0xb3, 0xef, 0x56,
+			0xf2, 0xf1, 0x1d, 0x28, 0xaa, 0xe6, 0x3c, 0x1c,
+			0xdc, 0xe8, 0xb5, 0x33, 0xcd, 0x81, 0xb5, 0x18,
+			0xbf, 0xf1, 0xb2, 0x34, 0x0a, 0xc6, 0xe9, 0x24,
+			0x0b, 0x5d, 0x5f, 0xe7, 0x3d, 0x1b, 0x81, 0x7b,
+			0xff, 0x64, 0x49, 0x5a, 0xeb, 0xbd, 0xf5, 0xdc,
+			0x47, 0x84, 0xc5, 0xbd, 0x6d, 0x9d, 0x8f, 0x69,
+			0xe8, 0x84, 0xe0, 0x57, 0x7f, 0x54, 0xc6, 0xd6,
+			0x7d, 0xd0, 0xc7, 0xa3, 0xb3, 0x83, 0x70, 0x13,
+			0x0c, 0x89, 0x1c, 0xac, 0xf5, 0xf6, 0x63, 0x36,
+			0xb6, 0x50, 0x17, 0x95, 0xc1, 0x96, 0x58, 0x0b,
+			0x87, 0x8d, 0x9d, 0x0e, 0x45, 0x01, 0x7d, 0x72,
+			0xd1, 0xb4, 0x42, 0x0a, 0x1a, 0x12, 0x93, 0xfb,
+			0x15, 0x07, 0x90, 0x70, 0x07, 0xce, 0x46, 0x7e,
+			0x44, 0x2f, 0x4c, 0x35, 0x68, 0xa6, 0xe7, 0x92,
+			0xd1, 0x2e, 0x02, 0xba, 0xd7, 0xc4, 0x81, 0xb9,
+			0x73, 0x4b, 0x16, 0xbb, 0x05, 0xbf, 0x23, 0x12,
+			0x51, 0x45, 0xec, 0x8c, 0xdb, 0x99, 0xcc, 0x1c,
+			0x87, 0x9e, 0x52, 0x4e, 0x4d, 0x4a, 0xaa, 0xa9,
+			0xf6, 0x7f, 0x9f, 0xf2, 0xad, 0x21, 0xab, 0xbf,
+			0xcd, 0x67, 0xc6, 0x76, 0xf9, 0xa3, 0x99, 0x0d,
+			0x05, 0xdb, 0x0d, 0xb7, 0xb7, 0x6d, 0xe0, 0xac,
+			0xeb, 0xb6, 0x23, 0xc6, 0x79, 0x65, 0x4a, 0xa0,
+			0x2d, 0xaf, 0xcc, 0x4c, 0x60, 0x35, 0x71, 0xb3,
+			0x82, 0x7e, 0x12, 0x84, 0x8a, 0xf3, 0xfa, 0x1f,
+			0x64, 0xe2, 0xdc, 0x64, 0x00, 0x0d, 0xf1, 0x27,
+			0xf7, 0x0a, 0x20, 0xd1, 0x81, 0x8e, 0xdb, 0xd7,
+			0xee, 0xfc, 0x21, 0xb7, 0x13, 0x8d, 0x2d, 0x3b,
+			0x2b, 0xe4, 0x21, 0x40, 0x2a, 0x2a, 0x90, 0xb3,
+			0xc3, 0x99, 0xe6, 0x9f, 0x63, 0x19, 0xd9, 0x1e,
+			0x38, 0x5c, 0x85, 0x21, 0x07, 0x5b, 0xf1, 0xee,
+			0x8c, 0xdf, 0xa6, 0x85, 0x15, 0x89, 0xbf, 0x27,
+			0x59, 0x30, 0x85, 0xa6, 0xdd, 0xf7, 0x80, 0xce,
+			0xaf, 0x6a, 0x33, 0x59, 0x20, 0x85, 0x13, 0x3e,
+			0xb8, 0x9f, 0x5b, 0x26, 0xd6, 0xc6, 0x24, 0x5e,
+			0xb1, 0x6b, 0x7c, 0x3b, 0x63, 0xb5, 0xda, 0xaf,
+			0x00, 0xe5, 0x63, 0x1c, 0x0b, 0xd6, 0xbe, 0x73,
+			0x40, 0x89, 0x83, 0x27, 0x8e, 0xe9, 0x47, 0xa7,
+			0xe3, 0xe3, 0xef, 0xd3, 0xb1, 0xac, 0xf8, 0x20,
+			0x7c, 0xe2, 0x18, 0xcd, 0xba, 0xe7, 0xa3, 0xa2,
+			0xbc, 0xbb, 0xde, 0x12, 0x0b, 0x8c, 0x2d, 0xe1,
+			0xfb, 0x45, 0x10, 0xaa, 0x0d, 0xd3, 0xd4, 0x38,
+			0x84, 0xad, 0x6a, 0xbc, 0xee, 0x88, 0xbb, 0x94,
+			0xbb, 0xc5, 0x4b, 0x23, 0x7b, 0x26, 0x96, 0xb8,
+			0xa3, 0x44, 0x0c, 0x80, 0x3e, 0x64, 0xc5, 0x16,
+			0x67, 0xc3, 0x64, 0x85, 0x34, 0xbd, 0x66, 0x8f,
+			0x40, 0x01, 0x51, 0x9d, 0x5a, 0xe8, 0x5c, 0xc0,
+			0x29, 0x17, 0x8a, 0xee, 0xea, 0x4b, 0xb1, 0xc0,
+			0x26, 0x96, 0xf9, 0xeb, 0xfc, 0xed, 0xf8, 0xca,
+			0x34, 0x95, 0x6e, 0x56, 0xcc, 0xfa, 0x90, 0x47,
+			0x95, 0x2a, 0x9e, 0x5a, 0xcd, 0x00, 0x70, 0x9a,
+			0xed, 0xcc, 0xec, 0x76, 0xae, 0xe9, 0xd3, 0xfb,
+			0x8a, 0x79, 0x95, 0xb2, 0xb9, 0x3e, 0xfb, 0xdc,
+			0x4d, 0x37, 0x4d, 0x09, 0x63, 0xe1, 0xcb, 0x0b,
+			0x06, 0x56, 0x74, 0x94, 0x33, 0x21, 0x6c, 0xdc,
+			0xd5, 0xd3, 0x2c, 0x91, 0xf7, 0x33, 0x29, 0xc1,
+			0x86, 0x9d, 0x4a, 0xda, 0x1a, 0x03, 0x6d, 0x21,
+			0x74, 0x85, 0x71, 0x06, 0x56, 0xe8, 0x26, 0xea,
+			0xaa, 0x3b, 0x0a, 0x0a, 0x14, 0x26, 0x78, 0x5f,
+			0x90, 0x09, 0x34, 0xe9, 0x11, 0x15, 0xe5, 0xbd,
+			0xf2, 0x89, 0x77, 0xa1, 0xc8, 0xae, 0x57, 0xf6,
+			0x0a, 0x95, 0x5b, 0x99, 0x7e, 0x16, 0x94, 0x26,
+			0x92, 0xf2, 0x72, 0xee, 0xb4, 0x1b, 0x91, 0x19,
+			0xfb, 0xed, 0xc0, 0x95, 0x1d, 0xb6, 0xfd, 0x57,
+			0xde, 0x7e, 0x8c, 0x65, 0x2b, 0xe8, 0x5b, 0x82,
+			0xd2, 0xbd, 0x5b, 0x83, 0xdf, 0xbb, 0x59, 0x2a,
+			0x2e, 0x39, 0x48, 0x44, 0x1d, 0x0a, 0x08, 0x2b,
+			0x58, 0x82, 0x29, 0x36, 0x94, 0xc9, 0x3d, 0xbf,
+			0xbc, 0x7e, 0xc4, 0xdb, 0x67, 0xfb, 0xcc, 0x43,
+			0x3d, 0xa8, 0x86, 0x21, 0x8d, 0x0c, 0x59, 0x9a,
+			0x54, 0x75, 0x59, 0x47, 0x17, 0x38, 0x34, 0xbd,
+			0xe9, 0x73, 0xbe, 0x99, 0xc4, 0xf9, 0x4d, 0x6e,
+			0x1c, 0x3f, 0x62, 0x2c, 0xef, 0x55, 0x27, 0x8d,
+			0xc6, 0xc7, 0x2b, 0x31, 0x58, 0x25, 0xed, 0x4e,
+			0xf7, 0x29, 0xb4, 0x80, 0xd0, 0xef, 0xf7, 0xd6,
+			0x0d, 0x62, 0x56, 0xa0, 0x9e, 0xb3, 0xdc, 0xd2,
+			0x23, 0x73, 0x7e, 0x30, 0x39, 0xce, 0xd6, 0x2c,
+			0x62, 0x45, 0xaf, 0x24, 0xa1, 0x5e, 0x6a, 0x4e,
+			0x9e, 0x0a, 0xa6, 0x92, 0xd8, 0xb6, 0xcb, 0x9b,
+			0x6e, 0xd1, 0xc1, 0x48, 0x68, 0xe6, 0x7a, 0x9d,
+			0xf9, 0x3f, 0xe3, 0xbc, 0x58, 0x94, 0x71, 0xbc,
+			0xc6, 0xbf, 0xd3, 0x43, 0xa3, 0xa9, 0x9f, 0x78,
+			0x50, 0x85, 0x0b, 0x7f, 0xce, 0x02, 0xe9, 0x81,
+			0xc1, 0x39, 0x0f, 0x37, 0xba, 0x79, 0xf4, 0xbb,
+			0x06, 0x96, 0x80, 0x54, 0xe7, 0x45, 0x72, 0x36,
+			0x48, 0x1d, 0xa4, 0x47, 0x93, 0xaa, 0xc1, 0x96,
+			0x2b, 0x97, 0xf1, 0xa7, 0xd2, 0xaf, 0x07, 0xe9,
+			0x03, 0x22, 0x87, 0x50, 0x18, 0x99, 0xdf, 0x38,
+			0x0e, 0x15, 0x3d, 0xf7, 0x76, 0xbb, 0x0e, 0x3e,
+			0xbf, 0x61, 0x4c, 0xd5, 0xd7, 0x51, 0xcb, 0x59,
+			0xc7, 0xfc, 0x3c, 0x29, 0xe9, 0x82, 0xb8, 0xe3,
+			0xa0, 0xb2, 0x62, 0x25, 0x21, 0x22, 0x6b, 0xa3,
+			0x90, 0x05, 0x5c, 0xcc, 0x0c, 0xb3, 0xbd, 0x24,
+			0x3e, 0xa7, 0xc6, 0x1e, 0x2d, 0x5a, 0x60, 0x03,
+			0xc8, 0xde, 0x44, 0xb7, 0xe4, 0x0a, 0xef, 0xa1,
+			0xc5, 0xa0, 0xb2, 0x7b, 0x1e, 0xad, 0x6e, 0x38,
+			0x3e, 0xc5, 0x86, 0x20, 0xb7, 0xa5, 0x31, 0x09,
+			0x70, 0xb5, 0x57, 0x50, 0x66, 0x88, 0xb7, 0xb3,
+			0x33, 0x88, 0xf0, 0x4f, 0xf2, 0xbb, 0x25, 0x75,
+			0xe4, 0x9d, 0x41, 0x91, 0x67, 0x32, 0xce, 0x0d,
+			0x28, 0xe2, 0xc6, 0x3e, 0xa3, 0xde, 0x34, 0x28,
+			0xa2, 0xb9, 0x40, 0xe2, 0x41, 0x04, 0x26, 0x2d,
+			0x2c, 0x29, 0xdb, 0x62, 0xda, 0x66, 0x9b, 0x4a,
+			0x60, 0x41, 0x8c, 0x96, 0xbb, 0x99, 0xd7, 0x32,
+			0x1f, 0xa5, 0x3c, 0x78, 0x4f, 0xe1, 0xeb, 0x0e,
+			0x57, 0x0e, 0xdd, 0x4e, 0x78, 0xf1, 0x65, 0xe5,
+			0x6a, 0xae, 0x8a, 0xcd, 0x4e, 0xd1, 0xe0, 0x08,
+			0xbd, 0xa6, 0x39, 0x41, 0xd9, 0xcf, 0xfe, 0xe9,
+			0xc5, 0xf4, 0xe6, 0x1b, 0xa5, 0xb0, 0xc3, 0x68,
+			0xf6, 0x2c, 0x25, 0x49, 0x28, 0x23, 0x68, 0x8f,
+			0x12, 0x05, 0x32, 0xa3, 0xdc, 0x47, 0xee, 0xe9,
+			0xab, 0xfc, 0xb1, 0x84, 0xf7, 0x26, 0x98, 0x0d,
+			0x93, 0x0a, 0x76, 0xa0, 0x5a, 0x8a, 0xd6, 0x47,
+			0x61, 0x3c, 0x28, 0x68, 0x5d, 0x06, 0xfc, 0x47,
+			0x88, 0x63, 0xc9, 0x7d, 0x94, 0xa1, 0xd2, 0x3a,
+			0xc2, 0xf6, 0x8b, 0xcd, 0x92, 0xbd, 0xa3, 0x0e,
+			0x93, 0xea, 0x7d, 0x55, 0x8d, 0x60, 0x19, 0xf3,
+			0x0a, 0xbb, 0x0e, 0xc8, 0xec, 0x17, 0x3a, 0xdf,
+			0xbd, 0x7f, 0x55, 0x58, 0xbb, 0xf9, 0x6f, 0xf0,
+			0xa3, 0xe8, 0xdf, 0x1d, 0x3e, 0xf7, 0xc7, 0x88,
+			0x85, 0xed, 0x1f, 0x52, 0x06, 0x1e, 0x6b, 0x50,
+			0xf5, 0x1b, 0xb7, 0x37, 0xb5, 0xc2, 0x6e, 0x08,
+			0x03, 0x98, 0xce, 0xcb, 0xc5, 0xff, 0xfa, 0x60,
+			0x2d, 0x0a, 0x8b, 0xaa, 0xd7, 0xb6, 0x02, 0xb2,
+			0x38, 0x76, 0x25, 0xe7, 0x2b, 0xb7, 0x6d, 0xbd,
+			0xc3, 0xc7, 0x71, 0x8f, 0x7c, 0x6c, 0xba, 0xa5,
+			0x5d, 0xcd, 0x77, 0xe3, 0x3c, 0x02, 0xed, 0x39,
+			0xb1, 0x5f, 0xe2, 0x36, 0x31, 0xeb, 0xe7, 0xb5,
+			0x60, 0x5e, 0xe1, 0x30, 0xe5, 0x52, 0x4b, 0x9b,
+			0xa2, 0x66, 0x86, 0xa1, 0x37, 0xaf, 0x47, 0x52,
+			0xd7, 0x02, 0x7d, 0xe2, 0x45, 0x3b, 0xe5, 0xa8,
+			0x7b, 0xda, 0x98, 0x66, 0xc4, 0x14, 0x67, 0x3d,
+			0x39, 0xbc, 0x58, 0x63, 0x52, 0xa6, 0x63, 0x39,
+			0x7e, 0x89, 0xd4, 0xbe, 0x62, 0xfd, 0x06, 0x99,
+			0x92, 0x5a, 0xd2, 0x07, 0x09, 0x56, 0xcd, 0xc9,
+			0x87, 0x6b, 0x4e, 0x4c, 0x3b, 0xfe, 0x8c, 0x27,
+			0xd0, 0x2a, 0xd8, 0x74, 0xa9, 0x87, 0x51, 0x3a,
+			0x23, 0xd8, 0xc0, 0x2d, 0xa9, 0xad, 0xe8, 0x08,
+			0x68, 0x21, 0xd4, 0x35, 0xdf, 0x83, 0xd3, 0x43,
+			0xe2, 0xf8, 0xaa, 0x82, 0xcf, 0x89, 0x1a, 0x2c,
+			0x0a, 0xbf, 0x7f, 0x1e, 0x63, 0x20, 0x36, 0x9c,
+			0x3c, 0x9f, 0x2c, 0x0a, 0xab, 0x80, 0x23, 0x4f,
+			0xf3, 0xc1, 0x45, 0x28, 0x28, 0x50, 0xac, 0xf8,
+			0x64, 0xed, 0x6a, 0xac, 0x10, 0x49, 0xd7, 0x4d,
+			0x93, 0x49, 0xcd, 0xab, 0x3b, 0x0e, 0xe0, 0x61,
+			0xa6, 0x09, 0x0c, 0xbf, 0x18, 0x0d, 0x72, 0x01,
+			0x22, 0xf6, 0xdf, 0xbf, 0xd1, 0x9e, 0x74, 0x90,
+			0xb7, 0xd5, 0x32, 0xa3, 0xf2, 0x31, 0xac, 0xdc,
+			0xcb, 0x4a, 0xca, 0xb8, 0x6f, 0x89, 0x81, 0x65,
+			0xab, 0x32, 0x5f, 0x52, 0x55, 0x7c, 0xe7, 0x18,
+			0x60, 0x1c, 0x99, 0x64, 0x6d, 0x3b, 0xaa, 0xdf,
+			0x03, 0x89, 0x62, 0xeb, 0x39, 0xda, 0x6a, 0xee,
+			0x4f, 0xe0, 0x17, 0x5d, 0x94, 0x87, 0x1e, 0xdf,
+			0x74, 0xb2, 0x54, 0x58, 0x60, 0xf6, 0x9b, 0x8c,
+			0x45, 0x23, 0x65, 0xcb, 0x23, 0x7b, 0x27, 0x35,
+			0xe1, 0x1f, 0x31, 0x26, 0xa5, 0xde, 0x04, 0x1d,
+			0x26, 0xf9, 0x21, 0xf8, 0x7e, 0x20, 0xc5, 0x40,
+			0xbe, 0xf5, 0x71, 0xd1, 0x2f, 0x06, 0xa2, 0x59,
+			0x19, 0x72, 0xc8, 0xf6, 0x41, 0x66, 0xe1, 0xa7,
+			0xfa, 0x58, 0x99, 0x99, 0x0c, 0xd2, 0xde, 0x29,
+			0xc5, 0x12, 0x82, 0x08, 0x64, 0xd5, 0x8d, 0xd0,
+			0xa9, 0xd1, 0xf6, 0xaf, 0x49, 0x69, 0x98, 0x3f,
+			0xf7, 0xc9, 0xcb, 0xe3, 0x02, 0xb3, 0x25, 0xc2,
+			0x85, 0x2c, 0xec, 0x29, 0x45, 0x23, 0xae, 0x33,
+			0xd6, 0xae, 0x11, 0xb9, 0x97, 0xe5, 0xeb, 0xf9,
+			0xe7, 0x25, 0x9c, 0x99, 0xfb, 0x74, 0x4b, 0x1b,
+			0xd2, 0xf8, 0xd9, 0xce, 0xf3, 0x7f, 0x8f, 0x1a,
+			0x4a, 0x6f, 0x72, 0xf5, 0x45, 0x5f, 0x8a, 0x60,
+			0x88, 0x66, 0xf9, 0x2b, 0x1a, 0xe5, 0x71, 0x07,
+			0xa4, 0x72, 0x98, 0x40, 0x4b, 0xb5, 0x6e, 0xd6,
+			0x3d, 0x39, 0x47, 0x77, 0x77, 0x86, 0xec, 0x54,
+			0x83, 0x7f, 0xe9, 0x0a, 0xa4, 0x0e, 0xa1, 0x3b,
+			0x3f, 0x5d, 0x26, 0x4b, 0x30, 0x53, 0x8a, 0xad,
+			0xf8, 0x2d, 0x0f, 0x1f, 0x9e, 0x64, 0xb2, 0x4e,
+			0x9f, 0x71, 0x81, 0x22, 0x3b, 0x35, 0x07, 0x08,
+			0x7e, 0x02, 0xdb, 0xac, 0xbf, 0x7c, 0x17, 0x3f,
+			0x26, 0xcf, 0xb0, 0xf7, 0x55, 0x51, 0x02, 0x8f,
+			0x91, 0xc2, 0xf8, 0x26, 0xfd, 0x0a, 0x98, 0x2e,
+			0xcf, 0xed, 0x6f, 0xd4, 0x09, 0x1b, 0xea, 0x59,
+			0xba, 0xad, 0x3e, 0x80, 0x4d, 0xb1, 0xf3, 0xb5,
+			0x5d, 0x4c, 0x55, 0xcb, 0x4e, 0x7e, 0xb3, 0x32,
+			0xcf, 0x50, 0x72, 0x66, 0xbb, 0xcb, 0x25, 0xf5,
+			0xc6, 0xab, 0x03, 0xa2, 0x8a, 0x00, 0x72, 0xcb,
+			0xb7, 0xc5, 0x72, 0xf2, 0xfe, 0xef, 0xf9, 0xac,
+			0x40, 0xf3, 0xfb, 0x46, 0x78, 0xa9, 0x8f, 0xc2,
+			0x5f, 0x9f, 0x8c, 0xba, 0xc0, 0xee, 0xbf, 0x71,
+			0x7d, 0xc2, 0x58, 0x7d, 0xdc, 0xe4, 0x7b, 0x1b,
+			0xe2, 0xce, 0x57, 0xd2, 0xc4, 0xb0, 0xcd, 0x97,
+			0xbb, 0x6a, 0x34, 0xc8, 0xdc, 0x31, 0xf3, 0xcd,
+			0x80, 0x6f, 0x36, 0x22, 0xb4, 0x03, 0x3b, 0x75,
+			0xab, 0x27, 0x91, 0xb8, 0x1d, 0x97, 0x32, 0xdd,
+			0xca, 0xee, 0xe3, 0x6b, 0x2d, 0x04, 0xaf, 0x58,
+			0x46, 0x8c, 0xeb, 0x6c, 0x3e, 0xed, 0xdd, 0x87,
+			0x00, 0x46, 0xe1, 0xf8, 0x9d, 0x35, 0x7a, 0x98,
+			0xa6, 0x57, 0x8a, 0x04, 0x92, 0x08, 0xb2, 0x7d,
+			0x80, 0x26, 0xd9, 0x9a, 0x6f, 0x6f, 0x85, 0x29,
+			0xc1, 0x7f, 0x49, 0x88, 0x26, 0x91, 0x1e, 0x50,
+			0xe0, 0x8a, 0xdf, 0x6c, 0xcc, 0xb6, 0xc8, 0xfb,
+			0x53, 0xcf, 0x02, 0x79, 0x1f, 0x0a, 0xe2, 0x38,
+			0xeb, 0xde, 0x3b, 0x7d, 0xb6, 0xa2, 0xf4, 0x0f,
+			0x2b, 0x28, 0x48, 0xdc, 0x3b, 0xef, 0xa5, 0xd9,
+			0x9d, 0x37, 0xae, 0x1c, 0x72, 0xb3, 0x3f, 0xd9,
+			0x19, 0x12, 0xc6, 0x42, 0xf4, 0x58, 0x37, 0x06,
+			0x69, 0xcd, 0x69, 0x69, 0x21, 0x86, 0x94, 0x83,
+			0x30, 0xea, 0x00, 0xa6, 0xa1, 0x5b, 0xa3, 0xb6,
+			0xcc, 0xa4, 0x19, 0x28, 0xd1, 0x4a, 0x66, 0x2e,
+			0xa6, 0xbc, 0x3b, 0x5a, 0xf8, 0xb0, 0x44, 0x4c,
+			0xf0, 0xd9, 0xf0, 0x94, 0x50, 0xca, 0xb6, 0x1b,
+			0xb1, 0x96, 0x35, 0xe2, 0x88, 0x07, 0x95, 0x72,
+			0x92, 0x27, 0xdb, 0x0a, 0x23, 0x61, 0x86, 0xf1,
+			0x13, 0xc1, 0xc9, 0x1a, 0xb2, 0xc9, 0x34, 0x54,
+			0x3a, 0x33, 0x30, 0xe4, 0xde, 0xb2, 0x39, 0xc4,
+			0x88, 0xb3, 0x0a, 0x95, 0xa1, 0xcc, 0x18, 0x4d,
+			0xe0, 0x2b, 0xf1, 0x12, 0x1e, 0x04, 0xe0, 0x44,
+			0xf7, 0xcc, 0xeb, 0x28, 0xf8, 0x0e, 0x2e, 0xb8,
+			0xdc, 0xb1, 0x87, 0xa5, 0x5a, 0xa8, 0x22, 0x65,
+			0xa8, 0x6b, 0x75, 0x1b, 0x02, 0xdd, 0x29, 0x2e,
+			0x32, 0x27, 0xca, 0x63, 0x0c, 0x0b, 0x45, 0xff,
+			0x58, 0x7b, 0xe7, 0x5d, 0xd5, 0x9c, 0x16, 0x5d,
+			0x3b, 0x06, 0x3a, 0x65, 0xa9, 0x16, 0x22, 0x2e,
+			0x2a, 0x89, 0xb1, 0xc1, 0xd3, 0x7c, 0xed, 0x4d,
+			0x75, 0x92, 0x70, 0xfc, 0x56, 0x68, 0xbc, 0x89,
+			0x75, 0x46, 0x25, 0x18, 0x78, 0x25, 0x7c, 0x8c,
+			0x10, 0xbc, 0x57, 0x07, 0x7e, 0x2b, 0x22, 0x59,
+			0x4e, 0xa4, 0x3a, 0x3a, 0x4e, 0x3b, 0x0b, 0x15,
+			0xba, 0xc9, 0x3f, 0xe5, 0xca, 0x20, 0x95, 0xc0,
+			0x27, 0xbe, 0x92, 0xfb, 0x1c, 0xf7, 0xaa, 0xf6,
+			0x5b, 0x03, 0x69, 0x95, 0x84, 0xc5, 0x85, 0x4f,
+			0x60, 0x67, 0x17, 0x4a, 0x35, 0x08, 0x2c, 0xe8,
+			0xb2, 0x4a, 0x34, 0x40, 0xc0, 0x64, 0x0a, 0x27,
+			0x53, 0xe7, 0x1c, 0xc9, 0xb6, 0x59, 0xf2, 0x9a,
+			0x3e, 0x51, 0x1f, 0x88, 0xef, 0x4b, 0x59, 0xcc,
+			0xe7, 0xf3, 0xa4, 0x41, 0x02, 0x6d, 0x20, 0xc4,
+			0xe2, 0x3b, 0x11, 0x5e, 0x04, 0x6f, 0xd7, 0x08,
+			0x82, 0x07, 0x36, 0x27, 0xdb, 0x79, 0x09, 0xcf,
+			0xac, 0x31, 0xcb, 0xf6, 0x53, 0x1c, 0x3a, 0x69,
+			0xaa, 0x73, 0xa7, 0x5d, 0x3d, 0x4a, 0xa4, 0x1e,
+			0xd2, 0x22, 0x78, 0xf6, 0x16, 0x03, 0xe9, 0xde,
+			0x20, 0xa8, 0xd3, 0x6f, 0x6a, 0xb7, 0x3d, 0x1c,
+			0xf5, 0x60, 0xa9, 0x85, 0xe2, 0xd7, 0x03, 0xc0,
+			0x2d, 0xf3, 0x27, 0x37, 0x84, 0x02, 0x0f, 0x30,
+			0xdb, 0x5d, 0x62, 0x2f, 0xea, 0x60, 0x0d, 0x06,
+			0x04, 0x4a, 0xfd, 0x7c, 0x26, 0xd0, 0xa8, 0x50,
+			0x59, 0x6b, 0xb8, 0x58, 0x41, 0xd0, 0x95, 0x9e,
+			0x22, 0xd8, 0xb5, 0x3f, 0x21, 0x9b, 0xd2, 0x52,
+			0xf1, 0xac, 0x3e, 0x89, 0x1c, 0x28, 0xb5, 0x80,
+			0xbc, 0x90, 0x1f, 0x3a, 0x81, 0x2e, 0x3f, 0x33,
+			0x2c, 0xaf, 0xbc, 0xdd, 0x40, 0x24, 0x20, 0xbb,
+			0xaf, 0x68, 0x73, 0xca, 0x1c, 0x65, 0x4c, 0xb9,
+			0x59, 0x66, 0x78, 0x3b, 0xb1, 0xe7, 0x64, 0xbd,
+			0x37, 0x02, 0x81, 0xbf, 0xac, 0xfe, 0x53, 0x98,
+			0x62, 0x2e, 0x55, 0x02, 0x79, 0x5f, 0xbd, 0x83,
+			0x8e, 0xa6, 0xea, 0xf7, 0xd2, 0x0f, 0x8d, 0x92,
+			0xf6, 0xe6, 0x94, 0xab, 0x63, 0xfd, 0x50, 0x80,
+			0x74, 0xca, 0xc9, 0x5f, 0x79, 0x8c, 0x9a, 0x01,
+			0x42, 0x6e, 0x21, 0x8a, 0xaa, 0x38, 0x2b, 0x70,
+			0x5e, 0xc8, 0x3c, 0x6c, 0x32, 0x58, 0xee, 0x37,
+			0xde, 0xd3, 0x77, 0x61, 0x79, 0xe5, 0x62, 0x79,
+			0x6e, 0xb0, 0xa9, 0xac, 0x5e, 0x76, 0x3f, 0xce,
+			0x13, 0x7c, 0x8f, 0x72, 0x3a, 0x47, 0x2a, 0x6d,
+			0x86, 0x44, 0x02, 0xde, 0x53, 0xf6, 0x22, 0x93,
+			0x21, 0x3e, 0x77, 0xca, 0x66, 0x98, 0x7a, 0x3a,
+			0x5e, 0xfd, 0x19, 0xc4, 0x27, 0x5f, 0x5c, 0x6c,
+			0xf6, 0xdc, 0x87, 0x8e, 0x44, 0x63, 0x4b, 0xe8,
+			0xcb, 0xa8, 0x2e, 0x51, 0x70, 0x70, 0xe5, 0x17,
+			0x64, 0x85, 0x85, 0x78, 0xd9, 0xd5, 0x71, 0xf0,
+			0x30, 0x13, 0xa0, 0x35, 0xee, 0xcf, 0xb2, 0x54,
+			0x94, 0xe9, 0x66, 0xfe, 0xf1, 0xe2, 0x9c, 0xce,
+			0x84, 0x85, 0x7b, 0x48, 0x49, 0x89, 0x32, 0x9a,
+			0x74, 0x26, 0xe5, 0x51, 0xcb, 0xa6, 0x1d, 0x70,
+			0x94, 0x6d, 0x4c, 0x5c, 0x22, 0x7c, 0xb4, 0xd3,
+			0x8f, 0xb1, 0x85, 0x1a, 0x0a, 0x2c, 0xde, 0x0b,
+			0xa1, 0xf6, 0xd7, 0x65, 0x15, 0x84, 0xfe, 0x9e,
+			0x53, 0xa3, 0x5d, 0xef, 0x14, 0xc8, 0xd1, 0x7a,
+			0x30, 0x0a, 0x70, 0xb2, 0xb4, 0x95, 0xd7, 0x27,
+			0x84, 0x67, 0xa0, 0xeb, 0x1a, 0x44, 0xaa, 0xa8,
+			0x59, 0xef, 0x6b, 0x2a, 0x59, 0x35, 0xe0, 0x69,
+			0xf4, 0xaa, 0xe9, 0x04, 0x03, 0xb9, 0xa0, 0x9e,
+			0x42, 0xa0, 0x11, 0xea, 0x8d, 0x3f, 0xd1, 0x53,
+			0xfc, 0xc0, 0xe0, 0x7f, 0x5a, 0x36, 0x54, 0x51,
+			0x5d, 0x3d, 0xbc, 0xf1, 0x24, 0xc2, 0x67, 0x39,
+			0xde, 0xb4, 0xc2, 0x54, 0x74, 0xd5, 0x31, 0x4f,
+			0xf3, 0x66, 0x59, 0xda, 0xd3, 0x9c, 0x42, 0xa0,
+			0x2c, 0x2c, 0xcf, 0x33, 0x63, 0x57, 0xc1, 0xb2,
+			0x49, 0x43, 0x41, 0x0c, 0x08, 0x7c, 0x9d, 0x4a,
+			0x78, 0xfe, 0x64, 0x37, 0xb2, 0x4a, 0x3a, 0x60,
+			0xc8, 0x4d, 0x84, 0xf6, 0xac, 0xc6, 0x7f, 0xbd,
+			0x39, 0x19, 0x4b, 0x28, 0x6d, 0xd3, 0xd6, 0xf6,
+			0xe8, 0x85, 0x16, 0xf8, 0xb4, 0xc8, 0xc6, 0x64,
+			0xd0, 0xc2, 0xf2, 0xb0, 0x47, 0x56, 0x60, 0xa6,
+			0x37, 0x04, 0xa2, 0x87, 0xfc, 0x00, 0xb9, 0x8b,
+			0x96, 0x15, 0xad, 0xdd, 0xcb, 0xbb, 0xba, 0xda,
+			0x1a, 0xd9, 0x63, 0xc9, 0x90, 0xe0, 0x1f, 0x04,
+			0xf3, 0xaf, 0x9f, 0xe7, 0x47, 0xea, 0x14, 0xa3,
+			0xec, 0x8e, 0x29, 0x49, 0x04, 0x6f, 0xda, 0xf6,
+			0xe0, 0xf7, 0x68, 0x67, 0x9b, 0x2a, 0x51, 0xe0,
+			0xa0, 0xd4, 0xa0, 0x19, 0xef, 0x6d, 0x0f, 0xfa,
+			0x7f, 0x86, 0xfa, 0x9b, 0x0c, 0x21, 0x86, 0x4f,
+			0xc4, 0x42, 0x4a, 0xcc, 0x40, 0x96, 0xa1, 0x24,
+			0x81, 0xb9, 0x28, 0xe0, 0x1b, 0x59, 0xc7, 0x5e,
+			0x13, 0x3e, 0x8a, 0xe5, 0xca, 0x63, 0xfe, 0x06,
+			0x9d, 0xad, 0x69, 0x26, 0xb5, 0xf9, 0x9e, 0x42,
+			0x69, 0x32, 0x27, 0x01, 0xdb, 0xd8, 0xc2, 0x6e,
+			0x9f, 0x19, 0x85, 0xb4, 0x1b, 0x31, 0x7d, 0xb9,
+			0xa0, 0x50, 0xda, 0xf8, 0x2d, 0xdf, 0x1a, 0xdd,
+			0x81, 0x11, 0xb9, 0x30, 0xe2, 0xae, 0xb7, 0x04,
+			0xf8, 0x15, 0x5f, 0xaa, 0x5d, 0x4c, 0x0f, 0xc8,
+			0x24, 0x53, 0xb9, 0xae, 0x9f, 0x49, 0xa7, 0xa9,
+			0x41, 0xb8, 0xb1, 0xc5, 0xfb, 0xc3, 0x8b, 0x39,
+			0xea, 0xa0, 0x21, 0x15, 0x68, 0xcc, 0x57, 0xdb,
+			0xd2, 0x88, 0x65, 0x66, 0x5c, 0xe5, 0x99, 0x4e,
+			0xc1, 0x99, 0x6e, 0x6b, 0xb3, 0x04, 0xfb, 0xf7,
+			0x11, 0x15, 0x81, 0xa9, 0x06, 0x73, 0x3d, 0x95,
+			0x5a, 0xad, 0x66, 0xb5, 0xf1, 0x86, 0xa8, 0x83,
+			0x05, 0xd7, 0x40, 0x0b, 0xaa, 0x53, 0x85, 0x94,
+			0xc3, 0x48, 0x2a, 0x76, 0x22, 0x7d, 0x53, 0x13,
+			0x53, 0x1d, 0x14, 0x38, 0x50, 0xa6, 0x89, 0x76,
+			0x4e, 0xad, 0xbc, 0x74, 0x54, 0xe6, 0x4a, 0x0a,
+			0x9f, 0x5e, 0xdf, 0xc7, 0x1b, 0x30, 0xc4, 0x69,
+			0x19, 0x4d, 0x28, 0x30, 0xfd, 0xbd, 0x9f, 0xf1,
+			0xca, 0xd4, 0xbb, 0x14, 0x33, 0xae, 0xe1, 0xf7,
+			0x0d, 0xe7, 0xde, 0xff, 0x3d, 0x1d, 0x80, 0x0a,
+			0xac, 0x3d, 0xc6, 0x8f, 0x55, 0x9a, 0x56, 0x80,
+			0x83, 0xe5, 0xeb, 0x10, 0xce, 0x5a, 0x32, 0xe8,
+			0xd3, 0xb8, 0xdb, 0x0f, 0xfd, 0x3c, 0x7f, 0x32,
+			0x0a, 0xa8, 0x3a, 0xd5, 0x60, 0x71, 0x19, 0x40,
+			0x59, 0x83, 0x11, 0x07, 0x5a, 0xb4, 0xf4, 0x0f,
+			0x9b, 0x31, 0xe0, 0x3e, 0x77, 0x6e, 0xf6, 0x15,
+			0xe3, 0x11, 0x90, 0xf1, 0x98, 0x71, 0x99, 0x66,
+			0x97, 0xe1, 0xc0, 0x77, 0xac, 0xe4, 0x0d, 0xb5,
+			0x97, 0x5c, 0x7d, 0x37, 0xf5, 0xa1, 0x40, 0xaf,
+			0x38, 0xf7, 0x10, 0x51, 0x18, 0xe8, 0xee, 0xc8,
+			0x9d, 0x25, 0xdb, 0xbb, 0x27, 0xf5, 0xd4, 0x32,
+			0x0d, 0xe9, 0xa0, 0xea, 0x42, 0x11, 0xc2, 0x3f,
+			0x64, 0x90, 0x03, 0x54, 0xfc, 0x24, 0xeb, 0x0b,
+			0x9d, 0x40, 0x88, 0x6c, 0xe8, 0x48, 0x35, 0x20,
+			0xde, 0xc7, 0xa2, 0xcf, 0x3c, 0x77, 0xaf, 0x69,
+			0x17, 0x87, 0x25, 0xe7, 0x7b, 0xb8, 0x99, 0x51,
+			0xb4, 0x2d, 0x1f, 0x3f, 0x34, 0x22, 0x40, 0xf9,
+			0xc6, 0x87, 0x95, 0x61, 0x14, 0xc0, 0x94, 0xc4,
+			0x75, 0xb4, 0x60, 0x41, 0xea, 0x65, 0xe6, 0x89,
+			0xff, 0x30, 0x62, 0x53, 0xde, 0x63, 0x20, 0xe3,
+			0xcd, 0x0e, 0xf3, 0x2c, 0xe5, 0x77, 0x73, 0xd7,
+			0xfe, 0x17, 0x9d, 0xec, 0x8c, 0x9c, 0x37, 0xce,
+			0xde, 0x55, 0x18, 0x12, 0xed, 0x02, 0x6f, 0x30,
+			0x16, 0x8d, 0x56, 0x6f, 0xe6, 0x4e, 0x17, 0x8b,
+			0x76, 0x42, 0x75, 0x0f, 0xf2, 0x27, 0xd5, 0xa8,
+			0x29, 0x3d, 0xf4, 0x9c, 0x50, 0x69, 0x6b, 0x34,
+			0xb3, 0x1c, 0x1b, 0xfd, 0xce, 0xf5, 0xf8, 0x7f,
+			0x11, 0x64, 0xf0, 0x53, 0x3a, 0x51, 0x91, 0x1a,
+			0x31, 0xba, 0x1e, 0x85, 0x00, 0x97, 0x69, 0x1e,
+			0x95, 0x38, 0x54, 0x3d, 0xb3, 0xb5, 0x5f, 0x17,
+			0x57, 0x72, 0xc4, 0xba, 0x08, 0x0d, 0xbf, 0x65,
+			0xb3, 0xcf, 0xee, 0x68, 0xb4, 0x60, 0xd9, 0x91,
+			0x7e, 0x79, 0x10, 0x6f, 0xb1, 0x61, 0x73, 0x38,
+			0xc0, 0x8f, 0x0c, 0xd6, 0x5b, 0xf9, 0x24, 0xb0,
+			0xe7, 0xdc, 0xbb, 0xa5, 0xb7, 0x6e, 0x1c, 0xb9,
+			0x44, 0x96, 0x1b, 0x87, 0x7a, 0xa8, 0x45, 0xd8,
+			0x95, 0x81, 0x5c, 0x26, 0x20, 0x5a, 0x14, 0xc1,
+			0xc4, 0x87, 0xa3, 0x7c, 0x43, 0x14, 0x05, 0x1a,
+			0x62, 0xa5, 0xa7, 0x88, 0x31, 0x99, 0xfd, 0x7f,
+			0x85, 0x06, 0xe7, 0xb8, 0x83, 0x66, 0xaf, 0x63,
+			0x71, 0xd0, 0xdc, 0x5f, 0x59, 0x96, 0x48, 0xb0,
+			0xf1, 0x7b, 0x79, 0x44, 0x34, 0xc8, 0xc6, 0x79,
+			0x6c, 0x1a, 0x45, 0xe5, 0x19, 0x4c, 0xc1, 0xe7,
+			0x1e, 0xae, 0xb1, 0x40, 0x32, 0x4c, 0x23, 0xb3,
+			0xca, 0xee, 0xa5, 0xe8, 0x15, 0x10, 0x89, 0xc8,
+			0x5e, 0x5f, 0xbc, 0x81, 0xf4, 0x84, 0xab, 0x2a,
+			0x77, 0xcf, 0x4c, 0x19, 0x58, 0x37, 0xf1, 0xed,
+			0xd1, 0xb6, 0xac, 0x5a, 0x6e, 0x56, 0xb4, 0x1c,
+			0xf7, 0xb2, 0xcc, 0x58, 0x2c, 0xb9, 0x53, 0x69,
+			0xba, 0xcb, 0x27, 0xa2, 0x24, 0x19, 0xff, 0xbe,
+			0x68, 0x0e, 0xa7, 0x3f, 0xef, 0x3c, 0xa8, 0xc9,
+			0x06, 0xd8, 0xa7, 0xba, 0x57, 0x5c, 0x59, 0x56,
+			0xb0, 0xcd, 0x59, 0x06, 0x2c, 0xf6, 0x54, 0xb6,
+			0x5b, 0xd9, 0x86, 0x9d, 0xcd, 0x92, 0xff, 0x15,
+			0xc5, 0xdd, 0x5c, 0x08, 0x7c, 0x93, 0x88, 0x4f,
+			0xb1, 0x38, 0x84, 0x69, 0x2e, 0x0d, 0xf2, 0x53,
+			0xe0, 0x6d, 0xea, 0x31, 0x85, 0x0d, 0x45, 0x6f,
+			0x55, 0x89, 0x1e, 0x7c, 0xc4, 0x41, 0x40, 0x97,
+			0xe7, 0xa3, 0x5a, 0x04, 0x03, 0x76, 0xf1, 0x1d,
+			0x55, 0x40, 0xee, 0xb9, 0x99, 0x06, 0x4b, 0x81,
+			0x76, 0x37, 0x29, 0x34, 0x9b, 0x7b, 0x81, 0x58,
+			0xfc, 0x83, 0x8c, 0x4d, 0xb4, 0x4d, 0xec, 0x4d,
+			0xd8, 0xa7, 0x2d, 0xbe, 0xa4, 0x8c, 0xa6, 0xcc,
+			0x30, 0x5a, 0x7a, 0xb3, 0x83, 0x3a, 0xb9, 0xbd,
+			0x39, 0xc7, 0x4d, 0x93, 0xae, 0x6f, 0x8a, 0xf4,
+			0xfb, 0x97, 0x59, 0x36, 0xae, 0xf0, 0x9e, 0x38,
+			0x91, 0x97, 0xff, 0x25, 0x9c, 0xd0, 0x91, 0x44,
+			0x93, 0x0e, 0x24, 0xc5, 0xc0, 0x9e, 0x03, 0xd4,
+			0xe2, 0x09, 0xe8, 0x39, 0x87, 0xb2, 0x32, 0x60,
+			0x93, 0x58, 0x75, 0x19, 0x02, 0x07, 0x6c, 0xc1,
+			0xcf, 0x32, 0x2d, 0xcb, 0x7b, 0x77, 0xf0, 0x7b,
+			0x59, 0x2d, 0xbc, 0x4f, 0x0e, 0x86, 0xfe, 0x39,
+			0x75, 0x04, 0xc9, 0xee, 0xe0, 0xb3, 0x4d, 0xcc,
+			0x9d, 0xdb, 0xf6, 0xb1, 0x0a, 0xbd, 0x7a, 0x36,
+			0xbd, 0x04, 0xe7, 0xcd, 0x5d, 0x58, 0x58, 0x2e,
+			0x15, 0x0e, 0x0b, 0xd1, 0xe8, 0x5e, 0x1f, 0x6f,
+			0x84, 0x6a, 0xc9, 0x06, 0x63, 0x07, 0x77, 0x6c,
+			0xb8, 0xf1, 0x21, 0x74, 0xd6, 0x54, 0x72, 0x00,
+			0x07, 0xc5, 0x58, 0x82, 0x57, 0x31, 0xff, 0x47,
+			0xc4, 0xb5, 0xe4, 0x4b, 0xc3, 0xc1, 0x14, 0x93,
+			0x6e, 0x34, 0xf9, 0x3c, 0xa8, 0x34, 0xa2, 0x84,
+			0xbb, 0x16, 0x70, 0xe9, 0x7d, 0x85, 0x38, 0xfc,
+			0xbd, 0xf0, 0xc6, 0x28, 0x76, 0x57, 0xcc, 0x58,
+			0x56, 0x29, 0x5b, 0xd3, 0xf1, 0x49, 0x8c, 0x1e,
+			0x1b, 0xcb, 0x09, 0x9a, 0x51, 0x3b, 0x81, 0x03,
+			0x41, 0xad, 0xc0, 0x00, 0xc4, 0x7e, 0x78, 0xc7,
+			0xab, 0xc6, 0xc6, 0x6f, 0xb1, 0xf0, 0xb4, 0xd1,
+			0xb8, 0x06, 0x8b, 0x74, 0xf5, 0x33, 0x56, 0x02,
+			0x87, 0x3c, 0x91, 0xf4, 0x3f, 0xe8, 0x70, 0x4c,
+			0xf4, 0x7f, 0xa4, 0x3c, 0xb2, 0x7b, 0x27, 0xdb,
+			0xa6, 0x9d, 0x65, 0xe5, 0xfc, 0x31, 0x4c, 0x0b,
+			0x51, 0x21, 0x45, 0xfc, 0x54, 0x3c, 0x92, 0x7a,
+			0x2f, 0x87, 0x8c, 0xa3, 0x6b, 0x8a, 0x1d, 0xfb,
+			0x74, 0xfe, 0xa6, 0xb3, 0x82, 0x53, 0xbe, 0xba,
+			0xf1, 0x6b, 0x0b, 0x77, 0x96, 0x16, 0x59, 0xab,
+			0xd0, 0x05, 0xfb, 0x2f, 0x0b, 0xaf, 0xbe, 0xe5,
+			0x75, 0xae, 0xda, 0x3c, 0xac, 0xc8, 0xaa, 0xec,
+			0x6e, 0xec, 0xa5, 0xf4, 0xe2, 0x5e, 0x70, 0x02,
+			0x61, 0xbd, 0x69, 0x1a, 0x83, 0xc0, 0x5d, 0x95,
+			0xdf, 0x06, 0x7f, 0x1b, 0x4e, 0xe6, 0x59, 0x7f,
+			0x25, 0xfd, 0xac, 0x1e, 0x5c, 0x14, 0xfe, 0x38,
+			0x77, 0x6b, 0xc3, 0x6d, 0x7d, 0x66, 0xa2, 0x00,
+			0x41, 0xa3, 0x79, 0x23, 0xc8, 0x46, 0x29, 0xe1,
+			0x53, 0x2d, 0x85, 0x18, 0x6f, 0xe2, 0x12, 0xb2,
+			0x59, 0x0d, 0x8c, 0xe6, 0xf7, 0x2c, 0x94, 0xd2,
+			0x91, 0x68, 0x89, 0x53, 0x80, 0x9d, 0x8a, 0xc2,
+			0xfb, 0x17, 0xb2, 0x3f, 0xc2, 0x6b, 0xa3, 0x64,
+			0xaf, 0xd8, 0xfa, 0xf9, 0x3f, 0xb7, 0xd9, 0xf5,
+			0xad, 0x2a, 0x50, 0x21, 0xa6, 0x57, 0x4d, 0x7a,
+			0xd7, 0x29, 0xc5, 0xd6, 0x00, 0x57, 0xa5, 0x25,
+			0xc6, 0x85, 0x4f, 0xbe, 0x69, 0xa1, 0x73, 0xa8,
+			0xff, 0x5a, 0x30, 0xc6, 0x75, 0xb5, 0x85, 0xa7,
+			0x3a, 0x56, 0x09, 0x81, 0xb6, 0x66, 0x0a, 0x6b,
+			0x67, 0x0d, 0xec, 0xca, 0x8f, 0x77, 0xe5, 0x15,
+			0x2f, 0xba, 0x4d, 0x4e, 0x3b, 0xe8, 0xc8, 0xeb,
+			0xff, 0x79, 0x0b, 0x00, 0xe4, 0x0d, 0x1a, 0x2a,
+			0x21, 0xb6, 0xaf, 0x8c, 0x65, 0x53, 0x47, 0xf3,
+			0x02, 0x2d, 0xe0, 0x09, 0x06, 0xa8, 0x5b, 0xce,
+			0xa4, 0xc2, 0xef, 0x9c, 0x0a, 0xc1, 0xea, 0x7d,
+			0x99, 0x31, 0x1b, 0x4b, 0xb6, 0x78, 0xa6, 0x8d,
+			0x3b, 0x93, 0xae, 0xe7, 0x22, 0xfd, 0xe4, 0x1f,
+			0xa5, 0xff, 0x6c, 0x67, 0xb4, 0x21, 0x06, 0x68,
+			0xef, 0x31, 0xc5, 0xe2, 0x81, 0x11, 0xbd, 0x02,
+			0x4d, 0xa3, 0x2b, 0x69, 0x14, 0xd0, 0xdc, 0x85,
+			0x12, 0xb1, 0x7d, 0x4e, 0x3b, 0xff, 0x8c, 0xe6,
+			0xc8, 0x32, 0xa9, 0x8c, 0x41, 0xba, 0x2d, 0x5e,
+			0x27, 0xb1, 0xad, 0x14, 0x8f, 0x8d, 0x2a, 0x3b,
+			0xf5, 0x8e, 0x70, 0x92, 0xc1, 0x5d, 0xd9, 0x7b,
+			0xc1, 0x83, 0x89, 0x32, 0x73, 0x0e, 0x88, 0xfc,
+			0xfe, 0xc0, 0x64, 0x2e, 0x27, 0xb0, 0xbe, 0xb2,
+			0x65, 0x02, 0xb1, 0x11, 0x66, 0x28, 0x7f, 0x03,
+			0x2b, 0xfc, 0x4a, 0x39, 0x35, 0x21, 0x54, 0x60,
+			0x83, 0x7e, 0xc2, 0x86, 0x84, 0x48, 0x5b, 0x43,
+			0xe4, 0x9c, 0x60, 0xe7, 0x8d, 0x8d, 0xf9, 0x26,
+			0xd4, 0xf0, 0x1b, 0xb6, 0xbd, 0xd8, 0xc3, 0x54,
+			0x3e, 0x1a, 0xcd, 0x2e, 0x7c, 0x57, 0x78, 0xd7,
+			0x8e, 0xbf, 0x92, 0xeb, 0x97, 0x16, 0xbe, 0xd3,
+			0xe4, 0x31, 0xf9, 0x8c, 0x8f, 0xfe, 0x56, 0x28,
+			0xdc, 0xe7, 0x15, 0x12, 0x4e, 0x0a, 0x3a, 0x29,
+			0xf6, 0xb3, 0x57, 0xcb, 0xfa, 0x4e, 0x89, 0x45,
+			0x4b, 0x2c, 0x81, 0xa3, 0xee, 0xff, 0x9b, 0xcb,
+			0x1b, 0xbb, 0x26, 0xba, 0x4f, 0x99, 0x7f, 0xc5,
+			0xb2, 0x9d, 0xc2, 0xb1, 0xa3, 0xce, 0x37, 0x97,
+			0xae, 0x9f, 0xb7, 0x85, 0xb4, 0x3b, 0x39, 0xc7,
+			0xea, 0x00, 0x09, 0x41, 0x60, 0xc1, 0x7d, 0x9b,
+			0xfa, 0x3c, 0xe6, 0x8b, 0x60, 0xa3, 0x5c, 0x48,
+			0xd9, 0x88, 0xba, 0x0a, 0x70, 0x69, 0xf6, 0x85,
+			0x02, 0x79, 0x5b, 0x00, 0x48, 0x7a, 0xd5, 0x1c,
+			0x62, 0x4a, 0x6a, 0x8a, 0xf4, 0xf4, 0xb3, 0x44,
+			0x1f, 0x6d, 0xc1, 0x16, 0x37, 0x72, 0x2d, 0xb4,
+			0x4b, 0x07, 0x07, 0x17, 0xff, 0xfe, 0x52, 0x84,
+			0x0a, 0x3c, 0x02, 0x34, 0xdf, 0x10, 0x96, 0x95,
+			0xd5, 0x58, 0x78, 0xac, 0x95, 0x69, 0x25, 0xc0,
+			0x72, 0xeb, 0xa9, 0x78, 0x48, 0x5d, 0xa4, 0x12,
+			0xea, 0xba, 0xbd, 0x3f, 0x04, 0x08, 0x0b, 0x89,
+			0xf0, 0xb4, 0xa7, 0xb0, 0x15, 0xa5, 0xb5, 0xf4,
+			0x5b, 0xcf, 0x4b, 0x75, 0x09, 0xac, 0xe8, 0x1a,
+			0xa8, 0x78, 0x54, 0xb1, 0x1b, 0x85, 0x3f, 0xd4,
+			0x8a, 0xd8, 0x90, 0xa9, 0xa1, 0x09, 0x76, 0xfc,
+			0x57, 0xb0, 0xdd, 0xf6, 0x1c, 0x1d, 0x3d, 0xd6,
+			0x0b, 0x2e, 0x99, 0x0f, 0x93, 0x8f, 0x00, 0xee,
+			0xcc, 0x78, 0x6d, 0x3c, 0xa0, 0x28, 0x99, 0xf5,
+			0x71, 0x17, 0xef, 0x85, 0x17, 0x2e, 0x30, 0xfd,
+			0x65, 0x47, 0xca, 0x3a, 0xc7, 0x0d, 0xad, 0x01,
+			0x5e, 0xe0, 0x84, 0xc9, 0x47, 0x38, 0xb5, 0x01,
+			0x8f, 0x06, 0x9e, 0x04, 0x47, 0x2a, 0xf4, 0x11,
+			0x39, 0xa2, 0x40, 0x54, 0x93, 0x56, 0x5a, 0x13,
+			0x03, 0xbe, 0x5d, 0xc8, 0xb0, 0x51, 0x67, 0xaf,
+			0x1e, 0x5b, 0xf2, 0x63, 0xec, 0x46, 0x3d, 0x41,
+			0x49, 0xb7, 0x88, 0xf4, 0xb4, 0x8c, 0xc0, 0xf6,
+			0xef, 0x3e, 0x22, 0xa6, 0x84, 0x61, 0xab, 0x04,
+			0x95, 0xd9, 0xb6, 0x52, 0x3e, 0xf9, 0xa3, 0x10,
+			0xa7, 0xcf, 0x4d, 0x64, 0xe5, 0xf9, 0xb6, 0xb6,
+			0x19, 0x76, 0x80, 0xe7, 0x3c, 0x35, 0x52, 0xe1,
+			0x7e, 0x54, 0x74, 0xc2, 0x99, 0x5c, 0x38, 0x04,
+			0x36, 0xb3, 0x23, 0x2a, 0xbf, 0x92, 0x3d, 0x04,
+			0x1f, 0x6a, 0x51, 0x62, 0x9b, 0xd4, 0xd5, 0x13,
+			0x01, 0xf3, 0xfd, 0x54, 0x9e, 0xb5, 0x77, 0xf1,
+			0x74, 0xbd, 0x29, 0x6c, 0x64, 0x8a, 0x00, 0xb2,
+			0x03, 0x77, 0x52, 0xf1, 0x9a, 0xde, 0x58, 0x10,
+			0xb3, 0xd6, 0x78, 0xa1, 0x5d, 0x64, 0x8d, 0xd3,
+			0x4a, 0xc2, 0x34, 0x81, 0x5a, 0xe6, 0xf3, 0x21,
+			0xbf, 0xe0, 0xd9, 0x00, 0x4f, 0x3f, 0xb7, 0x53,
+			0xd4, 0xab, 0x5d, 0xde, 0xcf, 0x18, 0x7f, 0xea,
+			0x96, 0xde, 0x58, 0xc0, 0x23, 0x38, 0xb3, 0x04,
+			0x85, 0x91, 0x85, 0xd5, 0x10, 0xc8, 0x5e, 0x12,
+			0xaa, 0xc4, 0xf4, 0xd8, 0x3c, 0x46, 0xa4, 0xc5,
+			0xef, 0x8f, 0xb6, 0xd6, 0xf2, 0xf6, 0xed, 0x06,
+			0x40, 0xdb, 0x3f, 0x29, 0xf0, 0x30, 0xb9, 0x4c,
+			0xee, 0x8c, 0x1b, 0xc6, 0xec, 0x29, 0xe5, 0x74,
+			0x7f, 0xf8, 0xd5, 0xb0, 0x20, 0xd3, 0x76, 0x25,
+			0x8f, 0x3c, 0x04, 0x35, 0xcf, 0x7b, 0x93, 0xcd,
+			0x99, 0x9a, 0x06, 0xeb, 0x94, 0x16, 0x9a, 0xd1,
+			0x17, 0xd8, 0xbf, 0x36, 0x8d, 0x3a, 0x49, 0x0b,
+			0xe6, 0x22, 0x38, 0xc5, 0x53, 0x83, 0x7e, 0x5b,
+			0x79, 0x0c, 0x5e, 0x6c, 0x39, 0xc8, 0x50, 0x9e,
+			0xe2, 0x85, 0xce, 0x4e, 0x04, 0x78, 0x3c, 0x5c,
+			0xdd, 0xa6, 0xe4, 0xf3, 0xcd, 0xee, 0x47, 0x32,
+			0xc3, 0xb0, 0x08, 0xe7, 0xba, 0xd6, 0x03, 0x06,
+			0x0d, 0x47, 0xfa, 0x0b, 0x38, 0xe9, 0x64, 0xd8,
+			0xd1, 0x11, 0x42, 0xe0, 0xac, 0x29, 0xf9, 0x84,
+			0x39, 0x6a, 0xee, 0xb9, 0xba, 0xeb, 0xe9, 0x1d,
+			0x6c, 0x8b, 0x12, 0x24, 0x97, 0xe2, 0xa8, 0x39,
+			0x93, 0xa1, 0x48, 0xe3, 0xdc, 0xa5, 0xd9, 0xfb,
+			0x74, 0x36, 0x92, 0x92, 0xa8, 0x2c, 0x08, 0xbf,
+			0xd2, 0xec, 0x4e, 0xff, 0x6b, 0x74, 0x3d, 0x5b,
+			0xc7, 0x52, 0x3f, 0x02, 0x34, 0x7e, 0x73, 0xac,
+			0xb5, 0xf7, 0xe8, 0x18, 0x01, 0x6b, 0xc9, 0x7c,
+			0x5b, 0x5f, 0x92, 0x3b, 0xfe, 0x08, 0xf0, 0xc8,
+			0x5b, 0xaf, 0xf5, 0x99, 0x9f, 0x35, 0x2c, 0x2a,
+			0xe1, 0xfd, 0x2a, 0xbf, 0x63, 0x93, 0x74, 0x61,
+			0xd6, 0x29, 0x09, 0x97, 0x21, 0xc1, 0x54, 0x3c,
+			0x3d, 0x90, 0xb2, 0x95, 0x3c, 0xf5, 0x32, 0xbe,
+			0x54, 0x04, 0x9c, 0x56, 0x5b, 0x77, 0xd9, 0x4d,
+			0x9c, 0xd7, 0xee, 0x65, 0x7c, 0xf3, 0x30, 0x24,
+			0xb9, 0x7b, 0x68, 0xd9, 0xe9, 0xda, 0xa4, 0xa8,
+			0x60, 0x03, 0x5e, 0x01, 0xcf, 0x60, 0xf8, 0x93,
+			0x4d, 0xa6, 0x2c, 0xcc, 0xc5, 0xd9, 0xa7, 0x5d,
+			0xa9, 0x0f, 0xb0, 0x0a, 0xc2, 0xcb, 0xeb, 0xc6,
+			0x91, 0xb9, 0x1e, 0x22, 0xef, 0xd6, 0xa0, 0x8f,
+			0x34, 0x13, 0x2e, 0x0c, 0xa3, 0x50, 0x1e, 0x1c,
+			0x14, 0xba, 0xef, 0xde, 0xd8, 0xa0, 0x8c, 0xb8,
+			0x3c, 0xaa, 0x44, 0xfa, 0xae, 0xbe, 0x4f, 0x9f,
+			0xee, 0x05, 0x4e, 0xee, 0x65, 0xaa, 0xd8, 0x2f,
+			0x8a, 0xb4, 0x9a, 0x34, 0x97, 0x3e, 0xd1, 0x8d,
+			0xa5, 0xfe, 0xae, 0xc9, 0x93, 0xee, 0x7c, 0x7d,
+			0x5c, 0xbd, 0x11, 0x06, 0x73, 0x93, 0x80, 0x36,
+			0xe9, 0x98, 0xaa, 0xd7, 0x20, 0x6d, 0xe8, 0xc2,
+			0x4e, 0xd9, 0xd3, 0x2b, 0xfd, 0x58, 0x03, 0x70,
+			0x14, 0x57, 0x5a, 0x66, 0x4d, 0xdc, 0xb0, 0xe5,
+			0x42, 0x68, 0xce, 0xb6, 0xae, 0x96, 0xa4, 0x36,
+			0x97, 0x18, 0x43, 0xd6, 0x53, 0x35, 0x21, 0x70,
+			0xf8, 0x96, 0x31, 0x99, 0xee, 0xbd, 0xbc, 0x12,
+			0xd5, 0x3f, 0xf4, 0x38, 0xff, 0x1a, 0x54, 0x86,
+			0x73, 0x76, 0xa8, 0x1d, 0x68, 0x63, 0xb3, 0x77,
+			0x0d, 0x0f, 0xaa, 0x0a, 0x16, 0x24, 0xee, 0x44,
+			0xcc, 0x19, 0xed, 0x83, 0x40, 0x9b, 0x9f, 0xeb,
+			0x63, 0x80, 0xc9, 0x53, 0x07, 0x68, 0xe3, 0x10,
+			0x03, 0x81, 0xf8, 0x91, 0xab, 0x3d, 0xc1, 0x05,
+			0x54, 0x99, 0x72, 0x76, 0xd4, 0x6c, 0xb0, 0xc5,
+			0x82, 0xeb, 0x2c, 0x9f, 0x90, 0xb1, 0x3f, 0x67,
+			0x33, 0x3c, 0xbe, 0xd1, 0x63, 0xd4, 0x2c, 0x62,
+			0xc8, 0x2f, 0x54, 0x08, 0x45, 0x78, 0xbd, 0x80,
+			0x5d, 0xd8, 0x52, 0x82, 0xd1, 0xf9, 0x91, 0xee,
+			0x3a, 0x82, 0x0d, 0x33, 0xb5, 0x31, 0xe1, 0xd2,
+			0xe3, 0x00, 0xe1, 0xa4, 0x78, 0x97, 0x10, 0xc1,
+			0x82, 0xde, 0x96, 0xd2, 0xc8, 0x4a, 0x7f, 0x48,
+			0xbf, 0x6c, 0x47, 0xb2, 0xc6, 0x6f, 0xf3, 0x1d,
+			0xfc, 0x77, 0xbc, 0xef, 0xad, 0xf2, 0xf7, 0x5e,
+			0x9f, 0xad, 0x6b, 0xec, 0xf0, 0xaa, 0x91, 0x18,
+			0xa7, 0x90, 0xa4, 0x82, 0xfa, 0x2b, 0xf0, 0x8f,
+			0x26, 0x6b, 0x0e, 0x65, 0x82, 0x96, 0xb5, 0xc5,
+			0xfb, 0x37, 0xa6, 0x5d, 0xb8, 0x26, 0xa4, 0x53,
+			0x9d, 0x48, 0x46, 0xc2, 0x60, 0x58, 0x71, 0x74,
+			0x27, 0xe1, 0x8b, 0x2d, 0xb7, 0xfa, 0x6c, 0x86,
+			0x9c, 0x10, 0xf2, 0x8a, 0xf2, 0x29, 0x3d, 0xb8,
+			0xf4, 0x19, 0x9c, 0xdb, 0xf1, 0x58, 0x5d, 0x8b,
+			0x57, 0x64, 0x8b, 0x7b, 0xe1, 0x8b, 0xc7, 0x1c,
+			0x58, 0x2f, 0xda, 0xc4, 0x59, 0x5f, 0x5a, 0xfd,
+			0xeb, 0x9a, 0xfa, 0xe3, 0x2f, 0x98, 0x83, 0xe5,
+			0x5b, 0x7f, 0x3d, 0x60, 0x9c, 0x46, 0xa4, 0x71,
+			0xca, 0x67, 0x91, 0xa0, 0x60, 0xad, 0xe5, 0x64,
+			0x20, 0xce, 0xc3, 0x96, 0x36, 0xe7, 0x2e, 0x01,
+			0x42, 0x68, 0x5e, 0x8e, 0xd4, 0x59, 0xfc, 0x89,
+			0x14, 0xa2, 0x78, 0x12, 0x0b, 0xa0, 0x3f, 0xe5,
+			0x92, 0x6d, 0x52, 0xfa, 0xc7, 0x72, 0x0d, 0x92,
+			0xc4, 0x9e, 0x51, 0x8f, 0xae, 0xdd, 0x42, 0xb2,
+			0x25, 0x69, 0xed, 0xc2, 0x4e, 0x0c, 0x6c, 0xd5,
+			0x72, 0xac, 0x28, 0x7d, 0xa9, 0x00, 0x95, 0xf3,
+			0x68, 0xe4, 0x24, 0xac, 0x71, 0x25, 0x7b, 0x90,
+			0x88, 0x4e, 0x8b, 0x63, 0x16, 0x59, 0xc8, 0x69,
+			0xcb, 0x04, 0x1e, 0xb2, 0xa6, 0xa1, 0xa3, 0xc6,
+			0x75, 0xc6, 0xed, 0x06, 0xda, 0xc9, 0x3a, 0x86,
+			0x93, 0x82, 0x61, 0xe0, 0xfe, 0xbc, 0x81, 0x6c,
+			0xd5, 0x7f, 0xf6, 0x73, 0x50, 0x09, 0x96, 0x19,
+			0x12, 0x87, 0x4b, 0xce, 0x09, 0x43, 0x4c, 0x66,
+			0x3a, 0xcf, 0xaa, 0x80, 0x75, 0x8c, 0x30, 0x7e,
+			0x2a, 0x1e, 0xda, 0x34, 0x8f, 0xef, 0x9a, 0x92,
+			0x1d, 0xe9, 0xf5, 0x8b, 0xbd, 0x05, 0x64, 0x1b,
+			0x14, 0xdd, 0x79, 0xce, 0x53, 0x28, 0xdb, 0x9f,
+			0x65, 0x31, 0xbd, 0x0a, 0xac, 0xcd, 0x59, 0x3e,
+			0x4b, 0xbe, 0x40, 0x0b, 0xc8, 0x85, 0xe7, 0x0e,
+			0x19, 0x66, 0xed, 0xaf, 0x1f, 0xf2, 0x8b, 0x37,
+			0x20, 0x17, 0x02, 0xc6, 0xc0, 0xca, 0x12, 0x8b,
+			0xd3, 0x11, 0x4b, 0xa1, 0x4b, 0xc3, 0x43, 0x9b,
+			0xa2, 0x9c, 0x1d, 0xfe, 0x05, 0x77, 0x67, 0x95,
+			0x35, 0x22, 0xb3, 0x1c, 0x83, 0x8c, 0xbf, 0xfb,
+			0xe0, 0xfb, 0x1e, 0x67, 0x19, 0xd8, 0xdc, 0x3b,
+			0x75, 0x2d, 0xe5, 0x0a, 0x5a, 0x9c, 0x45, 0xb8,
+			0xf6, 0x13, 0xf7, 0x2b, 0x0f, 0xeb, 0x1d, 0xa2,
+			0x1e, 0x08, 0x60, 0xe3, 0x88, 0xbf, 0x08, 0xc5,
+			0xbb, 0x54, 0x91, 0xc0, 0x53, 0x4d, 0xd9, 0x3f,
+			0x09, 0xab, 0xe1, 0x80, 0x89, 0x31, 0xd1, 0x01,
+			0x0e, 0xbd, 0x93, 0xa6, 0x0d, 0xd3, 0xdf, 0x77,
+			0x92, 0xf6, 0xa2, 0x0f, 0xcb, 0x69, 0xce, 0x1d,
+			0x9a, 0xf2, 0x95, 0xf3, 0x44, 0x63, 0xf9, 0x39,
+			0x3e, 0x0b, 0xd3, 0xcb, 0xa7, 0x4b, 0x18, 0x54,
+			0x39, 0x78, 0x2c, 0xee, 0xa4, 0x40, 0x33, 0x83,
+			0xa7, 0xe8, 0xca, 0xdc, 0xe2, 0x24, 0xc9, 0x28,
+			0x51, 0xad, 0xa2, 0xd3, 0x25, 0x9c, 0x59, 0x5e,
+			0x1f, 0xb1, 0x8c, 0x73, 0xbb, 0xcc, 0x80, 0x84,
+			0x69, 0xa1, 0x79, 0xe4, 0xc9, 0x4b, 0x96, 0x68,
+			0x43, 0x1d, 0xb5, 0x08, 0x71, 0x4a, 0x80, 0xfe,
+			0x2c, 0x1d, 0x3d, 0x38, 0x24, 0xb7, 0x79, 0x82,
+			0x74, 0xf9, 0x21, 0x69, 0x73, 0x3a, 0xd6, 0xd8,
+			0xd2, 0x89, 0x5e, 0x10, 0x74, 0x2a, 0xde, 0x44,
+			0x20, 0x76, 0x04, 0xb3, 0xaf, 0x6e, 0xd7, 0x0b,
+			0xe0, 0x32, 0xd3, 0x18, 0xfe, 0xff, 0x33, 0x09,
+			0x4f, 0xea, 0xde, 0xd8, 0xb1, 0xc2, 0xe0, 0x9a,
+			0xbc, 0xbb, 0xd1, 0xfd, 0x1a, 0x1c, 0xda, 0x21,
+			0x1b, 0xa2, 0xcf, 0x1b, 0x88, 0xa5, 0x31, 0xc8,
+			0x73, 0xc9, 0x95, 0xd5, 0x96, 0xb1, 0xd2, 0x38,
+			0x5f, 0x48, 0x74, 0x97, 0xb0, 0x10, 0xc6, 0x15,
+			0xf1, 0x16, 0xe2, 0x7e, 0xce, 0xe5, 0x37, 0xc1,
+			0xed, 0x8e, 0x90, 0xd4, 0x4b, 0xae, 0x71, 0x8a,
+			0xbd, 0xa1, 0x0b, 0x19, 0x14, 0xfe, 0x29, 0xc2,
+			0x56, 0x86, 0xf4, 0xd4, 0x6a, 0x2a, 0x2b, 0xfc,
+			0x4f, 0xa4, 0x3b, 0xfe, 0x1c, 0xfd, 0xb1, 0x44,
+			0x2f, 0x76, 0xfa, 0x0a, 0x7f, 0xf9, 0xcd, 0x14,
+			0x7d, 0x36, 0x4e, 0x61, 0xf8, 0xdb, 0x59, 0xaa,
+			0xb6, 0x80, 0xd1, 0xde, 0x43, 0x1b, 0x40, 0xa6,
+			0x72, 0x83, 0xa9, 0x75, 0x2b, 0xe2, 0x9b, 0xd5,
+			0x22, 0xd9, 0x60, 0x7c, 0x07, 0xc6, 0x14, 0x33,
+			0x56, 0xda, 0x7d, 0xba, 0x75, 0xd9, 0x07, 0xfa,
+			0xc2, 0x1e, 0xed, 0x19, 0xd0, 0x00, 0x21, 0x22,
+			0x84, 0xe9, 0x67, 0x7f, 0xc2, 0x69, 0xff, 0x6a,
+			0x47, 0x52, 0xf9, 0xca, 0xfb, 0x40, 0x19, 0x17,
+			0x38, 0xef, 0x3e, 0x0c, 0xb5, 0x57, 0xb8, 0xc0,
+			0x57, 0xd5, 0x20, 0x20, 0xe3, 0x4c, 0x7d, 0x2f,
+			0xae, 0x17, 0x22, 0x12, 0x0b, 0x4e, 0x24, 0xa6,
+			0xdb, 0x70, 0x41, 0xd3, 0xa1, 0xba, 0x47, 0x41,
+			0x2f, 0x23, 0xf9, 0xd6, 0x64, 0x45, 0x12, 0x8d,
+			0x22, 0x8f, 0x46, 0xc6, 0x8e, 0x11, 0x81, 0xd4,
+			0x62, 0x04, 0x10, 0xb1, 0xae, 0x1d, 0x03, 0x54,
+			0x40, 0x79, 0xf2, 0x0b, 0x39, 0xaa, 0xcc, 0x2f,
+			0x0c, 0x44, 0x9e, 0x08, 0x98, 0xcc, 0x66, 0x3e,
+			0xd7, 0xec, 0x9a, 0x64, 0xaa, 0x2a, 0xe6, 0xcd,
+			0xcc, 0xbf, 0x8d, 0x15, 0xc7, 0xf7, 0x49, 0xe5,
+			0x84, 0xe4, 0xf9, 0x6e, 0x60, 0xe7, 0x3f, 0x18,
+			0x58, 0xed, 0xe2, 0xc1, 0x4b, 0x64, 0x76, 0xd6,
+			0x39, 0xbb, 0xb3, 0x69, 0xfc, 0x1b, 0x1e, 0xaf,
+			0xd8, 0x43, 0x2f, 0x21, 0xce, 0xa1, 0xc5, 0x75,
+			0x64, 0xed, 0x1a, 0x9b, 0xb2, 0x96, 0xc8, 0xd1,
+			0xd3, 0xbc, 0x45, 0xd7, 0x91, 0x11, 0x93, 0x46,
+			0x92, 0x0c, 0xb8, 0xa2, 0x98, 0x93, 0xc3, 0xcc,
+			0x60, 0xe1, 0x43, 0xb2, 0xa8, 0x7e, 0x55, 0x51,
+			0x8a, 0x57, 0x9a, 0xbc, 0x13, 0xa5, 0x40, 0x12,
+			0x35, 0x73, 0x76, 0xb9, 0x23, 0xc4, 0xcd, 0xd1,
+			0x2e, 0xe4, 0xf1, 0x96, 0x93, 0x45, 0x9b, 0xc1,
+			0x95, 0xe2, 0x41, 0x7c, 0x93, 0x4d, 0xc8, 0x0c,
+			0x23, 0x01, 0x59, 0x7d, 0x91, 0xb7, 0x5e, 0x90,
+			0xe7, 0x2e, 0x1d, 0xbc, 0x6b, 0x03, 0x19, 0x53,
+			0x0d, 0x90, 0x08, 0xc9, 0xe6, 0xe1, 0x22, 0x63,
+			0x86, 0x35, 0x27, 0x00, 0x2c, 0xdb, 0x10, 0x7a,
+			0x0c, 0x4b, 0xa8, 0x4e, 0x32, 0x0b, 0xc5, 0xfe,
+			0x7c, 0xe3, 0x87, 0x4a, 0xe3, 0x20, 0xaa, 0x0f,
+			0xc8, 0x83, 0xfb, 0x2d, 0x0c, 0xe2, 0xee, 0xf1,
+			0xaa, 0x38, 0xf8, 0x20, 0x1b, 0xf5, 0x39, 0x06,
+			0xc2, 0xb0, 0xe4, 0x23, 0x9b, 0x36, 0xc8, 0x65,
+			0xba, 0x62, 0x6e, 0x93, 0x0d, 0x27, 0x9c, 0x60,
+			0xc0, 0xb6, 0x5b, 0xbd, 0xc8, 0x33, 0xab, 0x32,
+			0xb0, 0x3e, 0xa1, 0x03, 0x8d, 0x03, 0x0e, 0x83,
+			0x12, 0x59, 0x6c, 0x89, 0xba, 0x0e, 0x16, 0x24,
+			0xdb, 0x25, 0xe9, 0xfb, 0x0a, 0x3b, 0xa1, 0x96,
+			0x7b, 0xa6, 0x00, 0xf7, 0xd9, 0xe5, 0xc9, 0x1e,
+			0x00, 0x7b, 0xee, 0x9d, 0x68, 0xa2, 0x34, 0xd9,
+			0x82, 0xb6, 0x6a, 0x31, 0x3c, 0x5e, 0x53, 0xcf,
+			0xd5, 0xd8, 0x10, 0xd3, 0x1c, 0xd9, 0x5b, 0xd4,
+			0x5f, 0xf3, 0x25, 0x33, 0x9c, 0xfa, 0xe0, 0x98,
+			0xee, 0x7b, 0xaa, 0x77, 0x45, 0x7e, 0x43, 0x35,
+			0x8b, 0xb9, 0xd0, 0xc2, 0x0b, 0x6c, 0xd8, 0x0a,
+			0xb1, 0x4e, 0xea, 0x62, 0x96, 0x3b, 0xc0, 0x5f,
+			0xc2, 0x98, 0x78, 0xaa, 0x72, 0xce, 0x6c, 0x4d,
+			0xcf, 0x0a, 0xb5, 0x4c, 0x4c, 0xef, 0xbd, 0xc0,
+			0x2b, 0xc8, 0xc2, 0x68, 0x99, 0xd9, 0x40, 0x0a,
+			0x3e, 0xf0, 0xa5, 0xdf, 0x2d, 0xef, 0xab, 0xea,
+			0x26, 0xb9, 0xe7, 0x52, 0x59, 0xc2, 0xca, 0x64,
+			0xcf, 0xaa, 0xd5, 0x93, 0xa5, 0x1e, 0xad, 0x6e,
+			0x5b, 0x7a, 0x05, 0xbb, 0x2f, 0x62, 0x2d, 0x4c,
+			0xcb, 0x4d, 0xb7, 0x67, 0x4b, 0x80, 0x73, 0x9a,
+			0xd9, 0x17, 0xba, 0x9a, 0xea, 0xac, 0xf5, 0x41,
+			0x01, 0x40, 0x8c, 0x21, 0x4c, 0x61, 0x29, 0x69,
+			0xff, 0x8e, 0x14, 0x86, 0x32, 0xd6, 0x02, 0x37,
+			0x5f, 0x8c, 0x54, 0xea, 0xba, 0x59, 0x2e, 0x59,
+			0xc6, 0x2e, 0x3a, 0x37, 0x43, 0xb0, 0x61, 0xa3,
+			0x3e, 0x35, 0x56, 0x04, 0x79, 0x32, 0x36, 0x1b,
+			0x13, 0xa7, 0x2c, 0x48, 0xb3, 0x64, 0xe9, 0x0e,
+			0x2e, 0xb8, 0xc8, 0x65, 0xd9, 0xae, 0x68, 0xb6,
+			0x6a, 0xcb, 0x74, 0x34, 0x8e, 0x12, 0x2f, 0x80,
+			0x42, 0x17, 0xb5, 0x16, 0xf1, 0x39, 0x80, 0xc4,
+			0xc1, 0xac, 0xbf, 0x81, 0x6e, 0x19, 0x32, 0x2e,
+			0xb5, 0x08, 0x07, 0xac, 0x4b, 0xde, 0x44, 0xa5,
+			0x4a, 0x30, 0xc1, 0x46, 0x04, 0xbb, 0x06, 0x55,
+			0xee, 0xa5, 0xde, 0x18, 0xae, 0xd4, 0x78, 0xcc,
+			0xc5, 0xdf, 0xcf, 0xad, 0x6e, 0xae, 0xe6, 0x67,
+			0x1d, 0xbf, 0x48, 0x3f, 0xda, 0x20, 0x43, 0x4a,
+			0xc5, 0x8a, 0xb5, 0x4b, 0x7f, 0xaa, 0x45, 0x93,
+			0xf4, 0xd0, 0x43, 0xd5, 0x87, 0x12, 0xb5, 0x5f,
+			0xa0, 0x74, 0x88, 0x81, 0x75, 0x34, 0x24, 0x4c,
+			0xf2, 0x42, 0xac, 0x95, 0x09, 0xa6, 0xe1, 0xec,
+			0xfa, 0x4c, 0xff, 0xec, 0xd6, 0x3b, 0xbb, 0x56,
+			0xf3, 0xb1, 0x2c, 0x42, 0xa2, 0x2e, 0xe6, 0x8f,
+			0x6b, 0xbd, 0x1e, 0xb3, 0x10, 0x85, 0x60, 0xca,
+			0xd7, 0x21, 0xd5, 0x35, 0xa7, 0x9e, 0x55, 0x4c,
+			0x20, 0x81, 0x3e, 0x9e, 0x01, 0xc5, 0x37, 0x10,
+			0x96, 0x9c, 0x32, 0xf5, 0x0f, 0x2a, 0xe5, 0x1d,
+			0x98, 0xd0, 0x59, 0x58, 0x0c, 0x4f, 0x0a, 0x7f,
+			0x86, 0xeb, 0x6a, 0x3a, 0xe2, 0x97, 0xa3, 0x8a,
+			0xe8, 0x9a, 0x25, 0x69, 0x68, 0x99, 0x75, 0x65,
+			0xfc, 0x54, 0xe1, 0x11, 0xb3, 0x12, 0x26, 0xde,
+			0x09, 0x7b, 0x1a, 0xf6, 0x0f, 0x7c, 0x55, 0xb2,
+			0xd3, 0x01, 0x19, 0xe6, 0x96, 0x24, 0x78, 0x51,
+			0x36, 0x23, 0x41, 0xc5, 0x9c, 0x46, 0x9f, 0x59,
+			0x65, 0x64, 0x87, 0x3a, 0xac, 0xc5, 0xfc, 0xef,
+			0xde, 0xa8, 0x80, 0x8c, 0xb0, 0x29, 0x7a, 0x4f,
+			0x69, 0x51, 0x97, 0xbf, 0xf3, 0x6b, 0x7a, 0x70,
+			0x1b, 0xac, 0x2f, 0x19, 0xfa, 0x01, 0x8b, 0x2e,
+			0x51, 0x9f, 0x6b, 0x17, 0x91, 0x88, 0x74, 0xb6,
+			0x77, 0x14, 0x47, 0x7f, 0x31, 0xee, 0xbd, 0xee,
+			0xc4, 0x0b, 0xe4, 0x14, 0x15, 0x1e, 0xb0, 0x97,
+			0xaa, 0xf1, 0x26, 0x97, 0xdf, 0x4b, 0x42, 0x45,
+			0xdc, 0x6d, 0xff, 0x62, 0xf4, 0xae, 0x77, 0x48,
+			0xa2, 0xa5, 0xfa, 0x6d, 0xbb, 0xdb, 0x8d, 0x0d,
+			0xa4, 0xa6, 0xef, 0xd7, 0x2a, 0xdc, 0x04, 0xf7,
+			0xad, 0xed, 0x04, 0x48, 0x2a, 0x20, 0x92, 0x52,
+			0x62, 0x47, 0x32, 0xc1, 0x22, 0x1e, 0x87, 0x76,
+			0x68, 0xe1, 0xa8, 0x44, 0x52, 0x8f, 0x11, 0x73,
+			0xb9, 0x71, 0xe9, 0x0d, 0x12, 0xbc, 0x04, 0x88,
+			0x39, 0x52, 0x8b, 0xa7, 0x92, 0x2a, 0x76, 0x7e,
+			0x66, 0x5c, 0xea, 0x03, 0x32, 0xe3, 0x6b, 0xb2,
+			0x47, 0x5d, 0xee, 0xe6, 0xd8, 0x9a, 0x67, 0x1e,
+			0x0e, 0x4a, 0xb1, 0x90, 0xcd, 0x60, 0x03, 0x6e,
+			0x97, 0xa5, 0xd3, 0x78, 0x56, 0x69, 0x92, 0xe1,
+			0x10, 0xf6, 0xce, 0x38, 0x06, 0x76, 0x0d, 0x96,
+			0x7a, 0x1c, 0x8d, 0x6e, 0xf9, 0x23, 0xbd, 0x62,
+			0x22, 0x94, 0xac, 0x5a, 0xbf, 0x2c, 0x10, 0xc9,
+			0xa4, 0xd6, 0xfc, 0x08, 0x73, 0x63, 0xba, 0x0f,
+			0xbd, 0x7b, 0xfd, 0x20, 0xe0, 0x13, 0xfc, 0xd0,
+			0x24, 0x04, 0x84, 0xbe, 0xd8, 0x37, 0x01, 0x08,
+			0x5f, 0x31, 0x1a, 0xde, 0x26, 0x2f, 0xf7, 0x96,
+			0x36, 0x48, 0x87, 0x8c, 0xe2, 0xf3, 0x6c, 0xcd,
+			0xe7, 0x29, 0x7f, 0xc7, 0xa3, 0x39, 0x6d, 0x10,
+			0x9a, 0xfa, 0xb1, 0x57, 0xe7, 0xa1, 0x3b, 0x38,
+			0x09, 0xd7, 0x91, 0x65, 0xd3, 0x3c, 0x9e, 0x9b,
+			0x1d, 0x50, 0x46, 0x58, 0xe8, 0x38, 0x9a, 0xcf,
+			0xf2, 0x99, 0x23, 0xed, 0x6b, 0xd7, 0xbc, 0x52,
+			0xae, 0xaf, 0xcc, 0x81, 0x8d, 0x3b, 0x51, 0x8e,
+			0x14, 0x9d, 0xf1, 0x2b, 0xe7, 0x9d, 0x2d, 0x3c,
+			0x9a, 0x81, 0x69, 0xd5, 0x0d, 0x25, 0x2a, 0x93,
+			0x64, 0x80, 0xc4, 0xd9, 0x3b, 0x43, 0xe8, 0x1c,
+			0xf1, 0x4c, 0x2d, 0xff, 0x3e, 0x8b, 0x4f, 0x65,
+			0xca, 0xde, 0x59, 0x69, 0xa9, 0x7f, 0x22, 0xc3,
+			0x19, 0x5b, 0x52, 0x9c, 0xed, 0x76, 0x1f, 0x66,
+			0xc4, 0xa5, 0x25, 0x91, 0x73, 0xd9, 0x11, 0xd3,
+			0x04, 0x49, 0x10, 0x05, 0x8e, 0x48, 0x9a, 0xae,
+			0xa9, 0x4c, 0xdd, 0x9a, 0xe9, 0x2e, 0x63, 0x8a,
+			0xa1, 0x23, 0xa7, 0x74, 0xbd, 0xb2, 0x00, 0x03,
+			0xf8, 0x60, 0x93, 0xb2, 0x67, 0x5c, 0xa3, 0x00,
+			0xc2, 0x2c, 0x53, 0x55, 0x74, 0xe1, 0xe2, 0x12,
+			0xce, 0xca, 0xeb, 0x6b, 0x6f, 0xd1, 0xd2, 0xbb,
+			0x81, 0xcf, 0x03, 0x91, 0x83, 0x5e, 0xc4, 0xc9,
+			0xdf, 0xf1, 0x5f, 0x72, 0x63, 0xf4, 0x57, 0xfe,
+			0x44, 0xd4, 0x7b, 0x5d, 0x97, 0xf9, 0xdc, 0xd6,
+			0x72, 0x17, 0xcd, 0x32, 0x3b, 0x18, 0xb5, 0x55,
+			0xa4, 0xfa, 0xde, 0xdd, 0x0d, 0x55, 0xb5, 0x5b,
+			0xbc, 0xec, 0x02, 0xc4, 0x47, 0x6e, 0x09, 0x86,
+			0x8f, 0x08, 0xe0, 0xab, 0xcc, 0x74, 0x7c, 0x06,
+			0xed, 0x5b, 0x02, 0x55, 0x12, 0x1e, 0x80, 0x6b,
+			0x0b, 0x86, 0x78, 0x44, 0xd0, 0xe9, 0x14, 0x20,
+			0xce, 0xc8, 0xe0, 0x40, 0xb3, 0x1c, 0x3a, 0xc8,
+			0x99, 0x21, 0xe1, 0x6c, 0x0a, 0x2a, 0xfa, 0xd1,
+			0x84, 0x70, 0x5c, 0xd5, 0xe8, 0xd2, 0x71, 0x04,
+			0xf7, 0x5d, 0xf5, 0x93, 0xde, 0xd6, 0xbb, 0x55,
+			0x5b, 0x79, 0xd8, 0xb4, 0x1d, 0x0c, 0x62, 0xf5,
+			0x7a, 0x9a, 0xf8, 0xd9, 0x92, 0x35, 0x22, 0xc4,
+			0x68, 0x94, 0xa3, 0x06, 0x1b, 0x01, 0x6f, 0x27,
+			0xcc, 0x1f, 0x2b, 0xd4, 0x2d, 0x46, 0x20, 0xa4,
+			0x61, 0x61, 0x5b, 0x2b, 0x0c, 0xd8, 0xd5, 0xe8,
+			0x97, 0x23, 0xa0, 0xc9, 0x59, 0x5f, 0x99, 0x17,
+			0xdc, 0xf5, 0xcc, 0x2e, 0x80, 0xe0, 0x6d, 0x5f,
+			0xde, 0xe1, 0xa9, 0x4a, 0x97, 0xac, 0x0a, 0x20,
+			0xa8, 0x4d, 0x9a, 0x35, 0x41, 0x6e, 0xca, 0x3e,
+			0xf4, 0x8a, 0x07, 0x39, 0x9c, 0x44, 0x4e, 0x81,
+			0x0d, 0x17, 0x14, 0x9e, 0x39, 0xec, 0x39, 0x33,
+			0x2d, 0x90, 0x82, 0x06, 0xa7, 0x76, 0x52, 0xc6,
+			0x9e, 0xa8, 0x66, 0xea, 0x23, 0xc5, 0xfb, 0xb4,
+			0xb3, 0xcf, 0x8e, 0x63, 0x97, 0xfd, 0xcb, 0x81,
+			0x4d, 0xca, 0xad, 0xf9, 0x8a, 0xe1, 0x77, 0x55,
+			0x3d, 0x20, 0x1e, 0x4c, 0x41, 0xf4, 0x11, 0xbd,
+			0x8d, 0xc6, 0x54, 0x11, 0x60, 0x37, 0x73, 0xb5,
+			0x2c, 0xb2, 0xf5, 0x70, 0xa6, 0xc7, 0x20, 0x7f,
+			0xb7, 0x1a, 0xb4, 0xe5, 0x44, 0xdc, 0xfa, 0x3c,
+			0x5c, 0x6f, 0xd2, 0x59, 0xeb, 0xc8, 0x18, 0xe9,
+			0x4a, 0x21, 0x5a, 0xb0, 0xfb, 0x90, 0x64, 0xf7,
+			0x8e, 0x03, 0xed, 0x79, 0x55, 0x71, 0x62, 0x2d,
+			0x9d, 0xaf, 0x43, 0x45, 0x2d, 0xe4, 0x9c, 0x0d,
+			0xf6, 0x23, 0x4e, 0x9b, 0xdf, 0x88, 0x72, 0xe4,
+			0x02, 0xc8, 0x03, 0x00, 0x31, 0xc4, 0xb8, 0x88,
+			0xf3, 0xdb, 0x53, 0xfc, 0xbb, 0x13, 0x8a, 0xf4,
+			0xe8, 0x31, 0x2f, 0x82, 0xb7, 0x10, 0x43, 0xdc,
+			0x99, 0xb0, 0xba, 0xe8, 0x5b, 0x20, 0xa9, 0x8c,
+			0x31, 0x32, 0x6d, 0x87, 0x8a, 0x1b, 0x8f, 0x53,
+			0xe6, 0x23, 0x25, 0x4e, 0x37, 0xf3, 0x9c, 0x1a,
+			0xd1, 0xe6, 0x3f, 0x6f, 0xb7, 0x34, 0xcf, 0xe1,
+			0xe5, 0x23, 0x32, 0x40, 0xb9, 0xbc, 0xdf, 0x39,
+			0x56, 0x9d, 0xae, 0x49, 0x86, 0x80, 0x8d, 0x25,
+			0x31, 0x3a, 0xa4, 0x73, 0x33, 0x2d, 0x9a, 0xaa,
+			0xbb, 0x45, 0xf1, 0x53, 0x8c, 0x5d, 0x0b, 0xaa,
+			0xf6, 0xc6, 0x1a, 0xb3, 0x03, 0xc8, 0xcd, 0x94,
+			0x33, 0xbe, 0x42, 0x2c, 0x44, 0x94, 0xfc, 0x5a,
+			0x0a, 0xa7, 0x2a, 0x17, 0x91, 0xbd, 0x04, 0xe1,
+			0xf7, 0x5a, 0xc3, 0x75, 0x7d, 0xb9, 0xb3, 0x4b,
+			0x93, 0x23, 0xf5, 0x53, 0xed, 0x9b, 0xc6, 0x0d,
+			0xbb, 0x7f, 0xfb, 0x93, 0x3c, 0x95, 0x4b, 0x36,
+			0x05, 0xf6, 0xa2, 0x77, 0x9c, 0x32, 0xcf, 0x11,
+			0x00, 0xf6, 0xa5, 0x1a, 0xcd, 0x6e, 0xbc, 0x3e,
+			0x67, 0xf2, 0x12, 0xaf, 0x29, 0x84, 0x05, 0xb8,
+			0x9a, 0x47, 0xba, 0x2e, 0xed, 0x58, 0xcb, 0x6a,
+			0x02, 0x33, 0xa5, 0x4a, 0x03, 0x81, 0xf4, 0x90,
+			0x91, 0xc2, 0xc4, 0xa4, 0x99, 0x06, 0x82, 0x76,
+			0x90, 0x92, 0xeb, 0x04, 0xf7, 0x03, 0x51, 0x77,
+			0x7f, 0xbb, 0x58, 0x5d, 0xc5, 0xd8, 0xc6, 0x57,
+			0x74, 0x14, 0x44, 0xd1, 0xa0, 0xbc, 0x4f, 0xb6,
+			0x1c, 0xae, 0xc7, 0xbe, 0x7b, 0xd5, 0xde, 0x78,
+			0xae, 0x66, 0x56, 0x58, 0x62, 0xb5, 0xf7, 0x65,
+			0x09, 0xe5, 0x77, 0x88, 0x27, 0xe0, 0x12, 0x40,
+			0x17, 0x41, 0xf4, 0xec, 0x55, 0x42, 0xfc, 0x10,
+			0xbe, 0xf8, 0x87, 0x8e, 0x94, 0x1a, 0x74, 0xea,
+			0xbc, 0x52, 0xf6, 0xee, 0xc1, 0x5e, 0x54, 0x63,
+			0x23, 0x7b, 0x24, 0xd3, 0xb4, 0xee, 0xc6, 0x96,
+			0xff, 0x0a, 0x0a, 0x1e, 0x1c, 0xd0, 0x00, 0xff,
+			0xd3, 0x4c, 0x52, 0x82, 0x1d, 0x94, 0xe5, 0x5f,
+			0xba, 0xf3, 0x40, 0xf1, 0xfc, 0xf0, 0x31, 0x58,
+			0x43, 0xfc, 0x03, 0xd8, 0x1e, 0x9b, 0x16, 0x54,
+			0x0d, 0x73, 0x52, 0x59, 0xfb, 0x03, 0xe8, 0x5e,
+			0x1a, 0x76, 0x1d, 0x57, 0xda, 0x89, 0x7a, 0x90,
+			0x7e, 0x19, 0x96, 0xad, 0x83, 0xf6, 0xbc, 0xae,
+			0x3e, 0xa3, 0x67, 0x71, 0x67, 0xb4, 0xc3, 0x25,
+			0xdd, 0xd9, 0x04, 0xdc, 0xbb, 0x3a, 0x84, 0x25,
+			0x5a, 0x4d, 0xad, 0x64, 0x5b, 0xaa, 0x8a, 0x7e,
+			0x3b, 0x85, 0x71, 0x23, 0xa3, 0x8c, 0x34, 0xd2,
+			0x5d, 0xc7, 0x4b, 0x41, 0xe3, 0xb1, 0x1a, 0xfb,
+			0xbb, 0xd6, 0x21, 0xee, 0x8b, 0x3e, 0x44, 0x64,
+			0x56, 0x97, 0xd9, 0x71, 0x6a, 0x0f, 0xcb, 0xf1,
+			0xc4, 0xa8, 0x07, 0xa1, 0xa1, 0x29, 0xb6, 0x21,
+			0x30, 0x6f, 0x58, 0x2d, 0x19, 0xfb, 0x1c, 0xa6,
+			0xec, 0xe1, 0x63, 0x0c, 0x73, 0xa2, 0x5c, 0x2e,
+			0xa7, 0x5c, 0xf3, 0xd2, 0x15, 0x53, 0xcc, 0xed,
+			0x8c, 0xc1, 0xda, 0x68, 0xd6, 0x48, 0x4d, 0x8d,
+			0xf3, 0xa1, 0xeb, 0x15, 0x43, 0x7f, 0xa3, 0xda,
+			0x65, 0xea, 0xc3, 0x73, 0x17, 0x35, 0xc7, 0x83,
+			0xfb, 0x92, 0x61, 0x17, 0xef, 0xf1, 0xe3, 0xea,
+			0xdc, 0xc4, 0x6c, 0x58, 0x49, 0xf9, 0x80, 0xb2,
+			0xbe, 0x5c, 0x57, 0x39, 0xc5, 0xb1, 0x1a, 0x3e,
+			0xb5, 0x8c, 0xd2, 0xf2, 0xe5, 0x2b, 0x69, 0x6d,
+			0xb2, 0xe1, 0x38, 0xc5, 0x09, 0x6c, 0x40, 0xbb,
+			0x8a, 0x5c, 0xc4, 0xa4, 0x44, 0xea, 0x77, 0x7e,
+			0x60, 0xed, 0x7c, 0x17, 0x4f, 0x40, 0x75, 0x04,
+			0x2e, 0xeb, 0x76, 0xba, 0xa6, 0xc0, 0x4d, 0x45,
+			0xfd, 0xfa, 0xf4, 0xc8, 0xea, 0x75, 0xaf, 0x9b,
+			0x6a, 0x59, 0x31, 0xe1, 0x9a, 0xac, 0xb5, 0x07,
+			0xfe, 0xef, 0xc1, 0x05, 0xaa, 0x7d, 0xa5, 0x5a,
+			0x90, 0x54, 0x85, 0xe4, 0x38, 0x3d, 0x71, 0xd7,
+			0xec, 0x3b, 0x22, 0x40, 0xba, 0x16, 0x6d, 0x1a,
+			0xfa, 0xb9, 0x39, 0x4e, 0xdf, 0x9b, 0x44, 0xae,
+			0x69, 0x5f, 0x60, 0x7a, 0x78, 0x49, 0xf9, 0x94,
+			0x1e, 0xf0, 0x32, 0x87, 0x8d, 0x59, 0xbe, 0x16,
+			0x74, 0x51, 0x0c, 0x6c, 0x61, 0xfb, 0xb2, 0xc0,
+			0x18, 0xf9, 0xc7, 0xe2, 0x5a, 0x61, 0x5e, 0xe1,
+			0x33, 0x90, 0xc1, 0x00, 0x49, 0xfc, 0xa4, 0xc9,
+			0x4a, 0x8a, 0x33, 0x6c, 0x04, 0xa2, 0x5a, 0x71,
+			0xac, 0x93, 0x8d, 0xe3, 0xbc, 0xb5, 0x06, 0x2f,
+			0x56, 0xe4, 0xd6, 0xa5, 0x54, 0xaf, 0x13, 0x37,
+			0x76, 0x0a, 0x31, 0x36, 0xe8, 0xf5, 0xa3, 0xbd,
+			0x4a, 0x7c, 0xf8, 0x70, 0x12, 0xfd, 0x32, 0x20,
+			0x07, 0x42, 0x28, 0x10, 0x00, 0x8e, 0x1c, 0x89,
+			0x8c, 0xab, 0x8e, 0x5d, 0x73, 0xaa, 0xb6, 0xa3,
+			0xb7, 0x08, 0xd7, 0x9f, 0xa8, 0x5d, 0xa0, 0x83,
+			0x57, 0x55, 0x8e, 0x37, 0x3e, 0x65, 0x61, 0x8a,
+			0x49, 0x0f, 0x17, 0x8a, 0x1b, 0xab, 0x3d, 0x87,
+			0xa7, 0x57, 0x71, 0xcd, 0xfa, 0xcb, 0xd3, 0x8b,
+			0x40, 0x9e, 0x86, 0x23, 0x90, 0x1e, 0x35, 0xf6,
+			0x4e, 0x18, 0x8b, 0xfe, 0x74, 0x3a, 0x24, 0x8a,
+			0x42, 0xe5, 0xe4, 0xe4, 0xf2, 0x06, 0x0f, 0x30,
+			0xeb, 0xa9, 0x14, 0xac, 0x10, 0x0e, 0x7c, 0x8c,
+			0x52, 0x8e, 0x6a, 0x42, 0x27, 0x30, 0x1e, 0x48,
+			0xde, 0xee, 0x00, 0x51, 0x4c, 0xe1, 0x51, 0xaa,
+			0xb9, 0x47, 0x05, 0xbf, 0xf7, 0xd4, 0xd7, 0x51,
+			0xfc, 0x60, 0x5b, 0x5f, 0x85, 0xa2, 0xc3, 0x73,
+			0x44, 0x93, 0x5a, 0x42, 0x79, 0x91, 0xba, 0x0c,
+			0x30, 0x06, 0x56, 0xae, 0xc9, 0xac, 0x56, 0x2e,
+			0x96, 0x3e, 0xb8, 0xfa, 0x0f, 0x31, 0xc9, 0xe5,
+			0x7e, 0x67, 0xa4, 0xad, 0x8a, 0x49, 0xb0, 0x47,
+			0xd4, 0xbd, 0xc9, 0xfa, 0x4f, 0x95, 0x4e, 0xeb,
+			0x45, 0x38, 0x4c, 0x81, 0xa0, 0xb2, 0xb3, 0x44,
+			0xc2, 0x59, 0x29, 0x34, 0x68, 0xae, 0x17, 0x90,
+			0x95, 0x65, 0xca, 0x48, 0x75, 0xd6, 0x41, 0xd4,
+			0xf7, 0xa6, 0x21, 0x08, 0x25, 0xd7, 0xfa, 0x2a,
+			0x51, 0xf6, 0xdb, 0xd9, 0xe0, 0xe2, 0x3e, 0xf6,
+			0xf8, 0xa7, 0xdb, 0xd7, 0x4c, 0x2f, 0x05, 0xd5,
+			0x70, 0xb9, 0x10, 0x3a, 0x4d, 0xba, 0xce, 0x63,
+			0xc5, 0x40, 0x08, 0x26, 0x87, 0x26, 0xff, 0x29,
+			0x84, 0x56, 0xe2, 0xb2, 0x31, 0xe6, 0x3b, 0x4a,
+			0x26, 0x35, 0x8e, 0xc2, 0xe9, 0x77, 0xc3, 0xc3,
+			0x67, 0x9b, 0x89, 0xc4, 0x6a, 0x9d, 0x0a, 0xfc,
+			0x04, 0xe8, 0x45, 0xe7, 0xbc, 0x54, 0x7a, 0xf2,
+			0x85, 0x34, 0x30, 0xe3, 0xab, 0x2d, 0x85, 0x55,
+			0x7e, 0x9d, 0x19, 0xd0, 0xf4, 0x2e, 0x0b, 0x8f,
+			0xb0, 0x3a, 0xab, 0xd1, 0xba, 0x47, 0xb0, 0x4f,
+			0xe4, 0x4d, 0x3a, 0x19, 0xb1, 0x3c, 0xbe, 0x6d,
+			0x8d, 0x17, 0x65, 0xb3, 0x39, 0x39, 0x8b, 0xe1,
+			0x78, 0xee, 0x9a, 0x5a, 0x7e, 0x75, 0x54, 0x51,
+			0xc1, 0xe7, 0xda, 0xfc, 0xc5, 0x35, 0x4e, 0x96,
+			0x51, 0x02, 0xb1, 0xc6, 0x67, 0x41, 0xe8, 0x57,
+			0x35, 0xff, 0x89, 0xcc, 0xcd, 0x91, 0xe0, 0xde,
+			0x34, 0x65, 0xf4, 0x76, 0x5f, 0xec, 0x1e, 0x23,
+			0xa1, 0x7f, 0x9e, 0x00, 0x52, 0x3f, 0x4a, 0x99,
+			0x6c, 0x22, 0x76, 0x92, 0xb4, 0x9e, 0xb8, 0x44,
+			0x49, 0xfe, 0xe6, 0xf7, 0x51, 0x1d, 0x33, 0x45,
+			0x8f, 0x5d, 0x13, 0x45, 0x4f, 0xcd, 0xfc, 0xec,
+			0xd6, 0xb1, 0x24, 0x7c, 0x40, 0x37, 0x63, 0x91,
+			0xa4, 0x2d, 0xb5, 0x3d, 0x30, 0xbc, 0x41, 0xde,
+			0xb8, 0x2f, 0x53, 0x07, 0xea, 0x52, 0xa6, 0x0f,
+			0xdb, 0x77, 0x87, 0x9a, 0x0f, 0x27, 0x2c, 0x1a,
+			0xcd, 0x14, 0x93, 0xc4, 0x77, 0x2e, 0x83, 0xc9,
+			0x9b, 0x2d, 0x5e, 0x6f, 0x19, 0xbc, 0x6f, 0x3a,
+			0xe6, 0x28, 0x89, 0xd1, 0x77, 0x26, 0x86, 0x9d,
+			0x32, 0xf4, 0x41, 0x33, 0x15, 0xa0, 0x37, 0xa3,
+			0x00, 0xed, 0xc4, 0xe4, 0x8e, 0xdd, 0xb4, 0xf9,
+			0x3a, 0x09, 0x9a, 0x97, 0x90, 0xb1, 0xe2, 0xbf,
+			0x8a, 0x41, 0xe7, 0x27, 0x6f, 0x59, 0x8b, 0xe5,
+			0x38, 0xdc, 0xec, 0x87, 0x1b, 0xd1, 0xc0, 0x3b,
+			0x93, 0x68, 0xbc, 0x44, 0x5c, 0xc4, 0x95, 0x0c,
+			0xda, 0xf6, 0x00, 0xad, 0x37, 0xed, 0x92, 0x1b,
+			0x48, 0xfa, 0x54, 0x8c, 0x66, 0xa7, 0xc8, 0xdb,
+			0xaa, 0x4d, 0x86, 0xe1, 0x7b, 0x9a, 0x29, 0x37,
+			0xb8, 0x4c, 0xab, 0xca, 0xfa, 0x88, 0x30, 0x17,
+			0xec, 0x3c, 0x8c, 0x98, 0xde, 0xa4, 0xa7, 0x07,
+			0x56, 0x7d, 0xf7, 0x6a, 0x6f, 0xf9, 0xf1, 0x27,
+			0x53, 0x83, 0xb9, 0x12, 0xd8, 0x6b, 0x34, 0x14,
+			0x9a, 0x82, 0x0f, 0x7e, 0x87, 0x20, 0x4f, 0xee,
+			0xa2, 0xa0, 0xcc, 0x92, 0x3a, 0x3f, 0x61, 0xfb,
+			0xf0, 0xb7, 0xf5, 0xe4, 0xc3, 0x0d, 0x51, 0x7a,
+			0x2b, 0x57, 0x87, 0xc3, 0xf1, 0xed, 0x17, 0x4b,
+			0xf5, 0x6c, 0xf2, 0x20, 0x5c, 0x53, 0xd3, 0x32,
+			0x1e, 0x8c, 0xd9, 0xbe, 0x85, 0xbe, 0xbd, 0xa8,
+			0xd6, 0xf8, 0x10, 0x0b, 0x75, 0x9c, 0x0c, 0x46,
+			0x05, 0xb3, 0x46, 0x18, 0xdb, 0xbf, 0x57, 0x0b,
+			0xca, 0xac, 0x5b, 0xf4, 0x45, 0x49, 0x1f, 0x84,
+			0x86, 0x66, 0xce, 0x83, 0x57, 0xab, 0x1a, 0xd4,
+			0xe8, 0xe0, 0x18, 0x7d, 0x02, 0x1a, 0xda, 0x4b,
+			0x89, 0x9a, 0xd5, 0x1c, 0x41, 0xe7, 0x73, 0x6a,
+			0x2f, 0xc7, 0x00, 0xfe, 0xf7, 0xfe, 0xbc, 0x3e,
+			0x08, 0xb9, 0xa6, 0x48, 0xfa, 0x13, 0xff, 0x7c,
+			0x41, 0x8c, 0xa7, 0x76, 0x23, 0xf5, 0xbe, 0x3d,
+			0x96, 0x9c, 0x3f, 0x99, 0x00, 0xf6, 0xdd, 0x53,
+			0x7e, 0x8b, 0xbe, 0x5e, 0x19, 0xa0, 0x02, 0xb8,
+			0x72, 0x5a, 0x3f, 0x10, 0xdb, 0xe7, 0xa6, 0x0a,
+			0x9a, 0x53, 0x93, 0x27, 0x2b, 0xc0, 0xf3, 0x41,
+			0x05, 0xcf, 0xc2, 0xb9, 0x68, 0x0a, 0x70, 0x11,
+			0xf0, 0x6c, 0xc9, 0x0a, 0xce, 0xf9, 0x2e, 0x3f,
+			0x3f, 0x32, 0x44, 0x05, 0x51, 0x6f, 0x86, 0xe1,
+			0x62, 0x52, 0x42, 0x2d, 0xdf, 0x48, 0x21, 0x09,
+			0xd4, 0x48, 0x98, 0xcf, 0x30, 0xa3, 0xfc, 0x24,
+			0x43, 0xe1, 0xa8, 0xc3, 0x72, 0x88, 0x18, 0xc1,
+			0xd6, 0xe6, 0xe2, 0x02, 0x3a, 0x8d, 0x1e, 0x3a,
+			0x01, 0xe1, 0x98, 0x12, 0xdd, 0xda, 0x72, 0x3e,
+			0xaf, 0xc4, 0x32, 0x57, 0x1c, 0xb5, 0xd8, 0x51,
+			0x7b, 0x1f, 0xbc, 0xbe, 0x38, 0xa0, 0x76, 0xb1,
+			0x2a, 0x92, 0xf3, 0x34, 0x88, 0x91, 0xb5, 0x49,
+			0x25, 0x8b, 0x13, 0xae, 0xe2, 0xf8, 0x13, 0x01,
+			0x1e, 0x59, 0xc5, 0x3e, 0xba, 0xd0, 0x98, 0x99,
+			0x0b, 0x25, 0x14, 0x5d, 0xe8, 0x7c, 0x2c, 0xbe,
+			0xad, 0x78, 0xe8, 0x5a, 0xef, 0x67, 0xcd, 0xd5,
+			0x1b, 0xe2, 0x9f, 0xa6, 0xa4, 0xf6, 0x71, 0x2b,
+			0x2a, 0x9f, 0x05, 0xe3, 0x9b, 0x2b, 0x26, 0x33,
+			0x15, 0x3d, 0x00, 0x76, 0x69, 0x25, 0x9b, 0x84,
+			0xc9, 0x3b, 0x8e, 0xa8, 0x96, 0xea, 0xf6, 0x53,
+			0xa8, 0x79, 0x0b, 0xb7, 0x90, 0xa1, 0x36, 0xb4,
+			0x29, 0x4b, 0x57, 0x00, 0x06, 0xcb, 0x44, 0xb3,
+			0xfc, 0x25, 0x84, 0xd1, 0xcf, 0xac, 0x3e, 0x41,
+			0xb6, 0x9e, 0xdf, 0xa9, 0x51, 0xe1, 0x30, 0xc8,
+			0x5c, 0x97, 0x7b, 0xf6, 0xcb, 0xa0, 0xea, 0x3d,
+			0x0c, 0x13, 0x44, 0x15, 0xdd, 0x59, 0xc0, 0xba,
+			0xe7, 0xf3, 0xf7, 0x59, 0xbc, 0x46, 0xdf, 0x55,
+			0xad, 0xea, 0x54, 0x80, 0x65, 0x33, 0x69, 0xe3,
+			0x37, 0x08, 0x70, 0xa4, 0xb0, 0x45, 0xef, 0xad,
+			0xc5, 0xc6, 0x81, 0x10, 0x7b, 0x88, 0x30, 0xc1,
+			0xe7, 0xa3, 0x63, 0x89, 0xd6, 0x3a, 0x9d, 0xdb,
+			0xf9, 0x4b, 0x35, 0xe3, 0xd9, 0x14, 0xa3, 0x83,
+			0x41, 0x37, 0xf0, 0x49, 0x3e, 0x6e, 0xda, 0x91,
+			0x5a, 0x07, 0xa5, 0x73, 0x62, 0xbd, 0xf8, 0xc0,
+			0x14, 0xec, 0x17, 0x9d, 0xf8, 0x54, 0x1c, 0x78,
+			0x6b, 0x43, 0x91, 0x67, 0x79, 0x59, 0xc5, 0x50,
+			0x60, 0xe9, 0x44, 0x5d, 0x95, 0x9e, 0x91, 0xf4,
+			0xc9, 0x4f, 0xf7, 0x8a, 0x73, 0xf7, 0xcf, 0xec,
+			0xc4, 0x09, 0x12, 0x4e, 0x2d, 0xa2, 0xe6, 0x5d,
+			0x80, 0x88, 0x52, 0x35, 0xb2, 0xa8, 0x50, 0xdd,
+			0x12, 0xa4, 0xdb, 0x47, 0x09, 0x4b, 0x6a, 0xb6,
+			0xb8, 0x7b, 0xe5, 0xd0, 0xfb, 0xea, 0x21, 0xb3,
+			0xb3, 0x7a, 0x7f, 0x78, 0x19, 0x02, 0x09, 0x78,
+			0xb4, 0xcb, 0x69, 0x58, 0xf0, 0x6f, 0x27, 0xeb,
+			0x14, 0x01, 0xdd, 0x32, 0x31, 0xaf, 0x57, 0xf0,
+			0x34, 0x2d, 0x48, 0xc9, 0x44, 0x7f, 0x6b, 0x68,
+			0x44, 0xbf, 0x79, 0x57, 0x2a, 0x95, 0x6e, 0x60,
+			0xfc, 0x12, 0xad, 0x6a, 0x1f, 0x0a, 0xa0, 0x48,
+			0x78, 0xbd, 0x6d, 0x50, 0x15, 0x59, 0xd6, 0x6e,
+			0x63, 0x09, 0xa9, 0x42, 0x82, 0x60, 0xf2, 0xc2,
+			0xc5, 0x11, 0xa7, 0xb2, 0xde, 0xb1, 0xc7, 0xc5,
+			0x00, 0x79, 0x77, 0xa7, 0x54, 0xfe, 0xbd, 0x84,
+			0x26, 0xef, 0x3a, 0xe6, 0xab, 0xec, 0x1d, 0x15,
+			0xb5, 0x7c, 0x0a, 0xf4, 0x4b, 0x6e, 0xb0, 0xe5,
+			0x42, 0xaf, 0x67, 0x24, 0x29, 0x80, 0x5c, 0x67,
+			0x05, 0xb9, 0x6b, 0xcf, 0xa7, 0x6d, 0x29, 0xc9,
+			0xd3, 0xec, 0x82, 0x58, 0x35, 0x57, 0xca, 0x78,
+			0x3b, 0x59, 0xab, 0xea, 0x51, 0x47, 0x24, 0xdf,
+			0x66, 0xc8, 0x42, 0x8e, 0xe0, 0xc7, 0xc8, 0x1a,
+			0x7c, 0xf7, 0x8b, 0x91, 0x53, 0x1e, 0x78, 0x11,
+			0xf8, 0x4e, 0x42, 0xa6, 0x91, 0x9c, 0x83, 0xb1,
+			0xff, 0xa9, 0x13, 0x28, 0xa4, 0x23, 0x97, 0x58,
+			0xde, 0x11, 0x75, 0x9d, 0x6a, 0x81, 0x91, 0xfd,
+			0x47, 0x49, 0xb1, 0xff, 0x23, 0x9f, 0x5b, 0x3a,
+			0xee, 0x23, 0x88, 0x10, 0xde, 0xe2, 0x7c, 0x2f,
+			0x22, 0x9f, 0x2f, 0x13, 0xbb, 0xa2, 0xfd, 0xd5,
+			0x40, 0xc2, 0x48, 0x7d, 0x7a, 0x18, 0x98, 0x3a,
+			0xb2, 0x1f, 0x6b, 0x55, 0x09, 0xec, 0x27, 0x4e,
+			0xfd, 0xfd, 0x16, 0x29, 0xf7, 0x03, 0x8a, 0xec,
+			0x61, 0x8b, 0xd2, 0x8b, 0x8d, 0x2e, 0x5f, 0x0e,
+			0xf4, 0x2f, 0x85, 0x85, 0x91, 0x05, 0xe0, 0x92,
+			0x53, 0x24, 0x2b, 0xca, 0xc2, 0xe3, 0xcd, 0xe9,
+			0xdc, 0x3c, 0x44, 0xf1, 0x7e, 0x8c, 0xc7, 0xf2,
+			0x26, 0xd3, 0xef, 0xc8, 0xe7, 0x71, 0xa9, 0xf0,
+			0x12, 0x2f, 0x3c, 0x28, 0x0c, 0x18, 0xb4, 0xb9,
+			0xc6, 0x47, 0x42, 0x4a, 0x06, 0xd6, 0x20, 0x88,
+			0x9c, 0x7b, 0x2c, 0x51, 0x66, 0x5e, 0xfb, 0x39,
+			0x9f, 0x15, 0x69, 0xd5, 0xde, 0x6b, 0x36, 0x45,
+			0xb0, 0xd4, 0x59, 0xfe, 0x4d, 0x98, 0x6b, 0xcf,
+			0x35, 0x6b, 0x92, 0x01, 0xc2, 0x48, 0x57, 0x61,
+			0x23, 0xe8, 0x65, 0x2d, 0x5d, 0xc8, 0xc6, 0x21,
+			0x2d, 0x8c, 0x33, 0xd3, 0xd5, 0xb4, 0xa6, 0x63,
+			0x15, 0xb8, 0x50, 0x9d, 0x57, 0xf2, 0xd5, 0x06,
+			0x1a, 0x7d, 0x1d, 0x13, 0x30, 0xd4, 0xc9, 0x9d,
+			0x8e, 0x88, 0xe4, 0xa3, 0x95, 0x4d, 0x18, 0x1c,
+			0x0b, 0xc2, 0xfb, 0x54, 0x0d, 0x61, 0x90, 0x87,
+			0xd4, 0xf0, 0x39, 0x0f, 0x06, 0x9e, 0x16, 0xab,
+			0x2a, 0x61, 0xdd, 0x06, 0x34, 0xbc, 0x68, 0x4d,
+			0xd3, 0xe3, 0xbb, 0x13, 0x1d, 0x86, 0x86, 0xa5,
+			0x8b, 0x08, 0xe5, 0x3b, 0x9e, 0xc5, 0xa0, 0x42,
+			0xb2, 0x26, 0x80, 0x52, 0xfb, 0xaf, 0x70, 0xc2,
+			0x2e, 0x20, 0x74, 0xb1, 0x39, 0xcc, 0xba, 0x3b,
+			0x39, 0x87, 0xf7, 0x9d, 0x6c, 0x85, 0x63, 0x7a,
+			0xcc, 0xc3, 0xa9, 0x3d, 0x8a, 0xfd, 0x89, 0xbf,
+			0xfe, 0xf4, 0x4f, 0x5c, 0x90, 0x0c, 0x13, 0xb9,
+			0x51, 0x82, 0xaa, 0x73, 0x6d, 0x11, 0x1d, 0x53,
+			0xb7, 0x1c, 0xc3, 0x9f, 0xe0, 0xd2, 0x1e, 0x5b,
+			0x0c, 0x74, 0xd0, 0xe7, 0x23, 0x48, 0x27, 0x8b,
+			0x78, 0xe3, 0x33, 0x8b, 0xf3, 0x3b, 0x7a, 0x00,
+			0x11, 0xdb, 0x34, 0xd7, 0xd4, 0x8c, 0xe4, 0xbe,
+			0x65, 0x7c, 0xfc, 0x8b, 0x1b, 0x35, 0xf0, 0x6d,
+			0x7d, 0xe4, 0x49, 0x19, 0xbd, 0x4c, 0x05, 0xae,
+			0xdd, 0x9e, 0x26, 0x70, 0x74, 0xcb, 0xb7, 0x80,
+			0x09, 0xaf, 0xe6, 0xa5, 0x27, 0xba, 0x95, 0x33,
+			0x56, 0x58, 0x56, 0xe5, 0x9b, 0x77, 0x7d, 0x25,
+			0xbc, 0x59, 0xeb, 0xdb, 0x54, 0x9f, 0x76, 0xe9,
+			0x32, 0x77, 0x99, 0x8c, 0x28, 0x98, 0xe5, 0xf0,
+			0x3e, 0x33, 0x13, 0xb0, 0x04, 0x1d, 0xdf, 0x4c,
+			0x58, 0x45, 0x5c, 0x0f, 0x41, 0x95, 0x5a, 0xbd,
+			0xcf, 0x09, 0x21, 0x87, 0x0f, 0x2b, 0x10, 0x19,
+			0xc8, 0x5f, 0xf1, 0xcd, 0xb1, 0x61, 0xc5, 0x21,
+			0x73, 0xad, 0x3e, 0x6b, 0x70, 0xdd, 0x07, 0x1c,
+			0xbe, 0x23, 0x9a, 0x35, 0x41, 0x21, 0x11, 0x99,
+			0x39, 0x50, 0xf8, 0x2b, 0x93, 0xbc, 0x4c, 0x59,
+			0xc5, 0x86, 0x96, 0xc7, 0x59, 0x1a, 0x25, 0xf0,
+			0x9a, 0x9b, 0xc2, 0x1c, 0x0c, 0xea, 0x89, 0x56,
+			0x29, 0x96, 0x98, 0x6c, 0x98, 0x5f, 0x8a, 0xdb,
+			0x99, 0x31, 0x03, 0x43, 0x5d, 0xb2, 0x05, 0x4a,
+			0xa0, 0x62, 0xa6, 0xda, 0x6d, 0xe3, 0x14, 0xc4,
+			0x91, 0x9e, 0xeb, 0xb6, 0xf5, 0x13, 0x69, 0x5c,
+			0xfc, 0x41, 0x7d, 0x01, 0xf7, 0x63, 0x3c, 0xa7,
+			0xdb, 0x1e, 0xc5, 0x3f, 0xbc, 0x1b, 0x53, 0x40,
+			0x5a, 0x2f, 0xf2, 0xf2, 0x5a, 0xdc, 0x66, 0xa6,
+			0x01, 0xe4, 0x15, 0xd8, 0x68, 0xbe, 0xdf, 0x5e,
+			0xcd, 0x30, 0x1d, 0xa7, 0x9e, 0xbd, 0xcd, 0x0f,
+			0x67, 0x15, 0x4f, 0x49, 0x25, 0x59, 0x4c, 0xf8,
+			0x20, 0x36, 0xf4, 0x5e, 0x74, 0xd1, 0x05, 0x38,
+			0x49, 0x9b, 0x11, 0x83, 0xba, 0x47, 0x0b, 0xef,
+			0xca, 0x03, 0x2d, 0xc8, 0x5e, 0x7f, 0x63, 0x30,
+			0x23, 0x38, 0x8b, 0x38, 0x01, 0xcc, 0x55, 0x56,
+			0x4d, 0xa1, 0xb4, 0xeb, 0xd0, 0x77, 0x8f, 0x28,
+			0x18, 0x40, 0x6a, 0xe7, 0x66, 0x2b, 0x7c, 0x0e,
+			0x1a, 0xf0, 0x29, 0xf9, 0xfd, 0x9b, 0x8c, 0x1a,
+			0x88, 0x08, 0xc8, 0x55, 0x07, 0x0a, 0x2b, 0x68,
+			0x6e, 0x0d, 0x5f, 0x44, 0xf6, 0x00, 0x02, 0xae,
+			0xe1, 0x37, 0x0c, 0x10, 0x21, 0x9b, 0x71, 0x78,
+			0x5b, 0x57, 0xab, 0xf1, 0x8c, 0x0e, 0x24, 0x4a,
+			0x3a, 0x7c, 0x0d, 0xc1, 0x8e, 0x8d, 0xe9, 0x81,
+			0x33, 0x51, 0xd9, 0xf5, 0xaf, 0xa4, 0xf1, 0x91,
+			0xe3, 0xb3, 0xbf, 0x1c, 0xb4, 0x49, 0x92, 0x50,
+			0xa2, 0x8c, 0x05, 0x30, 0x78, 0x91, 0x5b, 0x2a,
+			0x67, 0x45, 0xa4, 0x60, 0x0a, 0x07, 0x06, 0x11,
+			0xaa, 0x0e, 0x03, 0xe8, 0xeb, 0x1d, 0xc4, 0x34,
+			0x82, 0x60, 0x8e, 0xe5, 0xa6, 0xa4, 0xbf, 0xd2,
+			0xd0, 0xb6, 0x64, 0x63, 0x05, 0x9c, 0xcd, 0x2f,
+			0x75, 0xd2, 0x77, 0xd4, 0x99, 0xc5, 0x36, 0xde,
+			0x8d, 0x7b, 0x79, 0xfd, 0x0c, 0x7d, 0x51, 0x78,
+			0x26, 0x32, 0x24, 0xe2, 0xe3, 0xe9, 0x5c, 0x8c,
+			0x1c, 0x49, 0x24, 0x63, 0x67, 0xf9, 0x4e, 0xd4,
+			0x76, 0x46, 0x7d, 0x31, 0xa0, 0x7e, 0xe6, 0x71,
+			0xd2, 0x58, 0x3b, 0x4b, 0x99, 0x37, 0xbc, 0xc5,
+			0x60, 0x54, 0x3b, 0x96, 0x3f, 0x6e, 0xe0, 0xf8,
+			0x33, 0x0a, 0xe6, 0xd0, 0xbf, 0xc1, 0xa4, 0x55,
+			0x80, 0x73, 0xca, 0xcf, 0x41, 0xee, 0x7c, 0xb4,
+			0x62, 0x10, 0x5b, 0x8d, 0x67, 0x42, 0x88, 0x15,
+			0x93, 0x1d, 0x83, 0x65, 0xd5, 0x09, 0x21, 0xf4,
+			0x6d, 0xd2, 0x00, 0x71, 0xd5, 0x8e, 0x53, 0x01,
+			0x1a, 0x8f, 0xda, 0x04, 0x4c, 0x27, 0xde, 0xf0,
+			0x97, 0xea, 0x2b, 0xf1, 0xb4, 0x76, 0x7a, 0xbb,
+			0x9f, 0x20, 0x49, 0xc9, 0xbb, 0x65, 0xbe, 0x51,
+			0x86, 0xec, 0x91, 0x19, 0x21, 0x38, 0x5b, 0x22,
+			0x20, 0xf2, 0x96, 0x23, 0x7d, 0x78, 0x4b, 0x51,
+			0x9b, 0xeb, 0x9a, 0x7c, 0x2b, 0xd1, 0xad, 0x0b,
+			0x69, 0x9a, 0x80, 0xe7, 0x62, 0xa6, 0x48, 0x95,
+			0xe2, 0x8a, 0xac, 0x42, 0xa5, 0xac, 0xab, 0x1b,
+			0xfb, 0xba, 0xda, 0xe8, 0x7e, 0x25, 0xfd, 0x56,
+			0xb1, 0x12, 0x7e, 0xba, 0x82, 0x1c, 0x36, 0xa1,
+			0xf3, 0x28, 0x2b, 0x2f, 0xb1, 0xad, 0x3a, 0xbb,
+			0x53, 0x57, 0xd5, 0x32, 0xae, 0x3c, 0xce, 0x66,
+			0xa1, 0x5b, 0xa3, 0x3c, 0xff, 0x91, 0x96, 0xa5,
+			0x58, 0xa8, 0xb6, 0x71, 0xb2, 0xba, 0xac, 0x9c,
+			0x66, 0xdf, 0x6a, 0xc7, 0xde, 0xa2, 0xe6, 0xa5,
+			0xf3, 0x2b, 0x13, 0x3e, 0x52, 0xb9, 0x5b, 0x5f,
+			0x82, 0x31, 0x2d, 0xc2, 0xc1, 0xa0, 0x67, 0x2a,
+			0xe9, 0xc5, 0x91, 0xfa, 0xb5, 0x9e, 0xb9, 0xb7,
+			0x97, 0x49, 0x6f, 0xa7, 0x4d, 0x0e, 0x7f, 0xb3,
+			0xc8, 0x0b, 0x95, 0x89, 0x90, 0xf3, 0x88, 0x45,
+			0x5a, 0x26, 0xf7, 0x95, 0xf5, 0xe9, 0xc7, 0xa8,
+			0x6e, 0x9a, 0xec, 0x7d, 0xee, 0x9a, 0x27, 0x12,
+			0x9f, 0x4b, 0xf6, 0xf5, 0xfb, 0x26, 0xc4, 0x7e,
+			0x01, 0xcc, 0xf7, 0x9f, 0xfb, 0x00, 0x7e, 0xfb,
+			0x45, 0x49, 0x60, 0xc2, 0x1a, 0x9c, 0x81, 0xe4,
+			0xdc, 0xf3, 0x7b, 0xc7, 0x24, 0x07, 0x35, 0x72,
+			0x93, 0xf0, 0x8b, 0xfd, 0x43, 0x92, 0x65, 0xca,
+			0x6a, 0xf5, 0xf9, 0x8f, 0x40, 0x0c, 0xee, 0xe0,
+			0x3e, 0xb8, 0x29, 0x71, 0xaf, 0x49, 0x40, 0x18,
+			0xec, 0x7f, 0xb1, 0x01, 0x7c, 0xad, 0xd8, 0x00,
+			0x43, 0xab, 0x30, 0x8f, 0x5b, 0xf1, 0x22, 0x36,
+			0x9e, 0xbc, 0x70, 0xb9, 0x69, 0x82, 0x6a, 0x0c,
+			0xb5, 0xae, 0x2c, 0x5f, 0x4c, 0x48, 0x09, 0x1e,
+			0xa0, 0x00, 0x8b, 0x8c, 0x2d, 0x4d, 0x3e, 0x27,
+			0xe5, 0x0f, 0xf9, 0x65, 0x0e, 0x73, 0x13, 0x85,
+			0xdf, 0xe8, 0xf6, 0x68, 0x7f, 0xf0, 0x8b, 0x21,
+			0x9d, 0x1d, 0x61, 0x10, 0x33, 0xd0, 0xda, 0x4b,
+			0xb5, 0x06, 0x5b, 0x62, 0xd1, 0x07, 0x95, 0xc4,
+			0x2c, 0x60, 0x6c, 0xfe, 0xc5, 0x25, 0x8a, 0xb6,
+			0x40, 0x70, 0x31, 0x16, 0xbf, 0xe6, 0xc6, 0x34,
+			0x81, 0x06, 0x94, 0x30, 0xd8, 0xf6, 0x08, 0xec,
+			0x97, 0x3a, 0x5d, 0xb2, 0xd4, 0x6e, 0x08, 0x53,
+			0xe0, 0x9b, 0x14, 0xcd, 0x44, 0x34, 0xe3, 0x82,
+			0x19, 0xaa, 0x31, 0x19, 0xe6, 0x47, 0x1f, 0x81,
+			0xae, 0x32, 0xc3, 0x73, 0x75, 0xaf, 0xc9, 0xab,
+			0xb9, 0xdc, 0x34, 0x6f, 0x64, 0xf2, 0xd9, 0xb4,
+			0x51, 0x41, 0x13, 0xd5, 0x47, 0x18, 0x1a, 0x6c,
+			0x09, 0x69, 0xb7, 0x86, 0x8c, 0x7b, 0x9d, 0xd6,
+			0x7b, 0xa6, 0x65, 0x39, 0x3d, 0x97, 0xa6, 0x5b,
+			0x27, 0x81, 0xab, 0xcd, 0xda, 0x4e, 0x34, 0x64,
+			0xc8, 0xb3, 0x3a, 0x4d, 0x61, 0x88, 0x1f, 0xae,
+			0x28, 0x37, 0xe0, 0x36, 0xea, 0xd3, 0x7f, 0x7c,
+			0x08, 0x18, 0x52, 0x18, 0x8a, 0xf0, 0x2d, 0xb9,
+			0x3a, 0x0f, 0xe1, 0x27, 0x30, 0x21, 0x92, 0x47,
+			0x46, 0x2a, 0x9a, 0xb9, 0x62, 0xf1, 0x67, 0xae,
+			0xc7, 0xde, 0xf5, 0xb8, 0xb1, 0xe2, 0x31, 0x8c,
+			0xba, 0x86, 0xd1, 0x67, 0x4d, 0xb5, 0xdb, 0xf6,
+			0xd6, 0x99, 0xe2, 0x6c, 0xf9, 0xf2, 0x5a, 0xd0,
+			0xbd, 0x60, 0x3a, 0x15, 0xfa, 0x2d, 0xdf, 0x99,
+			0x6f, 0xd5, 0xba, 0xa2, 0x81, 0xc4, 0x3b, 0x0a,
+			0xa8, 0x0b, 0x0e, 0xf4, 0x10, 0x7b, 0x9e, 0x8b,
+			0xd6, 0xad, 0x93, 0x47, 0x98, 0xf3, 0x08, 0xfd,
+			0xbc, 0x4d, 0x27, 0x3b, 0x9a, 0x41, 0x63, 0xb1,
+			0x25, 0x64, 0x2b, 0x57, 0x61, 0x1e, 0xed, 0x69,
+			0x53, 0xa8, 0x99, 0x3c, 0x7a, 0xdb, 0xd1, 0xa9,
+			0xf3, 0x3f, 0x3d, 0xfe, 0xef, 0xae, 0x2b, 0x9f,
+			0xe8, 0xd6, 0x4b, 0x6b, 0xd2, 0x78, 0xba, 0x90,
+			0xf8, 0x6b, 0x8b, 0x7b, 0xf5, 0x27, 0x64, 0xef,
+			0x23, 0x26, 0xdb, 0x7e, 0x22, 0x6b, 0xf0, 0x33,
+			0x9a, 0xce, 0x3e, 0xed, 0x45, 0x65, 0xdf, 0xa9,
+			0x58, 0x33, 0xe1, 0x8d, 0xfd, 0x94, 0x31, 0x1e,
+			0x30, 0x29, 0x98, 0x99, 0xe2, 0x5f, 0xb8, 0x08,
+			0x7a, 0x7c, 0x49, 0x2a, 0x82, 0x41, 0xeb, 0x82,
+			0x81, 0x8e, 0xe5, 0x48, 0x49, 0x2f, 0x02, 0x92,
+			0x21, 0x9f, 0x53, 0xe9, 0x58, 0xcd, 0xa5, 0xff,
+			0xe9, 0xc0, 0xfc, 0x22, 0x44, 0x89, 0xd4, 0xad,
+			0x1b, 0xa4, 0x1c, 0x2b, 0x71, 0x44, 0x76, 0xf4,
+			0x66, 0xc8, 0x1f, 0xdb, 0xa3, 0x09, 0x6d, 0x6f,
+			0xb0, 0xd4, 0xda, 0x60, 0x06, 0xd3, 0x4d, 0x2e,
+			0x66, 0xf0, 0x62, 0x24, 0x9a, 0xa6, 0xbe, 0xd9,
+			0x60, 0x28, 0xf9, 0xba, 0x08, 0x44, 0x67, 0x9a,
+			0xf3, 0x37, 0x45, 0x2f, 0xf1, 0x3d, 0xe6, 0xee,
+			0x55, 0x0e, 0x4b, 0xa2, 0x38, 0x5e, 0x67, 0x29,
+			0x88, 0x14, 0x21, 0xe0, 0x61, 0x3d, 0xdc, 0x57,
+			0xd2, 0xf3, 0x09, 0xe1, 0x06, 0x6f, 0x22, 0x75,
+			0x8c, 0x94, 0xe7, 0xb2, 0x74, 0x39, 0x51, 0x18,
+			0xc1, 0x83, 0x19, 0xca, 0x14, 0x71, 0xcc, 0x83,
+			0xf0, 0x9b, 0x95, 0x96, 0xb0, 0x9b, 0x56, 0x73,
+			0xbf, 0x30, 0xba, 0xab, 0xcd, 0xf3, 0x22, 0x2c,
+			0x66, 0x4a, 0x14, 0x1b, 0x1e, 0x02, 0xd6, 0xa0,
+			0xd8, 0x47, 0x40, 0x66, 0x1a, 0xd0, 0xf7, 0x4e,
+			0x0a, 0x09, 0x18, 0x78, 0x55, 0xf8, 0x4b, 0xec,
+			0x0c, 0x39, 0x1b, 0x79, 0x30, 0x15, 0x07, 0x0f,
+			0x53, 0x3e, 0x32, 0xa4, 0x92, 0x22, 0x62, 0xdd,
+			0x56, 0x55, 0x35, 0xe2, 0x1b, 0xd4, 0x9f, 0x3b,
+			0x19, 0xdd, 0xfd, 0xaa, 0x20, 0x30, 0xc0, 0xab,
+			0x97, 0xf9, 0x43, 0x19, 0x3d, 0x0a, 0xe7, 0x48,
+			0xe0, 0xb1, 0x38, 0x59, 0x40, 0x97, 0x5f, 0x1f,
+			0x50, 0x91, 0x3b, 0xfd, 0xb1, 0xae, 0x19, 0xf0,
+			0x80, 0x1d, 0x8b, 0xac, 0x88, 0x51, 0xd6, 0x96,
+			0x1d, 0x61, 0xa9, 0xc3, 0xaf, 0xe7, 0x3a, 0xf3,
+			0x45, 0x5e, 0x21, 0x1d, 0x79, 0x41, 0xb6, 0xd1,
+			0xe9, 0x13, 0xa3, 0xc0, 0xda, 0xc0, 0xab, 0x2f,
+			0x14, 0xa3, 0x9b, 0x1f, 0x47, 0xdd, 0xa4, 0x27,
+			0xbe, 0x50, 0x42, 0x80, 0x1d, 0x50, 0x92, 0xc8,
+			0x5e, 0x57, 0x34, 0x21, 0x41, 0xff, 0x40, 0x23,
+			0x73, 0xe4, 0xc0, 0x03, 0x8f, 0xd5, 0x3b, 0x50,
+			0x7c, 0xb2, 0xd8, 0x07, 0x18, 0xfc, 0x49, 0x0d,
+			0xfd, 0x95, 0xfc, 0x4c, 0x1b, 0xf5, 0x93, 0xc4,
+			0x03, 0xcd, 0x67, 0xb9, 0xa2, 0xca, 0x4e, 0x46,
+			0xe6, 0xbd, 0x6e, 0xb4, 0x3a, 0x43, 0x3a, 0x82,
+			0xec, 0xc5, 0x7d, 0xf8, 0x31, 0x11, 0x3b, 0x0c,
+			0x51, 0x12, 0xb0, 0xe4, 0xc9, 0xd2, 0xac, 0xd7,
+			0xc9, 0x13, 0xeb, 0xbd, 0x4d, 0xaa, 0xf2, 0x4a,
+			0x83, 0x5f, 0xd9, 0x6d, 0xad, 0x9a, 0x77, 0x20,
+			0x71, 0x96, 0x4d, 0xbc, 0xcc, 0x18, 0xf2, 0x4c,
+			0x63, 0xf6, 0x11, 0x8f, 0x6b, 0x5c, 0x00, 0x78,
+			0x43, 0x91, 0x7e, 0x7f, 0xca, 0x18, 0x79, 0xe3,
+			0xbd, 0x6c, 0xc1, 0xdc, 0x66, 0xa1, 0xd1, 0xf1,
+			0x19, 0xa8, 0x89, 0xb0, 0x31, 0xdd, 0x8e, 0x5d,
+			0x43, 0x32, 0x07, 0x8f, 0xea, 0x2c, 0x46, 0xf1,
+			0xc2, 0x06, 0x19, 0x82, 0xc8, 0x05, 0x47, 0x73,
+			0x3e, 0x38, 0x67, 0x79, 0x65, 0xfc, 0xc7, 0x6c,
+			0x4b, 0x47, 0xba, 0x5f, 0x8d, 0x18, 0x2b, 0x00,
+			0xbf, 0xde, 0xe7, 0x5a, 0x83, 0x56, 0x07, 0x2c,
+			0x1d, 0xa5, 0xc4, 0x73, 0x17, 0x0f, 0x2d, 0xbb,
+			0xa1, 0xc5, 0x43, 0x36, 0x8a, 0x75, 0xb1, 0xd8,
+			0xe9, 0x19, 0xa3, 0xf6, 0x7a, 0x00, 0xee, 0xf7,
+			0xb2, 0x0a, 0xb7, 0x64, 0xb3, 0xe6, 0xf6, 0x90,
+			0x34, 0xe7, 0x58, 0x16, 0xda, 0x67, 0x37, 0x54,
+			0x28, 0xdf, 0x07, 0x70, 0x73, 0x24, 0x61, 0xf8,
+			0x31, 0xfe, 0x2d, 0xfa, 0x56, 0x39, 0x0b, 0xe2,
+			0xe1, 0x07, 0xce, 0x0b, 0xaf, 0x4d, 0x00, 0xa4,
+			0xcb, 0x3f, 0x18, 0x55, 0xbd, 0xdc, 0x50, 0xfe,
+			0xee, 0xd1, 0x7c, 0x15, 0x6e, 0xf7, 0xe1, 0x8f,
+			0xba, 0xce, 0xd4, 0x0c, 0x30, 0x5b, 0xa7, 0x77,
+			0xef, 0x94, 0x2b, 0xee, 0xcb, 0x33, 0x6b, 0x27,
+			0xd2, 0xb4, 0x39, 0x5a, 0xfa, 0x50, 0xbe, 0xbb,
+			0x2b, 0x04, 0xa1, 0xb1, 0x26, 0x61, 0xfe, 0x68,
+			0x4b, 0xe4, 0x50, 0x5a, 0x52, 0x72, 0x93, 0xa4,
+			0x97, 0xae, 0xb9, 0xff, 0x13, 0x0f, 0x9c, 0x4b,
+			0xc1, 0x54, 0x04, 0xa8, 0xe2, 0x16, 0xe5, 0xcd,
+			0xfc, 0x48, 0xe0, 0x7d, 0x36, 0x3d, 0xe5, 0xbe,
+			0x46, 0x5f, 0xb7, 0x99, 0x3f, 0x4e, 0xfc, 0xbc,
+			0xfd, 0x76, 0x18, 0xe6, 0xdb, 0x1d, 0xb2, 0x65,
+			0x4b, 0x5e, 0x00, 0xaf, 0xeb, 0x03, 0x18, 0x32,
+			0x56, 0xbb, 0x0b, 0x42, 0x47, 0x8c, 0xca, 0x85,
+			0x5d, 0x24, 0x2f, 0x21, 0xfc, 0xb3, 0xda, 0xd0,
+			0x73, 0x7f, 0x2a, 0x59, 0x18, 0x74, 0x63, 0xa8,
+			0x29, 0xe8, 0x78, 0x31, 0xf7, 0xe4, 0x60, 0xff,
+			0xb5, 0xf0, 0x34, 0x88, 0x81, 0x8a, 0xc2, 0xfd,
+			0x2b, 0x1a, 0x84, 0x40, 0xe6, 0x9a, 0x8b, 0x55,
+			0xcd, 0xbe, 0x8c, 0x25, 0x12, 0x4d, 0xbb, 0x41,
+			0x2e, 0x1b, 0x97, 0x1c, 0x97, 0xfe, 0x11, 0xa9,
+			0xa3, 0x6f, 0x7a, 0x2f, 0x03, 0xe4, 0xb5, 0xec,
+			0x38, 0x33, 0x13, 0x57, 0x63, 0xdf, 0x52, 0xee,
+			0xee, 0xad, 0xe9, 0xa6, 0xd0, 0xac, 0xea, 0x3b,
+			0x39, 0x8a, 0xab, 0x21, 0x0d, 0x41, 0xdb, 0x23,
+			0x65, 0x3e, 0x26, 0x09, 0xbc, 0x9f, 0x52, 0x4d,
+			0x25, 0x08, 0x8d, 0xd0, 0x9b, 0x45, 0x26, 0x88,
+			0x7a, 0x6c, 0x0e, 0xd6, 0x37, 0x39, 0x85, 0x35,
+			0x02, 0xa9, 0xa0, 0xeb, 0x78, 0x71, 0x5b, 0x3f,
+			0x0f, 0x2a, 0xa4, 0x65, 0xa9, 0xc8, 0xef, 0x20,
+			0x60, 0xa4, 0xac, 0x5c, 0x68, 0x70, 0x76, 0xaf,
+			0x6f, 0x36, 0xd2, 0xb8, 0xc1, 0xee, 0xe6, 0xf7,
+			0xd3, 0xe9, 0x98, 0xc0, 0x18, 0xff, 0xa6, 0x9f,
+			0x30, 0x24, 0xc7, 0xdc, 0xea, 0x80, 0xd1, 0x38,
+			0x99, 0xa0, 0xd0, 0x20, 0x63, 0x1a, 0xbb, 0xaf,
+			0x3d, 0x82, 0xbb, 0x9b, 0xf0, 0x42, 0x0e, 0x87,
+			0x3d, 0x8e, 0xe2, 0xde, 0xbb, 0x04, 0x7c, 0x11,
+			0x49, 0x4c, 0xc6, 0x1f, 0x69, 0x22, 0x36, 0x08,
+			0x10, 0x68, 0x1c, 0x17, 0x75, 0x39, 0x76, 0xf8,
+			0x15, 0xcc, 0xf7, 0xe3, 0xe4, 0xe2, 0x47, 0xd5,
+			0xad, 0x63, 0xbe, 0xc6, 0xc3, 0x82, 0xae, 0xc5,
+			0x79, 0x2b, 0xa2, 0x41, 0x55, 0x8f, 0x49, 0x2e,
+			0x96, 0x8b, 0x07, 0x3b, 0x30, 0x44, 0x69, 0x26,
+			0xe3, 0xc8, 0xd3, 0xc5, 0xd6, 0x46, 0x4d, 0x99,
+			0x79, 0x04, 0xf6, 0xfc, 0x93, 0x44, 0x20, 0xb7,
+			0x4d, 0x05, 0x5c, 0x00, 0xc0, 0x7a, 0x82, 0x22,
+			0xf8, 0x13, 0xa9, 0x2b, 0x94, 0x60, 0x72, 0x94,
+			0xcd, 0x48, 0xd4, 0x91, 0x36, 0x63, 0xba, 0x44,
+			0x7a, 0x61, 0xba, 0xe9, 0x1e, 0xf2, 0x50, 0xff,
+			0x3a, 0xd2, 0xa6, 0x85, 0xb0, 0x5a, 0x54, 0xd2,
+			0xb4, 0xef, 0x65, 0xe6, 0xe6, 0x27, 0x9e, 0x14,
+			0x3d, 0xf4, 0xf0, 0x1e, 0xee, 0x52, 0xa5, 0x79,
+			0xfb, 0x71, 0x42, 0xe5, 0x75, 0xd6, 0x02, 0x7a,
+			0x66, 0x78, 0xcd, 0x30, 0x44, 0xaa, 0xb0, 0x87,
+			0x99, 0x3e, 0xa6, 0x04, 0x0f, 0xcd, 0x8f, 0xe9,
+			0x6d, 0xbf, 0xb6, 0xab, 0xa9, 0x0c, 0xd8, 0x26,
+			0xa2, 0xc7, 0xb1, 0x0d, 0x27, 0x9c, 0x7b, 0x97,
+			0x20, 0x44, 0xa5, 0x2c, 0x0b, 0x38, 0xda, 0x10,
+			0xa2, 0x0e, 0xa7, 0x35, 0x31, 0x01, 0xd0, 0x6a,
+			0x5b, 0xd8, 0x82, 0xe9, 0xf9, 0x34, 0xb2, 0x35,
+			0x15, 0x61, 0xec, 0x37, 0x08, 0x29, 0x92, 0xf5,
+			0x0a, 0x46, 0xc1, 0xde, 0x7b, 0x0b, 0xc5, 0x4f,
+			0xf0, 0x7c, 0x1b, 0x99, 0xce, 0x50, 0x87, 0x66,
+			0x24, 0xb0, 0x86, 0x30, 0x7b, 0x24, 0x6b, 0xca,
+			0xdb, 0xfd, 0xf6, 0x30, 0x4a, 0xff, 0xa6, 0x38,
+			0x5a, 0xde, 0x9b, 0x75, 0xf1, 0x2d, 0x11, 0xc8,
+			0x13, 0xb4, 0xba, 0x89, 0xfd, 0x99, 0x13, 0x34,
+			0x31, 0x42, 0xa0, 0xb1, 0x8f, 0x88, 0x5c, 0xff,
+			0x28, 0xb2, 0x25, 0x1f, 0x69, 0x62, 0x8f, 0xfa,
+			0x35, 0x77, 0x49, 0x2f, 0x82, 0xd6, 0xb8, 0xe5,
+			0xf6, 0xcc, 0x50, 0x8e, 0x36, 0x92, 0xa3, 0xdc,
+			0x64, 0xa3, 0x18, 0x5b, 0xc4, 0xda, 0x3e, 0xc6,
+			0x73, 0xd9, 0x1d, 0x7b, 0x1f, 0x77, 0x5c, 0xa2,
+			0x4d, 0x61, 0x1a, 0x37, 0x0b, 0x62, 0x5a, 0x76,
+			0xd8, 0x3d, 0xf9, 0x83, 0xe3, 0x41, 0x66, 0x54,
+			0x93, 0x4a, 0xa1, 0xa5, 0xf6, 0x6d, 0x84, 0x8d,
+			0x0f, 0x3a, 0x07, 0xa5, 0xcc, 0xd7, 0x5c, 0x75,
+			0xb6, 0x4d, 0xe5, 0x15, 0xd7, 0x00, 0x26, 0xc8,
+			0x51, 0x16, 0x6a, 0xc6, 0xd0, 0x51, 0x69, 0xb4,
+			0x70, 0xeb, 0x68, 0x64, 0x98, 0x3c, 0x4f, 0x71,
+			0x3f, 0x20, 0xf4, 0xa8, 0x52, 0xb3, 0x71, 0x60,
+			0x25, 0x09, 0xc4, 0xd2, 0xeb, 0xe8, 0xf7, 0x3b,
+			0x92, 0xa8, 0x46, 0xf0, 0xfc, 0x83, 0x56, 0x3a,
+			0x19, 0x98, 0x89, 0xec, 0x8a, 0x3e, 0x69, 0xe1,
+			0xfc, 0x78, 0x06, 0x5c, 0x9e, 0xff, 0x9d, 0x99,
+			0xfa, 0xa1, 0x87, 0x5a, 0xea, 0xc5, 0xb1, 0x4f,
+			0x26, 0xf8, 0x2a, 0xe4, 0xbb, 0xa6, 0xb2, 0xed,
+			0x4f, 0x8b, 0x5f, 0x66, 0x31, 0x5c, 0x2b, 0xbc,
+			0xff, 0x2e, 0x4e, 0x78, 0xb0, 0x30, 0xef, 0x11,
+			0x30, 0x1d, 0x36, 0x96, 0xc3, 0x86, 0x11, 0x4e,
+			0x24, 0xa2, 0x21, 0x07, 0x7b, 0x48, 0x51, 0xad,
+			0x92, 0x0a, 0xad, 0xce, 0xd6, 0x13, 0x0f, 0x88,
+			0x75, 0xac, 0x0c, 0x73, 0x7d, 0xa0, 0x4f, 0x77,
+			0x6d, 0xbc, 0x72, 0xda, 0x84, 0x74, 0xd6, 0xd5,
+			0xc4, 0x6d, 0xf8, 0xe6, 0x32, 0xa3, 0xe0, 0x87,
+			0x27, 0x9d, 0x5a, 0xe3, 0x0d, 0x80, 0x0e, 0x23,
+			0x0a, 0xb1, 0x9f, 0x31, 0x47, 0x4a, 0x9e, 0x46,
+			0xd7, 0xce, 0xfd, 0x60, 0xa4, 0xd1, 0xd5, 0xc5,
+			0xe4, 0x13, 0x67, 0xb6, 0x73, 0x82, 0xe1, 0x96,
+			0x8a, 0x93, 0xc0, 0xa3, 0xba, 0xb7, 0x2b, 0xc3,
+			0x2c, 0xdd, 0xdd, 0x6a, 0xcd, 0x22, 0xf1, 0x80,
+			0x50, 0xf3, 0xc9, 0xef, 0xae, 0xaa, 0x06, 0xe0,
+			0x18, 0x57, 0x55, 0x9f, 0x3a, 0x95, 0xcb, 0xa1,
+			0x9b, 0xd3, 0x2b, 0x2a, 0xfa, 0x18, 0x04, 0x37,
+			0x00, 0x08, 0x14, 0xc5, 0x6f, 0x76, 0x97, 0xca,
+			0xd6, 0x17, 0xcd, 0x73, 0x95, 0x59, 0x2d, 0x8a,
+			0x66, 0xf6, 0x96, 0x5e, 0x79, 0x56, 0x15, 0x19,
+			0x6a, 0xdd, 0xda, 0x92, 0xb1, 0xc1, 0xa8, 0x5e,
+			0x64, 0xea, 0x0a, 0x38, 0xe3, 0x15, 0x80, 0xbc,
+			0x03, 0xda, 0xf2, 0xbf, 0xf1, 0xea, 0xf1, 0x60,
+			0xb6, 0xbc, 0xf0, 0x50, 0xcd, 0x76, 0xd2, 0xd6,
+			0x53, 0xc0, 0x55, 0xa8, 0x74, 0xa9, 0xf3, 0xba,
+			0xb0, 0xfa, 0xe7, 0x0e, 0x57, 0x6e, 0xf7, 0xef,
+			0xd7, 0xea, 0x11, 0x4a, 0xf2, 0x11, 0x36, 0xd2,
+			0x44, 0xdc, 0x71, 0x80, 0xcf, 0x9b, 0x27, 0xf4,
+			0x7b, 0x61, 0xaa, 0x1d, 0xfb, 0xf1, 0xc8, 0xde,
+			0x3d, 0xda, 0x98, 0xe5, 0x17, 0x82, 0xda, 0x7e,
+			0x5e, 0x61, 0xd8, 0x44, 0x86, 0xc4, 0x46, 0xba,
+			0xee, 0x25, 0x4d, 0x48, 0xd4, 0xe4, 0x57, 0x3b,
+			0xfb, 0x12, 0xbd, 0xd3, 0x06, 0xb4, 0xc9, 0x28,
+			0xc4, 0xae, 0xfd, 0x22, 0xd9, 0xe5, 0xf5, 0x49,
+			0xb2, 0xa3, 0x60, 0x4d, 0x57, 0x8a, 0x69, 0xb0,
+			0x74, 0x19, 0x90, 0xc2, 0x71, 0x79, 0xda, 0x8e,
+			0x9f, 0x5e, 0x1b, 0xaa, 0x12, 0x1e, 0x64, 0x83,
+			0x77, 0x3c, 0x31, 0x70, 0x44, 0x6e, 0xa6, 0x05,
+			0x2a, 0x6a, 0xa3, 0x4d, 0xa2, 0xe5, 0x7b, 0x56,
+			0x41, 0x39, 0x65, 0xdf, 0xf0, 0x09, 0x29, 0x4e,
+			0x76, 0xa6, 0x68, 0xcf, 0x01, 0xd9, 0xdc, 0xfc,
+			0xeb, 0xa5, 0xcf, 0xc4, 0xe2, 0xea, 0xd6, 0xeb,
+			0xfb, 0x39, 0x7f, 0x6a, 0x44, 0x81, 0xad, 0xe6,
+			0x0e, 0xfb, 0x25, 0xf3, 0x83, 0x68, 0xe2, 0x60,
+			0x86, 0x03, 0x44, 0xd8, 0xbd, 0xb4, 0xfb, 0xe8,
+			0x94, 0xeb, 0x29, 0x77, 0x6e, 0x53, 0xd8, 0x90,
+			0x1f, 0x0e, 0x32, 0xd9, 0xee, 0xab, 0x1f, 0xb8,
+			0xea, 0x00, 0x3e, 0x62, 0x16, 0x30, 0x58, 0xb2,
+			0x9e, 0xad, 0x58, 0xdc, 0xd6, 0x12, 0x48, 0x95,
+			0xb6, 0xf9, 0x0c, 0x11, 0x25, 0xa3, 0xc1, 0xd1,
+			0x69, 0xe5, 0xc7, 0xd3, 0x19, 0x2a, 0xf7, 0x28,
+			0xec, 0x3c, 0xff, 0xd8, 0xac, 0x97, 0x15, 0x1e,
+			0xe6, 0x91, 0x90, 0x9c, 0xab, 0x9f, 0x20, 0xe2,
+			0x32, 0xf2, 0x04, 0xdb, 0x01, 0x4e, 0xf7, 0x32,
+			0x15, 0x92, 0xbe, 0x3b, 0x75, 0x2a, 0x71, 0xbf,
+			0xcc, 0xa1, 0xb6, 0x0d, 0x8c, 0xcb, 0x32, 0xe7,
+			0x3a, 0x46, 0x6b, 0x93, 0x4f, 0xe7, 0x2b, 0x47,
+			0x6f, 0xb4, 0x81, 0x19, 0x6c, 0x29, 0xae, 0x0a,
+			0xef, 0x2e, 0x91, 0xd8, 0xbf, 0xa7, 0x3c, 0x35,
+			0x32, 0xbd, 0xbc, 0xb2, 0x12, 0x07, 0x7b, 0x7f,
+			0x2a, 0x37, 0x9e, 0x44, 0xe2, 0x18, 0x16, 0x82,
+			0x27, 0xff, 0x12, 0xd9, 0x0a, 0x97, 0x64, 0x8d,
+			0x09, 0x41, 0xa4, 0x21, 0xc5, 0xcd, 0xc2, 0x70,
+			0x7d, 0x89, 0x2f, 0x80, 0xd6, 0x48, 0xac, 0xe6,
+			0x60, 0xf6, 0x3b, 0x4b, 0xfa, 0x2d, 0x93, 0xa0,
+			0xe9, 0xaf, 0xef, 0x8e, 0x87, 0x40, 0x53, 0x1f,
+			0xde, 0xbf, 0x12, 0x9c, 0x53, 0xe0, 0xf5, 0x96,
+			0xff, 0x95, 0x13, 0xf2, 0xb5, 0xb3, 0xc0, 0x3f,
+			0xfa, 0xcd, 0xbf, 0x20, 0x85, 0x72, 0xb3, 0x59,
+			0x57, 0xf7, 0x02, 0x32, 0x72, 0xfd, 0x9d, 0xe5,
+			0x98, 0xec, 0xee, 0x2f, 0xd3, 0xf9, 0x27, 0x5d,
+			0xa3, 0x96, 0x2b, 0x16, 0x98, 0xb3, 0x5c, 0xae,
+			0x92, 0x5b, 0x76, 0x55, 0x8f, 0xdd, 0x42, 0x08,
+			0x93, 0x04, 0x7a, 0x56, 0x5b, 0x45, 0xe5, 0x66,
+			0x8f, 0xf2, 0x0c, 0x6d, 0x20, 0xc0, 0x0e, 0xde,
+			0x4a, 0x74, 0x69, 0x29, 0x75, 0x99, 0x93, 0xa3,
+			0x6f, 0x80, 0x59, 0xb7, 0xdc, 0x5a, 0x67, 0xe9,
+			0xf1, 0x05, 0xeb, 0x52, 0x4d, 0xbe, 0x25, 0x72,
+			0x18, 0x75, 0x90, 0x4c, 0xce, 0x85, 0x34, 0x21,
+			0x95, 0xc3, 0x9e, 0x02, 0x81, 0x0d, 0x96, 0x41,
+			0xd0, 0x84, 0x27, 0x70, 0x26, 0x1e, 0x60, 0x33,
+			0x84, 0xcd, 0x17, 0x4b, 0xb9, 0xa3, 0x38, 0x5a,
+			0xa5, 0x03, 0xd8, 0xf5, 0xd5, 0x5b, 0x16, 0x6e,
+			0x9d, 0xd0, 0x14, 0x67, 0x7b, 0xd9, 0x1c, 0x7a,
+			0x02, 0x25, 0x22, 0x6d, 0x4d, 0x59, 0xcc, 0xa3,
+			0xe4, 0x4b, 0xbd, 0xd4, 0xab, 0x52, 0x5e, 0xf8,
+			0xdf, 0xfe, 0xec, 0x21, 0xe7, 0x38, 0xdd, 0x55,
+			0xab, 0xe4, 0x20, 0x03, 0x4e, 0x61, 0x87, 0xbe,
+			0x89, 0x55, 0xcd, 0xb4, 0xed, 0x7a, 0xa1, 0x05,
+			0x34, 0xea, 0x96, 0x77, 0x5e, 0x2e, 0xa4, 0x6f,
+			0x65, 0x53, 0x3e, 0x1e, 0x72, 0x38, 0x44, 0x6b,
+			0x12, 0xf9, 0xda, 0xa8, 0x61, 0xe7, 0x26, 0xde,
+			0x71, 0xa3, 0xdb, 0x26, 0xf4, 0xc2, 0xe9, 0xf0,
+			0xce, 0x51, 0xd3, 0xd2, 0x0f, 0x13, 0xb4, 0x8f,
+			0x9e, 0xc0, 0x93, 0x5c, 0xda, 0xd9, 0xf3, 0x33,
+			0x39, 0xbb, 0x20, 0x6c, 0x7d, 0xbe, 0x49, 0x7b,
+			0x82, 0xac, 0x78, 0x42, 0x38, 0xea, 0xd0, 0xbd,
+			0xc8, 0x10, 0x4b, 0xa3, 0x46, 0x9b, 0x1f, 0x64,
+			0xbf, 0x04, 0x67, 0xb1, 0xb5, 0xcc, 0xe5, 0x13,
+			0xf9, 0xdf, 0x3d, 0xcf, 0x5a, 0x1f, 0xd7, 0xfd,
+			0x04, 0x32, 0x44, 0x5d, 0xc7, 0x65, 0x7d, 0x7f,
+			0x72, 0x0d, 0x2f, 0x27, 0xae, 0xb0, 0xba, 0x98,
+			0xb1, 0x5a, 0x6e, 0xd8, 0x05, 0x51, 0x71, 0x0c,
+			0x8f, 0xc1, 0x03, 0x37, 0xa9, 0x40, 0xc6, 0xe8,
+			0xed, 0xc6, 0x23, 0xc4, 0x61, 0xe2, 0xe6, 0x46,
+			0x06, 0xba, 0xf6, 0xbe, 0x4a, 0x2a, 0x2d, 0xcb,
+			0xf7, 0xb4, 0x14, 0xe8, 0xe6, 0x2b, 0xc0, 0x7f,
+			0x78, 0x4a, 0x3a, 0x4e, 0x14, 0xb0, 0x69, 0x91,
+			0xee, 0xba, 0x5e, 0x76, 0xbc, 0x25, 0xaa, 0xd9,
+			0x30, 0xa6, 0x12, 0x7f, 0x3b, 0x86, 0x89, 0xfa,
+			0x6b, 0xbc, 0x7e, 0x1f, 0x56, 0x9d, 0x64, 0x4a,
+			0x7e, 0xa3, 0x0e, 0x2c, 0x12, 0x68, 0x3b, 0xa3,
+			0x64, 0x0f, 0x96, 0x3b, 0x6b, 0x4b, 0x82, 0xf9,
+			0xa1, 0xd3, 0x27, 0x76, 0xd6, 0x04, 0xfa, 0x2f,
+			0x0c, 0xaf, 0x19, 0x1c, 0x6d, 0x63, 0xfe, 0x59,
+			0x10, 0xcd, 0xca, 0x4f, 0xa7, 0x7c, 0xa2, 0x61,
+			0x20, 0x7d, 0xe1, 0xd7, 0xea, 0x6d, 0x7e, 0x94,
+			0x2b, 0xcf, 0x71, 0x2a, 0x5f, 0x3b, 0xa0, 0x54,
+			0x69, 0x83, 0x63, 0x31, 0xac, 0xd3, 0x53, 0x1a,
+			0xd5, 0xa6, 0xa0, 0x76, 0x0b, 0x6e, 0x10, 0xb2,
+			0x85, 0xec, 0x19, 0x1c, 0xf9, 0xfb, 0x86, 0xdb,
+			0x55, 0x82, 0x95, 0xdd, 0x2b, 0x27, 0xd3, 0x43,
+			0x4a, 0x07, 0xf7, 0x43, 0x30, 0x42, 0x6c, 0x51,
+			0xdc, 0xc9, 0x6c, 0x0f, 0x8f, 0xce, 0x63, 0xbe,
+			0xf9, 0xec, 0x7c, 0x03, 0xe8, 0x63, 0xd5, 0x36,
+			0x77, 0x60, 0xb7, 0x5d, 0x0a, 0x0e, 0x8c, 0x3e,
+			0x96, 0xad, 0xb0, 0xcf, 0x40, 0xe4, 0xf4, 0x18,
+			0x1f, 0xdb, 0x0b, 0xae, 0xb5, 0x38, 0xbc, 0x1f,
+			0x1d, 0x8f, 0xf4, 0x81, 0x21, 0xb9, 0x85, 0xef,
+			0x36, 0x3d, 0x97, 0x79, 0x27, 0x61, 0x61, 0x26,
+			0x15, 0x29, 0x57, 0x33, 0x95, 0x3b, 0x67, 0x13,
+			0xd0, 0x8b, 0x71, 0x00, 0xf1, 0xcd, 0x3a, 0xa4,
+			0xc2, 0x31, 0xce, 0x2a, 0xf1, 0x70, 0xcb, 0xb3,
+			0x66, 0xbe, 0xeb, 0xfe, 0xdd, 0x6b, 0xde, 0x1c,
+			0x62, 0xcf, 0x9b, 0xb5, 0x58, 0x61, 0xb9, 0x55,
+			0xcf, 0x0e, 0x42, 0x6a, 0x09, 0xd4, 0x57, 0xf4,
+			0xaa, 0xbe, 0xdf, 0x4e, 0xc9, 0xbb, 0x0a, 0xc0,
+			0xa0, 0xbc, 0x07, 0xf9, 0xc6, 0x58, 0x5b, 0x20,
+			0x8b, 0x0c, 0xd8, 0xd4, 0x37, 0xa5, 0x27, 0x4d,
+			0x8e, 0x45, 0x4a, 0xde, 0x4c, 0xd9, 0x77, 0x20,
+			0xd1, 0xc9, 0x23, 0x2a, 0xbe, 0x17, 0x73, 0x97,
+			0xb1, 0x9d, 0xf8, 0x3c, 0x7b, 0x94, 0x06, 0x23,
+			0x5d, 0x31, 0xe5, 0xfe, 0x3d, 0xee, 0x5d, 0xe6,
+			0x7a, 0x68, 0x98, 0x6e, 0xd1, 0x61, 0xbc, 0xcf,
+			0x61, 0x72, 0x05, 0x4f, 0xb4, 0xbe, 0x3f, 0x9e,
+			0xff, 0x58, 0x7c, 0x07, 0x7b, 0x61, 0x8c, 0x4b,
+			0x93, 0xad, 0xe4, 0x81, 0x33, 0xda, 0x02, 0x02,
+			0x8b, 0xb0, 0x25, 0x8d, 0xad, 0x2f, 0x86, 0x22,
+			0xd4, 0x3e, 0x69, 0x31, 0x07, 0x59, 0x54, 0x6b,
+			0x9c, 0x55, 0xce, 0x46, 0xb0, 0x41, 0x47, 0x9c,
+			0x32, 0x61, 0xf2, 0xf5, 0x5e, 0x9d, 0x11, 0xb3,
+			0xfd, 0xaf, 0x5a, 0xcc, 0x53, 0xd2, 0xf9, 0xec,
+			0xea, 0x49, 0xd8, 0xef, 0x74, 0xde, 0xfb, 0xac,
+			0x3b, 0x0c, 0x4c, 0x44, 0x42, 0x55, 0x3d, 0xfa,
+			0x01, 0x32, 0x60, 0x7f, 0x2f, 0xea, 0xb3, 0x12,
+			0x53, 0xc7, 0xf4, 0xec, 0x28, 0x54, 0xe2, 0xd9,
+			0xf4, 0x05, 0x9e, 0x54, 0xc5, 0x9e, 0x9f, 0xe0,
+			0x62, 0x4a, 0x5e, 0x6a, 0xe2, 0x56, 0x2f, 0x8d,
+			0xc8, 0x1d, 0x21, 0x32, 0xc0, 0x8f, 0x33, 0x8d,
+			0x90, 0xc6, 0x8e, 0x33, 0x39, 0x6a, 0x6e, 0x00,
+			0x9c, 0x54, 0xa4, 0x65, 0x8a, 0x9f, 0xbb, 0x68,
+			0x79, 0xef, 0xc9, 0xe0, 0x5a, 0x9e, 0xbc, 0x44,
+			0xa5, 0xf0, 0x2e, 0x56, 0x70, 0x9c, 0xce, 0x97,
+			0xb2, 0xb1, 0x1e, 0x32, 0x5a, 0xfd, 0x91, 0x7e,
+			0x51, 0x23, 0x77, 0x5e, 0x8c, 0x98, 0x8f, 0xa5,
+			0x64, 0x02, 0x93, 0xb4, 0xab, 0xd3, 0x8a, 0xb5,
+			0xdc, 0xd9, 0x7f, 0x86, 0x66, 0x05, 0x02, 0x29,
+			0xfa, 0x91, 0xf9, 0x25, 0x1e, 0x72, 0x47, 0x01,
+			0xf9, 0x36, 0xa1, 0xbb, 0x42, 0x47, 0xf5, 0xf4,
+			0xf4, 0x4e, 0x4c, 0x0d, 0x54, 0xf3, 0xa5, 0x7c,
+			0xfc, 0xb2, 0x1a, 0x08, 0xbd, 0xa9, 0xa7, 0x1a,
+			0x0a, 0xae, 0xc3, 0x95, 0xe2, 0x55, 0x26, 0xd0,
+			0x28, 0xf1, 0x75, 0xca, 0x41, 0x47, 0xc6, 0xf0,
+			0xb3, 0x19, 0x39, 0xdd, 0xd0, 0x6f, 0x7e, 0x81,
+			0x7b, 0x1b, 0xcf, 0x86, 0x01, 0x83, 0x9e, 0x1c,
+			0x60, 0xd8, 0x23, 0xf7, 0x2f, 0xdf, 0x70, 0x4c,
+			0x0b, 0xc8, 0x3d, 0x9a, 0x41, 0x35, 0xca, 0x17,
+			0xae, 0x0c, 0xcd, 0x79, 0xef, 0x12, 0xfa, 0x42,
+			0x85, 0x7c, 0x4b, 0xf4, 0xde, 0xda, 0x81, 0x86,
+			0x5a, 0xb8, 0x1e, 0x5c, 0xd3, 0x53, 0xd9, 0xe7,
+			0x7a, 0x71, 0xdb, 0xba, 0x5f, 0x38, 0xbf, 0xc1,
+			0xfe, 0x8d, 0xee, 0xf6, 0xc7, 0x13, 0x78, 0x9e,
+			0x4a, 0x9c, 0x16, 0x67, 0xf1, 0x0f, 0x6b, 0xcc,
+			0x52, 0x0f, 0x73, 0xa5, 0x1d, 0x36, 0x04, 0x64,
+			0x4a, 0x4d, 0x39, 0x0c, 0xe6, 0x0c, 0x9c, 0xca,
+			0x88, 0xc3, 0x72, 0x7f, 0x02, 0x4b, 0x38, 0x57,
+			0x50, 0xaa, 0xee, 0xf2, 0xfb, 0xfa, 0xc3, 0xaf,
+			0x15, 0xb9, 0xdc, 0x1d, 0x87, 0x90, 0x73, 0x0a,
+			0xf7, 0x2a, 0xbb, 0x48, 0xe8, 0xa1, 0x5c, 0xa1,
+			0xd8, 0x1e, 0x9a, 0x16, 0x1e, 0x64, 0x5d, 0x79,
+			0xad, 0x6b, 0x10, 0xfe, 0xe2, 0x70, 0x32, 0x42,
+			0x47, 0xc2, 0x85, 0x19, 0xb1, 0x42, 0x92, 0x8c,
+			0x33, 0xf0, 0xaa, 0xf0, 0x6c, 0x85, 0x17, 0x54,
+			0x7c, 0x16, 0x4d, 0xb4, 0x35, 0xae, 0x5a, 0x18,
+			0xf3, 0x14, 0xcc, 0x3c, 0xa5, 0x0f, 0x29, 0xa1,
+			0x33, 0xa3, 0x01, 0xdd, 0x37, 0x67, 0xde, 0xb6,
+			0xaf, 0x3d, 0x30, 0xda, 0x04, 0x1e, 0x49, 0x25,
+			0xe0, 0xe9, 0xae, 0xe3, 0x20, 0xc5, 0x1d, 0x03,
+			0xec, 0xa3, 0x6e, 0x43, 0xba, 0x9c, 0xec, 0xe2,
+			0x99, 0x71, 0xca, 0x86, 0x22, 0xce, 0x13, 0x61,
+			0x02, 0x3f, 0x02, 0x78, 0xf3, 0xd0, 0xa5, 0x0b,
+			0xc9, 0xb8, 0x55, 0x7d, 0x1c, 0xa1, 0x70, 0xb6,
+			0x99, 0x3b, 0xd2, 0xb9, 0xa5, 0xf2, 0x8a, 0x81,
+			0x4d, 0x62, 0xcf, 0x7f, 0x24, 0x64, 0x67, 0x33,
+			0xb4, 0x37, 0x25, 0xf7, 0x79, 0x1c, 0x8a, 0xd7,
+			0x57, 0xe4, 0x45, 0xc9, 0xa5, 0xbe, 0xf5, 0x9f,
+			0x91, 0xd5, 0x66, 0x8f, 0xc7, 0x0c, 0x46, 0x46,
+			0x40, 0xba, 0xb4, 0xab, 0x47, 0x71, 0xd2, 0x59,
+			0x6e, 0xa6, 0x83, 0x82, 0xe7, 0x92, 0xa1, 0x26,
+			0x35, 0xca, 0x4a, 0x1a, 0x0f, 0xa5, 0x29, 0xbe,
+			0x92, 0xad, 0x01, 0x48, 0xba, 0x5e, 0x2e, 0x2e,
+			0xcb, 0xb3, 0x97, 0x5a, 0x45, 0x31, 0xea, 0x9b,
+			0x2c, 0x0f, 0x6a, 0x52, 0x3f, 0x52, 0x57, 0x77,
+			0x29, 0x11, 0x4b, 0x39, 0xfa, 0x45, 0xbc, 0x55,
+			0xc6, 0xa6, 0x3c, 0x0f, 0xc6, 0x7c, 0xe3, 0x51,
+			0x82, 0xd5, 0x85, 0x94, 0x53, 0x82, 0x9c, 0x41,
+			0xca, 0xdb, 0xe0, 0xf4, 0x1d, 0x06, 0x54, 0x3c,
+			0x3e, 0xe7, 0xcf, 0x8d, 0xc9, 0xf2, 0x32, 0xad,
+			0x56, 0xba, 0x45, 0xa7, 0x92, 0x8e, 0xb8, 0x1d,
+			0x03, 0xfd, 0x50, 0xb4, 0x61, 0x72, 0x64, 0x9d,
+			0xf3, 0x4c, 0x5e, 0xb0, 0x6a, 0xb3, 0x49, 0xfd,
+			0x86, 0x5c, 0x32, 0x12, 0x04, 0x4d, 0xc6, 0x2a,
+			0x04, 0x6f, 0x63, 0x46, 0xc6, 0xdd, 0x06, 0x08,
+			0x63, 0x6c, 0x1c, 0xdd, 0x6b, 0xd1, 0x2b, 0xa9,
+			0x71, 0xdd, 0xbd, 0xc4, 0x64, 0x6c, 0x12, 0xc5,
+			0x6d, 0xb0, 0xab, 0x9b, 0x0c, 0xb1, 0xec, 0x50,
+			0xe0, 0xb3, 0x02, 0x3b, 0x4a, 0xf6, 0x1b, 0xa1,
+			0xbd, 0xda, 0x1c, 0x82, 0x2b, 0x3a, 0xeb, 0xfa,
+			0x4c, 0xfe, 0xa3, 0x05, 0x81, 0x6b, 0xb2, 0xe9,
+			0xc5, 0xb3, 0x71, 0xe6, 0x5c, 0xd4, 0xa1, 0x60,
+			0xe4, 0xe7, 0xed, 0x2f, 0x7e, 0x57, 0xdc, 0x00,
+			0x88, 0x40, 0x0d, 0x85, 0x27, 0x80, 0xa6, 0x14,
+			0x10, 0x2d, 0xa9, 0x2d, 0x2c, 0xa2, 0x3c, 0xfa,
+			0xc7, 0xcc, 0x26, 0xa1, 0x1d, 0xc2, 0xef, 0x25,
+			0x58, 0xb3, 0xcb, 0x47, 0xd5, 0x00, 0x94, 0x2b,
+			0xe6, 0x97, 0xf7, 0x81, 0xf6, 0x1c, 0xfe, 0x5f,
+			0x41, 0x8a, 0x68, 0xc0, 0x19, 0x65, 0x6d, 0x20,
+			0x37, 0x01, 0xf9, 0x12, 0x60, 0x97, 0x14, 0x52,
+			0x08, 0x0f, 0xe6, 0xb0, 0xd4, 0x01, 0x88, 0x3b,
+			0x36, 0x03, 0x2b, 0x1a, 0x05, 0x85, 0x49, 0x98,
+			0x70, 0x84, 0x79, 0xf9, 0x32, 0xe5, 0x5f, 0xf1,
+			0x5e, 0x1f, 0xb3, 0xc1, 0x4d, 0xf3, 0x09, 0x8b,
+			0x23, 0xf1, 0xd3, 0xb5, 0x57, 0x80, 0x7b, 0x0d,
+			0x80, 0x51, 0xa2, 0xee, 0x1f, 0x53, 0xc6, 0x24,
+			0x13, 0x8f, 0xa3, 0x7e, 0xe5, 0x33, 0x7d, 0x8c,
+			0x29, 0x57, 0x19, 0xf7, 0xaf, 0xb7, 0x63, 0x53,
+			0xf6, 0xb7, 0xf2, 0xa9, 0xbd, 0x35, 0xee, 0x4f,
+			0x38, 0x3c, 0x3a, 0x04, 0x36, 0xee, 0xe1, 0x57,
+			0xc2, 0xe2, 0xe9, 0x12, 0x43, 0x0f, 0x35, 0x4c,
+			0xc4, 0xdd, 0xe7, 0x32, 0x80, 0x25, 0x19, 0x1f,
+			0xf3, 0x7c, 0x2b, 0xc0, 0xc1, 0xf0, 0x31, 0x4f,
+			0x2e, 0x38, 0x1f, 0x11, 0x49, 0x8b, 0x54, 0x2f,
+			0xa9, 0x10, 0xf5, 0xea, 0x7e, 0xd9, 0x12, 0xb1,
+			0x3c, 0xae, 0xcf, 0xca, 0x8c, 0x31, 0x56, 0x6d,
+			0xda, 0x71, 0x60, 0xcc, 0x61, 0x60, 0x17, 0x70,
+			0xd8, 0xd2, 0x12, 0xd4, 0x7e, 0xae, 0xeb, 0x5d,
+			0x2e, 0x06, 0xbb, 0xec, 0xbd, 0x50, 0x41, 0x7f,
+			0x91, 0x96, 0xcf, 0xc4, 0x66, 0x1d, 0x5d, 0x81,
+			0x61, 0xcf, 0x7e, 0x8c, 0x4b, 0x5c, 0x89, 0xd4,
+			0x13, 0x64, 0xe8, 0x5e, 0xbe, 0xd5, 0x8d, 0xcd,
+			0xdf, 0xa3, 0x18, 0x44, 0x50, 0x37, 0x6f, 0xfe,
+			0x56, 0x29, 0x52, 0xbe, 0x06, 0xf5, 0xe6, 0x64,
+			0x1f, 0x5f, 0x84, 0xf0, 0x84, 0x9e, 0xf6, 0x18,
+			0x36, 0x90, 0x08, 0xfa, 0xc2, 0xff, 0x9b, 0x6f,
+			0xec, 0x32, 0x9e, 0x0a, 0x12, 0xbf, 0xbf, 0x73,
+			0x0f, 0x04, 0xdf, 0x83, 0x11, 0x19, 0x65, 0xf8,
+			0xb9, 0x2c, 0x7b, 0x94, 0xdb, 0x6e, 0x94, 0xa5,
+			0x69, 0x70, 0xbc, 0x03, 0x06, 0x03, 0xf6, 0x8a,
+			0x82, 0xde, 0x00, 0xaa, 0x4b, 0x7f, 0x94, 0x0a,
+			0x72, 0xbf, 0xf9, 0xca, 0x07, 0x65, 0x66, 0xa6,
+			0xe6, 0xd7, 0xe9, 0xa0, 0x6b, 0xe3, 0x4c, 0xcb,
+			0x90, 0x6d, 0x32, 0x39, 0xcc, 0x40, 0x43, 0xf8,
+			0xd2, 0xd9, 0x5a, 0x5a, 0x75, 0x44, 0x4c, 0x09,
+			0x42, 0xe8, 0xc3, 0xc5, 0xe5, 0x25, 0xeb, 0x81,
+			0x6c, 0x98, 0xa3, 0xba, 0xe1, 0x14, 0x0c, 0x93,
+			0x63, 0x00, 0x7e, 0xf1, 0x73, 0x9c, 0x16, 0x9c,
+			0xa2, 0x56, 0x8d, 0xaa, 0x46, 0x90, 0x28, 0xc3,
+			0xb1, 0xb6, 0x37, 0x0c, 0xa2, 0x40, 0x73, 0x9b,
+			0xee, 0xd2, 0xa9, 0x4f, 0x1c, 0xbf, 0x52, 0x2b,
+			0x6c, 0x69, 0x15, 0x55, 0x16, 0x24, 0x0a, 0x9d,
+			0xa7, 0xed, 0x48, 0x07, 0x53, 0xf9, 0x7d, 0xcb,
+			0x56, 0xa2, 0x80, 0x87, 0x1f, 0xaa, 0xa6, 0xea,
+			0xf3, 0x0c, 0x1d, 0x7b, 0x19, 0x26, 0x15, 0x7a,
+			0x05, 0x65, 0x3b, 0xc2, 0xc4, 0x8e, 0x32, 0xf8,
+			0x9f, 0x61, 0xdc, 0x11, 0x39, 0x93, 0x59, 0x78,
+			0xe3, 0xe9, 0xb6, 0x0f, 0x98, 0x58, 0xbe, 0xea,
+			0x7b, 0x2b, 0x0f, 0x9c, 0x95, 0x74, 0xb0, 0x64,
+			0xac, 0x16, 0x01, 0xae, 0x5f, 0x6e, 0xab, 0xf1,
+			0x5b, 0x7e, 0xcb, 0x1a, 0xeb, 0x91, 0x9a, 0x10,
+			0xb6, 0x88, 0x0a, 0xb2, 0xd4, 0xbf, 0x77, 0x89,
+			0xe6, 0x7c, 0xb2, 0xc4, 0x92, 0x55, 0x12, 0xad,
+			0x8c, 0x6b, 0x41, 0x28, 0xe5, 0x7b, 0xa0, 0xb8,
+			0xfb, 0x78, 0x17, 0x12, 0x2f, 0xbc, 0x6d, 0x76,
+			0x5a, 0xdf, 0xb7, 0xcf, 0x3d, 0x5f, 0x42, 0x4f,
+			0x6a, 0x2c, 0xba, 0xc9, 0x74, 0x19, 0x6a, 0x2b,
+			0x98, 0xa4, 0x8a, 0xfe, 0xf3, 0x90, 0x31, 0x28,
+			0x55, 0x5f, 0x03, 0x3f, 0xd3, 0x06, 0x49, 0xa6,
+			0x67, 0x2b, 0x22, 0xb5, 0xff, 0x47, 0xd2, 0x6a,
+			0x3b, 0xf7, 0x62, 0x26, 0x86, 0x01, 0x03, 0x9a,
+			0x55, 0xdc, 0xbf, 0xf1, 0x48, 0x48, 0x49, 0x7c,
+			0xd1, 0x36, 0x12, 0x43, 0x23, 0x78, 0x4e, 0xf4,
+			0xff, 0xcc, 0x05, 0x7d, 0xee, 0xbf, 0xcc, 0x01,
+			0xd2, 0x95, 0x62, 0xb4, 0x52, 0x4d, 0x62, 0x8d,
+			0x79, 0xa9, 0x07, 0x7c, 0x4f, 0xb4, 0xf2, 0x32,
+			0xb5, 0x64, 0xe9, 0xae, 0xd7, 0x2d, 0x18, 0xe5,
+			0xc6, 0x3e, 0x5d, 0x11, 0xf2, 0x1e, 0x7a, 0x32,
+			0xa5, 0x7c, 0xa6, 0xf1, 0xa0, 0xee, 0xe8, 0x3c,
+			0xd4, 0x51, 0x01, 0x1f, 0x54, 0x91, 0xeb, 0x5e,
+			0x4e, 0x77, 0x7c, 0x1c, 0x9d, 0x7b, 0xf7, 0x34,
+			0xbb, 0x58, 0x1e, 0xcb, 0x48, 0xfd, 0x2a, 0xee,
+			0x62, 0x6f, 0x63, 0x13, 0xc5, 0x9a, 0x52, 0x1f,
+			0x39, 0x24, 0xbb, 0xb8, 0xde, 0xae, 0x1b, 0xd2,
+			0x9f, 0xfb, 0x67, 0xa1, 0xb5, 0xa9, 0xbb, 0x70,
+			0x32, 0xb4, 0x53, 0x8a, 0xc5, 0x67, 0x7d, 0x50,
+			0xb3, 0x60, 0xda, 0xca, 0x85, 0x7e, 0xa0, 0x5d,
+			0x6a, 0x6a, 0xbd, 0xce, 0x6b, 0x9b, 0x31, 0x7f,
+			0xc8, 0xb8, 0x91, 0xce, 0xc4, 0x51, 0xe6, 0x37,
+			0x61, 0x97, 0x4e, 0x25, 0xae, 0xb9, 0x2e, 0xa8,
+			0x91, 0x03, 0xcf, 0x25, 0x07, 0x1e, 0x61, 0xcb,
+			0x0d, 0xc4, 0x2f, 0x88, 0x82, 0x6d, 0x50, 0xb3,
+			0x75, 0xd1, 0x7f, 0x19, 0x2d, 0xb1, 0xd2, 0x1f,
+			0xe6, 0x29, 0xe2, 0x44, 0x8c, 0x62, 0x44, 0x77,
+			0xca, 0x73, 0x52, 0xe0, 0x2c, 0xec, 0x55, 0x04,
+			0x7c, 0x12, 0x27, 0x58, 0xd0, 0x6b, 0x99, 0xe1,
+			0x9c, 0x8a, 0xc5, 0x05, 0xb8, 0x60, 0x7b, 0x25,
+			0x24, 0x52, 0x18, 0x0f, 0xe8, 0x80, 0x7a, 0x4d,
+			0x79, 0xdd, 0x4a, 0x1a, 0xb0, 0x17, 0x4d, 0x48,
+			0x16, 0x2e, 0xcc, 0xb7, 0xc0, 0xd3, 0xeb, 0x82,
+			0x7b, 0x54, 0x74, 0x43, 0x6f, 0x81, 0x06, 0x39,
+			0x7c, 0x4d, 0x7f, 0x1b, 0x3d, 0x34, 0x61, 0x6f,
+			0x48, 0x22, 0x1e, 0x67, 0x50, 0xf5, 0xe9, 0x51,
+			0x07, 0x7b, 0xb7, 0xeb, 0x9d, 0xed, 0x81, 0xac,
+			0x48, 0x55, 0xd4, 0x68, 0x5b, 0xf1, 0xb7, 0x5b,
+			0x20, 0x12, 0xbb, 0xd6, 0xfb, 0x63, 0x98, 0x29,
+			0xe3, 0x5d, 0xeb, 0x3a, 0xab, 0x91, 0xd4, 0x5c,
+			0xe7, 0x9d, 0x08, 0x75, 0x41, 0x18, 0xf2, 0x4c,
+			0xdf, 0x1d, 0xb3, 0xe4, 0xa3, 0xba, 0xe4, 0x11,
+			0xd6, 0x31, 0xbd, 0x7d, 0xf2, 0x84, 0xdb, 0x54,
+			0x61, 0x71, 0x33, 0x6f, 0xa6, 0x2a, 0xfe, 0x14,
+			0xa9, 0x02, 0xaf, 0xac, 0xa1, 0xe0, 0x9c, 0xf8,
+			0x84, 0xa1, 0xf1, 0xa9, 0x3a, 0x68, 0x41, 0x2c,
+			0x2f, 0x63, 0x5d, 0x89, 0x91, 0x0b, 0x61, 0xce,
+			0x8a, 0xe5, 0xfa, 0x1e, 0xd2, 0xc4, 0xb3, 0x59,
+			0x21, 0x35, 0x25, 0x71, 0x9b, 0x39, 0x72, 0x5f,
+			0x40, 0x25, 0x96, 0x0d, 0x6d, 0x83, 0xe4, 0x21,
+			0x37, 0x12, 0x11, 0x12, 0xe3, 0x7c, 0xa9, 0xec,
+			0x27, 0xf9, 0x40, 0x7b, 0xc8, 0x3f, 0xcf, 0x17,
+			0x60, 0x4a, 0x79, 0x3c, 0x7c, 0x12, 0xf0, 0x93,
+			0x52, 0x1a, 0xf8, 0xf8, 0x37, 0xb7, 0x6e, 0xf5,
+			0xbd, 0x6e, 0xdc, 0xf4, 0xc1, 0x5e, 0xe4, 0x81,
+			0x0e, 0xcc, 0xc2, 0xcb, 0xa3, 0x59, 0xf8, 0xaf,
+			0xa4, 0xbc, 0xd0, 0x7f, 0xc7, 0x49, 0x97, 0xad,
+			0xc5, 0x51, 0x96, 0xc0, 0x7c, 0xce, 0xc9, 0x5b,
+			0xb1, 0xc9, 0x18, 0xa6, 0x04, 0xc3, 0x42, 0x12,
+			0x43, 0xf8, 0xe4, 0xc9, 0x48, 0x2b, 0x3b, 0x8f,
+			0x9f, 0x37, 0x7d, 0x0e, 0x01, 0x59, 0x83, 0x06,
+			0xef, 0x28, 0x59, 0x5f, 0x24, 0x6b, 0xb9, 0x9c,
+			0xd9, 0x3b, 0xa0, 0x05, 0x85, 0x72, 0x55, 0x77,
+			0x8d, 0x88, 0x48, 0x35, 0x65, 0xa5, 0x69, 0xd8,
+			0xf0, 0x2c, 0xbf, 0x14, 0x79, 0xac, 0x26, 0xca,
+			0x58, 0x48, 0x20, 0x0e, 0xf1, 0x0e, 0x5e, 0x22,
+			0xe7, 0x33, 0xf5, 0xb8, 0xa3, 0xca, 0x21, 0xf5,
+			0x34, 0x10, 0xf4, 0x71, 0xbb, 0xd9, 0xbf, 0x8d,
+			0xd3, 0x8d, 0x5f, 0x5a, 0x3f, 0x6b, 0x5c, 0x38,
+			0xa0, 0xfa, 0x1e, 0x17, 0x69, 0x1f, 0xed, 0xaf,
+			0x2a, 0xf4, 0x86, 0x2b, 0xf8, 0xf8, 0x2f, 0x68,
+			0x2e, 0x51, 0xbb, 0xe2, 0xfb, 0x38, 0xab, 0xc4,
+			0x57, 0x5a, 0x4e, 0x7d, 0x71, 0xc8, 0x7f, 0xf1,
+			0x87, 0xd3, 0x14, 0x0d, 0xa3, 0x5d, 0x06, 0x84,
+			0xfe, 0xb2, 0xa4, 0x23, 0xa1, 0x2f, 0x9c, 0xd3,
+			0xae, 0x01, 0x1b, 0xe4, 0x95, 0x7b, 0xd9, 0xd5,
+			0x57, 0xc8, 0xc7, 0x2f, 0x68, 0xac, 0x40, 0x4d,
+			0xdb, 0x7e, 0xe1, 0x84, 0x76, 0xd8, 0xa6, 0x3e,
+			0x34, 0xef, 0x4e, 0x18, 0x71, 0x85, 0x6f, 0x91,
+			0x6d, 0x72, 0xc2, 0x9e, 0xb4, 0x72, 0xd0, 0x84,
+			0xdf, 0xc0, 0x39, 0x78, 0xb3, 0x4e, 0x79, 0x68,
+			0x33, 0xb1, 0xcf, 0xe9, 0x27, 0xd4, 0x3e, 0x39,
+			0x90, 0xbf, 0x6d, 0x18, 0xf9, 0xb2, 0xb9, 0x06,
+			0xf9, 0x53, 0xd5, 0xfb, 0x4b, 0x1c, 0x2e, 0xea,
+			0xe2, 0xf2, 0x8f, 0x09, 0x74, 0x28, 0x40, 0x2d,
+			0x34, 0xe4, 0x06, 0x96, 0x60, 0xe0, 0xe8, 0x0f,
+			0x3c, 0x79, 0x58, 0xa4, 0xe8, 0x73, 0xbc, 0x22,
+			0x6f, 0xba, 0x1b, 0x46, 0x87, 0x73, 0x66, 0x68,
+			0xf7, 0x4f, 0xd4, 0xd6, 0xd2, 0x97, 0xc0, 0xb3,
+			0x65, 0x60, 0xb7, 0x09, 0xda, 0x2a, 0xa7, 0xd5,
+			0xe0, 0xae, 0x2a, 0x15, 0x83, 0x6a, 0x62, 0x24,
+			0x73, 0xa0, 0xc4, 0x44, 0x53, 0x73, 0xf0, 0xce,
+			0xbd, 0x8b, 0xc0, 0xff, 0xe6, 0xe5, 0xa9, 0xdc,
+			0x2b, 0xef, 0x39, 0xe7, 0x30, 0x2d, 0x65, 0xe1,
+			0x62, 0xce, 0xed, 0xba, 0x80, 0x3c, 0x32, 0x3b,
+			0xe6, 0x3e, 0x59, 0x2e, 0x0b, 0x3f, 0x88, 0x4e,
+			0x3a, 0x44, 0x78, 0x72, 0xd9, 0x69, 0xa2, 0xaa,
+			0x54, 0xbf, 0xc3, 0xf5, 0xb0, 0x25, 0x42, 0x3f,
+			0x51, 0xdb, 0x28, 0xf4, 0x12, 0xe7, 0xc3, 0xd9,
+			0x0f, 0x17, 0xda, 0xe8, 0xe2, 0x7d, 0x02, 0xc0,
+			0x16, 0x01, 0x54, 0x2e, 0xeb, 0x17, 0xa8, 0xb8,
+			0xe1, 0xa7, 0x3f, 0xa8, 0x77, 0xfa, 0x88, 0x2c,
+			0x48, 0x5e, 0x3f, 0x73, 0xf9, 0xe1, 0xed, 0xdb,
+			0x3d, 0x2d, 0xd0, 0xca, 0xf8, 0xd4, 0xae, 0x20,
+			0xb9, 0x72, 0xc9, 0x5a, 0xfd, 0x1c, 0x06, 0x91,
+			0xc9, 0xfe, 0xa6, 0x05, 0x00, 0xfd, 0x15, 0xed,
+			0x7c, 0x6a, 0x69, 0x04, 0x07, 0xca, 0xb2, 0xa5,
+			0x7a, 0xab, 0x25, 0x7f, 0xb7, 0x26, 0x81, 0x5b,
+			0x25, 0x81, 0x59, 0x1b, 0xd6, 0x9f, 0xf0, 0x80,
+			0x63, 0xd7, 0x89, 0x78, 0xd9, 0x21, 0x1f, 0x19,
+			0xdb, 0x51, 0x66, 0x79, 0xe6, 0x3d, 0xe6, 0x31,
+			0x04, 0x77, 0x29, 0xed, 0xe2, 0xcb, 0x19, 0x54,
+			0xc3, 0xaa, 0x3b, 0x83, 0xf6, 0xaa, 0x09, 0xdd,
+			0xaa, 0xd2, 0x22, 0xa4, 0x5f, 0x76, 0x9a, 0xb2,
+			0x36, 0x02, 0x0d, 0x56, 0xdd, 0x00, 0x25, 0x1e,
+			0x82, 0x0a, 0x45, 0xbb, 0x14, 0x8b, 0x7a, 0x06,
+			0xbd, 0x3c, 0x52, 0xea, 0x23, 0x45, 0xb2, 0xd3,
+			0x5e, 0xdb, 0xc1, 0x64, 0x1e, 0x24, 0xe7, 0x9a,
+			0x53, 0x09, 0x88, 0xa9, 0x88, 0x65, 0xd0, 0xf4,
+			0x83, 0x7f, 0x00, 0x1c, 0x71, 0x7c, 0xd4, 0x02,
+			0xfd, 0xca, 0xba, 0x53, 0x95, 0x22, 0x0f, 0xe3,
+			0x44, 0x1a, 0xe4, 0x48, 0xec, 0x88, 0xad, 0xb3,
+			0x82, 0x3f, 0xe9, 0x56, 0x12, 0xa6, 0xde, 0x27,
+			0xf4, 0xb4, 0xa6, 0x82, 0x06, 0xbe, 0x5d, 0x82,
+			0xfb, 0xeb, 0x17, 0xbd, 0x30, 0xe7, 0x11, 0xd5,
+			0xf7, 0xdd, 0xab, 0x70, 0xbd, 0x41, 0x79, 0x1b,
+			0x5e, 0x6c, 0x5e, 0x90, 0x01, 0x1c, 0xe4, 0x47,
+			0x7a, 0xe5, 0xce, 0xbd, 0x30, 0x82, 0x0a, 0x94,
+			0xc7, 0x24, 0x05, 0x18, 0xf1, 0x09, 0x9f, 0x38,
+			0x79, 0xf6, 0xed, 0x6e, 0x12, 0x50, 0x5c, 0x85,
+			0x37, 0xb3, 0x2a, 0x37, 0x5f, 0x31, 0xbd, 0xd2,
+			0x92, 0x59, 0x33, 0x6e, 0xf0, 0x15, 0x7e, 0x89,
+			0xb6, 0x7d, 0xc8, 0xc1, 0xd2, 0xa6, 0x88, 0xf1,
+			0x4e, 0x39, 0x78, 0x38, 0x71, 0xba, 0x17, 0x0d,
+			0x26, 0x43, 0x6b, 0x00, 0x8b, 0x4e, 0xdc, 0x46,
+			0x71, 0x1d, 0x41, 0xe1, 0x34, 0xd8, 0x10, 0xe0,
+			0x1e, 0x8c, 0x35, 0x93, 0xb8, 0x02, 0x60, 0x85,
+			0x8a, 0x47, 0x6d, 0xc4, 0x58, 0xe0, 0x1e, 0x62,
+			0x81, 0xbb, 0x38, 0x33, 0x84, 0xf1, 0x47, 0xad,
+			0x49, 0x41, 0x8d, 0x8b, 0xb6, 0x1b, 0x67, 0x28,
+			0x3e, 0xe8, 0x9e, 0xbc, 0x71, 0x19, 0x4a, 0xc0,
+			0xaa, 0x2e, 0x4a, 0x8f, 0x37, 0xd8, 0x85, 0xd3,
+			0xc0, 0x82, 0x2f, 0xc0, 0x86, 0x9f, 0xa8, 0xe4,
+			0x6d, 0x26, 0x28, 0xc7, 0xa8, 0x7a, 0x0e, 0x4a,
+			0x70, 0xd6, 0xb5, 0xd5, 0xab, 0xf9, 0x1d, 0x15,
+			0xe5, 0x1e, 0x15, 0x76, 0x36, 0x1e, 0xdb, 0x25,
+			0xa4, 0x19, 0x04, 0x76, 0x20, 0x61, 0x04, 0xf1,
+			0xff, 0x0e, 0xf3, 0xa7, 0x4d, 0x54, 0x16, 0x27,
+			0x5e, 0x35, 0x98, 0xcf, 0xf5, 0xba, 0xdc, 0xcb,
+			0x2e, 0x3a, 0x00, 0x31, 0xda, 0x30, 0xc8, 0x04,
+			0x11, 0xf8, 0x33, 0x68, 0xea, 0x92, 0x22, 0x2f,
+			0x8a, 0xa5, 0x5c, 0x74, 0xe6, 0xce, 0x9f, 0x60,
+			0x0d, 0x1c, 0x4e, 0xe0, 0x6f, 0x21, 0xe7, 0xc5,
+			0x63, 0x1e, 0xc2, 0x03, 0x87, 0xa8, 0x58, 0x0e,
+			0x6d, 0xfd, 0x26, 0x6b, 0x0a, 0xc5, 0xd5, 0xfe,
+			0xa3, 0xe7, 0x96, 0xe4, 0xf7, 0x80, 0xe6, 0xa2,
+			0x0f, 0xd0, 0xd5, 0xaf, 0x2e, 0xcd, 0x40, 0x31,
+			0x78, 0xaf, 0xcc, 0xb5, 0xd4, 0x71, 0x83, 0xb7,
+			0xdf, 0x40, 0x2c, 0x2c, 0x4d, 0xd2, 0xda, 0x2b,
+			0x16, 0xb2, 0xca, 0x13, 0x16, 0xf9, 0x81, 0xcd,
+			0x58, 0x9a, 0x24, 0xb1, 0xa5, 0xe9, 0x9b, 0xfa,
+			0xfd, 0x72, 0x08, 0x3a, 0xf4, 0xd6, 0xd0, 0xe7,
+			0xd9, 0xac, 0xa5, 0x9a, 0xbe, 0xbd, 0xc0, 0x94,
+			0x65, 0x44, 0x4a, 0x12, 0x33, 0xa6, 0xae, 0x65,
+			0x2c, 0xa4, 0x92, 0x9c, 0xc9, 0xe5, 0x98, 0x20,
+			0xc6, 0xdd, 0x10, 0x00, 0x91, 0x9d, 0xf9, 0xf7,
+			0x2f, 0x78, 0xfe, 0x93, 0x12, 0xd6, 0x21, 0xe7,
+			0x58, 0xfd, 0x6e, 0x65, 0x33, 0xba, 0x77, 0xe4,
+			0x16, 0x8e, 0x34, 0x7b, 0xf3, 0xc0, 0x47, 0x46,
+			0x91, 0x10, 0x72, 0x25, 0x89, 0xac, 0x0d, 0x79,
+			0x5f, 0x19, 0x13, 0x8d, 0x46, 0x7a, 0x1e, 0x26,
+			0x99, 0x5b, 0x78, 0xf8, 0x19, 0x37, 0x81, 0x99,
+			0x6d, 0xc5, 0x4c, 0x1f, 0x30, 0x6e, 0x4f, 0x52,
+			0x51, 0x9e, 0x37, 0x3b, 0x98, 0xf7, 0xe5, 0x88,
+			0x81, 0x0a, 0x62, 0xb4, 0x99, 0xbf, 0x95, 0xce,
+			0x27, 0xe3, 0x8c, 0x7f, 0xb3, 0x47, 0x17, 0x3d,
+			0x54, 0xb5, 0x0d, 0xb1, 0x4a, 0xb2, 0x87, 0x71,
+			0x59, 0x77, 0xb5, 0x5f, 0xf7, 0x88, 0x24, 0xab,
+			0xfd, 0x83, 0xfb, 0x90, 0xe9, 0xa3, 0xb4, 0x09,
+			0x07, 0xd9, 0x67, 0xed, 0x79, 0x53, 0xf0, 0x89,
+			0x03, 0xa2, 0x44, 0x6e, 0xb2, 0xea, 0x42, 0xbe,
+			0x19, 0xe1, 0x62, 0xd0, 0x38, 0xd1, 0xad, 0xa7,
+			0x82, 0x1d, 0x23, 0x97, 0xe9, 0xf0, 0x78, 0x07,
+			0xae, 0xe8, 0x16, 0xda, 0xa5, 0xa4, 0x88, 0xef,
+			0x6e, 0x6d, 0xf4, 0x39, 0x65, 0x2a, 0xad, 0x19,
+			0x49, 0x4b, 0x7c, 0x8d, 0x1a, 0x7e, 0x25, 0xb6,
+			0x96, 0xcc, 0xa2, 0x43, 0x64, 0x7d, 0x15, 0xbc,
+			0x89, 0x2c, 0xdf, 0xf4, 0xc7, 0xdd, 0xb8, 0x13,
+			0x5f, 0xf6, 0xce, 0xb5, 0x96, 0xa5, 0x13, 0xfd,
+			0x7c, 0x9e, 0xee, 0xd2, 0x13, 0x88, 0x10, 0xe5,
+			0x26, 0xfc, 0x2d, 0xbd, 0xf0, 0x44, 0x65, 0xd1,
+			0x40, 0x1b, 0x39, 0x20, 0xac, 0x05, 0x84, 0x30,
+			0x04, 0x16, 0x78, 0xd2, 0xaf, 0x4a, 0x7d, 0x8c,
+			0x23, 0xaa, 0x95, 0x1a, 0x37, 0xee, 0x7d, 0x45,
+			0x21, 0xf3, 0xb5, 0xb3, 0xab, 0xbb, 0xa0, 0x0d,
+			0xe8, 0x7f, 0x01, 0x98, 0x05, 0x65, 0x93, 0x82,
+			0xb0, 0x7c, 0x99, 0x66, 0xa6, 0xa6, 0xa1, 0xb0,
+			0x16, 0x8d, 0x9e, 0x1b, 0xc9, 0xbe, 0xcb, 0x9e,
+			0x79, 0xd3, 0x37, 0x61, 0x83, 0x96, 0x06, 0x88,
+			0x56, 0x68, 0x58, 0x0c, 0x2f, 0x63, 0x47, 0xe5,
+			0xb2, 0x57, 0xf8, 0x33, 0x0e, 0xfa, 0xe9, 0x5f,
+			0xf5, 0xd7, 0x9c, 0x58, 0x7b, 0x56, 0x55, 0xab,
+			0x1d, 0x5c, 0x0e, 0xbe, 0x91, 0xfb, 0xf7, 0x5b,
+			0x3a, 0x43, 0xab, 0x22, 0x98, 0x43, 0x89, 0x81,
+			0x0a, 0x9e, 0xec, 0x92, 0x65, 0xcf, 0x24, 0x9b,
+			0xaa, 0x23, 0xa7, 0xe2, 0x0f, 0x11, 0x0c, 0x2e,
+			0x34, 0x0a, 0x56, 0xc3, 0x89, 0x6e, 0xb5, 0xb4,
+			0x9f, 0xf8, 0x56, 0x55, 0x5f, 0xd5, 0x50, 0xe2,
+			0x18, 0x79, 0x62, 0x6f, 0xb8, 0x72, 0xf6, 0xf7,
+			0xe3, 0x40, 0x8d, 0xf1, 0x48, 0xad, 0x3d, 0x34,
+			0x7b, 0x12, 0xdc, 0xeb, 0x1f, 0xcc, 0x00, 0xac,
+			0xf4, 0x71, 0x36, 0x95, 0x6f, 0x59, 0x13, 0x6c,
+			0xc4, 0x59, 0xc3, 0xd2, 0xdf, 0x2f, 0x59, 0xa0,
+			0x0f, 0x25, 0x70, 0x06, 0xc1, 0x2c, 0x03, 0xac,
+			0x4e, 0x14, 0xac, 0x71, 0x9f, 0x29, 0x4c, 0x3f,
+			0x3a, 0x0c, 0xad, 0x8a, 0xfd, 0x51, 0x4a, 0x77,
+			0x03, 0x4a, 0x4a, 0xf2, 0x6c, 0xf2, 0x13, 0x84,
+			0xef, 0x01, 0xb3, 0xde, 0xf6, 0x44, 0x11, 0x5f,
+			0x1f, 0x7d, 0x66, 0x2e, 0x71, 0x28, 0x69, 0x34,
+			0x2d, 0x61, 0xa1, 0xbe, 0x2e, 0xbe, 0xb0, 0x58,
+			0xa3, 0xf6, 0xa1, 0x3a, 0x10, 0x34, 0xde, 0x35,
+			0x5f, 0x5a, 0x6b, 0x9b, 0xc1, 0xde, 0x17, 0x63,
+			0xf0, 0x73, 0xad, 0x28, 0xdb, 0xfc, 0x6f, 0xf9,
+			0x24, 0x5e, 0x60, 0xd8, 0x7f, 0x05, 0xee, 0x1d,
+			0x82, 0x17, 0x10, 0x8f, 0x5e, 0x43, 0x6c, 0x32,
+			0xae, 0x78, 0xee, 0xd6, 0x30, 0xe9, 0x65, 0x00,
+			0x0b, 0x6c, 0x8f, 0xd3, 0xca, 0x00, 0x8d, 0x0e,
+			0xc1, 0x48, 0x0f, 0xc0, 0x0c, 0xf1, 0xb9, 0x95,
+			0xed, 0x68, 0x30, 0x87, 0x11, 0x1c, 0xbe, 0x6b,
+			0xdd, 0xbe, 0x90, 0x12, 0x4d, 0x0f, 0x1e, 0xad,
+			0xd8, 0x0f, 0x50, 0x37, 0x1a, 0x7f, 0x8a, 0x6f,
+			0x88, 0x9d, 0x01, 0x3b, 0x4f, 0x18, 0xb2, 0x87,
+			0x7f, 0x2d, 0x2c, 0x18, 0x84, 0xed, 0xb0, 0xa0,
+			0xd6, 0x62, 0x8c, 0x98, 0x5b, 0xad, 0x21, 0x1f,
+			0x43, 0xee, 0x9b, 0xd4, 0xbd, 0xd1, 0xa8, 0xb7,
+			0x1c, 0x75, 0xca, 0x69, 0xfd, 0x7d, 0x9e, 0xe9,
+			0xb0, 0xd7, 0xd3, 0x09, 0x49, 0x9c, 0x4b, 0x33,
+			0xe9, 0xa9, 0xdc, 0x83, 0xfe, 0xd7, 0x73, 0x4d,
+			0x20, 0xf9, 0x2e, 0x2b, 0x44, 0xf5, 0xa0, 0x38,
+			0x7c, 0x76, 0x0b, 0xe4, 0x9d, 0x2d, 0x32, 0xd9,
+			0x3f, 0x58, 0x56, 0x0b, 0xd9, 0xdc, 0x66, 0x7e,
+			0x31, 0x5a, 0x58, 0xb1, 0x33, 0x03, 0xc4, 0xb3,
+			0x7d, 0x48, 0xd5, 0xeb, 0x2f, 0x90, 0xe5, 0xab,
+			0xeb, 0xf5, 0xca, 0x65, 0x64, 0xe3, 0xac, 0x67,
+			0xdc, 0x74, 0x34, 0x7b, 0x88, 0x12, 0x41, 0xe4,
+			0x34, 0x44, 0xbe, 0x01, 0x7e, 0xa0, 0x62, 0x4b,
+			0x06, 0x1b, 0x49, 0xcb, 0xb2, 0x72, 0x15, 0x54,
+			0xb2, 0x7e, 0xc1, 0xfe, 0x40, 0x8a, 0x72, 0x66,
+			0x4f, 0xc9, 0xd8, 0x9a, 0xe4, 0x96, 0x48, 0x38,
+			0x42, 0x90, 0xc8, 0x3c, 0x55, 0x90, 0x23, 0x9e,
+			0xe8, 0x57, 0x09, 0x97, 0x54, 0x1c, 0x09, 0x15,
+			0x4f, 0x51, 0x83, 0xf0, 0x60, 0x09, 0xbb, 0x1d,
+			0x9a, 0xab, 0x76, 0x0a, 0x92, 0x98, 0x5e, 0xfc,
+			0x1c, 0xef, 0xc3, 0x2d, 0xd2, 0xfa, 0x50, 0x3f,
+			0xe8, 0x45, 0x43, 0x96, 0xa1, 0x39, 0x1b, 0x08,
+			0x2c, 0xa1, 0xa9, 0xb3, 0xdc, 0xd1, 0x87, 0x20,
+			0x2b, 0xe3, 0x8e, 0xba, 0xfe, 0xdb, 0x4e, 0x2a,
+			0x55, 0x7a, 0xa7, 0x62, 0x61, 0x2e, 0x1e, 0x0e,
+			0x07, 0xe1, 0x03, 0x69, 0x99, 0xac, 0x18, 0x05,
+			0xa4, 0x8d, 0xae, 0x7f, 0x8e, 0x3b, 0xc8, 0x0b,
+			0xc1, 0xb4, 0x51, 0x7b, 0xaf, 0x4b, 0x72, 0x49,
+			0xd2, 0x08, 0x43, 0x50, 0xfc, 0x4b, 0x3e, 0xcd,
+			0x79, 0x97, 0x42, 0xc8, 0x9c, 0xea, 0xa7, 0x63,
+			0xe1, 0x5c, 0xf9, 0x3a, 0x15, 0x68, 0x64, 0x31,
+			0xa6, 0xf0, 0xee, 0xce, 0x2a, 0xfd, 0xe8, 0x63,
+			0xa2, 0x8c, 0x84, 0x7b, 0x6e, 0x94, 0xbd, 0xdc,
+			0x3b, 0x78, 0x09, 0x7a, 0xfc, 0x04, 0x2d, 0xb5,
+			0x97, 0x51, 0xe9, 0x11, 0xa5, 0xaf, 0xdd, 0xa7,
+			0x26, 0x5c, 0xf0, 0xed, 0x72, 0xcf, 0x16, 0xc8,
+			0x86, 0x19, 0x78, 0x30, 0xd6, 0xf2, 0x55, 0xbb,
+			0xd4, 0x9c, 0x1c, 0x74, 0x6d, 0xf1, 0xb7, 0xaa,
+			0x23, 0xec, 0xe7, 0x72, 0xc8, 0x0e, 0xa2, 0xa0,
+			0x65, 0x98, 0xef, 0xae, 0x8f, 0xe5, 0xba, 0x1f,
+			0xec, 0x82, 0x05, 0xb2, 0xfc, 0x3a, 0x5b, 0x23,
+			0x97, 0xa2, 0x3b, 0x12, 0x35, 0x3b, 0x19, 0xa1,
+			0xae, 0x0e, 0xc3, 0x66, 0x28, 0x74, 0x6b, 0xe0,
+			0x08, 0xad, 0xc9, 0x1d, 0xe9, 0xc7, 0x5f, 0xbb,
+			0xc5, 0x9f, 0x84, 0x4e, 0x26, 0xcb, 0xc0, 0xb4,
+			0x6f, 0x53, 0x3d, 0xc9, 0x41, 0x45, 0x12, 0xcf,
+			0x78, 0x6e, 0x92, 0xa1, 0x5a, 0x81, 0x88, 0xba,
+			0x16, 0x96, 0x93, 0x98, 0x9e, 0xb7, 0x0c, 0x1e,
+			0x6b, 0xda, 0x19, 0x72, 0xf5, 0x71, 0x44, 0xdb,
+			0xce, 0x53, 0x82, 0x43, 0x34, 0xf2, 0xd4, 0x9d,
+			0xc9, 0x0f, 0xf5, 0x87, 0x07, 0xe2, 0xf9, 0x1f,
+			0x3d, 0x83, 0xe4, 0x85, 0xc4, 0xec, 0xb8, 0xac,
+			0xc4, 0xec, 0x42, 0x5f, 0xd4, 0xb5, 0x82, 0x70,
+			0xfc, 0xa3, 0x6a, 0x87, 0x52, 0x75, 0x1f, 0x8c,
+			0x1a, 0x26, 0x85, 0x02, 0x72, 0x1c, 0x4d, 0x5f,
+			0x38, 0xfe, 0x6a, 0x24, 0xeb, 0x2b, 0x17, 0x1a,
+			0x5c, 0xae, 0x78, 0xc7, 0x68, 0x11, 0xa2, 0xed,
+			0x3e, 0xae, 0x88, 0xb8, 0x9f, 0x41, 0xe5, 0x45,
+			0xcb, 0x28, 0x0c, 0xc3, 0xfe, 0xbc, 0x92, 0x15,
+			0x25, 0x87, 0x6f, 0xe0, 0x8a, 0xeb, 0x96, 0x29,
+			0x87, 0x5f, 0xad, 0x4b, 0x1c, 0x7b, 0xc6, 0x0b,
+			0x9b, 0x58, 0xba, 0x3c, 0x07, 0x54, 0xa9, 0x84,
+			0xf5, 0x2e, 0xcc, 0x3f, 0xd4, 0xb6, 0xc7, 0x76,
+			0xfb, 0x74, 0x74, 0xed, 0xf6, 0x9a, 0x16, 0xa6,
+			0xc1, 0x66, 0xb6, 0x3f, 0x7b, 0x12, 0xc7, 0x35,
+			0x0b, 0x74, 0xf9, 0x74, 0xd3, 0xe4, 0x2b, 0xfc,
+			0x11, 0x22, 0x89, 0xc8, 0x65, 0x1b, 0x10, 0x03,
+			0x62, 0xb1, 0xc6, 0xc3, 0xa9, 0xd3, 0x4d, 0x7b,
+			0xa0, 0x17, 0x99, 0x16, 0x80, 0x1e, 0x0d, 0xa9,
+			0xab, 0x91, 0x2d, 0x38, 0xff, 0xd9, 0xc1, 0x66,
+			0xe5, 0x82, 0x41, 0xc3, 0x45, 0x76, 0x6a, 0x29,
+			0x75, 0x3e, 0xf0, 0xe9, 0x1f, 0x95, 0xa0, 0x55,
+			0x5f, 0x62, 0x8a, 0x66, 0xff, 0xf3, 0x6e, 0x25,
+			0x22, 0xe8, 0xbc, 0xd9, 0x9d, 0x6a, 0xfa, 0xdb,
+			0x41, 0xe8, 0x13, 0xb3, 0x55, 0x91, 0xb9, 0x7f,
+			0xa9, 0x8f, 0x68, 0x09, 0x8f, 0xca, 0xfb, 0x3f,
+			0x3b, 0x07, 0x6b, 0xaf, 0x35, 0x7f, 0x21, 0x81,
+			0x58, 0x3d, 0xe4, 0xa4, 0xe5, 0xc4, 0x94, 0x41,
+			0xef, 0x74, 0x9a, 0x8d, 0x7f, 0x97, 0xb7, 0x9f,
+			0x24, 0xd1, 0xcd, 0xbc, 0x34, 0x91, 0xb7, 0xb0,
+			0x07, 0x43, 0x0b, 0x0e, 0x43, 0x5c, 0xef, 0x4d,
+			0x82, 0x36, 0xa4, 0x81, 0x14, 0xa7, 0xfe, 0xf7,
+			0xe8, 0x78, 0x77, 0x2b, 0x82, 0x35, 0xeb, 0x4d,
+			0x90, 0xd2, 0x9c, 0x4f, 0x74, 0x75, 0x02, 0xed,
+			0x80, 0x60, 0xb0, 0x97, 0xe2, 0x45, 0x3e, 0xbb,
+			0xad, 0xfb, 0x70, 0xe7, 0x30, 0xd8, 0xed, 0xc3,
+			0xc5, 0xf7, 0x48, 0x73, 0x87, 0x68, 0x53, 0xf3,
+			0xd7, 0x83, 0xa7, 0x22, 0x54, 0x9c, 0xf1, 0x02,
+			0xc3, 0x67, 0x8e, 0x1c, 0xcf, 0x95, 0xd3, 0xa1,
+			0x11, 0xf3, 0x75, 0x56, 0x16, 0xf9, 0x3d, 0x95,
+			0xd8, 0x4c, 0x48, 0x53, 0xfa, 0x03, 0x37, 0xb1,
+			0xb3, 0xcd, 0xcd, 0x91, 0xb0, 0x4b, 0xba, 0x13,
+			0x9f, 0x7a, 0x43, 0x8d, 0xa8, 0x6d, 0x59, 0x3a,
+			0x1a, 0x51, 0xe3, 0x81, 0x4f, 0x7e, 0x8c, 0xd5,
+			0xc5, 0xd0, 0xbe, 0x77, 0xa5, 0xf6, 0x0d, 0x92,
+			0x04, 0xdb, 0x10, 0x59, 0x7a, 0xe4, 0xa4, 0x0c,
+			0x9f, 0x1c, 0x09, 0x63, 0x10, 0xf2, 0x95, 0x23,
+			0x06, 0x8f, 0x50, 0x19, 0xaa, 0x3b, 0x9b, 0x02,
+			0x07, 0xbe, 0x89, 0x6d, 0x91, 0xeb, 0xcb, 0xc1,
+			0x7a, 0x81, 0xf9, 0xbd, 0x6c, 0x32, 0x95, 0xa2,
+			0x63, 0x9f, 0xf3, 0x04, 0x17, 0x18, 0xd2, 0x2a,
+			0xad, 0x24, 0x7b, 0x81, 0xcf, 0x10, 0xdc, 0xb9,
+			0x1a, 0x74, 0xa0, 0xbc, 0x02, 0xef, 0x15, 0x31,
+			0x22, 0x84, 0x48, 0x0e, 0x37, 0xd3, 0x83, 0x22,
+			0x79, 0x7d, 0x25, 0x3d, 0x93, 0x8a, 0x73, 0x83,
+			0x74, 0x02, 0x15, 0x04, 0xc9, 0xa3, 0xbe, 0xf5,
+			0xa4, 0xc3, 0x6d, 0xcf, 0xd9, 0x5a, 0x87, 0x99,
+			0xfb, 0xad, 0xb3, 0xd1, 0x42, 0x7e, 0xf7, 0x2e,
+			0xc8, 0x68, 0x13, 0xf9, 0xe5, 0xc2, 0x37, 0x68,
+			0x29, 0x7c, 0x3d, 0x4b, 0xdb, 0x9c, 0x23, 0xf2,
+			0x58, 0xf2, 0x4b, 0x43, 0xa9, 0x07, 0xbd, 0xed,
+			0x4e, 0x06, 0x81, 0x68, 0x5d, 0x85, 0xae, 0xd2,
+			0xc2, 0x3b, 0xcd, 0xe9, 0xe3, 0x1b, 0x0a, 0xb7,
+			0xac, 0xb2, 0x15, 0x52, 0x6e, 0x52, 0xbb, 0x0b,
+			0x5b, 0xa9, 0x71, 0xe1, 0xc1, 0xdb, 0x6a, 0x05,
+			0x43, 0xf7, 0x21, 0x32, 0xe1, 0x5b, 0xcd, 0x3e,
+			0xb0, 0x9a, 0xcf, 0x14, 0x45, 0x1c, 0xf0, 0xf4,
+			0x3a, 0x15, 0xc0, 0x9b, 0x7e, 0x3a, 0xc2, 0xaa,
+			0x59, 0x44, 0x94, 0x95, 0xc3, 0x98, 0x1b, 0xbe,
+			0xc2, 0xda, 0xb4, 0x24, 0xf2, 0x77, 0x31, 0x5e,
+			0x1a, 0xfe, 0x4c, 0x4e, 0x0e, 0x33, 0x51, 0xf3,
+			0x51, 0x4a, 0x30, 0x68, 0xfa, 0xa0, 0xd5, 0x6a,
+			0x48, 0xfa, 0x46, 0xf5, 0xe1, 0x46, 0x07, 0x36,
+			0x29, 0x77, 0x13, 0xf1, 0x4d, 0xc8, 0xa5, 0x06,
+			0xa6, 0x7b, 0xea, 0xc6, 0xbc, 0xde, 0x2b, 0x22,
+			0xe0, 0x0b, 0xa8, 0x63, 0x18, 0x31, 0xb7, 0xe0,
+			0x3d, 0xd1, 0x74, 0x13, 0xbd, 0xb4, 0xc5, 0x50,
+			0x56, 0x25, 0x44, 0x9f, 0xb7, 0x1a, 0xfd, 0x6f,
+			0x2f, 0xd8, 0x00, 0x11, 0x26, 0x40, 0xdf, 0x17,
+			0x18, 0xea, 0x08, 0xcb, 0x7a, 0x64, 0x6b, 0x53,
+			0xd2, 0x9b, 0x99, 0x88, 0xcc, 0xc6, 0xf5, 0x79,
+			0x1b, 0x6b, 0xd9, 0x9e, 0xb2, 0x04, 0x1d, 0xe1,
+			0xdb, 0x01, 0x2e, 0x19, 0x8a, 0x92, 0x6c, 0x33,
+			0xb5, 0xbf, 0x84, 0xe9, 0x5c, 0x52, 0x2a, 0x7b,
+			0x33, 0x75, 0x5e, 0x28, 0x51, 0x9f, 0x40, 0x96,
+			0x01, 0x78, 0x42, 0xb1, 0x11, 0x08, 0xfb, 0x40,
+			0xb6, 0x2a, 0x2b, 0x69, 0x0f, 0xc5, 0xa5, 0x39,
+			0x51, 0x14, 0xa5, 0xc9, 0x6f, 0xdf, 0x09, 0x5b,
+			0x3b, 0x23, 0x22, 0x0c, 0xac, 0xd9, 0x48, 0xeb,
+			0x03, 0x4e, 0xec, 0xb3, 0x88, 0xe8, 0xaa, 0x44,
+			0x59, 0x8a, 0xef, 0xb5, 0x81, 0x83, 0x22, 0xc8,
+			0x72, 0x51, 0x67, 0xba, 0x84, 0x46, 0x44, 0x41,
+			0x58, 0x1f, 0x9d, 0x4c, 0xbb, 0xcb, 0xf0, 0x1f,
+			0x99, 0x3e, 0x52, 0x14, 0xc7, 0x3b, 0x48, 0x77,
+			0x17, 0xe6, 0x66, 0x69, 0x3c, 0x17, 0xca, 0x32,
+			0x7c, 0x4b, 0x03, 0x67, 0x98, 0x3a, 0x81, 0x44,
+			0x06, 0x77, 0xc6, 0xd7, 0x0e, 0x44, 0xa0, 0x55,
+			0xdc, 0x53, 0x34, 0xd4, 0x81, 0xbe, 0xb5, 0x86,
+			0xf2, 0x1c, 0xbc, 0x77, 0x46, 0x94, 0x72, 0x27,
+			0x5a, 0x68, 0x55, 0x96, 0x06, 0x0d, 0xb9, 0x7e,
+			0x5c, 0x2b, 0x14, 0x85, 0x9e, 0x3c, 0x57, 0xe2,
+			0x3d, 0xad, 0x1c, 0x3f, 0xa3, 0x8f, 0x4a, 0xf0,
+			0x23, 0xf4, 0xd7, 0x43, 0x87, 0x5f, 0xb2, 0x49,
+			0xd0, 0x40, 0xc9, 0x8a, 0x88, 0x7d, 0xe2, 0xc1,
+			0x03, 0x2d, 0x04, 0xb6, 0x70, 0xd5, 0xf1, 0x24,
+			0x14, 0x1f, 0x36, 0x7f, 0xbd, 0x36, 0x15, 0x58,
+			0xc7, 0x5c, 0x75, 0x1a, 0x86, 0x96, 0x14, 0x54,
+			0xc3, 0xdd, 0x3e, 0x20, 0x6b, 0x53, 0xf2, 0x7e,
+			0xb1, 0x6a, 0xf4, 0x6f, 0x0a, 0xd6, 0xc2, 0x6f,
+			0xc0, 0x55, 0x05, 0xd9, 0xa7, 0xde, 0xdd, 0x4b,
+			0x9b, 0x62, 0x6b, 0x20, 0x83, 0xd5, 0x0f, 0x98,
+			0xb2, 0xbe, 0xd1, 0xad, 0x11, 0x3d, 0xb8, 0xb4,
+			0xcd, 0xeb, 0x54, 0x58, 0xc4, 0x43, 0x10, 0xb7,
+			0x26, 0x08, 0xf8, 0x3c, 0x82, 0xe0, 0x47, 0x20,
+			0xe2, 0x92, 0x57, 0xb2, 0x65, 0x21, 0xb6, 0x37,
+			0x45, 0x18, 0x29, 0x81, 0x09, 0x09, 0xfc, 0x53,
+			0x46, 0x30, 0xc1, 0xde, 0x29, 0xf4, 0xcf, 0xfc,
+			0x6d, 0x01, 0xe6, 0x0d, 0xff, 0xe9, 0x34, 0xb4,
+			0xad, 0x8d, 0xc6, 0x54, 0x0e, 0xfe, 0x42, 0x5b,
+			0xde, 0x2f, 0xb6, 0x51, 0x2a, 0xc3, 0x34, 0xc3,
+			0x43, 0xc6, 0xfa, 0x06, 0x51, 0x8f, 0x93, 0x5a,
+			0x7f, 0xc4, 0xd0, 0xd0, 0xd0, 0x37, 0xfb, 0x92,
+			0x77, 0x30, 0x01, 0xab, 0x97, 0xab, 0x6f, 0xa3,
+			0x08, 0x79, 0xfd, 0xd2, 0xf0, 0x9e, 0xc8, 0x1a,
+			0x1f, 0x74, 0x6b, 0x88, 0xf9, 0x31, 0xec, 0x3d,
+			0x47, 0x16, 0x86, 0xad, 0x68, 0x02, 0x78, 0x12,
+			0x68, 0x3d, 0x5c, 0x3d, 0x5b, 0x0a, 0x8d, 0xf3,
+			0xf5, 0x9e, 0xbb, 0x6a, 0x1c, 0xdb, 0xed, 0x58,
+			0xdb, 0x94, 0xe1, 0xd3, 0x45, 0xa9, 0x66, 0x18,
+			0xed, 0xf5, 0x84, 0xaa, 0x5d, 0x0b, 0xbc, 0x69,
+			0xce, 0xcb, 0x90, 0x1b, 0xb6, 0xb1, 0xfb, 0x70,
+			0xe2, 0xc8, 0x6a, 0x7a, 0xeb, 0x04, 0x5b, 0x05,
+			0x90, 0x4a, 0x35, 0x10, 0x67, 0xfc, 0xea, 0x79,
+			0x83, 0x9f, 0x0a, 0xa8, 0x8d, 0xe5, 0xe9, 0x38,
+			0xda, 0xf3, 0xf3, 0x5a, 0xf2, 0x54, 0x4c, 0xf0,
+			0xbc, 0xc1, 0x28, 0x2b, 0xa4, 0xaa, 0xc6, 0x4b,
+			0x96, 0x9b, 0x45, 0x6d, 0x48, 0x0f, 0x2d, 0x42,
+			0x90, 0xb9, 0x83, 0xac, 0x54, 0x90, 0xf5, 0xf0,
+			0x50, 0xa1, 0xb4, 0x00, 0x82, 0x51, 0xdd, 0x34,
+			0xd1, 0xa7, 0x20, 0x94, 0x35, 0x9d, 0xe1, 0xcf,
+			0xbf, 0x9e, 0xc4, 0x74, 0xcb, 0xa0, 0x92, 0x48,
+			0x0a, 0xd1, 0x4f, 0xaf, 0x45, 0x38, 0xb1, 0xe3,
+			0x46, 0x3b, 0xe4, 0x52, 0x7e, 0x16, 0x58, 0xd7,
+			0xb8, 0x56, 0xa5, 0x59, 0x86, 0x55, 0x95, 0x1c,
+			0x49, 0x13, 0x39, 0x5a, 0x5d, 0xaf, 0x23, 0x3c,
+			0x9b, 0xa8, 0x37, 0x3e, 0x68, 0x6b, 0x25, 0xfc,
+			0x6c, 0xd3, 0x79, 0xd5, 0x29, 0xa9, 0xcd, 0xfc,
+			0x93, 0x2a, 0x33, 0xad, 0x81, 0x4a, 0xb3, 0x14,
+			0x8f, 0x08, 0x8f, 0x8b, 0x1b, 0x84, 0x16, 0x9f,
+			0x78, 0xe0, 0x14, 0x73, 0x6b, 0xb7, 0xbc, 0x2f,
+			0xe4, 0xd8, 0x74, 0x9b, 0x94, 0xc3, 0x50, 0x76,
+			0xa3, 0xf8, 0xd4, 0x21, 0x7e, 0x22, 0x1d, 0x32,
+			0x56, 0x2f, 0x8f, 0x54, 0x5e, 0x53, 0x6a, 0xb5,
+			0x40, 0x6f, 0x69, 0xa2, 0x32, 0x60, 0x52, 0x34,
+			0x33, 0x2b, 0x68, 0xcb, 0xb5, 0x2d, 0x6c, 0x52,
+			0xdc, 0xd0, 0x9c, 0xd4, 0xdf, 0x3b, 0xef, 0x9c,
+			0xd9, 0x35, 0xed, 0x37, 0xe2, 0x06, 0x30, 0x1e,
+			0x3e, 0x28, 0x3f, 0xb9, 0xcf, 0x2f, 0x35, 0x4f,
+			0x83, 0x70, 0x36, 0xea, 0xb0, 0x25, 0x39, 0x6f,
+			0x29, 0xbe, 0xe8, 0x83, 0xdc, 0x32, 0x5b, 0x9a,
+			0xc9, 0x8b, 0x85, 0xac, 0xfa, 0x6d, 0x7f, 0x51,
+			0x15, 0xea, 0x08, 0xf5, 0x67, 0x5b, 0xa4, 0x97,
+			0x1d, 0x66, 0xdc, 0x78, 0x7e, 0x50, 0x2e, 0x20,
+			0x1b, 0xf6, 0xa0, 0x82, 0x3c, 0x09, 0xcb, 0x08,
+			0x13, 0xe9, 0x11, 0x1b, 0xdd, 0x61, 0xb4, 0x34,
+			0x4d, 0xfb, 0xd5, 0xf0, 0x22, 0xd9, 0xa4, 0xd1,
+			0x10, 0x85, 0x52, 0xac, 0x4f, 0x7f, 0xd9, 0x0c,
+			0x0e, 0x32, 0x5e, 0xea, 0x0f, 0x62, 0x31, 0xb8,
+			0xfc, 0x14, 0xce, 0xb9, 0x80, 0x63, 0x72, 0xa5,
+			0x06, 0x09, 0xa8, 0x29, 0xab, 0x64, 0x0e, 0x47,
+			0x23, 0x62, 0x30, 0xef, 0x71, 0xef, 0xd5, 0xd7,
+			0xb9, 0x91, 0x77, 0x6e, 0x6c, 0x19, 0x07, 0x6e,
+			0xd8, 0x3b, 0xf8, 0x46, 0x41, 0xea, 0x41, 0xf2,
+			0xd1, 0xf6, 0x2b, 0x8c, 0x6c, 0x97, 0xdb, 0xbc,
+			0xc1, 0xaa, 0xd4, 0x93, 0x51, 0xc1, 0x2c, 0x40,
+			0x31, 0xe9, 0xa4, 0x68, 0x3a, 0x91, 0x64, 0xf5,
+			0xff, 0xb5, 0x35, 0xdf, 0x83, 0xea, 0xd6, 0xdf,
+			0xcc, 0x6d, 0xdf, 0xd8, 0xcb, 0x9a, 0x0f, 0x88,
+			0xcf, 0xd4, 0xbe, 0xe0, 0x66, 0xf4, 0x24, 0xb9,
+			0x1c, 0x89, 0xd3, 0x37, 0x9a, 0xd0, 0x63, 0x24,
+			0x70, 0x84, 0xcc, 0xb8, 0x9a, 0x76, 0xc6, 0x05,
+			0xb2, 0xe6, 0xe4, 0x65, 0xfb, 0x28, 0x49, 0xe0,
+			0x30, 0x84, 0xd6, 0xae, 0x37, 0xc7, 0x66, 0xb0,
+			0xa7, 0xdb, 0x59, 0xd1, 0xc1, 0x54, 0xde, 0x8a,
+			0xf6, 0xae, 0xfc, 0x21, 0xbe, 0x07, 0xbe, 0x0f,
+			0x76, 0x1e, 0xb2, 0xe0, 0x1e, 0x8f, 0x8a, 0x32,
+			0xc8, 0xb4, 0x18, 0x97, 0x05, 0x90, 0xf9, 0x32,
+			0x18, 0x60, 0xac, 0x80, 0x4e, 0x9c, 0xa1, 0x5f,
+			0xd4, 0x7b, 0x80, 0xe7, 0x52, 0x1c, 0x7d, 0x56,
+			0x2f, 0xaf, 0x01, 0x2b, 0xfd, 0x36, 0x26, 0xcc,
+			0x5f, 0x89, 0xfa, 0x4f, 0xe3, 0x22, 0x87, 0xe6,
+			0x21, 0x6b, 0xb3, 0x7a, 0x5f, 0x4b, 0x7a, 0xe2,
+			0xd4, 0x0e, 0x43, 0x3b, 0xaa, 0x3d, 0xad, 0xe8,
+			0x5b, 0x76, 0x43, 0xc6, 0xe3, 0x3a, 0xf5, 0xd6,
+			0x2e, 0xf6, 0xfe, 0x69, 0x03, 0x59, 0xe8, 0x85,
+			0x70, 0xcd, 0xfe, 0xdd, 0x1c, 0x2e, 0xb1, 0x13,
+			0x68, 0x97, 0xf0, 0x6a, 0x92, 0xc2, 0x3f, 0xe3,
+			0x16, 0xd5, 0x1f, 0x89, 0xac, 0xd1, 0x5e, 0x6d,
+			0x61, 0x95, 0x9d, 0x10, 0x5f, 0xc6, 0x1b, 0x89,
+			0x90, 0x7e, 0xc0, 0x9a, 0x18, 0x2d, 0xfb, 0x93,
+			0xa3, 0xbb, 0x2c, 0x50, 0x30, 0xb7, 0x03, 0xaa,
+			0xf1, 0x5d, 0x9f, 0xe5, 0xee, 0x1c, 0xbd, 0xc9,
+			0x59, 0x2f, 0x94, 0xb0, 0x34, 0x63, 0x4b, 0x49,
+			0x82, 0xf7, 0x9d, 0x10, 0x04, 0xd3, 0x71, 0x4c,
+			0x03, 0x00, 0x0c, 0xbe, 0xff, 0x22, 0x53, 0x5c,
+			0xad, 0x8b, 0x12, 0xc5, 0x6b, 0xae, 0x47, 0xa7,
+			0xf4, 0x59, 0x02, 0x9f, 0x16, 0x63, 0x8d, 0xb9,
+			0x9b, 0x83, 0xde, 0xbc, 0x75, 0x24, 0x31, 0x97,
+			0xfc, 0x62, 0xb0, 0x70, 0x6d, 0x37, 0xec, 0xf7,
+			0xad, 0x58, 0x07, 0xf7, 0x48, 0xf0, 0x5f, 0xc8,
+			0x32, 0xa5, 0xf4, 0x3e, 0xc7, 0x6c, 0x57, 0xe5,
+			0x20, 0xd9, 0x88, 0x2b, 0x59, 0xd5, 0xa8, 0x34,
+			0x61, 0x7b, 0x16, 0xd5, 0x87, 0x40, 0xdf, 0x84,
+			0x0d, 0xc2, 0x68, 0x23, 0x67, 0xfd, 0xde, 0x60,
+			0xd5, 0xf5, 0xfd, 0x3a, 0xe6, 0xec, 0xbc, 0x48,
+			0xb0, 0xd2, 0x88, 0x4d, 0xfe, 0x00, 0xdb, 0x57,
+			0xbd, 0x76, 0x02, 0x4d, 0x51, 0x21, 0xd5, 0x05,
+			0x3f, 0x0d, 0xe4, 0x44, 0xdf, 0x6f, 0x13, 0xf9,
+			0xab, 0x0d, 0x65, 0xa6, 0xd7, 0xe8, 0xad, 0x8b,
+			0x8f, 0x69, 0xba, 0x0b, 0xae, 0xbd, 0x6d, 0xe1,
+			0xa7, 0x99, 0x14, 0xa8, 0x14, 0xea, 0xaa, 0x50,
+			0xa3, 0x40, 0x1d, 0x3c, 0x79, 0x9a, 0xee, 0x89,
+			0x42, 0xba, 0xba, 0x8c, 0x68, 0x94, 0xef, 0xf1,
+			0xcd, 0xf3, 0xa7, 0x46, 0x38, 0xe4, 0xc2, 0x1a,
+			0x10, 0x05, 0x08, 0xb4, 0xec, 0x10, 0x6a, 0x8c,
+			0x08, 0xd0, 0x72, 0x12, 0x71, 0x19, 0x3a, 0xe7,
+			0xbf, 0x6c, 0x93, 0xa2, 0x9e, 0x9d, 0xeb, 0x64,
+			0x0d, 0xf5, 0x6b, 0xd1, 0xb6, 0xec, 0xee, 0xab,
+			0xe3, 0xac, 0x5a, 0x5b, 0x78, 0xf9, 0x9b, 0x5e,
+			0x48, 0xae, 0xd5, 0x2c, 0xf3, 0x25, 0x19, 0xc8,
+			0x57, 0xab, 0xb0, 0x92, 0xb2, 0xa8, 0x4d, 0x76,
+			0x5f, 0x93, 0xe4, 0x4c, 0xd6, 0xe7, 0xca, 0x94,
+			0xac, 0xbe, 0x14, 0x2d, 0xe8, 0x8b, 0xe7, 0x61,
+			0x6b, 0x12, 0x10, 0x83, 0x0e, 0x29, 0x55, 0x80,
+			0x0b, 0xb3, 0xf0, 0x34, 0x89, 0xf8, 0xbc, 0x96,
+			0xfc, 0xdf, 0x8c, 0x1a, 0xa1, 0xa7, 0xcd, 0x43,
+			0x70, 0x34, 0x60, 0x9e, 0xc0, 0x8a, 0x05, 0xf3,
+			0x3f, 0x4b, 0xa1, 0x7b, 0xc2, 0xd0, 0xd7, 0x81,
+			0x23, 0x68, 0x38, 0x95, 0xf2, 0x5b, 0x8a, 0xa0,
+			0xcf, 0xb4, 0xb3, 0xc7, 0x3e, 0x53, 0xad, 0x6a,
+			0x1b, 0x53, 0x7f, 0x1b, 0x90, 0x32, 0x29, 0x33,
+			0x31, 0xce, 0xe8, 0x96, 0x30, 0x1a, 0x29, 0x37,
+			0x30, 0x4a, 0x71, 0x38, 0x86, 0xfc, 0x03, 0x0d,
+			0x1c, 0x13, 0x44, 0x4d, 0x67, 0x36, 0x2a, 0xb9,
+			0x3a, 0xff, 0xc9, 0x36, 0xd8, 0x29, 0x5e, 0xc5,
+			0x17, 0x48, 0x8d, 0x59, 0xf2, 0x3b, 0xf3, 0xbb,
+			0x3d, 0x02, 0x15, 0x29, 0x2e, 0xff, 0xc8, 0x6d,
+			0xe7, 0xfa, 0xf3, 0x3e, 0x93, 0x9e, 0x24, 0x92,
+			0x24, 0x8d, 0x5a, 0x59, 0x47, 0x82, 0xba, 0x64,
+			0xb1, 0xf2, 0x9c, 0x42, 0x1a, 0x2a, 0x97, 0x8c,
+			0xd8, 0x55, 0xd7, 0x6c, 0x78, 0x0f, 0x98, 0x29,
+			0xb2, 0x85, 0x7c, 0xa3, 0x42, 0xf1, 0xe6, 0x7f,
+			0x60, 0x96, 0x2b, 0xce, 0xe5, 0x4f, 0x79, 0xd8,
+			0xcd, 0x73, 0xb3, 0xc3, 0x33, 0xbd, 0xc2, 0x71,
+			0xc8, 0x32, 0xe1, 0x60, 0xe4, 0x4c, 0xa5, 0x0f,
+			0x1e, 0x3d, 0xac, 0x35, 0xc1, 0x1f, 0x21, 0x8f,
+			0xfa, 0x76, 0x1d, 0xa6, 0x15, 0x4b, 0xbf, 0x7f,
+			0x5a, 0x62, 0x38, 0x66, 0x33, 0x70, 0xcd, 0x63,
+			0xd6, 0xf6, 0x61, 0xb6, 0x8f, 0x99, 0xd8, 0xea,
+			0x87, 0x80, 0xe3, 0xae, 0x5f, 0x72, 0xbe, 0x07,
+			0x26, 0x8a, 0x24, 0x51, 0x63, 0x1e, 0x20, 0xc9,
+			0x2d, 0x13, 0x42, 0xf5, 0x83, 0x85, 0x86, 0xd5,
+			0x51, 0x00, 0xba, 0x09, 0xe9, 0xbe, 0x42, 0x61,
+			0x52, 0x89, 0x29, 0xc6, 0x31, 0xab, 0x58, 0x53,
+			0xca, 0xa1, 0xee, 0xcf, 0x65, 0xda, 0xb9, 0xe4,
+			0x13, 0x5e, 0x43, 0xae, 0x0e, 0xc7, 0xc9, 0x02,
+			0x86, 0xab, 0xc6, 0xec, 0xf8, 0xb1, 0xa3, 0x15,
+			0xc3, 0x24, 0x60, 0xc6, 0x63, 0x95, 0x52, 0x5b,
+			0xd6, 0x3e, 0xbd, 0x5b, 0xcd, 0xf1, 0x13, 0x89,
+			0x8a, 0xbd, 0x08, 0x73, 0x83, 0x24, 0x37, 0xf4,
+			0x74, 0x34, 0x74, 0xe4, 0xfd, 0x60, 0x00, 0x5b,
+			0xc2, 0xd5, 0xc1, 0x98, 0x8e, 0x50, 0xf1, 0x1d,
+			0xe9, 0x70, 0xcc, 0x8e, 0xc6, 0xf7, 0x4f, 0x6c,
+			0xf9, 0x12, 0xf4, 0x1d, 0xd8, 0x68, 0x00, 0x09,
+			0x3a, 0xba, 0xb3, 0x46, 0x36, 0x55, 0x69, 0x7a,
+			0x2e, 0x10, 0xbe, 0x23, 0x05, 0x90, 0x0b, 0xc4,
+			0x57, 0xc7, 0x14, 0xbe, 0xb2, 0xb1, 0xf8, 0x64,
+			0x4f, 0xeb, 0x0c, 0xe9, 0xf4, 0xae, 0x35, 0x90,
+			0x9f, 0x36, 0x70, 0x06, 0x5e, 0x9d, 0x05, 0x0c,
+			0xa2, 0x06, 0x1d, 0x54, 0x3d, 0x9d, 0x68, 0x88,
+			0x50, 0x52, 0xea, 0x51, 0xe5, 0xbd, 0x02, 0x62,
+			0xc0, 0x66, 0x07, 0x8d, 0xe7, 0x9a, 0x5c, 0xa2,
+			0xff, 0x50, 0x86, 0xb5, 0x68, 0xd7, 0x6d, 0xd0,
+			0x95, 0x56, 0x71, 0x88, 0xd3, 0x35, 0x32, 0xa0,
+			0xf3, 0x1c, 0xf2, 0xcd, 0x2b, 0x6d, 0x33, 0xd0,
+			0xa9, 0x6c, 0xdc, 0xf7, 0xdb, 0xf7, 0x3e, 0x7b,
+			0xd9, 0xdf, 0x84, 0x71, 0x66, 0x77, 0x63, 0x21,
+			0x1e, 0xc3, 0xf7, 0x04, 0x6a, 0x67, 0x46, 0x21,
+			0x13, 0xe1, 0x54, 0x08, 0xd0, 0x59, 0xd5, 0x32,
+			0xaf, 0x20, 0x86, 0x40, 0xdf, 0xc7, 0x88, 0x2f,
+			0xe4, 0x7a, 0xec, 0x76, 0xfc, 0x23, 0xbf, 0xea,
+			0x87, 0x22, 0x54, 0xb0, 0x3b, 0x14, 0xe5, 0xb3,
+			0x38, 0x69, 0x7e, 0xcc, 0xea, 0x48, 0x5b, 0x2f,
+			0x90, 0xf8, 0x31, 0x27, 0xf4, 0x8a, 0x7f, 0x3a,
+			0xd5, 0xa1, 0x85, 0x86, 0x19, 0xb2, 0x5c, 0x0a,
+			0x2e, 0x18, 0x1d, 0x34, 0x8b, 0xb8, 0xc8, 0xfe,
+			0xb3, 0x60, 0x02, 0x29, 0xfe, 0x63, 0x37, 0x86,
+			0xae, 0x66, 0x44, 0xf8, 0x64, 0x6a, 0x38, 0xdd,
+			0x3a, 0x79, 0x87, 0x91, 0x67, 0x61, 0x94, 0xb9,
+			0x37, 0xf8, 0xb8, 0x65, 0xb2, 0x89, 0xe9, 0x4a,
+			0xd9, 0xf6, 0xae, 0x91, 0x64, 0xec, 0x99, 0x1c,
+			0x25, 0x3c, 0x16, 0xeb, 0xa0, 0xb0, 0x46, 0x29,
+			0x60, 0x91, 0x5a, 0x98, 0x7d, 0xad, 0x60, 0x81,
+			0x37, 0x1d, 0x00, 0x16, 0x01, 0xea, 0x0e, 0x81,
+			0xdf, 0x20, 0x71, 0x47, 0xf5, 0x6a, 0x57, 0xf0,
+			0x68, 0xfc, 0x49, 0x44, 0xda, 0x9c, 0xa5, 0xb9,
+			0x3d, 0x03, 0xf6, 0x9b, 0x88, 0xb1, 0xff, 0x3a,
+			0x9c, 0xe9, 0x0c, 0xc2, 0xcf, 0xc6, 0xc2, 0x5a,
+			0xd8, 0x6f, 0x20, 0x16, 0x25, 0x91, 0x57, 0x2a,
+			0x43, 0xe6, 0xd7, 0xb5, 0x41, 0xc1, 0x35, 0x4b,
+			0xf4, 0x64, 0x53, 0x8a, 0xad, 0x3e, 0xe1, 0xa7,
+			0x8b, 0x81, 0x45, 0xf6, 0xe2, 0xa4, 0x2c, 0x1a,
+			0x6b, 0xae, 0x94, 0xc0, 0x6b, 0x3a, 0x0c, 0x4d,
+			0x9f, 0xa4, 0x1a, 0x66, 0x48, 0xc6, 0xad, 0x2e,
+			0xeb, 0xec, 0x24, 0xb8, 0xae, 0x75, 0xda, 0xb0,
+			0x57, 0x06, 0x2f, 0x22, 0x70, 0xa9, 0xed, 0xbe,
+			0xfa, 0x74, 0x29, 0x04, 0xa9, 0x96, 0x9d, 0x3b,
+			0x44, 0xbd, 0x92, 0x27, 0x5e, 0x85, 0xb5, 0x91,
+			0xaa, 0x5a, 0x4c, 0xf2, 0x68, 0x55, 0xa0, 0x8a,
+			0xfe, 0xd4, 0xe1, 0xf4, 0x47, 0x4e, 0x35, 0x00,
+			0xea, 0x86, 0x3a, 0x0d, 0xcd, 0x9d, 0x03, 0x87,
+			0x66, 0x70, 0xad, 0x4b, 0x2c, 0x6b, 0x56, 0xa1,
+			0xe2, 0x82, 0x5a, 0xf9, 0x2d, 0x28, 0xf2, 0x5f,
+			0xd2, 0xcf, 0x4b, 0xe1, 0xa4, 0x39, 0x01, 0x0b,
+			0x24, 0x89, 0x3d, 0x7c, 0x47, 0x62, 0x69, 0x7c,
+			0x36, 0x17, 0x21, 0xe2, 0xe2, 0xc2, 0x25, 0xe7,
+			0x86, 0x25, 0x1a, 0x5f, 0x07, 0x09, 0x9e, 0x85,
+			0xc4, 0xf4, 0x5f, 0x49, 0x55, 0x35, 0x05, 0x84,
+			0x8a, 0x64, 0xa6, 0xec, 0x82, 0xb8, 0xfe, 0x87,
+			0xcd, 0x74, 0xbd, 0xd4, 0x03, 0x5b, 0xd4, 0x2a,
+			0xa6, 0xf2, 0x6b, 0x1f, 0xa9, 0x85, 0xe8, 0x52,
+			0x6e, 0x49, 0xe2, 0xb6, 0x93, 0x37, 0x74, 0xab,
+			0xfe, 0x85, 0x1c, 0xaf, 0x01, 0xda, 0xda, 0x17,
+			0xc0, 0x5d, 0x3d, 0x0c, 0x61, 0x43, 0xac, 0x5d,
+			0xeb, 0xc8, 0x0b, 0x14, 0x02, 0x42, 0xfd, 0x26,
+			0xcf, 0x1a, 0x41, 0x68, 0x7f, 0x96, 0xd0, 0xfb,
+			0x84, 0x9d, 0x09, 0x41, 0xc2, 0x12, 0x82, 0x62,
+			0x1e, 0xa6, 0x31, 0x82, 0x9d, 0x76, 0x45, 0x0f,
+			0x74, 0xfa, 0x11, 0xab, 0x63, 0xde, 0x3c, 0x03,
+			0x3c, 0xc3, 0x31, 0x09, 0xdc, 0xbd, 0x6b, 0x88,
+			0xb7, 0xbc, 0xc4, 0x2f, 0x63, 0x0c, 0xa2, 0x5a,
+			0x8b, 0x4b, 0xb8, 0x49, 0xb4, 0xd9, 0x15, 0x14,
+			0x11, 0x37, 0xca, 0x5c, 0xee, 0x1a, 0xbb, 0xf8,
+			0xf8, 0xa4, 0x70, 0x36, 0xff, 0x35, 0xc7, 0x2b,
+			0x72, 0x56, 0x4f, 0x3e, 0x06, 0x38, 0xdf, 0x48,
+			0xe9, 0xc6, 0x67, 0x51, 0x0f, 0xf2, 0x1b, 0x79,
+			0xd9, 0x8f, 0x32, 0x99, 0x43, 0x4d, 0x69, 0xd9,
+			0xec, 0x73, 0x63, 0xea, 0x9e, 0x0e, 0x26, 0x96,
+			0xa0, 0x62, 0x7e, 0xdc, 0x5b, 0x4d, 0x25, 0x88,
+			0xac, 0xda, 0xea, 0xca, 0x27, 0x20, 0xe9, 0x1f,
+			0xc9, 0xf8, 0xf5, 0x9e, 0x84, 0xdf, 0x0a, 0x92,
+			0xf7, 0x90, 0xa2, 0xb6, 0xc8, 0x64, 0xc1, 0x7f,
+			0x7d, 0xf0, 0x29, 0x13, 0x68, 0x97, 0xcc, 0xe7,
+			0x23, 0x8d, 0x4b, 0xa8, 0x6d, 0xfb, 0x25, 0xf7,
+			0xf5, 0xc9, 0x11, 0x6d, 0x0b, 0x7f, 0xb1, 0xa2,
+			0xad, 0x4e, 0x77, 0x00, 0x1c, 0x6c, 0x81, 0x68,
+			0x6a, 0xb3, 0xea, 0xcd, 0x15, 0x3b, 0xf8, 0x67,
+			0xf1, 0xac, 0x8c, 0x58, 0x45, 0x56, 0x92, 0x9b,
+			0x8a, 0xfe, 0x64, 0xb3, 0x1d, 0xf1, 0xfa, 0x53,
+			0x5d, 0x98, 0x8c, 0xde, 0x37, 0x8d, 0x0e, 0x5e,
+			0x6e, 0x28, 0xbe, 0xb6, 0x33, 0x6b, 0xa2, 0x06,
+			0x81, 0x38, 0x20, 0x89, 0xd6, 0xc3, 0x9f, 0x09,
+			0x6e, 0xc8, 0x6f, 0x1f, 0x12, 0x82, 0xf5, 0x1f,
+			0x95, 0x77, 0xc1, 0x81, 0xe5, 0x56, 0x50, 0xe6,
+			0xaf, 0x4c, 0x49, 0xb0, 0xd9, 0x75, 0x72, 0xe4,
+			0x98, 0xa6, 0xcb, 0x3e, 0xf3, 0x89, 0x31, 0xdd,
+			0x49, 0x51, 0xbb, 0x9f, 0x73, 0x53, 0x2f, 0x57,
+			0x74, 0x41, 0x0d, 0xe2, 0x2a, 0x08, 0xcc, 0xf7,
+			0xae, 0xbc, 0x07, 0x53, 0x93, 0x90, 0x9e, 0x19,
+			0x20, 0xf6, 0x4d, 0x93, 0xc5, 0x71, 0x05, 0xaf,
+			0x85, 0xea, 0xef, 0xca, 0x53, 0x3d, 0x57, 0xf2,
+			0x94, 0x5d, 0x8b, 0xbd, 0x3d, 0xb9, 0xf1, 0x33,
+			0x13, 0xfc, 0xbf, 0x68, 0xbd, 0x2d, 0xc1, 0x4b,
+			0x69, 0xc7, 0x3d, 0x55, 0x44, 0xc1, 0xfd, 0x9b,
+			0xac, 0x58, 0x1b, 0xfe, 0x03, 0x5c, 0xf8, 0x29,
+			0x91, 0x15, 0xf9, 0x43, 0x00, 0x35, 0xeb, 0xc5,
+			0xb0, 0x79, 0x46, 0x77, 0x67, 0x31, 0x3a, 0xc4,
+			0xe6, 0xfe, 0xc1, 0x7b, 0xa4, 0xa1, 0x5b, 0x67,
+			0x91, 0xe4, 0xd5, 0x68, 0x6e, 0x93, 0x59, 0xc8,
+			0x56, 0x20, 0x6e, 0x9c, 0xc6, 0x1e, 0xb5, 0x1c,
+			0xea, 0x1a, 0x38, 0xfd, 0x8a, 0xbb, 0x89, 0xb3,
+			0xcf, 0x80, 0x18, 0x73, 0xc1, 0xc6, 0x72, 0xce,
+			0xc4, 0x8f, 0x62, 0x80, 0x9b, 0x77, 0xd7, 0xeb,
+			0x08, 0xed, 0xd4, 0x45, 0x75, 0x1e, 0x27, 0xa9,
+			0xd8, 0xfc, 0x0c, 0x6d, 0x02, 0xad, 0x47, 0x30,
+			0xba, 0x48, 0xeb, 0x75, 0x8e, 0x94, 0xef, 0xb7,
+			0x55, 0xeb, 0x60, 0x8a, 0x76, 0xf5, 0x9f, 0x02,
+			0xe2, 0xd3, 0xcb, 0xe8, 0x91, 0x4b, 0x1a, 0x87,
+			0x5d, 0x19, 0xa7, 0x32, 0x9d, 0x30, 0x0f, 0x19,
+			0x8f, 0x52, 0xf4, 0x2d, 0x85, 0xb5, 0x5b, 0xed,
+			0x69, 0x49, 0x75, 0x7b, 0x91, 0x93, 0x1f, 0x8e,
+			0xc9, 0x26, 0x98, 0x3e, 0x97, 0xd2, 0x69, 0x2c,
+			0x11, 0x9e, 0x28, 0x5a, 0x75, 0xa9, 0x49, 0x4c,
+			0x82, 0x25, 0x65, 0x50, 0x20, 0x62, 0x83, 0x66,
+			0xbf, 0x86, 0x05, 0xc5, 0x14, 0x99, 0x65, 0xfc,
+			0x4e, 0x97, 0x86, 0xeb, 0x08, 0x6c, 0x00, 0xa8,
+			0xbc, 0xf9, 0x9d, 0x9c, 0xe5, 0x4a, 0x0f, 0x9d,
+			0xe2, 0x34, 0xf1, 0x98, 0x47, 0xd8, 0xc1, 0x77,
+			0xfc, 0x64, 0x66, 0xe6, 0x0f, 0xee, 0x93, 0x9a,
+			0x5f, 0x0b, 0x03, 0xfc, 0x01, 0xba, 0x07, 0x88,
+			0xfb, 0x6e, 0xe0, 0xa1, 0x85, 0x85, 0x2b, 0x26,
+			0xd6, 0xe2, 0xde, 0xee, 0x21, 0xc5, 0x43, 0x73,
+			0xa9, 0x9a, 0x09, 0x78, 0x9a, 0x13, 0xd3, 0x9d,
+			0x42, 0x07, 0xd4, 0x96, 0x72, 0x0e, 0x57, 0xfc,
+			0x77, 0x6c, 0xf1, 0x04, 0x8a, 0x7b, 0x6a, 0xb2,
+			0xf5, 0x7b, 0xb0, 0xa3, 0x1b, 0x98, 0xbc, 0x29,
+			0x9c, 0x4f, 0xdb, 0x05, 0x94, 0x4d, 0x22, 0x63,
+			0x00, 0x82, 0x8e, 0xfe, 0x7e, 0x14, 0x6d, 0x39,
+			0x0b, 0xba, 0x14, 0xb0, 0xb4, 0x64, 0xad, 0xac,
+			0xbb, 0x22, 0x3f, 0x62, 0xe0, 0x98, 0xc5, 0x60,
+			0xcd, 0x59, 0x62, 0x70, 0xef, 0xa5, 0xa6, 0x26,
+			0xfc, 0xe2, 0x82, 0x50, 0xe3, 0xb4, 0xec, 0x3a,
+			0x99, 0x75, 0x83, 0x8d, 0x89, 0x01, 0x68, 0xac,
+			0x0e, 0x57, 0x73, 0xd4, 0x70, 0x8e, 0xb9, 0xa3,
+			0xa2, 0x69, 0x27, 0x3c, 0x29, 0x22, 0x8e, 0x89,
+			0x4d, 0x8e, 0x4c, 0x2f, 0x9d, 0x7b, 0x3d, 0x69,
+			0x51, 0xe2, 0xbb, 0x96, 0x3d, 0x64, 0xa4, 0xa1,
+			0xbd, 0x63, 0xc2, 0x41, 0xce, 0xe8, 0x4c, 0x27,
+			0x19, 0xdb, 0xe5, 0x4f, 0x13, 0x30, 0x01, 0xe5,
+			0x6b, 0xa8, 0x02, 0x6f, 0xc9, 0x38, 0x66, 0x3d,
+			0x02, 0x3d, 0x53, 0x32, 0xbd, 0xc0, 0xb2, 0x47,
+			0xfd, 0x20, 0x66, 0x11, 0x32, 0xcf, 0xfb, 0x55,
+			0x22, 0x47, 0x21, 0xad, 0xf8, 0x89, 0x67, 0x00,
+			0x3a, 0x24, 0x05, 0xe2, 0x21, 0xcc, 0x30, 0xc0,
+			0x12, 0x02, 0x3f, 0xa4, 0xcd, 0x3c, 0x8a, 0x73,
+			0xd7, 0x56, 0x2b, 0x28, 0x59, 0x6f, 0x1e, 0x32,
+			0x85, 0x05, 0x39, 0xd0, 0x0e, 0x1c, 0xb3, 0xfc,
+			0x77, 0xaa, 0x4e, 0x83, 0x5c, 0xdc, 0x51, 0x45,
+			0x29, 0x35, 0x46, 0x4e, 0x1b, 0x2c, 0x35, 0x9a,
+			0xbb, 0xb7, 0xde, 0xa9, 0x25, 0x04, 0xaa, 0x75,
+			0x27, 0xf6, 0x9d, 0xb0, 0xe4, 0x26, 0x84, 0xd6,
+			0x12, 0x24, 0x08, 0x2d, 0xea, 0x9e, 0x72, 0x64,
+			0xa9, 0x06, 0x85, 0x08, 0xd0, 0xbf, 0x6f, 0xd1,
+			0x8a, 0x3f, 0x38, 0x77, 0xcd, 0x6f, 0xb9, 0xbf,
+			0x62, 0x16, 0x29, 0x77, 0x15, 0x2c, 0x3a, 0x27,
+			0x71, 0x19, 0xc0, 0x5c, 0x10, 0x91, 0x82, 0x03,
+			0xc0, 0xae, 0x5f, 0x85, 0xd1, 0x37, 0xa1, 0xae,
+			0x5d, 0x2d, 0x1f, 0x25, 0xf1, 0x91, 0xf4, 0x76,
+			0x56, 0x5b, 0x9a, 0xd4, 0x7c, 0xa6, 0xf6, 0x43,
+			0xb8, 0x3d, 0x80, 0x84, 0xa1, 0x1b, 0x8a, 0x3e,
+			0x7c, 0x28, 0x9a, 0x95, 0xa5, 0x9c, 0x0d, 0x72,
+			0x9e, 0x36, 0x30, 0xb4, 0x18, 0xe7, 0x4d, 0xd4,
+			0x57, 0xa9, 0x62, 0x2d, 0x0e, 0x7c, 0x68, 0x7d,
+			0x05, 0x7b, 0x61, 0xdd, 0x10, 0xca, 0x52, 0xce,
+			0x6f, 0xc7, 0x40, 0xc3, 0xa8, 0x7f, 0xa4, 0x97,
+			0xd5, 0x70, 0xd6, 0xec, 0xe5, 0x43, 0x22, 0x94,
+			0xe1, 0x99, 0xc2, 0xe3, 0xbc, 0x68, 0xf6, 0xd6,
+			0x29, 0x23, 0xce, 0xc1, 0x3b, 0x05, 0x47, 0xdf,
+			0xb6, 0x0e, 0x55, 0xce, 0x14, 0x2f, 0x58, 0x46,
+			0x8b, 0xda, 0x8a, 0x6d, 0x7e, 0x2e, 0x99, 0xe1,
+			0xad, 0xb7, 0x9d, 0x44, 0x8a, 0xcd, 0x6c, 0x1d,
+			0x54, 0x98, 0x6d, 0x06, 0xa4, 0x76, 0x79, 0xbf,
+			0xab, 0x54, 0xd2, 0x17, 0xbb, 0xa5, 0x3c, 0xb6,
+			0xc9, 0x4b, 0x1a, 0x9a, 0x07, 0xaa, 0x4d, 0xd2,
+			0x78, 0x44, 0x43, 0x2f, 0x1d, 0x84, 0x67, 0xf5,
+			0x6e, 0xc1, 0x59, 0xab, 0x1a, 0xf6, 0x54, 0xa1,
+			0x4c, 0xe7, 0x85, 0x5b, 0x17, 0xa2, 0xb6, 0x10,
+			0x56, 0x4b, 0x3d, 0xe8, 0xd8, 0xb8, 0x17, 0xb6,
+			0x49, 0x73, 0xde, 0x57, 0x80, 0x03, 0xcf, 0x7d,
+			0x4f, 0x8a, 0x3a, 0xd8, 0x5d, 0x5b, 0x05, 0x06,
+			0xa3, 0x06, 0x44, 0x74, 0x6a, 0x8a, 0xdf, 0xfd,
+			0xea, 0x21, 0x0d, 0x69, 0x5e, 0x8f, 0x67, 0x5d,
+			0xbb, 0x06, 0x72, 0x36, 0x19, 0x49, 0x90, 0x36,
+			0xe4, 0x3c, 0xb5, 0xf9, 0x91, 0xbc, 0x3e, 0x25,
+			0x1b, 0x4f, 0x9c, 0xf6, 0x80, 0x16, 0x79, 0x90,
+			0x52, 0x7f, 0x7b, 0xab, 0xc4, 0xe4, 0x77, 0x6e,
+			0xdd, 0x70, 0xe8, 0xf6, 0x83, 0x6e, 0x75, 0x01,
+			0x1c, 0x78, 0x0b, 0x83, 0x81, 0xa0, 0x28, 0x8a,
+			0x9b, 0xc7, 0x1f, 0x52, 0x3f, 0x58, 0x0c, 0xe5,
+			0x94, 0xf4, 0xac, 0xcd, 0x02, 0xcc, 0xc6, 0x1c,
+			0x3c, 0xb2, 0x3a, 0xfd, 0xdd, 0x83, 0x21, 0x1e,
+			0xec, 0x2a, 0x27, 0x1d, 0x7e, 0xbb, 0x9c, 0x0a,
+			0x1e, 0x84, 0x14, 0x0b, 0xb6, 0x1b, 0x82, 0x4c,
+			0x1f, 0xce, 0xc9, 0x2d, 0x3d, 0x26, 0x7b, 0x9f,
+			0xab, 0x1b, 0x46, 0x46, 0x46, 0xa8, 0x8c, 0x56,
+			0x34, 0x95, 0x86, 0x3c, 0xf6, 0x3a, 0x07, 0x42,
+			0x90, 0xab, 0xa1, 0x88, 0xd1, 0x50, 0x88, 0x65,
+			0xca, 0x6a, 0xe0, 0xdf, 0x69, 0x1e, 0x01, 0xab,
+			0x9d, 0x34, 0x2e, 0x6c, 0x6d, 0x3f, 0xd1, 0x2b,
+			0xf6, 0xf7, 0xa6, 0xe4, 0x37, 0xbb, 0xe6, 0x7a,
+			0xc7, 0x41, 0x24, 0xe8, 0x15, 0x77, 0xb3, 0x5b,
+			0x0c, 0x48, 0xcd, 0xc4, 0xef, 0xf0, 0xef, 0xa2,
+			0x38, 0x52, 0xaa, 0x87, 0x17, 0xac, 0xba, 0x34,
+			0xb1, 0xe1, 0xa7, 0xb7, 0xb7, 0x5f, 0xa0, 0xcc,
+			0xbd, 0xfb, 0x06, 0xa8, 0x1d, 0x50, 0x46, 0x31,
+			0x8b, 0x5b, 0x47, 0xc4, 0x61, 0xaf, 0x8c, 0x3b,
+			0x3d, 0x1d, 0xea, 0x5e, 0xa1, 0x2b, 0xb6, 0xaa,
+			0xdf, 0x96, 0x30, 0x0f, 0x86, 0x34, 0x66, 0x29,
+			0x09, 0x48, 0x68, 0x95, 0xb4, 0x36, 0x0e, 0x31,
+			0xa1, 0x33, 0x2b, 0xdd, 0xb0, 0xc9, 0x6e, 0x3f,
+			0x1f, 0xf5, 0x71, 0x64, 0xaf, 0x4e, 0x42, 0x41,
+			0xf5, 0x0d, 0x96, 0x9b, 0x9a, 0x74, 0x2f, 0xf4,
+			0x16, 0xe0, 0x97, 0xda, 0xaa, 0x96, 0x0e, 0xc5,
+			0xeb, 0xb5, 0xfc, 0xf9, 0xee, 0x16, 0x56, 0xf8,
+			0x24, 0xe1, 0x5b, 0xf3, 0xe2, 0x58, 0xae, 0xcc,
+			0x92, 0xc6, 0xb3, 0xf7, 0x7c, 0x93, 0xc4, 0xe6,
+			0xab, 0x23, 0x25, 0x95, 0x91, 0x43, 0x58, 0x3b,
+			0xb8, 0xf3, 0x3c, 0xe8, 0x72, 0x86, 0x7c, 0x9e,
+			0x14, 0xd4, 0x99, 0x3e, 0xf3, 0x91, 0xdb, 0xca,
+			0x66, 0x01, 0x1c, 0x01, 0x3f, 0x67, 0x98, 0x5f,
+			0x87, 0x9d, 0xa7, 0x1b, 0xe4, 0xf9, 0x5c, 0xd2,
+			0xe2, 0x5d, 0xe4, 0x62, 0x36, 0xb4, 0x87, 0xb6,
+			0x77, 0x11, 0x45, 0x69, 0x88, 0x18, 0xc4, 0x99,
+			0x00, 0x77, 0x7a, 0x45, 0xbc, 0x23, 0xeb, 0x14,
+			0xb8, 0xbd, 0x62, 0x71, 0x1b, 0x0d, 0xc7, 0xa3,
+			0xba, 0x39, 0xd0, 0x67, 0x2e, 0x86, 0x22, 0xf1,
+			0x30, 0x8f, 0xa1, 0xe1, 0xce, 0x1b, 0xf1, 0xd8,
+			0x4b, 0xb0, 0xeb, 0x7c, 0x8e, 0x09, 0x1c, 0x25,
+			0xd2, 0xf2, 0x4d, 0x72, 0x11, 0x9c, 0xf0, 0x6c,
+			0x33, 0x8d, 0xa8, 0xf5, 0xa8, 0x16, 0x92, 0x51,
+			0x97, 0xea, 0xf3, 0x8c, 0x44, 0x7a, 0x1f, 0x69,
+			0xfb, 0x59, 0xc7, 0x45, 0x65, 0x5b, 0x29, 0x14,
+			0xd2, 0xb3, 0x59, 0xd6, 0xe5, 0xc5, 0xdb, 0x7e,
+			0x42, 0xdc, 0x43, 0xc1, 0xb6, 0xa6, 0x88, 0x9c,
+			0xb8, 0x11, 0x96, 0xdb, 0x6a, 0x32, 0x56, 0x20,
+			0x7a, 0xfc, 0xff, 0x93, 0x4b, 0xfa, 0xc5, 0x0b,
+			0x19, 0x68, 0xc5, 0x74, 0x1b, 0x63, 0xe7, 0x76,
+			0x36, 0x51, 0x4e, 0x15, 0x67, 0x0d, 0xb8, 0xe5,
+			0x33, 0x4b, 0xa5, 0x5a, 0x04, 0xf1, 0x32, 0x7c,
+			0xdc, 0x02, 0xa6, 0x02, 0x6c, 0xb0, 0x69, 0x45,
+			0xe0, 0x17, 0x43, 0x9b, 0xd5, 0xba, 0x33, 0x33,
+			0x53, 0xf7, 0x42, 0xfd, 0xe9, 0x0a, 0x4b, 0x2f,
+			0x72, 0x1b, 0x2f, 0xee, 0x35, 0x1a, 0x00, 0x89,
+			0xf2, 0x40, 0x46, 0x17, 0x1c, 0x34, 0xe9, 0x11,
+			0x59, 0x66, 0x86, 0xd6, 0x58, 0x5d, 0x1b, 0xa5,
+			0x1a, 0xb0, 0x83, 0x63, 0xa9, 0x54, 0x22, 0x07,
+			0x26, 0x90, 0x86, 0xd0, 0x9e, 0xa2, 0xb6, 0x59,
+			0xd5, 0x22, 0xc8, 0x67, 0x2f, 0xd0, 0x2c, 0x68,
+			0x11, 0x9a, 0x8c, 0x91, 0x0f, 0x9e, 0xf8, 0xbb,
+			0xc9, 0x5c, 0x43, 0xa2, 0xcf, 0x2a, 0x6e, 0x87,
+			0x10, 0x7b, 0xb8, 0x2b, 0x72, 0x81, 0x19, 0xb1,
+			0x14, 0x66, 0x0e, 0x90, 0xcc, 0xc2, 0x41, 0x52,
+			0x76, 0x4c, 0xa2, 0x1e, 0xc4, 0x98, 0x84, 0x51,
+			0x4b, 0x5b, 0x8f, 0x33, 0x8a, 0x8e, 0xb6, 0x32,
+			0x2a, 0xa6, 0x3c, 0xa8, 0xc4, 0x58, 0x05, 0xce,
+			0x0a, 0x82, 0xf3, 0xe5, 0x16, 0x50, 0x83, 0x31,
+			0x43, 0x22, 0x05, 0xc0, 0xb6, 0xfb, 0xdc, 0x93,
+			0xd3, 0x3a, 0xcf, 0xfa, 0x8c, 0x21, 0xcd, 0x71,
+			0xb5, 0xaa, 0x5e, 0x6a, 0x2b, 0x19, 0xa5, 0x7a,
+			0x77, 0xb9, 0x03, 0x65, 0x3b, 0x7c, 0xfb, 0x16,
+			0x81, 0x18, 0xea, 0xaf, 0xe8, 0xec, 0x74, 0x86,
+			0x04, 0xad, 0x4b, 0x75, 0x5e, 0xd1, 0xb7, 0xa9,
+			0x71, 0xa9, 0x14, 0x32, 0x16, 0xa0, 0x8d, 0x32,
+			0x58, 0xb1, 0xff, 0x41, 0xff, 0x74, 0x07, 0x5b,
+			0x91, 0x5a, 0xae, 0x64, 0x42, 0x1c, 0xa4, 0x38,
+			0x08, 0x15, 0x9b, 0x00, 0xd0, 0xa8, 0xc2, 0x3b,
+			0xbf, 0x33, 0x89, 0x15, 0x2f, 0xc8, 0x58, 0x73,
+			0x27, 0x2f, 0x92, 0xc6, 0x82, 0xc4, 0x8a, 0x1f,
+			0x2c, 0x71, 0x41, 0xb7, 0x54, 0x11, 0x59, 0x13,
+			0xaa, 0xd6, 0x62, 0x47, 0xd1, 0xe9, 0xe6, 0x17,
+			0x41, 0x8b, 0x2b, 0x63, 0x62, 0x03, 0xd5, 0xa2,
+			0x6c, 0x31, 0xf4, 0x26, 0xaa, 0x6b, 0x44, 0x1a,
+			0xaa, 0x7c, 0x03, 0x85, 0x23, 0x8a, 0x0b, 0xb2,
+			0xc9, 0x3a, 0xf6, 0x8e, 0x8b, 0xc1, 0xfc, 0xff,
+			0xc3, 0xfd, 0x62, 0x95, 0x2f, 0x5e, 0xe9, 0x60,
+			0xbf, 0x99, 0x16, 0xa0, 0x35, 0xcb, 0xa7, 0x5d,
+			0xbf, 0xf7, 0x19, 0x4e, 0x79, 0x2a, 0x6f, 0xf9,
+			0x4c, 0xda, 0xe9, 0xee, 0x47, 0x9a, 0x6f, 0xe5,
+			0x84, 0xd1, 0x87, 0x8e, 0x9d, 0xcb, 0x1a, 0xa5,
+			0xbc, 0xc0, 0x9e, 0x59, 0x2a, 0x97, 0x45, 0x8c,
+			0x1b, 0xb1, 0x98, 0x99, 0xb8, 0x6c, 0xb2, 0x43,
+			0x18, 0xb5, 0x5f, 0xd5, 0x22, 0xee, 0x74, 0xd7,
+			0xfa, 0xdb, 0x24, 0xdb, 0x3b, 0xfa, 0x86, 0x7f,
+			0xfa, 0x1d, 0xd3, 0xc6, 0xef, 0xdc, 0x43, 0x36,
+			0xec, 0x00, 0xfc, 0x20, 0xeb, 0x81, 0xd9, 0x41,
+			0xa8, 0x6d, 0x65, 0xc1, 0x02, 0xb7, 0x16, 0x61,
+			0x83, 0xc7, 0x7b, 0x2f, 0xf2, 0xb4, 0xf7, 0xf4,
+			0x8e, 0x93, 0x2e, 0x2b, 0xca, 0x9f, 0xbb, 0xa2,
+			0x21, 0xde, 0xa8, 0xcd, 0x0f, 0x09, 0x07, 0x40,
+			0x78, 0x16, 0xb8, 0x82, 0x5b, 0x4a, 0x1d, 0xc4,
+			0xb3, 0x08, 0x85, 0xbc, 0xb6, 0x21, 0x5d, 0x6f,
+			0x92, 0x1e, 0x72, 0x20, 0x41, 0xd4, 0x27, 0x8d,
+			0xf4, 0xb1, 0x14, 0x44, 0xff, 0x12, 0x61, 0xf3,
+			0x60, 0x56, 0xcc, 0x1a, 0xed, 0x88, 0x4a, 0x75,
+			0xfe, 0xf9, 0x8e, 0xd9, 0x5d, 0x56, 0x1f, 0x4c,
+			0xb7, 0x64, 0x08, 0xdd, 0x6d, 0x02, 0x73, 0x7b,
+			0xda, 0xd2, 0xcd, 0x30, 0x20, 0xa8, 0x36, 0x8e,
+			0xe6, 0x7e, 0xfe, 0x49, 0x9b, 0x1b, 0x76, 0xd4,
+			0xa5, 0x27, 0x3f, 0x04, 0x9e, 0x51, 0xb1, 0xef,
+			0x9d, 0x42, 0x85, 0xfd, 0x0b, 0xc2, 0x9b, 0x85,
+			0x73, 0xa4, 0x0a, 0x2b, 0xdf, 0xd1, 0x2e, 0xe2,
+			0x91, 0xbd, 0x14, 0x44, 0x5d, 0x5c, 0xc6, 0x7c,
+			0xb8, 0x74, 0xa2, 0xab, 0x65, 0xb9, 0x2d, 0x96,
+			0x54, 0xa1, 0x0a, 0x9b, 0xa6, 0x61, 0x65, 0x66,
+			0x43, 0x27, 0xab, 0x4f, 0x5c, 0xc1, 0xf1, 0xc2,
+			0xf4, 0x2f, 0xc2, 0xff, 0x15, 0xf4, 0x98, 0x20,
+			0x2a, 0xbe, 0x9c, 0x9a, 0x91, 0xc3, 0xca, 0x87,
+			0xfa, 0x89, 0xde, 0x70, 0xfd, 0x7d, 0x0b, 0x92,
+			0x8a, 0x1e, 0xe6, 0x7f, 0xa9, 0x4c, 0xd4, 0x49,
+			0x8c, 0x9d, 0xa7, 0xc2, 0x50, 0x69, 0xd4, 0x53,
+			0x76, 0x59, 0x2d, 0x49, 0x96, 0x94, 0x25, 0xea,
+			0x38, 0xd3, 0x6b, 0xde, 0xf6, 0xc8, 0x70, 0x15,
+			0xe3, 0xbb, 0x87, 0x75, 0x21, 0xbe, 0x90, 0xef,
+			0x2e, 0x57, 0x2e, 0xfa, 0x5e, 0x93, 0x2f, 0xd9,
+			0x08, 0xee, 0x4f, 0x67, 0x06, 0x4a, 0x7a, 0xa2,
+			0x98, 0x37, 0xd6, 0xda, 0x4f, 0x97, 0xff, 0xd6,
+			0x0a, 0x6e, 0xfa, 0x1e, 0xb3, 0x30, 0x8f, 0x59,
+			0x63, 0x7b, 0x8b, 0x44, 0xac, 0x07, 0x93, 0x2a,
+			0x54, 0xd9, 0xea, 0x83, 0x10, 0xf8, 0x0a, 0x91,
+			0x5b, 0xf7, 0x23, 0xa2, 0x27, 0xed, 0x22, 0x84,
+			0x82, 0xa4, 0x43, 0xac, 0x54, 0x2c, 0x33, 0x83,
+			0xdd, 0x03, 0xcf, 0x36, 0x6c, 0xaf, 0x8e, 0xbd,
+			0xfe, 0xdc, 0x7d, 0x70, 0x2f, 0xf0, 0x90, 0xd7,
+			0x1a, 0xf2, 0x67, 0xbc, 0xe3, 0x6e, 0x71, 0x9a,
+			0x9f, 0xa7, 0x2e, 0x23, 0xb2, 0x25, 0x57, 0x8d,
+			0x09, 0xe0, 0x58, 0xca, 0x76, 0x85, 0x4a, 0xa7,
+			0xe0, 0xeb, 0xe4, 0xc0, 0xed, 0x18, 0xbc, 0x8e,
+			0x09, 0x6c, 0xbd, 0xde, 0x43, 0xcd, 0xdb, 0x4c,
+			0x5e, 0xa1, 0xb9, 0xd4, 0xcf, 0x7b, 0x89, 0xdb,
+			0x79, 0xae, 0xfa, 0x5e, 0xdc, 0x0a, 0xa8, 0xe4,
+			0xfc, 0x9e, 0xb3, 0x0f, 0x86, 0xe9, 0x16, 0xbe,
+			0xdb, 0xd3, 0x8d, 0x61, 0x2d, 0x75, 0xb4, 0x01,
+			0xa1, 0x95, 0x0f, 0x55, 0xef, 0x41, 0x0a, 0x5b,
+			0x6b, 0xae, 0xa4, 0x50, 0x66, 0xb0, 0xd5, 0x19,
+			0x36, 0x79, 0xcc, 0x34, 0xcf, 0x15, 0xb5, 0x9f,
+			0x9b, 0x00, 0xce, 0x9c, 0xc0, 0x50, 0x6b, 0x01,
+			0xab, 0x17, 0xd6, 0x4c, 0x66, 0xb1, 0xf3, 0x8c,
+			0x8c, 0x73, 0xc1, 0x0a, 0xee, 0x5a, 0x4d, 0xea,
+			0xd1, 0xe5, 0x79, 0x50, 0x87, 0x9b, 0x19, 0x0f,
+			0x39, 0xb9, 0x37, 0xf5, 0xbe, 0x0a, 0xb5, 0x2e,
+			0xb8, 0xb2, 0x4b, 0xa2, 0x67, 0xcf, 0xef, 0xab,
+			0x64, 0xc2, 0x40, 0x36, 0xa1, 0xba, 0x94, 0xe7,
+			0x0a, 0x2d, 0x31, 0xf3, 0x72, 0x69, 0x55, 0xfa,
+			0x31, 0x69, 0x61, 0xfd, 0xfc, 0x10, 0xd8, 0x17,
+			0xaf, 0xfe, 0x7e, 0xe6, 0xb6, 0x3f, 0x89, 0x8d,
+			0xc4, 0x1a, 0x7f, 0x10, 0x97, 0x47, 0xdb, 0xe3,
+			0x6e, 0x98, 0xd4, 0x55, 0x29, 0x56, 0x27, 0xdf,
+			0x80, 0x2f, 0x8a, 0x57, 0x18, 0xe4, 0x8d, 0x47,
+			0x46, 0x75, 0x3b, 0x04, 0xbc, 0x70, 0x7f, 0x47,
+			0x28, 0x34, 0xfa, 0xb7, 0x3d, 0xb8, 0x27, 0x39,
+			0x43, 0x68, 0x1b, 0xaf, 0x03, 0x13, 0xd7, 0xeb,
+			0xa8, 0xb2, 0xa5, 0xc3, 0x4d, 0xff, 0x3b, 0x58,
+			0x5d, 0x1c, 0xaa, 0xbd, 0x44, 0xd9, 0x50, 0x0f,
+			0x19, 0x55, 0x6f, 0xce, 0x2f, 0x86, 0x5f, 0xec,
+			0xdd, 0xbc, 0xb9, 0x4c, 0x7e, 0x70, 0x66, 0xfc,
+			0x3b, 0xe8, 0x17, 0x38, 0x6d, 0x13, 0xc6, 0x3b,
+			0xa3, 0x79, 0x31, 0x59, 0x0c, 0x21, 0xdc, 0x84,
+			0xe7, 0x08, 0xb4, 0xa3, 0x29, 0xb3, 0xe8, 0x1f,
+			0x51, 0x58, 0x5e, 0x35, 0x88, 0xf2, 0xa0, 0xd9,
+			0xb2, 0x6e, 0xd7, 0x19, 0xcb, 0x02, 0xb9, 0xc7,
+			0xc2, 0x68, 0xb4, 0xd0, 0xc0, 0x03, 0x07, 0x7a,
+			0x86, 0xe7, 0x49, 0x0e, 0xd2, 0x15, 0x2b, 0x75,
+			0xa0, 0x58, 0xdb, 0x11, 0x73, 0x13, 0xe7, 0x36,
+			0xb9, 0x1f, 0xe6, 0x62, 0xe4, 0xa4, 0xed, 0x8c,
+			0x4d, 0x69, 0x62, 0x03, 0x1e, 0x38, 0x34, 0x6a,
+			0xe5, 0x37, 0xeb, 0x9a, 0xca, 0x7b, 0xe7, 0x46,
+			0xd3, 0x06, 0x55, 0x5f, 0xca, 0xbf, 0x29, 0x8d,
+			0x2f, 0xa3, 0xeb, 0xa4, 0x56, 0xf2, 0xe9, 0x3c,
+			0x6a, 0x80, 0x64, 0xc1, 0xf9, 0x2d, 0x06, 0xb8,
+			0x9e, 0xab, 0x17, 0xfb, 0x82, 0xc4, 0x21, 0xcc,
+			0xef, 0x26, 0xac, 0x05, 0x99, 0xeb, 0x1e, 0x43,
+			0x5d, 0x09, 0x2b, 0x12, 0xf3, 0x88, 0x6d, 0x24,
+			0xdd, 0xea, 0x00, 0x62, 0x77, 0x92, 0x55, 0xe2,
+			0x2d, 0x61, 0x33, 0x4d, 0x3c, 0x89, 0x22, 0x9c,
+			0x92, 0x2d, 0xff, 0x29, 0xfb, 0x6d, 0x55, 0x20,
+			0x1d, 0xf8, 0x0a, 0xad, 0xff, 0x4c, 0x6a, 0x7c,
+			0x8c, 0x76, 0x44, 0x06, 0x48, 0x65, 0x3c, 0x83,
+			0xec, 0x03, 0x1c, 0xaf, 0x6a, 0xd6, 0x9e, 0x25,
+			0x80, 0x3d, 0x4e, 0x38, 0xc7, 0x2d, 0x80, 0x36,
+			0x9e, 0xd9, 0xf2, 0x6f, 0x86, 0x1a, 0xbd, 0x74,
+			0xf5, 0xee, 0xfe, 0xb4, 0xdd, 0x33, 0x28, 0x38,
+			0x4d, 0x6f, 0xfd, 0x57, 0x1d, 0x32, 0xb5, 0x32,
+			0xe8, 0xb5, 0x27, 0x34, 0x32, 0x38, 0xd0, 0xbc,
+			0x89, 0xfc, 0x11, 0x1d, 0x95, 0xff, 0x74, 0x23,
+			0x8e, 0xaa, 0x40, 0xbb, 0xd0, 0xe5, 0x35, 0x20,
+			0x4f, 0xb1, 0xcd, 0xfb, 0x7b, 0x06, 0xed, 0xa0,
+			0x2b, 0x37, 0xb7, 0x08, 0x78, 0x63, 0xfb, 0xf6,
+			0xa1, 0xe3, 0xc0, 0x74, 0x20, 0xa4, 0x6e, 0xf7,
+			0x39, 0xb4, 0x27, 0xd4, 0xef, 0x5e, 0x99, 0x68,
+			0x30, 0x4b, 0xa6, 0x15, 0x22, 0xad, 0x65, 0xba,
+			0xca, 0x3b, 0x11, 0x9d, 0xb8, 0xeb, 0xe5, 0x4f,
+			0x7e, 0xe8, 0x22, 0x25, 0x26, 0x28, 0xd1, 0x76,
+			0x61, 0x0f, 0x3c, 0x62, 0x31, 0xfb, 0x65, 0x36,
+			0x78, 0x18, 0xc7, 0x47, 0x3f, 0x00, 0x09, 0x4f,
+			0x93, 0xa1, 0x5a, 0xa5, 0x53, 0x9b, 0xf5, 0x43,
+			0x3d, 0x02, 0xf0, 0xc8, 0x0f, 0x54, 0xad, 0xfc,
+			0xfd, 0x19, 0xd4, 0x22, 0xd2, 0x61, 0x34, 0xbc,
+			0x23, 0x55, 0x1d, 0xa5, 0xd6, 0xf7, 0xb9, 0x5d,
+			0x5d, 0x1a, 0xff, 0x0d, 0xca, 0xef, 0xd6, 0xe2,
+			0xe4, 0x86, 0x15, 0xf7, 0x14, 0x15, 0x5c, 0x14,
+			0x30, 0xc3, 0xaa, 0x39, 0xf4, 0x80, 0xc1, 0x3a,
+			0xfe, 0x27, 0xf3, 0xbd, 0x19, 0x98, 0x12, 0xf6,
+			0x23, 0x3a, 0x1c, 0x98, 0xd6, 0xbb, 0xa9, 0x4d,
+			0x5a, 0x3c, 0x9b, 0x53, 0x32, 0x4a, 0x1b, 0xfb,
+			0xdd, 0x7c, 0x5b, 0xb1, 0xd3, 0x89, 0x55, 0x89,
+			0x35, 0x14, 0xb5, 0x71, 0xd4, 0x7b, 0xe9, 0xfe,
+			0x2b, 0xa4, 0x40, 0x0e, 0xee, 0x43, 0x86, 0xc7,
+			0xcc, 0xe4, 0xb5, 0x2d, 0xe5, 0x3a, 0x72, 0xc1,
+			0x95, 0xc9, 0xe1, 0x84, 0x89, 0x4f, 0x1b, 0xe3,
+			0xa6, 0x8e, 0x91, 0x83, 0x10, 0xf9, 0xba, 0x27,
+			0x0e, 0x92, 0xa2, 0xf2, 0x74, 0x64, 0x56, 0x86,
+			0xfa, 0x78, 0x27, 0x71, 0x48, 0x7a, 0x1b, 0x49,
+			0x86, 0x33, 0x23, 0xf9, 0x9a, 0xf3, 0xfb, 0xc1,
+			0x74, 0xcb, 0x06, 0x1b, 0xc6, 0xa8, 0xbe, 0x04,
+			0xb8, 0x20, 0x98, 0x6e, 0x41, 0x5f, 0xa3, 0x36,
+			0xd0, 0x57, 0xf7, 0xa1, 0x28, 0xee, 0x2d, 0xce,
+			0xb7, 0x62, 0x6c, 0x57, 0xe1, 0xfc, 0x69, 0xac,
+			0x0f, 0xb5, 0x25, 0x86, 0x6f, 0x26, 0x91, 0xc5,
+			0xf8, 0xd5, 0x06, 0xb2, 0x67, 0xf9, 0x65, 0x24,
+			0x1f, 0x95, 0x92, 0x7c, 0xac, 0x73, 0x28, 0x86,
+			0x99, 0x29, 0x98, 0x06, 0x75, 0xc0, 0x5b, 0xe9,
+			0x2e, 0x12, 0xc6, 0x55, 0x99, 0x5c, 0x96, 0xa4,
+			0x33, 0x12, 0x79, 0x47, 0x3a, 0xe8, 0x4a, 0x68,
+			0x29, 0xa4, 0xc7, 0x07, 0x04, 0x5f, 0xd4, 0x48,
+			0x92, 0xe1, 0xa3, 0xa2, 0xb8, 0x51, 0xee, 0x75,
+			0xda, 0xa8, 0x42, 0x46, 0x6c, 0xd1, 0xa1, 0x7f,
+			0x78, 0xba, 0x5d, 0x2d, 0xe0, 0x84, 0xa8, 0x98,
+			0xb1, 0xaf, 0xc7, 0xbc, 0xc7, 0x79, 0xaf, 0xbb,
+			0x0c, 0x17, 0xf4, 0x9f, 0xc3, 0x95, 0xbd, 0xc4,
+			0x88, 0xf1, 0x0c, 0xe2, 0xab, 0x8d, 0x0e, 0x66,
+			0xb5, 0x62, 0x75, 0x1b, 0x06, 0xbc, 0x1b, 0x4d,
+			0x01, 0x17, 0xcf, 0xca, 0x3a, 0x1b, 0xfa, 0x2c,
+			0xf0, 0x99, 0xa2, 0x67, 0xe1, 0x78, 0x41, 0xb9,
+			0x80, 0x94, 0x3a, 0x66, 0x00, 0x24, 0xbc, 0xd1,
+			0x45, 0xc2, 0xb8, 0xcb, 0xe1, 0x41, 0x9b, 0x46,
+			0xea, 0x55, 0x95, 0xe8, 0x8a, 0x9d, 0x50, 0x94,
+			0x0a, 0x77, 0x0c, 0x75, 0xfb, 0x1d, 0x58, 0x4e,
+			0xbd, 0x30, 0x16, 0xcc, 0xa8, 0xe9, 0x42, 0xcc,
+			0x31, 0x4c, 0x31, 0x91, 0x59, 0x43, 0x43, 0x1d,
+			0x1e, 0x03, 0xf0, 0x6b, 0xaf, 0x7f, 0xd4, 0xa3,
+			0xb5, 0x51, 0x4e, 0xe3, 0x05, 0x0b, 0xb8, 0xaa,
+			0x58, 0xd0, 0xed, 0xa7, 0xb2, 0x1a, 0x8b, 0x56,
+			0xc0, 0x77, 0xc8, 0xd6, 0x8d, 0xd3, 0x6a, 0x3b,
+			0x6f, 0x1b, 0x96, 0xd3, 0x87, 0xec, 0x02, 0x00,
+			0xe2, 0xd1, 0xcb, 0x03, 0x32, 0xfb, 0x31, 0xfb,
+			0xdf, 0x59, 0x01, 0xc9, 0xf7, 0xd5, 0xa4, 0x2a,
+			0x4d, 0x86, 0xf2, 0x76, 0xba, 0x22, 0xc4, 0xbf,
+			0x17, 0xc6, 0x06, 0xff, 0x0a, 0xa2, 0xa0, 0x3e,
+			0x00, 0x7a, 0xa2, 0x27, 0x5a, 0x71, 0x5d, 0x1c,
+			0x9c, 0xcd, 0xc8, 0xa9, 0x12, 0x5d, 0x9d, 0x61,
+			0x20, 0xfd, 0xcc, 0xf8, 0x70, 0xa7, 0x7f, 0xd0,
+			0x52, 0x54, 0x43, 0xa2, 0xb7, 0x6a, 0x65, 0xde,
+			0x98, 0x00, 0x63, 0x11, 0x35, 0xb0, 0x6d, 0x87,
+			0x73, 0x24, 0x97, 0xad, 0xab, 0x47, 0xc9, 0xb3,
+			0x9d, 0x07, 0xbd, 0x8f, 0x70, 0x82, 0x81, 0x50,
+			0x4e, 0x9a, 0xf8, 0x41, 0xb2, 0xbf, 0x72, 0xe2,
+			0xc7, 0xac, 0xcf, 0x1c, 0xc7, 0x73, 0x40, 0x9d,
+			0x0c, 0x7b, 0x16, 0xf9, 0x53, 0x8e, 0x0c, 0xf4,
+			0xe9, 0xfc, 0x79, 0xd2, 0x24, 0x9c, 0x2a, 0xbb,
+			0xff, 0xf4, 0x94, 0x35, 0x6d, 0x46, 0xa1, 0xfd,
+			0xb4, 0xe8, 0x79, 0xbd, 0xe4, 0x1f, 0xdf, 0x57,
+			0xdf, 0x61, 0x90, 0x11, 0x00, 0x17, 0xea, 0x68,
+			0x20, 0xc6, 0x91, 0x71, 0x23, 0xbf, 0x41, 0xf0,
+			0xc9, 0x15, 0x03, 0xdc, 0x98, 0x56, 0x95, 0xeb,
+			0x73, 0xd8, 0x01, 0xe9, 0xdc, 0x2e, 0x7d, 0x4e,
+			0x06, 0x48, 0x42, 0x3f, 0x05, 0x56, 0x5c, 0xbd,
+			0xb7, 0x6f, 0x99, 0x2c, 0x32, 0x78, 0x3b, 0xd3,
+			0xc8, 0x7b, 0x00, 0x0a, 0x05, 0x7d, 0xe4, 0xb2,
+			0xb2, 0x16, 0xf8, 0x92, 0xb3, 0x6d, 0xf6, 0xb2,
+			0x34, 0xc7, 0x0f, 0x1d, 0xb1, 0xd4, 0xb4, 0x97,
+			0xd4, 0x4d, 0xff, 0x0e, 0xa6, 0x92, 0xc0, 0x2d,
+			0xfe, 0x6b, 0x67, 0xda, 0xde, 0x11, 0xa2, 0xcd,
+			0xb0, 0xb4, 0x52, 0x64, 0xa8, 0xb2, 0xdf, 0x42,
+			0x50, 0x05, 0x30, 0x20, 0xc4, 0xfa, 0x91, 0x36,
+			0x86, 0xbe, 0x54, 0x49, 0x4c, 0x78, 0xfb, 0x46,
+			0x06, 0x7f, 0xad, 0xa3, 0x57, 0x01, 0xa8, 0x7d,
+			0x27, 0x91, 0x30, 0xc8, 0x1c, 0xe4, 0xfe, 0x0b,
+			0x6d, 0x4b, 0xfd, 0x93, 0x19, 0x47, 0x48, 0x2e,
+			0xd5, 0xf5, 0x65, 0x2c, 0xc1, 0x8b, 0xfd, 0x9b,
+			0x13, 0x26, 0xa8, 0x17, 0xc7, 0x5b, 0x8b, 0xe9,
+			0xf7, 0x8b, 0xfc, 0xfd, 0x6c, 0xf2, 0xc8, 0x7e,
+			0xea, 0xb5, 0xc3, 0x7e, 0x3e, 0xef, 0x12, 0x09,
+			0x1c, 0x17, 0xae, 0xfe, 0x38, 0xe1, 0x24, 0x16,
+			0x80, 0x7a, 0xb2, 0x46, 0x23, 0x9a, 0x9e, 0xb0,
+			0x10, 0x1d, 0xe2, 0x4a, 0x37, 0xbb, 0xee, 0x54,
+			0x5a, 0x9e, 0x90, 0x43, 0x9c, 0x96, 0x94, 0x52,
+			0xd1, 0xbc, 0xc8, 0x02, 0x93, 0xb5, 0x1a, 0x9e,
+			0x29, 0x96, 0x71, 0x20, 0x31, 0x55, 0x7a, 0xe8,
+			0x19, 0x22, 0x3a, 0xb5, 0xa0, 0x0b, 0x8b, 0xbd,
+			0x92, 0xfd, 0x20, 0xc7, 0xbc, 0x0f, 0x55, 0xcc,
+			0xeb, 0x4d, 0x19, 0xc8, 0x6d, 0x3a, 0xe6, 0x63,
+			0x2d, 0x43, 0xbf, 0x1b, 0x18, 0x34, 0x01, 0xfb,
+			0x9b, 0x5e, 0xc2, 0xc0, 0xa2, 0x45, 0xbf, 0x4b,
+			0x3b, 0x2a, 0xf5, 0x4c, 0xef, 0x6b, 0x38, 0xd0,
+			0xda, 0xd8, 0xa2, 0x7e, 0xdd, 0x46, 0x29, 0x64,
+			0x78, 0x8f, 0x34, 0x24, 0x28, 0x28, 0x4a, 0x47,
+			0xa0, 0x00, 0x39, 0x2c, 0xa1, 0x35, 0xfa, 0x16,
+			0x9e, 0xf2, 0x0e, 0x0e, 0x1c, 0x92, 0x77, 0x35,
+			0x5e, 0x39, 0x5b, 0x28, 0xbf, 0x39, 0xb6, 0x68,
+			0xd5, 0x9a, 0xbf, 0xac, 0xe1, 0x09, 0x0d, 0xde,
+			0x3d, 0x6c, 0xf2, 0x48, 0xfc, 0xd2, 0x8a, 0x10,
+			0x53, 0xfa, 0x25, 0xc5, 0xae, 0xe0, 0x3e, 0xda,
+			0x02, 0xa5, 0xd3, 0x36, 0x18, 0x33, 0xb4, 0xbd,
+			0x37, 0xe2, 0xd3, 0x78, 0x5d, 0x31, 0xf2, 0x28,
+			0x7e, 0x53, 0x13, 0x51, 0x98, 0x63, 0x13, 0xe8,
+			0x8e, 0x22, 0xf4, 0x0c, 0xc0, 0xdc, 0x6f, 0xa1,
+			0x72, 0xe0, 0xe4, 0xcb, 0xf6, 0xed, 0xca, 0xef,
+			0xf2, 0xa5, 0x05, 0x4e, 0x9a, 0x0f, 0xf5, 0xc0,
+			0xf2, 0xda, 0xb6, 0x08, 0xe6, 0xca, 0x9c, 0xd2,
+			0xd5, 0x9a, 0xa7, 0xd0, 0x7d, 0x67, 0x63, 0x84,
+			0xbd, 0xcb, 0x8f, 0xeb, 0x33, 0x3b, 0x0a, 0x9f,
+			0x52, 0xa5, 0x5c, 0xa4, 0x39, 0x43, 0xbe, 0x98,
+			0x17, 0x8e, 0xdf, 0x94, 0x91, 0xee, 0x52, 0x90,
+			0x7e, 0x8a, 0x0b, 0xfa, 0x84, 0x1d, 0x8e, 0x3d,
+			0x9a, 0x32, 0x36, 0xe1, 0x7d, 0x6e, 0xf6, 0x45,
+			0x7e, 0xcb, 0x55, 0x10, 0x02, 0xe8, 0x8c, 0x6c,
+			0xaf, 0xe7, 0x00, 0x4a, 0xc6, 0xd2, 0x77, 0x77,
+			0x80, 0xb7, 0x12, 0xfa, 0x63, 0xa9, 0xe1, 0xc0,
+			0x80, 0x16, 0x4b, 0xd5, 0xd7, 0x2c, 0xb1, 0xff,
+			0x7a, 0xb0, 0xb3, 0x25, 0x36, 0x72, 0x3e, 0x6e,
+			0xc6, 0x88, 0xb8, 0xc3, 0x8e, 0x3b, 0x87, 0xaa,
+			0x33, 0x0a, 0xaa, 0x00, 0xbf, 0xd6, 0x8b, 0xb2,
+			0x56, 0x0b, 0xef, 0x49, 0xfd, 0x7d, 0x1c, 0x0a,
+			0x21, 0xfc, 0x98, 0x16, 0xe2, 0xbe, 0x12, 0x90,
+			0x99, 0xd0, 0xdc, 0x46, 0xbc, 0xd8, 0xe4, 0x7c,
+			0x60, 0xf8, 0x68, 0xe3, 0xa1, 0x7d, 0x37, 0x21,
+			0x03, 0x90, 0x38, 0x33, 0x3e, 0x3b, 0xfa, 0x98,
+			0xde, 0x94, 0x1a, 0xa7, 0x52, 0x5b, 0xeb, 0x01,
+			0x0b, 0xd8, 0x8f, 0x37, 0x63, 0x45, 0x79, 0xf0,
+			0xca, 0x22, 0xec, 0xc4, 0x01, 0x78, 0xa8, 0xb6,
+			0xf5, 0xc9, 0x0d, 0xb3, 0x89, 0xe8, 0x2e, 0xc3,
+			0xe0, 0x43, 0x62, 0xba, 0x7b, 0x8e, 0xc1, 0xfd,
+			0x82, 0xae, 0x94, 0x4d, 0x6c, 0xef, 0x2b, 0x67,
+			0x5d, 0x12, 0x22, 0x12, 0x10, 0x21, 0x44, 0x40,
+			0xdf, 0x5a, 0x2a, 0x6f, 0xdc, 0x7f, 0xf7, 0xaf,
+			0x2a, 0x49, 0xcf, 0x40, 0x88, 0x17, 0x18, 0x9d,
+			0x9b, 0x1a, 0x06, 0x11, 0x44, 0xa8, 0x53, 0x8a,
+			0x3d, 0x43, 0x25, 0xb3, 0x78, 0xc7, 0x25, 0x1f,
+			0x6a, 0x65, 0xb9, 0x69, 0xbb, 0x50, 0x00, 0xa1,
+			0x1e, 0xbf, 0xcb, 0x6b, 0xdb, 0xf2, 0xa6, 0xa0,
+			0x29, 0x4c, 0xf9, 0x82, 0x20, 0xaa, 0x7b, 0x66,
+			0x99, 0x7e, 0x74, 0x5c, 0xbe, 0xa9, 0x1c, 0xa1,
+			0x50, 0x24, 0x75, 0x51, 0x35, 0x79, 0x2d, 0x9b,
+			0xf5, 0xe1, 0x61, 0xfa, 0xf9, 0x74, 0x4b, 0x14,
+			0x36, 0x1f, 0x76, 0xbe, 0xce, 0xe2, 0xd0, 0x50,
+			0x51, 0xcf, 0x6f, 0x28, 0x8f, 0xaa, 0xd2, 0x31,
+			0x00, 0xa8, 0x64, 0xfe, 0x65, 0xfb, 0x74, 0xd8,
+			0x04, 0x8c, 0xcd, 0x53, 0x76, 0x21, 0x14, 0x19,
+			0x0f, 0x34, 0x3f, 0x96, 0xd1, 0xbc, 0x5d, 0xf2,
+			0x24, 0x51, 0x17, 0x41, 0xc6, 0x68, 0x2b, 0x73,
+			0x81, 0x34, 0x5f, 0x3d, 0x74, 0xde, 0x3d, 0x1c,
+			0x00, 0x91, 0x73, 0xd1, 0x2b, 0x7a, 0x5e, 0x3d,
+			0x80, 0x68, 0xad, 0x6c, 0xf9, 0x34, 0xca, 0xad,
+			0x04, 0x39, 0xa2, 0x7f, 0xd4, 0x78, 0x8a, 0x05,
+			0xbb, 0x45, 0xda, 0x64, 0x02, 0xe4, 0x3e, 0xed,
+			0xd1, 0x0d, 0xf2, 0x2c, 0xb8, 0x36, 0x85, 0xb7,
+			0x1c, 0xee, 0x75, 0xa9, 0xb8, 0xff, 0xac, 0xca,
+			0x46, 0x59, 0x60, 0x38, 0x5f, 0x97, 0x75, 0xa2,
+			0x53, 0xbf, 0xf9, 0x23, 0x22, 0xf3, 0xef, 0x9a,
+			0x7f, 0x95, 0xe6, 0xc5, 0x8f, 0x25, 0x1c, 0xd8,
+			0xe4, 0x98, 0x66, 0xd5, 0x89, 0x62, 0x6d, 0x0f,
+			0xff, 0x83, 0xf1, 0xab, 0x05, 0xa2, 0x5b, 0x27,
+			0x09, 0x35, 0xbd, 0xc4, 0xd5, 0x3f, 0xa5, 0x03,
+			0x63, 0x3b, 0x6d, 0xa4, 0x97, 0x60, 0xaf, 0x32,
+			0x6d, 0x2f, 0x18, 0xe3, 0x04, 0x07, 0x52, 0x6d,
+			0xae, 0x08, 0x17, 0x68, 0x2f, 0x44, 0x83, 0xa2,
+			0x02, 0xca, 0xd7, 0x41, 0x77, 0x28, 0x94, 0x11,
+			0x4e, 0x23, 0x91, 0x78, 0x07, 0x78, 0xf8, 0x0e,
+			0x80, 0xac, 0x8a, 0x20, 0x57, 0xea, 0x03, 0xcb,
+			0xb6, 0x8b, 0xd6, 0x67, 0x07, 0x81, 0x40, 0xaf,
+			0x12, 0xb7, 0x8f, 0x55, 0x50, 0x94, 0xc6, 0xef,
+			0x3e, 0xdb, 0xd2, 0x8f, 0x38, 0x00, 0x8e, 0x0e,
+			0x26, 0xf8, 0x9c, 0xe0, 0x4c, 0x3f, 0x07, 0xcc,
+			0x8c, 0x54, 0xae, 0x5f, 0xfd, 0xd8, 0x9f, 0x0b,
+			0x1e, 0x61, 0x38, 0x1c, 0x40, 0x25, 0xc0, 0x6f,
+			0xab, 0xc7, 0x86, 0xe4, 0xef, 0x25, 0xb4, 0x2b,
+			0x44, 0x5e, 0x71, 0xcb, 0x73, 0xec, 0x1e, 0x97,
+			0x17, 0x15, 0xa9, 0x34, 0x70, 0x62, 0x73, 0x04,
+			0x77, 0xc7, 0x0a, 0x8b, 0x02, 0x07, 0xa3, 0x43,
+			0x33, 0x2e, 0x87, 0x4f, 0xdf, 0x5d, 0x38, 0x14,
+			0xbe, 0x2f, 0xc3, 0x19, 0x66, 0x94, 0xe2, 0x74,
+			0x15, 0x1a, 0xae, 0xa0, 0xd7, 0x88, 0x4f, 0x71,
+			0x2f, 0x67, 0xed, 0xa6, 0xa1, 0x18, 0x64, 0x5a,
+			0x75, 0x11, 0x0b, 0x33, 0xbf, 0x0f, 0xea, 0x4b,
+			0xa9, 0x1b, 0x37, 0x46, 0x04, 0x51, 0xbb, 0x73,
+			0x56, 0x76, 0x8e, 0x5f, 0x2b, 0x54, 0xcb, 0x6d,
+			0xd4, 0x0c, 0xe4, 0x71, 0xfd, 0xe6, 0x75, 0xfd,
+			0xf5, 0x47, 0xaa, 0xb8, 0xc7, 0xfd, 0x29, 0xdd,
+			0xb4, 0x11, 0x84, 0xfe, 0x4e, 0xa5, 0xc4, 0xe3,
+			0x4d, 0x77, 0x32, 0xd8, 0x2f, 0x7e, 0x2d, 0x3e,
+			0x6f, 0xed, 0x97, 0x78, 0x04, 0x2d, 0xec, 0xc0,
+			0x28, 0x7b, 0x6a, 0xf6, 0x26, 0xaa, 0x83, 0xf5,
+			0x58, 0x85, 0xaa, 0x76, 0x27, 0x13, 0x7a, 0xa0,
+			0xf4, 0x27, 0xa0, 0x89, 0x51, 0xc8, 0x87, 0xea,
+			0x2d, 0x4b, 0xf8, 0x4b, 0x60, 0x7c, 0x48, 0xd7,
+			0xc2, 0x5a, 0xb1, 0x31, 0xc2, 0x9c, 0x87, 0x3c,
+			0x5c, 0xe3, 0x95, 0x61, 0x12, 0x64, 0xcc, 0x43,
+			0x7b, 0x07, 0x3f, 0x92, 0xbc, 0xf1, 0x99, 0xff,
+			0x08, 0x55, 0x8a, 0x97, 0x74, 0x6a, 0x19, 0x5c,
+			0x07, 0x7a, 0x84, 0xb8, 0x41, 0x1c, 0x36, 0x4c,
+			0x6b, 0x2a, 0x78, 0xaf, 0x2f, 0x31, 0xef, 0x28,
+			0xa4, 0x4a, 0xed, 0x5d, 0x0a, 0x27, 0xef, 0x1b,
+			0x2f, 0x0a, 0x72, 0x88, 0x1b, 0xa6, 0xe5, 0x29,
+			0x23, 0x82, 0x92, 0x14, 0x86, 0x7c, 0x92, 0xa4,
+			0x85, 0x0b, 0xaa, 0x2d, 0x8b, 0x44, 0x4e, 0xcf,
+			0xe0, 0xed, 0xb8, 0xd9, 0x2e, 0x44, 0xeb, 0x52,
+			0x1e, 0x18, 0xa1, 0x60, 0xc0, 0x23, 0x8f, 0xb3,
+			0x09, 0x32, 0xf3, 0x63, 0x8c, 0x78, 0x50, 0x54,
+			0x40, 0x12, 0x4a, 0x48, 0xd5, 0xd1, 0xb8, 0xfa,
+			0x83, 0x11, 0x23, 0x5b, 0x27, 0x50, 0x60, 0xf2,
+			0x4b, 0xcf, 0x2b, 0x48, 0x21, 0xc5, 0xd8, 0x68,
+			0x82, 0x75, 0x9b, 0x77, 0xe9, 0xa2, 0x22, 0xd5,
+			0xc5, 0xcd, 0x65, 0x58, 0x80, 0x34, 0xd3, 0x4a,
+			0x8b, 0xc5, 0xf2, 0x81, 0xf8, 0xbb, 0xf7, 0x0e,
+			0xb9, 0xd8, 0x00, 0x7a, 0x77, 0xa0, 0x69, 0x93,
+			0x68, 0xce, 0x9b, 0x73, 0x62, 0x0b, 0x6d, 0xd8,
+			0x5f, 0x3f, 0x69, 0x6f, 0xb9, 0x08, 0xc7, 0x6c,
+			0xad, 0xa3, 0x5a, 0x96, 0x86, 0xcc, 0x4e, 0xa0,
+			0xe2, 0xbc, 0x95, 0x27, 0xe5, 0x62, 0x41, 0x00,
+			0xe8, 0x67, 0x03, 0x8b, 0x2a, 0x12, 0x6d, 0x76,
+			0x79, 0x57, 0x05, 0x97, 0x98, 0x4c, 0x3d, 0x23,
+			0x5c, 0xd4, 0xa9, 0xfb, 0x64, 0xe4, 0x0f, 0xc4,
+			0xd2, 0xe3, 0x66, 0xd7, 0xff, 0xcc, 0x13, 0xd6,
+			0x64, 0x59, 0x29, 0x12, 0x2d, 0x5b, 0x38, 0x5f,
+			0x0f, 0x0f, 0x1c, 0x08, 0x0d, 0x3d, 0xc5, 0x5f,
+			0x5a, 0x38, 0x34, 0xfa, 0x48, 0x4e, 0x7c, 0xbb,
+			0x47, 0xfe, 0xe3, 0x5c, 0x2e, 0xb8, 0x3d, 0x52,
+			0x12, 0xba, 0xbe, 0xd4, 0xd1, 0x72, 0x43, 0xc8,
+			0xb9, 0xcd, 0x54, 0xa4, 0x8f, 0xcc, 0x02, 0x7a,
+			0x64, 0x4f, 0x62, 0xef, 0x45, 0x29, 0xa4, 0x00,
+			0xa2, 0x6d, 0x64, 0x2c, 0x47, 0xac, 0xf9, 0x31,
+			0xb6, 0x90, 0xbb, 0xce, 0x09, 0xc9, 0xb8, 0xe2,
+			0xed, 0xfa, 0x42, 0xda, 0xc2, 0x7c, 0xf3, 0x0c,
+			0x7c, 0x34, 0x4e, 0xe6, 0x46, 0xcf, 0x80, 0x24,
+			0x6a, 0x2c, 0x8b, 0x4c, 0xf3, 0x6a, 0x19, 0x6d,
+			0xd8, 0xa9, 0xfd, 0xe7, 0x9c, 0x83, 0x23, 0xdb,
+			0xf3, 0x71, 0xd1, 0x84, 0x76, 0xc1, 0x3c, 0x45,
+			0x62, 0x28, 0x97, 0xee, 0x87, 0xf6, 0x33, 0xa4,
+			0x88, 0x97, 0xb5, 0x36, 0xf4, 0x8b, 0x31, 0x4e,
+			0x66, 0x9e, 0xa9, 0x9c, 0xdc, 0xe3, 0xe2, 0xb8,
+			0x31, 0x42, 0x6d, 0x2f, 0xb9, 0x94, 0x54, 0x1e,
+			0x98, 0x0f, 0x69, 0x7c, 0x41, 0x10, 0xc4, 0x43,
+			0x95, 0x90, 0xa3, 0xa9, 0xf3, 0x40, 0xd0, 0x79,
+			0xa1, 0xf0, 0x9d, 0x0b, 0x19, 0xc1, 0x1e, 0xe4,
+			0x04, 0x90, 0xb7, 0x43, 0x6e, 0xa1, 0x20, 0x74,
+			0x35, 0x8a, 0x7c, 0x3f, 0x4d, 0x7c, 0xa3, 0x37,
+			0x57, 0xe9, 0x5a, 0x95, 0xce, 0xc0, 0x05, 0x87,
+			0x1b, 0x36, 0x76, 0xa6, 0x53, 0x81, 0xcf, 0xc1,
+			0xc8, 0xec, 0x0f, 0x47, 0xa0, 0x46, 0xda, 0xda,
+			0xd3, 0x8b, 0xd1, 0x4d, 0x3f, 0xd6, 0x0f, 0xe6,
+			0x95, 0x66, 0x68, 0xa4, 0x3a, 0xbf, 0xc1, 0x3b,
+			0xf0, 0x04, 0xff, 0xc3, 0xf3, 0x58, 0x0b, 0xf3,
+			0x62, 0x4d, 0x55, 0xef, 0x1e, 0xe2, 0x91, 0xa5,
+			0x98, 0x86, 0xe8, 0xd9, 0x60, 0xf9, 0xfa, 0xac,
+			0x39, 0xf7, 0x34, 0x93, 0x82, 0xef, 0xda, 0x17,
+			0xca, 0xad, 0x5c, 0x2c, 0x7a, 0x04, 0x40, 0xe0,
+			0x53, 0x3e, 0xe7, 0x39, 0x67, 0x83, 0x75, 0xfc,
+			0x5e, 0x72, 0x0f, 0x7e, 0x64, 0x67, 0xd8, 0x64,
+			0x90, 0x27, 0x69, 0x89, 0x0b, 0x39, 0xd2, 0xc3,
+			0x59, 0x13, 0x6d, 0xf5, 0xd8, 0xbd, 0xaa, 0xb2,
+			0x33, 0x56, 0x3e, 0x1c, 0xaf, 0x4e, 0x42, 0x93,
+			0x0e, 0x5b, 0xd6, 0xd9, 0x60, 0x8e, 0xf6, 0x7f,
+			0x4c, 0x91, 0x54, 0x26, 0x77, 0xa7, 0xe6, 0xe9,
+			0x0d, 0x8d, 0x66, 0x3a, 0x26, 0x4f, 0xaa, 0x4d,
+			0x77, 0x14, 0xd1, 0x00, 0x00, 0xbc, 0x2c, 0xaa,
+			0xb6, 0x5f, 0x31, 0xfb, 0xaf, 0xe8, 0x68, 0x68,
+			0x39, 0xbf, 0xaa, 0x0e, 0x68, 0x20, 0x98, 0xdc,
+			0x3c, 0x67, 0x16, 0x89, 0x50, 0x62, 0xa1, 0x45,
+			0x02, 0x5e, 0x4c, 0x10, 0x2b, 0xd7, 0xf0, 0xbb,
+			0x67, 0x42, 0xeb, 0x0a, 0xe9, 0x5a, 0x99, 0xec,
+			0xbf, 0xc4, 0x05, 0x66, 0xe2, 0xde, 0x20, 0x0e,
+			0x96, 0x40, 0xa8, 0xc6, 0xc3, 0x50, 0x81, 0xe8,
+			0x84, 0x66, 0x16, 0x76, 0xc6, 0x19, 0x6e, 0xb1,
+			0x81, 0x15, 0x48, 0xb6, 0x78, 0x97, 0xe3, 0x14,
+			0x90, 0x44, 0x10, 0xa1, 0xc9, 0xf5, 0xe5, 0x7e,
+			0x4a, 0x58, 0x69, 0x9c, 0xb6, 0x0b, 0x35, 0x59,
+			0x81, 0x7c, 0xd5, 0x2e, 0x71, 0x4a, 0xcd, 0xdb,
+			0x36, 0xd4, 0xcb, 0xdd, 0xf4, 0xf4, 0xcd, 0xe1,
+			0x0d, 0x64, 0x6f, 0x01, 0xbe, 0x1f, 0xa1, 0x50,
+			0xbf, 0xec, 0xa2, 0x28, 0x72, 0xd2, 0xf5, 0xbd,
+			0x24, 0xfa, 0x4b, 0x66, 0xe1, 0x00, 0x37, 0xa0,
+			0x4d, 0xb7, 0x7c, 0xa6, 0x42, 0xe8, 0x37, 0x68,
+			0x8a, 0xd1, 0x1f, 0xae, 0x57, 0x36, 0x8f, 0xdd,
+			0xdf, 0x6e, 0xc7, 0xfa, 0xba, 0x92, 0xf3, 0xce,
+			0x5f, 0x9e, 0x12, 0x91, 0x05, 0x38, 0x15, 0x23,
+			0x1c, 0x41, 0x45, 0x42, 0x07, 0x27, 0x0a, 0x65,
+			0x86, 0x78, 0x8a, 0xa6, 0x2d, 0xda, 0xe7, 0xe9,
+			0x81, 0xff, 0x9f, 0x57, 0x5b, 0xa5, 0x71, 0x51,
+			0xe5, 0xc4, 0xfd, 0xd1, 0xb4, 0x7f, 0x64, 0xf3,
+			0x91, 0x3f, 0x55, 0x8e, 0x47, 0x48, 0x27, 0x57,
+			0x9d, 0xfd, 0x54, 0x0e, 0x3a, 0xd3, 0x07, 0x5e,
+			0x16, 0x5f, 0x23, 0x65, 0x88, 0xab, 0xe4, 0xea,
+			0x17, 0x37, 0x25, 0x9e, 0x82, 0x89, 0xfd, 0x5e,
+			0x79, 0xa8, 0xde, 0x4e, 0xbb, 0x2e, 0x5a, 0x44,
+			0x6c, 0x0b, 0x11, 0x87, 0xc1, 0x7a, 0xb1, 0xd4,
+			0xbe, 0x3f, 0x73, 0xef, 0x7d, 0xf2, 0x5f, 0xa8,
+			0x2b, 0x5e, 0x9f, 0x6f, 0xbb, 0xcd, 0xbd, 0x17,
+			0x66, 0xcb, 0x5f, 0xc0, 0x9f, 0x1b, 0x1b, 0x2a,
+			0xee, 0x7f, 0xc8, 0x24, 0xc6, 0x64, 0x99, 0x1e,
+			0x37, 0x20, 0x6a, 0x5e, 0x85, 0x98, 0xff, 0x3c,
+			0xd1, 0x73, 0x59, 0x54, 0x46, 0x49, 0x26, 0xa1,
+			0xf5, 0x50, 0xac, 0x73, 0xb2, 0x35, 0x49, 0x1d,
+			0xe4, 0x55, 0xb3, 0x0f, 0xdd, 0x6a, 0x4f, 0x19,
+			0x28, 0x82, 0x39, 0x24, 0xe7, 0x25, 0x9f, 0xba,
+			0xb4, 0xdc, 0x98, 0x48, 0x61, 0xc0, 0x4c, 0xb8,
+			0xb0, 0x7d, 0xe5, 0xf8, 0xe4, 0xd4, 0x21, 0x4e,
+			0x9f, 0x8e, 0x15, 0x76, 0x9e, 0x99, 0xb1, 0x23,
+			0x0c, 0xb3, 0xbe, 0x92, 0x67, 0x9f, 0x38, 0xd9,
+			0xe1, 0x41, 0x3e, 0x2c, 0x66, 0x62, 0x9b, 0x6a,
+			0xe7, 0x9c, 0x6c, 0x64, 0xb2, 0xdd, 0xe0, 0xa8,
+			0xdb, 0xf2, 0x09, 0x43, 0xd7, 0x61, 0x5a, 0x79,
+			0x51, 0x5e, 0x7e, 0x7f, 0xe8, 0xcd, 0x3c, 0x04,
+			0xc1, 0x0d, 0xda, 0x4b, 0xe6, 0x40, 0xb9, 0x2b,
+			0x62, 0xf8, 0xd4, 0xcb, 0x6b, 0xf8, 0x08, 0x13,
+			0x0a, 0x5c, 0x1b, 0xfc, 0x70, 0xb7, 0xd3, 0x88,
+			0x7c, 0xcf, 0x1b, 0xb6, 0x33, 0x03, 0x3d, 0xc7,
+			0xcf, 0x27, 0xb9, 0x18, 0xb5, 0xc4, 0x8b, 0x1e,
+			0x71, 0x91, 0x91, 0x76, 0xcf, 0x3a, 0xdc, 0xa9,
+			0xe3, 0x37, 0x99, 0xc7, 0xef, 0xfc, 0x0a, 0x6c,
+			0x05, 0xb4, 0xf1, 0x63, 0x12, 0xae, 0xfb, 0x4c,
+			0x92, 0xcc, 0x56, 0xa2, 0xa2, 0x95, 0xad, 0x5d,
+			0x92, 0xdf, 0x90, 0x1e, 0x66, 0xa6, 0x57, 0xbf,
+			0x6b, 0xaa, 0xa4, 0x82, 0xba, 0xf7, 0x31, 0x14,
+			0x0b, 0xdc, 0xbf, 0x88, 0x5e, 0xce, 0x8d, 0x9f,
+			0x94, 0x88, 0x9d, 0x36, 0x11, 0xfe, 0x9c, 0x3f,
+			0x19, 0xd1, 0x80, 0xd0, 0xe6, 0xed, 0x2b, 0xdc,
+			0x4f, 0xe9, 0x40, 0xc8, 0xca, 0x4b, 0x46, 0x89,
+			0x62, 0xd6, 0x89, 0xde, 0x8a, 0x41, 0x9e, 0xf4,
+			0xaf, 0x9f, 0xee, 0xf2, 0x41, 0xd6, 0xc5, 0x87,
+			0x0d, 0xdf, 0xa8, 0xb8, 0xbb, 0x69, 0xd8, 0x73,
+			0x21, 0xdb, 0x75, 0xf2, 0x8d, 0x62, 0x3a, 0x2e,
+			0xc7, 0x8c, 0xd4, 0x5d, 0x06, 0xf6, 0x66, 0xf6,
+			0x83, 0x99, 0x36, 0x64, 0x6b, 0x26, 0x24, 0xf5,
+			0xab, 0x8e, 0x24, 0x02, 0x67, 0x52, 0x4e, 0x53,
+			0xe2, 0x14, 0x33, 0xd9, 0x5a, 0xd6, 0x8e, 0xc6,
+			0x60, 0x80, 0xe0, 0x15, 0xa5, 0xfc, 0x9b, 0x74,
+			0xed, 0xdc, 0x05, 0x90, 0xae, 0x9a, 0x05, 0x75,
+			0xdc, 0xb9, 0xe0, 0x66, 0x88, 0x58, 0xd9, 0xa0,
+			0x4b, 0xb9, 0xfa, 0x0c, 0xc0, 0x65, 0x14, 0x97,
+			0xec, 0x74, 0x0c, 0xb5, 0x42, 0x37, 0x67, 0x94,
+			0x6f, 0xf9, 0xca, 0x1f, 0xa1, 0x77, 0x74, 0x99,
+			0xa0, 0x98, 0x95, 0xcb, 0xa2, 0x13, 0x16, 0x79,
+			0x07, 0xd8, 0x35, 0xcb, 0xba, 0x29, 0x66, 0xe2,
+			0x11, 0xee, 0x9c, 0xa2, 0xe1, 0x4a, 0x74, 0x47,
+			0xa2, 0x7d, 0x79, 0x66, 0xe9, 0x55, 0xcf, 0x63,
+			0xa5, 0x38, 0xf0, 0x8c, 0xff, 0xe0, 0x1e, 0x32,
+			0x9e, 0xf5, 0x2a, 0x89, 0xf0, 0x92, 0x35, 0x94,
+			0x87, 0xe6, 0xf2, 0x94, 0x1d, 0x41, 0x77, 0x32,
+			0x3b, 0xdf, 0xe8, 0xb8, 0xcc, 0x5e, 0x97, 0x37,
+			0xc5, 0x4c, 0xc3, 0xd7, 0x7a, 0xff, 0x3a, 0xb7,
+			0xde, 0xfb, 0x43, 0x12, 0x98, 0x99, 0xdd, 0xe0,
+			0x51, 0x6a, 0x35, 0xcc, 0x33, 0xfa, 0x17, 0xa5,
+			0xf1, 0x10, 0x06, 0x19, 0x4f, 0xd9, 0x80, 0xcc,
+			0x9b, 0xc3, 0xfc, 0x54, 0xcd, 0x67, 0x30, 0xc1,
+			0xb2, 0x8c, 0xe7, 0x54, 0xb7, 0x91, 0x36, 0x4d,
+			0x89, 0xb0, 0x2a, 0x47, 0x59, 0x9c, 0x8e, 0xff,
+			0xbd, 0x8b, 0x99, 0xee, 0xbb, 0xea, 0x47, 0x0d,
+			0x02, 0x4d, 0x71, 0x97, 0x60, 0x9c, 0x28, 0x2d,
+			0x30, 0x23, 0x31, 0x4c, 0x14, 0xde, 0x58, 0xae,
+			0xc6, 0xe6, 0xf5, 0xbc, 0x5f, 0x38, 0x68, 0x1a,
+			0x39, 0x59, 0x5b, 0x82, 0x57, 0x54, 0x43, 0x14,
+			0xb6, 0x5f, 0xe6, 0xe7, 0x83, 0xdc, 0x19, 0x5d,
+			0x69, 0x9f, 0x81, 0x51, 0xde, 0xa9, 0xdb, 0x9d,
+			0x93, 0x3e, 0x9b, 0x58, 0xa8, 0xb1, 0xb5, 0x7e,
+			0x32, 0x64, 0x65, 0xf9, 0x54, 0x36, 0xab, 0x6d,
+			0xdc, 0xaf, 0x73, 0x78, 0xaf, 0x74, 0xc3, 0x01,
+			0xf4, 0x14, 0x54, 0xdd, 0xbd, 0x2b, 0x9e, 0x93,
+			0x52, 0x69, 0xb2, 0x88, 0xb7, 0xa1, 0xaa, 0x58,
+			0xe3, 0xa3, 0x52, 0x0a, 0x51, 0x63, 0x3a, 0xca,
+			0xea, 0x9b, 0x54, 0xc9, 0x84, 0x15, 0x00, 0x5a,
+			0xfa, 0x91, 0xcc, 0xd1, 0xb1, 0x6e, 0x18, 0x0c,
+			0xbe, 0x57, 0xad, 0x2f, 0x29, 0x10, 0x7a, 0x6d,
+			0x72, 0xce, 0x70, 0xf9, 0x07, 0xc2, 0x13, 0x03,
+			0x26, 0xcc, 0xcf, 0x15, 0x84, 0x01, 0x8e, 0x69,
+			0x46, 0xa6, 0x30, 0x7d, 0x37, 0x8e, 0x66, 0x29,
+			0x46, 0x5e, 0x5f, 0x36, 0x2d, 0xcf, 0x3f, 0xbc,
+			0xc8, 0x30, 0x3d, 0x06, 0x44, 0x9c, 0x6a, 0x41,
+			0xa3, 0x20, 0xaa, 0x37, 0x0a, 0xc3, 0x6f, 0xe6,
+			0x73, 0xba, 0xb0, 0xd8, 0x93, 0x3c, 0xe3, 0x1f,
+			0x9a, 0xd9, 0xe2, 0xf8, 0xeb, 0xaf, 0xec, 0xd6,
+			0x08, 0x54, 0x5f, 0x18, 0xde, 0x43, 0xe1, 0x3a,
+			0xc2, 0x5a, 0x3e, 0x0e, 0xe5, 0x3e, 0xf2, 0x7a,
+			0xea, 0xb3, 0x97, 0x2f, 0x66, 0xce, 0x2a, 0x48,
+			0x8d, 0xa8, 0xae, 0x10, 0xbe, 0x17, 0xab, 0x85,
+			0x5a, 0xd3, 0x76, 0x99, 0x1c, 0xf2, 0x2f, 0xea,
+			0xca, 0x93, 0x93, 0xf4, 0x2b, 0x9b, 0x69, 0x00,
+			0x09, 0xb5, 0xe9, 0x28, 0x3a, 0xdb, 0xb1, 0xa8,
+			0x1c, 0xe7, 0xe5, 0xec, 0xb0, 0x7e, 0x36, 0x81,
+			0xe2, 0xe6, 0x7f, 0x1a, 0x46, 0x88, 0xcb, 0x3a,
+			0x15, 0x75, 0x90, 0x0b, 0x29, 0x32, 0xfb, 0x21,
+			0xaa, 0xa2, 0xe3, 0x08, 0xcd, 0x60, 0xbc, 0x3d,
+			0xa4, 0x50, 0xc8, 0x9d, 0x00, 0xf9, 0xff, 0xc4,
+			0x5e, 0xce, 0x14, 0xfc, 0x1f, 0x8d, 0x1d, 0xb0,
+			0x93, 0x92, 0xba, 0xed, 0x34, 0x69, 0x47, 0x1c,
+			0x2f, 0x3c, 0x5b, 0xa3, 0x0a, 0x97, 0x20, 0xfa,
+			0x94, 0xd5, 0xa7, 0x0b, 0x02, 0x95, 0x69, 0x5a,
+			0xcd, 0xda, 0x2f, 0xb2, 0xd6, 0xa3, 0xf3, 0xc7,
+			0xd8, 0xcb, 0x19, 0xe9, 0x5f, 0x53, 0x9f, 0x94,
+			0xe3, 0xb0, 0x1f, 0x6a, 0x10, 0x85, 0xfc, 0x7f,
+			0x4b, 0x14, 0x0a, 0x5f, 0x9f, 0x74, 0xac, 0x00,
+			0x65, 0xc1, 0xd4, 0xff, 0x1c, 0x78, 0xbf, 0x52,
+			0x4e, 0xb0, 0x01, 0x0d, 0x5a, 0xf7, 0x47, 0xaf,
+			0x75, 0xde, 0xad, 0xfe, 0x41, 0x5b, 0x35, 0x18,
+			0xe0, 0xe2, 0x13, 0xb9, 0x35, 0xda, 0xf3, 0x3c,
+			0x5a, 0x32, 0x89, 0x38, 0x89, 0x9a, 0xc2, 0x40,
+			0x03, 0xa3, 0x12, 0x7f, 0xaa, 0x63, 0xe2, 0xb0,
+			0xd6, 0x11, 0xe1, 0x37, 0xeb, 0xaf, 0x91, 0xbd,
+			0x52, 0x23, 0x18, 0x2a, 0x60, 0x58, 0xc0, 0x3a,
+			0x47, 0x54, 0x87, 0x01, 0xe0, 0x13, 0x66, 0x65,
+			0xca, 0x63, 0xd8, 0x27, 0xbd, 0x1b, 0x7f, 0xb5,
+			0x1e, 0x8e, 0x33, 0x1e, 0xbc, 0x04, 0x81, 0xe9,
+			0xa9, 0xba, 0x3a, 0x2f, 0xf8, 0x43, 0x26, 0x79,
+			0x7c, 0x8b, 0xf2, 0xfd, 0xf2, 0x53, 0x3b, 0x25,
+			0xf9, 0x0b, 0x52, 0x94, 0x1c, 0x4a, 0x43, 0x04,
+			0x58, 0xb5, 0xeb, 0xf5, 0x0c, 0x71, 0x7b, 0x19,
+			0x2a, 0x36, 0x1d, 0x01, 0x38, 0x3b, 0x92, 0x8b,
+			0xcc, 0xec, 0x8e, 0xec, 0x45, 0x44, 0x4c, 0xba,
+			0x13, 0x9e, 0xe8, 0xf9, 0x9f, 0xd4, 0x88, 0x41,
+			0xd2, 0x39, 0x07, 0xf6, 0x7c, 0xbd, 0xbd, 0xa5,
+			0x79, 0x5e, 0xdf, 0x78, 0x23, 0x94, 0xfd, 0x83,
+			0x02, 0x07, 0xe8, 0x70, 0x61, 0xad, 0x27, 0xaa,
+			0x33, 0xda, 0x0e, 0xf9, 0xc5, 0xa3, 0x1f, 0x1e,
+			0x3e, 0x99, 0xcb, 0x13, 0x97, 0x3a, 0x75, 0xff,
+			0xa2, 0x40, 0x96, 0xc6, 0xfd, 0x3c, 0x4b, 0x59,
+			0x5d, 0xe3, 0x05, 0x6b, 0x95, 0x04, 0xfe, 0x86,
+			0x36, 0x8f, 0x43, 0x6e, 0xfa, 0xc0, 0x8a, 0xf5,
+			0x55, 0x58, 0x36, 0xbb, 0x08, 0xbd, 0xcc, 0x8c,
+			0xca, 0xa0, 0xcf, 0xfd, 0x4e, 0x6d, 0x88, 0x54,
+			0xa2, 0xf9, 0x8e, 0xd9, 0x18, 0x74, 0x31, 0x25,
+			0x09, 0x60, 0xe0, 0x79, 0xce, 0xbe, 0xe1, 0x9d,
+			0xcd, 0xc0, 0x81, 0x9e, 0xa4, 0xe4, 0xed, 0x1a,
+			0x2d, 0x65, 0x5c, 0x6e, 0xbc, 0x21, 0xb5, 0x12,
+			0xd5, 0xf8, 0x3e, 0x9f, 0x8e, 0x54, 0x7b, 0x8f,
+			0x6c, 0x6d, 0x88, 0xa9, 0x21, 0x06, 0x5e, 0xe8,
+			0x37, 0xcd, 0x30, 0x4c, 0xe4, 0xc9, 0x30, 0x4c,
+			0x50, 0x63, 0x25, 0x1b, 0xed, 0x97, 0x9f, 0x59,
+			0x45, 0x6a, 0x4e, 0x35, 0x9e, 0x3f, 0x41, 0xa8,
+			0x92, 0x9c, 0x25, 0x07, 0xb6, 0x56, 0xcf, 0x8f,
+			0x0d, 0x94, 0x02, 0xda, 0xa1, 0x2f, 0x25, 0x90,
+			0x17, 0x38, 0x7a, 0xfb, 0x38, 0xe5, 0x17, 0x20,
+			0xc0, 0xee, 0x94, 0xc4, 0xc5, 0x96, 0x27, 0x2b,
+			0xc7, 0x7c, 0xe3, 0xe5, 0xfb, 0xc0, 0x88, 0xd2,
+			0x52, 0xf7, 0xd0, 0x3b, 0xfb, 0xa1, 0xba, 0xab,
+			0xcc, 0xe8, 0x8b, 0x16, 0xa2, 0x49, 0x51, 0x71,
+			0xeb, 0x50, 0xed, 0xe2, 0x3d, 0x3e, 0x08, 0xee,
+			0x4a, 0xa3, 0x2f, 0xfa, 0x93, 0x8c, 0xc7, 0x42,
+			0xdf, 0xde, 0xc0, 0x23, 0xb7, 0x12, 0x0e, 0xac,
+			0xc7, 0xf1, 0x34, 0x76, 0x97, 0x48, 0xb5, 0xce,
+			0x09, 0x2a, 0x7d, 0x88, 0xf0, 0xd8, 0x20, 0x12,
+			0xfb, 0xd9, 0xcf, 0x45, 0x8c, 0xa0, 0xc3, 0x97,
+			0xd2, 0x31, 0xbc, 0xad, 0x05, 0xd8, 0x50, 0xd3,
+			0x2d, 0x5f, 0xe3, 0x06, 0x40, 0x51, 0x0c, 0x61,
+			0x84, 0xb5, 0xdb, 0x3b, 0xfb, 0x24, 0x8d, 0x99,
+			0xaf, 0x31, 0xe9, 0x62, 0x3f, 0x38, 0xae, 0xac,
+			0x80, 0x68, 0xba, 0x0b, 0x97, 0x45, 0x60, 0x5a,
+			0xb4, 0x05, 0x95, 0x66, 0x89, 0x49, 0xd3, 0x04,
+			0xf5, 0x67, 0xee, 0x4d, 0x33, 0x80, 0xfa, 0xb3,
+			0x2c, 0x5e, 0x71, 0xc2, 0x74, 0xdf, 0x56, 0x21,
+			0x00, 0xfe, 0xdb, 0x01, 0xf9, 0x24, 0xbb, 0x2d,
+			0x43, 0x15, 0x69, 0xa5, 0x10, 0x2f, 0xb7, 0x1a,
+			0x5e, 0xe0, 0x47, 0x51, 0x83, 0xb3, 0x45, 0x00,
+			0xe9, 0x3f, 0x94, 0xa6, 0x76, 0x63, 0x93, 0x7e,
+			0x92, 0x07, 0xd8, 0xaf, 0xf4, 0x72, 0x73, 0xab,
+			0xe1, 0x85, 0x34, 0x85, 0xc6, 0x02, 0xdc, 0x79,
+			0xb1, 0x38, 0x31, 0x66, 0xa4, 0xda, 0x6e, 0x0b,
+			0xe4, 0x34, 0x2f, 0xb1, 0x71, 0x2b, 0x56, 0x17,
+			0x67, 0x82, 0xed, 0x04, 0x04, 0x51, 0x7b, 0xd2,
+			0xe8, 0x0c, 0xef, 0x0a, 0x50, 0x7a, 0xcf, 0xee,
+			0x54, 0x48, 0xb0, 0x78, 0x56, 0x9a, 0x08, 0x05,
+			0x4c, 0xe1, 0x52, 0xbc, 0x8a, 0x0c, 0x7e, 0x3c,
+			0xb2, 0x55, 0x01, 0xfd, 0xc6, 0xd9, 0x21, 0x1a,
+			0x6f, 0x57, 0xa8, 0xa7, 0x41, 0x5f, 0x46, 0xc8,
+			0xc4, 0x43, 0xca, 0xae, 0x3f, 0x29, 0xa3, 0x6e,
+			0x47, 0x09, 0xdd, 0x09, 0x38, 0xca, 0x31, 0xe3,
+			0x81, 0x5f, 0x48, 0xf9, 0x33, 0xb8, 0x74, 0x18,
+			0xd4, 0x30, 0x86, 0x93, 0x41, 0x08, 0xbf, 0x11,
+			0x6c, 0x15, 0xb1, 0xba, 0xb4, 0x1b, 0x9c, 0xcf,
+			0x89, 0x21, 0xec, 0x0a, 0x9f, 0xaf, 0x39, 0x35,
+			0x1c, 0x13, 0x60, 0x15, 0x1f, 0x14, 0x7e, 0x62,
+			0xfc, 0xd4, 0x45, 0x78, 0xab, 0x0a, 0x2b, 0x56,
+			0x29, 0x86, 0xaa, 0x58, 0xa1, 0x95, 0xd4, 0x57,
+			0x6d, 0x98, 0x64, 0x5d, 0xed, 0x9d, 0xf5, 0xee,
+			0xef, 0x24, 0x88, 0x02, 0xaf, 0x41, 0x86, 0x30,
+			0x80, 0x8a, 0x13, 0xaf, 0xd1, 0xaa, 0xc0, 0x6d,
+			0x2b, 0x7c, 0x49, 0x43, 0xd2, 0xd5, 0x89, 0x54,
+			0x25, 0x68, 0xe7, 0x52, 0xda, 0x06, 0x98, 0x46,
+			0xde, 0xfb, 0xf9, 0xae, 0xe2, 0x14, 0x46, 0x6a,
+			0x0e, 0x83, 0x80, 0xae, 0xed, 0xe9, 0x56, 0x57,
+			0x22, 0xda, 0x92, 0xcb, 0xa8, 0x9b, 0xf8, 0x31,
+			0xfb, 0xdd, 0x9e, 0x2e, 0x3f, 0x59, 0xa8, 0xbf,
+			0x79, 0xba, 0x8e, 0x5f, 0x5b, 0xce, 0x23, 0xa6,
+			0x8f, 0xc5, 0xad, 0x23, 0x9c, 0x93, 0x30, 0xb0,
+			0xa3, 0x8a, 0x5e, 0xcd, 0x1e, 0xf8, 0x21, 0x96,
+			0x01, 0xef, 0x14, 0xe2, 0x25, 0x17, 0x98, 0x7a,
+			0x48, 0x85, 0xce, 0xd3, 0x8f, 0xa2, 0x13, 0x6c,
+			0x03, 0x17, 0x90, 0x17, 0x48, 0x65, 0x88, 0xeb,
+			0xc1, 0x2d, 0x8f, 0x0a, 0x68, 0x2c, 0x58, 0x23,
+			0x18, 0x55, 0xb2, 0x7d, 0xc9, 0x79, 0xf4, 0x62,
+			0x8b, 0xf5, 0xf5, 0x62, 0x7b, 0x95, 0x1a, 0x1f,
+			0x6e, 0x5e, 0x08, 0x32, 0x4d, 0x83, 0xa3, 0x3c,
+			0x9b, 0x4f, 0x3a, 0xef, 0x57, 0xe3, 0x43, 0x14,
+			0xfe, 0x42, 0x6c, 0x22, 0xed, 0x8b, 0x94, 0xf4,
+			0xeb, 0x4a, 0xc6, 0xd0, 0xd0, 0x13, 0xe1, 0xbf,
+			0xc7, 0xb4, 0x10, 0x5e, 0xe4, 0xdd, 0x82, 0xd5,
+			0x5e, 0x6a, 0x06, 0xcd, 0x66, 0x7e, 0xc5, 0xb6,
+			0xfb, 0x62, 0xdf, 0x4e, 0xc4, 0x65, 0x25, 0x40,
+			0x78, 0x17, 0xce, 0xb7, 0x91, 0xb4, 0x20, 0xfe,
+			0xa0, 0x51, 0x17, 0xfd, 0x07, 0xf7, 0x46, 0xb7,
+			0x1e, 0x46, 0xca, 0x1a, 0x6a, 0x14, 0x03, 0x49,
+			0xcf, 0x90, 0xda, 0xef, 0xf7, 0xcb, 0x1f, 0x08,
+			0xd1, 0x7c, 0xd9, 0xca, 0x0c, 0x1d, 0x39, 0x16,
+			0x89, 0xc3, 0x92, 0x88, 0xe3, 0x36, 0x13, 0x78,
+			0xb1, 0xed, 0x9f, 0xe3, 0x1e, 0x47, 0x68, 0xeb,
+			0x9e, 0xad, 0xe9, 0xec, 0xd7, 0xc2, 0xc1, 0xa8,
+			0x1b, 0x3f, 0xd8, 0xb7, 0x1d, 0x74, 0x22, 0xbf,
+			0xd8, 0xb7, 0xae, 0x2d, 0x35, 0x85, 0x59, 0xe5,
+			0xa7, 0xc4, 0x42, 0x46, 0xce, 0x57, 0xa3, 0xeb,
+			0xc9, 0x82, 0x18, 0x14, 0x0f, 0xf6, 0x25, 0x44,
+			0xfd, 0x5e, 0x40, 0xd5, 0x72, 0x9b, 0x10, 0x69,
+			0x53, 0x9a, 0x28, 0x95, 0x07, 0x47, 0xbf, 0x68,
+			0xbe, 0xc7, 0xaa, 0x44, 0x01, 0xd5, 0x51, 0x8a,
+			0xbc, 0x1d, 0xd8, 0x70, 0xe8, 0x8d, 0x54, 0xae,
+			0xae, 0x36, 0xcf, 0xd9, 0x66, 0x56, 0x26, 0xbe,
+			0x11, 0xa1, 0x50, 0x0f, 0x62, 0x5d, 0xc3, 0xc9,
+			0xde, 0xe5, 0xc7, 0xd0, 0xcf, 0x33, 0xff, 0x18,
+			0xa9, 0xad, 0x2e, 0x2e, 0x20, 0x30, 0x3e, 0x8c,
+			0x90, 0x58, 0x86, 0x16, 0xfd, 0x7c, 0x4d, 0x3d,
+			0xdf, 0x00, 0x86, 0xe4, 0x62, 0x4e, 0x88, 0x62,
+			0x30, 0x84, 0x80, 0x41, 0xbb, 0x6e, 0xfd, 0xdc,
+			0x86, 0x0f, 0xe9, 0xaf, 0x3e, 0x4e, 0xc2, 0xc1,
+			0xb1, 0x9f, 0xa5, 0x1f, 0xb6, 0x40, 0xaf, 0x8b,
+			0x6c, 0xd0, 0x18, 0xc6, 0xdf, 0x37, 0xce, 0xb1,
+			0xed, 0xea, 0x4d, 0x3c, 0xef, 0x60, 0x98, 0x98,
+			0x62, 0x7a, 0x3e, 0x31, 0x62, 0x86, 0x1a, 0x56,
+			0xd3, 0xb3, 0x51, 0x2d, 0xe8, 0xe1, 0x24, 0x1f,
+			0x54, 0x6e, 0xb8, 0xd2, 0x9b, 0x6d, 0x8c, 0x06,
+			0xfe, 0x88, 0xa0, 0xc1, 0xec, 0x1b, 0x0f, 0xf2,
+			0x11, 0x6f, 0xf2, 0x2f, 0xbd, 0x75, 0xba, 0x99,
+			0x63, 0x40, 0xc0, 0x68, 0x1f, 0x92, 0x64, 0x77,
+			0xfb, 0xa5, 0xdc, 0x66, 0x11, 0xed, 0xc7, 0x77,
+			0x58, 0x51, 0x2a, 0xb3, 0x1f, 0x52, 0xe5, 0x51,
+			0xbb, 0x98, 0xfb, 0x04, 0x98, 0x2c, 0x46, 0x9f,
+			0xb1, 0x8e, 0x4b, 0x60, 0x70, 0xf6, 0x1a, 0x6e,
+			0xc7, 0xaf, 0x8b, 0x5c, 0x03, 0x42, 0x3d, 0x2b,
+			0x6b, 0xdb, 0x73, 0xc1, 0x38, 0xa6, 0xfc, 0xc8,
+			0xa2, 0x1d, 0x5e, 0xcb, 0xb9, 0x6a, 0xe6, 0x85,
+			0x88, 0x12, 0xd4, 0xa4, 0xd9, 0x51, 0x22, 0x3f,
+			0x7d, 0x81, 0x32, 0x31, 0x34, 0x6e, 0xd7, 0x2f,
+			0x3e, 0x3b, 0x08, 0x93, 0x63, 0x28, 0x79, 0x0d,
+			0xc8, 0x86, 0x68, 0x0d, 0xa7, 0x1d, 0x39, 0x91,
+			0x14, 0x55, 0xc2, 0xe4, 0xf3, 0x5e, 0xae, 0xaf,
+			0x9b, 0x58, 0x66, 0x45, 0x48, 0x61, 0xbc, 0xa5,
+			0x05, 0x3d, 0x42, 0x65, 0x18, 0x8a, 0xa3, 0x93,
+			0x3a, 0xd2, 0xad, 0x4c, 0x15, 0x5a, 0x38, 0xe3,
+			0xa4, 0xd0, 0xa2, 0x22, 0x9d, 0xc8, 0xc4, 0xe5,
+			0x2b, 0xc1, 0x10, 0xb5, 0x31, 0x98, 0x7f, 0x16,
+			0x1b, 0xbb, 0x04, 0x23, 0xfd, 0xb5, 0x7b, 0x83,
+			0x23, 0xe3, 0x7a, 0x4f, 0x33, 0x5e, 0xe2, 0xdc,
+			0x06, 0xfe, 0x26, 0x42, 0x10, 0x12, 0x54, 0x8f,
+			0xe8, 0x09, 0xbc, 0x6e, 0x9a, 0xbe, 0x2b, 0x55,
+			0x12, 0x34, 0x7e, 0x98, 0x63, 0x86, 0x18, 0x70,
+			0x6c, 0x65, 0xbd, 0x49, 0x48, 0x81, 0x98, 0xe7,
+			0x6e, 0x80, 0xc7, 0x51, 0x91, 0xb1, 0x9d, 0xe0,
+			0x33, 0x00, 0x34, 0xd9, 0xfc, 0x97, 0x22, 0xff,
+			0x02, 0x03, 0xb1, 0x93, 0x27, 0xea, 0xdf, 0x1a,
+			0x48, 0x5c, 0x82, 0xc2, 0xee, 0x40, 0x48, 0xf1,
+			0x8a, 0x63, 0x94, 0xae, 0x67, 0x44, 0x41, 0x03,
+			0x4f, 0x68, 0xe3, 0x4c, 0x6a, 0xf7, 0x4a, 0xdc,
+			0xe7, 0x49, 0xb4, 0xf0, 0xa7, 0x4b, 0x2a, 0x78,
+			0x89, 0xdb, 0x5c, 0xf4, 0x9d, 0xd4, 0x08, 0x98,
+			0x78, 0x4f, 0x26, 0x58, 0x3e, 0x9a, 0xc0, 0xad,
+			0x38, 0x77, 0x70, 0x91, 0xdf, 0x44, 0x84, 0x6c,
+			0x8a, 0x6e, 0x4b, 0xd4, 0xa3, 0x90, 0xa0, 0x39,
+			0x22, 0xdd, 0x87, 0x19, 0x0f, 0x93, 0x7e, 0xd4,
+			0x75, 0x64, 0x53, 0x39, 0xf4, 0x6a, 0xbd, 0xa5,
+			0xe6, 0xa9, 0xd6, 0x13, 0x13, 0x26, 0xfe, 0x54,
+			0x67, 0x8c, 0x35, 0xc8, 0x44, 0xbf, 0x29, 0x03,
+			0x9c, 0xbd, 0x29, 0x6a, 0xa8, 0x11, 0x7d, 0x17,
+			0x2a, 0xf0, 0x5e, 0xd5, 0xcf, 0xb6, 0x56, 0xf8,
+			0xcb, 0xe3, 0x40, 0x33, 0xd0, 0x6e, 0x66, 0x44,
+			0xfb, 0x14, 0x7d, 0xd6, 0xd0, 0x5e, 0x7d, 0x03,
+			0x10, 0x92, 0x3b, 0x33, 0xd4, 0x66, 0xd1, 0x07,
+			0x1d, 0x82, 0xf0, 0x3f, 0x31, 0xff, 0x09, 0x22,
+			0x04, 0xc9, 0x40, 0x7b, 0xa3, 0xe4, 0xfe, 0xda,
+			0x98, 0xc7, 0xbc, 0x16, 0x0e, 0xa3, 0x2e, 0x61,
+			0x60, 0x70, 0x49, 0xfc, 0x38, 0xb5, 0xa7, 0xa1,
+			0xff, 0xfc, 0x5f, 0x05, 0x47, 0xd5, 0xdc, 0xa8,
+			0xfd, 0x41, 0xcb, 0xa5, 0xc7, 0x42, 0x45, 0xcf,
+			0xfc, 0x5f, 0xd7, 0x9c, 0x26, 0xae, 0x0f, 0x91,
+			0xef, 0x14, 0x2e, 0x59, 0x48, 0xb1, 0x98, 0x02,
+			0xe7, 0xa2, 0xeb, 0xc1, 0x6e, 0xc7, 0xcd, 0x0c,
+			0x8d, 0x60, 0xac, 0x44, 0x3e, 0x70, 0x7f, 0x51,
+			0x60, 0x46, 0xef, 0xe7, 0x22, 0xb7, 0x2b, 0xee,
+			0xa1, 0x7e, 0x10, 0xaa, 0x17, 0xaa, 0x54, 0x3c,
+			0x81, 0xf8, 0xc7, 0x61, 0x91, 0xf5, 0xdb, 0x4f,
+			0x0d, 0x3b, 0x2d, 0x05, 0x71, 0xce, 0xa5, 0xc2,
+			0x2a, 0x39, 0xb6, 0x82, 0xa0, 0x82, 0xf7, 0xcb,
+			0x17, 0x5f, 0x51, 0x0c, 0x0d, 0x6b, 0x2a, 0xcd,
+			0x78, 0x59, 0x36, 0x67, 0x5c, 0xc9, 0xe8, 0x60,
+			0xe7, 0x3f, 0x3e, 0xbf, 0x17, 0xff, 0xcf, 0x5a,
+			0x89, 0x8f, 0x32, 0x60, 0x18, 0xfe, 0x85, 0xba,
+			0x89, 0xd1, 0x1a, 0x73, 0x4a, 0x07, 0xf1, 0x91,
+			0x01, 0x3b, 0x21, 0x54, 0x39, 0xd8, 0x06, 0xc9,
+			0x79, 0xd6, 0x16, 0xe2, 0x68, 0xbb, 0x9c, 0x9a,
+			0xc0, 0xf5, 0x15, 0x2a, 0x5d, 0xff, 0xc7, 0xd6,
+			0x47, 0x19, 0x73, 0x52, 0x1b, 0xca, 0xe2, 0xa6,
+			0x0c, 0x87, 0x0b, 0xc0, 0xa8, 0x62, 0xfd, 0x2b,
+			0x95, 0x69, 0x80, 0x72, 0xaf, 0xf3, 0x96, 0x7e,
+			0xe0, 0xb4, 0xb7, 0x6b, 0x89, 0xdd, 0x92, 0x26,
+			0x71, 0x69, 0xc9, 0x76, 0x2a, 0x4d, 0x81, 0x6c,
+			0xfd, 0x6c, 0x56, 0xbd, 0xdf, 0x36, 0x94, 0x22,
+			0x22, 0x8f, 0xbf, 0x58, 0x06, 0xf9, 0x16, 0xe4,
+			0xc1, 0x70, 0x00, 0x3e, 0x9f, 0x0f, 0xbe, 0x25,
+			0xd5, 0x34, 0xd0, 0x93, 0x8c, 0x48, 0x82, 0x87,
+			0x61, 0x31, 0x10, 0xf9, 0xc9, 0xb7, 0x4c, 0xca,
+			0xeb, 0xda, 0x66, 0x4f, 0x5f, 0x10, 0x7d, 0x26,
+			0xc7, 0xac, 0xec, 0x70, 0x5c, 0x0d, 0xdf, 0x89,
+			0x60, 0x4b, 0x2d, 0x4e, 0x32, 0x0f, 0x34, 0x14,
+			0xc2, 0xa2, 0x6a, 0x85, 0xd1, 0x71, 0xae, 0xf2,
+			0x38, 0xaa, 0x60, 0xc2, 0x96, 0xf1, 0x88, 0xa4,
+			0xa0, 0x13, 0x8f, 0xbe, 0xaf, 0x85, 0xf0, 0x5b,
+			0x4a, 0x0d, 0xed, 0x9f, 0x22, 0x85, 0xd2, 0x3e,
+			0x5f, 0xf2, 0xfb, 0x22, 0x81, 0x16, 0x02, 0x37,
+			0xfe, 0xe8, 0x28, 0x3c, 0xc9, 0xba, 0x1d, 0xd9,
+			0x11, 0x41, 0x58, 0x7e, 0xe9, 0x75, 0xe0, 0x05,
+			0x73, 0x60, 0x5c, 0x8d, 0xe7, 0x96, 0x37, 0x01,
+			0xe2, 0xca, 0xd8, 0x86, 0x13, 0xe2, 0x36, 0x2a,
+			0xe0, 0xfc, 0x31, 0x56, 0x9c, 0x17, 0x1d, 0x5b,
+			0x3e, 0xf6, 0x28, 0x58, 0xd0, 0x74, 0x8c, 0x20,
+			0x41, 0xb8, 0xa6, 0xdb, 0x7e, 0x63, 0xf9, 0x13,
+			0x14, 0xf9, 0x07, 0x6c, 0x17, 0xc5, 0x7e, 0x1d,
+			0x70, 0x7c, 0x12, 0xc7, 0x62, 0xa1, 0x9a, 0x66,
+			0xa0, 0x03, 0x41, 0x86, 0x0e, 0x99, 0x36, 0x6d,
+			0x3d, 0x8c, 0x68, 0x78, 0x81, 0xb9, 0x40, 0x9b,
+			0xdb, 0xf1, 0xb9, 0xe6, 0xb2, 0x85, 0x8b, 0xe1,
+			0x91, 0x47, 0x9b, 0x2d, 0xe4, 0xab, 0x56, 0x65,
+			0xc0, 0x8c, 0x9c, 0x46, 0x87, 0x24, 0xf4, 0x7b,
+			0x14, 0xdf, 0xae, 0x09, 0x36, 0x49, 0x4b, 0x6a,
+			0xe1, 0xe2, 0x85, 0x4f, 0xc3, 0x56, 0xf5, 0xa9,
+			0x34, 0x77, 0x88, 0x02, 0x3e, 0x4a, 0x57, 0x0b,
+			0x8d, 0x6d, 0x85, 0x6b, 0x33, 0x1c, 0x66, 0x73,
+			0x95, 0x5a, 0x5e, 0xc9, 0xc9, 0x66, 0x34, 0x46,
+			0x17, 0xd8, 0x9d, 0x86, 0xc3, 0xba, 0x8d, 0x61,
+			0x5b, 0xfc, 0xef, 0xd9, 0xe9, 0x0b, 0x22, 0x78,
+			0x1a, 0xed, 0x97, 0x51, 0x52, 0x55, 0x09, 0x0e,
+			0xda, 0xde, 0xeb, 0x31, 0xe1, 0x4e, 0x07, 0x37,
+			0x9e, 0x1e, 0xe1, 0x69, 0xcc, 0xb2, 0xba, 0x34,
+			0x28, 0x97, 0x4b, 0x71, 0x95, 0xd4, 0x7d, 0x44,
+			0xa8, 0x8b, 0xea, 0x64, 0x2e, 0x42, 0x6d, 0x74,
+			0x55, 0x5e, 0x4b, 0x52, 0x9d, 0x61, 0x1c, 0x92,
+			0x61, 0xf5, 0xba, 0x6c, 0x6a, 0x18, 0xc2, 0x3c,
+			0x8f, 0x12, 0x9d, 0xc1, 0xab, 0xad, 0xec, 0x7f,
+			0x26, 0xe0, 0xe4, 0x34, 0xf0, 0xf0, 0x5c, 0xa0,
+			0xbc, 0x5a, 0x6c, 0x57, 0x5d, 0x5d, 0x67, 0x06,
+			0xdd, 0x48, 0xcf, 0x63, 0x63, 0xd2, 0xb2, 0xe6,
+			0x79, 0x62, 0x21, 0x4b, 0xc2, 0xc4, 0x2d, 0xcb,
+			0x34, 0xfd, 0xed, 0xe9, 0x15, 0x83, 0x3b, 0xc2,
+			0xcb, 0xdb, 0xc6, 0xc1, 0x9c, 0x78, 0x4c, 0x8d,
+			0x0c, 0xb8, 0xb4, 0x70, 0xc2, 0x2b, 0xd0, 0x07,
+			0x16, 0xff, 0xb2, 0x2b, 0xdb, 0xca, 0xb9, 0x99,
+			0xf9, 0xf1, 0x84, 0x2c, 0xc7, 0xba, 0xbc, 0x47,
+			0x42, 0xe4, 0x1d, 0x0d, 0x0a, 0x76, 0x40, 0x30,
+			0x05, 0x77, 0x32, 0x49, 0xc9, 0xb0, 0xef, 0xfc,
+			0x65, 0x3e, 0xef, 0x42, 0xe2, 0xac, 0x5d, 0xfe,
+			0xae, 0x08, 0xe9, 0xc3, 0x0e, 0xbc, 0x51, 0xce,
+			0xa5, 0x62, 0x27, 0xcf, 0x7e, 0xff, 0xd7, 0x05,
+			0xff, 0xc3, 0xfe, 0xa3, 0xb8, 0xa6, 0x33, 0x3f,
+			0xe9, 0x52, 0x9a, 0xfa, 0x4e, 0x4e, 0x25, 0x33,
+			0x9e, 0x7f, 0x34, 0x57, 0xf2, 0x8e, 0xcc, 0x88,
+			0x63, 0x5d, 0x2f, 0x44, 0x00, 0x9f, 0x88, 0x5d,
+			0x6f, 0x07, 0x01, 0xfe, 0xc7, 0x55, 0x84, 0x85,
+			0xd9, 0x1d, 0x91, 0xcc, 0x50, 0x43, 0xac, 0x42,
+			0x6b, 0x94, 0x8d, 0x7b, 0xdb, 0x6f, 0x77, 0xab,
+			0xbf, 0x9f, 0xa3, 0x07, 0xb7, 0xa3, 0x8a, 0x94,
+			0xd7, 0xc5, 0x6b, 0x07, 0xa2, 0xdd, 0x9a, 0xed,
+			0x0f, 0xab, 0xc0, 0x03, 0xfd, 0x49, 0x32, 0xbc,
+			0x5d, 0x2c, 0xe7, 0x6a, 0xb8, 0x32, 0x19, 0x04,
+			0xdb, 0x30, 0x2b, 0x04, 0xf7, 0xf1, 0x54, 0xf5,
+			0x50, 0xe6, 0x7d, 0x4c, 0xe7, 0x57, 0x80, 0x79,
+			0xfc, 0xcf, 0x75, 0xa6, 0xfa, 0xf1, 0x0e, 0x35,
+			0xc0, 0x91, 0xd0, 0xb5, 0xfa, 0xa1, 0x49, 0x65,
+			0x8e, 0x35, 0x0d, 0xa7, 0x39, 0xbf, 0xc7, 0x30,
+			0x18, 0xfc, 0x81, 0x6b, 0x93, 0xe1, 0x76, 0xda,
+			0xa2, 0x49, 0x06, 0x86, 0x3b, 0xc7, 0xce, 0x2a,
+			0xd2, 0x9b, 0xce, 0x79, 0x1c, 0x50, 0x07, 0x3c,
+			0xb8, 0x70, 0x74, 0x67, 0xc9, 0x82, 0x6a, 0xd9,
+			0x20, 0x64, 0x19, 0x99, 0xb9, 0x47, 0x73, 0x4f,
+			0x44, 0xd7, 0x3c, 0xe4, 0xfa, 0xda, 0x0d, 0x8a,
+			0x6f, 0x8b, 0x83, 0xab, 0x17, 0x2e, 0xea, 0xca,
+			0xa6, 0xef, 0x8c, 0x36, 0x85, 0xf1, 0x47, 0x2d,
+			0xd4, 0x5f, 0x35, 0x58, 0xa7, 0x32, 0xb9, 0x71,
+			0x7c, 0x5a, 0xeb, 0xbb, 0xcf, 0x88, 0xaf, 0x84,
+			0x60, 0x21, 0x57, 0xe6, 0x1a, 0x8a, 0x8e, 0xe3,
+			0x00, 0x29, 0xa1, 0x5e, 0x4c, 0x43, 0x4e, 0x4d,
+			0xb5, 0x05, 0x46, 0x42, 0x53, 0x46, 0x4c, 0x9b,
+			0xca, 0x48, 0x62, 0xfa, 0x69, 0xcd, 0x7a, 0xdf,
+			0x16, 0x13, 0x06, 0x3b, 0x8f, 0x36, 0xbf, 0x9e,
+			0x16, 0xec, 0x74, 0xe3, 0x2f, 0x3c, 0x4c, 0x46,
+			0xb5, 0x0b, 0x9f, 0x85, 0x4a, 0xe9, 0x8c, 0x30,
+			0x6c, 0x53, 0xfa, 0xb6, 0x6a, 0x11, 0x7b, 0xce,
+			0xe0, 0x0f, 0x39, 0x40, 0x9f, 0x9f, 0xe4, 0xeb,
+			0xad, 0x7e, 0x7d, 0x3b, 0xe9, 0xd9, 0xba, 0x3b,
+			0xc8, 0x4c, 0xe6, 0x41, 0x83, 0x1c, 0xce, 0x04,
+			0xa2, 0x27, 0x18, 0x89, 0x2c, 0x04, 0x91, 0x57,
+			0x1c, 0x7a, 0xdd, 0x13, 0x67, 0x26, 0xb1, 0x76,
+			0x48, 0xf5, 0x71, 0x1d, 0x5f, 0x59, 0x1f, 0x36,
+			0x35, 0xa0, 0x8b, 0xe5, 0x8d, 0x82, 0xfe, 0xa9,
+			0x26, 0x59, 0xf9, 0x11, 0xce, 0x80, 0xf4, 0xb8,
+			0x68, 0x34, 0xc7, 0xe0, 0xa0, 0x5c, 0x94, 0x06,
+			0x6e, 0xa4, 0x07, 0x47, 0xac, 0x93, 0xe0, 0x62,
+			0x4e, 0x42, 0x1d, 0x11, 0x2c, 0x6a, 0x9a, 0x8d,
+			0xe5, 0x98, 0x62, 0x76, 0xcb, 0x38, 0x98, 0xb0,
+			0x06, 0x14, 0xc2, 0x95, 0xf0, 0x80, 0x30, 0x5e,
+			0x6a, 0xa3, 0x9b, 0x8c, 0x19, 0xb5, 0x7e, 0xf9,
+			0x46, 0x22, 0xd8, 0x2a, 0x72, 0x2a, 0xb6, 0x59,
+			0xfc, 0x0b, 0x56, 0xba, 0x9a, 0xd2, 0x0b, 0x41,
+			0x97, 0xc8, 0xba, 0x0d, 0xc6, 0x0b, 0x69, 0x9d,
+			0x3c, 0x14, 0xfc, 0x34, 0xca, 0xcb, 0x9b, 0x08,
+			0x9a, 0x1b, 0x5d, 0xa7, 0xd1, 0xe2, 0x3e, 0x3d,
+			0xd3, 0x9f, 0x63, 0x2a, 0x13, 0x91, 0x9d, 0x8f,
+			0x0c, 0x45, 0xae, 0x10, 0xca, 0x6c, 0x83, 0xef,
+			0x1e, 0xe3, 0x2c, 0xb8, 0xb2, 0x38, 0x89, 0x56,
+			0x2f, 0xca, 0x7d, 0x0c, 0x46, 0x8d, 0x96, 0xdd,
+			0x06, 0xc6, 0x7f, 0xd8, 0x59, 0xa2, 0x30, 0x0c,
+			0x3c, 0xbe, 0x1e, 0x61, 0x1c, 0x80, 0x4b, 0x1a,
+			0xeb, 0xb3, 0xc4, 0x5f, 0x9c, 0x73, 0xb3, 0xaf,
+			0x48, 0x41, 0x98, 0x66, 0xe0, 0x81, 0xbb, 0xd6,
+			0xa0, 0xe3, 0x8b, 0x8c, 0xf4, 0xb7, 0xc7, 0x84,
+			0x4a, 0xd9, 0x15, 0x2c, 0x4f, 0x58, 0x6e, 0xee,
+			0x1a, 0x02, 0x07, 0x3f, 0x09, 0x11, 0xb7, 0xb1,
+			0x67, 0x2b, 0xb2, 0x61, 0x3f, 0x81, 0xba, 0x15,
+			0x4e, 0x8b, 0xbe, 0x99, 0x9d, 0x2d, 0xc1, 0x21,
+			0x0c, 0x40, 0xf9, 0xa4, 0x62, 0x20, 0x61, 0x46,
+			0xb0, 0x02, 0x13, 0x3f, 0x31, 0x4a, 0xb0, 0x49,
+			0x21, 0x79, 0x9b, 0xe2, 0x98, 0x9f, 0x2f, 0x8f,
+			0x00, 0x2a, 0x79, 0xaf, 0x18, 0xbe, 0xfc, 0x6c,
+			0x4a, 0xc6, 0x57, 0x48, 0x4e, 0xec, 0xd1, 0x33,
+			0xc3, 0xcc, 0xb4, 0x4e, 0xa7, 0x79, 0x97, 0xc8,
+			0xb3, 0xee, 0x93, 0x7d, 0xd3, 0xeb, 0x1a, 0xdd,
+			0xac, 0x9c, 0x0b, 0x95, 0xc8, 0x80, 0x34, 0x46,
+			0x73, 0x30, 0x8e, 0xcc, 0x7c, 0x71, 0x5e, 0x6d,
+			0x96, 0xfa, 0x0e, 0x9e, 0x62, 0x58, 0x15, 0x55,
+			0xe6, 0xa7, 0x12, 0x51, 0xd7, 0xdb, 0xc2, 0xc3,
+			0x0d, 0xb8, 0x56, 0x35, 0xe3, 0x63, 0x5e, 0x72,
+			0x29, 0x53, 0x88, 0x47, 0x93, 0x41, 0x59, 0x51,
+			0x01, 0xc8, 0xb1, 0xec, 0x8d, 0x52, 0x5b, 0x4a,
+			0xe9, 0xba, 0xf6, 0xd8, 0x9d, 0xaa, 0x7c, 0x17,
+			0x99, 0x06, 0xf4, 0xae, 0x84, 0x19, 0x2c, 0x91,
+			0xd5, 0x67, 0x8e, 0x46, 0x88, 0x9b, 0xf7, 0x9e,
+			0x45, 0x06, 0xd2, 0x50, 0xb1, 0x2a, 0xbe, 0xea,
+			0x39, 0x2e, 0x1e, 0x86, 0x62, 0x39, 0x94, 0xd6,
+			0x33, 0xe8, 0xb9, 0xdf, 0x60, 0xaa, 0xde, 0x63,
+			0x55, 0x4e, 0x6e, 0xb4, 0x08, 0x45, 0x7c, 0x07,
+			0x7e, 0xea, 0xdf, 0x06, 0xb1, 0x0d, 0x96, 0x19,
+			0x59, 0x0b, 0xc5, 0xbc, 0xe3, 0x4c, 0x70, 0x61,
+			0xa7, 0x00, 0x89, 0x0a, 0x1e, 0xaa, 0xb8, 0x4a,
+			0xea, 0x1e, 0x4e, 0x97, 0x0f, 0xfd, 0xae, 0x7c
+		},
+	}
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPHINCS_TESTER_VECTORS_SHA2_256S_H */